@@ -0,0 +1,28 @@
+# Find the lz4 library.
+# Output variables:
+#  LZ4_INCLUDE_DIR : e.g., /usr/include/.
+#  LZ4_LIBRARY     : Library path of lz4 library
+#  LZ4_FOUND       : True if found.
+
+FIND_PATH(LZ4_INCLUDE_DIR NAME lz4.h HINTS
+    "$ENV{LIB_DIR}/include"
+    "$ENV{INCLUDE}"
+    /usr/local/include
+    /usr/local/opt/lz4/include
+)
+
+FIND_LIBRARY(LZ4_LIBRARY NAMES lz4 PATHS
+  "$ENV{LIB_DIR}/lib"
+  "$ENV{LIB}/lib"
+  /usr/local/lib
+  /usr/local/opt/lz4/lib
+  )
+
+IF (LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+    SET(LZ4_FOUND TRUE)
+    MESSAGE(STATUS "Found lz4 library: inc=${LZ4_INCLUDE_DIR}, lib=${LZ4_LIBRARY}")
+ELSE ()
+    SET(LZ4_FOUND FALSE)
+    MESSAGE(STATUS "WARNING: lz4 library not found.")
+    MESSAGE(STATUS "Try: 'sudo apt-get install liblz4-dev' (or brew install lz4)")
+ENDIF ()
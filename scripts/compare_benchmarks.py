@@ -46,8 +46,13 @@ with open(sys.argv[1]) as old_file:
 with open(sys.argv[2]) as new_file:
     new_data = json.load(new_file)
 
+# Newer result files contain latency percentiles, which are only compared if both files have them
+with_latencies = all('latency' in benchmark for benchmark in old_data['benchmarks'] + new_data['benchmarks'])
+
 table_data = []
 table_data.append(["Benchmark", "prev. iter/s", "runs", "new iter/s", "runs", "change", "p-value (significant if <" + str(p_value_significance_threshold) + ")"])
+if with_latencies:
+	table_data[0] += ["prev. p99 ms", "new p99 ms"]
 
 average_diff_sum = 0.0
 
@@ -65,11 +70,18 @@ for old, new in zip(old_data['benchmarks'], new_data['benchmarks']):
 	p_value_formatted = calculate_and_format_p_value(old, new)
 
 	table_data.append([old['name'], str(old['items_per_second']), str(old['iterations']), str(new['items_per_second']), str(new['iterations']), diff_formatted, p_value_formatted])
+	if with_latencies:
+		table_data[-1] += ['{0:.2f}'.format(old['latency']['p99'] / 1e6), '{0:.2f}'.format(new['latency']['p99'] / 1e6)]
 
 table_data.append(['average', '', '', '', '', format_diff(average_diff_sum / len(old_data['benchmarks'])), ''])
+if with_latencies:
+	table_data[-1] += ['', '']
 
 table = AsciiTable(table_data)
 table.justify_columns[6] = 'right'
+if with_latencies:
+	table.justify_columns[7] = 'right'
+	table.justify_columns[8] = 'right'
 
 print("")
 print(table.table)
@@ -0,0 +1,51 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "cache/cache.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto CACHE_CAPACITY = size_t{1024};
+
+// Half of the keys are cached at any time, like the SQL strings of a workload with more statements than cached plans
+constexpr auto KEY_COUNT = 2 * CACHE_CAPACITY;
+
+std::vector<std::string> generate_keys() {
+  auto keys = std::vector<std::string>{};
+  keys.reserve(KEY_COUNT);
+  for (auto key_idx = size_t{0}; key_idx < KEY_COUNT; ++key_idx) {
+    keys.emplace_back("SELECT * FROM table_" + std::to_string(key_idx) + " WHERE a = ?");
+  }
+  return keys;
+}
+
+}  // namespace
+
+namespace opossum {
+
+// All threads of a run share one cache, just like the sessions of the server share the plan caches
+template <size_t shard_count>
+void BM_CacheLookup(benchmark::State& state) {  // NOLINT
+  static const auto keys = generate_keys();
+  static auto cache = std::make_unique<Cache<std::shared_ptr<int>>>(CACHE_CAPACITY, shard_count);
+
+  auto random_engine = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto key_distribution = std::uniform_int_distribution<size_t>{0, KEY_COUNT - 1};
+  const auto value = std::make_shared<int>(state.thread_index);
+
+  for (auto _ : state) {
+    const auto& key = keys[key_distribution(random_engine)];
+    if (!cache->try_get(key)) cache->set(key, value);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_CacheLookup, 1)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheLookup, DefaultCacheShardCount)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,236 @@
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpcc/ch_benchmark_queries.hpp"
+#include "tpcc/tpcc_table_generator.hpp"
+#include "tpcc/tpcc_terminal.hpp"
+#include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
+#include "utils/latency_histogram.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark runs a mixed workload in the style of the CH-benCHmark: `--clients` TPC-C terminals (see TpccTerminal)
+ * execute the TPC-C transaction mix while `--analytical_clients` clients concurrently execute the analytical queries
+ * (see ch_benchmark_queries), each in a permuted order per round. All of them work on the same tables of the
+ * TpccTableGenerator with MVCC, so that the analytical queries validate the rows that the transactions keep inserting
+ * and invalidating, and both compete for the scheduler.
+ *
+ * It reports the tpmC and the abort rates of the transactions, the latencies of the analytical queries, and how many
+ * rows the tables have and how many of them were invalidated at the end. Comparing runs with different client mixes
+ * (e.g., `--analytical_clients 0` against `--analytical_clients 4`) shows how the two workloads interfere.
+ */
+
+namespace {
+
+struct AnalyticalQueryResult {
+  std::atomic<uint64_t> execution_count{0};
+  LatencyHistogram latency_histogram;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("CH-benCHmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Number of warehouses", cxxopts::value<int>()->default_value("1")) // NOLINT
+    ("analytical_clients", "Number of clients that execute the analytical queries", cxxopts::value<uint>()->default_value("1")) // NOLINT
+    ("q,queries", "Specify queries to run (comma-separated query ids, e.g. \"--queries 1,6,19\"), default is all", cxxopts::value<std::string>()); // NOLINT
+  // clang-format on
+
+  std::shared_ptr<BenchmarkConfig> config;
+  int num_warehouses;
+  uint32_t analytical_client_count;
+  std::string comma_separated_queries;
+
+  if (CLIConfigParser::cli_has_json_config(argc, argv)) {
+    // JSON config file was passed in
+    const auto json_config = CLIConfigParser::parse_json_config_file(argv[1]);
+    num_warehouses = json_config.value("scale", 1);
+    analytical_client_count = json_config.value("analytical_clients", 1u);
+    comma_separated_queries = json_config.value("queries", std::string(""));
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
+  } else {
+    // Parse regular command line args
+    const auto cli_parse_result = cli_options.parse(argc, argv);
+
+    if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+    num_warehouses = cli_parse_result["scale"].as<int>();
+    analytical_client_count = cli_parse_result["analytical_clients"].as<uint>();
+    if (cli_parse_result.count("queries")) {
+      comma_separated_queries = cli_parse_result["queries"].as<std::string>();
+    }
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
+  }
+
+  Assert(num_warehouses > 0, "TPC-C needs at least one warehouse");
+  Assert(!config->verify, "The CH-benCHmark cannot be verified against SQLite");
+
+  // Build list of query ids to be benchmarked, ignoring leading, trailing, or duplicate commas
+  auto query_ids = std::vector<size_t>{};
+  if (comma_separated_queries.empty()) {
+    for (const auto& [query_id, sql] : ch_benchmark_queries) query_ids.emplace_back(query_id);
+  } else {
+    auto query_ids_str = std::vector<std::string>();
+    boost::trim_if(comma_separated_queries, boost::is_any_of(","));
+    boost::split(query_ids_str, comma_separated_queries, boost::is_any_of(","), boost::token_compress_on);
+    for (const auto& query_id_str : query_ids_str) {
+      const auto query_id = boost::lexical_cast<size_t, std::string>(query_id_str);
+      Assert(ch_benchmark_queries.count(query_id), "CH-benCHmark query " + query_id_str + " is not supported");
+      query_ids.emplace_back(query_id);
+    }
+  }
+
+  std::cout << "- CH-benCHmark with " << num_warehouses << " warehouse(s), " << config->clients
+            << " transactional and " << analytical_client_count << " analytical client(s)" << std::endl;
+  std::cout << "- Benchmarking Queries: [ ";
+  for (const auto query_id : query_ids) std::cout << query_id << ", ";
+  std::cout << "]" << std::endl;
+
+  auto context = BenchmarkRunner::create_context(*config);
+  context.emplace("scale_factor", num_warehouses);
+  context.emplace("analytical_clients", analytical_client_count);
+  context["using_mvcc"] = true;
+
+  if (config->enable_scheduler) {
+    Topology::use_default_topology(config->cores);
+    std::cout << "- Multi-threaded Topology:" << std::endl;
+    Topology::get().print(std::cout, 2);
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  }
+
+  std::cout << "- Generating tables" << std::endl;
+  auto table_timer = Timer{};
+  auto table_generator = TpccTableGenerator{config->chunk_size, static_cast<size_t>(num_warehouses),
+                                            config->encoding_config};
+  for (const auto& [table_name, table] : table_generator.generate_all_tables()) {
+    StorageManager::get().add_table(table_name, table);
+  }
+  std::cout << "- Tables generated (" << table_timer.lap_formatted() << ")" << std::endl;
+
+  // The transactions and queries that finish during the warmup are not recorded
+  std::cout << "- Starting Benchmark..." << std::endl;
+  auto transactional_results = TpccTerminal::Results{};
+  auto analytical_results = std::vector<AnalyticalQueryResult>(query_ids.size());
+  const auto measurement_begin = std::chrono::steady_clock::now() + config->warmup_duration;
+  const auto benchmark_end = measurement_begin + config->max_duration;
+
+  auto clients = std::vector<std::thread>{};
+  for (auto terminal_id = uint32_t{0}; terminal_id < config->clients; ++terminal_id) {
+    clients.emplace_back([&, terminal_id]() {
+      TpccTerminal{num_warehouses, 42 + terminal_id}.run(measurement_begin, benchmark_end, transactional_results);
+    });
+  }
+
+  for (auto client_id = uint32_t{0}; client_id < analytical_client_count; ++client_id) {
+    clients.emplace_back([&, client_id]() {
+      auto random_engine = std::mt19937{client_id};
+      auto query_indices = std::vector<size_t>(query_ids.size());
+      std::iota(query_indices.begin(), query_indices.end(), size_t{0});
+
+      while (std::chrono::steady_clock::now() < benchmark_end) {
+        std::shuffle(query_indices.begin(), query_indices.end(), random_engine);
+
+        for (const auto query_index : query_indices) {
+          if (std::chrono::steady_clock::now() >= benchmark_end) break;
+
+          const auto query_begin = std::chrono::steady_clock::now();
+          SQLPipelineBuilder{ch_benchmark_queries.at(query_ids[query_index])}.create_pipeline().get_result_table();
+          const auto query_end = std::chrono::steady_clock::now();
+          if (query_begin < measurement_begin || query_end > benchmark_end) continue;
+
+          auto& result = analytical_results[query_index];
+          ++result.execution_count;
+          result.latency_histogram.record(query_end - query_begin);
+        }
+      }
+    });
+  }
+  for (auto& client : clients) client.join();
+
+  std::cout << "- Transactional results:" << std::endl;
+  const auto procedures_json = TpccTerminal::report(transactional_results);
+  const auto tpmc = TpccTerminal::tpmc(transactional_results, config->max_duration);
+  std::cout << "  -> tpmC: " << std::fixed << std::setprecision(1) << tpmc << std::endl;
+
+  std::cout << "- Analytical results:" << std::endl;
+  auto queries_json = nlohmann::json::array();
+  for (auto query_index = size_t{0}; query_index < query_ids.size(); ++query_index) {
+    const auto& result = analytical_results[query_index];
+    const auto& latency_histogram = result.latency_histogram;
+    std::cout << "  -> Q" << std::setw(2) << std::left << query_ids[query_index] << " executed "
+              << result.execution_count << " times, latency p50 "
+              << format_duration(latency_histogram.percentile(50.0)) << ", p99 "
+              << format_duration(latency_histogram.percentile(99.0)) << std::endl;
+
+    queries_json.push_back({{"name", "CH-benCHmark " + std::to_string(query_ids[query_index])},
+                            {"executions", result.execution_count.load()},
+                            {"latency", latency_histogram.to_json()}});
+  }
+
+  // The rows that the transactions inserted and invalidated, which the analytical queries have to validate
+  std::cout << "- Tables after the benchmark:" << std::endl;
+  auto tables_json = nlohmann::json::array();
+  {
+    const auto tables = SQLPipelineBuilder{
+        "SELECT table_name, SUM(row_count), SUM(invalid_row_count) FROM meta_chunks GROUP BY table_name "
+        "ORDER BY table_name"}
+                            .create_pipeline()
+                            .get_result_table();
+    PerformanceWarningDisabler performance_warning_disabler;
+    for (auto row = size_t{0}; row < tables->row_count(); ++row) {
+      const auto table_name = tables->get_value<std::string>(ColumnID{0}, row);
+      const auto row_count = tables->get_value<int64_t>(ColumnID{1}, row);
+      const auto invalid_row_count = tables->get_value<int64_t>(ColumnID{2}, row);
+      std::cout << "  -> " << std::setw(10) << std::left << table_name << " " << row_count << " rows, "
+                << invalid_row_count << " of them invalidated" << std::endl;
+      tables_json.push_back(
+          {{"name", table_name}, {"row_count", row_count}, {"invalid_row_count", invalid_row_count}});
+    }
+  }
+
+  if (config->output_file_path) {
+    const auto report = nlohmann::json{{"context", context},
+                                       {"warehouses", num_warehouses},
+                                       {"terminals", config->clients},
+                                       {"analytical_clients", analytical_client_count},
+                                       {"tpmC", tpmc},
+                                       {"procedures", procedures_json},
+                                       {"queries", queries_json},
+                                       {"tables", tables_json}};
+    std::ofstream output_file(*config->output_file_path);
+    output_file << std::setw(2) << report << std::endl;
+  }
+
+  if (CurrentScheduler::is_set()) CurrentScheduler::get()->finish();
+}
@@ -0,0 +1,328 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cost_model/cost_model_physical.hpp"
+#include "cxxopts.hpp"
+#include "expression/expression_functional.hpp"
+#include "json.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;                         // NOLINT
+using namespace opossum::expression_functional;  // NOLINT
+
+/**
+ * Fits the coefficients of the CostModelPhysical to the runtimes of the operators on the current hardware and prints
+ * them as JSON, which can be read into PhysicalCostCoefficients.
+ *
+ * Every operator runs on generated tables of a single integer column with uniformly distributed values. For each
+ * LinearCostFunction, the weights are fitted to the median runtimes by a least squares regression on the features of
+ * CostModelPhysical::features(). The residuals are relative to the runtime, so that small operators are fitted as well
+ * as large ones. Features whose weight would become negative are dropped, as a negative cost has no physical meaning.
+ */
+
+namespace {
+
+constexpr auto CHUNK_SIZE = size_t{100'000};
+
+// All tables draw their values from the same range, so that the output row count of a join is not proportional to
+// the row count of one of its inputs, which would make their weights indistinguishable
+constexpr auto MAX_VALUE = 1'000'000.0;
+
+struct Measurement {
+  std::vector<float> features;
+  float runtime_ns;
+};
+
+std::shared_ptr<TableWrapper> generate_table(const size_t row_count, const bool create_indexes) {
+  const auto column_data_distribution = ColumnDataDistribution::make_uniform_config(0.0, MAX_VALUE);
+  const auto chunk_size = std::min(row_count, CHUNK_SIZE);
+  const auto table =
+      TableGenerator{}.generate_table({column_data_distribution}, row_count, chunk_size, EncodingType::Dictionary);
+
+  if (create_indexes) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    }
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+// Returns the median runtime of creating and executing the operator of @param make_operator, and its output row count
+template <typename MakeOperator>
+std::pair<float, float> measure(const MakeOperator& make_operator, const size_t run_count) {
+  auto runtimes = std::vector<float>{};
+  auto output_row_count = 0.0f;
+
+  for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+    const auto begin = std::chrono::steady_clock::now();
+    const auto op = make_operator();
+    op->execute();
+    const auto end = std::chrono::steady_clock::now();
+
+    runtimes.emplace_back(std::chrono::duration<float, std::nano>(end - begin).count());
+    output_row_count = static_cast<float>(op->get_output()->row_count());
+  }
+
+  std::nth_element(runtimes.begin(), runtimes.begin() + runtimes.size() / 2, runtimes.end());
+  return {runtimes[runtimes.size() / 2], output_row_count};
+}
+
+// Solves the linear system by Gaussian elimination with partial pivoting. Returns false if it is singular.
+bool solve(std::vector<std::vector<double>>& matrix, std::vector<double>& vector) {
+  const auto size = vector.size();
+  for (auto column_idx = size_t{0}; column_idx < size; ++column_idx) {
+    auto pivot_idx = column_idx;
+    for (auto row_idx = column_idx + 1; row_idx < size; ++row_idx) {
+      if (std::abs(matrix[row_idx][column_idx]) > std::abs(matrix[pivot_idx][column_idx])) pivot_idx = row_idx;
+    }
+    if (std::abs(matrix[pivot_idx][column_idx]) < 1e-12) return false;
+    std::swap(matrix[column_idx], matrix[pivot_idx]);
+    std::swap(vector[column_idx], vector[pivot_idx]);
+
+    for (auto row_idx = column_idx + 1; row_idx < size; ++row_idx) {
+      const auto factor = matrix[row_idx][column_idx] / matrix[column_idx][column_idx];
+      for (auto idx = column_idx; idx < size; ++idx) {
+        matrix[row_idx][idx] -= factor * matrix[column_idx][idx];
+      }
+      vector[row_idx] -= factor * vector[column_idx];
+    }
+  }
+
+  for (auto column_idx = size; column_idx-- > 0;) {
+    for (auto idx = column_idx + 1; idx < size; ++idx) {
+      vector[column_idx] -= matrix[column_idx][idx] * vector[idx];
+    }
+    vector[column_idx] /= matrix[column_idx][column_idx];
+  }
+  return true;
+}
+
+// Fits setup and weights to the measurements, see the comment at the top of the file
+LinearCostFunction fit(const std::vector<Measurement>& measurements, const size_t feature_count) {
+
+  // Index 0 is the setup, i.e., a constant feature of 1
+  auto active = std::vector<bool>(feature_count + 1, true);
+
+  while (true) {
+    auto active_indices = std::vector<size_t>{};
+    for (auto idx = size_t{0}; idx < active.size(); ++idx) {
+      if (active[idx]) active_indices.emplace_back(idx);
+    }
+    if (active_indices.empty()) return LinearCostFunction{0.0f, std::vector<Cost>(feature_count, 0.0f)};
+
+    // Normal equations of the relative residuals: every measurement is divided by its runtime
+    const auto size = active_indices.size();
+    auto matrix = std::vector<std::vector<double>>(size, std::vector<double>(size, 0.0));
+    auto vector = std::vector<double>(size, 0.0);
+    for (const auto& measurement : measurements) {
+      auto row = std::vector<double>(size);
+      for (auto idx = size_t{0}; idx < size; ++idx) {
+        const auto feature_idx = active_indices[idx];
+        const auto feature = feature_idx == 0 ? 1.0 : static_cast<double>(measurement.features[feature_idx - 1]);
+        row[idx] = feature / measurement.runtime_ns;
+      }
+      for (auto row_idx = size_t{0}; row_idx < size; ++row_idx) {
+        for (auto column_idx = size_t{0}; column_idx < size; ++column_idx) {
+          matrix[row_idx][column_idx] += row[row_idx] * row[column_idx];
+        }
+        vector[row_idx] += row[row_idx];
+      }
+    }
+
+    // Linearly dependent features cannot be told apart, so the last of them is dropped
+    if (!solve(matrix, vector)) {
+      active[active_indices.back()] = false;
+      continue;
+    }
+
+    // Drop the most negative coefficient and fit again without it
+    const auto min_iter = std::min_element(vector.begin(), vector.end());
+    if (*min_iter < 0.0) {
+      active[active_indices[std::distance(vector.begin(), min_iter)]] = false;
+      continue;
+    }
+
+    auto cost_function = LinearCostFunction{0.0f, std::vector<Cost>(feature_count, 0.0f)};
+    for (auto idx = size_t{0}; idx < size; ++idx) {
+      const auto feature_idx = active_indices[idx];
+      if (feature_idx == 0) {
+        cost_function.setup = static_cast<Cost>(vector[idx]);
+      } else {
+        cost_function.weights[feature_idx - 1] = static_cast<Cost>(vector[idx]);
+      }
+    }
+    return cost_function;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"hyriseCostModelCalibration",
+                                      "Fits the coefficients of the CostModelPhysical to the current hardware"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("r,runs", "Number of runs per measurement, of which the median is used", cxxopts::value<size_t>()->default_value("5")) // NOLINT
+    ("o,output", "File to write the coefficients to, as JSON", cxxopts::value<std::string>()->default_value("")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help({}) << std::endl;
+    return 0;
+  }
+
+  const auto run_count = cli_parse_result["runs"].as<size_t>();
+  Assert(run_count > 0, "Need at least one run per measurement");
+
+  const auto row_counts = std::vector<size_t>{1'000, 10'000, 100'000, 1'000'000};
+  const auto probe_row_counts = std::vector<size_t>{10, 100, 1'000, 10'000};
+  const auto nested_loop_row_counts = std::vector<size_t>{100, 1'000, 3'000};
+
+  std::cerr << "Generating tables" << std::endl;
+  auto tables = std::unordered_map<size_t, std::shared_ptr<TableWrapper>>{};
+  for (const auto row_count : row_counts) tables.emplace(row_count, generate_table(row_count, true));
+  for (const auto row_count : probe_row_counts) tables.emplace(row_count, generate_table(row_count, false));
+  for (const auto row_count : nested_loop_row_counts) tables.emplace(row_count, generate_table(row_count, false));
+
+  auto measurements = std::unordered_map<OperatorType, std::vector<Measurement>>{};
+
+  const auto measure_join = [&](const OperatorType join_type, const size_t left_row_count,
+                                const size_t right_row_count, const auto& make_join) {
+    const auto& left = tables.at(left_row_count);
+    const auto& right = tables.at(right_row_count);
+    const auto [runtime_ns, output_row_count] = measure([&]() { return make_join(left, right); }, run_count);
+    const auto right_chunk_count = right->get_output()->chunk_count();
+    measurements[join_type].emplace_back(
+        Measurement{CostModelPhysical::features(join_type, static_cast<float>(left_row_count),
+                                                static_cast<float>(right_row_count), output_row_count,
+                                                right_chunk_count),
+                    runtime_ns});
+  };
+
+  const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+
+  std::cerr << "Measuring joins" << std::endl;
+  for (const auto left_row_count : row_counts) {
+    for (const auto right_row_count : row_counts) {
+      measure_join(OperatorType::JoinHash, left_row_count, right_row_count, [&](const auto& left, const auto& right) {
+        return std::make_shared<JoinHash>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+      });
+      measure_join(OperatorType::JoinSortMerge, left_row_count, right_row_count,
+                   [&](const auto& left, const auto& right) {
+                     return std::make_shared<JoinSortMerge>(left, right, JoinMode::Inner, column_ids,
+                                                            PredicateCondition::Equals);
+                   });
+    }
+  }
+
+  for (const auto left_row_count : probe_row_counts) {
+    for (const auto right_row_count : row_counts) {
+      measure_join(OperatorType::JoinIndex, left_row_count, right_row_count, [&](const auto& left, const auto& right) {
+        return std::make_shared<JoinIndex>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+      });
+    }
+  }
+
+  for (const auto left_row_count : nested_loop_row_counts) {
+    for (const auto right_row_count : nested_loop_row_counts) {
+      measure_join(OperatorType::JoinNestedLoop, left_row_count, right_row_count,
+                   [&](const auto& left, const auto& right) {
+                     return std::make_shared<JoinNestedLoop>(left, right, JoinMode::Inner, column_ids,
+                                                             PredicateCondition::Equals);
+                   });
+    }
+  }
+
+  std::cerr << "Measuring scans" << std::endl;
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  for (const auto row_count : row_counts) {
+    const auto& table = tables.at(row_count);
+    const auto chunk_count = table->get_output()->chunk_count();
+
+    auto all_chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) all_chunk_ids.emplace_back(chunk_id);
+
+    for (const auto selectivity : {0.0001, 0.001, 0.01, 0.1, 0.5, 1.0}) {
+      const auto value = static_cast<int32_t>(selectivity * MAX_VALUE);
+
+      const auto [table_scan_runtime_ns, table_scan_output_row_count] = measure(
+          [&]() { return std::make_shared<TableScan>(table, less_than_(column_a, value)); }, run_count);
+      measurements[OperatorType::TableScan].emplace_back(
+          Measurement{CostModelPhysical::features(OperatorType::TableScan, static_cast<float>(row_count), 0.0f,
+                                                  table_scan_output_row_count),
+                      table_scan_runtime_ns});
+
+      // Like the LQPTranslator, combine the IndexScan with a TableScan of the chunks without index, of which there are
+      // none here
+      const auto [index_scan_runtime_ns, index_scan_output_row_count] = measure(
+          [&]() {
+            const auto index_scan =
+                std::make_shared<IndexScan>(table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                            PredicateCondition::LessThan, std::vector<AllTypeVariant>{value});
+            index_scan->set_included_chunk_ids(all_chunk_ids);
+            index_scan->execute();
+
+            const auto table_scan = std::make_shared<TableScan>(table, less_than_(column_a, value));
+            table_scan->set_excluded_chunk_ids(all_chunk_ids);
+            table_scan->execute();
+
+            return std::make_shared<UnionPositions>(index_scan, table_scan);
+          },
+          run_count);
+      measurements[OperatorType::IndexScan].emplace_back(
+          Measurement{CostModelPhysical::features(OperatorType::IndexScan, static_cast<float>(row_count), 0.0f,
+                                                  index_scan_output_row_count, chunk_count),
+                      index_scan_runtime_ns});
+    }
+  }
+
+  const auto default_cost_model = CostModelPhysical{};
+  const auto fit_cost_function = [&](const OperatorType operator_type) {
+    return fit(measurements.at(operator_type), default_cost_model.cost_function(operator_type).weights.size());
+  };
+
+  auto coefficients = PhysicalCostCoefficients{};
+  coefficients.join_hash = fit_cost_function(OperatorType::JoinHash);
+  coefficients.join_sort_merge = fit_cost_function(OperatorType::JoinSortMerge);
+  coefficients.join_index = fit_cost_function(OperatorType::JoinIndex);
+  coefficients.join_nested_loop = fit_cost_function(OperatorType::JoinNestedLoop);
+  coefficients.table_scan = fit_cost_function(OperatorType::TableScan);
+  coefficients.index_scan = fit_cost_function(OperatorType::IndexScan);
+
+  const auto json = nlohmann::json(coefficients).dump(2);
+  std::cout << json << std::endl;
+
+  const auto output_path = cli_parse_result["output"].as<std::string>();
+  if (!output_path.empty()) {
+    auto output_file = std::ofstream{output_path};
+    output_file << json << std::endl;
+  }
+
+  return 0;
+}
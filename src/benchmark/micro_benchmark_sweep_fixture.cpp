@@ -0,0 +1,135 @@
+#include "micro_benchmark_sweep_fixture.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "operators/abstract_operator.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "types.hpp"
+
+namespace {
+
+// The baseline configuration of the sweeps, from which one argument at a time is varied
+constexpr auto BASELINE_ROW_COUNT = int64_t{1'000'000};
+constexpr auto BASELINE_CHUNK_SIZE = int64_t{100'000};
+constexpr auto BASELINE_ENCODING_INDEX = int64_t{1};  // Dictionary
+constexpr auto BASELINE_DISTINCT_VALUE_COUNT = int64_t{10'000};
+constexpr auto BASELINE_ZIPF_EXPONENT = int64_t{0};
+constexpr auto BASELINE_SELECTIVITY = int64_t{10};
+
+const auto SWEEP_ROW_COUNTS = std::vector<int64_t>{10'000, 100'000, 1'000'000, 10'000'000};
+const auto SWEEP_CHUNK_SIZES = std::vector<int64_t>{1'000, 10'000, 100'000, 1'000'000};
+const auto SWEEP_DISTINCT_VALUE_COUNTS = std::vector<int64_t>{10, 1'000, 10'000, 100'000, 1'000'000};
+const auto SWEEP_ZIPF_EXPONENTS = std::vector<int64_t>{0, 50, 100, 150};
+const auto SWEEP_SELECTIVITIES = std::vector<int64_t>{1, 10, 50, 90, 100};
+
+void add_sweep_arguments(benchmark::internal::Benchmark* benchmark, const bool with_selectivity) {
+  auto baseline = std::vector<int64_t>{BASELINE_ROW_COUNT, BASELINE_CHUNK_SIZE, BASELINE_ENCODING_INDEX,
+                                       BASELINE_DISTINCT_VALUE_COUNT, BASELINE_ZIPF_EXPONENT};
+  if (with_selectivity) baseline.emplace_back(BASELINE_SELECTIVITY);
+
+  // Adds the configuration that differs from the baseline in the argument at @param index
+  const auto add_arguments = [&](const size_t index, const int64_t value) {
+    auto arguments = baseline;
+    arguments[index] = value;
+    benchmark->Args(arguments);
+  };
+
+  // The baseline itself is part of every sweep. It is only added by the sweep of the row counts.
+  for (const auto row_count : SWEEP_ROW_COUNTS) add_arguments(0, row_count);
+  for (const auto chunk_size : SWEEP_CHUNK_SIZES) {
+    if (chunk_size != BASELINE_CHUNK_SIZE) add_arguments(1, chunk_size);
+  }
+  for (auto encoding_index = int64_t{0};
+       encoding_index < static_cast<int64_t>(opossum::MicroBenchmarkSweepFixture::SWEEP_ENCODING_TYPES.size());
+       ++encoding_index) {
+    if (encoding_index != BASELINE_ENCODING_INDEX) add_arguments(2, encoding_index);
+  }
+  for (const auto distinct_value_count : SWEEP_DISTINCT_VALUE_COUNTS) {
+    if (distinct_value_count != BASELINE_DISTINCT_VALUE_COUNT) add_arguments(3, distinct_value_count);
+  }
+  for (const auto zipf_exponent : SWEEP_ZIPF_EXPONENTS) {
+    if (zipf_exponent != BASELINE_ZIPF_EXPONENT) add_arguments(4, zipf_exponent);
+  }
+  if (!with_selectivity) return;
+  for (const auto selectivity : SWEEP_SELECTIVITIES) {
+    if (selectivity != BASELINE_SELECTIVITY) add_arguments(5, selectivity);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+const std::vector<EncodingType> MicroBenchmarkSweepFixture::SWEEP_ENCODING_TYPES = {
+    EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference,
+    EncodingType::Delta};
+
+void MicroBenchmarkSweepFixture::SetUp(::benchmark::State& state) {
+  _row_count = static_cast<size_t>(state.range(0));
+  const auto chunk_size = static_cast<size_t>(state.range(1));
+  const auto encoding_type = SWEEP_ENCODING_TYPES.at(state.range(2));
+  _distinct_value_count = static_cast<int>(state.range(3));
+  const auto zipf_exponent = static_cast<double>(state.range(4)) / 100.0;
+
+  // An exponent of zero yields uniformly distributed values
+  const auto column_data_distribution =
+      ColumnDataDistribution::make_zipf_config(_distinct_value_count, zipf_exponent);
+
+  auto table_generator = TableGenerator{};
+  _table_wrapper_a = std::make_shared<TableWrapper>(table_generator.generate_table(
+      {column_data_distribution, column_data_distribution}, _row_count, chunk_size, encoding_type));
+  _table_wrapper_b = std::make_shared<TableWrapper>(table_generator.generate_table(
+      {column_data_distribution, column_data_distribution}, _row_count, chunk_size, encoding_type));
+  _table_wrapper_a->execute();
+  _table_wrapper_b->execute();
+
+  auto weight_sum = 0.0;
+  auto squared_weight_sum = 0.0;
+  for (auto value = 1; value <= _distinct_value_count; ++value) {
+    const auto weight = 1.0 / std::pow(static_cast<double>(value), zipf_exponent);
+    weight_sum += weight;
+    squared_weight_sum += weight * weight;
+  }
+  _equi_join_selectivity = squared_weight_sum / (weight_sum * weight_sum);
+}
+
+void MicroBenchmarkSweepFixture::TearDown(::benchmark::State&) {
+  _table_wrapper_a = nullptr;
+  _table_wrapper_b = nullptr;
+  StorageManager::get().reset();
+}
+
+void MicroBenchmarkSweepFixture::sweep(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"rows", "chunk_size", "encoding", "distinct", "zipf"});
+  add_sweep_arguments(benchmark, false);
+}
+
+void MicroBenchmarkSweepFixture::sweep_with_selectivity(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"rows", "chunk_size", "encoding", "distinct", "zipf", "selectivity"});
+  add_sweep_arguments(benchmark, true);
+}
+
+void MicroBenchmarkSweepFixture::_run(benchmark::State& state,
+                                      const std::function<std::shared_ptr<AbstractOperator>()>& operator_factory) {
+  auto warm_up = operator_factory();
+  warm_up->execute();
+  const auto output_row_count = warm_up->get_output()->row_count();
+  warm_up = nullptr;
+
+  for (auto _ : state) {
+    auto op = operator_factory();
+    op->execute();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(_row_count));
+  state.counters["output_rows"] = static_cast<double>(output_row_count);
+  state.counters["selectivity"] = static_cast<double>(output_row_count) / static_cast<double>(_row_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class TableWrapper;
+
+/**
+ * Fixture for micro benchmarks that sweep the data an operator processes instead of using the fixed tables of the
+ * MicroBenchmarkBasicFixture. The benchmark arguments are
+ *   0: the row count of the tables,
+ *   1: the chunk size,
+ *   2: the index of the encoding in SWEEP_ENCODING_TYPES,
+ *   3: the number of distinct values per column, and
+ *   4: the Zipf exponent of the values in hundredths (0 is uniform, see ColumnDataDistribution::make_zipf_config).
+ * The table scans add their selectivity in percent as argument 5.
+ *
+ * Register a benchmark with ->Apply(MicroBenchmarkSweepFixture::sweep) to vary one argument at a time, starting from
+ * the baseline configuration, which shows where an operator falls off as its data changes. Runs with
+ * `--benchmark_out=<file> --benchmark_out_format=json` can be compared with the compare.py of google benchmark for
+ * regression tracking, or used to calibrate the cost model against.
+ */
+class MicroBenchmarkSweepFixture : public benchmark::Fixture {
+ public:
+  static const std::vector<EncodingType> SWEEP_ENCODING_TYPES;
+
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State&) override;
+
+  static void sweep(benchmark::internal::Benchmark* benchmark);
+  static void sweep_with_selectivity(benchmark::internal::Benchmark* benchmark);
+
+ protected:
+  // Runs the operator created by @param operator_factory once to warm up and then once per iteration. Reports the
+  // input rows per second, the output rows, and their ratio to the input rows as counters.
+  void _run(benchmark::State& state, const std::function<std::shared_ptr<AbstractOperator>()>& operator_factory);
+
+  // The two columns of the tables have the same distribution, the tables are generated independently
+  std::shared_ptr<TableWrapper> _table_wrapper_a;
+  std::shared_ptr<TableWrapper> _table_wrapper_b;
+
+  size_t _row_count = 0;
+  int _distinct_value_count = 0;
+
+  // The probability that two values of a column are equal, i.e., the selectivity of an equi join of the two tables
+  double _equi_join_selectivity = 0.0;
+};
+
+}  // namespace opossum
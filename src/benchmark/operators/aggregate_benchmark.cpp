@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "../micro_benchmark_basic_fixture.hpp"
+#include "../micro_benchmark_sweep_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "operators/aggregate.hpp"
 #include "operators/table_wrapper.hpp"
@@ -24,4 +25,12 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Aggregate)(benchmark::State& state) {
   }
 }
 
+BENCHMARK_DEFINE_F(MicroBenchmarkSweepFixture, BM_AggregateSweep)(benchmark::State& state) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Min}};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}};
+
+  _run(state, [&]() { return std::make_shared<Aggregate>(_table_wrapper_a, aggregates, groupby); });
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkSweepFixture, BM_AggregateSweep)->Apply(MicroBenchmarkSweepFixture::sweep);
+
 }  // namespace opossum
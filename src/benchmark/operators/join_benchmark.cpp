@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
 
+#include "../micro_benchmark_sweep_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "operators/join_hash.hpp"
 #include "operators/join_index.hpp"
@@ -10,6 +17,7 @@
 #include "storage/chunk.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
 #include "table_generator.hpp"
 
 namespace {
@@ -20,6 +28,14 @@ constexpr auto NUMBER_OF_CHUNKS = size_t{50};
 constexpr auto TABLE_SIZE_SMALL = size_t{1'000};
 constexpr auto TABLE_SIZE_MEDIUM = size_t{100'000};
 constexpr auto TABLE_SIZE_BIG = size_t{10'000'000};
+
+// Configurations of the sweeps whose join result would exceed this are skipped, e.g., joining 1,000,000 rows with
+// only 10 distinct values
+constexpr auto MAX_SWEEP_JOIN_OUTPUT_ROW_COUNT = 100'000'000.0;
+
+// Build and probe side of BM_JoinHashPartitionSize
+constexpr auto PARTITION_SIZE_BUILD_ROW_COUNT = size_t{1'000'000};
+constexpr auto PARTITION_SIZE_PROBE_ROW_COUNT = size_t{4'000'000};
 }  // namespace
 
 namespace opossum {
@@ -100,6 +116,80 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+template <class C>
+std::function<std::shared_ptr<AbstractOperator>()> make_join_factory(
+    const std::shared_ptr<TableWrapper>& table_wrapper_left, const std::shared_ptr<TableWrapper>& table_wrapper_right) {
+  return [=]() {
+    return std::make_shared<C>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+                               std::pair<ColumnID, ColumnID>{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  };
+}
+
+BENCHMARK_DEFINE_F(MicroBenchmarkSweepFixture, BM_JoinHashSweep)(benchmark::State& state) {
+  if (_equi_join_selectivity * static_cast<double>(_row_count * _row_count) > MAX_SWEEP_JOIN_OUTPUT_ROW_COUNT) {
+    state.SkipWithError("Join result too large");
+    return;
+  }
+  _run(state, make_join_factory<JoinHash>(_table_wrapper_a, _table_wrapper_b));
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkSweepFixture, BM_JoinHashSweep)->Apply(MicroBenchmarkSweepFixture::sweep);
+
+// A table with a single int column holding @param values, in chunks of Chunk::DEFAULT_SIZE rows
+std::shared_ptr<TableWrapper> create_int_table(const std::vector<int32_t>& values) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (auto begin = size_t{0}; begin < values.size(); begin += Chunk::DEFAULT_SIZE) {
+    const auto end = std::min(begin + Chunk::DEFAULT_SIZE, values.size());
+    auto chunk_values = std::vector<int32_t>(values.begin() + begin, values.begin() + end);
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(chunk_values))});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+/**
+ * Joins 1,000,000 distinct keys with 4,000,000 probe rows that match one of them each. The radix bits are chosen so
+ * that the hash table of each partition (about 32 bytes per key) fits into the L1 cache (12 bits, 8 KB), the L2 cache
+ * (9 bits, 64 KB), the L3 cache (5 bits, 1 MB), or none of them (1 bit, 16 MB), which shows how well the probe phase
+ * hides the cache misses of the lookups.
+ */
+void BM_JoinHashPartitionSize(benchmark::State& state) {  // NOLINT
+  auto random_engine = std::mt19937{42};
+
+  auto build_values = std::vector<int32_t>(PARTITION_SIZE_BUILD_ROW_COUNT);
+  std::iota(build_values.begin(), build_values.end(), 0);
+  std::shuffle(build_values.begin(), build_values.end(), random_engine);
+
+  auto probe_values = std::vector<int32_t>(PARTITION_SIZE_PROBE_ROW_COUNT);
+  auto distribution = std::uniform_int_distribution<int32_t>{0, static_cast<int32_t>(build_values.size() - 1)};
+  for (auto& value : probe_values) value = distribution(random_engine);
+
+  const auto table_wrapper_left = create_int_table(build_values);
+  const auto table_wrapper_right = create_int_table(probe_values);
+  const auto radix_bits = static_cast<size_t>(state.range(0));
+
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+                                           ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                           radix_bits);
+    join->execute();
+  }
+}
+BENCHMARK(BM_JoinHashPartitionSize)->ArgName("radix_bits")->Arg(12)->Arg(9)->Arg(5)->Arg(1);
+
+BENCHMARK_DEFINE_F(MicroBenchmarkSweepFixture, BM_JoinSortMergeSweep)(benchmark::State& state) {
+  if (_equi_join_selectivity * static_cast<double>(_row_count * _row_count) > MAX_SWEEP_JOIN_OUTPUT_ROW_COUNT) {
+    state.SkipWithError("Join result too large");
+    return;
+  }
+  _run(state, make_join_factory<JoinSortMerge>(_table_wrapper_a, _table_wrapper_b));
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkSweepFixture, BM_JoinSortMergeSweep)->Apply(MicroBenchmarkSweepFixture::sweep);
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -3,6 +3,7 @@
 #include "benchmark/benchmark.h"
 
 #include "../micro_benchmark_basic_fixture.hpp"
+#include "../micro_benchmark_sweep_fixture.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
 
@@ -19,4 +20,9 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Sort)(benchmark::State& state) {
   }
 }
 
+BENCHMARK_DEFINE_F(MicroBenchmarkSweepFixture, BM_SortSweep)(benchmark::State& state) {
+  _run(state, [&]() { return std::make_shared<Sort>(_table_wrapper_a, ColumnID{0}, OrderByMode::Ascending); });
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkSweepFixture, BM_SortSweep)->Apply(MicroBenchmarkSweepFixture::sweep);
+
 }  // namespace opossum
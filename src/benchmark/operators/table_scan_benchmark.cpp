@@ -1,6 +1,7 @@
 #include <memory>
 
 #include "../micro_benchmark_basic_fixture.hpp"
+#include "../micro_benchmark_sweep_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
@@ -58,6 +59,17 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+// The values are below the bound with the given selectivity if they are uniformly distributed. For Zipf distributed
+// values, the measured selectivity is reported.
+BENCHMARK_DEFINE_F(MicroBenchmarkSweepFixture, BM_TableScanSweep)(benchmark::State& state) {
+  const auto bound = static_cast<int32_t>(_distinct_value_count * state.range(5) / 100);
+  const auto predicate = less_than_(pqp_column_(ColumnID{0}, DataType::Int, false, ""), value_(bound));
+
+  _run(state, [&]() { return std::make_shared<TableScan>(_table_wrapper_a, predicate); });
+}
+BENCHMARK_REGISTER_F(MicroBenchmarkSweepFixture, BM_TableScanSweep)
+    ->Apply(MicroBenchmarkSweepFixture::sweep_with_selectivity);
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
@@ -0,0 +1,77 @@
+#include <cxxopts.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "benchmark_config.hpp"
+#include "benchmark_runner.hpp"
+#include "file_based_table_generator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "server/query_log.hpp"
+#include "utils/format_duration.hpp"
+#include "workload_replayer.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Replays the queries that the server recorded in its query log (see QueryLog) on the tables of a directory, with the
+// scheduler that the server uses, and reports the latency distribution of the queries.
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"Hyrise Workload Replay Benchmark"};
+
+  // clang-format off
+  cli_options.add_options()
+      ("help", "print a summary of CLI options")
+      ("query_log", "Query log that the server recorded (HYRISE_QUERY_LOG)", cxxopts::value<std::string>()->default_value("")) // NOLINT
+      ("table_path", "Directory containing the Tables", cxxopts::value<std::string>()->default_value("")) // NOLINT
+      ("speedup", "Factor by which the queries are issued faster than recorded, 0 issues them without waiting", cxxopts::value<double>()->default_value("1")) // NOLINT
+      ("cores", "Specify the number of cores used by the scheduler. 0 means all available cores", cxxopts::value<uint>()->default_value("0")) // NOLINT
+      ("o,output", "File to output results to, don't specify for stdout", cxxopts::value<std::string>()->default_value("")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  const auto query_log_path = cli_parse_result["query_log"].as<std::string>();
+  const auto table_path = cli_parse_result["table_path"].as<std::string>();
+  if (cli_parse_result.count("help") || query_log_path.empty() || table_path.empty()) {
+    std::cout << cli_options.help({}) << std::endl;
+    return cli_parse_result.count("help") ? 0 : 1;
+  }
+
+  auto benchmark_config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  benchmark_config->enable_scheduler = true;
+  benchmark_config->cores = cli_parse_result["cores"].as<uint>();
+  FileBasedTableGenerator{benchmark_config, table_path}.generate_and_store();
+
+  auto entries = QueryLog::read(query_log_path);
+  std::cout << "- Replaying " << entries.size() << " queries from " << query_log_path << std::endl;
+
+  Topology::use_default_topology(benchmark_config->cores);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto result = WorkloadReplayer{std::move(entries), cli_parse_result["speedup"].as<double>()}.replay();
+  CurrentScheduler::get()->finish();
+
+  std::cout << "- Replayed " << result.query_count << " queries (" << result.failed_query_count << " failed) in "
+            << format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(result.duration)) << std::endl;
+  for (const auto percentile : {50.0, 90.0, 99.0, 99.9}) {
+    std::cout << "  p" << percentile << " latency: " << format_duration(result.latencies.percentile(percentile))
+              << std::endl;
+  }
+  std::cout << "  max delay: " << format_duration(result.delays.max()) << std::endl;
+
+  const auto report = nlohmann::json{{"context", BenchmarkRunner::create_context(*benchmark_config)},
+                                     {"replay", result.to_json()}};
+  const auto output_file_path = cli_parse_result["output"].as<std::string>();
+  if (output_file_path.empty()) {
+    std::cout << std::setw(2) << report << std::endl;
+  } else {
+    std::ofstream output_file(output_file_path);
+    output_file << std::setw(2) << report << std::endl;
+  }
+
+  return 0;
+}
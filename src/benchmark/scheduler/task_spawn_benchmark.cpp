@@ -0,0 +1,103 @@
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Spawns @param job_count empty jobs and waits for them, like a chunk-parallel operator on a table with as many chunks
+void spawn_and_wait(const size_t job_count, std::atomic_uint& counter) {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() { counter.fetch_add(1, std::memory_order_relaxed); }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+class SchedulerScope {
+ public:
+  explicit SchedulerScope(const bool use_scheduler) {
+    if (!use_scheduler) return;
+    Topology::use_default_topology();
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  }
+
+  ~SchedulerScope() { CurrentScheduler::set(nullptr); }
+};
+
+}  // namespace
+
+namespace opossum {
+
+// The cost of creating a task without scheduling it
+void BM_JobTaskCreation(benchmark::State& state) {  // NOLINT
+  auto counter = std::atomic_uint{0};
+  for (auto _ : state) {
+    auto job = std::make_shared<JobTask>([&]() { ++counter; });
+    benchmark::DoNotOptimize(job);
+  }
+}
+BENCHMARK(BM_JobTaskCreation);
+
+// Spawning jobs from a thread that is not a worker, such as the main thread of a test or a console. Without a
+// scheduler, the jobs are executed as they are scheduled.
+void BM_SpawnAndWaitFromMainThread(benchmark::State& state) {  // NOLINT
+  const auto scheduler_scope = SchedulerScope{state.range(1) != 0};
+  const auto job_count = static_cast<size_t>(state.range(0));
+
+  auto counter = std::atomic_uint{0};
+  for (auto _ : state) {
+    spawn_and_wait(job_count, counter);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * job_count));
+}
+BENCHMARK(BM_SpawnAndWaitFromMainThread)->RangeMultiplier(8)->Ranges({{1, 1024}, {0, 1}})->UseRealTime();
+
+// Spawning jobs from a task that runs on a worker, as the operators of an SQLPipeline do. The waiting worker executes
+// the jobs that no idle worker stole, see Worker::_wait_for_tasks().
+void BM_SpawnAndWaitFromWorker(benchmark::State& state) {  // NOLINT
+  const auto scheduler_scope = SchedulerScope{true};
+  const auto job_count = static_cast<size_t>(state.range(0));
+
+  auto counter = std::atomic_uint{0};
+  for (auto _ : state) {
+    const auto task = std::make_shared<JobTask>([&]() { spawn_and_wait(job_count, counter); });
+    task->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * job_count));
+}
+BENCHMARK(BM_SpawnAndWaitFromWorker)->RangeMultiplier(8)->Range(1, 1024)->UseRealTime();
+
+// A chain of dependent tasks, each of which can only be executed once its predecessor is done, like the operators of
+// a query plan with a single path
+void BM_ExecuteTaskChain(benchmark::State& state) {  // NOLINT
+  const auto scheduler_scope = SchedulerScope{state.range(1) != 0};
+  const auto task_count = static_cast<size_t>(state.range(0));
+
+  auto counter = std::atomic_uint{0};
+  for (auto _ : state) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    tasks.reserve(task_count);
+    for (auto task_index = size_t{0}; task_index < task_count; ++task_index) {
+      tasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      if (task_index > 0) tasks[task_index - 1]->set_as_predecessor_of(tasks.back());
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * task_count));
+}
+BENCHMARK(BM_ExecuteTaskChain)->RangeMultiplier(8)->Ranges({{1, 64}, {0, 1}})->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,118 @@
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpcc/tpcc_table_generator.hpp"
+#include "tpcc/tpcc_terminal.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark runs the transaction mix of TPC-C on the tables of the TpccTableGenerator. Each of the `--clients`
+ * terminals (see TpccTerminal) is a thread that executes one transaction after the other, so that the terminals contend
+ * for the same rows. All statements go through the SQLPipeline with MVCC.
+ *
+ * It reports the tpmC (committed NewOrder transactions per minute) and, for each transaction, the numbers of committed
+ * and aborted runs and their latencies. Running it with increasing `--clients` shows how commits scale with concurrent
+ * terminals. Unlike the TPC-C specification requires, there are no response time constraints, the Delivery is not
+ * queued, and the terminals are not bound to a warehouse.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("TPC-C Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Number of warehouses", cxxopts::value<int>()->default_value("1")); // NOLINT
+  // clang-format on
+
+  std::shared_ptr<BenchmarkConfig> config;
+  int num_warehouses;
+
+  if (CLIConfigParser::cli_has_json_config(argc, argv)) {
+    // JSON config file was passed in
+    const auto json_config = CLIConfigParser::parse_json_config_file(argv[1]);
+    num_warehouses = json_config.value("scale", 1);
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
+  } else {
+    // Parse regular command line args
+    const auto cli_parse_result = cli_options.parse(argc, argv);
+
+    if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+    num_warehouses = cli_parse_result["scale"].as<int>();
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
+  }
+
+  Assert(num_warehouses > 0, "TPC-C needs at least one warehouse");
+  Assert(!config->verify, "The TPC-C benchmark cannot be verified against SQLite");
+  std::cout << "- TPC-C with " << num_warehouses << " warehouse(s) and " << config->clients << " terminal(s)"
+            << std::endl;
+
+  auto context = BenchmarkRunner::create_context(*config);
+  context.emplace("scale_factor", num_warehouses);
+  context["using_mvcc"] = true;
+
+  if (config->enable_scheduler) {
+    Topology::use_default_topology(config->cores);
+    std::cout << "- Multi-threaded Topology:" << std::endl;
+    Topology::get().print(std::cout, 2);
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  }
+
+  std::cout << "- Generating tables" << std::endl;
+  auto table_timer = Timer{};
+  auto table_generator = TpccTableGenerator{config->chunk_size, static_cast<size_t>(num_warehouses),
+                                            config->encoding_config};
+  for (const auto& [table_name, table] : table_generator.generate_all_tables()) {
+    StorageManager::get().add_table(table_name, table);
+  }
+  std::cout << "- Tables generated (" << table_timer.lap_formatted() << ")" << std::endl;
+
+  // The transactions that finish during the warmup are not recorded
+  std::cout << "- Starting Benchmark..." << std::endl;
+  auto results = TpccTerminal::Results{};
+  const auto measurement_begin = std::chrono::steady_clock::now() + config->warmup_duration;
+  const auto benchmark_end = measurement_begin + config->max_duration;
+
+  auto terminals = std::vector<std::thread>{};
+  for (auto terminal_id = uint32_t{0}; terminal_id < config->clients; ++terminal_id) {
+    terminals.emplace_back([&, terminal_id]() {
+      TpccTerminal{num_warehouses, 42 + terminal_id}.run(measurement_begin, benchmark_end, results);
+    });
+  }
+  for (auto& terminal : terminals) terminal.join();
+
+  const auto procedures_json = TpccTerminal::report(results);
+  const auto tpmc = TpccTerminal::tpmc(results, config->max_duration);
+  std::cout << "- tpmC: " << std::fixed << std::setprecision(1) << tpmc << std::endl;
+
+  if (config->output_file_path) {
+    const auto report = nlohmann::json{{"context", context},
+                                       {"warehouses", num_warehouses},
+                                       {"terminals", config->clients},
+                                       {"tpmC", tpmc},
+                                       {"procedures", procedures_json}};
+    std::ofstream output_file(*config->output_file_path);
+    output_file << std::setw(2) << report << std::endl;
+  }
+
+  if (CurrentScheduler::is_set()) CurrentScheduler::get()->finish();
+}
@@ -15,9 +15,15 @@
 #include "operators/table_wrapper.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "tpch/tpch_query_generator.hpp"
 #include "tpch/tpch_table_generator.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -295,4 +301,65 @@ BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_SortMergeSemiProbeRelationLarger)(
   }
 }
 
+/**
+ * Decodes the ValueIDs of all dictionary segments of lineitem, compressed with SIMD-BP128, the way that scans and
+ * materializations read them. Runs of blocks with the same bit size are unpacked with AVX2 or AVX-512 if the CPU
+ * supports them (see SimdBp128Packing::unpack_blocks()), which the items per second of this benchmark reflect.
+ */
+BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_SimdBp128DecodeLineitemValueIDs)(benchmark::State& state) {
+  const auto lineitem_table = StorageManager::get().get_table("lineitem");
+
+  auto compressed_vectors = std::vector<std::unique_ptr<const BaseCompressedVector>>{};
+  auto value_count = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < lineitem_table->chunk_count(); ++chunk_id) {
+    for (const auto& segment : lineitem_table->get_chunk(chunk_id)->segments()) {
+      const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+      Assert(dictionary_segment, "Expected lineitem to be dictionary encoded");
+
+      const auto& attribute_vector = *dictionary_segment->attribute_vector();
+      auto value_ids = pmr_vector<uint32_t>(attribute_vector.size());
+      attribute_vector.decode_into(0u, attribute_vector.size(), value_ids.data());
+
+      compressed_vectors.emplace_back(compress_vector(value_ids, VectorCompressionType::SimdBp128, {}));
+      value_count += value_ids.size();
+    }
+  }
+
+  auto values = std::vector<uint32_t>{};
+  for (auto _ : state) {
+    for (const auto& compressed_vector : compressed_vectors) {
+      values.resize(compressed_vector->size());
+      compressed_vector->decode_into(0u, compressed_vector->size(), values.data());
+      benchmark::DoNotOptimize(values.data());
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * value_count));
+}
+
+// Parses, translates, and optimizes the TPC-H query of the argument without the plan caches, i.e., the time that a
+// query spends before it is executed
+BENCHMARK_DEFINE_F(TPCHDataMicroBenchmarkFixture, BM_TPCHQueryPlanning)(benchmark::State& state) {
+  const auto query_id = QueryID{static_cast<size_t>(state.range(0))};
+  auto query_generator = TPCHQueryGenerator{false, 0.001f};
+  const auto sql = query_generator.build_deterministic_query(query_id);
+  state.SetLabel(query_generator.query_name(query_id));
+
+  const auto logical_plan_cache_capacity = SQLLogicalPlanCache::get().capacity();
+  SQLLogicalPlanCache::get().resize(0);
+
+  for (auto _ : state) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    if (pipeline.requires_execution()) {
+      // E.g., the view of TPC-H 15 has to be created before the query using it can be translated
+      state.SkipWithError("Query cannot be translated without executing it");
+      break;
+    }
+    benchmark::DoNotOptimize(pipeline.get_optimized_logical_plans());
+  }
+
+  SQLLogicalPlanCache::get().resize(logical_plan_cache_capacity);
+}
+BENCHMARK_REGISTER_F(TPCHDataMicroBenchmarkFixture, BM_TPCHQueryPlanning)->DenseRange(0, 21);
+
 }  // namespace opossum
@@ -34,7 +34,24 @@ void AbstractTableGenerator::generate_and_store() {
   std::cout << "- Encoding tables done (" << timer.lap_formatted() << ")" << std::endl;
 
   /**
-   * Write the Tables into binary files if required
+   * Add the Tables to the StorageManager
+   */
+  std::cout << "- Adding Tables to StorageManager and generating statistics " << std::endl;
+  auto& storage_manager = StorageManager::get();
+  for (auto& [table_name, table_info] : table_info_by_name) {
+    std::cout << "-  Adding '" << table_name << "' " << std::flush;
+    Timer per_table_timer;
+    if (storage_manager.has_table(table_name)) storage_manager.drop_table(table_name);
+    storage_manager.add_table(table_name, table_info.table);
+    std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
+  }
+
+  std::cout << "- Adding Tables to StorageManager and generating statistics done (" << timer.lap_formatted() << ")"
+            << std::endl;
+
+  /**
+   * Write the Tables into binary files if required. This happens after their statistics were generated, so that the
+   * binary files include them.
    */
   if (_benchmark_config->cache_binary_tables) {
     std::cout << "- Writing tables into binary files if necessary" << std::endl;
@@ -59,22 +76,6 @@ void AbstractTableGenerator::generate_and_store() {
     }
     std::cout << "- Writing tables into binary files done (" << timer.lap_formatted() << ")" << std::endl;
   }
-
-  /**
-   * Add the Tables to the StorageManager
-   */
-  std::cout << "- Adding Tables to StorageManager and generating statistics " << std::endl;
-  auto& storage_manager = StorageManager::get();
-  for (auto& [table_name, table_info] : table_info_by_name) {
-    std::cout << "-  Adding '" << table_name << "' " << std::flush;
-    Timer per_table_timer;
-    if (storage_manager.has_table(table_name)) storage_manager.drop_table(table_name);
-    storage_manager.add_table(table_name, table_info.table);
-    std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
-  }
-
-  std::cout << "- Adding Tables to StorageManager and generating statistics done (" << timer.lap_formatted() << ")"
-            << std::endl;
 }
 
 }  // namespace opossum
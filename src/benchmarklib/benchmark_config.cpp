@@ -7,7 +7,8 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const Chunk
                                  const Duration& max_duration, const Duration& warmup_duration, const UseMvcc use_mvcc,
                                  const std::optional<std::string>& output_file_path, const bool enable_scheduler,
                                  const uint32_t cores, const uint32_t clients, const bool enable_visualization,
-                                 const bool verify, const bool cache_binary_tables)
+                                 const bool verify, const bool cache_binary_tables,
+                                 const bool collect_hardware_counters, const bool plan_quality)
     : benchmark_mode(benchmark_mode),
       chunk_size(chunk_size),
       encoding_config(encoding_config),
@@ -21,7 +22,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const Chunk
       clients(clients),
       enable_visualization(enable_visualization),
       verify(verify),
-      cache_binary_tables(cache_binary_tables) {}
+      cache_binary_tables(cache_binary_tables),
+      collect_hardware_counters(collect_hardware_counters),
+      plan_quality(plan_quality) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
 
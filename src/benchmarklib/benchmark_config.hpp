@@ -24,7 +24,7 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables);
+                  const bool cache_binary_tables, const bool collect_hardware_counters, const bool plan_quality);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +42,11 @@ class BenchmarkConfig {
   bool enable_visualization = false;
   bool verify = false;
   bool cache_binary_tables = false;
+  bool collect_hardware_counters = false;
+
+  // Instead of measuring the queries, execute each one once and compare the estimated cardinalities of its joins with
+  // the actual ones (see BenchmarkRunner::_evaluate_plan_quality())
+  bool plan_quality = false;
 
   static const char* description;
 
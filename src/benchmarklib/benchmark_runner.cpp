@@ -1,7 +1,11 @@
 #include <json.hpp>
 
+#include <algorithm>
 #include <boost/range/adaptors.hpp>
+#include <cmath>
 #include <random>
+#include <unordered_set>
+#include <vector>
 
 #include "cxxopts.hpp"
 
@@ -9,21 +13,52 @@
 #include "benchmark_runner.hpp"
 #include "benchmark_state.hpp"
 #include "constant_mappings.hpp"
+#include "cost_model/cost_model_logical.hpp"
+#include "operators/abstract_join_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/check_table_equal.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/sqlite_wrapper.hpp"
 #include "utils/timer.hpp"
 #include "version.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
+namespace {
+
+// The distribution of the @param q_errors, whose geometric mean is the factor by which the estimates are typically off
+nlohmann::json summarize_q_errors(std::vector<double> q_errors) {
+  if (q_errors.empty()) return nlohmann::json{{"count", 0}};
+
+  std::sort(q_errors.begin(), q_errors.end());
+  const auto percentile = [&](const double fraction) {
+    return q_errors[static_cast<size_t>(fraction * static_cast<double>(q_errors.size() - 1))];
+  };
+
+  auto log_sum = 0.0;
+  for (const auto q_error : q_errors) {
+    log_sum += std::log(q_error);
+  }
+
+  return nlohmann::json{{"count", q_errors.size()},
+                        {"geometric_mean", std::exp(log_sum / static_cast<double>(q_errors.size()))},
+                        {"median", percentile(0.5)},
+                        {"p90", percentile(0.9)},
+                        {"p99", percentile(0.99)},
+                        {"max", q_errors.back()}};
+}
+
+}  // namespace
+
 namespace opossum {
 
 BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
@@ -51,6 +86,15 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<
     const auto scheduler = std::make_shared<NodeQueueScheduler>();
     CurrentScheduler::set(scheduler);
   }
+
+  Assert(!config.plan_quality || !config.verify, "Cannot use verification when evaluating the plan quality");
+
+  if (config.collect_hardware_counters) {
+    HardwareCounters::set_enabled(true);
+    if (!HardwareCounters::available()) {
+      std::cout << "- Hardware counters are not available, check kernel.perf_event_paranoid" << std::endl;
+    }
+  }
 }
 
 BenchmarkRunner::~BenchmarkRunner() {
@@ -100,14 +144,18 @@ void BenchmarkRunner::run() {
   auto benchmark_start = std::chrono::steady_clock::now();
 
   // Run the queries in the selected mode
-  switch (_config.benchmark_mode) {
-    case BenchmarkMode::IndividualQueries: {
-      _benchmark_individual_queries();
-      break;
-    }
-    case BenchmarkMode::PermutedQuerySet: {
-      _benchmark_permuted_query_set();
-      break;
+  if (_config.plan_quality) {
+    _evaluate_plan_quality();
+  } else {
+    switch (_config.benchmark_mode) {
+      case BenchmarkMode::IndividualQueries: {
+        _benchmark_individual_queries();
+        break;
+      }
+      case BenchmarkMode::PermutedQuerySet: {
+        _benchmark_permuted_query_set();
+        break;
+      }
     }
   }
 
@@ -192,25 +240,29 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
         const auto query_run_begin = std::chrono::steady_clock::now();
         auto on_query_done = [query_run_begin, query_id, number_of_queries, &currently_running_clients,
                               &finished_query_set_runs, &finished_queries_total, &state, this]() {
-          if (finished_queries_total++ % number_of_queries == 0) {
-            currently_running_clients--;
-            finished_query_set_runs++;
-          }
-
           if (!state.is_done()) {  // To prevent queries to add their results after the time is up
-            const auto duration = std::chrono::steady_clock::now() - query_run_begin;
+            const auto query_run_end = std::chrono::steady_clock::now();
+            const auto duration = query_run_end - query_run_begin;
             auto& result = _query_results[query_id];
             result.duration += duration;
             result.iteration_durations.push_back(duration);
+            result.latency_histogram.record(duration);
+            result.iteration_ends.push_back(std::chrono::high_resolution_clock::now() - state.benchmark_begin);
             result.num_iterations++;
           }
+
+          if (finished_queries_total++ % number_of_queries == 0) {
+            currently_running_clients--;
+            finished_query_set_runs++;
+            _notify_client_done();
+          }
         };
 
         auto query_tasks = _schedule_or_execute_query(query_id, on_query_done);
         tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
       }
     } else {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      _wait_for_idle_client(currently_running_clients);
     }
   }
   state.set_done();
@@ -245,19 +297,23 @@ void BenchmarkRunner::_benchmark_individual_queries() {
         // The on_query_done callback will be appended to the last Task of the query,
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
-        auto on_query_done = [query_run_begin, &currently_running_clients, &result, &state]() {
-          currently_running_clients--;
+        auto on_query_done = [query_run_begin, &currently_running_clients, &result, &state, this]() {
           if (!state.is_done()) {  // To prevent queries to add their results after the time is up
             const auto query_run_end = std::chrono::steady_clock::now();
+            const auto duration = query_run_end - query_run_begin;
+            result.iteration_durations.push_back(duration);
+            result.latency_histogram.record(duration);
+            result.iteration_ends.push_back(std::chrono::high_resolution_clock::now() - state.benchmark_begin);
             result.num_iterations++;
-            result.iteration_durations.push_back(query_run_end - query_run_begin);
           }
+          currently_running_clients--;
+          _notify_client_done();
         };
 
         auto query_tasks = _schedule_or_execute_query(query_id, on_query_done);
         tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
       } else {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        _wait_for_idle_client(currently_running_clients);
       }
     }
     state.set_done();
@@ -269,6 +325,13 @@ void BenchmarkRunner::_benchmark_individual_queries() {
 
     std::cout << "  -> Executed " << result.num_iterations << " times in " << duration_seconds << " seconds ("
               << items_per_second << " iter/s)" << std::endl;
+    const auto& latency_histogram = result.latency_histogram;
+    if (latency_histogram.count() > 0) {
+      std::cout << "     Latency p50 " << format_duration(latency_histogram.percentile(50.0)) << ", p90 "
+                << format_duration(latency_histogram.percentile(90.0)) << ", p99 "
+                << format_duration(latency_histogram.percentile(99.0)) << ", p99.9 "
+                << format_duration(latency_histogram.percentile(99.9)) << std::endl;
+    }
 
     // Wait for the rest of the tasks that didn't make it in time - they will not count toward the results
     // TODO(leander/anyone): To be replaced with something like CurrentScheduler::abort(),
@@ -278,6 +341,83 @@ void BenchmarkRunner::_benchmark_individual_queries() {
   }
 }
 
+void BenchmarkRunner::_evaluate_plan_quality() {
+  const auto cost_estimator = CostModelLogical{};
+
+  for (const auto& query_id : _query_generator->selected_queries()) {
+    const auto& name = _query_generator->query_name(query_id);
+    std::cout << "- Evaluating the plan of Query " << name << std::endl;
+
+    // What was learned from the previous queries would otherwise correct the estimates of this one
+    CardinalityFeedback::get().clear();
+
+    auto pipeline_builder = SQLPipelineBuilder{_query_generator->build_query(query_id)}.with_mvcc(_config.use_mvcc);
+    if (_config.enable_visualization) pipeline_builder.dont_cleanup_temporaries();
+    auto pipeline = pipeline_builder.create_pipeline();
+
+    // The actual row counts are only known once the plans were executed, which also optimizes statements that depend
+    // on the execution of the previous ones (e.g., of views that they create)
+    const auto query_run_begin = std::chrono::steady_clock::now();
+    pipeline.get_result_table();
+    const auto duration = std::chrono::steady_clock::now() - query_run_begin;
+
+    auto& result = _query_results[query_id];
+    result.duration = duration;
+    result.iteration_durations.push_back(duration);
+    result.latency_histogram.record(duration);
+    result.iteration_ends.push_back(duration);
+    result.num_iterations = 1;
+
+    _record_operator_results(query_id, pipeline.get_physical_plans());
+    _store_plan(query_id, pipeline);
+
+    // The execution corrected the estimates of the predicates of the query itself
+    CardinalityFeedback::get().clear();
+
+    auto& plan_quality = result.plan_quality.emplace();
+    for (const auto& lqp : pipeline.get_optimized_logical_plans()) {
+      plan_quality.estimated_cost += cost_estimator.estimate_plan_cost(lqp);
+    }
+
+    // The LQPTranslator might merge the PredicateNodes above a JoinNode into the join operator, which then estimates
+    // the row count of the topmost of them. If it created more than one join operator for a node, the topmost one
+    // produces the rows of the node.
+    auto visited_operators = std::unordered_set<const AbstractOperator*>{};
+    auto visited_nodes = std::unordered_set<const AbstractLQPNode*>{};
+    const auto visit_operator = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+      if (!op || !visited_operators.emplace(op.get()).second) return;
+
+      const auto& node = op->lqp_node;
+      const auto is_join =
+          std::dynamic_pointer_cast<const AbstractJoinOperator>(op) || op->type() == OperatorType::Product;
+      const auto& actual_row_count = op->performance_data().output_row_count;
+      if (is_join && node && visited_nodes.emplace(node.get()).second && actual_row_count) {
+        const auto estimated_row_count = static_cast<double>(
+            node->derive_statistics_from(node->left_input(), node->right_input())->row_count());
+        const auto q = std::max(estimated_row_count, 1.0) / std::max(static_cast<double>(*actual_row_count), 1.0);
+        const auto description = node->type == LQPNodeType::Join ? node->description() : op->description();
+        plan_quality.joins.emplace_back(
+            JoinCardinalityResult{description, estimated_row_count, *actual_row_count, std::max(q, 1.0 / q)});
+      }
+
+      self(self, op->input_left());
+      self(self, op->input_right());
+    };
+
+    for (const auto& pqp : pipeline.get_physical_plans()) {
+      visit_operator(visit_operator, pqp);
+    }
+
+    auto max_q_error = 1.0;
+    for (const auto& join : plan_quality.joins) {
+      max_q_error = std::max(max_q_error, join.q_error);
+    }
+    std::cout << "  -> Estimated cost " << plan_quality.estimated_cost << ", " << plan_quality.joins.size()
+              << " joins with a max q-error of " << max_q_error << " (executed in " << format_duration(duration)
+              << ")" << std::endl;
+  }
+}
+
 void BenchmarkRunner::_warmup_query(const QueryID query_id) {
   if (_config.warmup_duration == Duration{0}) {
     return;
@@ -300,12 +440,15 @@ void BenchmarkRunner::_warmup_query(const QueryID query_id) {
 
       // The on_query_done callback will be appended to the last Task of the query,
       // to signal that the query was finished
-      auto on_query_done = [&currently_running_clients]() { currently_running_clients--; };
+      auto on_query_done = [&currently_running_clients, this]() {
+        currently_running_clients--;
+        _notify_client_done();
+      };
 
       auto query_tasks = _schedule_or_execute_query(query_id, on_query_done);
       tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
     } else {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      _wait_for_idle_client(currently_running_clients);
     }
   }
   state.set_done();
@@ -317,6 +460,19 @@ void BenchmarkRunner::_warmup_query(const QueryID query_id) {
   Assert(currently_running_clients == 0, "All query runs must be finished at this point");
 }
 
+void BenchmarkRunner::_wait_for_idle_client(const std::atomic_uint& currently_running_clients) {
+  std::unique_lock<std::mutex> lock(_clients_mutex);
+  _client_done.wait_for(lock, std::chrono::milliseconds(10), [&]() {
+    return currently_running_clients.load(std::memory_order_relaxed) < _config.clients;
+  });
+}
+
+void BenchmarkRunner::_notify_client_done() {
+  // Locking the mutex makes sure that the waiting thread either sees the finished client or is notified
+  { std::lock_guard<std::mutex> lock(_clients_mutex); }
+  _client_done.notify_all();
+}
+
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute_query(
     const QueryID query_id, const std::function<void()>& done_callback) {
   // Some queries (like TPC-H 15) require execution before we can call get_tasks() on the pipeline.
@@ -340,7 +496,13 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
   auto pipeline = pipeline_builder.create_pipeline();
 
   auto tasks_per_statement = pipeline.get_tasks();
-  tasks_per_statement.back().back()->set_done_callback(done_callback);
+
+  // The plans are executed once the last task is done
+  const auto& pqps = pipeline.get_physical_plans();
+  tasks_per_statement.back().back()->set_done_callback([&, query_id, pqps, done_callback]() {
+    _record_operator_results(query_id, pqps);
+    done_callback();
+  });
 
   for (auto tasks : tasks_per_statement) {
     CurrentScheduler::schedule_tasks(tasks);
@@ -399,6 +561,8 @@ void BenchmarkRunner::_execute_query(const QueryID query_id, const std::function
     }
   }
 
+  _record_operator_results(query_id, pipeline.get_physical_plans());
+
   if (done_callback) done_callback();
 
   // If necessary, keep plans for visualization
@@ -414,9 +578,44 @@ void BenchmarkRunner::_store_plan(const QueryID query_id, SQLPipeline& pipeline)
   }
 }
 
+void BenchmarkRunner::_record_operator_results(const QueryID query_id,
+                                               const std::vector<std::shared_ptr<AbstractOperator>>& pqps) {
+  std::lock_guard<std::mutex> lock(_operator_results_mutex);
+  auto& operator_results = _query_results[query_id].operator_results;
+
+  // Operators may be shared by several parts of a plan, but were executed once
+  auto visited_operators = std::unordered_set<const AbstractOperator*>{};
+  const auto record_operator = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+    if (!op || !visited_operators.emplace(op.get()).second) return;
+
+    const auto& performance_data = op->performance_data();
+    auto& operator_result = operator_results[op->name()];
+    ++operator_result.executions;
+    operator_result.walltime += performance_data.walltime;
+    operator_result.allocated_bytes += performance_data.allocated_bytes;
+    if (performance_data.hardware_counters) operator_result.hardware_counters += *performance_data.hardware_counters;
+    for (const auto& [step, walltime] : performance_data.step_walltimes()) {
+      operator_result.step_walltimes[step] += walltime;
+    }
+    for (const auto& [name, count] : performance_data.counts()) {
+      operator_result.counts[name] += count;
+    }
+
+    self(self, op->input_left());
+    self(self, op->input_right());
+  };
+
+  for (const auto& pqp : pqps) {
+    record_operator(record_operator, pqp);
+  }
+}
+
 void BenchmarkRunner::_create_report(std::ostream& stream) const {
   nlohmann::json benchmarks;
 
+  // The q-errors of the joins of all queries, if the plan quality was evaluated
+  auto all_q_errors = std::vector<double>{};
+
   for (const auto& query_id : _query_generator->selected_queries()) {
     const auto& name = _query_generator->query_name(query_id);
     const auto& query_result = _query_results[query_id];
@@ -444,11 +643,67 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                              {"items_per_second", items_per_second},
                              {"time_unit", "ns"}};
 
+    // The closed-loop latencies of the clients, in ns
+    benchmark["latency"] = query_result.latency_histogram.to_json();
+
+    // The number of iterations that finished in each second of the measurement
+    auto throughput_over_time = std::vector<size_t>{};
+    for (const auto& iteration_end : query_result.iteration_ends) {
+      const auto second = static_cast<size_t>(std::chrono::duration_cast<std::chrono::seconds>(iteration_end).count());
+      if (second >= throughput_over_time.size()) throughput_over_time.resize(second + 1);
+      ++throughput_over_time[second];
+    }
+    benchmark["throughput_over_time"] = throughput_over_time;
+
     if (_config.verify) {
       Assert(query_result.verification_passed, "Verification should have been performed");
       benchmark["verification_passed"] = *query_result.verification_passed;
     }
 
+    // The performance data of the operators, summed up over all executions, including those of the warmup
+    auto operators = nlohmann::json::array();
+    for (const auto& [operator_name, operator_result] : query_result.operator_results) {
+      auto operator_json = nlohmann::json{{"name", operator_name},
+                                          {"executions", operator_result.executions},
+                                          {"walltime", operator_result.walltime.count()},
+                                          {"allocated_bytes", operator_result.allocated_bytes}};
+
+      if (_config.collect_hardware_counters) {
+        const auto& counters = operator_result.hardware_counters;
+        operator_json["cycles"] = counters.cycles;
+        operator_json["instructions"] = counters.instructions;
+        operator_json["llc_misses"] = counters.llc_misses;
+        operator_json["branch_misses"] = counters.branch_misses;
+      }
+
+      for (const auto& [step, walltime] : operator_result.step_walltimes) {
+        operator_json["step_walltimes"][step] = walltime.count();
+      }
+      for (const auto& [name, count] : operator_result.counts) {
+        operator_json["counts"][name] = count;
+      }
+
+      operators.push_back(operator_json);
+    }
+    benchmark["operators"] = operators;
+
+    if (query_result.plan_quality) {
+      auto joins = nlohmann::json::array();
+      auto q_errors = std::vector<double>{};
+      for (const auto& join : query_result.plan_quality->joins) {
+        joins.push_back(nlohmann::json{{"description", join.description},
+                                       {"estimated_row_count", join.estimated_row_count},
+                                       {"actual_row_count", join.actual_row_count},
+                                       {"q_error", join.q_error}});
+        q_errors.emplace_back(join.q_error);
+      }
+      all_q_errors.insert(all_q_errors.end(), q_errors.begin(), q_errors.end());
+
+      benchmark["plan_quality"] = nlohmann::json{{"estimated_cost", query_result.plan_quality->estimated_cost},
+                                                 {"joins", joins},
+                                                 {"q_errors", summarize_q_errors(q_errors)}};
+    }
+
     benchmarks.push_back(benchmark);
   }
 
@@ -461,6 +716,7 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
   const auto total_run_duration_seconds = std::chrono::duration_cast<std::chrono::seconds>(_total_run_duration).count();
 
   nlohmann::json summary{{"table_size_in_bytes", table_size}, {"total_run_duration_in_s", total_run_duration_seconds}};
+  if (_config.plan_quality) summary["q_errors"] = summarize_q_errors(all_q_errors);
 
   nlohmann::json report{{"context", _context}, {"benchmarks", benchmarks}, {"summary", summary}};
 
@@ -472,7 +728,8 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
 
   // Create a comma separated strings with the encoding and compression options
   const auto get_first = boost::adaptors::transformed([](auto it) { return it.first; });
-  const auto encoding_strings_option = boost::algorithm::join(encoding_type_to_string.right | get_first, ", ");
+  const auto encoding_strings_option = boost::algorithm::join(encoding_type_to_string.right | get_first, ", ") + ", " +
+                                       EncodingConfig::AUTOMATIC_ENCODING_STRING;
   const auto compression_strings_option =
       boost::algorithm::join(vector_compression_type_to_string.right | get_first, ", ");
 
@@ -496,7 +753,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("hardware_counters", "Collect hardware counters (cycles, instructions, LLC and branch misses) per operator", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("plan_quality", "Instead of measuring the queries, execute each one once and report the q-errors of the estimated join cardinalities and the estimated plan costs", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -537,6 +796,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
+      {"using_hardware_counters", config.collect_hardware_counters},
+      {"plan_quality", config.plan_quality},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
 
@@ -4,7 +4,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -46,9 +48,24 @@ class BenchmarkRunner {
   // Run benchmark in BenchmarkMode::IndividualQueries mode
   void _benchmark_individual_queries();
 
+  /**
+   * Run instead of the benchmark if the plan quality is evaluated: Executes each query once and compares the row
+   * counts that the joins of its PQPs produced with the row counts that the optimizer estimated for their LQP nodes.
+   * They are estimated without the corrections of the CardinalityFeedback, which is cleared before and after each
+   * query, so that the estimates do not depend on the order of the queries. Also sums up the costs of the optimized
+   * LQPs, as estimated by the CostModelLogical that the JoinOrderingRule uses.
+   */
+  void _evaluate_plan_quality();
+
   // Execute warmup run of a query
   void _warmup_query(const QueryID query_id);
 
+  // The clients run closed loops: Each one issues its next query as soon as its previous one is done. These block until
+  // fewer than the configured number of clients are running (or briefly, so that the time limit is checked), and wake
+  // up the blocked thread, respectively.
+  void _wait_for_idle_client(const std::atomic_uint& currently_running_clients);
+  void _notify_client_done();
+
   // Calls _schedule_query if the scheduler is active, otherwise calls _execute_query and returns no tasks
   std::vector<std::shared_ptr<AbstractTask>> _schedule_or_execute_query(const QueryID query_id,
                                                                         const std::function<void()>& done_callback);
@@ -63,6 +80,9 @@ class BenchmarkRunner {
   // If visualization is enabled, stores an executed plan
   void _store_plan(const QueryID query_id, SQLPipeline& pipeline);
 
+  // Adds the performance data of the operators of executed plans to the results
+  void _record_operator_results(const QueryID query_id, const std::vector<std::shared_ptr<AbstractOperator>>& pqps);
+
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
   void _create_report(std::ostream& stream) const;
 
@@ -83,6 +103,10 @@ class BenchmarkRunner {
 
   // Stores the results of the query executions. Its length is defined by the number of available queries.
   std::vector<QueryBenchmarkResult> _query_results;
+  std::mutex _operator_results_mutex;
+
+  std::mutex _clients_mutex;
+  std::condition_variable _client_done;
 
   nlohmann::json _context;
 
@@ -81,6 +81,10 @@ namespace opossum {
 
 bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
                                    const EncodingConfig& encoding_config) {
+  if (encoding_config.is_automatic) {
+    return encode(table_name, table, EncodingConfig::advise({{table_name, table}}));
+  }
+
   /**
    * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
    */
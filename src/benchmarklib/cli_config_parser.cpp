@@ -90,6 +90,11 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Encoding is custom from " << encoding_type_str << "" << std::endl;
 
     Assert(compression_type_str.empty(), "Specified both compression type and an encoding file. Invalid combination.");
+  } else if (encoding_type_str == EncodingConfig::AUTOMATIC_ENCODING_STRING) {
+    encoding_config = std::make_unique<EncodingConfig>(EncodingConfig::automatic());
+    std::cout << "- Encoding is picked automatically per column" << std::endl;
+
+    Assert(compression_type_str.empty(), "Specified both compression type and automatic encoding. Invalid combination");
   } else {
     encoding_config = std::make_unique<EncodingConfig>(
         EncodingConfig::encoding_spec_from_strings(encoding_type_str, compression_type_str));
@@ -130,10 +135,21 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Not caching tables as binary files" << std::endl;
   }
 
+  const auto collect_hardware_counters =
+      json_config.value("hardware_counters", default_config.collect_hardware_counters);
+  if (collect_hardware_counters) {
+    std::cout << "- Collecting hardware counters per operator" << std::endl;
+  }
+
+  const auto plan_quality = json_config.value("plan_quality", default_config.plan_quality);
+  if (plan_quality) {
+    std::cout << "- Evaluating the plan quality instead of measuring the queries" << std::endl;
+  }
+
   return BenchmarkConfig{
       benchmark_mode, chunk_size,         *encoding_config, max_runs, timeout_duration, warmup_duration,
       use_mvcc,       output_file_path,   enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables};
+      verify,         cache_binary_tables, collect_hardware_counters, plan_quality};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -158,6 +174,8 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("hardware_counters", parse_result["hardware_counters"].as<bool>());
+  json_config.emplace("plan_quality", parse_result["plan_quality"].as<bool>());
 
   return json_config;
 }
@@ -1,6 +1,8 @@
 #include "encoding_config.hpp"
 
 #include "constant_mappings.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -11,13 +13,31 @@ EncodingConfig::EncodingConfig(const SegmentEncodingSpec& default_encoding_spec)
 
 EncodingConfig::EncodingConfig(const SegmentEncodingSpec& default_encoding_spec,
                                DataTypeEncodingMapping type_encoding_mapping,
-                               TableSegmentEncodingMapping encoding_mapping)
+                               TableSegmentEncodingMapping encoding_mapping, const bool is_automatic)
     : default_encoding_spec{default_encoding_spec},
       type_encoding_mapping{std::move(type_encoding_mapping)},
-      custom_encoding_mapping{std::move(encoding_mapping)} {}
+      custom_encoding_mapping{std::move(encoding_mapping)},
+      is_automatic{is_automatic} {}
 
 EncodingConfig EncodingConfig::unencoded() { return EncodingConfig{SegmentEncodingSpec{EncodingType::Unencoded}}; }
 
+EncodingConfig EncodingConfig::automatic() {
+  return EncodingConfig{SegmentEncodingSpec{EncodingType::Dictionary}, {}, {}, true};
+}
+
+EncodingConfig EncodingConfig::advise(const std::unordered_map<std::string, std::shared_ptr<Table>>& tables) {
+  auto custom_encoding_mapping = TableSegmentEncodingMapping{};
+  for (const auto& [table_name, table] : tables) {
+    const auto chunk_encoding_spec = EncodingAdvisor::advise(*table);
+    auto& column_encoding_mapping = custom_encoding_mapping[table_name];
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      column_encoding_mapping.emplace(table->column_name(column_id), chunk_encoding_spec[column_id]);
+    }
+  }
+
+  return EncodingConfig{SegmentEncodingSpec{EncodingType::Dictionary}, {}, std::move(custom_encoding_mapping)};
+}
+
 SegmentEncodingSpec EncodingConfig::encoding_spec_from_strings(const std::string& encoding_str,
                                                                const std::string& compression_str) {
   const auto encoding = EncodingConfig::encoding_string_to_type(encoding_str);
@@ -52,6 +72,11 @@ nlohmann::json EncodingConfig::to_json() const {
   };
 
   nlohmann::json json{};
+  if (is_automatic) {
+    json["default"] = {{"encoding", AUTOMATIC_ENCODING_STRING}};
+    return json;
+  }
+
   json["default"] = encoding_spec_to_string_map(default_encoding_spec);
 
   nlohmann::json type_mapping{};
@@ -89,6 +114,9 @@ The encoding config represents the segment encodings specified for a benchmark.
 All segments of a given share column the same encoding.
 If encoding (and vector compression) were specified via command line args,
 all segments are compressed using the default encoding.
+If the encoding "Auto" was specified, the EncodingAdvisor picks the encoding
+of each column by sampling it and comparing the size and scan cost of all
+encodings.
 If a JSON config was provided, a column- and/or type-specific
 encoding/compression can be chosen (same in each chunk). The JSON config must
 look like this:
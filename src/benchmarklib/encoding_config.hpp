@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 
 #include "json.hpp"
@@ -10,6 +12,8 @@
 
 namespace opossum {
 
+class Table;
+
 using DataTypeEncodingMapping = std::unordered_map<DataType, SegmentEncodingSpec>;
 
 // Map<TABLE_NAME, Map<column_name, SegmentEncoding>>
@@ -21,18 +25,28 @@ class EncodingConfig {
  public:
   EncodingConfig();
   EncodingConfig(const SegmentEncodingSpec& default_encoding_spec, DataTypeEncodingMapping type_encoding_mapping,
-                 TableSegmentEncodingMapping encoding_mapping);
+                 TableSegmentEncodingMapping encoding_mapping, const bool is_automatic = false);
   explicit EncodingConfig(const SegmentEncodingSpec& default_encoding_spec);
 
   static EncodingConfig unencoded();
 
+  // Leaves the choice of the encodings to the EncodingAdvisor (see EncodingConfig::advise)
+  static EncodingConfig automatic();
+
+  // Returns a config with the encodings that the EncodingAdvisor picks for each column of the given tables
+  static EncodingConfig advise(const std::unordered_map<std::string, std::shared_ptr<Table>>& tables);
+
   const SegmentEncodingSpec default_encoding_spec;
   const DataTypeEncodingMapping type_encoding_mapping;
   const TableSegmentEncodingMapping custom_encoding_mapping;
+  const bool is_automatic;
 
   static SegmentEncodingSpec encoding_spec_from_strings(const std::string& encoding_str,
                                                         const std::string& compression_str);
   static EncodingType encoding_string_to_type(const std::string& encoding_str);
+
+  // Used instead of an EncodingType to request EncodingConfig::automatic()
+  static constexpr auto AUTOMATIC_ENCODING_STRING = "Auto";
   static std::optional<VectorCompressionType> compression_string_to_type(const std::string& compression_str);
 
   nlohmann::json to_json() const;
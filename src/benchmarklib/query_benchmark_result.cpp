@@ -1,13 +1,22 @@
 #include "query_benchmark_result.hpp"
 
+#include <utility>
+
 namespace opossum {
 
-QueryBenchmarkResult::QueryBenchmarkResult() { iteration_durations.reserve(1'000'000); }
+QueryBenchmarkResult::QueryBenchmarkResult() {
+  iteration_durations.reserve(1'000'000);
+  iteration_ends.reserve(1'000'000);
+}
 
-QueryBenchmarkResult::QueryBenchmarkResult(QueryBenchmarkResult&& other) noexcept {
+QueryBenchmarkResult::QueryBenchmarkResult(QueryBenchmarkResult&& other) noexcept
+    : latency_histogram(std::move(other.latency_histogram)) {
   num_iterations.store(other.num_iterations);
   duration = other.duration;
   iteration_durations = other.iteration_durations;
+  iteration_ends = other.iteration_ends;
+  operator_results = std::move(other.operator_results);
+  plan_quality = std::move(other.plan_quality);
 }
 
 }  // namespace opossum
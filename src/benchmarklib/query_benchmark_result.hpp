@@ -1,11 +1,50 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "benchmark_config.hpp"
+#include "cost_model/cost.hpp"
+#include "utils/hardware_counters.hpp"
+#include "utils/latency_histogram.hpp"
 
 namespace opossum {
 
+// The performance data of all executions of an operator within the plans of a query, summed up by operator name
+struct OperatorBenchmarkResult {
+  size_t executions{0};
+  std::chrono::nanoseconds walltime{0};
+  size_t allocated_bytes{0};
+  HardwareCounters hardware_counters;
+
+  // See OperatorPerformanceData::step_walltimes() and OperatorPerformanceData::counts()
+  std::map<std::string, std::chrono::nanoseconds> step_walltimes;
+  std::map<std::string, size_t> counts;
+};
+
+// The cardinality of a join as the optimizer estimated it and as its operator produced it
+struct JoinCardinalityResult {
+  std::string description;
+  double estimated_row_count;
+  uint64_t actual_row_count;
+
+  // The factor by which the estimate is off, max(estimated / actual, actual / estimated), with both at least 1
+  double q_error;
+};
+
+// See BenchmarkRunner::_evaluate_plan_quality()
+struct PlanQualityResult {
+  // The costs of the optimized LQPs of the statements of the query, estimated by the CostModelLogical
+  Cost estimated_cost{0.0f};
+
+  // The joins, in the order in which they appear in the PQPs, from the root down
+  std::vector<JoinCardinalityResult> joins;
+};
+
 struct QueryBenchmarkResult : public Noncopyable {
   QueryBenchmarkResult();
 
@@ -17,7 +56,19 @@ struct QueryBenchmarkResult : public Noncopyable {
   Duration duration = Duration{};
   tbb::concurrent_vector<Duration> iteration_durations;
 
+  // The same durations, for their percentiles
+  LatencyHistogram latency_histogram;
+
+  // When the iterations finished, relative to the begin of the measurement, for the throughput over time
+  tbb::concurrent_vector<Duration> iteration_ends;
+
   std::optional<bool> verification_passed;
+
+  // Guarded by BenchmarkRunner::_operator_results_mutex
+  std::map<std::string, OperatorBenchmarkResult> operator_results;
+
+  // Only set if the plan quality was evaluated instead of measuring the query
+  std::optional<PlanQualityResult> plan_quality;
 };
 
 }  // namespace opossum
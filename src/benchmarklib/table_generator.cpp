@@ -86,15 +86,11 @@ std::shared_ptr<Table> TableGenerator::generate_table(
   const auto num_columns = column_data_distributions.size();
   const auto num_chunks = std::ceil(static_cast<double>(num_rows) / static_cast<double>(chunk_size));
 
-  // create result table and container for vectors holding the generated values for the columns
-  std::vector<tbb::concurrent_vector<int>> value_vectors;
-
-  // add column definitions and initialize each value vector
+  // add column definitions
   TableColumnDefinitions column_definitions;
   for (size_t column = 1; column <= num_columns; ++column) {
     auto column_name = "column_" + std::to_string(column);
     column_definitions.emplace_back(column_name, DataType::Int);
-    value_vectors.emplace_back(tbb::concurrent_vector<int>(chunk_size));
   }
   std::shared_ptr<Table> table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
 
@@ -107,6 +103,24 @@ std::shared_ptr<Table> TableGenerator::generate_table(
 
   pseudorandom_engine.seed(rd());
 
+  // The cumulative probabilities of the values of Zipf distributed columns, computed once for all chunks. A value is
+  // drawn by searching a uniformly distributed probability in them.
+  auto zipf_cumulative_probabilities = std::vector<std::vector<double>>(num_columns);
+  for (ColumnID column_index{0}; column_index < num_columns; ++column_index) {
+    const auto& column_data_distribution = column_data_distributions[column_index];
+    if (column_data_distribution.distribution_type != DataDistributionType::Zipf) continue;
+    Assert(column_data_distribution.num_different_values > 0, "Zipf distribution needs at least one value");
+
+    auto& cumulative_probabilities = zipf_cumulative_probabilities[column_index];
+    cumulative_probabilities.resize(column_data_distribution.num_different_values);
+    auto sum = 0.0;
+    for (auto value = size_t{0}; value < cumulative_probabilities.size(); ++value) {
+      sum += 1.0 / std::pow(static_cast<double>(value + 1), column_data_distribution.zipf_exponent);
+      cumulative_probabilities[value] = sum;
+    }
+    for (auto& cumulative_probability : cumulative_probabilities) cumulative_probability /= sum;
+  }
+
   // Base allocators if we don't use multiple NUMA nodes
   auto allocator_ptr_base_segment = PolymorphicAllocator<std::shared_ptr<BaseSegment>>{};
   auto allocator_value_segment_int = PolymorphicAllocator<ValueSegment<int>>{};
@@ -126,6 +140,9 @@ std::shared_ptr<Table> TableGenerator::generate_table(
     }
 #endif
 
+    // the last chunk holds the remaining rows
+    const auto chunk_row_count = std::min(chunk_size, num_rows - chunk_index * chunk_size);
+
     auto segments = Segments(allocator_ptr_base_segment);
     for (ColumnID column_index{0}; column_index < num_columns; ++column_index) {
       const auto& column_data_distribution = column_data_distributions[column_index];
@@ -160,22 +177,29 @@ std::shared_ptr<Table> TableGenerator::generate_table(
           };
           break;
         }
-      }
-
-      // generate values according to distribution
-      for (size_t row_offset{0}; row_offset < chunk_size; ++row_offset) {
-        // bounds check
-        if ((chunk_index + 1) * chunk_size + (row_offset + 1) > num_rows) {
+        case DataDistributionType::Zipf: {
+          const auto& cumulative_probabilities = zipf_cumulative_probabilities[column_index];
+          generate_value_by_distribution_type = [&cumulative_probabilities, &probability_dist, &pseudorandom_engine]() {
+            const auto probability = probability_dist(pseudorandom_engine);
+            const auto value_iter =
+                std::lower_bound(cumulative_probabilities.begin(), cumulative_probabilities.end(), probability);
+            // guard against the last cumulative probability being slightly below 1.0 due to rounding
+            return static_cast<int>(std::min(std::distance(cumulative_probabilities.begin(), value_iter),
+                                             static_cast<std::ptrdiff_t>(cumulative_probabilities.size() - 1)));
+          };
           break;
         }
+      }
 
-        value_vectors[column_index][row_offset] = generate_value_by_distribution_type();
+      // generate values according to distribution
+      auto values = tbb::concurrent_vector<int>(chunk_row_count);
+      for (size_t row_offset{0}; row_offset < chunk_row_count; ++row_offset) {
+        values[row_offset] = generate_value_by_distribution_type();
       }
 
-      // add values to segment, reset value vector
-      segments.push_back(std::allocate_shared<ValueSegment<int>>(
-          allocator_value_segment_int, std::move(value_vectors[column_index]), allocator_int));
-      value_vectors[column_index] = tbb::concurrent_vector<int>(chunk_size);
+      // add values to segment
+      segments.push_back(
+          std::allocate_shared<ValueSegment<int>>(allocator_value_segment_int, std::move(values), allocator_int));
 
       // add full chunk to table
       if (column_index == num_columns - 1) {
@@ -11,7 +11,7 @@ namespace opossum {
 
 class Table;
 
-enum class DataDistributionType { Uniform, NormalSkewed, Pareto };
+enum class DataDistributionType { Uniform, NormalSkewed, Pareto, Zipf };
 
 struct ColumnDataDistribution {
   static ColumnDataDistribution make_uniform_config(double min, double max) {
@@ -40,6 +40,16 @@ struct ColumnDataDistribution {
     return c;
   }
 
+  // The values 0 to num_different_values - 1, where value k occurs with a probability proportional to
+  // 1 / (k + 1)^zipf_exponent. An exponent of 0 is uniform, larger ones make the small values ever more frequent.
+  static ColumnDataDistribution make_zipf_config(int num_different_values = 1000, double zipf_exponent = 1.0) {
+    ColumnDataDistribution c{};
+    c.num_different_values = num_different_values;
+    c.zipf_exponent = zipf_exponent;
+    c.distribution_type = DataDistributionType::Zipf;
+    return c;
+  }
+
   DataDistributionType distribution_type = DataDistributionType::Uniform;
 
   int num_different_values = 1000;
@@ -51,6 +61,8 @@ struct ColumnDataDistribution {
   double skew_scale = 1.0;
   double skew_shape = 0.0;
 
+  double zipf_exponent = 1.0;
+
   double min_value = 0.0;
   double max_value = 1.0;
 };
@@ -0,0 +1,135 @@
+#include "ch_benchmark_queries.hpp"
+
+namespace {
+
+/**
+ * The dates of the TpccTableGenerator and of the TPC-C transactions are seconds since the epoch. The original dates
+ * are thus replaced by
+ *  915148800 for 1999-01-01,
+ *  1167696000 for 2007-01-02, and
+ *  2145916800 for 2038-01-01, which replaces 2020-01-01 as the tables are generated with the current date.
+ */
+
+/**
+ * CH-benCHmark 1
+ *
+ * Original:
+ *
+ * SELECT ol_number, sum(ol_quantity) as sum_qty, sum(ol_amount) as sum_amount, avg(ol_quantity) as avg_qty,
+ *        avg(ol_amount) as avg_amount, count(*) as count_order
+ * FROM order_line
+ * WHERE ol_delivery_d > '2007-01-02 00:00:00.000000'
+ * GROUP BY ol_number
+ * ORDER BY ol_number
+ */
+const char* const ch_benchmark_query_1 =
+    R"(SELECT OL_NUMBER, SUM(OL_QUANTITY) AS sum_qty, SUM(OL_AMOUNT) AS sum_amount, AVG(OL_QUANTITY) AS avg_qty,
+      AVG(OL_AMOUNT) AS avg_amount, COUNT(*) AS count_order FROM ORDER_LINE WHERE OL_DELIVERY_D > 1167696000
+      GROUP BY OL_NUMBER ORDER BY OL_NUMBER;)";
+
+/**
+ * CH-benCHmark 4
+ *
+ * Original:
+ *
+ * SELECT o_ol_cnt, count(*) as order_count
+ * FROM orders
+ * WHERE o_entry_d >= '2007-01-02 00:00:00.000000' AND o_entry_d < '2012-01-02 00:00:00.000000'
+ *   AND exists (SELECT * FROM order_line
+ *               WHERE o_id = ol_o_id AND o_w_id = ol_w_id AND o_d_id = ol_d_id AND ol_delivery_d >= o_entry_d)
+ * GROUP BY o_ol_cnt
+ * ORDER BY o_ol_cnt
+ *
+ * Changes:
+ *  1. The EXISTS is a join whose result is made distinct per order. A subquery that is correlated on more than one
+ *     column would be executed once per order.
+ *  2. The upper bound of o_entry_d is 2038-01-01
+ */
+const char* const ch_benchmark_query_4 =
+    R"(SELECT O_OL_CNT, COUNT(*) AS order_count FROM (SELECT DISTINCT O_W_ID, O_D_ID, O_ID, O_OL_CNT
+      FROM "ORDER", ORDER_LINE WHERE O_ID = OL_O_ID AND O_W_ID = OL_W_ID AND O_D_ID = OL_D_ID
+      AND OL_DELIVERY_D >= O_ENTRY_D AND O_ENTRY_D >= 1167696000 AND O_ENTRY_D < 2145916800) AS delivered_orders
+      GROUP BY O_OL_CNT ORDER BY O_OL_CNT;)";
+
+/**
+ * CH-benCHmark 6
+ *
+ * Original:
+ *
+ * SELECT sum(ol_amount) as revenue
+ * FROM order_line
+ * WHERE ol_delivery_d >= '1999-01-01 00:00:00.000000' AND ol_delivery_d < '2020-01-01 00:00:00.000000'
+ *   AND ol_quantity BETWEEN 1 AND 100000
+ */
+const char* const ch_benchmark_query_6 =
+    R"(SELECT SUM(OL_AMOUNT) AS revenue FROM ORDER_LINE WHERE OL_DELIVERY_D >= 915148800
+      AND OL_DELIVERY_D < 2145916800 AND OL_QUANTITY BETWEEN 1 AND 100000;)";
+
+/**
+ * CH-benCHmark 12
+ *
+ * Original:
+ *
+ * SELECT o_ol_cnt,
+ *        sum(case when o_carrier_id = 1 or o_carrier_id = 2 then 1 else 0 end) as high_line_count,
+ *        sum(case when o_carrier_id <> 1 and o_carrier_id <> 2 then 1 else 0 end) as low_line_count
+ * FROM orders, order_line
+ * WHERE ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_o_id = o_id AND o_entry_d <= ol_delivery_d
+ *   AND ol_delivery_d < '2020-01-01 00:00:00.000000'
+ * GROUP BY o_ol_cnt
+ * ORDER BY o_ol_cnt
+ */
+const char* const ch_benchmark_query_12 =
+    R"(SELECT O_OL_CNT, SUM(CASE WHEN O_CARRIER_ID = 1 OR O_CARRIER_ID = 2 THEN 1 ELSE 0 END) AS high_line_count,
+      SUM(CASE WHEN O_CARRIER_ID <> 1 AND O_CARRIER_ID <> 2 THEN 1 ELSE 0 END) AS low_line_count
+      FROM "ORDER", ORDER_LINE WHERE OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID
+      AND O_ENTRY_D <= OL_DELIVERY_D AND OL_DELIVERY_D < 2145916800 GROUP BY O_OL_CNT ORDER BY O_OL_CNT;)";
+
+/**
+ * CH-benCHmark 14
+ *
+ * Original:
+ *
+ * SELECT 100.00 * sum(case when i_data like 'PR%' then ol_amount else 0 end) / (1 + sum(ol_amount)) as promo_revenue
+ * FROM order_line, item
+ * WHERE ol_i_id = i_id AND ol_delivery_d >= '2007-01-02 00:00:00.000000'
+ *   AND ol_delivery_d < '2020-01-02 00:00:00.000000'
+ */
+const char* const ch_benchmark_query_14 =
+    R"(SELECT 100.00 * SUM(CASE WHEN I_DATA LIKE 'PR%' THEN OL_AMOUNT ELSE 0 END) / (1 + SUM(OL_AMOUNT))
+      AS promo_revenue FROM ORDER_LINE, ITEM WHERE OL_I_ID = I_ID AND OL_DELIVERY_D >= 1167696000
+      AND OL_DELIVERY_D < 2145916800;)";
+
+/**
+ * CH-benCHmark 19
+ *
+ * Original:
+ *
+ * SELECT sum(ol_amount) as revenue
+ * FROM order_line, item
+ * WHERE (ol_i_id = i_id AND i_data like '%a' AND ol_quantity >= 1 AND ol_quantity <= 10
+ *        AND i_price between 1 and 400000 AND ol_w_id in (1,2,3))
+ *    OR (ol_i_id = i_id AND i_data like '%b' AND ol_quantity >= 1 AND ol_quantity <= 10
+ *        AND i_price between 1 and 400000 AND ol_w_id in (1,2,4))
+ *    OR (ol_i_id = i_id AND i_data like '%c' AND ol_quantity >= 1 AND ol_quantity <= 10
+ *        AND i_price between 1 and 400000 AND ol_w_id in (1,5,3))
+ *
+ * Changes:
+ *  1. The predicates that all disjuncts share are factored out, so that the join predicate is not part of a
+ *     disjunction, which would make the optimizer keep the cross join
+ *  2. The warehouse ids start at zero
+ */
+const char* const ch_benchmark_query_19 =
+    R"(SELECT SUM(OL_AMOUNT) AS revenue FROM ORDER_LINE, ITEM WHERE OL_I_ID = I_ID AND OL_QUANTITY >= 1
+      AND OL_QUANTITY <= 10 AND I_PRICE BETWEEN 1 AND 400000 AND ((I_DATA LIKE '%a' AND OL_W_ID IN (0, 1, 2))
+      OR (I_DATA LIKE '%b' AND OL_W_ID IN (0, 1, 3)) OR (I_DATA LIKE '%c' AND OL_W_ID IN (0, 4, 2)));)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::map<size_t, const char*> ch_benchmark_queries = {
+    {1, ch_benchmark_query_1},   {4, ch_benchmark_query_4},   {6, ch_benchmark_query_6},
+    {12, ch_benchmark_query_12}, {14, ch_benchmark_query_14}, {19, ch_benchmark_query_19}};
+
+}  // namespace opossum
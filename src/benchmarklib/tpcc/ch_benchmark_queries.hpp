@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdlib>
+#include <map>
+
+namespace opossum {
+
+/**
+ * Contains the supported analytical queries of the CH-benCHmark (Cole et al., "The mixed workload CH-benCHmark",
+ * DBTest 2011), which are the TPC-H queries adapted to the TPC-C schema. Only those queries are supported that do not
+ * need the tables SUPPLIER, NATION, and REGION, which the TpccTableGenerator does not generate. Use ordered map to have
+ * queries sorted by query id.
+ */
+extern const std::map<size_t, const char*> ch_benchmark_queries;
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include "abstract_tpcc_procedure.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+
+namespace opossum {
+
+AbstractTpccProcedure::AbstractTpccProcedure(const int num_warehouses, TpccRandomGenerator& random_generator)
+    : _num_warehouses(num_warehouses), _random_generator(random_generator) {
+  Assert(num_warehouses > 0, "TPC-C needs at least one warehouse");
+}
+
+bool AbstractTpccProcedure::execute() {
+  _transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto success = _on_execute();
+
+  auto transaction_context = std::move(_transaction_context);
+  if (!success) {
+    // A failed read/write operator has already rolled back the transaction
+    if (!transaction_context->aborted()) transaction_context->rollback();
+    return false;
+  }
+
+  return transaction_context->commit();
+}
+
+std::pair<bool, std::shared_ptr<const Table>> AbstractTpccProcedure::_execute_sql(const std::string& sql) {
+  DebugAssert(_transaction_context, "SQL can only be executed by a running procedure");
+
+  auto pipeline_statement =
+      SQLPipelineBuilder{sql}.with_transaction_context(_transaction_context).create_pipeline_statement();
+  const auto& result_table = pipeline_statement.get_result_table();
+
+  if (_transaction_context->aborted()) return {false, nullptr};
+  return {true, result_table};
+}
+
+int AbstractTpccProcedure::_remote_warehouse_id(const int home_warehouse_id) {
+  if (_num_warehouses == 1) return home_warehouse_id;
+
+  const auto warehouse_id = static_cast<int>(_random_generator.random_number(0, _num_warehouses - 2));
+  return warehouse_id < home_warehouse_id ? warehouse_id : warehouse_id + 1;
+}
+
+std::pair<bool, std::optional<int>> AbstractTpccProcedure::_customer_id_by_last_name(const int warehouse_id,
+                                                                                     const int district_id,
+                                                                                     const std::string& last_name) {
+  const auto [success, customer_table] =
+      _execute_sql("SELECT C_ID FROM CUSTOMER WHERE C_W_ID = " + std::to_string(warehouse_id) +
+                   " AND C_D_ID = " + std::to_string(district_id) + " AND C_LAST = '" + last_name +
+                   "' ORDER BY C_FIRST");
+  if (!success) return {false, std::nullopt};
+
+  const auto customer_count = customer_table->row_count();
+  if (customer_count == 0) return {true, std::nullopt};
+  return {true, _get_value<int32_t>(*customer_table, ColumnID{0}, (customer_count - 1) / 2)};
+}
+
+}  // namespace opossum
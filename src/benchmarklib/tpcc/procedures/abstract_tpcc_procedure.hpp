@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "storage/base_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "tpcc/tpcc_random_generator.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+/**
+ * One of the five transactions of TPC-C (v5.11.0, clause 2). A procedure draws its input data from the terminal's
+ * random generator when it is created, and execute() then runs its SQL statements in a transaction of their own.
+ *
+ * Like in the tables of the TpccTableGenerator, all ids (warehouses, districts, customers, items, and orders) start at
+ * zero instead of one.
+ */
+class AbstractTpccProcedure {
+ public:
+  AbstractTpccProcedure(const int num_warehouses, TpccRandomGenerator& random_generator);
+  virtual ~AbstractTpccProcedure() = default;
+
+  virtual std::string name() const = 0;
+
+  // Returns false if the transaction was aborted, e.g., because it conflicted with a concurrent one, or rolled back as
+  // part of the procedure (e.g., 1% of the NewOrder transactions). Its modifications are undone in that case.
+  bool execute();
+
+ protected:
+  // Returns false if the procedure was aborted or wants to be rolled back
+  virtual bool _on_execute() = 0;
+
+  // Executes @param sql in the transaction of the procedure. The first value is false if the statement aborted the
+  // transaction, in which case the procedure has to stop.
+  std::pair<bool, std::shared_ptr<const Table>> _execute_sql(const std::string& sql);
+
+  // The value in the @param row_number of the @param column_id of a (small) result of _execute_sql, converted to T
+  template <typename T>
+  static T _get_value(const Table& table, const ColumnID column_id, const size_t row_number) {
+    auto chunk_offset = row_number;
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (chunk_offset < chunk->size()) {
+        return type_cast_variant<T>((*chunk->get_segment(column_id))[static_cast<ChunkOffset>(chunk_offset)]);
+      }
+      chunk_offset -= chunk->size();
+    }
+    Fail("Row does not exist");
+  }
+
+  // The id of a uniformly distributed warehouse other than @param home_warehouse_id, or the home warehouse if there is
+  // only one warehouse
+  int _remote_warehouse_id(const int home_warehouse_id);
+
+  // The id of the customer in the middle (TPC-C 2.5.2.2) of those of a district with the @param last_name, sorted by
+  // their first name. std::nullopt if there is none. The first value is false if the transaction was aborted.
+  std::pair<bool, std::optional<int>> _customer_id_by_last_name(const int warehouse_id, const int district_id,
+                                                                const std::string& last_name);
+
+  const int _num_warehouses;
+  TpccRandomGenerator& _random_generator;
+
+ private:
+  std::shared_ptr<TransactionContext> _transaction_context;
+};
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include "tpcc_delivery.hpp"
+
+#include <ctime>
+#include <string>
+
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccDelivery::TpccDelivery(const int num_warehouses, TpccRandomGenerator& random_generator)
+    : AbstractTpccProcedure(num_warehouses, random_generator) {
+  // TPC-C 2.7.1
+  _warehouse_id = static_cast<int>(_random_generator.random_number(0, _num_warehouses - 1));
+  _carrier_id = static_cast<int>(_random_generator.random_number(MIN_CARRIER_ID, MAX_CARRIER_ID));
+  _delivery_date = static_cast<int>(std::time(nullptr));
+}
+
+std::string TpccDelivery::name() const { return "Delivery"; }
+
+bool TpccDelivery::_on_execute() {
+  // TPC-C 2.7.4
+  const auto warehouse_id = std::to_string(_warehouse_id);
+
+  for (auto district_id_value = 0; district_id_value < NUM_DISTRICTS_PER_WAREHOUSE; ++district_id_value) {
+    const auto district_id = std::to_string(district_id_value);
+
+    const auto [new_order_success, new_order_table] =
+        _execute_sql("SELECT NO_O_ID FROM NEW_ORDER WHERE NO_W_ID = " + warehouse_id + " AND NO_D_ID = " +
+                     district_id + " ORDER BY NO_O_ID LIMIT 1");
+    if (!new_order_success) return false;
+
+    // Districts without undelivered orders are skipped
+    if (new_order_table->row_count() == 0) continue;
+    const auto order_id = std::to_string(_get_value<int32_t>(*new_order_table, ColumnID{0}, 0));
+
+    // Two concurrent deliveries of the same order conflict here, so that only one of them commits
+    if (!_execute_sql("DELETE FROM NEW_ORDER WHERE NO_W_ID = " + warehouse_id + " AND NO_D_ID = " + district_id +
+                      " AND NO_O_ID = " + order_id)
+             .first) {
+      return false;
+    }
+
+    const auto order_predicate =
+        " WHERE O_W_ID = " + warehouse_id + " AND O_D_ID = " + district_id + " AND O_ID = " + order_id;
+    const auto [order_success, order_table] = _execute_sql("SELECT O_C_ID FROM \"ORDER\"" + order_predicate);
+    if (!order_success) return false;
+    Assert(order_table->row_count() == 1, "Did not find the order");
+    const auto customer_id = std::to_string(_get_value<int32_t>(*order_table, ColumnID{0}, 0));
+
+    if (!_execute_sql("UPDATE \"ORDER\" SET O_CARRIER_ID = " + std::to_string(_carrier_id) + order_predicate).first) {
+      return false;
+    }
+
+    const auto order_line_predicate =
+        " WHERE OL_W_ID = " + warehouse_id + " AND OL_D_ID = " + district_id + " AND OL_O_ID = " + order_id;
+    if (!_execute_sql("UPDATE ORDER_LINE SET OL_DELIVERY_D = " + std::to_string(_delivery_date) +
+                      order_line_predicate)
+             .first) {
+      return false;
+    }
+
+    const auto [amount_success, amount_table] =
+        _execute_sql("SELECT SUM(OL_AMOUNT) FROM ORDER_LINE" + order_line_predicate);
+    if (!amount_success) return false;
+    const auto amount = _get_value<double>(*amount_table, ColumnID{0}, 0);
+
+    if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE + " + std::to_string(amount) +
+                      ", C_DELIVERY_CNT = C_DELIVERY_CNT + 1 WHERE C_W_ID = " + warehouse_id + " AND C_D_ID = " +
+                      district_id + " AND C_ID = " + customer_id)
+             .first) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+// Delivers the oldest new order of each district of a warehouse (clause 2.7), e.g., 4% of the transactions of the TPC-C
+// mix. Unlike the specification allows, the delivery is not queued, but executed right away.
+class TpccDelivery : public AbstractTpccProcedure {
+ public:
+  TpccDelivery(const int num_warehouses, TpccRandomGenerator& random_generator);
+
+  std::string name() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  int _warehouse_id;
+  int _carrier_id;
+  int _delivery_date;
+};
+
+}  // namespace opossum
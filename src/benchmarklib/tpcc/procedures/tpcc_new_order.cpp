@@ -0,0 +1,135 @@
+#include "tpcc_new_order.hpp"
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccNewOrder::TpccNewOrder(const int num_warehouses, TpccRandomGenerator& random_generator)
+    : AbstractTpccProcedure(num_warehouses, random_generator) {
+  // TPC-C 2.4.1
+  _warehouse_id = static_cast<int>(_random_generator.random_number(0, _num_warehouses - 1));
+  _district_id = static_cast<int>(_random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1));
+  _customer_id = static_cast<int>(_random_generator.nurand(1023, 0, NUM_CUSTOMERS_PER_DISTRICT - 1));
+
+  const auto order_line_count = _random_generator.random_number(MIN_ORDER_LINE_COUNT, MAX_ORDER_LINE_COUNT);
+  const auto rollback = _random_generator.random_number(1, 100) == 1;
+
+  _order_lines.resize(order_line_count);
+  for (auto& order_line : _order_lines) {
+    order_line.item_id = static_cast<int>(_random_generator.nurand(8191, 0, NUM_ITEMS - 1));
+    order_line.supply_warehouse_id =
+        _random_generator.random_number(1, 100) == 1 ? _remote_warehouse_id(_warehouse_id) : _warehouse_id;
+    order_line.quantity = static_cast<int>(_random_generator.random_number(1, MAX_ORDER_LINE_QUANTITY));
+  }
+
+  // An unused item id makes the transaction roll back when it looks the item up
+  if (rollback) _order_lines.back().item_id = NUM_ITEMS;
+
+  _entry_date = static_cast<int>(std::time(nullptr));
+}
+
+std::string TpccNewOrder::name() const { return "NewOrder"; }
+
+bool TpccNewOrder::_on_execute() {
+  // TPC-C 2.4.2
+  const auto warehouse_id = std::to_string(_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+
+  const auto [warehouse_success, warehouse_table] =
+      _execute_sql("SELECT W_TAX FROM WAREHOUSE WHERE W_ID = " + warehouse_id);
+  if (!warehouse_success) return false;
+  Assert(warehouse_table->row_count() == 1, "Did not find the warehouse");
+  const auto warehouse_tax = _get_value<float>(*warehouse_table, ColumnID{0}, 0);
+
+  const auto district_predicate = " WHERE D_W_ID = " + warehouse_id + " AND D_ID = " + district_id;
+  const auto [district_success, district_table] =
+      _execute_sql("SELECT D_TAX, D_NEXT_O_ID FROM DISTRICT" + district_predicate);
+  if (!district_success) return false;
+  Assert(district_table->row_count() == 1, "Did not find the district");
+  const auto district_tax = _get_value<float>(*district_table, ColumnID{0}, 0);
+  const auto order_id = std::to_string(_get_value<int32_t>(*district_table, ColumnID{1}, 0));
+
+  // Getting the order id and incrementing it is not atomic. Two concurrent orders of a district that read the same
+  // D_NEXT_O_ID conflict when they update it, so that only one of them commits.
+  if (!_execute_sql("UPDATE DISTRICT SET D_NEXT_O_ID = " + order_id + " + 1" + district_predicate).first) return false;
+
+  const auto [customer_success, customer_table] =
+      _execute_sql("SELECT C_DISCOUNT, C_LAST, C_CREDIT FROM CUSTOMER WHERE C_W_ID = " + warehouse_id +
+                   " AND C_D_ID = " + district_id + " AND C_ID = " + std::to_string(_customer_id));
+  if (!customer_success) return false;
+  Assert(customer_table->row_count() == 1, "Did not find the customer");
+  const auto customer_discount = _get_value<float>(*customer_table, ColumnID{0}, 0);
+
+  auto all_local = true;
+  for (const auto& order_line : _order_lines) {
+    all_local &= order_line.supply_warehouse_id == _warehouse_id;
+  }
+
+  if (!_execute_sql("INSERT INTO \"ORDER\" VALUES (" + order_id + ", " + district_id + ", " + warehouse_id + ", " +
+                    std::to_string(_customer_id) + ", " + std::to_string(_entry_date) + ", -1, " +
+                    std::to_string(_order_lines.size()) + ", " + (all_local ? "1" : "0") + ")")
+           .first) {
+    return false;
+  }
+
+  if (!_execute_sql("INSERT INTO NEW_ORDER VALUES (" + order_id + ", " + district_id + ", " + warehouse_id + ")")
+           .first) {
+    return false;
+  }
+
+  auto district_info_column = std::stringstream{};
+  district_info_column << "S_DIST_" << std::setw(2) << std::setfill('0') << (_district_id + 1);
+
+  for (auto line_number = size_t{0}; line_number < _order_lines.size(); ++line_number) {
+    const auto& order_line = _order_lines[line_number];
+    const auto item_id = std::to_string(order_line.item_id);
+    const auto supply_warehouse_id = std::to_string(order_line.supply_warehouse_id);
+
+    const auto [item_success, item_table] =
+        _execute_sql("SELECT I_PRICE, I_NAME, I_DATA FROM ITEM WHERE I_ID = " + item_id);
+    if (!item_success) return false;
+
+    // An unknown item rolls back the order (TPC-C 2.4.2.3)
+    if (item_table->row_count() == 0) return false;
+    const auto item_price = _get_value<float>(*item_table, ColumnID{0}, 0);
+
+    const auto stock_predicate = " WHERE S_I_ID = " + item_id + " AND S_W_ID = " + supply_warehouse_id;
+    const auto [stock_success, stock_table] =
+        _execute_sql("SELECT S_QUANTITY, " + district_info_column.str() + " FROM STOCK" + stock_predicate);
+    if (!stock_success) return false;
+    Assert(stock_table->row_count() == 1, "Did not find the stock of the item");
+    const auto stock_quantity = _get_value<int32_t>(*stock_table, ColumnID{0}, 0);
+    const auto district_info = _get_value<std::string>(*stock_table, ColumnID{1}, 0);
+
+    const auto new_stock_quantity = stock_quantity - order_line.quantity >= 10
+                                        ? stock_quantity - order_line.quantity
+                                        : stock_quantity - order_line.quantity + 91;
+    const auto is_remote = order_line.supply_warehouse_id != _warehouse_id;
+    if (!_execute_sql("UPDATE STOCK SET S_QUANTITY = " + std::to_string(new_stock_quantity) +
+                      ", S_YTD = S_YTD + " + std::to_string(order_line.quantity) +
+                      ", S_ORDER_CNT = S_ORDER_CNT + 1, S_REMOTE_CNT = S_REMOTE_CNT + " + (is_remote ? "1" : "0") +
+                      stock_predicate)
+             .first) {
+      return false;
+    }
+
+    const auto amount =
+        order_line.quantity * item_price * (1.0f + warehouse_tax + district_tax) * (1.0f - customer_discount);
+    if (!_execute_sql("INSERT INTO ORDER_LINE VALUES (" + order_id + ", " + district_id + ", " + warehouse_id + ", " +
+                      std::to_string(line_number) + ", " + item_id + ", " + supply_warehouse_id + ", -1, " +
+                      std::to_string(order_line.quantity) + ", " + std::to_string(amount) + ", '" + district_info +
+                      "')")
+             .first) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
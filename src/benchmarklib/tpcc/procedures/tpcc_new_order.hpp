@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+// Enters a new order of 5 to 15 items (clause 2.4), e.g., 45% of the transactions of the TPC-C mix
+class TpccNewOrder : public AbstractTpccProcedure {
+ public:
+  TpccNewOrder(const int num_warehouses, TpccRandomGenerator& random_generator);
+
+  std::string name() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  struct OrderLine {
+    int item_id;
+    int supply_warehouse_id;
+    int quantity;
+  };
+
+  int _warehouse_id;
+  int _district_id;
+  int _customer_id;
+  std::vector<OrderLine> _order_lines;
+  int _entry_date;
+};
+
+}  // namespace opossum
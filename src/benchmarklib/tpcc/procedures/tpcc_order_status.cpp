@@ -0,0 +1,60 @@
+#include "tpcc_order_status.hpp"
+
+#include <string>
+
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccOrderStatus::TpccOrderStatus(const int num_warehouses, TpccRandomGenerator& random_generator)
+    : AbstractTpccProcedure(num_warehouses, random_generator) {
+  // TPC-C 2.6.1
+  _warehouse_id = static_cast<int>(_random_generator.random_number(0, _num_warehouses - 1));
+  _district_id = static_cast<int>(_random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1));
+
+  if (_random_generator.random_number(1, 100) <= 60) {
+    _customer_last_name = _random_generator.last_name(_random_generator.nurand(255, 0, 999));
+  }
+  _customer_id = static_cast<int>(_random_generator.nurand(1023, 0, NUM_CUSTOMERS_PER_DISTRICT - 1));
+}
+
+std::string TpccOrderStatus::name() const { return "OrderStatus"; }
+
+bool TpccOrderStatus::_on_execute() {
+  // TPC-C 2.6.2
+  const auto warehouse_id = std::to_string(_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+
+  auto customer_id = _customer_id;
+  if (_customer_last_name) {
+    const auto [customer_success, customer_id_by_last_name] =
+        _customer_id_by_last_name(_warehouse_id, _district_id, *_customer_last_name);
+    if (!customer_success) return false;
+
+    // Not every generated last name is used by a customer of every district
+    if (customer_id_by_last_name) customer_id = *customer_id_by_last_name;
+  }
+
+  const auto [customer_success, customer_table] =
+      _execute_sql("SELECT C_BALANCE, C_FIRST, C_MIDDLE, C_LAST FROM CUSTOMER WHERE C_W_ID = " + warehouse_id +
+                   " AND C_D_ID = " + district_id + " AND C_ID = " + std::to_string(customer_id));
+  if (!customer_success) return false;
+  Assert(customer_table->row_count() == 1, "Did not find the customer");
+
+  const auto [order_success, order_table] =
+      _execute_sql("SELECT O_ID, O_ENTRY_D, O_CARRIER_ID FROM \"ORDER\" WHERE O_W_ID = " + warehouse_id +
+                   " AND O_D_ID = " + district_id + " AND O_C_ID = " + std::to_string(customer_id) +
+                   " ORDER BY O_ID DESC LIMIT 1");
+  if (!order_success) return false;
+
+  // Customers without orders have no order lines to list
+  if (order_table->row_count() == 0) return true;
+  const auto order_id = std::to_string(_get_value<int32_t>(*order_table, ColumnID{0}, 0));
+
+  return _execute_sql(
+             "SELECT OL_I_ID, OL_SUPPLY_W_ID, OL_QUANTITY, OL_AMOUNT, OL_DELIVERY_D FROM ORDER_LINE WHERE OL_W_ID = " +
+             warehouse_id + " AND OL_D_ID = " + district_id + " AND OL_O_ID = " + order_id)
+      .first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+// Reads the last order of a customer (clause 2.6), e.g., 4% of the transactions of the TPC-C mix
+class TpccOrderStatus : public AbstractTpccProcedure {
+ public:
+  TpccOrderStatus(const int num_warehouses, TpccRandomGenerator& random_generator);
+
+  std::string name() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  int _warehouse_id;
+  int _district_id;
+
+  // 60% of the customers are selected by their last name, the others by their id
+  std::optional<std::string> _customer_last_name;
+  int _customer_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include "tpcc_payment.hpp"
+
+#include <ctime>
+#include <string>
+
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccPayment::TpccPayment(const int num_warehouses, TpccRandomGenerator& random_generator)
+    : AbstractTpccProcedure(num_warehouses, random_generator) {
+  // TPC-C 2.5.1
+  _warehouse_id = static_cast<int>(_random_generator.random_number(0, _num_warehouses - 1));
+  _district_id = static_cast<int>(_random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1));
+
+  // 85% of the customers pay at their home warehouse
+  if (_random_generator.random_number(1, 100) <= 85) {
+    _customer_warehouse_id = _warehouse_id;
+    _customer_district_id = _district_id;
+  } else {
+    _customer_warehouse_id = _remote_warehouse_id(_warehouse_id);
+    _customer_district_id = static_cast<int>(_random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1));
+  }
+
+  if (_random_generator.random_number(1, 100) <= 60) {
+    _customer_last_name = _random_generator.last_name(_random_generator.nurand(255, 0, 999));
+  }
+  _customer_id = static_cast<int>(_random_generator.nurand(1023, 0, NUM_CUSTOMERS_PER_DISTRICT - 1));
+
+  _amount = static_cast<float>(_random_generator.random_number(100, 500'000)) / 100.0f;
+  _date = static_cast<int>(std::time(nullptr));
+}
+
+std::string TpccPayment::name() const { return "Payment"; }
+
+bool TpccPayment::_on_execute() {
+  // TPC-C 2.5.2
+  const auto warehouse_id = std::to_string(_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+  const auto amount = std::to_string(_amount);
+
+  const auto warehouse_predicate = " WHERE W_ID = " + warehouse_id;
+  if (!_execute_sql("UPDATE WAREHOUSE SET W_YTD = W_YTD + " + amount + warehouse_predicate).first) return false;
+  const auto [warehouse_success, warehouse_table] = _execute_sql("SELECT W_NAME FROM WAREHOUSE" + warehouse_predicate);
+  if (!warehouse_success) return false;
+  Assert(warehouse_table->row_count() == 1, "Did not find the warehouse");
+  const auto warehouse_name = _get_value<std::string>(*warehouse_table, ColumnID{0}, 0);
+
+  const auto district_predicate = " WHERE D_W_ID = " + warehouse_id + " AND D_ID = " + district_id;
+  if (!_execute_sql("UPDATE DISTRICT SET D_YTD = D_YTD + " + amount + district_predicate).first) return false;
+  const auto [district_success, district_table] = _execute_sql("SELECT D_NAME FROM DISTRICT" + district_predicate);
+  if (!district_success) return false;
+  Assert(district_table->row_count() == 1, "Did not find the district");
+  const auto district_name = _get_value<std::string>(*district_table, ColumnID{0}, 0);
+
+  auto customer_id = _customer_id;
+  if (_customer_last_name) {
+    const auto [customer_success, customer_id_by_last_name] =
+        _customer_id_by_last_name(_customer_warehouse_id, _customer_district_id, *_customer_last_name);
+    if (!customer_success) return false;
+
+    // Not every generated last name is used by a customer of every district
+    if (customer_id_by_last_name) customer_id = *customer_id_by_last_name;
+  }
+
+  const auto customer_predicate = " WHERE C_W_ID = " + std::to_string(_customer_warehouse_id) +
+                                  " AND C_D_ID = " + std::to_string(_customer_district_id) +
+                                  " AND C_ID = " + std::to_string(customer_id);
+  const auto [customer_success, customer_table] = _execute_sql("SELECT C_CREDIT, C_DATA FROM CUSTOMER" +
+                                                               customer_predicate);
+  if (!customer_success) return false;
+  Assert(customer_table->row_count() == 1, "Did not find the customer");
+
+  // Customers with bad credit get the payment prepended to their C_DATA, which is limited to 500 characters
+  auto customer_data_update = std::string{};
+  if (_get_value<std::string>(*customer_table, ColumnID{0}, 0) == "BC") {
+    const auto customer_data =
+        std::to_string(customer_id) + " " + std::to_string(_customer_district_id) + " " +
+        std::to_string(_customer_warehouse_id) + " " + district_id + " " + warehouse_id + " " + amount + " " +
+        _get_value<std::string>(*customer_table, ColumnID{1}, 0);
+    customer_data_update = ", C_DATA = '" + customer_data.substr(0, 500) + "'";
+  }
+
+  if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE - " + amount + ", C_YTD_PAYMENT = C_YTD_PAYMENT + " +
+                    amount + ", C_PAYMENT_CNT = C_PAYMENT_CNT + 1" + customer_data_update + customer_predicate)
+           .first) {
+    return false;
+  }
+
+  // The generated HISTORY table has no columns for the district and warehouse of the payment
+  return _execute_sql("INSERT INTO HISTORY VALUES (" + std::to_string(customer_id) + ", " +
+                      std::to_string(_customer_district_id) + ", " + std::to_string(_customer_warehouse_id) + ", " +
+                      std::to_string(_date) + ", " + amount + ", '" + warehouse_name + "    " + district_name + "')")
+      .first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+// Records a payment of a customer (clause 2.5), e.g., 43% of the transactions of the TPC-C mix
+class TpccPayment : public AbstractTpccProcedure {
+ public:
+  TpccPayment(const int num_warehouses, TpccRandomGenerator& random_generator);
+
+  std::string name() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  int _warehouse_id;
+  int _district_id;
+  int _customer_warehouse_id;
+  int _customer_district_id;
+
+  // 60% of the customers are selected by their last name, the others by their id
+  std::optional<std::string> _customer_last_name;
+  int _customer_id;
+
+  float _amount;
+  int _date;
+};
+
+}  // namespace opossum
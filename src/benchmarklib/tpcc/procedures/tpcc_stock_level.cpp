@@ -0,0 +1,38 @@
+#include "tpcc_stock_level.hpp"
+
+#include <string>
+
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccStockLevel::TpccStockLevel(const int num_warehouses, TpccRandomGenerator& random_generator)
+    : AbstractTpccProcedure(num_warehouses, random_generator) {
+  // TPC-C 2.8.1
+  _warehouse_id = static_cast<int>(_random_generator.random_number(0, _num_warehouses - 1));
+  _district_id = static_cast<int>(_random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1));
+  _threshold = static_cast<int>(_random_generator.random_number(10, 20));
+}
+
+std::string TpccStockLevel::name() const { return "StockLevel"; }
+
+bool TpccStockLevel::_on_execute() {
+  // TPC-C 2.8.2
+  const auto warehouse_id = std::to_string(_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+
+  const auto [district_success, district_table] = _execute_sql(
+      "SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + warehouse_id + " AND D_ID = " + district_id);
+  if (!district_success) return false;
+  Assert(district_table->row_count() == 1, "Did not find the district");
+  const auto next_order_id = _get_value<int32_t>(*district_table, ColumnID{0}, 0);
+
+  // The items of the last 20 orders of the district
+  return _execute_sql("SELECT COUNT(DISTINCT S_I_ID) FROM ORDER_LINE, STOCK WHERE OL_W_ID = " + warehouse_id +
+                      " AND OL_D_ID = " + district_id + " AND OL_O_ID < " + std::to_string(next_order_id) +
+                      " AND OL_O_ID >= " + std::to_string(next_order_id - 20) + " AND S_W_ID = " + warehouse_id +
+                      " AND S_I_ID = OL_I_ID AND S_QUANTITY < " + std::to_string(_threshold))
+      .first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+// Counts the recently sold items of a district whose stock is below a threshold (clause 2.8), e.g., 4% of the
+// transactions of the TPC-C mix
+class TpccStockLevel : public AbstractTpccProcedure {
+ public:
+  TpccStockLevel(const int num_warehouses, TpccRandomGenerator& random_generator);
+
+  std::string name() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  int _warehouse_id;
+  int _district_id;
+  int _threshold;
+};
+
+}  // namespace opossum
@@ -186,7 +186,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_district_table() {
   add_column<float>(segments_by_chunk, column_definitions, "D_YTD", cardinalities,
                     [&](std::vector<size_t>) { return CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT; });
   add_column<int>(segments_by_chunk, column_definitions, "D_NEXT_O_ID", cardinalities,
-                  [&](std::vector<size_t>) { return NUM_ORDERS + 1; });
+                  [&](std::vector<size_t>) { return NUM_ORDERS; });
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
@@ -326,7 +326,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
 
   add_column<int>(segments_by_chunk, column_definitions, "O_CARRIER_ID", cardinalities,
                   [&](std::vector<size_t> indices) {
-                    return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? _random_gen.random_number(1, 10) : -1;
+                    return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? _random_gen.random_number(1, 10) : -1;
                   });
   add_column<int>(segments_by_chunk, column_definitions, "O_OL_CNT", cardinalities,
                   [&](std::vector<size_t> indices) { return order_line_counts[indices[0]][indices[1]][indices[2]]; });
@@ -417,20 +417,20 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_NUMBER", cardinalities, order_line_counts,
                               [&](std::vector<size_t> indices) { return indices[3]; });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_I_ID", cardinalities, order_line_counts,
-                              [&](std::vector<size_t>) { return _random_gen.random_number(1, NUM_ITEMS); });
+                              [&](std::vector<size_t>) { return _random_gen.random_number(0, NUM_ITEMS - 1); });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_SUPPLY_W_ID", cardinalities, order_line_counts,
                               [&](std::vector<size_t> indices) { return indices[0]; });
   // TODO(anybody) -1 should be null
   _add_order_line_column<int>(
       segments_by_chunk, column_definitions, "OL_DELIVERY_D", cardinalities, order_line_counts,
-      [&](std::vector<size_t> indices) { return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? _current_date : -1; });
+      [&](std::vector<size_t> indices) { return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? _current_date : -1; });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_QUANTITY", cardinalities, order_line_counts,
                               [&](std::vector<size_t>) { return 5; });
 
   _add_order_line_column<float>(
       segments_by_chunk, column_definitions, "OL_AMOUNT", cardinalities, order_line_counts,
       [&](std::vector<size_t> indices) {
-        return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? 0.f : _random_gen.random_number(1, 999999) / 100.f;
+        return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? 0.f : _random_gen.random_number(1, 999999) / 100.f;
       });
   _add_order_line_column<std::string>(segments_by_chunk, column_definitions, "OL_DIST_INFO", cardinalities,
                                       order_line_counts,
@@ -445,7 +445,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
 
 std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   auto cardinalities = std::make_shared<std::vector<size_t>>(
-      std::initializer_list<size_t>{_warehouse_size, NUM_DISTRICTS_PER_WAREHOUSE, NUM_ORDERS});
+      std::initializer_list<size_t>{_warehouse_size, NUM_DISTRICTS_PER_WAREHOUSE, NUM_NEW_ORDERS});
 
   /**
    * indices[0] = warehouse
@@ -456,7 +456,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   TableColumnDefinitions column_definitions;
 
   add_column<int>(segments_by_chunk, column_definitions, "NO_O_ID", cardinalities,
-                  [&](std::vector<size_t> indices) { return indices[2] + NUM_ORDERS + 1 - NUM_NEW_ORDERS; });
+                  [&](std::vector<size_t> indices) { return indices[2] + NUM_ORDERS - NUM_NEW_ORDERS; });
   add_column<int>(segments_by_chunk, column_definitions, "NO_D_ID", cardinalities,
                   [&](std::vector<size_t> indices) { return indices[1]; });
   add_column<int>(segments_by_chunk, column_definitions, "NO_W_ID", cardinalities,
@@ -507,8 +507,8 @@ TpccTableGeneratorFunctions TpccTableGenerator::table_generator_functions() {
       {"DISTRICT", []() { return TpccTableGenerator().generate_district_table(); }},
       {"CUSTOMER", []() { return TpccTableGenerator().generate_customer_table(); }},
       {"HISTORY", []() { return TpccTableGenerator().generate_history_table(); }},
-      {"ORDER", []() { return TpccTableGenerator().generate_new_order_table(); }},
-      {"NEW_ORDER",
+      {"NEW_ORDER", []() { return TpccTableGenerator().generate_new_order_table(); }},
+      {"ORDER",
        []() {
          auto order_line_counts = TpccTableGenerator().generate_order_line_counts();
          return TpccTableGenerator().generate_order_table(order_line_counts);
@@ -0,0 +1,76 @@
+#include "tpcc_terminal.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "procedures/tpcc_delivery.hpp"
+#include "procedures/tpcc_new_order.hpp"
+#include "procedures/tpcc_order_status.hpp"
+#include "procedures/tpcc_payment.hpp"
+#include "procedures/tpcc_stock_level.hpp"
+#include "utils/format_duration.hpp"
+
+namespace opossum {
+
+TpccTerminal::TpccTerminal(const int num_warehouses, const uint32_t seed)
+    : _num_warehouses(num_warehouses), _random_generator(seed) {}
+
+void TpccTerminal::run(const std::chrono::steady_clock::time_point measurement_begin,
+                       const std::chrono::steady_clock::time_point end, Results& results) {
+  while (std::chrono::steady_clock::now() < end) {
+    const auto [procedure_index, procedure] = _create_procedure();
+
+    const auto procedure_begin = std::chrono::steady_clock::now();
+    const auto committed = procedure->execute();
+    const auto procedure_end = std::chrono::steady_clock::now();
+    if (procedure_begin < measurement_begin || procedure_end > end) continue;
+
+    auto& result = results[procedure_index];
+    ++(committed ? result.committed_count : result.aborted_count);
+    result.latency_histogram.record(procedure_end - procedure_begin);
+  }
+}
+
+double TpccTerminal::tpmc(const Results& results, const std::chrono::nanoseconds measurement_duration) {
+  const auto measurement_minutes = std::chrono::duration<double, std::ratio<60>>{measurement_duration}.count();
+  return static_cast<double>(results[0].committed_count) / measurement_minutes;
+}
+
+nlohmann::json TpccTerminal::report(const Results& results) {
+  auto procedures_json = nlohmann::json::array();
+  for (auto procedure_index = size_t{0}; procedure_index < PROCEDURE_NAMES.size(); ++procedure_index) {
+    const auto& result = results[procedure_index];
+    const auto committed_count = result.committed_count.load();
+    const auto aborted_count = result.aborted_count.load();
+    const auto total_count = committed_count + aborted_count;
+    const auto abort_rate =
+        total_count > 0 ? static_cast<double>(aborted_count) / static_cast<double>(total_count) : 0.0;
+    const auto& latency_histogram = result.latency_histogram;
+
+    std::cout << "  -> " << std::setw(11) << std::left << PROCEDURE_NAMES[procedure_index] << " committed "
+              << committed_count << ", aborted " << aborted_count << " (" << std::fixed << std::setprecision(2)
+              << abort_rate * 100.0 << "%), latency p50 " << format_duration(latency_histogram.percentile(50.0))
+              << ", p99 " << format_duration(latency_histogram.percentile(99.0)) << std::endl;
+
+    procedures_json.push_back({{"name", PROCEDURE_NAMES[procedure_index]},
+                               {"committed", committed_count},
+                               {"aborted", aborted_count},
+                               {"abort_rate", abort_rate},
+                               {"latency", latency_histogram.to_json()}});
+  }
+  return procedures_json;
+}
+
+std::pair<size_t, std::unique_ptr<AbstractTpccProcedure>> TpccTerminal::_create_procedure() {
+  const auto random = _random_generator.random_number(1, 100);
+  if (random <= 45) return {0, std::make_unique<TpccNewOrder>(_num_warehouses, _random_generator)};
+  if (random <= 88) return {1, std::make_unique<TpccPayment>(_num_warehouses, _random_generator)};
+  if (random <= 92) return {2, std::make_unique<TpccOrderStatus>(_num_warehouses, _random_generator)};
+  if (random <= 96) return {3, std::make_unique<TpccDelivery>(_num_warehouses, _random_generator)};
+  return {4, std::make_unique<TpccStockLevel>(_num_warehouses, _random_generator)};
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "json.hpp"
+
+#include "procedures/abstract_tpcc_procedure.hpp"
+#include "tpcc_random_generator.hpp"
+#include "utils/latency_histogram.hpp"
+
+namespace opossum {
+
+// The committed and aborted runs of one of the TPC-C transactions, recorded concurrently by all terminals
+struct TpccProcedureResult {
+  std::atomic<uint64_t> committed_count{0};
+  std::atomic<uint64_t> aborted_count{0};
+  LatencyHistogram latency_histogram;
+};
+
+/**
+ * A terminal of TPC-C that executes one transaction of the mix (NewOrder 45%, Payment 43%, OrderStatus, Delivery, and
+ * StockLevel 4% each, clause 5.2.3) after the other, without keying or think times. Transactions that conflict with a
+ * concurrent one are aborted and not retried. Used by the TPC-C benchmark and the CH-benCHmark.
+ */
+class TpccTerminal {
+ public:
+  static constexpr auto PROCEDURE_NAMES =
+      std::array<const char*, 5>{"NewOrder", "Payment", "OrderStatus", "Delivery", "StockLevel"};
+  using Results = std::array<TpccProcedureResult, PROCEDURE_NAMES.size()>;
+
+  // The fixed @param seed keeps the inputs, and thus the runs, comparable
+  TpccTerminal(const int num_warehouses, const uint32_t seed);
+
+  // Runs transactions until @param end. Only those that ran entirely after @param measurement_begin are recorded.
+  void run(const std::chrono::steady_clock::time_point measurement_begin,
+           const std::chrono::steady_clock::time_point end, Results& results);
+
+  // The committed NewOrder transactions per minute of a measurement that took @param measurement_duration
+  static double tpmc(const Results& results, const std::chrono::nanoseconds measurement_duration);
+
+  // Prints a line per transaction to std::cout and returns the same as JSON
+  static nlohmann::json report(const Results& results);
+
+ private:
+  // Draws a transaction of the mix and returns its index in PROCEDURE_NAMES
+  std::pair<size_t, std::unique_ptr<AbstractTpccProcedure>> _create_procedure();
+
+  const int _num_warehouses;
+  TpccRandomGenerator _random_generator;
+};
+
+}  // namespace opossum
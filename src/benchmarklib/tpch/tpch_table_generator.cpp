@@ -6,10 +6,16 @@ extern "C" {
 #include <rnd.h>
 }
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "boost/hana/for_each.hpp"
 #include "boost/hana/integral_constant.hpp"
+#include "boost/hana/range.hpp"
 #include "boost/hana/zip_with.hpp"
 
 #include "benchmark_config.hpp"
@@ -53,20 +59,69 @@ const auto region_column_names = boost::hana::make_tuple("r_regionkey", "r_name"
 
 // clang-format on
 
+// Calls functor(index) for each index in [0, count) on `hardware_concurrency` threads. Not using JobTasks here because
+// we want parallelism even if the scheduler is disabled (see BenchmarkTableEncoder).
+template <typename Functor>
+void for_each_index_in_parallel(const size_t count, const Functor& functor) {
+  auto next_index = std::atomic_size_t{0};
+  auto threads = std::vector<std::thread>{};
+
+  const auto thread_count = std::min(count, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&] {
+      while (true) {
+        const auto index = next_index++;
+        if (index >= count) return;
+        functor(index);
+      }
+    });
+  }
+
+  for (auto& thread : threads) thread.join();
+}
+
 /**
- * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. Keeps a vector
- * for each column and appends values to them in append_row(). Automatically creates chunks in accordance with the
- * specified chunk size.
+ * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. The rows are
+ * appended to one of several parts, so that several threads can generate them at once. Each part keeps a vector for
+ * each column. finish_table() concatenates the parts in their order and cuts them into chunks of the specified chunk
+ * size, building the ValueSegments of the chunks in parallel.
  *
  * No real need to tie this to TPCH, but atm it is only used here so that's where it resides.
  */
 template <typename... DataTypes>
 class TableBuilder {
  public:
+  // The rows that a single thread appends
+  class Part {
+   public:
+    void append_row(DataTypes&&... column_values) {
+      // Create a tuple ([&data_vector0, value0], ...)
+      auto vectors_and_values = boost::hana::zip_with(
+          [](auto& vector, auto&& value) {
+            return boost::hana::make_tuple(std::reference_wrapper(vector), std::forward<decltype(value)>(value));
+          },
+          _data_vectors, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
+
+      // Add the values to their respective data vector
+      boost::hana::for_each(vectors_and_values, [](auto&& vector_and_value) {
+        vector_and_value[boost::hana::llong_c<0>].get().emplace_back(
+            std::move(vector_and_value[boost::hana::llong_c<1>]));
+      });
+    }
+
+   private:
+    friend class TableBuilder;
+
+    boost::hana::tuple<std::vector<DataTypes>...> _data_vectors;
+
+    size_t _row_count() const { return _data_vectors[boost::hana::llong_c<0>].size(); }
+  };
+
   template <typename... Strings>
   TableBuilder(size_t chunk_size, const boost::hana::tuple<DataTypes...>& column_types,
-               const boost::hana::tuple<Strings...>& column_names, opossum::UseMvcc use_mvcc, size_t estimated_rows = 0)
-      : _use_mvcc(use_mvcc), _estimated_rows_per_chunk(estimated_rows < chunk_size ? estimated_rows : chunk_size) {
+               const boost::hana::tuple<Strings...>& column_names, opossum::UseMvcc use_mvcc, size_t estimated_rows = 0,
+               size_t part_count = 1)
+      : _parts(part_count) {
     /**
      * Create a tuple ((column_name0, column_type0), (column_name1, column_type1), ...) so we can iterate over the
      * columns.
@@ -90,57 +145,62 @@ class TableBuilder {
     _table = std::make_shared<opossum::Table>(column_definitions, opossum::TableType::Data, chunk_size, use_mvcc);
 
     // Reserve some space in the vectors
-    boost::hana::for_each(_data_vectors, [&](auto&& vector) { vector.reserve(_estimated_rows_per_chunk); });
+    for (auto& part : _parts) {
+      boost::hana::for_each(part._data_vectors, [&](auto&& vector) { vector.reserve(estimated_rows / part_count); });
+    }
   }
 
+  Part& part(const size_t part_id) { return _parts[part_id]; }
+
   std::shared_ptr<opossum::Table> finish_table() {
-    if (_current_chunk_row_count() > 0) {
-      _emit_chunk();
+    // The position of the first row of each part in the table
+    auto part_begins = std::vector<size_t>(_parts.size() + 1);
+    for (auto part_id = size_t{0}; part_id < _parts.size(); ++part_id) {
+      part_begins[part_id + 1] = part_begins[part_id] + _parts[part_id]._row_count();
     }
 
-    return _table;
-  }
-
-  void append_row(DataTypes&&... column_values) {
-    // Create a tuple ([&data_vector0, value0], ...)
-    auto vectors_and_values = boost::hana::zip_with(
-        [](auto& vector, auto&& value) {
-          return boost::hana::make_tuple(std::reference_wrapper(vector), std::forward<decltype(value)>(value));
-        },
-        _data_vectors, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
-
-    // Add the values to their respective data vector
-    boost::hana::for_each(vectors_and_values, [](auto&& vector_and_value) {
-      vector_and_value[boost::hana::llong_c<0>].get().emplace_back(
-          std::move(vector_and_value[boost::hana::llong_c<1>]));
+    const auto row_count = part_begins.back();
+    const auto chunk_size = size_t{_table->max_chunk_size()};
+    const auto chunk_count = (row_count + chunk_size - 1) / chunk_size;
+
+    _table->create_chunk_slots(chunk_count);
+    for_each_index_in_parallel(chunk_count, [&](const size_t chunk_idx) {
+      const auto chunk_begin = chunk_idx * chunk_size;
+      const auto chunk_end = std::min(chunk_begin + chunk_size, row_count);
+
+      // Move the rows of the chunk out of the parts that hold them, then create a segment from each data vector
+      opossum::Segments segments;
+      boost::hana::for_each(boost::hana::make_range(boost::hana::size_c<0>, boost::hana::size_c<sizeof...(DataTypes)>),
+                            [&](auto column_idx) {
+                              using T = typename std::decay_t<decltype(
+                                  _parts[0]._data_vectors[column_idx])>::value_type;
+                              auto values = std::vector<T>{};
+                              values.reserve(chunk_end - chunk_begin);
+
+                              auto part_id = static_cast<size_t>(std::distance(
+                                  part_begins.cbegin(),
+                                  std::upper_bound(part_begins.cbegin(), part_begins.cend(), chunk_begin) - 1));
+                              for (; part_begins[part_id] < chunk_end; ++part_id) {
+                                auto& part_vector = _parts[part_id]._data_vectors[column_idx];
+                                const auto begin = std::max(chunk_begin, part_begins[part_id]) - part_begins[part_id];
+                                const auto end = std::min(chunk_end, part_begins[part_id + 1]) - part_begins[part_id];
+                                std::move(part_vector.begin() + begin, part_vector.begin() + end,
+                                          std::back_inserter(values));
+                              }
+
+                              segments.push_back(std::make_shared<opossum::ValueSegment<T>>(std::move(values)));
+                            });
+      _table->set_chunk_slot(chunk_idx, segments);
     });
+    _table->append_chunk_slots();
 
-    if (_current_chunk_row_count() >= _table->max_chunk_size()) {
-      _emit_chunk();
-    }
+    _parts.clear();
+    return _table;
   }
 
  private:
   std::shared_ptr<opossum::Table> _table;
-  opossum::UseMvcc _use_mvcc;
-  boost::hana::tuple<std::vector<DataTypes>...> _data_vectors;
-  size_t _estimated_rows_per_chunk;
-
-  size_t _current_chunk_row_count() const { return _data_vectors[boost::hana::llong_c<0>].size(); }
-
-  void _emit_chunk() {
-    opossum::Segments segments;
-
-    // Create a segment from each data vector and add it to the Chunk, then re-initialize the vector
-    boost::hana::for_each(_data_vectors, [&](auto&& vector) {
-      using T = typename std::decay_t<decltype(vector)>::value_type;
-      // reason for nolint: clang-tidy wants this to be a forward, but that doesn't work
-      segments.push_back(std::make_shared<opossum::ValueSegment<T>>(std::move(vector)));  // NOLINT
-      vector = std::decay_t<decltype(vector)>();
-      vector.reserve(_estimated_rows_per_chunk);
-    });
-    _table->append_chunk(segments);
-  }
+  std::vector<Part> _parts;
 };
 
 std::unordered_map<opossum::TpchTable, std::underlying_type_t<opossum::TpchTable>> tpch_table_to_dbgen_id = {
@@ -196,6 +256,16 @@ void dbgen_cleanup() {
   asc_date = nullptr;
 }
 
+// The number of parts whose rows are generated by separate threads. There are several parts per thread, so that the
+// threads that finish their parts early take over the rest. Parts are not smaller than MIN_ROWS_PER_PART rows.
+constexpr auto PARTS_PER_THREAD = size_t{4};
+constexpr auto MIN_ROWS_PER_PART = size_t{100};
+
+size_t choose_part_count(const size_t row_count) {
+  const auto max_part_count = std::max(std::thread::hardware_concurrency(), 1u) * PARTS_PER_THREAD;
+  return std::clamp(row_count / MIN_ROWS_PER_PART, size_t{1}, max_part_count);
+}
+
 std::shared_ptr<BenchmarkConfig> create_benchmark_config_with_chunk_size(uint32_t chunk_size) {
   auto config = BenchmarkConfig::get_default_config();
   config.chunk_size = chunk_size;
@@ -227,84 +297,131 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   const auto nation_count = static_cast<size_t>(tdefs[NATION].base);
   const auto region_count = static_cast<size_t>(tdefs[REGION].base);
 
+  const auto customer_part_count = choose_part_count(customer_count);
+  const auto order_part_count = choose_part_count(order_count);
+  const auto part_part_count = choose_part_count(part_count);
+  const auto supplier_part_count = choose_part_count(supplier_count);
+
   // The `* 4` part is defined in the TPC-H specification.
   TableBuilder customer_builder{_benchmark_config->chunk_size, customer_column_types, customer_column_names,
-                                UseMvcc::Yes, customer_count};
+                                UseMvcc::Yes, customer_count, customer_part_count};
   TableBuilder order_builder{_benchmark_config->chunk_size, order_column_types, order_column_names, UseMvcc::Yes,
-                             order_count};
+                             order_count, order_part_count};
   TableBuilder lineitem_builder{_benchmark_config->chunk_size, lineitem_column_types, lineitem_column_names,
-                                UseMvcc::Yes, order_count * 4};
+                                UseMvcc::Yes, order_count * 4, order_part_count};
   TableBuilder part_builder{_benchmark_config->chunk_size, part_column_types, part_column_names, UseMvcc::Yes,
-                            part_count};
+                            part_count, part_part_count};
   TableBuilder partsupp_builder{_benchmark_config->chunk_size, partsupp_column_types, partsupp_column_names,
-                                UseMvcc::Yes, part_count * 4};
+                                UseMvcc::Yes, part_count * 4, part_part_count};
   TableBuilder supplier_builder{_benchmark_config->chunk_size, supplier_column_types, supplier_column_names,
-                                UseMvcc::Yes, supplier_count};
+                                UseMvcc::Yes, supplier_count, supplier_part_count};
   TableBuilder nation_builder{_benchmark_config->chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes,
                               nation_count};
   TableBuilder region_builder{_benchmark_config->chunk_size, region_column_types, region_column_names, UseMvcc::Yes,
                               region_count};
 
+  /**
+   * dbgen initializes parts of its state, which the threads share (e.g., the pool of the text of the comments), when
+   * the first row of a table is generated. So one row of each table is generated before the threads start.
+   */
   dbgen_reset_seeds();
+  call_dbgen_mk<customer_t>(1, mk_cust, TpchTable::Customer);
+  call_dbgen_mk<order_t>(1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+  call_dbgen_mk<part_t>(1, mk_part, TpchTable::Part, _scale_factor);
+  call_dbgen_mk<supplier_t>(1, mk_supp, TpchTable::Supplier);
 
   /**
-   * CUSTOMER
+   * The rows of CUSTOMER, ORDER and LINEITEM, PART and PARTSUPP, and SUPPLIER are generated in parts, which the
+   * threads take one after another. The seeds of dbgen are thread-local, and a thread advances them to the first row
+   * of the part, as if it had generated the rows before. This is what dbgen's -S and -C options do in separate
+   * processes. Thus, the rows of each table are the same as when they are generated one after another.
    */
-
-  for (size_t row_idx = 0; row_idx < customer_count; row_idx++) {
-    auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
-    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
-                                convert_money(customer.acctbal), customer.mktsegment, customer.comment);
-  }
+  auto jobs = std::vector<std::function<void()>>{};
+  const auto add_jobs = [&](const TpchTable table, const size_t row_count, const size_t part_count,
+                            const auto& generate_row) {
+    for (auto part_id = size_t{0}; part_id < part_count; ++part_id) {
+      const auto begin = row_count * part_id / part_count;
+      const auto end = row_count * (part_id + 1) / part_count;
+      jobs.emplace_back([table, part_id, begin, end, &generate_row] {
+        dbgen_reset_seeds();
+        dbgen_skip_rows(tpch_table_to_dbgen_id.at(table), begin);
+        for (auto row_idx = begin; row_idx < end; ++row_idx) {
+          generate_row(part_id, row_idx);
+        }
+      });
+    }
+  };
 
   /**
    * ORDER and LINEITEM
    */
 
-  for (size_t order_idx = 0; order_idx < order_count; ++order_idx) {
+  const auto generate_order = [&](const size_t part_id, const size_t order_idx) {
     const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
 
-    order_builder.append_row(order.okey, order.custkey, std::string(1, order.orderstatus),
-                             convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
-                             order.spriority, order.comment);
+    order_builder.part(part_id).append_row(order.okey, order.custkey, std::string(1, order.orderstatus),
+                                           convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
+                                           order.spriority, order.comment);
 
+    auto& lineitem_part = lineitem_builder.part(part_id);
     for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
       const auto& lineitem = order.l[line_idx];
 
-      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
-                                  convert_money(lineitem.eprice), convert_money(lineitem.discount),
-                                  convert_money(lineitem.tax), std::string(1, lineitem.rflag[0]),
-                                  std::string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
-                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
+      lineitem_part.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
+                               convert_money(lineitem.eprice), convert_money(lineitem.discount),
+                               convert_money(lineitem.tax), std::string(1, lineitem.rflag[0]),
+                               std::string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
+                               lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
     }
-  }
+  };
+  add_jobs(TpchTable::Orders, order_count, order_part_count, generate_order);
 
   /**
    * PART and PARTSUPP
    */
 
-  for (size_t part_idx = 0; part_idx < part_count; ++part_idx) {
+  const auto generate_part = [&](const size_t part_id, const size_t part_idx) {
     const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
 
-    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
-                            convert_money(part.retailprice), part.comment);
+    part_builder.part(part_id).append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size,
+                                          part.container, convert_money(part.retailprice), part.comment);
 
     for (const auto& partsupp : part.s) {
-      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
-                                  partsupp.comment);
+      partsupp_builder.part(part_id).append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty,
+                                                convert_money(partsupp.scost), partsupp.comment);
     }
-  }
+  };
+  add_jobs(TpchTable::Part, part_count, part_part_count, generate_part);
+
+  /**
+   * CUSTOMER
+   */
+
+  const auto generate_customer = [&](const size_t part_id, const size_t row_idx) {
+    auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
+    customer_builder.part(part_id).append_row(customer.custkey, customer.name, customer.address,
+                                              customer.nation_code, customer.phone, convert_money(customer.acctbal),
+                                              customer.mktsegment, customer.comment);
+  };
+  add_jobs(TpchTable::Customer, customer_count, customer_part_count, generate_customer);
 
   /**
    * SUPPLIER
    */
 
-  for (size_t supplier_idx = 0; supplier_idx < supplier_count; ++supplier_idx) {
+  const auto generate_supplier = [&](const size_t part_id, const size_t supplier_idx) {
     const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
 
-    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
-                                convert_money(supplier.acctbal), supplier.comment);
-  }
+    supplier_builder.part(part_id).append_row(supplier.suppkey, supplier.name, supplier.address,
+                                              supplier.nation_code, supplier.phone, convert_money(supplier.acctbal),
+                                              supplier.comment);
+  };
+  add_jobs(TpchTable::Supplier, supplier_count, supplier_part_count, generate_supplier);
+
+  for_each_index_in_parallel(jobs.size(), [&](const size_t job_idx) { jobs[job_idx](); });
+
+  // NATION and REGION are generated by this thread
+  dbgen_reset_seeds();
 
   /**
    * NATION
@@ -312,7 +429,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
 
   for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
     const auto nation = call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TpchTable::Nation);
-    nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
+    nation_builder.part(0).append_row(nation.code, nation.text, nation.join, nation.comment);
   }
 
   /**
@@ -321,7 +438,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
 
   for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
     const auto region = call_dbgen_mk<code_t>(region_idx + 1, mk_region, TpchTable::Region);
-    region_builder.append_row(region.code, region.text, region.comment);
+    region_builder.part(0).append_row(region.code, region.text, region.comment);
   }
 
   /**
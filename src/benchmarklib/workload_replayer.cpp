@@ -0,0 +1,129 @@
+#include "workload_replayer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/abstract_operator.hpp"
+#include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/create_pipeline_task.hpp"
+#include "tasks/server/execute_server_prepared_statement_task.hpp"
+#include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/parse_server_prepared_statement_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Executes the server task on the calling thread and returns its result, rethrowing its exception
+template <typename ServerTask>
+typename ServerTask::result_type execute_server_task(const std::shared_ptr<ServerTask>& task) {
+  auto future = task->get_future();
+  task->execute();
+  return future.get();
+}
+
+}  // namespace
+
+namespace opossum {
+
+nlohmann::json WorkloadReplayer::Result::to_json() const {
+  return nlohmann::json{{"query_count", query_count},
+                        {"failed_query_count", failed_query_count},
+                        {"duration", std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()},
+                        {"latencies", latencies.to_json()},
+                        {"delays", delays.to_json()}};
+}
+
+WorkloadReplayer::WorkloadReplayer(std::vector<QueryLogEntry> entries, const double speedup)
+    : _entries(std::move(entries)), _speedup(speedup) {
+  Assert(_speedup >= 0.0, "The speedup must not be negative");
+}
+
+WorkloadReplayer::Result WorkloadReplayer::replay() const {
+  auto result = Result{};
+  if (_entries.empty()) return result;
+
+  auto entries_by_session = std::map<uint64_t, std::vector<const QueryLogEntry*>>{};
+  for (const auto& entry : _entries) {
+    entries_by_session[entry.session_id].emplace_back(&entry);
+  }
+
+  const auto first_timestamp =
+      std::min_element(_entries.begin(), _entries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+      })->timestamp;
+
+  auto failed_query_count = std::atomic<uint64_t>{0};
+  const auto start = std::chrono::steady_clock::now();
+
+  auto session_threads = std::vector<std::thread>{};
+  session_threads.reserve(entries_by_session.size());
+  for (const auto& [session_id, session_entries] : entries_by_session) {
+    session_threads.emplace_back([&, &session_entries = session_entries]() {
+      for (const auto* entry : session_entries) {
+        auto scheduled = std::chrono::steady_clock::now();
+        if (_speedup > 0.0) {
+          const auto offset = std::chrono::duration<double, std::micro>{entry->timestamp - first_timestamp} / _speedup;
+          scheduled = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset);
+          std::this_thread::sleep_until(scheduled);
+        }
+
+        const auto issued = std::chrono::steady_clock::now();
+        result.delays.record(std::max(issued - scheduled, std::chrono::steady_clock::duration{0}));
+
+        try {
+          _execute(*entry);
+        } catch (const std::exception&) {
+          ++failed_query_count;
+        }
+        result.latencies.record(std::chrono::steady_clock::now() - issued);
+      }
+    });
+  }
+
+  for (auto& session_thread : session_threads) {
+    session_thread.join();
+  }
+
+  result.query_count = _entries.size();
+  result.failed_query_count = failed_query_count;
+  result.duration = std::chrono::steady_clock::now() - start;
+  return result;
+}
+
+void WorkloadReplayer::_execute(const QueryLogEntry& entry) {
+  if (!entry.is_prepared_statement) {
+    const auto create_pipeline_result =
+        execute_server_task(std::make_shared<CreatePipelineTask>(entry.sql, true));
+    // LOAD and COPY statements are executed by the session itself, they are not replayed
+    Assert(create_pipeline_result->sql_pipeline, "Only queries can be replayed: " + entry.sql);
+    execute_server_task(std::make_shared<ExecuteServerQueryTask>(create_pipeline_result->sql_pipeline));
+    return;
+  }
+
+  const auto prepared_plan = execute_server_task(std::make_shared<ParseServerPreparedStatementTask>(entry.sql));
+  const auto physical_plan =
+      execute_server_task(std::make_shared<BindServerPreparedStatementTask>(prepared_plan, entry.parameters));
+
+  // Each prepared statement runs in a transaction of its own, the sessions commit theirs on the next Sync message
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  physical_plan->set_transaction_context_recursively(transaction_context);
+  try {
+    execute_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan));
+  } catch (const std::exception&) {
+    transaction_context->rollback();
+    throw;
+  }
+  transaction_context->commit();
+}
+
+}  // namespace opossum
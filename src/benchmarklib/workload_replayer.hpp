@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "json.hpp"
+
+#include "benchmark_config.hpp"
+#include "server/query_log.hpp"
+#include "utils/latency_histogram.hpp"
+
+namespace opossum {
+
+/**
+ * Replays the queries that the server recorded in its QueryLog in-process, through the same server tasks that the
+ * sessions use (CreatePipelineTask and ExecuteServerQueryTask for simple queries, the Parse, Bind and Execute tasks
+ * for prepared statements), so that changes can be tested against a recorded workload.
+ *
+ * Each session of the log is replayed by a thread of its own, so that the queries run with their original
+ * concurrency. A query is issued at its original offset from the first query of the log, divided by the speedup, or
+ * once the previous query of its session finished, whichever is later. With a speedup of 0, the queries of each
+ * session are issued one after another without waiting.
+ */
+class WorkloadReplayer {
+ public:
+  struct Result {
+    uint64_t query_count{0};
+    uint64_t failed_query_count{0};
+    Duration duration{0};
+
+    // From issuing to finishing the queries, and how much later than scheduled they were issued
+    LatencyHistogram latencies;
+    LatencyHistogram delays;
+
+    nlohmann::json to_json() const;
+  };
+
+  WorkloadReplayer(std::vector<QueryLogEntry> entries, const double speedup);
+
+  Result replay() const;
+
+ protected:
+  // Throws if the query fails
+  static void _execute(const QueryLogEntry& entry);
+
+  const std::vector<QueryLogEntry> _entries;
+  const double _speedup;
+};
+
+}  // namespace opossum
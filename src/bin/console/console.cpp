@@ -550,6 +550,7 @@ int Console::_load_table(const std::string& args) {
   if (supported) {
     out("Encoding \"" + tablename + "\" using " + encoding + "\n");
     ChunkEncoder::encode_all_chunks(StorageManager::get().get_table(tablename), encoding_type->second);
+    SQLPlanCacheDependencies::get().invalidate_table(tablename);
   }
 
   return ReturnCode::Ok;
@@ -1,14 +1,30 @@
-#include <boost/asio/io_service.hpp>
-
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
 
+#include "logging/checkpoint.hpp"
+#include "logging/log_shipper.hpp"
+#include "logging/logger.hpp"
+#include "logging/recovery.hpp"
+#include "logging/replica.hpp"
+#include "operators/import_binary.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
+#include "server/io_service_pool.hpp"
+#include "server/query_log.hpp"
 #include "server/server.hpp"
+#include "storage/chunk_compression_manager.hpp"
+#include "storage/index_tuner.hpp"
+#include "storage/lazy_table_prefetcher.hpp"
+#include "storage/mvcc_garbage_collector.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
 #include "utils/load_table.hpp"
 
 int main(int argc, char* argv[]) {
@@ -23,17 +39,107 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    // Optionally, the server keeps its data in a directory: a snapshot of the tables and the redo log of the writes
+    // since the snapshot was taken. The snapshot is either the latest checkpoint (see Checkpoint) or, initially, binary
+    // files named after the tables (see ExportBinary). Pass "async" as the third argument to not wait for the log to be
+    // flushed on commit, and a number of seconds as the fourth one to write a checkpoint at that interval.
+    //
+    // The tables of the snapshot are only registered on startup. Each of them is loaded once a query (or the recovery)
+    // first looks it up, while the LazyTablePrefetcher loads the others in the background.
+    //
+    // The server streams its log to read-only replicas if the environment variable HYRISE_REPLICATION_PORT is set. It
+    // becomes such a replica itself if HYRISE_REPLICA_OF is set to the host and the replication port of its primary
+    // ("host:port"). A replica is started from a copy of the primary's data directory, which it does not write to.
+    const auto replica_of = std::getenv("HYRISE_REPLICA_OF");
+    if (argc >= 3) {
+      const auto data_directory = filesystem::path{argv[2]};
+      const auto durability =
+          argc >= 4 && std::string{argv[3]} == "async" ? opossum::Durability::Async : opossum::Durability::Sync;
+
+      const auto checkpoint_commit_id = opossum::Checkpoint::load(data_directory.string());
+      if (!checkpoint_commit_id) {
+        for (const auto& entry : filesystem::directory_iterator{data_directory}) {
+          if (entry.path().extension() != ".bin") continue;
+          const auto file_path = entry.path().string();
+          opossum::StorageManager::get().add_lazy_table(
+              entry.path().stem().string(), [file_path]() { return opossum::ImportBinary::read_binary(file_path); });
+        }
+      }
+
+      const auto log_file_path = (data_directory / "redo.log").string();
+      const auto recovered_transaction_count =
+          opossum::Recovery::recover(log_file_path, checkpoint_commit_id.value_or(opossum::CommitID{0}));
+      std::cout << "Recovered " << recovered_transaction_count << " transactions from " << log_file_path << std::endl;
+
+      if (replica_of) {
+        const auto primary = std::string{replica_of};
+        const auto separator = primary.rfind(':');
+        Assert(separator != std::string::npos, "HYRISE_REPLICA_OF must be host:port");
+        opossum::Replica::get().start(primary.substr(0, separator),
+                                      static_cast<uint16_t>(std::stoul(primary.substr(separator + 1))));
+        std::cout << "Replicating " << primary << std::endl;
+      } else {
+        opossum::Logger::get().enable(log_file_path, durability);
+      }
+
+      if (const auto replication_port = std::getenv("HYRISE_REPLICATION_PORT"); replication_port && !replica_of) {
+        opossum::LogShipper::get().start(static_cast<uint16_t>(std::stoul(replication_port)));
+      }
+
+      if (argc >= 5 && !replica_of) {
+        const auto checkpoint_interval = std::chrono::seconds{std::stoul(argv[4])};
+        std::thread{[data_directory, checkpoint_interval]() {
+          while (true) {
+            std::this_thread::sleep_for(checkpoint_interval);
+            opossum::Checkpoint::write(data_directory.string());
+          }
+        }}.detach();
+      }
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
-    boost::asio::io_service io_service;
+    if (argc >= 3) {
+      const auto usage_file_path = (filesystem::path{argv[2]} / "table_usage").string();
+      std::thread{[usage_file_path]() {
+        try {
+          opossum::LazyTablePrefetcher::prefetch(usage_file_path);
+        } catch (const std::exception& exception) {
+          std::cerr << "Prefetching the tables failed: " << exception.what() << std::endl;
+        }
+      }}.detach();
+    }
+
+    // Encode the chunks that are filled by inserts, clean up old row versions and index the scanned columns in the
+    // background. On replicas, the rows stay where the primary put them (see Replica).
+    if (!opossum::Replica::get().is_running()) {
+      opossum::ChunkCompressionManager::get().resume();
+      opossum::MvccGarbageCollector::get().resume();
+      opossum::IndexTuner::get().resume();
+    }
+
+    // The queries of the sessions are recorded for replaying them (see WorkloadReplayer) if the environment variable
+    // HYRISE_QUERY_LOG names the file to append them to
+    if (const auto query_log_path = std::getenv("HYRISE_QUERY_LOG")) {
+      opossum::QueryLog::get().open(query_log_path);
+      std::cout << "Recording the queries in " << query_log_path << std::endl;
+    }
+
+    // The sessions are spread across a pool of io_services, each running on a thread of its own. By default, there is
+    // one per core, set the environment variable HYRISE_SERVER_IO_THREADS to change that.
+    auto io_thread_count = size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+    if (const auto io_thread_count_env = std::getenv("HYRISE_SERVER_IO_THREADS")) {
+      io_thread_count = std::stoul(io_thread_count_env);
+    }
+    opossum::IoServicePool io_service_pool{io_thread_count};
 
-    // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
+    // The server registers itself to the boost io_services. They are the main IO control unit here and they live
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
     // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    opossum::Server server{io_service_pool, port};
 
-    io_service.run();
+    io_service_pool.run();
   } catch (std::exception& e) {
     std::cerr << "Exception: " << e.what() << "\n";
   }
@@ -55,6 +55,9 @@ class AbstractCacheImpl {
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
+  // Remove the element at the given key, if there is one.
+  virtual void erase(const Key& key) = 0;
+
   // Remove all elements from the cache.
   virtual void clear() = 0;
 
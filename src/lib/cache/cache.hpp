@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -14,75 +17,199 @@
 namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
+inline constexpr size_t DefaultCacheShardCount = 16;
+
+// A cache is only split into as many shards as still hold this many entries each
+inline constexpr size_t MinCacheShardCapacity = 64;
 
 // Per-default, uses the GDFS cache as underlying storage.
+//
+// The entries are distributed over shards by the hashes of their keys. Each shard has a cache implementation and a
+// lock of its own, so that threads that look up different keys rarely wait for each other. The eviction policy of a
+// shard only takes the entries of its shard into account. Caches that are too small for several shards of
+// MinCacheShardCapacity entries keep a single shard and thus the exact eviction order of their policy.
 template <typename Value, typename Key = std::string>
 class Cache : public Singleton<Cache<Value, Key>> {
  public:
   using Iterator = typename AbstractCacheImpl<Key, Value>::ErasedIterator;
 
-  explicit Cache(size_t capacity = DefaultCacheCapacity)
-      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+  explicit Cache(size_t capacity = DefaultCacheCapacity, size_t shard_count = DefaultCacheShardCount) {
+    replace_cache_impl<GDFSCache<Key, Value>>(capacity, shard_count);
+  }
 
   virtual ~Cache() {}
 
   // Adds or refreshes the cache entry [query, value].
   void set(const Key& query, const Value& value) {
-    if (_impl->capacity() == 0) return;
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.impl->capacity() == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    _impl->set(query, value);
+    shard.impl->set(query, value);
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
   std::optional<Value> try_get(const Key& query) {
-    if (_impl->capacity() == 0) return {};
-
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.impl->capacity() == 0 || !shard.impl->has(query)) {
+      _miss_count.fetch_add(1, std::memory_order_relaxed);
       return {};
     }
-    return _impl->get(query);
+    _hit_count.fetch_add(1, std::memory_order_relaxed);
+    return shard.impl->get(query);
   }
 
+  // How often try_get() found an entry and how often it did not, since the cache was created
+  size_t hit_count() const { return _hit_count.load(std::memory_order_relaxed); }
+  size_t miss_count() const { return _miss_count.load(std::memory_order_relaxed); }
+
   // Checks whether an entry for the query exists.
-  bool has(const Key& query) const { return _impl->has(query); }
+  bool has(const Key& query) const {
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.impl->has(query);
+  }
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _impl->get(query);
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.impl->get(query);
+  }
+
+  // Removes the entry for the query, if there is one.
+  void erase(const Key& query) {
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.impl->erase(query);
   }
 
   // Purges all entries from the cache.
-  void clear() { _impl->clear(); }
+  void clear() {
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->impl->clear();
+    }
+  }
+
+  // Distributes the capacity over the existing shards.
+  void resize(size_t capacity) {
+    for (auto shard_idx = size_t{0}; shard_idx < _shards.size(); ++shard_idx) {
+      std::lock_guard<std::mutex> lock(_shards[shard_idx]->mutex);
+      _shards[shard_idx]->impl->resize(_shard_capacity(capacity, shard_idx));
+    }
+  }
 
-  void resize(size_t capacity) { _impl->resize(capacity); }
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      size += shard->impl->size();
+    }
+    return size;
+  }
 
-  size_t size() const { return _impl->size(); }
+  size_t capacity() const {
+    auto capacity = size_t{0};
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      capacity += shard->impl->capacity();
+    }
+    return capacity;
+  }
 
-  // Returns a reference to the underlying cache.
-  AbstractCacheImpl<Key, Value>& cache() { return *_impl; }
-  const AbstractCacheImpl<Key, Value>& cache() const { return *_impl; }
+  size_t shard_count() const { return _shards.size(); }
 
-  // Replaces the underlying cache by creating a new object
-  // of the given cache type.
+  // Replaces the underlying cache by creating new objects
+  // of the given cache type, one for each shard.
+  // Not thread-safe, the cache must not be used concurrently.
   template <class cache_t>
-  void replace_cache_impl(size_t capacity) {
-    _impl = std::make_unique<cache_t>(capacity);
+  void replace_cache_impl(size_t capacity, size_t shard_count = DefaultCacheShardCount) {
+    shard_count = std::clamp(capacity / MinCacheShardCapacity, size_t{1}, std::max(shard_count, size_t{1}));
+
+    _shards.clear();
+    _shards.reserve(shard_count);
+    for (auto shard_idx = size_t{0}; shard_idx < shard_count; ++shard_idx) {
+      _shards.emplace_back(std::make_unique<Shard>());
+    }
+
+    for (auto shard_idx = size_t{0}; shard_idx < shard_count; ++shard_idx) {
+      _shards[shard_idx]->impl = std::make_unique<cache_t>(_shard_capacity(capacity, shard_idx));
+    }
   }
 
-  Iterator begin() { return _impl->begin(); }
+  // Iterate over the entries of one shard after the other.
+  // Not thread-safe, the cache must not be modified while iterating.
+  Iterator begin() { return Iterator{std::make_unique<ShardIterator>(_shards, 0)}; }
 
-  Iterator end() { return _impl->end(); }
+  Iterator end() { return Iterator{std::make_unique<ShardIterator>(_shards, _shards.size())}; }
 
  protected:
-  // Underlying cache eviction strategy.
-  std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
+  struct Shard {
+    std::unique_ptr<AbstractCacheImpl<Key, Value>> impl;
+    mutable std::mutex mutex;
+  };
+
+  class ShardIterator : public AbstractCacheImpl<Key, Value>::AbstractIterator {
+   public:
+    using KeyValuePair = typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+    using AbstractIterator = typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+
+    ShardIterator(const std::vector<std::unique_ptr<Shard>>& shards, const size_t shard_idx)
+        : _shards(shards), _shard_idx(shard_idx) {
+      _skip_exhausted_shards();
+    }
+
+    void increment() override {
+      ++*_iterator;
+      _skip_exhausted_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const override {
+      const auto& other_iterator = static_cast<const ShardIterator&>(other);
+      if (_shard_idx != other_iterator._shard_idx) return false;
+      return _shard_idx == _shards.size() || *_iterator == *other_iterator._iterator;
+    }
+
+    const KeyValuePair& dereference() const override { return **_iterator; }
+
+   private:
+    // Moves on to the first entry of the next shard that has entries, or to the end
+    void _skip_exhausted_shards() {
+      while (_shard_idx < _shards.size()) {
+        if (!_iterator) {
+          _iterator.emplace(_shards[_shard_idx]->impl->begin());
+          _end.emplace(_shards[_shard_idx]->impl->end());
+        }
+        if (*_iterator != *_end) return;
+
+        _iterator.reset();
+        _end.reset();
+        ++_shard_idx;
+      }
+    }
+
+    const std::vector<std::unique_ptr<Shard>>& _shards;
+    size_t _shard_idx;
+    std::optional<Iterator> _iterator;
+    std::optional<Iterator> _end;
+  };
+
+  Shard& _shard(const Key& query) const { return *_shards[std::hash<Key>{}(query) % _shards.size()]; }
+
+  // The capacity is split evenly, the first shards take the remainder
+  size_t _shard_capacity(const size_t capacity, const size_t shard_idx) const {
+    return capacity / _shards.size() + (shard_idx < capacity % _shards.size() ? 1 : 0);
+  }
+
+  // Underlying cache eviction strategies, one for each shard.
+  std::vector<std::unique_ptr<Shard>> _shards;
 
-  std::mutex _mutex;
+  std::atomic<size_t> _hit_count{0};
+  std::atomic<size_t> _miss_count{0};
 };
 
 }  // namespace opossum
@@ -107,6 +107,14 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _queue.erase(it->second);
+    _map.erase(it);
+  }
+
   void clear() {
     _map.clear();
     _queue.clear();
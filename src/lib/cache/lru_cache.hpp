@@ -72,6 +72,14 @@ class LRUCache : public AbstractCacheImpl<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _list.erase(it->second);
+    _map.erase(it);
+  }
+
   void clear() {
     _list.clear();
     _map.clear();
@@ -78,6 +78,20 @@ class RandomCache : public AbstractCacheImpl<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    // Move the last element into the gap so that the indices of all other elements stay the same
+    const auto index = it->second;
+    _map.erase(it);
+    if (index + 1 != _list.size()) {
+      _list[index] = std::move(_list.back());
+      _map[_list[index].first] = index;
+    }
+    _list.pop_back();
+  }
+
   void clear() {
     _list.clear();
     _map.clear();
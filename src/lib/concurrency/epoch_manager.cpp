@@ -0,0 +1,93 @@
+#include "epoch_manager.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+thread_local EpochManager::ThreadReaderSlot EpochManager::_thread_reader_slot;
+
+EpochGuard EpochManager::pin() {
+  if (!_thread_reader_slot.reader_slot && !_thread_reader_slot.has_no_reader_slot) {
+    _thread_reader_slot.reader_slot = _acquire_reader_slot();
+    _thread_reader_slot.has_no_reader_slot = !_thread_reader_slot.reader_slot;
+  }
+
+  const auto reader_slot = _thread_reader_slot.reader_slot;
+  if (!reader_slot) {
+    ++_overflow_reader_count;
+    return EpochGuard{nullptr};
+  }
+
+  // The epoch has to be visible to writers before the reader loads a pointer to the protected data, hence the
+  // sequentially consistent store
+  if (reader_slot->pin_count++ == 0) reader_slot->epoch.store(_global_epoch.load());
+  return EpochGuard{reader_slot};
+}
+
+void EpochManager::retire(std::shared_ptr<const void> object) {
+  auto lock = std::lock_guard<std::mutex>{_retired_objects_mutex};
+
+  // Readers that pin a later epoch cannot reach the object anymore
+  _retired_objects.emplace_back(_global_epoch.fetch_add(1), std::move(object));
+  _reclaim();
+}
+
+size_t EpochManager::reclaim() {
+  auto lock = std::lock_guard<std::mutex>{_retired_objects_mutex};
+  return _reclaim();
+}
+
+EpochManager::ThreadReaderSlot::~ThreadReaderSlot() {
+  if (!reader_slot) return;
+  DebugAssert(reader_slot->pin_count == 0, "Thread exits while its epoch is pinned");
+  reader_slot->is_used.store(false);
+}
+
+EpochManager::ReaderSlot* EpochManager::_acquire_reader_slot() {
+  for (auto& reader_slot : _reader_slots) {
+    auto expected = false;
+    if (!reader_slot.is_used.load() && reader_slot.is_used.compare_exchange_strong(expected, true)) {
+      return &reader_slot;
+    }
+  }
+  return nullptr;
+}
+
+size_t EpochManager::_reclaim() {
+  if (_retired_objects.empty() || _overflow_reader_count.load() > 0) return _retired_objects.size();
+
+  auto oldest_pinned_epoch = INACTIVE_EPOCH;
+  for (const auto& reader_slot : _reader_slots) {
+    oldest_pinned_epoch = std::min(oldest_pinned_epoch, reader_slot.epoch.load());
+  }
+
+  _retired_objects.erase(std::remove_if(_retired_objects.begin(), _retired_objects.end(),
+                                        [&](const auto& retired_object) {
+                                          return retired_object.first < oldest_pinned_epoch;
+                                        }),
+                         _retired_objects.end());
+  return _retired_objects.size();
+}
+
+EpochGuard::EpochGuard(EpochManager::ReaderSlot* reader_slot) : _reader_slot(reader_slot) {}
+
+EpochGuard::EpochGuard(EpochGuard&& other) noexcept : _reader_slot(other._reader_slot), _is_pinned(other._is_pinned) {
+  other._is_pinned = false;
+}
+
+EpochGuard::~EpochGuard() {
+  if (!_is_pinned) return;
+
+  if (!_reader_slot) {
+    --EpochManager::get()._overflow_reader_count;
+    return;
+  }
+
+  if (--_reader_slot->pin_count == 0) _reader_slot->epoch.store(EpochManager::INACTIVE_EPOCH);
+}
+
+}  // namespace opossum
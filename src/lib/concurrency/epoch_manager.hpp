@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class EpochGuard;
+
+/**
+ * Epoch-based reclamation for data that is read without locking, such as the MvccData of a chunk.
+ *
+ * Readers pin the current epoch for as long as they access the data (see EpochGuard). Pinning only writes to a slot
+ * that belongs to the reading thread, so that readers on different cores do not contend for a cache line, as they do
+ * for the reader count of a shared mutex. Writers atomically replace the data and retire the old version, which is
+ * freed once all readers that might still access it have unpinned their epoch.
+ */
+class EpochManager : public Singleton<EpochManager> {
+ public:
+  // Used by more threads than this at once, readers fall back to a shared counter
+  static constexpr size_t MAX_READER_SLOTS = 1024;
+
+  // Pins the current epoch for the calling thread until the returned guard is destroyed
+  EpochGuard pin();
+
+  // Frees the object as soon as no reader that pinned an epoch before it was retired is active anymore. The object
+  // must not be reachable for new readers at this point.
+  void retire(std::shared_ptr<const void> object);
+
+  /**
+   * Frees the retired objects that no reader can access anymore. Also called by retire().
+   * @return The number of objects that are still retired
+   */
+  size_t reclaim();
+
+  EpochManager(EpochManager&&) = delete;
+
+ protected:
+  EpochManager() = default;
+
+  friend class Singleton;
+  friend class EpochGuard;
+
+  static constexpr auto INACTIVE_EPOCH = std::numeric_limits<uint64_t>::max();
+
+  // Each slot is used by one thread at a time and has a cache line of its own
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> epoch{INACTIVE_EPOCH};
+    std::atomic_bool is_used{false};
+
+    // Number of guards of the thread, only the outermost one pins the epoch
+    uint32_t pin_count{0};
+  };
+
+  // Returns the reader slot of the thread to the EpochManager once the thread exits
+  struct ThreadReaderSlot {
+    ~ThreadReaderSlot();
+
+    ReaderSlot* reader_slot{nullptr};
+    bool has_no_reader_slot{false};
+  };
+
+  static thread_local ThreadReaderSlot _thread_reader_slot;
+
+  ReaderSlot* _acquire_reader_slot();
+
+  size_t _reclaim();
+
+  std::atomic<uint64_t> _global_epoch{0};
+  std::array<ReaderSlot, MAX_READER_SLOTS> _reader_slots;
+  std::atomic<uint32_t> _overflow_reader_count{0};
+
+  std::mutex _retired_objects_mutex;
+  std::vector<std::pair<uint64_t, std::shared_ptr<const void>>> _retired_objects;
+};
+
+// Keeps the epoch pinned, must be destroyed by the thread that created it
+class EpochGuard : private Noncopyable {
+ public:
+  EpochGuard(EpochGuard&& other) noexcept;
+  EpochGuard& operator=(EpochGuard&& other) = delete;
+
+  ~EpochGuard();
+
+ protected:
+  friend class EpochManager;
+
+  // nullptr if the thread has no reader slot
+  explicit EpochGuard(EpochManager::ReaderSlot* reader_slot);
+
+  EpochManager::ReaderSlot* _reader_slot;
+  bool _is_pinned{true};
+};
+
+/**
+ * Pointer to data that is protected by the EpochManager, mimicking the interface of a ScopedLockingPtr. It keeps the
+ * epoch pinned so that the data is not freed while the pointer exists.
+ */
+template <typename Type>
+class EpochProtectedPtr : private Noncopyable {
+ public:
+  EpochProtectedPtr(Type& value, EpochGuard&& epoch_guard) : _value{value}, _epoch_guard{std::move(epoch_guard)} {}
+
+  EpochProtectedPtr(EpochProtectedPtr<Type>&&) = default;
+
+  Type& operator*() { return _value; }
+  const Type& operator*() const { return _value; }
+
+  Type* operator->() { return &_value; }
+  const Type* operator->() const { return &_value; }
+
+ private:
+  Type& _value;
+  EpochGuard _epoch_guard;
+};
+
+}  // namespace opossum
@@ -2,8 +2,12 @@
 
 #include <future>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "commit_context.hpp"
+#include "logging/log_record.hpp"
+#include "logging/logger.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
 #include "utils/assert.hpp"
@@ -39,13 +43,17 @@ TransactionContext::~TransactionContext() {
                 return !has_registered_operators || committed_or_rolled_back;
               }()),
               "Has registered operators but has neither been committed nor rolled back.");
+
+  _release_snapshot();
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
 CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
 
 CommitID TransactionContext::commit_id() const {
-  Assert((_commit_context != nullptr), "TransactionContext cid only available after commit context has been created.");
+  Assert((_commit_context != nullptr),
+         "TransactionContext cid only available after commit context has been created, which read-only transactions "
+         "never do.");
 
   return _commit_context->commit_id();
 }
@@ -67,19 +75,28 @@ bool TransactionContext::rollback() {
   }
 
   _mark_as_rolled_back();
+  _release_snapshot();
 
   return true;
 }
 
 bool TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+  if (is_read_only()) return _commit_read_only(callback);
+
   const auto success = _prepare_commit();
 
   if (!success) return false;
 
+  // The transaction does not read anymore
+  _release_snapshot();
+
   for (const auto& op : _rw_operators) {
     op->commit_records(commit_id());
   }
 
+  // Before the changes become visible, see Logger
+  if (!_rw_operators.empty() && Logger::get().is_enabled()) _log_commit();
+
   _mark_as_pending_and_try_commit(callback);
 
   return true;
@@ -94,6 +111,11 @@ bool TransactionContext::commit() {
   if (!success) return false;
 
   committed_future.wait();
+
+  if (_log_sequence_number && Logger::get().durability() == Durability::Sync) {
+    Logger::get().wait_for_flush(*_log_sequence_number);
+  }
+
   return true;
 }
 
@@ -143,6 +165,19 @@ bool TransactionContext::_prepare_commit() {
   return true;
 }
 
+bool TransactionContext::_commit_read_only(const std::function<void(TransactionID)>& callback) {
+  const auto success = _transition(TransactionPhase::Active, TransactionPhase::Committing, TransactionPhase::Committed);
+
+  if (!success) return false;
+
+  _wait_for_active_operators_to_finish();
+  _release_snapshot();
+  _phase = TransactionPhase::Committed;
+
+  if (callback) callback(_transaction_id);
+  return true;
+}
+
 void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(TransactionID)> callback) {
   DebugAssert(([this]() {
                 for (const auto& op : _rw_operators) {
@@ -165,6 +200,26 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
   TransactionManager::get()._try_increment_last_commit_id(_commit_context);
 }
 
+void TransactionContext::_log_commit() {
+  auto log_record = LogRecord{};
+  log_record.transaction_id = _transaction_id;
+  log_record.commit_id = commit_id();
+
+  for (const auto& op : _rw_operators) {
+    op->log_records(log_record);
+  }
+
+  if (log_record.empty()) return;
+
+  auto serialized_log_record = std::vector<char>{};
+  log_record.serialize(serialized_log_record);
+  _log_sequence_number = Logger::get().append(std::move(serialized_log_record));
+}
+
+void TransactionContext::_release_snapshot() {
+  if (_holds_snapshot.exchange(false)) TransactionManager::get()._release_snapshot(_transaction_id);
+}
+
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
 
 void TransactionContext::on_operator_finished() {
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "types.hpp"
@@ -68,7 +69,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * The commit id that this transaction has once it is committed. This is the one that is written to the
    * begin/end commit ids of rows modified by this transaction.
-   * Only available after TransactionManager::prepare_commit has been called
+   * Only available after TransactionManager::prepare_commit has been called, i.e., not for read-only transactions
    */
   CommitID commit_id() const;
 
@@ -92,7 +93,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * @param callback called when transaction is actually committed
+   * A read-only transaction (see is_read_only()) gets no commit id, as its commit makes nothing visible: It only
+   * releases its snapshot and is committed right away, without waiting for earlier transactions to commit or
+   * touching the commit contexts of the TransactionManager.
+   *
+   * @param callback called when transaction is actually committed, which is not necessarily when its redo log record
+   *                 is durable (see Logger)
    * @return false if called a second time
    */
   bool commit_async(const std::function<void(TransactionID)>& callback);
@@ -100,7 +106,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * Blocks until transaction is actually committed.
+   * Blocks until transaction is actually committed and, if the Logger is enabled with Durability::Sync, until its redo
+   * log record was flushed.
    *
    * @return false if called a second time
    */
@@ -112,6 +119,11 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
 
+  /**
+   * Returns true if no read-write operator has been registered, i.e., the transaction has not modified any tables.
+   */
+  bool is_read_only() const { return _rw_operators.empty(); }
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -150,6 +162,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   bool _prepare_commit();
 
+  // Commits a transaction without read-write operators, see commit_async()
+  bool _commit_read_only(const std::function<void(TransactionID)>& callback);
+
   /**
    * Sets transaction phase to Pending.
    * Tries to commit transaction and all following
@@ -163,8 +178,14 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**@}*/
 
+  // Appends the redo log record of the committed operators to the Logger, unless they changed nothing
+  void _log_commit();
+
   void _wait_for_active_operators_to_finish() const;
 
+  // Unregisters the snapshot from the TransactionManager, once
+  void _release_snapshot();
+
   /**
    * Throws an exception if the transition fails and
    * has not been already in phase to_phase or end_phase.
@@ -178,6 +199,10 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
+  std::optional<LogSequenceNumber> _log_sequence_number;
+
+  // Whether the snapshot is registered with the TransactionManager, which is the case for transactions it created
+  std::atomic_bool _holds_snapshot{false};
 
   std::atomic_size_t _num_active_operators;
 
@@ -1,6 +1,7 @@
 #include "transaction_manager.hpp"
 
 #include <memory>
+#include <mutex>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
@@ -13,6 +14,9 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  auto lock = std::lock_guard<std::mutex>{manager._active_snapshots_mutex};
+  manager._active_snapshot_commit_ids.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -22,59 +26,104 @@ TransactionManager::TransactionManager()
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
+void TransactionManager::_reset_last_commit_id(const CommitID last_commit_id) {
+  _last_commit_id = last_commit_id;
+  std::atomic_store(&_last_commit_context, std::make_shared<CommitContext>(last_commit_id));
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  auto transaction_id = TransactionID{0};
+  auto snapshot_commit_id = CommitID{0};
+  {
+    auto lock = std::lock_guard<std::mutex>{_active_snapshots_mutex};
+    transaction_id = _next_transaction_id++;
+    snapshot_commit_id = _last_commit_id;
+    _active_snapshot_commit_ids.emplace(transaction_id, snapshot_commit_id);
+  }
+
+  auto transaction_context = std::make_shared<TransactionContext>(transaction_id, snapshot_commit_id);
+  transaction_context->_holds_snapshot = true;
+  return transaction_context;
+}
+
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  auto lock = std::lock_guard<std::mutex>{_active_snapshots_mutex};
+  if (_active_snapshot_commit_ids.empty()) return _last_commit_id;
+  return _active_snapshot_commit_ids.begin()->second;
+}
+
+TransactionID TransactionManager::lowest_active_transaction_id() const {
+  auto lock = std::lock_guard<std::mutex>{_active_snapshots_mutex};
+  if (_active_snapshot_commit_ids.empty()) return _next_transaction_id;
+  return _active_snapshot_commit_ids.begin()->first;
+}
+
+TransactionID TransactionManager::next_transaction_id() const { return _next_transaction_id; }
+
+void TransactionManager::_release_snapshot(const TransactionID transaction_id) {
+  auto lock = std::lock_guard<std::mutex>{_active_snapshots_mutex};
+  _active_snapshot_commit_ids.erase(transaction_id);
 }
 
 /**
  * Logic of the lock-free algorithm
  *
- * Let’s say n threads call this method simultaneously. They all enter the main while-loop.
- * Eventually they reach the point where they try to set the successor of _last_commit_context
- * (pointed to by current_context). Only one of them will succeed and will be able to pass the
- * following if statement. The rest continues with the loop and will now try to get the latest
- * context, which does not have a successor. As long as the thread that succeeded setting
- * the next commit context has not finished updating _last_commit_context, they are stuck in
- * the small while-loop. As soon as it is done, _last_commit_context will point to a commit
- * context with no successor and they will be able to leave this loop.
+ * Let’s say n threads call this method simultaneously. They all try to set the successor of the last commit context
+ * they know of. Only one of them succeeds, the others follow the successor that was set and try again from there.
+ * Thus, no thread has to wait for another one to update _last_commit_context, which is only a hint where the chain
+ * ends. It is moved forward, but never backward, because it keeps all following contexts alive.
  */
 std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   auto current_context = std::atomic_load(&_last_commit_context);
   auto next_context = std::shared_ptr<CommitContext>();
 
-  auto success = false;
-  while (!success) {
+  while (true) {
     while (current_context->has_next()) {
-      current_context = std::atomic_load(&_last_commit_context);
+      current_context = current_context->next();
     }
 
     next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
 
-    success = current_context->try_set_next(next_context);
-
-    if (!success) continue;
-
-    /**
-     * Only one thread at a time can ever reach this code since only one thread
-     * succeeds to set _last_commit_context’s successor.
-     */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+    if (current_context->try_set_next(next_context)) break;
+  }
 
-    Assert(success, "Invariant violated.");
+  auto last_commit_context = std::atomic_load(&_last_commit_context);
+  while (last_commit_context->commit_id() < next_context->commit_id() &&
+         !std::atomic_compare_exchange_weak(&_last_commit_context, &last_commit_context, next_context)) {
   }
 
   return next_context;
 }
 
+/**
+ * Group commit
+ *
+ * A commit context is committed once it and all of its predecessors are pending. The thread that commits it also
+ * commits all pending contexts that follow it, i.e., a batch of transactions, and publishes their commit ids with a
+ * single update of _last_commit_id. The threads of the other transactions in the batch return right away, as the
+ * _last_commit_id that they expect is skipped.
+ *
+ * A context that becomes pending while its predecessor is committed is not lost: Its thread marks it as pending
+ * before it tries to update _last_commit_id, while the committing thread checks whether it is pending only after it
+ * updated _last_commit_id. Thus, either of them succeeds.
+ */
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
   auto current_context = context;
 
   while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+    auto last_context = current_context;
+    while (last_context->has_next() && last_context->next()->is_pending()) {
+      last_context = last_context->next();
+    }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    auto expected_last_commit_id = current_context->commit_id() - 1;
+    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, last_context->commit_id())) return;
 
-    current_context->fire_callback();
+    while (true) {
+      current_context->fire_callback();
+      if (current_context == last_context) break;
+      current_context = current_context->next();
+    }
 
     if (!current_context->has_next()) return;
 
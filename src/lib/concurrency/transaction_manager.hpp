@@ -3,6 +3,8 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <map>
+#include <mutex>
 
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -44,6 +46,8 @@ class TransactionContext;
  * The TransactionManager is responsible for a consistent assignment of
  * transaction and commit ids. It also keeps track of the last commit id
  * which represents the current global visibility of records.
+ * Transactions that wait for their predecessors to commit are committed as
+ * a batch once these did, see _try_increment_last_commit_id().
  * The TransactionManager is thread-safe.
  */
 class TransactionManager : public Singleton<TransactionManager> {
@@ -57,6 +61,21 @@ class TransactionManager : public Singleton<TransactionManager> {
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * The lowest snapshot commit id of the transactions that have neither committed nor rolled back yet, or the last
+   * commit id if there are none. Rows that were deleted at or before it are invisible to all current and future
+   * transactions, see MvccGarbageCollector.
+   */
+  CommitID lowest_active_snapshot_commit_id() const;
+
+  /**
+   * The lowest id of the transactions that have neither committed nor rolled back yet, or the id of the next
+   * transaction if there are none. Transactions with lower ids are done reading.
+   */
+  TransactionID lowest_active_transaction_id() const;
+
+  TransactionID next_transaction_id() const;
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed)
@@ -67,11 +86,19 @@ class TransactionManager : public Singleton<TransactionManager> {
   TransactionManager();
 
   friend class Singleton;
+  friend class Recovery;
+  friend class Replica;
   friend class TransactionContext;
 
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Continues with the commit ids after those restored by the Recovery. There must be no transactions in flight.
+  void _reset_last_commit_id(const CommitID last_commit_id);
+
+  // Called once the transaction no longer reads
+  void _release_snapshot(const TransactionID transaction_id);
+
   std::atomic<TransactionID> _next_transaction_id;
 
   std::atomic<CommitID> _last_commit_id;
@@ -80,5 +107,11 @@ class TransactionManager : public Singleton<TransactionManager> {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // The snapshots of the active transactions, by transaction id. The id and the snapshot are taken and registered
+  // under the mutex, so that lower ids have lower or equal snapshots, and a transaction that is just starting is not
+  // missed.
+  mutable std::mutex _active_snapshots_mutex;
+  std::map<TransactionID, CommitID> _active_snapshot_commit_ids;
 };
 }  // namespace opossum
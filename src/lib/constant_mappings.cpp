@@ -60,6 +60,7 @@ const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string
         {AggregateFunction::Avg, "AVG"},
         {AggregateFunction::Count, "COUNT"},
         {AggregateFunction::CountDistinct, "COUNT DISTINCT"},
+        {AggregateFunction::ApproxCountDistinct, "APPROX_COUNT_DISTINCT"},
     });
 
 const boost::bimap<FunctionType, std::string> function_type_to_string =
@@ -76,6 +77,10 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::RunLength, "RunLength"},
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
+    {EncodingType::Delta, "Delta"},
+    {EncodingType::LZ4, "LZ4"},
+    {EncodingType::FrontCodedDictionary, "FrontCodedDictionary"},
+    {EncodingType::ColumnGroup, "ColumnGroup"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -88,4 +93,8 @@ const boost::bimap<VectorCompressionType, std::string> vector_compression_type_t
 const boost::bimap<TableType, std::string> table_type_to_string =
     make_bimap<TableType, std::string>({{TableType::Data, "Data"}, {TableType::References, "References"}});
 
+const boost::bimap<TableSampleMethod, std::string> table_sample_method_to_string =
+    make_bimap<TableSampleMethod, std::string>(
+        {{TableSampleMethod::System, "SYSTEM"}, {TableSampleMethod::Bernoulli, "BERNOULLI"}});
+
 }  // namespace opossum
@@ -0,0 +1,182 @@
+#include "cost_model_physical.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+float n_log_n(const float row_count) { return row_count * std::log2(std::max(row_count, 1.0f)); }
+
+}  // namespace
+
+namespace opossum {
+
+Cost LinearCostFunction::operator()(const std::vector<float>& features) const {
+  DebugAssert(features.size() == weights.size(), "Expected one weight per feature");
+
+  auto cost = setup;
+  for (auto feature_idx = size_t{0}; feature_idx < features.size(); ++feature_idx) {
+    cost += weights[feature_idx] * features[feature_idx];
+  }
+  return cost;
+}
+
+CostModelPhysical::CostModelPhysical(const PhysicalCostCoefficients& coefficients) : _coefficients(coefficients) {}
+
+const PhysicalCostCoefficients& CostModelPhysical::coefficients() const { return _coefficients; }
+
+std::vector<float> CostModelPhysical::features(const OperatorType operator_type, const float left_input_row_count,
+                                               const float right_input_row_count, const float output_row_count,
+                                               const size_t chunk_count) {
+  switch (operator_type) {
+    case OperatorType::JoinHash:
+      // JoinHash builds the hash table on the smaller input
+      return {std::min(left_input_row_count, right_input_row_count),
+              std::max(left_input_row_count, right_input_row_count), output_row_count};
+
+    case OperatorType::JoinSortMerge:
+      return {n_log_n(left_input_row_count) + n_log_n(right_input_row_count),
+              left_input_row_count + right_input_row_count, output_row_count};
+
+    case OperatorType::JoinIndex:
+      // JoinIndex looks up every row of the left input in the index of each chunk of the right input
+      return {left_input_row_count * static_cast<float>(chunk_count), output_row_count};
+
+    case OperatorType::JoinNestedLoop:
+      return {left_input_row_count * right_input_row_count, output_row_count};
+
+    case OperatorType::TableScan:
+      return {left_input_row_count, output_row_count};
+
+    case OperatorType::IndexScan:
+      return {static_cast<float>(chunk_count), output_row_count, n_log_n(output_row_count)};
+
+    default:
+      Fail("CostModelPhysical has no cost function for this operator");
+  }
+}
+
+Cost CostModelPhysical::estimate_join_cost(const OperatorType join_type, const float left_input_row_count,
+                                           const float right_input_row_count, const float output_row_count,
+                                           const size_t right_chunk_count) const {
+  return cost_function(join_type)(
+      features(join_type, left_input_row_count, right_input_row_count, output_row_count, right_chunk_count));
+}
+
+Cost CostModelPhysical::estimate_scan_cost(const OperatorType scan_type, const float input_row_count,
+                                           const float output_row_count, const size_t indexed_chunk_count) const {
+  return cost_function(scan_type)(features(scan_type, input_row_count, 0.0f, output_row_count, indexed_chunk_count));
+}
+
+const LinearCostFunction& CostModelPhysical::cost_function(const OperatorType operator_type) const {
+  switch (operator_type) {
+    case OperatorType::JoinHash:
+      return _coefficients.join_hash;
+    case OperatorType::JoinSortMerge:
+      return _coefficients.join_sort_merge;
+    case OperatorType::JoinIndex:
+      return _coefficients.join_index;
+    case OperatorType::JoinNestedLoop:
+      return _coefficients.join_nested_loop;
+    case OperatorType::TableScan:
+      return _coefficients.table_scan;
+    case OperatorType::IndexScan:
+      return _coefficients.index_scan;
+    default:
+      Fail("CostModelPhysical has no cost function for this operator");
+  }
+}
+
+Cost CostModelPhysical::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto output_row_count = node->get_statistics()->row_count();
+  const auto left_input_row_count = node->left_input() ? node->left_input()->get_statistics()->row_count() : 0.0f;
+  const auto right_input_row_count = node->right_input() ? node->right_input()->get_statistics()->row_count() : 0.0f;
+
+  switch (node->type) {
+    case LQPNodeType::Join: {
+      // Costs joins as operators that the LQPTranslator chooses if the inputs are not indexed
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(join_node->join_predicate());
+
+      auto join_type = OperatorType::JoinSortMerge;
+      if (!predicate) {
+        join_type = OperatorType::JoinNestedLoop;
+      } else if (predicate->predicate_condition == PredicateCondition::Equals &&
+                 join_node->join_mode != JoinMode::Outer) {
+        join_type = OperatorType::JoinHash;
+      }
+
+      return estimate_join_cost(join_type, left_input_row_count, right_input_row_count, output_row_count);
+    }
+
+    case LQPNodeType::Predicate: {
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+      if (predicate_node->scan_type == ScanType::TableScan) {
+        return estimate_scan_cost(OperatorType::TableScan, left_input_row_count, output_row_count);
+      }
+
+      // IndexScans are only used on StoredTableNodes (see IndexScanRule)
+      const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input());
+      const auto chunk_count = StorageManager::get().get_table(stored_table_node->table_name)->chunk_count();
+      return estimate_scan_cost(OperatorType::IndexScan, left_input_row_count, output_row_count, chunk_count);
+    }
+
+    default:
+      // Nodes without a cost function of their own are costed like a TableScan, i.e., by their input and output rows
+      return estimate_scan_cost(OperatorType::TableScan, left_input_row_count + right_input_row_count,
+                                output_row_count);
+  }
+}
+
+void from_json(const nlohmann::json& json, LinearCostFunction& cost_function) {
+  cost_function.setup = json.at("setup").get<Cost>();
+  cost_function.weights = json.at("weights").get<std::vector<Cost>>();
+}
+
+void to_json(nlohmann::json& json, const LinearCostFunction& cost_function) {
+  json = nlohmann::json{{"setup", cost_function.setup}, {"weights", cost_function.weights}};
+}
+
+void from_json(const nlohmann::json& json, PhysicalCostCoefficients& coefficients) {
+  const auto assign_if_exists = [&](LinearCostFunction& cost_function, const std::string& key) {
+    if (json.find(key) == json.end()) return;
+
+    const auto weight_count = cost_function.weights.size();
+    cost_function = json.at(key).get<LinearCostFunction>();
+    Assert(cost_function.weights.size() == weight_count, "Expected " + std::to_string(weight_count) +
+                                                             " weights for the cost function '" + key + "'");
+  };
+
+  assign_if_exists(coefficients.join_hash, "join_hash");
+  assign_if_exists(coefficients.join_sort_merge, "join_sort_merge");
+  assign_if_exists(coefficients.join_index, "join_index");
+  assign_if_exists(coefficients.join_nested_loop, "join_nested_loop");
+  assign_if_exists(coefficients.table_scan, "table_scan");
+  assign_if_exists(coefficients.index_scan, "index_scan");
+}
+
+void to_json(nlohmann::json& json, const PhysicalCostCoefficients& coefficients) {
+  json = nlohmann::json{{"join_hash", coefficients.join_hash},
+                        {"join_sort_merge", coefficients.join_sort_merge},
+                        {"join_index", coefficients.join_index},
+                        {"join_nested_loop", coefficients.join_nested_loop},
+                        {"table_scan", coefficients.table_scan},
+                        {"index_scan", coefficients.index_scan}};
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_cost_estimator.hpp"
+#include "json.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Cost of an operator as a linear function of its features, i.e., of quantities derived from its input and output row
+ * counts: setup + sum(weights[i] * features[i]). CostModelPhysical::features() defines the features of each operator.
+ */
+struct LinearCostFunction {
+  Cost operator()(const std::vector<float>& features) const;
+
+  Cost setup{0.0f};
+  std::vector<Cost> weights;
+};
+
+/**
+ * Coefficients of the CostModelPhysical, in nanoseconds. The defaults were fitted by hyriseCostModelCalibration on a
+ * server-class x86 machine. Run it to obtain the coefficients of the current hardware.
+ */
+struct PhysicalCostCoefficients {
+  // Features: smaller input rows, larger input rows, output rows
+  LinearCostFunction join_hash{12'000.0f, {28.0f, 14.0f, 6.0f}};
+
+  // Features: sum of (rows * log2(rows)) of both inputs, rows of both inputs, output rows
+  LinearCostFunction join_sort_merge{25'000.0f, {3.5f, 4.0f, 6.0f}};
+
+  // Features: left rows * right chunks, i.e., index lookups, output rows
+  LinearCostFunction join_index{2'000.0f, {45.0f, 8.0f}};
+
+  // Features: left rows * right rows, output rows
+  LinearCostFunction join_nested_loop{1'000.0f, {2.5f, 8.0f}};
+
+  // Features: input rows, output rows
+  LinearCostFunction table_scan{1'500.0f, {1.2f, 3.5f}};
+
+  // Features: indexed chunks, output rows, output rows * log2(output rows). The last feature covers the UnionPositions
+  // that combines the IndexScan with the TableScan of the chunks without index.
+  LinearCostFunction index_scan{4'000.0f, {250.0f, 5.0f, 2.0f}};
+};
+
+/**
+ * Cost model for the estimated runtime of physical operators, used to choose between the operators that can execute an
+ * LQP node. Each operator is described by a LinearCostFunction whose coefficients are fitted to measured runtimes.
+ */
+class CostModelPhysical : public AbstractCostEstimator {
+ public:
+  explicit CostModelPhysical(const PhysicalCostCoefficients& coefficients = {});
+
+  const PhysicalCostCoefficients& coefficients() const;
+
+  // The features of the join or scan @param operator_type, in the order of the weights of its LinearCostFunction.
+  // For joins, @param chunk_count is the chunk count of the right input. For scans, it is the number of indexed chunks.
+  static std::vector<float> features(const OperatorType operator_type, const float left_input_row_count,
+                                     const float right_input_row_count, const float output_row_count,
+                                     const size_t chunk_count = 1);
+
+  Cost estimate_join_cost(const OperatorType join_type, const float left_input_row_count,
+                          const float right_input_row_count, const float output_row_count,
+                          const size_t right_chunk_count = 1) const;
+  Cost estimate_scan_cost(const OperatorType scan_type, const float input_row_count, const float output_row_count,
+                          const size_t indexed_chunk_count = 1) const;
+
+  const LinearCostFunction& cost_function(const OperatorType operator_type) const;
+
+ protected:
+  Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  const PhysicalCostCoefficients _coefficients;
+};
+
+/**
+ * Functions used internally when converting PhysicalCostCoefficients to nlohmann::json and the other way round, e.g.,
+ * to read the output of hyriseCostModelCalibration:
+ *
+ * opossum::PhysicalCostCoefficients coefficients = nlohmann::json::parse(stream);
+ */
+void from_json(const nlohmann::json& json, LinearCostFunction& cost_function);
+void to_json(nlohmann::json& json, const LinearCostFunction& cost_function);
+void from_json(const nlohmann::json& json, PhysicalCostCoefficients& coefficients);
+void to_json(nlohmann::json& json, const PhysicalCostCoefficients& coefficients);
+
+}  // namespace opossum
@@ -61,6 +61,10 @@ DataType AggregateExpression::data_type() const {
     return AggregateTraits<NullValue, AggregateFunction::CountDistinct>::AGGREGATE_DATA_TYPE;
   }
 
+  if (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    return AggregateTraits<NullValue, AggregateFunction::ApproxCountDistinct>::AGGREGATE_DATA_TYPE;
+  }
+
   const auto argument_data_type = arguments[0]->data_type();
   auto aggregate_data_type = DataType::Null;
 
@@ -78,6 +82,7 @@ DataType AggregateExpression::data_type() const {
         break;
       case AggregateFunction::Count:
       case AggregateFunction::CountDistinct:
+      case AggregateFunction::ApproxCountDistinct:
         break;  // These are handled above
       case AggregateFunction::Sum:
         aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
@@ -91,7 +96,8 @@ DataType AggregateExpression::data_type() const {
 bool AggregateExpression::is_nullable() const {
   // Aggregates except the COUNTs will return NULL when executed on an empty group -
   // thus they are always nullable
-  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct;
+  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+         aggregate_function != AggregateFunction::ApproxCountDistinct;
 }
 
 bool AggregateExpression::_shallow_equals(const AbstractExpression& expression) const {
@@ -1,6 +1,9 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
 #include <iterator>
+#include <map>
+#include <numeric>
 #include <type_traits>
 
 #include "boost/lexical_cast.hpp"
@@ -30,9 +33,13 @@
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_utils.hpp"
 #include "utils/performance_warning.hpp"
 
 using namespace std::string_literals;            // NOLINT
@@ -127,24 +134,85 @@ std::shared_ptr<AbstractExpression> rewrite_in_list_expression(const InExpressio
   return rewritten_expression;
 }
 
+// Applies the binary @param Functor to the contiguous values of two operands, a literal operand being broadcast to all
+// rows. NULLs are handled by the caller, so the loop contains no branches. Together with the non-aliasing pointers and a
+// 64-bit index, this allows the compiler to vectorize it for arithmetic and comparisons on numeric types.
+template <typename Functor, bool left_is_literal, bool right_is_literal, typename Result, typename Left, typename Right>
+void evaluate_binary_kernel(Result* __restrict result_values, const Left* __restrict left_values,
+                            const Right* __restrict right_values, const size_t size) {
+  for (auto row_idx = size_t{0}; row_idx < size; ++row_idx) {
+    Functor{}(result_values[row_idx], left_values[left_is_literal ? 0 : row_idx],
+              right_values[right_is_literal ? 0 : row_idx]);
+  }
+}
+
+// Sub-selects are evaluated for all rows of a Chunk at once, so expressions containing them are not batched
+bool contains_select_expression(const AbstractExpression& expression) {
+  if (expression.type == ExpressionType::PQPSelect) return true;
+  return std::any_of(expression.arguments.begin(), expression.arguments.end(),
+                     [](const auto& argument) { return contains_select_expression(*argument); });
+}
+
 }  // namespace
 
 namespace opossum {
 
 ExpressionEvaluator::ExpressionEvaluator(
     const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-    const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results)
+    const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results,
+    const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions)
     : _table(table),
       _chunk(_table->get_chunk(chunk_id)),
       _chunk_id(chunk_id),
-      _uncorrelated_select_results(uncorrelated_select_results) {
+      _uncorrelated_select_results(uncorrelated_select_results),
+      _common_subexpressions(common_subexpressions) {
   _output_row_count = _chunk->size();
   _segment_materializations.resize(_chunk->column_count());
 }
 
+ExpressionEvaluator::ExpressionEvaluator(
+    const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results)
+    : _uncorrelated_select_results(uncorrelated_select_results) {}
+
+ExpressionEvaluator::ExpressionEvaluator(ExpressionEvaluator& chunk_evaluator,
+                                         const std::vector<ChunkOffset>& selection)
+    : _table(chunk_evaluator._table),
+      _chunk(chunk_evaluator._chunk),
+      _chunk_id(chunk_evaluator._chunk_id),
+      _chunk_evaluator(&chunk_evaluator),
+      _selection(selection),
+      _uncorrelated_select_results(chunk_evaluator._uncorrelated_select_results),
+      _common_subexpressions(chunk_evaluator._common_subexpressions) {
+  _output_row_count = _selection.size();
+  _segment_materializations.resize(_chunk->column_count());
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  if (!_common_subexpressions || _common_subexpressions->empty()) {
+    return _evaluate_expression_to_result<Result>(expression);
+  }
+
+  // Expressions created during the evaluation (e.g., the rewritten IN lists) are not owned by a shared_ptr
+  const auto shared_expression = std::const_pointer_cast<AbstractExpression>(expression.weak_from_this().lock());
+  if (!shared_expression || !_common_subexpressions->count(shared_expression)) {
+    return _evaluate_expression_to_result<Result>(expression);
+  }
+
+  auto& cached_result = _common_subexpression_results[shared_expression];
+  if (const auto typed_cached_result = std::dynamic_pointer_cast<ExpressionResult<Result>>(cached_result)) {
+    return typed_cached_result;
+  }
+
+  const auto result = _evaluate_expression_to_result<Result>(expression);
+  if (!cached_result) cached_result = result;
+  return result;
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result(
+    const AbstractExpression& expression) {
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       return _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
@@ -594,6 +662,61 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
   std::vector<Result> values;
   std::vector<bool> nulls;
 
+  // Instead of evaluating both THEN and ELSE for all rows and picking one of them per row, each of them is only
+  // evaluated for the rows that take its branch, on a selection vector (see evaluate_expression_to_pos_list()). The
+  // CASE expressions that the SQLTranslator nests in the ELSE of each other for multiple WHENs thus evaluate each THEN
+  // only for its own rows, too. Selects are evaluated per row of the Chunk, so they are not evaluated on selections.
+  if (_chunk && when->size() > 1 && !contains_select_expression(*case_expression.then()) &&
+      !contains_select_expression(*case_expression.otherwise())) {
+    const auto row_count = when->size();
+    auto then_selection = std::vector<ChunkOffset>{};
+    auto else_selection = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (when->value(chunk_offset) && !when->is_null(chunk_offset)) {
+        then_selection.emplace_back(chunk_offset);
+      } else {
+        else_selection.emplace_back(chunk_offset);
+      }
+    }
+
+    // The offsets of a selection are those of the rows of this evaluator, which may itself evaluate a selection. A
+    // branch that all rows take is evaluated by this evaluator, which saves gathering the rows.
+    const auto branch_evaluator = [&](const std::vector<ChunkOffset>& selection) {
+      if (selection.size() == row_count) return std::unique_ptr<ExpressionEvaluator>{};
+      return std::unique_ptr<ExpressionEvaluator>{new ExpressionEvaluator{*this, selection}};
+    };
+    const auto then_evaluator = branch_evaluator(then_selection);
+    const auto else_evaluator = branch_evaluator(else_selection);
+    auto& then_branch_evaluator = then_evaluator ? *then_evaluator : *this;
+    auto& else_branch_evaluator = else_evaluator ? *else_evaluator : *this;
+
+    then_branch_evaluator._resolve_to_expression_result(*case_expression.then(), [&](const auto& then_result) {
+      else_branch_evaluator._resolve_to_expression_result(*case_expression.otherwise(), [&](const auto& else_result) {
+        using ThenResultType = typename std::decay_t<decltype(then_result)>::Type;
+        using ElseResultType = typename std::decay_t<decltype(else_result)>::Type;
+
+        if constexpr (CaseEvaluator::supports_v<Result, ThenResultType, ElseResultType>) {
+          values.resize(row_count);
+          nulls.resize(row_count);
+
+          // Scatter the results of the branches into the rows that they were evaluated for
+          for (auto selection_idx = size_t{0}; selection_idx < then_selection.size(); ++selection_idx) {
+            values[then_selection[selection_idx]] = to_value<Result>(then_result.value(selection_idx));
+            nulls[then_selection[selection_idx]] = then_result.is_null(selection_idx);
+          }
+          for (auto selection_idx = size_t{0}; selection_idx < else_selection.size(); ++selection_idx) {
+            values[else_selection[selection_idx]] = to_value<Result>(else_result.value(selection_idx));
+            nulls[else_selection[selection_idx]] = else_result.is_null(selection_idx);
+          }
+        } else {
+          Fail("Illegal operands for CaseExpression");
+        }
+      });
+    });
+
+    return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  }
+
   _resolve_to_expression_results(
       *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
         using ThenResultType = typename std::decay_t<decltype(then_result)>::Type;
@@ -779,7 +902,61 @@ std::shared_ptr<ExpressionResult<std::string>> ExpressionEvaluator::_evaluate_ex
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_extract_expression(
     const ExtractExpression& extract_expression) {
-  Fail("Only Strings (YYYY-MM-DD) supported for Dates right now");
+  // Dates stored as Ints are the days since 1970-01-01, timestamps stored as Longs the seconds since 1970-01-01
+  // 00:00:00 (see utils/date_utils.hpp)
+  if constexpr (std::is_same_v<Result, int32_t>) {
+    const auto datetime_component = extract_expression.datetime_component;
+    const auto extract = [&](const auto& from_result, const bool is_timestamp) {
+      Assert(is_timestamp || datetime_component == DatetimeComponent::Year ||
+                 datetime_component == DatetimeComponent::Month || datetime_component == DatetimeComponent::Day,
+             "Hour, Minute and Second not available in Int Dates");
+
+      auto values = std::vector<int32_t>(from_result.size());
+      from_result.as_view([&](const auto& from_view) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < from_view.size(); ++chunk_offset) {
+          if (from_view.is_null(chunk_offset)) continue;
+
+          const auto value = static_cast<int64_t>(from_view.value(chunk_offset));
+          // Rounded towards negative infinity, so that the seconds of a day before 1970 are positive
+          const auto days = is_timestamp ? (value >= 0 ? value : value - SECONDS_PER_DAY + 1) / SECONDS_PER_DAY : value;
+          const auto second_of_day = is_timestamp ? value - days * SECONDS_PER_DAY : int64_t{0};
+
+          switch (datetime_component) {
+            case DatetimeComponent::Year:
+              values[chunk_offset] = civil_from_days(static_cast<int32_t>(days)).year;
+              break;
+            case DatetimeComponent::Month:
+              values[chunk_offset] = static_cast<int32_t>(civil_from_days(static_cast<int32_t>(days)).month);
+              break;
+            case DatetimeComponent::Day:
+              values[chunk_offset] = static_cast<int32_t>(civil_from_days(static_cast<int32_t>(days)).day);
+              break;
+            case DatetimeComponent::Hour:
+              values[chunk_offset] = static_cast<int32_t>(second_of_day / 3'600);
+              break;
+            case DatetimeComponent::Minute:
+              values[chunk_offset] = static_cast<int32_t>(second_of_day / 60 % 60);
+              break;
+            case DatetimeComponent::Second:
+              values[chunk_offset] = static_cast<int32_t>(second_of_day % 60);
+              break;
+          }
+        }
+      });
+
+      return std::make_shared<ExpressionResult<int32_t>>(std::move(values), from_result.nulls);
+    };
+
+    switch (extract_expression.from()->data_type()) {
+      case DataType::Int:
+        return extract(*evaluate_expression_to_result<int32_t>(*extract_expression.from()), false);
+      case DataType::Long:
+        return extract(*evaluate_expression_to_result<int64_t>(*extract_expression.from()), true);
+      default:
+        break;
+    }
+  }
+  Fail("Dates are Strings (YYYY-MM-DD), Ints (days since 1970-01-01) or Longs (seconds since 1970-01-01)");
 }
 
 template <size_t offset, size_t count>
@@ -879,8 +1056,24 @@ std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_select_
 
   std::vector<std::shared_ptr<const Table>> results(_output_row_count);
 
+  // Rows with the same parameter values get the same result, so the sub-PQP is executed only once per distinct
+  // combination of them. This pays off for correlation columns with few distinct values, e.g., foreign keys.
+  auto results_by_parameter_values = std::map<std::vector<AllTypeVariant>, std::shared_ptr<const Table>>{};
+  auto parameter_values = std::vector<AllTypeVariant>(expression.parameters.size());
+
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-    results[chunk_offset] = _evaluate_select_expression_for_row(expression, chunk_offset);
+    for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
+      const auto column_id = expression.parameters[parameter_idx].second;
+      parameter_values[parameter_idx] = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+    }
+
+    auto result_iter = results_by_parameter_values.find(parameter_values);
+    if (result_iter == results_by_parameter_values.end()) {
+      result_iter = results_by_parameter_values
+                        .emplace(parameter_values, _evaluate_select_expression_for_row(expression, chunk_offset))
+                        .first;
+    }
+    results[chunk_offset] = result_iter->second;
   }
 
   return results;
@@ -895,6 +1088,10 @@ ExpressionEvaluator::populate_uncorrelated_select_results_cache(
     visit_expression(expression, [&](const auto& sub_expression) {
       const auto pqp_select_expression = std::dynamic_pointer_cast<PQPSelectExpression>(sub_expression);
       if (pqp_select_expression && !pqp_select_expression->is_correlated()) {
+        if (uncorrelated_select_results->count(pqp_select_expression->pqp)) {
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+
         // Uncorrelated select expressions have the same result for every row, so executing them for row 0 is fine.
         auto result = evaluator._evaluate_select_expression_for_row(*pqp_select_expression, ChunkOffset{0});
         uncorrelated_select_results->emplace(pqp_select_expression->pqp, std::move(result));
@@ -907,6 +1104,34 @@ ExpressionEvaluator::populate_uncorrelated_select_results_cache(
   return uncorrelated_select_results;
 }
 
+std::shared_ptr<ExpressionUnorderedSet> ExpressionEvaluator::find_common_subexpressions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto occurrence_counts = ExpressionUnorderedMap<size_t>{};
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      // Columns and literals are cheap to evaluate anyway, uncorrelated selects are cached separately
+      if (sub_expression->type == ExpressionType::PQPColumn || sub_expression->type == ExpressionType::Value ||
+          sub_expression->type == ExpressionType::CorrelatedParameter || sub_expression->type == ExpressionType::List) {
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+      const auto pqp_select_expression = std::dynamic_pointer_cast<PQPSelectExpression>(sub_expression);
+      if (pqp_select_expression && !pqp_select_expression->is_correlated()) {
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      // The arguments of an expression that occurs multiple times are only evaluated for its first occurrence
+      return ++occurrence_counts[sub_expression] == 1 ? ExpressionVisitation::VisitArguments
+                                                      : ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+
+  auto common_subexpressions = std::make_shared<ExpressionUnorderedSet>();
+  for (const auto& [expression, occurrence_count] : occurrence_counts) {
+    if (occurrence_count > 1) common_subexpressions->emplace(expression);
+  }
+  return common_subexpressions;
+}
+
 std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_select_expression_for_row(
     const PQPSelectExpression& expression, const ChunkOffset chunk_offset) {
   Assert(expression.parameters.empty() || _chunk,
@@ -925,8 +1150,7 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_select_expression_fo
   }
 
   // TODO(moritz) deep_copy() shouldn't be necessary for every row if we could re-execute PQPs...
-  auto row_pqp = expression.pqp->deep_copy();
-  row_pqp->set_parameters(parameters);
+  auto row_pqp = expression.pqp->deep_copy(parameters);
 
   const auto tasks = OperatorTask::make_tasks_from_operator(row_pqp, CleanupTemporaries::Yes);
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
@@ -935,6 +1159,8 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_select_expression_fo
 }
 
 std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_expression_to_segment(const AbstractExpression& expression) {
+  if (const auto dictionary_segment = _evaluate_function_on_dictionary(expression)) return dictionary_segment;
+
   std::shared_ptr<BaseSegment> segment;
   pmr_concurrent_vector<bool> nulls;
 
@@ -968,6 +1194,68 @@ std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_expression_to_segment
 }
 
 PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpression& expression) {
+  if (!_chunk || _chunk_evaluator || contains_select_expression(expression)) {
+    return _evaluate_expression_to_pos_list(expression);
+  }
+
+  auto result_pos_list = PosList{};
+  auto selection = std::vector<ChunkOffset>{};
+
+  for (auto batch_begin = size_t{0}; batch_begin < _output_row_count; batch_begin += BATCH_SIZE) {
+    const auto batch_end = std::min(batch_begin + BATCH_SIZE, _output_row_count);
+    selection.resize(batch_end - batch_begin);
+    std::iota(selection.begin(), selection.end(), static_cast<ChunkOffset>(batch_begin));
+
+    for (const auto chunk_offset : _evaluate_expression_to_selection(expression, selection)) {
+      result_pos_list.emplace_back(_chunk_id, chunk_offset);
+    }
+  }
+
+  return result_pos_list;
+}
+
+std::vector<ChunkOffset> ExpressionEvaluator::_evaluate_expression_to_selection(
+    const AbstractExpression& expression, const std::vector<ChunkOffset>& selection) {
+  if (selection.empty()) return {};
+
+  if (expression.type == ExpressionType::Logical) {
+    const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
+    const auto left_selection = _evaluate_expression_to_selection(*logical_expression.left_operand(), selection);
+
+    switch (logical_expression.logical_operator) {
+      case LogicalOperator::And:
+        // Rows not matching the left operand do not need to be evaluated for the right operand
+        return _evaluate_expression_to_selection(*logical_expression.right_operand(), left_selection);
+
+      case LogicalOperator::Or: {
+        // Rows matching the left operand do not need to be evaluated for the right operand
+        auto remaining_selection = std::vector<ChunkOffset>{};
+        std::set_difference(selection.begin(), selection.end(), left_selection.begin(), left_selection.end(),
+                            std::back_inserter(remaining_selection));
+        const auto right_selection =
+            _evaluate_expression_to_selection(*logical_expression.right_operand(), remaining_selection);
+
+        auto result_selection = std::vector<ChunkOffset>{};
+        result_selection.reserve(left_selection.size() + right_selection.size());
+        std::merge(left_selection.begin(), left_selection.end(), right_selection.begin(), right_selection.end(),
+                   std::back_inserter(result_selection));
+        return result_selection;
+      }
+    }
+  }
+
+  // The batch evaluator returns the indices of the matching rows within the selection
+  auto batch_evaluator = ExpressionEvaluator{*this, selection};
+  const auto batch_pos_list = batch_evaluator._evaluate_expression_to_pos_list(expression);
+
+  auto result_selection = std::vector<ChunkOffset>(batch_pos_list.size());
+  for (auto match_idx = size_t{0}; match_idx < batch_pos_list.size(); ++match_idx) {
+    result_selection[match_idx] = selection[batch_pos_list[match_idx].chunk_offset];
+  }
+  return result_selection;
+}
+
+PosList ExpressionEvaluator::_evaluate_expression_to_pos_list(const AbstractExpression& expression) {
   /**
    * Only Expressions returning a Bool can be evaluated to a PosList of matches.
    *
@@ -1027,7 +1315,7 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
         } break;
 
         case PredicateCondition::Between:
-          return evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
+          return _evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
 
         case PredicateCondition::IsNull:
         case PredicateCondition::IsNotNull: {
@@ -1071,8 +1359,8 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
     case ExpressionType::Logical: {
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
-      const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
-      const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+      const auto left_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
+      const auto right_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
 
       switch (logical_expression.logical_operator) {
         case LogicalOperator::And:
@@ -1168,19 +1456,17 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
       values.resize(result_size);
       nulls = _evaluate_default_null_logic(left.nulls, right.nulls);
 
-      // Using three different branches instead of views, which would generate 9 cases.
+      // Using three different branches instead of views, which would generate 9 cases. The NULLs have been
+      // determined above, so the values are computed without looking at them.
       if (left.is_literal() == right.is_literal()) {
-        for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values[row_idx], right.values[row_idx]);
-        }
+        evaluate_binary_kernel<Functor, false, false>(values.data(), left.values.data(), right.values.data(),
+                                                      result_size);
       } else if (right.is_literal()) {
-        for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values[row_idx], right.values.front());
-        }
+        evaluate_binary_kernel<Functor, false, true>(values.data(), left.values.data(), right.values.data(),
+                                                     result_size);
       } else {
-        for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values.front(), right.values[row_idx]);
-        }
+        evaluate_binary_kernel<Functor, true, false>(values.data(), left.values.data(), right.values.data(),
+                                                     result_size);
       }
     } else {
       Fail("BinaryOperation not supported on the requested DataTypes");
@@ -1319,6 +1605,34 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
 
   if (_segment_materializations[column_id]) return;
 
+  if (_chunk_evaluator) {
+    // When evaluating a batch, the rows of the selection are gathered from the materialization of the entire segment
+    _chunk_evaluator->_materialize_segment_if_not_yet_materialized(column_id);
+    resolve_data_type(_table->column_data_type(column_id), [&](const auto column_data_type_t) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+
+      const auto& chunk_materialization = static_cast<const ExpressionResult<ColumnDataType>&>(
+          *_chunk_evaluator->_segment_materializations[column_id]);
+
+      std::vector<ColumnDataType> values(_selection.size());
+      for (auto row_idx = size_t{0}; row_idx < _selection.size(); ++row_idx) {
+        values[row_idx] = chunk_materialization.values[_selection[row_idx]];
+      }
+
+      std::vector<bool> nulls;
+      if (chunk_materialization.is_nullable()) {
+        nulls.resize(_selection.size());
+        for (auto row_idx = size_t{0}; row_idx < _selection.size(); ++row_idx) {
+          nulls[row_idx] = chunk_materialization.nulls[_selection[row_idx]];
+        }
+      }
+
+      _segment_materializations[column_id] =
+          std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
+    });
+    return;
+  }
+
   const auto& segment = *_chunk->get_segment(column_id);
 
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
@@ -1484,6 +1798,95 @@ std::shared_ptr<ExpressionResult<std::string>> ExpressionEvaluator::_evaluate_co
   return std::make_shared<ExpressionResult<std::string>>(std::move(result_values), std::move(result_nulls));
 }
 
+std::shared_ptr<BaseSegment> ExpressionEvaluator::_evaluate_function_on_dictionary(
+    const AbstractExpression& expression) {
+  if (!_chunk || _chunk_evaluator || expression.type != ExpressionType::Function) return nullptr;
+
+  // Sub-selects might depend on the row and would be executed again for the copied expression. Otherwise, only columns
+  // differ between the rows.
+  if (contains_select_expression(expression)) return nullptr;
+
+  // The copied expression refers to the function's single column as the only column of the dictionary_table below
+  auto column_id = std::optional<ColumnID>{};
+  auto references_multiple_columns = false;
+  auto dictionary_expression = expression.deep_copy();
+  visit_expression(dictionary_expression, [&](auto& sub_expression) {
+    if (sub_expression->type != ExpressionType::PQPColumn) return ExpressionVisitation::VisitArguments;
+
+    const auto& pqp_column_expression = static_cast<const PQPColumnExpression&>(*sub_expression);
+    references_multiple_columns |= column_id && *column_id != pqp_column_expression.column_id;
+    column_id = pqp_column_expression.column_id;
+    sub_expression = std::make_shared<PQPColumnExpression>(ColumnID{0}, DataType::String, false,
+                                                          pqp_column_expression.as_column_name());
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+  if (!column_id || references_multiple_columns) return nullptr;
+
+  const auto dictionary_segment =
+      std::dynamic_pointer_cast<const DictionarySegment<std::string>>(_chunk->get_segment(*column_id));
+  if (!dictionary_segment || dictionary_segment->dictionary()->empty()) return nullptr;
+
+  // Evaluate the function once per dictionary entry
+  const auto& dictionary = *dictionary_segment->dictionary();
+  const auto dictionary_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"dictionary", DataType::String, false}}, TableType::Data);
+  dictionary_table->append_chunk({std::make_shared<ValueSegment<std::string>>(
+      pmr_concurrent_vector<std::string>{dictionary.cbegin(), dictionary.cend()})});
+  const auto function_result = ExpressionEvaluator{dictionary_table, ChunkID{0}, _uncorrelated_select_results}
+                                   .evaluate_expression_to_result<std::string>(*dictionary_expression);
+
+  // NULLs can only stem from NULL literals, i.e., all rows would be NULL. Leave these to the per-row evaluation.
+  const auto& result_nulls = function_result->nulls;
+  if (std::find(result_nulls.cbegin(), result_nulls.cend(), true) != result_nulls.cend()) return nullptr;
+
+  // The results are neither sorted nor distinct, e.g., for prefixes of the dictionary entries. Thus, the new
+  // dictionary is created from them as by the DictionaryEncoder, and the old ValueIDs are mapped to the new ones.
+  const auto dictionary_size = dictionary.size();
+  auto new_dictionary = pmr_vector<std::string>(dictionary_size);
+  for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+    new_dictionary[value_id] = function_result->value(value_id);
+  }
+  std::sort(new_dictionary.begin(), new_dictionary.end());
+  new_dictionary.erase(std::unique(new_dictionary.begin(), new_dictionary.end()), new_dictionary.end());
+  new_dictionary.shrink_to_fit();
+
+  const auto new_null_value_id = static_cast<uint32_t>(new_dictionary.size());
+  auto value_id_mapping = std::vector<uint32_t>(dictionary_size + 1);
+  for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+    const auto new_value_iter =
+        std::lower_bound(new_dictionary.cbegin(), new_dictionary.cend(), function_result->value(value_id));
+    value_id_mapping[value_id] = static_cast<uint32_t>(std::distance(new_dictionary.cbegin(), new_value_iter));
+  }
+  value_id_mapping[dictionary_size] = new_null_value_id;
+
+  // If the function preserves the order and distinctness of the entries (e.g., prepending a literal), the ValueIDs do
+  // not change and the attribute vector is shared with the input segment
+  auto attribute_vector = dictionary_segment->attribute_vector();
+  auto value_ids_change = false;
+  for (auto value_id = size_t{0}; value_id <= dictionary_size; ++value_id) {
+    value_ids_change |= value_id_mapping[value_id] != value_id;
+  }
+
+  if (value_ids_change) {
+    auto new_attribute_vector = pmr_vector<uint32_t>{};
+    new_attribute_vector.reserve(attribute_vector->size());
+    resolve_compressed_vector_type(*attribute_vector, [&](const auto& vector) {
+      for (auto value_id_iter = vector.cbegin(); value_id_iter != vector.cend(); ++value_id_iter) {
+        new_attribute_vector.emplace_back(value_id_mapping[*value_id_iter]);
+      }
+    });
+
+    const auto vector_compression_type = attribute_vector->type() == CompressedVectorType::SimdBp128
+                                             ? VectorCompressionType::SimdBp128
+                                             : VectorCompressionType::FixedSizeByteAligned;
+    attribute_vector = compress_vector(new_attribute_vector, vector_compression_type, {}, {new_null_value_id});
+  }
+
+  return std::make_shared<DictionarySegment<std::string>>(
+      std::make_shared<pmr_vector<std::string>>(std::move(new_dictionary)), attribute_vector,
+      ValueID{new_null_value_id});
+}
+
 template <typename Result>
 std::vector<std::shared_ptr<ExpressionResult<Result>>> ExpressionEvaluator::_prune_tables_to_expression_results(
     const std::vector<std::shared_ptr<const Table>>& tables) {
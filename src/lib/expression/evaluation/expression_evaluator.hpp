@@ -6,6 +6,7 @@
 #include "boost/variant.hpp"
 
 #include "all_type_variant.hpp"
+#include "expression/abstract_expression.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
 #include "expression_result.hpp"
@@ -41,6 +42,11 @@ class PQPColumnExpression;
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
  *      - ...without a Chunk, thus returning a single value (and failing if Columns are encountered in the Expression)
+ *
+ * evaluate_expression_to_pos_list() processes a Chunk in batches of BATCH_SIZE rows, so that the intermediate results
+ * stay in the cache. The batches are evaluated on selection vectors (i.e., the offsets of the rows that are still
+ * candidates): the second operand of an AND is only evaluated for the rows matching the first one, and the second
+ * operand of an OR only for those not matching the first one.
  */
 class ExpressionEvaluator final {
  public:
@@ -49,6 +55,9 @@ class ExpressionEvaluator final {
   using Bool = int32_t;
   static constexpr auto DataTypeBool = DataType::Int;
 
+  // The number of rows of a Chunk that evaluate_expression_to_pos_list() evaluates at once
+  static constexpr auto BATCH_SIZE = ChunkOffset{1024};
+
   // Performance Hack:
   //   For PQPSelectExpressions that are not correlated (i.e., that have no parameters), we pass previously
   //   calculated results into the per-chunk evaluator so that they are only evaluated once, not per-chunk.
@@ -57,13 +66,19 @@ class ExpressionEvaluator final {
   // For Expressions that do not reference any columns (e.g. in the LIMIT clause)
   ExpressionEvaluator() = default;
 
+  // For Expressions that do not reference any columns, but contain uncorrelated selects that were evaluated before
+  explicit ExpressionEvaluator(const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results);
+
   /*
    * For Expressions that reference segments from a single table
    * @param uncorrelated_select_results  Results from pre-computed uncorrelated selects, so they do not need to be
    *                                     evaluated for every chunk. Solely for performance.
+   * @param common_subexpressions        Expressions whose result is kept once it has been computed, so that they are
+   *                                     only evaluated once per chunk. Solely for performance.
    */
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-                      const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results = {});
+                      const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results = {},
+                      const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions = {});
 
   std::shared_ptr<BaseSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   PosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
@@ -71,11 +86,31 @@ class ExpressionEvaluator final {
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> evaluate_expression_to_result(const AbstractExpression& expression);
 
-  // Utility to populate a cache of UncorrelatedSelectResults
+  // Utility to populate a cache of UncorrelatedSelectResults. Each select is executed once, even if it occurs multiple
+  // times in the @param expressions.
   static std::shared_ptr<UncorrelatedSelectResults> populate_uncorrelated_select_results_cache(
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
+  // Utility to find the (non-trivial) subexpressions that occur more than once in the @param expressions, e.g., `a * b`
+  // in `a * b + c` and `a * b - c`
+  static std::shared_ptr<ExpressionUnorderedSet> find_common_subexpressions(
+      const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
  private:
+  // For evaluating an expression on the rows of the @param chunk_evaluator's Chunk that are in the @param selection.
+  // The segments are materialized by the chunk_evaluator, so that this happens only once per Chunk.
+  ExpressionEvaluator(ExpressionEvaluator& chunk_evaluator, const std::vector<ChunkOffset>& selection);
+
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result(const AbstractExpression& expression);
+
+  // Evaluates the expression for all rows (of the selection, if this evaluator has one) at once
+  PosList _evaluate_expression_to_pos_list(const AbstractExpression& expression);
+
+  // Returns the offsets of the rows in the @param selection (in ascending order) for which the expression is true
+  std::vector<ChunkOffset> _evaluate_expression_to_selection(const AbstractExpression& expression,
+                                                             const std::vector<ChunkOffset>& selection);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -183,6 +218,12 @@ class ExpressionEvaluator final {
   std::shared_ptr<ExpressionResult<std::string>> _evaluate_concatenate(
       const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
 
+  // If the @param expression is a function (SUBSTR, CONCAT) whose only column argument is a
+  // DictionarySegment<std::string>, it is evaluated once per dictionary entry instead of once per row. The result is
+  // a DictionarySegment that reuses the attribute vector if the function preserves the order of the dictionary.
+  // Returns nullptr if the expression cannot be evaluated this way.
+  std::shared_ptr<BaseSegment> _evaluate_function_on_dictionary(const AbstractExpression& expression);
+
   template <typename Result>
   static std::vector<std::shared_ptr<ExpressionResult<Result>>> _prune_tables_to_expression_results(
       const std::vector<std::shared_ptr<const Table>>& tables);
@@ -195,7 +236,15 @@ class ExpressionEvaluator final {
   // One entry for each segment in the _chunk, may be nullptr if the segment hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
+  // Only set when evaluating a batch. Then, the rows of this evaluator are those of the chunk_evaluator at the offsets
+  // in the _selection.
+  ExpressionEvaluator* _chunk_evaluator{nullptr};
+  std::vector<ChunkOffset> _selection;
+
   const std::shared_ptr<const UncorrelatedSelectResults> _uncorrelated_select_results;
+
+  const std::shared_ptr<const ExpressionUnorderedSet> _common_subexpressions;
+  ExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _common_subexpression_results;
 };
 
 }  // namespace opossum
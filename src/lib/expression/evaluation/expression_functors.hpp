@@ -1,6 +1,7 @@
 #pragma once
 
 #include "expression_result.hpp"
+#include "utils/checked_arithmetic.hpp"
 
 /**
  * ExpressionEvaluator internal functor objects.
@@ -106,7 +107,8 @@ using LessThanEvaluator = STLComparisonFunctorWrapper<std::less>;
 using LessThanEqualsEvaluator = STLComparisonFunctorWrapper<std::less_equal>;
 
 /**
- * See STLComparisonFunctorWrappe, but for arithmetic functors (+, -, *)
+ * See STLComparisonFunctorWrappe, but for arithmetic functors (+, -, *). Integer arithmetic fails on overflows (see
+ * utils/checked_arithmetic.hpp).
  * @tparam Functor
  */
 template <template <typename T> typename Functor>
@@ -122,6 +124,15 @@ struct STLArithmeticFunctorWrapper {
     if constexpr (std::is_same_v<NullValue, Result> || std::is_same_v<NullValue, ArgA> ||
                   std::is_same_v<NullValue, ArgB>) {
       result = Result{};
+    } else if constexpr (std::is_integral_v<Result> && std::is_integral_v<ArgA> && std::is_integral_v<ArgB>) {
+      if constexpr (std::is_same_v<Functor<Result>, std::plus<Result>>) {
+        result = checked_add<Result>(a, b);
+      } else if constexpr (std::is_same_v<Functor<Result>, std::minus<Result>>) {
+        result = checked_subtract<Result>(a, b);
+      } else {
+        static_assert(std::is_same_v<Functor<Result>, std::multiplies<Result>>, "Unexpected arithmetic functor");
+        result = checked_multiply<Result>(a, b);
+      }
     } else {
       result = static_cast<Result>(Functor<std::common_type_t<ArgA, ArgB>>{}(a, b));
     }
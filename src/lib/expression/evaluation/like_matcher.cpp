@@ -1,6 +1,8 @@
 #include "like_matcher.hpp"
 
-#include "boost/algorithm/string/replace.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 #include "utils/assert.hpp"
 
@@ -16,6 +18,50 @@ bool LikeMatcher::contains_wildcard(const std::string& pattern) {
   return get_index_of_next_wildcard(pattern) != std::string::npos;
 }
 
+size_t LikeMatcher::find(const std::string_view& string, const std::string_view& substring, const size_t offset) {
+  const auto substring_size = substring.size();
+  if (offset > string.size() || string.size() - offset < substring_size) return std::string::npos;
+  if (substring_size == 0) return offset;
+
+  constexpr auto BLOCK_SIZE = size_t{32};
+
+  const auto* data = string.data();
+  const auto first_char = substring.front();
+  const auto last_char = substring.back();
+
+  // The characters between the first and the last one still have to be compared for a candidate
+  const auto matches_at = [&](const size_t position) {
+    return substring_size <= 2 || std::memcmp(data + position + 1, substring.data() + 1, substring_size - 2) == 0;
+  };
+
+  // Positions after `end` leave too few characters for the substring
+  const auto end = string.size() - substring_size + 1;
+
+  auto position = offset;
+  for (; position + BLOCK_SIZE <= end; position += BLOCK_SIZE) {
+    auto mask = uint32_t{0};
+    for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+      const auto is_candidate =
+          (data[position + index] == first_char) & (data[position + index + substring_size - 1] == last_char);
+      mask |= static_cast<uint32_t>(is_candidate) << index;
+    }
+
+    while (mask != 0) {
+      const auto index = static_cast<size_t>(__builtin_ctz(mask));
+      if (matches_at(position + index)) return position + index;
+      mask &= mask - 1;
+    }
+  }
+
+  for (; position < end; ++position) {
+    if (data[position] == first_char && data[position + substring_size - 1] == last_char && matches_at(position)) {
+      return position;
+    }
+  }
+
+  return std::string::npos;
+}
+
 LikeMatcher::PatternTokens LikeMatcher::pattern_string_to_tokens(const std::string& pattern) {
   PatternTokens tokens;
 
@@ -90,34 +136,82 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
     if (pattern_is_contains_multiple) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return pattern_string_to_general_pattern(pattern);
     }
   }
 }
 
-std::string LikeMatcher::sql_like_to_regex(std::string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
+LikeMatcher::GeneralPattern LikeMatcher::pattern_string_to_general_pattern(const std::string& pattern) {
+  auto general_pattern = GeneralPattern{};
+
+  auto piece_begin = size_t{0};
+  while (true) {
+    const auto piece_end = std::min(pattern.find('%', piece_begin), pattern.size());
+    auto& piece = general_pattern.pieces.emplace_back();
+    piece.string = pattern.substr(piece_begin, piece_end - piece_begin);
+
+    // The longest run without '_' is what middle pieces are searched for
+    auto run_begin = size_t{0};
+    while (run_begin < piece.string.size()) {
+      const auto run_end = std::min(piece.string.find('_', run_begin), piece.string.size());
+      if (run_end - run_begin > piece.literal_size) {
+        piece.literal_offset = run_begin;
+        piece.literal_size = run_end - run_begin;
+      }
+      run_begin = run_end + 1;
+    }
+
+    if (piece_end == pattern.size()) break;
+    piece_begin = piece_end + 1;
+  }
+
+  return general_pattern;
+}
+
+bool LikeMatcher::matches_general_pattern(const GeneralPattern& pattern, const std::string_view& string) {
+  const auto& pieces = pattern.pieces;
+
+  const auto piece_matches_at = [&](const GeneralPattern::Piece& piece, const size_t position) {
+    const auto& piece_string = piece.string;
+    if (position + piece_string.size() > string.size()) return false;
+    for (auto index = size_t{0}; index < piece_string.size(); ++index) {
+      if (piece_string[index] != '_' && piece_string[index] != string[position + index]) return false;
+    }
+    return true;
+  };
+
+  const auto& first_piece = pieces.front();
+  if (pieces.size() == 1) return string.size() == first_piece.string.size() && piece_matches_at(first_piece, 0);
+
+  const auto& last_piece = pieces.back();
+  if (string.size() < first_piece.string.size() + last_piece.string.size()) return false;
+  if (!piece_matches_at(first_piece, 0)) return false;
+
+  // The last piece has to end with the string, so the middle pieces have to end before it begins
+  const auto last_piece_begin = string.size() - last_piece.string.size();
+  const auto middle_string = string.substr(0, last_piece_begin);
+
+  // As each piece has a fixed length, matching it at its first position leaves the most room for the following ones
+  auto position = first_piece.string.size();
+  for (auto piece_idx = size_t{1}; piece_idx + 1 < pieces.size(); ++piece_idx) {
+    const auto& piece = pieces[piece_idx];
+    const auto literal = std::string_view{piece.string}.substr(piece.literal_offset, piece.literal_size);
+
+    while (true) {
+      const auto literal_position = find(middle_string, literal, position + piece.literal_offset);
+      if (literal_position == std::string::npos) return false;
+
+      const auto piece_position = literal_position - piece.literal_offset;
+      if (piece_position + piece.string.size() > last_piece_begin) return false;
+      if (piece_matches_at(piece, piece_position)) {
+        position = piece_position + piece.string.size();
+        break;
+      }
+      position = piece_position + 1;
+    }
   }
 
-  return "^" + sql_like + "$";
+  return piece_matches_at(last_piece, last_piece_begin);
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -17,14 +17,18 @@ namespace opossum {
  */
 class LikeMatcher {
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(std::string sql_like);
-
   static size_t get_index_of_next_wildcard(const std::string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const std::string& pattern);
 
+  /**
+   * Returns the position of the first occurrence of `substring` in `string` at or after `offset`, or std::string::npos.
+   * Candidate positions are found by comparing the first and the last character of `substring` to 32 characters of
+   * `string` at a time. The comparisons are free of branches, so that the compiler translates them into vector
+   * instructions. Only the candidates are then compared to the whole `substring`. Compared to std::string::find(),
+   * which looks for the first character only, this skips most false candidates in natural language text.
+   */
+  static size_t find(const std::string_view& string, const std::string_view& substring, const size_t offset = 0);
+
   explicit LikeMatcher(const std::string& pattern);
 
   enum class Wildcard { SingleChar /* '_' */, AnyChars /* '%' */ };
@@ -39,7 +43,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is matched as a GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -57,18 +61,33 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<std::string> strings;
   };
+  // 'H_llo%W%_d', i.e., any other pattern. It is split at '%' into pieces of a fixed length, in which '_' matches any
+  // character. The first piece has to match at the beginning of the string, the last one at its end, and the ones in
+  // between at the first position after the previous one, which is where their longest run without '_' is found.
+  struct GeneralPattern final {
+    struct Piece final {
+      std::string string;
+      size_t literal_offset{0};
+      size_t literal_size{0};
+    };
+    std::vector<Piece> pieces;
+  };
+
+  static bool matches_general_pattern(const GeneralPattern& pattern, const std::string_view& string);
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to a GeneralPattern.
    */
   using AllPatternVariant =
-      boost::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      boost::variant<StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern, GeneralPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const std::string& pattern);
+  static GeneralPattern pattern_string_to_general_pattern(const std::string& pattern);
 
   /**
    * The functor will be called with a concrete matcher.
+   * The matchers take a std::string_view, so that strings that are not stored as std::string (e.g., in a
+   * FixedStringVector) need not be copied.
    * Usage example:
    *    LikeMatcher{"%hello%"}.resolve(false, [](const auto& matcher) {
    *        std::cout << matcher("He said hello!") << std::endl;
@@ -78,41 +97,43 @@ class LikeMatcher {
   void resolve(const bool invert_results, const Functor& functor) const {
     if (_pattern_variant.type() == typeid(StartsWithPattern)) {
       const auto& prefix = boost::get<StartsWithPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
+      functor([&](const std::string_view& string) -> bool {
         if (string.size() < prefix.size()) return invert_results;
         return (string.compare(0, prefix.size(), prefix) == 0) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(EndsWithPattern)) {
       const auto& suffix = boost::get<EndsWithPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
+      functor([&](const std::string_view& string) -> bool {
         if (string.size() < suffix.size()) return invert_results;
         return (string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(ContainsPattern)) {
       const auto& contains_str = boost::get<ContainsPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
-        return (string.find(contains_str) != std::string::npos) ^ invert_results;
+      functor([&](const std::string_view& string) -> bool {
+        return (find(string, contains_str) != std::string::npos) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(MultipleContainsPattern)) {
       const auto& contains_strs = boost::get<MultipleContainsPattern>(_pattern_variant).strings;
 
-      functor([&](const std::string& string) -> bool {
+      functor([&](const std::string_view& string) -> bool {
         auto current_position = size_t{0};
         for (const auto& contains_str : contains_strs) {
-          current_position = string.find(contains_str, current_position);
+          current_position = find(string, contains_str, current_position);
           if (current_position == std::string::npos) return invert_results;
           current_position += contains_str.size();
         }
         return !invert_results;
       });
 
-    } else if (_pattern_variant.type() == typeid(std::regex)) {
-      const auto& regex = boost::get<std::regex>(_pattern_variant);
+    } else if (_pattern_variant.type() == typeid(GeneralPattern)) {
+      const auto& general_pattern = boost::get<GeneralPattern>(_pattern_variant);
 
-      functor([&](const std::string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      functor([&](const std::string_view& string) -> bool {
+        return matches_general_pattern(general_pattern, string) ^ invert_results;
+      });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
@@ -60,6 +60,28 @@ std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy(
   return copied_expressions;
 }
 
+std::shared_ptr<AbstractExpression> expression_deep_copy_if_stateful(
+    const std::shared_ptr<AbstractExpression>& expression) {
+  auto is_stateful = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    is_stateful |= sub_expression->type == ExpressionType::CorrelatedParameter ||
+                   sub_expression->type == ExpressionType::PQPSelect;
+    return is_stateful ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+
+  return is_stateful ? expression->deep_copy() : expression;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy_if_stateful(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  std::vector<std::shared_ptr<AbstractExpression>> copied_expressions;
+  copied_expressions.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    copied_expressions.emplace_back(expression_deep_copy_if_stateful(expression));
+  }
+  return copied_expressions;
+}
+
 std::vector<std::shared_ptr<AbstractExpression>> expressions_copy_and_adapt_to_different_lqp(
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions, const LQPNodeMapping& node_mapping) {
   std::vector<std::shared_ptr<AbstractExpression>> copied_expressions;
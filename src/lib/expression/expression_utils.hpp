@@ -42,6 +42,15 @@ bool expression_equal_to_expression_in_different_lqp(const AbstractExpression& e
 std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy(
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
+/**
+ * Utility to AbstractExpression::deep_copy() the expression(s) of an operator for a copy of its PQP. Only expressions
+ * with parameters or subselects are set per execution of a PQP, the others are shared with the copy.
+ */
+std::shared_ptr<AbstractExpression> expression_deep_copy_if_stateful(
+    const std::shared_ptr<AbstractExpression>& expression);
+std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy_if_stateful(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
 /**
  * Utility to AbstractExpression::deep_copy() a vector of expressions while adjusting column references in
  * LQPColumnExpressions according to the node_mapping
@@ -43,8 +43,10 @@ std::string ExtractExpression::as_column_name() const {
 }
 
 DataType ExtractExpression::data_type() const {
-  // Dates are Strings, DateComponents COULD be Ints, but lets leave it at String for now
-  return DataType::String;
+  // The components of dates that are Strings (YYYY-MM-DD) are Strings. Dates and timestamps that are stored as integers
+  // (see utils/date_utils.hpp) are taken apart arithmetically, their components are Ints.
+  const auto from_data_type = from()->data_type();
+  return from_data_type == DataType::Int || from_data_type == DataType::Long ? DataType::Int : DataType::String;
 }
 
 std::shared_ptr<AbstractExpression> ExtractExpression::from() const { return arguments[0]; }
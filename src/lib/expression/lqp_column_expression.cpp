@@ -4,8 +4,6 @@
 
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
-#include "storage/storage_manager.hpp"
-#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -39,8 +37,7 @@ std::string LQPColumnExpression::as_column_name() const {
 DataType LQPColumnExpression::data_type() const {
   if (column_reference.original_node()->type == LQPNodeType::StoredTable) {
     const auto stored_table_node = std::static_pointer_cast<const StoredTableNode>(column_reference.original_node());
-    const auto table = StorageManager::get().get_table(stored_table_node->table_name);
-    return table->column_data_type(column_reference.original_column_id());
+    return stored_table_node->column_definitions().at(column_reference.original_column_id()).data_type;
 
   } else if (column_reference.original_node()->type == LQPNodeType::Mock) {
     const auto mock_node = std::static_pointer_cast<const MockNode>(column_reference.original_node());
@@ -55,8 +52,7 @@ DataType LQPColumnExpression::data_type() const {
 bool LQPColumnExpression::is_nullable() const {
   if (column_reference.original_node()->type == LQPNodeType::StoredTable) {
     const auto stored_table_node = std::static_pointer_cast<const StoredTableNode>(column_reference.original_node());
-    const auto table = StorageManager::get().get_table(stored_table_node->table_name);
-    return table->column_is_nullable(column_reference.original_column_id());
+    return stored_table_node->column_definitions().at(column_reference.original_column_id()).nullable;
 
   } else if (column_reference.original_node()->type == LQPNodeType::Mock) {
     return false;  // MockNodes do not support NULLs
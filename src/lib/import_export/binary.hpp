@@ -1,9 +1,29 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 namespace opossum {
 
 enum class BinarySegmentType : uint8_t { value_segment = 0, dictionary_segment = 1 };
 
+enum class BinaryFilterType : uint8_t { min_max_filter = 0, range_filter = 1, null_count_filter = 2 };
+
 using BoolAsByteType = uint8_t;
 
+/**
+ * The chunk directory at the end of a binary file holds the offsets of the chunks in the file (as uint64_t), followed
+ * by this marker. It lets ImportBinary find the chunks without reading the ones before them. Files without it (i.e.,
+ * written before it was introduced) are still imported, the chunks are then found by skipping over their
+ * predecessors.
+ */
+constexpr auto CHUNK_DIRECTORY_MARKER = std::array<char, 8>{'C', 'H', 'U', 'N', 'K', 'D', 'I', 'R'};
+
+/**
+ * The statistics of the table and its chunks precede the chunk directory. They end with their offset in the file (as
+ * uint64_t), followed by this marker. Files without them are imported all the same, the StorageManager then generates
+ * the statistics of the table.
+ */
+constexpr auto STATISTICS_MARKER = std::array<char, 8>{'S', 'T', 'A', 'T', 'I', 'S', 'T', 'C'};
+
 }  // namespace opossum
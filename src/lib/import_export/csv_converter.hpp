@@ -5,8 +5,11 @@
 #include <algorithm>
 #include <cstdlib>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "csv_meta.hpp"
@@ -14,6 +17,7 @@
 #include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_utils.hpp"
 
 namespace opossum {
 
@@ -41,13 +45,49 @@ class BaseCsvConverter {
    */
   static void unescape(std::string& field, const ParseConfig& config = {});
   static std::string unescape_copy(const std::string& field, const ParseConfig& config = {});
+
+  /*
+   * Fast path for converting plain decimal integers such as "-123", which make up the vast majority of integer fields.
+   * Returns std::nullopt for anything else (e.g., leading whitespace, a '+' sign, or an overflow), which is then left
+   * to std::stoi() and std::stoll() with their error handling.
+   */
+  template <typename T>
+  static std::optional<T> parse_plain_integer(const std::string& field) {
+    static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "Expected a signed integer type");
+    using UnsignedType = std::make_unsigned_t<T>;
+
+    const auto is_negative = !field.empty() && field.front() == '-';
+    const auto first_digit = is_negative ? size_t{1} : size_t{0};
+    if (field.size() == first_digit || field.size() - first_digit > std::numeric_limits<T>::digits10) {
+      return std::nullopt;
+    }
+
+    // With at most digits10 digits, the value cannot overflow UnsignedType or T
+    auto value = UnsignedType{0};
+    for (auto index = first_digit; index < field.size(); ++index) {
+      const auto digit = static_cast<UnsignedType>(field[index] - '0');
+      if (digit > 9) return std::nullopt;
+      value = value * 10 + digit;
+    }
+
+    return is_negative ? static_cast<T>(-static_cast<T>(value)) : static_cast<T>(value);
+  }
 };
 
+/*
+ * With is_datetime, the fields of an Int column are dates (YYYY-MM-DD) and those of a Long column are timestamps
+ * (YYYY-MM-DD HH:MM:SS), which are stored as the days or seconds since 1970-01-01 (see utils/date_utils.hpp).
+ */
 template <typename T>
 class CsvConverter : public BaseCsvConverter {
  public:
-  explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false)
-      : _parsed_values(size), _null_values(size, false), _is_nullable(is_nullable), _config(config) {}
+  explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false,
+                        bool is_datetime = false)
+      : _parsed_values(size),
+        _null_values(size, false),
+        _is_nullable(is_nullable),
+        _config(config),
+        _conversion_function(_get_conversion_function(is_datetime)) {}
 
   void insert(std::string& value, ChunkOffset position) override {
     if (_is_nullable && value.length() == 0) {
@@ -55,7 +95,8 @@ class CsvConverter : public BaseCsvConverter {
       return;
     }
 
-    if (boost::to_lower_copy(value) == ParseConfig::NULL_STRING) {
+    if (value.size() == std::char_traits<char>::length(ParseConfig::NULL_STRING) &&
+        boost::iequals(value, ParseConfig::NULL_STRING)) {
       Assert(!_config.reject_null_strings,
              "Unquoted null found in CSV file. Quote it for string literal \"null\", leave field empty for null value, "
              "or set 'reject_null_strings' to false in parse config.");
@@ -71,14 +112,15 @@ class CsvConverter : public BaseCsvConverter {
     } else {  // NOLINT
       // clang-format on
       if (_config.reject_quoted_nonstrings) {
-        Assert(value == unescape_copy(value, _config),
+        // Only fields that start with a quote are changed by unescape()
+        Assert(value.empty() || value.front() != _config.quote,
                "Unexpected quoted string " + value + " encountered in non-string column");
       } else {
         unescape(value, _config);
       }
     }
 
-    _parsed_values[position] = _get_conversion_function()(value);
+    _parsed_values[position] = _conversion_function(value);
   }
 
   std::unique_ptr<BaseSegment> finish() override {
@@ -96,16 +138,30 @@ class CsvConverter : public BaseCsvConverter {
    * The assumption is that only csv fields of type string must be unescaped because other types cannot contain special
    * csv characters.
    */
-  std::function<T(const std::string&)> _get_conversion_function();
+  std::function<T(const std::string&)> _get_conversion_function(const bool is_datetime);
   tbb::concurrent_vector<T> _parsed_values;
   tbb::concurrent_vector<bool> _null_values;
   const bool _is_nullable;
   ParseConfig _config;
+
+  // Created once instead of for every field
+  const std::function<T(const std::string&)> _conversion_function;
 };
 
 template <>
-inline std::function<int32_t(const std::string&)> CsvConverter<int32_t>::_get_conversion_function() {
+inline std::function<int32_t(const std::string&)> CsvConverter<int32_t>::_get_conversion_function(
+    const bool is_datetime) {
+  if (is_datetime) {
+    return [](const std::string& str) {
+      const auto days = parse_date(str);
+      Assert(days, "Invalid date (expected YYYY-MM-DD): " + str);
+      return *days;
+    };
+  }
+
   return [](const std::string& str) {
+    if (const auto converted = parse_plain_integer<int32_t>(str)) return *converted;
+
     size_t pos;
     auto converted = std::stoi(str, &pos);
     Assert(pos == str.size(), "Unprocessed characters found while converting to int: " + str);
@@ -114,8 +170,19 @@ inline std::function<int32_t(const std::string&)> CsvConverter<int32_t>::_get_co
 }
 
 template <>
-inline std::function<int64_t(const std::string&)> CsvConverter<int64_t>::_get_conversion_function() {
+inline std::function<int64_t(const std::string&)> CsvConverter<int64_t>::_get_conversion_function(
+    const bool is_datetime) {
+  if (is_datetime) {
+    return [](const std::string& str) {
+      const auto seconds = parse_timestamp(str);
+      Assert(seconds, "Invalid timestamp (expected YYYY-MM-DD HH:MM:SS): " + str);
+      return *seconds;
+    };
+  }
+
   return [](const std::string& str) {
+    if (const auto converted = parse_plain_integer<int64_t>(str)) return *converted;
+
     size_t pos;
     auto converted = static_cast<int64_t>(std::stoll(str, &pos));
     Assert(pos == str.size(), "Unprocessed characters found while converting to long: " + str);
@@ -124,7 +191,8 @@ inline std::function<int64_t(const std::string&)> CsvConverter<int64_t>::_get_co
 }
 
 template <>
-inline std::function<float(const std::string&)> CsvConverter<float>::_get_conversion_function() {
+inline std::function<float(const std::string&)> CsvConverter<float>::_get_conversion_function(const bool is_datetime) {
+  Assert(!is_datetime, "Dates and timestamps are stored as Ints and Longs");
   return [](const std::string& str) {
     size_t pos;
     auto converted = std::stof(str, &pos);
@@ -134,7 +202,9 @@ inline std::function<float(const std::string&)> CsvConverter<float>::_get_conver
 }
 
 template <>
-inline std::function<double(const std::string&)> CsvConverter<double>::_get_conversion_function() {
+inline std::function<double(const std::string&)> CsvConverter<double>::_get_conversion_function(
+    const bool is_datetime) {
+  Assert(!is_datetime, "Dates and timestamps are stored as Ints and Longs");
   return [](const std::string& str) {
     size_t pos;
     auto converted = std::stod(str, &pos);
@@ -144,7 +214,9 @@ inline std::function<double(const std::string&)> CsvConverter<double>::_get_conv
 }
 
 template <>
-inline std::function<std::string(const std::string&)> CsvConverter<std::string>::_get_conversion_function() {
+inline std::function<std::string(const std::string&)> CsvConverter<std::string>::_get_conversion_function(
+    const bool is_datetime) {
+  Assert(!is_datetime, "Dates and timestamps are stored as Ints and Longs");
   return [](const std::string& str) { return str; };
 }
 
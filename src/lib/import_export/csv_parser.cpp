@@ -1,9 +1,9 @@
 #include "csv_parser.hpp"
 
 #include <boost/algorithm/string/trim.hpp>
-#include <fstream>
+#include <algorithm>
+#include <array>
 #include <functional>
-#include <list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -22,6 +22,7 @@
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
@@ -38,54 +39,39 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::
 
   auto table = _create_table_from_meta(chunk_size);
 
-  std::ifstream csvfile{filename};
+  const auto csv_file = MemoryMappedFile{filename};
+  const auto content = csv_file.content();
 
   // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
+  if (content.empty() || content.front() == '\r' || content.front() == '\n') return table;
 
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != _meta.config.delimiter) content.push_back(_meta.config.delimiter);
-
-  std::string_view content_view{content.c_str(), content.size()};
-
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
-  std::vector<size_t> field_ends;
-  while (_find_fields_in_chunk(content_view, *table, field_ends)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
-
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
-
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
-
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([this, relevant_content, field_ends, &table, &segments]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments);
+  const auto chunk_begins = _find_chunk_begins(content, table->max_chunk_size(), ROW_SEARCH_BLOCK_SIZE);
+  const auto chunk_count = chunk_begins.size() - 1;
+
+  // The chunks are parsed in parallel and added to the table as soon as they are done. Only the chunks' fields that are
+  // currently being parsed are copied out of the mapped file.
+  table->create_chunk_slots(chunk_count);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(chunk_count);
+  for (auto chunk_idx = size_t{0}; chunk_idx < chunk_count; ++chunk_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, chunk_idx]() {
+      const auto csv_chunk =
+          content.substr(chunk_begins[chunk_idx], chunk_begins[chunk_idx + 1] - chunk_begins[chunk_idx]);
+
+      auto field_ends = std::vector<size_t>{};
+      _find_fields_in_chunk(csv_chunk, *table, field_ends);
+
+      auto segments = Segments{};
+      _parse_into_chunk(csv_chunk, field_ends, *table, segments);
+      table->set_chunk_slot(chunk_idx, segments);
     }));
     tasks.back()->schedule();
   }
 
   CurrentScheduler::wait_for_tasks(tasks);
 
-  for (auto& segments : segments_by_chunks) {
-    table->append_chunk(segments);
-  }
+  table->append_chunk_slots();
 
   return table;
 }
@@ -105,7 +91,11 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
     auto column_type = column_meta.type;
     BaseCsvConverter::unescape(column_type);
 
-    const auto data_type = data_type_to_string.right.at(column_type);
+    // Dates and timestamps are stored as the days and seconds since 1970-01-01 (see utils/date_utils.hpp)
+    const auto data_type = column_type == DATE_COLUMN_TYPE
+                               ? DataType::Int
+                               : column_type == TIMESTAMP_COLUMN_TYPE ? DataType::Long
+                                                                      : data_type_to_string.right.at(column_type);
 
     column_definitions.emplace_back(column_name, data_type, column_meta.nullable);
   }
@@ -113,19 +103,117 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
-bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table,
-                                      std::vector<size_t>& field_ends) {
-  field_ends.clear();
-  if (csv_content.empty()) {
-    return false;
+std::vector<size_t> CsvParser::_find_chunk_begins(std::string_view csv_content, const ChunkOffset chunk_size,
+                                                  const size_t block_size) const {
+  /**
+   * The file is split into blocks that are searched for row ends in parallel. Whether a delimiter ends a row depends on
+   * whether it is quoted, which in turn depends on all quotes before it. Hence, this happens in two passes:
+   *
+   *  1. For each block, count the quotes and the rows if the block starts outside of quotes and if it starts inside.
+   *     Then, from the first block to the last, determine whether each block starts inside quotes and how many rows
+   *     precede it.
+   *  2. For each block, find the ends of every chunk_size-th row, after which the next chunk begins.
+   *
+   * Neither pass needs more memory than a few counters per block.
+   */
+  const auto content_size = csv_content.size();
+  if (chunk_size == 0) return {0, content_size};
+
+  const auto block_count = (content_size + block_size - 1) / block_size;
+
+  // Calls `functor(position, in_quotes)` for each delimiter of the block that is not part of a quoted value
+  const auto for_each_row_end = [&](const size_t block_idx, bool in_quotes, const auto& functor) {
+    const auto block_end = std::min((block_idx + 1) * block_size, content_size);
+    for (auto position = block_idx * block_size; position < block_end; ++position) {
+      const auto character = csv_content[position];
+
+      // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
+      if (character == _meta.config.quote) {
+        const auto quote_is_escaped = _meta.config.quote != _meta.config.escape && position != 0 &&
+                                      csv_content[position - 1] == _meta.config.escape;
+        if (!quote_is_escaped) in_quotes = !in_quotes;
+      } else if (character == _meta.config.delimiter && !in_quotes) {
+        functor(position);
+      }
+    }
+    return in_quotes;
+  };
+
+  struct BlockInfo {
+    // Index 0: The block starts outside of quotes, index 1: inside of quotes
+    std::array<bool, 2> ends_in_quotes;
+    std::array<size_t, 2> row_counts;
+
+    bool starts_in_quotes;
+    size_t first_row;
+  };
+  auto block_infos = std::vector<BlockInfo>(block_count);
+
+  // Pass 1
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(block_count);
+  for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, block_idx]() {
+      auto& block_info = block_infos[block_idx];
+      for (const auto starts_in_quotes : {false, true}) {
+        auto& row_count = block_info.row_counts[starts_in_quotes];
+        row_count = 0;
+        block_info.ends_in_quotes[starts_in_quotes] =
+            for_each_row_end(block_idx, starts_in_quotes, [&](const size_t) { ++row_count; });
+      }
+    }));
+    tasks.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  auto in_quotes = false;
+  auto row_count = size_t{0};
+  for (auto& block_info : block_infos) {
+    block_info.starts_in_quotes = in_quotes;
+    block_info.first_row = row_count;
+    in_quotes = block_info.ends_in_quotes[in_quotes];
+    row_count += block_info.row_counts[block_info.starts_in_quotes];
+  }
+
+  // Pass 2
+  auto chunk_begins_by_block = std::vector<std::vector<size_t>>(block_count);
+  tasks.clear();
+  for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, block_idx]() {
+      const auto& block_info = block_infos[block_idx];
+      auto row = block_info.first_row;
+      for_each_row_end(block_idx, block_info.starts_in_quotes, [&](const size_t position) {
+        ++row;
+        // A delimiter at the very end of the file does not begin another chunk
+        if (row % chunk_size == 0 && position + 1 < content_size) {
+          chunk_begins_by_block[block_idx].emplace_back(position + 1);
+        }
+      });
+    }));
+    tasks.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  auto chunk_begins = std::vector<size_t>{0};
+  for (const auto& block_chunk_begins : chunk_begins_by_block) {
+    chunk_begins.insert(chunk_begins.end(), block_chunk_begins.begin(), block_chunk_begins.end());
   }
+  chunk_begins.emplace_back(content_size);
+
+  return chunk_begins;
+}
+
+void CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table,
+                                      std::vector<size_t>& field_ends) const {
+  field_ends.clear();
+  if (csv_content.empty()) return;
 
   std::string search_for{_meta.config.separator, _meta.config.delimiter, _meta.config.quote};
 
   size_t pos, from = 0;
-  unsigned int rows = 0, field_count = 1;
+  unsigned int field_count = 1;
   bool in_quotes = false;
-  while (rows < table.max_chunk_size() || 0 == table.max_chunk_size()) {
+  while (true) {
     // Find either of row separator, column delimiter, quote identifier
     pos = csv_content.find_first_of(search_for, from);
     if (std::string::npos == pos) {
@@ -148,7 +236,6 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     // Determine if delimiter marks end of row or is part of the (string) value
     if (elem == _meta.config.delimiter && !in_quotes) {
       DebugAssert(field_count == table.column_count(), "Number of CSV fields does not match number of columns.");
-      ++rows;
       field_count = 0;
     }
 
@@ -161,7 +248,11 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     field_ends.push_back(pos);
   }
 
-  return true;
+  // The last row of the file need not be terminated by a delimiter
+  if (csv_content.back() != _meta.config.delimiter) {
+    DebugAssert(field_count == table.column_count(), "Number of CSV fields does not match number of columns.");
+    field_ends.push_back(csv_content.size());
+  }
 }
 
 size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
@@ -174,9 +265,12 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
   for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
     const auto is_nullable = table.column_is_nullable(column_id);
     const auto column_type = table.column_data_type(column_id);
+    auto meta_column_type = _meta.columns[column_id].type;
+    BaseCsvConverter::unescape(meta_column_type);
+    const auto is_datetime = meta_column_type == DATE_COLUMN_TYPE || meta_column_type == TIMESTAMP_COLUMN_TYPE;
 
-    converters.emplace_back(
-        make_unique_by_data_type<BaseCsvConverter, CsvConverter>(column_type, row_count, _meta.config, is_nullable));
+    converters.emplace_back(make_unique_by_data_type<BaseCsvConverter, CsvConverter>(
+        column_type, row_count, _meta.config, is_nullable, is_datetime));
   }
 
   Assert(field_ends.size() == row_count * column_count, "Unexpected number of fields");
@@ -186,11 +280,14 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
   size_t field_idx = 0;
   ColumnID column_id{0};
 
+  // Reused for all fields, so that long fields do not allocate every time
+  auto field = std::string{};
+
   try {
     for (; row_id < row_count; ++row_id) {
       for (column_id = ColumnID{0}; column_id < column_count; ++column_id, ++field_idx) {
         const auto end = field_ends[field_idx];
-        auto field = std::string{csv_chunk.substr(start, end - start)};
+        field.assign(csv_chunk.data() + start, end - start);
         start = end + 1;
 
         if (!_meta.config.rfc_mode) {
@@ -21,11 +21,13 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser maps the csv file into memory and searches it for the row ends in parallel to separate the data into
+ * chunks that are aligned with the csv rows. Each data chunk is then parsed and converted into a opossum chunk in
+ * parallel. The file is never copied as a whole, so it may be larger than the main memory.
  */
 class CsvParser {
+  friend class CsvParserTest;
+
  public:
   // cannot move-assign because of const members
   CsvParser& operator=(CsvParser&&) = delete;
@@ -40,20 +42,35 @@ class CsvParser {
   std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                      const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
+  // Column types of the meta file for dates (YYYY-MM-DD) and timestamps (YYYY-MM-DD HH:MM:SS), which are stored as the
+  // days in Int columns and as the seconds in Long columns since 1970-01-01 (see utils/date_utils.hpp)
+  static constexpr auto DATE_COLUMN_TYPE = "date";
+  static constexpr auto TIMESTAMP_COLUMN_TYPE = "timestamp";
+
  protected:
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
   std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size);
 
+  // The size of the blocks of the CSV that are searched for row ends in parallel
+  static constexpr auto ROW_SEARCH_BLOCK_SIZE = size_t{16 * 1024 * 1024};
+
+  /*
+   * @param csv_content String_view on the content of the CSV.
+   * @param chunk_size  Number of rows per chunk, 0 for a single chunk.
+   * @param block_size  Size of the blocks that are searched for row ends in parallel.
+   * @returns           The offsets in \p csv_content at which the chunks begin, followed by the size of \p csv_content.
+   */
+  std::vector<size_t> _find_chunk_begins(std::string_view csv_content, const ChunkOffset chunk_size,
+                                         const size_t block_size) const;
+
   /*
-   * @param      csv_content String_view on the remaining content of the CSV.
+   * @param      csv_content String_view on one chunk of the CSV.
    * @param      table       Empty table created by _process_meta_file.
-   * @param[out] field_ends  Empty vector, to be filled with positions of the field ends for one chunk found in \p
-   * csv_content.
-   * @returns                False if \p csv_content is empty or chunk_size set to 0, True otherwise.
+   * @param[out] field_ends  Empty vector, to be filled with positions of the field ends found in \p csv_content.
    */
-  bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends);
+  void _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends) const;
 
   /*
    * @param      csv_chunk  String_view on one chunk of the CSV.
@@ -0,0 +1,320 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto CHECKPOINT_FILE_NAME = std::string{"CHECKPOINT"};
+const auto ROW_POSITIONS_FILE_NAME = std::string{"row_positions"};
+
+// The rows of a chunk that are part of the checkpoint, as ranges [begin, end) of chunk offsets
+using RowRanges = std::vector<std::pair<ChunkOffset, ChunkOffset>>;
+using TableRowRanges = std::vector<RowRanges>;
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+  auto value = T{};
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+// Makes a file or the entries of a directory durable
+void sync_to_disk(const filesystem::path& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + path.string());
+  const auto result = ::fsync(file_descriptor);
+  ::close(file_descriptor);
+  Assert(result == 0, "Cannot sync " + path.string());
+}
+
+std::optional<CommitID> read_checkpoint_commit_id(const filesystem::path& data_directory) {
+  const auto checkpoint_file_path = data_directory / CHECKPOINT_FILE_NAME;
+  if (!filesystem::exists(checkpoint_file_path)) return std::nullopt;
+
+  auto stream = std::ifstream{checkpoint_file_path};
+  auto checkpoint_commit_id = CommitID{0};
+  stream >> checkpoint_commit_id;
+  Assert(stream, "Cannot read " + checkpoint_file_path.string());
+  return checkpoint_commit_id;
+}
+
+// Finds the same rows as ExportBinary::write_binary() does for a snapshot
+TableRowRanges visible_row_ranges(const Table& table, const CommitID snapshot_commit_id) {
+  auto table_row_ranges = TableRowRanges(table.chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+
+    auto& row_ranges = table_row_ranges[chunk_id];
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->begin_cids[chunk_offset] > snapshot_commit_id ||
+          snapshot_commit_id >= mvcc_data->end_cids[chunk_offset]) {
+        continue;
+      }
+
+      if (!row_ranges.empty() && row_ranges.back().second == chunk_offset) {
+        ++row_ranges.back().second;
+      } else {
+        row_ranges.emplace_back(chunk_offset, chunk_offset + 1);
+      }
+    }
+  }
+
+  return table_row_ranges;
+}
+
+/**
+ * The file holds the row ranges of all tables:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Table count           | uint32_t                              |   4
+ * Per table:
+ *   Name length         | uint32_t                              |   4
+ *   Name                | char array                            |   Name length
+ *   Chunk count         | uint32_t                              |   4
+ *   Per chunk:
+ *     Range count       | uint32_t                              |   4
+ *     Ranges            | ChunkOffset pair array                |   Range count * 8
+ */
+void write_row_positions(const std::map<std::string, TableRowRanges>& row_ranges_by_table,
+                         const filesystem::path& path) {
+  auto stream = std::ofstream{};
+  stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  stream.open(path, std::ios::binary);
+
+  write_value(stream, static_cast<uint32_t>(row_ranges_by_table.size()));
+  for (const auto& [table_name, table_row_ranges] : row_ranges_by_table) {
+    write_value(stream, static_cast<uint32_t>(table_name.size()));
+    stream.write(table_name.data(), table_name.size());
+
+    write_value(stream, static_cast<uint32_t>(table_row_ranges.size()));
+    for (const auto& row_ranges : table_row_ranges) {
+      write_value(stream, static_cast<uint32_t>(row_ranges.size()));
+      for (const auto& [begin, end] : row_ranges) {
+        write_value(stream, begin);
+        write_value(stream, end);
+      }
+    }
+  }
+}
+
+std::map<std::string, TableRowRanges> read_row_positions(const filesystem::path& path) {
+  auto stream = std::ifstream{};
+  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  stream.open(path, std::ios::binary);
+
+  auto row_ranges_by_table = std::map<std::string, TableRowRanges>{};
+
+  const auto table_count = read_value<uint32_t>(stream);
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    auto table_name = std::string(read_value<uint32_t>(stream), '\0');
+    stream.read(table_name.data(), table_name.size());
+
+    auto& table_row_ranges = row_ranges_by_table[table_name];
+    table_row_ranges.resize(read_value<uint32_t>(stream));
+    for (auto& row_ranges : table_row_ranges) {
+      row_ranges.resize(read_value<uint32_t>(stream));
+      for (auto& [begin, end] : row_ranges) {
+        begin = read_value<ChunkOffset>(stream);
+        end = read_value<ChunkOffset>(stream);
+      }
+    }
+  }
+
+  return row_ranges_by_table;
+}
+
+// Moves the rows that ImportBinary read back into the positions that they had when the checkpoint was written
+std::shared_ptr<Table> restore_row_positions(const Table& imported_table, const TableRowRanges& table_row_ranges) {
+  Assert(imported_table.chunk_count() == table_row_ranges.size(), "Checkpoint does not match its row positions");
+
+  auto table = std::make_shared<Table>(imported_table.column_definitions(), TableType::Data,
+                                       imported_table.max_chunk_size(), UseMvcc::Yes);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table.chunk_count(); ++chunk_id) {
+    const auto imported_chunk = imported_table.get_chunk(chunk_id);
+    const auto& row_ranges = table_row_ranges[chunk_id];
+    const auto chunk_size = row_ranges.empty() ? ChunkOffset{0} : row_ranges.back().second;
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < imported_table.column_count(); ++column_id) {
+      resolve_data_type(imported_table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        const auto imported_segment =
+            std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(imported_chunk->get_segment(column_id));
+        Assert(imported_segment, "Checkpoints consist of value segments");
+
+        const auto is_nullable = imported_segment->is_nullable();
+        auto values = pmr_concurrent_vector<ColumnDataType>(chunk_size);
+        auto null_values = pmr_concurrent_vector<bool>(is_nullable ? chunk_size : 0);
+
+        auto imported_offset = size_t{0};
+        for (const auto& [begin, end] : row_ranges) {
+          for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset, ++imported_offset) {
+            values[chunk_offset] = imported_segment->values()[imported_offset];
+            if (is_nullable) null_values[chunk_offset] = imported_segment->null_values()[imported_offset];
+          }
+        }
+        Assert(imported_offset == imported_segment->size(), "Checkpoint does not match its row positions");
+
+        if (is_nullable) {
+          segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+
+    table->append_chunk(segments);
+
+    // The rows in between were not visible when the checkpoint was written
+    auto mvcc_data = table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+    auto gap_begin = ChunkOffset{0};
+    for (const auto& [begin, end] : row_ranges) {
+      for (auto chunk_offset = gap_begin; chunk_offset < begin; ++chunk_offset) {
+        mvcc_data->end_cids[chunk_offset] = CommitID{0};
+      }
+      gap_begin = end;
+    }
+  }
+
+  return table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+CommitID Checkpoint::write(const std::string& data_directory) {
+  // The transaction only reads, so committing it does not wait for the log
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  // Nothing was committed since the latest checkpoint, which must not be overwritten while CHECKPOINT names it
+  if (read_checkpoint_commit_id(data_directory) == snapshot_commit_id) {
+    transaction_context->commit();
+    return snapshot_commit_id;
+  }
+
+  // Remove what an earlier attempt might have left
+  const auto checkpoint_directory = filesystem::path{data_directory} / std::to_string(snapshot_commit_id);
+  filesystem::remove_all(checkpoint_directory);
+  filesystem::create_directories(checkpoint_directory);
+
+  // The tables that no query looked up since they were added lazily (e.g., by load()) have to be part of the
+  // checkpoint, too
+  for (const auto& table_name : StorageManager::get().lazy_table_names()) {
+    StorageManager::get().load_lazy_table(table_name);
+  }
+
+  auto tables = StorageManager::get().tables();
+  auto row_ranges_by_table = std::map<std::string, TableRowRanges>{};
+  for (const auto& [table_name, table] : tables) {
+    row_ranges_by_table.emplace(table_name, TableRowRanges{});
+  }
+
+  // ExportBinary serializes the chunks of each table in parallel, too
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(tables.size());
+  for (const auto& [table_name, table] : tables) {
+    const auto table_file_path = checkpoint_directory / (table_name + ".bin");
+    auto& table_row_ranges = row_ranges_by_table[table_name];
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, table = table, table_file_path]() {
+      ExportBinary::write_binary(*table, table_file_path.string(), snapshot_commit_id);
+      table_row_ranges = visible_row_ranges(*table, snapshot_commit_id);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  transaction_context->commit();
+
+  const auto row_positions_file_path = checkpoint_directory / ROW_POSITIONS_FILE_NAME;
+  write_row_positions(row_ranges_by_table, row_positions_file_path);
+
+  for (const auto& [table_name, table] : tables) {
+    sync_to_disk(checkpoint_directory / (table_name + ".bin"));
+  }
+  sync_to_disk(row_positions_file_path);
+  sync_to_disk(checkpoint_directory);
+
+  // Replacing the file is atomic, so CHECKPOINT always names a complete checkpoint
+  const auto checkpoint_file_path = filesystem::path{data_directory} / CHECKPOINT_FILE_NAME;
+  const auto temporary_file_path = filesystem::path{data_directory} / (CHECKPOINT_FILE_NAME + ".tmp");
+  {
+    auto stream = std::ofstream{};
+    stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    stream.open(temporary_file_path);
+    stream << snapshot_commit_id << std::endl;
+  }
+  sync_to_disk(temporary_file_path);
+  filesystem::rename(temporary_file_path, checkpoint_file_path);
+  sync_to_disk(data_directory);
+
+  // Remove the previous checkpoints, which are directories named after their commit ids
+  for (const auto& entry : filesystem::directory_iterator{data_directory}) {
+    if (!entry.is_directory() || entry.path() == checkpoint_directory) continue;
+
+    const auto& name = entry.path().filename().string();
+    if (name.find_first_not_of("0123456789") == std::string::npos) filesystem::remove_all(entry.path());
+  }
+
+  return snapshot_commit_id;
+}
+
+std::optional<CommitID> Checkpoint::load(const std::string& data_directory) {
+  const auto checkpoint_commit_id = read_checkpoint_commit_id(data_directory);
+  if (!checkpoint_commit_id) return std::nullopt;
+
+  const auto checkpoint_directory = filesystem::path{data_directory} / std::to_string(*checkpoint_commit_id);
+  auto row_ranges_by_table = read_row_positions(checkpoint_directory / ROW_POSITIONS_FILE_NAME);
+
+  // The tables are loaded once they are looked up, e.g., by the first query or by Recovery replaying the log. The
+  // checkpoint is not removed before the next one is complete, which loads all of them first.
+  for (auto& [table_name, table_row_ranges] : row_ranges_by_table) {
+    const auto table_file_path = (checkpoint_directory / (table_name + ".bin")).string();
+    StorageManager::get().add_lazy_table(
+        table_name, [table_row_ranges = std::move(table_row_ranges), table_file_path]() {
+          const auto imported_table = ImportBinary::read_binary(table_file_path);
+          return restore_row_positions(*imported_table, table_row_ranges);
+        });
+  }
+
+  return checkpoint_commit_id;
+}
+
+}  // namespace opossum
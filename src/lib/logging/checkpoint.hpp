@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A checkpoint is a consistent snapshot of all tables at a commit id, which is written while transactions keep
+ * modifying the tables. Restarting from a checkpoint saves replaying the redo log (see Logger) from the beginning:
+ * Recovery skips the records of the transactions that committed up to the checkpoint's commit id, so the log can be
+ * truncated up to there.
+ *
+ * The checkpoint runs in a transaction and writes the rows visible to it, one binary file per table (see
+ * ExportBinary), in parallel. As the log refers to rows by their RowIDs, the checkpoint also keeps the positions of
+ * the rows it wrote. Loading it puts each row back into its position, the ones in between are invisible.
+ *
+ * A data directory holds the checkpoints in subdirectories named after their commit ids, and the file CHECKPOINT,
+ * which names the latest complete one. A checkpoint only replaces the previous one once all of its files are synced
+ * to disk, so a crash while it is written leaves the previous checkpoint intact.
+ */
+class Checkpoint {
+ public:
+  /**
+   * Writes a checkpoint of all tables in the StorageManager into @param data_directory and removes the previous one.
+   *
+   * @returns the commit id of the checkpoint
+   */
+  static CommitID write(const std::string& data_directory);
+
+  /**
+   * Adds the tables of the latest checkpoint in @param data_directory to the StorageManager, lazily, so that each is
+   * only loaded once it is first looked up (see StorageManager::add_lazy_table()). Pass its commit id to
+   * Recovery::recover() afterwards.
+   *
+   * @returns the commit id of the checkpoint, or std::nullopt if there is none
+   */
+  static std::optional<CommitID> load(const std::string& data_directory);
+};
+
+}  // namespace opossum
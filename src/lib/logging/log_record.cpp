@@ -0,0 +1,211 @@
+#include "log_record.hpp"
+
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The size and the checksum of the payload precede it
+using RecordSize = uint32_t;
+using Checksum = uint32_t;
+
+// FNV-1a, which is good enough to detect torn writes
+Checksum checksum(const char* data, const size_t size) {
+  auto hash = Checksum{2166136261u};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= Checksum{16777619u};
+  }
+  return hash;
+}
+
+template <typename T>
+void write(std::vector<char>& buffer, const T& value) {
+  const auto offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+void write_string(std::vector<char>& buffer, const std::string& string) {
+  write(buffer, static_cast<uint32_t>(string.size()));
+  buffer.insert(buffer.end(), string.begin(), string.end());
+}
+
+// The DataType of a value, which is also the index of its type in AllTypeVariant, followed by the value itself
+void write_value(std::vector<char>& buffer, const AllTypeVariant& value) {
+  const auto data_type = static_cast<DataType>(value.which());
+  write(buffer, data_type);
+  if (data_type == DataType::Null) return;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ValueDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ValueDataType, std::string>) {
+      write_string(buffer, boost::get<std::string>(value));
+    } else {
+      write(buffer, boost::get<ValueDataType>(value));
+    }
+  });
+}
+
+// Reads from the payload of a record, which was checked to be complete already. Malformed payloads are thus bugs.
+class PayloadReader {
+ public:
+  explicit PayloadReader(const std::vector<char>& payload) : _payload(payload) {}
+
+  template <typename T>
+  T read() {
+    Assert(_offset + sizeof(T) <= _payload.size(), "Log record is malformed");
+    auto value = T{};
+    std::memcpy(&value, _payload.data() + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto size = read<uint32_t>();
+    Assert(_offset + size <= _payload.size(), "Log record is malformed");
+    auto string = std::string{_payload.data() + _offset, size};
+    _offset += size;
+    return string;
+  }
+
+  AllTypeVariant read_value() {
+    const auto data_type = read<DataType>();
+    if (data_type == DataType::Null) return NULL_VALUE;
+
+    auto value = AllTypeVariant{};
+    resolve_data_type(data_type, [&](auto type) {
+      using ValueDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ValueDataType, std::string>) {
+        value = read_string();
+      } else {
+        value = read<ValueDataType>();
+      }
+    });
+    return value;
+  }
+
+  RowID read_row_id() {
+    const auto chunk_id = read<ChunkID>();
+    const auto chunk_offset = read<ChunkOffset>();
+    return RowID{chunk_id, chunk_offset};
+  }
+
+  bool at_end() const { return _offset == _payload.size(); }
+
+ private:
+  const std::vector<char>& _payload;
+  size_t _offset{0};
+};
+
+}  // namespace
+
+namespace opossum {
+
+bool LogRecord::empty() const {
+  for (const auto& [table_name, changes] : table_changes) {
+    if (!changes.inserted_row_ids.empty() || !changes.deleted_row_ids.empty()) return false;
+  }
+  return true;
+}
+
+void LogRecord::serialize(std::vector<char>& buffer) const {
+  const auto header_offset = buffer.size();
+  buffer.resize(header_offset + sizeof(RecordSize) + sizeof(Checksum));
+
+  const auto payload_offset = buffer.size();
+  write(buffer, transaction_id);
+  write(buffer, commit_id);
+  write(buffer, static_cast<uint32_t>(table_changes.size()));
+
+  for (const auto& [table_name, changes] : table_changes) {
+    DebugAssert(changes.inserted_row_ids.size() == changes.inserted_rows.size(), "Need the values of each row");
+    write_string(buffer, table_name);
+
+    write(buffer, static_cast<uint32_t>(changes.inserted_row_ids.size()));
+    for (auto row_index = size_t{0}; row_index < changes.inserted_row_ids.size(); ++row_index) {
+      write(buffer, changes.inserted_row_ids[row_index].chunk_id);
+      write(buffer, changes.inserted_row_ids[row_index].chunk_offset);
+
+      const auto& row = changes.inserted_rows[row_index];
+      write(buffer, static_cast<uint32_t>(row.size()));
+      for (const auto& value : row) {
+        write_value(buffer, value);
+      }
+    }
+
+    write(buffer, static_cast<uint32_t>(changes.deleted_row_ids.size()));
+    for (const auto& row_id : changes.deleted_row_ids) {
+      write(buffer, row_id.chunk_id);
+      write(buffer, row_id.chunk_offset);
+    }
+  }
+
+  const auto payload_size = buffer.size() - payload_offset;
+  Assert(payload_size <= std::numeric_limits<RecordSize>::max(), "Log record is too large");
+
+  const auto record_size = static_cast<RecordSize>(payload_size);
+  const auto record_checksum = checksum(buffer.data() + payload_offset, payload_size);
+  std::memcpy(buffer.data() + header_offset, &record_size, sizeof(RecordSize));
+  std::memcpy(buffer.data() + header_offset + sizeof(RecordSize), &record_checksum, sizeof(Checksum));
+}
+
+std::optional<LogRecord> LogRecord::deserialize(std::istream& stream) {
+  auto record_size = RecordSize{0};
+  auto record_checksum = Checksum{0};
+  stream.read(reinterpret_cast<char*>(&record_size), sizeof(RecordSize));
+  stream.read(reinterpret_cast<char*>(&record_checksum), sizeof(Checksum));
+  if (!stream) return std::nullopt;
+
+  // The size of a torn record is garbage, so do not allocate more than the stream holds
+  const auto payload_position = stream.tellg();
+  stream.seekg(0, std::ios::end);
+  const auto remaining_size = static_cast<size_t>(stream.tellg() - payload_position);
+  stream.seekg(payload_position);
+  if (record_size > remaining_size) return std::nullopt;
+
+  auto payload = std::vector<char>(record_size);
+  stream.read(payload.data(), record_size);
+  if (!stream || checksum(payload.data(), payload.size()) != record_checksum) return std::nullopt;
+
+  auto reader = PayloadReader{payload};
+  auto record = LogRecord{};
+  record.transaction_id = reader.read<TransactionID>();
+  record.commit_id = reader.read<CommitID>();
+
+  const auto table_count = reader.read<uint32_t>();
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    auto& changes = record.table_changes[reader.read_string()];
+
+    const auto inserted_row_count = reader.read<uint32_t>();
+    changes.inserted_row_ids.reserve(inserted_row_count);
+    changes.inserted_rows.reserve(inserted_row_count);
+    for (auto row_index = uint32_t{0}; row_index < inserted_row_count; ++row_index) {
+      changes.inserted_row_ids.emplace_back(reader.read_row_id());
+
+      auto& row = changes.inserted_rows.emplace_back(reader.read<uint32_t>());
+      for (auto& value : row) {
+        value = reader.read_value();
+      }
+    }
+
+    const auto deleted_row_count = reader.read<uint32_t>();
+    changes.deleted_row_ids.reserve(deleted_row_count);
+    for (auto row_index = uint32_t{0}; row_index < deleted_row_count; ++row_index) {
+      changes.deleted_row_ids.emplace_back(reader.read_row_id());
+    }
+  }
+
+  Assert(reader.at_end(), "Log record is malformed");
+  return record;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <istream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The redo log record of a committed transaction, see Logger. It holds the effects of the transaction's Insert and
+ * Delete operators (an Update is a Delete followed by an Insert) per table: the values of the inserted rows and the
+ * rows that were deleted. Rows are identified by their RowIDs, so a log can only be replayed onto the snapshot that
+ * the database was started from (see Recovery).
+ *
+ * Serialized, a record is framed by its size and a checksum, so that a record that was only partially written before
+ * a crash is recognized as such.
+ */
+struct LogRecord {
+  struct TableChanges {
+    std::vector<RowID> inserted_row_ids;
+    std::vector<std::vector<AllTypeVariant>> inserted_rows;
+    std::vector<RowID> deleted_row_ids;
+  };
+
+  bool empty() const;
+
+  /**
+   * Appends the serialized record to @param buffer
+   */
+  void serialize(std::vector<char>& buffer) const;
+
+  /**
+   * Reads the next record from @param stream. Returns std::nullopt at the end of the stream and if the next record is
+   * incomplete or corrupt.
+   */
+  static std::optional<LogRecord> deserialize(std::istream& stream);
+
+  TransactionID transaction_id{0};
+  CommitID commit_id{0};
+
+  // Ordered by table name, so that records are serialized deterministically
+  std::map<std::string, TableChanges> table_changes;
+};
+
+}  // namespace opossum
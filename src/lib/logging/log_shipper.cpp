@@ -0,0 +1,139 @@
+#include "log_shipper.hpp"
+
+#include <boost/asio/write.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "logger.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LogShipper::ReplicaConnection::ReplicaConnection(boost::asio::io_service& io_service) : socket(io_service) {}
+
+LogShipper::~LogShipper() {
+  if (_is_running) stop();
+}
+
+void LogShipper::start(const uint16_t port) {
+  Assert(!_is_running, "LogShipper is running already");
+  Assert(Logger::get().is_enabled(), "LogShipper needs the Logger to be enabled");
+
+  _shipped_commit_id = TransactionManager::get().last_commit_id();
+  _flusher_shipped_commit_id = _shipped_commit_id;
+
+  _io_service.reset();
+  _work.emplace(_io_service);
+  _acceptor.emplace(_io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port));
+  _accept();
+
+  _io_thread = std::thread{[this]() { _io_service.run(); }};
+  _is_running = true;
+}
+
+void LogShipper::stop() {
+  Assert(_is_running, "LogShipper is not running");
+  _is_running = false;
+
+  _work.reset();
+  _io_service.stop();
+  _io_thread.join();
+
+  _acceptor.reset();
+  _next_replica = nullptr;
+  _replicas.clear();
+  _replica_count = 0;
+}
+
+bool LogShipper::is_running() const { return _is_running; }
+
+uint16_t LogShipper::port() const {
+  Assert(_is_running, "LogShipper is not running");
+  return _acceptor->local_endpoint().port();
+}
+
+size_t LogShipper::replica_count() const { return _replica_count; }
+
+void LogShipper::ship(std::vector<char>&& records, const CommitID shipped_commit_id) {
+  // The flusher ships even if it did not flush anything, so that the transactions without records become visible on
+  // the replicas. Nothing is sent as long as no transaction committed.
+  if (records.empty() && shipped_commit_id <= _flusher_shipped_commit_id) return;
+  _flusher_shipped_commit_id = shipped_commit_id;
+
+  const auto message = _encode_message(records, shipped_commit_id);
+  _io_service.post([this, message, shipped_commit_id]() {
+    _shipped_commit_id = shipped_commit_id;
+    for (const auto& replica : _replicas) {
+      _send(replica, message);
+    }
+  });
+}
+
+std::shared_ptr<const std::vector<char>> LogShipper::_encode_message(const std::vector<char>& records,
+                                                                     const CommitID shipped_commit_id) {
+  const auto header = LogShippingHeader{shipped_commit_id, records.size()};
+
+  auto message = std::make_shared<std::vector<char>>(sizeof(LogShippingHeader) + records.size());
+  std::memcpy(message->data(), &header, sizeof(LogShippingHeader));
+  std::copy(records.begin(), records.end(), message->begin() + sizeof(LogShippingHeader));
+  return message;
+}
+
+void LogShipper::_accept() {
+  _next_replica = std::make_shared<ReplicaConnection>(_io_service);
+  _acceptor->async_accept(_next_replica->socket, [this](const boost::system::error_code& error) {
+    if (error) return;
+    _add_replica(_next_replica);
+    _accept();
+  });
+}
+
+void LogShipper::_add_replica(const std::shared_ptr<ReplicaConnection>& replica) {
+  // Records that are flushed from now on are shipped after this handler, so that the replica gets all of them. It may
+  // get those that are flushed right now twice.
+  const auto flushed_size = Logger::get().flushed_size();
+  auto records = std::vector<char>(flushed_size);
+  auto log_file = std::ifstream{Logger::get().log_file_path(), std::ios::binary};
+  log_file.read(records.data(), static_cast<std::streamsize>(flushed_size));
+  Assert(log_file, "Cannot read log file " + Logger::get().log_file_path());
+
+  _replicas.emplace_back(replica);
+  ++_replica_count;
+  _send(replica, _encode_message(records, _shipped_commit_id));
+}
+
+void LogShipper::_send(const std::shared_ptr<ReplicaConnection>& replica,
+                       const std::shared_ptr<const std::vector<char>>& message) {
+  replica->messages.emplace_back(message);
+  if (replica->messages.size() == 1) _send_next(replica);
+}
+
+void LogShipper::_send_next(const std::shared_ptr<ReplicaConnection>& replica) {
+  boost::asio::async_write(replica->socket, boost::asio::buffer(*replica->messages.front()),
+                           [this, replica](const boost::system::error_code& error, const size_t) {
+                             if (error) {
+                               _remove_replica(replica);
+                               return;
+                             }
+
+                             replica->messages.pop_front();
+                             if (!replica->messages.empty()) _send_next(replica);
+                           });
+}
+
+void LogShipper::_remove_replica(const std::shared_ptr<ReplicaConnection>& replica) {
+  const auto replica_iter = std::find(_replicas.begin(), _replicas.end(), replica);
+  if (replica_iter == _replicas.end()) return;
+
+  _replicas.erase(replica_iter);
+  --_replica_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Precedes the records of each message that the LogShipper sends: The primary committed all transactions up to the
+ * shipped commit id, and the records of these transactions were part of this message or of the ones before.
+ */
+struct LogShippingHeader {
+  uint64_t shipped_commit_id;
+  uint64_t records_size;
+};
+
+/**
+ * The LogShipper streams the redo log of a primary (see Logger) over TCP to read-only replicas (see Replica), which
+ * apply it to their copies of the tables and serve queries on them.
+ *
+ * A replica that connects receives the flushed part of the log file first and then the records that the Logger
+ * flushes from then on, together with the commit id up to which it has received all records. A record may be sent
+ * twice if it was flushed while the replica connected. The replicas skip the records they have applied already.
+ *
+ * The connections are served asynchronously by a thread of their own, so that a slow replica does not delay the
+ * flusher. The messages for a replica are queued until they are sent, so that a replica that does not keep up
+ * consumes memory on the primary.
+ */
+class LogShipper : public Singleton<LogShipper> {
+ public:
+  ~LogShipper() override;
+
+  /**
+   * Listens for replicas on the @param port, or on a free one if it is 0 (see port()). Needs the Logger to be enabled
+   * already, and should be started before transactions commit.
+   */
+  void start(const uint16_t port = 0);
+
+  // Disconnects the replicas
+  void stop();
+
+  bool is_running() const;
+
+  uint16_t port() const;
+
+  // The number of replicas that are connected
+  size_t replica_count() const;
+
+  // Called by the Logger: Sends the flushed @param records to all replicas, together with the @param shipped_commit_id
+  void ship(std::vector<char>&& records, const CommitID shipped_commit_id);
+
+ private:
+  struct ReplicaConnection {
+    explicit ReplicaConnection(boost::asio::io_service& io_service);
+
+    boost::asio::ip::tcp::socket socket;
+    std::deque<std::shared_ptr<const std::vector<char>>> messages;
+  };
+
+  LogShipper() = default;
+
+  friend class Singleton;
+
+  static std::shared_ptr<const std::vector<char>> _encode_message(const std::vector<char>& records,
+                                                                  const CommitID shipped_commit_id);
+
+  // The following run on the _io_thread
+  void _accept();
+  void _add_replica(const std::shared_ptr<ReplicaConnection>& replica);
+  void _send(const std::shared_ptr<ReplicaConnection>& replica,
+             const std::shared_ptr<const std::vector<char>>& message);
+  void _send_next(const std::shared_ptr<ReplicaConnection>& replica);
+  void _remove_replica(const std::shared_ptr<ReplicaConnection>& replica);
+
+  std::atomic_bool _is_running{false};
+
+  boost::asio::io_service _io_service;
+  std::optional<boost::asio::io_service::work> _work;
+  std::optional<boost::asio::ip::tcp::acceptor> _acceptor;
+  std::thread _io_thread;
+
+  std::shared_ptr<ReplicaConnection> _next_replica;
+  std::list<std::shared_ptr<ReplicaConnection>> _replicas;
+  std::atomic<size_t> _replica_count{0};
+
+  // The commit id of the last shipped message, as the _io_thread has seen it, and as the flusher has shipped it
+  CommitID _shipped_commit_id{0};
+  CommitID _flusher_shipped_commit_id{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "log_shipper.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Logger::~Logger() {
+  if (_is_enabled) disable();
+}
+
+void Logger::enable(const std::string& log_file_path, const Durability durability) {
+  Assert(!_is_enabled, "Logger is enabled already");
+
+  _file_descriptor = ::open(log_file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open log file " + log_file_path + ": " + std::strerror(errno));
+
+  // Recovery dropped a torn record at the end, so the file ends with the last flushed record
+  const auto file_size = ::lseek(_file_descriptor, 0, SEEK_END);
+  Assert(file_size >= 0, "Cannot determine the size of log file " + log_file_path + ": " + std::strerror(errno));
+  _flushed_size = static_cast<uint64_t>(file_size);
+
+  _log_file_path = log_file_path;
+  _durability = durability;
+  _stop_flusher = false;
+  _flusher = std::thread{&Logger::_flush_loop, this};
+  _is_enabled = true;
+}
+
+void Logger::disable() {
+  Assert(_is_enabled, "Logger is not enabled");
+  _is_enabled = false;
+
+  {
+    std::lock_guard<std::mutex> lock{_flusher_mutex};
+    _stop_flusher = true;
+  }
+  _new_record_condition.notify_one();
+  _flusher.join();
+
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+bool Logger::is_enabled() const { return _is_enabled; }
+
+Durability Logger::durability() const { return _durability; }
+
+const std::string& Logger::log_file_path() const { return _log_file_path; }
+
+uint64_t Logger::flushed_size() const { return _flushed_size; }
+
+LogSequenceNumber Logger::append(std::vector<char>&& record) {
+  DebugAssert(_is_enabled, "Logger is not enabled");
+
+  const auto log_sequence_number = _next_log_sequence_number++;
+  _buffer.push({log_sequence_number, std::move(record)});
+
+  // The record is added before _flusher_is_waiting is read, while the flusher does the opposite. Thus, either the
+  // flusher sees the record, or we see the waiting flusher (cf. TaskQueue::notify_one()).
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_flusher_is_waiting) {
+    std::lock_guard<std::mutex> lock{_flusher_mutex};
+    _new_record_condition.notify_one();
+  }
+
+  return log_sequence_number;
+}
+
+void Logger::wait_for_flush(const LogSequenceNumber log_sequence_number) {
+  std::unique_lock<std::mutex> lock{_flushed_mutex};
+  _flushed_condition.wait(lock, [&]() { return _flushed_log_sequence_number >= log_sequence_number; });
+}
+
+void Logger::_flush_loop() {
+  while (!_stop_flusher) {
+    if (_flush()) continue;
+
+    std::unique_lock<std::mutex> lock{_flusher_mutex};
+    _flusher_is_waiting = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_buffer.empty() && !_stop_flusher) _new_record_condition.wait_for(lock, FLUSHER_WAIT_TIMEOUT);
+    _flusher_is_waiting = false;
+  }
+
+  // Records appended until the Logger was disabled
+  while (_flush()) {
+  }
+}
+
+bool Logger::_flush() {
+  // Transactions append their records before they become visible, so all records of the transactions up to this commit
+  // id are in the buffer or were taken from it before. Replicas thus know when they have all of them.
+  const auto shipped_commit_id = TransactionManager::get().last_commit_id();
+
+  auto data = std::vector<char>{};
+  auto log_sequence_numbers = std::vector<LogSequenceNumber>{};
+
+  auto entry = std::pair<LogSequenceNumber, std::vector<char>>{};
+  while (_buffer.try_pop(entry)) {
+    log_sequence_numbers.emplace_back(entry.first);
+    data.insert(data.end(), entry.second.begin(), entry.second.end());
+  }
+  if (log_sequence_numbers.empty()) {
+    // Transactions without records advance the commit id, too
+    if (LogShipper::get().is_running()) LogShipper::get().ship({}, shipped_commit_id);
+    return false;
+  }
+
+  auto written_size = size_t{0};
+  while (written_size < data.size()) {
+    const auto result = ::write(_file_descriptor, data.data() + written_size, data.size() - written_size);
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, std::string{"Cannot write to log file: "} + std::strerror(errno));
+    written_size += static_cast<size_t>(result);
+  }
+  Assert(::fdatasync(_file_descriptor) == 0, std::string{"Cannot sync log file: "} + std::strerror(errno));
+  _flushed_size += data.size();
+
+  if (LogShipper::get().is_running()) LogShipper::get().ship(std::move(data), shipped_commit_id);
+
+  {
+    std::lock_guard<std::mutex> lock{_flushed_mutex};
+    _flushed_after_gap.insert(log_sequence_numbers.begin(), log_sequence_numbers.end());
+    while (!_flushed_after_gap.empty() && *_flushed_after_gap.begin() == _flushed_log_sequence_number + 1) {
+      ++_flushed_log_sequence_number;
+      _flushed_after_gap.erase(_flushed_after_gap.begin());
+    }
+  }
+  _flushed_condition.notify_all();
+
+  return true;
+}
+
+}  // namespace opossum
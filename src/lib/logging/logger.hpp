@@ -0,0 +1,113 @@
+#pragma once
+
+#include <tbb/concurrent_queue.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Determines when TransactionContext::commit() returns: Sync waits until the redo log record of the transaction was
+ * flushed to disk. Async returns right away, so that a crash may lose the transactions of the last few milliseconds.
+ */
+enum class Durability { Sync, Async };
+
+/**
+ * The Logger writes the redo log, from which Recovery restores the committed writes after a crash. It is disabled
+ * until enable() is called, e.g., by the server.
+ *
+ * When a transaction commits, it appends the serialized LogRecord of its changes to the log buffer. It does so before
+ * its changes become visible, so that the records of all transactions whose changes it could have seen precede its
+ * own record. Read-only transactions do not write a record and do not wait for the log.
+ *
+ * The log buffer is a lock-free queue. A dedicated flusher thread takes all records from it, writes them to the log
+ * file and syncs the file once for all of them (group commit). The records that are appended while the file is being
+ * synced are flushed together afterwards. If the LogShipper is running, the flusher passes the flushed records on to
+ * it, so that replicas receive them once they are durable.
+ */
+class Logger : public Singleton<Logger> {
+ public:
+  ~Logger() override;
+
+  /**
+   * Opens the log file (appending to it if it exists, see Recovery) and starts the flusher
+   */
+  void enable(const std::string& log_file_path, const Durability durability = Durability::Sync);
+
+  /**
+   * Flushes all records and stops the flusher
+   */
+  void disable();
+
+  bool is_enabled() const;
+
+  Durability durability() const;
+
+  const std::string& log_file_path() const;
+
+  /**
+   * The size of the log file up to the end of the last flushed record. The file may be larger than that while the
+   * flusher writes to it.
+   */
+  uint64_t flushed_size() const;
+
+  /**
+   * Adds a serialized LogRecord to the log buffer
+   */
+  LogSequenceNumber append(std::vector<char>&& record);
+
+  /**
+   * Blocks until the record @param log_sequence_number and all records appended before it were flushed
+   */
+  void wait_for_flush(const LogSequenceNumber log_sequence_number);
+
+ private:
+  // Bounds how long the flusher sleeps if it misses a wakeup
+  static constexpr auto FLUSHER_WAIT_TIMEOUT = std::chrono::milliseconds{10};
+
+  Logger() = default;
+
+  friend class Singleton;
+
+  void _flush_loop();
+
+  // Writes the buffered records to the log file and syncs it. Returns false if the buffer was empty.
+  bool _flush();
+
+  std::atomic_bool _is_enabled{false};
+  Durability _durability{Durability::Sync};
+  std::string _log_file_path;
+  int _file_descriptor{-1};
+  std::atomic<uint64_t> _flushed_size{0};
+
+  tbb::concurrent_queue<std::pair<LogSequenceNumber, std::vector<char>>> _buffer;
+  std::atomic<LogSequenceNumber> _next_log_sequence_number{1};
+
+  std::thread _flusher;
+  std::atomic_bool _stop_flusher{false};
+  std::mutex _flusher_mutex;
+  std::condition_variable _new_record_condition;
+  std::atomic_bool _flusher_is_waiting{false};
+
+  // All records up to this one were flushed. Records are flushed in the order in which they were taken from the
+  // buffer, which may differ slightly from their order of sequence numbers. The flusher thus keeps track of the
+  // flushed records that follow a gap.
+  LogSequenceNumber _flushed_log_sequence_number{0};
+  std::set<LogSequenceNumber> _flushed_after_gap;
+  std::mutex _flushed_mutex;
+  std::condition_variable _flushed_condition;
+};
+
+}  // namespace opossum
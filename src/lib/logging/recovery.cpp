@@ -0,0 +1,167 @@
+#include "recovery.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "log_record.hpp"
+#include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Grows the chunk so that it holds the row, the rows in between are invisible to all transactions
+void grow_chunk(Chunk& chunk, const ChunkOffset chunk_offset) {
+  const auto old_size = chunk.size();
+
+  // Keeps the reservations of later inserts behind the row
+  const auto reservation = chunk.reserve_rows(chunk_offset + 1 - old_size, Chunk::MAX_SIZE);
+  Assert(reservation.first == old_size && reservation.second == chunk_offset + 1 - old_size,
+         "Cannot replay inserts while rows are being inserted");
+
+  chunk.add_reserved_rows(old_size, chunk_offset + 1, [&]() {
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto segment = chunk.get_segment(column_id);
+      resolve_data_type(segment->data_type(), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+        Assert(value_segment, "Cannot replay inserts into encoded segments");
+
+        value_segment->values().resize(chunk_offset + 1);
+        if (value_segment->is_nullable()) value_segment->null_values().resize(chunk_offset + 1);
+      });
+    }
+
+    // Until the row is filled, it is invisible to the transactions that are running concurrently on a replica
+    auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+    mvcc_data->grow_by(chunk_offset + 1 - old_size, MvccData::MAX_COMMIT_ID);
+    for (auto offset = old_size; offset < chunk_offset; ++offset) {
+      mvcc_data->end_cids[offset] = CommitID{0};
+    }
+  });
+}
+
+void replay_insert(Table& table, const RowID& row_id, const std::vector<AllTypeVariant>& row,
+                   const CommitID commit_id) {
+  while (table.chunk_count() <= row_id.chunk_id) {
+    table.append_mutable_chunk();
+  }
+  if (const auto partition_schema = table.partition_schema()) {
+    table.set_chunk_partition_id(row_id.chunk_id, partition_schema->partition_of(row[partition_schema->column_id()]));
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (chunk->size() <= row_id.chunk_offset) grow_chunk(*chunk, row_id.chunk_offset);
+
+  Assert(row.size() == chunk->column_count(), "Logged row does not match the table");
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto segment = chunk->get_segment(column_id);
+    resolve_data_type(segment->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+      Assert(value_segment, "Cannot replay inserts into encoded segments");
+
+      const auto& value = row[column_id];
+      if (variant_is_null(value)) {
+        Assert(value_segment->is_nullable(), "Cannot replay NULL into NOT NULL column");
+        value_segment->values()[row_id.chunk_offset] = ColumnDataType{};
+        value_segment->null_values()[row_id.chunk_offset] = true;
+      } else {
+        value_segment->values()[row_id.chunk_offset] = type_cast_variant<ColumnDataType>(value);
+        if (value_segment->is_nullable()) value_segment->null_values()[row_id.chunk_offset] = false;
+      }
+    });
+  }
+
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  mvcc_data->invalidate_visibility_summary();
+  mvcc_data->tids[row_id.chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
+  mvcc_data->begin_cids[row_id.chunk_offset] = commit_id;
+  mvcc_data->end_cids[row_id.chunk_offset] = MvccData::MAX_COMMIT_ID;
+}
+
+void replay_delete(Table& table, const RowID& row_id, const CommitID commit_id) {
+  Assert(row_id.chunk_id < table.chunk_count(), "Logged delete refers to a row that does not exist");
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  Assert(row_id.chunk_offset < chunk->size(), "Logged delete refers to a row that does not exist");
+
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  mvcc_data->invalidate_visibility_summary();
+  mvcc_data->end_cids[row_id.chunk_offset] = commit_id;
+}
+
+}  // namespace
+
+namespace opossum {
+
+size_t Recovery::recover(const std::string& log_file_path, const CommitID checkpoint_commit_id) {
+  auto transaction_count = size_t{0};
+  auto last_commit_id = std::max(TransactionManager::get().last_commit_id(), checkpoint_commit_id);
+
+  if (filesystem::exists(log_file_path)) {
+    auto log_file = std::ifstream{log_file_path, std::ios::binary};
+    Assert(log_file.is_open(), "Cannot open log file " + log_file_path);
+
+    auto valid_size = std::streamoff{0};
+
+    while (const auto record = LogRecord::deserialize(log_file)) {
+      valid_size = log_file.tellg();
+
+      // The changes of transactions that committed before the checkpoint are part of it already
+      if (record->commit_id <= checkpoint_commit_id) continue;
+
+      replay(*record);
+
+      last_commit_id = std::max(last_commit_id, record->commit_id);
+      ++transaction_count;
+    }
+
+    // Drop the torn record that a crash might have left at the end, so that the Logger appends after the last valid
+    // one
+    log_file.close();
+    if (static_cast<uintmax_t>(valid_size) < filesystem::file_size(log_file_path)) {
+      filesystem::resize_file(log_file_path, static_cast<uintmax_t>(valid_size));
+    }
+  }
+
+  TransactionManager::get()._reset_last_commit_id(last_commit_id);
+
+  return transaction_count;
+}
+
+void Recovery::replay(const LogRecord& record) {
+  for (const auto& [table_name, changes] : record.table_changes) {
+    Assert(StorageManager::get().has_table(table_name), "Logged table " + table_name + " does not exist");
+    const auto table = StorageManager::get().get_table(table_name);
+    Assert(table->has_mvcc() == UseMvcc::Yes, "Logged table " + table_name + " has no MVCC data");
+
+    // Rows that a transaction inserted and deleted again are part of both lists, so the inserts go first
+    for (auto row_index = size_t{0}; row_index < changes.inserted_row_ids.size(); ++row_index) {
+      replay_insert(*table, changes.inserted_row_ids[row_index], changes.inserted_rows[row_index], record.commit_id);
+    }
+
+    for (const auto& row_id : changes.deleted_row_ids) {
+      replay_delete(*table, row_id, record.commit_id);
+    }
+
+    const auto table_statistics = table->table_statistics();
+    if (table_statistics) table_statistics->increase_invalid_row_count(changes.deleted_row_ids.size());
+
+    // Results that the SQLResultCache holds for the table are outdated, as they are for the writes of an Insert
+    table->raise_last_commit_id(record.commit_id);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct LogRecord;
+
+/**
+ * Restores the writes of committed transactions from the redo log (see Logger) after a restart.
+ *
+ * The log refers to rows by their RowIDs, so it has to be replayed onto the same snapshot that the database was
+ * started from before, e.g., the tables that were imported from binary files (see ExportBinary), or a Checkpoint, which
+ * restores the positions of the rows it holds. The log has to be started anew whenever a snapshot of another kind is
+ * taken. Inserted rows are written to the positions that they had before, and rows in between that were not committed
+ * are made invisible. Deleted rows are invalidated. The records of transactions that committed before the checkpoint
+ * are skipped.
+ *
+ * Recovery must run before any transaction starts, and before the Logger is enabled, as it truncates a record that was
+ * only partially written when the database crashed.
+ */
+class Recovery {
+ public:
+  /**
+   * Replays the log file onto the tables in the StorageManager and sets the last commit id of the TransactionManager
+   * to the highest commit id in the log or @param checkpoint_commit_id, whichever is higher. Only the transactions
+   * that committed after @param checkpoint_commit_id are replayed. A missing log file is treated as an empty one.
+   *
+   * @returns the number of transactions that were replayed
+   */
+  static size_t recover(const std::string& log_file_path, const CommitID checkpoint_commit_id = CommitID{0});
+
+  /**
+   * Applies the changes of a single @param record to the tables in the StorageManager. The inserted rows only become
+   * visible once the last commit id of the TransactionManager reaches the commit id of the record. Replicas use this
+   * to apply the log of their primary while they are queried (see Replica).
+   */
+  static void replay(const LogRecord& record);
+};
+
+}  // namespace opossum
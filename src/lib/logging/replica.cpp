@@ -0,0 +1,129 @@
+#include "replica.hpp"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "concurrency/transaction_manager.hpp"
+#include "recovery.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Replica::~Replica() {
+  if (_is_running) stop();
+}
+
+void Replica::start(const std::string& host, const uint16_t port) {
+  Assert(!_is_running, "Replica is running already");
+
+  _applied_commit_id = TransactionManager::get().last_commit_id();
+  _pending_records.clear();
+
+  _io_service.reset();
+  _socket.emplace(_io_service);
+  auto resolver = boost::asio::ip::tcp::resolver{_io_service};
+  boost::asio::connect(*_socket, resolver.resolve({host, std::to_string(port)}));
+
+  _is_connected = true;
+  _receive_header();
+
+  _io_thread = std::thread{[this]() { _io_service.run(); }};
+  _is_running = true;
+}
+
+void Replica::stop() {
+  Assert(_is_running, "Replica is not running");
+  _is_running = false;
+
+  _io_service.stop();
+  _io_thread.join();
+  _socket.reset();
+
+  _disconnect();
+}
+
+bool Replica::is_running() const { return _is_running; }
+
+bool Replica::is_connected() const { return _is_connected; }
+
+CommitID Replica::applied_commit_id() const { return _applied_commit_id; }
+
+bool Replica::wait_for_commit_id(const CommitID commit_id) {
+  std::unique_lock<std::mutex> lock{_applied_mutex};
+  _applied_condition.wait(lock, [&]() { return _applied_commit_id >= commit_id || !_is_connected; });
+  return _applied_commit_id >= commit_id;
+}
+
+void Replica::_receive_header() {
+  boost::asio::async_read(*_socket, boost::asio::buffer(&_header, sizeof(LogShippingHeader)),
+                          [this](const boost::system::error_code& error, const size_t) {
+                            if (error) {
+                              _disconnect();
+                              return;
+                            }
+
+                            _records.resize(_header.records_size);
+                            _receive_records();
+                          });
+}
+
+void Replica::_receive_records() {
+  boost::asio::async_read(*_socket, boost::asio::buffer(_records),
+                          [this](const boost::system::error_code& error, const size_t) {
+                            if (error) {
+                              _disconnect();
+                              return;
+                            }
+
+                            _apply_records();
+                            _receive_header();
+                          });
+}
+
+void Replica::_apply_records() {
+  auto stream = std::istringstream{std::string{_records.begin(), _records.end()}};
+  auto valid_size = std::streamoff{0};
+
+  while (auto record = LogRecord::deserialize(stream)) {
+    valid_size = stream.tellg();
+
+    // Records that were part of the snapshot or were received twice
+    if (record->commit_id <= _applied_commit_id) continue;
+    _pending_records.emplace(record->commit_id, std::move(*record));
+  }
+  Assert(static_cast<size_t>(valid_size) == _records.size(), "Received a corrupt log record");
+
+  const auto shipped_commit_id = static_cast<CommitID>(_header.shipped_commit_id);
+  while (!_pending_records.empty() && _pending_records.begin()->first <= shipped_commit_id) {
+    Recovery::replay(_pending_records.begin()->second);
+    _pending_records.erase(_pending_records.begin());
+  }
+
+  if (shipped_commit_id <= _applied_commit_id) return;
+
+  // New transactions see the applied rows from now on
+  TransactionManager::get()._reset_last_commit_id(shipped_commit_id);
+  {
+    std::lock_guard<std::mutex> lock{_applied_mutex};
+    _applied_commit_id = shipped_commit_id;
+  }
+  _applied_condition.notify_all();
+}
+
+void Replica::_disconnect() {
+  if (_is_connected && _is_running) std::cerr << "Replica lost the connection to its primary" << std::endl;
+
+  {
+    std::lock_guard<std::mutex> lock{_applied_mutex};
+    _is_connected = false;
+  }
+  _applied_condition.notify_all();
+}
+
+}  // namespace opossum
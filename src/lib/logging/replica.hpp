@@ -0,0 +1,91 @@
+#pragma once
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "log_record.hpp"
+#include "log_shipper.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * A read-only replica applies the redo log that the LogShipper of its primary streams to it, so that queries on the
+ * replica read the tables as the primary committed them. Read queries are thus spread across several machines.
+ *
+ * The replica starts from the same snapshot that the primary started from (see Recovery), e.g., a copy of the
+ * primary's latest checkpoint, as the log refers to rows by their RowIDs. It skips the records of the transactions
+ * that were part of the snapshot. The other records are applied in the order of their commit ids, while queries run.
+ * Once all transactions up to the commit id that the primary shipped with them were applied, it becomes the last
+ * commit id of the TransactionManager, so that the transactions that begin afterwards see their rows. Each query thus
+ * reads a consistent snapshot of the primary.
+ *
+ * Statements that modify tables are rejected while the replica runs (see SQLPipelineStatement). Nothing else may
+ * change the positions of the rows, so the MvccGarbageCollector must not run on replicas, and neither may the
+ * ChunkCompressionManager or the IndexTuner, as rows may still be applied to any chunk. If the connection to the
+ * primary is lost, the replica keeps serving the snapshot it applied last.
+ */
+class Replica : public Singleton<Replica> {
+ public:
+  ~Replica() override;
+
+  /**
+   * Connects to the LogShipper of the primary at @param host and @param port and applies its log in the background.
+   * The tables of the snapshot must be in the StorageManager and the last commit id of the TransactionManager must be
+   * that of the snapshot.
+   */
+  void start(const std::string& host, const uint16_t port);
+
+  void stop();
+
+  bool is_running() const;
+
+  bool is_connected() const;
+
+  // New transactions see the writes of all transactions of the primary up to this commit id
+  CommitID applied_commit_id() const;
+
+  // Returns once the replica applied the transactions up to @param commit_id, or false if it lost the connection first
+  bool wait_for_commit_id(const CommitID commit_id);
+
+ private:
+  Replica() = default;
+
+  friend class Singleton;
+
+  // Run on the _io_thread
+  void _receive_header();
+  void _receive_records();
+  void _apply_records();
+  void _disconnect();
+
+  std::atomic_bool _is_running{false};
+  std::atomic_bool _is_connected{false};
+
+  boost::asio::io_service _io_service;
+  std::optional<boost::asio::ip::tcp::socket> _socket;
+  std::thread _io_thread;
+
+  LogShippingHeader _header{};
+  std::vector<char> _records;
+
+  // The records of the transactions that committed after the applied ones, by their commit ids
+  std::map<CommitID, LogRecord> _pending_records;
+
+  std::atomic<CommitID> _applied_commit_id{0};
+  std::mutex _applied_mutex;
+  std::condition_variable _applied_condition;
+};
+
+}  // namespace opossum
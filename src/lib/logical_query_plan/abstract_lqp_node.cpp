@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
+
+#include "boost/functional/hash.hpp"
 
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
@@ -49,6 +52,28 @@ void collect_lqps_in_plan(const AbstractLQPNode& lqp, std::unordered_set<std::sh
   if (lqp.right_input()) collect_lqps_in_plan(*lqp.right_input(), lqps);
 }
 
+/**
+ * Utility for AbstractLQPNode::hash()
+ * The hashes of expressions include the addresses of the nodes their columns stem from, which differ between equal
+ * LQPs. Thus, only the types of the expressions and the literals are hashed.
+ */
+void hash_lqp(const AbstractLQPNode& lqp, size_t& hash, std::unordered_set<const AbstractLQPNode*>& visited_nodes) {
+  if (!visited_nodes.emplace(&lqp).second) return;
+
+  boost::hash_combine(hash, static_cast<size_t>(lqp.type));
+  for (const auto& node_expression : lqp.node_expressions) {
+    visit_expression(node_expression, [&](const auto& sub_expression) {
+      boost::hash_combine(hash, static_cast<size_t>(sub_expression->type));
+      if (sub_expression->type == ExpressionType::Value) boost::hash_combine(hash, sub_expression->hash());
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  boost::hash_combine(hash, lqp.input_count());
+  if (lqp.left_input()) hash_lqp(*lqp.left_input(), hash, visited_nodes);
+  if (lqp.right_input()) hash_lqp(*lqp.right_input(), hash, visited_nodes);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -247,6 +272,13 @@ bool AbstractLQPNode::operator==(const AbstractLQPNode& rhs) const {
 
 bool AbstractLQPNode::operator!=(const AbstractLQPNode& rhs) const { return !operator==(rhs); }
 
+size_t AbstractLQPNode::hash() const {
+  auto hash = size_t{0};
+  auto visited_nodes = std::unordered_set<const AbstractLQPNode*>{};
+  hash_lqp(*this, hash, visited_nodes);
+  return hash;
+}
+
 void AbstractLQPNode::_print_impl(std::ostream& out) const {
   const auto get_inputs_fn = [](const auto& node) {
     std::vector<std::shared_ptr<const AbstractLQPNode>> inputs;
@@ -22,6 +22,7 @@ enum class LQPNodeType {
   DropView,
   DropTable,
   DummyTable,
+  Exchange,
   Insert,
   Join,
   Limit,
@@ -164,6 +165,12 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   bool operator==(const AbstractLQPNode& rhs) const;
   bool operator!=(const AbstractLQPNode& rhs) const;
 
+  /**
+   * Hashes the structure of the LQP, i.e., the types of its nodes and of their expressions, and its literals. Equal
+   * LQPs (see operator==) have equal hashes, even if their columns stem from different (but equal) nodes.
+   */
+  size_t hash() const;
+
   const LQPNodeType type;
 
   /**
@@ -198,4 +205,21 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   std::array<std::shared_ptr<AbstractLQPNode>, 2> _inputs;
 };
 
+// Wrapper around lqp->hash(), to enable hash based containers containing std::shared_ptr<AbstractLQPNode>
+struct LQPNodeSharedPtrHash final {
+  size_t operator()(const std::shared_ptr<AbstractLQPNode>& lqp) const { return lqp->hash(); }
+};
+
+// Wrapper around AbstractLQPNode::operator==(), to enable hash based containers containing
+// std::shared_ptr<AbstractLQPNode>
+struct LQPNodeSharedPtrEqual final {
+  bool operator()(const std::shared_ptr<AbstractLQPNode>& lqp_a, const std::shared_ptr<AbstractLQPNode>& lqp_b) const {
+    return *lqp_a == *lqp_b;
+  }
+};
+
+template <typename Value>
+using LQPNodeUnorderedMap =
+    std::unordered_map<std::shared_ptr<AbstractLQPNode>, Value, LQPNodeSharedPtrHash, LQPNodeSharedPtrEqual>;
+
 }  // namespace opossum
@@ -0,0 +1,40 @@
+#include "exchange_node.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ExchangeNode::ExchangeNode(const std::shared_ptr<AbstractExpression>& partition_expression,
+                           const PartitionID partition_count)
+    : AbstractLQPNode(LQPNodeType::Exchange, {partition_expression}), partition_count(partition_count) {
+  Assert(partition_count > 0, "Exchange needs at least one partition");
+}
+
+std::string ExchangeNode::description() const {
+  std::stringstream stream;
+  stream << "[Exchange] Hash(" << partition_expression()->as_column_name() << ") " << partition_count
+         << " partitions";
+  return stream.str();
+}
+
+std::shared_ptr<AbstractExpression> ExchangeNode::partition_expression() const { return node_expressions[0]; }
+
+std::shared_ptr<AbstractLQPNode> ExchangeNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  return ExchangeNode::make(expression_copy_and_adapt_to_different_lqp(*partition_expression(), node_mapping),
+                            partition_count);
+}
+
+bool ExchangeNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& exchange_node = static_cast<const ExchangeNode&>(rhs);
+  return expression_equal_to_expression_in_different_lqp(*partition_expression(),
+                                                         *exchange_node.partition_expression(), node_mapping) &&
+         partition_count == exchange_node.partition_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents shuffling the rows of its input into hash partitions by the value of the
+ * partition_expression, which the Exchange operator executes (see ExchangePlacementRule). Its output is partitioned
+ * like a stored table that is hash-partitioned by the same column into partition_count partitions (see
+ * PartitionSchema), so that JoinHash joins it with such tables partition by partition.
+ */
+class ExchangeNode : public EnableMakeForLQPNode<ExchangeNode>, public AbstractLQPNode {
+ public:
+  ExchangeNode(const std::shared_ptr<AbstractExpression>& partition_expression, const PartitionID partition_count);
+
+  std::string description() const override;
+
+  std::shared_ptr<AbstractExpression> partition_expression() const;
+
+  const PartitionID partition_count;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -11,10 +11,12 @@
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
@@ -22,9 +24,11 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
@@ -93,9 +97,19 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   bool use_validate = false;
   bool validate_after_filter = false;
 
+  // The probe side of a single join can be part of the operator chain. Its right input is the input of the chain,
+  // while its left input is hashed before the chain is executed.
+  auto join_node = std::shared_ptr<JoinNode>{};
+
   // Traverse query tree until a non-jittable nodes is found in each branch
   _visit(node, [&](auto& current_node) {
     const auto is_root_node = current_node == node;
+    if (!join_node && _join_node_is_jittable(current_node)) {
+      join_node = std::static_pointer_cast<JoinNode>(current_node);
+      ++jittable_node_count;
+      input_nodes.insert(join_node->right_input());
+      return false;
+    }
     if (_node_is_jittable(current_node, is_root_node)) {
       use_validate |= current_node->type == LQPNodeType::Validate;
       validate_after_filter |= use_validate && current_node->type == LQPNodeType::Predicate;
@@ -112,34 +126,62 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   //   - Always JIT AggregateNodes, as the JitAggregate is significantly faster than the Aggregate operator
   //   - Otherwise, JIT if there are two or more jittable nodes
   if (input_nodes.size() != 1 || jittable_node_count < 1) return nullptr;
-  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Validate)) {
+  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Validate ||
+                                   node->type == LQPNodeType::Join)) {
     return nullptr;
   }
 
+  // The JitValidate does not support the output of joins, which references multiple tables
+  if (join_node && use_validate) return nullptr;
+
   // The input_node is not being integrated into the operator chain, but instead serves as the input to the JitOperators
   const auto input_node = *input_nodes.begin();
+  const auto build_node = join_node ? join_node->left_input() : nullptr;
 
-  const auto jit_operator = std::make_shared<JitOperatorWrapper>(translate_node(input_node));
+  const auto jit_operator = std::make_shared<JitOperatorWrapper>(
+      translate_node(input_node), JitExecutionMode::CompileAsync, std::vector<std::shared_ptr<AbstractJittable>>{},
+      build_node ? translate_node(build_node) : nullptr);
   const auto read_tuples = std::make_shared<JitReadTuples>(use_validate);
   jit_operator->add_jit_operator(read_tuples);
 
+  auto hash_join_probe = std::shared_ptr<JitHashJoinProbe>{};
+  if (join_node) {
+    const auto join_predicate =
+        OperatorJoinPredicate::from_expression(*join_node->join_predicate(), *build_node, *input_node);
+    if (!join_predicate) return nullptr;
+
+    const auto& probe_expression = input_node->column_expressions().at(join_predicate->column_ids.second);
+    const auto probe_value = read_tuples->add_input_column(
+        probe_expression->data_type(), probe_expression->is_nullable(), join_predicate->column_ids.second);
+    hash_join_probe = std::make_shared<JitHashJoinProbe>(probe_value, join_predicate->column_ids.first);
+    jit_operator->add_jit_operator(hash_join_probe);
+  }
+
+  // The bottom node of the subplan that becomes the operator chain
+  const auto chain_bottom_node = join_node ? std::static_pointer_cast<AbstractLQPNode>(join_node) : input_node;
+
+  // Translates an expression on the output of the bottom node or a node above it
+  const auto translate_expression = [&](const AbstractExpression& expression) {
+    return _try_translate_expression_to_jit_expression(expression, *read_tuples, input_node, build_node,
+                                                       hash_join_probe);
+  };
+
   // "filter_node". The root node of the subplan computed by a JitFilter.
   auto filter_node = node;
-  while (filter_node != input_node && filter_node->type != LQPNodeType::Predicate &&
+  while (filter_node != chain_bottom_node && filter_node->type != LQPNodeType::Predicate &&
          filter_node->type != LQPNodeType::Union) {
     filter_node = filter_node->left_input();
   }
 
   if (use_validate && !validate_after_filter) jit_operator->add_jit_operator(std::make_shared<JitValidate>());
 
-  // If we can reach the input node without encountering a UnionNode or PredicateNode,
+  // If we can reach the bottom node without encountering a UnionNode or PredicateNode,
   // there is no need to filter any tuples
-  if (filter_node != input_node) {
+  if (filter_node != chain_bottom_node) {
     const auto boolean_expression = lqp_subplan_to_boolean_expression(filter_node);
     if (!boolean_expression) return nullptr;
 
-    const auto jit_boolean_expression =
-        _try_translate_expression_to_jit_expression(*boolean_expression, *read_tuples, input_node);
+    const auto jit_boolean_expression = translate_expression(*boolean_expression);
     if (!jit_boolean_expression) return nullptr;
 
     // make sure that the expression gets computed ...
@@ -161,8 +203,7 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     for (auto expression_idx = size_t{0}; expression_idx < aggregate_node->aggregate_expressions_begin_idx;
          ++expression_idx) {
       const auto& groupby_expression = aggregate_node->node_expressions[expression_idx];
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*groupby_expression, *read_tuples, input_node);
+      const auto jit_expression = translate_expression(*groupby_expression);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each computed groupby column ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -178,8 +219,7 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
       const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
       DebugAssert(aggregate_expression, "Expression is not a function.");
 
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*aggregate_expression->arguments[0], *read_tuples, input_node);
+      const auto jit_expression = translate_expression(*aggregate_expression->arguments[0]);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each aggregate expression on a computed value ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -195,8 +235,7 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     // Add a compute operator for each computed output column (i.e., a column that is not from a stored table).
     auto write_table = std::make_shared<JitWriteTuples>();
     for (const auto& column_expression : node->column_expressions()) {
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*column_expression, *read_tuples, input_node);
+      const auto jit_expression = translate_expression(*column_expression);
       if (!jit_expression) return nullptr;
       // If the JitExpression is of type JitExpressionType::Column, there is no need to add a compute node, since it
       // would not compute anything anyway
@@ -214,7 +253,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
 std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expression_to_jit_expression(
     const AbstractExpression& expression, JitReadTuples& jit_source,
-    const std::shared_ptr<AbstractLQPNode>& input_node) const {
+    const std::shared_ptr<AbstractLQPNode>& input_node, const std::shared_ptr<AbstractLQPNode>& build_node,
+    const std::shared_ptr<JitHashJoinProbe>& hash_join_probe) const {
   const auto input_node_column_id = input_node->find_column_id(expression);
   if (input_node_column_id) {
     const auto tuple_value =
@@ -222,6 +262,23 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     return std::make_shared<JitExpression>(tuple_value);
   }
 
+  // Columns of the build side of a join are copied to the runtime tuple by the JitHashJoinProbe
+  if (build_node) {
+    if (const auto build_node_column_id = build_node->find_column_id(expression)) {
+      // Only request a slot in the runtime tuple if the column was not added before
+      if (const auto tuple_value = hash_join_probe->find_build_column(*build_node_column_id)) {
+        return std::make_shared<JitExpression>(*tuple_value);
+      }
+      const auto tuple_value = hash_join_probe->add_build_column(
+          *build_node_column_id, expression.data_type(), expression.is_nullable(), jit_source.add_temporary_value());
+      return std::make_shared<JitExpression>(tuple_value);
+    }
+  }
+
+  if (const auto input_predicate = _try_translate_predicate_to_input_predicate(expression, jit_source, input_node)) {
+    return input_predicate;
+  }
+
   std::shared_ptr<const JitExpression> left, right;
   switch (expression.type) {
     case ExpressionType::Value: {
@@ -239,7 +296,8 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     case ExpressionType::Logical: {
       std::vector<std::shared_ptr<const JitExpression>> jit_expression_arguments;
       for (const auto& argument : expression.arguments) {
-        const auto jit_expression = _try_translate_expression_to_jit_expression(*argument, jit_source, input_node);
+        const auto jit_expression =
+            _try_translate_expression_to_jit_expression(*argument, jit_source, input_node, build_node, hash_join_probe);
         if (!jit_expression) return nullptr;
         jit_expression_arguments.emplace_back(jit_expression);
       }
@@ -278,10 +336,59 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
   }
 }
 
+std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_predicate_to_input_predicate(
+    const AbstractExpression& expression, JitReadTuples& jit_source,
+    const std::shared_ptr<AbstractLQPNode>& input_node) const {
+  const auto* predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&expression);
+  if (!predicate_expression) return nullptr;
+
+  auto predicate_condition = predicate_expression->predicate_condition;
+  if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+      predicate_condition != PredicateCondition::LessThan &&
+      predicate_condition != PredicateCondition::LessThanEquals &&
+      predicate_condition != PredicateCondition::GreaterThan &&
+      predicate_condition != PredicateCondition::GreaterThanEquals) {
+    return nullptr;
+  }
+
+  // Bring the predicate into the form "column <condition> value"
+  auto column_expression = predicate_expression->left_operand();
+  auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate_expression->right_operand());
+  if (!value_expression) {
+    column_expression = predicate_expression->right_operand();
+    value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate_expression->left_operand());
+    predicate_condition = flip_predicate_condition(predicate_condition);
+  }
+  if (!value_expression || variant_is_null(value_expression->value)) return nullptr;
+
+  // The value is not cast to the data type of the column, as the JitExpressions would compare both without a cast
+  const auto column_id = input_node->find_column_id(*column_expression);
+  if (!column_id || column_expression->data_type() != value_expression->data_type()) return nullptr;
+
+  const auto tuple_value = jit_source.add_input_predicate(*column_id, column_expression->is_nullable(),
+                                                          predicate_condition, value_expression->value);
+  return std::make_shared<JitExpression>(tuple_value);
+}
+
+bool JitAwareLQPTranslator::_join_node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+  if (!join_node || join_node->join_mode != JoinMode::Inner) return false;
+
+  const auto join_predicate = OperatorJoinPredicate::from_expression(
+      *join_node->join_predicate(), *join_node->left_input(), *join_node->right_input());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+  // The JitHashJoinProbe looks up the probe values without casting them
+  const auto& left_expression = join_node->left_input()->column_expressions().at(join_predicate->column_ids.first);
+  const auto& right_expression = join_node->right_input()->column_expressions().at(join_predicate->column_ids.second);
+  return left_expression->data_type() == right_expression->data_type();
+}
+
 bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node,
                                               const bool allow_aggregate_node) const {
   if (node->type == LQPNodeType::Aggregate) {
-    // We do not support the count distinct function yet and thus need to check all aggregate expressions.
+    // We do not support the (approximate) count distinct functions yet and thus need to check all aggregate
+    // expressions.
     auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
     const auto& expressions = aggregate_node->node_expressions;
     auto has_unsupported_aggregate = std::any_of(
@@ -291,6 +398,7 @@ bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPN
           // Right now, the JIT doesn't support CountDistinct and Count(*) (which can be recognized by an empty
           // argument list)
           return aggregate_expression->aggregate_function == AggregateFunction::CountDistinct ||
+                 aggregate_expression->aggregate_function == AggregateFunction::ApproxCountDistinct ||
                  aggregate_expression->arguments.empty();
         });
     return allow_aggregate_node && !has_unsupported_aggregate;
@@ -9,6 +9,8 @@
 
 namespace opossum {
 
+class JitHashJoinProbe;
+
 /* This class can be used as a drop-in specialization for the LQPTranslator.
  * The JitAwareLQPTranslator will try to translate multiple AbstractLQPNodes into a single JitOperatorWrapper, whenever
  * that is possible and seems beneficial. Otherwise, it will fall back to the LQPTranslator.
@@ -36,6 +38,9 @@ namespace opossum {
  *    can in turn reference a LQPExpression in a ProjectionNode) is encountered, it is converted to an JitExpression
  *    by a helper method first. We then add a JitCompute operator to our chain and use its result value instead of the
  *    original non-primitive value.
+ *    An inner equi join below the other jittable nodes is translated to a JitHashJoinProbe: Its right input becomes the
+ *    input node of the chain, and its left input is translated separately and hashed before the chain is executed.
+ *    Columns of the left input are provided by the JitHashJoinProbe instead of the JitReadTuples operator.
  */
 class JitAwareLQPTranslator final : public LQPTranslator {
  public:
@@ -45,10 +50,23 @@ class JitAwareLQPTranslator final : public LQPTranslator {
   std::shared_ptr<JitOperatorWrapper> _try_translate_sub_plan_to_jit_operators(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Columns of the @param build_node are provided by the @param hash_join_probe, if the operator chain contains one
   std::shared_ptr<const JitExpression> _try_translate_expression_to_jit_expression(
+      const AbstractExpression& expression, JitReadTuples& jit_source,
+      const std::shared_ptr<AbstractLQPNode>& input_node, const std::shared_ptr<AbstractLQPNode>& build_node = nullptr,
+      const std::shared_ptr<JitHashJoinProbe>& hash_join_probe = nullptr) const;
+
+  // Translates a comparison of a column of the @param input_node with a literal of the same data type to an input
+  // predicate of the JitReadTuples, which is evaluated on the ValueIDs of dictionary segments. Returns nullptr for all
+  // other expressions.
+  std::shared_ptr<const JitExpression> _try_translate_predicate_to_input_predicate(
       const AbstractExpression& expression, JitReadTuples& jit_source,
       const std::shared_ptr<AbstractLQPNode>& input_node) const;
 
+  // Returns whether a JoinNode can be translated to a JitHashJoinProbe, i.e., whether it is an inner equi join on two
+  // columns of the same data type.
+  bool _join_node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Returns whether an LQP node with its current configuration can be part of an operator pipeline.
   bool _node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node, const bool allow_aggregate_node) const;
 
@@ -1,5 +1,6 @@
 #include "join_node.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -13,7 +14,9 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "operators/operator_join_predicate.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -78,11 +81,30 @@ std::shared_ptr<TableStatistics> JoinNode::derive_statistics_from(
         OperatorJoinPredicate::from_expression(*join_predicate(), *left_input, *right_input);
 
     // TODO(anybody) (Complex) predicate we can't build statistics for
-    if (!operator_join_predicate) return cross_join_statistics;
+    if (!operator_join_predicate) return CardinalityFeedback::get().correct(*this, cross_join_statistics);
 
-    return std::make_shared<TableStatistics>(left_input->get_statistics()->estimate_predicated_join(
+    auto join_statistics = std::make_shared<TableStatistics>(left_input->get_statistics()->estimate_predicated_join(
         *right_input->get_statistics(), join_mode, operator_join_predicate->column_ids,
         operator_join_predicate->predicate_condition));
+
+    // If the join column of one side is unique, each row of the other side finds at most one join partner
+    if (join_mode == JoinMode::Inner && operator_join_predicate->predicate_condition == PredicateCondition::Equals) {
+      const auto& [left_column_id, right_column_id] = operator_join_predicate->column_ids;
+      auto max_row_count = join_statistics->row_count();
+      if (lqp_expressions_are_unique(left_input, {left_input->column_expressions()[left_column_id]})) {
+        max_row_count = std::min(max_row_count, right_input->get_statistics()->row_count());
+      }
+      if (lqp_expressions_are_unique(right_input, {right_input->column_expressions()[right_column_id]})) {
+        max_row_count = std::min(max_row_count, left_input->get_statistics()->row_count());
+      }
+
+      if (max_row_count < join_statistics->row_count()) {
+        join_statistics = std::make_shared<TableStatistics>(join_statistics->table_type(), max_row_count,
+                                                            join_statistics->column_statistics());
+      }
+    }
+
+    return CardinalityFeedback::get().correct(*this, join_statistics);
   }
 }
 
@@ -4,8 +4,6 @@
 
 #include "abstract_lqp_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
-#include "storage/storage_manager.hpp"
-#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -27,8 +25,7 @@ std::ostream& operator<<(std::ostream& os, const LQPColumnReference& column_refe
   Assert(original_node, "OriginalNode has expired");
 
   const auto stored_table_node = std::static_pointer_cast<const StoredTableNode>(column_reference.original_node());
-  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
-  os << table->column_name(column_reference.original_column_id());
+  os << stored_table_node->column_definitions().at(column_reference.original_column_id()).name;
 
   return os;
 }
@@ -1,7 +1,9 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -11,18 +13,22 @@
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "delete_node.hpp"
 #include "drop_table_node.hpp"
 #include "drop_view_node.hpp"
 #include "dummy_table_node.hpp"
+#include "exchange_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/between_expression.hpp"
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/is_null_expression.hpp"
 #include "expression/list_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_select_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
@@ -33,10 +39,16 @@
 #include "operators/aggregate.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
+#include "operators/exchange.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_ie.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -46,6 +58,7 @@
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
+#include "operators/multi_column_sort.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/product.hpp"
@@ -53,23 +66,32 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
+#include "scheduler/topology.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
+#include "utils/plugin_manager.hpp"
 #include "validate_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator() : LQPTranslator(std::make_shared<CostModelPhysical>()) {}
+
+LQPTranslator::LQPTranslator(const std::shared_ptr<const CostModelPhysical>& cost_model, const bool use_adaptive_joins)
+    : _cost_model(cost_model), _use_adaptive_joins(use_adaptive_joins) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -85,7 +107,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
    *          |
    *     table_int_float2
    *
-   * would result in multiple operators created from predicate_c and thus in performance drops
+   * would result in multiple operators created from predicate_c and thus in performance drops.
+   *
+   * Subplans that are not the same nodes, but equal (see AbstractLQPNode::operator==), share their operator as well,
+   * e.g., the scans of a table with the same predicates on both sides of a self-join. The result of a shared operator
+   * is computed once and read by each of its consumers.
    */
 
   const auto operator_iter = _operator_by_lqp_node.find(node);
@@ -93,13 +119,56 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
     return operator_iter->second;
   }
 
+  const auto is_shareable = _is_shareable(*node);
+  if (is_shareable) {
+    const auto equal_operator_iter = _operator_by_equal_lqp.find(node);
+    if (equal_operator_iter != _operator_by_equal_lqp.end()) {
+      _operator_by_lqp_node.emplace(node, equal_operator_iter->second);
+      return equal_operator_iter->second;
+    }
+  }
+
   const auto pqp = _translate_by_node_type(node->type, node);
+
+  // An operator that was created for another node before (e.g., for the input of the node) keeps that node
+  if (!pqp->lqp_node) pqp->lqp_node = node;
+
   _operator_by_lqp_node.emplace(node, pqp);
+  if (is_shareable) _operator_by_equal_lqp.emplace(node, pqp);
   return pqp;
 }
 
+bool LQPTranslator::_is_shareable(const AbstractLQPNode& node) {
+  // Operators that modify tables or the catalog must be executed for each of their nodes
+  switch (node.type) {
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Alias:
+    case LQPNodeType::Exchange:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+bool LQPTranslator::_is_translated(const std::shared_ptr<AbstractLQPNode>& node) const {
+  return _operator_by_lqp_node.count(node) || (_is_shareable(*node) && _operator_by_equal_lqp.count(node));
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     LQPNodeType type, const std::shared_ptr<AbstractLQPNode>& node) const {
+  for (const auto& lqp_translator_override : PluginManager::get().lqp_translator_overrides(type)) {
+    if (auto pqp = lqp_translator_override(node, *this)) return pqp;
+  }
+
   switch (type) {
     // clang-format off
     case LQPNodeType::Alias:              return _translate_alias_node(node);
@@ -116,6 +185,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
+    case LQPNodeType::Exchange:           return _translate_exchange_node(node);
 
       // Maintenance operators
     case LQPNodeType::ShowTables:         return _translate_show_tables_node(node);
@@ -137,25 +207,176 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
   const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
   const auto get_table = std::make_shared<GetTable>(stored_table_node->table_name);
   get_table->set_excluded_chunk_ids(stored_table_node->excluded_chunk_ids());
+  get_table->set_table_sample(stored_table_node->table_sample());
   return get_table;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_node = node->left_input();
-  const auto input_operator = translate_node(input_node);
   const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
 
+  if (const auto secondary_predicate = _join_ie_secondary_predicate(predicate_node)) {
+    const auto join_node = std::static_pointer_cast<JoinNode>(node->left_input());
+    const auto join_predicate = OperatorJoinPredicate::from_expression(
+        *join_node->join_predicate(), *join_node->left_input(), *join_node->right_input());
+    return std::make_shared<JoinIE>(translate_node(join_node->left_input()), translate_node(join_node->right_input()),
+                                    JoinMode::Inner, join_predicate->column_ids, join_predicate->predicate_condition,
+                                    secondary_predicate->column_ids, secondary_predicate->predicate_condition);
+  }
+
+  const auto secondary_predicates = _join_hash_secondary_predicates(predicate_node);
+  if (!secondary_predicates.empty()) {
+    auto input_node = node->left_input();
+    while (input_node->type == LQPNodeType::Predicate) input_node = input_node->left_input();
+    const auto join_node = std::static_pointer_cast<JoinNode>(input_node);
+    const auto join_predicate = OperatorJoinPredicate::from_expression(
+        *join_node->join_predicate(), *join_node->left_input(), *join_node->right_input());
+
+    auto secondary_column_ids = std::vector<ColumnIDPair>{};
+    for (const auto& secondary_predicate : secondary_predicates) {
+      secondary_column_ids.emplace_back(secondary_predicate.column_ids);
+    }
+    return std::make_shared<JoinHash>(translate_node(join_node->left_input()),
+                                      translate_node(join_node->right_input()), JoinMode::Inner,
+                                      join_predicate->column_ids, PredicateCondition::Equals, std::nullopt,
+                                      secondary_column_ids);
+  }
+
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
-      return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
+      return _translate_predicate_nodes_to_table_scan(predicate_node);
     case ScanType::IndexScan:
-      return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
+      return _translate_predicate_node_to_index_scan(predicate_node, translate_node(node->left_input()));
   }
 
   Fail("GCC thinks this is reachable");
 }
 
+std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_nodes_to_table_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * A chain of PredicateNodes, as it is created for a conjunction by the PredicateReorderingRule, is translated into a
+   * single TableScan that evaluates all predicates chunk by chunk (see ConjunctionTableScanImpl). That avoids an
+   * intermediate table per predicate. The PredicateReorderingRule places the most selective predicate at the bottom of
+   * the chain, so the predicates are conjoined bottom-up.
+   * PredicateNodes whose result is needed by other nodes as well (see translate_node()) are not merged, neither are
+   * those that become a JoinIE or a JoinHash with the JoinNode below them.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{node};
+  while (true) {
+    const auto input_predicate_node = std::dynamic_pointer_cast<PredicateNode>(predicate_nodes.back()->left_input());
+    if (!input_predicate_node || input_predicate_node->scan_type != ScanType::TableScan ||
+        input_predicate_node->output_count() > 1 || _is_translated(input_predicate_node) ||
+        _join_ie_secondary_predicate(input_predicate_node) ||
+        !_join_hash_secondary_predicates(input_predicate_node).empty()) {
+      break;
+    }
+    predicate_nodes.emplace_back(input_predicate_node);
+  }
+
+  if (predicate_nodes.size() == 1) {
+    return _translate_predicate_node_to_table_scan(node, translate_node(node->left_input()));
+  }
+
+  // PredicateNodes do not change the columns, so all predicates can be resolved against the input of the chain
+  const auto input_node = predicate_nodes.back()->left_input();
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  predicates.reserve(predicate_nodes.size());
+  for (auto predicate_node_iter = predicate_nodes.rbegin(); predicate_node_iter != predicate_nodes.rend();
+       ++predicate_node_iter) {
+    predicates.emplace_back(_translate_expression((*predicate_node_iter)->predicate(), input_node));
+  }
+
+  return std::make_shared<TableScan>(translate_node(input_node),
+                                     inflate_logical_expressions(predicates, LogicalOperator::And));
+}
+
+std::optional<OperatorJoinPredicate> LQPTranslator::_join_ie_secondary_predicate(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * An inner JoinNode on an inequality with a PredicateNode on another inequality between its inputs right above, as
+   * the JoinOrderingRule creates them for `a.x < b.x AND a.y > b.y`, is executed by a single JoinIE. Any other join
+   * would produce all pairs that satisfy the first inequality, often a large share of the cross product, before the
+   * TableScan filters them by the second one.
+   */
+  if (node->scan_type != ScanType::TableScan) return std::nullopt;
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(node->left_input());
+  if (!join_node || join_node->join_mode != JoinMode::Inner) return std::nullopt;
+  if (join_node->output_count() > 1 || _is_translated(join_node)) return std::nullopt;
+
+  const auto& left_input = *join_node->left_input();
+  const auto& right_input = *join_node->right_input();
+  const auto join_predicate = OperatorJoinPredicate::from_expression(*join_node->join_predicate(), left_input,
+                                                                     right_input);
+  const auto secondary_predicate =
+      OperatorJoinPredicate::from_expression(*node->predicate(), left_input, right_input);
+  if (!join_predicate || !secondary_predicate) return std::nullopt;
+
+  const auto is_supported = [&](const OperatorJoinPredicate& predicate) {
+    const auto predicate_condition = predicate.predicate_condition;
+    if (predicate_condition != PredicateCondition::LessThan &&
+        predicate_condition != PredicateCondition::LessThanEquals &&
+        predicate_condition != PredicateCondition::GreaterThan &&
+        predicate_condition != PredicateCondition::GreaterThanEquals) {
+      return false;
+    }
+
+    return left_input.column_expressions().at(predicate.column_ids.first)->data_type() ==
+           right_input.column_expressions().at(predicate.column_ids.second)->data_type();
+  };
+  if (!is_supported(*join_predicate) || !is_supported(*secondary_predicate)) return std::nullopt;
+
+  return secondary_predicate;
+}
+
+std::vector<OperatorJoinPredicate> LQPTranslator::_join_hash_secondary_predicates(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * An inner JoinNode on an equality with a chain of PredicateNodes on further equalities between its inputs right
+   * above, as the JoinOrderingRule creates them for `a.x = b.x AND a.y = b.y`, is executed by a single JoinHash on the
+   * composite key, if the JoinNode would become a JoinHash anyway. Otherwise, the join would produce all pairs that
+   * match on the first column before the TableScan filters them by the others.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto input_node = std::static_pointer_cast<AbstractLQPNode>(node);
+  while (const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(input_node)) {
+    if (predicate_node->scan_type != ScanType::TableScan) return {};
+    const auto is_shared = predicate_node->output_count() > 1 || _is_translated(predicate_node);
+    if (predicate_node != node && is_shared) return {};
+    predicate_nodes.emplace_back(predicate_node);
+    input_node = predicate_node->left_input();
+  }
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(input_node);
+  if (!join_node || join_node->join_mode != JoinMode::Inner) return {};
+  if (join_node->output_count() > 1 || _is_translated(join_node)) return {};
+
+  const auto& left_input = *join_node->left_input();
+  const auto& right_input = *join_node->right_input();
+  const auto is_supported = [&](const std::optional<OperatorJoinPredicate>& predicate) {
+    return predicate && predicate->predicate_condition == PredicateCondition::Equals &&
+           left_input.column_expressions().at(predicate->column_ids.first)->data_type() ==
+               right_input.column_expressions().at(predicate->column_ids.second)->data_type();
+  };
+
+  const auto join_predicate = OperatorJoinPredicate::from_expression(*join_node->join_predicate(), left_input,
+                                                                     right_input);
+  if (!is_supported(join_predicate)) return {};
+  if (_use_numa_aware_join(join_node, *join_predicate)) return {};
+  if (_cheapest_join_type(join_node, *join_predicate) != OperatorType::JoinHash) return {};
+
+  auto secondary_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto secondary_predicate =
+        OperatorJoinPredicate::from_expression(*predicate_node->predicate(), left_input, right_input);
+    if (!is_supported(secondary_predicate)) return {};
+    secondary_predicates.emplace_back(*secondary_predicate);
+  }
+
+  return secondary_predicates;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
@@ -196,6 +417,13 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
+
+  // A TableIndex covers all chunks (see IndexScan), but only those of the stored table, not of a pruned copy of it
+  if (table->get_table_index(column_id) && stored_table_node->excluded_chunk_ids().empty()) {
+    return std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                       predicate->predicate_condition, right_values, right_values2);
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
@@ -254,31 +482,23 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
-  /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
-   */
-
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
+  auto column_ids = std::vector<ColumnID>{};
   const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
-
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
+  for (const auto& pqp_expression : pqp_expressions) {
     const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
     Assert(pqp_column_expression,
            "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+    column_ids.emplace_back(pqp_column_expression->column_id);
+  }
 
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
+  /**
+   * Multiple ORDER BY columns are sorted in a single pass on normalized keys instead of by one stable Sort per column.
+   */
+  if (column_ids.size() > 1) {
+    return std::make_shared<MultiColumnSort>(input_operator, column_ids, sort_node->order_by_modes);
   }
 
-  return current_pqp;
+  return std::make_shared<Sort>(input_operator, column_ids.front(), sort_node->order_by_modes.front());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -306,13 +526,194 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
   const auto predicate_condition = operator_join_predicate->predicate_condition;
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
+  if (const auto table_scan = _translate_semi_anti_join_to_table_scan(join_node, *operator_join_predicate,
+                                                                      input_left_operator, input_right_operator)) {
+    return table_scan;
+  }
+
+  if (_use_numa_aware_join(join_node, *operator_join_predicate)) {
+    return std::make_shared<JoinMPSM>(input_left_operator, input_right_operator, join_node->join_mode,
                                       operator_join_predicate->column_ids, predicate_condition);
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
+  if (_use_adaptive_joins && (join_node->left_input()->type != LQPNodeType::StoredTable ||
+                              join_node->right_input()->type != LQPNodeType::StoredTable)) {
+    return std::make_shared<JoinAdaptive>(input_left_operator, input_right_operator, join_node->join_mode,
+                                          operator_join_predicate->column_ids, predicate_condition, _cost_model);
+  }
+
+  switch (_cheapest_join_type(join_node, *operator_join_predicate)) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
+                                        operator_join_predicate->column_ids, predicate_condition);
+    case OperatorType::JoinSortMerge:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
+                                             operator_join_predicate->column_ids, predicate_condition);
+    case OperatorType::JoinIndex:
+      return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode,
                                          operator_join_predicate->column_ids, predicate_condition);
+    case OperatorType::JoinNestedLoop:
+      return std::make_shared<JoinNestedLoop>(input_left_operator, input_right_operator, join_node->join_mode,
+                                              operator_join_predicate->column_ids, predicate_condition);
+    default:
+      Fail("Unexpected join type");
+  }
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_semi_anti_join_to_table_scan(
+    const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& operator_join_predicate,
+    const std::shared_ptr<AbstractOperator>& input_left_operator,
+    const std::shared_ptr<AbstractOperator>& input_right_operator) const {
+  /**
+   * A semi/anti join with a small right input is executed as `<left column> [NOT] IN (SELECT <right column> ...)`,
+   * which the TableScan evaluates with a hash set of the right column's values and without materializing the left
+   * input. This is what most EXISTS subqueries turn into after the ExistsReformulationRule.
+   *
+   * SQL's NOT IN yields no rows if the set contains a NULL, whereas the anti join ignores NULLs of the right input.
+   * Thus, anti joins are only translated if the right column is not nullable. NULLs of the left column are neither part
+   * of the result of the joins nor of the scans.
+   */
+  const auto join_mode = join_node->join_mode;
+  if (join_mode != JoinMode::Semi && join_mode != JoinMode::Anti) return nullptr;
+  if (operator_join_predicate.predicate_condition != PredicateCondition::Equals) return nullptr;
+
+  const auto& left_column_expression =
+      join_node->left_input()->column_expressions().at(operator_join_predicate.column_ids.first);
+  const auto& right_column_expression =
+      join_node->right_input()->column_expressions().at(operator_join_predicate.column_ids.second);
+  if (left_column_expression->data_type() != right_column_expression->data_type()) return nullptr;
+  if (join_mode == JoinMode::Anti && right_column_expression->is_nullable()) return nullptr;
+
+  if (join_node->right_input()->get_statistics()->row_count() > SEMI_JOIN_SCAN_MAX_ROW_COUNT) return nullptr;
+
+  const auto right_column = std::make_shared<PQPColumnExpression>(
+      operator_join_predicate.column_ids.second, right_column_expression->data_type(),
+      right_column_expression->is_nullable(), right_column_expression->as_column_name());
+  const auto subquery_pqp = std::make_shared<Projection>(
+      input_right_operator, std::vector<std::shared_ptr<AbstractExpression>>{right_column});
+  const auto subquery = std::make_shared<PQPSelectExpression>(subquery_pqp, right_column_expression->data_type(),
+                                                              right_column_expression->is_nullable());
+
+  const auto left_column = std::make_shared<PQPColumnExpression>(
+      operator_join_predicate.column_ids.first, left_column_expression->data_type(),
+      left_column_expression->is_nullable(), left_column_expression->as_column_name());
+  const auto predicate_condition = join_mode == JoinMode::Semi ? PredicateCondition::In : PredicateCondition::NotIn;
+
+  return std::make_shared<TableScan>(input_left_operator,
+                                     std::make_shared<InExpression>(predicate_condition, left_column, subquery));
+}
+
+bool LQPTranslator::_use_numa_aware_join(const std::shared_ptr<JoinNode>& join_node,
+                                         const OperatorJoinPredicate& operator_join_predicate) const {
+  /**
+   * JoinMPSM places its partitions in node-local memory and runs the jobs processing them on the node that owns the
+   * partition. On systems with multiple NUMA nodes, this avoids the cross-node traffic that dominates the other joins
+   * for large inputs. JoinMPSM only handles equi joins on columns of the same type without NULLs, and no semi or anti
+   * joins.
+   */
+  if (Topology::get().nodes().size() < 2) return false;
+
+  if (operator_join_predicate.predicate_condition != PredicateCondition::Equals) return false;
+  const auto join_mode = join_node->join_mode;
+  if (join_mode != JoinMode::Inner && join_mode != JoinMode::Left && join_mode != JoinMode::Right &&
+      join_mode != JoinMode::Outer) {
+    return false;
+  }
+
+  const auto& left_column_expression =
+      join_node->left_input()->column_expressions().at(operator_join_predicate.column_ids.first);
+  const auto& right_column_expression =
+      join_node->right_input()->column_expressions().at(operator_join_predicate.column_ids.second);
+  if (left_column_expression->data_type() != right_column_expression->data_type()) return false;
+  if (left_column_expression->is_nullable() || right_column_expression->is_nullable()) return false;
+
+  return join_node->left_input()->get_statistics()->row_count() >= NUMA_AWARE_JOIN_MIN_ROW_COUNT &&
+         join_node->right_input()->get_statistics()->row_count() >= NUMA_AWARE_JOIN_MIN_ROW_COUNT;
+}
+
+OperatorType LQPTranslator::_cheapest_join_type(const std::shared_ptr<JoinNode>& join_node,
+                                               const OperatorJoinPredicate& operator_join_predicate) const {
+  /**
+   * Of the joins that support the join mode and the predicate, the one with the lowest cost estimated by the
+   * CostModelPhysical is chosen. Equal costs are resolved in favour of the join that is listed first.
+   *
+   * JoinIndex and JoinNestedLoop do not support semi and anti joins. JoinIndex is only an option if every chunk of the
+   * right input has an index on the join column, otherwise it falls back to a nested loop for the remaining chunks.
+   * JoinNestedLoop is meant for tests and benchmarks only, so it is just used if no other join supports the predicate.
+   */
+  const auto join_mode = join_node->join_mode;
+  const auto predicate_condition = operator_join_predicate.predicate_condition;
+  const auto is_semi_or_anti_join = join_mode == JoinMode::Semi || join_mode == JoinMode::Anti;
+  const auto is_comparison = predicate_condition == PredicateCondition::Equals ||
+                             predicate_condition == PredicateCondition::NotEquals ||
+                             predicate_condition == PredicateCondition::LessThan ||
+                             predicate_condition == PredicateCondition::LessThanEquals ||
+                             predicate_condition == PredicateCondition::GreaterThan ||
+                             predicate_condition == PredicateCondition::GreaterThanEquals;
+
+  const auto left_input_row_count = join_node->left_input()->get_statistics()->row_count();
+  const auto right_input_row_count = join_node->right_input()->get_statistics()->row_count();
+  const auto output_row_count = join_node->get_statistics()->row_count();
+
+  auto cheapest_join_type = std::optional<OperatorType>{};
+  auto cheapest_cost = Cost{0};
+  const auto consider = [&](const OperatorType join_type, const size_t right_chunk_count) {
+    const auto cost = _cost_model->estimate_join_cost(join_type, left_input_row_count, right_input_row_count,
+                                                      output_row_count, right_chunk_count);
+    if (cheapest_join_type && cost >= cheapest_cost) return;
+
+    cheapest_join_type = join_type;
+    cheapest_cost = cost;
+  };
+
+  if (predicate_condition == PredicateCondition::Equals && join_mode != JoinMode::Outer) {
+    consider(OperatorType::JoinHash, 1);
+  }
+
+  if (!is_semi_or_anti_join && is_comparison) {
+    if (predicate_condition != PredicateCondition::NotEquals || join_mode == JoinMode::Inner) {
+      consider(OperatorType::JoinSortMerge, 1);
+    }
+
+    if (const auto indexed_chunk_count = _indexed_chunk_count_of_right_input(join_node, operator_join_predicate)) {
+      consider(OperatorType::JoinIndex, *indexed_chunk_count);
+    }
+  }
+
+  if (cheapest_join_type) return *cheapest_join_type;
+
+  return is_semi_or_anti_join ? OperatorType::JoinSortMerge : OperatorType::JoinNestedLoop;
+}
+
+std::optional<size_t> LQPTranslator::_indexed_chunk_count_of_right_input(
+    const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& operator_join_predicate) const {
+  // Only stored tables have indexes, the chunks of intermediate results do not
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(join_node->right_input());
+  // The rows of a sampled table are only a part of those that the indexes find
+  if (!stored_table_node || stored_table_node->table_sample()) return std::nullopt;
+
+  // The indexes look up the values of the left column, so they have to be of the type of the right column
+  const auto& left_column_expression =
+      join_node->left_input()->column_expressions().at(operator_join_predicate.column_ids.first);
+  const auto& right_column_expression =
+      stored_table_node->column_expressions().at(operator_join_predicate.column_ids.second);
+  if (left_column_expression->data_type() != right_column_expression->data_type()) return std::nullopt;
+
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  const auto& excluded_chunk_ids = stored_table_node->excluded_chunk_ids();
+  const auto column_ids = std::vector<ColumnID>{operator_join_predicate.column_ids.second};
+
+  auto indexed_chunk_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (std::find(excluded_chunk_ids.begin(), excluded_chunk_ids.end(), chunk_id) != excluded_chunk_ids.end()) {
+      continue;
+    }
+    if (table->get_chunk(chunk_id)->get_indices(column_ids).empty()) return std::nullopt;
+    ++indexed_chunk_count;
+  }
+
+  if (indexed_chunk_count == 0) return std::nullopt;
+  return indexed_chunk_count;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
@@ -364,8 +765,26 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+
+  /**
+   * A Limit with a constant row count directly on top of a Sort by a single column ("ORDER BY x LIMIT n") is fused
+   * into a TopK, which never sorts the entire input.
+   */
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node->left_input());
+  if (sort_node && sort_node->node_expressions.size() == 1 &&
+      std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression())) {
+    const auto sort_input_operator = translate_node(sort_node->left_input());
+    const auto pqp_sort_expression = _translate_expressions(sort_node->node_expressions, sort_node->left_input()).front();
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_sort_expression);
+    Assert(pqp_column_expression, "Sort Expression '"s + pqp_sort_expression->as_column_name() +
+                                      "' must be available as column, LQP is invalid");
+
+    return std::make_shared<TopK>(sort_input_operator, pqp_column_expression->column_id,
+                                  sort_node->order_by_modes.front(), limit_node->num_rows_expression()->deep_copy());
+  }
+
+  const auto input_operator = translate_node(node->left_input());
   return std::make_shared<Limit>(
       input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
 }
@@ -389,6 +808,33 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_update_node(
   auto update_node = std::dynamic_pointer_cast<UpdateNode>(node);
 
   const auto input_operator_left = translate_node(node->left_input());
+
+  // If the updated values are a Projection of the rows to update, only the columns that change are projected. Update
+  // takes the other columns from the rows that it replaces, so that they are not materialized.
+  const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(node->right_input());
+  if (projection_node && projection_node->left_input() == node->left_input()) {
+    const auto& column_expressions = node->left_input()->column_expressions();
+    const auto& projected_expressions = projection_node->node_expressions;
+
+    auto updated_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+    auto updated_column_ids = std::vector<ColumnID>{};
+    for (auto column_id = ColumnID{0}; column_id < projected_expressions.size(); ++column_id) {
+      if (column_id < column_expressions.size() &&
+          *projected_expressions[column_id] == *column_expressions[column_id]) {
+        continue;
+      }
+      updated_expressions.emplace_back(projected_expressions[column_id]);
+      updated_column_ids.emplace_back(column_id);
+    }
+
+    if (!updated_expressions.empty() && projected_expressions.size() == column_expressions.size()) {
+      const auto updated_values_operator = std::make_shared<Projection>(
+          input_operator_left, _translate_expressions(updated_expressions, node->left_input()));
+      return std::make_shared<Update>(update_node->table_name, input_operator_left, updated_values_operator,
+                                      updated_column_ids);
+    }
+  }
+
   const auto input_operator_right = translate_node(node->right_input());
 
   return std::make_shared<Update>(update_node->table_name, input_operator_left, input_operator_right);
@@ -414,6 +860,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_exchange_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = translate_node(node->left_input());
+  const auto exchange_node = std::dynamic_pointer_cast<ExchangeNode>(node);
+  const auto column_id = node->left_input()->get_column_id(*exchange_node->partition_expression());
+  return std::make_shared<Exchange>(input_operator, column_id, exchange_node->partition_count);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_show_tables_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   DebugAssert(node->left_input() == nullptr, "ShowTables should not have an input operator.");
@@ -487,7 +941,7 @@ std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
       const auto lqp_select_expression = std::dynamic_pointer_cast<LQPSelectExpression>(expression);
       Assert(lqp_select_expression, "Expected LQPSelectExpression");
 
-      const auto sub_select_pqp = LQPTranslator{}.translate_node(lqp_select_expression->lqp);
+      const auto sub_select_pqp = LQPTranslator{_cost_model}.translate_node(lqp_select_expression->lqp);
 
       auto sub_select_parameters = PQPSelectExpression::Parameters{};
       sub_select_parameters.reserve(lqp_select_expression->parameter_count());
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include "abstract_lqp_node.hpp"
@@ -12,6 +13,8 @@ namespace opossum {
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class CostModelPhysical;
+class JoinNode;
 class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
@@ -19,10 +22,27 @@ struct OperatorJoinPredicate;
 
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
- * engine, which in return is represented by its root Operator.
+ * engine, which in return is represented by its root Operator. Where multiple join operators can execute a JoinNode,
+ * the CostModelPhysical decides between them.
+ *
+ * Plugins can translate the nodes of a type themselves by adding an LQPTranslatorOverride to the PluginManager, which
+ * is tried before the node is translated here.
+ *
+ * With @param use_adaptive_joins, the JoinNodes that have an input other than a StoredTableNode, whose row counts are
+ * thus estimated, become JoinAdaptives, which choose the join by the actual row counts of their inputs instead.
  */
 class LQPTranslator {
  public:
+  // Minimum (estimated) row count of both inputs of an equi join for it to be executed by JoinMPSM on NUMA systems
+  static constexpr auto NUMA_AWARE_JOIN_MIN_ROW_COUNT = 1'000'000.0f;
+
+  // Maximum (estimated) row count of the right input of a semi/anti join for it to be executed as a TableScan
+  static constexpr auto SEMI_JOIN_SCAN_MAX_ROW_COUNT = 10'000.0f;
+
+  LQPTranslator();
+  explicit LQPTranslator(const std::shared_ptr<const CostModelPhysical>& cost_model,
+                         const bool use_adaptive_joins = false);
+
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -35,12 +55,25 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::shared_ptr<TableScan> _translate_predicate_nodes_to_table_scan(const std::shared_ptr<PredicateNode>& node) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::optional<OperatorJoinPredicate> _join_ie_secondary_predicate(const std::shared_ptr<PredicateNode>& node) const;
+  std::vector<OperatorJoinPredicate> _join_hash_secondary_predicates(const std::shared_ptr<PredicateNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_semi_anti_join_to_table_scan(
+      const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& operator_join_predicate,
+      const std::shared_ptr<AbstractOperator>& input_left_operator,
+      const std::shared_ptr<AbstractOperator>& input_right_operator) const;
+  bool _use_numa_aware_join(const std::shared_ptr<JoinNode>& join_node,
+                            const OperatorJoinPredicate& operator_join_predicate) const;
+  OperatorType _cheapest_join_type(const std::shared_ptr<JoinNode>& join_node,
+                                   const OperatorJoinPredicate& operator_join_predicate) const;
+  std::optional<size_t> _indexed_chunk_count_of_right_input(const std::shared_ptr<JoinNode>& join_node,
+                                                            const OperatorJoinPredicate& operator_join_predicate) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -49,6 +82,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_update_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_union_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_exchange_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -67,9 +101,21 @@ class LQPTranslator {
       const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Whether the operator of the @param node can be shared with equal nodes, see translate_node()
+  static bool _is_shareable(const AbstractLQPNode& node);
+
+  // Whether the @param node, or a shareable node equal to it, has been translated, so that its operator is shared
+  bool _is_translated(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  const std::shared_ptr<const CostModelPhysical> _cost_model;
+  const bool _use_adaptive_joins;
+
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
+
+  // The same for equal subplans that are not the same nodes
+  mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_equal_lqp;
 };
 
 }  // namespace opossum
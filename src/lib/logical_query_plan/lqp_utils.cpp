@@ -1,9 +1,11 @@
 #include "lqp_utils.hpp"
 
+#include <algorithm>
 #include <set>
 
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
@@ -12,6 +14,9 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "storage/index/unique_constraint_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -180,6 +185,75 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp) {
   return lqp_is_validated(lqp->left_input()) && lqp_is_validated(lqp->right_input());
 }
 
+bool lqp_expressions_are_unique(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  const auto contains_expression = [&](const auto& expression) {
+    return std::any_of(expressions.begin(), expressions.end(),
+                       [&](const auto& other_expression) { return *other_expression == *expression; });
+  };
+
+  auto validated = false;
+
+  for (auto node = lqp; node; node = node->left_input()) {
+    switch (node->type) {
+      case LQPNodeType::Alias:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+        break;
+
+      case LQPNodeType::Validate:
+        validated = true;
+        break;
+
+      case LQPNodeType::Join: {
+        // Semi and anti joins only filter the rows of their left input
+        const auto join_mode = static_cast<const JoinNode&>(*node).join_mode;
+        if (join_mode != JoinMode::Semi && join_mode != JoinMode::Anti) return false;
+      } break;
+
+      case LQPNodeType::Aggregate: {
+        const auto& aggregate_node = static_cast<const AggregateNode&>(*node);
+        const auto group_by_expressions_end =
+            aggregate_node.node_expressions.begin() + aggregate_node.aggregate_expressions_begin_idx;
+        return std::all_of(aggregate_node.node_expressions.begin(), group_by_expressions_end, contains_expression);
+      }
+
+      case LQPNodeType::StoredTable: {
+        if (!validated) return false;
+
+        const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node);
+        const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+
+        auto column_ids = std::set<ColumnID>{};
+        for (const auto& expression : expressions) {
+          if (expression->type != ExpressionType::LQPColumn) continue;
+          const auto& column_reference = static_cast<const LQPColumnExpression&>(*expression).column_reference;
+          if (column_reference.original_node() == stored_table_node) {
+            column_ids.emplace(column_reference.original_column_id());
+          }
+        }
+
+        for (const auto& unique_constraint : table->unique_constraints()) {
+          const auto& constraint_column_ids = unique_constraint->definition().column_ids;
+          const auto constraint_is_covered =
+              std::all_of(constraint_column_ids.begin(), constraint_column_ids.end(), [&](const auto column_id) {
+                return column_ids.count(column_id) && !table->column_is_nullable(column_id);
+              });
+          if (constraint_is_covered) return true;
+        }
+        return false;
+      }
+
+      default:
+        return false;
+    }
+  }
+
+  return false;
+}
+
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp) {
   std::set<std::string> modified_tables;
 
@@ -212,6 +286,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::CreateView:
       case LQPNodeType::DropView:
       case LQPNodeType::DummyTable:
+      case LQPNodeType::Exchange:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
       case LQPNodeType::Predicate:
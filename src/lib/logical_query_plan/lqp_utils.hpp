@@ -50,6 +50,16 @@ void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return whether no two rows of the output of the @param lqp have the same values for all of the @param expressions.
+ *         This is known if they include the columns of a unique constraint of a stored table, or the group by
+ *         expressions of an AggregateNode, and only nodes that do not duplicate rows lie in between. As the rows of a
+ *         stored table are only unique per transaction, the path to the StoredTableNode has to contain a ValidateNode.
+ *         Nullable columns allow duplicate NULLs, so only constraints on non-nullable columns count.
+ */
+bool lqp_expressions_are_unique(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
 /**
  * @return all names of tables that have been accessed in modifying nodes (e.g., InsertNode, UpdateNode)
  */
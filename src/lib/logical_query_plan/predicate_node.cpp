@@ -12,6 +12,7 @@
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -38,8 +39,10 @@ std::shared_ptr<TableStatistics> PredicateNode::derive_statistics_from(
    * Currently, we cannot compute statistics for, e.g., IN or nestings of AND/OR.
    */
 
+  // The CardinalityFeedback corrects the estimates of all predicates that were executed before, including those that
+  // are estimated with a selectivity of 1
   const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate(), *left_input);
-  if (!operator_predicates) return left_input->get_statistics();
+  if (!operator_predicates) return CardinalityFeedback::get().correct(*this, left_input->get_statistics());
 
   auto output_statistics = left_input->get_statistics();
 
@@ -49,7 +52,7 @@ std::shared_ptr<TableStatistics> PredicateNode::derive_statistics_from(
                                               operator_predicate.value, operator_predicate.value2));
   }
 
-  return output_statistics;
+  return CardinalityFeedback::get().correct(*this, output_statistics);
 }
 
 std::shared_ptr<AbstractExpression> PredicateNode::predicate() const { return node_expressions[0]; }
@@ -1,8 +1,18 @@
 #include "stored_table_node.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
 #include "expression/lqp_column_expression.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -10,25 +20,51 @@ StoredTableNode::StoredTableNode(const std::string& table_name)
     : AbstractLQPNode(LQPNodeType::StoredTable), table_name(table_name) {}
 
 LQPColumnReference StoredTableNode::get_column(const std::string& name) const {
-  const auto table = StorageManager::get().get_table(table_name);
-  const auto column_id = table->column_id_by_name(name);
-  return {shared_from_this(), column_id};
+  const auto& column_definitions = this->column_definitions();
+  const auto iter = std::find_if(column_definitions.begin(), column_definitions.end(),
+                                 [&](const auto& column_definition) { return column_definition.name == name; });
+  Assert(iter != column_definitions.end(), "Couldn't find column '" + name + "'");
+  return {shared_from_this(), static_cast<ColumnID>(std::distance(column_definitions.begin(), iter))};
+}
+
+const TableColumnDefinitions& StoredTableNode::column_definitions() const {
+  if (!_column_definitions) {
+    _column_definitions =
+        std::make_shared<TableColumnDefinitions>(StorageManager::get().get_table(table_name)->column_definitions());
+  }
+  return *_column_definitions;
 }
 
 void StoredTableNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunks) { _excluded_chunk_ids = chunks; }
 
 const std::vector<ChunkID>& StoredTableNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
 
-std::string StoredTableNode::description() const { return "[StoredTable] Name: '" + table_name + "'"; }
+void StoredTableNode::set_table_sample(const std::optional<TableSample>& table_sample) {
+  Assert(!table_sample || (table_sample->percentage >= 0.0f && table_sample->percentage <= 100.0f),
+         "Sampling percentage has to be between 0 and 100");
+  _table_sample = table_sample;
+}
+
+const std::optional<TableSample>& StoredTableNode::table_sample() const { return _table_sample; }
+
+std::string StoredTableNode::description() const {
+  std::stringstream stream;
+  stream << "[StoredTable] Name: '" << table_name << "'";
+  if (_table_sample) {
+    stream << " TABLESAMPLE " << table_sample_method_to_string.left.at(_table_sample->method) << " ("
+           << _table_sample->percentage << ")";
+  }
+  return stream.str();
+}
 
 const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_expressions() const {
   // Need to initialize the expressions lazily because they will have a weak_ptr to this node and we can't obtain that
   // in the constructor
   if (!_expressions) {
-    const auto table = StorageManager::get().get_table(table_name);
+    const auto column_count = column_definitions().size();
 
-    _expressions.emplace(table->column_count());
-    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    _expressions.emplace(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
       (*_expressions)[column_id] =
           std::make_shared<LQPColumnExpression>(LQPColumnReference{shared_from_this(), column_id});
     }
@@ -40,18 +76,30 @@ const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_
 std::shared_ptr<TableStatistics> StoredTableNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   DebugAssert(!left_input && !right_input, "StoredTableNode must be leaf");
-  return StorageManager::get().get_table(table_name)->table_statistics();
+  const auto table_statistics = StorageManager::get().get_table(table_name)->table_statistics();
+  if (!_table_sample) return table_statistics;
+
+  // A sample keeps the expected share of the rows. The column statistics are those of the whole table, as the sample
+  // is drawn independently of the values.
+  const auto table_type =
+      _table_sample->method == TableSampleMethod::Bernoulli ? TableType::References : table_statistics->table_type();
+  return std::make_shared<TableStatistics>(table_type,
+                                           table_statistics->row_count() * _table_sample->percentage / 100.0f,
+                                           table_statistics->column_statistics());
 }
 
 std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto copy = make(table_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_table_sample(_table_sample);
+  copy->_column_definitions = _column_definitions;
   return copy;
 }
 
 bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& stored_table_node = static_cast<const StoredTableNode&>(rhs);
-  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids;
+  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids &&
+         _table_sample == stored_table_node._table_sample;
 }
 
 }  // namespace opossum
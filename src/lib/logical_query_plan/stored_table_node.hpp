@@ -6,6 +6,7 @@
 #include "abstract_lqp_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "lqp_column_reference.hpp"
+#include "storage/table_column_definition.hpp"
 
 namespace opossum {
 
@@ -17,9 +18,17 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
 
   LQPColumnReference get_column(const std::string& name) const;
 
+  // The columns of the table, which are looked up in the StorageManager once and then shared with the copies of the
+  // node, so that the names and types of the columns are not resolved by the table name over and over again
+  const TableColumnDefinitions& column_definitions() const;
+
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunks);
   const std::vector<ChunkID>& excluded_chunk_ids() const;
 
+  // TABLESAMPLE of the table, which the GetTable draws (see GetTable::set_table_sample())
+  void set_table_sample(const std::optional<TableSample>& table_sample);
+  const std::optional<TableSample>& table_sample() const;
+
   std::string description() const override;
   const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
   std::shared_ptr<TableStatistics> derive_statistics_from(
@@ -34,7 +43,9 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
 
  private:
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _expressions;
+  mutable std::shared_ptr<const TableColumnDefinitions> _column_definitions;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<TableSample> _table_sample;
 };
 
 }  // namespace opossum
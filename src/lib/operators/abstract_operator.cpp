@@ -1,16 +1,22 @@
 #include "abstract_operator.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "boost/container/pmr/global_resource.hpp"
+
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
+#include "utils/query_memory_resource.hpp"
 #include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -31,6 +37,10 @@ void AbstractOperator::execute() {
 
   Timer performance_timer;
 
+  _begin_counting_hardware_events();
+  auto hardware_counter_scope = std::optional<HardwareCounterScope>{};
+  hardware_counter_scope.emplace(_hardware_counter_collector);
+
   auto transaction_context = this->transaction_context();
 
   if (transaction_context) {
@@ -43,15 +53,28 @@ void AbstractOperator::execute() {
       return;
     }
     transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
+    try {
+      _output = _on_execute(transaction_context);
+    } catch (...) {
+      // E.g., because the query was cancelled. A rollback waits for all operators of the transaction to finish.
+      transaction_context->on_operator_finished();
+      throw;
+    }
     transaction_context->on_operator_finished();
   } else {
     _output = _on_execute(nullptr);
   }
 
+  if (_output) _performance_data->output_row_count = _output->row_count();
+  _performance_data->peak_memory_bytes = _memory_tracker.peak_allocated_bytes();
+  _performance_data->allocated_bytes = _memory_tracker.total_allocated_bytes();
+
   // release any temporary data if possible
   _on_cleanup();
 
+  hardware_counter_scope.reset();
+  _end_counting_hardware_events();
+
   _performance_data->walltime = performance_timer.lap();
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
@@ -63,7 +86,8 @@ void AbstractOperator::execute() {
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   DebugAssert(
       [&]() {
-        if (_output == nullptr) return true;
+        // The chunks of a pipelined output are set concurrently
+        if (_output == nullptr || _pipelined_output) return true;
         if (_output->chunk_count() <= ChunkID{1}) return true;
         for (auto chunk_id = ChunkID{0}; chunk_id < _output->chunk_count(); ++chunk_id) {
           if (_output->get_chunk(chunk_id)->size() < 1) return true;
@@ -83,7 +107,18 @@ const std::string AbstractOperator::description(DescriptionMode description_mode
 
 std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>> copied_ops;
-  return _deep_copy_impl(copied_ops);
+  return _deep_copy_impl(copied_ops, {});
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return _deep_copy_impl(copied_ops, {});
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
+    const std::unordered_map<ParameterID, AllTypeVariant>& parameters) const {
+  std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>> copied_ops;
+  return _deep_copy_impl(copied_ops, parameters);
 }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
@@ -111,6 +146,28 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_input_right != nullptr) mutable_input_right()->set_transaction_context_recursively(transaction_context);
 }
 
+boost::container::pmr::memory_resource* AbstractOperator::query_memory_resource() const {
+  // The statement owning the resource outlives the execution, so the raw pointer stays valid while it is used
+  if (!_query_memory_resource.expired()) return &_memory_tracker;
+  return boost::container::pmr::get_default_resource();
+}
+
+size_t AbstractOperator::query_memory_budget() const {
+  const auto query_budget = _query_memory_resource.expired() ? size_t{0} : _query_memory_resource.lock()->budget();
+  const auto global_budget = QueryMemoryResource::global_budget();
+  if (query_budget == 0 || global_budget == 0) return std::max(query_budget, global_budget);
+  return std::min(query_budget, global_budget);
+}
+
+void AbstractOperator::set_query_memory_resource_recursively(
+    const std::weak_ptr<QueryMemoryResource>& query_memory_resource) {
+  _query_memory_resource = query_memory_resource;
+  if (const auto resource = query_memory_resource.lock()) _memory_tracker.set_upstream(resource.get());
+
+  if (_input_left != nullptr) mutable_input_left()->set_query_memory_resource_recursively(query_memory_resource);
+  if (_input_right != nullptr) mutable_input_right()->set_query_memory_resource_recursively(query_memory_resource);
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -156,22 +213,118 @@ void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllT
   if (input_right()) mutable_input_right()->set_parameters(parameters);
 }
 
+bool AbstractOperator::is_pipeline_breaker() const { return true; }
+
+bool AbstractOperator::needs_ordered_pipelined_chunks() const { return false; }
+
+std::vector<size_t> AbstractOperator::pipelined_input_chunk_sizes() const {
+  const auto input_table = input_table_left();
+
+  auto chunk_sizes = std::vector<size_t>(input_table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    chunk_sizes[chunk_id] = input_table->get_chunk(chunk_id)->size();
+  }
+  return chunk_sizes;
+}
+
+void AbstractOperator::begin_pipelined_execution(const ChunkID chunk_count) {
+  DTRACE_PROBE1(HYRISE, OPERATOR_STARTED, name().c_str());
+  DebugAssert(!is_pipeline_breaker(), "Pipeline breakers cannot be executed in a pipeline");
+  DebugAssert(!_output, "Operator has already been executed");
+
+  _pipelined_execution_timer.lap();
+  _begin_counting_hardware_events();
+
+  auto transaction_context = this->transaction_context();
+  if (transaction_context) transaction_context->on_operator_started();
+
+  _pipelined_output = _on_begin_pipelined_execution(transaction_context);
+  _pipelined_output->create_pipelined_chunks(chunk_count);
+  _pipelined_output_row_count = 0;
+  _output = _pipelined_output;
+}
+
+bool AbstractOperator::execute_pipelined_chunk(const ChunkID chunk_id) {
+  {
+    const auto hardware_counter_scope = HardwareCounterScope{_hardware_counter_collector};
+    _on_execute_pipelined_chunk(chunk_id, *_pipelined_output);
+  }
+
+  // The next operator of the pipeline releases the chunk, so the output rows are counted while the chunk exists
+  const auto chunk = _pipelined_output->get_chunk(chunk_id);
+  if (!chunk) return false;
+
+  _pipelined_output_row_count += chunk->size();
+  return true;
+}
+
+void AbstractOperator::release_pipelined_chunk(const ChunkID chunk_id) {
+  _pipelined_output->release_pipelined_chunk(chunk_id);
+}
+
+bool AbstractOperator::pipelined_output_is_complete() const { return false; }
+
+void AbstractOperator::end_pipelined_execution() {
+  _pipelined_output->remove_missing_chunks();
+  _pipelined_output = nullptr;
+  _performance_data->output_row_count = _pipelined_output_row_count.load();
+  _performance_data->peak_memory_bytes = _memory_tracker.peak_allocated_bytes();
+  _performance_data->allocated_bytes = _memory_tracker.total_allocated_bytes();
+
+  auto transaction_context = this->transaction_context();
+  if (transaction_context) transaction_context->on_operator_finished();
+
+  _on_cleanup();
+  _end_counting_hardware_events();
+
+  // The operators of a pipeline process each chunk one after another, so this includes the time spent in the others
+  _performance_data->walltime = _pipelined_execution_timer.lap();
+
+  DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(), _output->row_count(),
+                _output->chunk_count(), reinterpret_cast<uintptr_t>(this));
+}
+
+void AbstractOperator::_begin_counting_hardware_events() {
+  // Without access to the counters, the performance data would only show zeros
+  if (HardwareCounters::enabled() && HardwareCounters::available()) {
+    _hardware_counter_collector = std::make_shared<HardwareCounterCollector>();
+  }
+}
+
+void AbstractOperator::_end_counting_hardware_events() {
+  if (!_hardware_counter_collector) return;
+
+  _performance_data->hardware_counters = _hardware_counter_collector->counters();
+  _hardware_counter_collector = nullptr;
+}
+
+std::shared_ptr<Table> AbstractOperator::_on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) {
+  Fail(name() + " cannot be executed in a pipeline");
+}
+
+void AbstractOperator::_on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) {
+  Fail(name() + " cannot be executed in a pipeline");
+}
+
 void AbstractOperator::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {}
 
 void AbstractOperator::_on_cleanup() {}
 
 std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
-    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops,
+    const std::unordered_map<ParameterID, AllTypeVariant>& parameters) const {
   const auto copied_ops_iter = copied_ops.find(this);
   if (copied_ops_iter != copied_ops.end()) return copied_ops_iter->second;
 
   const auto copied_input_left =
-      input_left() ? input_left()->_deep_copy_impl(copied_ops) : std::shared_ptr<AbstractOperator>{};
+      input_left() ? input_left()->_deep_copy_impl(copied_ops, parameters) : std::shared_ptr<AbstractOperator>{};
   const auto copied_input_right =
-      input_right() ? input_right()->_deep_copy_impl(copied_ops) : std::shared_ptr<AbstractOperator>{};
+      input_right() ? input_right()->_deep_copy_impl(copied_ops, parameters) : std::shared_ptr<AbstractOperator>{};
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
+  if (!parameters.empty()) copied_op->_on_set_parameters(parameters);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->lqp_node = lqp_node;
 
   copied_ops.emplace(this, copied_op);
 
@@ -1,17 +1,24 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "boost/container/pmr/memory_resource.hpp"
+
 #include "all_parameter_variant.hpp"
 #include "operator_performance_data.hpp"
 #include "types.hpp"
+#include "utils/timer.hpp"
+#include "utils/tracking_memory_resource.hpp"
 
 namespace opossum {
 
+class AbstractLQPNode;
 class OperatorTask;
+class QueryMemoryResource;
 class Table;
 class TransactionContext;
 
@@ -20,6 +27,7 @@ enum class OperatorType {
   Alias,
   Delete,
   Difference,
+  Exchange,
   ExportBinary,
   ExportCsv,
   GetTable,
@@ -27,19 +35,24 @@ enum class OperatorType {
   ImportCsv,
   IndexScan,
   Insert,
+  Intersect,
   JitOperatorWrapper,
+  JoinAdaptive,
   JoinHash,
+  JoinIE,
   JoinIndex,
   JoinMPSM,
   JoinNestedLoop,
   JoinSortMerge,
   Limit,
+  MultiColumnSort,
   Print,
   Product,
   Projection,
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
@@ -67,6 +80,9 @@ enum class OperatorType {
 //
 // Operators shall not be executed twice.
 //
+// Operators that are not pipeline breakers can also be executed chunk by chunk as part of a pipeline instead (see
+// "Pipelined execution" below).
+//
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
 class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
@@ -103,11 +119,34 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // The memory resource for the intermediate data structures of the operator, which must not outlive its execution
+  // (see QueryMemoryResource). Without a QueryMemoryResource, e.g., outside of an SQLPipeline, this is the default
+  // resource. The allocations are tracked, so that the peak is part of the performance data.
+  boost::container::pmr::memory_resource* query_memory_resource() const;
+
+  // The number of bytes that the intermediate data structures of the query may take, i.e., the budget of the
+  // QueryMemoryResource or the global budget, whichever is smaller. 0 if there is none.
+  size_t query_memory_budget() const;
+
+  // Sets the QueryMemoryResource of the operator and both input operators recursively
+  void set_query_memory_resource_recursively(const std::weak_ptr<QueryMemoryResource>& query_memory_resource);
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
+  // Expressions without parameters or subselects are not copied, but shared with the copy, as they are not modified by
+  // executing the operator (see expression_deep_copy_if_stateful()).
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
+  // Same as deep_copy(), but the operators in @param copied_ops are not copied and are replaced by the operators they
+  // are mapped to instead, e.g., to execute a PQP on other inputs. Adds the copied operators to @param copied_ops.
+  std::shared_ptr<AbstractOperator> deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+
+  // Same as deep_copy() followed by set_parameters(), but sets the @param parameters in the operators while copying
+  // them, so that a cached PQP is instantiated in a single pass
+  std::shared_ptr<AbstractOperator> deep_copy(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -129,12 +168,62 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  /**
+   * @defgroup Pipelined execution
+   *
+   * Pipeline breakers (e.g., joins, aggregates and sorts) need all of their input before they can output anything. The
+   * other operators compute output chunk i from input chunk i alone. OperatorTask executes chains of them as a
+   * pipeline, which pushes each input chunk through all of its operators before it is done with that chunk. This way,
+   * the operators in the middle of a pipeline never hold their entire output.
+   *
+   * Instead of execute(), the pipeline calls begin_pipelined_execution() on its operators from front to back, then
+   * execute_pipelined_chunk() for each input chunk of the pipeline and finally end_pipelined_execution(). Different
+   * chunks are processed in parallel, unless an operator needs_ordered_pipelined_chunks(). The output of a pipelined
+   * operator has one chunk per input chunk of the pipeline (see Table::create_pipelined_chunks()).
+   * @{
+   */
+
+  // Operators that are not pipeline breakers override this as well as the _on_*_pipelined_* methods
+  virtual bool is_pipeline_breaker() const;
+
+  // Operators that need their input chunks in order (e.g., Limit) can only be the last operator of a pipeline
+  virtual bool needs_ordered_pipelined_chunks() const;
+
+  // The number of rows of each chunk that the pipeline processes. Only called on the first operator of a pipeline,
+  // whose inputs have been executed before.
+  virtual std::vector<size_t> pipelined_input_chunk_sizes() const;
+
+  void begin_pipelined_execution(const ChunkID chunk_count);
+
+  // Returns false if the input chunk did not result in an output chunk, e.g., because a scan had no matches
+  bool execute_pipelined_chunk(const ChunkID chunk_id);
+
+  // Frees an output chunk once the next operator of the pipeline has processed it
+  void release_pipelined_chunk(const ChunkID chunk_id);
+
+  // Returns true once processing further input chunks does not change the output (e.g., a Limit with all of its rows)
+  virtual bool pipelined_output_is_complete() const;
+
+  void end_pipelined_execution();
+
+  /** @} */
+
+  // The LQP node that the LQPTranslator created this operator for, if any. Operators that the LQPTranslator created
+  // in addition (e.g., the IndexScan of a PredicateNode, which is combined with a TableScan) have none.
+  std::shared_ptr<const AbstractLQPNode> lqp_node;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) = 0;
 
+  // Creates the empty output table of a pipelined operator and prepares the processing of single chunks
+  virtual std::shared_ptr<Table> _on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context);
+
+  // Computes the output chunk for the input chunk with @param chunk_id and sets it in @param output
+  virtual void _on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output);
+
   // method that allows operator-specific cleanups for temporary data.
   // separate from _on_execute for readability and as a reminder to
   // clean up after execution (if it makes sense)
@@ -149,9 +238,15 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   void _print_impl(std::ostream& out, std::vector<bool>& levels,
                    std::unordered_map<const AbstractOperator*, size_t>& id_by_operator, size_t& id_counter) const;
 
+  // Creates the _hardware_counter_collector if hardware counters are collected, and moves its counters into the
+  // performance data once the execution is done, respectively
+  void _begin_counting_hardware_events();
+  void _end_counting_hardware_events();
+
   // Looks itself up in @param copied_ops to support diamond shapes in PQPs, if not found calls _on_deep_copy()
   std::shared_ptr<AbstractOperator> _deep_copy_impl(
-      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops,
+      const std::unordered_map<ParameterID, AllTypeVariant>& parameters) const;
 
   virtual std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -166,9 +261,24 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
 
+  // The output while the operator is executed in a pipeline, which is the same table as _output
+  std::shared_ptr<Table> _pipelined_output;
+  std::atomic<uint64_t> _pipelined_output_row_count{0};
+  Timer _pipelined_execution_timer;
+
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  // Owned by the SQLPipelineStatement, which keeps it alive while the operator is executed. Cached plans thus do not
+  // keep the memory of the queries that executed them.
+  std::weak_ptr<QueryMemoryResource> _query_memory_resource;
+
+  // Forwards to the QueryMemoryResource and attributes its allocations to the operator
+  mutable TrackingMemoryResource _memory_tracker;
+
+  // Counts the hardware events of the operator and its jobs while it is executed, if enabled (see HardwareCounters)
+  std::shared_ptr<HardwareCounterCollector> _hardware_counter_collector;
+
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
 };
 
@@ -51,6 +51,12 @@ void AbstractReadWriteOperator::rollback_records() {
   _state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::log_records(LogRecord& log_record) const {
+  Assert(_state == ReadWriteOperatorState::Committed, "Operator needs to have state Committed in order to be logged.");
+
+  _on_log_records(log_record);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _state == ReadWriteOperatorState::Failed || _state == ReadWriteOperatorState::RolledBack;
 }
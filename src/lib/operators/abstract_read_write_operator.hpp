@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+struct LogRecord;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -46,6 +48,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds the changes of the committed operator to the redo log record of its transaction, see Logger
+   */
+  void log_records(LogRecord& log_record) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -78,6 +85,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by log_records. Operators that do not write to tables do not log anything.
+   */
+  virtual void _on_log_records(LogRecord& log_record) const {}
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
@@ -3,6 +3,9 @@
 #include <boost/container/pmr/monotonic_buffer_resource.hpp>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -10,43 +13,90 @@
 #include <utility>
 #include <vector>
 
+#include "aggregate/aggregate_hash_table.hpp"
 #include "aggregate/aggregate_traits.hpp"
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/null_count_filter.hpp"
+#include "statistics/chunk_statistics/range_filter.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/materialize.hpp"
 #include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
+#include "utils/checked_arithmetic.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
 
 namespace {
 using namespace opossum;  // NOLINT
 
-// Given an AggregateKey key, and a RowId row_id where this AggregateKey was encountered, this first checks if the
-// AggregateKey was seen before. If not, a new aggregate result is inserted into results and connected to the row id.
-// This is important so that we can reconstruct the original values later. In any case, a reference to the result is
-// returned so that result information, such as the aggregate's count or sum, can be modified by the caller.
-template <typename ResultIds, typename Results, typename AggregateKey>
-typename Results::reference get_or_add_result(ResultIds& result_ids, Results& results, const AggregateKey& key,
-                                              const RowID& row_id) {
-  // Get the result id for the current key or add it to the id map
-  auto it = result_ids.find(key);
-  if (it != result_ids.end()) return results[it->second];
+// Number of hash partitions in which the chunk-local groups are merged when a scheduler is active
+constexpr auto GROUPING_PARTITION_COUNT = size_t{64};
 
-  auto result_id = results.size();
+// Number of values that the ungrouped aggregation gathers into an array before aggregating them in one loop
+constexpr auto UNGROUPED_BLOCK_SIZE = size_t{1'024};
 
-  result_ids.emplace_hint(it, key, result_id);
+// Adds a @param value to a @param sum, failing if an integer sum overflows
+template <typename AggregateType, typename T>
+AggregateType add_to_sum(const AggregateType& sum, const T& value) {
+  if constexpr (std::is_integral_v<AggregateType> && std::is_integral_v<T>) {
+    return checked_add<AggregateType>(sum, value);
+  } else {
+    return sum + static_cast<AggregateType>(value);
+  }
+}
 
-  // If it was added to the id map, add the current row id to the result list so that we can revert the
-  // value(s) -> key mapping
-  results.emplace_back();
-  results[result_id].row_id = row_id;
+// The groups of a chunk with a single group-by column are found through a vector indexed by their keys if the largest
+// key is less than this factor times the chunk size
+constexpr auto DENSE_GROUPING_FACTOR = size_t{4};
+
+// The first occurrence of a chunk-local group. Its AggregateKey can be looked up in the chunk's AggregateKeys, its hash
+// is kept so that the key is hashed only once.
+struct LocalGroup {
+  AggregateResultId local_result_id;
+  ChunkOffset chunk_offset;
+  size_t hash;
+};
 
-  return results[result_id];
+// Calls the @param functor with the @param function as an std::integral_constant, so that it can be used as a template
+// argument
+template <typename Functor>
+void resolve_aggregate_function(const AggregateFunction function, const Functor& functor) {
+  switch (function) {
+    case AggregateFunction::Min:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+      break;
+    case AggregateFunction::Max:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+      break;
+    case AggregateFunction::Sum:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+      break;
+    case AggregateFunction::Avg:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+      break;
+    case AggregateFunction::Count:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+      break;
+    case AggregateFunction::CountDistinct:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+      break;
+    case AggregateFunction::ApproxCountDistinct:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::ApproxCountDistinct>{});
+      break;
+  }
 }
 }  // namespace
 
@@ -55,7 +105,7 @@ namespace opossum {
 Aggregate::Aggregate(const std::shared_ptr<AbstractOperator>& in,
                      const std::vector<AggregateColumnDefinition>& aggregates,
                      const std::vector<ColumnID>& groupby_column_ids)
-    : AbstractReadOnlyOperator(OperatorType::Aggregate, in),
+    : AbstractReadOnlyOperator(OperatorType::Aggregate, in, nullptr, std::make_unique<Aggregate::PerformanceData>()),
       _aggregates(aggregates),
       _groupby_column_ids(groupby_column_ids) {
   Assert(!(aggregates.empty() && groupby_column_ids.empty()),
@@ -106,29 +156,25 @@ void Aggregate::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 void Aggregate::_on_cleanup() { _contexts_per_column.clear(); }
 
 /*
-Visitor context for the AggregateVisitor. The AggregateResultContext can be used without knowing the
-AggregateKey, the AggregateContext is the "full" version.
+Visitor context for the AggregateVisitor. It holds one AggregateResult per group, i.e., it is indexed by
+AggregateResultId.
 */
 template <typename ColumnDataType, typename AggregateType>
 struct AggregateResultContext : SegmentVisitorContext {
   using AggregateResultAllocator = PolymorphicAllocator<AggregateResults<ColumnDataType, AggregateType>>;
 
-  AggregateResultContext() : results(AggregateResultAllocator{&buffer}) {}
+  explicit AggregateResultContext(const std::vector<RowID>& group_row_ids)
+      : results(group_row_ids.size(), AggregateResultAllocator{&buffer}) {
+    // Remember a row of each group so that we can reconstruct the group-by values later
+    for (auto result_id = AggregateResultId{0}; result_id < group_row_ids.size(); ++result_id) {
+      results[result_id].row_id = group_row_ids[result_id];
+    }
+  }
 
   boost::container::pmr::monotonic_buffer_resource buffer;
   AggregateResults<ColumnDataType, AggregateType> results;
 };
 
-template <typename ColumnDataType, typename AggregateType, typename AggregateKey>
-struct AggregateContext : public AggregateResultContext<ColumnDataType, AggregateType> {
-  AggregateContext() {
-    auto allocator = AggregateResultIdMapAllocator<AggregateKey>{&this->buffer};
-    result_ids = std::make_unique<AggregateResultIdMap<AggregateKey>>(allocator);
-  }
-
-  std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
-};
-
 /*
 The AggregateFunctionBuilder is used to create the lambda function that will be used by
 the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
@@ -171,7 +217,7 @@ struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction
     return [](const ColumnDataType& new_value, std::optional<AggregateType>& current_aggregate) {
       // add new value to sum
       if (current_aggregate) {
-        *current_aggregate += new_value;
+        *current_aggregate = add_to_sum(*current_aggregate, new_value);
       } else {
         current_aggregate = new_value;
       }
@@ -201,23 +247,63 @@ struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction
   }
 };
 
-template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
+template <typename ColumnDataType, typename AggregateType>
+struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct> {
+  auto get_aggregate_function() {
+    return [](const ColumnDataType&, std::optional<AggregateType>& current_aggregate) { return std::nullopt; };
+  }
+};
+
+// Adds a value to the distinct values of COUNT(DISTINCT) or to the HyperLogLog sketch of APPROX_COUNT_DISTINCT
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void add_distinct_value(AggregateResult<ColumnDataType, AggregateType>& result, const ColumnDataType& value) {
+  if constexpr (function == AggregateFunction::CountDistinct) {
+    result.distinct_values.insert(value);
+  } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+    result.hyper_log_log.add(HyperLogLog::mix_hash(std::hash<ColumnDataType>{}(value)));
+  }
+}
+
+template <typename ColumnDataType, AggregateFunction function>
 void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                   const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+                                   const AggregateResultIdsPerChunk& result_ids_per_chunk) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
+  auto& context = *std::static_pointer_cast<AggregateResultContext<ColumnDataType, AggregateType>>(
       _contexts_per_column[column_index]);
 
-  auto& result_ids = *context.result_ids;
   auto& results = context.results;
-  const auto& hash_keys = keys_per_chunk[chunk_id];
+  const auto& result_ids = result_ids_per_chunk[chunk_id];
+
+  if constexpr (function == AggregateFunction::CountDistinct || function == AggregateFunction::ApproxCountDistinct) {
+    // The distinct pairs of group and ValueID of a DictionarySegment are found first, so that each value is decoded
+    // and added to the distinct values of a group only once per chunk
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&base_segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      const auto null_value_id = dictionary_segment->null_value_id();
+
+      auto group_value_ids = std::vector<std::pair<AggregateResultId, ValueID>>{};
+      group_value_ids.reserve(result_ids.size());
+      for_each_value_id(*dictionary_segment->attribute_vector(), [&](const auto chunk_offset, const auto value_id) {
+        if (value_id == null_value_id) return;
+        group_value_ids.emplace_back(result_ids[chunk_offset], value_id);
+        ++results[result_ids[chunk_offset]].aggregate_count;
+      });
+
+      std::sort(group_value_ids.begin(), group_value_ids.end());
+      group_value_ids.erase(std::unique(group_value_ids.begin(), group_value_ids.end()), group_value_ids.end());
+      for (const auto& [result_id, value_id] : group_value_ids) {
+        add_distinct_value<ColumnDataType, AggregateType, function>(results[result_id], dictionary[value_id]);
+      }
+      return;
+    }
+  }
 
   ChunkOffset chunk_offset{0};
   segment_iterate<ColumnDataType>(base_segment, [&](const auto& position) {
-    auto& result = get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID(chunk_id, chunk_offset));
+    auto& result = results[result_ids[chunk_offset]];
 
     /**
     * If the value is NULL, the current aggregate value does not change.
@@ -229,17 +315,381 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
       // increase value counter
       ++result.aggregate_count;
 
-      if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
-        // clang-tidy error: https://bugs.llvm.org/show_bug.cgi?id=35824
-        // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-        result.distinct_values.insert(position.value());
-      }
+      // For the (approximate) COUNT(DISTINCT), keep track of the distinct values
+      add_distinct_value<ColumnDataType, AggregateType, function>(result, position.value());
     }
 
     ++chunk_offset;
   });
 }
 
+void Aggregate::_validate_aggregates() const {
+  const auto input_table = input_table_left();
+
+  for (const auto& aggregate : _aggregates) {
+    if (!aggregate.column) {
+      if (aggregate.function != AggregateFunction::Count) {
+        Fail("Aggregate: Asterisk is only valid with COUNT");
+      }
+    } else {
+      DebugAssert(*aggregate.column < input_table->column_count(), "Aggregate column index out of bounds");
+      if (input_table->column_data_type(*aggregate.column) == DataType::String &&
+          (aggregate.function == AggregateFunction::Sum || aggregate.function == AggregateFunction::Avg)) {
+        Fail("Aggregate: Cannot calculate SUM or AVG on string column");
+      }
+    }
+  }
+}
+
+/*
+The following functions compute the AggregateResult of a single segment for the ungrouped aggregation. They are tried
+in order, from the cheapest to the most general one.
+*/
+// MIN, MAX and COUNT are taken from the filters of the segment's statistics. Returns false if there is no such filter.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+bool aggregate_ungrouped_from_statistics(const SegmentStatistics& statistics,
+                                         AggregateResult<ColumnDataType, AggregateType>& result) {
+  for (const auto& filter : statistics.filters()) {
+    if constexpr (function == AggregateFunction::Count) {
+      if (const auto null_count_filter = std::dynamic_pointer_cast<const NullCountFilter>(filter)) {
+        result.aggregate_count = null_count_filter->row_count() - null_count_filter->null_count();
+        return true;
+      }
+    } else if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      // Both filters are built from the sorted values of the segment, so their bounds are its minimum and maximum
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (const auto range_filter = std::dynamic_pointer_cast<const RangeFilter<ColumnDataType>>(filter)) {
+          const auto& ranges = range_filter->ranges();
+          result.current_aggregate =
+              function == AggregateFunction::Min ? ranges.front().first : ranges.back().second;
+          return true;
+        }
+      }
+      if (const auto min_max_filter = std::dynamic_pointer_cast<const MinMaxFilter<ColumnDataType>>(filter)) {
+        result.current_aggregate = function == AggregateFunction::Min ? min_max_filter->min() : min_max_filter->max();
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// The dictionary of a DictionarySegment holds exactly its distinct values. MIN, MAX and COUNT(DISTINCT) are computed
+// from the dictionary alone, the other aggregates from the number of occurrences of each ValueID.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void aggregate_ungrouped_dictionary_segment(const DictionarySegment<ColumnDataType>& segment,
+                                            AggregateResult<ColumnDataType, AggregateType>& result) {
+  const auto& dictionary = *segment.dictionary();
+
+  if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+    if (!dictionary.empty()) {
+      result.current_aggregate = function == AggregateFunction::Min ? dictionary.front() : dictionary.back();
+    }
+  } else if constexpr (function == AggregateFunction::CountDistinct ||
+                       function == AggregateFunction::ApproxCountDistinct) {
+    for (const auto& value : dictionary) {
+      add_distinct_value<ColumnDataType, AggregateType, function>(result, value);
+    }
+  } else {
+    const auto null_value_id = segment.null_value_id();
+    auto value_id_counts = std::vector<size_t>(null_value_id + 1);
+    for_each_value_id(*segment.attribute_vector(), [&](const auto /* chunk_offset */, const auto value_id) {
+      ++value_id_counts[value_id];
+    });
+    result.aggregate_count = segment.size() - value_id_counts[null_value_id];
+
+    if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Avg) &&
+                  std::is_arithmetic_v<AggregateType>) {
+      if (result.aggregate_count == 0) return;
+
+      auto sum = AggregateType{0};
+      for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+        if constexpr (std::is_integral_v<AggregateType>) {
+          sum = add_to_sum(sum, checked_multiply<AggregateType>(dictionary[value_id], value_id_counts[value_id]));
+        } else {
+          sum += static_cast<AggregateType>(dictionary[value_id]) *
+                 static_cast<AggregateType>(value_id_counts[value_id]);
+        }
+      }
+      result.current_aggregate = sum;
+    }
+  }
+}
+
+// The (approximate) COUNT(DISTINCT) of references to DictionarySegments marks the referenced ValueIDs of each chunk in
+// a bitmap and decodes each marked value once. Returns false if a referenced segment is not a DictionarySegment.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+bool aggregate_ungrouped_distinct_references(const ReferenceSegment& segment,
+                                             AggregateResult<ColumnDataType, AggregateType>& result) {
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+  const auto chunk_count = referenced_table.chunk_count();
+
+  auto dictionary_segments = std::vector<const DictionarySegment<ColumnDataType>*>(chunk_count);
+  auto decompressors = std::vector<std::unique_ptr<BaseVectorDecompressor>>(chunk_count);
+  auto value_id_bitmaps = std::vector<std::vector<bool>>(chunk_count);
+
+  for (const auto& row_id : *segment.pos_list()) {
+    if (row_id.is_null()) continue;
+
+    auto& decompressor = decompressors[row_id.chunk_id];
+    if (!decompressor) {
+      const auto referenced_segment = referenced_table.get_chunk(row_id.chunk_id)->get_segment(referenced_column_id);
+      const auto dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(referenced_segment.get());
+      if (!dictionary_segment) return false;
+
+      dictionary_segments[row_id.chunk_id] = dictionary_segment;
+      decompressor = dictionary_segment->attribute_vector()->create_base_decompressor();
+      value_id_bitmaps[row_id.chunk_id].resize(dictionary_segment->null_value_id() + 1);
+    }
+    value_id_bitmaps[row_id.chunk_id][decompressor->get(row_id.chunk_offset)] = true;
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto dictionary_segment = dictionary_segments[chunk_id];
+    if (!dictionary_segment) continue;
+
+    // The bit of the NULL ValueID follows those of the dictionary entries and is ignored
+    const auto& dictionary = *dictionary_segment->dictionary();
+    const auto& value_id_bitmap = value_id_bitmaps[chunk_id];
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      if (value_id_bitmap[value_id]) {
+        add_distinct_value<ColumnDataType, AggregateType, function>(result, dictionary[value_id]);
+      }
+    }
+  }
+  return true;
+}
+
+// All other segments are iterated. Arithmetic values are gathered into blocks, which are aggregated by loops without
+// branches that the compiler vectorizes.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void aggregate_ungrouped_segment(const BaseSegment& segment, AggregateResult<ColumnDataType, AggregateType>& result) {
+  if constexpr (!std::is_arithmetic_v<ColumnDataType>) {
+    auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) return;
+
+      aggregator(position.value(), result.current_aggregate);
+      ++result.aggregate_count;
+      add_distinct_value<ColumnDataType, AggregateType, function>(result, position.value());
+    });
+  } else {
+    auto values = std::array<ColumnDataType, UNGROUPED_BLOCK_SIZE>{};
+    auto null_values = std::array<bool, UNGROUPED_BLOCK_SIZE>{};
+    auto block_size = size_t{0};
+
+    const auto aggregate_block = [&]() {
+      auto value_count = size_t{0};
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        value_count += !null_values[index];
+      }
+      if (value_count == 0) return;
+      result.aggregate_count += value_count;
+
+      if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+        // NULLs are replaced by the neutral element, i.e., the largest value for MIN and the smallest for MAX
+        constexpr auto IS_MIN = function == AggregateFunction::Min;
+        constexpr auto NEUTRAL_VALUE =
+            std::numeric_limits<ColumnDataType>::has_infinity
+                ? (IS_MIN ? std::numeric_limits<ColumnDataType>::infinity()
+                          : -std::numeric_limits<ColumnDataType>::infinity())
+                : (IS_MIN ? std::numeric_limits<ColumnDataType>::max() : std::numeric_limits<ColumnDataType>::lowest());
+
+        auto block_aggregate = NEUTRAL_VALUE;
+        for (auto index = size_t{0}; index < block_size; ++index) {
+          const auto value = null_values[index] ? NEUTRAL_VALUE : values[index];
+          block_aggregate = (IS_MIN ? value < block_aggregate : value > block_aggregate) ? value : block_aggregate;
+        }
+        if (!result.current_aggregate || (IS_MIN ? block_aggregate < *result.current_aggregate
+                                                 : block_aggregate > *result.current_aggregate)) {
+          result.current_aggregate = block_aggregate;
+        }
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        auto block_sum = AggregateType{0};
+        if constexpr (std::is_integral_v<ColumnDataType> && std::is_integral_v<AggregateType> &&
+                      sizeof(ColumnDataType) >= sizeof(AggregateType)) {
+          // The overflow flags of the additions are collected and checked once per block
+          auto overflowed = false;
+          for (auto index = size_t{0}; index < block_size; ++index) {
+            overflowed |= __builtin_add_overflow(block_sum, null_values[index] ? ColumnDataType{0} : values[index],
+                                                 &block_sum);
+          }
+          if (overflowed) Fail("Integer overflow in SUM");
+        } else {
+          // The sum of a block of narrower integers cannot overflow
+          for (auto index = size_t{0}; index < block_size; ++index) {
+            block_sum += null_values[index] ? AggregateType{0} : static_cast<AggregateType>(values[index]);
+          }
+        }
+        result.current_aggregate =
+            result.current_aggregate ? add_to_sum(*result.current_aggregate, block_sum) : block_sum;
+      } else if constexpr (function == AggregateFunction::CountDistinct ||
+                           function == AggregateFunction::ApproxCountDistinct) {
+        for (auto index = size_t{0}; index < block_size; ++index) {
+          if (!null_values[index]) add_distinct_value<ColumnDataType, AggregateType, function>(result, values[index]);
+        }
+      }
+    };
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      null_values[block_size] = position.is_null();
+      values[block_size] = position.is_null() ? ColumnDataType{} : position.value();
+      if (++block_size == UNGROUPED_BLOCK_SIZE) {
+        aggregate_block();
+        block_size = 0;
+      }
+    });
+    aggregate_block();
+  }
+}
+
+// Merges the AggregateResult of a chunk into the @param result of the whole table
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void merge_ungrouped_result(const AggregateResult<ColumnDataType, AggregateType>& chunk_result,
+                            AggregateResult<ColumnDataType, AggregateType>& result) {
+  result.aggregate_count += chunk_result.aggregate_count;
+  if constexpr (function == AggregateFunction::CountDistinct) {
+    result.distinct_values.insert(chunk_result.distinct_values.cbegin(), chunk_result.distinct_values.cend());
+  } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+    result.hyper_log_log.merge(chunk_result.hyper_log_log);
+  }
+
+  if (!chunk_result.current_aggregate) return;
+  if (!result.current_aggregate) {
+    result.current_aggregate = chunk_result.current_aggregate;
+    return;
+  }
+
+  if constexpr (function == AggregateFunction::Min) {
+    if (value_smaller(*chunk_result.current_aggregate, *result.current_aggregate)) {
+      result.current_aggregate = chunk_result.current_aggregate;
+    }
+  } else if constexpr (function == AggregateFunction::Max) {
+    if (value_greater(*chunk_result.current_aggregate, *result.current_aggregate)) {
+      result.current_aggregate = chunk_result.current_aggregate;
+    }
+  } else if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Avg) &&
+                       std::is_arithmetic_v<AggregateType>) {
+    *result.current_aggregate = add_to_sum(*result.current_aggregate, *chunk_result.current_aggregate);
+  }
+}
+
+void Aggregate::_aggregate_ungrouped() {
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  auto timer = Timer{};
+
+  const auto input_table = input_table_left();
+  _validate_aggregates();
+
+  // Without a GROUP BY, there is one group if the input has rows, and none otherwise. The aggregates of each chunk are
+  // computed in their own AggregateResult first, i.e., as if every chunk was a group.
+  const auto chunk_count = input_table->chunk_count();
+  const auto row_count = input_table->row_count();
+  const auto group_row_ids =
+      row_count > 0 ? std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}} : std::vector<RowID>{};
+  const auto chunk_row_ids = std::vector<RowID>(chunk_count);
+
+  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  auto chunk_contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    const auto& aggregate = _aggregates[column_index];
+    if (!aggregate.column) {
+      // COUNT(*) is the number of rows of the input
+      auto context = std::make_shared<AggregateResultContext<CountColumnType, CountAggregateType>>(group_row_ids);
+      if (row_count > 0) context->results.front().aggregate_count = row_count;
+      _contexts_per_column[column_index] = context;
+      continue;
+    }
+
+    const auto data_type = input_table->column_data_type(*aggregate.column);
+    _contexts_per_column[column_index] = _create_aggregate_context(data_type, aggregate.function, group_row_ids);
+    chunk_contexts_per_column[column_index] = _create_aggregate_context(data_type, aggregate.function, chunk_row_ids);
+  }
+
+  // The statistics of a chunk describe its segments only if the chunk is not the result of an operator
+  const auto use_statistics = input_table->type() == TableType::Data;
+
+  MorselDispatcher{*input_table}.run([&](const size_t chunk_index) {
+    CancellationToken::throw_if_current_cancelled();
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto chunk = input_table->get_chunk(chunk_id);
+    const auto chunk_statistics = use_statistics ? chunk->statistics() : nullptr;
+
+    for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+      const auto& aggregate = _aggregates[column_index];
+      if (!aggregate.column) continue;
+
+      const auto& segment = *chunk->get_segment(*aggregate.column);
+      resolve_data_type(input_table->column_data_type(*aggregate.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        resolve_aggregate_function(aggregate.function, [&](const auto function_constant) {
+          constexpr auto FUNCTION = decltype(function_constant)::value;
+          using AggregateType = typename AggregateTraits<ColumnDataType, FUNCTION>::AggregateType;
+
+          auto& result = std::static_pointer_cast<AggregateResultContext<ColumnDataType, AggregateType>>(
+                             chunk_contexts_per_column[column_index])
+                             ->results[chunk_id];
+
+          if constexpr (FUNCTION == AggregateFunction::Min || FUNCTION == AggregateFunction::Max ||
+                        FUNCTION == AggregateFunction::Count) {
+            if (chunk_statistics &&
+                aggregate_ungrouped_from_statistics<ColumnDataType, AggregateType, FUNCTION>(
+                    *chunk_statistics->statistics()[*aggregate.column], result)) {
+              return;
+            }
+          }
+
+          if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment)) {
+            aggregate_ungrouped_dictionary_segment<ColumnDataType, AggregateType, FUNCTION>(*dictionary_segment,
+                                                                                            result);
+            return;
+          }
+
+          if constexpr (FUNCTION == AggregateFunction::CountDistinct ||
+                        FUNCTION == AggregateFunction::ApproxCountDistinct) {
+            const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+            if (reference_segment &&
+                aggregate_ungrouped_distinct_references<ColumnDataType, AggregateType, FUNCTION>(*reference_segment,
+                                                                                                 result)) {
+              return;
+            }
+          }
+
+          aggregate_ungrouped_segment<ColumnDataType, AggregateType, FUNCTION>(segment, result);
+        });
+      });
+    }
+  });
+
+  if (row_count > 0) {
+    for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+      const auto& aggregate = _aggregates[column_index];
+      if (!aggregate.column) continue;
+
+      resolve_data_type(input_table->column_data_type(*aggregate.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        resolve_aggregate_function(aggregate.function, [&](const auto function_constant) {
+          constexpr auto FUNCTION = decltype(function_constant)::value;
+          using AggregateType = typename AggregateTraits<ColumnDataType, FUNCTION>::AggregateType;
+          using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+          auto& result = std::static_pointer_cast<Context>(_contexts_per_column[column_index])->results.front();
+          for (const auto& chunk_result :
+               std::static_pointer_cast<Context>(chunk_contexts_per_column[column_index])->results) {
+            merge_ungrouped_result<ColumnDataType, AggregateType, FUNCTION>(chunk_result, result);
+          }
+        });
+      });
+    }
+  }
+
+  performance_data.aggregation = timer.lap();
+}
+
 template <typename AggregateKey>
 void Aggregate::_aggregate() {
   // We use monotonic_buffer_resource for the vector of vectors that hold the aggregate keys. That is so that we can
@@ -252,26 +702,16 @@ void Aggregate::_aggregate() {
   using AggregateKeysAllocator =
       boost::container::scoped_allocator_adaptor<PolymorphicAllocator<AggregateKeys<AggregateKey>>>;
 
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  auto timer = Timer{};
+
   auto input_table = input_table_left();
 
   for ([[maybe_unused]] const auto& groupby_column_id : _groupby_column_ids) {
     DebugAssert(groupby_column_id < input_table->column_count(), "GroupBy column index out of bounds");
   }
 
-  // check for invalid aggregates
-  for (const auto& aggregate : _aggregates) {
-    if (!aggregate.column) {
-      if (aggregate.function != AggregateFunction::Count) {
-        Fail("Aggregate: Asterisk is only valid with COUNT");
-      }
-    } else {
-      DebugAssert(*aggregate.column < input_table->column_count(), "Aggregate column index out of bounds");
-      if (input_table->column_data_type(*aggregate.column) == DataType::String &&
-          (aggregate.function == AggregateFunction::Sum || aggregate.function == AggregateFunction::Avg)) {
-        Fail("Aggregate: Cannot calculate SUM or AVG on string column");
-      }
-    }
-  }
+  _validate_aggregates();
 
   /*
   PARTITIONING PHASE
@@ -280,20 +720,22 @@ void Aggregate::_aggregate() {
   It is gradually built by visitors, one for each group segment.
   */
 
+  // Allocate a temporary memory buffer, for more details see aggregate.hpp
+  // This calculation assumes that we use pmr_vector<AggregateKeyEntry> - other data structures use less space, but
+  // that is fine
+  size_t needed_size_per_aggregate_key =
+      aligned_size<AggregateKey>() + _groupby_column_ids.size() * aligned_size<AggregateKeyEntry>();
+  size_t needed_size = aligned_size<KeysPerChunk<AggregateKey>>() +
+                       input_table->chunk_count() * aligned_size<AggregateKeys<AggregateKey>>() +
+                       input_table->row_count() * needed_size_per_aggregate_key;
+  needed_size *= 1.1;  // Give it a little bit more, just in case
+
+  // The buffer is declared before keys_per_chunk, so that it outlives the keys that are allocated in it
+  auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size);
+
   KeysPerChunk<AggregateKey> keys_per_chunk;
 
   {
-    // Allocate a temporary memory buffer, for more details see aggregate.hpp
-    // This calculation assumes that we use pmr_vector<AggregateKeyEntry> - other data structures use less space, but
-    // that is fine
-    size_t needed_size_per_aggregate_key =
-        aligned_size<AggregateKey>() + _groupby_column_ids.size() * aligned_size<AggregateKeyEntry>();
-    size_t needed_size = aligned_size<KeysPerChunk<AggregateKey>>() +
-                         input_table->chunk_count() * aligned_size<AggregateKeys<AggregateKey>>() +
-                         input_table->row_count() * needed_size_per_aggregate_key;
-    needed_size *= 1.1;  // Give it a little bit more, just in case
-
-    auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size);
     auto allocator = AggregateKeysAllocator{PolymorphicAllocator<AggregateKeys<AggregateKey>>{&temp_buffer}};
     allocator.allocate(1);  // Make sure that the buffer is initialized
     const auto start_next_buffer_size = temp_buffer.next_buffer_size();
@@ -336,39 +778,56 @@ void Aggregate::_aggregate() {
         The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
         */
 
-        // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
-        // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
-        // allocate a bit too much.
-        auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
-        auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
+        auto id_map = AggregateHashTable<ColumnDataType>{};
 
-        auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
-                                         std::equal_to<ColumnDataType>, decltype(allocator)>(allocator);
-        AggregateKeyEntry id_counter = 1u;
+        const auto write_key_entry = [&](const ChunkID chunk_id, const ChunkOffset chunk_offset,
+                                         const AggregateKeyEntry id) {
+          if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+            keys_per_chunk[chunk_id][chunk_offset] = id;
+          } else {
+            keys_per_chunk[chunk_id][chunk_offset][group_column_index] = id;
+          }
+        };
 
         for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+          // Each job processes a whole column, so it checks for cancellation between the chunks
+          CancellationToken::throw_if_current_cancelled();
+
           const auto chunk_in = input_table->get_chunk(chunk_id);
           const auto base_segment = chunk_in->get_segment(column_id);
 
+          /*
+          For dictionary-encoded segments, only the distinct values of the dictionary are looked up in the id_map. The
+          rows are then mapped to their IDs through a dense vector indexed by ValueID, so that no value is hashed or
+          compared per row. The NULL ValueID maps to the reserved ID 0.
+          */
+          if (const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(base_segment)) {
+            const auto null_value_id = dictionary_segment->null_value_id();
+            const auto unique_values_count = dictionary_segment->unique_values_count();
+            DebugAssert(null_value_id >= unique_values_count, "Expected the NULL ValueID after all dictionary entries");
+
+            auto ids_by_value_id = std::vector<AggregateKeyEntry>(null_value_id + 1, 0u);
+            for (ValueID value_id{0}; value_id < unique_values_count; ++value_id) {
+              const auto value = type_cast_variant<ColumnDataType>(dictionary_segment->value_of_value_id(value_id));
+              ids_by_value_id[value_id] = id_map.find_or_insert(value, std::hash<ColumnDataType>{}(value)).first + 1;
+            }
+
+            const auto& attribute_vector = *dictionary_segment->attribute_vector();
+            for_each_value_id(attribute_vector, [&](const auto chunk_offset, const auto value_id) {
+              write_key_entry(chunk_id, chunk_offset, ids_by_value_id[value_id]);
+            });
+            continue;
+          }
+
           ChunkOffset chunk_offset{0};
           segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
             if (position.is_null()) {
-              if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                keys_per_chunk[chunk_id][chunk_offset] = 0u;
-              } else {
-                keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
-              }
+              write_key_entry(chunk_id, chunk_offset, 0u);
             } else {
-              auto inserted = id_map.try_emplace(position.value(), id_counter);
-              // store either the current id_counter or the existing ID of the value
-              if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                keys_per_chunk[chunk_id][chunk_offset] = inserted.first->second;
-              } else {
-                keys_per_chunk[chunk_id][chunk_offset][group_column_index] = inserted.first->second;
-              }
-
-              // if the id_map didn't have the value as a key and a new element was inserted
-              if (inserted.second) ++id_counter;
+              // Either a new ID for the value or its existing one, shifted by one because 0 is reserved for NULL
+              const auto& value = position.value();
+              write_key_entry(chunk_id, chunk_offset,
+                              id_map.find_or_insert(value, std::hash<ColumnDataType>{}(value)).first + 1);
             }
 
             ++chunk_offset;
@@ -380,6 +839,155 @@ void Aggregate::_aggregate() {
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
+  performance_data.key_extraction = timer.lap();
+
+  /*
+  GROUPING PHASE
+  Next, every row gets the AggregateResultId of its group, i.e., the index of the group's AggregateResult. This is done
+  in two steps, so that no step has to look at all rows on a single thread:
+   1. Every chunk groups its own rows in a chunk-local AggregateHashTable. The chunk-local groups are partitioned by the hash of
+      their AggregateKey.
+   2. Every partition merges the chunk-local groups that fall into it. As equal AggregateKeys always end up in the same
+      partition, the partitions are disjoint and can be merged independently.
+  Afterwards, the group ids of all partitions are concatenated and the rows are mapped to these global ids.
+  */
+  const auto chunk_count = input_table->chunk_count();
+  const auto partition_count = CurrentScheduler::is_set() ? GROUPING_PARTITION_COUNT : size_t{1};
+
+  auto result_ids_per_chunk = AggregateResultIdsPerChunk(chunk_count);
+  auto local_groups_per_chunk = std::vector<std::vector<std::vector<LocalGroup>>>(chunk_count);
+
+  // Maps chunk-local group ids to ids within the partition first, and to the global AggregateResultIds later
+  auto local_to_global_result_ids_per_chunk = std::vector<std::vector<AggregateResultId>>(chunk_count);
+
+  // The chunks are processed in morsels, see MorselDispatcher
+  auto chunk_sizes = std::vector<size_t>(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_sizes[chunk_id] = keys_per_chunk[chunk_id].size();
+  }
+  const auto morsel_dispatcher = MorselDispatcher{chunk_sizes};
+
+  morsel_dispatcher.run([&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto& keys = keys_per_chunk[chunk_id];
+    auto& result_ids = result_ids_per_chunk[chunk_id];
+    auto& local_groups = local_groups_per_chunk[chunk_id];
+
+    result_ids.resize(keys.size());
+    local_groups.resize(partition_count);
+
+    const auto chunk_size = static_cast<ChunkOffset>(keys.size());
+
+    // In a chunk that is sorted by the only group-by column, the rows of each group are consecutive. Thus, the groups
+    // are found by comparing each key to the previous one, without probing a hash table (stream aggregation).
+    const auto& ordered_by = input_table->get_chunk(chunk_id)->ordered_by();
+    if (_groupby_column_ids.size() == 1 && ordered_by && ordered_by->first == _groupby_column_ids.front()) {
+      auto local_group_count = AggregateResultId{0};
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto& key = keys[chunk_offset];
+        if (chunk_offset == 0 || !(key == keys[chunk_offset - 1])) {
+          const auto hash = std::hash<AggregateKey>{}(key);
+          local_groups[hash % partition_count].emplace_back(LocalGroup{local_group_count, chunk_offset, hash});
+          ++local_group_count;
+        }
+        result_ids[chunk_offset] = local_group_count - 1;
+      }
+
+      local_to_global_result_ids_per_chunk[chunk_id].resize(local_group_count);
+      return;
+    }
+
+    // The keys of a single group-by column are dense ids, e.g., those of the dictionary entries for SELECT DISTINCT on
+    // a dictionary-encoded column. Unless they are much larger than the chunk, the groups are found through a vector
+    // indexed by the keys instead of a hash table.
+    if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+      const auto max_key = chunk_size == 0 ? AggregateKeyEntry{0} : *std::max_element(keys.begin(), keys.end());
+      if (max_key < DENSE_GROUPING_FACTOR * chunk_size) {
+        constexpr auto NO_RESULT_ID = std::numeric_limits<AggregateResultId>::max();
+        auto local_result_id_by_key = std::vector<AggregateResultId>(max_key + 1, NO_RESULT_ID);
+
+        auto local_group_count = AggregateResultId{0};
+        for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          const auto key = keys[chunk_offset];
+          auto& local_result_id = local_result_id_by_key[key];
+          if (local_result_id == NO_RESULT_ID) {
+            local_result_id = local_group_count++;
+            const auto hash = std::hash<AggregateKey>{}(key);
+            local_groups[hash % partition_count].emplace_back(LocalGroup{local_result_id, chunk_offset, hash});
+          }
+          result_ids[chunk_offset] = local_result_id;
+        }
+
+        local_to_global_result_ids_per_chunk[chunk_id].resize(local_group_count);
+        return;
+      }
+    }
+
+    auto local_result_ids = AggregateHashTable<AggregateKey>{};
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto& key = keys[chunk_offset];
+      const auto hash = std::hash<AggregateKey>{}(key);
+      const auto [local_result_id, inserted] = local_result_ids.find_or_insert(key, hash);
+      if (inserted) {
+        local_groups[hash % partition_count].emplace_back(LocalGroup{local_result_id, chunk_offset, hash});
+      }
+      result_ids[chunk_offset] = local_result_id;
+    }
+
+    local_to_global_result_ids_per_chunk[chunk_id].resize(local_result_ids.size());
+  });
+
+  auto group_row_ids_per_partition = std::vector<std::vector<RowID>>(partition_count);
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& group_row_ids = group_row_ids_per_partition[partition_id];
+
+      auto partition_result_ids = AggregateHashTable<AggregateKey>{};
+
+      // Visiting the chunks in order keeps the first occurrence of each group as its representative row
+      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+        CancellationToken::throw_if_current_cancelled();
+        auto& local_to_global_result_ids = local_to_global_result_ids_per_chunk[chunk_id];
+
+        for (const auto& local_group : local_groups_per_chunk[chunk_id][partition_id]) {
+          const auto& key = keys_per_chunk[chunk_id][local_group.chunk_offset];
+          const auto [partition_result_id, inserted] = partition_result_ids.find_or_insert(key, local_group.hash);
+          if (inserted) group_row_ids.emplace_back(chunk_id, local_group.chunk_offset);
+          local_to_global_result_ids[local_group.local_result_id] = partition_result_id;
+        }
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  auto partition_offsets = std::vector<AggregateResultId>(partition_count);
+  auto group_row_ids = std::vector<RowID>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    partition_offsets[partition_id] = group_row_ids.size();
+    const auto& partition_group_row_ids = group_row_ids_per_partition[partition_id];
+    group_row_ids.insert(group_row_ids.end(), partition_group_row_ids.begin(), partition_group_row_ids.end());
+  }
+
+  morsel_dispatcher.run([&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    auto& local_to_global_result_ids = local_to_global_result_ids_per_chunk[chunk_id];
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      for (const auto& local_group : local_groups_per_chunk[chunk_id][partition_id]) {
+        local_to_global_result_ids[local_group.local_result_id] += partition_offsets[partition_id];
+      }
+    }
+
+    for (auto& result_id : result_ids_per_chunk[chunk_id]) {
+      result_id = local_to_global_result_ids[result_id];
+    }
+  });
+
+  performance_data.grouping = timer.lap();
 
   /*
   AGGREGATION PHASE
@@ -388,18 +996,31 @@ void Aggregate::_aggregate() {
 
   if (_aggregates.empty()) {
     /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+    DISTINCT implementation
+
+    In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+
+    For a query like "SELECT DISTINCT * FROM A;"
+    we would assume that all columns from A are part of 'groupby_columns',
+    respectively any columns that were specified in the projection.
+    The optimizer is responsible to take care of passing in the correct columns.
+
+    The distinct rows have already been found in the grouping phase. In order to reuse the output implementation, we
+    insert a dummy context with one AggregateResult per group. That way, _contexts_per_column will always have at least
+    one context with results. This is important later on when we write the group keys into the table.
 
     We choose int8_t for column type and aggregate type because it's small.
+
+    Obviously this implementation is also used for plain GroupBy's.
     */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
+    auto context = std::make_shared<AggregateResultContext<DistinctColumnType, DistinctAggregateType>>(group_row_ids);
     _contexts_per_column.push_back(context);
+    performance_data.aggregation = timer.lap();
+    return;
   }
 
   /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * Create an AggregateResultContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
    * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
    * and _write_aggregate_output() needs these contexts anyway.
    */
@@ -407,126 +1028,97 @@ void Aggregate::_aggregate() {
     const auto& aggregate = _aggregates[column_id];
     if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
+      auto context = std::make_shared<AggregateResultContext<CountColumnType, CountAggregateType>>(group_row_ids);
       _contexts_per_column[column_id] = context;
       continue;
     }
     auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
+    _contexts_per_column[column_id] = _create_aggregate_context(data_type, aggregate.function, group_row_ids);
   }
 
-  // Process Chunks and perform aggregations
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    auto chunk_in = input_table->get_chunk(chunk_id);
-
-    const auto& hash_keys = keys_per_chunk[chunk_id];
+  // Every aggregate writes only to its own context, so the aggregates are computed in parallel
+  jobs.clear();
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_index]() {
+      const auto& aggregate = _aggregates[column_index];
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (_aggregates.empty()) {
       /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the result ids of all rows and count the occurrences of each group.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
        */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-      }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[column_index]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          // count occurrences for each group key
-          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-            auto& result =
-                get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-            ++result.aggregate_count;
+      if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+        auto context = std::static_pointer_cast<AggregateResultContext<CountColumnType, CountAggregateType>>(
+            _contexts_per_column[column_index]);
+        auto& results = context->results;
+
+        for (const auto& result_ids : result_ids_per_chunk) {
+          for (const auto result_id : result_ids) {
+            ++results[result_id].aggregate_count;
           }
-
-          ++column_index;
-          continue;
         }
+        return;
+      }
+
+      const auto data_type = input_table->column_data_type(*aggregate.column);
 
-        auto base_segment = chunk_in->get_segment(*aggregate.column);
-        auto data_type = input_table->column_data_type(*aggregate.column);
+      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+        CancellationToken::throw_if_current_cancelled();
+        const auto base_segment = input_table->get_chunk(chunk_id)->get_segment(*aggregate.column);
 
         /*
         Invoke correct aggregator for each segment
         */
-
-        resolve_data_type(data_type, [&, aggregate](auto type) {
+        resolve_data_type(data_type, [&](auto type) {
           using ColumnDataType = typename decltype(type)::type;
 
           switch (aggregate.function) {
             case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Min>(chunk_id, column_index, *base_segment,
+                                                                         result_ids_per_chunk);
               break;
             case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Max>(chunk_id, column_index, *base_segment,
+                                                                         result_ids_per_chunk);
               break;
             case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Sum>(chunk_id, column_index, *base_segment,
+                                                                         result_ids_per_chunk);
               break;
             case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Avg>(chunk_id, column_index, *base_segment,
+                                                                         result_ids_per_chunk);
               break;
             case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                         *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::Count>(chunk_id, column_index, *base_segment,
+                                                                           result_ids_per_chunk);
               break;
             case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
+              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct>(chunk_id, column_index,
+                                                                                   *base_segment, result_ids_per_chunk);
+              break;
+            case AggregateFunction::ApproxCountDistinct:
+              _aggregate_segment<ColumnDataType, AggregateFunction::ApproxCountDistinct>(
+                  chunk_id, column_index, *base_segment, result_ids_per_chunk);
               break;
           }
         });
-
-        ++column_index;
       }
-    }
+    }));
+    jobs.back()->schedule();
   }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+  performance_data.aggregation = timer.lap();
+}
+
+std::vector<std::pair<std::string, std::chrono::nanoseconds>> Aggregate::PerformanceData::step_walltimes() const {
+  return {{"key_extraction", key_extraction},
+          {"grouping", grouping},
+          {"aggregation", aggregation},
+          {"output_writing", output_writing}};
 }
 
 std::shared_ptr<const Table> Aggregate::_on_execute() {
@@ -535,6 +1127,9 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   // Also, we need to make sure that there are tests for at least the first case, one array case, and the fallback.
   switch (_groupby_column_ids.size()) {
     case 0:
+      // Without a GROUP BY, the aggregates are computed chunk by chunk and no AggregateKeys are needed
+      _aggregate_ungrouped();
+      break;
     case 1:
       // No need for a complex data structure if we only have one entry
       _aggregate<AggregateKeyEntry>();
@@ -549,6 +1144,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
       break;
   }
 
+  auto timer = Timer{};
+
   const auto& input_table = input_table_left();
 
   /**
@@ -590,6 +1187,7 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   auto output = std::make_shared<Table>(_output_column_definitions, TableType::Data);
   output->append_chunk(_output_segments);
 
+  static_cast<PerformanceData&>(*_performance_data).output_writing = timer.lap();
   return output;
 }
 
@@ -656,6 +1254,23 @@ std::enable_if_t<func == AggregateFunction::CountDistinct, void> write_aggregate
   }
 }
 
+// APPROX_COUNT_DISTINCT writes the estimated number of distinct values
+template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
+std::enable_if_t<func == AggregateFunction::ApproxCountDistinct, void> write_aggregate_values(
+    std::shared_ptr<ValueSegment<AggregateType>> segment,
+    const AggregateResults<ColumnDataType, AggregateType>& results) {
+  DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
+
+  auto& values = segment->values();
+  values.resize(results.size());
+
+  size_t i = 0;
+  for (const auto& result : results) {
+    values[i] = static_cast<AggregateType>(result.hyper_log_log.estimate());
+    ++i;
+  }
+}
+
 // AVG writes the calculated average from current aggregate and the aggregate counter
 template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
 std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
@@ -753,6 +1368,9 @@ void Aggregate::_write_aggregate_output(boost::hana::basic_type<ColumnDataType>
     case AggregateFunction::CountDistinct:
       write_aggregate_output<ColumnDataType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
   }
 }
 
@@ -802,7 +1420,8 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   }
 
   // write aggregated values into the segment
-  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
+  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct &&
+                               function != AggregateFunction::ApproxCountDistinct);
   _output_column_definitions.emplace_back(column_name_stream.str(), aggregate_data_type, NEEDS_NULL);
 
   auto output_segment = std::make_shared<ValueSegment<decltype(aggregate_type)>>(NEEDS_NULL);
@@ -812,7 +1431,7 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   } else if (_groupby_column_ids.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
     output_segment->values().push_back(decltype(aggregate_type){});
-    if (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct) {
+    if constexpr (NEEDS_NULL) {
       output_segment->null_values().push_back(true);
     }
   }
@@ -820,42 +1439,47 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   _output_segments.push_back(output_segment);
 }
 
-template <typename AggregateKey>
-std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(const DataType data_type,
-                                                                            const AggregateFunction function) const {
+std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(
+    const DataType data_type, const AggregateFunction function, const std::vector<RowID>& group_row_ids) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
     switch (function) {
       case AggregateFunction::Min:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Max:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Sum:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Avg:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Count:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::CountDistinct:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType>>(
+            group_row_ids);
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType,
+            typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxCountDistinct>::AggregateType>>(
+            group_row_ids);
         break;
     }
   });
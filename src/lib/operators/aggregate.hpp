@@ -3,6 +3,7 @@
 #include <boost/container/pmr/polymorphic_allocator.hpp>
 #include <boost/container/scoped_allocator.hpp>
 #include <boost/functional/hash.hpp>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -14,6 +15,7 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "aggregate/hyper_log_log.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_segment_visitor.hpp"
@@ -45,6 +47,13 @@ Operator to aggregate columns by certain functions, such as min, max, sum, avera
  with reference segments. As with most operators we do not guarantee a stable operation with regards to positions -
  i.e. your sorting order.
 
+Grouping runs in two phases: every chunk first groups its own rows, then the chunk-local groups are merged in hash
+ partitions. Both phases run in parallel if a scheduler is active. The aggregates are computed per column in parallel.
+
+Without GROUP BY columns, no grouping is needed: every chunk computes all aggregates on its own, in parallel, and the
+ results of the chunks are merged. MIN, MAX and COUNT are taken from the chunk statistics of stored tables, dictionary
+ segments are aggregated through their dictionaries, and COUNT(*) is the row count of the input.
+
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Aggregate-Operator
 */
 
@@ -58,6 +67,7 @@ struct AggregateResult {
   std::optional<AggregateType> current_aggregate;
   size_t aggregate_count = 0;
   std::set<ColumnDataType> distinct_values;
+  HyperLogLog hyper_log_log;
   RowID row_id;
 };
 
@@ -66,14 +76,8 @@ template <typename ColumnDataType, typename AggregateType>
 using AggregateResults = pmr_vector<AggregateResult<ColumnDataType, AggregateType>>;
 using AggregateResultId = size_t;
 
-// The AggregateResultIdMap maps AggregateKeys to their index in the list of aggregate results.
-template <typename AggregateKey>
-using AggregateResultIdMapAllocator = PolymorphicAllocator<std::pair<const AggregateKey, AggregateResultId>>;
-
-template <typename AggregateKey>
-using AggregateResultIdMap =
-    std::unordered_map<AggregateKey, AggregateResultId, std::hash<AggregateKey>, std::equal_to<AggregateKey>,
-                       AggregateResultIdMapAllocator<AggregateKey>>;
+// AggregateKeys are mapped to their index in the list of aggregate results by an AggregateHashTable, see
+// aggregate/aggregate_hash_table.hpp
 
 /*
 The key type that is used for the aggregation map.
@@ -86,6 +90,9 @@ using AggregateKeys = pmr_vector<AggregateKey>;
 template <typename AggregateKey>
 using KeysPerChunk = pmr_vector<AggregateKeys<AggregateKey>>;
 
+// For each row of each chunk, the AggregateResultId of the row's group
+using AggregateResultIdsPerChunk = std::vector<std::vector<AggregateResultId>>;
+
 /**
  * Types that are used for the special COUNT(*) and DISTINCT implementations
  */
@@ -108,6 +115,15 @@ class Aggregate : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  struct PerformanceData : public OperatorPerformanceData {
+    std::chrono::nanoseconds key_extraction{0};
+    std::chrono::nanoseconds grouping{0};
+    std::chrono::nanoseconds aggregation{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> step_walltimes() const override;
+  };
+
   // write the aggregated output for a given aggregate column
   template <typename ColumnDataType, AggregateFunction function>
   void write_aggregate_output(ColumnID column_index);
@@ -118,6 +134,10 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  void _aggregate_ungrouped();
+
+  void _validate_aggregates() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -132,13 +152,13 @@ class Aggregate : public AbstractReadOnlyOperator {
 
   void _write_groupby_output(PosList& pos_list);
 
-  template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
+  template <typename ColumnDataType, AggregateFunction function>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          const AggregateResultIdsPerChunk& result_ids_per_chunk);
 
-  template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction function) const;
+                                                                   const AggregateFunction function,
+                                                                   const std::vector<RowID>& group_row_ids) const;
 
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
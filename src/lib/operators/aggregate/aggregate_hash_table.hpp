@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Open-addressing hash table that maps the keys of the groups in Aggregate to dense ids (0, 1, 2, ...) in the order of
+ * their insertion. Unlike a node-based std::unordered_map, it does not allocate per group:
+ *
+ *  - The slots are a single, flat vector that only holds the hash and the id of a group. They are probed linearly and
+ *    the hashes are compared before the keys, so that a probe typically touches a single cache line.
+ *  - The keys are stored once, in a separate vector that is indexed by id.
+ *
+ * The callers already need the hash of a key (e.g., to partition the groups), so it is passed in instead of being
+ * recomputed. Growing the table only rehashes the stored hashes and leaves the keys untouched.
+ */
+template <typename Key>
+class AggregateHashTable {
+ public:
+  using Id = size_t;
+
+  explicit AggregateHashTable(const size_t expected_size = 0) {
+    auto capacity = MIN_CAPACITY;
+    while (capacity < expected_size * 2) capacity *= 2;
+    _resize_slots(capacity);
+    _keys.reserve(expected_size);
+  }
+
+  // Returns the id of the group with the given key and whether the group has been newly inserted
+  std::pair<Id, bool> find_or_insert(const Key& key, const size_t hash) {
+    // Keep the load factor at or below 0.5, linear probing degrades quickly beyond that
+    if ((_keys.size() + 1) * 2 > _slots.size()) _resize_slots(_slots.size() * 2);
+
+    const auto slot_mask = _slots.size() - 1;
+    for (auto slot_idx = _slot_index(hash);; slot_idx = (slot_idx + 1) & slot_mask) {
+      auto& slot = _slots[slot_idx];
+      if (slot.id == EMPTY_ID) {
+        slot = Slot{hash, _keys.size()};
+        _keys.emplace_back(key);
+        return {slot.id, true};
+      }
+      if (slot.hash == hash && _keys[slot.id] == key) return {slot.id, false};
+    }
+  }
+
+  size_t size() const { return _keys.size(); }
+
+  // The keys of all groups, indexed by their id
+  const std::vector<Key>& keys() const { return _keys; }
+
+ protected:
+  struct Slot {
+    size_t hash;
+    Id id;
+  };
+
+  static constexpr auto EMPTY_ID = std::numeric_limits<Id>::max();
+  static constexpr auto MIN_CAPACITY = size_t{16};
+
+  // Fibonacci hashing uses the upper bits of the scrambled hash. Hash functions such as std::hash<uint64_t> are the
+  // identity, and callers that partition by the lower bits would otherwise only ever hit a fraction of the slots.
+  size_t _slot_index(const size_t hash) const {
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * uint64_t{11'400'714'819'323'198'485u}) >> _shift);
+  }
+
+  void _resize_slots(const size_t capacity) {
+    DebugAssert((capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+
+    _shift = 64;
+    for (auto remaining_capacity = capacity; remaining_capacity > 1; remaining_capacity /= 2) --_shift;
+
+    auto old_slots = std::vector<Slot>(capacity, Slot{0, EMPTY_ID});
+    std::swap(old_slots, _slots);
+
+    const auto slot_mask = capacity - 1;
+    for (const auto& old_slot : old_slots) {
+      if (old_slot.id == EMPTY_ID) continue;
+
+      auto slot_idx = _slot_index(old_slot.hash);
+      while (_slots[slot_idx].id != EMPTY_ID) slot_idx = (slot_idx + 1) & slot_mask;
+      _slots[slot_idx] = old_slot;
+    }
+  }
+
+  std::vector<Slot> _slots;
+  size_t _shift{64};
+  std::vector<Key> _keys;
+};
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., 2007) that estimates the number of distinct values of APPROX_COUNT_DISTINCT in
+ * constant memory. The first PRECISION bits of a value's hash select one of 2^PRECISION registers, which keeps the
+ * largest number of leading zeros plus one that any of the remaining bits of its hashes had. With 2^12 registers, the
+ * standard error of the estimate is about 1.6%.
+ *
+ * The registers are only allocated once the first value is added, as Aggregate holds a sketch for every group of every
+ * aggregate. Sketches are merged by taking the maximum of each register, so that they can be built per chunk.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = uint32_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  // Adds a value by its @param hash, which has to be well distributed over all 64 bits (see mix_hash())
+  void add(const uint64_t hash) {
+    if (_registers.empty()) _registers.resize(REGISTER_COUNT);
+
+    const auto register_index = hash >> (64 - PRECISION);
+    // The sentinel bit bounds the number of leading zeros of the remaining bits if all of them are zero
+    const auto remaining_bits = (hash << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+    _registers[register_index] = std::max(_registers[register_index], rank);
+  }
+
+  void merge(const HyperLogLog& other) {
+    if (other._registers.empty()) return;
+    if (_registers.empty()) {
+      _registers = other._registers;
+      return;
+    }
+
+    for (auto register_index = size_t{0}; register_index < REGISTER_COUNT; ++register_index) {
+      _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+    }
+  }
+
+  uint64_t estimate() const {
+    if (_registers.empty()) return 0;
+
+    auto inverse_sum = 0.0;
+    auto zero_register_count = size_t{0};
+    for (const auto rank : _registers) {
+      inverse_sum += std::ldexp(1.0, -rank);
+      zero_register_count += rank == 0;
+    }
+
+    const auto register_count = static_cast<double>(REGISTER_COUNT);
+    const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+    const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+    // For small cardinalities, linear counting on the empty registers is more accurate. With 64-bit hashes, no
+    // correction for hash collisions of large cardinalities is needed.
+    if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+      return static_cast<uint64_t>(
+          std::llround(register_count * std::log(register_count / static_cast<double>(zero_register_count))));
+    }
+    return static_cast<uint64_t>(std::llround(raw_estimate));
+  }
+
+  // Spreads the bits of a hash like std::hash, which is the identity for integers, over all 64 bits (the finalizer of
+  // MurmurHash3)
+  static uint64_t mix_hash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb3fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+ protected:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
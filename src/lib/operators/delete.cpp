@@ -1,10 +1,15 @@
 #include "delete.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "logging/log_record.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
@@ -51,8 +56,8 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
     for (auto row_id : *pos_list) {
       auto referenced_chunk = first_segment->referenced_table()->get_chunk(row_id.chunk_id);
 
-      // Scope for the lock on the MVCC data
-      {
+      // Scope for the access to the MVCC data, repeated while the chunk replaces it (see Chunk::shrink_mvcc_data())
+      while (true) {
         auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
 
         DebugAssert(
@@ -61,11 +66,19 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
                                      mvcc_data->end_cids[row_id.chunk_offset]),
             "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
 
+        // The chunk's visibility summary must not claim that the row is unlocked anymore
+        mvcc_data->invalidate_visibility_summary();
+
         // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
         auto expected = 0u;
         const auto success = mvcc_data->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
 
         if (!success) {
+          if (expected == MvccData::SHRINK_TRANSACTION_ID) {
+            std::this_thread::yield();
+            continue;
+          }
+
           // If the row has a set TID, it might be a row that our TX inserted
           // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
           // change this row from the initial tid
@@ -79,6 +92,8 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
             return nullptr;
           }
         }
+
+        break;
       }
     }
   }
@@ -93,6 +108,7 @@ void Delete::_on_commit_records(const CommitID cid) {
     const auto referencing_segment =
         std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
     const auto referenced_table = referencing_segment->referenced_table();
+    referenced_table->raise_last_commit_id(cid);
 
     for (const auto& row_id : *referencing_segment->pos_list()) {
       auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
@@ -109,6 +125,55 @@ void Delete::_on_commit_records(const CommitID cid) {
   }
 }
 
+void Delete::_on_log_records(LogRecord& log_record) const {
+  const auto catalog = StorageManager::get().catalog();
+  const auto& tables = catalog->tables;
+
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+    const auto referenced_table = referencing_segment->referenced_table();
+    const auto& pos_list = *referencing_segment->pos_list();
+
+    // The log refers to tables by their names
+    const auto table_iter = std::find_if(tables.cbegin(), tables.cend(), [&](const auto& name_and_table) {
+      return name_and_table.second == referenced_table;
+    });
+
+    if (table_iter != tables.cend()) {
+      auto& deleted_row_ids = log_record.table_changes[table_iter->first].deleted_row_ids;
+      deleted_row_ids.insert(deleted_row_ids.end(), pos_list.begin(), pos_list.end());
+      continue;
+    }
+
+    // If GetTable pruned chunks, the rows reference a copy of the stored table, whose ChunkIDs differ. Find the
+    // stored table and ChunkID of each referenced chunk.
+    auto stored_chunks = std::unordered_map<ChunkID, std::pair<std::string, ChunkID>>{};
+    for (const auto& row_id : pos_list) {
+      auto stored_chunk_iter = stored_chunks.find(row_id.chunk_id);
+      if (stored_chunk_iter == stored_chunks.end()) {
+        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+        for (const auto& [table_name, table] : tables) {
+          for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+            if (table->get_chunk(chunk_id) != referenced_chunk) continue;
+            stored_chunk_iter =
+                stored_chunks.emplace(row_id.chunk_id, std::make_pair(table_name, chunk_id)).first;
+            break;
+          }
+          if (stored_chunk_iter != stored_chunks.end()) break;
+        }
+        Assert(stored_chunk_iter != stored_chunks.end(),
+               "Cannot log deletes from tables that are not in the StorageManager");
+      }
+
+      const auto& [table_name, chunk_id] = stored_chunk_iter->second;
+      log_record.table_changes[table_name].deleted_row_ids.emplace_back(chunk_id, row_id.chunk_offset);
+    }
+  }
+}
+
 void Delete::_on_rollback_records() {
   for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
        ++referencing_chunk_id) {
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -12,7 +11,8 @@
 namespace opossum {
 
 /**
- * Note: Difference does not support null values at the moment
+ * Returns the rows of the left input that have no row with the same values in the right input, including duplicates
+ * (see find_rows_in_table()). The rows are hashed instead of compared as a whole, chunk by chunk in parallel.
  */
 class Difference : public AbstractReadOnlyOperator {
  public:
@@ -27,8 +27,5 @@ class Difference : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
-
- private:
-  void _append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant& value);
 };
 }  // namespace opossum
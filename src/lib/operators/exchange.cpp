@@ -0,0 +1,55 @@
+#include "exchange.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "storage/partition_schema.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Exchange::Exchange(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                   const PartitionID partition_count)
+    : AbstractReadOnlyOperator(OperatorType::Exchange, in), _column_id(column_id), _partition_count(partition_count) {
+  Assert(partition_count > 0, "Exchange needs at least one partition");
+}
+
+const std::string Exchange::name() const { return "Exchange"; }
+
+const std::string Exchange::description(DescriptionMode description_mode) const {
+  auto column_name = std::string("Column #") + std::to_string(_column_id);
+  if (input_table_left()) column_name = input_table_left()->column_name(_column_id);
+
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "Hash(" + column_name + ") " + std::to_string(_partition_count) + " partitions";
+}
+
+ColumnID Exchange::column_id() const { return _column_id; }
+
+PartitionID Exchange::partition_count() const { return _partition_count; }
+
+std::shared_ptr<const Table> Exchange::_on_execute() {
+  const auto input_table = input_table_left();
+
+  const auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::Data,
+                                                    Table::choose_max_chunk_size(input_table->row_count()));
+  output_table->set_partition_schema(PartitionSchema::hash_partitioning(
+      _column_id, input_table->column_data_type(_column_id), _partition_count));
+
+  // The rows are appended to the last chunk of their partition, which assigns them like the rows of stored tables
+  output_table->append_rows(*input_table);
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> Exchange::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Exchange>(copied_input_left, _column_id, _partition_count);
+}
+
+void Exchange::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
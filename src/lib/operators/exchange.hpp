@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Shuffles the rows of its input into the hash partitions of the column with the column_id, i.e., materializes them
+ * into a data table that is hash-partitioned by the column into partition_count partitions (see PartitionSchema). Each
+ * chunk of the output thus holds the rows of a single partition, and JoinHash joins the output with a table that is
+ * partitioned alike partition by partition (see ExchangePlacementRule).
+ */
+class Exchange : public AbstractReadOnlyOperator {
+ public:
+  Exchange(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+           const PartitionID partition_count);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  ColumnID column_id() const;
+  PartitionID partition_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const ColumnID _column_id;
+  const PartitionID _partition_count;
+};
+
+}  // namespace opossum
@@ -1,12 +1,27 @@
 #include "export_binary.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "import_export/binary.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/histograms/equal_distinct_count_histogram.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/null_count_filter.hpp"
+#include "statistics/chunk_statistics/range_filter.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
@@ -21,11 +36,11 @@
 
 namespace {
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the stream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& stream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the string are
+/* Writes the given strings to the stream. First an array of string lengths is written. After that the string are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
@@ -33,7 +48,7 @@ void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values)
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
 template <typename Alloc>
-void export_string_values(std::ofstream& ofstream, const std::vector<std::string, Alloc>& values) {
+void export_string_values(std::ostream& stream, const std::vector<std::string, Alloc>& values) {
   std::vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -43,7 +58,7 @@ void export_string_values(std::ofstream& ofstream, const std::vector<std::string
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(stream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -56,59 +71,59 @@ void export_string_values(std::ofstream& ofstream, const std::vector<std::string
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(stream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& stream, const std::vector<T, Alloc>& values) {
+  stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_vector<std::string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& stream, const opossum::pmr_vector<std::string>& values) {
+  export_string_values(stream, values);
 }
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<std::string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& stream, const std::vector<std::string>& values) {
+  export_string_values(stream, values);
 }
 
 // specialized implementation for bool values
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
+void export_values(std::ostream& stream, const std::vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(stream, writable_bools);
 }
 
 template <typename T>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<T>& values) {
+void export_values(std::ostream& stream, const opossum::pmr_concurrent_vector<T>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<T>{values.begin(), values.end()};
-  ofstream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
+  stream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<std::string>& values) {
+void export_values(std::ostream& stream, const opossum::pmr_concurrent_vector<std::string>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<std::string>{values.begin(), values.end()};
-  export_string_values(ofstream, value_block);
+  export_string_values(stream, value_block);
 }
 
 // specialized implementation for bool values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<bool>& values) {
+void export_values(std::ostream& stream, const opossum::pmr_concurrent_vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(stream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Writes a shallow copy of the given value to the stream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 }  // namespace
 
@@ -117,16 +132,56 @@ namespace opossum {
 ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename)
     : AbstractReadOnlyOperator(OperatorType::ExportBinary, in), _filename(filename) {}
 
-void ExportBinary::write_binary(const Table& table, const std::string& filename) {
+void ExportBinary::write_binary(const Table& table, const std::string& filename,
+                                const std::optional<CommitID>& snapshot_commit_id) {
+  Assert(!snapshot_commit_id || table.has_mvcc() == UseMvcc::Yes, "Writing a snapshot requires MVCC data");
+
   std::ofstream ofstream;
   ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
   ofstream.open(filename, std::ios::binary);
 
   _write_header(table, ofstream);
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  /**
+   * The chunks are serialized into buffers in parallel, but have to be written to the file in order. To limit the
+   * memory held by the buffers, only one batch of chunks is serialized at a time. The offsets of the chunks are
+   * collected for the chunk directory at the end of the file.
+   */
+  const auto chunk_count = static_cast<ChunkID::base_type>(table.chunk_count());
+  const auto batch_size = ChunkID::base_type{std::max(std::thread::hardware_concurrency(), 1u)};
+
+  auto chunk_offsets = std::vector<uint64_t>(chunk_count);
+  auto buffers = std::vector<std::string>(batch_size);
+
+  for (auto batch_begin = ChunkID::base_type{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto stream = std::ostringstream{};
+        stream.exceptions(std::ostringstream::failbit | std::ostringstream::badbit);
+        _write_chunk(table, stream, ChunkID{chunk_id}, snapshot_commit_id);
+        buffers[chunk_id - batch_begin] = stream.str();
+      }));
+      jobs.back()->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      auto& buffer = buffers[chunk_id - batch_begin];
+      chunk_offsets[chunk_id] = static_cast<uint64_t>(ofstream.tellp());
+      ofstream.write(buffer.data(), buffer.size());
+      buffer = std::string{};
+    }
   }
+
+  if (!snapshot_commit_id && table.table_statistics()) _write_statistics(table, ofstream);
+
+  _write_chunk_directory(chunk_offsets, ofstream);
 }
 
 const std::string ExportBinary::name() const { return "ExportBinary"; }
@@ -144,10 +199,10 @@ std::shared_ptr<AbstractOperator> ExportBinary::_on_deep_copy(
 
 void ExportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
-  export_value(ofstream, static_cast<ChunkOffset>(table.max_chunk_size()));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+void ExportBinary::_write_header(const Table& table, std::ostream& stream) {
+  export_value(stream, static_cast<ChunkOffset>(table.max_chunk_size()));
+  export_value(stream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(stream, static_cast<ColumnID::base_type>(table.column_count()));
 
   std::vector<std::string> column_types(table.column_count());
   std::vector<std::string> column_names(table.column_count());
@@ -159,25 +214,180 @@ void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(stream, column_types);
+  export_values(stream, columns_are_nullable);
+  export_string_values(stream, column_names);
+}
+
+void ExportBinary::_write_chunk_directory(const std::vector<uint64_t>& chunk_offsets, std::ostream& stream) {
+  export_values(stream, chunk_offsets);
+  stream.write(CHUNK_DIRECTORY_MARKER.data(), CHUNK_DIRECTORY_MARKER.size());
+}
+
+void ExportBinary::_write_statistics(const Table& table, std::ostream& stream) {
+  const auto statistics_offset = static_cast<uint64_t>(stream.tellp());
+
+  const auto table_statistics = table.table_statistics();
+  export_value(stream, table_statistics->row_count());
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _write_column_statistics<ColumnDataType>(*table_statistics->column_statistics()[column_id], stream);
+    });
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    _write_chunk_statistics(table, chunk_id, stream);
+  }
+
+  export_value(stream, statistics_offset);
+  stream.write(STATISTICS_MARKER.data(), STATISTICS_MARKER.size());
+}
+
+template <typename T>
+void ExportBinary::_write_column_statistics(const BaseColumnStatistics& base_column_statistics, std::ostream& stream) {
+  const auto& column_statistics = static_cast<const ColumnStatistics<T>&>(base_column_statistics);
+
+  export_value(stream, column_statistics.null_value_ratio());
+  export_value(stream, column_statistics.distinct_count());
+  export_values(stream, std::vector<T>{column_statistics.min(), column_statistics.max()});
+
+  const auto histogram =
+      std::dynamic_pointer_cast<const EqualDistinctCountHistogram<T>>(column_statistics.histogram());
+  export_value(stream, histogram ? histogram->bin_count() : BinID{0});
+  if (!histogram || histogram->bin_count() == 0) return;
+
+  const auto& bin_data = histogram->bin_data();
+  export_values(stream, bin_data.bin_minima);
+  export_values(stream, bin_data.bin_maxima);
+  export_values(stream, bin_data.bin_heights);
+  export_value(stream, bin_data.distinct_count_per_bin);
+  export_value(stream, bin_data.bin_count_with_extra_value);
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    export_values(stream, std::vector<std::string>{histogram->supported_characters()});
+    export_value(stream, histogram->string_prefix_length());
+  }
+}
+
+void ExportBinary::_write_chunk_statistics(const Table& table, const ChunkID chunk_id, std::ostream& stream) {
+  const auto chunk_statistics = table.get_chunk(chunk_id)->statistics();
+  export_value(stream, static_cast<BoolAsByteType>(chunk_statistics != nullptr));
+  if (!chunk_statistics) return;
+
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _write_segment_statistics<ColumnDataType>(*chunk_statistics->statistics()[column_id], stream);
+    });
+  }
 }
 
-void ExportBinary::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+template <typename T>
+void ExportBinary::_write_segment_statistics(const SegmentStatistics& segment_statistics, std::ostream& stream) {
+  auto min_max_filters = std::vector<std::shared_ptr<const MinMaxFilter<T>>>{};
+  auto range_filters = std::vector<std::vector<std::pair<T, T>>>{};
+  auto null_count_filters = std::vector<std::shared_ptr<const NullCountFilter>>{};
+  for (const auto& filter : segment_statistics.filters()) {
+    if (const auto min_max_filter = std::dynamic_pointer_cast<const MinMaxFilter<T>>(filter)) {
+      min_max_filters.emplace_back(min_max_filter);
+    }
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (const auto range_filter = std::dynamic_pointer_cast<const RangeFilter<T>>(filter)) {
+        range_filters.emplace_back(range_filter->ranges());
+      }
+    }
+    if (const auto null_count_filter = std::dynamic_pointer_cast<const NullCountFilter>(filter)) {
+      null_count_filters.emplace_back(null_count_filter);
+    }
+  }
+
+  export_value(stream,
+               static_cast<uint32_t>(min_max_filters.size() + range_filters.size() + null_count_filters.size()));
+
+  for (const auto& min_max_filter : min_max_filters) {
+    export_value(stream, BinaryFilterType::min_max_filter);
+    export_values(stream, std::vector<T>{min_max_filter->min(), min_max_filter->max()});
+  }
+
+  for (const auto& ranges : range_filters) {
+    export_value(stream, BinaryFilterType::range_filter);
+    export_value(stream, static_cast<uint32_t>(ranges.size()));
+
+    auto range_minima = std::vector<T>(ranges.size());
+    auto range_maxima = std::vector<T>(ranges.size());
+    for (auto range_index = size_t{0}; range_index < ranges.size(); ++range_index) {
+      std::tie(range_minima[range_index], range_maxima[range_index]) = ranges[range_index];
+    }
+    export_values(stream, range_minima);
+    export_values(stream, range_maxima);
+  }
+
+  for (const auto& null_count_filter : null_count_filters) {
+    export_value(stream, BinaryFilterType::null_count_filter);
+    export_value(stream, static_cast<uint64_t>(null_count_filter->null_count()));
+    export_value(stream, static_cast<uint64_t>(null_count_filter->row_count()));
+  }
+}
+
+void ExportBinary::_write_chunk(const Table& table, std::ostream& stream, const ChunkID& chunk_id,
+                                const std::optional<CommitID>& snapshot_commit_id) {
   const auto chunk = table.get_chunk(chunk_id);
-  const auto context = std::make_shared<ExportContext>(ofstream);
+  const auto context = std::make_shared<ExportContext>(stream);
+
+  auto segments = chunk->segments();
+  auto row_count = chunk->size();
+
+  if (snapshot_commit_id) {
+    // Rows whose begin_cid is set, but whose end_cid is not set yet, belong to transactions that committed after the
+    // snapshot. Thus, neither locks nor transactions that are still committing change which rows are visible.
+    const auto visible_positions = std::make_shared<PosList>();
+    visible_positions->guarantee_single_chunk();
+    {
+      const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (mvcc_data->begin_cids[chunk_offset] <= *snapshot_commit_id &&
+            *snapshot_commit_id < mvcc_data->end_cids[chunk_offset]) {
+          visible_positions->emplace_back(chunk_id, chunk_offset);
+        }
+      }
+    }
+
+    // Copy the visible rows into value segments, which works for all encodings
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto values = pmr_concurrent_vector<ColumnDataType>{};
+        auto null_values = pmr_concurrent_vector<bool>{};
+        values.reserve(visible_positions->size());
+        null_values.reserve(visible_positions->size());
+
+        segment_iterate_filtered<ColumnDataType>(*segments[column_id], visible_positions, [&](const auto& position) {
+          values.push_back(position.value());
+          null_values.push_back(position.is_null());
+        });
+
+        if (table.column_is_nullable(column_id)) {
+          segments[column_id] =
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+        } else {
+          segments[column_id] = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+        }
+      });
+    }
+    row_count = static_cast<ChunkOffset>(visible_positions->size());
+  }
 
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(stream, static_cast<ChunkOffset>(row_count));
 
   // Iterating over all segments of this chunk and exporting them
   for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
     auto visitor =
         make_unique_by_data_type<AbstractSegmentVisitor, ExportBinaryVisitor>(table.column_data_type(column_id));
-    resolve_data_and_segment_type(*chunk->get_segment(column_id),
-                                  [&](const auto data_type_t, const auto& resolved_segment) {
-                                    visitor->handle_segment(resolved_segment, context);
-                                  });
+    resolve_data_and_segment_type(*segments[column_id], [&](const auto data_type_t, const auto& resolved_segment) {
+      visitor->handle_segment(resolved_segment, context);
+    });
   }
 }
 
@@ -187,13 +397,13 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseValueSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
   const auto& segment = static_cast<const ValueSegment<T>&>(base_segment);
 
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->stream, BinarySegmentType::value_segment);
 
   if (segment.is_nullable()) {
-    export_values(context->ofstream, segment.null_values());
+    export_values(context->stream, segment.null_values());
   }
 
-  export_values(context->ofstream, segment.values());
+  export_values(context->stream, segment.values());
 }
 
 template <typename T>
@@ -202,12 +412,12 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const ReferenceSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->stream, BinarySegmentType::value_segment);
 
   // Unfortunately, we have to iterate over all values of the reference segment
   // to materialize its contents. Then we can write them to the file
   for (ChunkOffset row = 0; row < ref_segment.size(); ++row) {
-    export_value(context->ofstream, type_cast_variant<T>(ref_segment[row]));
+    export_value(context->stream, type_cast_variant<T>(ref_segment[row]));
   }
 }
 
@@ -218,7 +428,7 @@ void ExportBinary::ExportBinaryVisitor<std::string>::handle_segment(
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->stream, BinarySegmentType::value_segment);
 
   // If there is no data, we can skip all of the coming steps.
   if (ref_segment.size() == 0) return;
@@ -234,8 +444,10 @@ void ExportBinary::ExportBinaryVisitor<std::string>::handle_segment(
     values << value;
   }
 
-  export_values(context->ofstream, string_lengths);
-  context->ofstream << values.rdbuf();
+  export_values(context->stream, string_lengths);
+  // Unlike `stream << values.rdbuf()`, this does not fail if all strings are empty
+  const auto values_string = values.str();
+  context->stream.write(values_string.data(), values_string.size());
 }
 
 template <typename T>
@@ -248,7 +460,7 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
   Assert(is_fixed_size_byte_aligned(*base_segment.compressed_vector_type()),
          "Does only support fixed-size byte-aligned compressed attribute vectors.");
 
-  export_value(context->ofstream, BinarySegmentType::dictionary_segment);
+  export_value(context->stream, BinarySegmentType::dictionary_segment);
 
   const auto attribute_vector_width = [&]() {
     Assert(base_segment.compressed_vector_type(),
@@ -266,26 +478,33 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
   }();
 
   // Write attribute vector width
-  export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
+  export_value(context->stream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
 
   if (base_segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& segment = static_cast<const FixedStringDictionarySegment<std::string>&>(base_segment);
 
     // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_value(context->stream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
+    export_values(context->stream, *segment.dictionary());
+  } else if (base_segment.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& segment = static_cast<const FrontCodedDictionarySegment<std::string>&>(base_segment);
+
+    // Write the dictionary size and the decoded dictionary, so that it is imported as a DictionarySegment
+    const auto dictionary = segment.dictionary();
+    export_value(context->stream, static_cast<ValueID::base_type>(dictionary->size()));
+    export_values(context->stream, *dictionary);
   } else {
     const auto& segment = static_cast<const DictionarySegment<T>&>(base_segment);
 
     // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_value(context->stream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
+    export_values(context->stream, *segment.dictionary());
   }
 
   // Write attribute vector
   Assert(base_segment.compressed_vector_type(),
          "Expected DictionarySegment to use vector compression for attribute vector");
-  _export_attribute_vector(context->ofstream, *base_segment.compressed_vector_type(), *base_segment.attribute_vector());
+  _export_attribute_vector(context->stream, *base_segment.compressed_vector_type(), *base_segment.attribute_vector());
 }
 
 template <typename T>
@@ -295,18 +514,18 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseEncodedSegme
 }
 
 template <typename T>
-void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstream& ofstream,
+void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ostream& stream,
                                                                     const CompressedVectorType type,
                                                                     const BaseCompressedVector& attribute_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
       return;
     default:
       Fail("Any other type should have been caught before.");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -13,7 +14,9 @@
 
 namespace opossum {
 
+class BaseColumnStatistics;
 class BaseCompressedVector;
+class SegmentStatistics;
 enum class CompressedVectorType : uint8_t;
 
 /**
@@ -23,7 +26,14 @@ class ExportBinary : public AbstractReadOnlyOperator {
  public:
   explicit ExportBinary(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename);
 
-  static void write_binary(const Table& table, const std::string& filename);
+  /**
+   * Writes @param table to @param filename. If @param snapshot_commit_id is given, the table needs MVCC data and only
+   * the rows that are visible at that commit id are written, e.g., for a checkpoint while transactions modify the
+   * table. Each chunk of the table still becomes a chunk in the file, which may be empty then. The statistics of the
+   * table and its chunks are only written without a @param snapshot_commit_id, as they describe all rows of it.
+   */
+  static void write_binary(const Table& table, const std::string& filename,
+                           const std::optional<CommitID>& snapshot_commit_id = std::nullopt);
 
   /**
    * Executes the export operator
@@ -47,7 +57,7 @@ class ExportBinary : public AbstractReadOnlyOperator {
   const std::string _filename;
 
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given stream.
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
@@ -60,12 +70,12 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    * @param table The table that is to be exported
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& stream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given stream.
    * First, it creates a chunk header with the following contents:
    *
    * Description           | Type                                  | Size in bytes
@@ -76,18 +86,112 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * of the segment, such as ReferenceSegment, DictionarySegment, ValueSegment).
    *
    * @param table The table we are currently exporting
-   * @param ofstream The output stream to write to
+   * @param stream The output stream to write to
    * @param chunkId The id of the chunk that is to be worked on now
+   * @param snapshot_commit_id If given, only the rows visible at this commit id are written, as value segments
+   *
+   */
+  static void _write_chunk(const Table& table, std::ostream& stream, const ChunkID& chunk_id,
+                           const std::optional<CommitID>& snapshot_commit_id);
+
+  /**
+   * Writes the chunk directory, which follows the last chunk:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Chunk offsets         | uint64_t array                        |   Chunk count * 8
+   * Marker                | CHUNK_DIRECTORY_MARKER                |   8
+   *
+   * The offsets are relative to the beginning of the file. They let ImportBinary read the chunks in parallel.
+   *
+   * @param chunk_offsets The offset of each chunk in the file
+   * @param stream The output stream to write to
+   */
+  static void _write_chunk_directory(const std::vector<uint64_t>& chunk_offsets, std::ostream& stream);
+
+  /**
+   * Writes the statistics of the table and of its chunks, which follow the last chunk, so that ImportBinary restores
+   * them instead of reading the whole table again. They are only written if the table has statistics (i.e., it was
+   * added to the StorageManager):
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Row count             | float                                 |   4
+   * Column statistics     | see _write_column_statistics          |   Column count * variable
+   * Chunk statistics      | see _write_chunk_statistics           |   Chunk count * variable
+   * Statistics offset     | uint64_t                              |   8
+   * Marker                | STATISTICS_MARKER                     |   8
+   *
+   * @param table The table whose statistics are exported
+   * @param stream The output stream to write to
+   */
+  static void _write_statistics(const Table& table, std::ostream& stream);
+
+  /**
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Null value ratio      | float                                 |   4
+   * Distinct count        | float                                 |   4
+   * Minimum and maximum   | T array                               |   2 * sizeof(T)
+   * Bin count             | BinID                                 |   8
+   * Bin minima'           | T array                               |   Bin count * sizeof(T)
+   * Bin maxima'           | T array                               |   Bin count * sizeof(T)
+   * Bin heights'          | HistogramCountType array              |   Bin count * 4
+   * Distinct count p. bin'| HistogramCountType                    |   4
+   * Bins w. extra value'  | BinID                                 |   8
+   * Supported characters^ | std::string array                     |   8 + length
+   * String prefix length^ | size_t                                |   8
+   *
+   * Arrays of strings are written like the values of a ValueSegment, i.e., the lengths (size_t) followed by the
+   * characters. The histogram is only written if it is an EqualDistinctCountHistogram, otherwise, the bin count is
+   * zero.
+   *
+   * ': These fields are only written if the bin count is not zero.
+   * ^: These fields are only written if the bin count is not zero and the type of the column IS a string.
+   */
+  template <typename T>
+  static void _write_column_statistics(const BaseColumnStatistics& base_column_statistics, std::ostream& stream);
+
+  /**
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Has statistics        | bool (stored as BoolAsByteType)       |   1
+   * Segment statistics'   | see below                             |   Column count * variable
+   *
+   * The statistics of a segment are its MinMaxFilters, RangeFilters and NullCountFilters. Other filters (e.g.,
+   * CountingQuotientFilters) are not written.
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Filter count          | uint32_t                              |   4
+   * Filters               | see below                             |   Filter count * variable
    *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Filter type           | BinaryFilterType                      |   1
+   * Minimum and maximum°  | T array                               |   2 * sizeof(T)
+   * Range count^          | uint32_t                              |   4
+   * Range minima^         | T array                               |   Range count * sizeof(T)
+   * Range maxima^         | T array                               |   Range count * sizeof(T)
+   * Null count~           | uint64_t                              |   8
+   * Row count~            | uint64_t                              |   8
+   *
+   * ': This field is only written if the chunk has statistics.
+   * °: These fields are only written for MinMaxFilters.
+   * ^: These fields are only written for RangeFilters.
+   * ~: These fields are only written for NullCountFilters.
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk_statistics(const Table& table, const ChunkID chunk_id, std::ostream& stream);
+
+  template <typename T>
+  static void _write_segment_statistics(const SegmentStatistics& segment_statistics, std::ostream& stream);
 
   template <typename T>
   class ExportBinaryVisitor;
 
   struct ExportContext : SegmentVisitorContext {
-    explicit ExportContext(std::ofstream& ofstream) : ofstream(ofstream) {}
-    std::ofstream& ofstream;
+    explicit ExportContext(std::ostream& stream) : stream(stream) {}
+    std::ostream& stream;
   };
 };
 
@@ -112,7 +216,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the stream.
    *
    */
   void handle_segment(const BaseValueSegment& base_segment, std::shared_ptr<SegmentVisitorContext> base_context) final;
@@ -134,7 +238,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the stream.
    */
   void handle_segment(const ReferenceSegment& ref_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -159,7 +263,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is written if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the stream.
    */
   void handle_segment(const BaseDictionarySegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -169,7 +273,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
 
  private:
   // Chooses the right FixedSizeByteAlignedVector depending on the attribute_vector_width and exports it.
-  static void _export_attribute_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  static void _export_attribute_vector(std::ostream& stream, const CompressedVectorType type,
                                        const BaseCompressedVector& attribute_vector);
 };
 }  // namespace opossum
@@ -2,13 +2,88 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
+#include <random>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
+#include "constant_mappings.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A counter-based random number generator (SplitMix64), so that the rows of all chunks can be drawn independently of
+// each other and without a branch per row
+uint64_t split_mix(uint64_t state) {
+  state += 0x9e3779b97f4a7c15ULL;
+  state = (state ^ (state >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  state = (state ^ (state >> 27)) * 0x94d049bb133111ebULL;
+  return state ^ (state >> 31);
+}
+
+// Keeps every row of the @param table with a probability of @param percentage / 100 and outputs the kept rows as
+// ReferenceSegments, chunk by chunk in parallel
+std::shared_ptr<const Table> sample_rows(const std::shared_ptr<const Table>& table, const float percentage,
+                                         const uint32_t seed) {
+  // Rows with a random number below the threshold are kept. The threshold is taken from the upper 32 bits of the
+  // random numbers, so that 100% does not overflow it.
+  const auto threshold = static_cast<uint64_t>(static_cast<double>(percentage) / 100.0 * (uint64_t{1} << 32));
+
+  const auto chunk_count = table->chunk_count();
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_size = table->get_chunk(chunk_id)->size();
+      // The random numbers of a chunk continue those of the previous chunks, so that they depend on the seed only and
+      // not on the number of rows that were drawn before
+      const auto chunk_seed = (static_cast<uint64_t>(seed) << 32) + chunk_id * uint64_t{table->max_chunk_size()};
+
+      auto pos_list = std::make_shared<PosList>(chunk_size);
+      auto kept_row_count = size_t{0};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto keep = (split_mix(chunk_seed + chunk_offset) >> 32) < threshold;
+        (*pos_list)[kept_row_count] = RowID{chunk_id, chunk_offset};
+        kept_row_count += keep;
+      }
+      pos_list->resize(kept_row_count);
+      pos_list->guarantee_single_chunk();
+      pos_lists[chunk_id] = std::move(pos_list);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  const auto column_count = table->column_count();
+  auto output_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (pos_lists[chunk_id]->empty()) continue;
+
+    auto segments = Segments{};
+    segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_lists[chunk_id]));
+    }
+    output_table->append_chunk(segments);
+  }
+  return output_table;
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -23,6 +98,10 @@ const std::string GetTable::description(DescriptionMode description_mode) const
   if (!_excluded_chunk_ids.empty()) {
     stream << separator << "(" << _excluded_chunk_ids.size() << " Chunks pruned)";
   }
+  if (_table_sample) {
+    stream << separator << "(TABLESAMPLE " << table_sample_method_to_string.left.at(_table_sample->method) << " "
+           << _table_sample->percentage << "%)";
+  }
   return stream.str();
 }
 
@@ -32,11 +111,20 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+void GetTable::set_table_sample(const std::optional<TableSample>& table_sample) {
+  Assert(!table_sample || (table_sample->percentage >= 0.0f && table_sample->percentage <= 100.0f),
+         "Sampling percentage has to be between 0 and 100");
+  _table_sample = table_sample;
+}
+
+const std::optional<TableSample>& GetTable::table_sample() const { return _table_sample; }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   auto copy = std::make_shared<GetTable>(_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_table_sample(_table_sample);
   return copy;
 }
 
@@ -44,22 +132,69 @@ void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeV
 
 std::shared_ptr<const Table> GetTable::_on_execute() {
   auto original_table = StorageManager::get().get_table(_name);
-  if (_excluded_chunk_ids.empty()) {
-    return original_table;
+
+  auto excluded_chunks_set = std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
+
+  // Without REPEATABLE, every execution draws another sample
+  const auto sample_seed =
+      _table_sample ? (_table_sample->seed ? *_table_sample->seed : std::random_device{}()) : uint32_t{0};
+
+  // SYSTEM sampling draws for every chunk of the table in order, so that a seed selects the same chunks however many
+  // chunks are pruned
+  if (_table_sample && _table_sample->method == TableSampleMethod::System) {
+    auto generator = std::mt19937{sample_seed};
+    auto distribution = std::uniform_real_distribution<float>{0.0f, 100.0f};
+    for (auto chunk_id = ChunkID{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+      if (distribution(generator) >= _table_sample->percentage) excluded_chunks_set.emplace(chunk_id);
+    }
+  }
+
+  // The rows of chunks that the MvccGarbageCollector cleaned up before our snapshot are invisible to us, and the
+  // chunks may be removed while we run. Without a transaction, we see the latest state, where they are invisible, too.
+  const auto snapshot_commit_id = transaction_context_is_set()
+                                      ? std::optional<CommitID>{transaction_context()->snapshot_commit_id()}
+                                      : std::nullopt;
+  for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+    const auto cleanup_commit_id = original_table->get_chunk(chunk_id)->cleanup_commit_id();
+    if (cleanup_commit_id && (!snapshot_commit_id || *cleanup_commit_id <= *snapshot_commit_id)) {
+      excluded_chunks_set.emplace(chunk_id);
+    }
+  }
+
+  // The chunks of replicated tables are read from the memory of the node of our worker (see Table::get_chunk_replica())
+  auto node_id = INVALID_NODE_ID;
+  if (original_table->is_numa_replicated()) {
+    if (const auto worker = Worker::get_this_thread_worker()) node_id = worker->queue()->node_id();
+  }
+
+  const auto sample_rows_of = [&](const std::shared_ptr<const Table>& table) {
+    if (!_table_sample || _table_sample->method != TableSampleMethod::Bernoulli) return table;
+    return sample_rows(table, _table_sample->percentage, sample_seed);
+  };
+
+  if (excluded_chunks_set.empty() && node_id == INVALID_NODE_ID) {
+    return sample_rows_of(original_table);
   }
 
-  // we create a copy of the original table and don't include the excluded chunks
+  // we create a copy of the original table and don't include the excluded chunks. The copy keeps the partitions, so
+  // that JoinHash still joins it partition by partition.
   const auto pruned_table = std::make_shared<Table>(original_table->column_definitions(), TableType::Data,
                                                     original_table->max_chunk_size(), original_table->has_mvcc());
-  const auto excluded_chunks_set =
-      std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
+  const auto partition_schema = original_table->partition_schema();
+  if (partition_schema) pruned_table->set_partition_schema(partition_schema);
   for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
     if (excluded_chunks_set.find(chunk_id) == excluded_chunks_set.end()) {
-      pruned_table->append_chunk(original_table->get_chunk(chunk_id));
+      const auto chunk = node_id == INVALID_NODE_ID ? original_table->get_chunk(chunk_id)
+                                                    : original_table->get_chunk_replica(chunk_id, node_id);
+      if (partition_schema) {
+        pruned_table->append_partition_chunk(chunk);
+      } else {
+        pruned_table->append_chunk(chunk);
+      }
     }
   }
 
-  return pruned_table;
+  return sample_rows_of(pruned_table);
 }
 
 }  // namespace opossum
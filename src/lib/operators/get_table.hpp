@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -9,7 +10,8 @@
 
 namespace opossum {
 
-// operator to retrieve a table from the StorageManager by specifying its name
+// operator to retrieve a table from the StorageManager by specifying its name. With a TableSample, only a sample of the
+// table is retrieved: SYSTEM skips whole chunks, BERNOULLI outputs a References table with the sampled rows.
 class GetTable : public AbstractReadOnlyOperator {
  public:
   explicit GetTable(const std::string& name);
@@ -21,6 +23,9 @@ class GetTable : public AbstractReadOnlyOperator {
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
 
+  void set_table_sample(const std::optional<TableSample>& table_sample);
+  const std::optional<TableSample>& table_sample() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -32,5 +37,6 @@ class GetTable : public AbstractReadOnlyOperator {
   // name of the table to retrieve
   const std::string _name;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<TableSample> _table_sample;
 };
 }  // namespace opossum
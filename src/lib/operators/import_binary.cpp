@@ -3,7 +3,8 @@
 #include <boost/hana/for_each.hpp>
 
 #include <cstdint>
-#include <fstream>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -14,67 +15,126 @@
 #include "constant_mappings.hpp"
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/histograms/equal_distinct_count_histogram.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/null_count_filter.hpp"
+#include "statistics/chunk_statistics/range_filter.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
 ImportBinary::ImportBinary(const std::string& filename, const std::optional<std::string>& tablename)
     : AbstractReadOnlyOperator(OperatorType::ImportBinary), _filename(filename), _tablename(tablename) {}
 
-const std::string ImportBinary::name() const { return "ImportBinary"; }
+class ImportBinary::Reader {
+ public:
+  Reader(const std::string_view content, const size_t offset) : _content(content), _offset(offset) {}
 
-std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
+  size_t offset() const { return _offset; }
+
+  // Returns the next `size` bytes and moves past them. The bytes are not necessarily aligned for any type.
+  const char* read_bytes(const size_t size) {
+    Assert(size <= _content.size() - _offset, "ImportBinary: Unexpected end of file");
+    const auto* const bytes = _content.data() + _offset;
+    _offset += size;
+    return bytes;
+  }
+
+ private:
+  const std::string_view _content;
+  size_t _offset;
+};
 
-  Assert(file.is_open(), "ImportBinary: Could not open file " + filename);
+const std::string ImportBinary::name() const { return "ImportBinary"; }
 
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
+  const auto file = MemoryMappedFile{filename};
+  auto reader = Reader{file.content(), 0};
 
   std::shared_ptr<Table> table;
   ChunkID chunk_count;
-  std::tie(table, chunk_count) = _read_header(file);
+  std::tie(table, chunk_count) = _read_header(reader);
+
+  // Files without a chunk directory store the chunks one after another without an index, so they have to be found by
+  // skipping over their predecessors
+  auto chunk_offsets = _read_chunk_directory(file.content(), reader.offset(), chunk_count);
+  auto statistics_offset = std::optional<size_t>{};
+  if (chunk_offsets) {
+    const auto directory_begin =
+        file.content().size() - chunk_count * sizeof(uint64_t) - CHUNK_DIRECTORY_MARKER.size();
+    const auto min_statistics_offset = chunk_count > 0 ? chunk_offsets->back() + 1 : reader.offset();
+    statistics_offset = _find_statistics(file.content(), min_statistics_offset, directory_begin);
+  } else {
+    chunk_offsets.emplace(chunk_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      (*chunk_offsets)[chunk_id] = reader.offset();
+      _skip_chunk(reader, *table);
+    }
+  }
+
+  table->create_chunk_slots(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto chunk_reader = Reader{file.content(), (*chunk_offsets)[chunk_id]};
+      table->set_chunk_slot(chunk_id, _import_chunk(chunk_reader, *table));
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  table->append_chunk_slots();
+
+  if (statistics_offset) {
+    auto statistics_reader = Reader{file.content(), *statistics_offset};
+    _import_statistics(statistics_reader, *table);
   }
 
   return table;
 }
 
 template <typename T>
-pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> ImportBinary::_read_values(Reader& reader, const size_t count) {
   pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  std::memcpy(values.data(), reader.read_bytes(count * sizeof(T)), count * sizeof(T));
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<std::string> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  return _read_string_values(file, count);
+pmr_vector<std::string> ImportBinary::_read_values(Reader& reader, const size_t count) {
+  return _read_string_values(reader, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
-  return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
+pmr_vector<bool> ImportBinary::_read_values(Reader& reader, const size_t count) {
+  const auto* const readable_bools = reinterpret_cast<const BoolAsByteType*>(reader.read_bytes(count));
+  return pmr_vector<bool>(readable_bools, readable_bools + count);
 }
 
-pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, const size_t count) {
-  const auto string_lengths = _read_values<size_t>(file, count);
+pmr_vector<std::string> ImportBinary::_read_string_values(Reader& reader, const size_t count) {
+  const auto string_lengths = _read_values<size_t>(reader, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  const auto* const buffer = reader.read_bytes(total_length);
 
   pmr_vector<std::string> values(count);
   size_t start = 0;
 
   for (size_t i = 0; i < count; ++i) {
-    values[i] = std::string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
+    values[i] = std::string(buffer + start, buffer + start + string_lengths[i]);
     start += string_lengths[i];
   }
 
@@ -82,12 +142,28 @@ pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, c
 }
 
 template <typename T>
-T ImportBinary::_read_value(std::ifstream& file) {
+T ImportBinary::_read_value(Reader& reader) {
   T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+  std::memcpy(&result, reader.read_bytes(sizeof(T)), sizeof(T));
   return result;
 }
 
+template <typename T>
+void ImportBinary::_skip_values(Reader& reader, const size_t count) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto* const string_lengths = reader.read_bytes(count * sizeof(size_t));
+    auto total_length = size_t{0};
+    for (auto index = size_t{0}; index < count; ++index) {
+      auto string_length = size_t{};
+      std::memcpy(&string_length, string_lengths + index * sizeof(size_t), sizeof(size_t));
+      total_length += string_length;
+    }
+    reader.read_bytes(total_length);
+  } else {
+    reader.read_bytes(count * sizeof(T));
+  }
+}
+
 std::shared_ptr<const Table> ImportBinary::_on_execute() {
   if (_tablename && StorageManager::get().has_table(*_tablename)) {
     return StorageManager::get().get_table(*_tablename);
@@ -110,13 +186,13 @@ std::shared_ptr<AbstractOperator> ImportBinary::_on_deep_copy(
 
 void ImportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstream& file) {
-  const auto chunk_size = _read_value<ChunkOffset>(file);
-  const auto chunk_count = _read_value<ChunkID>(file);
-  const auto column_count = _read_value<ColumnID>(file);
-  const auto column_data_types = _read_values<std::string>(file, column_count);
-  const auto column_nullables = _read_values<bool>(file, column_count);
-  const auto column_names = _read_string_values(file, column_count);
+std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(Reader& reader) {
+  const auto chunk_size = _read_value<ChunkOffset>(reader);
+  const auto chunk_count = _read_value<ChunkID>(reader);
+  const auto column_count = _read_value<ColumnID>(reader);
+  const auto column_data_types = _read_values<std::string>(reader, column_count);
+  const auto column_nullables = _read_values<bool>(reader, column_count);
+  const auto column_names = _read_string_values(reader, column_count);
 
   TableColumnDefinitions output_column_definitions;
   for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
@@ -129,38 +205,225 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
-  const auto row_count = _read_value<ChunkOffset>(file);
+std::optional<std::vector<size_t>> ImportBinary::_read_chunk_directory(const std::string_view content,
+                                                                      const size_t chunks_begin,
+                                                                      const ChunkID chunk_count) {
+  const auto directory_size = chunk_count * sizeof(uint64_t) + CHUNK_DIRECTORY_MARKER.size();
+  if (content.size() < chunks_begin + directory_size) return std::nullopt;
+  if (content.substr(content.size() - CHUNK_DIRECTORY_MARKER.size()) !=
+      std::string_view{CHUNK_DIRECTORY_MARKER.data(), CHUNK_DIRECTORY_MARKER.size()}) {
+    return std::nullopt;
+  }
+
+  const auto directory_begin = content.size() - directory_size;
+  auto reader = Reader{content, directory_begin};
+  const auto stored_chunk_offsets = _read_values<uint64_t>(reader, chunk_count);
+
+  // The chunks have to follow the header and each other. Otherwise, the marker is just the end of the last chunk.
+  auto chunk_offsets = std::vector<size_t>(stored_chunk_offsets.begin(), stored_chunk_offsets.end());
+  if (chunk_count > 0 && chunk_offsets.front() != chunks_begin) return std::nullopt;
+  for (ChunkID chunk_id{1}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_offsets[chunk_id] <= chunk_offsets[chunk_id - 1]) return std::nullopt;
+  }
+  if (chunk_count > 0 && chunk_offsets.back() >= directory_begin) return std::nullopt;
+
+  return chunk_offsets;
+}
+
+std::optional<size_t> ImportBinary::_find_statistics(const std::string_view content, const size_t min_statistics_offset,
+                                                     const size_t statistics_end) {
+  const auto trailer_size = sizeof(uint64_t) + STATISTICS_MARKER.size();
+  if (statistics_end < min_statistics_offset + trailer_size) return std::nullopt;
+  if (content.substr(statistics_end - STATISTICS_MARKER.size(), STATISTICS_MARKER.size()) !=
+      std::string_view{STATISTICS_MARKER.data(), STATISTICS_MARKER.size()}) {
+    return std::nullopt;
+  }
+
+  auto reader = Reader{content, statistics_end - trailer_size};
+  const auto statistics_offset = static_cast<size_t>(_read_value<uint64_t>(reader));
+
+  // Otherwise, the marker is just the end of the last chunk
+  if (statistics_offset < min_statistics_offset || statistics_offset > statistics_end - trailer_size) {
+    return std::nullopt;
+  }
+
+  return statistics_offset;
+}
+
+void ImportBinary::_import_statistics(Reader& reader, Table& table) {
+  const auto row_count = _read_value<float>(reader);
+
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.reserve(table.column_count());
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      column_statistics.emplace_back(_import_column_statistics<ColumnDataType>(reader));
+    });
+  }
+
+  table.set_table_statistics(std::make_shared<TableStatistics>(TableType::Data, row_count, column_statistics));
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (!_read_value<BoolAsByteType>(reader)) continue;
+
+    auto segment_statistics = std::vector<std::shared_ptr<SegmentStatistics>>{};
+    segment_statistics.reserve(table.column_count());
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segment_statistics.emplace_back(_import_segment_statistics<ColumnDataType>(reader));
+      });
+    }
+
+    const auto chunk = table.get_chunk(chunk_id);
+    chunk->mark_immutable();
+    chunk->set_statistics(std::make_shared<ChunkStatistics>(segment_statistics));
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseColumnStatistics> ImportBinary::_import_column_statistics(Reader& reader) {
+  const auto null_value_ratio = _read_value<float>(reader);
+  const auto distinct_count = _read_value<float>(reader);
+  const auto min_max = _read_values<T>(reader, 2);
+
+  auto histogram = std::shared_ptr<const AbstractHistogram<T>>{};
+  const auto bin_count = _read_value<BinID>(reader);
+  if (bin_count > 0) {
+    const auto bin_minima = _read_values<T>(reader, bin_count);
+    const auto bin_maxima = _read_values<T>(reader, bin_count);
+    const auto bin_heights = _read_values<HistogramCountType>(reader, bin_count);
+    const auto distinct_count_per_bin = _read_value<HistogramCountType>(reader);
+    const auto bin_count_with_extra_value = _read_value<BinID>(reader);
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto supported_characters = _read_string_values(reader, 1).front();
+      const auto string_prefix_length = _read_value<size_t>(reader);
+      histogram = std::make_shared<EqualDistinctCountHistogram<T>>(
+          std::vector<T>(bin_minima.begin(), bin_minima.end()), std::vector<T>(bin_maxima.begin(), bin_maxima.end()),
+          std::vector<HistogramCountType>(bin_heights.begin(), bin_heights.end()), distinct_count_per_bin,
+          bin_count_with_extra_value, supported_characters, string_prefix_length);
+    } else {
+      histogram = std::make_shared<EqualDistinctCountHistogram<T>>(
+          std::vector<T>(bin_minima.begin(), bin_minima.end()), std::vector<T>(bin_maxima.begin(), bin_maxima.end()),
+          std::vector<HistogramCountType>(bin_heights.begin(), bin_heights.end()), distinct_count_per_bin,
+          bin_count_with_extra_value);
+    }
+  }
+
+  return std::make_shared<ColumnStatistics<T>>(null_value_ratio, distinct_count, min_max[0], min_max[1], histogram);
+}
+
+template <typename T>
+std::shared_ptr<SegmentStatistics> ImportBinary::_import_segment_statistics(Reader& reader) {
+  auto segment_statistics = std::make_shared<SegmentStatistics>();
+
+  const auto filter_count = _read_value<uint32_t>(reader);
+  for (auto filter_index = uint32_t{0}; filter_index < filter_count; ++filter_index) {
+    const auto filter_type = _read_value<BinaryFilterType>(reader);
+
+    switch (filter_type) {
+      case BinaryFilterType::min_max_filter: {
+        const auto min_max = _read_values<T>(reader, 2);
+        segment_statistics->add_filter(std::make_shared<MinMaxFilter<T>>(min_max[0], min_max[1]));
+        break;
+      }
+      case BinaryFilterType::range_filter:
+        if constexpr (std::is_arithmetic_v<T>) {
+          const auto range_count = _read_value<uint32_t>(reader);
+          const auto range_minima = _read_values<T>(reader, range_count);
+          const auto range_maxima = _read_values<T>(reader, range_count);
+
+          auto ranges = std::vector<std::pair<T, T>>(range_count);
+          for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+            ranges[range_index] = {range_minima[range_index], range_maxima[range_index]};
+          }
+          segment_statistics->add_filter(std::make_shared<RangeFilter<T>>(std::move(ranges)));
+        } else {
+          Fail("Cannot import statistics: range filters are not supported for strings");
+        }
+        break;
+      case BinaryFilterType::null_count_filter: {
+        const auto null_count = _read_value<uint64_t>(reader);
+        const auto row_count = _read_value<uint64_t>(reader);
+        segment_statistics->add_filter(std::make_shared<NullCountFilter>(null_count, row_count));
+        break;
+      }
+      default:
+        // This case happens if the read filter type is not a valid BinaryFilterType.
+        Fail("Cannot import statistics: invalid filter type");
+    }
+  }
+
+  return segment_statistics;
+}
+
+void ImportBinary::_skip_chunk(Reader& reader, const Table& table) {
+  const auto row_count = _read_value<ChunkOffset>(reader);
+
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _skip_segment<ColumnDataType>(reader, row_count, table.column_is_nullable(column_id));
+    });
+  }
+}
+
+template <typename ColumnDataType>
+void ImportBinary::_skip_segment(Reader& reader, ChunkOffset row_count, bool is_nullable) {
+  const auto column_type = _read_value<BinarySegmentType>(reader);
+
+  switch (column_type) {
+    case BinarySegmentType::value_segment:
+      if (is_nullable) _skip_values<BoolAsByteType>(reader, row_count);
+      _skip_values<ColumnDataType>(reader, row_count);
+      return;
+    case BinarySegmentType::dictionary_segment: {
+      const auto attribute_vector_width = _read_value<AttributeVectorWidth>(reader);
+      const auto dictionary_size = _read_value<ValueID>(reader);
+      _skip_values<ColumnDataType>(reader, dictionary_size);
+      reader.read_bytes(size_t{row_count} * attribute_vector_width);
+      return;
+    }
+    default:
+      // This case happens if the read column type is not a valid BinarySegmentType.
+      Fail("Cannot import column: invalid column type");
+  }
+}
+
+Segments ImportBinary::_import_chunk(Reader& reader, const Table& table) {
+  const auto row_count = _read_value<ChunkOffset>(reader);
 
   Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_segment(reader, row_count, table.column_data_type(column_id), table.column_is_nullable(column_id)));
   }
-  table->append_chunk(output_segments);
+  return output_segments;
 }
 
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(Reader& reader, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
-    result = _import_segment<ColumnDataType>(file, row_count, is_nullable);
+    result = _import_segment<ColumnDataType>(reader, row_count, is_nullable);
   });
 
   return result;
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(Reader& reader, ChunkOffset row_count,
                                                            bool is_nullable) {
-  const auto column_type = _read_value<BinarySegmentType>(file);
+  const auto column_type = _read_value<BinarySegmentType>(reader);
 
   switch (column_type) {
     case BinarySegmentType::value_segment:
-      return _import_value_segment<ColumnDataType>(file, row_count, is_nullable);
+      return _import_value_segment<ColumnDataType>(reader, row_count, is_nullable);
     case BinarySegmentType::dictionary_segment:
-      return _import_dictionary_segment<ColumnDataType>(file, row_count);
+      return _import_dictionary_segment<ColumnDataType>(reader, row_count);
     default:
       // This case happens if the read column type is not a valid BinarySegmentType.
       Fail("Cannot import column: invalid column type");
@@ -168,44 +431,59 @@ std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file,
 }
 
 std::shared_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    Reader& reader, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(reader, row_count));
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(reader, row_count));
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(reader, row_count));
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(Reader& reader, ChunkOffset row_count,
                                                                      bool is_nullable) {
-  // TODO(unknown): Ideally _read_values would directly write into a tbb::concurrent_vector so that no conversion is
-  // needed
+  // The values are copied straight from the file into the tbb::concurrent_vector. As it does not store its elements
+  // contiguously, this happens value by value.
+  auto null_values = tbb::concurrent_vector<bool>{};
+  if (is_nullable) {
+    const auto* const readable_bools = reinterpret_cast<const BoolAsByteType*>(reader.read_bytes(row_count));
+    null_values = tbb::concurrent_vector<bool>(readable_bools, readable_bools + row_count);
+  }
+
+  auto values = tbb::concurrent_vector<T>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto string_values = _read_string_values(reader, row_count);
+    values = tbb::concurrent_vector<T>(std::make_move_iterator(string_values.begin()),
+                                       std::make_move_iterator(string_values.end()));
+  } else {
+    const auto* const bytes = reader.read_bytes(row_count * sizeof(T));
+    values = tbb::concurrent_vector<T>(row_count);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      std::memcpy(&values[row], bytes + row * sizeof(T), sizeof(T));
+    }
+  }
+
   if (is_nullable) {
-    const auto nullables = _read_values<bool>(file, row_count);
-    const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueSegment<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()},
-                                             tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
+    return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
   } else {
-    const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueSegment<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()});
+    return std::make_shared<ValueSegment<T>>(std::move(values));
   }
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(Reader& reader,
                                                                                ChunkOffset row_count) {
-  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
-  const auto dictionary_size = _read_value<ValueID>(file);
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(reader);
+  const auto dictionary_size = _read_value<ValueID>(reader);
   const auto null_value_id = dictionary_size;
-  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(reader, dictionary_size));
 
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  auto attribute_vector = _import_attribute_vector(reader, row_count, attribute_vector_width);
 
   return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector, null_value_id);
 }
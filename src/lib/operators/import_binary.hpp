@@ -1,9 +1,9 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -15,12 +15,21 @@
 
 namespace opossum {
 
+class BaseColumnStatistics;
+class SegmentStatistics;
+
 /*
  * This operator reads a Opossum binary file and creates a table from that input.
  * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
  * already exists, it is returned and no import is performed.
  *
- * Note: ImportBinary does not support null values at the moment
+ * The file is mapped into memory instead of being read through a stream. The chunks are found through the chunk
+ * directory at the end of the file. Older files do not have one, in that case a first, sequential pass finds the
+ * chunks by skipping over their segments, which only reads the sizes stored in the file. Then, the chunks are
+ * imported in parallel, copying the values straight from the mapped pages into the segments.
+ *
+ * If the file holds the statistics of the table and its chunks, they are restored, so that the StorageManager does not
+ * have to generate them again.
  */
 class ImportBinary : public AbstractReadOnlyOperator {
  public:
@@ -35,9 +44,15 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * |   Header   |
    * |------------|
    * |   Chunks¹  |
+   * |------------|
+   * | Statistics²|
+   * |------------|
+   * | Chunk dir.³|
    * --------------
    *
    * ¹ Zero or more chunks
+   * ² Optional, see ExportBinary::_write_statistics. Needs a chunk directory.
+   * ³ Optional, see ExportBinary::_write_chunk_directory
    */
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -50,6 +65,9 @@ class ImportBinary : public AbstractReadOnlyOperator {
   const std::string name() const final;
 
  private:
+  // Reads the values of the binary file from its memory mapping, starting at a given offset
+  class Reader;
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
@@ -67,10 +85,40 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(Reader& reader);
+
+  // Returns the chunk offsets stored in the chunk directory, or nullopt if the file has no (valid) chunk directory
+  static std::optional<std::vector<size_t>> _read_chunk_directory(std::string_view content, size_t chunks_begin,
+                                                                  ChunkID chunk_count);
+
+  // Returns the offset of the statistics that end at @param statistics_end, or nullopt if the file has no (valid)
+  // statistics. They cannot begin before @param min_statistics_offset, which is after the beginning of the last chunk.
+  static std::optional<size_t> _find_statistics(std::string_view content, size_t min_statistics_offset,
+                                                size_t statistics_end);
+
+  // Sets the statistics of the table and its chunks, see ExportBinary::_write_statistics for the format. Chunks with
+  // statistics are marked as immutable, as they were when their statistics were generated.
+  static void _import_statistics(Reader& reader, Table& table);
+
+  template <typename T>
+  static std::shared_ptr<BaseColumnStatistics> _import_column_statistics(Reader& reader);
+
+  template <typename T>
+  static std::shared_ptr<SegmentStatistics> _import_segment_statistics(Reader& reader);
+
+  // Moves the reader past the chunk that starts at its current position
+  static void _skip_chunk(Reader& reader, const Table& table);
+
+  // Moves the reader past the segment that starts at its current position
+  template <typename ColumnDataType>
+  static void _skip_segment(Reader& reader, ChunkOffset row_count, bool is_nullable);
+
+  // Moves the reader past `count` values as written by _read_values<T>
+  template <typename T>
+  static void _skip_values(Reader& reader, const size_t count);
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
+   * Creates the segments of a chunk from chunk information from the given file.
    * The chunk information has the following form:
    *
    * ----------------
@@ -81,15 +129,15 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static Segments _import_chunk(Reader& reader, const Table& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+  static std::shared_ptr<BaseSegment> _import_segment(Reader& reader, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(Reader& reader, ChunkOffset row_count, bool is_nullable);
 
   /*
    * Imports a serialized ValueSegment from the given file.
@@ -117,7 +165,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    */
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(Reader& reader, ChunkOffset row_count,
                                                                 bool is_nullable);
 
   /*
@@ -137,22 +185,22 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * °: This field is needed if the type of the column is NOT a string
    */
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(Reader& reader, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(Reader& reader, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(Reader& reader, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<std::string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<std::string> _read_string_values(Reader& reader, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(Reader& reader);
 
  private:
   // Name of the import file
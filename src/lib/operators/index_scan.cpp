@@ -6,7 +6,11 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
+#include "table_scan/column_between_table_scan_impl.hpp"
+#include "table_scan/column_vs_value_table_scan_impl.hpp"
+
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -34,6 +38,14 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  // A TableIndex covers all chunks, so that it is probed once instead of the index of every chunk
+  if (_left_column_ids.size() == 1) {
+    if (const auto table_index = _in_table->get_table_index(_left_column_ids.front())) {
+      _scan_table_index(*table_index);
+      return _out_table;
+    }
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -101,6 +113,50 @@ void IndexScan::_validate_input() {
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
 }
 
+PosList IndexScan::_scan_chunk_without_index(const ChunkID chunk_id) const {
+  auto impl = std::unique_ptr<AbstractTableScanImpl>{};
+  if (_predicate_condition == PredicateCondition::Between) {
+    impl = std::make_unique<ColumnBetweenTableScanImpl>(_in_table, _left_column_ids.front(), _right_values.front(),
+                                                        _right_values2.front());
+  } else {
+    impl = std::make_unique<ColumnVsValueTableScanImpl>(_in_table, _left_column_ids.front(), _predicate_condition,
+                                                        _right_values.front());
+  }
+  return std::move(*impl->scan_chunk(chunk_id));
+}
+
+void IndexScan::_scan_table_index(const BaseTableIndex& table_index) {
+  const auto value2 = _right_values2.empty() ? std::nullopt : std::optional<AllTypeVariant>{_right_values2.front()};
+  auto matches = table_index.lookup(_predicate_condition, _right_values.front(), value2);
+  std::sort(matches.begin(), matches.end());
+
+  auto included_chunks = std::vector<bool>(_in_table->chunk_count(), _included_chunk_ids.empty());
+  for (const auto chunk_id : _included_chunk_ids) {
+    included_chunks[chunk_id] = true;
+  }
+
+  // As for the indexes of the chunks, each input chunk with matches gets an output chunk
+  for (auto matches_begin = matches.begin(); matches_begin != matches.end();) {
+    const auto chunk_id = matches_begin->chunk_id;
+    const auto matches_end = std::find_if(matches_begin, matches.end(),
+                                          [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    // Chunks that were appended concurrently have no rows visible to this scan
+    if (chunk_id < included_chunks.size() && included_chunks[chunk_id]) {
+      const auto matches_out = std::make_shared<PosList>(matches_begin, matches_end);
+      const auto chunk = _in_table->get_chunk(chunk_id);
+
+      Segments segments;
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+      }
+      _out_table->append_chunk(segments, chunk->get_allocator(), chunk->access_counter());
+    }
+
+    matches_begin = matches_end;
+  }
+}
+
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
@@ -111,7 +167,11 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   auto matches_out = PosList{};
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
-  Assert(index != nullptr, "Index of specified type not found for segment (vector).");
+  if (!index) {
+    // The IndexTuner may have dropped the index since the plan was created, e.g., for a cached plan
+    Assert(_left_column_ids.size() == 1, "Index of specified type not found for segment (vector).");
+    return _scan_chunk_without_index(chunk_id);
+  }
 
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
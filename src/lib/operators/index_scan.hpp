@@ -11,13 +11,16 @@
 
 namespace opossum {
 
-class Table;
 class AbstractTask;
+class BaseTableIndex;
+class Table;
 
 /**
  * Operator that performs a predicate search using indices
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * If the table has a TableIndex on the (single) column, that index is used instead of those of the chunks.
  */
 class IndexScan : public AbstractReadOnlyOperator {
   friend class LQPTranslatorTest;
@@ -47,6 +50,9 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  // Scans a chunk whose index has been removed meanwhile like a TableScan would
+  PosList _scan_chunk_without_index(const ChunkID chunk_id) const;
+  void _scan_table_index(const BaseTableIndex& table_index);
 
  private:
   const SegmentIndexType _index_type;
@@ -2,15 +2,23 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/log_record.hpp"
+#include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/index/unique_constraint_index.hpp"
+#include "storage/materialize.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
-#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -79,20 +87,9 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
       // Ignore source value and only set null to true
       casted_target->null_values()[target_start_index] = true;
     } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceSegment>(source)){
-      // since we have no guarantee that a ReferenceSegment references only a single other segment,
-      // this would require us to find out the referenced segment's type for each single row.
-      // instead, we just use the slow path below.
-      for (auto i = 0u; i < length; i++) {
-        auto ref_value = (*source)[source_start_index + i];
-        if (variant_is_null(ref_value)) {
-          Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
-          values[target_start_index + i] = T{};
-          casted_target->null_values()[target_start_index + i] = true;
-        } else {
-          values[target_start_index + i] = type_cast_variant<T>(ref_value);
-        }
-      }
+      // Resolve the type and the encoding of any other segment once, e.g., of the ReferenceSegments that Update
+      // passes for the columns that it does not change, and cast the values if the data types differ
+      materialize_into_value_segment(*source, source_start_index, length, *casted_target, target_start_index);
     }
   }
 };
@@ -100,6 +97,13 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
 Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert)
     : AbstractReadWriteOperator(OperatorType::Insert, values_to_insert), _target_table_name(target_table_name) {}
 
+Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const Table>& values_to_insert)
+    : Insert(target_table_name, [&]() {
+        const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+        table_wrapper->execute();
+        return table_wrapper;
+      }()) {}
+
 const std::string Insert::name() const { return "Insert"; }
 
 std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionContext> context) {
@@ -114,114 +118,174 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         make_unique_by_data_type<AbstractTypedSegmentProcessor, TypedSegmentProcessor>(column_type));
   }
 
-  auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
-
-  // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
-  // modifying the table's size simultaneously.
-  auto start_index = 0u;
-  auto start_chunk_id = ChunkID{0};
-  auto end_chunk_id = 0u;
-  {
-    auto scoped_lock = _target_table->acquire_append_mutex();
-
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
+  const auto max_chunk_size = _target_table->max_chunk_size();
+  const auto partition_schema = _target_table->partition_schema();
+  const auto partition_count = partition_schema ? partition_schema->partition_count() : PartitionID{1};
+
+  // The rows of a partitioned table are added to the last chunk of their partition (see PartitionSchema), otherwise to
+  // the last chunk of the table. Consecutive input rows of the same partition are copied together.
+  struct SourceRows {
+    ChunkID chunk_id;
+    ChunkOffset begin_offset;
+    ChunkOffset row_count;
+  };
+  auto source_rows_by_partition = std::vector<std::vector<SourceRows>>(partition_count);
+
+  for (auto source_chunk_id = ChunkID{0}; source_chunk_id < input_table_left()->chunk_count(); ++source_chunk_id) {
+    const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
+    if (!partition_schema) {
+      if (source_chunk->size() > 0) {
+        source_rows_by_partition[0].emplace_back(SourceRows{source_chunk_id, ChunkOffset{0}, source_chunk->size()});
+      }
+      continue;
     }
 
-    start_chunk_id = _target_table->chunk_count() - 1;
-    end_chunk_id = start_chunk_id + 1;
-    auto last_chunk = _target_table->get_chunk(start_chunk_id);
-    start_index = last_chunk->size();
+    const auto& segment = *source_chunk->get_segment(partition_schema->column_id());
+    segment_iterate<ResolveDataTypeTag, EraseTypes::Always>(segment, [&](const auto& position) {
+      const auto partition_id = position.is_null() ? PartitionID{0} : partition_schema->partition_of(position.value());
+      const auto chunk_offset = position.chunk_offset();
+
+      auto& source_rows = source_rows_by_partition[partition_id];
+      if (!source_rows.empty() && source_rows.back().chunk_id == source_chunk_id &&
+          source_rows.back().begin_offset + source_rows.back().row_count == chunk_offset) {
+        ++source_rows.back().row_count;
+      } else {
+        source_rows.emplace_back(SourceRows{source_chunk_id, chunk_offset, ChunkOffset{1}});
+      }
+    });
+  }
 
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (!last_chunk->is_mutable()) {
-      _target_table->append_mutable_chunk();
-      end_chunk_id++;
+  // First, reserve space for all the rows to insert at the end of the partitions. This does not lock the table,
+  // concurrent inserts only wait for each other while the reserved rows are added to a chunk, and while a new chunk is
+  // appended once the last one is full.
+  struct ReservedRows {
+    PartitionID partition_id;
+    ChunkID chunk_id;
+    std::shared_ptr<Chunk> chunk;
+    ChunkOffset begin_offset;
+    ChunkOffset row_count;
+  };
+  auto reserved_rows = std::vector<ReservedRows>{};
+
+  for (auto partition_id = PartitionID{0}; partition_id < partition_count; ++partition_id) {
+    auto remaining_rows = uint32_t{0};
+    for (const auto& source_rows : source_rows_by_partition[partition_id]) {
+      remaining_rows += source_rows.row_count;
     }
 
-    auto remaining_rows = total_rows_to_insert;
     while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
-      auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
-
-      // Resize MVCC vectors.
-      current_chunk->get_scoped_mvcc_data_lock()->grow_by(rows_to_insert_this_loop, MvccData::MAX_COMMIT_ID);
+      const auto last_chunk_id = _target_table->last_chunk_id_of_partition(partition_id);
+      const auto last_chunk = last_chunk_id != INVALID_CHUNK_ID ? _target_table->get_chunk(last_chunk_id) : nullptr;
 
-      // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
-      for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
-        typed_segment_processors[column_id]->resize_vector(current_chunk->get_segment(column_id),
-                                                           old_size + rows_to_insert_this_loop);
+      // If the last chunk is compressed, add a new uncompressed chunk
+      auto reservation = std::pair<ChunkOffset, ChunkOffset>{0, 0};
+      if (last_chunk && last_chunk->is_mutable()) {
+        reservation = last_chunk->reserve_rows(remaining_rows, max_chunk_size);
+      }
+      const auto begin_offset = reservation.first;
+      const auto row_count = reservation.second;
+
+      if (row_count == 0) {
+        // Unless another insert has done so in the meantime
+        auto scoped_lock = _target_table->acquire_append_mutex();
+        if (_target_table->last_chunk_id_of_partition(partition_id) == last_chunk_id) {
+          _target_table->append_mutable_chunk(partition_id);
+        }
+        continue;
       }
 
-      remaining_rows -= rows_to_insert_this_loop;
+      last_chunk->add_reserved_rows(begin_offset, begin_offset + row_count, [&]() {
+        // Resize MVCC vectors first, so that the rows are invisible until they are committed.
+        last_chunk->get_scoped_mvcc_data_lock()->grow_by(row_count, MvccData::MAX_COMMIT_ID);
 
-      // Create new chunk if necessary.
-      if (remaining_rows > 0) {
-        _target_table->append_mutable_chunk();
-        end_chunk_id++;
-      }
+        for (ColumnID column_id{0}; column_id < last_chunk->column_count(); ++column_id) {
+          typed_segment_processors[column_id]->resize_vector(last_chunk->get_segment(column_id),
+                                                             begin_offset + row_count);
+        }
+      });
+
+      reserved_rows.emplace_back(ReservedRows{partition_id, last_chunk_id, last_chunk, begin_offset, row_count});
+      remaining_rows -= row_count;
     }
   }
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
-  // Then, actually insert the data.
-  auto input_offset = 0u;
-  auto source_chunk_id = ChunkID{0};
-  auto source_chunk_start_index = 0u;
+  // Then, actually insert the data. The reserved rows of each partition are filled with its source rows in order.
+  auto current_partition_id = std::optional<PartitionID>{};
+  auto source_rows_iter = std::vector<SourceRows>::const_iterator{};
+  auto source_rows_offset = ChunkOffset{0};
 
-  for (auto target_chunk_id = start_chunk_id; target_chunk_id < end_chunk_id; target_chunk_id++) {
-    auto target_chunk = _target_table->get_chunk(target_chunk_id);
-
-    const auto current_num_rows_to_insert =
-        std::min(target_chunk->size() - start_index, total_rows_to_insert - input_offset);
+  for (const auto& [partition_id, target_chunk_id, target_chunk, begin_offset, row_count] : reserved_rows) {
+    if (partition_id != current_partition_id) {
+      current_partition_id = partition_id;
+      source_rows_iter = source_rows_by_partition[partition_id].cbegin();
+      source_rows_offset = 0u;
+    }
 
-    auto target_start_index = start_index;
-    auto still_to_insert = current_num_rows_to_insert;
+    const auto end_offset = begin_offset + row_count;
 
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
-      const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
-      auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
+    auto target_start_index = begin_offset;
+    while (target_start_index != end_offset) {
+      const auto source_chunk = input_table_left()->get_chunk(source_rows_iter->chunk_id);
+      auto num_to_insert = std::min(source_rows_iter->row_count - source_rows_offset, end_offset - target_start_index);
+      const auto source_start_index = source_rows_iter->begin_offset + source_rows_offset;
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
         const auto& source_segment = source_chunk->get_segment(column_id);
-        typed_segment_processors[column_id]->copy_data(source_segment, source_chunk_start_index,
+        typed_segment_processors[column_id]->copy_data(source_segment, source_start_index,
                                                        target_chunk->get_segment(column_id), target_start_index,
                                                        num_to_insert);
       }
-      still_to_insert -= num_to_insert;
       target_start_index += num_to_insert;
-      source_chunk_start_index += num_to_insert;
+      source_rows_offset += num_to_insert;
 
-      bool source_chunk_depleted = source_chunk_start_index == source_chunk->size();
-      if (source_chunk_depleted) {
-        source_chunk_id++;
-        source_chunk_start_index = 0u;
+      bool source_rows_depleted = source_rows_offset == source_rows_iter->row_count;
+      if (source_rows_depleted) {
+        ++source_rows_iter;
+        source_rows_offset = 0u;
       }
     }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
+    // The rows are invisible until they are committed, so that they can be indexed right away
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->insert(*target_chunk, target_chunk_id, begin_offset, end_offset);
+    }
+
+    auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
       // the transaction IDs are set here and not during the resize, because
       // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
       // deleted.
-      target_chunk->get_scoped_mvcc_data_lock()->tids[i] = context->transaction_id();
-      _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+      mvcc_data->tids[chunk_offset] = context->transaction_id();
+      _inserted_rows.emplace_back(RowID{target_chunk_id, chunk_offset});
     }
+  }
 
-    input_offset += current_num_rows_to_insert;
-    start_index = 0u;
+  // The keys are only checked now that the tids are set, so that concurrent Inserts of the same keys see these rows as
+  // being inserted. If a key is taken, the transaction has to be rolled back, which invalidates the rows.
+  for (const auto& unique_constraint : _target_table->unique_constraints()) {
+    for (const auto& reserved_range : reserved_rows) {
+      if (!unique_constraint->insert(*_target_table, reserved_range.chunk_id, reserved_range.begin_offset,
+                                     reserved_range.begin_offset + reserved_range.row_count,
+                                     context->transaction_id())) {
+        _mark_as_failed();
+        return nullptr;
+      }
+    }
   }
 
   return nullptr;
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
+  _target_table->raise_last_commit_id(cid);
+
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
 
     auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    mvcc_data->invalidate_visibility_summary();
     mvcc_data->begin_cids[row_id.chunk_offset] = cid;
     mvcc_data->tids[row_id.chunk_offset] = 0u;
   }
@@ -232,6 +296,7 @@ void Insert::_on_rollback_records() {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
+    chunk->get_scoped_mvcc_data_lock()->invalidate_visibility_summary();
     chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = 0u;
     std::atomic_thread_fence(std::memory_order_release);
     chunk->get_scoped_mvcc_data_lock()->begin_cids[row_id.chunk_offset] = 0u;
@@ -240,6 +305,20 @@ void Insert::_on_rollback_records() {
   }
 }
 
+void Insert::_on_log_records(LogRecord& log_record) const {
+  auto& changes = log_record.table_changes[_target_table_name];
+  changes.inserted_row_ids.insert(changes.inserted_row_ids.end(), _inserted_rows.begin(), _inserted_rows.end());
+
+  for (const auto& row_id : _inserted_rows) {
+    const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+    auto& row = changes.inserted_rows.emplace_back();
+    row.reserve(chunk->column_count());
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      row.emplace_back((*chunk->get_segment(column_id))[row_id.chunk_offset]);
+    }
+  }
+}
+
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -19,12 +19,19 @@ class TransactionContext;
  *
  * Assumption: The input has been validated before.
  * Note: Insert does not support null values at the moment
+ *
+ * If a row violates a unique constraint of the table (see UniqueConstraintIndex), the Insert fails and the
+ * transaction has to be rolled back.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
   explicit Insert(const std::string& target_table_name,
                   const std::shared_ptr<const AbstractOperator>& values_to_insert);
 
+  // Inserts the rows of a table that no operator computed, e.g., a batch of rows. ValueSegments of the data types of
+  // the target table are copied as they are, without going through AllTypeVariants.
+  Insert(const std::string& target_table_name, const std::shared_ptr<const Table>& values_to_insert);
+
   const std::string name() const override;
 
  protected:
@@ -35,6 +42,7 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_log_records(LogRecord& log_record) const override;
 
  private:
   const std::string _target_table_name;
@@ -0,0 +1,31 @@
+#include "intersect.hpp"
+
+#include <memory>
+#include <string>
+
+#include "set_operation_steps.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+Intersect::Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+                     const std::shared_ptr<const AbstractOperator>& right_in)
+    : AbstractReadOnlyOperator(OperatorType::Intersect, left_in, right_in) {}
+
+const std::string Intersect::name() const { return "Intersect"; }
+
+std::shared_ptr<AbstractOperator> Intersect::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Intersect>(copied_input_left, copied_input_right);
+}
+
+void Intersect::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Intersect::_on_execute() {
+  DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
+              "Input tables must have same number of columns");
+
+  return select_rows(input_table_left(), find_rows_in_table(*input_table_left(), *input_table_right()));
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Returns the rows of the left input that have a row with the same values in the right input, including duplicates
+ * (see find_rows_in_table()). It is the counterpart of the Difference.
+ */
+class Intersect : public AbstractReadOnlyOperator {
+ public:
+  Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+            const std::shared_ptr<const AbstractOperator>& right_in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+};
+}  // namespace opossum
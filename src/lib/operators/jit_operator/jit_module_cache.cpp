@@ -0,0 +1,46 @@
+#include "jit_module_cache.hpp"
+
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JitModuleCache::JitModuleCache() : _pipelines(DEFAULT_CAPACITY) {}
+
+std::shared_ptr<JitCompiledPipeline> JitModuleCache::get_or_compile(
+    const std::string& key, const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+    const bool two_specialization_passes, const bool asynchronous) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (const auto cached_pipeline = _pipelines.try_get(key)) return *cached_pipeline;
+
+  const auto source = std::dynamic_pointer_cast<const JitReadTuples>(jit_operators.front());
+  Assert(source, "The operator pipeline does not start with a JitReadTuples");
+
+  const auto pipeline = std::make_shared<JitCompiledPipeline>();
+  pipeline->jit_operators = jit_operators;
+
+  // The future is destroyed before the rest of the pipeline and waits for the compilation, so the raw pointer stays
+  // valid. Capturing the shared_ptr would create a cycle instead.
+  auto& specializer = pipeline->specializer;
+  const auto compile = [&specializer, source, two_specialization_passes]() {
+    // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
+    return specializer.specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+        "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+        std::make_shared<JitConstantRuntimePointer>(source.get()), two_specialization_passes);
+  };
+  pipeline->execute_function =
+      std::async(asynchronous ? std::launch::async : std::launch::deferred, compile).share();
+
+  _pipelines.set(key, pipeline);
+  return pipeline;
+}
+
+size_t JitModuleCache::size() const { return _pipelines.size(); }
+
+void JitModuleCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _pipelines.clear();
+}
+
+}  // namespace opossum
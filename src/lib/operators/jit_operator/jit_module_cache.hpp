@@ -0,0 +1,70 @@
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cache/cache.hpp"
+#include "operators/jit_operator/operators/abstract_jittable.hpp"
+#include "operators/jit_operator/specialization/jit_code_specializer.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class JitReadTuples;
+struct JitRuntimeContext;
+
+// An operator pipeline that was specialized and compiled by the JitModuleCache
+struct JitCompiledPipeline {
+  using ExecuteFunction = std::function<void(const JitReadTuples*, JitRuntimeContext&)>;
+
+  // Owns the LLVM module the compiled function lives in
+  JitCodeSpecializer specializer;
+
+  // The operators that the function was specialized for. The specialized code may refer to values of these operators,
+  // so they are kept alive (and unchanged) as long as the function is used.
+  std::vector<std::shared_ptr<AbstractJittable>> jit_operators;
+
+  // Ready once the compilation is done
+  std::shared_future<ExecuteFunction> execute_function;
+};
+
+/**
+ * Specializing and compiling an operator pipeline with the JitCodeSpecializer takes tens of milliseconds, which is
+ * often longer than the query itself. The JitModuleCache keeps the compiled pipelines, keyed by the structure of their
+ * operators (see JitOperatorWrapper), so that a pipeline is only compiled when an operator chain of that structure is
+ * executed for the first time.
+ *
+ * The compiled function is called with the JitReadTuples of the pipeline that is executed. Values that only live in
+ * the JitRuntimeContext, such as literals and parameters, are not part of the specialized code, so pipelines that only
+ * differ in them share their compiled function.
+ */
+class JitModuleCache : public Singleton<JitModuleCache> {
+ public:
+  static constexpr auto DEFAULT_CAPACITY = size_t{256};
+
+  // Returns the pipeline cached for the @param key. If there is none yet, the pipeline of the @param jit_operators
+  // (chained already, the first one being a JitReadTuples) is specialized and compiled, either in a background thread
+  // if @param asynchronous is set or by the first thread that waits for the execute_function.
+  std::shared_ptr<JitCompiledPipeline> get_or_compile(
+      const std::string& key, const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+      const bool two_specialization_passes, const bool asynchronous);
+
+  size_t size() const;
+
+  void clear();
+
+ protected:
+  friend class Singleton;
+
+  JitModuleCache();
+
+  // Makes looking up and inserting a pipeline atomic, so that each pipeline is compiled once
+  std::mutex _mutex;
+  Cache<std::shared_ptr<JitCompiledPipeline>> _pipelines;
+};
+
+}  // namespace opossum
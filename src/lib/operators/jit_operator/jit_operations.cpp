@@ -1,5 +1,10 @@
 #include "jit_operations.hpp"
 
+#include <optional>
+#include <string>
+
+#include "expression/evaluation/like_matcher.hpp"
+
 namespace opossum {
 
 // Returns the enum value (e.g., DataType::Int, DataType::String) of a data type defined in the DATA_TYPE_INFO sequence
@@ -21,6 +26,10 @@ namespace opossum {
   case JIT_GET_ENUM_VALUE(0, types): \
     return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(context), to_index, context);
 
+#define JIT_ASSIGN_FROM_VECTOR_CASE(r, types) \
+  case JIT_GET_ENUM_VALUE(0, types):          \
+    return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(from_index), context);
+
 #define JIT_GROW_BY_ONE_CASE(r, types) \
   case JIT_GET_ENUM_VALUE(0, types):   \
     return context.hashmap.columns[value.column_index()].grow_by_one<JIT_GET_DATA_TYPE(0, types)>(initial_value);
@@ -70,18 +79,32 @@ void jit_or(const JitTupleValue& lhs, const JitTupleValue& rhs, const JitTupleVa
   }
 }
 
-// TODO(anyone) State Machine is currently build for every comparison. It should be build only once.
+namespace {
+
+// The pattern is usually the same for all rows, so the matcher of the last one is kept per thread
+const LikeMatcher& like_matcher_for_pattern(const std::string& pattern) {
+  thread_local auto last_pattern = std::string{};
+  thread_local auto last_matcher = std::optional<LikeMatcher>{};
+
+  if (!last_matcher || pattern != last_pattern) {
+    last_pattern = pattern;
+    last_matcher.emplace(pattern);
+  }
+  return *last_matcher;
+}
+
+}  // namespace
+
 bool jit_like(const std::string& a, const std::string& b) {
-  const auto regex_string = LikeMatcher::sql_like_to_regex(b);
-  const auto regex = std::regex{regex_string};
-  return std::regex_match(a, regex);
+  auto result = false;
+  like_matcher_for_pattern(b).resolve(false, [&](const auto& matcher) { result = matcher(a); });
+  return result;
 }
 
-// TODO(anyone) State Machine is currently build for every comparison. It should be build only once.
 bool jit_not_like(const std::string& a, const std::string& b) {
-  const auto regex_string = LikeMatcher::sql_like_to_regex(b);
-  const auto regex = std::regex{regex_string};
-  return !std::regex_match(a, regex);
+  auto result = false;
+  like_matcher_for_pattern(b).resolve(true, [&](const auto& matcher) { result = matcher(a); });
+  return result;
 }
 
 void jit_is_null(const JitTupleValue& lhs, const JitTupleValue& result, JitRuntimeContext& context) {
@@ -151,6 +174,23 @@ void jit_assign(const JitTupleValue& from, const JitHashmapValue& to, const size
   }
 }
 
+void jit_assign(JitVariantVector& from, const size_t from_index, const JitTupleValue& to, JitRuntimeContext& context) {
+  if (to.is_nullable()) {
+    const bool is_null = from.is_null(from_index);
+    to.set_is_null(is_null, context);
+    // The value is NULL - our work is done here.
+    if (is_null) {
+      return;
+    }
+  }
+
+  switch (to.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_ASSIGN_FROM_VECTOR_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      break;
+  }
+}
+
 size_t jit_grow_by_one(const JitHashmapValue& value, const JitVariantVector::InitialValue initial_value,
                        JitRuntimeContext& context) {
   switch (value.data_type()) {
@@ -166,6 +206,7 @@ size_t jit_grow_by_one(const JitHashmapValue& value, const JitVariantVector::Ini
 #undef JIT_HASH_CASE
 #undef JIT_AGGREGATE_EQUALS_CASE
 #undef JIT_ASSIGN_CASE
+#undef JIT_ASSIGN_FROM_VECTOR_CASE
 #undef JIT_GROW_BY_ONE_CASE
 
 }  // namespace opossum
@@ -255,6 +255,11 @@ __attribute__((noinline)) bool jit_aggregate_equals(const JitTupleValue& lhs, co
 __attribute__((noinline)) void jit_assign(const JitTupleValue& from, const JitHashmapValue& to, const size_t to_index,
                                           JitRuntimeContext& context);
 
+// Copies the value at @param from_index of a materialized column to a JitTupleValue. Both MUST be of the same data
+// type.
+__attribute__((noinline)) void jit_assign(JitVariantVector& from, const size_t from_index, const JitTupleValue& to,
+                                          JitRuntimeContext& context);
+
 // Adds an element to a column represented by some JitHashmapValue
 __attribute__((noinline)) size_t jit_grow_by_one(const JitHashmapValue& value,
                                                  const JitVariantVector::InitialValue initial_value,
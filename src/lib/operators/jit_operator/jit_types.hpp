@@ -113,6 +113,7 @@ class JitVariantVector {
   std::vector<bool> _is_null;
 };
 
+class BaseJitJoinHashTable;
 class BaseJitSegmentReader;
 class BaseJitSegmentWriter;
 
@@ -143,13 +144,8 @@ struct JitRuntimeContext {
   CommitID snapshot_commit_id;
 
   // MVCC data from the current input chunk required by JitValidate
-  // If the input table is a data table, its MVCC data is used.
+  // If the input table is a data table, its MVCC data is used. Holding the shared_ptr keeps it from being freed.
   std::shared_ptr<MvccData> mvcc_data;
-  // The MVCC data is locked with a SharedScopedLockingPtr. The SharedScopedLockingPtr is stored within a unique ptr as
-  // a SharedScopedLockingPtr has not the required copy assignment operator due to its reference data member.
-  // The SharedScopedLockingPtr is only used to lock and not to access MVCC as this construct requires two ptr
-  // dereferencings instead of one to access the MVCC data.
-  std::unique_ptr<SharedScopedLockingPtr<MvccData>> mvcc_data_lock;
   // The transaction ids are materialized as specialization cannot handle the atomics holding the transaction ids.
   pmr_vector<TransactionID> row_tids;
 
@@ -157,6 +153,9 @@ struct JitRuntimeContext {
   // lookup the corresponding mvcc data for each row.
   std::shared_ptr<const Table> referenced_table;
   std::shared_ptr<const PosList> pos_list;
+
+  // The hash table of the build side of a JitHashJoinProbe
+  std::shared_ptr<BaseJitJoinHashTable> join_hash_table;
 };
 
 // The JitTupleValue represents a value in the runtime tuple.
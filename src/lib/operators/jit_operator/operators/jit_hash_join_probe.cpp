@@ -0,0 +1,134 @@
+#include "jit_hash_join_probe.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "operators/jit_operator/jit_operations.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+class JitJoinHashTable : public BaseJitJoinHashTable {
+ public:
+  explicit JitJoinHashTable(std::optional<HashTable<T>>&& hash_table) : _hash_table(std::move(hash_table)) {}
+
+  std::pair<const RowID*, const RowID*> find(const JitTupleValue& probe_value,
+                                             JitRuntimeContext& context) const final {
+    // build() does not create hash tables for empty partitions
+    if (!_hash_table) return {nullptr, nullptr};
+
+    const auto row_ids = _hash_table->find(probe_value.get<T>(context));
+    return {row_ids.begin(), row_ids.end()};
+  }
+
+ private:
+  const std::optional<HashTable<T>> _hash_table;
+};
+
+}  // namespace
+
+namespace opossum {
+
+JitHashJoinProbe::JitHashJoinProbe(const JitTupleValue& probe_value, const ColumnID build_column_id)
+    : _probe_value{probe_value}, _build_column_id{build_column_id} {}
+
+std::string JitHashJoinProbe::description() const {
+  // The data types of the build columns are part of the description, as they are not known from the JitReadTuples
+  std::stringstream desc;
+  desc << "[HashJoinProbe] x" << _probe_value.tuple_index() << " = Column#" << _build_column_id << ", Build: ";
+  for (const auto& build_column : _build_columns) {
+    desc << "x" << build_column.tuple_value.tuple_index() << " = Column#" << build_column.column_id << " ("
+         << data_type_to_string.left.at(build_column.tuple_value.data_type()) << "), ";
+  }
+  return desc.str();
+}
+
+void JitHashJoinProbe::before_query(const std::shared_ptr<const Table>& build_table,
+                                    JitRuntimeContext& context) const {
+  Assert(build_table->column_data_type(_build_column_id) == _probe_value.data_type(),
+         "Both join columns must be of the same data type");
+
+  // Like the JoinHash without radix partitioning, only NULL values are skipped when materializing the build side
+  resolve_data_type(_probe_value.data_type(), [&](auto type) {
+    using JoinColumnDataType = typename decltype(type)::type;
+    auto histograms = std::vector<std::vector<size_t>>{};
+    const auto radix_container =
+        materialize_input<JoinColumnDataType, JoinColumnDataType, false>(build_table, _build_column_id, histograms, 0);
+    auto hash_tables = build<JoinColumnDataType, JoinColumnDataType>(radix_container);
+    DebugAssert(hash_tables.size() == 1, "Expected a single hash table without radix partitioning");
+    context.join_hash_table = std::make_shared<JitJoinHashTable<JoinColumnDataType>>(std::move(hash_tables.front()));
+  });
+
+  // The build rows are identified by their RowIDs (or, for reference tables, by their positions within the chunks),
+  // so the build columns are materialized chunk by chunk
+  auto& hash_table = *context.join_hash_table;
+  hash_table.chunk_offsets = determine_chunk_offsets(build_table);
+  hash_table.columns.resize(_build_columns.size());
+  for (auto column_idx = size_t{0}; column_idx < _build_columns.size(); ++column_idx) {
+    const auto& build_column = _build_columns[column_idx];
+    resolve_data_type(build_column.tuple_value.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto& values = hash_table.columns[column_idx].get_vector<ColumnDataType>();
+      auto& null_values = hash_table.columns[column_idx].get_is_null_vector();
+      values.reserve(build_table->row_count());
+      null_values.reserve(build_table->row_count());
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < build_table->chunk_count(); ++chunk_id) {
+        const auto& segment = *build_table->get_chunk(chunk_id)->get_segment(build_column.column_id);
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+          null_values.emplace_back(position.is_null());
+        });
+      }
+    });
+  }
+}
+
+JitTupleValue JitHashJoinProbe::add_build_column(const ColumnID column_id, const DataType data_type,
+                                                 const bool is_nullable, const size_t tuple_index) {
+  if (const auto tuple_value = find_build_column(column_id)) return *tuple_value;
+
+  const auto tuple_value = JitTupleValue(data_type, is_nullable, tuple_index);
+  _build_columns.push_back({column_id, tuple_value});
+  return tuple_value;
+}
+
+std::optional<JitTupleValue> JitHashJoinProbe::find_build_column(const ColumnID column_id) const {
+  const auto it = std::find_if(_build_columns.begin(), _build_columns.end(),
+                               [&column_id](const auto& build_column) { return build_column.column_id == column_id; });
+  if (it == _build_columns.end()) return std::nullopt;
+  return it->tuple_value;
+}
+
+const JitTupleValue& JitHashJoinProbe::probe_value() const { return _probe_value; }
+
+ColumnID JitHashJoinProbe::build_column_id() const { return _build_column_id; }
+
+const std::vector<JitBuildColumn>& JitHashJoinProbe::build_columns() const { return _build_columns; }
+
+void JitHashJoinProbe::_consume(JitRuntimeContext& context) const {
+  // NULL values never match
+  if (_probe_value.is_null(context)) return;
+
+  auto& hash_table = *context.join_hash_table;
+  const auto [matches_begin, matches_end] = hash_table.find(_probe_value, context);
+  for (auto match = matches_begin; match != matches_end; ++match) {
+    const auto row = hash_table.chunk_offsets[match->chunk_id] + match->chunk_offset;
+    for (auto column_idx = size_t{0}; column_idx < _build_columns.size(); ++column_idx) {
+      jit_assign(hash_table.columns[column_idx], row, _build_columns[column_idx].tuple_value, context);
+    }
+    _emit(context);
+  }
+}
+
+}  // namespace opossum
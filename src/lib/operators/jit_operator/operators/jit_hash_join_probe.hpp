@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_jittable.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// A column of the build side of a join that is copied to the runtime tuple for each match
+struct JitBuildColumn {
+  ColumnID column_id;
+  JitTupleValue tuple_value;
+};
+
+/* The hash table of the build side of a JitHashJoinProbe, along with the materialized build columns. It is built before
+ * the query is executed and stored in the JitRuntimeContext, as it is not known during specialization.
+ */
+class BaseJitJoinHashTable {
+ public:
+  virtual ~BaseJitJoinHashTable() = default;
+
+  // Returns the range of the build rows whose join key equals the @param probe_value, which must not be NULL
+  virtual std::pair<const RowID*, const RowID*> find(const JitTupleValue& probe_value,
+                                                     JitRuntimeContext& context) const = 0;
+
+  // The materialized build columns, in the order of JitHashJoinProbe::build_columns()
+  std::vector<JitVariantVector> columns;
+
+  // The position of the first row of each build chunk in the materialized columns
+  std::vector<size_t> chunk_offsets;
+};
+
+/* The JitHashJoinProbe operator performs the probe phase of an inner equi join within an operator chain, so that the
+ * tuples of the probe side are joined, computed on, and aggregated without materializing an intermediate result.
+ * Before the query is executed, the build side (the left input of the join, which the JitOperatorWrapper receives as
+ * its right input) is hashed by the build phase of the JoinHash (see join_hash_steps.hpp) and the build columns used
+ * by the later operators are materialized. For each incoming tuple, the operator looks up its probe value and, for each
+ * matching build row, copies the build columns to the runtime tuple and emits the tuple.
+ *
+ * Both join columns must be of the same data type. NULL values never match.
+ */
+class JitHashJoinProbe : public AbstractJittable {
+ public:
+  JitHashJoinProbe(const JitTupleValue& probe_value, const ColumnID build_column_id);
+
+  std::string description() const final;
+
+  // Hashes the join column and materializes the build columns of the @param build_table into the runtime context
+  void before_query(const std::shared_ptr<const Table>& build_table, JitRuntimeContext& context) const;
+
+  // Adds a column of the build side that is copied to the runtime tuple slot with the @param tuple_index for each
+  // match. If the column was added before, its JitTupleValue is returned instead.
+  JitTupleValue add_build_column(const ColumnID column_id, const DataType data_type, const bool is_nullable,
+                                 const size_t tuple_index);
+  std::optional<JitTupleValue> find_build_column(const ColumnID column_id) const;
+
+  const JitTupleValue& probe_value() const;
+  ColumnID build_column_id() const;
+  const std::vector<JitBuildColumn>& build_columns() const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  const JitTupleValue _probe_value;
+  const ColumnID _build_column_id;
+  std::vector<JitBuildColumn> _build_columns;
+};
+
+}  // namespace opossum
@@ -1,8 +1,51 @@
 #include "jit_read_tuples.hpp"
 
 #include "../jit_types.hpp"
+#include "constant_mappings.hpp"
 #include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "type_cast.hpp"
+#include "type_comparison.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The ValueIDs [begin, end) (or, if negate is set, all other ValueIDs) whose values satisfy a predicate
+struct ValueIdRange {
+  ValueID begin;
+  ValueID end;
+  bool negate;
+};
+
+ValueIdRange get_value_id_range(const BaseDictionarySegment& segment, const PredicateCondition predicate_condition,
+                                const AllTypeVariant& value) {
+  // See ColumnVsValueTableScanImpl::_scan_dictionary_segment for how the predicates translate to ValueIDs
+  const auto unique_values_count = ValueID{segment.unique_values_count()};
+  const auto lower_bound = std::min(segment.lower_bound(value), unique_values_count);
+  const auto upper_bound = std::min(segment.upper_bound(value), unique_values_count);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return {lower_bound, upper_bound, false};
+    case PredicateCondition::NotEquals:
+      return {lower_bound, upper_bound, true};
+    case PredicateCondition::LessThan:
+      return {ValueID{0}, lower_bound, false};
+    case PredicateCondition::LessThanEquals:
+      return {ValueID{0}, upper_bound, false};
+    case PredicateCondition::GreaterThan:
+      return {upper_bound, unique_values_count, false};
+    case PredicateCondition::GreaterThanEquals:
+      return {lower_bound, unique_values_count, false};
+    default:
+      Fail("Unsupported predicate condition");
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -17,6 +60,11 @@ std::string JitReadTuples::description() const {
   for (const auto& input_literal : _input_literals) {
     desc << "x" << input_literal.tuple_value.tuple_index() << " = " << input_literal.value << ", ";
   }
+  for (const auto& input_predicate : _input_predicates) {
+    desc << "x" << input_predicate.tuple_value.tuple_index() << " = Column#" << input_predicate.column_id << " "
+         << predicate_condition_to_string.left.at(input_predicate.predicate_condition) << " " << input_predicate.value
+         << ", ";
+  }
   return desc.str();
 }
 
@@ -55,8 +103,6 @@ void JitReadTuples::before_chunk(const Table& in_table, const Chunk& in_chunk, J
       for (const auto& tid : in_chunk.mvcc_data()->tids) {
         *itr++ = tid.load();
       }
-      // Lock MVCC data before accessing it.
-      context.mvcc_data_lock = std::make_unique<SharedScopedLockingPtr<MvccData>>(in_chunk.get_scoped_mvcc_data_lock());
       context.mvcc_data = in_chunk.mvcc_data();
     } else {
       DebugAssert(in_chunk.references_exactly_one_table(),
@@ -90,6 +136,48 @@ void JitReadTuples::before_chunk(const Table& in_table, const Chunk& in_chunk, J
       });
     }
   }
+
+  // Create a reader that evaluates each input predicate. Dictionary segments are not decompressed for this.
+  for (const auto& input_predicate : _input_predicates) {
+    const auto column_id = input_predicate.column_id;
+    const auto segment = in_chunk.get_segment(column_id);
+    const auto is_nullable = in_table.column_is_nullable(column_id);
+    const auto& tuple_value = input_predicate.tuple_value;
+
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+      const auto range = get_value_id_range(*dictionary_segment, input_predicate.predicate_condition,
+                                            input_predicate.value);
+      const auto null_value_id = dictionary_segment->null_value_id();
+      resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& vector) {
+        using IteratorType = decltype(vector.cbegin());
+        if (is_nullable) {
+          context.inputs.push_back(std::make_shared<JitValueIdPredicateReader<IteratorType, true>>(
+              vector.cbegin(), range.begin, range.end, range.negate, null_value_id, tuple_value));
+        } else {
+          context.inputs.push_back(std::make_shared<JitValueIdPredicateReader<IteratorType, false>>(
+              vector.cbegin(), range.begin, range.end, range.negate, null_value_id, tuple_value));
+        }
+      });
+      continue;
+    }
+
+    segment_with_iterators(*segment, [&](auto it, const auto end) {
+      using IteratorType = decltype(it);
+      using Type = typename IteratorType::ValueType;
+      const auto typed_value = type_cast_variant<Type>(input_predicate.value);
+
+      with_comparator(input_predicate.predicate_condition, [&](auto comparator) {
+        using ComparatorType = decltype(comparator);
+        if (is_nullable) {
+          context.inputs.push_back(std::make_shared<JitPredicateReader<IteratorType, Type, true, ComparatorType>>(
+              it, typed_value, comparator, tuple_value));
+        } else {
+          context.inputs.push_back(std::make_shared<JitPredicateReader<IteratorType, Type, false, ComparatorType>>(
+              it, typed_value, comparator, tuple_value));
+        }
+      });
+    });
+  }
 }
 
 void JitReadTuples::execute(JitRuntimeContext& context) const {
@@ -127,6 +215,23 @@ JitTupleValue JitReadTuples::add_literal_value(const AllTypeVariant& value) {
   return tuple_value;
 }
 
+JitTupleValue JitReadTuples::add_input_predicate(const ColumnID column_id, const bool is_nullable,
+                                                 const PredicateCondition predicate_condition,
+                                                 const AllTypeVariant& value) {
+  Assert(!variant_is_null(value), "Comparisons with NULL are never true and should not be evaluated");
+  Assert(predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals ||
+             predicate_condition == PredicateCondition::LessThan ||
+             predicate_condition == PredicateCondition::LessThanEquals ||
+             predicate_condition == PredicateCondition::GreaterThan ||
+             predicate_condition == PredicateCondition::GreaterThanEquals,
+         "Unsupported predicate condition for an input predicate");
+
+  // The result is NULL if the value of the column is NULL
+  const auto tuple_value = JitTupleValue(DataType::Bool, is_nullable, _num_tuple_values++);
+  _input_predicates.push_back({column_id, predicate_condition, value, tuple_value});
+  return tuple_value;
+}
+
 size_t JitReadTuples::add_temporary_value() {
   // Somebody wants to store a temporary value in the runtime tuple. We don't really care about the value itself,
   // but have to remember to make some space for it when we create the runtime tuple.
@@ -137,6 +242,8 @@ std::vector<JitInputColumn> JitReadTuples::input_columns() const { return _input
 
 std::vector<JitInputLiteral> JitReadTuples::input_literals() const { return _input_literals; }
 
+std::vector<JitInputPredicate> JitReadTuples::input_predicates() const { return _input_predicates; }
+
 std::optional<ColumnID> JitReadTuples::find_input_column(const JitTupleValue& tuple_value) const {
   const auto it = std::find_if(_input_columns.begin(), _input_columns.end(), [&tuple_value](const auto& input_column) {
     return input_column.tuple_value == tuple_value;
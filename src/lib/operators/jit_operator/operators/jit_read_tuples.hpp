@@ -27,10 +27,18 @@ struct JitInputLiteral {
   JitTupleValue tuple_value;
 };
 
+// A comparison of an input column with a value, whose (nullable boolean) result is stored to the tuple_value
+struct JitInputPredicate {
+  ColumnID column_id;
+  PredicateCondition predicate_condition;
+  AllTypeVariant value;
+  JitTupleValue tuple_value;
+};
+
 /* JitReadTuples must be the first operator in any chain of jit operators.
  * It is responsible for:
  * 1) storing literal values to the runtime tuple before the query is executed
- * 2) reading data from the the input table to the runtime tuple
+ * 2) reading data from the the input table to the runtime tuple (and evaluating input predicates on it)
  * 3) advancing the segment iterators
  * 4) keeping track of the number of values in the runtime tuple. Whenever
  *    another operator needs to store a temporary value in the runtime tuple,
@@ -84,6 +92,70 @@ class JitReadTuples : public AbstractJittable {
     JitTupleValue _tuple_value;
   };
 
+  /* JitPredicateReaders evaluate an input predicate instead of reading the value of the segment: they compare each
+   * value from the _iterator with the _value and store the result to their JitTupleValue.
+   */
+  template <typename Iterator, typename DataType, bool Nullable, typename Comparator>
+  class JitPredicateReader : public BaseJitSegmentReader {
+   public:
+    JitPredicateReader(const Iterator& iterator, const DataType& value, const Comparator& comparator,
+                       const JitTupleValue& tuple_value)
+        : _iterator{iterator}, _value{value}, _comparator{comparator}, _tuple_value{tuple_value} {}
+
+    void read_value(JitRuntimeContext& context) {
+      const auto& value = *_iterator;
+      ++_iterator;
+      if constexpr (Nullable) {
+        context.tuple.set_is_null(_tuple_value.tuple_index(), value.is_null());
+        if (value.is_null()) return;
+      }
+      context.tuple.set<bool>(_tuple_value.tuple_index(), _comparator(value.value(), _value));
+    }
+
+   private:
+    Iterator _iterator;
+    const DataType _value;
+    const Comparator _comparator;
+    JitTupleValue _tuple_value;
+  };
+
+  /* JitValueIdPredicateReaders evaluate an input predicate on a dictionary segment without decompressing it. Like the
+   * ColumnVsValueTableScanImpl, the predicate is translated to a range of ValueIDs (or its complement) before the
+   * chunk is processed, so that only the ValueIDs read from the compressed attribute vector (e.g., a SimdBp128Vector
+   * or a FixedSizeByteAlignedVector) have to be compared.
+   */
+  template <typename Iterator, bool Nullable>
+  class JitValueIdPredicateReader : public BaseJitSegmentReader {
+   public:
+    JitValueIdPredicateReader(const Iterator& iterator, const ValueID begin, const ValueID end, const bool negate,
+                              const ValueID null_value_id, const JitTupleValue& tuple_value)
+        : _iterator{iterator},
+          _begin{begin},
+          _end{end},
+          _negate{negate},
+          _null_value_id{null_value_id},
+          _tuple_value{tuple_value} {}
+
+    void read_value(JitRuntimeContext& context) {
+      const auto value_id = static_cast<ValueID::base_type>(*_iterator);
+      ++_iterator;
+      if constexpr (Nullable) {
+        const auto is_null = value_id == _null_value_id;
+        context.tuple.set_is_null(_tuple_value.tuple_index(), is_null);
+        if (is_null) return;
+      }
+      context.tuple.set<bool>(_tuple_value.tuple_index(), (value_id >= _begin && value_id < _end) != _negate);
+    }
+
+   private:
+    Iterator _iterator;
+    const ValueID::base_type _begin;
+    const ValueID::base_type _end;
+    const bool _negate;
+    const ValueID::base_type _null_value_id;
+    JitTupleValue _tuple_value;
+  };
+
  public:
   explicit JitReadTuples(const bool has_validate = false);
 
@@ -96,8 +168,16 @@ class JitReadTuples : public AbstractJittable {
   JitTupleValue add_literal_value(const AllTypeVariant& value);
   size_t add_temporary_value();
 
+  // Adds a comparison of the input column with the @param column_id with the (non-NULL) @param value, which is
+  // evaluated while reading the input segments. This way, predicates on dictionary segments are evaluated on the
+  // ValueIDs without decompressing the segments. The data type of the value should match that of the column,
+  // otherwise the value is cast like by the TableScan.
+  JitTupleValue add_input_predicate(const ColumnID column_id, const bool is_nullable,
+                                    const PredicateCondition predicate_condition, const AllTypeVariant& value);
+
   std::vector<JitInputColumn> input_columns() const;
   std::vector<JitInputLiteral> input_literals() const;
+  std::vector<JitInputPredicate> input_predicates() const;
 
   std::optional<ColumnID> find_input_column(const JitTupleValue& tuple_value) const;
   std::optional<AllTypeVariant> find_literal_value(const JitTupleValue& tuple_value) const;
@@ -108,6 +188,7 @@ class JitReadTuples : public AbstractJittable {
   uint32_t _num_tuple_values{0};
   std::vector<JitInputColumn> _input_columns;
   std::vector<JitInputLiteral> _input_literals;
+  std::vector<JitInputPredicate> _input_predicates;
 
  private:
   void _consume(JitRuntimeContext& context) const final {}
@@ -1,14 +1,21 @@
 #include "jit_operator_wrapper.hpp"
 
+#include <chrono>
+#include <future>
+
+#include "constant_mappings.hpp"
+#include "operators/jit_operator/jit_module_cache.hpp"
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
 
 namespace opossum {
 
 JitOperatorWrapper::JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
                                        const JitExecutionMode execution_mode,
-                                       const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators)
-    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left},
+                                       const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                                       const std::shared_ptr<const AbstractOperator>& right)
+    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left, right},
       _execution_mode{execution_mode},
       _jit_operators{jit_operators} {}
 
@@ -38,6 +45,26 @@ const std::shared_ptr<AbstractJittableSink> JitOperatorWrapper::_sink() const {
   return std::dynamic_pointer_cast<AbstractJittableSink>(_jit_operators.back());
 }
 
+std::string JitOperatorWrapper::_module_cache_key(const Table& in_table) const {
+  std::stringstream key;
+  key << table_type_to_string.left.at(in_table.type()) << " ";
+  for (const auto& input_column : _source()->input_columns()) {
+    const auto& tuple_value = input_column.tuple_value;
+    key << "x" << tuple_value.tuple_index() << " = Column#" << input_column.column_id << " of type "
+        << static_cast<int>(tuple_value.data_type()) << (tuple_value.is_nullable() ? " NULL" : "") << ", ";
+  }
+  for (const auto& input_literal : _source()->input_literals()) {
+    const auto& tuple_value = input_literal.tuple_value;
+    key << "x" << tuple_value.tuple_index() << " = Literal of type " << static_cast<int>(tuple_value.data_type())
+        << (tuple_value.is_nullable() ? " NULL" : "") << ", ";
+  }
+  // The description of the JitReadTuples contains the values of the literals, so it is left out
+  for (auto it = _jit_operators.begin() + 1; it != _jit_operators.end(); ++it) {
+    key << "| " << (*it)->description() << " ";
+  }
+  return key.str();
+}
+
 std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   Assert(_source(), "JitOperatorWrapper does not have a valid source node.");
   Assert(_sink(), "JitOperatorWrapper does not have a valid sink node.");
@@ -58,6 +85,9 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   for (auto& jit_operator : _jit_operators) {
     if (auto jit_validate = std::dynamic_pointer_cast<JitValidate>(jit_operator)) {
       jit_validate->set_input_table_type(in_table.type());
+    } else if (const auto jit_hash_join_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operator)) {
+      Assert(input_right(), "JitHashJoinProbe requires a build input");
+      jit_hash_join_probe->before_query(input_right()->get_output(), context);
     }
   }
 
@@ -66,23 +96,32 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
     (*it)->set_next_operator(*(it + 1));
   }
 
-  std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
-  // We want to perform two specialization passes if the operator chain contains a JitAggregate operator, since the
-  // JitAggregate operator contains multiple loops that need unrolling.
-  auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
-  switch (_execution_mode) {
-    case JitExecutionMode::Compile:
-      // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
-      execute_func = _module.specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
-          "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
-          std::make_shared<JitConstantRuntimePointer>(_source().get()), two_specialization_passes);
-      break;
-    case JitExecutionMode::Interpret:
-      execute_func = &JitReadTuples::execute;
-      break;
+  JitCompiledPipeline::ExecuteFunction execute_func = &JitReadTuples::execute;
+  // Also keeps the compiled code alive until the query is done
+  std::shared_ptr<JitCompiledPipeline> compiled_pipeline;
+  if (_execution_mode != JitExecutionMode::Interpret) {
+    // We want to perform two specialization passes if the operator chain contains a JitAggregate operator, since the
+    // JitAggregate operator contains multiple loops that need unrolling.
+    const auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
+    compiled_pipeline =
+        JitModuleCache::get().get_or_compile(_module_cache_key(in_table), _jit_operators, two_specialization_passes,
+                                             _execution_mode == JitExecutionMode::CompileAsync);
+  }
+
+  auto uses_compiled_pipeline = false;
+  if (_execution_mode == JitExecutionMode::Compile) {
+    execute_func = compiled_pipeline->execute_function.get();
+    uses_compiled_pipeline = true;
   }
 
   for (opossum::ChunkID chunk_id{0}; chunk_id < in_table.chunk_count(); ++chunk_id) {
+    // Switch to the compiled pipeline as soon as its compilation in the background is done
+    if (compiled_pipeline && !uses_compiled_pipeline &&
+        compiled_pipeline->execute_function.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+      execute_func = compiled_pipeline->execute_function.get();
+      uses_compiled_pipeline = true;
+    }
+
     const auto& in_chunk = *in_table.get_chunk(chunk_id);
     _source()->before_chunk(in_table, in_chunk, context);
     execute_func(_source().get(), context);
@@ -97,7 +136,7 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
 std::shared_ptr<AbstractOperator> JitOperatorWrapper::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _jit_operators);
+  return std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _jit_operators, copied_input_right);
 }
 
 void JitOperatorWrapper::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
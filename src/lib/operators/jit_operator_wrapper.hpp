@@ -5,11 +5,13 @@
 #include "abstract_read_only_operator.hpp"
 #include "jit_operator/operators/abstract_jittable_sink.hpp"
 #include "jit_operator/operators/jit_read_tuples.hpp"
-#include "operators/jit_operator/specialization/jit_code_specializer.hpp"
 
 namespace opossum {
 
-enum class JitExecutionMode { Interpret, Compile };
+// Compile waits for the compiled pipeline before the first chunk is processed. CompileAsync interprets the chunks
+// until the compilation (running in the background) is done and uses the compiled pipeline for the remaining chunks.
+// Compiled pipelines are cached by the JitModuleCache in both modes.
+enum class JitExecutionMode { Interpret, Compile, CompileAsync };
 
 /* The JitOperatorWrapper wraps a number of jittable operators and exposes them through Hyrise's default
  * operator interface. This allows a number of jit operators to be seamlessly integrated with
@@ -20,9 +22,11 @@ enum class JitExecutionMode { Interpret, Compile };
  */
 class JitOperatorWrapper : public AbstractReadOnlyOperator {
  public:
+  // The @param right input is only used as the build side of a JitHashJoinProbe
   explicit JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
-                              const JitExecutionMode execution_mode = JitExecutionMode::Compile,
-                              const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators = {});
+                              const JitExecutionMode execution_mode = JitExecutionMode::CompileAsync,
+                              const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators = {},
+                              const std::shared_ptr<const AbstractOperator>& right = nullptr);
 
   const std::string name() const final;
   const std::string description(DescriptionMode description_mode) const final;
@@ -45,8 +49,12 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
   const std::shared_ptr<JitReadTuples> _source() const;
   const std::shared_ptr<AbstractJittableSink> _sink() const;
 
+  // The key of the pipeline in the JitModuleCache. It describes everything that the specialized code depends on, i.e.,
+  // the operators, the tuple values they work on including their data types, and the type of the input table, but not
+  // the values of literals or parameters, which are only stored in the runtime context.
+  std::string _module_cache_key(const Table& in_table) const;
+
   const JitExecutionMode _execution_mode;
-  JitCodeSpecializer _module;
   std::vector<std::shared_ptr<AbstractJittable>> _jit_operators;
 };
 
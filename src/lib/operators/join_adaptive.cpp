@@ -0,0 +1,204 @@
+#include "join_adaptive.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cost_model/cost_model_physical.hpp"
+#include "join_hash.hpp"
+#include "join_index.hpp"
+#include "join_nested_loop.hpp"
+#include "join_sort_merge.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Whether all chunks of the @param table are sorted ascending by the column with the @param column_id
+bool is_sorted_by(const Table& table, const ColumnID column_id) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& ordered_by = table.get_chunk(chunk_id)->ordered_by();
+    if (!ordered_by || ordered_by->first != column_id ||
+        (ordered_by->second != OrderByMode::Ascending && ordered_by->second != OrderByMode::AscendingNullsLast)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The first feature of JoinSortMerge for one input: rows * log2(rows) for sorting it, or rows * log2(chunks) for
+// merging the sorted runs of its chunks if they are sorted already
+float sort_feature(const Table& table, const ColumnID column_id) {
+  const auto row_count = static_cast<float>(table.row_count());
+  const auto run_count = is_sorted_by(table, column_id) ? static_cast<float>(table.chunk_count()) : row_count;
+  return row_count * std::log2(std::max(run_count, 1.0f));
+}
+
+// The number of index lookups per probed row if the @param table has an index on the column with the @param column_id,
+// i.e., one for a TableIndex or one per chunk for chunk indexes, or std::nullopt if the column is not (fully) indexed
+std::optional<size_t> indexed_chunk_count(const Table& table, const ColumnID column_id) {
+  // Indexes belong to stored tables, the chunks of intermediate results do not have any
+  if (table.type() != TableType::Data || table.chunk_count() == 0) return std::nullopt;
+  if (table.get_table_index(column_id)) return size_t{1};
+
+  const auto column_ids = std::vector<ColumnID>{column_id};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (table.get_chunk(chunk_id)->get_indices(column_ids).empty()) return std::nullopt;
+  }
+  return static_cast<size_t>(table.chunk_count());
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinAdaptive::JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                           const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+                           const std::shared_ptr<const CostModelPhysical>& cost_model)
+    : AbstractJoinOperator(OperatorType::JoinAdaptive, left, right, mode, column_ids, predicate_condition),
+      _cost_model(cost_model ? cost_model : std::make_shared<CostModelPhysical>()) {}
+
+const std::string JoinAdaptive::name() const { return "JoinAdaptive"; }
+
+const std::string JoinAdaptive::description(DescriptionMode description_mode) const {
+  auto description = AbstractJoinOperator::description(description_mode);
+  if (!_executed_join) return description;
+
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  description += separator + ("executed as " + _executed_join->name());
+  if (_inputs_swapped) description += " with swapped inputs";
+  return description;
+}
+
+std::shared_ptr<const AbstractJoinOperator> JoinAdaptive::executed_join() const { return _executed_join; }
+
+bool JoinAdaptive::inputs_swapped() const { return _inputs_swapped; }
+
+std::shared_ptr<AbstractOperator> JoinAdaptive::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinAdaptive>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                        _cost_model);
+}
+
+void JoinAdaptive::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::pair<OperatorType, bool> JoinAdaptive::_choose_join_type() const {
+  const auto& left_table = *input_table_left();
+  const auto& right_table = *input_table_right();
+  const auto left_row_count = static_cast<float>(left_table.row_count());
+  const auto right_row_count = static_cast<float>(right_table.row_count());
+  const auto output_row_count = std::max(left_row_count, right_row_count);
+
+  const auto is_semi_or_anti_join = _mode == JoinMode::Semi || _mode == JoinMode::Anti;
+  const auto is_comparison = _predicate_condition == PredicateCondition::Equals ||
+                             _predicate_condition == PredicateCondition::NotEquals ||
+                             _predicate_condition == PredicateCondition::LessThan ||
+                             _predicate_condition == PredicateCondition::LessThanEquals ||
+                             _predicate_condition == PredicateCondition::GreaterThan ||
+                             _predicate_condition == PredicateCondition::GreaterThanEquals;
+  // JoinSortMerge compares the values of both columns as one type, and the indexes look up the values of the other
+  // column
+  const auto have_same_data_types =
+      left_table.column_data_type(_column_ids.first) == right_table.column_data_type(_column_ids.second);
+
+  auto cheapest_join_type = std::optional<OperatorType>{};
+  auto cheapest_cost = Cost{0};
+  auto cheapest_inputs_swapped = false;
+  const auto consider = [&](const OperatorType join_type, const Cost cost, const bool inputs_swapped) {
+    if (cheapest_join_type && cost >= cheapest_cost) return;
+
+    cheapest_join_type = join_type;
+    cheapest_cost = cost;
+    cheapest_inputs_swapped = inputs_swapped;
+  };
+
+  if (_predicate_condition == PredicateCondition::Equals && _mode != JoinMode::Outer) {
+    consider(OperatorType::JoinHash,
+             _cost_model->estimate_join_cost(OperatorType::JoinHash, left_row_count, right_row_count, output_row_count),
+             false);
+  }
+
+  if (!is_semi_or_anti_join && is_comparison && have_same_data_types) {
+    if (_predicate_condition != PredicateCondition::NotEquals || _mode == JoinMode::Inner) {
+      const auto features = std::vector<float>{
+          sort_feature(left_table, _column_ids.first) + sort_feature(right_table, _column_ids.second),
+          left_row_count + right_row_count, output_row_count};
+      consider(OperatorType::JoinSortMerge, _cost_model->cost_function(OperatorType::JoinSortMerge)(features), false);
+    }
+
+    if (const auto chunk_count = indexed_chunk_count(right_table, _column_ids.second)) {
+      consider(OperatorType::JoinIndex,
+               _cost_model->estimate_join_cost(OperatorType::JoinIndex, left_row_count, right_row_count,
+                                               output_row_count, *chunk_count),
+               false);
+    }
+
+    if (_mode == JoinMode::Inner) {
+      if (const auto chunk_count = indexed_chunk_count(left_table, _column_ids.first)) {
+        consider(OperatorType::JoinIndex,
+                 _cost_model->estimate_join_cost(OperatorType::JoinIndex, right_row_count, left_row_count,
+                                                 output_row_count, *chunk_count),
+                 true);
+      }
+    }
+  }
+
+  if (cheapest_join_type) return {*cheapest_join_type, cheapest_inputs_swapped};
+
+  return {is_semi_or_anti_join ? OperatorType::JoinSortMerge : OperatorType::JoinNestedLoop, false};
+}
+
+std::shared_ptr<const Table> JoinAdaptive::_on_execute() {
+  const auto [join_type, inputs_swapped] = _choose_join_type();
+  _inputs_swapped = inputs_swapped;
+
+  const auto& left = _inputs_swapped ? _input_right : _input_left;
+  const auto& right = _inputs_swapped ? _input_left : _input_right;
+  const auto column_ids = _inputs_swapped ? ColumnIDPair{_column_ids.second, _column_ids.first} : _column_ids;
+  const auto predicate_condition =
+      _inputs_swapped ? flip_predicate_condition(_predicate_condition) : _predicate_condition;
+
+  switch (join_type) {
+    case OperatorType::JoinHash:
+      _executed_join = std::make_shared<JoinHash>(left, right, _mode, column_ids, predicate_condition);
+      break;
+    case OperatorType::JoinSortMerge:
+      _executed_join = std::make_shared<JoinSortMerge>(left, right, _mode, column_ids, predicate_condition);
+      break;
+    case OperatorType::JoinIndex:
+      _executed_join = std::make_shared<JoinIndex>(left, right, _mode, column_ids, predicate_condition);
+      break;
+    case OperatorType::JoinNestedLoop:
+      _executed_join = std::make_shared<JoinNestedLoop>(left, right, _mode, column_ids, predicate_condition);
+      break;
+    default:
+      Fail("Unexpected join type");
+  }
+
+  _executed_join->execute();
+  const auto output = _executed_join->get_output();
+  if (!_inputs_swapped) return output;
+
+  // The columns of the swapped join's output are those of the right input followed by those of the left one
+  DebugAssert(_mode == JoinMode::Inner, "Only the inputs of inner joins are swapped");
+  auto output_table = _initialize_output_table();
+  const auto right_column_count = static_cast<size_t>(input_table_right()->column_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& segments = output->get_chunk(chunk_id)->segments();
+    auto reordered_segments = Segments{segments.begin() + right_column_count, segments.end()};
+    reordered_segments.insert(reordered_segments.end(), segments.begin(), segments.begin() + right_column_count);
+    output_table->append_chunk(reordered_segments);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
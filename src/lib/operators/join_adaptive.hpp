@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class CostModelPhysical;
+
+/**
+ * Chooses the join algorithm once its inputs are executed, by their actual row counts instead of the estimates that the
+ * LQPTranslator chooses by, and executes the join that the CostModelPhysical deems cheapest for them:
+ *  - JoinHash builds the hash table on the smaller input itself, unless the join mode fixes the build side.
+ *  - JoinSortMerge merges the sorted runs of the chunks of inputs that are sorted by their join columns already (see
+ *    Chunk::ordered_by()) instead of sorting them, so that its sort phase is costed with one run per chunk then.
+ *  - JoinIndex is considered if the right input is a stored table with an index on its join column (a TableIndex or
+ *    chunk indexes on all chunks). For inner joins, the left input may be the indexed one. The inputs of the JoinIndex
+ *    are swapped then, and the columns of its output are put back in the order of the inputs.
+ *
+ * The joins are considered for the join modes and predicates that the LQPTranslator considers them for, JoinSortMerge
+ * and JoinIndex only for columns of the same type. As the output row count is not known before the join, it is assumed
+ * to be that of the larger input, as for joins on keys.
+ */
+class JoinAdaptive : public AbstractJoinOperator {
+ public:
+  JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+               const std::shared_ptr<const CostModelPhysical>& cost_model = nullptr);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  // The join that was executed, nullptr before the execution
+  std::shared_ptr<const AbstractJoinOperator> executed_join() const;
+
+  // Whether the inputs of the executed join were swapped
+  bool inputs_swapped() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // The cheapest join for the input tables and whether its inputs are swapped
+  std::pair<OperatorType, bool> _choose_join_type() const;
+
+  const std::shared_ptr<const CostModelPhysical> _cost_model;
+
+  std::shared_ptr<AbstractJoinOperator> _executed_join;
+  bool _inputs_swapped{false};
+};
+
+}  // namespace opossum
@@ -1,47 +1,314 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "boost/functional/hash.hpp"
+
 #include "bytell_hash_map.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/base_column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "table_wrapper.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The partitions of the chunks of a join input whose rows come from a partitioned table (see PartitionSchema)
+struct InputPartitioning {
+  std::shared_ptr<const PartitionSchema> partition_schema;
+  // std::nullopt for empty chunks
+  std::vector<std::optional<PartitionID>> chunk_partition_ids;
+};
+
+// @return The partitioning of the @param table, if it is partitioned by the column with the @param column_id and each
+// chunk holds rows of a single partition, which is the case for the chunks of the partitioned table and their scans
+std::optional<InputPartitioning> input_partitioning(const Table& table, const ColumnID column_id) {
+  auto partitioning = InputPartitioning{};
+
+  if (table.type() == TableType::Data) {
+    partitioning.partition_schema = table.partition_schema();
+    if (!partitioning.partition_schema || partitioning.partition_schema->column_id() != column_id) return std::nullopt;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      partitioning.chunk_partition_ids.emplace_back(table.get_chunk(chunk_id)->partition_id());
+    }
+    return partitioning;
+  }
+
+  auto referenced_table = std::shared_ptr<const Table>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto reference_segment =
+        std::static_pointer_cast<const ReferenceSegment>(table.get_chunk(chunk_id)->get_segment(column_id));
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty()) {
+      partitioning.chunk_partition_ids.emplace_back(std::nullopt);
+      continue;
+    }
+
+    if (!referenced_table) {
+      referenced_table = reference_segment->referenced_table();
+      partitioning.partition_schema = referenced_table->partition_schema();
+    }
+    if (reference_segment->referenced_table() != referenced_table || !partitioning.partition_schema ||
+        reference_segment->referenced_column_id() != partitioning.partition_schema->column_id() ||
+        !pos_list.references_single_chunk()) {
+      return std::nullopt;
+    }
+
+    partitioning.chunk_partition_ids.emplace_back(
+        referenced_table->get_chunk(pos_list.common_chunk_id())->partition_id());
+  }
+
+  if (!referenced_table) return std::nullopt;
+  return partitioning;
+}
+
+// @return The chunks with the @param chunk_ids as a reference table. The rows of data tables are referenced, so that
+// the output of the join references the table itself.
+std::shared_ptr<Table> partition_input(const std::shared_ptr<const Table>& table,
+                                       const std::vector<ChunkID>& chunk_ids) {
+  auto partition_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (table->type() == TableType::References) {
+      partition_table->append_chunk(chunk->segments());
+      continue;
+    }
+
+    auto pos_list = std::make_shared<PosList>(chunk->size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+    pos_list->guarantee_single_chunk();
+
+    Segments segments;
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    partition_table->append_chunk(segments);
+  }
+
+  return partition_table;
+}
+
+// @return A table with a single, nullable Long column that holds a hash of the values of the @param column_ids in each
+// row of the @param table, or NULL if any of them is NULL. It has the same chunks as the table, so that its RowIDs
+// identify the rows of the table. Used as the join column of joins on multiple column pairs.
+std::shared_ptr<Table> composite_key_table(const std::shared_ptr<const Table>& table,
+                                           const std::vector<ColumnID>& column_ids) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("composite_key", DataType::Long, true);
+  auto key_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  key_table->create_chunk_slots(table->chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table->get_chunk(chunk_id);
+      auto hashes = std::vector<size_t>(chunk->size());
+      auto null_values = std::vector<bool>(chunk->size());
+
+      for (const auto column_id : column_ids) {
+        resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+            if (position.is_null()) {
+              null_values[position.chunk_offset()] = true;
+            } else {
+              boost::hash_combine(hashes[position.chunk_offset()], position.value());
+            }
+          });
+        });
+      }
+
+      auto keys = std::vector<int64_t>(hashes.size());
+      std::transform(hashes.begin(), hashes.end(), keys.begin(),
+                     [](const auto hash) { return static_cast<int64_t>(hash); });
+      key_table->set_chunk_slot(chunk_id, Segments{std::make_shared<ValueSegment<int64_t>>(std::move(keys),
+                                                                                            std::move(null_values))});
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  key_table->append_chunk_slots();
+
+  return key_table;
+}
+
+// @return The values of the column with the @param column_id of the @param table, by chunk and chunk offset. NULLs are
+// default-constructed, as their rows have a NULL composite key and thus never match.
+template <typename T>
+std::vector<std::vector<T>> materialize_key_values(const Table& table, const ColumnID column_id) {
+  auto values = std::vector<std::vector<T>>(table.chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+      auto& chunk_values = values[chunk_id];
+      chunk_values.resize(segment.size());
+      segment_iterate<T>(segment, [&](const auto& position) {
+        if (!position.is_null()) chunk_values[position.chunk_offset()] = position.value();
+      });
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return values;
+}
+
+// Removes the matches of an inner join whose values differ in any of the @param key_column_ids. These are the matches
+// of rows whose composite keys (see composite_key_table()) merely share the hash.
+void remove_composite_key_collisions(const Table& left_table, const Table& right_table,
+                                     const std::vector<ColumnIDPair>& key_column_ids,
+                                     std::vector<PosList>& left_pos_lists, std::vector<PosList>& right_pos_lists) {
+  auto matches = std::vector<std::vector<bool>>(left_pos_lists.size());
+  for (auto pos_list_idx = size_t{0}; pos_list_idx < left_pos_lists.size(); ++pos_list_idx) {
+    matches[pos_list_idx].resize(left_pos_lists[pos_list_idx].size(), true);
+  }
+
+  for (const auto& [left_column_id, right_column_id] : key_column_ids) {
+    resolve_data_type(left_table.column_data_type(left_column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto left_values = materialize_key_values<ColumnDataType>(left_table, left_column_id);
+      const auto right_values = materialize_key_values<ColumnDataType>(right_table, right_column_id);
+
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(left_pos_lists.size());
+      for (auto pos_list_idx = size_t{0}; pos_list_idx < left_pos_lists.size(); ++pos_list_idx) {
+        if (left_pos_lists[pos_list_idx].empty()) continue;
+
+        jobs.emplace_back(std::make_shared<JobTask>([&, pos_list_idx]() {
+          const auto& left_pos_list = left_pos_lists[pos_list_idx];
+          const auto& right_pos_list = right_pos_lists[pos_list_idx];
+          auto& pos_list_matches = matches[pos_list_idx];
+          for (auto match_idx = size_t{0}; match_idx < left_pos_list.size(); ++match_idx) {
+            const auto& left_row_id = left_pos_list[match_idx];
+            const auto& right_row_id = right_pos_list[match_idx];
+            if (left_values[left_row_id.chunk_id][left_row_id.chunk_offset] !=
+                right_values[right_row_id.chunk_id][right_row_id.chunk_offset]) {
+              pos_list_matches[match_idx] = false;
+            }
+          }
+        }));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+    });
+  }
+
+  for (auto pos_list_idx = size_t{0}; pos_list_idx < left_pos_lists.size(); ++pos_list_idx) {
+    auto& left_pos_list = left_pos_lists[pos_list_idx];
+    auto& right_pos_list = right_pos_lists[pos_list_idx];
+    const auto& pos_list_matches = matches[pos_list_idx];
+
+    auto output_idx = size_t{0};
+    for (auto match_idx = size_t{0}; match_idx < left_pos_list.size(); ++match_idx) {
+      if (!pos_list_matches[match_idx]) continue;
+      left_pos_list[output_idx] = left_pos_list[match_idx];
+      right_pos_list[output_idx] = right_pos_list[match_idx];
+      ++output_idx;
+    }
+    left_pos_list.resize(output_idx);
+    right_pos_list.resize(output_idx);
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const std::optional<size_t>& radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
-      _radix_bits(radix_bits) {
+                   const std::optional<size_t>& radix_bits, const std::vector<ColumnIDPair>& secondary_column_ids)
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition,
+                           std::make_unique<JoinHash::PerformanceData>()),
+      _radix_bits(radix_bits),
+      _secondary_column_ids(secondary_column_ids) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
+  Assert(secondary_column_ids.empty() || mode == JoinMode::Inner,
+         "JoinHash only supports inner joins on multiple column pairs");
 }
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
+const std::vector<ColumnIDPair>& JoinHash::secondary_column_ids() const { return _secondary_column_ids; }
+
+const std::string JoinHash::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  auto join_description = AbstractJoinOperator::description(description_mode);
+  for (const auto& [left_column_id, right_column_id] : _secondary_column_ids) {
+    auto column_name_left = std::string("Column #") + std::to_string(left_column_id);
+    auto column_name_right = std::string("Column #") + std::to_string(right_column_id);
+    if (input_table_left()) column_name_left = input_table_left()->column_name(left_column_id);
+    if (input_table_right()) column_name_right = input_table_right()->column_name(right_column_id);
+    join_description += separator + ("AND " + column_name_left + " = " + column_name_right);
+  }
+
+  if (_partition_wise_partition_count) {
+    return join_description + separator + "Partition-wise (" + std::to_string(*_partition_wise_partition_count) +
+           " partitions)";
+  }
+  if (!_radix_bits_per_pass) return join_description;
+
+  std::stringstream stream;
+  stream << join_description << separator << "Radix bits: "
+         << std::accumulate(_radix_bits_per_pass->begin(), _radix_bits_per_pass->end(), size_t{0});
+  stream << " (passes: ";
+  if (_radix_bits_per_pass->empty()) stream << "none";
+  for (auto pass = size_t{0}; pass < _radix_bits_per_pass->size(); ++pass) {
+    stream << (pass > 0 ? ", " : "") << (*_radix_bits_per_pass)[pass];
+  }
+  stream << ")";
+  if (_spilled_batch_count && *_spilled_batch_count > 1) {
+    stream << separator << "Spilled (" << *_spilled_batch_count << " batches)";
+  }
+  return stream.str();
+}
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                    _radix_bits, _secondary_column_ids);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 std::shared_ptr<const Table> JoinHash::_on_execute() {
+  if (const auto partition_wise_output = _try_execute_partition_wise()) return partition_wise_output;
+
   std::shared_ptr<const AbstractOperator> build_operator;
   std::shared_ptr<const AbstractOperator> probe_operator;
   ColumnID build_column_id;
@@ -75,20 +342,120 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
+  auto build_data_type = build_input->column_data_type(build_column_id);
+  auto probe_data_type = probe_input->column_data_type(probe_column_id);
+
+  auto adjusted_secondary_column_ids = std::vector<ColumnIDPair>{};
+  for (const auto& [left_column_id, right_column_id] : _secondary_column_ids) {
+    adjusted_secondary_column_ids.emplace_back(inputs_swapped ? ColumnIDPair{right_column_id, left_column_id}
+                                                              : ColumnIDPair{left_column_id, right_column_id});
+  }
+
+  // The hash tables of joins on multiple column pairs hold the Long hashes of the composite keys
+  if (!adjusted_secondary_column_ids.empty()) {
+    Assert(build_data_type == probe_data_type, "JoinHash on multiple column pairs needs the same data types in each");
+    for (const auto& [build_secondary_column_id, probe_secondary_column_id] : adjusted_secondary_column_ids) {
+      Assert(build_input->column_data_type(build_secondary_column_id) ==
+                 probe_input->column_data_type(probe_secondary_column_id),
+             "JoinHash on multiple column pairs needs the same data types in each");
+    }
+    build_data_type = DataType::Long;
+    probe_data_type = DataType::Long;
+  }
+
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
-      build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), *this,
-      build_operator, probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
+      build_data_type, probe_data_type, *this, build_operator, probe_operator, _mode, adjusted_column_ids,
+      _predicate_condition, inputs_swapped, adjusted_secondary_column_ids, _radix_bits);
   return _impl->_on_execute();
 }
 
+std::shared_ptr<const Table> JoinHash::_try_execute_partition_wise() {
+  const auto left_input = input_table_left();
+  const auto right_input = input_table_right();
+
+  const auto left_partitioning = input_partitioning(*left_input, _column_ids.first);
+  if (!left_partitioning) return nullptr;
+  const auto right_partitioning = input_partitioning(*right_input, _column_ids.second);
+  if (!right_partitioning || !left_partitioning->partition_schema->is_compatible_with(
+                                 *right_partitioning->partition_schema)) {
+    return nullptr;
+  }
+
+  const auto partition_count = left_partitioning->partition_schema->partition_count();
+  if (partition_count < 2) return nullptr;
+
+  // Equal values are in the same partition on both sides, so rows only match rows of the same partition
+  auto left_chunk_ids_by_partition = std::vector<std::vector<ChunkID>>(partition_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < left_input->chunk_count(); ++chunk_id) {
+    const auto partition_id = left_partitioning->chunk_partition_ids[chunk_id];
+    if (partition_id) left_chunk_ids_by_partition[*partition_id].emplace_back(chunk_id);
+  }
+  auto right_chunk_ids_by_partition = std::vector<std::vector<ChunkID>>(partition_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < right_input->chunk_count(); ++chunk_id) {
+    const auto partition_id = right_partitioning->chunk_partition_ids[chunk_id];
+    if (partition_id) right_chunk_ids_by_partition[*partition_id].emplace_back(chunk_id);
+  }
+
+  const auto output = _initialize_output_table();
+  for (auto partition_id = PartitionID{0}; partition_id < partition_count; ++partition_id) {
+    const auto& left_chunk_ids = left_chunk_ids_by_partition[partition_id];
+    const auto& right_chunk_ids = right_chunk_ids_by_partition[partition_id];
+    if (left_chunk_ids.empty() && right_chunk_ids.empty()) continue;
+    if ((left_chunk_ids.empty() || right_chunk_ids.empty()) && (_mode == JoinMode::Inner || _mode == JoinMode::Semi)) {
+      continue;
+    }
+
+    // Each join is parallelized by itself, and its hash tables are smaller than those of the whole inputs
+    const auto left_partition = std::make_shared<TableWrapper>(partition_input(left_input, left_chunk_ids));
+    const auto right_partition = std::make_shared<TableWrapper>(partition_input(right_input, right_chunk_ids));
+    left_partition->execute();
+    right_partition->execute();
+
+    const auto partition_join = std::make_shared<JoinHash>(left_partition, right_partition, _mode, _column_ids,
+                                                           _predicate_condition, _radix_bits, _secondary_column_ids);
+    partition_join->execute();
+
+    // The joins of the partitions are executed one after another, so the walltimes of their steps add up
+    auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+    const auto& partition_performance_data = static_cast<const PerformanceData&>(partition_join->performance_data());
+    performance_data.materialization += partition_performance_data.materialization;
+    performance_data.radix_partitioning += partition_performance_data.radix_partitioning;
+    performance_data.build += partition_performance_data.build;
+    performance_data.probe += partition_performance_data.probe;
+    performance_data.output_writing += partition_performance_data.output_writing;
+    performance_data.probe_chunks_pruned += partition_performance_data.probe_chunks_pruned;
+
+    const auto partition_output = partition_join->get_output();
+    for (auto chunk_id = ChunkID{0}; chunk_id < partition_output->chunk_count(); ++chunk_id) {
+      output->append_chunk(partition_output->get_chunk(chunk_id)->segments());
+    }
+  }
+
+  _partition_wise_partition_count = partition_count;
+  return output;
+}
+
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
+std::vector<std::pair<std::string, std::chrono::nanoseconds>> JoinHash::PerformanceData::step_walltimes() const {
+  return {{"materialization", materialization},
+          {"radix_partitioning", radix_partitioning},
+          {"build", build},
+          {"probe", probe},
+          {"output_writing", output_writing}};
+}
+
+std::vector<std::pair<std::string, size_t>> JoinHash::PerformanceData::counts() const {
+  return {{"probe_chunks_pruned", probe_chunks_pruned}};
+}
+
 template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
-  JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const AbstractOperator>& left,
+  JoinHashImpl(JoinHash& join_hash, const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
+               const std::vector<ColumnIDPair>& secondary_column_ids,
                const std::optional<size_t>& radix_bits = std::nullopt)
       : _join_hash(join_hash),
         _left(left),
@@ -96,25 +463,54 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
-        _inputs_swapped(inputs_swapped) {
+        _inputs_swapped(inputs_swapped),
+        _secondary_column_ids(secondary_column_ids) {
     if (radix_bits.has_value()) {
       _radix_bits = radix_bits.value();
     } else {
       _radix_bits = _calculate_radix_bits();
     }
+
+    // If the partitions and their hash tables exceed the memory budget, they are processed in batches, for which there
+    // need to be enough partitions. A batch should take at most half of the budget. As the partitions are rarely filled
+    // evenly, there are twice as many as that would require.
+    const auto memory_budget = _join_hash.query_memory_budget();
+    const auto estimated_size = _estimate_memory_usage();
+    if (memory_budget > 0 && estimated_size > memory_budget) {
+      _spill_batch_size = std::max(memory_budget / 2, size_t{1});
+      if (!radix_bits) {
+        // More partitions than build rows would only be empty
+        const auto max_partition_count = std::max(static_cast<double>(_left->get_output()->row_count()), 1.0);
+        const auto min_partition_count = std::clamp(2.0 * estimated_size / static_cast<double>(*_spill_batch_size),
+                                                    1.0, max_partition_count);
+        _radix_bits = std::max(_radix_bits, static_cast<size_t>(std::ceil(std::log2(min_partition_count))));
+      }
+      if (_radix_bits == 0) _spill_batch_size.reset();
+    }
+
+    _radix_bits_per_pass = _split_radix_bits_into_passes();
+    _join_hash._radix_bits_per_pass = _radix_bits_per_pass;
   }
 
  protected:
-  const JoinHash& _join_hash;
+  JoinHash& _join_hash;
   const std::shared_ptr<const AbstractOperator> _left, _right;
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
   const bool _inputs_swapped;
+  const std::vector<ColumnIDPair> _secondary_column_ids;
 
   std::shared_ptr<Table> _output_table;
 
   size_t _radix_bits;
+  std::vector<size_t> _radix_bits_per_pass;
+
+  // The estimated size of the partitions of a batch if the join exceeds its memory budget, see _probe_in_batches()
+  std::optional<size_t> _spill_batch_size;
+
+  // The Bloom filter serializes building and probing, which only pays off if it can drop many probe values
+  static constexpr auto BLOOM_FILTER_MIN_PROBE_FACTOR = size_t{4};
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
@@ -122,15 +518,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   size_t _calculate_radix_bits() const {
     /*
       Setting number of bits for radix clustering:
-      The number of bits is used to create probe partitions with a size that can
-      be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
+      The number of bits is used to create partitions whose hash tables can be expected to fit into the L2 cache, the
+      size of which is detected by the Topology.
       We estimate the size the following way:
-        - we assume each key appears once (that is an overestimation space-wise, but we
-        aim rather for a hash map that is slightly smaller than L2 than slightly larger)
-        - each entry in the hash map is a data structure holding the actual value
-        and the RowID
+        - each distinct value of the build relation has one entry in the hash map, which holds the value and a RowID.
+        Values with more than one row keep their RowIDs in an overflow list instead (see HashTable).
+        - the distinct count is taken from the statistics of the build column. Without statistics, we assume each key
+        appears once (that is an overestimation space-wise, but we aim rather for a hash map that is slightly smaller
+        than L2 than slightly larger)
     */
     const auto build_relation_size = _left->get_output()->row_count();
     const auto probe_relation_size = _right->get_output()->row_count();
@@ -146,24 +541,180 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    const auto l2_cache_size = static_cast<double>(Topology::get().l2_cache_size());  // bytes
+    const auto complete_hash_map_size = _estimate_hash_map_size();
 
-    // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
-    // that each value maps to a PosList with a single RowID. For the used small_vector's, we assume a
-    // size of 2*RowID per PosList. For sizing, see comments:
+    const auto adaption_factor = 2.0;  // don't occupy the whole L2 cache
+    const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+
+    return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+  }
+
+  double _estimate_hash_map_size() const {
+    const auto build_relation_size = _left->get_output()->row_count();
+    const auto distinct_count = _estimate_build_distinct_count();
+
+    // For sizing of the hash map, see comments:
     // https://probablydance.com/2018/05/28/a-new-fast-hash-table-in-response-to-googles-new-fast-hash-table/
-    const auto complete_hash_map_size =
-        // number of items in map
-        (build_relation_size *
-         // key + value (and one byte overhead, see link above)
-         (sizeof(LeftType) + 2 * sizeof(RowID) + 1))
+    return
+        // key + RowID (and one byte overhead, see link above) per distinct value
+        (distinct_count * (sizeof(HashedType) + sizeof(RowID) + 1) +
+         // RowIDs in the overflow lists of duplicate values, which at most hold two rows per duplicate
+         (build_relation_size - distinct_count) * 2 * sizeof(RowID))
         // fill factor
         / 0.8;
+  }
 
-    const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+  // The materialized inputs plus the hash tables
+  size_t _estimate_memory_usage() const {
+    return static_cast<size_t>(_estimate_hash_map_size()) +
+           _left->get_output()->row_count() * sizeof(PartitionedElement<LeftType>) +
+           _right->get_output()->row_count() * sizeof(PartitionedElement<RightType>);
+  }
 
-    return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+  // Estimates the number of distinct values in the build column from the statistics of the stored table that it
+  // belongs to (directly or through ReferenceSegments). Without statistics, all values are assumed to be distinct.
+  size_t _estimate_build_distinct_count() const {
+    const auto build_table = _left->get_output();
+    const auto build_relation_size = build_table->row_count();
+
+    auto statistics_table = build_table;
+    auto statistics_column_id = _column_ids.first;
+    if (build_table->type() == TableType::References) {
+      if (build_table->chunk_count() == 0) return build_relation_size;
+
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+          build_table->get_chunk(ChunkID{0})->get_segment(statistics_column_id));
+      if (!reference_segment) return build_relation_size;
+
+      statistics_table = reference_segment->referenced_table();
+      statistics_column_id = reference_segment->referenced_column_id();
+    }
+
+    const auto table_statistics = statistics_table->table_statistics();
+    if (!table_statistics) return build_relation_size;
+
+    // The statistics might be outdated or describe more rows than the build relation holds
+    const auto distinct_count = table_statistics->column_statistics().at(statistics_column_id)->distinct_count();
+    if (distinct_count <= 0.0f) return build_relation_size;
+    return std::min(build_relation_size, static_cast<size_t>(std::ceil(distinct_count)));
+  }
+
+  // A partitioning pass writes to 2^radix_bits partitions at once. As long as one cache line per partition fits into
+  // half of the L1 data cache, these writes stay cache-resident and a single pass is used. Otherwise, the radix bits
+  // are spread evenly over multiple passes.
+  std::vector<size_t> _split_radix_bits_into_passes() const {
+    if (_radix_bits == 0) return {};
+
+    constexpr auto cache_line_size = size_t{64};
+    const auto cache_lines = Topology::get().l1_data_cache_size() / cache_line_size / 2;
+    const auto max_radix_bits_per_pass =
+        std::max(size_t{1}, static_cast<size_t>(std::floor(std::log2(std::max(size_t{2}, cache_lines)))));
+
+    const auto pass_count = (_radix_bits + max_radix_bits_per_pass - 1) / max_radix_bits_per_pass;
+    auto radix_bits_per_pass = std::vector<size_t>(pass_count, _radix_bits / pass_count);
+    for (auto pass = size_t{0}; pass < _radix_bits % pass_count; ++pass) {
+      ++radix_bits_per_pass[pass];
+    }
+    return radix_bits_per_pass;
+  }
+
+  // Radix partitions a materialized input in the passes given by _radix_bits_per_pass. The first pass uses the
+  // histograms that have been created during materialization.
+  template <typename T, bool consider_null_values>
+  RadixContainer<T> _partition(const RadixContainer<T>& materialized, const std::vector<size_t>& chunk_offsets,
+                               std::vector<std::vector<size_t>>& histograms) const {
+    auto radix_container = partition_radix_parallel<T, HashedType, consider_null_values>(
+        materialized, chunk_offsets, histograms, _radix_bits_per_pass.front());
+
+    auto previous_radix_bits = _radix_bits_per_pass.front();
+    for (auto pass = size_t{1}; pass < _radix_bits_per_pass.size(); ++pass) {
+      radix_container = partition_radix_refine<T, HashedType, consider_null_values>(
+          radix_container, previous_radix_bits, _radix_bits_per_pass[pass]);
+      previous_radix_bits += _radix_bits_per_pass[pass];
+    }
+    return radix_container;
+  }
+
+  void _probe(const RadixContainer<RightType>& radix_right,
+              const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
+              std::vector<PosList>& left_pos_lists, std::vector<PosList>& right_pos_lists) const {
+    if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
+      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+    } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+      probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+    } else {
+      probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+    }
+  }
+
+  /**
+   * If the partitions and their hash tables exceed the memory budget, they are joined in batches of consecutive
+   * partitions, in the style of a hybrid hash join: The first batch stays in memory, the others are written to
+   * TempFiles (see spill_partitions()). Then, the full radix containers are released, and one batch after another is
+   * read back, hashed, and probed. Thus, only the hash tables of a single batch exist at a time.
+   *
+   * The hash tables and their overflow lists use the default resource here, as the QueryMemoryResource would keep the
+   * memory of all batches until the query is done.
+   */
+  void _probe_in_batches(RadixContainer<LeftType>& radix_left, RadixContainer<RightType>& radix_right,
+                         std::vector<PosList>& left_pos_lists, std::vector<PosList>& right_pos_lists) {
+    const auto partition_count = radix_right.partition_offsets.size();
+    const auto hash_table_entry_size = (sizeof(HashedType) + sizeof(RowID) + 1) / 0.8;
+
+    // Each batch holds consecutive partitions whose estimated size fits into the batch size, but at least one
+    auto batch_ends = std::vector<size_t>{};
+    auto batch_size = 0.0;
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      const auto [left_begin, left_end] = partition_element_range(radix_left, partition_id, partition_id + 1);
+      const auto [right_begin, right_end] = partition_element_range(radix_right, partition_id, partition_id + 1);
+      const auto partition_size =
+          static_cast<double>(left_end - left_begin) * (sizeof(PartitionedElement<LeftType>) + hash_table_entry_size) +
+          static_cast<double>(right_end - right_begin) * sizeof(PartitionedElement<RightType>);
+
+      if (partition_id > 0 && batch_size + partition_size > static_cast<double>(*_spill_batch_size)) {
+        batch_ends.emplace_back(partition_id);
+        batch_size = 0.0;
+      }
+      batch_size += partition_size;
+    }
+    batch_ends.emplace_back(partition_count);
+
+    auto spilled_left = std::vector<SpilledPartitions>{};
+    auto spilled_right = std::vector<SpilledPartitions>{};
+    for (auto batch_id = size_t{1}; batch_id < batch_ends.size(); ++batch_id) {
+      spilled_left.emplace_back(spill_partitions(radix_left, batch_ends[batch_id - 1], batch_ends[batch_id]));
+      spilled_right.emplace_back(spill_partitions(radix_right, batch_ends[batch_id - 1], batch_ends[batch_id]));
+    }
+
+    auto batch_left = slice_partitions(radix_left, 0, batch_ends.front());
+    auto batch_right = slice_partitions(radix_right, 0, batch_ends.front());
+    radix_left = {};
+    radix_right = {};
+
+    for (auto batch_id = size_t{0}; batch_id < batch_ends.size(); ++batch_id) {
+      if (batch_id > 0) {
+        batch_left = read_spilled_partitions<LeftType>(spilled_left[batch_id - 1]);
+        batch_right = read_spilled_partitions<RightType>(spilled_right[batch_id - 1]);
+        spilled_left[batch_id - 1] = {};
+        spilled_right[batch_id - 1] = {};
+      }
+
+      const auto hashtables = build<LeftType, HashedType>(batch_left);
+
+      const auto batch_begin = batch_id == 0 ? size_t{0} : batch_ends[batch_id - 1];
+      const auto batch_partition_count = batch_ends[batch_id] - batch_begin;
+      auto batch_left_pos_lists = std::vector<PosList>(batch_partition_count);
+      auto batch_right_pos_lists = std::vector<PosList>(batch_partition_count);
+      _probe(batch_right, hashtables, batch_left_pos_lists, batch_right_pos_lists);
+
+      for (auto partition_idx = size_t{0}; partition_idx < batch_partition_count; ++partition_idx) {
+        left_pos_lists[batch_begin + partition_idx] = std::move(batch_left_pos_lists[partition_idx]);
+        right_pos_lists[batch_begin + partition_idx] = std::move(batch_right_pos_lists[partition_idx]);
+      }
+    }
+
+    _join_hash._spilled_batch_count = batch_ends.size();
   }
 
   std::shared_ptr<const Table> _on_execute() override {
@@ -172,6 +723,33 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     _output_table = _join_hash._initialize_output_table();
 
+    // Joins on multiple column pairs are executed on the hashes of their composite keys. The tables holding them have
+    // the same chunks as the inputs, so that the matches reference the rows of the inputs just the same.
+    auto left_key_table = left_in_table;
+    auto left_key_column_id = _column_ids.first;
+    auto right_key_table = right_in_table;
+    auto right_key_column_id = _column_ids.second;
+    auto key_column_ids = std::vector<ColumnIDPair>{};
+    auto composite_key_materialization = std::chrono::nanoseconds{0};
+    if (!_secondary_column_ids.empty()) {
+      auto timer = Timer{};
+      key_column_ids.emplace_back(_column_ids);
+      key_column_ids.insert(key_column_ids.end(), _secondary_column_ids.begin(), _secondary_column_ids.end());
+
+      auto left_key_column_ids = std::vector<ColumnID>{};
+      auto right_key_column_ids = std::vector<ColumnID>{};
+      for (const auto& [left_column_id, right_column_id] : key_column_ids) {
+        left_key_column_ids.emplace_back(left_column_id);
+        right_key_column_ids.emplace_back(right_column_id);
+      }
+
+      left_key_table = composite_key_table(left_in_table, left_key_column_ids);
+      left_key_column_id = ColumnID{0};
+      right_key_table = composite_key_table(right_in_table, right_key_column_ids);
+      right_key_column_id = ColumnID{0};
+      composite_key_materialization = timer.lap();
+    }
+
     /*
      * This flag is used in the materialization and probing phases.
      * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
@@ -184,8 +762,6 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
     const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
 
-    Timer performance_timer;
-
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
     std::vector<std::vector<size_t>> histograms_left;
@@ -211,153 +787,255 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //
     //           Relation Left                       Relation Right
     //                 |                                    |
-    //        materialize_input()                  materialize_input()
+    //        materialize_input()                ( materialize_input() )
     //                 |                                    |
     //  ( partition_radix_parallel() )       ( partition_radix_parallel() )
     //                 |                                    |
-    //               build()                                |
+    //               build() - - - ( Bloom filter ) - - - > |
     //                   \_                               _/
     //                     \_                           _/
     //                       \_                       _/
     //                         \_                   _/
     //                           \                 /
     //                          Probing (actual Join)
+    //
+    // For inner and semi joins with a probe relation that is much larger than the build relation, the build path
+    // additionally creates a Bloom filter. The right path then waits for it and drops the values that cannot have a
+    // match during materialization, so that they do not need to be partitioned and probed. Before that, the chunks of
+    // the right relation whose statistics rule out all values of the left relation are pruned (see
+    // prune_probe_chunks()), so that they are not even materialized.
+    //
+    // Without radix bits, the single hash table is expected to fit into the cache. The right relation is then neither
+    // materialized nor partitioned, but its chunks are probed directly, writing the output chunk by chunk (see
+    // probe_streaming()). This avoids a full copy of (potentially large) probe relations.
+
+    const auto partition_right = _radix_bits > 0;
 
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
+    // When spilling, the hash tables are built batch by batch after the probe relation has been partitioned
+    const auto use_bloom_filter =
+        partition_right && !_spill_batch_size && (_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+        right_in_table->row_count() >= BLOOM_FILTER_MIN_PROBE_FACTOR * left_in_table->row_count();
+    auto bloom_filter = std::shared_ptr<BloomFilter>{};
+    if (use_bloom_filter) bloom_filter = std::make_shared<BloomFilter>(_estimate_build_distinct_count());
+
+    // The right relation can only be pruned once the left one is materialized, i.e., if it waits for the left one
+    // anyway. Values of other types would have to be cast to check them against the statistics.
+    const auto prune_right = (use_bloom_filter || !partition_right) &&
+                             (_mode == JoinMode::Inner || _mode == JoinMode::Semi) && key_column_ids.empty() &&
+                             std::is_same_v<LeftType, RightType>;
+    auto pruned_right_chunks = std::vector<bool>{};
+
+    // The histograms of the materialization phase are used by the first radix partitioning pass
+    const auto first_pass_radix_bits = _radix_bits > 0 ? _radix_bits_per_pass.front() : size_t{0};
+
+    auto& performance_data = static_cast<PerformanceData&>(*_join_hash._performance_data);
+    auto left_materialization = std::chrono::nanoseconds{0};
+    auto left_radix_partitioning = std::chrono::nanoseconds{0};
+    auto right_materialization = std::chrono::nanoseconds{0};
+    auto right_radix_partitioning = std::chrono::nanoseconds{0};
+
     // Pre-Probing path of left relation
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto timer = Timer{};
+
       // materialize left table (NULLs are always discarded for the build side)
-      materialized_left = materialize_input<LeftType, HashedType, false>(left_in_table, _column_ids.first,
-                                                                         histograms_left, _radix_bits);
+      materialized_left = materialize_input<LeftType, HashedType, false>(left_key_table, left_key_column_id,
+                                                                         histograms_left, first_pass_radix_bits);
+      if (prune_right) pruned_right_chunks = prune_probe_chunks(materialized_left, *right_in_table, _column_ids.second);
+      left_materialization = timer.lap();
 
       if (_radix_bits > 0) {
         // radix partition the left table
-        radix_left = partition_radix_parallel<LeftType, HashedType, false>(materialized_left, left_chunk_offsets,
-                                                                           histograms_left, _radix_bits);
+        radix_left = _partition<LeftType, false>(materialized_left, left_chunk_offsets, histograms_left);
+        if (_spill_batch_size) materialized_left = {};
       } else {
         // short cut: skip radix partitioning and use materialized data directly
         radix_left = std::move(materialized_left);
       }
+      left_radix_partitioning = timer.lap();
 
       // build hash tables
-      hashtables = build<LeftType, HashedType>(radix_left);
+      if (!_spill_batch_size) {
+        hashtables = build<LeftType, HashedType>(radix_left, bloom_filter, _join_hash.query_memory_resource());
+        performance_data.build = timer.lap();
+      }
     }));
     jobs.back()->schedule();
 
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
-      // Materialize right table. The third template parameter signals if the relation on the right (probe
-      // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
-      if (keep_nulls) {
-        materialized_right = materialize_input<RightType, HashedType, true>(right_in_table, _column_ids.second,
-                                                                            histograms_right, _radix_bits);
-      } else {
-        materialized_right = materialize_input<RightType, HashedType, false>(right_in_table, _column_ids.second,
-                                                                             histograms_right, _radix_bits);
-      }
+    if (use_bloom_filter) {
+      CurrentScheduler::wait_for_tasks(jobs);
+      jobs.clear();
+    }
+
+    if (partition_right) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        auto timer = Timer{};
+
+        // Materialize right table. The third template parameter signals if the relation on the right (probe
+        // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
+        if (keep_nulls) {
+          materialized_right = materialize_input<RightType, HashedType, true>(right_key_table, right_key_column_id,
+                                                                              histograms_right, first_pass_radix_bits);
+        } else {
+          materialized_right = materialize_input<RightType, HashedType, false>(
+              right_key_table, right_key_column_id, histograms_right, first_pass_radix_bits, bloom_filter,
+              pruned_right_chunks);
+        }
+        right_materialization = timer.lap();
 
-      if (_radix_bits > 0) {
         // radix partition the right table. 'keep_nulls' makes sure that the
         // relation on the right keeps NULL values when executing an OUTER join.
         if (keep_nulls) {
-          radix_right = partition_radix_parallel<RightType, HashedType, true>(materialized_right, right_chunk_offsets,
-                                                                              histograms_right, _radix_bits);
+          radix_right = _partition<RightType, true>(materialized_right, right_chunk_offsets, histograms_right);
         } else {
-          radix_right = partition_radix_parallel<RightType, HashedType, false>(materialized_right, right_chunk_offsets,
-                                                                               histograms_right, _radix_bits);
+          radix_right = _partition<RightType, false>(materialized_right, right_chunk_offsets, histograms_right);
         }
-      } else {
-        // short cut: skip radix partitioning and use materialized data directly
-        radix_right = std::move(materialized_right);
-      }
-    }));
-    jobs.back()->schedule();
+        if (_spill_batch_size) materialized_right = {};
+        right_radix_partitioning = timer.lap();
+      }));
+      jobs.back()->schedule();
+    }
 
     CurrentScheduler::wait_for_tasks(jobs);
 
+    // With a Bloom filter, the right relation is only materialized once the left one is done
+    if (use_bloom_filter) {
+      performance_data.materialization = composite_key_materialization + left_materialization + right_materialization;
+      performance_data.radix_partitioning = left_radix_partitioning + right_radix_partitioning;
+    } else {
+      performance_data.materialization =
+          composite_key_materialization + std::max(left_materialization, right_materialization);
+      performance_data.radix_partitioning = std::max(left_radix_partitioning, right_radix_partitioning);
+    }
+    performance_data.probe_chunks_pruned = std::count(pruned_right_chunks.begin(), pruned_right_chunks.end(), true);
+
+    // When spilling, the probe step includes building the hash tables of the batches
+    auto timer = Timer{};
+
     // Probe phase
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
-    const size_t partition_count = radix_right.partition_offsets.size();
-    left_pos_lists.resize(partition_count);
-    right_pos_lists.resize(partition_count);
-    for (size_t i = 0; i < partition_count; i++) {
-      // simple heuristic: half of the rows of the right relation will match
-      const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
-
-      left_pos_lists[i].reserve(result_rows_per_partition);
-      right_pos_lists[i].reserve(result_rows_per_partition);
-    }
-    /*
-    NUMA notes:
-    The workers for each radix partition P should be scheduled on the same node as the input data:
-    leftP, rightP and hashtableP.
-    */
-    if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+
+    if (!partition_right) {
+      // One hash table for the entire left relation, unless it holds no values
+      const auto& hashtable = hashtables.front();
+
+      left_pos_lists.resize(right_in_table->chunk_count());
+      right_pos_lists.resize(right_in_table->chunk_count());
+
+      if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
+        probe_streaming_semi_anti<RightType, HashedType>(right_key_table, right_key_column_id, hashtable,
+                                                         right_pos_lists, _mode, pruned_right_chunks);
+      } else if (keep_nulls) {
+        probe_streaming<RightType, HashedType, true>(right_key_table, right_key_column_id, hashtable, left_pos_lists,
+                                                     right_pos_lists, _mode);
+      } else {
+        probe_streaming<RightType, HashedType, false>(right_key_table, right_key_column_id, hashtable, left_pos_lists,
+                                                      right_pos_lists, _mode, pruned_right_chunks);
+      }
     } else {
-      if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
-        probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+      const size_t partition_count = radix_right.partition_offsets.size();
+      left_pos_lists.resize(partition_count);
+      right_pos_lists.resize(partition_count);
+      for (size_t i = 0; i < partition_count; i++) {
+        // simple heuristic: half of the rows of the right relation will match
+        const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
+
+        left_pos_lists[i].reserve(result_rows_per_partition);
+        right_pos_lists[i].reserve(result_rows_per_partition);
+      }
+      /*
+      NUMA notes:
+      The workers for each radix partition P should be scheduled on the same node as the input data:
+      leftP, rightP and hashtableP.
+      */
+      if (_spill_batch_size) {
+        _probe_in_batches(radix_left, radix_right, left_pos_lists, right_pos_lists);
       } else {
-        probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+        _probe(radix_right, hashtables, left_pos_lists, right_pos_lists);
       }
+
+      // Now, the matches are grouped by partitions. Align them to the chunks of the right relation, like the
+      // output of the streaming probe is.
+      align_pos_lists_to_chunks(left_pos_lists, right_pos_lists, _mode != JoinMode::Semi && _mode != JoinMode::Anti,
+                                right_in_table->chunk_count());
+      left_pos_lists.resize(right_pos_lists.size());
     }
 
+    if (!key_column_ids.empty()) {
+      remove_composite_key_collisions(*left_in_table, *right_in_table, key_column_ids, left_pos_lists, right_pos_lists);
+    }
+    performance_data.probe = timer.lap();
+
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
 
     /**
-     * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
-     *  quite a lot Partitions (>500 seen), input Chunks (>500 seen), and columns (>50 seen), this speeds up
-     *  write_output_chunks a lot.
+     * The matches are aligned to the chunks of the right relation, so that each output chunk holds the matches of one
+     * chunk of the right relation. For the right relation, write_output_segments_aligned() thus only needs the pos
+     * lists of that chunk and shares them between columns like TableScan does. Its output pos lists are guaranteed to
+     * reference a single chunk, which enables the single-chunk fast paths of, e.g., split_pos_list_by_chunk_id.
+     *
+     * The matches of the left relation reference arbitrary chunks. For them, a cache avoids redundant reference
+     * materialization for Reference input tables. As there might be quite a lot input Chunks (>500 seen) and
+     * columns (>50 seen), this speeds up write_output_chunks a lot.
      *
-     * They do two things:
+     * It does two things:
      *      - Make it possible to re-use output pos lists if two segments in the input table have exactly the same
      *          PosLists Chunk by Chunk
-     *      - Avoid creating the std::vector<const PosList*> for each Partition over and over again.
+     *      - Avoid creating the std::vector<const PosList*> for each output chunk over and over again.
      *
-     * They hold one entry per column in the table, not per BaseSegment in a single chunk
+     * It holds one entry per column in the table, not per BaseSegment in a single chunk
      */
     PosListsBySegment left_pos_lists_by_segment;
-    PosListsBySegment right_pos_lists_by_segment;
 
     // left_pos_lists_by_segment will only be needed if left is a reference table and being output
     if (left_in_table->type() == TableType::References && !only_output_right_input) {
       left_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
     }
 
-    // right_pos_lists_by_segment will only be needed if right is a reference table
-    if (right_in_table->type() == TableType::References) {
-      right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
-    }
+    // The output chunks are written in parallel, each into the chunk slot of its right input chunk
+    _output_table->create_chunk_slots(right_pos_lists.size());
 
-    for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
-      // moving the values into a shared pos list saves us some work in write_output_segments. We know that
-      // left_pos_lists and right_pos_lists will not be used again.
-      auto left = std::make_shared<PosList>(std::move(left_pos_lists[partition_id]));
-      auto right = std::make_shared<PosList>(std::move(right_pos_lists[partition_id]));
+    auto output_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    output_jobs.reserve(right_pos_lists.size());
 
-      if (left->empty() && right->empty()) {
+    for (ChunkID chunk_id{0}; chunk_id < right_pos_lists.size(); ++chunk_id) {
+      if (left_pos_lists[chunk_id].empty() && right_pos_lists[chunk_id].empty()) {
         continue;
       }
 
-      Segments output_segments;
+      output_jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        // moving the values into a shared pos list saves us some work in write_output_segments. We know that
+        // left_pos_lists and right_pos_lists will not be used again.
+        auto left = std::make_shared<PosList>(std::move(left_pos_lists[chunk_id]));
+        auto right = std::make_shared<PosList>(std::move(right_pos_lists[chunk_id]));
+
+        Segments output_segments;
 
-      // we need to swap back the inputs, so that the order of the output columns is not harmed
-      if (_inputs_swapped) {
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+        // we need to swap back the inputs, so that the order of the output columns is not harmed
+        if (_inputs_swapped) {
+          write_output_segments_aligned(output_segments, right_in_table, chunk_id, right);
 
-        // Semi/Anti joins are always swapped but do not need the outer relation
-        if (!only_output_right_input) {
+          // Semi/Anti joins are always swapped but do not need the outer relation
+          if (!only_output_right_input) {
+            write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
+          }
+        } else {
           write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
+          write_output_segments_aligned(output_segments, right_in_table, chunk_id, right);
         }
-      } else {
-        write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
-      }
 
-      _output_table->append_chunk(output_segments);
+        _output_table->set_chunk_slot(chunk_id, output_segments);
+      }));
+      output_jobs.back()->schedule();
     }
 
+    CurrentScheduler::wait_for_tasks(output_jobs);
+    _output_table->append_chunk_slots();
+    performance_data.output_writing = timer.lap();
+
     return _output_table;
   }
 };
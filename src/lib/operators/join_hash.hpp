@@ -1,5 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "abstract_join_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -14,15 +20,57 @@ namespace opossum {
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
  *
+ * Unless radix_bits is given, the number of radix bits is chosen so that the hash table of each partition fits into the
+ * L2 cache (see Topology::l2_cache_size()). The fan-out of a single partitioning pass is limited by the L1 data cache, so
+ * that larger numbers of radix bits are split into multiple passes. Both are shown in the description once the operator
+ * has been executed.
+ *
+ * If the radix partitions and their hash tables are expected to exceed the memory budget of the query (see
+ * AbstractOperator::query_memory_budget()), the partitions are joined in batches that fit into half of it. All batches
+ * but the first are written to temporary files (see TempFileManager) in the meantime.
+ *
+ * If both inputs are partitioned alike by their join columns (see PartitionSchema), e.g., because they are scans of
+ * tables that are hash partitioned by their join keys, they are joined partition by partition instead.
+ *
+ * For inner and semi joins, the chunks of the probe input whose statistics (see ChunkStatistics) show that they hold
+ * none of the values of the build input are skipped, if the probe input is much larger or not partitioned at all. For
+ * chunks of reference tables, the statistics of the chunk that they reference are used. E.g., star joins with a
+ * filtered dimension table skip the chunks of the fact table that hold other keys only.
+ *
+ * The walltimes of the steps of the join are recorded in its PerformanceData. The build and the probe input are
+ * materialized and partitioned concurrently, so these steps take as long as the slower of the two inputs.
+ *
+ * Joins on multiple columns take the further column pairs as @param secondary_column_ids, which are compared for
+ * equality as well. Instead of the values of the join columns, the hash tables then hold a hash of the values of all
+ * key columns of a row (see composite_key_table()), so that only rows that match on all of them are found by the probe.
+ * Matches whose keys merely share the hash are removed afterwards. This is only supported for inner joins.
+ *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Radix-Partitioned-and-Hash-Based-Join
  */
 class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const std::optional<size_t>& radix_bits = std::nullopt);
+           const std::optional<size_t>& radix_bits = std::nullopt,
+           const std::vector<ColumnIDPair>& secondary_column_ids = {});
 
   const std::string name() const override;
+  const std::vector<ColumnIDPair>& secondary_column_ids() const;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  struct PerformanceData : public OperatorPerformanceData {
+    std::chrono::nanoseconds materialization{0};
+    std::chrono::nanoseconds radix_partitioning{0};
+    std::chrono::nanoseconds build{0};
+    std::chrono::nanoseconds probe{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    // The chunks of the probe input that were skipped, see above
+    size_t probe_chunks_pruned{0};
+
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> step_walltimes() const override;
+    std::vector<std::pair<std::string, size_t>> counts() const override;
+  };
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -32,8 +80,21 @@ class JoinHash : public AbstractJoinOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_cleanup() override;
 
+  // @return The output of joining the inputs partition by partition, or nullptr if they are not partitioned alike
+  std::shared_ptr<const Table> _try_execute_partition_wise();
+
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   const std::optional<size_t> _radix_bits;
+  const std::vector<ColumnIDPair> _secondary_column_ids;
+
+  // The radix bits of each partitioning pass, set during execution. Kept after _on_cleanup() for the description.
+  std::optional<std::vector<size_t>> _radix_bits_per_pass;
+
+  // The number of partitions if the inputs were joined partition by partition
+  std::optional<PartitionID> _partition_wise_partition_count;
+
+  // The number of batches if the partitions exceeded the memory budget and were joined batch by batch
+  std::optional<size_t> _spilled_batch_count;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
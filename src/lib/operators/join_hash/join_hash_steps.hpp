@@ -1,18 +1,34 @@
 #pragma once
 
-#include <boost/container/small_vector.hpp>
+#include <boost/container/pmr/global_resource.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "bytell_hash_map.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "uninitialized_vector.hpp"
+#include "utils/temp_file_manager.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -42,15 +58,128 @@ template <typename T>
 using Partition = std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
                                      std::vector<PartitionedElement<T>>>;
 
-// The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
-// as n because in many cases, we join on primary key attributes where by definition we have only one match on the
-// smaller side.
-using SmallPosList = boost::container::small_vector<RowID, 1>;
-
-// In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
-// with bytell hash map and in some cases up to 5% faster) but is significantly larger than the bytell hash map.
+/*
+Maps the values of a partition of Left to the RowIDs of the rows holding them. In many cases, we join on primary key
+attributes, where by definition each value has only one row. Each entry of the map thus holds the value and a single
+RowID, which is the row itself for unique values. Only the RowIDs of values with more than one row are stored in an
+overflow list, to which the entry refers instead (by DUPLICATES_CHUNK_ID and the index of the list). An entry takes
+sizeof(T) + 8 bytes, compared to sizeof(T) + 40 bytes for a small_vector of RowIDs. The size of the hash tables is
+what limits how large a build side can be kept in memory. Whether a value gets an overflow list is decided when its
+second row is inserted, so that the layout does not depend on (possibly wrong) distinct count estimates.
+
+In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
+with bytell hash map and in some cases up to 5% faster) but is significantly larger than the bytell hash map. The
+buckets and the overflow lists are taken from the memory resource passed to build(), usually the QueryMemoryResource of
+the JoinHash, which may, e.g., back them with huge pages (see HugePageMemoryResource).
+*/
 template <typename T>
-using HashTable = ska::bytell_hash_map<T, SmallPosList>;
+class HashTable {
+ public:
+  using Matches = boost::iterator_range<const RowID*>;
+
+  // RowIDs of stored tables never have the INVALID_CHUNK_ID, which only NULL_ROW_ID uses, and NULLs are not inserted
+  static constexpr auto DUPLICATES_CHUNK_ID = INVALID_CHUNK_ID;
+
+  HashTable(const size_t expected_distinct_count, boost::container::pmr::memory_resource* memory_resource)
+      : _map(expected_distinct_count, std::hash<T>{}, std::equal_to<T>{},
+             PolymorphicAllocator<std::pair<T, RowID>>{memory_resource}),
+        _duplicate_row_ids(PolymorphicAllocator<pmr_vector<RowID>>{memory_resource}) {}
+
+  void insert(T value, const RowID row_id) {
+    DebugAssert(row_id.chunk_id != DUPLICATES_CHUNK_ID, "NULL_ROW_ID cannot be inserted");
+    ++_row_count;
+
+    const auto [it, inserted] = _map.emplace(std::move(value), row_id);  // NOLINT
+    if (inserted) return;
+
+    auto& entry = it->second;
+    if (entry.chunk_id == DUPLICATES_CHUNK_ID) {
+      _duplicate_row_ids[entry.chunk_offset].emplace_back(row_id);
+      return;
+    }
+
+    // The PolymorphicAllocator passes its memory resource on to the overflow list
+    auto& row_ids = _duplicate_row_ids.emplace_back();
+    row_ids.emplace_back(entry);
+    row_ids.emplace_back(row_id);
+    entry = RowID{DUPLICATES_CHUNK_ID, static_cast<ChunkOffset>(_duplicate_row_ids.size() - 1)};
+  }
+
+  // The RowIDs of the rows holding @param value, which stay valid as long as the HashTable exists
+  Matches find(const T& value) const {
+    const auto it = _map.find(value);
+    if (it == _map.end()) return {};
+
+    const auto& entry = it->second;
+    if (entry.chunk_id != DUPLICATES_CHUNK_ID) return {&entry, &entry + 1};
+
+    const auto& row_ids = _duplicate_row_ids[entry.chunk_offset];
+    return {row_ids.data(), row_ids.data() + row_ids.size()};
+  }
+
+  bool contains(const T& value) const { return _map.find(value) != _map.end(); }
+
+  // The number of inserted rows and of their distinct values
+  size_t row_count() const { return _row_count; }
+  size_t distinct_count() const { return _map.size(); }
+
+ protected:
+  ska::bytell_hash_map<T, RowID, std::hash<T>, std::equal_to<T>, PolymorphicAllocator<std::pair<T, RowID>>> _map;
+  pmr_vector<pmr_vector<RowID>> _duplicate_row_ids;
+  size_t _row_count{0};
+};
+
+/*
+Register-blocked Bloom filter over the hashes of the build side's values. It is used to drop the probe side's values
+that cannot find a match before they are radix-partitioned (sideways information passing). Each hash selects a single
+64-bit block and sets BITS_PER_VALUE bits within it, so that a lookup touches only one word instead of one cache line
+per bit. Values can be inserted concurrently.
+*/
+class BloomFilter {
+ public:
+  // Number of bits spent per distinct value. With 16 bits, the false positive rate is about 1%.
+  static constexpr auto BITS_PER_DISTINCT_VALUE = size_t{16};
+  static constexpr auto BITS_PER_VALUE = size_t{4};
+
+  explicit BloomFilter(const size_t distinct_count) {
+    auto block_count = size_t{1};
+    _shift = 64;
+    while (block_count * 64 < distinct_count * BITS_PER_DISTINCT_VALUE) {
+      block_count *= 2;
+      --_shift;
+    }
+    _blocks = std::vector<std::atomic<uint64_t>>(block_count);
+  }
+
+  void insert(const Hash hash) {
+    const auto [block_idx, mask] = _block_and_mask(hash);  // NOLINT
+    _blocks[block_idx].fetch_or(mask, std::memory_order_relaxed);
+  }
+
+  // May return true for hashes that have not been inserted, but never false for those that have
+  bool contains(const Hash hash) const {
+    const auto [block_idx, mask] = _block_and_mask(hash);  // NOLINT
+    return (_blocks[block_idx].load(std::memory_order_relaxed) & mask) == mask;
+  }
+
+ protected:
+  // Hash functions such as std::hash<int> are the identity, so the hash is scrambled first. The upper bits of the
+  // scrambled hash select the block, the upper bits of scrambling it once more select the bits within the block.
+  std::pair<size_t, uint64_t> _block_and_mask(const Hash hash) const {
+    const auto scrambled_hash = static_cast<uint64_t>(hash) * uint64_t{11'400'714'819'323'198'485u};
+    const auto block_idx = _shift == 64 ? size_t{0} : static_cast<size_t>(scrambled_hash >> _shift);
+
+    const auto bit_hash = scrambled_hash * uint64_t{14'029'467'366'897'019'727u};
+    auto mask = uint64_t{0};
+    for (auto bit_idx = size_t{0}; bit_idx < BITS_PER_VALUE; ++bit_idx) {
+      mask |= uint64_t{1} << ((bit_hash >> (58 - 6 * bit_idx)) & 63);
+    }
+    return {block_idx, mask};
+  }
+
+  std::vector<std::atomic<uint64_t>> _blocks;
+  size_t _shift;
+};
 
 /*
 This struct contains radix-partitioned data in a contiguous buffer, as well as a list of offsets for each partition.
@@ -86,9 +215,93 @@ inline std::vector<size_t> determine_chunk_offsets(std::shared_ptr<const Table>
   return chunk_offsets;
 }
 
+/*
+Determines the chunks of the probe input that cannot hold any value of the materialized build input, so that they are
+neither materialized nor probed. Thus, the result must only be used when the unmatched values are not part of the join
+result (i.e., for inner and semi joins). The statistics of each chunk (see ChunkStatistics) are checked against the
+range of the build values and, if there are at most MAX_PRUNING_VALUE_COUNT distinct ones, against each of them, which
+the RangeFilters and CountingQuotientFilters can rule out. The chunks of a reference table are checked against the
+statistics of the single chunk that they reference, if they do, as it holds a superset of their values.
+@return Whether each chunk can be skipped, or an empty vector if no chunk has statistics
+*/
+template <typename T>
+std::vector<bool> prune_probe_chunks(const RadixContainer<T>& build_container, const Table& probe_table,
+                                     const ColumnID probe_column_id) {
+  constexpr auto MAX_PRUNING_VALUE_COUNT = size_t{64};
+  const auto chunk_count = probe_table.chunk_count();
+
+  auto min = std::optional<T>{};
+  auto max = T{};
+  auto values = std::unordered_set<T>{};
+  auto has_few_values = true;
+  for (const auto& element : *build_container.elements) {
+    // NULLs and unused slots
+    if (element.row_id == NULL_ROW_ID) continue;
+
+    if (!min) {
+      min = element.value;
+      max = element.value;
+    } else {
+      min = std::min(*min, element.value);
+      max = std::max(max, element.value);
+    }
+
+    if (has_few_values) {
+      values.emplace(element.value);
+      has_few_values = values.size() <= MAX_PRUNING_VALUE_COUNT;
+    }
+  }
+
+  // Without build values, no probe value has a match
+  if (!min) return std::vector<bool>(chunk_count, true);
+
+  auto pruned_chunks = std::vector<bool>(chunk_count);
+  auto has_statistics = false;
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = probe_table.get_chunk(chunk_id);
+    auto statistics = chunk->statistics();
+    auto statistics_column_id = probe_column_id;
+
+    if (probe_table.type() == TableType::References) {
+      const auto reference_segment =
+          std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(probe_column_id));
+      const auto& pos_list = *reference_segment->pos_list();
+      if (pos_list.empty() || !pos_list.references_single_chunk() || pos_list.front() == NULL_ROW_ID) continue;
+
+      statistics = reference_segment->referenced_table()->get_chunk(pos_list.front().chunk_id)->statistics();
+      statistics_column_id = reference_segment->referenced_column_id();
+    }
+    if (!statistics) continue;
+    has_statistics = true;
+
+    if (statistics->can_prune(statistics_column_id, PredicateCondition::Between, AllTypeVariant{*min},
+                              AllTypeVariant{max})) {
+      pruned_chunks[chunk_id] = true;
+    } else if (has_few_values) {
+      pruned_chunks[chunk_id] = std::all_of(values.begin(), values.end(), [&](const auto& value) {
+        return statistics->can_prune(statistics_column_id, PredicateCondition::Equals, AllTypeVariant{value});
+      });
+    }
+  }
+
+  if (!has_statistics) return {};
+  return pruned_chunks;
+}
+
+/*
+Materializes the join column of an input, chunk by chunk and in parallel. If a Bloom filter of the other input is
+given, values that cannot have a match are not materialized, as if they were NULLs that are not considered. The same
+goes for the values of the chunks flagged by @param pruned_chunks (see prune_probe_chunks()). Thus, both must only be
+passed when the unmatched values are not part of the join result (i.e., for inner and semi joins).
+*/
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    const std::shared_ptr<const BloomFilter>& bloom_filter = nullptr,
+                                    const std::vector<bool>& pruned_chunks = {}) {
+  DebugAssert(!consider_null_values || !bloom_filter, "Bloom filter would drop values that have to be kept");
+  DebugAssert(!consider_null_values || pruned_chunks.empty(), "Pruning would drop values that have to be kept");
+
   const std::hash<HashedType> hash_function;
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
@@ -101,11 +314,11 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
-  size_t pass = 0;
-  size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
+  // This is the first radix partitioning pass, further passes are done by partition_radix_refine()
+  size_t mask = static_cast<uint32_t>(pow(2, radix_bits) - 1);
 
   auto chunk_offsets = std::vector<size_t>(in_table->chunk_count());
+  auto chunk_sizes = std::vector<size_t>(in_table->chunk_count());
 
   // fill work queue
   {
@@ -114,6 +327,7 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
 
       chunk_offsets[chunk_id] = output_offset;
+      chunk_sizes[chunk_id] = segment->size();
       output_offset += segment->size();
     }
   }
@@ -121,87 +335,96 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // create histograms per chunk
   histograms.resize(chunk_offsets.size());
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(in_table->chunk_count());
+  MorselDispatcher{chunk_sizes}.run([&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    // Get information from work queue
+    auto output_offset = chunk_offsets[chunk_id];
+    auto output_iterator = elements->begin() + output_offset;
+    auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      // Get information from work queue
-      auto output_offset = chunk_offsets[chunk_id];
-      auto output_iterator = elements->begin() + output_offset;
-      auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+    [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
+    if constexpr (consider_null_values) {
+      null_value_bitvector_iterator += output_offset;
+    }
 
-      [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
-      if constexpr (consider_null_values) {
-        null_value_bitvector_iterator += output_offset;
-      }
+    // prepare histogram
+    auto histogram = std::vector<size_t>(num_partitions);
 
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_partitions);
+    auto reference_chunk_offset = ChunkOffset{0};
 
-      auto reference_chunk_offset = ChunkOffset{0};
+    segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+      using IterableType = typename decltype(it)::IterableType;
 
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
-        using IterableType = typename decltype(it)::IterableType;
+      // The slots of pruned chunks remain empty, as if their values were NULLs that are not considered
+      if (!pruned_chunks.empty() && pruned_chunks[chunk_id]) return;
 
-        while (it != end) {
-          const auto& value = *it;
-          ++it;
+      while (it != end) {
+        const auto& value = *it;
+        ++it;
 
-          if (!value.is_null() || consider_null_values) {
-            const Hash hashed_value = hash_function(type_cast<HashedType>(value.value()));
+        if (!value.is_null() || consider_null_values) {
+          const Hash hashed_value = hash_function(type_cast<HashedType>(value.value()));
 
-            /*
-            For ReferenceSegments we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
+          if (bloom_filter && !bloom_filter->contains(hashed_value)) {
+            // reference_chunk_offset is only used for ReferenceSegments
             if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-            } else {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+              ++reference_chunk_offset;
             }
-
-            // In case we care about NULL values, store the NULL flag
-            if constexpr (consider_null_values) {
-              if (value.is_null()) {
-                *null_value_bitvector_iterator = true;
-              }
-            }
-
-            const Hash radix = hashed_value & mask;
-            ++histogram[radix];
-            ++null_value_bitvector_iterator;
+            continue;
           }
-          // reference_chunk_offset is only used for ReferenceSegments
+
+          /*
+          For ReferenceSegments we do not use the RowIDs from the referenced tables.
+          Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+          values from different inputs (important for Multi Joins).
+          */
           if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
-            ++reference_chunk_offset;
+            *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+          } else {
+            *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
           }
-        }
-      });
 
-      if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
-        // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
-        auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
-        while (output_iterator != elements->begin() + output_offset_end) {
-          *(output_iterator++) = PartitionedElement<T>{};
+          // In case we care about NULL values, store the NULL flag
+          if constexpr (consider_null_values) {
+            if (value.is_null()) {
+              *null_value_bitvector_iterator = true;
+            }
+          }
+
+          const Hash radix = hashed_value & mask;
+          ++histogram[radix];
+          ++null_value_bitvector_iterator;
+        }
+        // reference_chunk_offset is only used for ReferenceSegments
+        if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
+          ++reference_chunk_offset;
         }
       }
+    });
 
-      histograms[chunk_id] = std::move(histogram);
-    }));
-    jobs.back()->schedule();
-  }
-  CurrentScheduler::wait_for_tasks(jobs);
+    if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
+      // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
+      auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
+      while (output_iterator != elements->begin() + output_offset_end) {
+        *(output_iterator++) = PartitionedElement<T>{};
+      }
+    }
+
+    histograms[chunk_id] = std::move(histogram);
+  });
 
   return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector};
 }
 
 /*
-Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
+Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left.
+If a Bloom filter is given, the hashes of all values are inserted into it. The hash tables and their position lists
+are allocated from the memory_resource, which has to outlive them.
 */
 template <typename LeftType, typename HashedType>
-std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container) {
+std::vector<std::optional<HashTable<HashedType>>> build(
+    const RadixContainer<LeftType>& radix_container, const std::shared_ptr<BloomFilter>& bloom_filter = nullptr,
+    boost::container::pmr::memory_resource* memory_resource = boost::container::pmr::get_default_resource()) {
   /*
   NUMA notes:
   The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
@@ -229,7 +452,7 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
       auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
 
       // slightly oversize the hash table to avoid unnecessary rebuilds
-      auto hashtable = HashTable<HashedType>(static_cast<size_t>(partition_size * 1.2));
+      auto hashtable = HashTable<HashedType>(static_cast<size_t>(partition_size * 1.2), memory_resource);
 
       for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
         auto& element = partition_left[partition_offset];
@@ -240,12 +463,9 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
         }
 
         auto casted_value = type_cast<HashedType>(std::move(element.value));
-        auto it = hashtable.find(casted_value);
-        if (it != hashtable.end()) {
-          it->second.emplace_back(element.row_id);
-        } else {
-          hashtable.emplace(casted_value, SmallPosList{element.row_id});
-        }
+        if (bloom_filter) bloom_filter->insert(std::hash<HashedType>{}(casted_value));
+
+        hashtable.insert(std::move(casted_value), element.row_id);
       }
 
       hashtables[current_partition_id] = std::move(hashtable);
@@ -277,9 +497,8 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
-  size_t pass = 0;
-  size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
+  // This is the first radix partitioning pass, further passes are done by partition_radix_refine()
+  size_t mask = static_cast<uint32_t>(pow(2, radix_bits) - 1);
 
   // allocate new (shared) output
   auto output = std::make_shared<Partition<T>>();
@@ -353,11 +572,275 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   return radix_output;
 }
 
+/*
+Subsequent pass of a multi-pass radix partitioning: Each partition of the input container is split by the next
+`radix_bits` bits of the hash, i.e., the bits above the `previous_radix_bits` that have already been used. Partition
+p of the input becomes the partitions p * 2^radix_bits to (p + 1) * 2^radix_bits - 1 of the output. As both inputs of
+the join are refined the same way, equal values still end up in partitions with the same id.
+
+A single pass with a large fan-out scatters its writes over more partitions than the L1 cache and the TLB can hold.
+Splitting the radix bits into multiple passes keeps the fan-out of each pass small. The partitions are independent of
+each other and are refined in parallel.
+*/
+template <typename T, typename HashedType, bool consider_null_values>
+RadixContainer<T> partition_radix_refine(const RadixContainer<T>& radix_container, const size_t previous_radix_bits,
+                                         const size_t radix_bits) {
+  if constexpr (consider_null_values) {
+    DebugAssert(radix_container.null_value_bitvector->size() == radix_container.elements->size(),
+                "partition_radix_refine() called with NULL consideration but radix container does not store any NULL "
+                "value information");
+  }
+
+  const std::hash<HashedType> hash_function;
+
+  const auto& container_elements = *radix_container.elements;
+  [[maybe_unused]] const auto& null_value_bitvector = *radix_container.null_value_bitvector;
+
+  const auto input_partition_count = radix_container.partition_offsets.size();
+  const size_t fan_out = 1ull << radix_bits;
+  const size_t mask = fan_out - 1;
+
+  auto output = std::make_shared<Partition<T>>();
+  output->resize(container_elements.size());
+
+  [[maybe_unused]] auto output_nulls = std::make_shared<std::vector<bool>>();
+  if constexpr (consider_null_values) {
+    output_nulls->resize(null_value_bitvector.size());
+  }
+
+  RadixContainer<T> radix_output;
+  radix_output.elements = output;
+  radix_output.partition_offsets.resize(input_partition_count * fan_out);
+  radix_output.null_value_bitvector = output_nulls;
+
+  // std::vector<bool> packs its flags, so that neighbouring partitions cannot write their NULL flags concurrently.
+  // Instead, each job collects the flags of its partition, which are copied into output_nulls afterwards.
+  [[maybe_unused]] auto output_nulls_by_partition = std::vector<std::vector<bool>>(input_partition_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_partition_count);
+
+  for (size_t input_partition_id = 0; input_partition_id < input_partition_count; ++input_partition_id) {
+    const auto partition_begin =
+        input_partition_id == 0 ? 0 : radix_container.partition_offsets[input_partition_id - 1];
+    const auto partition_end = radix_container.partition_offsets[input_partition_id];  // make end non-inclusive
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, input_partition_id, partition_begin, partition_end]() {
+      const auto radix_of = [&](const PartitionedElement<T>& element) {
+        return (hash_function(type_cast<HashedType>(element.value)) >> previous_radix_bits) & mask;
+      };
+
+      auto histogram = std::vector<size_t>(fan_out);
+      for (auto partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
+        ++histogram[radix_of(container_elements[partition_offset])];
+      }
+
+      // use the histogram to calculate the offsets of the refined partitions
+      auto output_offsets = std::vector<size_t>(fan_out);
+      auto offset = partition_begin;
+      for (size_t radix = 0; radix < fan_out; ++radix) {
+        output_offsets[radix] = offset;
+        offset += histogram[radix];
+        radix_output.partition_offsets[input_partition_id * fan_out + radix] = offset;
+      }
+
+      [[maybe_unused]] auto& partition_nulls = output_nulls_by_partition[input_partition_id];
+      if constexpr (consider_null_values) {
+        partition_nulls.resize(partition_end - partition_begin);
+      }
+
+      for (auto partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
+        const auto& element = container_elements[partition_offset];
+        const auto radix = radix_of(element);
+
+        if constexpr (consider_null_values) {
+          partition_nulls[output_offsets[radix] - partition_begin] = null_value_bitvector[partition_offset];
+        }
+
+        (*output)[output_offsets[radix]] = element;
+        ++output_offsets[radix];
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  if constexpr (consider_null_values) {
+    auto output_nulls_iter = output_nulls->begin();
+    for (const auto& partition_nulls : output_nulls_by_partition) {
+      output_nulls_iter = std::copy(partition_nulls.begin(), partition_nulls.end(), output_nulls_iter);
+    }
+  }
+
+  return radix_output;
+}
+
+/*
+Consecutive partitions of a RadixContainer that were written to a TempFile because they do not fit into the memory
+budget of the join, see spill_partitions(). Elements of trivially copyable types are written as one block, strings
+as their RowID, their length, and their characters. The NULL flags follow as one byte per element.
+*/
+struct SpilledPartitions {
+  std::unique_ptr<TempFile> file;
+
+  // The accumulated sizes of the partitions, as in the RadixContainer
+  std::vector<size_t> partition_offsets;
+
+  size_t element_bytes{0};
+  bool has_null_values{false};
+};
+
+// @return The range of elements of the partitions [begin_partition, end_partition) of the @param radix_container
+template <typename T>
+std::pair<size_t, size_t> partition_element_range(const RadixContainer<T>& radix_container,
+                                                  const size_t begin_partition, const size_t end_partition) {
+  const auto element_begin = begin_partition == 0 ? size_t{0} : radix_container.partition_offsets[begin_partition - 1];
+  const auto element_end = end_partition == 0 ? size_t{0} : radix_container.partition_offsets[end_partition - 1];
+  return {element_begin, element_end};
+}
+
+template <typename T>
+std::vector<size_t> sliced_partition_offsets(const RadixContainer<T>& radix_container, const size_t begin_partition,
+                                             const size_t end_partition, const size_t element_begin) {
+  auto partition_offsets = std::vector<size_t>(end_partition - begin_partition);
+  for (auto partition_id = begin_partition; partition_id < end_partition; ++partition_id) {
+    partition_offsets[partition_id - begin_partition] = radix_container.partition_offsets[partition_id] - element_begin;
+  }
+  return partition_offsets;
+}
+
+template <typename T>
+bool has_null_values(const RadixContainer<T>& radix_container) {
+  return radix_container.null_value_bitvector && !radix_container.null_value_bitvector->empty();
+}
+
+// Copies the partitions [begin_partition, end_partition) of the @param radix_container into a RadixContainer of their
+// own, whose partitions are numbered from zero
+template <typename T>
+RadixContainer<T> slice_partitions(const RadixContainer<T>& radix_container, const size_t begin_partition,
+                                   const size_t end_partition) {
+  const auto [element_begin, element_end] =  // NOLINT
+      partition_element_range(radix_container, begin_partition, end_partition);
+
+  auto elements = std::make_shared<Partition<T>>(element_end - element_begin);
+  std::copy(radix_container.elements->begin() + element_begin, radix_container.elements->begin() + element_end,
+            elements->begin());
+
+  auto null_value_bitvector = std::make_shared<std::vector<bool>>();
+  if (has_null_values(radix_container)) {
+    null_value_bitvector->assign(radix_container.null_value_bitvector->begin() + element_begin,
+                                 radix_container.null_value_bitvector->begin() + element_end);
+  }
+
+  return RadixContainer<T>{
+      elements, sliced_partition_offsets(radix_container, begin_partition, end_partition, element_begin),
+      null_value_bitvector};
+}
+
+// Writes the partitions [begin_partition, end_partition) of the @param radix_container to a new TempFile
+template <typename T>
+SpilledPartitions spill_partitions(const RadixContainer<T>& radix_container, const size_t begin_partition,
+                                   const size_t end_partition) {
+  const auto [element_begin, element_end] =  // NOLINT
+      partition_element_range(radix_container, begin_partition, end_partition);
+
+  auto spilled_partitions = SpilledPartitions{};
+  spilled_partitions.file = TempFileManager::get().create_file();
+  spilled_partitions.partition_offsets =
+      sliced_partition_offsets(radix_container, begin_partition, end_partition, element_begin);
+  spilled_partitions.has_null_values = has_null_values(radix_container);
+
+  auto& file = *spilled_partitions.file;
+  const auto& elements = *radix_container.elements;
+
+  if constexpr (std::is_trivially_copyable_v<PartitionedElement<T>>) {
+    file.write(elements.data() + element_begin, (element_end - element_begin) * sizeof(PartitionedElement<T>));
+  } else {
+    // The strings are serialized into a buffer that is written whenever it is full, so that each string does not
+    // need a write of its own
+    constexpr auto BUFFER_SIZE = size_t{1} << 20;
+    auto buffer = std::vector<char>{};
+    buffer.reserve(BUFFER_SIZE);
+    const auto append = [&](const void* data, const size_t bytes) {
+      const auto* begin = static_cast<const char*>(data);
+      buffer.insert(buffer.end(), begin, begin + bytes);
+    };
+
+    for (auto element_idx = element_begin; element_idx < element_end; ++element_idx) {
+      const auto& element = elements[element_idx];
+      const auto length = element.value.size();
+      append(&element.row_id, sizeof(RowID));
+      append(&length, sizeof(length));
+      append(element.value.data(), length);
+
+      if (buffer.size() >= BUFFER_SIZE) {
+        file.write(buffer.data(), buffer.size());
+        buffer.clear();
+      }
+    }
+    file.write(buffer.data(), buffer.size());
+  }
+  spilled_partitions.element_bytes = file.size();
+
+  if (spilled_partitions.has_null_values) {
+    auto null_values = std::vector<uint8_t>(element_end - element_begin);
+    for (auto element_idx = element_begin; element_idx < element_end; ++element_idx) {
+      null_values[element_idx - element_begin] = (*radix_container.null_value_bitvector)[element_idx];
+    }
+    file.write(null_values.data(), null_values.size());
+  }
+
+  return spilled_partitions;
+}
+
+// Reads partitions that were written by spill_partitions() back into a RadixContainer
+template <typename T>
+RadixContainer<T> read_spilled_partitions(const SpilledPartitions& spilled_partitions) {
+  const auto element_count =
+      spilled_partitions.partition_offsets.empty() ? size_t{0} : spilled_partitions.partition_offsets.back();
+  const auto& file = *spilled_partitions.file;
+
+  auto elements = std::make_shared<Partition<T>>(element_count);
+  if constexpr (std::is_trivially_copyable_v<PartitionedElement<T>>) {
+    file.read(0, elements->data(), element_count * sizeof(PartitionedElement<T>));
+  } else {
+    auto buffer = std::vector<char>(spilled_partitions.element_bytes);
+    file.read(0, buffer.data(), buffer.size());
+
+    auto buffer_offset = size_t{0};
+    for (auto& element : *elements) {
+      auto length = size_t{0};
+      std::memcpy(&element.row_id, buffer.data() + buffer_offset, sizeof(RowID));
+      std::memcpy(&length, buffer.data() + buffer_offset + sizeof(RowID), sizeof(length));
+      buffer_offset += sizeof(RowID) + sizeof(length);
+      element.value.assign(buffer.data() + buffer_offset, length);
+      buffer_offset += length;
+    }
+  }
+
+  auto null_value_bitvector = std::make_shared<std::vector<bool>>();
+  if (spilled_partitions.has_null_values) {
+    auto null_values = std::vector<uint8_t>(element_count);
+    file.read(spilled_partitions.element_bytes, null_values.data(), null_values.size());
+    null_value_bitvector->assign(null_values.begin(), null_values.end());
+  }
+
+  return RadixContainer<T>{elements, spilled_partitions.partition_offsets, null_value_bitvector};
+}
+
 /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
   number of hash tables that need to be looked into to just 1.
+
+  Once the hash table of a partition exceeds the caches, each lookup is a cache miss. The rows are thus probed in
+  batches of PROBE_BATCH_SIZE: All lookups of a batch are done first, with no dependency between them, so that the CPU
+  can overlap their cache misses. The overflow lists of the matches are prefetched, and only then are the matches of
+  the batch written to the output, which does not stall the lookups of the next batch with the branches and stores.
   */
+constexpr auto PROBE_BATCH_SIZE = size_t{16};
+
 template <typename RightType, typename HashedType, bool consider_null_values>
 void probe(const RadixContainer<RightType>& radix_container,
            const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
@@ -405,53 +888,65 @@ void probe(const RadixContainer<RightType>& radix_container,
         pos_list_left_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_right_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-          auto& row = partition[partition_offset];
+        // The matching rows of each row of the current batch
+        auto batch_matches = std::array<typename HashTable<HashedType>::Matches, PROBE_BATCH_SIZE>{};
 
-          if (mode == JoinMode::Inner && row.row_id == NULL_ROW_ID) {
-            // From previous joins, we could potentially have NULL values that do not refer to
-            // an actual row but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
-            continue;
+        for (auto batch_begin = partition_begin; batch_begin < partition_end; batch_begin += PROBE_BATCH_SIZE) {
+          const auto batch_end = std::min(batch_begin + PROBE_BATCH_SIZE, partition_end);
+
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            const auto& row = partition[partition_offset];
+            const auto matching_rows = hashtable.find(type_cast<HashedType>(row.value));
+            if (matching_rows.size() > 1) __builtin_prefetch(matching_rows.begin());
+            batch_matches[partition_offset - batch_begin] = matching_rows;
           }
 
-          const auto& rows_iter = hashtable.find(type_cast<HashedType>(row.value));
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            auto& row = partition[partition_offset];
 
-          if (rows_iter != hashtable.end()) {
-            // Key exists, thus we have at least one hit
-            const auto& matching_rows = rows_iter->second;
+            if (mode == JoinMode::Inner && row.row_id == NULL_ROW_ID) {
+              // From previous joins, we could potentially have NULL values that do not refer to
+              // an actual row but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
+              continue;
+            }
 
-            // Since we cannot store NULL values directly in off-the-shelf containers,
-            // we need to the check the NULL bit vector here because a NULL value (represented
-            // as a zero) yields the same rows as an actual zero value.
-            // For inner joins, we skip NULL values and output them for outer joins.
-            // Note, if the materialization/radix partitioning phase did not explicitely consider
-            // NULL values, they will not be handed to the probe function.
-            if constexpr (consider_null_values) {
-              if ((*radix_container.null_value_bitvector)[partition_offset]) {
-                if (mode == JoinMode::Left || mode == JoinMode::Right) {
-                  pos_list_left_local.emplace_back(NULL_ROW_ID);
-                  pos_list_right_local.emplace_back(row.row_id);
+            const auto& matching_rows = batch_matches[partition_offset - batch_begin];
+            if (!matching_rows.empty()) {
+              // Key exists, thus we have at least one hit
+
+              // Since we cannot store NULL values directly in off-the-shelf containers,
+              // we need to the check the NULL bit vector here because a NULL value (represented
+              // as a zero) yields the same rows as an actual zero value.
+              // For inner joins, we skip NULL values and output them for outer joins.
+              // Note, if the materialization/radix partitioning phase did not explicitely consider
+              // NULL values, they will not be handed to the probe function.
+              if constexpr (consider_null_values) {
+                if ((*radix_container.null_value_bitvector)[partition_offset]) {
+                  if (mode == JoinMode::Left || mode == JoinMode::Right) {
+                    pos_list_left_local.emplace_back(NULL_ROW_ID);
+                    pos_list_right_local.emplace_back(row.row_id);
+                  }
+                  // ignore found matches and continue with next probe item
+                  continue;
                 }
-                // ignore found matches and continue with next probe item
-                continue;
               }
-            }
 
-            // If NULL values are discarded, the matching row pairs will be written to the result pos lists.
-            for (const auto& row_id : matching_rows) {
-              pos_list_left_local.emplace_back(row_id);
-              pos_list_right_local.emplace_back(row.row_id);
-            }
-          } else {
-            // We have not found matching items. Only continue for non-equi join modes.
-            // We use constexpr to prune this conditional for the equi-join implementation.
-            // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
-            // relation since the relations are swapped upfront.
-            if constexpr (consider_null_values) {
-              if (mode == JoinMode::Left || mode == JoinMode::Right) {
-                pos_list_left_local.emplace_back(NULL_ROW_ID);
+              // If NULL values are discarded, the matching row pairs will be written to the result pos lists.
+              for (const auto& row_id : matching_rows) {
+                pos_list_left_local.emplace_back(row_id);
                 pos_list_right_local.emplace_back(row.row_id);
               }
+            } else {
+              // We have not found matching items. Only continue for non-equi join modes.
+              // We use constexpr to prune this conditional for the equi-join implementation.
+              // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
+              // relation since the relations are swapped upfront.
+              if constexpr (consider_null_values) {
+                if (mode == JoinMode::Left || mode == JoinMode::Right) {
+                  pos_list_left_local.emplace_back(NULL_ROW_ID);
+                  pos_list_right_local.emplace_back(row.row_id);
+                }
+              }
             }
           }
         }
@@ -527,9 +1022,9 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
           }
 
           const auto& hashtable = hashtables[current_partition_id].value();
-          const auto it = hashtable.find(type_cast<HashedType>(row.value));
+          const auto has_match = hashtable.contains(type_cast<HashedType>(row.value));
 
-          if ((mode == JoinMode::Semi && it != hashtable.end()) || (mode == JoinMode::Anti && it == hashtable.end())) {
+          if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) {
             // Semi: found at least one match for this row -> match
             // Anti: no matching rows found -> match
             pos_list_local.emplace_back(row.row_id);
@@ -554,6 +1049,190 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
   CurrentScheduler::wait_for_tasks(jobs);
 }
 
+/*
+Non-partitioned probe phase: If no radix bits are used, the single hash table of the left relation is expected to fit
+into the cache. Instead of materializing and partitioning the right relation, its chunks are probed directly and in
+parallel, and the matches of each chunk are written to the pos lists of that chunk (pos_lists_left and
+pos_lists_right have to be sized by the caller). The results are the same as those of materialize_input() followed by
+probe(). The chunks flagged by @param pruned_chunks are skipped, see materialize_input().
+*/
+template <typename RightType, typename HashedType, bool consider_null_values>
+void probe_streaming(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                     const std::optional<HashTable<HashedType>>& hashtable, std::vector<PosList>& pos_lists_left,
+                     std::vector<PosList>& pos_lists_right, const JoinMode mode,
+                     const std::vector<bool>& pruned_chunks = {}) {
+  DebugAssert(!consider_null_values || pruned_chunks.empty(), "Pruning would drop values that have to be kept");
+
+  MorselDispatcher{*in_table}.run([&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    if (!pruned_chunks.empty() && pruned_chunks[chunk_id]) return;
+
+    const auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+    PosList pos_list_left_local;
+    PosList pos_list_right_local;
+
+    // simple heuristic to estimate result size: half of the chunk's rows will match
+    const auto expected_output_size = std::max(size_t{10}, static_cast<size_t>(segment->size() / 2));
+    pos_list_left_local.reserve(expected_output_size);
+    pos_list_right_local.reserve(expected_output_size);
+
+    auto reference_chunk_offset = ChunkOffset{0};
+
+    segment_with_iterators<RightType>(*segment, [&](auto it, const auto end) {
+      using IterableType = typename decltype(it)::IterableType;
+
+      for (; it != end; ++it, ++reference_chunk_offset) {
+        const auto& value = *it;
+
+        // For ReferenceSegments we do not use the RowIDs from the referenced tables, see materialize_input()
+        auto row_id = RowID{chunk_id, value.chunk_offset()};
+        if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<RightType>>) {
+          row_id = RowID{chunk_id, reference_chunk_offset};
+        }
+
+        // NULL values never match. Like values without matches, they are only part of the result for outer joins.
+        // We use constexpr to prune this conditional for the equi-join implementation.
+        const auto emit_without_match = [&]() {
+          if constexpr (consider_null_values) {
+            if (mode == JoinMode::Left || mode == JoinMode::Right) {
+              pos_list_left_local.emplace_back(NULL_ROW_ID);
+              pos_list_right_local.emplace_back(row_id);
+            }
+          }
+        };
+
+        if (value.is_null() || !hashtable) {
+          emit_without_match();
+          continue;
+        }
+
+        const auto matching_row_ids = hashtable->find(type_cast<HashedType>(value.value()));
+        if (matching_row_ids.empty()) {
+          emit_without_match();
+          continue;
+        }
+
+        for (const auto& matching_row_id : matching_row_ids) {
+          pos_list_left_local.emplace_back(matching_row_id);
+          pos_list_right_local.emplace_back(row_id);
+        }
+      }
+    });
+
+    pos_lists_left[chunk_id] = std::move(pos_list_left_local);
+    pos_lists_right[chunk_id] = std::move(pos_list_right_local);
+  });
+}
+
+// Non-partitioned counterpart of probe_semi_anti(), see probe_streaming()
+template <typename RightType, typename HashedType>
+void probe_streaming_semi_anti(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                               const std::optional<HashTable<HashedType>>& hashtable, std::vector<PosList>& pos_lists,
+                               const JoinMode mode, const std::vector<bool>& pruned_chunks = {}) {
+  DebugAssert(mode == JoinMode::Semi || pruned_chunks.empty(), "Pruning would drop values that have to be kept");
+
+  MorselDispatcher{*in_table}.run([&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    if (!pruned_chunks.empty() && pruned_chunks[chunk_id]) return;
+
+    const auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+    PosList pos_list_local;
+
+    auto reference_chunk_offset = ChunkOffset{0};
+
+    segment_with_iterators<RightType>(*segment, [&](auto it, const auto end) {
+      using IterableType = typename decltype(it)::IterableType;
+
+      for (; it != end; ++it, ++reference_chunk_offset) {
+        const auto& value = *it;
+
+        // NULL values are neither part of the result of semi nor of anti joins
+        if (value.is_null()) continue;
+
+        const auto has_match = hashtable && hashtable->contains(type_cast<HashedType>(value.value()));
+        if (has_match != (mode == JoinMode::Semi)) continue;
+
+        if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<RightType>>) {
+          pos_list_local.emplace_back(chunk_id, reference_chunk_offset);
+        } else {
+          pos_list_local.emplace_back(chunk_id, value.chunk_offset());
+        }
+      }
+    });
+
+    pos_lists[chunk_id] = std::move(pos_list_local);
+  });
+}
+
+/*
+Redistributes the matches of the partitioned probe phase, so that they are aligned to the chunks of the right (probe)
+relation: Afterwards, pos_lists_right[chunk_id] and pos_lists_left[chunk_id] hold the matches of the rows in chunk
+chunk_id, in the order of the partitions. This way, each output chunk of the join references a single chunk of the right
+relation, which write_output_segments_aligned() and the operators consuming the join's output can exploit.
+For semi and anti joins, pos_lists_left is not used and has to be passed with align_left set to false.
+*/
+inline void align_pos_lists_to_chunks(std::vector<PosList>& pos_lists_left, std::vector<PosList>& pos_lists_right,
+                                      const bool align_left, const size_t chunk_count) {
+  const auto partition_count = pos_lists_right.size();
+
+  // count the matches of each chunk per partition
+  auto histograms = std::vector<std::vector<size_t>>(partition_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(partition_count);
+
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto histogram = std::vector<size_t>(chunk_count);
+      for (const auto& row_id : pos_lists_right[partition_id]) {
+        ++histogram[row_id.chunk_id];
+      }
+      histograms[partition_id] = std::move(histogram);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  // use the histograms to calculate where each partition writes the matches of each chunk
+  auto output_offsets_by_partition =
+      std::vector<std::vector<size_t>>(partition_count, std::vector<size_t>(chunk_count));
+  auto aligned_pos_lists_left = std::vector<PosList>(align_left ? chunk_count : 0);
+  auto aligned_pos_lists_right = std::vector<PosList>(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto offset = size_t{0};
+    for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+      output_offsets_by_partition[partition_id][chunk_id] = offset;
+      offset += histograms[partition_id][chunk_id];
+    }
+
+    aligned_pos_lists_right[chunk_id].resize(offset);
+    if (align_left) aligned_pos_lists_left[chunk_id].resize(offset);
+  }
+
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& output_offsets = output_offsets_by_partition[partition_id];
+      const auto& pos_list_right = pos_lists_right[partition_id];
+
+      for (size_t position = 0; position < pos_list_right.size(); ++position) {
+        const auto chunk_id = pos_list_right[position].chunk_id;
+        const auto output_offset = output_offsets[chunk_id]++;
+
+        aligned_pos_lists_right[chunk_id][output_offset] = pos_list_right[position];
+        if (align_left) aligned_pos_lists_left[chunk_id][output_offset] = pos_lists_left[partition_id][position];
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  pos_lists_left = std::move(aligned_pos_lists_left);
+  pos_lists_right = std::move(aligned_pos_lists_right);
+}
+
 using PosLists = std::vector<std::shared_ptr<const PosList>>;
 using PosListsBySegment = std::vector<std::shared_ptr<PosLists>>;
 
@@ -589,6 +1268,48 @@ inline PosListsBySegment setup_pos_lists_by_segment(const std::shared_ptr<const
   return pos_lists_by_segment;
 }
 
+/*
+Writes the output segments for a pos list that only references the rows of chunk chunk_id of input_table, e.g., the
+matches of the right relation after align_pos_lists_to_chunks(). The output pos lists are marked as referencing a
+single chunk. For reference tables, the input pos lists of the chunk are dereferenced once each and the results are
+shared between all columns that share their input pos list, like in TableScan.
+*/
+inline void write_output_segments_aligned(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
+                                          const ChunkID chunk_id, std::shared_ptr<PosList> pos_list) {
+  if (input_table->type() == TableType::Data) {
+    pos_list->guarantee_single_chunk();
+    for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+      output_segments.push_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+    return;
+  }
+
+  const auto chunk = input_table->get_chunk(chunk_id);
+  auto dereferenced_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+    const auto& pos_list_in = reference_segment->pos_list();
+
+    auto& dereferenced_pos_list = dereferenced_pos_lists[pos_list_in];
+    if (!dereferenced_pos_list) {
+      dereferenced_pos_list = std::make_shared<PosList>(pos_list->size());
+      if (pos_list_in->references_single_chunk()) {
+        dereferenced_pos_list->guarantee_single_chunk();
+      }
+
+      auto dereferenced_pos_list_iter = dereferenced_pos_list->begin();
+      for (const auto& row : *pos_list) {
+        *dereferenced_pos_list_iter = (*pos_list_in)[row.chunk_offset];
+        ++dereferenced_pos_list_iter;
+      }
+    }
+
+    output_segments.push_back(std::make_shared<ReferenceSegment>(
+        reference_segment->referenced_table(), reference_segment->referenced_column_id(), dereferenced_pos_list));
+  }
+}
+
 inline void write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                                   const PosListsBySegment& input_pos_list_ptrs_sptrs_by_segments,
                                   std::shared_ptr<PosList> pos_list) {
@@ -0,0 +1,297 @@
+#include "join_ie.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The rank of a value among the values of a column of both inputs, NULL_RANK for NULLs
+constexpr auto NULL_RANK = std::numeric_limits<size_t>::max();
+
+bool is_inequality(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+/**
+ * Replaces the values of the columns of a predicate with their ranks in the sorted values of both columns, equal values
+ * getting the same rank. The ranks compare like the values, so that the join itself only needs to be compiled once and
+ * not for each combination of the data types of the two predicates. The ranks of a table are ordered like its rows.
+ */
+template <typename T>
+void rank_values(const Table& left_table, const ColumnID left_column_id, const Table& right_table,
+                 const ColumnID right_column_id, std::vector<size_t>& left_ranks, std::vector<size_t>& right_ranks) {
+  const auto left_row_count = left_table.row_count();
+  left_ranks.assign(left_row_count, NULL_RANK);
+  right_ranks.assign(right_table.row_count(), NULL_RANK);
+
+  // The values and the indices of their rows, where the rows of the right table follow those of the left table
+  auto values = std::vector<std::pair<T, size_t>>{};
+  values.reserve(left_row_count + right_table.row_count());
+
+  const auto add_values = [&](const Table& table, const ColumnID column_id, size_t row_index) {
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      segment_iterate<T>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) values.emplace_back(position.value(), row_index);
+        ++row_index;
+      });
+    }
+  };
+  add_values(left_table, left_column_id, 0);
+  add_values(right_table, right_column_id, left_row_count);
+
+  std::sort(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  auto rank = size_t{0};
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    if (value_index > 0 && values[value_index - 1].first < values[value_index].first) ++rank;
+
+    const auto row_index = values[value_index].second;
+    if (row_index < left_row_count) {
+      left_ranks[row_index] = rank;
+    } else {
+      right_ranks[row_index - left_row_count] = rank;
+    }
+  }
+}
+
+void rank_column_pair(const Table& left_table, const Table& right_table, const ColumnIDPair& column_ids,
+                      std::vector<size_t>& left_ranks, std::vector<size_t>& right_ranks) {
+  const auto data_type = left_table.column_data_type(column_ids.first);
+  Assert(data_type == right_table.column_data_type(column_ids.second),
+         "JoinIE requires the columns of a predicate to have the same data type");
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    rank_values<ColumnDataType>(left_table, column_ids.first, right_table, column_ids.second, left_ranks,
+                                right_ranks);
+  });
+}
+
+// The RowIDs of a table, ordered like its ranks
+std::vector<RowID> row_ids(const Table& table) {
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(table.row_count());
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk_size = table.get_chunk(chunk_id)->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      row_ids.emplace_back(chunk_id, chunk_offset);
+    }
+  }
+  return row_ids;
+}
+
+// Calls @param functor with the index of every set bit in [begin, end) of @param words
+template <typename Functor>
+void for_each_set_bit(const std::vector<uint64_t>& words, const size_t begin, const size_t end,
+                      const Functor& functor) {
+  if (begin >= end) return;
+
+  const auto last_word_index = (end - 1) / 64;
+  for (auto word_index = begin / 64; word_index <= last_word_index; ++word_index) {
+    auto word = words[word_index];
+    if (word_index == begin / 64) word &= ~uint64_t{0} << (begin % 64);
+    if (word_index == last_word_index && end % 64 != 0) word &= (uint64_t{1} << (end % 64)) - 1;
+
+    while (word != 0) {
+      functor(word_index * 64 + static_cast<size_t>(__builtin_ctzll(word)));
+      word &= word - 1;
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinIE::JoinIE(const std::shared_ptr<const AbstractOperator>& left,
+               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+               const ColumnIDPair& secondary_column_ids, const PredicateCondition secondary_predicate_condition)
+    : AbstractJoinOperator(OperatorType::JoinIE, left, right, mode, column_ids, predicate_condition),
+      _secondary_column_ids(secondary_column_ids),
+      _secondary_predicate_condition(secondary_predicate_condition) {
+  Assert(mode == JoinMode::Inner, "JoinIE only supports inner joins");
+  Assert(is_inequality(predicate_condition) && is_inequality(secondary_predicate_condition),
+         "JoinIE requires two inequality predicates");
+}
+
+const std::string JoinIE::name() const { return "JoinIE"; }
+
+const std::string JoinIE::description(DescriptionMode description_mode) const {
+  const auto column_name = [&](const auto& table, const ColumnID column_id) {
+    return table ? table->column_name(column_id) : std::string("Column #") + std::to_string(column_id);
+  };
+  const auto predicate_string = [&](const ColumnIDPair& column_ids, const PredicateCondition predicate_condition) {
+    return column_name(input_table_left(), column_ids.first) + " " +
+           predicate_condition_to_string.left.at(predicate_condition) + " " +
+           column_name(input_table_right(), column_ids.second);
+  };
+
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  return name() + separator + "(" + join_mode_to_string.at(_mode) + " Join where " +
+         predicate_string(_column_ids, _predicate_condition) + " AND " +
+         predicate_string(_secondary_column_ids, _secondary_predicate_condition) + ")";
+}
+
+const ColumnIDPair& JoinIE::secondary_column_ids() const { return _secondary_column_ids; }
+
+PredicateCondition JoinIE::secondary_predicate_condition() const { return _secondary_predicate_condition; }
+
+std::shared_ptr<AbstractOperator> JoinIE::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinIE>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                  _secondary_column_ids, _secondary_predicate_condition);
+}
+
+void JoinIE::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> JoinIE::_on_execute() {
+  const auto left_table = input_table_left();
+  const auto right_table = input_table_right();
+
+  // x is the column of the first predicate, y the one of the second
+  auto left_x = std::vector<size_t>{};
+  auto right_x = std::vector<size_t>{};
+  auto left_y = std::vector<size_t>{};
+  auto right_y = std::vector<size_t>{};
+  rank_column_pair(*left_table, *right_table, _column_ids, left_x, right_x);
+  rank_column_pair(*left_table, *right_table, _secondary_column_ids, left_y, right_y);
+
+  const auto valid_rows = [](const auto& x, const auto& y) {
+    auto rows = std::vector<size_t>{};
+    rows.reserve(x.size());
+    for (auto row = size_t{0}; row < x.size(); ++row) {
+      if (x[row] != NULL_RANK && y[row] != NULL_RANK) rows.emplace_back(row);
+    }
+    return rows;
+  };
+
+  // The right rows sorted by x. A right row is marked in the bit array at its position in this order.
+  auto right_rows_by_x = valid_rows(right_x, right_y);
+  std::stable_sort(right_rows_by_x.begin(), right_rows_by_x.end(),
+                   [&](const auto lhs, const auto rhs) { return right_x[lhs] < right_x[rhs]; });
+
+  auto sorted_right_x = std::vector<size_t>(right_rows_by_x.size());
+  auto x_positions = std::vector<size_t>(right_x.size());
+  for (auto position = size_t{0}; position < right_rows_by_x.size(); ++position) {
+    sorted_right_x[position] = right_x[right_rows_by_x[position]];
+    x_positions[right_rows_by_x[position]] = position;
+  }
+
+  /**
+   * The left and the right rows sorted by y, in the order in which the right rows start to satisfy the second
+   * predicate for a left row. E.g., for left.y < right.y, these are the right rows with a larger y, so that the left
+   * rows are visited by descending y. Once a right row satisfies the predicate for a left row, it does so for all
+   * subsequent left rows.
+   */
+  const auto y_ascending = _secondary_predicate_condition == PredicateCondition::GreaterThan ||
+                           _secondary_predicate_condition == PredicateCondition::GreaterThanEquals;
+  const auto sort_by_y = [&](std::vector<size_t>& rows, const std::vector<size_t>& y) {
+    std::stable_sort(rows.begin(), rows.end(), [&](const auto lhs, const auto rhs) {
+      return y_ascending ? y[lhs] < y[rhs] : y[rhs] < y[lhs];
+    });
+  };
+  auto left_rows_by_y = valid_rows(left_x, left_y);
+  sort_by_y(left_rows_by_y, left_y);
+  auto right_rows_by_y = valid_rows(right_x, right_y);
+  sort_by_y(right_rows_by_y, right_y);
+
+  const auto satisfies_second_predicate = [&](const size_t left_y_rank, const size_t right_y_rank) {
+    switch (_secondary_predicate_condition) {
+      case PredicateCondition::LessThan:
+        return left_y_rank < right_y_rank;
+      case PredicateCondition::LessThanEquals:
+        return left_y_rank <= right_y_rank;
+      case PredicateCondition::GreaterThan:
+        return left_y_rank > right_y_rank;
+      default:
+        return left_y_rank >= right_y_rank;
+    }
+  };
+
+  // The range of positions in sorted_right_x that satisfy the first predicate for a left row
+  const auto x_range = [&](const size_t left_x_rank) -> std::pair<size_t, size_t> {
+    const auto lower_bound = static_cast<size_t>(
+        std::lower_bound(sorted_right_x.begin(), sorted_right_x.end(), left_x_rank) - sorted_right_x.begin());
+    const auto upper_bound = static_cast<size_t>(
+        std::upper_bound(sorted_right_x.begin(), sorted_right_x.end(), left_x_rank) - sorted_right_x.begin());
+    switch (_predicate_condition) {
+      case PredicateCondition::LessThan:
+        return {upper_bound, sorted_right_x.size()};
+      case PredicateCondition::LessThanEquals:
+        return {lower_bound, sorted_right_x.size()};
+      case PredicateCondition::GreaterThan:
+        return {0, lower_bound};
+      default:
+        return {0, upper_bound};
+    }
+  };
+
+  /**
+   * The marked right rows, by their position in sorted_right_x. A second level with one bit per word of the first one
+   * skips the unmarked words quickly, which matters while only a few right rows are marked.
+   */
+  auto marked_positions = std::vector<uint64_t>((sorted_right_x.size() + 63) / 64);
+  auto marked_words = std::vector<uint64_t>((marked_positions.size() + 63) / 64);
+
+  const auto left_row_ids = row_ids(*left_table);
+  const auto right_row_ids = row_ids(*right_table);
+  auto pos_list_left = std::make_shared<PosList>();
+  auto pos_list_right = std::make_shared<PosList>();
+
+  auto right_rows_by_y_iter = right_rows_by_y.begin();
+  for (const auto left_row : left_rows_by_y) {
+    while (right_rows_by_y_iter != right_rows_by_y.end() &&
+           satisfies_second_predicate(left_y[left_row], right_y[*right_rows_by_y_iter])) {
+      const auto position = x_positions[*right_rows_by_y_iter];
+      marked_positions[position / 64] |= uint64_t{1} << (position % 64);
+      marked_words[position / 4096] |= uint64_t{1} << ((position / 64) % 64);
+      ++right_rows_by_y_iter;
+    }
+
+    const auto [begin, end] = x_range(left_x[left_row]);
+    if (begin >= end) continue;
+
+    for_each_set_bit(marked_words, begin / 64, (end - 1) / 64 + 1, [&](const size_t word_index) {
+      const auto word_begin = std::max(begin, word_index * 64);
+      const auto word_end = std::min(end, word_index * 64 + 64);
+      for_each_set_bit(marked_positions, word_begin, word_end, [&](const size_t position) {
+        pos_list_left->emplace_back(left_row_ids[left_row]);
+        pos_list_right->emplace_back(right_row_ids[right_rows_by_x[position]]);
+      });
+    });
+  }
+
+  const auto output_table = _initialize_output_table();
+
+  const auto pos_lists_by_segment = [](const std::shared_ptr<const Table>& table) {
+    return table->type() == TableType::References ? setup_pos_lists_by_segment(table) : PosListsBySegment{};
+  };
+
+  Segments output_segments;
+  write_output_segments(output_segments, left_table, pos_lists_by_segment(left_table), pos_list_left);
+  write_output_segments(output_segments, right_table, pos_lists_by_segment(right_table), pos_list_right);
+  output_table->append_chunk(output_segments);
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This operator joins two tables on two inequality predicates (<, <=, >, >=) at once, e.g., for the interval join
+ * `a.ts >= b.start AND a.ts <= b.end`. It implements the IEJoin of Khayyat et al. ("Lightning Fast and Space Efficient
+ * Inequality Joins", VLDB 2015): The rows of the right input are sorted by the column of the first predicate, and
+ * positions in this order are marked in a bit array. The rows of the left input are visited in the order of the column
+ * of the second predicate, which makes the set of the right rows that satisfy the second predicate grow monotonically.
+ * Thus, each right row is marked once, and the matches of a left row are the marked bits in the range of the sorted
+ * right rows that satisfy the first predicate.
+ *
+ * In contrast to a JoinSortMerge or JoinNestedLoop on one of the predicates followed by a TableScan on the other, the
+ * intermediate result is not quadratic, and the memory is linear in the size of the inputs.
+ *
+ * The columns of each predicate need to have the same data type. Only inner joins are supported. NULLs never match.
+ */
+class JoinIE : public AbstractJoinOperator {
+ public:
+  JoinIE(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+         const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+         const ColumnIDPair& secondary_column_ids, const PredicateCondition secondary_predicate_condition);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const ColumnIDPair& secondary_column_ids() const;
+  PredicateCondition secondary_predicate_condition() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const ColumnIDPair _secondary_column_ids;
+  const PredicateCondition _secondary_predicate_condition;
+};
+
+}  // namespace opossum
@@ -1,8 +1,10 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -12,6 +14,7 @@
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -68,53 +71,80 @@ void JoinIndex::_perform_join() {
   _pos_list_left = std::make_shared<PosList>();
   _pos_list_right = std::make_shared<PosList>();
 
-  size_t worst_case = input_table_left()->row_count() * input_table_right()->row_count();
+  // Reserving the worst case of left * right rows would exhaust the memory for large inputs. Instead, we reserve space
+  // for one match per row of the larger input, which is what equi joins on keys produce.
+  const auto expected_match_count = std::max(input_table_left()->row_count(), input_table_right()->row_count());
 
-  _pos_list_left->reserve(worst_case);
-  _pos_list_right->reserve(worst_case);
+  _pos_list_left->reserve(expected_match_count);
+  _pos_list_right->reserve(expected_match_count);
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+  // A TableIndex on the right column covers all of its chunks, so that it is probed once per row of the left input
+  // instead of the indexes of all right chunks. A TableIndex holds the rows of a stored table, not of references to it.
+  const auto right_table_index = input_table_right()->type() == TableType::Data
+                                     ? input_table_right()->get_table_index(_column_ids.second)
+                                     : nullptr;
 
-    std::shared_ptr<BaseIndex> index = nullptr;
+  if (right_table_index) {
+    if (track_right_matches) {
+      for (ChunkID chunk_id_right{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+        _right_matches[chunk_id_right].resize(input_table_right()->get_chunk(chunk_id_right)->size());
+      }
+    }
 
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+      const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+      _join_probe_keys_using_table_index(_probe_keys(*segment_left), chunk_id_left, *right_table_index);
     }
+    performance_data.chunks_scanned_with_index += input_table_right()->chunk_count();
+  } else {
+    // The probe keys of a left chunk are used for the indexes of all right chunks, so they are only gathered once
+    auto left_probe_keys = std::vector<std::optional<ProbeKeys>>(input_table_left()->chunk_count());
+
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+
+      std::shared_ptr<BaseIndex> index = nullptr;
+
+      if (!indices.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        index = indices.front();
+      }
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          auto& probe_keys = left_probe_keys[chunk_id_left];
+          if (!probe_keys) {
+            probe_keys = _probe_keys(*input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first));
+          }
 
-        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
-        });
-      }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+          _join_probe_keys_using_index(*probe_keys, chunk_id_left, chunk_id_right, *index);
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right,
+                                                     params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
   }
 
@@ -161,60 +191,123 @@ void JoinIndex::_perform_join() {
   }
 }
 
-// join loop that joins two segments of two columns using an iterator for the left, and an index for the right
-template <typename LeftIterator>
-void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
-                                               const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index) {
-  for (; left_it != left_end; ++left_it) {
-    const auto left_value = *left_it;
-    if (left_value.is_null()) continue;
+JoinIndex::ProbeKeys JoinIndex::_probe_keys(const BaseSegment& segment) {
+  auto probe_keys = ProbeKeys{};
+
+  segment_with_iterators(segment, [&](auto it, const auto end) {
+    using ColumnDataType = std::decay_t<decltype(it->value())>;
+
+    auto rows = std::vector<std::pair<ColumnDataType, ChunkOffset>>{};
+    rows.reserve(segment.size());
+    for (; it != end; ++it) {
+      const auto position = *it;
+      if (!position.is_null()) rows.emplace_back(position.value(), position.chunk_offset());
+    }
+    std::sort(rows.begin(), rows.end());
+
+    probe_keys.chunk_offsets.reserve(rows.size());
+    for (auto row_idx = size_t{0}; row_idx < rows.size(); ++row_idx) {
+      if (row_idx == 0 || rows[row_idx - 1].first != rows[row_idx].first) {
+        probe_keys.values.emplace_back(rows[row_idx].first);
+        probe_keys.group_begins.emplace_back(row_idx);
+      }
+      probe_keys.chunk_offsets.emplace_back(rows[row_idx].second);
+    }
+    probe_keys.group_begins.emplace_back(rows.size());
+  });
+
+  return probe_keys;
+}
 
+// join loop that joins the probe keys of a left segment with the index of a right segment
+void JoinIndex::_join_probe_keys_using_index(const ProbeKeys& probe_keys, const ChunkID chunk_id_left,
+                                             const ChunkID chunk_id_right, const BaseIndex& index) {
+  for (auto group_idx = size_t{0}; group_idx < probe_keys.values.size(); ++group_idx) {
+    const auto& value = probe_keys.values[group_idx];
+
+    // NotEquals matches the values below and above the search value, all others match a single range
     auto range_begin = BaseIndex::Iterator{};
     auto range_end = BaseIndex::Iterator{};
+    auto second_range_begin = index.cend();
+    auto second_range_end = index.cend();
 
     switch (_predicate_condition) {
       case PredicateCondition::Equals: {
-        range_begin = index->lower_bound({left_value.value()});
-        range_end = index->upper_bound({left_value.value()});
+        range_begin = index.lower_bound({value});
+        range_end = index.upper_bound({value});
         break;
       }
       case PredicateCondition::NotEquals: {
-        // first, get all values less than the search value
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({left_value.value()});
-
-        _append_matches(range_begin, range_end, left_value.chunk_offset(), chunk_id_left, chunk_id_right);
-
-        // set range for second half to all values greater than the search value
-        range_begin = index->upper_bound({left_value.value()});
-        range_end = index->cend();
+        range_begin = index.cbegin();
+        range_end = index.lower_bound({value});
+        second_range_begin = index.upper_bound({value});
         break;
       }
       case PredicateCondition::GreaterThan: {
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({left_value.value()});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound({value});
         break;
       }
       case PredicateCondition::GreaterThanEquals: {
-        range_begin = index->cbegin();
-        range_end = index->upper_bound({left_value.value()});
+        range_begin = index.cbegin();
+        range_end = index.upper_bound({value});
         break;
       }
       case PredicateCondition::LessThan: {
-        range_begin = index->upper_bound({left_value.value()});
-        range_end = index->cend();
+        range_begin = index.upper_bound({value});
+        range_end = index.cend();
         break;
       }
       case PredicateCondition::LessThanEquals: {
-        range_begin = index->lower_bound({left_value.value()});
-        range_end = index->cend();
+        range_begin = index.lower_bound({value});
+        range_end = index.cend();
         break;
       }
       default:
         Fail("Unsupported comparison type encountered");
     }
 
-    _append_matches(range_begin, range_end, left_value.chunk_offset(), chunk_id_left, chunk_id_right);
+    for (auto row_idx = probe_keys.group_begins[group_idx]; row_idx < probe_keys.group_begins[group_idx + 1];
+         ++row_idx) {
+      const auto chunk_offset_left = probe_keys.chunk_offsets[row_idx];
+      _append_matches(range_begin, range_end, chunk_offset_left, chunk_id_left, chunk_id_right);
+      _append_matches(second_range_begin, second_range_end, chunk_offset_left, chunk_id_left, chunk_id_right);
+    }
+  }
+}
+
+// join loop that joins the probe keys of a left segment with the TableIndex of the right column
+void JoinIndex::_join_probe_keys_using_table_index(const ProbeKeys& probe_keys, const ChunkID chunk_id_left,
+                                                   const BaseTableIndex& table_index) {
+  // `left <predicate_condition> right` is `right <flipped predicate_condition> left`, which is what the index answers
+  const auto index_predicate_condition = flip_predicate_condition(_predicate_condition);
+  const auto right_chunk_count = static_cast<ChunkID>(_right_matches.size());
+
+  for (auto group_idx = size_t{0}; group_idx < probe_keys.values.size(); ++group_idx) {
+    auto right_row_ids = table_index.lookup(index_predicate_condition, probe_keys.values[group_idx]);
+
+    // Rows of chunks that were appended after the join started are not part of its input
+    right_row_ids.erase(std::remove_if(right_row_ids.begin(), right_row_ids.end(),
+                                       [&](const auto& row_id) { return row_id.chunk_id >= right_chunk_count; }),
+                        right_row_ids.end());
+    if (right_row_ids.empty()) continue;
+
+    if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+      for (const auto& row_id : right_row_ids) {
+        _right_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+      }
+    }
+
+    for (auto row_idx = probe_keys.group_begins[group_idx]; row_idx < probe_keys.group_begins[group_idx + 1];
+         ++row_idx) {
+      const auto chunk_offset_left = probe_keys.chunk_offsets[row_idx];
+      if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+        _left_matches[chunk_id_left][chunk_offset_left] = true;
+      }
+
+      std::fill_n(std::back_inserter(*_pos_list_left), right_row_ids.size(), RowID{chunk_id_left, chunk_offset_left});
+      _pos_list_right->insert(_pos_list_right->end(), right_row_ids.begin(), right_row_ids.end());
+    }
   }
 }
 
@@ -336,6 +429,11 @@ void JoinIndex::_on_cleanup() {
   _right_matches.clear();
 }
 
+std::vector<std::pair<std::string, size_t>> JoinIndex::PerformanceData::counts() const {
+  return {{"chunks_scanned_with_index", chunks_scanned_with_index},
+          {"chunks_scanned_without_index", chunks_scanned_without_index}};
+}
+
 std::string JoinIndex::PerformanceData::to_string(DescriptionMode description_mode) const {
   std::string string = OperatorPerformanceData::to_string(description_mode);
   string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
@@ -7,17 +7,22 @@
 #include <vector>
 
 #include "abstract_join_operator.hpp"
+#include "all_type_variant.hpp"
 #include "storage/index/base_index.hpp"
 #include "storage/pos_list.hpp"
 #include "types.hpp"
 
 namespace opossum {
+
+class BaseTableIndex;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. A TableIndex on the
+   *       right column is preferred over the indexes of its chunks.
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -32,6 +37,7 @@ class JoinIndex : public AbstractJoinOperator {
     size_t chunks_scanned_with_index{0};
     size_t chunks_scanned_without_index{0};
 
+    std::vector<std::pair<std::string, size_t>> counts() const override;
     std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
   };
 
@@ -45,9 +51,25 @@ class JoinIndex : public AbstractJoinOperator {
 
   void _perform_join();
 
-  template <typename LeftIterator>
-  void _join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
-                                      const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
+  /**
+   * The distinct non-NULL values of a left segment in ascending order, each with the offsets of the rows holding it.
+   * The index is thus looked up once per distinct value instead of once per row. As the values are sorted, the
+   * consecutive lookups mostly traverse the same nodes of the index, which are still cached from the previous one.
+   */
+  struct ProbeKeys {
+    std::vector<AllTypeVariant> values;
+    // The rows holding values[i] are at chunk_offsets[group_begins[i]] to chunk_offsets[group_begins[i + 1] - 1]
+    std::vector<size_t> group_begins;
+    std::vector<ChunkOffset> chunk_offsets;
+  };
+
+  static ProbeKeys _probe_keys(const BaseSegment& segment);
+
+  void _join_probe_keys_using_index(const ProbeKeys& probe_keys, const ChunkID chunk_id_left,
+                                    const ChunkID chunk_id_right, const BaseIndex& index);
+
+  void _join_probe_keys_using_table_index(const ProbeKeys& probe_keys, const ChunkID chunk_id_left,
+                                          const BaseTableIndex& table_index);
 
   template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   void _join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
@@ -317,7 +317,10 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     // The right side is not reshuffled and is worked on for each partition
     const auto right_cluster_id = cluster_number;
 
-    _output_pos_lists_left[left_node_id][left_cluster_id] = std::make_shared<PosList>();
+    // The output is written by a job on this cluster's node, so it is allocated there as well
+    const auto output_allocator = PosList::allocator_type{Topology::get().get_memory_resource(left_node_id)};
+
+    _output_pos_lists_left[left_node_id][left_cluster_id] = std::make_shared<PosList>(output_allocator);
 
     std::shared_ptr<MaterializedSegment<T>> left_cluster =
         (*_sorted_left_table)[left_node_id].materialized_segments[left_cluster_id];
@@ -325,7 +328,7 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     auto left_joined = std::vector<bool>(left_cluster->size(), false);
 
     for (auto right_node_id = NodeID{0}; right_node_id < static_cast<NodeID>(_cluster_count); ++right_node_id) {
-      _output_pos_lists_right[right_node_id][right_cluster_id] = std::make_shared<PosList>();
+      _output_pos_lists_right[right_node_id][right_cluster_id] = std::make_shared<PosList>(output_allocator);
 
       std::shared_ptr<MaterializedSegment<T>> right_cluster =
           (*_sorted_right_table)[right_node_id].materialized_segments[right_cluster_id];
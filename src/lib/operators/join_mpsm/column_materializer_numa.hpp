@@ -9,6 +9,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/materialize.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/numa_memory_resource.hpp"
@@ -167,16 +168,16 @@ class ColumnMaterializerNUMA {
 
     auto value_ids = segment.attribute_vector();
     auto dict = segment.dictionary();
+    const auto null_value_id = segment.null_value_id();
 
-    auto iterable = create_iterable_from_segment(segment);
-    iterable.for_each([&](const auto& position) {
-      const auto row_id = RowID{chunk_id, position.chunk_offset()};
-      if (position.is_null()) {
+    for_each_value_id(*value_ids, [&](const auto chunk_offset, const auto value_id) {
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      if (value_id == null_value_id) {
         if (_materialize_null) {
           null_rows_output->emplace_back(row_id);
         }
       } else {
-        output->emplace_back(row_id, position.value());
+        output->emplace_back(row_id, (*dict)[value_id]);
       }
     });
 
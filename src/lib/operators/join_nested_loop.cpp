@@ -1,5 +1,7 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -9,6 +11,10 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -52,15 +58,130 @@ void join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, Le
     }
   }
 }
+
+// The number of right values that a left value is compared with at a time, so that they stay in the L1 cache while
+// all values of the left segment are compared with them
+constexpr auto BLOCK_SIZE = size_t{2048};
+
+// The non-NULL values of a segment and their chunk offsets. NULLs never match, so they are left out.
+template <typename T>
+struct MaterializedSegment {
+  std::vector<T> values;
+  std::vector<ChunkOffset> chunk_offsets;
+};
+
+template <typename T>
+std::vector<MaterializedSegment<T>> materialize_column(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+  auto materialized_segments = std::vector<MaterializedSegment<T>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+      auto& materialized_segment = materialized_segments[chunk_id];
+      materialized_segment.values.reserve(segment.size());
+      materialized_segment.chunk_offsets.reserve(segment.size());
+
+      segment_iterate<T>(segment, [&](const auto& position) {
+        if (position.is_null()) return;
+        materialized_segment.values.emplace_back(position.value());
+        materialized_segment.chunk_offsets.emplace_back(position.chunk_offset());
+      });
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+  return materialized_segments;
+}
+
+// Compares every left value with a block of right values at a time. The comparisons of a left value with a block are
+// written to a mask without branching, so that the compiler can vectorize them for numeric types. Only the left values
+// with at least one match go over the mask again to emit them.
+template <typename BinaryFunctor, typename LeftType, typename RightType>
+void __attribute__((noinline))
+join_materialized_segments(const BinaryFunctor& func, const MaterializedSegment<LeftType>& left,
+                           const MaterializedSegment<RightType>& right, const ChunkID chunk_id_left,
+                           const ChunkID chunk_id_right, PosList& pos_list_left, PosList& pos_list_right) {
+  auto matches = std::array<uint8_t, BLOCK_SIZE>{};
+
+  const auto left_size = left.values.size();
+  const auto right_size = right.values.size();
+
+  for (auto block_begin = size_t{0}; block_begin < right_size; block_begin += BLOCK_SIZE) {
+    // Comparing all pairs of rows takes long, so the join stops early if the query is cancelled
+    CancellationToken::throw_if_current_cancelled();
+
+    const auto block_size = std::min(BLOCK_SIZE, right_size - block_begin);
+    const auto* const right_values = right.values.data() + block_begin;
+
+    for (auto left_index = size_t{0}; left_index < left_size; ++left_index) {
+      const auto& left_value = left.values[left_index];
+
+      auto match_count = size_t{0};
+      for (auto block_index = size_t{0}; block_index < block_size; ++block_index) {
+        matches[block_index] = func(left_value, right_values[block_index]);
+        match_count += matches[block_index];
+      }
+      if (match_count == 0) continue;
+
+      const auto left_row_id = RowID{chunk_id_left, left.chunk_offsets[left_index]};
+      for (auto block_index = size_t{0}; block_index < block_size; ++block_index) {
+        if (!matches[block_index]) continue;
+        pos_list_left.emplace_back(left_row_id);
+        pos_list_right.emplace_back(RowID{chunk_id_right, right.chunk_offsets[block_begin + block_index]});
+      }
+    }
+  }
+}
+
+// Joins each pair of a left and a right chunk in its own job. The matches of the pair (chunk_id_left, chunk_id_right)
+// are written to the position lists at chunk_id_left * right_table.chunk_count() + chunk_id_right.
+template <typename LeftType, typename RightType>
+void join_chunk_pairs(const Table& left_table, const ColumnID left_column_id, const Table& right_table,
+                      const ColumnID right_column_id, const PredicateCondition predicate_condition,
+                      std::vector<PosList>& pos_lists_left, std::vector<PosList>& pos_lists_right) {
+  const auto materialized_segments_left = materialize_column<LeftType>(left_table, left_column_id);
+  const auto materialized_segments_right = materialize_column<RightType>(right_table, right_column_id);
+
+  const auto left_chunk_count = left_table.chunk_count();
+  const auto right_chunk_count = right_table.chunk_count();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  for (ChunkID chunk_id_left{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+    const auto& materialized_segment_left = materialized_segments_left[chunk_id_left];
+    if (materialized_segment_left.values.empty()) continue;
+
+    for (ChunkID chunk_id_right{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      const auto& materialized_segment_right = materialized_segments_right[chunk_id_right];
+      if (materialized_segment_right.values.empty()) continue;
+
+      const auto pair_index = chunk_id_left * right_chunk_count + chunk_id_right;
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left, chunk_id_right, pair_index]() {
+        with_comparator(predicate_condition, [&](auto comparator) {
+          join_materialized_segments(comparator, materialized_segment_left, materialized_segment_right, chunk_id_left,
+                                     chunk_id_right, pos_lists_left[pair_index], pos_lists_right[pair_index]);
+        });
+      }));
+      jobs.back()->schedule();
+    }
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
 }  // namespace
 
 namespace opossum {
 
 /*
- * This is a Nested Loop Join implementation completely based on iterables.
- * It supports all current join and predicate conditions, as well as NULL values.
- * Because this is a Nested Loop Join, the performance is going to be far inferior to JoinHash and JoinSortMerge,
- * so only use this for testing or benchmarking purposes.
+ * This is a Nested Loop Join implementation that supports all current join and predicate conditions, as well as NULL
+ * values. It materializes the join columns and joins each pair of a left and a right chunk in its own job, so that all
+ * workers can help with the quadratic number of comparisons. Still, for equi joins, the performance is going to be
+ * far inferior to JoinHash and JoinSortMerge, so use it for non-equi joins, testing, or benchmarking purposes.
  */
 
 JoinNestedLoop::JoinNestedLoop(const std::shared_ptr<const AbstractOperator>& left,
@@ -155,27 +276,65 @@ void JoinNestedLoop::_perform_join() {
 
   _is_outer_join = (_mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::Outer);
 
-  // Scan all chunks from left input
-  _right_matches.resize(right_table->chunk_count());
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_table->chunk_count(); ++chunk_id_left) {
-    auto segment_left = left_table->get_chunk(chunk_id_left)->get_segment(left_column_id);
+  const auto left_chunk_count = left_table->chunk_count();
+  const auto right_chunk_count = right_table->chunk_count();
+
+  auto pos_lists_left = std::vector<PosList>(left_chunk_count * right_chunk_count);
+  auto pos_lists_right = std::vector<PosList>(left_chunk_count * right_chunk_count);
 
+  resolve_data_type(left_table->column_data_type(left_column_id), [&](const auto left_type) {
+    resolve_data_type(right_table->column_data_type(right_column_id), [&](const auto right_type) {
+      using LeftType = typename decltype(left_type)::type;
+      using RightType = typename decltype(right_type)::type;
+
+      constexpr auto LEFT_IS_STRING_COLUMN = (std::is_same<LeftType, std::string>{});
+      constexpr auto RIGHT_IS_STRING_COLUMN = (std::is_same<RightType, std::string>{});
+
+      if constexpr (LEFT_IS_STRING_COLUMN == RIGHT_IS_STRING_COLUMN) {
+        join_chunk_pairs<LeftType, RightType>(*left_table, left_column_id, *right_table, right_column_id,
+                                              _predicate_condition, pos_lists_left, pos_lists_right);
+      } else {
+        Fail("Cannot join String with non-String column");
+      }
+    });
+  });
+
+  // Merge the matches of all pairs of chunks, ordered by the left chunk
+  auto match_count = size_t{0};
+  for (const auto& pos_list_left : pos_lists_left) match_count += pos_list_left.size();
+  _pos_list_left->reserve(match_count);
+  _pos_list_right->reserve(match_count);
+
+  _right_matches.resize(right_chunk_count);
+  if (_mode == JoinMode::Outer) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      _right_matches[chunk_id_right].resize(right_table->get_chunk(chunk_id_right)->size());
+    }
+  }
+
+  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
     // for Outer joins, remember matches on the left side
     std::vector<bool> left_matches;
 
     if (_is_outer_join) {
-      left_matches.resize(segment_left->size());
+      left_matches.resize(left_table->get_chunk(chunk_id_left)->size());
     }
 
-    // Scan all chunks for right input
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
-      const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
-      _right_matches[chunk_id_right].resize(segment_right->size());
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      auto& pos_list_left = pos_lists_left[chunk_id_left * right_chunk_count + chunk_id_right];
+      auto& pos_list_right = pos_lists_right[chunk_id_left * right_chunk_count + chunk_id_right];
+
+      if (_is_outer_join) {
+        for (const auto& row_id : pos_list_left) left_matches[row_id.chunk_offset] = true;
+      }
+      if (_mode == JoinMode::Outer) {
+        for (const auto& row_id : pos_list_right) _right_matches[chunk_id_right][row_id.chunk_offset] = true;
+      }
 
-      const auto track_right_matches = (_mode == JoinMode::Outer);
-      JoinParams params{*_pos_list_left, *_pos_list_right,    left_matches, _right_matches[chunk_id_right],
-                        _is_outer_join,  track_right_matches, _mode,        _predicate_condition};
-      _join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+      _pos_list_left->insert(_pos_list_left->end(), pos_list_left.begin(), pos_list_left.end());
+      _pos_list_right->insert(_pos_list_right->end(), pos_list_right.begin(), pos_list_right.end());
+      pos_list_left = PosList{};
+      pos_list_right = PosList{};
     }
 
     if (_is_outer_join) {
@@ -192,7 +351,7 @@ void JoinNestedLoop::_perform_join() {
   // For Full Outer we need to add all unmatched rows for the right side.
   // Unmatched rows on the left side are already added in the main loop above
   if (_mode == JoinMode::Outer) {
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
       const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
 
       segment_iterate(*segment_right, [&](const auto& position) {
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -523,13 +524,22 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   }
 
   /**
-  * Performs the join on all clusters in parallel.
+  * Performs the join on all clusters in parallel. The largest clusters are scheduled first, so that the workers do not
+  * wait for a large cluster that was scheduled last.
   **/
   void _perform_join() {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
+    const auto cluster_size = [&](const size_t cluster_number) {
+      return (*_sorted_left_table)[cluster_number]->size() + (*_sorted_right_table)[cluster_number]->size();
+    };
+    auto cluster_numbers = std::vector<size_t>(_cluster_count);
+    std::iota(cluster_numbers.begin(), cluster_numbers.end(), size_t{0});
+    std::stable_sort(cluster_numbers.begin(), cluster_numbers.end(),
+                     [&](const auto lhs, const auto rhs) { return cluster_size(lhs) > cluster_size(rhs); });
+
     // Parallel join for each cluster
-    for (size_t cluster_number = 0; cluster_number < _cluster_count; ++cluster_number) {
+    for (const auto cluster_number : cluster_numbers) {
       // Create output position lists
       _output_pos_lists_left[cluster_number] = std::make_shared<PosList>();
       _output_pos_lists_right[cluster_number] = std::make_shared<PosList>();
@@ -647,7 +657,8 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     bool include_null_right = (_mode == JoinMode::Right || _mode == JoinMode::Outer);
     auto radix_clusterer = RadixClusterSort<T>(
         _sort_merge_join.input_table_left(), _sort_merge_join.input_table_right(), _sort_merge_join._column_ids,
-        _op == PredicateCondition::Equals, include_null_left, include_null_right, _cluster_count);
+        _op == PredicateCondition::Equals, include_null_left, include_null_right, _cluster_count,
+        _mode == JoinMode::Inner);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
     _sorted_left_table = std::move(sort_output.clusters_left);
@@ -7,10 +7,11 @@
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/materialize.hpp"
 #include "storage/segment_iterate.hpp"
-#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -52,6 +53,13 @@ class ColumnMaterializer {
  public:
   explicit ColumnMaterializer(bool sort, bool materialize_null) : _sort{sort}, _materialize_null{materialize_null} {}
 
+  // Whether the non-NULL values of the chunk are sorted ascending by the column (see Chunk::ordered_by())
+  static bool chunk_is_sorted_ascending(const Chunk& chunk, const ColumnID column_id) {
+    const auto& ordered_by = chunk.ordered_by();
+    return ordered_by && ordered_by->first == column_id &&
+           (ordered_by->second == OrderByMode::Ascending || ordered_by->second == OrderByMode::AscendingNullsLast);
+  }
+
  public:
   /**
    * Materializes and sorts all the chunks of an input table in parallel
@@ -101,13 +109,17 @@ class ColumnMaterializer {
                                                                   std::shared_ptr<const Table> input,
                                                                   const ColumnID column_id, Subsample<T>& subsample) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      auto segment = chunk->get_segment(column_id);
+
+      // Chunks that are sorted ascending by the column already do not need to be sorted again
+      const auto sort = _sort && !chunk_is_sorted_ascending(*chunk, column_id);
 
       if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
         (*output)[chunk_id] =
-            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample);
+            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample, sort);
       } else {
-        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample);
+        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample, sort);
       }
     });
   }
@@ -141,7 +153,7 @@ class ColumnMaterializer {
   std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(const BaseSegment& segment,
                                                                        const ChunkID chunk_id,
                                                                        std::unique_ptr<PosList>& null_rows_output,
-                                                                       Subsample<T>& subsample) {
+                                                                       Subsample<T>& subsample, const bool sort) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
@@ -156,7 +168,7 @@ class ColumnMaterializer {
       }
     });
 
-    if (_sort) {
+    if (sort) {
       std::sort(output.begin(), output.end(),
                 [](const auto& left, const auto& right) { return left.value < right.value; });
     }
@@ -172,14 +184,14 @@ class ColumnMaterializer {
   std::shared_ptr<MaterializedSegment<T>> _materialize_dictionary_segment(const DictionarySegment<T>& segment,
                                                                           const ChunkID chunk_id,
                                                                           std::unique_ptr<PosList>& null_rows_output,
-                                                                          Subsample<T>& subsample) {
+                                                                          Subsample<T>& subsample, const bool sort) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
     auto base_attribute_vector = segment.attribute_vector();
     auto dict = segment.dictionary();
 
-    if (_sort) {
+    if (sort) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
@@ -191,20 +203,13 @@ class ColumnMaterializer {
       }
 
       // Collect the rows for each value id
-      resolve_compressed_vector_type(*base_attribute_vector, [&](const auto& attribute_vector) {
-        auto chunk_offset = ChunkOffset{0u};
-        auto value_id_it = attribute_vector.cbegin();
-        auto null_value_id = segment.null_value_id();
-
-        for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
-          auto value_id = static_cast<ValueID>(*value_id_it);
-
-          if (value_id != null_value_id) {
-            rows_with_value[value_id].push_back(RowID{chunk_id, chunk_offset});
-          } else {
-            if (_materialize_null) {
-              null_rows_output->push_back(RowID{chunk_id, chunk_offset});
-            }
+      const auto null_value_id = segment.null_value_id();
+      for_each_value_id(*base_attribute_vector, [&](const auto chunk_offset, const auto value_id) {
+        if (value_id != null_value_id) {
+          rows_with_value[value_id].push_back(RowID{chunk_id, chunk_offset});
+        } else {
+          if (_materialize_null) {
+            null_rows_output->push_back(RowID{chunk_id, chunk_offset});
           }
         }
       });
@@ -218,15 +223,15 @@ class ColumnMaterializer {
         }
       }
     } else {
-      auto iterable = create_iterable_from_segment(segment);
-      iterable.for_each([&](const auto& position) {
-        const auto row_id = RowID{chunk_id, position.chunk_offset()};
-        if (position.is_null()) {
+      const auto null_value_id = segment.null_value_id();
+      for_each_value_id(*base_attribute_vector, [&](const auto chunk_offset, const auto value_id) {
+        const auto row_id = RowID{chunk_id, chunk_offset};
+        if (value_id == null_value_id) {
           if (_materialize_null) {
             null_rows_output->emplace_back(row_id);
           }
         } else {
-          output.emplace_back(row_id, position.value());
+          output.emplace_back(row_id, (*dict)[value_id]);
         }
       });
     }
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -30,6 +31,8 @@ struct RadixClusterOutput {
 * sorted in themselves but not in between the clusters. This is okay for the equi join, because we are only interested
 * in equality. In the case of a non-equi join however, complete sortedness is required, because join matches exist
 * beyond cluster borders. Therefore, the clustering defaults to a range clustering algorithm for the non-equi-join.
+* If the samples of the inputs show that radix clustering would put far more than its share of the values into one
+* cluster, e.g., for Zipfian join keys, the equi join is range clustered, too (see _equi_depth_cluster()).
 * General clustering process:
 * -> Input chunks are materialized and sorted. Every value is stored together with its row id.
 * -> Then, either radix clustering or range clustering is performed.
@@ -49,7 +52,7 @@ class RadixClusterSort {
  public:
   RadixClusterSort(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
                    const ColumnIDPair& column_ids, bool equi_case, const bool materialize_null_left,
-                   const bool materialize_null_right, size_t cluster_count)
+                   const bool materialize_null_right, size_t cluster_count, const bool replicate_heavy_hitters)
       : _input_table_left{left},
         _input_table_right{right},
         _left_column_id{column_ids.first},
@@ -57,7 +60,8 @@ class RadixClusterSort {
         _equi_case{equi_case},
         _cluster_count{cluster_count},
         _materialize_null_left{materialize_null_left},
-        _materialize_null_right{materialize_null_right} {
+        _materialize_null_right{materialize_null_right},
+        _replicate_heavy_hitters{replicate_heavy_hitters} {
     DebugAssert(cluster_count > 0, "cluster_count must be > 0");
     DebugAssert((cluster_count & (cluster_count - 1)) == 0, "cluster_count must be a power of two");
     DebugAssert(left != nullptr, "left input operator is null");
@@ -67,6 +71,29 @@ class RadixClusterSort {
   virtual ~RadixClusterSort() = default;
 
  protected:
+  // Radix clustering is considered skewed if the samples of a cluster exceed its share by this factor
+  static constexpr auto SKEW_FACTOR = size_t{2};
+
+  /**
+  * Where the clustering puts an entry: into the cluster with the cluster_id, or into the replica_count clusters from
+  * there on (wrapping around) if it is a heavy hitter of the input that is replicated.
+  **/
+  struct ClusterAssignment {
+    size_t cluster_id;
+    size_t replica_count;
+  };
+
+  /**
+  * A value that makes up more than the share of one cluster of the samples. Its entries of the larger input are spread
+  * over cluster_span clusters from first_cluster_id on and those of the smaller input are replicated to all of them.
+  **/
+  struct HeavyHitter {
+    T value;
+    size_t first_cluster_id;
+    size_t cluster_span;
+    bool spread_left;
+  };
+
   /**
   * The ChunkInformation structure is used to gather statistics regarding a chunk's values in order to
   * be able to appropriately reserve space for the clustering output.
@@ -118,6 +145,10 @@ class RadixClusterSort {
   bool _materialize_null_left;
   bool _materialize_null_right;
 
+  // Replicating the entries of heavy hitters is only correct for inner joins, as the replicas of an outer join would
+  // emit the rows without a match once per replica
+  bool _replicate_heavy_hitters;
+
   // Radix calculation for arithmetic types
   template <typename T2>
   static std::enable_if_t<std::is_arithmetic_v<T2>, uint32_t> get_radix(T2 value, size_t radix_bitmask) {
@@ -135,7 +166,7 @@ class RadixClusterSort {
   /**
   * Determines the total size of a materialized segment list.
   **/
-  static size_t _materialized_table_size(std::unique_ptr<MaterializedSegmentList<T>>& table) {
+  static size_t _materialized_table_size(const std::unique_ptr<MaterializedSegmentList<T>>& table) {
     size_t total_size = 0;
     for (auto chunk : *table) {
       total_size += chunk->size();
@@ -170,9 +201,12 @@ class RadixClusterSort {
   *    it will be inserting values in each cluster.
   * -> Reserve the appropriate space for each output cluster to avoid ongoing vector resizing.
   * -> At last, each value of each chunk is moved to the appropriate cluster.
+  * The clusterer returns the ClusterAssignment for a value and the position of its entry, i.e., its index in the chunk
+  * plus the chunk number.
   **/
+  template <typename Clusterer>
   std::unique_ptr<MaterializedSegmentList<T>> _cluster(const std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
-                                                       std::function<size_t(const T&)> clusterer) {
+                                                       const Clusterer& clusterer) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(_cluster_count);
     TableInformation table_information(input_chunks->size(), _cluster_count);
 
@@ -183,10 +217,12 @@ class RadixClusterSort {
       auto input_chunk = (*input_chunks)[chunk_number];
 
       // Count the number of entries for each cluster to be able to reserve the appropriate output space later.
-      auto job = std::make_shared<JobTask>([input_chunk, &clusterer, &chunk_information] {
-        for (auto& entry : *input_chunk) {
-          auto cluster_id = clusterer(entry.value);
-          ++chunk_information.cluster_histogram[cluster_id];
+      auto job = std::make_shared<JobTask>([this, chunk_number, input_chunk, &clusterer, &chunk_information] {
+        for (auto index = size_t{0}; index < input_chunk->size(); ++index) {
+          const auto assignment = clusterer((*input_chunk)[index].value, chunk_number + index);
+          for (auto replica = size_t{0}; replica < assignment.replica_count; ++replica) {
+            ++chunk_information.cluster_histogram[(assignment.cluster_id + replica) % _cluster_count];
+          }
         }
       });
 
@@ -213,15 +249,20 @@ class RadixClusterSort {
     // Move each entry into its appropriate cluster in parallel
     std::vector<std::shared_ptr<AbstractTask>> cluster_jobs;
     for (size_t chunk_number = 0; chunk_number < input_chunks->size(); ++chunk_number) {
-      auto job =
-          std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
+      auto job = std::make_shared<JobTask>(
+          [this, chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
             auto& chunk_information = table_information.chunk_information[chunk_number];
-            for (auto& entry : *(*input_chunks)[chunk_number]) {
-              auto cluster_id = clusterer(entry.value);
-              auto& output_cluster = *(*output_table)[cluster_id];
-              auto& insert_position = chunk_information.insert_position[cluster_id];
-              output_cluster[insert_position] = entry;
-              ++insert_position;
+            const auto& input_chunk = *(*input_chunks)[chunk_number];
+            for (auto index = size_t{0}; index < input_chunk.size(); ++index) {
+              const auto& entry = input_chunk[index];
+              const auto assignment = clusterer(entry.value, chunk_number + index);
+              for (auto replica = size_t{0}; replica < assignment.replica_count; ++replica) {
+                const auto cluster_id = (assignment.cluster_id + replica) % _cluster_count;
+                auto& output_cluster = *(*output_table)[cluster_id];
+                auto& insert_position = chunk_information.insert_position[cluster_id];
+                output_cluster[insert_position] = entry;
+                ++insert_position;
+              }
             }
           });
       cluster_jobs.push_back(job);
@@ -243,7 +284,105 @@ class RadixClusterSort {
   std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(
       std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
     auto radix_bitmask = _cluster_count - 1;
-    return _cluster(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+    return _cluster(input_chunks, [=](const T& value, const size_t) {
+      return ClusterAssignment{get_radix<T>(value, radix_bitmask), 1};
+    });
+  }
+
+  /**
+  * Whether radix clustering would put more than SKEW_FACTOR times its share of the @param sample_values into a
+  * cluster.
+  **/
+  bool _radix_clusters_are_skewed(const std::vector<T>& sample_values) const {
+    if (sample_values.empty()) return false;
+
+    const auto radix_bitmask = _cluster_count - 1;
+    auto cluster_histogram = std::vector<size_t>(_cluster_count);
+    for (const auto& value : sample_values) {
+      ++cluster_histogram[get_radix<T>(value, radix_bitmask)];
+    }
+
+    const auto largest_cluster_size = *std::max_element(cluster_histogram.begin(), cluster_histogram.end());
+    return largest_cluster_size * _cluster_count > SKEW_FACTOR * sample_values.size();
+  }
+
+  /**
+  * Range clusters the equi join by equi-depth split values of the samples, which balances the clusters however the
+  * values are distributed except for heavy hitters, values whose entries alone exceed a cluster. For inner joins, they
+  * are spread over several clusters: the entries of the input with more of them are distributed round-robin, while
+  * those of the other input are replicated to each of these clusters, so that every pair is joined in one cluster.
+  * For other joins, the heavy hitters stay in one cluster, as replicas would emit their rows without a match again.
+  **/
+  std::pair<std::unique_ptr<MaterializedSegmentList<T>>, std::unique_ptr<MaterializedSegmentList<T>>>
+  _equi_depth_cluster(const std::unique_ptr<MaterializedSegmentList<T>>& input_left,
+                      const std::unique_ptr<MaterializedSegmentList<T>>& input_right, std::vector<T> samples_left,
+                      std::vector<T> samples_right) {
+    std::sort(samples_left.begin(), samples_left.end());
+    std::sort(samples_right.begin(), samples_right.end());
+
+    auto sample_values = std::vector<T>{};
+    sample_values.reserve(samples_left.size() + samples_right.size());
+    std::merge(samples_left.begin(), samples_left.end(), samples_right.begin(), samples_right.end(),
+               std::back_inserter(sample_values));
+
+    // Find the heavy hitters in the sorted samples, which are left out when the split values are picked
+    auto heavy_hitters = std::vector<HeavyHitter>{};
+    auto regular_sample_values = std::vector<T>{};
+    regular_sample_values.reserve(sample_values.size());
+    const auto cluster_share = sample_values.size() / _cluster_count;
+    for (auto run_begin = sample_values.begin(); run_begin != sample_values.end();) {
+      const auto run_end = std::upper_bound(run_begin, sample_values.end(), *run_begin);
+      const auto run_length = static_cast<size_t>(std::distance(run_begin, run_end));
+      if (_replicate_heavy_hitters && run_length > std::max(cluster_share, size_t{1})) {
+        const auto cluster_span = std::min(_cluster_count, (run_length * _cluster_count) / sample_values.size() + 1);
+        heavy_hitters.push_back(HeavyHitter{*run_begin, 0, cluster_span, true});
+      } else {
+        regular_sample_values.insert(regular_sample_values.end(), run_begin, run_end);
+      }
+      run_begin = run_end;
+    }
+
+    const auto split_values = _pick_split_values(std::move(regular_sample_values));
+    const auto range_cluster_id = [&split_values](const T& value) {
+      return static_cast<size_t>(
+          std::distance(split_values.begin(), std::lower_bound(split_values.begin(), split_values.end(), value)));
+    };
+
+    // The input with more entries of a heavy hitter is spread, estimated by the share of the samples of each input
+    const auto left_size = static_cast<double>(_materialized_table_size(input_left));
+    const auto right_size = static_cast<double>(_materialized_table_size(input_right));
+    const auto estimated_count = [](const std::vector<T>& samples, const T& value, const double size) {
+      if (samples.empty()) return 0.0;
+      const auto [begin, end] = std::equal_range(samples.begin(), samples.end(), value);
+      return static_cast<double>(std::distance(begin, end)) / static_cast<double>(samples.size()) * size;
+    };
+    for (auto& heavy_hitter : heavy_hitters) {
+      heavy_hitter.first_cluster_id = range_cluster_id(heavy_hitter.value);
+      heavy_hitter.spread_left = estimated_count(samples_left, heavy_hitter.value, left_size) >=
+                                 estimated_count(samples_right, heavy_hitter.value, right_size);
+    }
+
+    const auto create_clusterer = [&](const bool is_left) {
+      return [&, is_left](const T& value, const size_t position) {
+        if (!heavy_hitters.empty()) {
+          const auto heavy_hitter =
+              std::lower_bound(heavy_hitters.begin(), heavy_hitters.end(), value,
+                               [](const auto& heavy_hitter, const auto& value) { return heavy_hitter.value < value; });
+          if (heavy_hitter != heavy_hitters.end() && heavy_hitter->value == value) {
+            if (heavy_hitter->spread_left == is_left) {
+              return ClusterAssignment{heavy_hitter->first_cluster_id + position % heavy_hitter->cluster_span, 1};
+            }
+            return ClusterAssignment{heavy_hitter->first_cluster_id, heavy_hitter->cluster_span};
+          }
+        }
+        return ClusterAssignment{range_cluster_id(value), 1};
+      };
+    };
+
+    auto output_left = _cluster(input_left, create_clusterer(true));
+    auto output_right = _cluster(input_right, create_clusterer(false));
+
+    return {std::move(output_left), std::move(output_right)};
   }
 
   /**
@@ -282,20 +421,12 @@ class RadixClusterSort {
       const std::unique_ptr<MaterializedSegmentList<T>>& input_right, std::vector<T> sample_values) {
     const std::vector<T> split_values = _pick_split_values(sample_values);
 
-    // Implements range clustering
-    auto cluster_count = _cluster_count;
-    auto clusterer = [cluster_count, &split_values](const T& value) {
-      // Find the first split value that is greater or equal to the entry.
-      // The split values are sorted in ascending order.
-      // Note: can we do this faster? (binary search?)
-      for (size_t cluster_id = 0; cluster_id < cluster_count - 1; ++cluster_id) {
-        if (value <= split_values[cluster_id]) {
-          return cluster_id;
-        }
-      }
-
-      // The value is greater than all split values, which means it belongs in the last cluster.
-      return cluster_count - 1;
+    // Implements range clustering: an entry belongs into the cluster of the first split value that is greater or equal
+    // to it, or into the last one if it is greater than all split values. There are fewer split values than clusters
+    // if the samples repeat values.
+    auto clusterer = [&split_values](const T& value, const size_t) {
+      const auto split_value = std::lower_bound(split_values.begin(), split_values.end(), value);
+      return ClusterAssignment{static_cast<size_t>(std::distance(split_values.begin(), split_value)), 1};
     };
 
     auto output_left = _cluster(input_left, clusterer);
@@ -304,12 +435,60 @@ class RadixClusterSort {
     return {std::move(output_left), std::move(output_right)};
   }
 
+  /**
+  * Whether all materialized chunks of the table are sorted, either because the materializer sorted them or because
+  * the chunks are sorted by the column already (see Chunk::ordered_by()).
+  **/
+  bool _materialized_chunks_are_sorted(const std::shared_ptr<const Table>& table, const ColumnID column_id) const {
+    if (!_equi_case) return true;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (!ColumnMaterializer<T>::chunk_is_sorted_ascending(*table->get_chunk(chunk_id), column_id)) return false;
+    }
+    return true;
+  }
+
+  /**
+  * Merges the sorted runs of a cluster. The clustering keeps the order of the values of each chunk, so a cluster of
+  * sorted chunks consists of at most one sorted run per chunk. The runs are found where the values decrease and are
+  * merged pairwise, which takes O(n log r) instead of O(n log n) for r runs.
+  **/
+  static void _merge_sorted_runs(MaterializedSegment<T>& cluster) {
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+
+    auto run_begins = std::vector<size_t>{0};
+    for (auto index = size_t{1}; index < cluster.size(); ++index) {
+      if (compare(cluster[index], cluster[index - 1])) run_begins.emplace_back(index);
+    }
+    run_begins.emplace_back(cluster.size());
+
+    while (run_begins.size() > 2) {
+      auto merged_run_begins = std::vector<size_t>{};
+      merged_run_begins.reserve(run_begins.size() / 2 + 1);
+
+      auto run_idx = size_t{0};
+      for (; run_idx + 2 < run_begins.size(); run_idx += 2) {
+        std::inplace_merge(cluster.begin() + run_begins[run_idx], cluster.begin() + run_begins[run_idx + 1],
+                           cluster.begin() + run_begins[run_idx + 2], compare);
+        merged_run_begins.emplace_back(run_begins[run_idx]);
+      }
+      if (run_idx + 1 < run_begins.size()) merged_run_begins.emplace_back(run_begins[run_idx]);
+      merged_run_begins.emplace_back(cluster.size());
+
+      run_begins = std::move(merged_run_begins);
+    }
+  }
+
   /**
   * Sorts all clusters of a materialized table.
   **/
-  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
+  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters, const bool chunks_are_sorted) {
     for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      if (chunks_are_sorted) {
+        _merge_sorted_runs(*cluster);
+      } else {
+        std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      }
     }
   }
 
@@ -330,26 +509,31 @@ class RadixClusterSort {
     output.null_rows_left = std::move(null_rows_left);
     output.null_rows_right = std::move(null_rows_right);
 
-    // Append right samples to left samples and sort (reserve not necessarity when insert can
-    // determined the new capacity from iterator: https://stackoverflow.com/a/35359472/1147726)
-    samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
+    // Append right samples to left samples (reserve not necessarity when insert can determined the new capacity from
+    // iterator: https://stackoverflow.com/a/35359472/1147726)
+    auto samples = samples_left;
+    samples.insert(samples.end(), samples_right.begin(), samples_right.end());
 
     if (_cluster_count == 1) {
       output.clusters_left = _concatenate_chunks(materialized_left_segments);
       output.clusters_right = _concatenate_chunks(materialized_right_segments);
-    } else if (_equi_case) {
+    } else if (_equi_case && !_radix_clusters_are_skewed(samples)) {
       output.clusters_left = _radix_cluster(materialized_left_segments);
       output.clusters_right = _radix_cluster(materialized_right_segments);
+    } else if (_equi_case) {
+      auto result = _equi_depth_cluster(materialized_left_segments, materialized_right_segments,
+                                        std::move(samples_left), std::move(samples_right));
+      output.clusters_left = std::move(result.first);
+      output.clusters_right = std::move(result.second);
     } else {
-      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left);
+      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples);
       output.clusters_left = std::move(result.first);
       output.clusters_right = std::move(result.second);
     }
 
-    // Sort each cluster (right now std::sort -> but maybe can be replaced with
-    // an more efficient algorithm, if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    // Sort each cluster. If the chunks are sorted, the sorted runs of the chunks only need to be merged.
+    _sort_clusters(output.clusters_left, _materialized_chunks_are_sorted(_input_table_left, _left_column_id));
+    _sort_clusters(output.clusters_right, _materialized_chunks_are_sorted(_input_table_right, _right_column_id));
 
     return output;
   }
@@ -24,24 +24,19 @@ std::shared_ptr<AbstractExpression> Limit::row_count_expression() const { return
 std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Limit>(copied_input_left, _row_count_expression->deep_copy());
+  return std::make_shared<Limit>(copied_input_left, expression_deep_copy_if_stateful(_row_count_expression));
 }
 
-std::shared_ptr<const Table> Limit::_on_execute() {
-  const auto input_table = input_table_left();
+bool Limit::is_pipeline_breaker() const { return false; }
 
-  /**
-   * Evaluate the _row_count_expression to determine the actual number of rows to "Limit" the output to
-   */
-  const auto num_rows_expression_result =
-      ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*_row_count_expression);
-  Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for Limit");
-  Assert(!num_rows_expression_result->is_null(0), "Expected non-null for Limit");
+bool Limit::needs_ordered_pipelined_chunks() const { return true; }
 
-  const auto signed_num_rows = num_rows_expression_result->value(0);
-  Assert(signed_num_rows >= 0, "Can't Limit to a negative number of Rows");
+bool Limit::pipelined_output_is_complete() const { return _remaining_row_count == 0; }
 
-  const auto num_rows = static_cast<size_t>(signed_num_rows);
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = input_table_left();
+
+  const auto num_rows = _evaluate_row_count();
 
   /**
    * Perform the actual limitting
@@ -51,38 +46,74 @@ std::shared_ptr<const Table> Limit::_on_execute() {
   ChunkID chunk_id{0};
   for (size_t i = 0; i < num_rows && chunk_id < input_table->chunk_count(); chunk_id++) {
     const auto input_chunk = input_table->get_chunk(chunk_id);
-    Segments output_segments;
 
     size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), num_rows - i);
 
-    for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
-      const auto input_base_segment = input_chunk->get_segment(column_id);
-      auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
-      std::shared_ptr<const Table> referenced_table;
-      ColumnID output_column_id = column_id;
-
-      if (auto input_ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_base_segment)) {
-        output_column_id = input_ref_segment->referenced_column_id();
-        referenced_table = input_ref_segment->referenced_table();
-        // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_segment->pos_list()->begin();
-        std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
-      } else {
-        referenced_table = input_table;
-        for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
-        }
-      }
+    i += output_chunk_row_count;
+    output_table->append_chunk(_limit_chunk(input_table, chunk_id, output_chunk_row_count));
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> Limit::_on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) {
+  _remaining_row_count = _evaluate_row_count();
+  return std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+}
 
-      output_segments.push_back(
-          std::make_shared<ReferenceSegment>(referenced_table, output_column_id, output_pos_list));
+void Limit::_on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) {
+  const auto input_table = input_table_left();
+
+  const auto output_chunk_row_count = std::min<size_t>(input_table->get_chunk(chunk_id)->size(), _remaining_row_count);
+  if (output_chunk_row_count == 0) return;
+
+  _remaining_row_count -= output_chunk_row_count;
+  output.set_pipelined_chunk(chunk_id, _limit_chunk(input_table, chunk_id, output_chunk_row_count));
+}
+
+size_t Limit::_evaluate_row_count() const {
+  /**
+   * Evaluate the _row_count_expression to determine the actual number of rows to "Limit" the output to
+   */
+  const auto num_rows_expression_result =
+      ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*_row_count_expression);
+  Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for Limit");
+  Assert(!num_rows_expression_result->is_null(0), "Expected non-null for Limit");
+
+  const auto signed_num_rows = num_rows_expression_result->value(0);
+  Assert(signed_num_rows >= 0, "Can't Limit to a negative number of Rows");
+
+  return static_cast<size_t>(signed_num_rows);
+}
+
+Segments Limit::_limit_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                             const size_t output_chunk_row_count) {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  Segments output_segments;
+
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
+    const auto input_base_segment = input_chunk->get_segment(column_id);
+    auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
+    std::shared_ptr<const Table> referenced_table;
+    ColumnID output_column_id = column_id;
+
+    if (auto input_ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_base_segment)) {
+      output_column_id = input_ref_segment->referenced_column_id();
+      referenced_table = input_ref_segment->referenced_table();
+      // TODO(all): optimize using whole chunk whenever possible
+      auto begin = input_ref_segment->pos_list()->begin();
+      std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
+    } else {
+      referenced_table = input_table;
+      for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
+        (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
     }
 
-    i += output_chunk_row_count;
-    output_table->append_chunk(output_segments);
+    output_segments.push_back(std::make_shared<ReferenceSegment>(referenced_table, output_column_id, output_pos_list));
   }
 
-  return output_table;
+  return output_segments;
 }
 
 void Limit::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
@@ -18,8 +18,16 @@ class Limit : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractExpression> row_count_expression() const;
 
+  bool is_pipeline_breaker() const override;
+  bool needs_ordered_pipelined_chunks() const override;
+  bool pipelined_output_is_complete() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) override;
+
+  void _on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -28,6 +36,15 @@ class Limit : public AbstractReadOnlyOperator {
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
 
  private:
+  size_t _evaluate_row_count() const;
+
+  // Returns the ReferenceSegments of the first @param output_chunk_row_count rows of the input chunk
+  static Segments _limit_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                               const size_t output_chunk_row_count);
+
   std::shared_ptr<AbstractExpression> _row_count_expression;
+
+  // The number of rows that a pipelined Limit still outputs
+  size_t _remaining_row_count{0};
 };
 }  // namespace opossum
@@ -2,19 +2,22 @@
 
 #include "operators/abstract_read_only_operator.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
 
 namespace opossum {
 
-// maintenance operator for the "CREATE TABLE" sql statement
+// maintenance operator for the "CREATE TABLE" sql statement, optionally with UNIQUE and PRIMARY KEY constraints
 class CreateTable : public AbstractReadOnlyOperator {
  public:
-  CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions);
+  CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+              const TableConstraintDefinitions& constraint_definitions = {});
 
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
   const std::string table_name;
   const TableColumnDefinitions column_definitions;
+  const TableConstraintDefinitions constraint_definitions;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -0,0 +1,276 @@
+#include "multi_column_sort.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Position and encoding of one sort column within the normalized key
+struct KeyColumn {
+  ColumnID column_id;
+  bool nullable;
+  bool nulls_first;
+  bool descending;
+  size_t offset;
+  size_t value_width;
+};
+
+template <typename T>
+void write_big_endian(const T bits, uint8_t* key) {
+  for (auto byte_idx = size_t{0}; byte_idx < sizeof(T); ++byte_idx) {
+    key[byte_idx] = static_cast<uint8_t>(bits >> (8 * (sizeof(T) - 1 - byte_idx)));
+  }
+}
+
+// Writes `value_width` bytes to `key`, so that memcmp on two encoded values orders them like operator< on the values
+template <typename T>
+void encode_value(const T& value, uint8_t* key, const size_t value_width) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Strings are padded with zeros, which places "ab" before "abc"
+    std::memcpy(key, value.data(), value.size());
+    std::memset(key + value.size(), 0, value_width - value.size());
+  } else if constexpr (std::is_integral_v<T>) {
+    using UnsignedType = std::make_unsigned_t<T>;
+    // Flipping the sign bit places negative values before positive ones
+    constexpr auto sign_bit = UnsignedType{1} << (sizeof(T) * 8 - 1);
+    write_big_endian(static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ sign_bit), key);
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Unexpected data type");
+    using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = UnsignedType{1} << (sizeof(T) * 8 - 1);
+
+    // -0.0 and 0.0 compare equal, so they need the same key
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = UnsignedType{};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+
+    // The larger the magnitude of a negative value, the smaller it is, so all of its bits are flipped. Setting the sign
+    // bit of positive values places them after the negative ones.
+    bits = (bits & sign_bit) ? static_cast<UnsignedType>(~bits) : static_cast<UnsignedType>(bits | sign_bit);
+    write_big_endian(bits, key);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+MultiColumnSort::MultiColumnSort(const std::shared_ptr<const AbstractOperator>& in,
+                                 const std::vector<ColumnID>& column_ids,
+                                 const std::vector<OrderByMode>& order_by_modes, const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::MultiColumnSort, in),
+      _column_ids(column_ids),
+      _order_by_modes(order_by_modes),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_column_ids.empty(), "Expected at least one sort column");
+  Assert(_column_ids.size() == _order_by_modes.size(), "Expected one OrderByMode per sort column");
+}
+
+const std::vector<ColumnID>& MultiColumnSort::column_ids() const { return _column_ids; }
+
+const std::vector<OrderByMode>& MultiColumnSort::order_by_modes() const { return _order_by_modes; }
+
+const std::string MultiColumnSort::name() const { return "MultiColumnSort"; }
+
+const std::string MultiColumnSort::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name();
+  for (auto sort_column_idx = size_t{0}; sort_column_idx < _column_ids.size(); ++sort_column_idx) {
+    stream << separator << "Column #" << _column_ids[sort_column_idx] << " "
+           << order_by_mode_to_string.at(_order_by_modes[sort_column_idx]);
+  }
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> MultiColumnSort::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<MultiColumnSort>(copied_input_left, _column_ids, _order_by_modes, _output_chunk_size);
+}
+
+void MultiColumnSort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> MultiColumnSort::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  // 1. Determine the layout of the normalized keys
+  auto key_columns = std::vector<KeyColumn>{};
+  auto key_width = size_t{0};
+  for (auto sort_column_idx = size_t{0}; sort_column_idx < _column_ids.size(); ++sort_column_idx) {
+    const auto column_id = _column_ids[sort_column_idx];
+    const auto order_by_mode = _order_by_modes[sort_column_idx];
+
+    auto key_column = KeyColumn{};
+    key_column.column_id = column_id;
+    key_column.nullable = input_table->column_is_nullable(column_id);
+    key_column.nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+    key_column.descending =
+        order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+    key_column.offset = key_width;
+
+    resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        auto max_length = size_t{0};
+        for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+          segment_iterate<ColumnDataType>(*input_table->get_chunk(chunk_id)->get_segment(column_id),
+                                          [&](const auto& position) {
+                                            if (position.is_null()) return;
+                                            max_length = std::max(max_length, position.value().size());
+                                          });
+        }
+        key_column.value_width = max_length;
+      } else {
+        key_column.value_width = sizeof(ColumnDataType);
+      }
+    });
+
+    key_width += (key_column.nullable ? 1 : 0) + key_column.value_width;
+    key_columns.emplace_back(key_column);
+  }
+
+  // 2. Encode the keys of all rows, one job per chunk
+  auto first_row_by_chunk = std::vector<size_t>(chunk_count);
+  auto row_count = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    first_row_by_chunk[chunk_id] = row_count;
+    row_count += input_table->get_chunk(chunk_id)->size();
+  }
+
+  auto row_ids = std::vector<RowID>(row_count);
+  auto keys = std::vector<uint8_t>(row_count * key_width);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto first_row = first_row_by_chunk[chunk_id];
+
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        row_ids[first_row + chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+
+      for (const auto& key_column : key_columns) {
+        resolve_data_type(input_table->column_data_type(key_column.column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+
+          segment_iterate<ColumnDataType>(*chunk->get_segment(key_column.column_id), [&](const auto& position) {
+            auto* key = keys.data() + (first_row + position.chunk_offset()) * key_width + key_column.offset;
+
+            if (key_column.nullable) {
+              *key = position.is_null() == key_column.nulls_first ? 0 : 1;
+              ++key;
+            }
+
+            // All NULLs of a column are equal, their value bytes stay zero
+            if (position.is_null()) return;
+
+            encode_value(position.value(), key, key_column.value_width);
+            if (key_column.descending) {
+              for (auto byte_idx = size_t{0}; byte_idx < key_column.value_width; ++byte_idx) {
+                key[byte_idx] = static_cast<uint8_t>(~key[byte_idx]);
+              }
+            }
+          });
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 3. Sort the rows by their keys. A stable sort keeps rows with equal keys in the order of the input.
+  auto permutation = std::vector<size_t>(row_count);
+  std::iota(permutation.begin(), permutation.end(), size_t{0});
+  std::stable_sort(permutation.begin(), permutation.end(), [&](const size_t lhs, const size_t rhs) {
+    return std::memcmp(keys.data() + lhs * key_width, keys.data() + rhs * key_width, key_width) < 0;
+  });
+
+  auto sorted_row_ids = std::vector<RowID>(row_count);
+  for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+    sorted_row_ids[row_idx] = row_ids[permutation[row_idx]];
+  }
+
+  return _materialize_output(sorted_row_ids);
+}
+
+std::shared_ptr<const Table> MultiColumnSort::_materialize_output(const std::vector<RowID>& row_ids) const {
+  const auto input_table = input_table_left();
+  auto output = std::make_shared<Table>(input_table->column_definitions(), TableType::Data, _output_chunk_size);
+
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+
+  const auto output_chunk_count = (row_ids.size() + _output_chunk_size - 1) / _output_chunk_size;
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count);
+
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto accessors = std::vector<std::unique_ptr<BaseSegmentAccessor<ColumnDataType>>>(input_table->chunk_count());
+
+      for (auto output_chunk_idx = size_t{0}; output_chunk_idx < output_chunk_count; ++output_chunk_idx) {
+        const auto begin_row_idx = output_chunk_idx * _output_chunk_size;
+        const auto end_row_idx = std::min(begin_row_idx + _output_chunk_size, row_ids.size());
+
+        auto values = pmr_concurrent_vector<ColumnDataType>(end_row_idx - begin_row_idx);
+        auto null_values = pmr_concurrent_vector<bool>(end_row_idx - begin_row_idx);
+
+        for (auto row_idx = begin_row_idx; row_idx < end_row_idx; ++row_idx) {
+          const auto [chunk_id, chunk_offset] = row_ids[row_idx];  // NOLINT
+          auto& accessor = accessors[chunk_id];
+          if (!accessor) {
+            accessor =
+                create_segment_accessor<ColumnDataType>(input_table->get_chunk(chunk_id)->get_segment(column_id));
+          }
+
+          const auto typed_value = accessor->access(chunk_offset);
+          null_values[row_idx - begin_row_idx] = !typed_value;
+          if (typed_value) values[row_idx - begin_row_idx] = *typed_value;
+        }
+
+        if (input_table->column_is_nullable(column_id)) {
+          output_segments_by_chunk[output_chunk_idx].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          output_segments_by_chunk[output_chunk_idx].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      }
+    });
+  }
+
+  for (const auto& segments : output_segments_by_chunk) {
+    output->append_chunk(segments);
+  }
+
+  return output;
+}
+
+}  // namespace opossum
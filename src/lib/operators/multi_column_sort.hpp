@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator to sort a table by multiple columns in a single pass ("ORDER BY a, b DESC, c"). The sort is stable.
+ *
+ * For every row, the values of all sort columns are encoded into one fixed-width, normalized key, so that comparing two
+ * keys with memcmp yields the order of the rows. Each column contributes (optionally) one byte for NULL ordering and
+ * the big-endian, order-preserving representation of its value, which is bit-inverted for descending columns. Strings
+ * are padded to the longest string of their column. The keys are encoded chunk by chunk in parallel and then sorted
+ * once, instead of running one stable Sort per column.
+ */
+class MultiColumnSort : public AbstractReadOnlyOperator {
+ public:
+  // The parameter output_chunk_size sets the chunk size of the output table, which will always be materialized
+  MultiColumnSort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+                  const std::vector<OrderByMode>& order_by_modes,
+                  const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
+
+  const std::vector<ColumnID>& column_ids() const;
+  const std::vector<OrderByMode>& order_by_modes() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  std::shared_ptr<const Table> _materialize_output(const std::vector<RowID>& row_ids) const;
+
+ private:
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<OrderByMode> _order_by_modes;
+  const size_t _output_chunk_size;
+};
+
+}  // namespace opossum
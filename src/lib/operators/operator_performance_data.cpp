@@ -1,13 +1,40 @@
 #include "operator_performance_data.hpp"
 
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 
 namespace opossum {
 
+std::vector<std::pair<std::string, std::chrono::nanoseconds>> OperatorPerformanceData::step_walltimes() const {
+  return {};
+}
+
+std::vector<std::pair<std::string, size_t>> OperatorPerformanceData::counts() const { return {}; }
+
 std::string OperatorPerformanceData::to_string(DescriptionMode description_mode) const {
-  return format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  auto string = format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  if (peak_memory_bytes > 0) string += ", " + format_bytes(peak_memory_bytes) + " peak memory";
+
+  const auto steps = step_walltimes();
+  for (auto step_idx = size_t{0}; step_idx < steps.size(); ++step_idx) {
+    if (step_idx == 0) {
+      string += description_mode == DescriptionMode::MultiLine ? "\n" : " (";
+    } else {
+      string += ", ";
+    }
+    string += steps[step_idx].first + ": " + format_duration(steps[step_idx].second);
+  }
+  if (!steps.empty() && description_mode == DescriptionMode::SingleLine) string += ")";
+
+  if (hardware_counters) {
+    string += description_mode == DescriptionMode::MultiLine ? "\n" : ", ";
+    string += hardware_counters->to_string();
+  }
+  return string;
 }
 
 }  // namespace opossum
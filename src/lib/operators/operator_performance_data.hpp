@@ -1,19 +1,43 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "types.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
-// For an example on how this can be extended on a per-operator basis, see JoinIndex
+// For examples on how this can be extended on a per-operator basis, see JoinIndex and JoinHash
 
 struct OperatorPerformanceData : public Noncopyable {
   virtual ~OperatorPerformanceData() = default;
 
   std::chrono::nanoseconds walltime{0};
 
+  // The row count of the output, which remains known after OperatorTasks cleared the output (see CardinalityFeedback)
+  std::optional<uint64_t> output_row_count;
+
+  // The peak size of the intermediate data that the operator allocated through its query_memory_resource()
+  size_t peak_memory_bytes{0};
+
+  // The total size of these allocations, including those that were freed again
+  size_t allocated_bytes{0};
+
+  // The events of the operator and its jobs, if hardware counters were collected (see HardwareCounters)
+  std::optional<HardwareCounters> hardware_counters;
+
+  /**
+   * Operator-specific measurements by name, which sub classes provide: The walltimes of the steps of the operator, in
+   * the order of execution, and other counts (e.g., of pruned chunks). The BenchmarkRunner sums them up per operator
+   * for its JSON report. to_string() lists the steps, sub classes describe their counts themselves.
+   */
+  virtual std::vector<std::pair<std::string, std::chrono::nanoseconds>> step_walltimes() const;
+  virtual std::vector<std::pair<std::string, size_t>> counts() const;
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
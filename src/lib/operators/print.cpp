@@ -194,6 +194,22 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) co
         segment_type += "FoR";
         break;
       }
+      case EncodingType::Delta: {
+        segment_type += "Dlt";
+        break;
+      }
+      case EncodingType::LZ4: {
+        segment_type += "LZ4";
+        break;
+      }
+      case EncodingType::FrontCodedDictionary: {
+        segment_type += "FCD";
+        break;
+      }
+      case EncodingType::ColumnGroup: {
+        segment_type += "CG";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
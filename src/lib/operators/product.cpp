@@ -1,11 +1,16 @@
 #include "product.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -30,19 +35,35 @@ std::shared_ptr<const Table> Product::_on_execute() {
 
   auto output = std::make_shared<Table>(column_definitions, TableType::References);
 
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-      _add_product_of_two_chunks(output, chunk_id_left, chunk_id_right);
+  const auto left_chunk_count = input_table_left()->chunk_count();
+  const auto right_chunk_count = input_table_right()->chunk_count();
+  output->create_chunk_slots(static_cast<size_t>(left_chunk_count) * right_chunk_count);
+
+  // The output grows quadratically, so the chunk pairs are processed in parallel. Cancelled queries skip the jobs that
+  // have not started yet, and CurrentScheduler::wait_for_tasks() then unwinds the operator.
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(static_cast<size_t>(left_chunk_count) * right_chunk_count);
+  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left, chunk_id_right]() {
+        CancellationToken::throw_if_current_cancelled();
+        output->set_chunk_slot(static_cast<size_t>(chunk_id_left) * right_chunk_count + chunk_id_right,
+                               _product_of_two_chunks(chunk_id_left, chunk_id_right));
+      }));
+      jobs.back()->schedule();
     }
   }
+  CurrentScheduler::wait_for_tasks(jobs);
+  output->append_chunk_slots();
 
   return output;
 }
 
-void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, ChunkID chunk_id_left,
-                                         ChunkID chunk_id_right) {
+Segments Product::_product_of_two_chunks(ChunkID chunk_id_left, ChunkID chunk_id_right) const {
   const auto chunk_left = input_table_left()->get_chunk(chunk_id_left);
   const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+  const auto left_size = static_cast<size_t>(chunk_left->size());
+  const auto right_size = static_cast<size_t>(chunk_right->size());
 
   // we use an approach here in which we do not have nested loops for left and right but create both sides separately
   // When the result looks like this:
@@ -62,10 +83,6 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
   auto is_left_side = true;
 
   for (const auto& chunk_in : {chunk_left, chunk_right}) {
-    // reusing the same code for left and right side - using a reference_wrapper is ugly, but better than code
-    // duplication
-    auto table = is_left_side ? input_table_left() : input_table_right();
-
     for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
       std::shared_ptr<const Table> referenced_table;
       ColumnID referenced_segment;
@@ -85,19 +102,27 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
       // gets updated accordingly
       auto& pos_list_out = (is_left_side ? calculated_pos_lists_left : calculated_pos_lists_right)[pos_list_in];
       if (!pos_list_out) {
-        // can't reuse
-        pos_list_out = std::make_shared<PosList>();
-        pos_list_out->reserve(chunk_left->size() * chunk_right->size());
-        for (size_t i = 0; i < chunk_left->size() * chunk_right->size(); ++i) {
-          // size_t is sufficient here, because ChunkOffset::max is 2^32 and (2^32 * 2^32 = 2^64)
-          auto offset = is_left_side ? static_cast<ChunkOffset>(i / chunk_right->size())
-                                     : static_cast<ChunkOffset>(i % chunk_right->size());
-          if (pos_list_in) {
-            pos_list_out->emplace_back((*pos_list_in)[offset]);
-          } else {
-            pos_list_out->emplace_back(RowID{is_left_side ? chunk_id_left : chunk_id_right, offset});
+        // can't reuse. size_t is sufficient here, because ChunkOffset::max is 2^32 and (2^32 * 2^32 = 2^64)
+        pos_list_out = std::make_shared<PosList>(left_size * right_size);
+        const auto chunk_id_in = is_left_side ? chunk_id_left : chunk_id_right;
+        const auto row_id_in = [&](const size_t offset) {
+          return pos_list_in ? (*pos_list_in)[offset] : RowID{chunk_id_in, static_cast<ChunkOffset>(offset)};
+        };
+
+        if (is_left_side) {
+          for (auto left_offset = size_t{0}; left_offset < left_size; ++left_offset) {
+            std::fill_n(pos_list_out->begin() + left_offset * right_size, right_size, row_id_in(left_offset));
+          }
+        } else if (left_size > 0) {
+          for (auto right_offset = size_t{0}; right_offset < right_size; ++right_offset) {
+            (*pos_list_out)[right_offset] = row_id_in(right_offset);
+          }
+          for (auto left_offset = size_t{1}; left_offset < left_size; ++left_offset) {
+            std::copy_n(pos_list_out->begin(), right_size, pos_list_out->begin() + left_offset * right_size);
           }
         }
+
+        if (!pos_list_in || pos_list_in->references_single_chunk()) pos_list_out->guarantee_single_chunk();
       }
       output_segments.push_back(std::make_shared<ReferenceSegment>(referenced_table, referenced_segment, pos_list_out));
     }
@@ -105,8 +130,9 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
     is_left_side = false;
   }
 
-  output->append_chunk(output_segments);
+  return output_segments;
 }
+
 std::shared_ptr<AbstractOperator> Product::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -14,6 +14,9 @@ namespace opossum {
  * Operator to calculate the cartesian product (unconditional join)
  * This is for demonstration purposes and for supporting the full relational algebra.
  *
+ * The output holds one chunk per pair of input chunks, in the order of the left chunks and then the right ones. The
+ * pairs are processed in parallel jobs.
+ *
  * Note: Product does not support null values at the moment
  */
 class Product : public AbstractReadOnlyOperator {
@@ -23,7 +26,7 @@ class Product : public AbstractReadOnlyOperator {
   const std::string name() const override;
 
  protected:
-  void _add_product_of_two_chunks(const std::shared_ptr<Table>& output, ChunkID chunk_id_left, ChunkID chunk_id_right);
+  Segments _product_of_two_chunks(ChunkID chunk_id_left, ChunkID chunk_id_right) const;
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -12,6 +12,9 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -25,7 +28,7 @@ const std::string Projection::name() const { return "Projection"; }
 std::shared_ptr<AbstractOperator> Projection::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Projection>(copied_input_left, expressions_deep_copy(expressions));
+  return std::make_shared<Projection>(copied_input_left, expressions_deep_copy_if_stateful(expressions));
 }
 
 void Projection::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
@@ -36,7 +39,50 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
   expressions_set_transaction_context(expressions, transaction_context);
 }
 
+bool Projection::is_pipeline_breaker() const { return false; }
+
 std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto output_table = _create_output_table();
+
+  /**
+   * Perform the projection, one job per chunk
+   */
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  // The output chunk ids match the input chunk ids
+  output_table->create_chunk_slots(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>(
+        [&, chunk_id]() { output_table->set_chunk_slot(chunk_id, _project_chunk(input_table, chunk_id)); }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  output_table->append_chunk_slots();
+
+  return output_table;
+}
+
+std::shared_ptr<Table> Projection::_on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) {
+  return _create_output_table();
+}
+
+void Projection::_on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) {
+  output.set_pipelined_chunk(chunk_id, _project_chunk(input_table_left(), chunk_id));
+}
+
+void Projection::_on_cleanup() {
+  _uncorrelated_select_results.reset();
+  _common_subexpressions.reset();
+}
+
+std::shared_ptr<Table> Projection::_create_output_table() {
   /**
    * Determine the TableColumnDefinitions
    */
@@ -54,38 +100,33 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   });
 
   const auto output_table_type = only_projects_columns ? input_table_left()->type() : TableType::Data;
-  const auto forward_columns = input_table_left()->type() == output_table_type;
+  _forward_columns = input_table_left()->type() == output_table_type;
+
+  _uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+  _common_subexpressions = ExpressionEvaluator::find_common_subexpressions(expressions);
 
-  const auto output_table =
-      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table_left()->has_mvcc());
+  return std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table_left()->has_mvcc());
+}
 
-  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+std::shared_ptr<Chunk> Projection::_project_chunk(const std::shared_ptr<const Table>& input_table,
+                                                  const ChunkID chunk_id) const {
+  auto output_segments = Segments{};
+  output_segments.reserve(expressions.size());
 
-  /**
-   * Perform the projection
-   */
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
-
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
-
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_select_results);
-    for (const auto& expression : expressions) {
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-      } else {
-        output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
-      }
-    }
+  const auto input_chunk = input_table->get_chunk(chunk_id);
 
-    output_table->append_chunk(output_segments);
-    output_table->get_chunk(chunk_id)->set_mvcc_data(input_chunk->mvcc_data());
+  ExpressionEvaluator evaluator(input_table, chunk_id, _uncorrelated_select_results, _common_subexpressions);
+  for (const auto& expression : expressions) {
+    // Forward input column if possible
+    if (expression->type == ExpressionType::PQPColumn && _forward_columns) {
+      const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+      output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+    } else {
+      output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+    }
   }
 
-  return output_table;
+  return std::make_shared<Chunk>(output_segments, input_chunk->mvcc_data());
 }
 
 // returns the singleton dummy table used for literal projections
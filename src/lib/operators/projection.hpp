@@ -12,6 +12,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
 
 namespace opossum {
 
@@ -45,14 +46,32 @@ class Projection : public AbstractReadOnlyOperator {
 
   const std::vector<std::shared_ptr<AbstractExpression>> expressions;
 
+  bool is_pipeline_breaker() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) override;
+
+  void _on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) override;
+
+  void _on_cleanup() override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+ private:
+  // Creates the empty output table and evaluates what the projection of all chunks has in common
+  std::shared_ptr<Table> _create_output_table();
+
+  std::shared_ptr<Chunk> _project_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const;
+
+  bool _forward_columns{false};
+  std::shared_ptr<const ExpressionEvaluator::UncorrelatedSelectResults> _uncorrelated_select_results;
+  std::shared_ptr<const ExpressionUnorderedSet> _common_subexpressions;
 };
 
 }  // namespace opossum
@@ -0,0 +1,177 @@
+#include "set_operation_steps.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "bytell_hash_map.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Runs @param function for each chunk of the @param table in parallel jobs
+template <typename Function>
+void for_each_chunk_in_parallel(const Table& table, const Function& function) {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { function(chunk_id); }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+// The values of a column, by chunk and chunk offset, with std::nullopt for NULLs
+template <typename T>
+using MaterializedColumn = std::vector<std::vector<std::optional<T>>>;
+
+// Materializes the column with the @param column_id of the @param table and combines its values into the
+// @param row_hashes
+template <typename T>
+std::shared_ptr<MaterializedColumn<T>> materialize_and_hash_column(const Table& table, const ColumnID column_id,
+                                                                   std::vector<std::vector<size_t>>& row_hashes) {
+  auto column = std::make_shared<MaterializedColumn<T>>(table.chunk_count());
+  for_each_chunk_in_parallel(table, [&](const ChunkID chunk_id) {
+    const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+    auto& values = (*column)[chunk_id];
+    auto& hashes = row_hashes[chunk_id];
+    values.resize(segment.size());
+
+    segment_iterate<T>(segment, [&](const auto& position) {
+      const auto chunk_offset = position.chunk_offset();
+      boost::hash_combine(hashes[chunk_offset], position.is_null());
+      if (position.is_null()) return;
+
+      values[chunk_offset] = position.value();
+      boost::hash_combine(hashes[chunk_offset], position.value());
+    });
+  });
+  return column;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::vector<std::vector<bool>> find_rows_in_table(const Table& probe_table, const Table& build_table) {
+  DebugAssert(probe_table.column_definitions() == build_table.column_definitions(),
+              "Input tables must have the same column definitions");
+
+  auto probe_hashes = std::vector<std::vector<size_t>>(probe_table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < probe_table.chunk_count(); ++chunk_id) {
+    probe_hashes[chunk_id].resize(probe_table.get_chunk(chunk_id)->size());
+  }
+  auto build_hashes = std::vector<std::vector<size_t>>(build_table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+    build_hashes[chunk_id].resize(build_table.get_chunk(chunk_id)->size());
+  }
+
+  // The typed columns are compared through a function per column, so that rows can be compared across all of them
+  using RowComparator = std::function<bool(const ChunkID, const ChunkOffset, const RowID&)>;
+  auto column_comparators = std::vector<RowComparator>{};
+  for (auto column_id = ColumnID{0}; column_id < probe_table.column_count(); ++column_id) {
+    resolve_data_type(probe_table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto probe_column = materialize_and_hash_column<ColumnDataType>(probe_table, column_id, probe_hashes);
+      const auto build_column = materialize_and_hash_column<ColumnDataType>(build_table, column_id, build_hashes);
+      column_comparators.emplace_back(
+          [probe_column, build_column](const ChunkID chunk_id, const ChunkOffset chunk_offset, const RowID& row_id) {
+            return (*probe_column)[chunk_id][chunk_offset] == (*build_column)[row_id.chunk_id][row_id.chunk_offset];
+          });
+    });
+  }
+
+  auto build_rows_by_hash = ska::bytell_hash_map<size_t, std::vector<RowID>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+    const auto& hashes = build_hashes[chunk_id];
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < hashes.size(); ++chunk_offset) {
+      build_rows_by_hash[hashes[chunk_offset]].emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  auto rows_found = std::vector<std::vector<bool>>(probe_table.chunk_count());
+  for_each_chunk_in_parallel(probe_table, [&](const ChunkID chunk_id) {
+    const auto& hashes = probe_hashes[chunk_id];
+    auto& chunk_rows_found = rows_found[chunk_id];
+    chunk_rows_found.resize(hashes.size());
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < hashes.size(); ++chunk_offset) {
+      const auto build_rows_iter = build_rows_by_hash.find(hashes[chunk_offset]);
+      if (build_rows_iter == build_rows_by_hash.end()) continue;
+
+      chunk_rows_found[chunk_offset] =
+          std::any_of(build_rows_iter->second.begin(), build_rows_iter->second.end(), [&](const RowID& row_id) {
+            return std::all_of(column_comparators.begin(), column_comparators.end(),
+                               [&](const auto& comparator) { return comparator(chunk_id, chunk_offset, row_id); });
+          });
+    }
+  });
+
+  return rows_found;
+}
+
+std::shared_ptr<Table> select_rows(const std::shared_ptr<const Table>& table,
+                                   const std::vector<std::vector<bool>>& row_selection) {
+  auto output = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  output->create_chunk_slots(table->chunk_count());
+
+  for_each_chunk_in_parallel(*table, [&](const ChunkID chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto& chunk_row_selection = row_selection[chunk_id];
+    if (std::none_of(chunk_row_selection.begin(), chunk_row_selection.end(), [](const bool selected) {
+          return selected;
+        })) {
+      return;
+    }
+
+    // Segments that share their position list in the input share it in the output as well
+    auto output_pos_lists = std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+    Segments output_segments;
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      auto referenced_table = table;
+      auto referenced_column_id = column_id;
+      auto input_pos_list = std::shared_ptr<const PosList>{};
+      if (const auto reference_segment =
+              std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))) {
+        referenced_table = reference_segment->referenced_table();
+        referenced_column_id = reference_segment->referenced_column_id();
+        input_pos_list = reference_segment->pos_list();
+      }
+
+      auto& output_pos_list = output_pos_lists[input_pos_list];
+      if (!output_pos_list) {
+        output_pos_list = std::make_shared<PosList>();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_row_selection.size(); ++chunk_offset) {
+          if (!chunk_row_selection[chunk_offset]) continue;
+          output_pos_list->emplace_back(input_pos_list ? (*input_pos_list)[chunk_offset]
+                                                       : RowID{chunk_id, chunk_offset});
+        }
+        if (!input_pos_list || input_pos_list->references_single_chunk()) output_pos_list->guarantee_single_chunk();
+      }
+
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list));
+    }
+
+    output->set_chunk_slot(chunk_id, output_segments);
+  });
+  output->append_chunk_slots();
+
+  return output;
+}
+
+}  // namespace opossum
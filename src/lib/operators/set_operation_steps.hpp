@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The steps of the set operators that compare the values of entire rows (Difference and Intersect).
+ *
+ * Both inputs are hashed row by row, chunk by chunk in parallel. The rows of the @param build_table are put into a hash
+ * table by their hashes, and each row of the @param probe_table is compared value by value with the rows that share
+ * its hash. NULLs are equal to NULLs, as it is the case for the set operations of SQL.
+ *
+ * @return Whether each row of the probe table, by chunk and chunk offset, has a row with the same values in the build
+ *         table. Both tables need to have the same column definitions.
+ */
+std::vector<std::vector<bool>> find_rows_in_table(const Table& probe_table, const Table& build_table);
+
+/**
+ * @return A reference table that holds the rows of the @param table for which @param row_selection is true,
+ *         one chunk per non-empty chunk of the input, whose position lists are shared between the segments that
+ *         shared them in the input (see TableScan)
+ */
+std::shared_ptr<Table> select_rows(const std::shared_ptr<const Table>& table,
+                                   const std::vector<std::vector<bool>>& row_selection);
+
+}  // namespace opossum
@@ -1,22 +1,37 @@
 #include "sort.hpp"
 
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <numeric>
+#include <queue>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/prefixed_string.hpp"
+#include "utils/temp_file_manager.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
            const size_t output_chunk_size)
-    : AbstractReadOnlyOperator(OperatorType::Sort, in),
+    : AbstractReadOnlyOperator(OperatorType::Sort, in, nullptr, std::make_unique<Sort::PerformanceData>()),
       _column_id(column_id),
       _order_by_mode(order_by_mode),
       _output_chunk_size(output_chunk_size) {}
@@ -37,13 +52,18 @@ void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVaria
 
 std::shared_ptr<const Table> Sort::_on_execute() {
   _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
+      input_table_left()->column_data_type(_column_id), input_table_left(),
+      static_cast<PerformanceData&>(*_performance_data), _column_id, _order_by_mode, _output_chunk_size,
+      query_memory_budget());
   return _impl->_on_execute();
 }
 
 void Sort::_on_cleanup() { _impl.reset(); }
 
+std::vector<std::pair<std::string, std::chrono::nanoseconds>> Sort::PerformanceData::step_walltimes() const {
+  return {{"materialization", materialization}, {"sort", sort}, {"output_writing", output_writing}};
+}
+
 // This class fulfills only the materialization task for a sorted row_id_value_vector.
 template <typename SortColumnType>
 class Sort::SortImplMaterializeOutput {
@@ -51,8 +71,11 @@ class Sort::SortImplMaterializeOutput {
   // creates a new table with reference segments
   SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
                             const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+                            const size_t output_chunk_size, const std::pair<ColumnID, OrderByMode>& ordered_by)
+      : _table_in(in),
+        _output_chunk_size(output_chunk_size),
+        _row_id_value_vector(id_value_map),
+        _ordered_by(ordered_by) {}
 
   std::shared_ptr<const Table> execute() {
     // First we create a new table as the output
@@ -60,6 +83,13 @@ class Sort::SortImplMaterializeOutput {
 
     // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
 
+    append_chunks(*output);
+    return output;
+  }
+
+  // Appends the rows to the @param output in chunks of the output chunk size. The external sort streams its output
+  // this way, one chunk at a time.
+  void append_chunks(Table& output) {
     // After we created the output table and initialized the column structure, we can start adding values. Because the
     // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
     // copied column by column for each output row. For each column in a row we visit the input segment with a reference
@@ -76,8 +106,9 @@ class Sort::SortImplMaterializeOutput {
     std::vector<Segments> output_segments_by_chunk(chunk_count_out);
 
     // Materialize segment-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_data_type(column_id);
+    for (ColumnID column_id{0u}; column_id < output.column_count(); ++column_id) {
+      CancellationToken::throw_if_current_cancelled();
+      const auto column_data_type = output.column_data_type(column_id);
 
       resolve_data_type(column_data_type, [&](auto type) {
         using ColumnDataType = typename decltype(type)::type;
@@ -145,30 +176,35 @@ class Sort::SortImplMaterializeOutput {
     }
 
     for (auto& segments : output_segments_by_chunk) {
-      output->append_chunk(segments);
+      output.append_chunk(segments);
+      output.get_chunk(static_cast<ChunkID>(output.chunk_count() - 1))->set_ordered_by(_ordered_by);
     }
-
-    return output;
   }
 
  protected:
   const std::shared_ptr<const Table> _table_in;
   const size_t _output_chunk_size;
   const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
+  const std::pair<ColumnID, OrderByMode> _ordered_by;
 };
 
 // we need to use the impl pattern because the scan operator of the sort depends on the type of the column
 template <typename SortColumnType>
 class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
  public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
+  // Strings are sorted as PrefixedStrings, so that most comparisons are decided without following a pointer
+  using SortKey = std::conditional_t<std::is_same_v<SortColumnType, std::string>, PrefixedString, SortColumnType>;
+  using RowIDValuePair = std::pair<RowID, SortKey>;
 
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
+  SortImpl(const std::shared_ptr<const Table>& table_in, PerformanceData& performance_data, const ColumnID column_id,
+           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0,
+           const size_t memory_budget = 0)
       : _table_in(table_in),
+        _performance_data(performance_data),
         _column_id(column_id),
         _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
+        _output_chunk_size(output_chunk_size),
+        _memory_budget(memory_budget) {
     // initialize a structure which can be sorted by std::sort
     _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
     _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
@@ -176,14 +212,28 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
  protected:
   std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
+    const auto ascending =
+        _order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast;
 
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
+    // 1-3. External path: If the materialized sort column exceeds the memory budget, sorted runs are written to disk
+    if (_memory_budget > 0 && _table_in->row_count() * sizeof(RowIDValuePair) > _memory_budget) {
+      return ascending ? _external_sort<std::less<>>() : _external_sort<std::greater<>>();
+    }
+
+    if (CurrentScheduler::is_set() && _table_in->chunk_count() > 1) {
+      // 1+2. Parallel path: Each chunk is materialized and sorted in its own job, the sorted runs are then merged
+      if (ascending) {
+        _materialize_and_sort_parallel<std::less<>>();
+      } else {
+        _materialize_and_sort_parallel<std::greater<>>();
+      }
     } else {
-      _sort_with_operator<std::greater<>>();
+      // 1+2. Prepare Sort: Creating rowid-value-Structure, sorted by the value of the pair
+      if (ascending) {
+        _materialize_and_sort<std::less<>>();
+      } else {
+        _materialize_and_sort<std::greater<>>();
+      }
     }
 
     // 2b. Insert null rows if necessary
@@ -199,50 +249,382 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
     // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
     // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    return materialization->execute();
+    auto timer = Timer{};
+    auto materialization = std::make_shared<SortImplMaterializeOutput<SortKey>>(
+        _table_in, _row_id_value_vector, _output_chunk_size, std::make_pair(_column_id, _order_by_mode));
+    const auto output = materialization->execute();
+    _performance_data.output_writing = timer.lap();
+    return output;
+  }
+
+  // Whether the values of the chunk are already ordered by the sort column in the direction of the Comparator. Where
+  // the NULLs are does not matter, as they are materialized separately.
+  template <typename Comparator>
+  bool _chunk_is_sorted(const Chunk& chunk) const {
+    const auto& ordered_by = chunk.ordered_by();
+    if (!ordered_by || ordered_by->first != _column_id) return false;
+
+    const auto ascending = ordered_by->second == OrderByMode::Ascending ||
+                           ordered_by->second == OrderByMode::AscendingNullsLast;
+    return ascending == std::is_same_v<Comparator, std::less<>>;
+  }
+
+  // The characters of long PrefixedStrings are allocated from the @param arena
+  static SortKey _sort_key(const SortColumnType& value, boost::container::pmr::memory_resource& arena) {
+    if constexpr (std::is_same_v<SortColumnType, std::string>) {
+      return PrefixedString{value, arena};
+    } else {
+      return value;
+    }
   }
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
+  /**
+   * Completely materializes the sort column to create a vector of RowID-Value pairs and sorts it. To skip the chunks
+   * that are already sorted, each chunk is sorted on its own and the sorted runs are merged afterwards.
+   */
+  template <typename Comparator>
+  void _materialize_and_sort() {
     auto& row_id_value_vector = *_row_id_value_vector;
     row_id_value_vector.reserve(_table_in->row_count());
 
     auto& null_value_rows = *_null_value_rows;
+    auto& string_arena = _string_arenas.emplace_back();
+
+    Comparator comparator;
+    const auto compare_values = [comparator](const auto& a, const auto& b) { return comparator(a.second, b.second); };
+
+    // The sorted runs are [run_begins[i], run_begins[i+1])
+    auto run_begins = std::vector<size_t>{};
+    run_begins.reserve(_table_in->chunk_count() + 1);
 
+    auto timer = Timer{};
     for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      CancellationToken::throw_if_current_cancelled();
       auto chunk = _table_in->get_chunk(chunk_id);
 
       auto base_segment = chunk->get_segment(_column_id);
 
+      const auto run_begin = row_id_value_vector.size();
       segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
         if (position.is_null()) {
-          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
+          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortKey{});
         } else {
-          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()},
+                                           _sort_key(position.value(), string_arena));
         }
       });
+
+      _performance_data.materialization += timer.lap();
+      if (run_begin == row_id_value_vector.size()) continue;
+      run_begins.emplace_back(run_begin);
+
+      if (!_chunk_is_sorted<Comparator>(*chunk)) {
+        std::stable_sort(row_id_value_vector.begin() + run_begin, row_id_value_vector.end(), compare_values);
+      }
+      _performance_data.sort += timer.lap();
+    }
+    run_begins.emplace_back(row_id_value_vector.size());
+
+    // Neighboring runs are merged until only one is left. inplace_merge takes the elements of the left run first on
+    // ties, so the sort remains stable.
+    while (run_begins.size() > 2) {
+      auto merged_run_begins = std::vector<size_t>{};
+      merged_run_begins.reserve(run_begins.size() / 2 + 1);
+
+      auto run_idx = size_t{0};
+      for (; run_idx + 2 < run_begins.size(); run_idx += 2) {
+        std::inplace_merge(row_id_value_vector.begin() + run_begins[run_idx],
+                           row_id_value_vector.begin() + run_begins[run_idx + 1],
+                           row_id_value_vector.begin() + run_begins[run_idx + 2], compare_values);
+        merged_run_begins.emplace_back(run_begins[run_idx]);
+      }
+      // An odd run out is simply moved to the next round
+      if (run_idx + 1 < run_begins.size()) merged_run_begins.emplace_back(run_begins[run_idx]);
+      merged_run_begins.emplace_back(row_id_value_vector.size());
+
+      run_begins = std::move(merged_run_begins);
     }
+    _performance_data.sort += timer.lap();
   }
 
+  /**
+   * Materializes and sorts every chunk in its own job and merges the resulting sorted runs pairwise until only one run
+   * is left. Runs are always merged with their neighbor and, on ties, elements of the left run are taken first. Thus,
+   * the sort remains stable. To keep all workers busy even when only a few (large) runs are left, each merge is split
+   * into independent parts (see _schedule_merge). The jobs of a cancelled query are skipped, in which case
+   * wait_for_tasks() throws (see CancellationToken).
+   */
   template <typename Comparator>
-  void _sort_with_operator() {
+  void _materialize_and_sort_parallel() {
+    const auto chunk_count = _table_in->chunk_count();
+
+    auto runs = std::vector<std::vector<RowIDValuePair>>(chunk_count);
+    auto null_value_rows_by_chunk = std::vector<std::vector<RowIDValuePair>>(chunk_count);
+    auto materialization_by_chunk = std::vector<std::chrono::nanoseconds>(chunk_count);
+    auto sort_by_chunk = std::vector<std::chrono::nanoseconds>(chunk_count);
+
+    // Each job allocates from its own arena, created before the jobs so that they do not modify _string_arenas
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) _string_arenas.emplace_back();
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& run = runs[chunk_id];
+        auto& null_value_rows = null_value_rows_by_chunk[chunk_id];
+        auto& string_arena = _string_arenas[chunk_id];
+        auto timer = Timer{};
+
+        const auto chunk = _table_in->get_chunk(chunk_id);
+        run.reserve(chunk->size());
+
+        segment_iterate<SortColumnType>(*chunk->get_segment(_column_id), [&](const auto& position) {
+          if (position.is_null()) {
+            null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortKey{});
+          } else {
+            run.emplace_back(RowID{chunk_id, position.chunk_offset()}, _sort_key(position.value(), string_arena));
+          }
+        });
+
+        materialization_by_chunk[chunk_id] = timer.lap();
+        if (_chunk_is_sorted<Comparator>(*chunk)) return;
+
+        Comparator comparator;
+        std::stable_sort(run.begin(), run.end(),
+                         [comparator](const auto& a, const auto& b) { return comparator(a.second, b.second); });
+        sort_by_chunk[chunk_id] = timer.lap();
+      }));
+      jobs.back()->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+    auto timer = Timer{};
+
+    _performance_data.materialization =
+        std::accumulate(materialization_by_chunk.begin(), materialization_by_chunk.end(), std::chrono::nanoseconds{0});
+    _performance_data.sort =
+        std::accumulate(sort_by_chunk.begin(), sort_by_chunk.end(), std::chrono::nanoseconds{0});
+
+    // NULLs are not sorted among each other, so we only need to preserve the order of the input
+    for (const auto& null_value_rows : null_value_rows_by_chunk) {
+      _null_value_rows->insert(_null_value_rows->end(), null_value_rows.begin(), null_value_rows.end());
+    }
+
+    while (runs.size() > 1) {
+      auto merged_runs = std::vector<std::vector<RowIDValuePair>>((runs.size() + 1) / 2);
+      jobs.clear();
+
+      for (auto run_idx = size_t{0}; run_idx + 1 < runs.size(); run_idx += 2) {
+        _schedule_merge<Comparator>(runs[run_idx], runs[run_idx + 1], merged_runs[run_idx / 2], jobs);
+      }
+
+      // An odd run out is simply moved to the next round
+      if (runs.size() % 2 == 1) merged_runs.back() = std::move(runs.back());
+
+      CurrentScheduler::wait_for_tasks(jobs);
+      runs = std::move(merged_runs);
+    }
+
+    *_row_id_value_vector = std::move(runs.front());
+    _performance_data.sort += timer.lap();
+  }
+
+  /**
+   * Merges two sorted runs into `output`. The output is partitioned into ranges of MERGE_PARTITION_SIZE elements. For
+   * each range, the "merge path" (i.e., how many elements of the left and the right run end up in the output before
+   * the range starts) is found by a binary search. Thus, the ranges can be merged independently from each other.
+   */
+  template <typename Comparator>
+  void _schedule_merge(const std::vector<RowIDValuePair>& left, const std::vector<RowIDValuePair>& right,
+                       std::vector<RowIDValuePair>& output, std::vector<std::shared_ptr<AbstractTask>>& jobs) {
+    static constexpr auto MERGE_PARTITION_SIZE = size_t{65'536};
+
+    output.resize(left.size() + right.size());
+
+    // Returns the number of elements from the left run that are among the first `output_offset` merged elements
+    const auto merge_path = [&](const size_t output_offset) {
+      Comparator comparator;
+      auto low = output_offset > right.size() ? output_offset - right.size() : size_t{0};
+      auto high = std::min(output_offset, left.size());
+      while (low < high) {
+        const auto left_offset = (low + high) / 2;
+        const auto right_offset = output_offset - left_offset;
+        // On ties, the left element is merged first
+        if (right_offset > 0 && !comparator(right[right_offset - 1].second, left[left_offset].second)) {
+          low = left_offset + 1;
+        } else {
+          high = left_offset;
+        }
+      }
+      return low;
+    };
+
+    for (auto output_begin = size_t{0}; output_begin < output.size(); output_begin += MERGE_PARTITION_SIZE) {
+      const auto output_end = std::min(output_begin + MERGE_PARTITION_SIZE, output.size());
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, merge_path, output_begin, output_end]() {
+        const auto left_begin = merge_path(output_begin);
+        const auto left_end = merge_path(output_end);
+        const auto right_begin = output_begin - left_begin;
+        const auto right_end = output_end - left_end;
+
+        Comparator comparator;
+        std::merge(left.begin() + left_begin, left.begin() + left_end, right.begin() + right_begin,
+                   right.begin() + right_end, output.begin() + output_begin,
+                   [comparator](const auto& a, const auto& b) { return comparator(a.second, b.second); });
+      }));
+      jobs.back()->schedule();
+    }
+  }
+
+  /**
+   * Sorts a sort column that does not fit into the memory budget. The input is materialized into runs that take half
+   * of the budget each. Every run is sorted and written to a TempFile. Then, all runs are merged at once (k-way), with
+   * a buffered TempFileReader per run, and the output is materialized chunk by chunk. Thus, neither the materialized
+   * sort column nor the sorted RowIDs are in memory as a whole. The NULL rows are kept in memory, as only their RowIDs
+   * are needed. The runs keep the values as SortColumnType, as they are written to the TempFiles anyway.
+   */
+  template <typename Comparator>
+  std::shared_ptr<const Table> _external_sort() {
+    using ExternalRowIDValuePair = std::pair<RowID, SortColumnType>;
+
+    const auto run_budget = std::max(_memory_budget / 2, size_t{1});
+
     Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+    const auto compare_values = [comparator](const auto& a, const auto& b) { return comparator(a.second, b.second); };
+
+    auto runs = std::vector<std::unique_ptr<TempFile>>{};
+    auto run = std::vector<ExternalRowIDValuePair>{};
+    auto run_bytes = size_t{0};
+
+    // The runs are materialized and sorted in turns. Writing them to their TempFiles counts towards sorting.
+    auto timer = Timer{};
+    const auto spill_run = [&]() {
+      _performance_data.materialization += timer.lap();
+      std::stable_sort(run.begin(), run.end(), compare_values);
+
+      runs.emplace_back(TempFileManager::get().create_file());
+      auto writer = TempFileWriter{*runs.back()};
+      for (const auto& [row_id, value] : run) {
+        writer.write(row_id);
+        writer.write(value);
+      }
+      writer.flush();
+
+      run.clear();
+      run_bytes = 0;
+      _performance_data.sort += timer.lap();
+    };
+
+    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      CancellationToken::throw_if_current_cancelled();
+      const auto chunk = _table_in->get_chunk(chunk_id);
+
+      segment_iterate<SortColumnType>(*chunk->get_segment(_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          _null_value_rows->emplace_back(RowID{chunk_id, position.chunk_offset()}, SortKey{});
+          return;
+        }
+
+        run.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+        run_bytes += sizeof(ExternalRowIDValuePair);
+        if constexpr (std::is_same_v<SortColumnType, std::string>) run_bytes += run.back().second.size();
+
+        if (run_bytes >= run_budget) spill_run();
+      });
+    }
+    if (!run.empty()) spill_run();
+    run = {};
+    _performance_data.materialization += timer.lap();
+
+    // The k-way merge is interleaved with materializing the output, so it counts towards writing the output
+
+    // The next value of each run. On ties, the value of the earlier run (i.e., the earlier row of the input) is merged
+    // first, so that the sort remains stable. priority_queue returns the greatest element, hence the reversed order.
+    using RunHead = std::pair<ExternalRowIDValuePair, size_t>;
+    const auto merged_later = [comparator](const RunHead& a, const RunHead& b) {
+      if (comparator(b.first.second, a.first.second)) return true;
+      if (comparator(a.first.second, b.first.second)) return false;
+      return a.second > b.second;
+    };
+    auto run_heads = std::priority_queue<RunHead, std::vector<RunHead>, decltype(merged_later)>{merged_later};
+
+    const auto reader_buffer_size = std::max(run_budget / std::max(runs.size(), size_t{1}), size_t{4'096});
+    auto readers = std::vector<TempFileReader>{};
+    readers.reserve(runs.size());
+
+    const auto read_run_head = [&](const size_t run_idx) {
+      auto& reader = readers[run_idx];
+      if (reader.at_end()) return;
+
+      auto run_head = RunHead{ExternalRowIDValuePair{}, run_idx};
+      reader.read(run_head.first.first);
+      reader.read(run_head.first.second);
+      run_heads.push(std::move(run_head));
+    };
+
+    for (auto run_idx = size_t{0}; run_idx < runs.size(); ++run_idx) {
+      readers.emplace_back(*runs[run_idx], 0, runs[run_idx]->size(), reader_buffer_size);
+      read_run_head(run_idx);
+    }
+
+    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+    _row_id_value_vector->reserve(_output_chunk_size);
+
+    // Only the RowIDs of the output rows are needed to materialize it
+    const auto emit_row = [&](const RowID& row_id) {
+      _row_id_value_vector->emplace_back(row_id, SortKey{});
+      if (_row_id_value_vector->size() < _output_chunk_size) return;
+
+      CancellationToken::throw_if_current_cancelled();
+      SortImplMaterializeOutput<SortKey>{_table_in, _row_id_value_vector, _output_chunk_size,
+                                         std::make_pair(_column_id, _order_by_mode)}
+          .append_chunks(*output);
+      _row_id_value_vector->clear();
+    };
+    const auto emit_null_value_rows = [&]() {
+      for (const auto& null_value_row : *_null_value_rows) emit_row(null_value_row.first);
+    };
+
+    const auto nulls_last =
+        _order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast;
+    if (!nulls_last) emit_null_value_rows();
+
+    while (!run_heads.empty()) {
+      const auto run_head = run_heads.top();
+      run_heads.pop();
+      emit_row(run_head.first.first);
+      read_run_head(run_head.second);
+    }
+
+    if (nulls_last) emit_null_value_rows();
+
+    // The last chunk is not full
+    SortImplMaterializeOutput<SortKey>{_table_in, _row_id_value_vector, _output_chunk_size,
+                                       std::make_pair(_column_id, _order_by_mode)}
+        .append_chunks(*output);
+
+    _performance_data.output_writing = timer.lap();
+    return output;
   }
 
   const std::shared_ptr<const Table> _table_in;
+  PerformanceData& _performance_data;
 
   // column to sort by
   const ColumnID _column_id;
   const OrderByMode _order_by_mode;
   // chunk size of the materialized output
   const size_t _output_chunk_size;
+  // bytes the materialized sort column may take before it is sorted externally, 0 if unlimited
+  const size_t _memory_budget;
 
   std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
   std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
+
+  // The characters of the PrefixedStrings in _row_id_value_vector, one arena per concurrently materialized run
+  std::deque<boost::container::pmr::monotonic_buffer_resource> _string_arenas;
 };
 
 }  // namespace opossum
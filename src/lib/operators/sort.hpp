@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
@@ -17,7 +18,18 @@ namespace opossum {
 /**
  * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
  * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * To sort by multiple columns, use MultiColumnSort.
+ *
+ * If a scheduler is active, the chunks are materialized and sorted in parallel, and the sorted runs are merged with a
+ * parallel, stable merge afterwards.
+ *
+ * If the materialized sort column exceeds the memory budget of the query (see AbstractOperator::query_memory_budget()),
+ * it is sorted externally: Sorted runs are written to temporary files (see TempFileManager) and merged at once, while
+ * the output is materialized chunk by chunk.
+ *
+ * The walltimes of the steps of the sort are recorded in its PerformanceData. In the parallel path, the chunks are
+ * materialized and sorted concurrently, so the walltimes of these steps are summed up over the chunks (plus the merges
+ * for the sort step) and may exceed the walltime of the operator.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -30,6 +42,14 @@ class Sort : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  struct PerformanceData : public OperatorPerformanceData {
+    std::chrono::nanoseconds materialization{0};
+    std::chrono::nanoseconds sort{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> step_walltimes() const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
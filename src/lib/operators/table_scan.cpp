@@ -1,5 +1,6 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -16,23 +17,36 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
+#include "expression/pqp_select_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "operators/get_table.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/index_tuner.hpp"
 #include "storage/proxy_chunk.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
+#include "table_scan/column_in_hash_set_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/conjunction_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
@@ -42,12 +56,15 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in}, _predicate(predicate) {}
+    : AbstractReadOnlyOperator{OperatorType::TableScan, in, nullptr, std::make_unique<TableScan::PerformanceData>()},
+      _predicate(predicate) {}
 
 void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
 
 const std::shared_ptr<AbstractExpression>& TableScan::predicate() const { return _predicate; }
 
+const std::vector<ChunkID>& TableScan::pruned_chunk_ids() const { return _pruned_chunk_ids; }
+
 const std::string TableScan::name() const { return "TableScan"; }
 
 const std::string TableScan::description(DescriptionMode description_mode) const {
@@ -73,105 +90,302 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
+  return std::make_shared<TableScan>(copied_input_left, expression_deep_copy_if_stateful(_predicate));
+}
+
+bool TableScan::is_pipeline_breaker() const {
+  // The excluded ChunkIDs refer to the complete input table, which only exists if the input is executed on its own
+  return !_excluded_chunk_ids.empty();
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
   const auto in_table = input_table_left();
+  const auto output_table = _prepare_execution();
+
+  // Each job writes the output chunk for its input chunk into its own slot, so that no locking is needed and the
+  // output chunks are in the order of the input chunks
+  output_table->create_chunk_slots(in_table->chunk_count());
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  auto chunk_sizes = std::vector<size_t>{};
+  chunk_ids.reserve(in_table->chunk_count());
+  chunk_sizes.reserve(in_table->chunk_count());
+
+  for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    if (_skip_chunk(*in_table, chunk_id)) continue;
+
+    chunk_ids.emplace_back(chunk_id);
+    chunk_sizes.emplace_back(in_table->get_chunk(chunk_id)->size());
+  }
+
+  MorselDispatcher{chunk_sizes}.run([&](const size_t chunk_index) {
+    const auto chunk_id = chunk_ids[chunk_index];
+    const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
+    const auto out_segments = _scan_chunk(in_table, chunk_id);
+    if (out_segments.empty()) return;
+
+    // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+    // towards the original chunk.
+    output_table->set_chunk_slot(chunk_id, _create_output_chunk(*chunk_guard, out_segments));
+  });
+
+  output_table->append_chunk_slots();
+
+  // Single-column predicates on stored tables are those that the IndexScanRule can use an index for
+  if (const auto get_table = std::dynamic_pointer_cast<const GetTable>(input_left())) {
+    if (_execution_pruning_predicates.size() == 1 && !std::dynamic_pointer_cast<LogicalExpression>(_predicate)) {
+      IndexTuner::get().record_scan(get_table->table_name(), _execution_pruning_predicates.front().column_id,
+                                    in_table->row_count(), output_table->row_count());
+    }
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> TableScan::_on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) {
+  return _prepare_execution();
+}
+
+void TableScan::_on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) {
+  const auto in_table = input_table_left();
+  if (_skip_chunk(*in_table, chunk_id)) return;
+
+  const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
+  const auto out_segments = _scan_chunk(in_table, chunk_id);
+  if (out_segments.empty()) return;
+
+  output.set_pipelined_chunk(chunk_id, _create_output_chunk(*chunk_guard, out_segments));
+}
+
+std::shared_ptr<Chunk> TableScan::_create_output_chunk(const std::shared_ptr<const Chunk>& in_chunk,
+                                                       const Segments& out_segments) {
+  const auto out_chunk =
+      std::make_shared<Chunk>(out_segments, nullptr, in_chunk->get_allocator(), in_chunk->access_counter());
+
+  // The matches are in the order of the input rows, so the output is sorted like the input
+  if (in_chunk->ordered_by()) out_chunk->set_ordered_by(*in_chunk->ordered_by());
+
+  return out_chunk;
+}
 
-  const auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+std::shared_ptr<Table> TableScan::_prepare_execution() {
+  const auto in_table = input_table_left();
 
   _impl = create_impl();
   _impl_description = _impl->description();
 
-  std::mutex output_mutex;
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  performance_data.impl_description = _impl_description;
+  performance_data.chunks_scanned = 0;
+  performance_data.chunks_pruned = 0;
+  performance_data.chunks_excluded = 0;
 
-  const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
+  _excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  /**
+   * The ChunkPruningRule can only exclude chunks if the values of the predicate are known during optimization. For
+   * prepared statements and correlated parameters, they are only known now, so the chunks are pruned here. Only data
+   * tables are pruned, as the statistics and dictionaries of referenced chunks say nothing about the referenced rows.
+   */
+  _execution_pruning_predicates = in_table->type() == TableType::Data ? _pruning_predicates(_predicate)
+                                                                        : std::vector<PruningPredicate>{};
+  _pruned_chunk_ids.clear();
 
-  for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
-
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      Segments out_segments;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        const auto chunk_in = in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
-
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
-
-          const auto pos_list_in = ref_segment_in->pos_list();
-
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
-            }
-
-            size_t offset = 0;
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
-              ++offset;
-            }
-          }
-
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+}
+
+bool TableScan::_skip_chunk(const Table& in_table, const ChunkID chunk_id) {
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  if (_excluded_chunk_set.count(chunk_id)) {
+    ++performance_data.chunks_excluded;
+    return true;
+  }
+
+  if (_execution_pruning_predicates.empty() ||
+      !_can_prune_chunk(*in_table.get_chunk(chunk_id), _execution_pruning_predicates)) {
+    ++performance_data.chunks_scanned;
+    return false;
+  }
+  ++performance_data.chunks_pruned;
+
+  // In a pipeline, chunks are pruned in parallel
+  const auto lock = std::lock_guard<std::mutex>{_pruned_chunk_ids_mutex};
+  _pruned_chunk_ids.emplace_back(chunk_id);
+  return true;
+}
+
+Segments TableScan::_scan_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id) const {
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = _impl->scan_chunk(chunk_id);
+  if (matches_out->empty()) return {};
+
+  Segments out_segments;
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+   * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between segments as much as possible. Position lists can be shared between two segments iff
+   * (a) they point to the same table and
+   * (b) the reference segments of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
+
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto segment_in = chunk_in->get_segment(column_id);
+
+      auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+      DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
+
+      const auto pos_list_in = ref_segment_in->pos_list();
+
+      const auto table_out = ref_segment_in->referenced_table();
+      const auto column_id_out = ref_segment_in->referenced_column_id();
+
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>(matches_out->size());
+        if (pos_list_in->references_single_chunk()) {
+          filtered_pos_list->guarantee_single_chunk();
         }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+
+        size_t offset = 0;
+        for (const auto& match : *matches_out) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          (*filtered_pos_list)[offset] = row_id;
+          ++offset;
         }
       }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  } else {
+    matches_out->guarantee_single_chunk();
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
+
+  return out_segments;
+}
+
+std::vector<TableScan::PruningPredicate> TableScan::_pruning_predicates(
+    const std::shared_ptr<AbstractExpression>& predicate) {
+  auto pruning_predicates = std::vector<PruningPredicate>{};
+
+  // Non-null values of the data type of the column. Values of other types would have to be cast for the lookups in the
+  // dictionary, which may change the result of the comparison (e.g., `int_column < 2.5`).
+  const auto get_value = [](const AbstractExpression& expression,
+                            const PQPColumnExpression& column) -> std::optional<AllTypeVariant> {
+    const auto value = expression_get_value_or_parameter(expression);
+    if (!value || variant_is_null(*value) || data_type_from_all_type_variant(*value) != column.data_type()) {
+      return std::nullopt;
+    }
+    return value;
+  };
+
+  for (const auto& conjunct : flatten_logical_expressions(predicate, LogicalOperator::And)) {
+    if (const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(conjunct)) {
+      const auto predicate_condition = binary_predicate->predicate_condition;
+      if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+          predicate_condition != PredicateCondition::LessThan &&
+          predicate_condition != PredicateCondition::LessThanEquals &&
+          predicate_condition != PredicateCondition::GreaterThan &&
+          predicate_condition != PredicateCondition::GreaterThanEquals) {
+        continue;
+      }
 
-    jobs.push_back(job_task);
-    job_task->schedule();
+      // Predicate pattern: <column> <condition> <value> or <value> <condition> <column>
+      if (const auto column = std::dynamic_pointer_cast<PQPColumnExpression>(binary_predicate->left_operand())) {
+        if (const auto value = get_value(*binary_predicate->right_operand(), *column)) {
+          pruning_predicates.emplace_back(PruningPredicate{column->column_id, predicate_condition, *value, {}});
+        }
+      } else if (const auto column =
+                     std::dynamic_pointer_cast<PQPColumnExpression>(binary_predicate->right_operand())) {
+        if (const auto value = get_value(*binary_predicate->left_operand(), *column)) {
+          pruning_predicates.emplace_back(
+              PruningPredicate{column->column_id, flip_predicate_condition(predicate_condition), *value, {}});
+        }
+      }
+    } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(conjunct)) {
+      // Predicate pattern: <column> BETWEEN <value> AND <value>
+      if (const auto column = std::dynamic_pointer_cast<PQPColumnExpression>(between_expression->value())) {
+        const auto lower_bound = get_value(*between_expression->lower_bound(), *column);
+        const auto upper_bound = get_value(*between_expression->upper_bound(), *column);
+        if (lower_bound && upper_bound) {
+          pruning_predicates.emplace_back(
+              PruningPredicate{column->column_id, PredicateCondition::Between, *lower_bound, *upper_bound});
+        }
+      }
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  return pruning_predicates;
+}
+
+bool TableScan::_can_prune_chunk(const Chunk& chunk, const std::vector<PruningPredicate>& pruning_predicates) {
+  const auto chunk_statistics = chunk.statistics();
 
-  return output_table;
+  // As the predicates are a conjunction, the chunk can be skipped if a single one of them matches no row
+  for (const auto& [column_id, predicate_condition, value, value2] : pruning_predicates) {
+    if (chunk_statistics && chunk_statistics->can_prune(column_id, predicate_condition, value, value2)) return true;
+
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk.get_segment(column_id));
+    if (!dictionary_segment) continue;
+
+    // A dictionary without entries means that the segment holds nothing but NULLs, which never match
+    if (dictionary_segment->unique_values_count() == 0) return true;
+
+    // lower_bound() and upper_bound() return INVALID_VALUE_ID if all dictionary entries are smaller (or equal)
+    const auto lower_bound = dictionary_segment->lower_bound(value);
+    const auto upper_bound = dictionary_segment->upper_bound(value);
+
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        if (lower_bound == upper_bound) return true;
+        break;
+      case PredicateCondition::NotEquals:
+        if (dictionary_segment->unique_values_count() == 1 && lower_bound == ValueID{0} &&
+            upper_bound == INVALID_VALUE_ID) {
+          return true;
+        }
+        break;
+      case PredicateCondition::LessThan:
+        if (lower_bound == ValueID{0}) return true;
+        break;
+      case PredicateCondition::LessThanEquals:
+        if (upper_bound == ValueID{0}) return true;
+        break;
+      case PredicateCondition::GreaterThan:
+        if (upper_bound == INVALID_VALUE_ID) return true;
+        break;
+      case PredicateCondition::GreaterThanEquals:
+        if (lower_bound == INVALID_VALUE_ID) return true;
+        break;
+      case PredicateCondition::Between:
+        // No dictionary entry lies within [value, value2]
+        if (lower_bound == dictionary_segment->upper_bound(*value2)) return true;
+        break;
+      default:
+        break;
+    }
+  }
+
+  return false;
 }
 
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
-    const std::shared_ptr<AbstractExpression>& predicate) {
+    const std::shared_ptr<AbstractExpression>& predicate,
+    const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results) {
   // If the predicate has an uncorrelated subquery as an argument, we resolve that subquery first. That way, we can
   // use, e.g., a regular ColumnVsValueTableScanImpl instead of the ExpressionEvaluator. That is faster. We do not care
   // about subqueries that are deeper within the expression tree, because we would need the ExpressionEvaluator for
@@ -184,15 +398,20 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
     return predicate;
   }
 
+  // The other arguments are not copied, so that the subqueries within them are still found in the
+  // uncorrelated_select_results
   const auto new_predicate = predicate->deep_copy();
-  for (auto& argument : new_predicate->arguments) {
+  for (auto argument_idx = size_t{0}; argument_idx < predicate->arguments.size(); ++argument_idx) {
+    auto& argument = new_predicate->arguments[argument_idx];
+    argument = predicate->arguments[argument_idx];
     const auto subquery = std::dynamic_pointer_cast<PQPSelectExpression>(argument);
     if (!subquery || subquery->is_correlated()) continue;
 
     auto subquery_result = AllTypeVariant{};
     resolve_data_type(subquery->data_type(), [&](const auto data_type_t) {
       using ColumnDataType = typename decltype(data_type_t)::type;
-      auto expression_result = ExpressionEvaluator{}.evaluate_expression_to_result<ColumnDataType>(*subquery);
+      auto expression_result = ExpressionEvaluator{uncorrelated_select_results}  // NOLINT
+                                   .evaluate_expression_to_result<ColumnDataType>(*subquery);
       Assert(expression_result->size() == 1, "Expected subquery to return a single row");
       if (!expression_result->is_null(0)) {
         subquery_result = AllTypeVariant{expression_result->value(0)};
@@ -204,7 +423,62 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
   return new_predicate;
 }
 
+std::optional<std::vector<AllTypeVariant>> TableScan::_resolve_in_set(
+    const InExpression& in_expression, const DataType column_data_type,
+    const UncorrelatedSelectResults& uncorrelated_select_results) {
+  if (const auto list_expression = std::dynamic_pointer_cast<ListExpression>(in_expression.set())) {
+    auto values = std::vector<AllTypeVariant>{};
+    values.reserve(list_expression->elements().size());
+
+    // The elements may be literals or parameters that have been set, as in prepared statements
+    for (const auto& element : list_expression->elements()) {
+      const auto value = expression_get_value_or_parameter(*element);
+      if (!value) return std::nullopt;
+
+      // Mixed data types (e.g., `int_column IN (1, 2.5)`) are left to the ExpressionEvaluator
+      if (!variant_is_null(*value) && data_type_from_all_type_variant(*value) != column_data_type) {
+        return std::nullopt;
+      }
+      values.emplace_back(*value);
+    }
+
+    return values;
+  }
+
+  const auto subquery = std::dynamic_pointer_cast<PQPSelectExpression>(in_expression.set());
+  if (!subquery || subquery->is_correlated() || subquery->data_type() != column_data_type) return std::nullopt;
+
+  const auto subquery_result = uncorrelated_select_results.at(subquery->pqp);
+  Assert(subquery_result->column_count() == 1, "Expected subquery of IN to return a single column");
+
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(subquery_result->row_count());
+
+  resolve_data_type(column_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < subquery_result->chunk_count(); ++chunk_id) {
+      segment_iterate<ColumnDataType>(*subquery_result->get_chunk(chunk_id)->get_segment(ColumnID{0}),
+                                      [&](const auto& position) {
+                                        if (position.is_null()) {
+                                          values.emplace_back(NullValue{});
+                                        } else {
+                                          values.emplace_back(position.value());
+                                        }
+                                      });
+    }
+  });
+
+  return values;
+}
+
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+  return _create_impl(_predicate, ExpressionEvaluator::populate_uncorrelated_select_results_cache({_predicate}));
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(
+    const std::shared_ptr<AbstractExpression>& predicate,
+    const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results) const {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -212,7 +486,25 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    * an expression.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  // Predicate pattern: <predicate> AND <predicate> AND ...
+  const auto conjunction = flatten_logical_expressions(predicate, LogicalOperator::And);
+  if (conjunction.size() > 1) {
+    auto impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+    impls.reserve(conjunction.size());
+    for (const auto& conjunct : conjunction) {
+      impls.emplace_back(_create_impl(conjunct, uncorrelated_select_results));
+    }
+
+    // The predicates are expected to be ordered by their selectivity. Still, the ExpressionEvaluator is so much more
+    // expensive per row than the dedicated impls that the predicates falling back to it are evaluated last, on the rows
+    // that are left.
+    std::stable_partition(impls.begin(), impls.end(), [](const auto& impl) {
+      return !dynamic_cast<const ExpressionEvaluatorTableScanImpl*>(impl.get());
+    });
+    return std::make_unique<ConjunctionTableScanImpl>(input_table_left(), std::move(impls));
+  }
+
+  auto resolved_predicate = _resolve_uncorrelated_subqueries(predicate, uncorrelated_select_results);
 
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
@@ -295,10 +587,43 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     }
   }
 
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(resolved_predicate)) {
+    // Predicate pattern: <column> [NOT] IN <list of literals / uncorrelated subquery>
+    if (const auto left_column = std::dynamic_pointer_cast<PQPColumnExpression>(in_expression->value())) {
+      const auto values = _resolve_in_set(*in_expression, left_column->data_type(), *uncorrelated_select_results);
+      if (values) {
+        return std::make_unique<ColumnInHashSetTableScanImpl>(input_table_left(), left_column->column_id,
+                                                              in_expression->predicate_condition, *values);
+      }
+    }
+  }
+
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), resolved_predicate);
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), resolved_predicate,
+                                                            uncorrelated_select_results);
 }
 
-void TableScan::_on_cleanup() { _impl.reset(); }
+void TableScan::_on_cleanup() {
+  _impl.reset();
+  std::sort(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end());
+}
+
+std::vector<std::pair<std::string, size_t>> TableScan::PerformanceData::counts() const {
+  return {{"chunks_scanned", chunks_scanned},
+          {"chunks_pruned", chunks_pruned},
+          {"chunks_excluded", chunks_excluded},
+          {"impl_" + impl_description, 1}};
+}
+
+std::string TableScan::PerformanceData::to_string(DescriptionMode description_mode) const {
+  auto string = OperatorPerformanceData::to_string(description_mode);
+  string += description_mode == DescriptionMode::MultiLine ? "\n" : ", ";
+  string += "Impl: " + impl_description + ", " + std::to_string(chunks_scanned) + " of " +
+            std::to_string(chunks_scanned + chunks_pruned + chunks_excluded) + " chunks scanned";
+  if (chunks_pruned > 0 || chunks_excluded > 0) {
+    string += " (" + std::to_string(chunks_pruned) + " pruned, " + std::to_string(chunks_excluded) + " excluded)";
+  }
+  return string;
+}
 
 }  // namespace opossum
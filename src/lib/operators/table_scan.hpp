@@ -1,19 +1,26 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class Chunk;
+class InExpression;
 class Table;
 
 class TableScan : public AbstractReadOnlyOperator {
@@ -40,17 +47,41 @@ class TableScan : public AbstractReadOnlyOperator {
 
   const std::shared_ptr<AbstractExpression>& predicate() const;
 
+  // The chunks that were skipped during the last execution because their statistics or dictionaries show that none of
+  // their rows match the predicate
+  const std::vector<ChunkID>& pruned_chunk_ids() const;
+
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  // In a pipeline, the chunks are scanned in parallel, hence the atomics
+  struct PerformanceData : public OperatorPerformanceData {
+    std::string impl_description;
+    std::atomic<size_t> chunks_scanned{0};
+    // By their statistics or dictionaries during the execution, see pruned_chunk_ids()
+    std::atomic<size_t> chunks_pruned{0};
+    // By the optimizer, see set_excluded_chunk_ids()
+    std::atomic<size_t> chunks_excluded{0};
+
+    // When summed up, the number of executions per impl is counted, too
+    std::vector<std::pair<std::string, size_t>> counts() const override;
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
   /**
    * Create the TableScanImpl based on the predicate type. Public for testing purposes.
    */
   std::unique_ptr<AbstractTableScanImpl> create_impl() const;
 
+  bool is_pipeline_breaker() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<Table> _on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) override;
+
+  void _on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) override;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -60,10 +91,52 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _on_cleanup() override;
 
+  // Creates the impl and the empty output table
+  std::shared_ptr<Table> _prepare_execution();
+
+  // Returns true for excluded and pruned chunks
+  bool _skip_chunk(const Table& in_table, const ChunkID chunk_id);
+
+  // Returns the output segments for a single input chunk - or an empty vector if no row of the chunk matches
+  Segments _scan_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id) const;
+
+  // Creates the output chunk for the input chunk, which shares its allocator, access counter, and sort order
+  static std::shared_ptr<Chunk> _create_output_chunk(const std::shared_ptr<const Chunk>& in_chunk,
+                                                     const Segments& out_segments);
+
+  // Conjunctions are split into their predicates, each of which gets its own impl. The @param
+  // uncorrelated_select_results contain the results of all uncorrelated subqueries of the entire predicate, so that
+  // each of them is executed only once per scan.
+  using UncorrelatedSelectResults = ExpressionEvaluator::UncorrelatedSelectResults;
+  std::unique_ptr<AbstractTableScanImpl> _create_impl(
+      const std::shared_ptr<AbstractExpression>& predicate,
+      const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results) const;
+
+  // A predicate that the statistics and dictionaries of a chunk are checked against (see ChunkStatistics::can_prune())
+  struct PruningPredicate {
+    ColumnID column_id;
+    PredicateCondition predicate_condition;
+    AllTypeVariant value;
+    std::optional<AllTypeVariant> value2;
+  };
+
+  // Extracts the `<column> <condition> <value>` and `<column> BETWEEN <value> AND <value>` predicates of a conjunction
+  static std::vector<PruningPredicate> _pruning_predicates(const std::shared_ptr<AbstractExpression>& predicate);
+
+  // Returns true if no row of the chunk can match all of the `pruning_predicates`
+  static bool _can_prune_chunk(const Chunk& chunk, const std::vector<PruningPredicate>& pruning_predicates);
+
   // Turns top-level uncorrelated subqueries into their value, e.g. `a = (SELECT 123)` becomes `a = 123`. This makes it
   // easier to avoid using the more expensive ExpressionEvaluatorTableScanImpl.
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
-      const std::shared_ptr<AbstractExpression>& predicate);
+      const std::shared_ptr<AbstractExpression>& predicate,
+      const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results);
+
+  // For `<column> IN <set>`, returns the elements of the set if it is a list of literals or an uncorrelated subquery
+  // that all have the data type of the column.
+  static std::optional<std::vector<AllTypeVariant>> _resolve_in_set(
+      const InExpression& in_expression, const DataType column_data_type,
+      const UncorrelatedSelectResults& uncorrelated_select_results);
 
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
@@ -74,6 +147,12 @@ class TableScan : public AbstractReadOnlyOperator {
   std::string _impl_description{"Unset"};
 
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::vector<ChunkID> _pruned_chunk_ids;
+
+  // Set up for each execution
+  std::unordered_set<ChunkID> _excluded_chunk_set;
+  std::vector<PruningPredicate> _execution_pruning_predicates;
+  std::mutex _pruned_chunk_ids_mutex;
 };
 
 }  // namespace opossum
@@ -34,6 +34,53 @@ std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk(const Chu
   return matches;
 }
 
+void AbstractSingleColumnTableScanImpl::scan_chunk_into_selection(const ChunkID chunk_id,
+                                                                  SelectionBitmap& selection) const {
+  const auto selected_row_count = selection.count();
+  if (selected_row_count > selection.size() * POSITION_FILTER_MAX_SELECTIVITY) {
+    AbstractTableScanImpl::scan_chunk_into_selection(chunk_id, selection);
+    return;
+  }
+  if (selected_row_count == 0) return;
+
+  const auto& segment = _in_table->get_chunk(chunk_id)->get_segment(_column_id);
+  const auto selected_rows = selection.to_pos_list(chunk_id);
+
+  // The position filter holds the positions of the selected rows within the segment that is actually scanned
+  auto position_filter = std::shared_ptr<PosList>{};
+  auto scanned_segment = std::shared_ptr<const BaseSegment>{};
+
+  if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+    const auto& pos_list = reference_segment->pos_list();
+    if (!pos_list->references_single_chunk() || pos_list->empty()) {
+      AbstractTableScanImpl::scan_chunk_into_selection(chunk_id, selection);
+      return;
+    }
+
+    position_filter = std::make_shared<PosList>(selected_rows->size());
+    for (auto row_idx = size_t{0}; row_idx < selected_rows->size(); ++row_idx) {
+      (*position_filter)[row_idx] = (*pos_list)[(*selected_rows)[row_idx].chunk_offset];
+    }
+
+    const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+    scanned_segment = referenced_chunk->get_segment(reference_segment->referenced_column_id());
+  } else {
+    position_filter = selected_rows;
+    scanned_segment = segment;
+  }
+  position_filter->guarantee_single_chunk();
+
+  auto matches = PosList{};
+  _scan_non_reference_segment(*scanned_segment, chunk_id, matches, position_filter);
+
+  // The chunk offsets of the matches are positions within the position filter, which map to the selected rows
+  auto filtered_selection = SelectionBitmap{selection.size()};
+  for (const auto& match : matches) {
+    filtered_selection.select((*selected_rows)[match.chunk_offset].chunk_offset);
+  }
+  selection = std::move(filtered_selection);
+}
+
 void AbstractSingleColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id,
                                                                 PosList& matches) const {
   const auto& pos_list = segment.pos_list();
@@ -29,6 +29,13 @@ class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
 
+  // If only few rows are selected, only these are scanned, using a position filter
+  void scan_chunk_into_selection(const ChunkID chunk_id, SelectionBitmap& selection) const override;
+
+  // Up to this share of selected rows, scanning only the selected rows is expected to be faster than scanning the
+  // whole segment and intersecting the results
+  static constexpr auto POSITION_FILTER_MAX_SELECTIVITY = 0.1f;
+
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, PosList& matches) const;
 
@@ -0,0 +1,12 @@
+#include "abstract_table_scan_impl.hpp"
+
+namespace opossum {
+
+void AbstractTableScanImpl::scan_chunk_into_selection(const ChunkID chunk_id, SelectionBitmap& selection) const {
+  if (selection.none()) return;
+
+  const auto matches = scan_chunk(chunk_id);
+  selection &= SelectionBitmap::from_pos_list(selection.size(), *matches);
+}
+
+}  // namespace opossum
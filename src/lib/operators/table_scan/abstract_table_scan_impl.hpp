@@ -2,6 +2,7 @@
 
 #include <array>
 
+#include "selection_bitmap.hpp"
 #include "storage/pos_list.hpp"
 #include "types.hpp"
 
@@ -18,6 +19,13 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  /**
+   * Deselects the rows of `selection` that do not match the predicate, i.e., combines the predicate with the ones that
+   * have been evaluated into `selection` before. By default, the whole chunk is scanned. Impls can override this to
+   * only look at the selected rows.
+   */
+  virtual void scan_chunk_into_selection(const ChunkID chunk_id, SelectionBitmap& selection) const;
+
  protected:
   /**
    * @defgroup The hot loop of the table scan
@@ -39,17 +47,23 @@ class AbstractTableScanImpl {
   static void __attribute__((hot, flatten, aligned(256), noinline))
   _scan_with_iterators(const BinaryFunctor func, LeftIterator left_it, const LeftIterator left_end,
                        const ChunkID chunk_id, PosList& matches_out, [[maybe_unused]] RightIterator right_it) {
+    // Iterators of segments without NULLs (e.g., NonNullSegmentPositions) are never checked for NULLs
+    constexpr auto CHECK_LEFT_FOR_NULL = CheckForNull && std::decay_t<decltype(*left_it)>::Nullable;
+
     for (; left_it != left_end; ++left_it) {
       if constexpr (std::is_same_v<RightIterator, std::false_type>) {
         const auto left = *left_it;
 
-        if ((!CheckForNull || !left.is_null()) && func(left)) {
+        if ((!CHECK_LEFT_FOR_NULL || !left.is_null()) && func(left)) {
           matches_out.emplace_back(RowID{chunk_id, left.chunk_offset()});
         }
       } else {
+        constexpr auto CHECK_RIGHT_FOR_NULL = CheckForNull && std::decay_t<decltype(*right_it)>::Nullable;
+
         const auto left = *left_it;
         const auto right = *right_it;
-        if ((!CheckForNull || (!left.is_null() && !right.is_null())) && func(left, right)) {
+        if ((!CHECK_LEFT_FOR_NULL || !left.is_null()) && (!CHECK_RIGHT_FOR_NULL || !right.is_null()) &&
+            func(left, right)) {
           matches_out.emplace_back(RowID{chunk_id, left.chunk_offset()});
         }
         ++right_it;
@@ -6,13 +6,16 @@
 
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 
 #include "utils/assert.hpp"
 
+#include "frame_of_reference_segment_scan.hpp"
 #include "resolve_type.hpp"
+#include "run_length_segment_scan.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
@@ -26,6 +29,18 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetween"; }
 
+std::shared_ptr<PosList> ColumnBetweenTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto& ordered_by = chunk->ordered_by();
+  if (!ordered_by || ordered_by->first != _column_id) return AbstractSingleColumnTableScanImpl::scan_chunk(chunk_id);
+
+  auto matches = std::make_shared<PosList>();
+  if (variant_is_null(_left_value) || variant_is_null(_right_value)) return matches;
+
+  _scan_sorted_segment(chunk->get_segment(_column_id), ordered_by->second, chunk_id, *matches);
+  return matches;
+}
+
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -39,8 +54,14 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   }
 
   // Select optimized or generic scanning implementation based on segment type
+  const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (encoded_segment && encoded_segment->encoding_type() == EncodingType::RunLength && !position_filter) {
+    _scan_run_length_segment(*encoded_segment, chunk_id, matches);
+  } else if (encoded_segment && encoded_segment->encoding_type() == EncodingType::FrameOfReference &&
+             !position_filter) {
+    _scan_frame_of_reference_segment(*encoded_segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -98,4 +119,85 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
   });
 }
 
+void ColumnBetweenTableScanImpl::_scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                      const OrderByMode order_by_mode, const ChunkID chunk_id,
+                                                      PosList& matches) const {
+  resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+    const auto typed_right_value = type_cast_variant<ColumnDataType>(_right_value);
+    const auto ascending = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast;
+    const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+
+    // The segment is accessed at O(log n) positions only, so the accessor's virtual calls do not matter. This also
+    // works for ReferenceSegments, whose values are sorted in the order of their positions.
+    const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+
+    // Returns the first chunk offset for which `is_before` is false. The rows for which it is true precede all others.
+    const auto partition_point = [&](const auto& is_before) {
+      auto low = ChunkOffset{0};
+      auto high = static_cast<ChunkOffset>(segment->size());
+      while (low < high) {
+        const auto middle = static_cast<ChunkOffset>(low + (high - low) / 2);
+        const auto value = accessor->access(middle);
+        if (value ? is_before(*value) : nulls_first) {
+          low = middle + 1;
+        } else {
+          high = middle;
+        }
+      }
+      return low;
+    };
+
+    // The matching rows are those between the rows that precede the range and those that follow it
+    const auto begin = partition_point([&](const auto& value) {
+      return ascending ? value < typed_left_value : value > typed_right_value;
+    });
+    const auto end = partition_point([&](const auto& value) {
+      return ascending ? value <= typed_right_value : value >= typed_left_value;
+    });
+
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      matches.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  });
+}
+
+void ColumnBetweenTableScanImpl::_scan_run_length_segment(const BaseEncodedSegment& segment, const ChunkID chunk_id,
+                                                          PosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& run_length_segment = static_cast<const RunLengthSegment<ColumnDataType>&>(segment);
+    const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+    const auto typed_right_value = type_cast_variant<ColumnDataType>(_right_value);
+
+    const auto predicate = [&typed_left_value, &typed_right_value](const auto& value) {
+      return value >= typed_left_value && value <= typed_right_value;
+    };
+    scan_run_length_segment(run_length_segment, predicate, chunk_id, matches);
+  });
+}
+
+void ColumnBetweenTableScanImpl::_scan_frame_of_reference_segment(const BaseEncodedSegment& segment,
+                                                                  const ChunkID chunk_id, PosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    constexpr auto encoding_type_c = enum_c<EncodingType, EncodingType::FrameOfReference>;
+    if constexpr (hana::value(encoding_supports_data_type(encoding_type_c, hana::type_c<ColumnDataType>))) {
+      const auto& frame_of_reference_segment = static_cast<const FrameOfReferenceSegment<ColumnDataType>&>(segment);
+      const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+      const auto typed_right_value = type_cast_variant<ColumnDataType>(_right_value);
+      if (typed_left_value > typed_right_value) return;
+
+      scan_frame_of_reference_segment(frame_of_reference_segment, typed_left_value, typed_right_value, false, chunk_id,
+                                      matches);
+    } else {
+      Fail("FrameOfReferenceSegment does not support this data type");
+    }
+  });
+}
+
 }  // namespace opossum
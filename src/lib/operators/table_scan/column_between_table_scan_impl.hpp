@@ -28,6 +28,9 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
 
   std::string description() const override;
 
+  // Chunks that are sorted by the column (see Chunk::ordered_by()) are binary-searched for the matching range of rows
+  std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
+
  protected:
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
@@ -39,6 +42,18 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
 
+  // Optimized scan on RunLengthSegments without a position filter, which compares each run's value only once
+  void _scan_run_length_segment(const BaseEncodedSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Optimized scan on FrameOfReferenceSegments without a position filter, which compares the offsets of each block to
+  // the range translated by the block's minimum
+  void _scan_frame_of_reference_segment(const BaseEncodedSegment& segment, const ChunkID chunk_id,
+                                        PosList& matches) const;
+
+  // Finds the matching rows of a chunk that is sorted by the column with the @param order_by_mode
+  void _scan_sorted_segment(const std::shared_ptr<const BaseSegment>& segment, const OrderByMode order_by_mode,
+                            const ChunkID chunk_id, PosList& matches) const;
+
   const AllTypeVariant _left_value;
   const AllTypeVariant _right_value;
 };
@@ -0,0 +1,182 @@
+#include "column_in_hash_set_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ColumnInHashSetTableScanImpl::ColumnInHashSetTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                                                           const ColumnID column_id,
+                                                           const PredicateCondition& predicate_condition,
+                                                           const std::vector<AllTypeVariant>& values)
+    : AbstractSingleColumnTableScanImpl{in_table, column_id, predicate_condition} {
+  DebugAssert(predicate_condition == PredicateCondition::In || predicate_condition == PredicateCondition::NotIn,
+              "Invalid PredicateCondition");
+
+  resolve_data_type(in_table->column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto value_set = std::make_unique<ValueSet<ColumnDataType>>();
+    value_set->values.reserve(values.size());
+
+    for (const auto& value : values) {
+      if (variant_is_null(value)) {
+        _values_contain_null = true;
+        continue;
+      }
+
+      const auto typed_value = type_cast_variant<ColumnDataType>(value);
+      if (value_set->values.emplace(typed_value).second) {
+        value_set->sorted_values.emplace_back(typed_value);
+        _values.emplace_back(typed_value);
+      }
+    }
+    std::sort(value_set->sorted_values.begin(), value_set->sorted_values.end());
+
+    _value_set = std::move(value_set);
+  });
+}
+
+std::string ColumnInHashSetTableScanImpl::description() const { return "ColumnInHashSet"; }
+
+void ColumnInHashSetTableScanImpl::_scan_non_reference_segment(
+    const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter) const {
+  // `a NOT IN (..., NULL)` is either false or NULL, so no row qualifies
+  if (_predicate_condition == PredicateCondition::NotIn && _values_contain_null) return;
+
+  // Select optimized or generic scanning implementation based on segment type
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else {
+    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+  }
+}
+
+void ColumnInHashSetTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                         PosList& matches,
+                                                         const std::shared_ptr<const PosList>& position_filter) const {
+  segment_with_iterators_filtered(segment, position_filter, [&](auto it, const auto end) {
+    using ColumnDataType = typename decltype(it)::ValueType;
+    const auto& values = static_cast<const ValueSet<ColumnDataType>&>(*_value_set).values;
+    const auto negated = _predicate_condition == PredicateCondition::NotIn;
+
+    const auto comparator = [&values, negated](const auto& position) {
+      return (values.find(position.value()) != values.end()) != negated;
+    };
+    _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+void ColumnInHashSetTableScanImpl::_scan_dictionary_segment(
+    const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter) const {
+  const auto unique_values_count = segment.unique_values_count();
+  const auto negated = _predicate_condition == PredicateCondition::NotIn;
+
+  // Whether a value ID qualifies. The last entry is the value ID used for NULLs, which never qualifies.
+  auto value_id_matches = std::vector<bool>(unique_values_count + 1, negated);
+  value_id_matches.back() = false;
+
+  const auto matching_value_id_count = _match_value_ids(segment, value_id_matches, !negated);
+
+  // Early outs
+  const auto qualifying_value_id_count =
+      negated ? unique_values_count - matching_value_id_count : matching_value_id_count;
+  if (qualifying_value_id_count == 0) return;
+
+  auto iterable = create_iterable_from_attribute_vector(segment);
+
+  if (qualifying_value_id_count == unique_values_count) {
+    iterable.with_iterators(position_filter, [&](auto it, auto end) {
+      static const auto always_true = [](const auto&) { return true; };
+      // Matches all, so include all rows except those with NULLs in the result.
+      _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
+    });
+
+    return;
+  }
+
+  // The value ID of NULLs does not qualify, so there is no need to check for it explicitly
+  const auto comparator = [&value_id_matches](const auto& position) { return value_id_matches[position.value()]; };
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+size_t ColumnInHashSetTableScanImpl::_match_value_ids(const BaseDictionarySegment& segment,
+                                                      std::vector<bool>& value_id_matches, const bool match) const {
+  const auto unique_values_count = segment.unique_values_count();
+  auto matching_value_id_count = size_t{0};
+
+  auto merged = false;
+  resolve_data_type(_in_table->column_data_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment);
+    if (!dictionary_segment) return;
+
+    // Both the dictionary and the values are sorted and distinct, so a single merge pass finds all matches
+    const auto& dictionary = *dictionary_segment->dictionary();
+    const auto& sorted_values = static_cast<const ValueSet<ColumnDataType>&>(*_value_set).sorted_values;
+    auto dictionary_iter = dictionary.cbegin();
+    auto values_iter = sorted_values.cbegin();
+    while (dictionary_iter != dictionary.cend() && values_iter != sorted_values.cend()) {
+      if (*dictionary_iter < *values_iter) {
+        ++dictionary_iter;
+      } else if (*values_iter < *dictionary_iter) {
+        ++values_iter;
+      } else {
+        value_id_matches[std::distance(dictionary.cbegin(), dictionary_iter)] = match;
+        ++matching_value_id_count;
+        ++dictionary_iter;
+        ++values_iter;
+      }
+    }
+    merged = true;
+  });
+  if (merged) return matching_value_id_count;
+
+  // Other dictionary segments (i.e., FixedStringDictionarySegments) are accessed through the base interface. Depending
+  // on which one is smaller, either look up the dictionary values in the set or the set values in the dictionary.
+  if (unique_values_count <= _values.size()) {
+    resolve_data_type(_in_table->column_data_type(_column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto& values = static_cast<const ValueSet<ColumnDataType>&>(*_value_set).values;
+
+      for (auto value_id = ValueID{0}; value_id < unique_values_count; ++value_id) {
+        const auto value = type_cast_variant<ColumnDataType>(segment.value_of_value_id(value_id));
+        if (values.find(value) == values.end()) continue;
+
+        value_id_matches[value_id] = match;
+        ++matching_value_id_count;
+      }
+    });
+  } else {
+    for (const auto& value : _values) {
+      const auto value_id = segment.lower_bound(value);
+      if (value_id == INVALID_VALUE_ID || segment.value_of_value_id(value_id) != value) continue;
+
+      value_id_matches[value_id] = match;
+      ++matching_value_id_count;
+    }
+  }
+
+  return matching_value_id_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "abstract_single_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+/**
+ * @brief Checks whether the values of one column are part of a set of literals ("a IN (1, 2, 3)" or "a NOT IN ...")
+ *
+ * The literals are stored in a hash set, so that the costs per row do not depend on the size of the set, as they do for
+ * the ExpressionEvaluator. This makes it possible to execute semi and anti joins with a small right input as scans.
+ *
+ * - Value segments (and all other non-dictionary segments) probe the hash set for every row
+ * - For dictionary segments, the matching value IDs are determined once per segment by merging the sorted dictionary
+ *   with the sorted values of the set. Then, only the attribute vector is scanned, testing one bit per row.
+ *
+ * NULLs of the scanned column never qualify. If the set contains NULL, no row qualifies for NOT IN, as in SQL.
+ */
+class ColumnInHashSetTableScanImpl : public AbstractSingleColumnTableScanImpl {
+ public:
+  ColumnInHashSetTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                               const PredicateCondition& predicate_condition,
+                               const std::vector<AllTypeVariant>& values);
+
+  std::string description() const override;
+
+ protected:
+  void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                                   const std::shared_ptr<const PosList>& position_filter) const override;
+
+  void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                             const std::shared_ptr<const PosList>& position_filter) const;
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+                                const std::shared_ptr<const PosList>& position_filter) const;
+
+  // Sets the entries of the value IDs whose values are part of the set to @param match. Returns their number.
+  size_t _match_value_ids(const BaseDictionarySegment& segment, std::vector<bool>& value_id_matches,
+                          const bool match) const;
+
+  // The hash set is typed with the data type of the scanned column, which is only known at runtime
+  struct BaseValueSet {
+    virtual ~BaseValueSet() = default;
+  };
+
+  template <typename T>
+  struct ValueSet : BaseValueSet {
+    std::unordered_set<T> values;
+
+    // The same values, sorted, for merging them with dictionaries
+    std::vector<T> sorted_values;
+  };
+
+  std::unique_ptr<BaseValueSet> _value_set;
+
+  // The non-NULL values of the set, used for looking up the value IDs in small dictionaries
+  std::vector<AllTypeVariant> _values;
+
+  bool _values_contain_null{false};
+};
+
+}  // namespace opossum
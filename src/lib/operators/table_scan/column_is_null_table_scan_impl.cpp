@@ -78,7 +78,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
       return false;
 
     case PredicateCondition::IsNotNull:
-      return !segment.is_nullable();
+      return !segment.may_contain_nulls();
 
     default:
       Fail("Unsupported comparison type encountered");
@@ -88,7 +88,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
 bool ColumnIsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::IsNull:
-      return !segment.is_nullable();
+      return !segment.may_contain_nulls();
 
     case PredicateCondition::IsNotNull:
       return false;
@@ -24,6 +24,7 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const PredicateCondition predicate_condition,
                                                  const std::string& pattern)
     : AbstractSingleColumnTableScanImpl{in_table, column_id, predicate_condition},
+      _pattern{pattern},
       _matcher{pattern},
       _invert_results(predicate_condition == PredicateCondition::NotLike) {}
 
@@ -61,38 +62,45 @@ void ColumnLikeTableScanImpl::_scan_generic_segment(const BaseSegment& segment,
 void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
-  std::pair<size_t, std::vector<bool>> result;
+  auto dictionary_matches = std::shared_ptr<const LikeDictionaryMatches>{};
 
   if (segment.encoding_type() == EncodingType::Dictionary) {
     const auto& typed_segment = static_cast<const DictionarySegment<std::string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    dictionary_matches = _find_matches_in_dictionary(typed_segment.dictionary());
+  } else if (segment.encoding_type() == EncodingType::FrontCodedDictionary) {
+    // The FrontCodedStringVector is decoded string by string while it is matched
+    const auto& typed_segment = static_cast<const FrontCodedDictionarySegment<std::string>&>(segment);
+    dictionary_matches = _find_matches_in_dictionary(typed_segment.front_coded_dictionary());
   } else {
+    // FixedStringDictionarySegment::dictionary() would copy all strings, the FixedStringVector is matched directly
     const auto& typed_segment = static_cast<const FixedStringDictionarySegment<std::string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    dictionary_matches = _find_matches_in_dictionary(typed_segment.fixed_string_dictionary());
   }
 
-  const auto& match_count = result.first;
-  const auto& dictionary_matches = result.second;
+  const auto& matches_by_value_id = dictionary_matches->matches;
+  const auto dictionary_size = matches_by_value_id.size();
+  const auto match_count =
+      _invert_results ? dictionary_size - dictionary_matches->match_count : dictionary_matches->match_count;
 
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
-  // LIKE matches all rows
-  if (match_count == dictionary_matches.size()) {
+  // LIKE matches no rows. Checked first, as a segment with an empty dictionary holds nothing but NULLs.
+  if (match_count == 0u) {
+    return;
+  }
+
+  // LIKE matches all rows except for NULLs
+  if (match_count == dictionary_size) {
     attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
       static const auto always_true = [](const auto&) { return true; };
-      _scan_with_iterators<false>(always_true, it, end, chunk_id, matches);
+      _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
     });
 
     return;
   }
 
-  // LIKE matches no rows
-  if (match_count == 0u) {
-    return;
-  }
-
-  const auto dictionary_lookup = [&dictionary_matches](const auto& position) {
-    return dictionary_matches[position.value()];
+  const auto dictionary_lookup = [&](const auto& position) {
+    return matches_by_value_id[position.value()] != _invert_results;
   };
 
   attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
@@ -100,25 +108,37 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
-std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
-    const pmr_vector<std::string>& dictionary) const {
-  auto result = std::pair<size_t, std::vector<bool>>{};
+template <typename Dictionary>
+std::shared_ptr<const LikeDictionaryMatches> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
+    const std::shared_ptr<const Dictionary>& dictionary) const {
+  auto& cache = LikeDictionaryMatchesCache::get();
+  const auto cache_key = LikeDictionaryMatchesCacheKey{dictionary.get(), _pattern};
 
-  auto& count = result.first;
-  auto& dictionary_matches = result.second;
+  if (const auto cached_matches = cache.try_get(cache_key)) {
+    if ((*cached_matches)->dictionary.lock() == dictionary) return *cached_matches;
+  }
 
-  count = 0u;
-  dictionary_matches.reserve(dictionary.size());
+  auto dictionary_matches = std::make_shared<LikeDictionaryMatches>();
+  dictionary_matches->dictionary = dictionary;
+  dictionary_matches->matches.reserve(dictionary->size());
 
-  _matcher.resolve(_invert_results, [&](const auto& matcher) {
-    for (const auto& value : dictionary) {
+  _matcher.resolve(false, [&](const auto& matcher) {
+    const auto match_value = [&](const auto& value) {
       const auto matches = matcher(value);
-      count += static_cast<size_t>(matches);
-      dictionary_matches.push_back(matches);
+      dictionary_matches->match_count += static_cast<size_t>(matches);
+      dictionary_matches->matches.push_back(matches);
+    };
+
+    if constexpr (std::is_same_v<Dictionary, FrontCodedStringVector>) {
+      dictionary->for_each(match_value);
+    } else {
+      for (const auto& value : *dictionary) match_value(value);
     }
   });
 
-  return result;
+  cache.set(cache_key, dictionary_matches);
+
+  return dictionary_matches;
 }
 
 }  // namespace opossum
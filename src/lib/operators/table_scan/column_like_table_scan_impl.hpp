@@ -2,13 +2,14 @@
 
 #include <map>
 #include <memory>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_single_column_table_scan_impl.hpp"
+#include "boost/functional/hash.hpp"
 #include "boost/variant.hpp"
+#include "cache/cache.hpp"
 #include "expression/evaluation/like_matcher.hpp"
 
 #include "types.hpp"
@@ -17,6 +18,48 @@ namespace opossum {
 
 class Table;
 
+/**
+ * The result of matching a LIKE pattern against each entry of a dictionary. Matching the whole dictionary is the
+ * expensive part of scanning a dictionary segment, so the results are cached per dictionary and pattern (see
+ * LikeDictionaryMatchesCache) and reused by later scans. As NOT LIKE only inverts the results, both share an entry.
+ */
+struct LikeDictionaryMatches {
+  // Dictionaries are identified by their address in the cache. Once the dictionary is deleted, its address may be
+  // reused by another one, which is detected by this pointer having expired.
+  std::weak_ptr<const void> dictionary;
+
+  size_t match_count{0};
+  std::vector<bool> matches;
+};
+
+struct LikeDictionaryMatchesCacheKey {
+  const void* dictionary;
+  std::string pattern;
+
+  bool operator==(const LikeDictionaryMatchesCacheKey& other) const {
+    return dictionary == other.dictionary && pattern == other.pattern;
+  }
+};
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::LikeDictionaryMatchesCacheKey> {
+  size_t operator()(const opossum::LikeDictionaryMatchesCacheKey& key) const {
+    auto hash = std::hash<const void*>{}(key.dictionary);
+    boost::hash_combine(hash, key.pattern);
+    return hash;
+  }
+};
+
+}  // namespace std
+
+namespace opossum {
+
+using LikeDictionaryMatchesCache = Cache<std::shared_ptr<const LikeDictionaryMatches>, LikeDictionaryMatchesCacheKey>;
+
 /**
  * @brief Implements a column scan using the LIKE operator
  *
@@ -24,10 +67,11 @@ class Table;
  * - Value segments are scanned sequentially
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. The matches are cached
+ *   in the LikeDictionaryMatchesCache, so repeated scans with the same pattern skip this step.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * Performance Notes: Uses a GeneralPattern as a fallback and resorts to even faster Pattern matchers for special
+ *                    cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractSingleColumnTableScanImpl {
  public:
@@ -47,10 +91,13 @@ class ColumnLikeTableScanImpl : public AbstractSingleColumnTableScanImpl {
 
   /**
    * Used for dictionary segments
-   * @returns number of matches and the result of each dictionary entry
+   * @returns the (cached) number of matches and result of each dictionary entry, not yet inverted for NOT LIKE
    */
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary) const;
+  template <typename Dictionary>
+  std::shared_ptr<const LikeDictionaryMatches> _find_matches_in_dictionary(
+      const std::shared_ptr<const Dictionary>& dictionary) const;
 
+  const std::string _pattern;
   const LikeMatcher _matcher;
 
   // For NOT LIKE support
@@ -1,5 +1,6 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -9,8 +10,12 @@
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
+#include "compressed_vector_scan.hpp"
+#include "frame_of_reference_segment_scan.hpp"
 #include "resolve_type.hpp"
+#include "run_length_segment_scan.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
@@ -36,8 +41,14 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
   }
 
   // Select optimized or generic scanning implementation based on segment type
+  const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (encoded_segment && encoded_segment->encoding_type() == EncodingType::RunLength && !position_filter) {
+    _scan_run_length_segment(*encoded_segment, chunk_id, matches);
+  } else if (encoded_segment && encoded_segment->encoding_type() == EncodingType::FrameOfReference &&
+             !position_filter) {
+    _scan_frame_of_reference_segment(*encoded_segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -108,25 +119,106 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can
+  // avoid explicitly checking for it, since the condition (e.g., LessThan) would never return true for
+  // dictionary.size() anyway.
+  const auto check_for_null = _predicate_condition != PredicateCondition::Equals &&
+                              _predicate_condition != PredicateCondition::LessThanEquals &&
+                              _predicate_condition != PredicateCondition::LessThan;
+
   _with_operator_for_dict_segment_scan(_predicate_condition, [&](auto predicate_comparator) {
+    // Without a position filter, the attribute vector is scanned sequentially, which the block-wise scans speed up
+    if (!position_filter) {
+      resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& vector) {
+        if (check_for_null) {
+          scan_compressed_vector<true>(vector, predicate_comparator, search_value_id, segment.null_value_id(),
+                                       chunk_id, matches);
+        } else {
+          scan_compressed_vector<false>(vector, predicate_comparator, search_value_id, segment.null_value_id(),
+                                        chunk_id, matches);
+        }
+      });
+      return;
+    }
+
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
     };
     iterable.with_iterators(position_filter, [&](auto it, auto end) {
-      // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can
-      // avoid explicitly checking for it, since the condition (e.g., LessThan) would never return true for
-      // dictionary.size() anyway.
-      if (_predicate_condition == PredicateCondition::Equals ||
-          _predicate_condition == PredicateCondition::LessThanEquals ||
-          _predicate_condition == PredicateCondition::LessThan) {
-        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
-      } else {
+      if (check_for_null) {
         _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+      } else {
+        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
       }
     });
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_run_length_segment(const BaseEncodedSegment& segment, const ChunkID chunk_id,
+                                                          PosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& run_length_segment = static_cast<const RunLengthSegment<ColumnDataType>&>(segment);
+    const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+
+    with_comparator(_predicate_condition, [&](auto predicate_comparator) {
+      const auto predicate = [predicate_comparator, &typed_value](const auto& value) {
+        return predicate_comparator(value, typed_value);
+      };
+      scan_run_length_segment(run_length_segment, predicate, chunk_id, matches);
+    });
+  });
+}
+
+void ColumnVsValueTableScanImpl::_scan_frame_of_reference_segment(const BaseEncodedSegment& segment,
+                                                                  const ChunkID chunk_id, PosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    constexpr auto encoding_type_c = enum_c<EncodingType, EncodingType::FrameOfReference>;
+    if constexpr (hana::value(encoding_supports_data_type(encoding_type_c, hana::type_c<ColumnDataType>))) {
+      const auto& frame_of_reference_segment = static_cast<const FrameOfReferenceSegment<ColumnDataType>&>(segment);
+      const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+
+      constexpr auto min_value = std::numeric_limits<ColumnDataType>::min();
+      constexpr auto max_value = std::numeric_limits<ColumnDataType>::max();
+
+      // Translate the predicate into a value range (or its complement), see frame_of_reference_segment_scan.hpp
+      const auto scan_range = [&](const ColumnDataType lower_bound, const ColumnDataType upper_bound,
+                                  const bool negate) {
+        scan_frame_of_reference_segment(frame_of_reference_segment, lower_bound, upper_bound, negate, chunk_id,
+                                        matches);
+      };
+
+      switch (_predicate_condition) {
+        case PredicateCondition::Equals:
+          scan_range(typed_value, typed_value, false);
+          return;
+        case PredicateCondition::NotEquals:
+          scan_range(typed_value, typed_value, true);
+          return;
+        case PredicateCondition::LessThan:
+          if (typed_value != min_value) scan_range(min_value, typed_value - 1, false);
+          return;
+        case PredicateCondition::LessThanEquals:
+          scan_range(min_value, typed_value, false);
+          return;
+        case PredicateCondition::GreaterThan:
+          if (typed_value != max_value) scan_range(typed_value + 1, max_value, false);
+          return;
+        case PredicateCondition::GreaterThanEquals:
+          scan_range(typed_value, max_value, false);
+          return;
+        default:
+          Fail("Unsupported predicate condition encountered");
+      }
+    } else {
+      Fail("FrameOfReferenceSegment does not support this data type");
+    }
+  });
+}
+
 ValueID ColumnVsValueTableScanImpl::_get_search_value_id(const BaseDictionarySegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::Equals:
@@ -20,6 +20,9 @@ namespace opossum {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For run-length segments without a position filter, the value is compared once per run
+ * - For frame-of-reference segments without a position filter, the value is translated into a range of offsets per
+ *   block, which are compared without decoding the values
  */
 class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
  public:
@@ -36,6 +39,9 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
                              const std::shared_ptr<const PosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
+  void _scan_run_length_segment(const BaseEncodedSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+  void _scan_frame_of_reference_segment(const BaseEncodedSegment& segment, const ChunkID chunk_id,
+                                        PosList& matches) const;
 
   /**
    * @defgroup Methods used for handling dictionary segments
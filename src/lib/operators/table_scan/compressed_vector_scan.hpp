@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "storage/pos_list.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @defgroup Block-wise scans of compressed attribute vectors
+ *
+ * Compare the value ids of an attribute vector to a search value id and append the positions of the matches to a
+ * PosList. Unlike the iterator-based scans (see AbstractTableScanImpl::_scan_with_iterators), the value ids are
+ * compared in blocks of 64 without branches, and the results are collected in a bitmask. With -march=native, the
+ * compiler translates the comparisons into vector instructions (e.g., AVX2 or AVX-512), so that a block of uint8_t
+ * value ids takes only a few instructions. Only then are the set bits of the bitmask turned into RowIDs, so that
+ * blocks without any matches are skipped at the cost of a single branch.
+ *
+ * The search value id has to be smaller than the null value id; the early outs of the scans take care of the others.
+ * If CheckForNull is set, the null value id never matches. Otherwise, the comparator has to exclude it.
+ * @{
+ */
+
+namespace detail {
+
+template <bool CheckForNull, typename Comparator, typename UnsignedIntType>
+void __attribute__((hot)) scan_unsigned_int_values(const UnsignedIntType* values, const size_t size,
+                                                   const ChunkOffset first_chunk_offset, const Comparator& comparator,
+                                                   const UnsignedIntType search_value_id,
+                                                   [[maybe_unused]] const UnsignedIntType null_value_id,
+                                                   const ChunkID chunk_id, PosList& matches) {
+  constexpr auto BLOCK_SIZE = size_t{64};
+
+  const auto matches_value = [&](const UnsignedIntType value) {
+    if constexpr (CheckForNull) {
+      return comparator(value, search_value_id) & (value != null_value_id);
+    } else {
+      return comparator(value, search_value_id);
+    }
+  };
+
+  auto offset = size_t{0};
+  for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+      mask |= static_cast<uint64_t>(matches_value(values[offset + index])) << index;
+    }
+
+    while (mask != 0) {
+      const auto index = static_cast<ChunkOffset>(__builtin_ctzll(mask));
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + offset + index)});
+      mask &= mask - 1;
+    }
+  }
+
+  for (; offset < size; ++offset) {
+    if (matches_value(values[offset])) {
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + offset)});
+    }
+  }
+}
+
+}  // namespace detail
+
+template <bool CheckForNull, typename Comparator, typename UnsignedIntType>
+void scan_compressed_vector(const FixedSizeByteAlignedVector<UnsignedIntType>& vector, const Comparator& comparator,
+                            const ValueID search_value_id, const ValueID null_value_id, const ChunkID chunk_id,
+                            PosList& matches) {
+  const auto& data = vector.data();
+  detail::scan_unsigned_int_values<CheckForNull>(data.data(), data.size(), ChunkOffset{0}, comparator,
+                                                 static_cast<UnsignedIntType>(search_value_id),
+                                                 static_cast<UnsignedIntType>(null_value_id), chunk_id, matches);
+}
+
+/**
+ * SIMD-BP128 vectors are decoded one block of 128 value ids at a time into a buffer that stays in the L1 cache and
+ * compared right away, instead of being decoded value by value through the SimdBp128Iterator.
+ */
+template <bool CheckForNull, typename Comparator>
+void scan_compressed_vector(const SimdBp128Vector& vector, const Comparator& comparator, const ValueID search_value_id,
+                            const ValueID null_value_id, const ChunkID chunk_id, PosList& matches) {
+  using Packing = SimdBp128Packing;
+
+  const auto* data = vector.data().data();
+  const auto size = vector.size();
+
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  alignas(16) auto block = std::array<uint32_t, Packing::block_size>{};
+
+  auto data_index = size_t{0};
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < size; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(data + data_index++, meta_info.data());
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      if (block_begin >= size) return;
+
+      const auto bit_size = meta_info[block_index];
+      Packing::unpack_block(data + data_index, block.data(), bit_size);
+      data_index += bit_size;
+
+      const auto block_value_count = std::min(size_t{Packing::block_size}, size - block_begin);
+      detail::scan_unsigned_int_values<CheckForNull>(
+          block.data(), block_value_count, static_cast<ChunkOffset>(block_begin), comparator,
+          static_cast<uint32_t>(search_value_id), static_cast<uint32_t>(null_value_id), chunk_id, matches);
+    }
+  }
+}
+
+/**@}*/
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#include "conjunction_table_scan_impl.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ConjunctionTableScanImpl::ConjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                                                   std::vector<std::unique_ptr<AbstractTableScanImpl>> impls)
+    : _in_table(in_table), _impls(std::move(impls)) {
+  Assert(_impls.size() > 1, "Expected at least two predicates");
+}
+
+std::string ConjunctionTableScanImpl::description() const {
+  std::stringstream stream;
+  stream << "Conjunction(";
+  for (auto impl_idx = size_t{0}; impl_idx < _impls.size(); ++impl_idx) {
+    stream << (impl_idx > 0 ? ", " : "") << _impls[impl_idx]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<PosList> ConjunctionTableScanImpl::scan_chunk(ChunkID chunk_id) const {
+  // The first predicate looks at all rows anyway, so it produces its matches directly
+  const auto first_matches = _impls.front()->scan_chunk(chunk_id);
+  if (first_matches->empty()) return first_matches;
+
+  auto selection = SelectionBitmap::from_pos_list(_in_table->get_chunk(chunk_id)->size(), *first_matches);
+  for (auto impl_idx = size_t{1}; impl_idx < _impls.size(); ++impl_idx) {
+    _impls[impl_idx]->scan_chunk_into_selection(chunk_id, selection);
+    if (selection.none()) break;
+  }
+
+  return selection.to_pos_list(chunk_id);
+}
+
+void ConjunctionTableScanImpl::scan_chunk_into_selection(const ChunkID chunk_id, SelectionBitmap& selection) const {
+  for (const auto& impl : _impls) {
+    impl->scan_chunk_into_selection(chunk_id, selection);
+    if (selection.none()) return;
+  }
+}
+
+const std::vector<std::unique_ptr<AbstractTableScanImpl>>& ConjunctionTableScanImpl::impls() const { return _impls; }
+
+}  // namespace opossum
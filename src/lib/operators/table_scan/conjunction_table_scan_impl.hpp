@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Scans for a conjunction of predicates (`<a> AND <b> AND ...`) in a single pass over each chunk. The impls of the
+ * predicates are applied one after another and combine their matches in a SelectionBitmap, instead of producing an
+ * intermediate table per predicate. Once few rows are left, the following predicates only look at these rows (see
+ * AbstractTableScanImpl::scan_chunk_into_selection).
+ */
+class ConjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  ConjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                           std::vector<std::unique_ptr<AbstractTableScanImpl>> impls);
+
+  std::string description() const override;
+
+  std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const override;
+
+  void scan_chunk_into_selection(const ChunkID chunk_id, SelectionBitmap& selection) const override;
+
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>>& impls() const;
+
+ private:
+  const std::shared_ptr<const Table> _in_table;
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> _impls;
+};
+
+}  // namespace opossum
@@ -6,9 +6,12 @@
 namespace opossum {
 
 ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
-    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression)
-    : _in_table(in_table), _expression(expression) {
-  _uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache({expression});
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression,
+    const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results)
+    : _in_table(in_table), _expression(expression), _uncorrelated_select_results(uncorrelated_select_results) {
+  if (!_uncorrelated_select_results) {
+    _uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache({expression});
+  }
 }
 
 std::string ExpressionEvaluatorTableScanImpl::description() const { return "ExpressionEvaluator"; }
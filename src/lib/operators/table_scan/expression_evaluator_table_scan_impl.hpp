@@ -12,11 +12,16 @@ class Table;
  * Uses the ExpressionEvaluator::evaluate_expression_to_pos_list() for a fallback implementation of the
  * AbstractTableScanImpl. This is likely slower than any specialized `AbstractTableScanImpl` and should thus only be
  * used if a particular expression type doesn't have a specialized `AbstractTableScanImpl`.
+ *
+ * The uncorrelated selects of the expression are executed once per scan, not per chunk. If no
+ * @param uncorrelated_select_results are passed (e.g., by the TableScan, which shares them between the predicates of a
+ * conjunction), they are executed when the impl is created.
  */
 class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  public:
-  ExpressionEvaluatorTableScanImpl(const std::shared_ptr<const Table>& in_table,
-                                   const std::shared_ptr<AbstractExpression>& expression);
+  ExpressionEvaluatorTableScanImpl(
+      const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression,
+      const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results = {});
 
   std::string description() const override;
   std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const override;
@@ -24,7 +29,7 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  private:
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<AbstractExpression> _expression;
-  std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults> _uncorrelated_select_results;
+  std::shared_ptr<const ExpressionEvaluator::UncorrelatedSelectResults> _uncorrelated_select_results;
 };
 
 }  // namespace opossum
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @defgroup Block-wise scans of FrameOfReferenceSegments
+ *
+ * Match the values of a FrameOfReferenceSegment against an inclusive value range [lower_bound, upper_bound] (or, if
+ * `negate` is set, against its complement) and append the positions of the non-NULL matches to a PosList.
+ *
+ * Instead of adding the block minimum to each offset, the value range is translated into a range of offsets once per
+ * block. Blocks whose minimum lies above the range match nothing, and blocks where the offset range covers all
+ * uint32_t offsets match everything, so that their offsets are never looked at. Otherwise, the offsets are compared
+ * to the offset range in blocks of 64 without branches (see compressed_vector_scan.hpp), so that the comparison is
+ * vectorized on the compressed offsets.
+ *
+ * All predicates of ColumnVsValueTableScanImpl and ColumnBetweenTableScanImpl map onto such a range: NotEquals is the
+ * complement of [value, value], LessThan is [min, value - 1] and so on.
+ * @{
+ */
+
+namespace detail {
+
+/**
+ * The range of offsets [lower_offset, lower_offset + offset_range_width] of a block that matches the value range
+ */
+struct FrameOfReferenceOffsetRange {
+  bool matches_none;
+  bool matches_all;
+  uint32_t lower_offset;
+  uint32_t offset_range_width;
+};
+
+template <typename T>
+FrameOfReferenceOffsetRange frame_of_reference_offset_range(const T block_minimum, const T lower_bound,
+                                                            const T upper_bound, const bool negate) {
+  using UnsignedT = std::make_unsigned_t<T>;
+  constexpr auto max_offset = UnsignedT{std::numeric_limits<uint32_t>::max()};
+
+  // As the difference of two values of T might overflow T, it is calculated in its unsigned counterpart
+  const auto difference = [&](const T value) {
+    return static_cast<UnsignedT>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(block_minimum));
+  };
+
+  const auto range_is_empty =
+      upper_bound < block_minimum || (lower_bound > block_minimum && difference(lower_bound) > max_offset);
+  if (range_is_empty) return {!negate, negate, 0u, 0u};
+
+  const auto lower_offset = lower_bound > block_minimum ? difference(lower_bound) : UnsignedT{0};
+  const auto upper_offset = std::min(difference(upper_bound), max_offset);
+  if (lower_offset == 0u && upper_offset == max_offset) return {negate, !negate, 0u, 0u};
+
+  return {false, false, static_cast<uint32_t>(lower_offset), static_cast<uint32_t>(upper_offset - lower_offset)};
+}
+
+inline void scan_non_null_positions(const pmr_vector<bool>& null_values, const size_t begin, const size_t end,
+                                    const ChunkID chunk_id, PosList& matches) {
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    if (!null_values[chunk_offset]) matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+  }
+}
+
+template <typename UnsignedIntType>
+void __attribute__((hot))
+scan_frame_of_reference_offsets(const UnsignedIntType* offsets, const size_t size, const size_t first_chunk_offset,
+                                const FrameOfReferenceOffsetRange& offset_range, const bool negate,
+                                const pmr_vector<bool>& null_values, const ChunkID chunk_id, PosList& matches) {
+  constexpr auto BLOCK_SIZE = size_t{64};
+
+  const auto lower_offset = offset_range.lower_offset;
+  const auto offset_range_width = offset_range.offset_range_width;
+
+  // The unsigned subtraction wraps around for offsets below lower_offset, so that a single comparison suffices
+  const auto matches_offset = [&](const UnsignedIntType offset) {
+    return (static_cast<uint32_t>(offset - lower_offset) <= offset_range_width) != negate;
+  };
+
+  const auto append_matches = [&](uint64_t mask, const size_t block_begin) {
+    while (mask != 0) {
+      const auto chunk_offset = first_chunk_offset + block_begin + static_cast<size_t>(__builtin_ctzll(mask));
+      if (!null_values[chunk_offset]) matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+      mask &= mask - 1;
+    }
+  };
+
+  auto offset = size_t{0};
+  for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+      mask |= static_cast<uint64_t>(matches_offset(offsets[offset + index])) << index;
+    }
+    append_matches(mask, offset);
+  }
+
+  auto mask = uint64_t{0};
+  for (auto index = size_t{0}; offset + index < size; ++index) {
+    mask |= static_cast<uint64_t>(matches_offset(offsets[offset + index])) << index;
+  }
+  append_matches(mask, offset);
+}
+
+template <typename T, typename UnsignedIntType>
+void scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment,
+                                     const FixedSizeByteAlignedVector<UnsignedIntType>& vector, const T lower_bound,
+                                     const T upper_bound, const bool negate, const ChunkID chunk_id, PosList& matches) {
+  constexpr auto block_size = size_t{FrameOfReferenceSegment<T>::block_size};
+
+  const auto& block_minima = segment.block_minima();
+  const auto& null_values = segment.null_values();
+  const auto& data = vector.data();
+
+  for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+    const auto block_begin = block_index * block_size;
+    const auto block_end = std::min(block_begin + block_size, data.size());
+
+    const auto offset_range =
+        frame_of_reference_offset_range(block_minima[block_index], lower_bound, upper_bound, negate);
+    if (offset_range.matches_none) continue;
+    if (offset_range.matches_all) {
+      scan_non_null_positions(null_values, block_begin, block_end, chunk_id, matches);
+      continue;
+    }
+
+    scan_frame_of_reference_offsets(data.data() + block_begin, block_end - block_begin, block_begin, offset_range,
+                                    negate, null_values, chunk_id, matches);
+  }
+}
+
+/**
+ * SIMD-BP128 vectors are decoded one block of 128 offsets at a time. Blocks that match everything or nothing are not
+ * decoded at all.
+ */
+template <typename T>
+void scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, const SimdBp128Vector& vector,
+                                     const T lower_bound, const T upper_bound, const bool negate,
+                                     const ChunkID chunk_id, PosList& matches) {
+  using Packing = SimdBp128Packing;
+  constexpr auto block_size = size_t{FrameOfReferenceSegment<T>::block_size};
+  static_assert(block_size % Packing::block_size == 0u, "Blocks of SIMD-BP128 must not span multiple FoR blocks.");
+
+  const auto& block_minima = segment.block_minima();
+  const auto& null_values = segment.null_values();
+  const auto* data = vector.data().data();
+  const auto size = vector.size();
+
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  alignas(16) auto block = std::array<uint32_t, Packing::block_size>{};
+
+  auto offset_range = FrameOfReferenceOffsetRange{};
+
+  auto data_index = size_t{0};
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < size; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(data + data_index++, meta_info.data());
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      if (block_begin >= size) return;
+
+      const auto block_end = std::min(block_begin + Packing::block_size, size);
+      const auto bit_size = meta_info[block_index];
+
+      if (block_begin % block_size == 0u) {
+        offset_range =
+            frame_of_reference_offset_range(block_minima[block_begin / block_size], lower_bound, upper_bound, negate);
+      }
+
+      if (offset_range.matches_none || offset_range.matches_all) {
+        if (offset_range.matches_all) scan_non_null_positions(null_values, block_begin, block_end, chunk_id, matches);
+        data_index += bit_size;
+        continue;
+      }
+
+      Packing::unpack_block(data + data_index, block.data(), bit_size);
+      data_index += bit_size;
+
+      scan_frame_of_reference_offsets(block.data(), block_end - block_begin, block_begin, offset_range, negate,
+                                      null_values, chunk_id, matches);
+    }
+  }
+}
+
+}  // namespace detail
+
+template <typename T>
+void scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, const T lower_bound,
+                                     const T upper_bound, const bool negate, const ChunkID chunk_id,
+                                     PosList& matches) {
+  resolve_compressed_vector_type(segment.offset_values(), [&](const auto& vector) {
+    detail::scan_frame_of_reference_segment(segment, vector, lower_bound, upper_bound, negate, chunk_id, matches);
+  });
+}
+
+/**@}*/
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "storage/pos_list.hpp"
+#include "storage/run_length_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Run-wise scan of a RunLengthSegment
+ *
+ * Evaluates a predicate on the value of each run instead of on each row, and appends the positions of all rows in
+ * matching runs to a PosList. Runs of NULLs never match. Sorted columns with few distinct values (e.g., status flags)
+ * have only a handful of runs per chunk, so that the scan costs little more than writing out the matches.
+ *
+ * Only used without a position filter, as a position filter touches single rows anyway.
+ */
+template <typename T, typename Predicate>
+void scan_run_length_segment(const RunLengthSegment<T>& segment, const Predicate& predicate, const ChunkID chunk_id,
+                             PosList& matches) {
+  const auto& values = *segment.values();
+  const auto& null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+
+  auto run_begin = ChunkOffset{0};
+  for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+    // End positions are inclusive
+    const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+
+    if (!null_values[run_index] && predicate(values[run_index])) {
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        matches.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+
+    run_begin = run_end;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "selection_bitmap.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SelectionBitmap::SelectionBitmap(const ChunkOffset size, const bool selected)
+    : _size(size), _words((size + BITS_PER_WORD - 1) / BITS_PER_WORD, selected ? ~uint64_t{0} : uint64_t{0}) {
+  // Bits beyond _size stay unset, so that count() and to_pos_list() do not have to mask them
+  if (selected && size % BITS_PER_WORD != 0) {
+    _words.back() = (uint64_t{1} << (size % BITS_PER_WORD)) - 1;
+  }
+}
+
+SelectionBitmap SelectionBitmap::from_pos_list(const ChunkOffset size, const PosList& pos_list) {
+  auto selection = SelectionBitmap{size};
+  for (const auto& row_id : pos_list) {
+    selection.select(row_id.chunk_offset);
+  }
+  return selection;
+}
+
+ChunkOffset SelectionBitmap::size() const { return _size; }
+
+void SelectionBitmap::select(const ChunkOffset chunk_offset) {
+  DebugAssert(chunk_offset < _size, "ChunkOffset out of range");
+  _words[chunk_offset / BITS_PER_WORD] |= uint64_t{1} << (chunk_offset % BITS_PER_WORD);
+}
+
+bool SelectionBitmap::is_selected(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _size, "ChunkOffset out of range");
+  return (_words[chunk_offset / BITS_PER_WORD] >> (chunk_offset % BITS_PER_WORD)) & uint64_t{1};
+}
+
+size_t SelectionBitmap::count() const {
+  auto count = size_t{0};
+  for (const auto word : _words) {
+    count += __builtin_popcountll(word);
+  }
+  return count;
+}
+
+bool SelectionBitmap::none() const {
+  for (const auto word : _words) {
+    if (word != 0) return false;
+  }
+  return true;
+}
+
+SelectionBitmap& SelectionBitmap::operator&=(const SelectionBitmap& other) {
+  Assert(_size == other._size, "Can only intersect selections of the same chunk");
+  for (auto word_idx = size_t{0}; word_idx < _words.size(); ++word_idx) {
+    _words[word_idx] &= other._words[word_idx];
+  }
+  return *this;
+}
+
+std::shared_ptr<PosList> SelectionBitmap::to_pos_list(const ChunkID chunk_id) const {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(count());
+
+  for (auto word_idx = size_t{0}; word_idx < _words.size(); ++word_idx) {
+    for (auto word = _words[word_idx]; word != 0; word &= word - 1) {
+      const auto bit_idx = static_cast<ChunkOffset>(__builtin_ctzll(word));
+      pos_list->emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(word_idx * BITS_PER_WORD + bit_idx)});
+    }
+  }
+
+  return pos_list;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * One bit per row of a chunk that tells whether the row is still selected by the predicates that have been evaluated
+ * so far. For chained predicates with a high selectivity, this is much smaller than a PosList with one 12-byte RowID
+ * per match, and further predicates are combined into it with a bitwise AND. It is only turned into a PosList once the
+ * positions are needed, i.e., when the output of the scan is built.
+ */
+class SelectionBitmap {
+ public:
+  explicit SelectionBitmap(const ChunkOffset size, const bool selected = false);
+
+  // Selects the rows at the chunk offsets of `pos_list`
+  static SelectionBitmap from_pos_list(const ChunkOffset size, const PosList& pos_list);
+
+  ChunkOffset size() const;
+
+  void select(const ChunkOffset chunk_offset);
+  bool is_selected(const ChunkOffset chunk_offset) const;
+
+  // Number of selected rows
+  size_t count() const;
+  bool none() const;
+
+  SelectionBitmap& operator&=(const SelectionBitmap& other);
+
+  // Returns the selected rows in ascending order
+  std::shared_ptr<PosList> to_pos_list(const ChunkID chunk_id) const;
+
+ private:
+  static constexpr auto BITS_PER_WORD = ChunkOffset{64};
+
+  ChunkOffset _size;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -0,0 +1,204 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+           const OrderByMode order_by_mode, const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _column_id(column_id),
+      _order_by_mode(order_by_mode),
+      _row_count_expression(row_count_expression) {}
+
+ColumnID TopK::column_id() const { return _column_id; }
+
+OrderByMode TopK::order_by_mode() const { return _order_by_mode; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "Column #" << _column_id << " " << order_by_mode_to_string.at(_order_by_mode)
+         << separator << "Rows: " << _row_count_expression->as_column_name();
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _column_id, _order_by_mode,
+                                expression_deep_copy_if_stateful(_row_count_expression));
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto row_count_expression_result =
+      ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*_row_count_expression);
+  Assert(row_count_expression_result->size() == 1, "Expected exactly one row for TopK");
+  Assert(!row_count_expression_result->is_null(0), "Expected non-null for TopK");
+
+  const auto signed_row_count = row_count_expression_result->value(0);
+  Assert(signed_row_count >= 0, "Can't TopK to a negative number of Rows");
+
+  const auto row_count = std::min(static_cast<size_t>(signed_row_count), input_table_left()->row_count());
+
+  auto row_ids = std::vector<RowID>{};
+  resolve_data_type(input_table_left()->column_data_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    row_ids = _find_top_k<ColumnDataType>(row_count);
+  });
+
+  return _materialize_output(row_ids);
+}
+
+template <typename ColumnDataType>
+std::vector<RowID> TopK::_find_top_k(const size_t row_count) const {
+  if (row_count == 0) return {};
+
+  struct Candidate {
+    RowID row_id;
+    bool is_null;
+    ColumnDataType value;
+  };
+
+  const auto ascending = _order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast;
+  const auto nulls_first = _order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::Descending;
+
+  // Returns true if `lhs` comes before `rhs` in the output. Ties are broken by the position in the input, which makes
+  // the operator stable.
+  const auto comes_before = [ascending, nulls_first](const Candidate& lhs, const Candidate& rhs) {
+    if (lhs.is_null != rhs.is_null) return lhs.is_null == nulls_first;
+    if (!lhs.is_null) {
+      if (lhs.value < rhs.value) return ascending;
+      if (rhs.value < lhs.value) return !ascending;
+    }
+    return lhs.row_id < rhs.row_id;
+  };
+
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto candidates_by_chunk = std::vector<std::vector<Candidate>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      // The heap's top is the candidate that comes last, i.e., the first one to be replaced
+      auto heap = std::priority_queue<Candidate, std::vector<Candidate>, decltype(comes_before)>{comes_before};
+
+      const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(_column_id);
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        auto candidate = Candidate{RowID{chunk_id, position.chunk_offset()}, position.is_null(),
+                                   position.is_null() ? ColumnDataType{} : position.value()};
+        if (heap.size() < row_count) {
+          heap.emplace(std::move(candidate));
+        } else if (comes_before(candidate, heap.top())) {
+          heap.pop();
+          heap.emplace(std::move(candidate));
+        }
+      });
+
+      auto& candidates = candidates_by_chunk[chunk_id];
+      candidates.reserve(heap.size());
+      while (!heap.empty()) {
+        candidates.emplace_back(heap.top());
+        heap.pop();
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Merge the candidates of all chunks. There are at most chunk_count * row_count of them.
+  auto candidates = std::vector<Candidate>{};
+  for (auto& chunk_candidates : candidates_by_chunk) {
+    std::move(chunk_candidates.begin(), chunk_candidates.end(), std::back_inserter(candidates));
+  }
+
+  const auto output_row_count = std::min(row_count, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + output_row_count, candidates.end(), comes_before);
+
+  auto row_ids = std::vector<RowID>(output_row_count);
+  for (auto row_idx = size_t{0}; row_idx < output_row_count; ++row_idx) {
+    row_ids[row_idx] = candidates[row_idx].row_id;
+  }
+  return row_ids;
+}
+
+std::shared_ptr<const Table> TopK::_materialize_output(const std::vector<RowID>& row_ids) const {
+  const auto input_table = input_table_left();
+
+  // The output has at most row_count rows, so it is stored in a single chunk
+  auto output = std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  if (row_ids.empty()) return output;
+
+  Segments output_segments;
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    resolve_data_type(input_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>(row_ids.size());
+      auto null_values = pmr_concurrent_vector<bool>(row_ids.size());
+
+      auto accessors = std::vector<std::unique_ptr<BaseSegmentAccessor<ColumnDataType>>>(input_table->chunk_count());
+
+      for (auto row_idx = size_t{0}; row_idx < row_ids.size(); ++row_idx) {
+        const auto [chunk_id, chunk_offset] = row_ids[row_idx];  // NOLINT
+        auto& accessor = accessors[chunk_id];
+        if (!accessor) {
+          accessor = create_segment_accessor<ColumnDataType>(input_table->get_chunk(chunk_id)->get_segment(column_id));
+        }
+
+        const auto typed_value = accessor->access(chunk_offset);
+        null_values[row_idx] = !typed_value;
+        if (typed_value) values[row_idx] = *typed_value;
+      }
+
+      if (input_table->column_is_nullable(column_id)) {
+        output_segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        output_segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  output->append_chunk(output_segments);
+  return output;
+}
+
+}  // namespace opossum
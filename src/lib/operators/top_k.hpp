@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first n rows of its input according to a sort column, i.e., it fuses Sort and Limit
+ * ("ORDER BY x LIMIT n"). Instead of sorting the entire input, every chunk keeps a bounded heap of its best n rows in
+ * its own job. Only these candidates are sorted in the end. Like Sort, TopK is stable and materializes its output.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  ColumnID column_id() const;
+  OrderByMode order_by_mode() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Returns the (input) RowIDs of the first `row_count` rows in sort order
+  template <typename ColumnDataType>
+  std::vector<RowID> _find_top_k(const size_t row_count) const;
+
+  std::shared_ptr<const Table> _materialize_output(const std::vector<RowID>& row_ids) const;
+
+ private:
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
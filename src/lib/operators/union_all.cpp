@@ -7,6 +7,17 @@
 
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The output only has MVCC data if both inputs have, so that their chunks can be forwarded as they are
+UseMvcc output_use_mvcc(const Table& left, const Table& right) {
+  return left.has_mvcc() == UseMvcc::Yes && right.has_mvcc() == UseMvcc::Yes ? UseMvcc::Yes : UseMvcc::No;
+}
+
+}  // namespace
+
 namespace opossum {
 UnionAll::UnionAll(const std::shared_ptr<const AbstractOperator>& left_in,
                    const std::shared_ptr<const AbstractOperator>& right_in)
@@ -19,29 +30,63 @@ const std::string UnionAll::name() const { return "UnionAll"; }
 std::shared_ptr<const Table> UnionAll::_on_execute() {
   DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
               "Input tables must have same number of columns");
-  DebugAssert(input_table_left()->type() == input_table_left()->type(), "Input tables must have the same type");
+  DebugAssert(input_table_left()->type() == input_table_right()->type(), "Input tables must have the same type");
 
-  auto output = std::make_shared<Table>(input_table_left()->column_definitions(), input_table_left()->type());
+  const auto use_mvcc = output_use_mvcc(*input_table_left(), *input_table_right());
+  auto output =
+      std::make_shared<Table>(input_table_left()->column_definitions(), input_table_left()->type(), std::nullopt,
+                              use_mvcc);
 
-  // add positions to output by iterating over both input tables
+  // The chunks of both inputs are shared with the output instead of being copied. Only the chunks of an input with
+  // MVCC data get new chunks (without MVCC data) for their segments if the other input has none.
   for (const auto& input : {input_table_left(), input_table_right()}) {
-    // iterating over all chunks of table input
-    for (ChunkID in_chunk_id{0}; in_chunk_id < input->chunk_count(); in_chunk_id++) {
-      // creating empty chunk to add segments with positions
-      Segments output_segments;
-
-      // iterating over all segments of the current chunk
-      for (ColumnID column_id{0}; column_id < input->column_count(); ++column_id) {
-        output_segments.push_back(input->get_chunk(in_chunk_id)->get_segment(column_id));
+    for (const auto& chunk : input->chunks()) {
+      if (chunk->has_mvcc_data() == (use_mvcc == UseMvcc::Yes)) {
+        output->append_chunk(chunk);
+      } else {
+        output->append_chunk(chunk->segments());
       }
-
-      // adding newly filled chunk to the output table
-      output->append_chunk(output_segments);
     }
   }
 
   return output;
 }
+
+bool UnionAll::is_pipeline_breaker() const { return false; }
+
+std::vector<size_t> UnionAll::pipelined_input_chunk_sizes() const {
+  // The chunks of the right input follow those of the left input
+  auto chunk_sizes = std::vector<size_t>{};
+  for (const auto& input : {input_table_left(), input_table_right()}) {
+    for (ChunkID in_chunk_id{0}; in_chunk_id < input->chunk_count(); in_chunk_id++) {
+      chunk_sizes.emplace_back(input->get_chunk(in_chunk_id)->size());
+    }
+  }
+  return chunk_sizes;
+}
+
+std::shared_ptr<Table> UnionAll::_on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) {
+  DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
+              "Input tables must have same number of columns");
+  DebugAssert(input_table_left()->type() == input_table_right()->type(), "Input tables must have the same type");
+
+  return std::make_shared<Table>(input_table_left()->column_definitions(), input_table_left()->type(), std::nullopt,
+                                 output_use_mvcc(*input_table_left(), *input_table_right()));
+}
+
+void UnionAll::_on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) {
+  const auto left_chunk_count = input_table_left()->chunk_count();
+  const auto& input_chunk = chunk_id < left_chunk_count
+                                ? input_table_left()->chunks()[chunk_id]
+                                : input_table_right()->chunks()[chunk_id - left_chunk_count];
+
+  if (input_chunk->has_mvcc_data() == (output.has_mvcc() == UseMvcc::Yes)) {
+    output.set_pipelined_chunk(chunk_id, input_chunk);
+  } else {
+    output.set_pipelined_chunk(chunk_id, input_chunk->segments());
+  }
+}
+
 std::shared_ptr<AbstractOperator> UnionAll::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
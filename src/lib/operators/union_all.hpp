@@ -16,8 +16,16 @@ class UnionAll : public AbstractReadOnlyOperator {
            const std::shared_ptr<const AbstractOperator>& right_in);
   const std::string name() const override;
 
+  bool is_pipeline_breaker() const override;
+
+  std::vector<size_t> pipelined_input_chunk_sizes() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _on_begin_pipelined_execution(std::shared_ptr<TransactionContext> context) override;
+
+  void _on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -5,9 +5,15 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "boost/functional/hash.hpp"
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
@@ -25,6 +31,10 @@
  * ReferenceMatrices.
  * Using a implementation derived from std::set_union, the two virtual pos lists are merged into the result table.
  *
+ * Large inputs (see HASH_MIN_ROW_COUNT) are not sorted, but the rows of both ReferenceMatrices are hashed and
+ * partitioned by their hashes. Each partition is deduplicated with a hash set in a job of its own, and becomes one or
+ * more chunks of the result table. The result is thus not ordered by RowIDs.
+ *
  *
  * ### About ReferenceMatrices
  * The ReferenceMatrix consists of N rows and X columns of RowIDs.
@@ -51,7 +61,7 @@
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
  *
- * The sorting, which is the most expensive part of this operator, could probably be parallelized.
+ * The sorting, which is the most expensive part of this operator for small inputs, could probably be parallelized.
  */
 namespace opossum {
 
@@ -81,6 +91,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   auto reference_matrix_left = _build_reference_matrix(input_table_left());
   auto reference_matrix_right = _build_reference_matrix(input_table_right());
 
+  if (input_table_left()->row_count() + input_table_right()->row_count() >= HASH_MIN_ROW_COUNT) {
+    return _union_by_hashing(reference_matrix_left, reference_matrix_right);
+  }
+
   /**
    * Init the virtual pos lists
    */
@@ -120,23 +134,7 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   };
 
   // Turn 'pos_lists' into a new chunk and append it to the table
-  const auto emit_chunk = [&]() {
-    Segments output_segments;
-
-    for (size_t pos_lists_idx = 0; pos_lists_idx < pos_lists.size(); ++pos_lists_idx) {
-      const auto cluster_column_id_begin = _column_cluster_offsets[pos_lists_idx];
-      const auto cluster_column_id_end = pos_lists_idx >= _column_cluster_offsets.size() - 1
-                                             ? input_table_left()->column_count()
-                                             : _column_cluster_offsets[pos_lists_idx + 1];
-      for (auto column_id = cluster_column_id_begin; column_id < cluster_column_id_end; ++column_id) {
-        auto ref_segment = std::make_shared<ReferenceSegment>(
-            _referenced_tables[pos_lists_idx], _referenced_column_ids[column_id], pos_lists[pos_lists_idx]);
-        output_segments.push_back(ref_segment);
-      }
-    }
-
-    out_table->append_chunk(output_segments);
-  };
+  const auto emit_chunk = [&]() { out_table->append_chunk(_output_segments(pos_lists)); };
 
   /**
    * This loop merges reference_matrix_left and reference_matrix_right into the result table. The implementation is
@@ -194,6 +192,113 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   return out_table;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_by_hashing(const ReferenceMatrix& reference_matrix_left,
+                                                              const ReferenceMatrix& reference_matrix_right) const {
+  // The rows of both matrices are numbered consecutively, those of the right one following those of the left one
+  const auto row_count_left = input_table_left()->row_count();
+  const auto row_count = row_count_left + input_table_right()->row_count();
+  const auto row_id = [&](const size_t cluster_id, const size_t row_idx) {
+    return row_idx < row_count_left ? reference_matrix_left[cluster_id][row_idx]
+                                    : reference_matrix_right[cluster_id][row_idx - row_count_left];
+  };
+
+  constexpr auto ROWS_PER_JOB = size_t{65'536};
+  const auto run_jobs = [](const size_t job_count, const auto& function) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_idx]() { function(job_idx); }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  };
+
+  auto hashes = std::vector<size_t>(row_count);
+  run_jobs((row_count + ROWS_PER_JOB - 1) / ROWS_PER_JOB, [&](const size_t job_idx) {
+    const auto end_idx = std::min(row_count, (job_idx + 1) * ROWS_PER_JOB);
+    for (auto row_idx = job_idx * ROWS_PER_JOB; row_idx < end_idx; ++row_idx) {
+      auto hash = size_t{0};
+      for (auto cluster_id = size_t{0}; cluster_id < _column_cluster_offsets.size(); ++cluster_id) {
+        const auto& cluster_row_id = row_id(cluster_id, row_idx);
+        boost::hash_combine(hash, static_cast<ChunkID::base_type>(cluster_row_id.chunk_id));
+        boost::hash_combine(hash, cluster_row_id.chunk_offset);
+      }
+      hashes[row_idx] = hash;
+    }
+  });
+
+  // Equal rows have equal hashes and thus end up in the same partition
+  const auto partition_count = std::clamp(row_count / HASH_MIN_ROW_COUNT, size_t{1}, size_t{256});
+  auto partition_offsets = std::vector<size_t>(partition_count + 1);
+  for (const auto hash : hashes) ++partition_offsets[hash % partition_count + 1];
+  std::partial_sum(partition_offsets.begin(), partition_offsets.end(), partition_offsets.begin());
+  auto partitioned_row_idxs = std::vector<size_t>(row_count);
+  {
+    auto write_offsets = partition_offsets;
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      partitioned_row_idxs[write_offsets[hashes[row_idx] % partition_count]++] = row_idx;
+    }
+  }
+
+  const auto out_chunk_size = std::max(input_table_left()->max_chunk_size(), input_table_right()->max_chunk_size());
+  const auto rows_equal = [&](const size_t left_row_idx, const size_t right_row_idx) {
+    for (auto cluster_id = size_t{0}; cluster_id < _column_cluster_offsets.size(); ++cluster_id) {
+      if (!(row_id(cluster_id, left_row_idx) == row_id(cluster_id, right_row_idx))) return false;
+    }
+    return true;
+  };
+  const auto row_hash = [&](const size_t row_idx) { return hashes[row_idx]; };
+
+  auto chunks_by_partition = std::vector<std::vector<Segments>>(partition_count);
+  run_jobs(partition_count, [&](const size_t partition_id) {
+    const auto partition_begin = partition_offsets[partition_id];
+    const auto partition_end = partition_offsets[partition_id + 1];
+
+    auto unique_rows = std::unordered_set<size_t, decltype(row_hash), decltype(rows_equal)>(
+        partition_end - partition_begin, row_hash, rows_equal);
+    auto pos_lists = std::vector<std::shared_ptr<PosList>>(_column_cluster_offsets.size());
+    std::generate(pos_lists.begin(), pos_lists.end(), [&] { return std::make_shared<PosList>(); });
+
+    for (auto partition_idx = partition_begin; partition_idx < partition_end; ++partition_idx) {
+      const auto row_idx = partitioned_row_idxs[partition_idx];
+      if (!unique_rows.emplace(row_idx).second) continue;
+
+      for (auto cluster_id = size_t{0}; cluster_id < pos_lists.size(); ++cluster_id) {
+        pos_lists[cluster_id]->emplace_back(row_id(cluster_id, row_idx));
+      }
+      if (pos_lists.front()->size() == out_chunk_size) {
+        chunks_by_partition[partition_id].emplace_back(_output_segments(pos_lists));
+        std::generate(pos_lists.begin(), pos_lists.end(), [&] { return std::make_shared<PosList>(); });
+      }
+    }
+    if (!pos_lists.front()->empty()) chunks_by_partition[partition_id].emplace_back(_output_segments(pos_lists));
+  });
+
+  auto out_table = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+  for (const auto& partition_chunks : chunks_by_partition) {
+    for (const auto& segments : partition_chunks) out_table->append_chunk(segments);
+  }
+  return out_table;
+}
+
+Segments UnionPositions::_output_segments(const std::vector<std::shared_ptr<PosList>>& pos_lists) const {
+  Segments output_segments;
+
+  for (size_t pos_lists_idx = 0; pos_lists_idx < pos_lists.size(); ++pos_lists_idx) {
+    const auto cluster_column_id_begin = _column_cluster_offsets[pos_lists_idx];
+    const auto cluster_column_id_end = pos_lists_idx >= _column_cluster_offsets.size() - 1
+                                           ? input_table_left()->column_count()
+                                           : _column_cluster_offsets[pos_lists_idx + 1];
+    for (auto column_id = cluster_column_id_begin; column_id < cluster_column_id_end; ++column_id) {
+      auto ref_segment = std::make_shared<ReferenceSegment>(
+          _referenced_tables[pos_lists_idx], _referenced_column_ids[column_id], pos_lists[pos_lists_idx]);
+      output_segments.push_back(ref_segment);
+    }
+  }
+
+  return output_segments;
+}
+
 std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
               "Input tables don't have the same layout");
@@ -74,6 +74,9 @@ class UnionPositions : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  // Inputs with at least this many rows in total are merged by hashing their rows instead of sorting them
+  static constexpr auto HASH_MIN_ROW_COUNT = size_t{10'000};
+
  private:
   // See docs at the top of the cpp
   using ReferenceMatrix = std::vector<opossum::PosList>;
@@ -107,6 +110,13 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  // Computes the union in parallel jobs over partitions of the rows by their hashes, see the docs at the top of the cpp
+  std::shared_ptr<const Table> _union_by_hashing(const ReferenceMatrix& reference_matrix_left,
+                                                 const ReferenceMatrix& reference_matrix_right) const;
+
+  // @return The ReferenceSegments of an output chunk, each ColumnCluster referencing its pos list of @param pos_lists
+  Segments _output_segments(const std::vector<std::shared_ptr<PosList>>& pos_lists) const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                       const ReferenceMatrix& right_matrix, size_t right_row_idx) const;
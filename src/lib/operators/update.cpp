@@ -16,9 +16,11 @@
 namespace opossum {
 
 Update::Update(const std::string& table_to_update_name, const std::shared_ptr<AbstractOperator>& fields_to_update_op,
-               const std::shared_ptr<AbstractOperator>& update_values_op)
+               const std::shared_ptr<AbstractOperator>& update_values_op,
+               const std::optional<std::vector<ColumnID>>& updated_column_ids)
     : AbstractReadWriteOperator(OperatorType::Update, fields_to_update_op, update_values_op),
-      _table_to_update_name{table_to_update_name} {}
+      _table_to_update_name{table_to_update_name},
+      _updated_column_ids{updated_column_ids} {}
 
 const std::string Update::name() const { return "Update"; }
 
@@ -29,8 +31,11 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   DebugAssert(context != nullptr, "Update needs a transaction context");
   DebugAssert(input_table_left()->row_count() == input_table_right()->row_count(),
               "Update required identical layouts from its input tables");
-  DebugAssert(input_table_left()->column_data_types() == input_table_right()->column_data_types(),
+  DebugAssert(_updated_column_ids ||
+                  input_table_left()->column_data_types() == input_table_right()->column_data_types(),
               "Update required identical layouts from its input tables");
+  DebugAssert(!_updated_column_ids || _updated_column_ids->size() == input_table_right()->column_count(),
+              "Update requires a column of updated values per updated column");
 
   // 1. Delete obsolete data with the Delete operator.
   //    Delete doesn't accept empty input data
@@ -46,7 +51,16 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   }
 
   // 2. Insert new data with the Insert operator.
-  _insert = std::make_shared<Insert>(_table_to_update_name, _input_right);
+  auto values_to_insert = std::shared_ptr<const AbstractOperator>{_input_right};
+  if (const auto updated_rows = _updated_rows(*table_to_update)) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(updated_rows);
+    table_wrapper->execute();
+    values_to_insert = table_wrapper;
+  } else {
+    Assert(!_updated_column_ids, "The chunks of the inputs of an Update of some columns have to line up");
+  }
+
+  _insert = std::make_shared<Insert>(_table_to_update_name, values_to_insert);
   _insert->set_transaction_context(context);
   _insert->execute();
   // Insert cannot fail in the MVCC sense, no check necessary
@@ -57,9 +71,65 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
 std::shared_ptr<AbstractOperator> Update::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Update>(_table_to_update_name, copied_input_left, copied_input_right);
+  return std::make_shared<Update>(_table_to_update_name, copied_input_left, copied_input_right, _updated_column_ids);
 }
 
 void Update::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+std::shared_ptr<const Table> Update::_updated_rows(const Table& table_to_update) const {
+  const auto& fields_to_update = *input_table_left();
+  const auto& update_values = input_table_right();
+
+  const auto chunk_count = fields_to_update.chunk_count();
+  if (fields_to_update.type() != TableType::References || update_values->chunk_count() != chunk_count) return nullptr;
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (fields_to_update.get_chunk(chunk_id)->size() != update_values->get_chunk(chunk_id)->size()) return nullptr;
+  }
+
+  // The column of the updated values for each column of the table, if it is updated
+  auto update_values_column_ids = std::vector<std::optional<ColumnID>>(table_to_update.column_count());
+  for (auto column_id = ColumnID{0}; column_id < update_values->column_count(); ++column_id) {
+    update_values_column_ids[_updated_column_ids ? (*_updated_column_ids)[column_id] : column_id] = column_id;
+  }
+
+  const auto updated_rows = std::make_shared<Table>(table_to_update.column_definitions(), TableType::References);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_size = fields_to_update.get_chunk(chunk_id)->size();
+    const auto update_values_chunk = update_values->get_chunk(chunk_id);
+
+    // References all rows of the chunk of updated values, unless they are ReferenceSegments already
+    auto update_values_pos_list = std::shared_ptr<PosList>{};
+
+    auto segments = Segments{};
+    segments.reserve(table_to_update.column_count());
+    for (auto column_id = ColumnID{0}; column_id < table_to_update.column_count(); ++column_id) {
+      const auto update_values_column_id = update_values_column_ids[column_id];
+      if (!update_values_column_id) {
+        segments.emplace_back(fields_to_update.get_chunk(chunk_id)->get_segment(column_id));
+        continue;
+      }
+
+      const auto segment = update_values_chunk->get_segment(*update_values_column_id);
+      if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        segments.emplace_back(segment);
+        continue;
+      }
+
+      if (!update_values_pos_list) {
+        update_values_pos_list = std::make_shared<PosList>(chunk_size);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          (*update_values_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+        }
+        update_values_pos_list->guarantee_single_chunk();
+      }
+      segments.emplace_back(
+          std::make_shared<ReferenceSegment>(update_values, *update_values_column_id, update_values_pos_list));
+    }
+
+    updated_rows->append_chunk(segments);
+  }
+
+  return updated_rows;
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -20,6 +21,16 @@ class Insert;
  * The second input table must have the exact same column layout and number of rows as the first table and contains the
  * data that is used to update the rows specified by the first table.
  *
+ * If @param updated_column_ids is given, the second input only contains the values of these columns of the table, in
+ * this order, and all other columns keep the values that the first input references. The LQPTranslator does so for
+ * the columns that an UPDATE does not change, which thus are neither materialized by the Projection of the updated
+ * values nor go through an intermediate table.
+ *
+ * The rows are inserted from a table of ReferenceSegments: to the updated values and, for the other columns, to the
+ * old rows. This requires both inputs to consist of chunks of the same sizes, e.g., if the second input is a
+ * Projection of the first. Otherwise, the second input is inserted as a whole, which requires it to contain all
+ * columns.
+ *
  * Assumption: The input has been validated before.
  *
  * Note: Update does not support null values at the moment
@@ -27,7 +38,8 @@ class Insert;
 class Update : public AbstractReadWriteOperator {
  public:
   explicit Update(const std::string& table_to_update_name, const std::shared_ptr<AbstractOperator>& fields_to_update_op,
-                  const std::shared_ptr<AbstractOperator>& update_values_op);
+                  const std::shared_ptr<AbstractOperator>& update_values_op,
+                  const std::optional<std::vector<ColumnID>>& updated_column_ids = std::nullopt);
 
   const std::string name() const override;
 
@@ -44,8 +56,13 @@ class Update : public AbstractReadWriteOperator {
   // Rollback happens in Insert and Delete operators
   void _on_rollback_records() override {}
 
+  // Combines the updated values and the unchanged columns into the rows to insert, or returns nullptr if the chunks of
+  // the inputs do not line up
+  std::shared_ptr<const Table> _updated_rows(const Table& table_to_update) const;
+
  protected:
   const std::string _table_to_update_name;
+  const std::optional<std::vector<ColumnID>> _updated_column_ids;
   std::shared_ptr<Delete> _delete;
   std::shared_ptr<Insert> _insert;
 };
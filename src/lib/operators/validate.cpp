@@ -1,11 +1,18 @@
 #include "validate.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -21,6 +28,74 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+// The visible rows are in the order of the input rows, so the output chunk is sorted like the input chunk
+std::shared_ptr<Chunk> create_output_chunk(const Chunk& in_chunk, const Segments& output_segments) {
+  const auto output_chunk = std::make_shared<Chunk>(output_segments);
+  if (in_chunk.ordered_by()) output_chunk->set_ordered_by(*in_chunk.ordered_by());
+  return output_chunk;
+}
+
+constexpr auto VALIDATE_BLOCK_SIZE = size_t{256};
+
+/**
+ * Checks the visibility of all rows of a chunk and adds the visible ones to pos_list_out. As the MVCC vectors are not
+ * contiguous, they are copied block-wise into local buffers first. The visibility check of a block then has neither
+ * branches nor loop-carried dependencies (except for the reductions), so that the compiler can vectorize it.
+ *
+ * As we look at all rows anyway, we also compute the chunk's visibility summary (see MvccData). Returns the max
+ * begin_cid of the chunk if all rows are unlocked and not deleted, std::nullopt otherwise.
+ */
+std::optional<CommitID> validate_all_rows(const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                          const ChunkID chunk_id, const ChunkOffset chunk_size,
+                                          const MvccData& mvcc_data, PosList& pos_list_out) {
+  auto row_tids = std::array<TransactionID, VALIDATE_BLOCK_SIZE>{};
+  auto begin_cids = std::array<CommitID, VALIDATE_BLOCK_SIZE>{};
+  auto end_cids = std::array<CommitID, VALIDATE_BLOCK_SIZE>{};
+  auto visible = std::array<uint8_t, VALIDATE_BLOCK_SIZE>{};
+
+  auto tid_iter = mvcc_data.tids.cbegin();
+  auto begin_cid_iter = mvcc_data.begin_cids.cbegin();
+  auto end_cid_iter = mvcc_data.end_cids.cbegin();
+
+  auto all_rows_unlocked_and_not_deleted = true;
+  auto max_begin_cid = CommitID{0};
+
+  pos_list_out.reserve(chunk_size);
+
+  for (auto block_begin = size_t{0}; block_begin < chunk_size; block_begin += VALIDATE_BLOCK_SIZE) {
+    const auto block_size = std::min(VALIDATE_BLOCK_SIZE, chunk_size - block_begin);
+
+    for (auto offset = size_t{0}; offset < block_size; ++offset, ++tid_iter, ++begin_cid_iter, ++end_cid_iter) {
+      row_tids[offset] = tid_iter->load();
+      begin_cids[offset] = *begin_cid_iter;
+      end_cids[offset] = *end_cid_iter;
+    }
+
+    auto block_unlocked_and_not_deleted = true;
+    for (auto offset = size_t{0}; offset < block_size; ++offset) {
+      visible[offset] =
+          Validate::is_row_visible(our_tid, snapshot_commit_id, row_tids[offset], begin_cids[offset], end_cids[offset]);
+      block_unlocked_and_not_deleted &= (row_tids[offset] == 0u) & (end_cids[offset] == MvccData::MAX_COMMIT_ID);
+      max_begin_cid = std::max(max_begin_cid, begin_cids[offset]);
+    }
+    all_rows_unlocked_and_not_deleted &= block_unlocked_and_not_deleted;
+
+    for (auto offset = size_t{0}; offset < block_size; ++offset) {
+      if (visible[offset]) pos_list_out.emplace_back(chunk_id, static_cast<ChunkOffset>(block_begin + offset));
+    }
+  }
+
+  // Rows with a begin_cid of MAX_COMMIT_ID have been inserted but not yet committed
+  if (!all_rows_unlocked_and_not_deleted || max_begin_cid == MvccData::MAX_COMMIT_ID) return std::nullopt;
+  return max_begin_cid;
+}
+
+// Returns true if the visibility summary of the chunk guarantees that all of its rows are visible to the snapshot
+bool all_rows_visible(const CommitID snapshot_commit_id, const MvccData& mvcc_data) {
+  const auto max_begin_cid = mvcc_data.max_begin_cid_of_visible_rows();
+  return max_begin_cid && *max_begin_cid <= snapshot_commit_id;
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -61,88 +136,145 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
+  // Each chunk is validated in its own job. The jobs write into their own chunk slot of the output so that no
+  // synchronization is needed and the output chunks are in the order of the input chunks.
+  output->create_chunk_slots(in_table->chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(in_table->chunk_count());
+
   for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      const auto output_segments = _validate_chunk(in_table, chunk_id, our_tid, snapshot_commit_id);
+      if (!output_segments.empty()) {
+        output->set_chunk_slot(chunk_id, create_output_chunk(*in_table->get_chunk(chunk_id), output_segments));
+      }
+    });
 
-    Segments output_segments;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
+    jobs.push_back(job_task);
+    job_task->schedule();
+  }
 
-    // If the segments in this chunk reference a segment, build a poslist for a reference segment.
-    if (ref_segment_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+  CurrentScheduler::wait_for_tasks(jobs);
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_segment_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+  output->append_chunk_slots();
 
-      const auto& pos_list_in = *ref_segment_in->pos_list();
-      if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
-        // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
+  return output;
+}
 
-        pos_list_out->guarantee_single_chunk();
+bool Validate::is_pipeline_breaker() const { return false; }
 
-        const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+std::shared_ptr<Table> Validate::_on_begin_pipelined_execution(
+    std::shared_ptr<TransactionContext> transaction_context) {
+  Assert(transaction_context != nullptr, "Validate can't be called without a transaction context.");
+  DebugAssert(transaction_context->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
 
-        for (auto row_id : pos_list_in) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            pos_list_out->emplace_back(row_id);
-          }
-        }
+  _our_tid = transaction_context->transaction_id();
+  _snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-      } else {
-        // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
+  return std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+}
 
-        for (auto row_id : pos_list_in) {
-          const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+void Validate::_on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) {
+  const auto& in_table = input_table_left();
+  const auto output_segments = _validate_chunk(in_table, chunk_id, _our_tid, _snapshot_commit_id);
+  if (!output_segments.empty()) {
+    output.set_pipelined_chunk(chunk_id, create_output_chunk(*in_table->get_chunk(chunk_id), output_segments));
+  }
+}
 
-          auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+Segments Validate::_validate_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                   const TransactionID our_tid, const CommitID snapshot_commit_id) {
+  const auto chunk_in = in_table->get_chunk(chunk_id);
 
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            pos_list_out->emplace_back(row_id);
-          }
-        }
-      }
+  Segments output_segments;
+  auto pos_list_out = std::make_shared<PosList>();
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
+
+  // If the segments in this chunk reference a segment, build a poslist for a reference segment.
+  if (ref_segment_in) {
+    DebugAssert(chunk_in->references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
+
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_segment_in->referenced_table();
+    DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+
+    const auto& pos_list_in = *ref_segment_in->pos_list();
+    if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
+      // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
 
-      // Construct the actual ReferenceSegment objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
-        const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+      pos_list_out->guarantee_single_chunk();
+
+      const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
+      auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+
+      // Fastest path - all rows of the referenced chunk are visible, so we can forward the input segments
+      if (all_rows_visible(snapshot_commit_id, *mvcc_data)) return chunk_in->segments();
+
+      for (auto row_id : pos_list_in) {
+        if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+          pos_list_out->emplace_back(row_id);
+        }
       }
 
-      // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
     } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
-      const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
-      pos_list_out->guarantee_single_chunk();
+      // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
 
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
+      for (auto row_id : pos_list_in) {
+        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+
+        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+
+        if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+          pos_list_out->emplace_back(row_id);
         }
       }
+    }
+
+    if (pos_list_out->empty()) return {};
 
-      // Create actual ReferenceSegment objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+    // Construct the actual ReferenceSegment objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+      const auto referenced_column_id = reference_segment->referenced_column_id();
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
+    }
+
+    // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
+    auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
+    pos_list_out->guarantee_single_chunk();
+
+    // Generate pos_list_out.
+    const auto chunk_size = chunk_in->size();
+    if (all_rows_visible(snapshot_commit_id, *mvcc_data)) {
+      // Fast path - the visibility summary tells us that all rows are visible without looking at them
+      pos_list_out->resize(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        (*pos_list_out)[chunk_offset] = RowID{chunk_id, chunk_offset};
       }
+    } else {
+      const auto visibility_summary_version = mvcc_data->visibility_summary_version();
+      const auto max_begin_cid =
+          validate_all_rows(our_tid, snapshot_commit_id, chunk_id, chunk_size, *mvcc_data, *pos_list_out);
+      if (max_begin_cid) mvcc_data->set_max_begin_cid_of_visible_rows(*max_begin_cid, visibility_summary_version);
     }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_segments);
+    if (pos_list_out->empty()) return {};
+
+    // Create actual ReferenceSegment objects.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
     }
   }
-  return output;
+
+  return output_segments;
 }
 
 }  // namespace opossum
@@ -15,6 +15,9 @@ namespace opossum {
  * within the context of a given transaction
  *
  * Assumption: Validate happens before joins.
+ *
+ * Chunks are validated in parallel, one JobTask per input chunk. The output chunks keep the order of the input chunks.
+ * Validate is not a pipeline breaker.
  */
 class Validate : public AbstractReadOnlyOperator {
  public:
@@ -26,13 +29,29 @@ class Validate : public AbstractReadOnlyOperator {
   static bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                              const CommitID begin_cid, const CommitID end_cid);
 
+  bool is_pipeline_breaker() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _on_begin_pipelined_execution(
+      std::shared_ptr<TransactionContext> transaction_context) override;
+
+  void _on_execute_pipelined_chunk(const ChunkID chunk_id, Table& output) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  // Returns the output segments for a single input chunk - or an empty vector if no row of the chunk is visible
+  static Segments _validate_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                  const TransactionID our_tid, const CommitID snapshot_commit_id);
+
+  // Of the transaction, while Validate is executed in a pipeline
+  TransactionID _our_tid{0};
+  CommitID _snapshot_commit_id{0};
 };
 
 }  // namespace opossum
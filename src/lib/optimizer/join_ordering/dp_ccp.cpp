@@ -11,18 +11,41 @@
 
 namespace opossum {
 
-DpCcp::DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
-    : AbstractJoinOrderingAlgorithm(cost_estimator) {}
+DpCcp::DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+             const std::optional<size_t>& max_csg_cmp_pair_count)
+    : AbstractJoinOrderingAlgorithm(cost_estimator), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
 
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
 
+  /**
+   * 1. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
+   */
+  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
+  for (const auto& edge : join_graph.edges) {
+    // EnumerateCcp only deals with binary join predicates
+    if (edge.vertex_set.count() != 2) continue;
+
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+
+    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
+  }
+
+  /**
+   * 2. Enumerate the CsgCmpPairs before any plan is built, so that JoinGraphs that are too complex are rejected without
+   *    touching their vertices
+   */
+  const auto csg_cmp_pairs =
+      EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges, _max_csg_cmp_pair_count}();  // NOLINT
+  if (_max_csg_cmp_pair_count && csg_cmp_pairs.size() > *_max_csg_cmp_pair_count) return nullptr;
+
   // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible because
   // boost::dynamic_bitset hides the data necessary for doing so efficiently.
   auto best_plan = std::map<JoinGraphVertexSet, std::shared_ptr<AbstractLQPNode>>{};
 
   /**
-   * 1. Initialize best_plan[] with the vertices
+   * 3. Initialize best_plan[] with the vertices
    */
   for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
     auto single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
@@ -32,8 +55,8 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 2. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
-   * 2.1 Collect uncorrelated predicates
+   * 4. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
+   * 4.1 Collect uncorrelated predicates
    */
   std::vector<std::shared_ptr<AbstractExpression>> uncorrelated_predicates;
   for (const auto& edge : join_graph.edges) {
@@ -42,7 +65,7 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 2.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
+   * 4.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
    *     Reasoning: Uncorrelated predicates are either False or True for *all* rows. If an uncorrelated
    *                predicate is False and we place it on top of the largest vertex we avoid processing the vertex'
    *                many rows in later joins.
@@ -71,7 +94,7 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 3. Add local predicates on top of the vertices
+   * 5. Add local predicates on top of the vertices
    */
   for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
     const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
@@ -83,24 +106,9 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 4. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
-   */
-  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
-  for (const auto& edge : join_graph.edges) {
-    // EnumerateCcp only deals with binary join predicates
-    if (edge.vertex_set.count() != 2) continue;
-
-    const auto first_vertex_idx = edge.vertex_set.find_first();
-    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
-
-    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
-  }
-
-  /**
-   * 5. Actual DpCcp algorithm: Enumerate the CsgCmpPairs; build candidate plans; update best_plan if the candidate plan
-   *                            is cheaper than the cheapest currently known plan for a particular subset of vertices.
+   * 6. Actual DpCcp algorithm: For each CsgCmpPair, build a candidate plan; update best_plan if the candidate plan is
+   *                            cheaper than the cheapest currently known plan for a particular subset of vertices.
    */
-  const auto csg_cmp_pairs = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges}();  // NOLINT
   for (const auto& csg_cmp_pair : csg_cmp_pairs) {
     const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
     const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
@@ -121,7 +129,7 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 6. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
+   * 7. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
    *    graph.
    */
   boost::dynamic_bitset<> all_vertices_set{join_graph.vertices.size()};
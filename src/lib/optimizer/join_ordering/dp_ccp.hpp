@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "abstract_join_ordering_algorithm.hpp"
 
 namespace opossum {
@@ -14,10 +16,14 @@ namespace opossum {
  * DpCcp is driven by EnumerateCcp which enumerates all candidate join operations.
  *
  * Local predicates are pushed down and sorted by increasing cost.
+ *
+ * As one candidate plan is costed per CsgCmpPair, @param max_csg_cmp_pair_count bounds the time DpCcp takes. JoinGraphs
+ * with more CsgCmpPairs are left to other algorithms (see JoinOrderingRule).
  */
 class DpCcp final : public AbstractJoinOrderingAlgorithm {
  public:
-  explicit DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  explicit DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                 const std::optional<size_t>& max_csg_cmp_pair_count = std::nullopt);
 
   /**
    * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. DpCcp is only applied
@@ -25,8 +31,12 @@ class DpCcp final : public AbstractJoinOrderingAlgorithm {
    * @return                An LQP consisting of
    *                         * the operations from the JoinGraph in an optimal order
    *                         * the subplans from the vertices below them
+   *                        or nullptr if the JoinGraph has more than max_csg_cmp_pair_count CsgCmpPairs
    */
   std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph);
+
+ private:
+  const std::optional<size_t> _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
@@ -17,8 +17,9 @@
 
 namespace opossum {
 
-EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges)
-    : _num_vertices(num_vertices), _edges(std::move(edges)) {
+EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+                           const std::optional<size_t>& max_csg_cmp_pair_count)
+    : _num_vertices(num_vertices), _edges(std::move(edges)), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {
   // DPccp should not be used for queries with a table count on the scale of 64 because of complexity reasons
   Assert(num_vertices < sizeof(unsigned long) * 8, "Too many vertices, EnumerateCcp relies on to_ulong()");  // NOLINT
 
@@ -57,6 +58,7 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
     std::vector<JoinGraphVertexSet> csgs;
     _enumerate_csg_recursive(csgs, start_vertex_set, _exclusion_set(forward_vertex_idx));
     for (const auto& csg : csgs) {
+      if (_exceeds_max_csg_cmp_pair_count()) return _csg_cmp_pairs;
       _enumerate_cmp(csg);
     }
   }
@@ -125,6 +127,8 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
   } while ((current_vertex_idx = neighborhood.find_next(current_vertex_idx)) != JoinGraphVertexSet::npos);
 
   for (auto iter = reverse_vertex_indices.rbegin(); iter != reverse_vertex_indices.rend(); ++iter) {
+    if (_exceeds_max_csg_cmp_pair_count()) return;
+
     auto cmp_vertex_set = JoinGraphVertexSet(_num_vertices);
     cmp_vertex_set.set(*iter);
 
@@ -218,4 +222,8 @@ std::vector<JoinGraphVertexSet> EnumerateCcp::_non_empty_subsets(const JoinGraph
   return subsets;
 }
 
+bool EnumerateCcp::_exceeds_max_csg_cmp_pair_count() const {
+  return _max_csg_cmp_pair_count && _csg_cmp_pairs.size() > *_max_csg_cmp_pair_count;
+}
+
 }  // namespace opossum
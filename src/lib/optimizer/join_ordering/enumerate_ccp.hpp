@@ -51,12 +51,18 @@ using CsgCmpPair = std::pair<JoinGraphVertexSet, JoinGraphVertexSet>;
  *          -> a single vertex or
  *          -> a subgraph for which **all possible subdivisions have been enumerated before**. This fact is essential
  *              for dynamic programming to work.
+ *
+ * The number of CsgCmpPairs grows exponentially with the number of vertices for star- and clique-shaped JoinGraphs.
+ * If @param max_csg_cmp_pair_count is given, the enumeration stops once there are more CsgCmpPairs than that, so that
+ * callers can find out cheaply whether a JoinGraph is too complex for them.
  */
 class EnumerateCcp final {
  public:
-  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges);
+  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+               const std::optional<size_t>& max_csg_cmp_pair_count = std::nullopt);
 
   // Corresponds to EnumerateCsg in the paper
+  // @return All CsgCmpPairs or, if there are more than max_csg_cmp_pair_count, more than max_csg_cmp_pair_count of them
   std::vector<CsgCmpPair> operator()();
 
  private:
@@ -78,8 +84,11 @@ class EnumerateCcp final {
   // Corresponds to subset-first subset enumeration in the paper
   std::vector<JoinGraphVertexSet> _non_empty_subsets(const JoinGraphVertexSet& vertex_set) const;
 
+  bool _exceeds_max_csg_cmp_pair_count() const;
+
   const size_t _num_vertices;
   const std::vector<std::pair<size_t, size_t>> _edges;
+  const std::optional<size_t> _max_csg_cmp_pair_count;
 
   std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
 
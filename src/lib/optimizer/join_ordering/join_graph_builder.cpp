@@ -5,6 +5,8 @@
 #include <queue>
 #include <stack>
 
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/join_node.hpp"
@@ -24,6 +26,9 @@ std::optional<JoinGraph> JoinGraphBuilder::operator()(const std::shared_ptr<Abst
 
   _traverse(lqp);
 
+  const auto transitive_predicates = _derive_transitive_predicates(_predicates);
+  _predicates.insert(_predicates.end(), transitive_predicates.begin(), transitive_predicates.end());
+
   /**
    * Turn the predicates into JoinEdges and build the JoinGraph
    */
@@ -70,7 +75,19 @@ void JoinGraphBuilder::_traverse(const std::shared_ptr<AbstractLQPNode>& node) {
 
     case LQPNodeType::Predicate: {
       const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
-      _predicates.emplace_back(predicate_node->predicate());
+
+      /**
+       * A BETWEEN with a column as a bound, e.g., `a.ts BETWEEN b.start AND b.end`, is split into its two comparisons,
+       * so that they can become join predicates, which the LQPTranslator executes together in a JoinIE.
+       */
+      const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(predicate_node->predicate());
+      if (between_expression && (between_expression->lower_bound()->type == ExpressionType::LQPColumn ||
+                                 between_expression->upper_bound()->type == ExpressionType::LQPColumn)) {
+        _predicates.emplace_back(greater_than_equals_(between_expression->value(), between_expression->lower_bound()));
+        _predicates.emplace_back(less_than_equals_(between_expression->value(), between_expression->upper_bound()));
+      } else {
+        _predicates.emplace_back(predicate_node->predicate());
+      }
 
       _traverse(node->left_input());
     } break;
@@ -164,6 +181,109 @@ std::vector<JoinGraphEdge> JoinGraphBuilder::_join_edges_from_predicates(
   return edges;
 }
 
+std::vector<std::shared_ptr<AbstractExpression>> JoinGraphBuilder::_derive_transitive_predicates(
+    const std::vector<std::shared_ptr<AbstractExpression>>& predicates) {
+  /**
+   * Group the columns into classes of columns that are equal to each other, i.e., the transitive closure of the
+   * `column = column` predicates. All predicates of the JoinGraph have to hold for each of its result rows, and they
+   * don't hold for NULLs, so that a predicate on one column of a class holds for all of them.
+   */
+  auto column_classes = std::vector<std::vector<std::shared_ptr<AbstractExpression>>>{};
+  auto class_idx_by_column = ExpressionUnorderedMap<size_t>{};
+
+  for (const auto& predicate : predicates) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) continue;
+
+    const auto& left_column = binary_predicate->left_operand();
+    const auto& right_column = binary_predicate->right_operand();
+    if (left_column->type != ExpressionType::LQPColumn || right_column->type != ExpressionType::LQPColumn) continue;
+
+    const auto left_class_iter = class_idx_by_column.find(left_column);
+    const auto right_class_iter = class_idx_by_column.find(right_column);
+
+    if (left_class_iter == class_idx_by_column.end() && right_class_iter == class_idx_by_column.end()) {
+      class_idx_by_column.emplace(left_column, column_classes.size());
+      class_idx_by_column.emplace(right_column, column_classes.size());
+      column_classes.push_back({left_column, right_column});
+    } else if (right_class_iter == class_idx_by_column.end()) {
+      column_classes[left_class_iter->second].emplace_back(right_column);
+      class_idx_by_column.emplace(right_column, left_class_iter->second);
+    } else if (left_class_iter == class_idx_by_column.end()) {
+      column_classes[right_class_iter->second].emplace_back(left_column);
+      class_idx_by_column.emplace(left_column, right_class_iter->second);
+    } else if (left_class_iter->second != right_class_iter->second) {
+      // Merge the class of the right column into that of the left one, leaving the former empty
+      const auto left_class_idx = left_class_iter->second;
+      auto& right_class = column_classes[right_class_iter->second];
+      for (const auto& column : right_class) {
+        class_idx_by_column[column] = left_class_idx;
+        column_classes[left_class_idx].emplace_back(column);
+      }
+      right_class.clear();
+    }
+  }
+
+  if (column_classes.empty()) return {};
+
+  /**
+   * Apply the comparisons of columns with literals to the other columns of their class
+   */
+  const auto is_literal = [](const auto& expression) { return expression->type == ExpressionType::Value; };
+
+  auto known_predicates = ExpressionUnorderedSet{predicates.begin(), predicates.end()};
+  auto transitive_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  const auto add_transitive_predicates = [&](const auto& column, const auto& make_predicate) {
+    const auto class_iter = class_idx_by_column.find(column);
+    if (class_iter == class_idx_by_column.end()) return;
+
+    for (const auto& other_column : column_classes[class_iter->second]) {
+      if (*other_column == *column) continue;
+
+      const auto transitive_predicate = make_predicate(other_column);
+      if (known_predicates.emplace(transitive_predicate).second) {
+        transitive_predicates.emplace_back(transitive_predicate);
+      }
+    }
+  };
+
+  for (const auto& predicate : predicates) {
+    if (const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate)) {
+      const auto predicate_condition = binary_predicate->predicate_condition;
+      if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+          predicate_condition != PredicateCondition::LessThan &&
+          predicate_condition != PredicateCondition::LessThanEquals &&
+          predicate_condition != PredicateCondition::GreaterThan &&
+          predicate_condition != PredicateCondition::GreaterThanEquals) {
+        continue;
+      }
+
+      const auto& left_operand = binary_predicate->left_operand();
+      const auto& right_operand = binary_predicate->right_operand();
+
+      if (is_literal(right_operand)) {
+        add_transitive_predicates(left_operand, [&](const auto& other_column) {
+          return std::make_shared<BinaryPredicateExpression>(predicate_condition, other_column, right_operand);
+        });
+      } else if (is_literal(left_operand)) {
+        add_transitive_predicates(right_operand, [&](const auto& other_column) {
+          return std::make_shared<BinaryPredicateExpression>(predicate_condition, left_operand, other_column);
+        });
+      }
+    } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(predicate)) {
+      if (!is_literal(between_expression->lower_bound()) || !is_literal(between_expression->upper_bound())) continue;
+
+      add_transitive_predicates(between_expression->value(), [&](const auto& other_column) {
+        return std::make_shared<BetweenExpression>(other_column, between_expression->lower_bound(),
+                                                   between_expression->upper_bound());
+      });
+    }
+  }
+
+  return transitive_predicates;
+}
+
 std::vector<JoinGraphEdge> JoinGraphBuilder::_cross_edges_between_components(
     const std::vector<std::shared_ptr<AbstractLQPNode>>& vertices, std::vector<JoinGraphEdge> edges) {
   /**
@@ -39,6 +39,14 @@ class JoinGraphBuilder final {
       const std::vector<std::shared_ptr<AbstractLQPNode>>& vertices,
       const std::vector<std::shared_ptr<AbstractExpression>>& predicates);
 
+  /**
+   * Derives the predicates implied by the equi-join predicates among the @param predicates, e.g., `b.x < 10` from
+   * `a.x = b.x AND a.x < 10`, so that both sides of the join are filtered before it. Only comparisons and BETWEENs of
+   * columns with literals are derived, and only if they are not among the @param predicates already.
+   */
+  static std::vector<std::shared_ptr<AbstractExpression>> _derive_transitive_predicates(
+      const std::vector<std::shared_ptr<AbstractExpression>>& predicates);
+
   static std::vector<JoinGraphEdge> _cross_edges_between_components(
       const std::vector<std::shared_ptr<AbstractLQPNode>>& vertices, std::vector<JoinGraphEdge> edges);
 
@@ -1,24 +1,38 @@
 #include "optimizer.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "cost_model/cost_model_logical.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_select_expression.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/strategy/predicate_placement_rule.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
 #include "strategy/constant_calculation_rule.hpp"
+#include "strategy/distinct_removal_rule.hpp"
+#include "strategy/exchange_placement_rule.hpp"
 #include "strategy/exists_reformulation_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_detection_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
+#include "strategy/limit_pushdown_rule.hpp"
 #include "strategy/logical_reduction_rule.hpp"
+#include "strategy/materialized_view_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/subselect_to_join_rule.hpp"
+#include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/plugin_manager.hpp"
 
 /**
  * IMPORTANT NOTES ON OPTIMIZING SUB-SELECT LQPS
@@ -40,6 +54,9 @@
  *
  * -> Optimizer::_apply_rule()              optimizes each unique LQP exactly once and assignes the optimized LQPs back
  *                                          to the SelectExpressions referencing them.
+ *
+ * Unique LQPs are found by hashing them (AbstractLQPNode::hash()), so that queries with many subselects do not compare
+ * each of them with all others. If the unique LQPs do not share any nodes, the rule is applied to them in parallel.
  */
 
 namespace {
@@ -51,7 +68,9 @@ using SelectExpressionsByLQP =
     std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, std::vector<std::shared_ptr<LQPSelectExpression>>>>;
 
 // See comment at the top of file for the purpose of this.
+// @param lqp_indices     The index of each LQP in @param select_expressions_by_lqp
 void collect_select_expressions_by_lqp(SelectExpressionsByLQP& select_expressions_by_lqp,
+                                       LQPNodeUnorderedMap<size_t>& lqp_indices,
                                        const std::shared_ptr<AbstractLQPNode>& node,
                                        std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
   if (!node) return;
@@ -62,20 +81,41 @@ void collect_select_expressions_by_lqp(SelectExpressionsByLQP& select_expression
       const auto lqp_select_expression = std::dynamic_pointer_cast<LQPSelectExpression>(sub_expression);
       if (!lqp_select_expression) return ExpressionVisitation::VisitArguments;
 
-      for (auto& lqp_and_select_expressions : select_expressions_by_lqp) {
-        if (*lqp_and_select_expressions.first == *lqp_select_expression->lqp) {
-          lqp_and_select_expressions.second.emplace_back(lqp_select_expression);
-          return ExpressionVisitation::DoNotVisitArguments;
-        }
+      const auto [lqp_index_iter, is_new_lqp] =
+          lqp_indices.emplace(lqp_select_expression->lqp, select_expressions_by_lqp.size());
+      if (is_new_lqp) {
+        select_expressions_by_lqp.emplace_back(lqp_select_expression->lqp, std::vector{lqp_select_expression});
+      } else {
+        select_expressions_by_lqp[lqp_index_iter->second].second.emplace_back(lqp_select_expression);
       }
-      select_expressions_by_lqp.emplace_back(lqp_select_expression->lqp, std::vector{lqp_select_expression});
 
       return ExpressionVisitation::DoNotVisitArguments;
     });
   }
 
-  collect_select_expressions_by_lqp(select_expressions_by_lqp, node->left_input(), visited_nodes);
-  collect_select_expressions_by_lqp(select_expressions_by_lqp, node->right_input(), visited_nodes);
+  collect_select_expressions_by_lqp(select_expressions_by_lqp, lqp_indices, node->left_input(), visited_nodes);
+  collect_select_expressions_by_lqp(select_expressions_by_lqp, lqp_indices, node->right_input(), visited_nodes);
+}
+
+// Rules modify the nodes of an LQP and their outputs, so they can only be applied to LQPs in parallel that do not share
+// any nodes, including those of their subselects
+bool lqps_share_nodes(const SelectExpressionsByLQP& select_expressions_by_lqp) {
+  auto nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  for (const auto& lqp_and_select_expressions : select_expressions_by_lqp) {
+    auto lqp_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+    for (const auto& subplan_root : lqp_find_subplan_roots(lqp_and_select_expressions.first)) {
+      visit_lqp(subplan_root, [&](const auto& node) {
+        lqp_nodes.emplace(node);
+        return LQPVisitation::VisitInputs;
+      });
+    }
+
+    for (const auto& node : lqp_nodes) {
+      if (!nodes.emplace(node).second) return true;
+    }
+  }
+
+  return false;
 }
 
 }  // namespace
@@ -85,16 +125,26 @@ namespace opossum {
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   auto optimizer = std::make_shared<Optimizer>();
 
+  // Look for the unoptimized LQPs of materialized views before any other rule changes the subplans that equal them
+  optimizer->add_rule(std::make_shared<MaterializedViewRule>());
+
   // Run pruning just once since the rule would otherwise insert the pruning ProjectionNodes multiple times.
   optimizer->add_rule(std::make_shared<ConstantCalculationRule>());
 
   optimizer->add_rule(std::make_shared<LogicalReductionRule>());
 
+  // Turn subselects into joins before the columns are pruned, so that the columns the joins need are kept
+  optimizer->add_rule(std::make_shared<SubselectToJoinRule>());
+
+  // Remove DISTINCTs on unique columns, including the AggregateNodes that the SubselectToJoinRule added
+  optimizer->add_rule(std::make_shared<DistinctRemovalRule>());
+
   optimizer->add_rule(std::make_shared<ColumnPruningRule>());
 
-  optimizer->add_rule(std::make_shared<ExistsReformulationRule>());
+  // Limit the rows before the ProjectionNodes, including those that the ColumnPruningRule added, compute them
+  optimizer->add_rule(std::make_shared<LimitPushdownRule>());
 
-  optimizer->add_rule(std::make_shared<ChunkPruningRule>());
+  optimizer->add_rule(std::make_shared<ExistsReformulationRule>());
 
   optimizer->add_rule(std::make_shared<JoinOrderingRule>(std::make_shared<CostModelLogical>()));
 
@@ -102,23 +152,52 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   // for now we want the PredicateReorderingRule to have the final say on predicate positions
   optimizer->add_rule(std::make_shared<PredicatePlacementRule>());
 
+  // Prune chunks once the predicates are placed directly above the tables, including those that the JoinOrderingRule
+  // derived from the join predicates for the other side of a join
+  optimizer->add_rule(std::make_shared<ChunkPruningRule>());
+
   // Bring predicates into the desired order once the PredicateReorderingRule has positioned them as desired
   optimizer->add_rule(std::make_shared<PredicateReorderingRule>());
 
-  optimizer->add_rule(std::make_shared<IndexScanRule>());
+  optimizer->add_rule(std::make_shared<IndexScanRule>(std::make_shared<CostModelPhysical>()));
+
+  // Shuffle join inputs into the partitions of the other input once the joins and their inputs are final
+  optimizer->add_rule(std::make_shared<ExchangePlacementRule>());
+
+  // Add the rules of the loaded plugins, each before the default rule it names or after all rules
+  for (const auto& plugin_optimizer_rule : PluginManager::get().optimizer_rules()) {
+    if (!plugin_optimizer_rule.before_rule_name) {
+      optimizer->add_rule(plugin_optimizer_rule.rule);
+      continue;
+    }
+
+    auto& rules = optimizer->_rules;
+    const auto rule_iter = std::find_if(rules.begin(), rules.end(), [&](const auto& rule) {
+      return rule->name() == *plugin_optimizer_rule.before_rule_name;
+    });
+    Assert(rule_iter != rules.end(), "Plugin " + plugin_optimizer_rule.plugin_name + " added a rule before the rule " +
+                                         *plugin_optimizer_rule.before_rule_name + ", which does not exist");
+    rules.insert(rule_iter, plugin_optimizer_rule.rule);
+  }
 
   return optimizer;
 }
 
 void Optimizer::add_rule(const std::shared_ptr<AbstractRule>& rule) { _rules.emplace_back(rule); }
 
-std::shared_ptr<AbstractLQPNode> Optimizer::optimize(const std::shared_ptr<AbstractLQPNode>& input) const {
+std::shared_ptr<AbstractLQPNode> Optimizer::optimize(const std::shared_ptr<AbstractLQPNode>& input,
+                                                     OptimizerRuleDurations* rule_durations) const {
   // Add explicit root node, so the rules can freely change the tree below it without having to maintain a root node
   // to return to the Optimizer
   const auto root_node = LogicalPlanRootNode::make(input);
 
   for (const auto& rule : _rules) {
+    const auto started = std::chrono::high_resolution_clock::now();
     _apply_rule(*rule, root_node);
+    if (rule_durations) {
+      const auto done = std::chrono::high_resolution_clock::now();
+      rule_durations->emplace_back(rule->name(), std::chrono::duration_cast<std::chrono::nanoseconds>(done - started));
+    }
   }
 
   // Remove LogicalPlanRootNode
@@ -135,16 +214,32 @@ void Optimizer::_apply_rule(const AbstractRule& rule, const std::shared_ptr<Abst
    * Optimize Subselects
    */
   auto select_expressions_by_lqp = SelectExpressionsByLQP{};
+  auto lqp_indices = LQPNodeUnorderedMap<size_t>{};
   auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
-  collect_select_expressions_by_lqp(select_expressions_by_lqp, root_node, visited_nodes);
+  collect_select_expressions_by_lqp(select_expressions_by_lqp, lqp_indices, root_node, visited_nodes);
 
-  for (const auto& lqp_and_select_expressions : select_expressions_by_lqp) {
+  const auto optimize_lqp = [&](const auto& lqp_and_select_expressions) {
     const auto local_root_node = LogicalPlanRootNode::make(lqp_and_select_expressions.first);
     _apply_rule(rule, local_root_node);
     for (const auto& select_expression : lqp_and_select_expressions.second) {
       select_expression->lqp = local_root_node->left_input();
     }
+  };
+
+  if (select_expressions_by_lqp.size() < 2 || lqps_share_nodes(select_expressions_by_lqp)) {
+    for (const auto& lqp_and_select_expressions : select_expressions_by_lqp) {
+      optimize_lqp(lqp_and_select_expressions);
+    }
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(select_expressions_by_lqp.size());
+  for (const auto& lqp_and_select_expressions : select_expressions_by_lqp) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() { optimize_lqp(lqp_and_select_expressions); }));
+    jobs.back()->schedule();
   }
+  CurrentScheduler::wait_for_tasks(jobs);
 }
 
 }  // namespace opossum
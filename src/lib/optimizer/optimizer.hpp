@@ -1,6 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace opossum {
@@ -8,12 +11,16 @@ namespace opossum {
 class AbstractRule;
 class AbstractLQPNode;
 
+// The time that each rule took, in the order in which the rules were applied
+using OptimizerRuleDurations = std::vector<std::pair<std::string, std::chrono::nanoseconds>>;
+
 /**
  * Applies optimization rules to an LQP.
  * On each invocation of optimize(), these Batches are applied in the same order as they were added
  * to the Optimizer.
  *
- * Optimizer::create_default_optimizer() creates the Optimizer with the default rule set.
+ * Optimizer::create_default_optimizer() creates the Optimizer with the default rule set, including the rules of the
+ * loaded plugins (see PluginManager::add_optimizer_rule()).
  */
 class Optimizer final {
  public:
@@ -21,7 +28,9 @@ class Optimizer final {
 
   void add_rule(const std::shared_ptr<AbstractRule>& rule);
 
-  std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input) const;
+  // @param rule_durations, if given, is extended by the time each rule took
+  std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input,
+                                            OptimizerRuleDurations* rule_durations = nullptr) const;
 
  private:
   std::vector<std::shared_ptr<AbstractRule>> _rules;
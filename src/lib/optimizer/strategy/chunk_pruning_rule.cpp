@@ -5,11 +5,15 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -65,6 +69,12 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
     auto new_exclusions = _compute_exclude_list(statistics, predicate);
     excluded_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
   }
+  if (table->partition_schema()) {
+    for (auto& predicate : predicate_nodes) {
+      auto new_exclusions = _compute_partition_exclude_list(*table, predicate);
+      excluded_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
+    }
+  }
 
   // wanted side effect of usings sets: excluded_chunk_ids vector is sorted
   auto& already_excluded_chunk_ids = stored_table->excluded_chunk_ids();
@@ -81,6 +91,10 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
 std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
     const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
     const std::shared_ptr<PredicateNode>& predicate_node) const {
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate_node->predicate())) {
+    return _compute_in_exclude_list(statistics, *in_expression, *predicate_node);
+  }
+
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
   if (!operator_predicates) return {};
@@ -106,4 +120,66 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   return result;
 }
 
+std::set<ChunkID> ChunkPruningRule::_compute_in_exclude_list(
+    const std::vector<std::shared_ptr<ChunkStatistics>>& statistics, const InExpression& in_expression,
+    const PredicateNode& predicate_node) const {
+  const auto column_id = predicate_node.find_column_id(*in_expression.value());
+  const auto list_expression = std::dynamic_pointer_cast<ListExpression>(in_expression.set());
+  if (in_expression.is_negated() || !column_id || !list_expression) return {};
+
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& element : list_expression->elements()) {
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(element);
+    if (!value_expression) return {};
+    values.emplace_back(value_expression->value);
+  }
+
+  // A chunk is pruned if it cannot hold any value of the list
+  std::set<ChunkID> result;
+  for (auto chunk_id = ChunkID{0}; chunk_id < statistics.size(); ++chunk_id) {
+    if (!statistics[chunk_id]) continue;
+
+    const auto& chunk_statistics = *statistics[chunk_id];
+    if (std::all_of(values.begin(), values.end(), [&](const auto& value) {
+          return chunk_statistics.can_prune(*column_id, PredicateCondition::Equals, value);
+        })) {
+      result.insert(chunk_id);
+    }
+  }
+  return result;
+}
+
+std::set<ChunkID> ChunkPruningRule::_compute_partition_exclude_list(
+    const Table& table, const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates) return {};
+
+  const auto& partition_schema = *table.partition_schema();
+  auto pruned_partitions = std::vector<bool>(partition_schema.partition_count());
+
+  for (const auto& operator_predicate : *operator_predicates) {
+    if (operator_predicate.column_id != partition_schema.column_id() || !is_variant(operator_predicate.value)) continue;
+
+    const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+    std::optional<AllTypeVariant> value2;
+    if (operator_predicate.value2) {
+      if (!is_variant(*operator_predicate.value2)) continue;
+      value2 = boost::get<AllTypeVariant>(*operator_predicate.value2);
+    }
+
+    for (auto partition_id = PartitionID{0}; partition_id < partition_schema.partition_count(); ++partition_id) {
+      if (partition_schema.can_prune(partition_id, operator_predicate.predicate_condition, value, value2)) {
+        pruned_partitions[partition_id] = true;
+      }
+    }
+  }
+
+  std::set<ChunkID> result;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (pruned_partitions[table.get_chunk(chunk_id)->partition_id()]) result.insert(chunk_id);
+  }
+  return result;
+}
+
 }  // namespace opossum
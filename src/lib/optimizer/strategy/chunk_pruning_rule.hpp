@@ -13,12 +13,16 @@ namespace opossum {
 
 class AbstractLQPNode;
 class ChunkStatistics;
+class InExpression;
 class PredicateNode;
+class Table;
 
 /**
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
- * table nodes.
+ * table nodes. Besides the comparisons that the filters of the ChunkStatistics answer (including IS NULL and
+ * LIKE 'abc%'), a chunk is excluded by an IN list if none of the list's values can be in it. Additionally, all chunks
+ * of the partitions that a predicate rules out are excluded if the table is partitioned (see PartitionSchema).
  */
 class ChunkPruningRule : public AbstractRule {
  public:
@@ -28,6 +32,13 @@ class ChunkPruningRule : public AbstractRule {
  protected:
   std::set<ChunkID> _compute_exclude_list(const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
                                           const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  std::set<ChunkID> _compute_in_exclude_list(const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
+                                             const InExpression& in_expression,
+                                             const PredicateNode& predicate_node) const;
+
+  std::set<ChunkID> _compute_partition_exclude_list(const Table& table,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const;
 };
 
 }  // namespace opossum
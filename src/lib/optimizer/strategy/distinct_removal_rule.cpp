@@ -0,0 +1,31 @@
+#include "distinct_removal_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace opossum {
+
+std::string DistinctRemovalRule::name() const { return "Distinct Removal Rule"; }
+
+void DistinctRemovalRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Aggregate) {
+    const auto& aggregate_node = static_cast<const AggregateNode&>(*node);
+
+    if (aggregate_node.aggregate_expressions_begin_idx == aggregate_node.node_expressions.size() &&
+        lqp_expressions_are_unique(node->left_input(), aggregate_node.node_expressions)) {
+      const auto projection_node = ProjectionNode::make(aggregate_node.node_expressions);
+      lqp_replace_node(node, projection_node);
+      _apply_to_inputs(projection_node);
+      return;
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Removes AggregateNodes that only group, i.e., DISTINCTs, if their input is unique for the group by expressions
+ * anyway (see lqp_expressions_are_unique()), e.g., `SELECT DISTINCT pk, a FROM t` for the primary key pk of t.
+ * The AggregateNode is replaced with a ProjectionNode of the group by expressions, which has the same output.
+ */
+class DistinctRemovalRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
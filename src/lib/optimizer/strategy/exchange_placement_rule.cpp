@@ -0,0 +1,125 @@
+#include "exchange_placement_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/exchange_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// @return The hash partitioning by the @param expression that JoinHash finds in the output of the @param node, or
+// nullptr if there is none
+std::shared_ptr<const PartitionSchema> hash_partitioning_of(const std::shared_ptr<AbstractLQPNode>& node,
+                                                            const AbstractExpression& expression) {
+  // Projections and aliases forward the segments of their input, which keep their partitions only if they reference
+  // the partitioned table, i.e., if rows were filtered below them
+  auto needs_references = false;
+
+  for (auto input = node; input; input = input->left_input()) {
+    switch (input->type) {
+      case LQPNodeType::Alias:
+      case LQPNodeType::Projection:
+        needs_references = true;
+        break;
+
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Validate:
+        needs_references = false;
+        break;
+
+      case LQPNodeType::Exchange: {
+        const auto& exchange_node = static_cast<const ExchangeNode&>(*input);
+        if (needs_references || *exchange_node.partition_expression() != expression) return nullptr;
+        return PartitionSchema::hash_partitioning(ColumnID{0}, expression.data_type(), exchange_node.partition_count);
+      }
+
+      case LQPNodeType::StoredTable: {
+        if (needs_references || expression.type != ExpressionType::LQPColumn) return nullptr;
+        const auto& column_reference = static_cast<const LQPColumnExpression&>(expression).column_reference;
+        if (column_reference.original_node() != input) return nullptr;
+
+        const auto& table_name = static_cast<const StoredTableNode&>(*input).table_name;
+        const auto partition_schema = StorageManager::get().get_table(table_name)->partition_schema();
+        if (!partition_schema || partition_schema->type() != PartitioningType::Hash ||
+            partition_schema->column_id() != column_reference.original_column_id()) {
+          return nullptr;
+        }
+        return partition_schema;
+      }
+
+      default:
+        return nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string ExchangePlacementRule::name() const { return "Exchange Placement Rule"; }
+
+void ExchangePlacementRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Update || node->type == LQPNodeType::Delete) return;
+
+  if (node->type == LQPNodeType::Join) _place_exchange(std::static_pointer_cast<JoinNode>(node));
+
+  _apply_to_inputs(node);
+}
+
+void ExchangePlacementRule::_place_exchange(const std::shared_ptr<JoinNode>& join_node) {
+  // The join modes that JoinHash executes partition-wise
+  const auto join_mode = join_node->join_mode;
+  if (join_mode != JoinMode::Inner && join_mode != JoinMode::Left && join_mode != JoinMode::Right &&
+      join_mode != JoinMode::Semi && join_mode != JoinMode::Anti) {
+    return;
+  }
+
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+  const auto join_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicate(), *left_input, *right_input);
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return;
+
+  const auto left_expression = left_input->column_expressions().at(join_predicate->column_ids.first);
+  const auto right_expression = right_input->column_expressions().at(join_predicate->column_ids.second);
+  const auto left_partitioning = hash_partitioning_of(left_input, *left_expression);
+  const auto right_partitioning = hash_partitioning_of(right_input, *right_expression);
+  if (left_partitioning && right_partitioning && left_partitioning->is_compatible_with(*right_partitioning)) return;
+
+  const auto left_row_count = left_input->get_statistics()->row_count();
+  const auto right_row_count = right_input->get_statistics()->row_count();
+  const auto shuffled_side = left_row_count < right_row_count ? LQPInputSide::Left : LQPInputSide::Right;
+  const auto& partitioning = shuffled_side == LQPInputSide::Left ? right_partitioning : left_partitioning;
+  if (!partitioning || partitioning->partition_count() < 2) return;
+
+  if (shuffled_side == LQPInputSide::Right && (join_mode == JoinMode::Semi || join_mode == JoinMode::Anti) &&
+      right_row_count <= LQPTranslator::SEMI_JOIN_SCAN_MAX_ROW_COUNT) {
+    return;
+  }
+
+  // E.g., a float column cannot be shuffled into the partitions of an int column
+  const auto& shuffled_expression = shuffled_side == LQPInputSide::Left ? left_expression : right_expression;
+  const auto shuffled_partitioning = PartitionSchema::hash_partitioning(ColumnID{0}, shuffled_expression->data_type(),
+                                                                        partitioning->partition_count());
+  if (!shuffled_partitioning->is_compatible_with(*partitioning)) return;
+
+  lqp_insert_node(join_node, shuffled_side, ExchangeNode::make(shuffled_expression, partitioning->partition_count()));
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class JoinNode;
+
+/**
+ * Places an ExchangeNode below an equi join if one input is hash-partitioned by its join column, so that JoinHash joins
+ * both inputs partition by partition (see PartitionSchema). The other, smaller input is shuffled into the same
+ * partitions. Each partition join then builds and probes hash tables of a fraction of the inputs, which stay in the
+ * caches, and the partitions are the units that a shared-nothing execution would distribute over nodes.
+ *
+ * The input of a JoinNode is partitioned by a column if the column stems from a hash-partitioned stored table or an
+ * ExchangeNode, and the nodes in between only filter or forward the rows of their input chunks (predicates and
+ * validates, as well as projections and aliases of reference tables, see JoinHash). Inputs that are partitioned alike
+ * already are left as they are. The larger input is never shuffled, and neither is the right input of a semi or anti
+ * join that the LQPTranslator executes as a TableScan.
+ *
+ * The Exchange operator materializes the rows, so that no ExchangeNodes are placed below Update or Delete nodes, which
+ * need the rows of their inputs to reference the modified table.
+ */
+class ExchangePlacementRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  static void _place_exchange(const std::shared_ptr<JoinNode>& join_node);
+};
+
+}  // namespace opossum
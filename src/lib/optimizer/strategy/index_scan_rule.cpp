@@ -8,25 +8,20 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-// Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
-// This value is kind of arbitrarily chosen, but the following paper suggests something similar:
-// Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
-constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
-
-// Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
-// The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
-constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+IndexScanRule::IndexScanRule(const std::shared_ptr<const CostModelPhysical>& cost_model) : _cost_model(cost_model) {}
 
 std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
@@ -34,7 +29,9 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
   if (node->type == LQPNodeType::Predicate) {
     const auto& child = node->left_input();
 
-    if (child->type == LQPNodeType::StoredTable) {
+    // The indexes of a sampled table would find the rows that are not part of the sample, too
+    if (child->type == LQPNodeType::StoredTable &&
+        !std::static_pointer_cast<StoredTableNode>(child)->table_sample()) {
       const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
       const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
       const auto table = StorageManager::get().get_table(stored_table_node->table_name);
@@ -45,6 +42,15 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
+
+      // A TableIndex is probed once for all chunks, but it does not know the chunks of a pruned table
+      if (stored_table_node->excluded_chunk_ids().empty()) {
+        for (const auto& table_index : table->table_indexes()) {
+          if (_is_index_scan_cheaper(table_index->column_id(), 1, predicate_node)) {
+            predicate_node->scan_type = ScanType::IndexScan;
+          }
+        }
+      }
     }
   }
 
@@ -57,6 +63,14 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
 
   if (index_info.type != SegmentIndexType::GroupKey) return false;
 
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(predicate_node->left_input());
+  const auto chunk_count = StorageManager::get().get_table(stored_table_node->table_name)->chunk_count();
+
+  return _is_index_scan_cheaper(index_info.column_ids[0], chunk_count, predicate_node);
+}
+
+bool IndexScanRule::_is_index_scan_cheaper(const ColumnID column_id, const size_t indexed_chunk_count,
+                                           const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
   if (!operator_predicates) return false;
@@ -67,16 +81,24 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   // Currently, we do not support two-column predicates
   if (is_column_id(operator_predicate.value)) return false;
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+  // The IndexScan takes its values when it is created, so it cannot be used for parameters, e.g., of cached plans
+  if (is_parameter_id(operator_predicate.value)) return false;
+  if (operator_predicate.value2 && is_parameter_id(*operator_predicate.value2)) return false;
 
-  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
-  if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+  if (column_id != operator_predicate.column_id) return false;
 
+  // Whether probing is cheaper than scanning depends on the selectivity, see "Access Path Selection in Main-Memory
+  // Optimized Data Systems: Should I Scan or Should I Probe?"
+  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
   const auto row_count_predicate =
       predicate_node->derive_statistics_from(predicate_node->left_input(), nullptr)->row_count();
-  const float selectivity = row_count_predicate / row_count_table;
 
-  return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
+  const auto index_scan_cost = _cost_model->estimate_scan_cost(OperatorType::IndexScan, row_count_table,
+                                                               row_count_predicate, indexed_chunk_count);
+  const auto table_scan_cost =
+      _cost_model->estimate_scan_cost(OperatorType::TableScan, row_count_table, row_count_predicate);
+
+  return index_scan_cost < table_scan_cost;
 }
 
 inline bool IndexScanRule::_is_single_segment_index(const IndexInfo& index_info) const {
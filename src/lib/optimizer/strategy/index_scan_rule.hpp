@@ -11,22 +11,25 @@
 namespace opossum {
 
 class AbstractLQPNode;
+class CostModelPhysical;
 class PredicateNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
- * for being executed by IndexScans. If the expected selectivity of the predicate falls below a certain threshold, the
- * ScanType of the PredicateNode is set to IndexScan.
+ * for being executed by IndexScans. If the CostModelPhysical estimates the IndexScan to be cheaper than the TableScan
+ * for the expected selectivity of the predicate, the ScanType of the PredicateNode is set to IndexScan.
  *
  * Note:
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes are supported, and TableIndexes, which cover all chunks of a table.
  */
 
 class IndexScanRule : public AbstractRule {
  public:
+  explicit IndexScanRule(const std::shared_ptr<const CostModelPhysical>& cost_model);
+
   std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
@@ -34,6 +37,13 @@ class IndexScanRule : public AbstractRule {
   bool _is_index_scan_applicable(const IndexInfo& index_info,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
   inline bool _is_single_segment_index(const IndexInfo& index_info) const;
+
+  // Whether an IndexScan that probes @param indexed_chunk_count indexes on the column with the @param column_id is
+  // cheaper than a TableScan for the predicate of the @param predicate_node
+  bool _is_index_scan_cheaper(const ColumnID column_id, const size_t indexed_chunk_count,
+                              const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  const std::shared_ptr<const CostModelPhysical> _cost_model;
 };
 
 }  // namespace opossum
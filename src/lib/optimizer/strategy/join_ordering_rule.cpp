@@ -9,8 +9,11 @@
 
 namespace opossum {
 
-JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
-    : _cost_estimator(cost_estimator) {}
+JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                   const size_t max_dp_ccp_vertex_count, const size_t max_dp_ccp_csg_cmp_pair_count)
+    : _cost_estimator(cost_estimator),
+      _max_dp_ccp_vertex_count(max_dp_ccp_vertex_count),
+      _max_dp_ccp_csg_cmp_pair_count(max_dp_ccp_csg_cmp_pair_count) {}
 
 std::string JoinOrderingRule::name() const { return "JoinOrderingRule"; }
 
@@ -40,7 +43,7 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
    * Try to build a JoinGraph starting for the current subplan
    *    -> if that fails, continue to try it with the node's inputs
    *    -> if that works
-   *        -> call DpCcp on that JoinGraph
+   *        -> call DpCcp on that JoinGraph, or GreedyOperatorOrdering if the JoinGraph is too complex for DpCcp
    *        -> look for more JoinGraphs below the JoinGraph's vertices
    */
 
@@ -50,12 +53,12 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
     return lqp;
   }
 
-  // Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
+  // DpCcp returns nullptr if the JoinGraph has more CsgCmpPairs than it may cost
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  if (join_graph->vertices.size() < 9) {
-    result_lqp = DpCcp{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
-  } else {
+  if (join_graph->vertices.size() <= _max_dp_ccp_vertex_count) {
+    result_lqp = DpCcp{_cost_estimator, _max_dp_ccp_csg_cmp_pair_count}(*join_graph);  // NOLINT - doesn't like `{}()`
+  }
+  if (!result_lqp) {
     result_lqp = GreedyOperatorOrdering{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
   }
 
@@ -10,14 +10,23 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * Currently only the order of inner joins is modified.
  *
- * TODO(anybody) Use a different join ordering algorithm, such as GreedyOperatorOrdering, if there are too many join
- *               operations for DPccp to handle efficiently.
+ * The optimal DpCcp is used as long as its effort is bounded, i.e., the JoinGraph has at most
+ * max_dp_ccp_vertex_count vertices and at most max_dp_ccp_csg_cmp_pair_count candidate joins (CsgCmpPairs). Chain-
+ * and cycle-shaped JoinGraphs of many tables have few CsgCmpPairs, whereas stars and cliques quickly have too many.
+ * All other JoinGraphs are ordered with GreedyOperatorOrdering.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
-  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  static constexpr auto DEFAULT_MAX_DP_CCP_VERTEX_COUNT = size_t{16};
+
+  // Enough for a clique of eight vertices (3'025 CsgCmpPairs)
+  static constexpr auto DEFAULT_MAX_DP_CCP_CSG_CMP_PAIR_COUNT = size_t{4'096};
+
+  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                            const size_t max_dp_ccp_vertex_count = DEFAULT_MAX_DP_CCP_VERTEX_COUNT,
+                            const size_t max_dp_ccp_csg_cmp_pair_count = DEFAULT_MAX_DP_CCP_CSG_CMP_PAIR_COUNT);
 
   std::string name() const override;
 
@@ -29,6 +38,8 @@ class JoinOrderingRule : public AbstractRule {
   void _recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp) const;
 
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+  const size_t _max_dp_ccp_vertex_count;
+  const size_t _max_dp_ccp_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
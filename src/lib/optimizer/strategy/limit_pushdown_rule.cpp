@@ -0,0 +1,32 @@
+#include "limit_pushdown_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+std::string LimitPushdownRule::name() const { return "Limit Pushdown Rule"; }
+
+void LimitPushdownRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Limit) {
+    // The lowest node that the LimitNode can be placed below
+    auto parent_node = std::shared_ptr<AbstractLQPNode>{};
+    for (auto input = node->left_input(); input->type == LQPNodeType::Projection || input->type == LQPNodeType::Alias;
+         input = input->left_input()) {
+      if (input->output_count() > 1) break;
+      parent_node = input;
+    }
+
+    if (parent_node) {
+      lqp_remove_node(node);
+      lqp_insert_node(parent_node, LQPInputSide::Left, node);
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
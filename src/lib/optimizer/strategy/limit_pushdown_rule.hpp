@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Moves LimitNodes below the ProjectionNodes and AliasNodes beneath them, e.g., `SELECT a + 1 FROM t LIMIT 10` only
+ * computes `a + 1` for ten rows. Both produce one output row per input row, so the first n rows stay the same.
+ *
+ * The Limit operator stops the pipeline that it ends once it has its rows (see OperatorTask), which thus also covers
+ * the scans below it. A LimitNode directly on top of a SortNode is executed as a single Sort (see LQPTranslator).
+ *
+ * Nodes with more than one output are not passed, as the other outputs need all of their rows.
+ */
+class LimitPushdownRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "materialized_view_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void replace_expressions(std::shared_ptr<AbstractExpression>& expression,
+                         const ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>& replacements) {
+  const auto replacement_iter = replacements.find(expression);
+  if (replacement_iter != replacements.end()) {
+    expression = replacement_iter->second;
+    return;
+  }
+
+  for (auto& argument : expression->arguments) {
+    replace_expressions(argument, replacements);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string MaterializedViewRule::name() const { return "Materialized View Rule"; }
+
+void MaterializedViewRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto catalog = StorageManager::get().catalog();
+  const auto& materialized_views = catalog->materialized_views;
+  if (materialized_views.empty()) return;
+
+  auto remaining_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto replacements = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+
+  visit_lqp(node, [&](const auto& sub_node) {
+    for (const auto& [table_name, materialized_view] : materialized_views) {
+      const auto& view_lqp = materialized_view->lqp;
+      if (sub_node->type != view_lqp->type || !lqp_is_validated(view_lqp) || *sub_node != *view_lqp) continue;
+
+      const auto stored_table_node = StoredTableNode::make(table_name);
+      const auto validate_node = ValidateNode::make(stored_table_node);
+
+      const auto& column_expressions = sub_node->column_expressions();
+      const auto& table_column_expressions = stored_table_node->column_expressions();
+      for (auto column_id = ColumnID{0}; column_id < column_expressions.size(); ++column_id) {
+        replacements.emplace(column_expressions[column_id], table_column_expressions[column_id]);
+      }
+
+      for (const auto& output_relation : sub_node->output_relations()) {
+        output_relation.output->set_input(output_relation.input_side, validate_node);
+      }
+
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    remaining_nodes.emplace_back(sub_node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  if (replacements.empty()) return;
+
+  for (const auto& remaining_node : remaining_nodes) {
+    for (auto& expression : remaining_node->node_expressions) {
+      replace_expressions(expression, replacements);
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Replaces the subplans that equal the LQP of a materialized view (see MaterializedView) with the validated table of
+ * the view, e.g., `SELECT a, SUM(b) FROM t GROUP BY a` once it is the LQP of a materialized view. The expressions of
+ * the nodes above that refer to the columns of the subplan are replaced with the columns of the table.
+ *
+ * As the table holds the result as of the last MaterializedView::refresh(), so do the queries that read it. Only
+ * subplans with MVCC are replaced, as the table needs to be validated.
+ */
+class MaterializedViewRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
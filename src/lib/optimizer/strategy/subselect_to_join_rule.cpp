@@ -0,0 +1,316 @@
+#include "subselect_to_join_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/lqp_select_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A predicate `inner_expression = parameter` of a subselect, with the outer_expression that the parameter stands for
+struct Correlation {
+  std::shared_ptr<AbstractExpression> outer_expression;
+  std::shared_ptr<AbstractExpression> inner_expression;
+};
+
+bool is_comparison(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals ||
+         predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+// The joins can compare numbers with numbers and strings with strings, but not numbers with strings
+bool are_comparable(const AbstractExpression& lhs, const AbstractExpression& rhs) {
+  return (lhs.data_type() == DataType::String) == (rhs.data_type() == DataType::String);
+}
+
+bool contains_subselect(const std::shared_ptr<AbstractExpression>& expression) {
+  auto has_subselect = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::LQPSelect) has_subselect = true;
+    return has_subselect ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return has_subselect;
+}
+
+// Whether the @param expression is NULL whenever the aggregates it is computed from are, i.e., for the empty groups
+// that a scalar subselect returns NULL for, but that the join drops
+bool is_null_for_empty_groups(const std::shared_ptr<AbstractExpression>& expression) {
+  auto has_aggregate = false;
+  auto has_other_expressions = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    switch (sub_expression->type) {
+      case ExpressionType::Aggregate:
+        has_aggregate = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+
+      case ExpressionType::Arithmetic:
+      case ExpressionType::Cast:
+      case ExpressionType::UnaryMinus:
+      case ExpressionType::Value:
+        return ExpressionVisitation::VisitArguments;
+
+      default:
+        has_other_expressions = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+    }
+  });
+  return has_aggregate && !has_other_expressions;
+}
+
+// The number of times that the @param parameter_ids are used in the @param lqp, including as arguments of its
+// subselects
+size_t count_parameter_uses(const std::shared_ptr<AbstractLQPNode>& lqp,
+                            const std::vector<ParameterID>& parameter_ids) {
+  auto parameter_use_count = size_t{0};
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type != ExpressionType::CorrelatedParameter) return ExpressionVisitation::VisitArguments;
+
+        const auto parameter_id = static_cast<const CorrelatedParameterExpression&>(*sub_expression).parameter_id;
+        if (std::find(parameter_ids.begin(), parameter_ids.end(), parameter_id) != parameter_ids.end()) {
+          ++parameter_use_count;
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  return parameter_use_count;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string SubselectToJoinRule::name() const { return "Subselect to Join Rule"; }
+
+void SubselectToJoinRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Predicate) {
+    if (const auto replacement_node = _reformulate(static_cast<const PredicateNode&>(*node))) {
+      const auto outputs = node->outputs();
+      const auto input_sides = node->get_input_sides();
+      for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+        outputs[output_idx]->set_input(input_sides[output_idx], replacement_node);
+      }
+      node->set_left_input(nullptr);
+
+      // The subselect might contain subselects itself, which are part of this LQP now
+      apply_to(replacement_node);
+      return;
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+std::shared_ptr<AbstractLQPNode> SubselectToJoinRule::_reformulate(const PredicateNode& predicate_node) const {
+  const auto& predicate = predicate_node.predicate();
+  const auto outer_lqp = predicate_node.left_input();
+
+  /**
+   * 1. Find `value IN subselect` or `value <predicate_condition> subselect`
+   */
+  auto subselect_expression = std::shared_ptr<LQPSelectExpression>{};
+  auto value = std::shared_ptr<AbstractExpression>{};
+  auto predicate_condition = std::optional<PredicateCondition>{};
+
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate)) {
+    if (in_expression->is_negated() || in_expression->set()->type != ExpressionType::LQPSelect) return nullptr;
+    subselect_expression = std::static_pointer_cast<LQPSelectExpression>(in_expression->set());
+    value = in_expression->value();
+  } else if (const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate)) {
+    if (!is_comparison(binary_predicate->predicate_condition)) return nullptr;
+
+    if (binary_predicate->right_operand()->type == ExpressionType::LQPSelect) {
+      subselect_expression = std::static_pointer_cast<LQPSelectExpression>(binary_predicate->right_operand());
+      value = binary_predicate->left_operand();
+      predicate_condition = binary_predicate->predicate_condition;
+    } else if (binary_predicate->left_operand()->type == ExpressionType::LQPSelect) {
+      subselect_expression = std::static_pointer_cast<LQPSelectExpression>(binary_predicate->left_operand());
+      value = binary_predicate->right_operand();
+      predicate_condition = flip_predicate_condition(binary_predicate->predicate_condition);
+    }
+  }
+
+  if (!subselect_expression || contains_subselect(value)) return nullptr;
+
+  // Uncorrelated subselects are executed only once anyway, but the hash join is faster than the IN evaluation
+  if (!subselect_expression->is_correlated() && predicate_condition) return nullptr;
+
+  // The subselect LQP might be used by other expressions, too, so that the join gets a copy of it
+  const auto subselect_lqp = subselect_expression->lqp->deep_copy();
+  if (subselect_lqp->column_expressions().size() != 1) return nullptr;
+
+  const auto subselect_column = subselect_lqp->column_expressions().front();
+  if (!are_comparable(*value, *subselect_column)) return nullptr;
+
+  /**
+   * 2. Uncorrelated IN: Semi join
+   */
+  if (!subselect_expression->is_correlated()) {
+    if (!outer_lqp->find_column_id(*value)) return nullptr;
+    return JoinNode::make(JoinMode::Semi, equals_(value, subselect_column), outer_lqp, subselect_lqp);
+  }
+
+  /**
+   * 3. Find the select list of the subselect: [Alias] [Projection] [Aggregate (only for scalar subselects)]
+   */
+  auto node = subselect_lqp;
+  if (node->type == LQPNodeType::Alias) node = node->left_input();
+
+  auto projection_node = std::shared_ptr<AbstractLQPNode>{};
+  if (node->type == LQPNodeType::Projection) {
+    projection_node = node;
+    node = node->left_input();
+  }
+
+  auto aggregate_node = std::shared_ptr<AggregateNode>{};
+  if (predicate_condition) {
+    aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+    if (!aggregate_node || aggregate_node->aggregate_expressions_begin_idx != 0) return nullptr;
+
+    for (const auto& expression : aggregate_node->node_expressions) {
+      const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
+      if (!aggregate_expression || aggregate_expression->aggregate_function == AggregateFunction::Count ||
+          aggregate_expression->aggregate_function == AggregateFunction::CountDistinct ||
+          aggregate_expression->aggregate_function == AggregateFunction::ApproxCountDistinct) {
+        return nullptr;
+      }
+    }
+
+    if (!is_null_for_empty_groups(subselect_column)) return nullptr;
+    node = node->left_input();
+  }
+
+  // The node whose input the correlated predicates are below
+  const auto select_list_node = aggregate_node ? aggregate_node : projection_node;
+
+  /**
+   * 4. Collect the correlated predicates below the select list
+   */
+  auto correlations = std::vector<Correlation>{};
+  auto correlated_predicate_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  const auto& parameter_ids = subselect_expression->parameter_ids;
+
+  for (auto spine_node = node; spine_node && (spine_node->type == LQPNodeType::Predicate ||
+                                              spine_node->type == LQPNodeType::Projection ||
+                                              spine_node->type == LQPNodeType::Validate);
+       spine_node = spine_node->left_input()) {
+    if (spine_node->type != LQPNodeType::Predicate) continue;
+
+    const auto binary_predicate =
+        std::dynamic_pointer_cast<BinaryPredicateExpression>(static_cast<PredicateNode&>(*spine_node).predicate());
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) continue;
+
+    auto inner_expression = binary_predicate->left_operand();
+    auto parameter_expression = binary_predicate->right_operand();
+    if (inner_expression->type == ExpressionType::CorrelatedParameter) {
+      std::swap(inner_expression, parameter_expression);
+    }
+    if (inner_expression->type != ExpressionType::LQPColumn ||
+        parameter_expression->type != ExpressionType::CorrelatedParameter) {
+      continue;
+    }
+
+    const auto parameter_id = static_cast<const CorrelatedParameterExpression&>(*parameter_expression).parameter_id;
+    const auto parameter_iter = std::find(parameter_ids.begin(), parameter_ids.end(), parameter_id);
+    if (parameter_iter == parameter_ids.end()) continue;
+
+    const auto argument_idx = std::distance(parameter_ids.begin(), parameter_iter);
+    const auto& outer_expression = subselect_expression->arguments[argument_idx];
+    if (!outer_lqp->find_column_id(*outer_expression) || !are_comparable(*outer_expression, *inner_expression)) {
+      return nullptr;
+    }
+
+    correlations.push_back({outer_expression, inner_expression});
+    correlated_predicate_nodes.emplace_back(spine_node);
+  }
+
+  // All other uses of the parameters would still need the outer row
+  if (correlations.empty() || count_parameter_uses(subselect_lqp, parameter_ids) != correlations.size()) return nullptr;
+
+  for (const auto& correlated_predicate_node : correlated_predicate_nodes) {
+    if (correlated_predicate_node == node) node = node->left_input();
+    lqp_remove_node(correlated_predicate_node);
+  }
+  if (select_list_node) select_list_node->set_left_input(nullptr);
+
+  // Projections on the spine might have pruned the columns that the correlated predicates used
+  for (const auto& correlation : correlations) {
+    if (!node->find_column_id(*correlation.inner_expression)) return nullptr;
+  }
+
+  /**
+   * 5. Group the subselect by the columns of the correlated predicates, so that each outer row matches one group
+   */
+  auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  const auto add_group_by_expression = [&](const auto& expression) {
+    if (std::none_of(group_by_expressions.begin(), group_by_expressions.end(),
+                     [&](const auto& group_by_expression) { return *group_by_expression == *expression; })) {
+      group_by_expressions.emplace_back(expression);
+    }
+  };
+
+  for (const auto& correlation : correlations) {
+    add_group_by_expression(correlation.inner_expression);
+  }
+
+  auto subselect_plan = std::shared_ptr<AbstractLQPNode>{};
+  if (aggregate_node) {
+    subselect_plan = AggregateNode::make(group_by_expressions, aggregate_node->node_expressions, node);
+    if (projection_node) {
+      auto projection_expressions = group_by_expressions;
+      projection_expressions.emplace_back(subselect_column);
+      subselect_plan = ProjectionNode::make(projection_expressions, subselect_plan);
+    }
+  } else {
+    add_group_by_expression(subselect_column);
+    subselect_plan = projection_node ? ProjectionNode::make(group_by_expressions, node) : node;
+    subselect_plan = AggregateNode::make(group_by_expressions, std::vector<std::shared_ptr<AbstractExpression>>{},
+                                         subselect_plan);
+  }
+
+  /**
+   * 6. Join the groups with the outer rows and compare them
+   */
+  auto plan = std::shared_ptr<AbstractLQPNode>{
+      JoinNode::make(JoinMode::Inner, equals_(correlations.front().outer_expression,
+                                              correlations.front().inner_expression),
+                     outer_lqp, subselect_plan)};
+  for (auto correlation_idx = size_t{1}; correlation_idx < correlations.size(); ++correlation_idx) {
+    const auto& correlation = correlations[correlation_idx];
+    plan = PredicateNode::make(equals_(correlation.outer_expression, correlation.inner_expression), plan);
+  }
+
+  const auto comparison = predicate_condition ? std::make_shared<BinaryPredicateExpression>(*predicate_condition,
+                                                                                            value, subselect_column)
+                                              : equals_(value, subselect_column);
+  plan = PredicateNode::make(comparison, plan);
+
+  return ProjectionNode::make(outer_lqp->column_expressions(), plan);
+}
+
+}  // namespace opossum
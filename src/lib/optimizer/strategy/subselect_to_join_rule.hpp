@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class PredicateNode;
+
+/**
+ * Rewrites PredicateNodes with IN and comparison subselects into joins, so that the subselect is executed once
+ * instead of once per row of the outer query (which is what the ExpressionEvaluator does for correlated subselects).
+ *
+ *  - `a IN (SELECT x FROM t2)` (uncorrelated) becomes a semi join on `a = x`.
+ *  - `a IN (SELECT x FROM t2 WHERE t2.y = t1.z)` becomes an inner join on `t1.z = t2.y` with the subselect grouped by
+ *    t2.y and x, followed by a PredicateNode `a = x`. The grouping makes sure that each outer row is matched once.
+ *  - `a > (SELECT 0.5 * SUM(x) FROM t2 WHERE t2.y = t1.z)` becomes an inner join on `t1.z = t2.y` with the aggregate
+ *    of the subselect grouped by t2.y, followed by a PredicateNode `a > 0.5 * SUM(x)`. Outer rows without a matching
+ *    group are dropped by the join just as they would be by the comparison with the NULL that the subselect returns
+ *    for them.
+ *
+ * A ProjectionNode on top of the join restores the columns of the outer query. This is the decorrelation described by
+ * Kim ("On Optimizing an SQL-like Nested Query", TODS 1982) plus its fix for empty groups, restricted to cases where
+ * it is exact:
+ *  - The correlated predicates have to be `column = parameter` predicates in the chain of PredicateNodes, Projections
+ *    and Validates directly below the aggregate (or the top of the subselect for IN). Their parameters must not be
+ *    used anywhere else in the subselect, and the expressions they stand for have to be columns of the outer query.
+ *  - Scalar subselects need a single aggregate without GROUP BY that is not a COUNT (COUNT returns 0 instead of NULL
+ *    for empty groups), and the expressions on top of the aggregate have to return NULL for NULL, too.
+ *  - NOT IN is not rewritten, as an anti join would not return NULL for NULLs in the subselect.
+ */
+class SubselectToJoinRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  // @return The plan that replaces the @param predicate_node, or nullptr if it cannot be rewritten
+  std::shared_ptr<AbstractLQPNode> _reformulate(const PredicateNode& predicate_node) const;
+};
+
+}  // namespace opossum
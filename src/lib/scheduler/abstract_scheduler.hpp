@@ -10,6 +10,7 @@ namespace opossum {
 class AbstractTask;
 class CurrentScheduler;
 class TaskQueue;
+class Worker;
 
 class AbstractScheduler {
   friend class CurrentScheduler;
@@ -36,6 +37,8 @@ class AbstractScheduler {
 
   virtual const std::vector<std::shared_ptr<TaskQueue>>& queues() const = 0;
 
+  virtual const std::vector<std::shared_ptr<Worker>>& workers() const = 0;
+
   virtual void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                         SchedulePriority priority = SchedulePriority::Default) = 0;
 };
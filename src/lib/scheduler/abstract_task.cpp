@@ -1,18 +1,32 @@
 #include "abstract_task.hpp"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
 #include "current_scheduler.hpp"
+#include "resource_group.hpp"
+#include "task_profiler.hpp"
 #include "task_queue.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+/**
+ * The ticket of the query whose task the current thread executes, if any. Inherited by the tasks it schedules.
+ */
+thread_local std::shared_ptr<opossum::QueryTicket> this_thread_query_ticket;
+
+}  // namespace
+
 namespace opossum {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -27,6 +41,13 @@ bool AbstractTask::is_done() const { return _done; }
 
 bool AbstractTask::is_stealable() const { return _stealable; }
 
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
+void AbstractTask::set_priority(SchedulePriority priority) {
+  DebugAssert(!_is_scheduled, "Cannot change the priority of a scheduled task");
+  _priority = priority;
+}
+
 bool AbstractTask::is_scheduled() const { return _is_scheduled; }
 
 std::string AbstractTask::description() const {
@@ -49,7 +70,14 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
-bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
+bool AbstractTask::try_mark_as_enqueued() {
+  if (_is_enqueued.exchange(true)) return false;
+
+  _enqueue_time = std::chrono::steady_clock::now();
+  return true;
+}
+
+std::chrono::steady_clock::time_point AbstractTask::enqueue_time() const { return _enqueue_time; }
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
@@ -57,10 +85,64 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
   _done_callback = done_callback;
 }
 
+void AbstractTask::set_query_ticket(const std::shared_ptr<QueryTicket>& query_ticket) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the query ticket after the Task was scheduled");
+
+  _query_ticket = query_ticket;
+}
+
+const std::shared_ptr<QueryTicket>& AbstractTask::query_ticket() const { return _query_ticket; }
+
+ResourceGroupID AbstractTask::resource_group_id() const {
+  return _query_ticket ? _query_ticket->resource_group()->id() : DEFAULT_RESOURCE_GROUP_ID;
+}
+
+void AbstractTask::set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the cancellation token after the Task was scheduled");
+
+  _cancellation_token = cancellation_token;
+}
+
+const std::shared_ptr<const CancellationToken>& AbstractTask::cancellation_token() const {
+  return _cancellation_token;
+}
+
+void AbstractTask::set_task_profiler(const std::shared_ptr<TaskProfiler>& task_profiler) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the task profiler after the Task was scheduled");
+
+  _task_profiler = task_profiler;
+}
+
+const std::shared_ptr<TaskProfiler>& AbstractTask::task_profiler() const { return _task_profiler; }
+
 void AbstractTask::schedule(NodeID preferred_node_id) {
   _mark_as_scheduled();
 
+  if (!_cancellation_token) _cancellation_token = CancellationToken::current();
+  if (!_hardware_counter_collector) _hardware_counter_collector = HardwareCounterScope::current_collector();
+  if (!_task_profiler) {
+    _task_profiler = TaskProfiler::current();
+    _profiled_operator = TaskProfiler::current_operator();
+  }
+
   if (CurrentScheduler::is_set()) {
+    // Jobs belong to the query of the task that spawns them. If the query has as many jobs in flight as it may have,
+    // the spawning task executes the job right away (see IN-FLIGHT JOBS in resource_group.hpp).
+    if (!_query_ticket && this_thread_query_ticket) {
+      _query_ticket = this_thread_query_ticket;
+
+      if (is_ready()) {
+        if (!_query_ticket->try_begin_job()) {
+          execute();
+          return;
+        }
+        _is_in_flight_job = true;
+      }
+    }
+
+    // Tasks of queries that are not admitted yet are handed to the Scheduler on admission
+    if (_query_ticket && _query_ticket->try_defer(shared_from_this(), preferred_node_id)) return;
+
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, _priority);
   } else {
     // If the Task isn't ready, it will execute() once its dependency counter reaches 0
@@ -76,11 +158,37 @@ void AbstractTask::_join() {
 }
 
 void AbstractTask::execute() {
+  [[maybe_unused]] const auto already_started = _started.exchange(true);
+  DebugAssert(!already_started, "Possible bug: Trying to execute the same task twice");
+  _execute();
+}
+
+bool AbstractTask::_try_mark_as_started() { return !_started.exchange(true); }
+
+void AbstractTask::_execute() {
   DTRACE_PROBE3(HYRISE, JOB_START, _id.load(), _description.c_str(), reinterpret_cast<uintptr_t>(this));
-  DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  auto previous_query_ticket = std::exchange(this_thread_query_ticket, _query_ticket);
+  auto previous_cancellation_token = CancellationToken::exchange_current(_cancellation_token);
+
+  // A cancelled task counts as done, so that nobody waits for it forever. Whoever waits for the query finds out that
+  // it was cancelled by checking its token.
+  try {
+    const auto hardware_counter_scope = HardwareCounterScope{_hardware_counter_collector};
+    const auto task_profiler_scope = TaskProfiler::Scope{_task_profiler, *this, _profiled_operator};
+    if (!_cancellation_token || !_cancellation_token->is_cancelled()) _on_execute();
+  } catch (const QueryCancelledException&) {
+    // Not this task's query, but, e.g., one that it executed through an SQLPipeline
+    if (!_cancellation_token || !_cancellation_token->is_cancelled()) {
+      CancellationToken::exchange_current(std::move(previous_cancellation_token));
+      this_thread_query_ticket = std::move(previous_query_ticket);
+      throw;
+    }
+  }
+
+  CancellationToken::exchange_current(std::move(previous_cancellation_token));
+  this_thread_query_ticket = std::move(previous_query_ticket);
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -88,6 +196,11 @@ void AbstractTask::execute() {
 
   if (_done_callback) _done_callback();
 
+  if (_is_in_flight_job) _query_ticket->end_job();
+  _query_ticket = nullptr;
+  _hardware_counter_collector = nullptr;
+  _task_profiler = nullptr;
+
   {
     std::lock_guard<std::mutex> lock(_done_mutex);
     _done = true;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -12,6 +13,10 @@
 
 namespace opossum {
 
+class CancellationToken;
+class HardwareCounterCollector;
+class QueryTicket;
+class TaskProfiler;
 class Worker;
 
 /**
@@ -21,6 +26,8 @@ class Worker;
  */
 class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   friend class CurrentScheduler;
+  friend class QueryTicket;
+  friend class Worker;
 
  public:
   explicit AbstractTask(SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
@@ -47,6 +54,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  /**
+   * The priority that the task is scheduled with, which can only be changed before it is scheduled
+   */
+  SchedulePriority priority() const;
+  void set_priority(SchedulePriority priority);
+
   /**
    * Description for debugging purposes
    */
@@ -85,6 +98,31 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_done_callback(const std::function<void()>& done_callback);
 
+  /**
+   * Executes the task as part of a query, see ResourceGroup. Tasks scheduled by this task inherit the ticket.
+   */
+  void set_query_ticket(const std::shared_ptr<QueryTicket>& query_ticket);
+  const std::shared_ptr<QueryTicket>& query_ticket() const;
+
+  /**
+   * The group of the task's query, or the default group if the task does not belong to a query
+   */
+  ResourceGroupID resource_group_id() const;
+
+  /**
+   * The task is skipped once the token is cancelled, see CancellationToken. Tasks scheduled by this task inherit the
+   * token.
+   */
+  void set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+  const std::shared_ptr<const CancellationToken>& cancellation_token() const;
+
+  /**
+   * The task records its execution into the profiler, see TaskProfiler. Tasks scheduled by this task inherit the
+   * profiler.
+   */
+  void set_task_profiler(const std::shared_ptr<TaskProfiler>& task_profiler);
+  const std::shared_ptr<TaskProfiler>& task_profiler() const;
+
   /**
    * Schedules the task if a Scheduler is available, otherwise just executes it on the current Thread
    */
@@ -102,11 +140,15 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool try_mark_as_enqueued();
 
+  /**
+   * When the task was marked as enqueued, for the queue wait times of the SchedulerStatistics
+   */
+  std::chrono::steady_clock::time_point enqueue_time() const;
+
   /**
    * Executes the task in the current Thread, blocks until all operations are finished
    */
   void execute();
-
  protected:
   virtual void _on_execute() = 0;
 
@@ -121,6 +163,15 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _on_predecessor_done();
 
+  /**
+   * Claims the task for the calling thread, which executes it with _execute() then. Tasks stay in their queues and
+   * deques when a worker that waits for them executes them (see Worker::_wait_for_tasks()), so whoever takes them out
+   * finds them claimed.
+   * @return false if another thread claimed the task already
+   */
+  bool _try_mark_as_started();
+  void _execute();
+
   /**
    * Blocks the calling thread until the Task finished executing.
    * This is only called from non-Worker threads and from CurrentScheduler::wait_for_tasks().
@@ -145,14 +196,31 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
 
+  // Written before the task is enqueued, read by the worker that takes it out
+  std::chrono::steady_clock::time_point _enqueue_time;
+
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
   std::mutex _done_mutex;
 
+  // Reset once the task is done, so that the query releases its admission slot when all of its tasks are done
+  std::shared_ptr<QueryTicket> _query_ticket;
+  bool _is_in_flight_job{false};
+
+  std::shared_ptr<const CancellationToken> _cancellation_token;
+
+  // Where the hardware counters of the task are counted, inherited from the scheduling thread (see
+  // HardwareCounterScope)
+  std::shared_ptr<HardwareCounterCollector> _hardware_counter_collector;
+
+  // Inherited from the scheduling thread, like the operator that a job belongs to (see TaskProfiler::current())
+  std::shared_ptr<TaskProfiler> _task_profiler;
+  std::string _profiled_operator;
+
   // Purely for debugging purposes, in order to be able to identify tasks after they have been scheduled
   std::string _description;
 
-  // To make sure a task is never executed twice
+  // Claimed by the thread that executes the task, so that a task is never executed twice
   std::atomic_bool _started{false};
 };
 
@@ -0,0 +1,53 @@
+#include "cancellation_token.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace {
+
+/**
+ * The token of the task that the current thread executes, if any. Inherited by the tasks it schedules.
+ */
+thread_local std::shared_ptr<const opossum::CancellationToken> this_thread_cancellation_token;
+
+}  // namespace
+
+namespace opossum {
+
+CancellationToken::CancellationToken(const std::shared_ptr<const CancellationToken>& parent) : _parent(parent) {}
+
+void CancellationToken::cancel() { _is_cancelled = true; }
+
+void CancellationToken::set_deadline(const std::chrono::steady_clock::time_point deadline) {
+  _deadline = deadline.time_since_epoch().count();
+}
+
+bool CancellationToken::is_cancelled() const {
+  if (_is_cancelled) return true;
+
+  const auto deadline = _deadline.load();
+  if (deadline >= 0 && std::chrono::steady_clock::now().time_since_epoch().count() >= deadline) return true;
+
+  return _parent && _parent->is_cancelled();
+}
+
+void CancellationToken::throw_if_cancelled() const {
+  if (is_cancelled()) throw QueryCancelledException{};
+}
+
+const std::shared_ptr<const CancellationToken>& CancellationToken::current() { return this_thread_cancellation_token; }
+
+std::shared_ptr<const CancellationToken> CancellationToken::exchange_current(
+    std::shared_ptr<const CancellationToken> token) {
+  return std::exchange(this_thread_cancellation_token, std::move(token));
+}
+
+bool CancellationToken::is_current_cancelled() {
+  return this_thread_cancellation_token && this_thread_cancellation_token->is_cancelled();
+}
+
+void CancellationToken::throw_if_current_cancelled() {
+  if (is_current_cancelled()) throw QueryCancelledException{};
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thrown by the tasks and operators of a query once its CancellationToken is cancelled
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what_arg = "Query was cancelled")
+      : std::runtime_error(what_arg) {}
+};
+
+/**
+ * Stops a running query, e.g., because the user gave up on it or because it exceeded its statement timeout (see
+ * SQLPipelineBuilder::with_cancellation_token() and with_statement_timeout()).
+ *
+ * Cancellation is cooperative: The tasks of a query and the tasks scheduled by them refer to its token. A task whose
+ * token is cancelled is not executed, but counts as done, so that whoever waits for it is not blocked. Long-running
+ * operators additionally check the token of the task that executes them between morsels (see
+ * throw_if_current_cancelled()). This unwinds the operator with a QueryCancelledException, which the task catches.
+ * CurrentScheduler::wait_for_tasks() checks the token, too, so that an operator does not continue with the results
+ * of jobs that were skipped.
+ *
+ * A token can have a parent, e.g., the token of a client session and the token of a single statement with a deadline.
+ * It is cancelled once its parent is.
+ */
+class CancellationToken : private Noncopyable {
+ public:
+  explicit CancellationToken(const std::shared_ptr<const CancellationToken>& parent = nullptr);
+
+  void cancel();
+
+  /**
+   * The token counts as cancelled once the deadline has passed
+   */
+  void set_deadline(const std::chrono::steady_clock::time_point deadline);
+
+  bool is_cancelled() const;
+
+  void throw_if_cancelled() const;
+
+  /**
+   * The token of the task that the current thread executes, if any
+   */
+  static const std::shared_ptr<const CancellationToken>& current();
+
+  /**
+   * Sets the token of the current thread and returns the previous one, used by AbstractTask::execute()
+   */
+  static std::shared_ptr<const CancellationToken> exchange_current(std::shared_ptr<const CancellationToken> token);
+
+  /**
+   * Whether the current token, if any, is cancelled. Cheap enough to be checked once per chunk or morsel.
+   */
+  static bool is_current_cancelled();
+
+  /**
+   * Throws a QueryCancelledException if the current token is cancelled. Only call this where no jobs that refer to the
+   * state of the caller are in flight, e.g., between the phases of an operator. In the functor of a MorselDispatcher,
+   * which checks the token before each morsel anyway, or in a job, this simply ends the job.
+   */
+  static void throw_if_current_cancelled();
+
+ private:
+  const std::shared_ptr<const CancellationToken> _parent;
+
+  std::atomic_bool _is_cancelled{false};
+
+  // In ticks since the epoch of the steady_clock, so that it can be atomic. Negative for no deadline.
+  std::atomic<std::chrono::steady_clock::rep> _deadline{std::chrono::steady_clock::rep{-1}};
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <utility>
 
 #include "abstract_task.hpp"
 
@@ -28,9 +29,11 @@ namespace opossum {
  */
 class JobTask : public AbstractTask {
  public:
-  explicit JobTask(const std::function<void()>& fn, SchedulePriority priority = SchedulePriority::Default,
+  // std::function stores small lambdas (with libstdc++, those that capture up to two references) without allocating.
+  // Larger ones are allocated once and moved into the task instead of being copied.
+  explicit JobTask(std::function<void()> fn, SchedulePriority priority = SchedulePriority::Default,
                    bool stealable = true)
-      : AbstractTask(priority, stealable), _fn(fn) {}
+      : AbstractTask(priority, stealable), _fn(std::move(fn)) {}
 
  protected:
   void _on_execute() override;
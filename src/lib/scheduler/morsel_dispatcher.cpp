@@ -0,0 +1,146 @@
+#include "morsel_dispatcher.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "storage/table.hpp"
+#include "task_queue.hpp"
+#include "topology.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MorselDispatcher::MorselDispatcher(const std::vector<size_t>& item_sizes, const size_t morsel_size)
+    : MorselDispatcher{item_sizes, std::vector<NodeID>(item_sizes.size(), INVALID_NODE_ID), morsel_size} {}
+
+MorselDispatcher::MorselDispatcher(const std::vector<size_t>& item_sizes, const std::vector<NodeID>& item_node_ids,
+                                   const size_t morsel_size) {
+  DebugAssert(morsel_size > 0, "Morsels must not be empty");
+  DebugAssert(item_node_ids.size() == item_sizes.size(), "Need one node per item");
+
+  // Empty items do not complete a morsel, so the rows alone do not tell whether a morsel is open
+  auto morsel_is_open = false;
+  auto rows_in_morsel = size_t{0};
+  for (auto item_index = size_t{0}; item_index < item_sizes.size(); ++item_index) {
+    // Items of another node start a new morsel, so that each morsel can be processed on a single node
+    if (morsel_is_open && item_node_ids[item_index] != _morsel_node_ids.back()) morsel_is_open = false;
+
+    if (!morsel_is_open) {
+      _morsel_begins.emplace_back(item_index);
+      _morsel_node_ids.emplace_back(item_node_ids[item_index]);
+      morsel_is_open = true;
+      rows_in_morsel = 0;
+    }
+
+    rows_in_morsel += item_sizes[item_index];
+    if (rows_in_morsel >= morsel_size) morsel_is_open = false;
+  }
+  _morsel_begins.emplace_back(item_sizes.size());
+}
+
+MorselDispatcher::MorselDispatcher(const Table& table, const size_t morsel_size)
+    : MorselDispatcher{[&]() {
+                         auto chunk_sizes = std::vector<size_t>(table.chunk_count());
+                         for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+                           chunk_sizes[chunk_id] = table.get_chunk(chunk_id)->size();
+                         }
+                         return chunk_sizes;
+                       }(),
+                       [&]() {
+                         auto chunk_node_ids = std::vector<NodeID>(table.chunk_count());
+                         for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+                           const auto& allocator = table.get_chunk(chunk_id)->get_allocator();
+                           chunk_node_ids[chunk_id] = Topology::get().get_node_id(allocator.resource());
+                         }
+                         return chunk_node_ids;
+                       }(),
+                       morsel_size} {}
+
+size_t MorselDispatcher::morsel_count() const { return _morsel_begins.size() - 1; }
+
+std::pair<size_t, size_t> MorselDispatcher::morsel(const size_t morsel_index) const {
+  DebugAssert(morsel_index < morsel_count(), "Morsel index out of range");
+  return {_morsel_begins[morsel_index], _morsel_begins[morsel_index + 1]};
+}
+
+NodeID MorselDispatcher::morsel_node_id(const size_t morsel_index) const {
+  DebugAssert(morsel_index < morsel_count(), "Morsel index out of range");
+  return _morsel_node_ids[morsel_index];
+}
+
+void MorselDispatcher::run(const std::function<void(size_t)>& functor) const {
+  const auto process_morsel = [&](const size_t morsel_index) {
+    // Ends the job, or run() if this is the calling thread, once the query is cancelled
+    CancellationToken::throw_if_current_cancelled();
+
+    const auto [begin, end] = morsel(morsel_index);
+    for (auto item_index = begin; item_index < end; ++item_index) {
+      functor(item_index);
+    }
+  };
+
+  const auto worker_count = CurrentScheduler::is_set() ? CurrentScheduler::get()->workers().size() : size_t{0};
+  const auto job_count = std::min(worker_count, morsel_count());
+
+  if (job_count <= 1) {
+    for (auto morsel_index = size_t{0}; morsel_index < morsel_count(); ++morsel_index) {
+      process_morsel(morsel_index);
+    }
+    return;
+  }
+
+  // Group the morsels by node. The last group holds the morsels without a (known) node.
+  const auto& scheduler = CurrentScheduler::get();
+  const auto node_count = scheduler->queues().size();
+  const auto group_count = node_count + 1;
+
+  auto group_morsel_indices = std::vector<std::vector<size_t>>(group_count);
+  for (auto morsel_index = size_t{0}; morsel_index < morsel_count(); ++morsel_index) {
+    const auto node_id = static_cast<size_t>(morsel_node_id(morsel_index));
+    group_morsel_indices[node_id < node_count ? node_id : node_count].emplace_back(morsel_index);
+  }
+
+  auto group_worker_counts = std::vector<size_t>(group_count);
+  for (const auto& worker : scheduler->workers()) {
+    ++group_worker_counts[worker->queue()->node_id()];
+  }
+  group_worker_counts[node_count] = worker_count;
+
+  // Value-initialized, i.e., zero
+  auto next_positions = std::vector<std::atomic<size_t>>(group_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto group = size_t{0}; group < group_count; ++group) {
+    const auto group_job_count = std::min(group_worker_counts[group], group_morsel_indices[group].size());
+    for (auto job_index = size_t{0}; job_index < group_job_count; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, group]() {
+        // Take the morsels of the own group first, then help with those of the others
+        for (auto group_offset = size_t{0}; group_offset < group_count; ++group_offset) {
+          const auto current_group = (group + group_offset) % group_count;
+          const auto& morsel_indices = group_morsel_indices[current_group];
+          auto& next_position = next_positions[current_group];
+          for (auto position = next_position++; position < morsel_indices.size(); position = next_position++) {
+            process_morsel(morsel_indices[position]);
+          }
+        }
+      }));
+
+      if (group < node_count) {
+        jobs.back()->schedule(static_cast<NodeID>(group));
+      } else {
+        jobs.back()->schedule();
+      }
+    }
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+}  // namespace opossum
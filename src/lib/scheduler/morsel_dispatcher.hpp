@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Parallelizes the processing of a range of work items, usually the chunks of a table, and is the common way for
+ * operators to do so.
+ *
+ * Instead of one JobTask per item, consecutive items are combined into morsels of at least `morsel_size` rows, and at
+ * most one JobTask per worker is scheduled. Each job repeatedly grabs the next unprocessed morsel, so that
+ *  - tables with many tiny chunks do not pay for scheduling a task per chunk, and
+ *  - jobs that finish early take over the remaining morsels instead of waiting for a straggler.
+ *
+ * Items are never split, as the operators process whole chunks. Items can be assigned to the NUMA node that holds
+ * their data, e.g., the node that a chunk was migrated to (see NUMAPlacementManager). Morsels never span nodes, and
+ * for each node, as many jobs as it has workers are scheduled to the TaskQueue of the node. These jobs process the
+ * morsels of their node first and only then help with those of other nodes. The jobs for items without a node are
+ * scheduled from the calling worker, so they are taken by workers of its node first (see NodeQueueScheduler).
+ * Without a scheduler, or if there is only a single morsel, all items are processed on the calling thread.
+ *
+ * Usage example:
+ *
+ *   auto chunk_sizes = std::vector<size_t>{};
+ *   for (...) chunk_sizes.emplace_back(table->get_chunk(chunk_id)->size());
+ *   MorselDispatcher{chunk_sizes}.run([&](const size_t chunk_index) { ...; });
+ */
+class MorselDispatcher {
+ public:
+  /**
+   * A morsel of rows pays for the overhead of a task many times over and still leaves enough morsels for load
+   * balancing in medium-sized tables.
+   */
+  static constexpr auto DEFAULT_MORSEL_SIZE = size_t{10'000};
+
+  /**
+   * @param item_sizes  The number of rows of each work item
+   */
+  explicit MorselDispatcher(const std::vector<size_t>& item_sizes, const size_t morsel_size = DEFAULT_MORSEL_SIZE);
+
+  /**
+   * @param item_node_ids  The node of each work item, INVALID_NODE_ID for items without one
+   */
+  MorselDispatcher(const std::vector<size_t>& item_sizes, const std::vector<NodeID>& item_node_ids,
+                   const size_t morsel_size = DEFAULT_MORSEL_SIZE);
+
+  /**
+   * Uses the chunks of the table as items, with the nodes that their memory resources belong to (see
+   * Topology::get_node_id())
+   */
+  explicit MorselDispatcher(const Table& table, const size_t morsel_size = DEFAULT_MORSEL_SIZE);
+
+  size_t morsel_count() const;
+
+  /**
+   * The range [begin, end) of items in a morsel
+   */
+  std::pair<size_t, size_t> morsel(const size_t morsel_index) const;
+
+  /**
+   * The node of the items in a morsel, INVALID_NODE_ID if they have none
+   */
+  NodeID morsel_node_id(const size_t morsel_index) const;
+
+  /**
+   * Calls functor(item_index) once for every item and returns once all calls finished. Calls for items of the same
+   * morsel happen in order on the same thread. Throws a QueryCancelledException if the query is cancelled (see
+   * CancellationToken), in which case the remaining morsels are skipped.
+   */
+  void run(const std::function<void(size_t)>& functor) const;
+
+ private:
+  // The first item of each morsel, followed by the number of items
+  std::vector<size_t> _morsel_begins;
+  std::vector<NodeID> _morsel_node_ids;
+};
+
+}  // namespace opossum
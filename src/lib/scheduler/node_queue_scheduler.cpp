@@ -14,6 +14,7 @@
 
 #include "uid_allocator.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
 
 namespace opossum {
 
@@ -75,6 +76,20 @@ void NodeQueueScheduler::finish() {
 
   _active = false;
 
+  if (_statistics_dump_thread.joinable()) {
+    // Taking the mutex makes sure that the dump thread is either waiting or sees that the scheduler is inactive
+    {
+      std::lock_guard<std::mutex> lock{_statistics_dump_mutex};
+      _statistics_dump_condition.notify_all();
+    }
+    _statistics_dump_thread.join();
+  }
+
+  // Wake up the idle workers so that they notice the shutdown right away
+  for (auto& queue : _queues) {
+    queue->notify_all();
+  }
+
   for (auto& worker : _workers) {
     worker->join();
   }
@@ -86,8 +101,41 @@ void NodeQueueScheduler::finish() {
 
 bool NodeQueueScheduler::active() const { return _active; }
 
+SchedulerStatistics NodeQueueScheduler::statistics() const {
+  auto statistics = SchedulerStatistics{};
+  statistics.workers.reserve(_workers.size());
+  for (const auto& worker : _workers) {
+    statistics.workers.emplace_back(worker->statistics());
+  }
+  statistics.queues.reserve(_queues.size());
+  for (const auto& queue : _queues) {
+    statistics.queues.emplace_back(queue->statistics());
+  }
+  return statistics;
+}
+
+void NodeQueueScheduler::dump_statistics_periodically(const std::chrono::milliseconds interval,
+                                                      std::ostream& stream) {
+  Assert(_active, "The scheduler has to begin before its statistics can be dumped");
+  Assert(!_statistics_dump_thread.joinable(), "The statistics are dumped already");
+
+  _statistics_dump_thread = std::thread([&, interval]() {
+    auto previous_statistics = statistics();
+
+    auto lock = std::unique_lock<std::mutex>{_statistics_dump_mutex};
+    while (!_statistics_dump_condition.wait_for(lock, interval, [&]() { return !_active; })) {
+      auto current_statistics = statistics();
+      stream << "Scheduler statistics of the last " << format_duration(interval) << ":" << std::endl;
+      (current_statistics - previous_statistics).print(stream);
+      previous_statistics = std::move(current_statistics);
+    }
+  });
+}
+
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -105,6 +153,11 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
+      // Tasks spawned by a running task go to the deque of its worker, see WORKER DEQUES in the header
+      if (priority == SchedulePriority::Default && task->is_stealable()) {
+        worker->push_local_task(task);
+        return;
+      }
       preferred_node_id = worker->queue()->node_id();
     } else {
       // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
@@ -1,11 +1,16 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "scheduler_statistics.hpp"
 
 namespace opossum {
 
@@ -54,6 +59,38 @@ namespace opossum {
  * on non-NUMA development machines.
  *
  *
+ * WORKER DEQUES
+ *
+ * Tasks that are scheduled by a task running on a worker (e.g., the JobTasks of a TableScan, one per chunk) do not
+ * go to the TaskQueue of the node, which all workers of the node would contend on. Instead, they are pushed to the
+ * WorkStealingDeque of the worker. The worker takes them from its deque in LIFO order while it waits for them, so
+ * that their data is likely still cached. Idle workers steal from the deques of randomly chosen workers in FIFO
+ * order, preferring the workers of their own node. This only applies to stealable tasks with the default priority.
+ *
+ *
+ * NUMA-LOCAL JOBS
+ *
+ * The jobs of chunk-parallel operators are scheduled to the TaskQueue of the node that holds the chunks they process,
+ * see MorselDispatcher.
+ *
+ *
+ * RESOURCE GROUPS
+ *
+ * Queries can be executed in resource groups, which share the workers by weight, limit the number of running queries
+ * and the number of jobs per query. See resource_group.hpp.
+ *
+ *
+ * CANCELLATION
+ *
+ * The tasks of a cancelled query are skipped, and long-running operators stop early. See cancellation_token.hpp.
+ *
+ *
+ * STATISTICS
+ *
+ * The workers and queues count where their tasks come from, how long the tasks waited, and how long the workers were
+ * busy or idle. See scheduler_statistics.hpp.
+ *
+ *
  * WORK STEALING
  *
  * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
@@ -64,10 +101,10 @@ namespace opossum {
  * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
  * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
  * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Therefore, the current worker first tries the deques of the workers of its own node. Only once it found no task
+ * for a number of iterations, i.e., once the workers of the remote nodes had the chance to pull their tasks, it steals
+ * from the deques of remote workers and from the remote queues. Afterwards, the current worker is checking its local
+ * queue again.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -96,6 +133,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -104,12 +143,25 @@ class NodeQueueScheduler : public AbstractScheduler {
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Default) override;
 
+  // A snapshot of the counters of all workers and queues
+  SchedulerStatistics statistics() const;
+
+  /**
+   * Prints the statistics of each @param interval (i.e., the difference of two snapshots) to the @param stream from a
+   * background thread, until the scheduler finishes. Must be called after begin().
+   */
+  void dump_statistics_periodically(const std::chrono::milliseconds interval, std::ostream& stream = std::cout);
+
  private:
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _active{false};
+
+  std::thread _statistics_dump_thread;
+  std::mutex _statistics_dump_mutex;
+  std::condition_variable _statistics_dump_condition;
 };
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -9,11 +11,79 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "scheduler/worker.hpp"
+#include "storage/table.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
+
+namespace {
+
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+
+    // Visit the inputs of each operator only once, even if it has multiple consumers
+    if (consumer_counts[input]++ == 0) count_consumers(input, consumer_counts);
+  }
+}
+
+// Gives the tasks on the longest chain of dependent tasks (i.e., the critical path) a high priority, so that the
+// Scheduler starts them before the tasks of shorter branches, which can wait without delaying the root. E.g., the
+// deeper input of a join is started first. Each task is weighted by the number of operators it executes.
+void prioritize_critical_path(const std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  auto task_indices = std::unordered_map<const AbstractTask*, size_t>{};
+  for (auto task_idx = size_t{0}; task_idx < tasks.size(); ++task_idx) {
+    task_indices.emplace(tasks[task_idx].get(), task_idx);
+  }
+
+  const auto weight = [&](const size_t task_idx) {
+    return std::max(tasks[task_idx]->pipelined_operators().size(), size_t{1});
+  };
+
+  // The longest chains from any leaf to each task and from each task to the root, both including the task. The
+  // predecessors of each task come before it.
+  auto path_from_leaves = std::vector<size_t>(tasks.size());
+  for (auto task_idx = size_t{0}; task_idx < tasks.size(); ++task_idx) {
+    for (const auto& predecessor : tasks[task_idx]->predecessors()) {
+      const auto predecessor_idx = task_indices.at(predecessor.lock().get());
+      path_from_leaves[task_idx] = std::max(path_from_leaves[task_idx], path_from_leaves[predecessor_idx]);
+    }
+    path_from_leaves[task_idx] += weight(task_idx);
+  }
+
+  auto path_to_root = std::vector<size_t>(tasks.size());
+  for (auto task_idx = tasks.size(); task_idx-- > 0;) {
+    for (const auto& successor : tasks[task_idx]->successors()) {
+      const auto successor_idx = task_indices.at(successor.get());
+      path_to_root[task_idx] = std::max(path_to_root[task_idx], path_to_root[successor_idx]);
+    }
+    path_to_root[task_idx] += weight(task_idx);
+  }
+
+  const auto critical_path_length = *std::max_element(path_from_leaves.begin(), path_from_leaves.end());
+  auto is_critical = std::vector<bool>(tasks.size());
+  for (auto task_idx = size_t{0}; task_idx < tasks.size(); ++task_idx) {
+    const auto longest_path = path_from_leaves[task_idx] + path_to_root[task_idx] - weight(task_idx);
+    is_critical[task_idx] = longest_path == critical_path_length;
+  }
+
+  // Without independent branches, e.g., for a chain of tasks, there is nothing to choose from
+  if (std::all_of(is_critical.begin(), is_critical.end(), [](const auto critical) { return critical; })) return;
+
+  for (auto task_idx = size_t{0}; task_idx < tasks.size(); ++task_idx) {
+    if (is_critical[task_idx]) tasks[task_idx]->set_priority(SchedulePriority::High);
+  }
+}
+
+}  // namespace
+
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
                            SchedulePriority priority, bool stealable)
     : AbstractTask(priority, stealable), _op(std::move(op)), _cleanup_temporaries(cleanup_temporaries) {}
@@ -26,27 +96,53 @@ const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_o
     const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_counts;
+  count_consumers(op, consumer_counts);
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, consumer_counts, cleanup_temporaries);
+  prioritize_critical_path(tasks);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts,
     CleanupTemporaries cleanup_temporaries) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
-  task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
+  // Walk down the chain of operators that can be executed in a pipeline together with op, see the class comment
+  auto pipeline = std::vector<std::shared_ptr<AbstractOperator>>{op};
+  if (cleanup_temporaries == CleanupTemporaries::Yes && !op->is_pipeline_breaker()) {
+    while (!pipeline.back()->input_right()) {
+      const auto input = pipeline.back()->mutable_input_left();
+      if (!input || input->is_pipeline_breaker() || input->needs_ordered_pipelined_chunks() ||
+          consumer_counts.at(input) != 1) {
+        break;
+      }
+      pipeline.emplace_back(input);
+    }
+  }
+
+  for (const auto& pipelined_operator : pipeline) {
+    task_by_op.emplace(pipelined_operator, task);
+  }
+  if (pipeline.size() > 1) task->_pipelined_operators.assign(pipeline.rbegin(), pipeline.rend());
+
+  // Only the first operator of a pipeline has inputs outside of it
+  const auto& first_operator = pipeline.back();
+
+  if (auto left = first_operator->mutable_input_left()) {
+    auto subtree_root =
+        OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, consumer_counts, cleanup_temporaries);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
+  if (auto right = first_operator->mutable_input_right()) {
+    auto subtree_root =
+        OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, consumer_counts, cleanup_temporaries);
     subtree_root->set_as_predecessor_of(task);
   }
 
@@ -58,6 +154,10 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorTask::pipelined_operators() const {
+  return _pipelined_operators;
+}
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -83,7 +183,11 @@ void OperatorTask::_on_execute() {
   }
 
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  if (_pipelined_operators.empty()) {
+    _op->execute();
+  } else {
+    _execute_pipeline();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -116,4 +220,90 @@ void OperatorTask::_on_execute() {
     }
   }
 }
+
+void OperatorTask::_execute_pipeline() {
+  // As in AbstractOperator::execute(), the operators of an aborted transaction are not executed
+  const auto transaction_context = _op->transaction_context();
+  if (transaction_context && transaction_context->aborted()) return;
+
+  auto stage_begin = size_t{0};
+  while (stage_begin < _pipelined_operators.size()) {
+    CancellationToken::throw_if_current_cancelled();
+
+    const auto chunk_sizes = _pipelined_operators[stage_begin]->pipelined_input_chunk_sizes();
+    const auto chunk_count = ChunkID{static_cast<ChunkID::base_type>(chunk_sizes.size())};
+
+    // The chunks of a References table are released as soon as the next operator has processed them, as no other
+    // operator references them. The chunks of a data table (e.g., of a Projection that evaluates expressions) might be
+    // referenced by the output of the following operators, so the pipeline is split into stages after such operators.
+    auto stage_end = stage_begin;
+    do {
+      _pipelined_operators[stage_end]->begin_pipelined_execution(chunk_count);
+      ++stage_end;
+    } while (stage_end < _pipelined_operators.size() &&
+             _pipelined_operators[stage_end - 1]->get_output()->type() == TableType::References);
+
+    _execute_pipeline_stage(stage_begin, stage_end, chunk_sizes);
+
+    for (auto operator_index = stage_begin; operator_index < stage_end; ++operator_index) {
+      _pipelined_operators[operator_index]->end_pipelined_execution();
+    }
+
+    // The output of the previous stage was the input of this one. Within the stage, only the output of the last
+    // operator holds any chunks.
+    if (stage_begin > 0) _pipelined_operators[stage_begin - 1]->clear_output();
+    for (auto operator_index = stage_begin; operator_index + 1 < stage_end; ++operator_index) {
+      _pipelined_operators[operator_index]->clear_output();
+    }
+
+    stage_begin = stage_end;
+  }
+}
+
+void OperatorTask::_execute_pipeline_stage(const size_t stage_begin, const size_t stage_end,
+                                           const std::vector<size_t>& chunk_sizes) {
+  // Pushes an input chunk through the operators [stage_begin, operators_end) of the stage
+  const auto process_chunk = [&](const ChunkID chunk_id, const size_t operators_end) {
+    for (auto operator_index = stage_begin; operator_index < operators_end; ++operator_index) {
+      const auto has_output = _pipelined_operators[operator_index]->execute_pipelined_chunk(chunk_id);
+      if (operator_index > stage_begin) _pipelined_operators[operator_index - 1]->release_pipelined_chunk(chunk_id);
+      if (!has_output) return;
+    }
+  };
+
+  const auto& last_operator = _pipelined_operators[stage_end - 1];
+  if (!last_operator->needs_ordered_pipelined_chunks()) {
+    MorselDispatcher{chunk_sizes}.run([&](const size_t chunk_index) {
+      process_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_index)}, stage_end);
+    });
+    return;
+  }
+
+  // The last operator has to process the chunks in order. The other operators process batches of chunks in parallel,
+  // so that the pipeline stops early once the output of the last operator is complete (e.g., a Limit has its rows).
+  const auto batch_size = CurrentScheduler::is_set() ? CurrentScheduler::get()->workers().size() : size_t{1};
+  const auto previous_operator = stage_end - 1 > stage_begin ? _pipelined_operators[stage_end - 2] : nullptr;
+
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_sizes.size(); batch_begin += batch_size) {
+    if (last_operator->pipelined_output_is_complete()) break;
+    CancellationToken::throw_if_current_cancelled();
+
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_sizes.size());
+    const auto batch_chunk_sizes =
+        std::vector<size_t>(chunk_sizes.begin() + batch_begin, chunk_sizes.begin() + batch_end);
+    MorselDispatcher{batch_chunk_sizes}.run([&](const size_t chunk_index) {
+      process_chunk(ChunkID{static_cast<ChunkID::base_type>(batch_begin + chunk_index)}, stage_end - 1);
+    });
+
+    for (auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(batch_begin)}; chunk_id < batch_end; ++chunk_id) {
+      if (!previous_operator) {
+        last_operator->execute_pipelined_chunk(chunk_id);
+      } else if (previous_operator->get_output()->get_chunk(chunk_id)) {
+        last_operator->execute_pipelined_chunk(chunk_id);
+        previous_operator->release_pipelined_chunk(chunk_id);
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -12,6 +12,19 @@ class AbstractOperator;
 
 /**
  * Makes an AbstractOperator scheduleable
+ *
+ * With CleanupTemporaries::Yes, make_tasks_from_operator() creates a single task for each chain of operators that are
+ * not pipeline breakers. The task executes them as a pipeline (see "Pipelined execution" in AbstractOperator), so that
+ * only the output of the last operator of the chain is materialized as a whole. An operator joins the pipeline of its
+ * consumer if
+ *  - neither of them is a pipeline breaker,
+ *  - it has no other consumer and the consumer has no right input, and
+ *  - it does not need ordered chunks, which only the last operator of a pipeline can have.
+ * The operator of such a task is the last operator of its pipeline. Intermediate results are not cleaned up with
+ * CleanupTemporaries::No, so then each operator keeps its own task.
+ *
+ * If the PQP has independent branches (e.g., the inputs of a join), the tasks on the longest chain of dependent tasks
+ * get SchedulePriority::High, so that the Scheduler starts the critical path first.
  */
 class OperatorTask : public AbstractTask {
  public:
@@ -27,6 +40,9 @@ class OperatorTask : public AbstractTask {
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  // The operators that the task executes as a pipeline, from first to last. Empty if it only executes get_operator().
+  const std::vector<std::shared_ptr<AbstractOperator>>& pipelined_operators() const;
+
   std::string description() const override;
 
  protected:
@@ -34,15 +50,24 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
-   * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param task_by_op       Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param consumer_counts  The number of consumers of each operator in the PQP
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts,
       CleanupTemporaries cleanup_temporaries);
 
  private:
+  void _execute_pipeline();
+
+  // Executes the operators [stage_begin, stage_end) of the pipeline, which are already begun
+  void _execute_pipeline_stage(const size_t stage_begin, const size_t stage_end,
+                               const std::vector<size_t>& chunk_sizes);
+
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+  std::vector<std::shared_ptr<AbstractOperator>> _pipelined_operators;
 };
 }  // namespace opossum
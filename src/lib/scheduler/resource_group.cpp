@@ -0,0 +1,197 @@
+#include "resource_group.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
+#include "current_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ResourceGroup::Registry::Registry() {
+  resource_groups[DEFAULT_RESOURCE_GROUP_ID] = std::shared_ptr<ResourceGroup>(
+      new ResourceGroup(DEFAULT_RESOURCE_GROUP_ID, "default", 1, 0, 0));  // NOLINT - the constructor is private
+  resource_group_count = 1;
+}
+
+ResourceGroup::Registry& ResourceGroup::_registry() {
+  static auto registry = Registry{};
+  return registry;
+}
+
+std::shared_ptr<ResourceGroup> ResourceGroup::create(const std::string& name, const uint32_t weight,
+                                                     const size_t max_running_queries,
+                                                     const size_t max_in_flight_jobs_per_query) {
+  Assert(weight > 0, "The weight of a resource group has to be positive");
+
+  auto& registry = _registry();
+  std::lock_guard<std::mutex> lock{registry.mutex};
+
+  const auto id = static_cast<ResourceGroupID>(registry.resource_group_count.load());
+  Assert(id < MAX_RESOURCE_GROUP_COUNT, "Too many resource groups");
+
+  auto resource_group = std::shared_ptr<ResourceGroup>(
+      new ResourceGroup(id, name, weight, max_running_queries, max_in_flight_jobs_per_query));  // NOLINT
+  registry.resource_groups[id] = resource_group;
+
+  // Published only now, so that readers of get() never see an empty slot
+  registry.resource_group_count.store(id + 1, std::memory_order_release);
+
+  return resource_group;
+}
+
+const std::shared_ptr<ResourceGroup>& ResourceGroup::default_group() {
+  return _registry().resource_groups[DEFAULT_RESOURCE_GROUP_ID];
+}
+
+const std::shared_ptr<ResourceGroup>& ResourceGroup::get(const ResourceGroupID resource_group_id) {
+  auto& registry = _registry();
+  DebugAssert(resource_group_id < registry.resource_group_count.load(std::memory_order_acquire),
+              "Unknown resource group");
+  return registry.resource_groups[resource_group_id];
+}
+
+size_t ResourceGroup::count() { return _registry().resource_group_count.load(std::memory_order_acquire); }
+
+ResourceGroup::ResourceGroup(const ResourceGroupID id, const std::string& name, const uint32_t weight,
+                             const size_t max_running_queries, const size_t max_in_flight_jobs_per_query)
+    : _id(id),
+      _name(name),
+      _weight(weight),
+      _max_running_queries(max_running_queries),
+      _max_in_flight_jobs_per_query(max_in_flight_jobs_per_query) {}
+
+ResourceGroupID ResourceGroup::id() const { return _id; }
+
+const std::string& ResourceGroup::name() const { return _name; }
+
+uint32_t ResourceGroup::weight() const { return _weight; }
+
+size_t ResourceGroup::max_running_queries() const { return _max_running_queries; }
+
+size_t ResourceGroup::max_in_flight_jobs_per_query() const { return _max_in_flight_jobs_per_query; }
+
+void ResourceGroup::charge(const std::chrono::nanoseconds execution_time) {
+  const auto cost = static_cast<uint64_t>(std::max(execution_time.count(), int64_t{0})) / _weight;
+
+  auto virtual_time = _virtual_time.load();
+  auto new_virtual_time = uint64_t{0};
+  do {
+    // A group that was idle for a while does not get to catch up on its share, see the class comment
+    new_virtual_time = std::max(virtual_time, _min_virtual_time()) + cost;
+  } while (!_virtual_time.compare_exchange_weak(virtual_time, new_virtual_time));
+
+  auto& max_virtual_time = _registry().max_virtual_time;
+  auto current_max_virtual_time = max_virtual_time.load();
+  while (current_max_virtual_time < new_virtual_time &&
+         !max_virtual_time.compare_exchange_weak(current_max_virtual_time, new_virtual_time)) {
+  }
+}
+
+uint64_t ResourceGroup::virtual_time() const { return std::max(_virtual_time.load(), _min_virtual_time()); }
+
+std::shared_ptr<QueryTicket> ResourceGroup::queue_query() {
+  auto query_ticket = std::make_shared<QueryTicket>(get(_id));
+
+  {
+    std::lock_guard<std::mutex> lock{_admission_mutex};
+    if (_max_running_queries != 0 && _running_query_count >= _max_running_queries) {
+      _admission_queue.emplace_back(query_ticket);
+      return query_ticket;
+    }
+    ++_running_query_count;
+  }
+
+  query_ticket->_admit();
+  return query_ticket;
+}
+
+size_t ResourceGroup::running_query_count() const {
+  std::lock_guard<std::mutex> lock{_admission_mutex};
+  return _running_query_count;
+}
+
+uint64_t ResourceGroup::_min_virtual_time() {
+  const auto max_virtual_time = _registry().max_virtual_time.load();
+  const auto lag = static_cast<uint64_t>(MAX_VIRTUAL_TIME_LAG.count());
+  return max_virtual_time > lag ? max_virtual_time - lag : uint64_t{0};
+}
+
+void ResourceGroup::_on_query_finished() {
+  auto next_query_ticket = std::shared_ptr<QueryTicket>{};
+
+  {
+    std::lock_guard<std::mutex> lock{_admission_mutex};
+    --_running_query_count;
+
+    // Tickets of queries that were given up while they were queued have expired
+    while (!_admission_queue.empty() && !next_query_ticket) {
+      next_query_ticket = _admission_queue.front().lock();
+      _admission_queue.pop_front();
+    }
+
+    if (!next_query_ticket) return;
+    ++_running_query_count;
+  }
+
+  next_query_ticket->_admit();
+}
+
+QueryTicket::QueryTicket(const std::shared_ptr<ResourceGroup>& resource_group) : _resource_group(resource_group) {}
+
+QueryTicket::~QueryTicket() {
+  if (_is_admitted) _resource_group->_on_query_finished();
+}
+
+const std::shared_ptr<ResourceGroup>& QueryTicket::resource_group() const { return _resource_group; }
+
+bool QueryTicket::is_admitted() const { return _is_admitted; }
+
+bool QueryTicket::try_defer(const std::shared_ptr<AbstractTask>& task, const NodeID preferred_node_id) {
+  if (_is_admitted) return false;
+
+  std::lock_guard<std::mutex> lock{_deferred_tasks_mutex};
+  if (_is_admitted) return false;
+
+  _deferred_tasks.emplace_back(task, preferred_node_id);
+  return true;
+}
+
+bool QueryTicket::try_begin_job() {
+  const auto max_in_flight_jobs = _resource_group->max_in_flight_jobs_per_query();
+  if (max_in_flight_jobs == 0) return true;
+
+  if (_in_flight_job_count++ < max_in_flight_jobs) return true;
+
+  --_in_flight_job_count;
+  return false;
+}
+
+void QueryTicket::end_job() {
+  if (_resource_group->max_in_flight_jobs_per_query() == 0) return;
+
+  DebugAssert(_in_flight_job_count > 0, "More jobs ended than began");
+  --_in_flight_job_count;
+}
+
+void QueryTicket::_admit() {
+  auto deferred_tasks = std::vector<std::pair<std::shared_ptr<AbstractTask>, NodeID>>{};
+
+  {
+    std::lock_guard<std::mutex> lock{_deferred_tasks_mutex};
+    _is_admitted = true;
+    deferred_tasks = std::move(_deferred_tasks);
+  }
+
+  // The tasks were already marked as scheduled, so they skip AbstractTask::schedule()
+  for (const auto& [task, preferred_node_id] : deferred_tasks) {
+    CurrentScheduler::get()->schedule(task, preferred_node_id, task->_priority);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class QueryTicket;
+
+/**
+ * Resource groups let different kinds of queries, e.g., short transactions and long-running reports, share the
+ * workers without one of them driving up the latency of the other. Queries are executed in a group (see
+ * SQLPipelineBuilder::with_resource_group()), and so are their tasks and the jobs spawned by these tasks. All other
+ * tasks belong to the default group.
+ *
+ *
+ * WEIGHTED FAIR SCHEDULING
+ *
+ * Workers charge the time they spend on a task to its group, divided by the group's weight. A TaskQueue hands out the
+ * tasks of the group with the lowest of these virtual times first, so that the groups with tasks in the queue get
+ * workers in proportion to their weights. A group that was idle for a while does not get to catch up on its share, as
+ * its virtual time never falls more than MAX_VIRTUAL_TIME_LAG behind the highest virtual time of all groups.
+ * Tasks in the deques of the workers (see WORKER DEQUES in node_queue_scheduler.hpp) are not subject to this. Idle
+ * workers pull from the TaskQueue before stealing from these deques, though.
+ *
+ *
+ * ADMISSION CONTROL
+ *
+ * A group runs at most max_running_queries queries at once. The tasks of further queries wait in a FIFO admission
+ * queue and are handed to the Scheduler once a running query finishes. Waiting for them does not block a worker, as it
+ * works on other tasks in the meantime. Without a Scheduler, tasks run when they are scheduled, admitted or not.
+ *
+ *
+ * IN-FLIGHT JOBS
+ *
+ * A query has at most max_in_flight_jobs_per_query jobs scheduled at once. A task that spawns further jobs executes
+ * them itself, so that a single query cannot flood the workers with jobs.
+ *
+ *
+ * The TaskQueues refer to the groups by their ResourceGroupID, so groups live as long as the program does. They are
+ * meant to be created once, e.g., one for transactions and one for reports.
+ */
+class ResourceGroup : private Noncopyable {
+ public:
+  static constexpr auto MAX_RESOURCE_GROUP_COUNT = size_t{16};
+  static constexpr auto MAX_VIRTUAL_TIME_LAG = std::chrono::nanoseconds{std::chrono::milliseconds{10}};
+
+  /**
+   * @param weight                        The share of the workers relative to the other groups
+   * @param max_running_queries           Zero for no limit
+   * @param max_in_flight_jobs_per_query  Zero for no limit
+   */
+  static std::shared_ptr<ResourceGroup> create(const std::string& name, const uint32_t weight,
+                                               const size_t max_running_queries = 0,
+                                               const size_t max_in_flight_jobs_per_query = 0);
+
+  /**
+   * The group of all tasks that are not executed in a query of another group. Its weight is one, it has no limits.
+   */
+  static const std::shared_ptr<ResourceGroup>& default_group();
+
+  static const std::shared_ptr<ResourceGroup>& get(const ResourceGroupID resource_group_id);
+
+  /**
+   * The number of groups created so far, including the default group. Their ids are [0, count()).
+   */
+  static size_t count();
+
+  ResourceGroupID id() const;
+  const std::string& name() const;
+  uint32_t weight() const;
+  size_t max_running_queries() const;
+  size_t max_in_flight_jobs_per_query() const;
+
+  /**
+   * Adds the time that a worker spent executing a task of this group to the group's virtual time
+   */
+  void charge(const std::chrono::nanoseconds execution_time);
+
+  /**
+   * The time charged to this group divided by its weight, in nanoseconds
+   */
+  uint64_t virtual_time() const;
+
+  /**
+   * Creates the QueryTicket of a new query. The query is admitted right away if the group runs fewer than
+   * max_running_queries queries, otherwise it is queued. It counts as running until its ticket is destroyed.
+   */
+  std::shared_ptr<QueryTicket> queue_query();
+
+  size_t running_query_count() const;
+
+ private:
+  friend class QueryTicket;
+
+  struct Registry {
+    Registry();
+
+    std::mutex mutex;
+    std::array<std::shared_ptr<ResourceGroup>, MAX_RESOURCE_GROUP_COUNT> resource_groups;
+    std::atomic<size_t> resource_group_count{0};
+    std::atomic<uint64_t> max_virtual_time{0};
+  };
+
+  static Registry& _registry();
+
+  // The virtual time that no group with tasks falls behind
+  static uint64_t _min_virtual_time();
+
+  ResourceGroup(const ResourceGroupID id, const std::string& name, const uint32_t weight,
+                const size_t max_running_queries, const size_t max_in_flight_jobs_per_query);
+
+  // Called by a QueryTicket of an admitted query when it is destroyed
+  void _on_query_finished();
+
+  const ResourceGroupID _id;
+  const std::string _name;
+  const uint32_t _weight;
+  const size_t _max_running_queries;
+  const size_t _max_in_flight_jobs_per_query;
+
+  std::atomic<uint64_t> _virtual_time{0};
+
+  mutable std::mutex _admission_mutex;
+  size_t _running_query_count{0};
+  std::deque<std::weak_ptr<QueryTicket>> _admission_queue;
+};
+
+/**
+ * A single query in a ResourceGroup, see ResourceGroup::queue_query(). The tasks of the query refer to the ticket until
+ * they are done. Tasks that are scheduled before the query is admitted are kept by the ticket until then.
+ */
+class QueryTicket : private Noncopyable {
+ public:
+  // Use ResourceGroup::queue_query() to create tickets
+  explicit QueryTicket(const std::shared_ptr<ResourceGroup>& resource_group);
+  ~QueryTicket();
+
+  const std::shared_ptr<ResourceGroup>& resource_group() const;
+
+  bool is_admitted() const;
+
+  /**
+   * Keeps a task until the query is admitted. Returns false if the query was admitted already, in which case the task
+   * has to be scheduled right away.
+   */
+  bool try_defer(const std::shared_ptr<AbstractTask>& task, const NodeID preferred_node_id);
+
+  /**
+   * Registers a job that is about to be scheduled. Returns false if the query has max_in_flight_jobs_per_query jobs
+   * in flight already. Call end_job() once a registered job is done.
+   */
+  bool try_begin_job();
+  void end_job();
+
+ private:
+  friend class ResourceGroup;
+
+  // Schedules the deferred tasks
+  void _admit();
+
+  const std::shared_ptr<ResourceGroup> _resource_group;
+
+  std::atomic_bool _is_admitted{false};
+  std::atomic<size_t> _in_flight_job_count{0};
+
+  std::mutex _deferred_tasks_mutex;
+  std::vector<std::pair<std::shared_ptr<AbstractTask>, NodeID>> _deferred_tasks;
+};
+
+}  // namespace opossum
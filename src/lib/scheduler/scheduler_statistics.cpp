@@ -0,0 +1,97 @@
+#include "scheduler_statistics.hpp"
+
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
+
+namespace opossum {
+
+uint64_t WorkerStatistics::tasks_stolen() const {
+  return std::accumulate(tasks_stolen_from_nodes.cbegin(), tasks_stolen_from_nodes.cend(), tasks_stolen_locally);
+}
+
+std::chrono::nanoseconds WorkerStatistics::average_queue_wait_time() const {
+  if (tasks_executed == 0) return std::chrono::nanoseconds{0};
+  return queue_wait_time / tasks_executed;
+}
+
+WorkerStatistics WorkerStatistics::operator-(const WorkerStatistics& rhs) const {
+  DebugAssert(worker_id == rhs.worker_id && tasks_stolen_from_nodes.size() == rhs.tasks_stolen_from_nodes.size(),
+              "Statistics of different workers cannot be subtracted");
+
+  auto difference = *this;
+  difference.tasks_executed -= rhs.tasks_executed;
+  difference.tasks_from_deque -= rhs.tasks_from_deque;
+  difference.tasks_pulled -= rhs.tasks_pulled;
+  difference.tasks_stolen_locally -= rhs.tasks_stolen_locally;
+  for (auto node_id = size_t{0}; node_id < tasks_stolen_from_nodes.size(); ++node_id) {
+    difference.tasks_stolen_from_nodes[node_id] -= rhs.tasks_stolen_from_nodes[node_id];
+  }
+  difference.busy_time -= rhs.busy_time;
+  difference.idle_time -= rhs.idle_time;
+  difference.sleep_time -= rhs.sleep_time;
+  difference.idle_iterations -= rhs.idle_iterations;
+  difference.queue_wait_time -= rhs.queue_wait_time;
+  return difference;
+}
+
+std::chrono::nanoseconds TaskQueueStatistics::average_queue_wait_time() const {
+  const auto tasks_taken = tasks_pulled + tasks_stolen;
+  if (tasks_taken == 0) return std::chrono::nanoseconds{0};
+  return queue_wait_time / tasks_taken;
+}
+
+TaskQueueStatistics TaskQueueStatistics::operator-(const TaskQueueStatistics& rhs) const {
+  DebugAssert(node_id == rhs.node_id, "Statistics of different queues cannot be subtracted");
+
+  // The queue depth is a current value, not a counter
+  auto difference = *this;
+  difference.tasks_pushed -= rhs.tasks_pushed;
+  difference.tasks_pulled -= rhs.tasks_pulled;
+  difference.tasks_stolen -= rhs.tasks_stolen;
+  difference.scan_iterations -= rhs.scan_iterations;
+  difference.queue_wait_time -= rhs.queue_wait_time;
+  return difference;
+}
+
+SchedulerStatistics SchedulerStatistics::operator-(const SchedulerStatistics& rhs) const {
+  Assert(workers.size() == rhs.workers.size() && queues.size() == rhs.queues.size(),
+         "Statistics of different schedulers cannot be subtracted");
+
+  auto difference = SchedulerStatistics{};
+  for (auto worker_idx = size_t{0}; worker_idx < workers.size(); ++worker_idx) {
+    difference.workers.emplace_back(workers[worker_idx] - rhs.workers[worker_idx]);
+  }
+  for (auto queue_idx = size_t{0}; queue_idx < queues.size(); ++queue_idx) {
+    difference.queues.emplace_back(queues[queue_idx] - rhs.queues[queue_idx]);
+  }
+  return difference;
+}
+
+void SchedulerStatistics::print(std::ostream& stream) const {
+  for (const auto& worker : workers) {
+    stream << "Worker " << worker.worker_id << " (node " << worker.node_id << "): " << worker.tasks_executed
+           << " tasks (" << worker.tasks_from_deque << " from deque, " << worker.tasks_pulled << " pulled, "
+           << worker.tasks_stolen_locally << " stolen locally";
+    for (auto node_id = size_t{0}; node_id < worker.tasks_stolen_from_nodes.size(); ++node_id) {
+      if (worker.tasks_stolen_from_nodes[node_id] == 0) continue;
+      stream << ", " << worker.tasks_stolen_from_nodes[node_id] << " stolen from node " << node_id;
+    }
+    stream << "), busy " << format_duration(worker.busy_time) << ", idle " << format_duration(worker.idle_time)
+           << " (asleep " << format_duration(worker.sleep_time) << ", " << worker.idle_iterations
+           << " idle iterations), average queue wait " << format_duration(worker.average_queue_wait_time())
+           << std::endl;
+  }
+
+  for (const auto& queue : queues) {
+    stream << "TaskQueue " << queue.node_id << ": " << queue.queue_depth << " queued, " << queue.tasks_pushed
+           << " pushed, " << queue.tasks_pulled << " pulled, " << queue.tasks_stolen << " stolen, "
+           << queue.scan_iterations << " scan iterations, average queue wait "
+           << format_duration(queue.average_queue_wait_time()) << std::endl;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Snapshots of the counters that the Workers and TaskQueues of the NodeQueueScheduler keep, to tell whether the
+ * latency of queries comes from scheduling (e.g., tasks waiting in queues while workers sleep) or from the cost of the
+ * operators. The counters are monotonic since the scheduler began, so the difference of two snapshots describes the
+ * time between them (see operator-). They are updated with relaxed atomics, so a snapshot that is taken while tasks
+ * run is not exactly consistent.
+ */
+struct WorkerStatistics {
+  WorkerID worker_id{0};
+  NodeID node_id{0};
+
+  uint64_t tasks_executed{0};
+
+  // Where the executed tasks came from: The worker's own deque, the queue of its node, the deques of other workers of
+  // its node, or (by node) the queues and deques of other nodes
+  uint64_t tasks_from_deque{0};
+  uint64_t tasks_pulled{0};
+  uint64_t tasks_stolen_locally{0};
+  std::vector<uint64_t> tasks_stolen_from_nodes;
+
+  // The time spent executing tasks, excluding the tasks that other tasks waited for on this worker, which are counted
+  // by themselves
+  std::chrono::nanoseconds busy_time{0};
+
+  // The time spent without a task, spinning (yielding the CPU) or sleeping on the queue, and how often the worker
+  // found no task. A task that waits for its jobs while the worker finds no other task to execute is busy and idle at the same time.
+  std::chrono::nanoseconds idle_time{0};
+  std::chrono::nanoseconds sleep_time{0};
+  uint64_t idle_iterations{0};
+
+  // The time between the executed tasks being enqueued (in a TaskQueue or a deque) and the worker taking them
+  std::chrono::nanoseconds queue_wait_time{0};
+
+  uint64_t tasks_stolen() const;
+  std::chrono::nanoseconds average_queue_wait_time() const;
+
+  WorkerStatistics operator-(const WorkerStatistics& rhs) const;
+};
+
+struct TaskQueueStatistics {
+  NodeID node_id{0};
+
+  // The tasks currently in the queue
+  uint64_t queue_depth{0};
+
+  uint64_t tasks_pushed{0};
+  // Taken by the workers of the node and (only stealable tasks) by workers of other nodes
+  uint64_t tasks_pulled{0};
+  uint64_t tasks_stolen{0};
+
+  // How often a worker looked into one of the queues of a resource group and priority level while searching for a
+  // task, including the unstealable tasks that a thief put back
+  uint64_t scan_iterations{0};
+
+  // The time between the tasks being pushed and them being pulled or stolen
+  std::chrono::nanoseconds queue_wait_time{0};
+
+  std::chrono::nanoseconds average_queue_wait_time() const;
+
+  TaskQueueStatistics operator-(const TaskQueueStatistics& rhs) const;
+};
+
+struct SchedulerStatistics {
+  std::vector<WorkerStatistics> workers;
+  std::vector<TaskQueueStatistics> queues;
+
+  SchedulerStatistics operator-(const SchedulerStatistics& rhs) const;
+
+  // Prints one line per worker and per queue
+  void print(std::ostream& stream) const;
+};
+
+}  // namespace opossum
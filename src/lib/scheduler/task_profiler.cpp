@@ -0,0 +1,150 @@
+#include "task_profiler.hpp"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/worker.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+thread_local opossum::TaskProfiler::Scope* innermost_scope = nullptr;
+
+// The timestamps of the Chrome trace event format are in microseconds
+double to_microseconds(const std::chrono::nanoseconds duration) {
+  return static_cast<double>(duration.count()) / 1000.0;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TaskProfiler::TaskProfiler() : _begin(std::chrono::steady_clock::now()) {}
+
+void TaskProfiler::record(TaskProfileEvent event) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _events.emplace_back(std::move(event));
+}
+
+std::vector<TaskProfileEvent> TaskProfiler::events() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _events;
+}
+
+nlohmann::json TaskProfiler::to_chrome_trace() const {
+  const auto events = this->events();
+
+  // Each worker is a row of the timeline. Threads that are not workers get the rows after them.
+  auto max_worker_id = WorkerID{0};
+  for (const auto& event : events) {
+    if (event.worker_id) max_worker_id = std::max(max_worker_id, *event.worker_id);
+  }
+  auto thread_rows = std::map<std::thread::id, size_t>{};
+  auto row_names = std::map<size_t, std::string>{};
+
+  auto trace_events = nlohmann::json::array();
+  for (const auto& event : events) {
+    auto row = size_t{0};
+    if (event.worker_id) {
+      row = *event.worker_id;
+      row_names.emplace(row, "Worker " + std::to_string(*event.worker_id));
+    } else {
+      const auto [thread_row, inserted] = thread_rows.emplace(event.thread_id, max_worker_id + 1 + thread_rows.size());
+      row = thread_row->second;
+      if (inserted) row_names.emplace(row, "Thread " + std::to_string(thread_rows.size()));
+    }
+
+    auto args = nlohmann::json{{"task_id", event.task_id}, {"description", event.description}};
+    if (!event.parent_operator.empty()) args["operator"] = event.parent_operator;
+    if (event.cpu_id) args["cpu"] = static_cast<CpuID::base_type>(*event.cpu_id);
+
+    trace_events.push_back({{"name", event.name},
+                            {"cat", event.category},
+                            {"ph", "X"},
+                            {"ts", to_microseconds(event.begin)},
+                            {"dur", to_microseconds(event.end - event.begin)},
+                            {"pid", 0},
+                            {"tid", row},
+                            {"args", args}});
+  }
+
+  for (const auto& [row, name] : row_names) {
+    trace_events.push_back(
+        {{"name", "thread_name"}, {"ph", "M"}, {"pid", 0}, {"tid", row}, {"args", {{"name", name}}}});
+  }
+
+  return {{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}};
+}
+
+void TaskProfiler::export_chrome_trace(const std::string& path) const {
+  auto stream = std::ofstream{path};
+  Assert(stream.good(), "Cannot write the task profile to " + path);
+  stream << to_chrome_trace().dump(2) << std::endl;
+}
+
+std::shared_ptr<TaskProfiler> TaskProfiler::current() { return innermost_scope ? innermost_scope->_profiler : nullptr; }
+
+std::string TaskProfiler::current_operator() { return innermost_scope ? innermost_scope->_operator : ""; }
+
+TaskProfiler::Scope::Scope(const std::shared_ptr<TaskProfiler>& profiler, const AbstractTask& task,
+                           const std::string& inherited_operator)
+    : _profiler(profiler), _task(task) {
+  if (!_profiler) return;
+
+  const auto* operator_task = dynamic_cast<const OperatorTask*>(&task);
+  _operator = operator_task ? operator_task->get_operator()->name() : inherited_operator;
+
+  _outer_scope = std::exchange(innermost_scope, this);
+  _begin = std::chrono::steady_clock::now();
+}
+
+TaskProfiler::Scope::~Scope() {
+  if (!_profiler) return;
+
+  const auto end = std::chrono::steady_clock::now();
+  innermost_scope = _outer_scope;
+
+  auto event = TaskProfileEvent{};
+  event.task_id = _task.id();
+  event.parent_operator = _operator;
+
+  const auto* operator_task = dynamic_cast<const OperatorTask*>(&_task);
+  if (operator_task) {
+    event.name = _operator;
+    event.category = "OperatorTask";
+    event.description = operator_task->get_operator()->description();
+  } else {
+    event.name = "JobTask";
+    event.category = "JobTask";
+    event.description = _task.description();
+  }
+
+  const auto worker = Worker::get_this_thread_worker();
+  if (worker) {
+    event.worker_id = worker->id();
+    event.cpu_id = worker->cpu_id();
+  }
+#if defined(__linux__)
+  // The CPU that the thread ran on last, as the workers are pinned to theirs only with NUMA support
+  const auto cpu = sched_getcpu();
+  if (cpu >= 0) event.cpu_id = CpuID{static_cast<CpuID::base_type>(cpu)};
+#endif
+  event.thread_id = std::this_thread::get_id();
+
+  event.begin = std::chrono::duration_cast<std::chrono::nanoseconds>(_begin - _profiler->_begin);
+  event.end = std::chrono::duration_cast<std::chrono::nanoseconds>(end - _profiler->_begin);
+  _profiler->record(std::move(event));
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "json.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// When and where a task was executed, relative to the beginning of the profile
+struct TaskProfileEvent {
+  TaskID task_id{INVALID_TASK_ID};
+
+  // For OperatorTasks the name of the operator, otherwise "JobTask"
+  std::string name;
+  // "OperatorTask" or "JobTask"
+  std::string category;
+  std::string description;
+
+  // The operator that the task belongs to: Its own one for OperatorTasks, or the one of the task that scheduled a job
+  std::string parent_operator;
+
+  // Not set for tasks executed without a Scheduler or by a thread that is not a worker (e.g., the one waiting for the
+  // tasks of the query)
+  std::optional<WorkerID> worker_id;
+  std::optional<CpuID> cpu_id;
+  std::thread::id thread_id;
+
+  std::chrono::nanoseconds begin{0};
+  std::chrono::nanoseconds end{0};
+};
+
+/**
+ * Records the execution of the tasks of queries, e.g., of an SQLPipeline (see SQLPipelineBuilder::with_task_profiler),
+ * and exports them in the Chrome trace event format, which chrome://tracing and https://ui.perfetto.dev display as a
+ * timeline per worker. This shows where the workers idle while a query runs and which jobs are stragglers, without the
+ * external toolchain that the dtrace probes JOB_START and JOB_END need.
+ *
+ * Tasks record themselves into the profiler that they were given (AbstractTask::set_task_profiler) or that they
+ * inherited from the task that scheduled them, like they inherit the CancellationToken.
+ */
+class TaskProfiler : public Noncopyable {
+ public:
+  TaskProfiler();
+
+  void record(TaskProfileEvent event);
+
+  std::vector<TaskProfileEvent> events() const;
+
+  // One complete event ("ph": "X") per task and one thread with the name of each worker
+  nlohmann::json to_chrome_trace() const;
+  void export_chrome_trace(const std::string& path) const;
+
+  /**
+   * The profiler and the operator of the task that the calling thread executes, i.e., of the innermost Scope. Read by
+   * AbstractTask::schedule(), so that jobs inherit them.
+   */
+  static std::shared_ptr<TaskProfiler> current();
+  static std::string current_operator();
+
+  /**
+   * Records the execution of a task while it lives, see AbstractTask::execute(). Does nothing without a profiler.
+   */
+  class Scope : public Noncopyable {
+    friend class TaskProfiler;
+
+   public:
+    // @param inherited_operator  the operator of the task that scheduled a job, see TaskProfileEvent::parent_operator
+    Scope(const std::shared_ptr<TaskProfiler>& profiler, const AbstractTask& task,
+          const std::string& inherited_operator);
+    ~Scope();
+
+   private:
+    const std::shared_ptr<TaskProfiler> _profiler;
+    const AbstractTask& _task;
+    Scope* _outer_scope{nullptr};
+    std::string _operator;
+    std::chrono::steady_clock::time_point _begin;
+  };
+
+ private:
+  const std::chrono::steady_clock::time_point _begin;
+
+  mutable std::mutex _mutex;
+  std::vector<TaskProfileEvent> _events;
+};
+
+}  // namespace opossum
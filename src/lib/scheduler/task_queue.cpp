@@ -1,5 +1,7 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <utility>
 
@@ -12,6 +14,8 @@ TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
 bool TaskQueue::empty() const { return _num_tasks == 0; }
 
+size_t TaskQueue::size() const { return _num_tasks; }
+
 NodeID TaskQueue::node_id() const { return _node_id; }
 
 void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
@@ -21,35 +25,92 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  _queues[task->resource_group_id()][priority].push(task);
 
   _num_tasks++;
+  _num_pushed_tasks.fetch_add(1, std::memory_order_relaxed);
+
+  notify_one();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::pull() {
+std::shared_ptr<AbstractTask> TaskQueue::pull() { return _pop(false); }
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() { return _pop(true); }
+
+std::shared_ptr<AbstractTask> TaskQueue::_pop(const bool only_stealable) {
+  const auto resource_group_count = ResourceGroup::count();
+
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      _num_tasks--;
-      return task;
+  auto scan_iterations = uint64_t{0};
+  for (auto priority = uint32_t{0}; priority < NUM_PRIORITY_LEVELS; ++priority) {
+    // Try the groups with tasks of this priority in the order of their virtual times
+    auto candidates = std::array<std::pair<uint64_t, ResourceGroupID>, ResourceGroup::MAX_RESOURCE_GROUP_COUNT>{};
+    auto candidate_count = size_t{0};
+    for (auto resource_group_id = ResourceGroupID{0}; resource_group_id < resource_group_count; ++resource_group_id) {
+      if (_queues[resource_group_id][priority].empty()) continue;
+      candidates[candidate_count++] = {ResourceGroup::get(resource_group_id)->virtual_time(), resource_group_id};
     }
-  }
-  return nullptr;
-}
+    std::sort(candidates.begin(), candidates.begin() + candidate_count);
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        _num_tasks--;
-        return task;
-      } else {
-        queue.push(task);
+    for (auto candidate_index = size_t{0}; candidate_index < candidate_count; ++candidate_index) {
+      auto& queue = _queues[candidates[candidate_index].second][priority];
+      ++scan_iterations;
+      if (queue.try_pop(task)) {
+        if (!only_stealable || task->is_stealable()) {
+          _num_tasks--;
+          _num_scan_iterations.fetch_add(scan_iterations, std::memory_order_relaxed);
+          (only_stealable ? _num_stolen_tasks : _num_pulled_tasks).fetch_add(1, std::memory_order_relaxed);
+          const auto queue_wait_time = std::chrono::steady_clock::now() - task->enqueue_time();
+          _queue_wait_time_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(queue_wait_time).count(),
+                                        std::memory_order_relaxed);
+          return task;
+        } else {
+          queue.push(task);
+        }
       }
     }
   }
+  // Idle workers call this all the time, so an empty queue is not counted (and its cache line not written)
+  if (scan_iterations > 0) _num_scan_iterations.fetch_add(scan_iterations, std::memory_order_relaxed);
   return nullptr;
 }
 
+void TaskQueue::wait_for_task(const std::chrono::microseconds timeout, const std::function<bool()>& has_other_tasks) {
+  std::unique_lock<std::mutex> lock{_wait_mutex};
+  _num_waiting_workers++;
+
+  if (empty() && !has_other_tasks()) _new_task.wait_for(lock, timeout);
+
+  _num_waiting_workers--;
+}
+
+void TaskQueue::notify_one() {
+  // The new task is added before _num_waiting_workers is read, while wait_for_task() does the opposite. Thus, either
+  // the waiting worker sees the new task, or the notifying thread sees the worker. The fence keeps the read from being
+  // reordered before the (possibly relaxed) write that added the task.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_num_waiting_workers == 0) return;
+
+  // Locking the mutex guarantees that a worker that already checked for tasks is waiting on the condition variable
+  std::lock_guard<std::mutex> lock{_wait_mutex};
+  _new_task.notify_one();
+}
+
+void TaskQueue::notify_all() {
+  std::lock_guard<std::mutex> lock{_wait_mutex};
+  _new_task.notify_all();
+}
+
+TaskQueueStatistics TaskQueue::statistics() const {
+  auto statistics = TaskQueueStatistics{};
+  statistics.node_id = _node_id;
+  statistics.queue_depth = _num_tasks;
+  statistics.tasks_pushed = _num_pushed_tasks.load(std::memory_order_relaxed);
+  statistics.tasks_pulled = _num_pulled_tasks.load(std::memory_order_relaxed);
+  statistics.tasks_stolen = _num_stolen_tasks.load(std::memory_order_relaxed);
+  statistics.scan_iterations = _num_scan_iterations.load(std::memory_order_relaxed);
+  statistics.queue_wait_time = std::chrono::nanoseconds{_queue_wait_time_ns.load(std::memory_order_relaxed)};
+  return statistics;
+}
+
 }  // namespace opossum
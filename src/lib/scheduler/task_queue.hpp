@@ -4,8 +4,14 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 
+#include "resource_group.hpp"
+#include "scheduler_statistics.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -13,16 +19,20 @@ namespace opossum {
 class AbstractTask;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node. Within a priority level, the tasks of the
+ * resource group with the lowest virtual time are handed out first (see WEIGHTED FAIR SCHEDULING in
+ * resource_group.hpp).
  */
 class TaskQueue {
  public:
-  static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
 
   explicit TaskQueue(NodeID node_id);
 
   bool empty() const;
 
+  size_t size() const;
+
   NodeID node_id() const;
 
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
@@ -37,10 +47,49 @@ class TaskQueue {
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Blocks the calling worker until a task is pushed, notify_one() or notify_all() is called, or the timeout expires.
+   * Returns right away if the queue is not empty or if `has_other_tasks` (which checks for tasks that are not in this
+   * queue, e.g., in the deques of the workers) returns true. As wakeups can be spurious, callers have to check for
+   * tasks afterwards.
+   */
+  void wait_for_task(const std::chrono::microseconds timeout, const std::function<bool()>& has_other_tasks);
+
+  /**
+   * Wakes one worker waiting in wait_for_task(), if there is one. Call this after adding a task somewhere else than
+   * this queue that the waiting workers can take, e.g., a worker's deque.
+   */
+  void notify_one();
+
+  /**
+   * Wakes all workers waiting in wait_for_task(), e.g., when the scheduler shuts down
+   */
+  void notify_all();
+
+  TaskQueueStatistics statistics() const;
+
  private:
+  std::shared_ptr<AbstractTask> _pop(const bool only_stealable);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // One queue per resource group and priority level
+  std::array<std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS>,
+             ResourceGroup::MAX_RESOURCE_GROUP_COUNT>
+      _queues;
   std::atomic_uint _num_tasks{0};
+
+  // Pushing a task only takes the mutex to wake a worker if one is waiting, so that busy queues do not pay for it
+  std::mutex _wait_mutex;
+  std::condition_variable _new_task;
+  std::atomic_uint _num_waiting_workers{0};
+
+  // See TaskQueueStatistics
+  std::atomic<uint64_t> _num_pushed_tasks{0};
+  std::atomic<uint64_t> _num_pulled_tasks{0};
+  std::atomic<uint64_t> _num_stolen_tasks{0};
+  std::atomic<uint64_t> _num_scan_iterations{0};
+  std::atomic<uint64_t> _queue_wait_time_ns{0};
 };
 
 }  // namespace opossum
@@ -5,9 +5,11 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -22,7 +24,10 @@ const int Topology::_number_of_hardware_nodes = numa_num_configured_nodes();  //
 const int Topology::_number_of_hardware_nodes = 1;  // NOLINT
 #endif
 
-Topology::Topology() { _init_default_topology(); }
+Topology::Topology() {
+  _init_cache_sizes();
+  _init_default_topology();
+}
 
 void TopologyNode::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
@@ -153,18 +158,68 @@ void Topology::_init_fake_numa_topology(uint32_t max_num_workers, uint32_t worke
   _create_memory_resources();
 }
 
+void Topology::_init_cache_sizes() {
+  // Linux exposes one directory per cache of a core, e.g., .../cpu0/cache/index2/ with the files "level" (2), "type"
+  // ("Unified") and "size" ("2048K"). We assume that all cores are equal and only look at the first one.
+  for (auto cache_index = 0;; ++cache_index) {
+    const auto cache_directory =
+        std::string{"/sys/devices/system/cpu/cpu0/cache/index"} + std::to_string(cache_index) + "/";
+
+    auto level_file = std::ifstream{cache_directory + "level"};
+    auto type_file = std::ifstream{cache_directory + "type"};
+    auto size_file = std::ifstream{cache_directory + "size"};
+    if (!level_file || !type_file || !size_file) break;
+
+    auto level = 0;
+    auto type = std::string{};
+    auto size = size_t{0};
+    auto unit = char{0};
+    level_file >> level;
+    type_file >> type;
+    size_file >> size >> unit;
+
+    if (unit == 'K') {
+      size *= 1024;
+    } else if (unit == 'M') {
+      size *= 1024 * 1024;
+    }
+
+    if (size == 0) continue;
+
+    if (level == 1 && type == "Data") {
+      _l1_data_cache_size = size;
+    } else if (level == 2 && type != "Instruction") {
+      _l2_cache_size = size;
+    }
+  }
+}
+
 const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+size_t Topology::l1_data_cache_size() const { return _l1_data_cache_size; }
+
+size_t Topology::l2_cache_size() const { return _l2_cache_size; }
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
 }
 
+NodeID Topology::get_node_id(const boost::container::pmr::memory_resource* memory_resource) const {
+  for (auto node_id = size_t{0}; node_id < _memory_resources.size(); ++node_id) {
+    if (&_memory_resources[node_id] == memory_resource) return NodeID{static_cast<NodeID::base_type>(node_id)};
+  }
+  return INVALID_NODE_ID;
+}
+
 void Topology::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
   stream << "Number of CPUs: " << _num_cpus << std::endl;
+  for (size_t i = 0; i < indent; ++i) stream << " ";
+  stream << "L1 data cache: " << _l1_data_cache_size / 1024 << " KB, L2 cache: " << _l2_cache_size / 1024 << " KB"
+         << std::endl;
   for (size_t node_idx = 0; node_idx < _nodes.size(); ++node_idx) {
     for (size_t i = 0; i < indent; ++i) stream << " ";
     stream << "Node #" << node_idx << " - ";
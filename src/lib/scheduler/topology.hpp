@@ -83,8 +83,22 @@ class Topology final : public Singleton<Topology> {
 
   size_t num_cpus() const;
 
+  /**
+   * Sizes (in bytes) of the L1 data cache and the L2 cache of a single core. They are read from sysfs once, when the
+   * Topology is created. If the system does not expose them, the sizes of a common server CPU (32 KB / 256 KB) are
+   * assumed. Replacing the topology through one of the use_*_topology() methods keeps the detected sizes.
+   */
+  size_t l1_data_cache_size() const;
+  size_t l2_cache_size() const;
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
+  /**
+   * The node whose memory resource (see get_memory_resource()) is @param memory_resource, e.g., of a chunk that was
+   * migrated to that node. INVALID_NODE_ID for other resources, such as the default one.
+   */
+  NodeID get_node_id(const boost::container::pmr::memory_resource* memory_resource) const;
+
   void print(std::ostream& stream = std::cout, size_t indent = 0) const;
 
  private:
@@ -97,6 +111,8 @@ class Topology final : public Singleton<Topology> {
   void _init_non_numa_topology(uint32_t max_num_cores = 0);
   void _init_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
+  void _init_cache_sizes();
+
   void _clear();
   void _create_memory_resources();
 
@@ -104,6 +120,9 @@ class Topology final : public Singleton<Topology> {
   uint32_t _num_cpus{0};
   bool _fake_numa_topology{false};
 
+  size_t _l1_data_cache_size{32 * 1024};
+  size_t _l2_cache_size{256 * 1024};
+
   static const int _number_of_hardware_nodes;
 
   std::vector<NUMAMemoryResource> _memory_resources;
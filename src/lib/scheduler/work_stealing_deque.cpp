@@ -0,0 +1,110 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(init_capacity), slots(std::make_unique<Slot[]>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity has to be a power of two");
+}
+
+WorkStealingDeque::Slot& WorkStealingDeque::Buffer::operator[](const int64_t index) {
+  return slots[static_cast<size_t>(index) & (capacity - 1)];
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  auto& buffer = *_buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    delete buffer[index].load(std::memory_order_relaxed);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  // Lê et al. use a release fence followed by a relaxed store. The release store is equivalent here, and it is
+  // understood by ThreadSanitizer.
+  (*buffer)[bottom].store(new std::shared_ptr<AbstractTask>(task), std::memory_order_relaxed);
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task = (*buffer)[bottom].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // This is the last task, which a thief might try to take at the same time
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!task) return nullptr;
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  auto* buffer = _buffer.load(std::memory_order_acquire);
+  auto* task = (*buffer)[top].load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Lost the race against the owner or another thief
+    return nullptr;
+  }
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+bool WorkStealingDeque::empty() const { return _top.load() >= _bottom.load(); }
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, const int64_t top, const int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    (*new_buffer)[index].store((*buffer)[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  _buffers.emplace_back(std::move(new_buffer));
+  auto* result = _buffers.back().get();
+  _buffer.store(result, std::memory_order_release);
+  return result;
+}
+
+}  // namespace opossum
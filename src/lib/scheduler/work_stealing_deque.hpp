@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque of tasks as described by Chase and Lev. Each Worker owns one.
+ *
+ * Only the owning worker pushes and pops tasks, and it does so at the bottom (LIFO). The jobs spawned by a task thus
+ * run while their data is still in the cache. Other workers steal from the top (FIFO). The oldest tasks are stolen
+ * first, and they usually are the largest pieces of work.
+ *
+ * The memory orderings follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013).
+ * The slots hold pointers to heap-allocated shared_ptrs, so that they can be read and written atomically. Whoever
+ * takes a task out of the deque frees its shared_ptr. A thief might still read from a buffer after the owner replaced
+ * it by a larger one, so the replaced buffers are only freed together with the deque.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 64);
+  ~WorkStealingDeque();
+
+  /**
+   * Owner only: adds a task at the bottom
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Owner only: removes the most recently pushed task, or returns nullptr if the deque is empty
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes the least recently pushed task. Returns nullptr if the deque is empty or if another thread took the task
+   * first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+ private:
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    Slot& operator[](const int64_t index);
+
+    const size_t capacity;
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, const int64_t top, const int64_t bottom);
+
+  // top and bottom are modified by different threads, so they are kept on separate cache lines
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // Holds the current and all replaced buffers, only modified by the owner
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -4,16 +4,21 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "resource_group.hpp"
 #include "task_queue.hpp"
+#include "topology.hpp"
+#include "utils/timer.hpp"
 
 namespace {
 
@@ -29,7 +34,11 @@ namespace opossum {
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
 Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _queue(queue),
+      _id(id),
+      _cpu_id(cpu_id),
+      _num_tasks_stolen_from_nodes(Topology::get().nodes().size()),
+      _random_engine(id) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -50,11 +59,22 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  auto task = _queue->pull();
+  auto idle_timer = Timer{};
+
+  auto task = _deque.pop();
+  if (task) {
+    _add(_num_tasks_from_deque, 1);
+  } else {
+    task = _queue->pull();
+    if (task) _add(_num_pulled_tasks, 1);
+  }
 
-  if (!task) {
+  // Tasks on other nodes are left to the workers of these nodes for a moment, as their data likely lives there
+  const auto may_steal_remotely = _num_idle_iterations >= MIN_IDLE_ITERATIONS_BEFORE_REMOTE_STEALING;
+  if (!task) task = _steal_from_workers(may_steal_remotely);
+
+  if (!task && may_steal_remotely) {
     // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
     for (auto& queue : CurrentScheduler::get()->queues()) {
       if (queue == _queue) {
         continue;
@@ -62,26 +82,105 @@ void Worker::_work() {
 
       task = queue->steal();
       if (task) {
+        _add(_num_tasks_stolen_from_nodes[queue->node_id()], 1);
         task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
         break;
       }
     }
+  }
 
-    // Sleep if there is no ready task in our queue and work stealing was not successful.
-    if (!work_stealing_successful) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-      return;
+  // Spin for a while and then wait for a new task if there is no ready task in our queue and work stealing was not
+  // successful. Returning lets the caller check whether it should stop working, e.g., on shutdown.
+  if (!task) {
+    if (_num_idle_iterations < MAX_IDLE_SPIN_ITERATIONS) {
+      _num_idle_iterations++;
+      std::this_thread::yield();
+    } else {
+      auto sleep_timer = Timer{};
+      _queue->wait_for_task(IDLE_WAIT_TIMEOUT, [&]() { return _workers_have_tasks(); });
+      _add(_sleep_time_ns, sleep_timer.lap().count());
     }
+    _add(_total_idle_iterations, 1);
+    _add(_idle_time_ns, idle_timer.lap().count());
+    return;
   }
 
-  task->execute();
+  _num_idle_iterations = 0;
 
-  // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
-  // Scheduler to determine whether all tasks finished
+  const auto queue_wait_time = std::chrono::steady_clock::now() - task->enqueue_time();
+  _add(_queue_wait_time_ns, std::chrono::duration_cast<std::chrono::nanoseconds>(queue_wait_time).count());
+
+  // A worker that waited for the task might have executed it already (see _wait_for_tasks())
+  _try_execute(*task);
+
+  // This is part of the Scheduler shutdown system. Count the number of tasks a Worker took out of the queues and
+  // deques to allow the Scheduler to determine whether all tasks finished
   _num_finished_tasks++;
 }
 
+void Worker::_try_execute(AbstractTask& task) {
+  // The thread that claimed the task resets its query ticket once it is done, so it must not be looked at otherwise
+  if (!task._try_mark_as_started()) return;
+
+  const auto resource_group_id = task.resource_group_id();
+  const auto outer_nested_task_time = std::exchange(_nested_task_time, std::chrono::nanoseconds{0});
+
+  auto timer = Timer{};
+  task._execute();
+  const auto task_time = timer.lap();
+
+  ResourceGroup::get(resource_group_id)->charge(task_time - _nested_task_time);
+  _add(_busy_time_ns, (task_time - _nested_task_time).count());
+  _nested_task_time = outer_nested_task_time + task_time;
+}
+
+void Worker::push_local_task(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(get_this_thread_worker().get() == this, "Only the worker itself may push to its deque");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deque.push(task);
+
+  // This worker is busy with the spawning task, so let an idle one steal the new task
+  _queue->notify_one();
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_from_workers(const bool may_steal_remotely) {
+  const auto& workers = CurrentScheduler::get()->workers();
+  if (workers.size() < 2) return nullptr;
+
+  const auto first_victim = std::uniform_int_distribution<size_t>{0, workers.size() - 1}(_random_engine);
+
+  for (const auto same_node : {true, false}) {
+    if (!same_node && !may_steal_remotely) break;
+
+    for (auto victim_offset = size_t{0}; victim_offset < workers.size(); ++victim_offset) {
+      const auto& victim = workers[(first_victim + victim_offset) % workers.size()];
+      if (victim.get() == this || (victim->_queue == _queue) != same_node) continue;
+
+      auto task = victim->_deque.steal();
+      if (task) {
+        if (same_node) {
+          _add(_num_tasks_stolen_locally, 1);
+        } else {
+          _add(_num_tasks_stolen_from_nodes[victim->_queue->node_id()], 1);
+        }
+        task->set_node_id(_queue->node_id());
+        return task;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+bool Worker::_workers_have_tasks() const {
+  const auto& workers = CurrentScheduler::get()->workers();
+  return std::any_of(workers.cbegin(), workers.cend(), [](const auto& worker) { return !worker->_deque.empty(); });
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -91,6 +190,33 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+WorkerStatistics Worker::statistics() const {
+  const auto load_duration = [](const std::atomic<uint64_t>& nanoseconds) {
+    return std::chrono::nanoseconds{nanoseconds.load(std::memory_order_relaxed)};
+  };
+
+  auto statistics = WorkerStatistics{};
+  statistics.worker_id = _id;
+  statistics.node_id = _queue->node_id();
+  statistics.tasks_executed = _num_finished_tasks;
+  statistics.tasks_from_deque = _num_tasks_from_deque.load(std::memory_order_relaxed);
+  statistics.tasks_pulled = _num_pulled_tasks.load(std::memory_order_relaxed);
+  statistics.tasks_stolen_locally = _num_tasks_stolen_locally.load(std::memory_order_relaxed);
+  for (const auto& num_stolen_tasks : _num_tasks_stolen_from_nodes) {
+    statistics.tasks_stolen_from_nodes.emplace_back(num_stolen_tasks.load(std::memory_order_relaxed));
+  }
+  statistics.busy_time = load_duration(_busy_time_ns);
+  statistics.idle_time = load_duration(_idle_time_ns);
+  statistics.sleep_time = load_duration(_sleep_time_ns);
+  statistics.idle_iterations = _total_idle_iterations.load(std::memory_order_relaxed);
+  statistics.queue_wait_time = load_duration(_queue_wait_time_ns);
+  return statistics;
+}
+
+void Worker::_add(std::atomic<uint64_t>& counter, const uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -1,15 +1,20 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <random>
 #include <thread>
 #include <vector>
 
+#include "scheduler_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
 
 /**
@@ -36,6 +41,14 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   uint64_t num_finished_tasks() const;
 
+  WorkerStatistics statistics() const;
+
+  /**
+   * Pushes a task spawned by the task this worker executes to the worker's deque. Must be called on the worker's own
+   * thread.
+   */
+  void push_local_task(const std::shared_ptr<AbstractTask>& task);
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -55,23 +68,84 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
       return true;
     };
 
+    // Instead of searching the queues and deques for any task, the worker first executes the tasks that it waits for
+    // and that nobody started yet itself. It begins with the last ones, which are on top of its deque, while idle
+    // workers steal from the bottom. The tasks stay in their queues and deques, and whoever takes them out skips them.
+    for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+      const auto& task = *it;
+      if (task->is_ready() && task->is_stealable()) _try_execute(*task);
+    }
+
     while (!tasks_completed()) {
       _work();
     }
   }
 
+  /**
+   * Executes the @param task unless another thread started it already, and charges its time to its resource group
+   */
+  void _try_execute(AbstractTask& task);
+
  private:
+  /**
+   * A worker that finds no task yields its CPU this many times before it waits on its queue. Short gaps between tasks
+   * (e.g., between the operators of a query) are thus bridged without a context switch.
+   */
+  static constexpr auto MAX_IDLE_SPIN_ITERATIONS = uint32_t{64};
+
+  /**
+   * An idle worker only steals from the queue and the deques of workers of other nodes once it found no task this many
+   * times, so that the workers of these nodes, which are closer to the data of the tasks, get to them first.
+   */
+  static constexpr auto MIN_IDLE_ITERATIONS_BEFORE_REMOTE_STEALING = uint32_t{16};
+
+  /**
+   * Waiting workers are only woken by tasks pushed to their own queue. The timeout bounds how long tasks on other
+   * queues wait before an idle worker steals them.
+   */
+  static constexpr auto IDLE_WAIT_TIMEOUT = std::chrono::microseconds{10'000};
+
   /**
    * Pin a worker to a particular core.
    * This does not work on non-NUMA systems, and might be addressed in the future.
    */
   void _set_affinity();
 
+  /**
+   * Tries to steal a task from the deques of the other workers, starting with a random one. It tries the workers of
+   * the same node first, and those of other nodes only if @param may_steal_remotely is set.
+   */
+  std::shared_ptr<AbstractTask> _steal_from_workers(const bool may_steal_remotely);
+
+  // Only the worker's own thread writes its counters, so that relaxed loads and stores suffice
+  static void _add(std::atomic<uint64_t>& counter, const uint64_t value);
+
+  bool _workers_have_tasks() const;
+
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+  uint32_t _num_idle_iterations{0};
+
+  // See WorkerStatistics
+  std::atomic<uint64_t> _num_tasks_from_deque{0};
+  std::atomic<uint64_t> _num_pulled_tasks{0};
+  std::atomic<uint64_t> _num_tasks_stolen_locally{0};
+  std::vector<std::atomic<uint64_t>> _num_tasks_stolen_from_nodes;
+  std::atomic<uint64_t> _total_idle_iterations{0};
+  std::atomic<uint64_t> _busy_time_ns{0};
+  std::atomic<uint64_t> _idle_time_ns{0};
+  std::atomic<uint64_t> _sleep_time_ns{0};
+  std::atomic<uint64_t> _queue_wait_time_ns{0};
+
+  // Time spent on the tasks that this worker executed while the current task waited for its jobs. It is not charged
+  // to the resource group of the current task, but to the groups of these tasks.
+  std::chrono::nanoseconds _nested_task_time{0};
+
+  WorkStealingDeque _deque;
+  std::minstd_rand _random_engine;
 };
 
 }  // namespace opossum
@@ -2,6 +2,8 @@
 
 #include <boost/asio.hpp>
 
+#include <algorithm>
+
 #include "postgres_wire_handler.hpp"
 #include "then_operator.hpp"
 #include "use_boost_future.hpp"
@@ -12,9 +14,8 @@ using opossum::then_operator::then;
 
 const auto ignore_sent_bytes = [](uint64_t sent_bytes) {};
 
-ClientConnection::ClientConnection(boost::asio::ip::tcp::socket socket) : _socket(std::move(socket)) {
-  _response_buffer.reserve(_max_response_size);
-}
+// The buffers grow with the first messages, so that connections that are opened, but barely used, stay small
+ClientConnection::ClientConnection(boost::asio::ip::tcp::socket socket) : _socket(std::move(socket)) {}
 
 boost::future<uint32_t> ClientConnection::receive_startup_packet_header() {
   constexpr uint32_t STARTUP_HEADER_LENGTH = 8u;
@@ -29,6 +30,13 @@ boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size)
   };
 }
 
+boost::future<CancelRequestPacket> ClientConnection::receive_cancel_request_packet_body() {
+  // The process ID and the secret key of the session whose query is to be cancelled
+  constexpr uint32_t CANCEL_REQUEST_BODY_LENGTH = 8u;
+
+  return _receive_bytes_async(CANCEL_REQUEST_BODY_LENGTH) >> then >> PostgresWireHandler::handle_cancel_request_packet;
+}
+
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
   constexpr uint32_t HEADER_LENGTH = 5u;
 
@@ -61,10 +69,23 @@ boost::future<void> ClientConnection::receive_flush_packet_body(uint32_t size) {
   return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
 }
 
-boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_t size) {
+boost::future<ExecutePacket> ClientConnection::receive_execute_packet_body(uint32_t size) {
   return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
 }
 
+boost::future<std::string> ClientConnection::receive_copy_data_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_data_packet;
+}
+
+boost::future<void> ClientConnection::receive_copy_done_packet_body(uint32_t size) {
+  // Packet has no content, we'll make the receive call anyways, just in case size > 0
+  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+}
+
+boost::future<std::string> ClientConnection::receive_copy_fail_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_fail_packet;
+}
+
 boost::future<void> ClientConnection::send_ssl_denied() {
   // Don't use new_output_packet here, because this packet has special size requirements (only contains N, no size)
   auto output_packet = std::make_shared<OutputPacket>();
@@ -87,6 +108,13 @@ boost::future<void> ClientConnection::send_parameter_status(const std::string& k
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
+boost::future<void> ClientConnection::send_backend_key_data(uint32_t process_id, uint32_t secret_key) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::BackendKeyData);
+  PostgresWireHandler::write_value(*output_packet, htonl(process_id));
+  PostgresWireHandler::write_value(*output_packet, htonl(secret_key));
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
 boost::future<void> ClientConnection::send_ready_for_query() {
   // ReadyForQuery packet 'Z' with transaction status Idle 'I'
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ReadyForQuery);
@@ -104,7 +132,7 @@ boost::future<void> ClientConnection::send_error(const std::string& message) {
 
   // Terminate the error response
   PostgresWireHandler::write_value(*output_packet, '\0');
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
 boost::future<void> ClientConnection::send_notice(const std::string& notice) {
@@ -116,7 +144,7 @@ boost::future<void> ClientConnection::send_notice(const std::string& notice) {
 
   // Terminate the notice response
   PostgresWireHandler::write_value(*output_packet, '\0');
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
 boost::future<void> ClientConnection::send_status_message(const NetworkMessageType& type) {
@@ -168,13 +196,14 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet,
                                      htons(static_cast<uint16_t>(column_description.type_width)));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                                    // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                                    // text format
+    PostgresWireHandler::write_value(*output_packet,
+                                     htons(static_cast<uint16_t>(column_description.format_code)));  // format code
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
+boost::future<void> ClientConnection::send_data_row(const std::vector<std::optional<std::string>>& row_values) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
 
   /*
@@ -199,16 +228,54 @@ boost::future<void> ClientConnection::send_data_row(const std::vector<std::strin
   */
 
   // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
+  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_values.size())));
+
+  for (const auto& value : row_values) {
+    if (!value) {
+      PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(-1)));
+      continue;
+    }
+
+    // Size of the text or binary representation of the value, NOT of the value type's size
+    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value->length())));
+
+    // Values are sent as non-terminated strings, binary values hold their bytes in network byte order
+    PostgresWireHandler::write_string(*output_packet, *value, false);
+  }
+
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
+boost::future<void> ClientConnection::send_copy_in_response(uint16_t column_count, FormatCode format) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CopyInResponse);
+
+  // The overall format and the format of each column, which have to be the same
+  PostgresWireHandler::write_value(*output_packet, static_cast<int8_t>(format));
+  PostgresWireHandler::write_value(*output_packet, htons(column_count));
+  for (auto column_idx = uint16_t{0}; column_idx < column_count; ++column_idx) {
+    PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(format)));
+  }
+
+  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+}
 
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
+boost::future<void> ClientConnection::send_copy_out_response(uint16_t column_count) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CopyOutResponse);
 
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
+  // The overall format and the format of each column, we only send COPY data as text
+  PostgresWireHandler::write_value(*output_packet, static_cast<int8_t>(FormatCode::Text));
+  PostgresWireHandler::write_value(*output_packet, htons(column_count));
+  for (auto column_idx = uint16_t{0}; column_idx < column_count; ++column_idx) {
+    PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(FormatCode::Text)));
   }
 
+  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+}
+
+boost::future<void> ClientConnection::send_copy_data(const std::string& data) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CopyData);
+  PostgresWireHandler::write_string(*output_packet, data, false);
+
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
@@ -216,26 +283,55 @@ boost::future<void> ClientConnection::send_command_complete(const std::string& m
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
   PostgresWireHandler::write_string(*output_packet, message);
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  // Not flushed, the client waits for the ReadyForQuery after the last command of a query or pipeline
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
+boost::future<void> ClientConnection::flush() {
+  if (_response_size == 0) return boost::make_ready_future();
+  return _flush_async() >> then >> ignore_sent_bytes;
 }
 
 boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
-  auto result = std::make_shared<InputPacket>();
-  result->data.resize(size);
+  const auto buffered_size = _read_buffer.size() - _read_offset;
+  if (buffered_size >= size) return boost::make_ready_future(_take_buffered_bytes(size));
+
+  // Keep the bytes that were not handled yet and append the next ones
+  _read_buffer.erase(_read_buffer.begin(), _read_buffer.begin() + static_cast<std::ptrdiff_t>(_read_offset));
+  _read_offset = 0;
+  const auto missing_size = size - buffered_size;
+  _read_buffer.resize(buffered_size + std::max(missing_size, size_t{_read_ahead_size}));
 
   // We need a copy of this client connection to outlive the async operation
   auto self = shared_from_this();
-  return _socket.async_read_some(boost::asio::buffer(result->data, size), boost::asio::use_boost_future) >> then >>
-         [self, result, size](uint64_t received_size) {
+  // async_read() completes once at least the missing bytes were received, which can take several reads for bigger
+  // packets, such as the CopyData messages of COPY ... FROM STDIN. It returns the bytes of the following messages
+  // that arrived already, too.
+  const auto read_buffer =
+      boost::asio::buffer(_read_buffer.data() + buffered_size, _read_buffer.size() - buffered_size);
+  return boost::asio::async_read(_socket, read_buffer, boost::asio::transfer_at_least(missing_size),
+                                 boost::asio::use_boost_future) >>
+         then >> [this, self, buffered_size, size](uint64_t received_size) {
            // If this assertion should fail, we will end up in either the error handler for the current command or
            // the entire session. The connection may be closed but the server will keep running either way.
-           Assert(received_size == size, "Client sent less data than expected.");
+           Assert(buffered_size + received_size >= size, "Client sent less data than expected.");
 
-           result->offset = result->data.begin();
-           return std::move(*result);
+           _read_buffer.resize(buffered_size + received_size);
+           return _take_buffered_bytes(size);
          };
 }
 
+InputPacket ClientConnection::_take_buffered_bytes(size_t size) {
+  const auto begin = _read_buffer.cbegin() + static_cast<std::ptrdiff_t>(_read_offset);
+
+  auto packet = InputPacket{};
+  packet.data.assign(begin, begin + static_cast<std::ptrdiff_t>(size));
+  packet.offset = packet.data.cbegin();
+  _read_offset += size;
+
+  return packet;
+}
+
 boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush) {
   const auto packet_size = packet->data.size();
 
@@ -244,32 +340,55 @@ boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_pt
     PostgresWireHandler::write_output_packet_size(*packet);
   }
 
-  // If this fails, the connection may be closed but the server will keep running.
-  Assert(packet_size <= _max_response_size,
-         "The output packet is too big and cannot be sent. This should never happen!");
-
-  if (_response_buffer.size() + packet_size > _max_response_size) {
-    // We have to flush before we can actually process the data
-    return _flush_async() >> then >> [=](uint64_t) { return _send_bytes_async(packet, flush); };
+  if (packet_size <= _max_copied_packet_size) {
+    _response_buffer.insert(_response_buffer.end(), packet->data.begin(), packet->data.end());
+  } else {
+    // Larger messages, e.g., rows with long strings, are not copied, but written from their own buffer
+    _close_response_buffer();
+    _response_chunks.emplace_back(std::move(packet->data));
   }
+  _response_size += packet_size;
 
-  _response_buffer.insert(_response_buffer.end(), packet->data.begin(), packet->data.end());
-
-  if (flush) {
+  if (flush || _response_size >= _max_response_size) {
     return _flush_async() >> then >> [=](uint64_t) { return static_cast<uint64_t>(packet_size); };
-  } else {
-    // Return an already resolved future (we have just written data to the buffer)
-    return boost::make_ready_future<uint64_t>(packet_size);
   }
+
+  // Return an already resolved future (we have just written data to the buffer)
+  return boost::make_ready_future<uint64_t>(packet_size);
 }
 
 boost::future<uint64_t> ClientConnection::_flush_async() {
-  return _socket.async_send(boost::asio::buffer(_response_buffer), boost::asio::use_boost_future) >> then >>
-         [=](uint64_t sent_bytes) {
+  _close_response_buffer();
+  const auto response_chunks = std::make_shared<std::vector<ByteBuffer>>(std::move(_response_chunks));
+  const auto response_size = _response_size;
+  _response_chunks.clear();
+  _response_size = 0;
+
+  auto buffers = std::vector<boost::asio::const_buffer>{};
+  buffers.reserve(response_chunks->size());
+  for (const auto& response_chunk : *response_chunks) {
+    buffers.emplace_back(boost::asio::buffer(response_chunk));
+  }
+
+  // We need a copy of this client connection to outlive the async operation
+  auto self = shared_from_this();
+  // async_write() gathers the chunks into as few sends as possible (sendmsg() with an iovec per chunk) and only
+  // completes once all of them were sent, which can take several sends if the socket's send buffer is full. The
+  // session does not serialize more rows until then, see QueryResponseBuilder.
+  return boost::asio::async_write(_socket, buffers, boost::asio::use_boost_future) >> then >>
+         [self, response_chunks, response_size](uint64_t sent_bytes) {
            // If this fails, the connection may be closed but the server will keep running.
-           Assert(sent_bytes == _response_buffer.size(), "Could not send all data");
-           _response_buffer.clear();
+           Assert(sent_bytes == response_size, "Could not send all data");
            return static_cast<uint64_t>(sent_bytes);
          };
 }
+
+void ClientConnection::_close_response_buffer() {
+  if (_response_buffer.empty()) return;
+
+  _response_chunks.emplace_back(std::move(_response_buffer));
+  _response_buffer = ByteBuffer{};
+  _response_buffer.reserve(_max_response_size);
+}
+
 }  // namespace opossum
@@ -4,6 +4,9 @@
 #include <boost/thread/future.hpp>
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace opossum {
 
@@ -13,23 +16,33 @@ struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
+struct ExecutePacket;
+struct CancelRequestPacket;
 enum class NetworkMessageType : unsigned char;
+enum class FormatCode : int16_t;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  FormatCode format_code;
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
 // network messages using the PostgresWireHandler. It's a very thin wrapper
 // because the ASIO socket is hard to mock, so there are no tests for this class
+//
+// Reads fetch as many bytes as the client has sent already, so that the messages that a client pipelines (e.g.,
+// Parse/Bind/Execute/Sync) are received in one read and handled without waiting for the socket. Responses are
+// buffered until the client waits for them (ReadyForQuery, CopyInResponse, ...) or flush() is called, so that the
+// responses to a pipeline are sent in few writes.
 class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
  public:
   explicit ClientConnection(boost::asio::ip::tcp::socket socket);
 
   boost::future<uint32_t> receive_startup_packet_header();
   boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<CancelRequestPacket> receive_cancel_request_packet_body();
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
@@ -38,30 +51,59 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<std::string> receive_describe_packet_body(uint32_t size);
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
-  boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  boost::future<ExecutePacket> receive_execute_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_data_packet_body(uint32_t size);
+  boost::future<void> receive_copy_done_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_fail_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
   boost::future<void> send_parameter_status(const std::string& key, const std::string& value);
+  boost::future<void> send_backend_key_data(uint32_t process_id, uint32_t secret_key);
   boost::future<void> send_ready_for_query();
   boost::future<void> send_error(const std::string& message);
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  // std::nullopt is sent as NULL
+  boost::future<void> send_data_row(const std::vector<std::optional<std::string>>& row_values);
+  boost::future<void> send_copy_in_response(uint16_t column_count, FormatCode format);
+  boost::future<void> send_copy_out_response(uint16_t column_count);
+  boost::future<void> send_copy_data(const std::string& data);
   boost::future<void> send_command_complete(const std::string& message);
 
+  // Sends the buffered responses, e.g., for a Flush message
+  boost::future<void> flush();
+
  protected:
   boost::future<InputPacket> _receive_bytes_async(size_t size);
+  InputPacket _take_buffered_bytes(size_t size);
 
   boost::future<uint64_t> _send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush = false);
   boost::future<uint64_t> _flush_async();
 
+  // Appends the _response_buffer to the _response_chunks and starts a new one
+  void _close_response_buffer();
+
   boost::asio::ip::tcp::socket _socket;
 
-  // Max 2048 bytes per IP packet sent
-  uint32_t _max_response_size = 2048;
+  // Responses are sent once they exceed this size at the latest
+  uint32_t _max_response_size = 16384;
+
+  // Small messages, such as most DataRows, are copied into the _response_buffer, so that a batch of them is written
+  // from one buffer. Larger ones are not copied, but sent from their own buffer in the same write. The chunks are
+  // the buffers that a flush writes, in this order, before the _response_buffer.
+  uint32_t _max_copied_packet_size = 1024;
   ByteBuffer _response_buffer;
+  std::vector<ByteBuffer> _response_chunks;
+  size_t _response_size{0};
+
+  // The bytes that were received, but not handled yet, start at the _read_offset
+  ByteBuffer _read_buffer;
+  size_t _read_offset{0};
+
+  // Reads ask for at least as many bytes, even if fewer are needed for the next message
+  uint32_t _read_ahead_size = 4096;
 };
 
 }  // namespace opossum
@@ -0,0 +1,359 @@
+#include "copy_in_parser.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "import_export/csv_converter.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Not using Assert() in this file since it includes file:line info that we don't want to send to the client
+
+template <typename T>
+T read_big_endian(const std::string& data, const size_t offset) {
+  auto value = T{};
+  std::memcpy(&value, data.data() + offset, sizeof(T));
+  boost::endian::big_to_native_inplace(value);
+  return value;
+}
+
+template <typename T>
+T value_from_text(const std::string& text) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return text;
+  } else {
+    if constexpr (std::is_integral_v<T>) {
+      if (const auto value = BaseCsvConverter::parse_plain_integer<T>(text)) return *value;
+    }
+
+    auto position = size_t{0};
+    auto value = T{};
+    if constexpr (std::is_same_v<T, int32_t>) {
+      value = std::stoi(text, &position);
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      value = static_cast<int64_t>(std::stoll(text, &position));
+    } else if constexpr (std::is_same_v<T, float>) {
+      value = std::stof(text, &position);
+    } else {
+      value = std::stod(text, &position);
+    }
+
+    if (position != text.size()) Fail("Could not convert COPY value '" + text + "'.");
+    return value;
+  }
+}
+
+// Integers and IEEE 754 floating point numbers in network byte order, see binary_value() in QueryResponseBuilder
+template <typename T>
+T value_from_binary(const std::string& data, const size_t offset, const size_t size) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return data.substr(offset, size);
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    static_assert(sizeof(T) == sizeof(Bits), "Unexpected size of a numeric type");
+
+    if (size != sizeof(T)) Fail("Binary COPY value has the wrong size for its column.");
+
+    const auto bits = read_big_endian<Bits>(data, offset);
+    auto value = T{};
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+}
+
+// Unescapes a value in COPY's text format, see QueryResponseBuilder::build_copy_data()
+std::string unescape_text(const std::string_view field) {
+  auto value = std::string{};
+  value.reserve(field.size());
+
+  for (auto char_idx = size_t{0}; char_idx < field.size(); ++char_idx) {
+    if (field[char_idx] != '\\' || char_idx + 1 == field.size()) {
+      value += field[char_idx];
+      continue;
+    }
+
+    ++char_idx;
+    switch (field[char_idx]) {
+      case 'b':
+        value += '\b';
+        break;
+      case 'f':
+        value += '\f';
+        break;
+      case 'n':
+        value += '\n';
+        break;
+      case 'r':
+        value += '\r';
+        break;
+      case 't':
+        value += '\t';
+        break;
+      case 'v':
+        value += '\v';
+        break;
+      default:
+        // Any other character stands for itself, e.g., the backslash
+        value += field[char_idx];
+    }
+  }
+
+  return value;
+}
+
+}  // namespace
+
+namespace opossum {
+
+// Collects the values of one column for the current batch, similar to the TypedSegmentProcessors of Insert
+class AbstractCopyInColumn {
+ public:
+  virtual ~AbstractCopyInColumn() = default;
+
+  virtual void append_null() = 0;
+  virtual void append_text(const std::string& text) = 0;
+  virtual void append_binary(const std::string& data, const size_t offset, const size_t size) = 0;
+
+  // Returns the values that were appended since the last call
+  virtual std::shared_ptr<BaseSegment> take_segment() = 0;
+};
+
+template <typename T>
+class CopyInColumn : public AbstractCopyInColumn {
+ public:
+  CopyInColumn(const bool is_nullable, const ChunkOffset batch_row_count)
+      : _is_nullable(is_nullable), _batch_row_count(batch_row_count) {
+    _reserve();
+  }
+
+  void append_null() override {
+    if (!_is_nullable) Fail("Cannot COPY NULL into a NOT NULL column.");
+    _values.emplace_back();
+    _null_values.emplace_back(true);
+  }
+
+  void append_text(const std::string& text) override { _append(value_from_text<T>(text)); }
+
+  void append_binary(const std::string& data, const size_t offset, const size_t size) override {
+    _append(value_from_binary<T>(data, offset, size));
+  }
+
+  std::shared_ptr<BaseSegment> take_segment() override {
+    auto segment = _is_nullable ? std::make_shared<ValueSegment<T>>(std::move(_values), std::move(_null_values))
+                                : std::make_shared<ValueSegment<T>>(std::move(_values));
+    _values = pmr_concurrent_vector<T>{};
+    _null_values = pmr_concurrent_vector<bool>{};
+    _reserve();
+    return segment;
+  }
+
+ protected:
+  void _append(T value) {
+    _values.emplace_back(std::move(value));
+    if (_is_nullable) _null_values.emplace_back(false);
+  }
+
+  void _reserve() {
+    _values.reserve(_batch_row_count);
+    if (_is_nullable) _null_values.reserve(_batch_row_count);
+  }
+
+  const bool _is_nullable;
+  const ChunkOffset _batch_row_count;
+
+  pmr_concurrent_vector<T> _values;
+  pmr_concurrent_vector<bool> _null_values;
+};
+
+CopyInParser::CopyInParser(const Table& target_table, const FormatCode format)
+    : _column_definitions(target_table.column_definitions()),
+      _format(format),
+      _batch_row_count(std::min(target_table.max_chunk_size(), static_cast<uint32_t>(Chunk::DEFAULT_SIZE))) {
+  for (const auto& column_definition : _column_definitions) {
+    _columns.emplace_back(make_unique_by_data_type<AbstractCopyInColumn, CopyInColumn>(
+        column_definition.data_type, column_definition.nullable, _batch_row_count));
+  }
+}
+
+CopyInParser::~CopyInParser() = default;
+
+void CopyInParser::parse(const std::string& data) {
+  // Only an incomplete row is left from the previous message
+  _data.erase(0, _data_offset);
+  _data_offset = 0;
+  _data += data;
+
+  // Anything after the end of the data is ignored, as in PostgreSQL
+  while (!_has_parsed_end_of_data) {
+    auto has_parsed = false;
+    if (_format == FormatCode::Text) {
+      has_parsed = _parse_text_row();
+    } else if (!_has_parsed_binary_header) {
+      has_parsed = _parse_binary_header();
+    } else {
+      has_parsed = _parse_binary_row();
+    }
+
+    if (!has_parsed) break;
+  }
+}
+
+std::vector<std::shared_ptr<Table>> CopyInParser::take_full_batches() {
+  auto full_batches = std::move(_full_batches);
+  _full_batches.clear();
+  return full_batches;
+}
+
+std::vector<std::shared_ptr<Table>> CopyInParser::finish() {
+  // The last line of the text format does not need to end with a line break
+  if (_format == FormatCode::Text && !_has_parsed_end_of_data && _data_offset != _data.size()) parse("\n");
+
+  if (_format == FormatCode::Binary && !_has_parsed_end_of_data) Fail("Binary COPY data ended without its trailer.");
+
+  if (_current_batch_row_count > 0) _full_batches.emplace_back(_take_batch());
+  return take_full_batches();
+}
+
+uint64_t CopyInParser::row_count() const { return _row_count; }
+
+ChunkOffset CopyInParser::batch_row_count() const { return _batch_row_count; }
+
+bool CopyInParser::_parse_text_row() {
+  const auto line_end = _data.find('\n', _data_offset);
+  if (line_end == std::string::npos) return false;
+
+  auto line = std::string_view{_data}.substr(_data_offset, line_end - _data_offset);
+  _data_offset = line_end + 1;
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+  // The end-of-data marker that clients of older protocol versions send
+  if (line == "\\.") {
+    _has_parsed_end_of_data = true;
+    return true;
+  }
+
+  // Tabs in values are escaped, so every tab separates two values
+  auto column_idx = size_t{0};
+  auto field_begin = size_t{0};
+  while (true) {
+    if (column_idx == _columns.size()) Fail("COPY data has more columns than the table.");
+
+    const auto field_end = std::min(line.find('\t', field_begin), line.size());
+    const auto field = line.substr(field_begin, field_end - field_begin);
+    if (field == "\\N") {
+      _columns[column_idx]->append_null();
+    } else {
+      _columns[column_idx]->append_text(unescape_text(field));
+    }
+    ++column_idx;
+
+    if (field_end == line.size()) break;
+    field_begin = field_end + 1;
+  }
+
+  if (column_idx != _columns.size()) Fail("COPY data has fewer columns than the table.");
+
+  _complete_row();
+  return true;
+}
+
+bool CopyInParser::_parse_binary_header() {
+  // The signature is followed by 32 bits of flags and the length of the header extension
+  static const auto signature = std::string{"PGCOPY\n\377\r\n", 11};
+  const auto header_size = signature.size() + 2 * sizeof(uint32_t);
+  if (_data.size() - _data_offset < header_size) return false;
+
+  if (_data.compare(_data_offset, signature.size(), signature) != 0) {
+    Fail("COPY data does not start with the signature of the binary format.");
+  }
+
+  // Bit 16 of the flags indicates that the rows contain OIDs, the other bits are of no relevance here
+  const auto flags = read_big_endian<uint32_t>(_data, _data_offset + signature.size());
+  if (flags & (1u << 16u)) Fail("Binary COPY data with OIDs is not supported.");
+
+  const auto extension_size = read_big_endian<uint32_t>(_data, _data_offset + signature.size() + sizeof(uint32_t));
+  if (_data.size() - _data_offset < header_size + extension_size) return false;
+
+  _data_offset += header_size + extension_size;
+  _has_parsed_binary_header = true;
+  return true;
+}
+
+bool CopyInParser::_parse_binary_row() {
+  auto offset = _data_offset;
+  const auto is_available = [&](const size_t size) { return _data.size() - offset >= size; };
+
+  if (!is_available(sizeof(int16_t))) return false;
+  const auto value_count = read_big_endian<int16_t>(_data, offset);
+  offset += sizeof(int16_t);
+
+  // The trailer
+  if (value_count == -1) {
+    _data_offset = offset;
+    _has_parsed_end_of_data = true;
+    return true;
+  }
+
+  if (static_cast<size_t>(value_count) != _columns.size()) {
+    Fail("COPY data has a different number of columns than the table.");
+  }
+
+  // Only append the values once the row is complete
+  _binary_values.clear();
+  for (auto column_idx = size_t{0}; column_idx < _columns.size(); ++column_idx) {
+    if (!is_available(sizeof(int32_t))) return false;
+    const auto value_size = read_big_endian<int32_t>(_data, offset);
+    offset += sizeof(int32_t);
+
+    // -1 stands for NULL
+    if (value_size > 0 && !is_available(value_size)) return false;
+    _binary_values.emplace_back(offset, value_size);
+    offset += std::max(value_size, 0);
+  }
+
+  for (auto column_idx = size_t{0}; column_idx < _columns.size(); ++column_idx) {
+    const auto [value_offset, value_size] = _binary_values[column_idx];
+    if (value_size < 0) {
+      _columns[column_idx]->append_null();
+    } else {
+      _columns[column_idx]->append_binary(_data, value_offset, value_size);
+    }
+  }
+  _data_offset = offset;
+
+  _complete_row();
+  return true;
+}
+
+void CopyInParser::_complete_row() {
+  ++_current_batch_row_count;
+  ++_row_count;
+  if (_current_batch_row_count == _batch_row_count) _full_batches.emplace_back(_take_batch());
+}
+
+std::shared_ptr<Table> CopyInParser::_take_batch() {
+  auto segments = Segments{};
+  for (const auto& column : _columns) {
+    segments.emplace_back(column->take_segment());
+  }
+
+  const auto batch = std::make_shared<Table>(_column_definitions, TableType::Data, _batch_row_count);
+  batch->append_chunk(segments);
+  _current_batch_row_count = 0;
+  return batch;
+}
+
+}  // namespace opossum
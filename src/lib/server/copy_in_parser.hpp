@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "server/types.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class AbstractCopyInColumn;
+
+/**
+ * Parses the data of COPY table FROM STDIN, which the client sends in CopyData messages, in the text or the binary
+ * format of PostgreSQL's COPY. The client splits the data into messages regardless of rows, so an incomplete row is
+ * kept until the next message completes it.
+ *
+ * The rows are converted into batches, i.e., tables of the target table's columns with a single chunk of
+ * ValueSegments, which the Insert operator copies into the target table without any further conversion.
+ */
+class CopyInParser {
+ public:
+  CopyInParser(const Table& target_table, const FormatCode format);
+  ~CopyInParser();
+
+  void parse(const std::string& data);
+
+  // Returns the batches that are full and removes them from the parser
+  std::vector<std::shared_ptr<Table>> take_full_batches();
+
+  // Called once the client has sent CopyDone. Returns the remaining batches, the last of which might not be full.
+  std::vector<std::shared_ptr<Table>> finish();
+
+  // Number of rows that were parsed so far
+  uint64_t row_count() const;
+
+  // Number of rows in a full batch, which is also the size of a chunk of the target table unless it has bigger chunks
+  ChunkOffset batch_row_count() const;
+
+ protected:
+  // Return false if the data does not hold the complete row, header, or trailer yet
+  bool _parse_text_row();
+  bool _parse_binary_header();
+  bool _parse_binary_row();
+
+  // Adds the current batch to _full_batches once it is full
+  void _complete_row();
+  std::shared_ptr<Table> _take_batch();
+
+  const TableColumnDefinitions _column_definitions;
+  const FormatCode _format;
+  const ChunkOffset _batch_row_count;
+
+  std::vector<std::unique_ptr<AbstractCopyInColumn>> _columns;
+  ChunkOffset _current_batch_row_count{0};
+  uint64_t _row_count{0};
+  std::vector<std::shared_ptr<Table>> _full_batches;
+
+  // Data that has not been parsed yet, starting at _data_offset
+  std::string _data;
+  size_t _data_offset{0};
+
+  // Offsets and lengths of the values of the binary row that is currently parsed
+  std::vector<std::pair<size_t, int32_t>> _binary_values;
+
+  bool _has_parsed_binary_header{false};
+  bool _has_parsed_end_of_data{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#include "io_service_pool.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IoServicePool::IoServicePool(const size_t size) {
+  Assert(size > 0, "IoServicePool needs at least one io_service");
+
+  _io_services.reserve(size);
+  for (auto io_service_idx = size_t{0}; io_service_idx < size; ++io_service_idx) {
+    _io_services.emplace_back(std::make_unique<boost::asio::io_service>());
+  }
+}
+
+size_t IoServicePool::size() const { return _io_services.size(); }
+
+boost::asio::io_service& IoServicePool::acceptor_io_service() { return *_io_services.front(); }
+
+boost::asio::io_service& IoServicePool::next_io_service() {
+  auto& io_service = *_io_services[_next_io_service_idx];
+  _next_io_service_idx = (_next_io_service_idx + 1) % _io_services.size();
+  return io_service;
+}
+
+void IoServicePool::run() {
+  // io_services without sessions would return from run() right away
+  auto works = std::vector<boost::asio::io_service::work>{};
+  works.reserve(_io_services.size());
+  for (auto& io_service : _io_services) {
+    works.emplace_back(*io_service);
+  }
+
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(_io_services.size() - 1);
+  for (auto io_service_idx = size_t{1}; io_service_idx < _io_services.size(); ++io_service_idx) {
+    threads.emplace_back([&, io_service_idx]() { _io_services[io_service_idx]->run(); });
+  }
+
+  _io_services.front()->run();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void IoServicePool::stop() {
+  for (auto& io_service : _io_services) {
+    io_service->stop();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <boost/asio/io_service.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+// A fixed number of io_services that each run on a thread of their own. The Server accepts connections on the first
+// one and spreads the sessions across all of them. As a session and its TaskRunner stay on one io_service, all of
+// its IO, packet parsing, and result serialization run on the same thread, so that it needs no strand.
+class IoServicePool {
+ public:
+  explicit IoServicePool(const size_t size);
+
+  size_t size() const;
+
+  // The io_service that accepts the connections
+  boost::asio::io_service& acceptor_io_service();
+
+  // Returns the io_services round-robin. Only called on the thread of the acceptor_io_service().
+  boost::asio::io_service& next_io_service();
+
+  // Runs the io_services, one of them on the calling thread, until they are stopped
+  void run();
+
+  void stop();
+
+ protected:
+  std::vector<std::unique_ptr<boost::asio::io_service>> _io_services;
+  size_t _next_io_service_idx{0};
+};
+
+}  // namespace opossum
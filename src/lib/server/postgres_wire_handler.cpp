@@ -1,5 +1,6 @@
 #include "postgres_wire_handler.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 
@@ -26,6 +27,9 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   // Special SSL version number that we catch to deny SSL support
   if (version == 80877103) {
     return 0;
+  } else if (version == 80877102) {
+    // Special version number of a CancelRequest, whose body has a fixed size
+    return CANCEL_REQUEST;
   } else {
     // Subtract read bytes from total length
     return length - (2 * sizeof(uint32_t));
@@ -37,6 +41,13 @@ void PostgresWireHandler::handle_startup_package_content(const InputPacket& pack
   read_values<char>(packet, packet.data.size());
 }
 
+CancelRequestPacket PostgresWireHandler::handle_cancel_request_packet(const InputPacket& packet) {
+  const auto network_process_id = read_value<uint32_t>(packet);
+  const auto network_secret_key = read_value<uint32_t>(packet);
+
+  return {ntohl(network_process_id), ntohl(network_secret_key)};
+}
+
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
   auto tag = read_value<NetworkMessageType>(packet);
 
@@ -83,17 +94,33 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
   }
 
   auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
-  auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  auto result_column_format_codes = std::vector<FormatCode>{};
+  result_column_format_codes.reserve(num_result_column_format_codes);
+  for (const auto network_format_code : read_values<int16_t>(packet, num_result_column_format_codes)) {
+    const auto format_code = static_cast<FormatCode>(ntohs(network_format_code));
+    // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+    if (format_code != FormatCode::Text && format_code != FormatCode::Binary) Fail("Unknown result format code.");
+    result_column_format_codes.emplace_back(format_code);
+  }
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(result_column_format_codes)};
 }
 
-std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
-  const auto portal = read_string(packet);
-  /*const auto max_rows = */ read_value<int32_t>(packet);
-  return portal;
+ExecutePacket PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
+  auto portal = read_string(packet);
+  const auto max_rows = static_cast<int32_t>(ntohl(read_value<uint32_t>(packet)));
+
+  // Negative values are not defined by the protocol, PostgreSQL treats them as "no limit" as well
+  return ExecutePacket{std::move(portal), static_cast<uint32_t>(std::max(max_rows, 0))};
 }
 
+std::string PostgresWireHandler::handle_copy_data_packet(const InputPacket& packet) {
+  // The data is not terminated, a message can even end in the middle of a row
+  return std::string(packet.offset, packet.data.cend());
+}
+
+std::string PostgresWireHandler::handle_copy_fail_packet(const InputPacket& packet) { return read_string(packet); }
+
 std::string PostgresWireHandler::handle_describe_packet(const InputPacket& packet) {
   read_value<char>(packet);
   const auto portal = read_string(packet);
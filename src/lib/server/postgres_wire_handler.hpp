@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -39,19 +40,39 @@ struct ParsePacket {
   std::string query;
 };
 
+struct CancelRequestPacket {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
 struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
   std::vector<AllTypeVariant> params;
+
+  // Either empty (all columns as text), one code for all columns, or one code per column
+  std::vector<FormatCode> result_column_format_codes;
+};
+
+struct ExecutePacket {
+  std::string portal;
+
+  // The portal is suspended after this many rows, 0 means no limit
+  uint32_t max_rows;
 };
 
 class PostgresWireHandler {
  public:
+  // Returned by handle_startup_package() for a CancelRequest, which is sent instead of a startup packet. An SSL request
+  // results in 0.
+  static constexpr auto CANCEL_REQUEST = std::numeric_limits<uint32_t>::max();
+
   static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
   static void write_output_packet_size(OutputPacket& packet);
 
   static uint32_t handle_startup_package(const InputPacket& packet);
   static void handle_startup_package_content(const InputPacket& packet);
+  static CancelRequestPacket handle_cancel_request_packet(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
@@ -59,7 +80,9 @@ class PostgresWireHandler {
   static ParsePacket handle_parse_packet(const InputPacket& packet);
   static BindPacket handle_bind_packet(const InputPacket& packet);
   static std::string handle_describe_packet(const InputPacket& packet);
-  static std::string handle_execute_packet(const InputPacket& packet);
+  static ExecutePacket handle_execute_packet(const InputPacket& packet);
+  static std::string handle_copy_data_packet(const InputPacket& packet);
+  static std::string handle_copy_fail_packet(const InputPacket& packet);
 
   template <typename T>
   static T read_value(const InputPacket& packet);
@@ -0,0 +1,46 @@
+#include "query_cancellation_registry.hpp"
+
+#include <memory>
+
+#include "scheduler/cancellation_token.hpp"
+
+namespace opossum {
+
+QueryCancellationRegistry::QueryCancellationRegistry() : _random_engine(std::random_device{}()) {}
+
+BackendKey QueryCancellationRegistry::register_session() {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Guessing the secret key of a session must not be easy, as it lets anyone cancel the session's queries
+  const auto key = BackendKey{_next_process_id++, static_cast<uint32_t>(_random_engine())};
+  _sessions.emplace(key.process_id, Session{key.secret_key, {}});
+  return key;
+}
+
+void QueryCancellationRegistry::unregister_session(const BackendKey& key) {
+  std::lock_guard<std::mutex> lock{_mutex};
+  _sessions.erase(key.process_id);
+}
+
+void QueryCancellationRegistry::set_running_query(const BackendKey& key,
+                                                  const std::shared_ptr<CancellationToken>& cancellation_token) {
+  std::lock_guard<std::mutex> lock{_mutex};
+  const auto session_it = _sessions.find(key.process_id);
+  if (session_it != _sessions.end()) session_it->second.running_query = cancellation_token;
+}
+
+bool QueryCancellationRegistry::cancel_running_query(const BackendKey& key) {
+  auto cancellation_token = std::shared_ptr<CancellationToken>{};
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    const auto session_it = _sessions.find(key.process_id);
+    if (session_it == _sessions.end() || session_it->second.secret_key != key.secret_key) return false;
+    cancellation_token = session_it->second.running_query.lock();
+  }
+
+  if (cancellation_token) cancellation_token->cancel();
+  return true;
+}
+
+}  // namespace opossum
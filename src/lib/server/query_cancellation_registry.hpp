@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class CancellationToken;
+
+// Identifies a session towards its client, which needs the key to cancel the session's query. PostgreSQL calls the
+// process_id the process ID of the backend.
+struct BackendKey {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
+// Clients cancel the running query of a session by opening a new connection and sending a CancelRequest with the key
+// of the session (https://www.postgresql.org/docs/10/static/protocol-flow.html#id-1.10.5.7.9). This registry maps the
+// keys to the tokens of the running queries, so that the session of the CancelRequest can find them.
+class QueryCancellationRegistry : public Singleton<QueryCancellationRegistry> {
+ public:
+  BackendKey register_session();
+  void unregister_session(const BackendKey& key);
+
+  // The query that a CancelRequest for the session cancels from now on
+  void set_running_query(const BackendKey& key, const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  // Returns false if there is no session with this key, in which case PostgreSQL silently ignores the request, too
+  bool cancel_running_query(const BackendKey& key);
+
+ protected:
+  friend class Singleton;
+
+  QueryCancellationRegistry();
+
+  struct Session {
+    uint32_t secret_key;
+    std::weak_ptr<CancellationToken> running_query;
+  };
+
+  std::mutex _mutex;
+  uint32_t _next_process_id{1};
+  std::mt19937 _random_engine;
+  std::unordered_map<uint32_t, Session> _sessions;
+};
+
+}  // namespace opossum
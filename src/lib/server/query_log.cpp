@@ -0,0 +1,121 @@
+#include "query_log.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "json.hpp"
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+nlohmann::json parameter_to_json(const AllTypeVariant& parameter) {
+  if (variant_is_null(parameter)) return nullptr;
+
+  auto json = nlohmann::json{};
+  resolve_data_type(data_type_from_all_type_variant(parameter),
+                    [&](const auto type) { json = boost::get<typename decltype(type)::type>(parameter); });
+  return json;
+}
+
+// Numbers are read as Ints if they fit, otherwise as Longs or Doubles. The server receives the parameters of prepared
+// statements as strings anyway.
+AllTypeVariant parameter_from_json(const nlohmann::json& json) {
+  if (json.is_null()) return NULL_VALUE;
+  if (json.is_string()) return json.get<std::string>();
+  if (json.is_number_float()) return json.get<double>();
+
+  Assert(json.is_number_integer(), "Unexpected parameter in query log: " + json.dump());
+  const auto value = json.get<int64_t>();
+  if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+    return static_cast<int32_t>(value);
+  }
+  return value;
+}
+
+std::chrono::microseconds now() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch());
+}
+
+}  // namespace
+
+namespace opossum {
+
+void QueryLog::open(const std::string& path) {
+  std::lock_guard<std::mutex> lock(_file_mutex);
+  Assert(!_is_open, "The query log is open already");
+
+  _file.open(path, std::ios::app);
+  Assert(_file.is_open(), "Could not open the query log " + path);
+  _is_open = true;
+}
+
+void QueryLog::close() {
+  std::lock_guard<std::mutex> lock(_file_mutex);
+  if (!_is_open) return;
+
+  _is_open = false;
+  _file.close();
+}
+
+bool QueryLog::is_open() const { return _is_open; }
+
+uint64_t QueryLog::new_session_id() { return _next_session_id++; }
+
+void QueryLog::record_simple_query(const uint64_t session_id, const std::string& sql) {
+  if (!_is_open) return;
+  _record(QueryLogEntry{now(), session_id, sql, false, {}});
+}
+
+void QueryLog::record_prepared_statement(const uint64_t session_id, const std::string& sql,
+                                         const std::vector<AllTypeVariant>& parameters) {
+  if (!_is_open) return;
+  _record(QueryLogEntry{now(), session_id, sql, true, parameters});
+}
+
+void QueryLog::_record(const QueryLogEntry& entry) {
+  auto json = nlohmann::json{{"timestamp", entry.timestamp.count()},
+                             {"session", entry.session_id},
+                             {"sql", entry.sql},
+                             {"prepared", entry.is_prepared_statement}};
+  json["parameters"] = nlohmann::json::array();
+  for (const auto& parameter : entry.parameters) {
+    json["parameters"].push_back(parameter_to_json(parameter));
+  }
+  const auto line = json.dump();
+
+  // The log is flushed after each query, so that it is complete when the server is killed
+  std::lock_guard<std::mutex> lock(_file_mutex);
+  if (!_is_open) return;
+  _file << line << std::endl;
+}
+
+std::vector<QueryLogEntry> QueryLog::read(const std::string& path) {
+  auto file = std::ifstream{path};
+  Assert(file.is_open(), "Could not open the query log " + path);
+
+  auto entries = std::vector<QueryLogEntry>{};
+  auto line = std::string{};
+  while (std::getline(file, line)) {
+    if (line.empty()) continue;
+
+    const auto json = nlohmann::json::parse(line);
+    auto entry = QueryLogEntry{std::chrono::microseconds{json.at("timestamp").get<int64_t>()},
+                               json.at("session").get<uint64_t>(), json.at("sql").get<std::string>(),
+                               json.at("prepared").get<bool>(), {}};
+    for (const auto& parameter : json.at("parameters")) {
+      entry.parameters.emplace_back(parameter_from_json(parameter));
+    }
+    entries.emplace_back(std::move(entry));
+  }
+  return entries;
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+// A query that a session of the server received, see QueryLog
+struct QueryLogEntry {
+  // Microseconds since the epoch, when the query was received
+  std::chrono::microseconds timestamp;
+  uint64_t session_id;
+  std::string sql;
+
+  // Whether the query was a prepared statement, and the values bound to its placeholders
+  bool is_prepared_statement{false};
+  std::vector<AllTypeVariant> parameters;
+};
+
+/**
+ * Records the queries that the sessions of the server receive, so that the workload can be replayed (see
+ * WorkloadReplayer). The server enables it if the environment variable HYRISE_QUERY_LOG names the log file.
+ *
+ * Each line of the log is a JSON object with the timestamp, the id of the session, the SQL string and the parameters
+ * of one query. Simple queries are recorded when they are received, prepared statements when a bound portal is
+ * executed, with the SQL string that was prepared.
+ */
+class QueryLog : public Singleton<QueryLog> {
+ public:
+  // Appends the queries to the file at @param path from now on
+  void open(const std::string& path);
+  void close();
+  bool is_open() const;
+
+  // The ids of the sessions that the entries refer to, unique within the lifetime of the server
+  uint64_t new_session_id();
+
+  // Does nothing if the log is not open
+  void record_simple_query(const uint64_t session_id, const std::string& sql);
+  void record_prepared_statement(const uint64_t session_id, const std::string& sql,
+                                 const std::vector<AllTypeVariant>& parameters);
+
+  // The entries of the log at @param path, in the order in which they were recorded
+  static std::vector<QueryLogEntry> read(const std::string& path);
+
+ protected:
+  friend class Singleton;
+
+  QueryLog() = default;
+
+  void _record(const QueryLogEntry& entry);
+
+  std::atomic_bool _is_open{false};
+  std::atomic<uint64_t> _next_session_id{1};
+
+  std::mutex _file_mutex;
+  std::ofstream _file;
+};
+
+}  // namespace opossum
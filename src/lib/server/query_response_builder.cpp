@@ -1,17 +1,61 @@
 #include "query_response_builder.hpp"
 
+#include <boost/endian/conversion.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
 
 #include "SQLParserResult.h"
 
+#include "resolve_type.hpp"
 #include "then_operator.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// PostgreSQL's binary format is big-endian, floating point numbers are sent as their IEEE 754 bit pattern. The bytes
+// fit into the small string buffer, so that unlike the text format, this does not allocate.
+template <typename T>
+std::string binary_value(const T value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return value;
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    static_assert(sizeof(T) == sizeof(Bits), "Unexpected size of a numeric type");
+
+    auto bits = Bits{};
+    std::memcpy(&bits, &value, sizeof(T));
+    boost::endian::native_to_big_inplace(bits);
+    return std::string(reinterpret_cast<const char*>(&bits), sizeof(Bits));
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+std::vector<FormatCode> QueryResponseBuilder::build_column_formats(const std::vector<FormatCode>& format_codes,
+                                                                   const size_t column_count) {
+  if (format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (format_codes.size() == 1) return std::vector<FormatCode>(column_count, format_codes.front());
+
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (format_codes.size() != column_count) Fail("The number of result format codes does not match the result.");
+  return format_codes;
+}
+
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& column_formats) {
   std::vector<ColumnDescription> result;
 
   const auto& column_names = table->column_names();
@@ -46,7 +90,8 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    const auto format_code = column_formats.empty() ? FormatCode::Text : column_formats[column_id];
+    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id, format_code});
   }
 
   return result;
@@ -76,38 +121,109 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
   return sql_pipeline->metrics().to_string();
 }
 
-boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
-  // Essentially we're iterating over every row in every chunk in the table, generating and sending
-  // its string representation. However, because of the asynchronous send_row call, we have to
-  // use this two-level recursion instead of two nested for-loops
+std::string QueryResponseBuilder::build_copy_data(const std::vector<std::optional<std::string>>& row_values) {
+  // Values are separated by tabs and NULL is written as \N. Thus, backslashes, tabs, and line breaks in the values
+  // have to be escaped.
+  auto copy_data = std::string{};
+  for (auto value_idx = size_t{0}; value_idx < row_values.size(); ++value_idx) {
+    if (value_idx > 0) copy_data += '\t';
+
+    const auto& value = row_values[value_idx];
+    if (!value) {
+      copy_data += "\\N";
+      continue;
+    }
+
+    for (const auto character : *value) {
+      switch (character) {
+        case '\\':
+          copy_data += "\\\\";
+          break;
+        case '\t':
+          copy_data += "\\t";
+          break;
+        case '\n':
+          copy_data += "\\n";
+          break;
+        case '\r':
+          copy_data += "\\r";
+          break;
+        default:
+          copy_data += character;
+      }
+    }
+  }
+  copy_data += '\n';
 
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
+  return copy_data;
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table,
+                                                                  const uint64_t row_offset,
+                                                                  const uint64_t max_row_count,
+                                                                  const std::vector<FormatCode>& column_formats) {
+  DebugAssert(row_offset <= table.row_count(), "Row offset is out of range");
+
+  // Skip the rows that were sent before the portal was suspended
+  auto chunk_id = ChunkID{0};
+  auto chunk_offset = row_offset;
+  while (chunk_id < table.chunk_count() && chunk_offset >= table.get_chunk(chunk_id)->size()) {
+    chunk_offset -= table.get_chunk(chunk_id)->size();
+    ++chunk_id;
+  }
 
-  const auto& chunk = table.get_chunk(current_chunk_id);
+  auto row_count = table.row_count() - row_offset;
+  if (max_row_count != 0) row_count = std::min(row_count, max_row_count);
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
+  return _send_query_response_rows(send_row, table, column_formats, chunk_id, static_cast<ChunkOffset>(chunk_offset),
+                                   row_count) >>
+         then >> [row_count]() { return row_count; };
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
-
-  std::vector<std::string> row_strings(chunk.column_count());
+boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Table& table,
+                                                                    const std::vector<FormatCode>& column_formats,
+                                                                    ChunkID chunk_id, ChunkOffset chunk_offset,
+                                                                    uint64_t remaining_row_count) {
+  // Rows are serialized in a loop for as long as the connection buffers them. Only when a send has to wait for the
+  // socket, we continue once it has completed, so that a slow client holds back the serialization instead of the
+  // result piling up in memory. Recursing for every row instead would nest a continuation per row.
+  auto row_values = std::vector<std::optional<std::string>>(table.column_count());
+
+  while (remaining_row_count > 0) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk_offset == chunk->size()) {
+      ++chunk_id;
+      chunk_offset = ChunkOffset{0};
+      continue;
+    }
 
-  for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& segment = chunk.get_segment(column_id);
-    row_strings[column_id] = type_cast_variant<std::string>((*segment)[current_chunk_offset]);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto& segment = chunk->get_segment(column_id);
+      const auto value = (*segment)[chunk_offset];
+
+      if (variant_is_null(value)) {
+        row_values[column_id] = std::nullopt;
+      } else if (!column_formats.empty() && column_formats[column_id] == FormatCode::Binary) {
+        resolve_data_type(segment->data_type(), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          row_values[column_id] = binary_value(boost::get<ColumnDataType>(value));
+        });
+      } else {
+        row_values[column_id] = type_cast_variant<std::string>(value);
+      }
+    }
+    ++chunk_offset;
+    --remaining_row_count;
+
+    auto row_sent = send_row(row_values);
+    if (!row_sent.is_ready() || row_sent.has_exception()) {
+      return std::move(row_sent) >> then >> [=, &table]() {
+        return _send_query_response_rows(send_row, table, column_formats, chunk_id, chunk_offset, remaining_row_count);
+      };
+    }
   }
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+  return boost::make_ready_future();
 }
 
 }  // namespace opossum
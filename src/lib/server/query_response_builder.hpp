@@ -1,8 +1,15 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "sql/SQLStatement.h"
 
 #include "server/client_connection.hpp"
+#include "server/types.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -12,19 +19,36 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // Resolves the result column format codes of a Bind message to one format per column
+  static std::vector<FormatCode> build_column_formats(const std::vector<FormatCode>& format_codes,
+                                                      size_t column_count);
+
+  // If column_formats is empty, all columns are sent as text
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<FormatCode>& column_formats = {});
   static std::string build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
+  // Formats a row in the text format of COPY, for CopyData messages
+  static std::string build_copy_data(const std::vector<std::optional<std::string>>& row_values);
+
+  // NULL values are passed as std::nullopt
+  using send_row_t = std::function<boost::future<void>(const std::vector<std::optional<std::string>>&)>;
 
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
+  /**
+   * Sends the rows of the table, starting at row_offset, and resolves to the number of sent rows. If max_row_count is
+   * not 0, at most that many rows are sent (see portal suspension in ServerSessionImpl::_handle_execute_command).
+   * Columns in the binary format are passed to send_row as the big-endian bytes of their values instead of text.
+   */
+  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table,
+                                                     const uint64_t row_offset = 0, const uint64_t max_row_count = 0,
+                                                     const std::vector<FormatCode>& column_formats = {});
 
  protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                         ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
+  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Table& table,
+                                                       const std::vector<FormatCode>& column_formats,
+                                                       ChunkID chunk_id, ChunkOffset chunk_offset,
+                                                       uint64_t remaining_row_count);
 };
 
 }  // namespace opossum
@@ -4,6 +4,7 @@
 #include <boost/bind.hpp>
 
 #include "client_connection.hpp"
+#include "io_service_pool.hpp"
 #include "server_session.hpp"
 #include "task_runner.hpp"
 #include "then_operator.hpp"
@@ -14,22 +15,36 @@ using opossum::then_operator::then;
 
 Server::Server(boost::asio::io_service& io_service, uint16_t port)
     : _io_service(io_service),
-      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
+  _accept_next_connection();
+}
+
+Server::Server(IoServicePool& io_service_pool, uint16_t port)
+    : _io_service(io_service_pool.acceptor_io_service()),
+      _io_service_pool(&io_service_pool),
+      _acceptor(_io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
   _accept_next_connection();
 }
 
 void Server::_accept_next_connection() {
-  _acceptor.async_accept(_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
+  // The socket is bound to the io_service of its session, so that the session's IO runs on the thread of that
+  // io_service
+  _session_io_service = _io_service_pool ? &_io_service_pool->next_io_service() : &_io_service;
+  _socket.emplace(*_session_io_service);
+
+  _acceptor.async_accept(*_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
 }
 
 void Server::_start_session(boost::system::error_code error) {
   if (!error) {
-    auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
+    auto& task_runner = _task_runners[_session_io_service];
+    if (!task_runner) task_runner = std::make_shared<TaskRunner>(*_session_io_service);
+
+    auto connection = std::make_shared<ClientConnection>(std::move(*_socket));
     auto session = std::make_shared<ServerSession>(connection, task_runner);
-    // Start the session and release it once it has terminated
-    session->start() >> then >> [=]() mutable { session.reset(); };
+    // Start the session on the thread of its io_service and release it once it has terminated. Sessions of the
+    // acceptor's io_service start right away instead of going through its queue.
+    _session_io_service->dispatch([session]() { session->start() >> then >> [=]() mutable { session.reset(); }; });
   }
 
   _accept_next_connection();
@@ -3,14 +3,24 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
 #include "server_session.hpp"
 
 namespace opossum {
 
+class IoServicePool;
+class TaskRunner;
+
 class Server {
  public:
   Server(boost::asio::io_service& io_service, uint16_t port);
 
+  // Accepts connections on the pool's acceptor_io_service() and spreads the sessions across all io_services of the pool
+  Server(IoServicePool& io_service_pool, uint16_t port);
+
   uint16_t get_port_number();
 
  protected:
@@ -18,8 +28,15 @@ class Server {
   void _start_session(boost::system::error_code error);
 
   boost::asio::io_service& _io_service;
+  IoServicePool* _io_service_pool{nullptr};
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
+
+  // The socket of the next connection and the io_service that runs its session
+  boost::asio::io_service* _session_io_service{nullptr};
+  std::optional<boost::asio::ip::tcp::socket> _socket;
+
+  // The TaskRunner only refers to its io_service, so all sessions of an io_service share one
+  std::unordered_map<boost::asio::io_service*, std::shared_ptr<TaskRunner>> _task_runners;
 };
 
 }  // namespace opossum
@@ -7,11 +7,15 @@
 
 #include <chrono>
 #include <iostream>
+#include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
@@ -19,10 +23,13 @@
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/insert_server_batch_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
 
 #include "client_connection.hpp"
+#include "query_cancellation_registry.hpp"
+#include "query_log.hpp"
 #include "query_response_builder.hpp"
 #include "then_operator.hpp"
 #include "types.hpp"
@@ -34,11 +41,20 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
+template <typename TConnection, typename TTaskRunner>
+ServerSessionImpl<TConnection, TTaskRunner>::~ServerSessionImpl() {
+  if (_backend_key) QueryCancellationRegistry::get().unregister_session(*_backend_key);
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
   // We need a copy of this session to outlive the async operation
   auto self = this->shared_from_this();
-  return (_perform_session_startup() >> then >> [this, self]() { return _handle_client_requests(); })
+  return (_perform_session_startup() >> then >>
+          [this, self](bool is_client_session) {
+            if (!is_client_session) return boost::make_ready_future();
+            return _handle_client_requests();
+          })
       // Use .then instead of >> then >> to be able to handle exceptions
       .then(boost::launch::sync, [self](boost::future<void> f) {
         try {
@@ -50,19 +66,30 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
 }
 
 template <typename TConnection, typename TTaskRunner>
-boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
+boost::future<bool> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
   return _connection->receive_startup_packet_header() >> then >> [=](uint32_t startup_packet_length) {
     if (startup_packet_length == 0) {
       // This is a request for SSL, deny it and wait for the next startup packet
       return _connection->send_ssl_denied() >> then >> [=]() { return _perform_session_startup(); };
     }
 
+    if (startup_packet_length == PostgresWireHandler::CANCEL_REQUEST) {
+      // The client cancels the query of another session. As in PostgreSQL, there is no response.
+      return _connection->receive_cancel_request_packet_body() >> then >> [](CancelRequestPacket cancel_request) {
+        QueryCancellationRegistry::get().cancel_running_query({cancel_request.process_id, cancel_request.secret_key});
+        return false;
+      };
+    }
+
+    _backend_key = QueryCancellationRegistry::get().register_session();
+
     return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
            [=]() { return _connection->send_auth(); } >> then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_parameter_status("client_encoding", "UTF8"); } >> then >>
-           [=]() { return _connection->send_ready_for_query(); };
+           [=]() { return _connection->send_backend_key_data(_backend_key->process_id, _backend_key->secret_key); } >>
+           then >> [=]() { return _connection->send_ready_for_query(); } >> then >> []() { return true; };
   };
 }
 
@@ -104,7 +131,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
 
       case NetworkMessageType::ExecuteCommand: {
         return _connection->receive_execute_packet_body(request.payload_length) >> then >>
-               [=](std::string portal) { return _handle_execute_command(portal); };
+               [=](ExecutePacket execute_packet) { return _handle_execute_command(execute_packet); };
       }
 
       default:
@@ -119,11 +146,18 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
       return boost::make_ready_future();
     }
 
+    // As in PostgreSQL, the messages after a failed message of the extended query protocol are discarded until the
+    // Sync that ends the pipeline
+    if (_skip_until_sync && request.message_type != NetworkMessageType::SyncCommand) {
+      return _connection->receive_sync_packet_body(request.payload_length) >> then >>
+             [this, self]() { return _handle_client_requests(); };
+    }
+
     // Handle any exceptions that have occurred during process_command. For this, we need to call .then() explicitly,
     // because >> then >> does not handle exceptions
     return process_command(request)
                .then(boost::launch::sync,
-                     [this, self](boost::future<void> result) {
+                     [this, self, request](boost::future<void> result) {
                        try {
                          result.get();
                          return boost::make_ready_future();
@@ -134,6 +168,15 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                            _transaction.reset();
                          }
 
+                         // The client expects the ReadyForQuery of a pipeline only in response to its Sync, so that
+                         // it can tell which messages were discarded
+                         const auto is_pipelined = request.message_type != NetworkMessageType::SimpleQueryCommand &&
+                                                   request.message_type != NetworkMessageType::SyncCommand;
+                         if (is_pipelined) {
+                           _skip_until_sync = true;
+                           return _connection->send_error(e.what());
+                         }
+
                          return _connection->send_error(e.what()) >> then >>
                                 [this, self]() { return _connection->send_ready_for_query(); };
                        }
@@ -157,7 +200,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 
     return _connection->send_row_description(row_description) >> then >> [=]() {
       return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+          [=](const std::vector<std::optional<std::string>>& row) { return _connection->send_data_row(row); },
+          *result_table);
     };
   };
 
@@ -173,10 +217,102 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_copy_response(
+    const std::shared_ptr<SQLPipeline>& sql_pipeline) {
+  const auto result_table = sql_pipeline->get_result_table();
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (!result_table) Fail("COPY TO STDOUT requires a query that returns rows.");
+
+  // The rows are sent in CopyData messages, one per row, instead of DataRow messages
+  auto send_copy_data = [=](const std::vector<std::optional<std::string>>& row) {
+    return _connection->send_copy_data(QueryResponseBuilder::build_copy_data(row));
+  };
+
+  return _connection->send_copy_out_response(static_cast<uint16_t>(result_table->column_count())) >> then >>
+         [=]() { return QueryResponseBuilder::send_query_response(send_copy_data, *result_table); } >> then >>
+         [=](uint64_t row_count) {
+           return _connection->send_status_message(NetworkMessageType::CopyDone) >> then >>
+                  [=]() { return _connection->send_command_complete("COPY " + std::to_string(row_count)); };
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_copy_from_stdin(const std::string& table_name,
+                                                                                         const FormatCode format) {
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (!StorageManager::get().has_table(table_name)) Fail("The table to COPY into does not exist.");
+
+  const auto table = StorageManager::get().get_table(table_name);
+  const auto parser = std::make_shared<CopyInParser>(*table, format);
+
+  return _connection->send_copy_in_response(static_cast<uint16_t>(table->column_count()), format) >> then >>
+         [=]() { return _receive_copy_data(table_name, parser); };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_receive_copy_data(
+    const std::string& table_name, const std::shared_ptr<CopyInParser>& parser) {
+  // The rows are parsed as the messages come in, and inserted once a batch is full. The next message is only received
+  // once the batches are inserted, so that a client that sends faster than we insert is held back by the socket.
+  return _connection->receive_packet_header() >> then >> [=](RequestHeader request) {
+    switch (request.message_type) {
+      case NetworkMessageType::CopyData: {
+        return _connection->receive_copy_data_packet_body(request.payload_length) >> then >>
+               [=](std::string data) {
+                 parser->parse(data);
+                 return _insert_copy_batches(table_name, parser->take_full_batches());
+               } >>
+               then >> [=]() { return _receive_copy_data(table_name, parser); };
+      }
+
+      case NetworkMessageType::CopyDone: {
+        return _connection->receive_copy_done_packet_body(request.payload_length) >> then >>
+               [=]() { return _insert_copy_batches(table_name, parser->finish()); } >> then >>
+               [=]() { return _connection->send_command_complete("COPY " + std::to_string(parser->row_count())); };
+      }
+
+      case NetworkMessageType::CopyFail: {
+        return _connection->receive_copy_fail_packet_body(request.payload_length) >> then >>
+               [](std::string message) { Fail("COPY failed: " + message); };
+      }
+
+      // As in PostgreSQL, these are ignored during COPY
+      case NetworkMessageType::FlushCommand:
+      case NetworkMessageType::SyncCommand: {
+        return _connection->receive_sync_packet_body(request.payload_length) >> then >>
+               [=]() { return _receive_copy_data(table_name, parser); };
+      }
+
+      default:
+        Fail("Unexpected message during COPY.");
+    }
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_insert_copy_batches(
+    const std::string& table_name, const std::vector<std::shared_ptr<Table>>& batches) {
+  // One after another, so that the rows are inserted in the order in which the client sent them
+  auto batches_inserted = boost::make_ready_future();
+  for (const auto& batch : batches) {
+    batches_inserted = std::move(batches_inserted) >> then >> [=]() {
+      return _task_runner->dispatch_server_task(std::make_shared<InsertServerBatchTask>(table_name, batch));
+    };
+  }
+  return batches_inserted;
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
+  QueryLog::get().record_simple_query(_session_id, sql);
+
+  // A CancelRequest for this session cancels this query from now on
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  if (_backend_key) QueryCancellationRegistry::get().set_running_query(*_backend_key, cancellation_token);
+
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, cancellation_token));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -197,6 +333,11 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
     if (result->load_table.has_value()) {
       return load_table_file(result->load_table->first, result->load_table->second);
+    } else if (result->copy_from_stdin) {
+      return _handle_copy_from_stdin(result->copy_from_stdin->first, result->copy_from_stdin->second);
+    } else if (result->is_copy_to_stdout) {
+      return execute_sql_pipeline(result->sql_pipeline) >> then >>
+             [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_copy_response(sql_pipeline); };
     } else {
       return execute_sql_pipeline(result->sql_pipeline) >> then >>
              [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_simple_query_response(sql_pipeline); };
@@ -218,9 +359,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
 
   auto task = std::make_shared<ParseServerPreparedStatementTask>(parse_info.query);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::unique_ptr<PreparedPlan> prepared_plan) {
+         [=](std::shared_ptr<PreparedPlan> prepared_plan) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
-           StorageManager::get().add_prepared_plan(parse_info.statement_name, std::move(prepared_plan));
+           StorageManager::get().add_prepared_plan(parse_info.statement_name, prepared_plan);
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
@@ -250,7 +391,10 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
 
   auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
+         [=](std::shared_ptr<AbstractOperator> physical_plan) {
+           _portals.emplace(portal_name, Portal{physical_plan, packet.result_column_format_codes, nullptr, 0,
+                                                prepared_plan->sql, packet.params});
+         } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
 }
 
@@ -263,6 +407,14 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_describ
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_command() {
+  _skip_until_sync = false;
+
+  // Suspended portals end with the transaction, a named portal is executed again by the next Execute message
+  for (auto& [portal_name, portal] : _portals) {
+    portal.result_table.reset();
+    portal.sent_row_count = 0;
+  }
+
   if (!_transaction) return boost::make_ready_future();
 
   _transaction->commit();
@@ -273,41 +425,82 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_co
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_flush_command() {
-  // Ignore this because this message is received in a batch with other commands that handle the response.
-  return boost::make_ready_future();
+  // The responses are buffered until the Sync otherwise, see ClientConnection
+  return _connection->flush();
 }
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(
-    const std::string& portal_name) {
+    const ExecutePacket& execute_packet) {
+  const auto portal_name = execute_packet.portal;
+  const auto max_rows = execute_packet.max_rows;
+
   auto portal_it = _portals.find(portal_name);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  // A suspended portal continues where the previous Execute message stopped
+  if (portal_it->second.result_table) return _send_portal_rows(portal_name, max_rows);
 
-  if (portal_name.empty()) _portals.erase(portal_it);
+  const auto physical_plan = portal_it->second.physical_plan;
+  QueryLog::get().record_prepared_statement(_session_id, portal_it->second.sql, portal_it->second.parameters);
 
   if (!_transaction) _transaction = TransactionManager::get().new_transaction_context();
 
   physical_plan->set_transaction_context_recursively(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
-         [=](std::shared_ptr<const Table> result_table) {
-           // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
-           if (!result_table) {
-             return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
-                    []() { return uint64_t(0); };
-           }
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  if (_backend_key) QueryCancellationRegistry::get().set_running_query(*_backend_key, cancellation_token);
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
-           return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-           };
-         } >>
+  const auto task = std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan, cancellation_token);
+  return _task_runner->dispatch_server_task(task) >> then >> [=](std::shared_ptr<const Table> result_table) {
+    // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
+    if (!result_table) {
+      if (portal_name.empty()) _portals.erase(portal_name);
+
+      return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >> [=]() {
+        auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, 0);
+        return _connection->send_command_complete(complete_message);
+      };
+    }
+
+    auto& portal = _portals.at(portal_name);
+    portal.result_table = result_table;
+    portal.result_column_formats =
+        QueryResponseBuilder::build_column_formats(portal.result_column_formats, result_table->column_count());
+
+    const auto row_description =
+        QueryResponseBuilder::build_row_description(result_table, portal.result_column_formats);
+    return _connection->send_row_description(row_description) >> then >>
+           [=]() { return _send_portal_rows(portal_name, max_rows); };
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_portal_rows(const std::string& portal_name,
+                                                                                   const uint32_t max_rows) {
+  const auto& portal = _portals.at(portal_name);
+  const auto result_table = portal.result_table;
+
+  return QueryResponseBuilder::send_query_response(
+             [=](const std::vector<std::optional<std::string>>& row) { return _connection->send_data_row(row); },
+             *result_table, portal.sent_row_count, max_rows, portal.result_column_formats) >>
          then >> [=](uint64_t row_count) {
-           auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
+           auto& portal = _portals.at(portal_name);
+           portal.sent_row_count += row_count;
+
+           // The client sends another Execute message for the remaining rows
+           if (portal.sent_row_count < result_table->row_count()) {
+             return _connection->send_status_message(NetworkMessageType::PortalSuspended);
+           }
+
+           auto complete_message =
+               QueryResponseBuilder::build_command_complete_message(*portal.physical_plan, portal.sent_row_count);
+           if (portal_name.empty()) {
+             _portals.erase(portal_name);
+           } else {
+             portal.result_table.reset();
+             portal.sent_row_count = 0;
+           }
            return _connection->send_command_complete(complete_message);
          };
 }
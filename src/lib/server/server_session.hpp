@@ -5,9 +5,13 @@
 #include <boost/thread/future.hpp>
 
 #include <memory>
+#include <optional>
 
 #include "client_connection.hpp"
+#include "copy_in_parser.hpp"
 #include "postgres_wire_handler.hpp"
+#include "query_cancellation_registry.hpp"
+#include "query_log.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
@@ -18,30 +22,67 @@ template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
   explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+      : _connection(connection), _task_runner(task_runner), _session_id(QueryLog::get().new_session_id()) {}
+
+  ~ServerSessionImpl();
 
   boost::future<void> start();
 
  protected:
-  boost::future<void> _perform_session_startup();
+  // Resolves to false if the client sent a CancelRequest, after which the connection is closed
+  boost::future<bool> _perform_session_startup();
 
   boost::future<void> _handle_client_requests();
   boost::future<void> _handle_simple_query_command(const std::string& sql);
   boost::future<void> _handle_parse_command(const ParsePacket& parse_info);
   boost::future<void> _handle_bind_command(const BindPacket& packet);
   boost::future<void> _handle_describe_command(const std::string& portal_name);
-  boost::future<void> _handle_execute_command(const std::string& portal_name);
+  boost::future<void> _handle_execute_command(const ExecutePacket& execute_packet);
   boost::future<void> _handle_sync_command();
   boost::future<void> _handle_flush_command();
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
+  boost::future<void> _send_copy_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
+
+  // Receives the CopyData messages of COPY table FROM STDIN and inserts the rows batch by batch
+  boost::future<void> _handle_copy_from_stdin(const std::string& table_name, FormatCode format);
+  boost::future<void> _receive_copy_data(const std::string& table_name, const std::shared_ptr<CopyInParser>& parser);
+  boost::future<void> _insert_copy_batches(const std::string& table_name,
+                                           const std::vector<std::shared_ptr<Table>>& batches);
+
+  // Sends the next rows of the executed portal, and then either PortalSuspended or CommandComplete
+  boost::future<void> _send_portal_rows(const std::string& portal_name, uint32_t max_rows);
 
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
+  // Identifies the session in the QueryLog
+  const uint64_t _session_id;
+
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  // Set after a message of the extended query protocol failed, until the next Sync message
+  bool _skip_until_sync{false};
+
+  // Sent to the client during startup, so that it can cancel the running query, see QueryCancellationRegistry
+  std::optional<BackendKey> _backend_key;
+
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+
+    // As requested by the Bind message, resolved to one format per column once the result is known
+    std::vector<FormatCode> result_column_formats;
+
+    // Set while the portal is suspended, i.e., while an Execute message with a row limit has not sent all of its rows
+    std::shared_ptr<const Table> result_table;
+    uint64_t sent_row_count{0};
+
+    // The prepared SQL string and the bound parameters, which are recorded in the QueryLog when the portal is executed
+    std::string sql;
+    std::vector<AllTypeVariant> parameters;
+  };
+
+  std::unordered_map<std::string, Portal> _portals;
 };
 
 // The corresponding template instantiation takes place in the .cpp
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 enum class NetworkMessageType : unsigned char {
@@ -14,12 +16,18 @@ enum class NetworkMessageType : unsigned char {
   CommandComplete = 'C',
   ParameterStatus = 'S',
   AuthenticationRequest = 'R',
+  BackendKeyData = 'K',
   ErrorResponse = 'E',
   EmptyQueryResponse = 'I',
   NoDataResponse = 'n',
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  PortalSuspended = 's',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
+  CopyData = 'd',
+  CopyDone = 'c',
 
   // Errors
   HumanReadableError = 'M',
@@ -35,6 +43,7 @@ enum class NetworkMessageType : unsigned char {
   ParseCommand = 'P',
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
+  CopyFail = 'f',
 
   // SSL willingness
   SslYes = 'S',
@@ -42,6 +51,9 @@ enum class NetworkMessageType : unsigned char {
   Notice = 'N',
 };
 
+// Format of a parameter or result column, see https://www.postgresql.org/docs/current/static/protocol-overview.html
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 enum class TransactionStatusIndicator : unsigned char {
   Idle = 'I',
   InTransactionBlock = 'T',
@@ -0,0 +1,262 @@
+#include "parameterized_sql.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/value_expression.hpp"
+#include "import_export/csv_converter.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/prepared_plan.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_identifier_char(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+// The parser reads `-5` as the negation of 5, which a placeholder would hide from the TableScan. Thus, the sign is part
+// of the literal if the minus cannot be a subtraction.
+bool is_sign(const std::string& sql, const size_t char_idx) {
+  if (sql[char_idx] != '-' || char_idx + 1 == sql.size() || !is_digit(sql[char_idx + 1])) return false;
+  if (char_idx == 0) return true;
+
+  const auto previous_char_idx = sql.find_last_not_of(" \t\r\n", char_idx - 1);
+  return previous_char_idx == std::string::npos ||
+         std::string_view{"(,=<>+-*/%"}.find(sql[previous_char_idx]) != std::string_view::npos;
+}
+
+// The row counts of LIMIT and OFFSET are kept, as only a Limit with a constant row count is fused into a TopK
+bool is_row_count(const std::string& sql, const size_t char_idx) {
+  if (char_idx == 0) return false;
+
+  const auto word_end = sql.find_last_not_of(" \t\r\n", char_idx - 1);
+  if (word_end == std::string::npos) return false;
+
+  auto word_begin = word_end + 1;
+  while (word_begin > 0 && is_identifier_char(sql[word_begin - 1])) --word_begin;
+
+  const auto word = sql.substr(word_begin, word_end + 1 - word_begin);
+  return boost::iequals(word, "LIMIT") || boost::iequals(word, "OFFSET");
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::unordered_map<ParameterID, AllTypeVariant> ParameterizedSQL::parameters() const {
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    parameters.emplace(static_cast<ParameterID>(value_idx), values[value_idx]);
+  }
+  return parameters;
+}
+
+std::optional<ParameterizedSQL> parameterize_sql_literals(const std::string& sql) {
+  // The literals of other statements end up in projections (INSERT, UPDATE) or are statements themselves (PREPARE)
+  const auto statement_begin = sql.find_first_not_of(" \t\r\n(");
+  if (statement_begin == std::string::npos || !boost::iequals(sql.substr(statement_begin, 6), "SELECT")) {
+    return std::nullopt;
+  }
+
+  auto parameterized_sql = ParameterizedSQL{};
+  auto& parameterized_string = parameterized_sql.sql;
+  parameterized_string.reserve(sql.size());
+
+  auto char_idx = size_t{0};
+  while (char_idx < sql.size()) {
+    const auto character = sql[char_idx];
+    const auto next_character = char_idx + 1 < sql.size() ? sql[char_idx + 1] : '\0';
+    const auto follows_identifier = char_idx > 0 && (is_identifier_char(sql[char_idx - 1]) || sql[char_idx - 1] == '.');
+
+    // Comments, quoted identifiers, and strings with a prefix (e.g., E'\n') are kept as they are. If they are not
+    // closed, they reach until the end of the string.
+    auto verbatim_end = std::optional<size_t>{};
+    if (character == '-' && next_character == '-') {
+      verbatim_end = sql.find('\n', char_idx);
+    } else if (character == '/' && next_character == '*') {
+      const auto comment_end = sql.find("*/", char_idx + 2);
+      verbatim_end = comment_end == std::string::npos ? comment_end : comment_end + 2;
+    } else if (character == '"' || (character == '\'' && follows_identifier)) {
+      const auto quote_end = sql.find(character, char_idx + 1);
+      verbatim_end = quote_end == std::string::npos ? quote_end : quote_end + 1;
+    }
+
+    if (verbatim_end) {
+      const auto end = std::min(*verbatim_end, sql.size());
+      parameterized_string.append(sql, char_idx, end - char_idx);
+      char_idx = end;
+      continue;
+    }
+
+    if (character == '?') return std::nullopt;
+
+    if (character == '\'') {
+      // A string literal, in which '' stands for a single quote
+      auto value = std::string{};
+      auto value_begin = char_idx + 1;
+      while (true) {
+        const auto quote_idx = sql.find('\'', value_begin);
+        if (quote_idx == std::string::npos) return std::nullopt;
+
+        value.append(sql, value_begin, quote_idx - value_begin);
+        if (quote_idx + 1 == sql.size() || sql[quote_idx + 1] != '\'') {
+          char_idx = quote_idx + 1;
+          break;
+        }
+
+        value += '\'';
+        value_begin = quote_idx + 2;
+      }
+
+      parameterized_string += '?';
+      parameterized_sql.values.emplace_back(std::move(value));
+      continue;
+    }
+
+    if ((is_digit(character) || is_sign(sql, char_idx)) && !follows_identifier) {
+      auto number_end = char_idx + 1;
+      while (number_end < sql.size() && is_digit(sql[number_end])) ++number_end;
+
+      const auto is_float = number_end < sql.size() && sql[number_end] == '.';
+      if (is_float) {
+        ++number_end;
+        while (number_end < sql.size() && is_digit(sql[number_end])) ++number_end;
+      }
+
+      const auto number = sql.substr(char_idx, number_end - char_idx);
+      auto value = std::optional<AllTypeVariant>{};
+
+      // Exponents, numbers that run into identifiers, and integers beyond int64_t are left to the parser, too
+      const auto ends_number =
+          number_end == sql.size() || (!is_identifier_char(sql[number_end]) && sql[number_end] != '.');
+      if (ends_number && !is_row_count(sql, char_idx)) {
+        if (is_float) {
+          value = std::strtod(number.c_str(), nullptr);
+        } else if (const auto integer = BaseCsvConverter::parse_plain_integer<int64_t>(number)) {
+          // The SQLTranslator turns integers into int32_t values where possible
+          if (static_cast<int32_t>(*integer) == *integer) {
+            value = static_cast<int32_t>(*integer);
+          } else {
+            value = *integer;
+          }
+        }
+      }
+
+      if (value) {
+        parameterized_string += '?';
+        parameterized_sql.values.emplace_back(std::move(*value));
+      } else {
+        parameterized_string += number;
+      }
+
+      char_idx = number_end;
+      continue;
+    }
+
+    parameterized_string += character;
+    ++char_idx;
+  }
+
+  if (parameterized_sql.values.empty()) return std::nullopt;
+
+  parameterized_sql.cache_key = parameterized_sql_cache_key(parameterized_string, parameterized_sql.values);
+
+  return parameterized_sql;
+}
+
+std::string parameterized_sql_cache_key(const std::string& sql, const std::vector<AllTypeVariant>& values) {
+  auto cache_key = sql + "\n--";
+  for (const auto& value : values) {
+    cache_key += " " + data_type_to_string.left.at(data_type_from_all_type_variant(value));
+  }
+  return cache_key;
+}
+
+std::shared_ptr<AbstractLQPNode> lqp_parameterize_placeholders(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                               const std::vector<ParameterID>& parameter_ids,
+                                                               const std::vector<AllTypeVariant>& values) {
+  if (parameter_ids.size() != values.size()) return nullptr;
+
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameters.reserve(values.size());
+
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    if (parameter_ids[value_idx] != static_cast<ParameterID>(value_idx)) return nullptr;
+
+    const auto referenced_expression_info = CorrelatedParameterExpression::ReferencedExpressionInfo{
+        data_type_from_all_type_variant(values[value_idx]), false, "?"};
+    parameters.emplace_back(
+        std::make_shared<CorrelatedParameterExpression>(parameter_ids[value_idx], referenced_expression_info));
+  }
+
+  return PreparedPlan{lqp, parameter_ids}.instantiate(parameters);
+}
+
+bool lqp_only_predicates_use_parameters(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t parameter_count) {
+  auto only_predicates_use_parameters = true;
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (subplan_root == lqp && node->type == LQPNodeType::Predicate) return LQPVisitation::VisitInputs;
+
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::CorrelatedParameter &&
+              static_cast<const CorrelatedParameterExpression&>(*sub_expression).parameter_id < parameter_count) {
+            only_predicates_use_parameters = false;
+          }
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  return only_predicates_use_parameters;
+}
+
+std::shared_ptr<AbstractLQPNode> lqp_bind_parameters(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  const auto bound_lqp = lqp->deep_copy();
+
+  // The parameters only occur in the statement itself, see lqp_only_predicates_use_parameters()
+  visit_lqp(bound_lqp, [&](const auto& node) {
+    for (auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](auto& sub_expression) {
+        if (sub_expression->type != ExpressionType::CorrelatedParameter) return ExpressionVisitation::VisitArguments;
+
+        const auto& parameter_expression = static_cast<const CorrelatedParameterExpression&>(*sub_expression);
+        const auto parameter_iter = parameters.find(parameter_expression.parameter_id);
+        if (parameter_iter != parameters.end()) {
+          sub_expression = std::make_shared<ValueExpression>(parameter_iter->second);
+        }
+        return ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  return bound_lqp;
+}
+
+}  // namespace opossum
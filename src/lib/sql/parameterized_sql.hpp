@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Statements that only differ in their literals (e.g., `WHERE id = 17` and `WHERE id = 18`) share a plan in the
+ * SQLLogicalPlanCache and the SQLPhysicalPlanCache. For this, the literals are replaced with ?s, so that they become
+ * placeholders when the SQL string is translated. The placeholders are turned into CorrelatedParameterExpressions of
+ * the ParameterIDs 0..n-1, which stay in the cached plans. Each statement sets its own values while copying the PQP
+ * (see AbstractOperator::deep_copy()).
+ */
+struct ParameterizedSQL {
+  // The values of the literals as parameters of the cached plans
+  std::unordered_map<ParameterID, AllTypeVariant> parameters() const;
+
+  // The SQL string with a ? in place of each literal
+  std::string sql;
+
+  // The values of the literals, in the order of the ?s
+  std::vector<AllTypeVariant> values;
+
+  // The SQL string followed by the DataTypes of the values, as the DataType of a parameter is part of the plan
+  std::string cache_key;
+};
+
+/**
+ * Replaces the numeric and string literals of a SELECT statement with ?s. Literals that are not translated into
+ * ValueExpressions of the same value (e.g., E'...' strings or 1e5) are left as they are.
+ *
+ * @return std::nullopt if the statement is no SELECT, has no literals, or already has placeholders of its own
+ */
+std::optional<ParameterizedSQL> parameterize_sql_literals(const std::string& sql);
+
+/**
+ * @return The ParameterizedSQL::cache_key of the @param sql with a ? for each of the @param values, so that prepared
+ *         statements of the server share the cached plans of the statements whose literals were parameterized
+ */
+std::string parameterized_sql_cache_key(const std::string& sql, const std::vector<AllTypeVariant>& values);
+
+/**
+ * Replaces the PlaceholderExpressions of the @param lqp translated from ParameterizedSQL::sql with
+ * CorrelatedParameterExpressions of the DataTypes of the @param values.
+ *
+ * @param parameter_ids  The ParameterIDs of the placeholders, as allocated by the SQLTranslator
+ * @return nullptr if the SQLTranslator did not allocate the ParameterIDs 0..n-1 to the placeholders in their order
+ */
+std::shared_ptr<AbstractLQPNode> lqp_parameterize_placeholders(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                               const std::vector<ParameterID>& parameter_ids,
+                                                               const std::vector<AllTypeVariant>& values);
+
+/**
+ * Only the predicates of the statement itself, not those of its subselects, may depend on the values. The values of
+ * other expressions can be part of the plan, e.g., in the column name of `SELECT a + 1`.
+ *
+ * @return Whether the parameters 0..@param parameter_count-1 only occur in PredicateNodes of @param lqp
+ */
+bool lqp_only_predicates_use_parameters(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t parameter_count);
+
+/**
+ * @return A copy of the @param lqp with the CorrelatedParameterExpressions of the @param parameters replaced with
+ *         ValueExpressions
+ */
+std::shared_ptr<AbstractLQPNode> lqp_bind_parameters(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                     const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
+
+}  // namespace opossum
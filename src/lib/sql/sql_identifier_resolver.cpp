@@ -1,5 +1,8 @@
 #include "sql_identifier_resolver.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include "sql_identifier_resolver_proxy.hpp"
 #include "utils/assert.hpp"
 
@@ -10,36 +13,42 @@ namespace opossum {
 void SQLIdentifierResolver::set_column_name(const std::shared_ptr<AbstractExpression>& expression,
                                             const std::string& column_name) {
   auto& entry = _find_or_create_expression_entry(expression);
+  const auto entry_idx = static_cast<size_t>(&entry - _entries.data());
+
   if (entry.identifier) {
+    if (entry.identifier->column_name == column_name) return;
+
+    auto& entry_indices = _entry_indices_by_column_name[entry.identifier->column_name];
+    entry_indices.erase(std::find(entry_indices.begin(), entry_indices.end(), entry_idx));
     entry.identifier->column_name = column_name;
   } else {
     entry.identifier.emplace(column_name);
   }
+
+  _entry_indices_by_column_name[column_name].emplace_back(entry_idx);
 }
 
 void SQLIdentifierResolver::set_table_name(const std::shared_ptr<AbstractExpression>& expression,
                                            const std::string& table_name) {
   auto& entry = _find_or_create_expression_entry(expression);
-  if (!entry.identifier) entry.identifier.emplace(expression->as_column_name());
+  if (!entry.identifier) {
+    entry.identifier.emplace(expression->as_column_name());
+    _entry_indices_by_column_name[entry.identifier->column_name].emplace_back(&entry - _entries.data());
+  }
 
   entry.identifier->table_name = table_name;
 }
 
 std::shared_ptr<AbstractExpression> SQLIdentifierResolver::resolve_identifier_relaxed(
     const SQLIdentifier& identifier) const {
+  const auto entry_indices_iter = _entry_indices_by_column_name.find(identifier.column_name);
+  if (entry_indices_iter == _entry_indices_by_column_name.end()) return nullptr;
+
   std::vector<std::shared_ptr<AbstractExpression>> matching_expressions;
-  for (const auto& entry : _entries) {
-    if (!entry.identifier) continue;
-
-    if (identifier.table_name) {
-      if (identifier.table_name == entry.identifier->table_name &&
-          identifier.column_name == entry.identifier->column_name) {
-        matching_expressions.emplace_back(entry.expression);
-      }
-    } else {
-      if (identifier.column_name == entry.identifier->column_name) {
-        matching_expressions.emplace_back(entry.expression);
-      }
+  for (const auto entry_idx : entry_indices_iter->second) {
+    const auto& entry = _entries[entry_idx];
+    if (!identifier.table_name || identifier.table_name == entry.identifier->table_name) {
+      matching_expressions.emplace_back(entry.expression);
     }
   }
 
@@ -50,10 +59,9 @@ std::shared_ptr<AbstractExpression> SQLIdentifierResolver::resolve_identifier_re
 
 const std::optional<SQLIdentifier> SQLIdentifierResolver::get_expression_identifier(
     const std::shared_ptr<AbstractExpression>& expression) const {
-  auto entry_iter = std::find_if(_entries.begin(), _entries.end(),
-                                 [&](const auto& entry) { return *entry.expression == *expression; });
-  if (entry_iter == _entries.end()) return std::nullopt;
-  return entry_iter->identifier;
+  const auto entry_idx_iter = _entry_idx_by_expression.find(expression);
+  if (entry_idx_iter == _entry_idx_by_expression.end()) return std::nullopt;
+  return _entries[entry_idx_iter->second].identifier;
 }
 
 std::vector<std::shared_ptr<AbstractExpression>> SQLIdentifierResolver::resolve_table_name(
@@ -66,21 +74,32 @@ std::vector<std::shared_ptr<AbstractExpression>> SQLIdentifierResolver::resolve_
 }
 
 void SQLIdentifierResolver::append(SQLIdentifierResolver&& rhs) {
-  _entries.insert(_entries.end(), rhs._entries.begin(), rhs._entries.end());
+  const auto begin_idx = _entries.size();
+  _entries.insert(_entries.end(), std::make_move_iterator(rhs._entries.begin()),
+                  std::make_move_iterator(rhs._entries.end()));
+
+  for (auto entry_idx = begin_idx; entry_idx < _entries.size(); ++entry_idx) {
+    _index_entry(entry_idx);
+  }
 }
 
 SQLIdentifierContextEntry& SQLIdentifierResolver::_find_or_create_expression_entry(
     const std::shared_ptr<AbstractExpression>& expression) {
-  auto entry_iter = std::find_if(_entries.begin(), _entries.end(),
-                                 [&](const auto& entry) { return *entry.expression == *expression; });
+  const auto entry_idx_iter = _entry_idx_by_expression.find(expression);
+  if (entry_idx_iter != _entry_idx_by_expression.end()) return _entries[entry_idx_iter->second];
 
   // If there is no entry for this Expression, just add one
-  if (entry_iter == _entries.end()) {
-    SQLIdentifierContextEntry entry{expression, {}};
-    entry_iter = _entries.emplace(_entries.end(), entry);
-  }
+  _entries.emplace_back(SQLIdentifierContextEntry{expression, {}});
+  _index_entry(_entries.size() - 1);
+  return _entries.back();
+}
+
+void SQLIdentifierResolver::_index_entry(const size_t entry_idx) {
+  const auto& entry = _entries[entry_idx];
 
-  return *entry_iter;
+  // An expression that has multiple entries (e.g., after append()) is resolved to its first entry
+  _entry_idx_by_expression.emplace(entry.expression, entry_idx);
+  if (entry.identifier) _entry_indices_by_column_name[entry.identifier->column_name].emplace_back(entry_idx);
 }
 
 }  // namespace opossum
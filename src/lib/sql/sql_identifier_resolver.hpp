@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -20,6 +21,9 @@ struct SQLIdentifierContextEntry final {
 /**
  * Used during SQL translation to obtain the expression an identifier refers to.
  * Manages column/table aliases.
+ *
+ * The entries are indexed by their expression and by their column name, so that resolving an identifier does not
+ * compare it with every column of every table in scope.
  */
 class SQLIdentifierResolver final {
  public:
@@ -58,7 +62,15 @@ class SQLIdentifierResolver final {
  private:
   SQLIdentifierContextEntry& _find_or_create_expression_entry(const std::shared_ptr<AbstractExpression>& expression);
 
+  // Adds the entry at the @param entry_idx to the indexes
+  void _index_entry(const size_t entry_idx);
+
   std::vector<SQLIdentifierContextEntry> _entries;
+
+  // The index of the first entry of each expression, and the indices of the entries with an identifier by its column
+  // name
+  ExpressionUnorderedMap<size_t> _entry_idx_by_expression;
+  std::unordered_map<std::string, std::vector<size_t>> _entry_indices_by_column_name;
 };
 
 }  // namespace opossum
@@ -3,20 +3,73 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
+#include "concurrency/transaction_manager.hpp"
 #include "create_sql_parser_error_message.hpp"
+#include "operators/insert.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+/**
+ * Converts the @param literal of a single-row INSERT (or its negation) into the @param value of the target column, if
+ * the SQLTranslator and the ExpressionEvaluator would compute the same value from it. Literals that would need other
+ * casts (e.g., strings into numbers, or truncating numbers) are left to them.
+ */
+template <typename T>
+bool literal_to_value(const hsql::Expr& literal, T& value) {
+  const auto is_negated = literal.type == hsql::kExprOperator && literal.opType == hsql::kOpUnaryMinus;
+  const auto& operand = is_negated ? *literal.expr : literal;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (is_negated || operand.type != hsql::kExprLiteralString || !operand.name) return false;
+    value = operand.name;
+    return true;
+  } else {
+    if (operand.type == hsql::kExprLiteralInt) {
+      // The SQLTranslator makes a Long of an integer that does not fit into an Int, which would be cast back
+      if (std::is_same_v<T, int32_t> && static_cast<int32_t>(operand.ival) != operand.ival) return false;
+      if (is_negated && operand.ival == std::numeric_limits<int64_t>::min()) return false;
+      value = static_cast<T>(is_negated ? -operand.ival : operand.ival);
+      return true;
+    }
+
+    if (operand.type == hsql::kExprLiteralFloat && std::is_floating_point_v<T>) {
+      value = static_cast<T>(is_negated ? -operand.fval : operand.fval);
+      return true;
+    }
+
+    return false;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
-    : _transaction_context(transaction_context), _optimizer(optimizer) {
+                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                         const std::shared_ptr<ResourceGroup>& resource_group,
+                         const std::shared_ptr<const CancellationToken>& cancellation_token,
+                         const std::chrono::milliseconds statement_timeout, const size_t memory_budget,
+                         const std::shared_ptr<TaskProfiler>& task_profiler)
+    : _transaction_context(transaction_context), _use_mvcc(use_mvcc), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
@@ -73,9 +126,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
+        cleanup_temporaries, resource_group, cancellation_token, statement_timeout, memory_budget, task_profiler);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -196,15 +249,55 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   _result_tables.reserve(_sql_pipeline_statements.size());
 
-  for (auto& pipeline_statement : _sql_pipeline_statements) {
-    pipeline_statement->get_result_table();
+  // The next statement is optimized while a statement is executed. Statements that are not DML might change what the
+  // SQLTranslator sees (e.g., PREPARE), so that the next one waits for them.
+  auto planning_task = std::shared_ptr<JobTask>{};
+
+  for (auto statement_idx = size_t{0}; statement_idx < statement_count();) {
+    if (planning_task) {
+      CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{planning_task});
+      planning_task = nullptr;
+    }
+
+    auto& pipeline_statement = _sql_pipeline_statements[statement_idx];
+
+    const auto insert_batch_end = _insert_batch_end(statement_idx);
+    auto executed_statement_count =
+        insert_batch_end > statement_idx + 1 ? _execute_insert_batch(statement_idx, insert_batch_end) : size_t{0};
+
+    if (executed_statement_count == 0) {
+      pipeline_statement->get_tasks();
+
+      const auto statement_type = pipeline_statement->get_parsed_sql_statement()->getStatement(0)->type();
+      const auto is_dml = statement_type == hsql::kStmtSelect || statement_type == hsql::kStmtInsert ||
+                          statement_type == hsql::kStmtUpdate || statement_type == hsql::kStmtDelete;
+      if (!_requires_execution && is_dml && statement_idx + 1 < statement_count()) {
+        const auto next_pipeline_statement = _sql_pipeline_statements[statement_idx + 1];
+        planning_task = std::make_shared<JobTask>([next_pipeline_statement]() {
+          // A statement that fails to be optimized fails again when it is executed, after the previous statements
+          try {
+            next_pipeline_statement->get_optimized_logical_plan();
+          } catch (const std::exception&) {
+          }
+        });
+        planning_task->schedule();
+      }
+
+      pipeline_statement->get_result_table();
+      executed_statement_count = 1;
+    }
+
     if (_transaction_context && _transaction_context->aborted()) {
+      if (planning_task) CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{planning_task});
       _failed_pipeline_statement = pipeline_statement;
       _result_tables.clear();
       return _result_tables;
     }
 
-    _result_tables.emplace_back(pipeline_statement->get_result_table());
+    for (auto executed_idx = size_t{0}; executed_idx < executed_statement_count; ++executed_idx) {
+      _result_tables.emplace_back(_sql_pipeline_statements[statement_idx + executed_idx]->get_result_table());
+    }
+    statement_idx += executed_statement_count;
   }
 
   _pipeline_was_executed = true;
@@ -212,6 +305,145 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
   return _result_tables;
 }
 
+size_t SQLPipeline::_insert_batch_end(const size_t begin_statement_idx) const {
+  if (_use_mvcc == UseMvcc::No) return begin_statement_idx;
+
+  // The table name of a single-row INSERT with literal values, or nullptr for other statements
+  const auto insert_table_name = [&](const size_t statement_idx) -> const char* {
+    const auto* statement = _sql_pipeline_statements[statement_idx]->get_parsed_sql_statement()->getStatement(0);
+    if (statement->type() != hsql::kStmtInsert) return nullptr;
+
+    const auto& insert = static_cast<const hsql::InsertStatement&>(*statement);
+    if (insert.type != hsql::kInsertValues) return nullptr;
+
+    // Values of other expressions (e.g., subselects) might depend on the rows of the previous statements
+    const auto has_literal_values = std::all_of(insert.values->begin(), insert.values->end(), [](const auto* value) {
+      if (value->type == hsql::kExprOperator && value->opType == hsql::kOpUnaryMinus) value = value->expr;
+      return value->isLiteral();
+    });
+    return has_literal_values ? insert.tableName : nullptr;
+  };
+
+  const auto* table_name = insert_table_name(begin_statement_idx);
+  if (!table_name) return begin_statement_idx;
+
+  auto end_statement_idx = begin_statement_idx + 1;
+  while (end_statement_idx < statement_count()) {
+    const auto* next_table_name = insert_table_name(end_statement_idx);
+    if (!next_table_name || std::strcmp(next_table_name, table_name) != 0) break;
+    ++end_statement_idx;
+  }
+
+  return end_statement_idx;
+}
+
+size_t SQLPipeline::_execute_insert_batch(const size_t begin_statement_idx, const size_t end_statement_idx) {
+  const auto insert_statement = [&](const size_t statement_idx) -> const hsql::InsertStatement& {
+    const auto* statement = _sql_pipeline_statements[statement_idx]->get_parsed_sql_statement()->getStatement(0);
+    return static_cast<const hsql::InsertStatement&>(*statement);
+  };
+
+  const auto table_name = std::string{insert_statement(begin_statement_idx).tableName};
+  if (!StorageManager::get().has_table(table_name)) return 0;
+
+  const auto target_table = StorageManager::get().get_table(table_name);
+  const auto column_count = target_table->column_count();
+  const auto column_names = target_table->column_names();
+
+  // The literal of each column of each row, or nullptr for the columns that the INSERT does not specify (i.e., NULL)
+  auto rows = std::vector<std::vector<const hsql::Expr*>>{};
+  rows.reserve(end_statement_idx - begin_statement_idx);
+  for (auto statement_idx = begin_statement_idx; statement_idx < end_statement_idx; ++statement_idx) {
+    const auto& insert = insert_statement(statement_idx);
+    auto row = std::vector<const hsql::Expr*>(column_count);
+
+    if (insert.columns) {
+      if (insert.columns->size() != insert.values->size()) break;
+
+      auto value_idx = size_t{0};
+      for (; value_idx < insert.values->size(); ++value_idx) {
+        const auto column_iter = std::find(column_names.begin(), column_names.end(), (*insert.columns)[value_idx]);
+        if (column_iter == column_names.end()) break;
+        row[std::distance(column_names.begin(), column_iter)] = (*insert.values)[value_idx];
+      }
+      if (value_idx < insert.values->size()) break;
+    } else {
+      if (insert.values->size() != column_count) break;
+      std::copy(insert.values->begin(), insert.values->end(), row.begin());
+    }
+
+    rows.emplace_back(std::move(row));
+  }
+
+  // The rows are converted into ValueSegments of the column types once, unless a literal would need a cast, after
+  // which the batch ends. That statement is executed on its own then.
+  auto row_count = rows.size();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(target_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto value = ColumnDataType{};
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        const auto* literal = rows[row_idx][column_id];
+        const auto is_null = !literal || literal->type == hsql::kExprLiteralNull;
+        if (is_null ? !target_table->column_is_nullable(column_id) : !literal_to_value(*literal, value)) {
+          row_count = row_idx;
+        }
+      }
+    });
+  }
+
+  if (row_count < 2) return 0;
+
+  auto segments = Segments{};
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(target_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_concurrent_vector<bool>(row_count);
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        const auto* literal = rows[row_idx][column_id];
+        if (!literal || literal->type == hsql::kExprLiteralNull) {
+          null_values[row_idx] = true;
+        } else {
+          literal_to_value(*literal, values[row_idx]);
+        }
+      }
+
+      if (target_table->column_is_nullable(column_id)) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  const auto batch_table = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+  batch_table->append_chunk(segments);
+
+  const auto transaction_context =
+      _transaction_context ? _transaction_context : TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>(table_name, batch_table);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  if (insert->execute_failed()) {
+    transaction_context->rollback();
+    if (!_transaction_context) return 0;
+  } else if (!_transaction_context) {
+    transaction_context->commit();
+  }
+
+  for (auto statement_idx = begin_statement_idx; statement_idx < begin_statement_idx + row_count; ++statement_idx) {
+    _sql_pipeline_statements[statement_idx]->set_executed_in_batch();
+  }
+
+  return row_count;
+}
+
 std::shared_ptr<TransactionContext> SQLPipeline::transaction_context() const { return _transaction_context; }
 
 std::shared_ptr<SQLPipelineStatement> SQLPipeline::failed_pipeline_statement() const {
@@ -238,6 +470,7 @@ std::string SQLPipelineMetrics::to_string() const {
   auto total_optimize_nanos = std::chrono::nanoseconds::zero();
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
+  auto peak_memory_bytes = size_t{0};
   std::vector<bool> query_plan_cache_hits;
 
   for (const auto& statement_metric : statement_metrics) {
@@ -245,6 +478,7 @@ std::string SQLPipelineMetrics::to_string() const {
     total_optimize_nanos += statement_metric->optimize_time_nanos;
     total_lqp_translate_nanos += statement_metric->lqp_translate_time_nanos;
     total_execute_nanos += statement_metric->execution_time_nanos;
+    peak_memory_bytes = std::max(peak_memory_bytes, statement_metric->peak_memory_bytes);
 
     query_plan_cache_hits.push_back(statement_metric->query_plan_cache_hit);
   }
@@ -258,6 +492,7 @@ std::string SQLPipelineMetrics::to_string() const {
   info_string << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
   info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
+  info_string << "PEAK MEMORY: " << format_bytes(peak_memory_bytes) << " | ";
   info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
   info_string << "]\n";
 
@@ -29,13 +29,22 @@ struct SQLPipelineMetrics {
  *
  * The SQLPipeline splits a given SQL string into its single SQL statements and wraps each statement in an
  * SQLPipelineStatement.
+ *
+ * get_result_tables() executes the statements in order. Unless the pipeline requires execution (see
+ * requires_execution()), statement i+1 is translated and optimized while statement i is executed. Consecutive
+ * single-row INSERTs with literal values into the same table are executed as a single Insert of all of their rows
+ * (see _execute_insert_batch()). Without a transaction context that is passed in, the rows of such a batch become
+ * visible together.
  */
 class SQLPipeline : public Noncopyable {
  public:
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const std::shared_ptr<ResourceGroup>& resource_group,
+              const std::shared_ptr<const CancellationToken>& cancellation_token,
+              const std::chrono::milliseconds statement_timeout, const size_t memory_budget,
+              const std::shared_ptr<TaskProfiler>& task_profiler);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -77,9 +86,22 @@ class SQLPipeline : public Noncopyable {
   const SQLPipelineMetrics& metrics();
 
  private:
+  // The end of the consecutive single-row INSERTs with literal values into the same table as the statement at
+  // @param begin_statement_idx, or @param begin_statement_idx if that statement is none
+  size_t _insert_batch_end(const size_t begin_statement_idx) const;
+
+  // Inserts the rows of the INSERTs in [@param begin_statement_idx, @param end_statement_idx) with one Insert, whose
+  // input are ValueSegments that are filled from the literals directly, without the SQLTranslator and the
+  // ExpressionEvaluator. Stops at the first statement whose literals do not fit the table as they are, which is then
+  // executed on its own, as are the statements of a failed batch without a transaction context that was passed in
+  // (e.g., because of a unique constraint), so that only their own statements fail.
+  // @return The number of statements that were executed.
+  size_t _execute_insert_batch(const size_t begin_statement_idx, const size_t end_statement_idx);
+
   std::vector<std::shared_ptr<SQLPipelineStatement>> _sql_pipeline_statements;
 
   const std::shared_ptr<TransactionContext> _transaction_context;
+  const UseMvcc _use_mvcc;
   const std::shared_ptr<Optimizer> _optimizer;
 
   // Execution results
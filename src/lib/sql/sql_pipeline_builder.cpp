@@ -28,6 +28,32 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group) {
+  _resource_group = resource_group;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_cancellation_token(
+    const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  _cancellation_token = cancellation_token;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_statement_timeout(const std::chrono::milliseconds statement_timeout) {
+  _statement_timeout = statement_timeout;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_budget(const size_t memory_budget) {
+  _memory_budget = memory_budget;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_task_profiler(const std::shared_ptr<TaskProfiler>& task_profiler) {
+  _task_profiler = task_profiler;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -39,7 +65,9 @@ SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries,
+                              _resource_group, _cancellation_token, _statement_timeout, _memory_budget,
+                              _task_profiler);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -50,8 +78,18 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator,
-          optimizer, _cleanup_temporaries};
+  return {_sql,
+          std::move(parsed_sql),
+          _use_mvcc,
+          _transaction_context,
+          lqp_translator,
+          optimizer,
+          _cleanup_temporaries,
+          _resource_group,
+          _cancellation_token,
+          _statement_timeout,
+          _memory_budget,
+          _task_profiler};
 }
 
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -28,6 +29,9 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - No resource group, i.e., no admission control
+ *  - No cancellation token, no statement timeout, and no memory budget
+ *  - No task profiler
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +46,34 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Execute each statement as a query of the resource group, e.g., the group of a server session
+   */
+  SQLPipelineBuilder& with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group);
+
+  /**
+   * Cancelling the token stops the running statement and fails all following ones, see CancellationToken
+   */
+  SQLPipelineBuilder& with_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
+  /**
+   * Cancels each statement that runs longer than the timeout, like PostgreSQL's statement_timeout. Zero for no timeout.
+   */
+  SQLPipelineBuilder& with_statement_timeout(const std::chrono::milliseconds statement_timeout);
+
+  /**
+   * Cancels each statement whose operators allocate more than the budget for their intermediate data structures with a
+   * MemoryBudgetExceededException, see QueryMemoryResource. Zero for no budget. The global budget of all statements
+   * is set by QueryMemoryResource::set_global_budget().
+   */
+  SQLPipelineBuilder& with_memory_budget(const size_t memory_budget);
+
+  /**
+   * Records when and on which worker the tasks of the statements and their jobs are executed, e.g., to export them as a
+   * timeline with TaskProfiler::export_chrome_trace()
+   */
+  SQLPipelineBuilder& with_task_profiler(const std::shared_ptr<TaskProfiler>& task_profiler);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -68,6 +100,11 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   CleanupTemporaries _cleanup_temporaries{true};
+  std::shared_ptr<ResourceGroup> _resource_group;
+  std::shared_ptr<const CancellationToken> _cancellation_token;
+  std::chrono::milliseconds _statement_timeout{0};
+  size_t _memory_budget{0};
+  std::shared_ptr<TaskProfiler> _task_profiler;
 };
 
 }  // namespace opossum
@@ -9,15 +9,42 @@
 #include "concurrency/transaction_manager.hpp"
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
+#include "logging/replica.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/parameterized_sql.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool modifies_tables(const OperatorType operator_type) {
+  switch (operator_type) {
+    case OperatorType::CreateTable:
+    case OperatorType::CreateView:
+    case OperatorType::Delete:
+    case OperatorType::DropTable:
+    case OperatorType::DropView:
+    case OperatorType::ImportBinary:
+    case OperatorType::ImportCsv:
+    case OperatorType::Insert:
+    case OperatorType::Update:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
@@ -25,7 +52,12 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const std::shared_ptr<ResourceGroup>& resource_group,
+                                           const std::shared_ptr<const CancellationToken>& cancellation_token,
+                                           const std::chrono::milliseconds statement_timeout,
+                                           const size_t memory_budget,
+                                           const std::shared_ptr<TaskProfiler>& task_profiler)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -33,8 +65,14 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _lqp_translator(lqp_translator),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
+      _query_memory_resource(std::make_shared<QueryMemoryResource>(memory_budget)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _resource_group(resource_group),
+      _cancellation_token(cancellation_token),
+      _statement_timeout(statement_timeout),
+      _task_profiler(task_profiler),
+      _parameterized_sql(parameterize_sql_literals(_sql_string)) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -94,33 +132,10 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     return _optimized_logical_plan;
   }
 
-  // Handle logical query plan if statement has been cached
-  if (const auto cached_plan = SQLLogicalPlanCache::get().try_get(_sql_string)) {
-    const auto plan = *cached_plan;
-    DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
-    // MVCC-enabled and MVCC-disabled LQPs will evict each other
-    if (lqp_is_validated(plan) == (_use_mvcc == UseMvcc::Yes)) {
-      _optimized_logical_plan = plan;
-      return _optimized_logical_plan;
-    }
-  }
+  const auto& lqp = _get_parameterized_optimized_logical_plan();
 
-  const auto& unoptimized_lqp = get_unoptimized_logical_plan();
-
-  const auto started = std::chrono::high_resolution_clock::now();
-
-  _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp);
-
-  const auto done = std::chrono::high_resolution_clock::now();
-  _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
-
-  // The optimizer works on the original unoptimized LQP nodes. After optimizing, the unoptimized version is also
-  // optimized, which could lead to subtle bugs. optimized_logical_plan holds the original values now.
-  // As the unoptimized LQP is only used for visualization, we can afford to recreate it if necessary.
-  _unoptimized_logical_plan = nullptr;
-
-  // Cache newly created plan for the according sql statement
-  SQLLogicalPlanCache::get().set(_sql_string, _optimized_logical_plan);
+  // Only this LQP holds the values of the statement, the cached plans keep the parameters
+  _optimized_logical_plan = _parameterized_sql ? lqp_bind_parameters(lqp, _parameterized_sql->parameters()) : lqp;
 
   return _optimized_logical_plan;
 }
@@ -139,19 +154,33 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
-  if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string)) {
+  // A statement whose literals could not be parameterized is cached by its SQL string. Plans whose tables have changed
+  // too much since they were cached are evicted instead of being used.
+  auto& cache_dependencies = SQLPlanCacheDependencies::get();
+  auto cached_physical_plan = std::optional<std::shared_ptr<AbstractOperator>>{};
+  if (_parameterized_sql && !cache_dependencies.evict_if_outdated(_parameterized_sql->cache_key)) {
+    cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_parameterized_sql->cache_key);
+  }
+  if (!cached_physical_plan && !cache_dependencies.evict_if_outdated(_sql_string)) {
+    cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string);
+    if (cached_physical_plan) _parameterized_sql.reset();
+  }
+
+  if (cached_physical_plan) {
     if ((*cached_physical_plan)->transaction_context_is_set()) {
       Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
     } else {
       Assert(_use_mvcc == UseMvcc::No, "Trying to use non-MVCC cached query with a transaction context.");
     }
 
-    _physical_plan = (*cached_physical_plan)->deep_copy();
+    // The parameters are set while copying, the cached plan keeps the parameters without values
+    _physical_plan = _parameterized_sql ? (*cached_physical_plan)->deep_copy(_parameterized_sql->parameters())
+                                        : (*cached_physical_plan)->deep_copy();
     _metrics->query_plan_cache_hit = true;
 
   } else {
     // "Normal" mode in which the query plan is created
-    const auto& lqp = get_optimized_logical_plan();
+    const auto& lqp = _get_parameterized_optimized_logical_plan();
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
@@ -164,9 +193,17 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   // Cache newly created plan for the according sql statement (only if not already cached)
   if (!_metrics->query_plan_cache_hit) {
-    SQLPhysicalPlanCache::get().set(_sql_string, _physical_plan);
+    SQLPhysicalPlanCache::get().set(_parameterized_sql ? _parameterized_sql->cache_key : _sql_string, _physical_plan);
+
+    // Other statements copy the cached plan at any time, so that its parameters must not be set
+    if (_parameterized_sql) {
+      _physical_plan = _physical_plan->deep_copy(_parameterized_sql->parameters());
+      if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+    }
   }
 
+  _physical_plan->set_query_memory_resource_recursively(_query_memory_resource);
+
   _metrics->lqp_translate_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
   return _physical_plan;
@@ -188,12 +225,79 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   const auto& tasks = get_tasks();
 
+  // The tables of a replica only change by the writes of its primary (see Replica)
+  if (Replica::get().is_running()) {
+    for (const auto& task : tasks) {
+      Assert(!modifies_tables(task->get_operator()->type()), "Cannot modify the tables of a read-only replica");
+    }
+  }
+
   const auto started = std::chrono::high_resolution_clock::now();
 
+  // A read-only statement uses the result of an earlier execution whose snapshot saw the same rows, see SQLResultCache.
+  // The versions of its tables are taken before it is executed.
+  auto table_versions = std::optional<std::vector<SQLResultCache::TableVersion>>{};
+  if (_use_mvcc == UseMvcc::Yes && SQLResultCache::get().capacity() > 0 && _transaction_context->is_read_only()) {
+    table_versions = SQLResultCache::table_versions(get_optimized_logical_plan());
+  }
+
+  if (table_versions) {
+    _result_table =
+        SQLResultCache::get().try_get(get_optimized_logical_plan(), _transaction_context->snapshot_commit_id());
+    if (_result_table) {
+      if (_auto_commit) _transaction_context->commit();
+
+      _metrics->result_cache_hit = true;
+      const auto done = std::chrono::high_resolution_clock::now();
+      _metrics->execution_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+      return _result_table;
+    }
+  }
+
+  // The tasks refer to the ticket until they are done. The query thus leaves the group once it is executed.
+  if (_resource_group) {
+    const auto query_ticket = _resource_group->queue_query();
+    for (const auto& task : tasks) {
+      task->set_query_ticket(query_ticket);
+    }
+  }
+
+  // The deadline of a statement timeout and the memory budgets only apply to this statement, so the statement gets a
+  // token of its own. The global memory budget may be set at any time, so the token is needed even without limits.
+  const auto cancellation_token = std::make_shared<CancellationToken>(_cancellation_token);
+  if (_statement_timeout.count() > 0) {
+    cancellation_token->set_deadline(std::chrono::steady_clock::now() + _statement_timeout);
+  }
+  _query_memory_resource->set_cancellation_token(cancellation_token);
+
+  for (const auto& task : tasks) {
+    task->set_cancellation_token(cancellation_token);
+    task->set_task_profiler(_task_profiler);
+  }
+
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
 
+  // The operators are done, so their intermediate data structures are gone
+  _metrics->peak_memory_bytes = _query_memory_resource->allocated_bytes();
+  const auto budget_exceeded_message = _query_memory_resource->budget_exceeded_message();
+  _query_memory_resource.reset();
+
+  // Some tasks might have been skipped or stopped halfway, so neither the result nor the modifications can be used
+  if (cancellation_token->is_cancelled()) {
+    if (_transaction_context && _transaction_context->phase() == TransactionPhase::Active) {
+      _transaction_context->rollback();
+    }
+
+    if (budget_exceeded_message) throw MemoryBudgetExceededException{*budget_exceeded_message};
+
+    // The messages of PostgreSQL
+    const auto timed_out = !_cancellation_token || !_cancellation_token->is_cancelled();
+    throw QueryCancelledException{timed_out ? "canceling statement due to statement timeout"
+                                            : "canceling statement due to user request"};
+  }
+
   if (_auto_commit) {
     _transaction_context->commit();
   }
@@ -201,10 +305,20 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->execution_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
+  // A cached plan whose estimates were far off is optimized again with the corrected estimates when it is used next
+  if (CardinalityFeedback::get().record(_physical_plan) > CardinalityFeedback::MAX_Q_ERROR) {
+    SQLPlanCacheDependencies::get().evict(_parameterized_sql ? _parameterized_sql->cache_key : _sql_string);
+  }
+
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
+  if (table_versions && _result_table) {
+    SQLResultCache::get().set(get_optimized_logical_plan(), _result_table, _transaction_context->snapshot_commit_id(),
+                              *table_versions);
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translate_time_nanos.count(),
                 _metrics->optimize_time_nanos.count(), _metrics->lqp_translate_time_nanos.count(),
                 _metrics->execution_time_nanos.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -212,6 +326,106 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   return _result_table;
 }
 
+void SQLPipelineStatement::set_executed_in_batch() {
+  DebugAssert(!_result_table, "Statement has already been executed");
+  _query_has_output = false;
+}
+
+const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::_get_parameterized_optimized_logical_plan() {
+  if (_parameterized_optimized_logical_plan) {
+    return _parameterized_optimized_logical_plan;
+  }
+
+  // Handle logical query plan if statement has been cached. A cached nullptr means that the literals of the statement
+  // cannot be parameterized, so that it is cached by its SQL string.
+  if (_parameterized_sql) {
+    const auto cached_plan = SQLLogicalPlanCache::get().try_get(_parameterized_sql->cache_key);
+    if (cached_plan && !*cached_plan) _parameterized_sql.reset();
+  }
+
+  const auto& cache_key = _parameterized_sql ? _parameterized_sql->cache_key : _sql_string;
+  SQLPlanCacheDependencies::get().evict_if_outdated(cache_key);
+  if (const auto cached_plan = SQLLogicalPlanCache::get().try_get(cache_key)) {
+    const auto plan = *cached_plan;
+    DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
+    // MVCC-enabled and MVCC-disabled LQPs will evict each other
+    if (lqp_is_validated(plan) == (_use_mvcc == UseMvcc::Yes)) {
+      _parameterized_optimized_logical_plan = plan;
+      return _parameterized_optimized_logical_plan;
+    }
+  }
+
+  if (_parameterized_sql) {
+    _parameterized_optimized_logical_plan = _optimize_parameterized_sql();
+    SQLLogicalPlanCache::get().set(_parameterized_sql->cache_key, _parameterized_optimized_logical_plan);
+    if (_parameterized_optimized_logical_plan) {
+      SQLPlanCacheDependencies::get().set(_parameterized_sql->cache_key, _parameterized_optimized_logical_plan);
+      return _parameterized_optimized_logical_plan;
+    }
+
+    _parameterized_sql.reset();
+  }
+
+  const auto& unoptimized_lqp = get_unoptimized_logical_plan();
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  _metrics->optimizer_rule_durations.clear();
+  _parameterized_optimized_logical_plan = _optimizer->optimize(unoptimized_lqp, &_metrics->optimizer_rule_durations);
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+
+  // The optimizer works on the original unoptimized LQP nodes. After optimizing, the unoptimized version is also
+  // optimized, which could lead to subtle bugs. optimized_logical_plan holds the original values now.
+  // As the unoptimized LQP is only used for visualization, we can afford to recreate it if necessary.
+  _unoptimized_logical_plan = nullptr;
+
+  // Cache newly created plan for the according sql statement
+  SQLLogicalPlanCache::get().set(_sql_string, _parameterized_optimized_logical_plan);
+  SQLPlanCacheDependencies::get().set(_sql_string, _parameterized_optimized_logical_plan);
+
+  return _parameterized_optimized_logical_plan;
+}
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_optimize_parameterized_sql() {
+  const auto& values = _parameterized_sql->values;
+
+  // The ?s are not valid everywhere a literal is, e.g., within INTERVAL '1' DAY
+  auto parsed_sql = hsql::SQLParserResult{};
+  hsql::SQLParser::parse(_parameterized_sql->sql, &parsed_sql);
+  if (!parsed_sql.isValid() || parsed_sql.size() != 1) return nullptr;
+
+  const auto translate_started = std::chrono::high_resolution_clock::now();
+
+  auto parameterized_lqp = std::shared_ptr<AbstractLQPNode>{};
+  try {
+    auto sql_translator = SQLTranslator{_use_mvcc};
+    const auto lqp = sql_translator.translate_parser_result(parsed_sql).front();
+    const auto parameter_ids = sql_translator.parameter_ids_of_value_placeholders();
+    parameterized_lqp = lqp_parameterize_placeholders(lqp, parameter_ids, values);
+  } catch (const std::exception&) {
+    // The SQLTranslator might require the DataType of a literal, which a placeholder does not have. If the statement
+    // is invalid, translating it with its literals reports the error.
+    return nullptr;
+  }
+
+  const auto translate_done = std::chrono::high_resolution_clock::now();
+  _metrics->sql_translate_time_nanos =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(translate_done - translate_started);
+
+  if (!parameterized_lqp) return nullptr;
+
+  _metrics->optimizer_rule_durations.clear();
+  const auto optimized_lqp = _optimizer->optimize(parameterized_lqp, &_metrics->optimizer_rule_durations);
+
+  const auto optimize_done = std::chrono::high_resolution_clock::now();
+  _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(optimize_done - translate_done);
+
+  if (!lqp_only_predicates_use_parameters(optimized_lqp, values.size())) return nullptr;
+  return optimized_lqp;
+}
+
 const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_context() const {
   return _transaction_context;
 }
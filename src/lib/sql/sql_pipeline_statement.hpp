@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
@@ -7,7 +9,12 @@
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_profiler.hpp"
+#include "sql/parameterized_sql.hpp"
 #include "storage/table.hpp"
+#include "utils/query_memory_resource.hpp"
 
 namespace opossum {
 
@@ -15,10 +22,17 @@ namespace opossum {
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translate_time_nanos{};
   std::chrono::nanoseconds optimize_time_nanos{};
+  OptimizerRuleDurations optimizer_rule_durations;
   std::chrono::nanoseconds lqp_translate_time_nanos{};
   std::chrono::nanoseconds execution_time_nanos{};
 
+  // The peak size of the intermediate data of the operators (see QueryMemoryResource)
+  size_t peak_memory_bytes{0};
+
   bool query_plan_cache_hit = false;
+
+  // Whether the result was taken from the SQLResultCache instead of executing the physical plan
+  bool result_cache_hit = false;
 };
 
 /**
@@ -33,6 +47,10 @@ struct SQLPipelineStatementMetrics {
  * NOTE:
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the optimized
  *  LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be different.
+ *
+ * NOTE:
+ *  SELECT statements that only differ in the literals of their predicates share their cached plans, see
+ *  parameterize_sql_literals(). The PQP of such a statement sets the values as parameters.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -40,7 +58,11 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                       const std::shared_ptr<ResourceGroup>& resource_group,
+                       const std::shared_ptr<const CancellationToken>& cancellation_token,
+                       const std::chrono::milliseconds statement_timeout, const size_t memory_budget,
+                       const std::shared_ptr<TaskProfiler>& task_profiler);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -63,8 +85,15 @@ class SQLPipelineStatement : public Noncopyable {
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Throws a QueryCancelledException if the statement was cancelled or timed out, after rolling back its transaction.
+  // If it exceeded its memory budget or the global one (see QueryMemoryResource), this is a
+  // MemoryBudgetExceededException.
   const std::shared_ptr<const Table>& get_result_table();
 
+  // For an INSERT whose row the SQLPipeline inserted together with those of other statements, so that
+  // get_result_table() does not execute the statement again
+  void set_executed_in_batch();
+
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
   // This can be a nullptr if no transaction management is wanted.
   const std::shared_ptr<TransactionContext>& transaction_context() const;
@@ -72,6 +101,13 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
  private:
+  // The optimized LQP that is cached. If the literals of the statement are parameterized, it has
+  // CorrelatedParameterExpressions instead of the values.
+  const std::shared_ptr<AbstractLQPNode>& _get_parameterized_optimized_logical_plan();
+
+  // Returns nullptr if the literals of the statement cannot be parameterized
+  std::shared_ptr<AbstractLQPNode> _optimize_parameterized_sql();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -88,7 +124,11 @@ class SQLPipelineStatement : public Noncopyable {
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
   std::shared_ptr<AbstractLQPNode> _optimized_logical_plan;
+  std::shared_ptr<AbstractLQPNode> _parameterized_optimized_logical_plan;
   std::shared_ptr<AbstractOperator> _physical_plan;
+
+  // The intermediate data structures of the operators, freed once the physical plan has been executed
+  std::shared_ptr<QueryMemoryResource> _query_memory_resource;
   std::vector<std::shared_ptr<OperatorTask>> _tasks;
   std::shared_ptr<const Table> _result_table;
   // Assume there is an output table. Only change if nullptr is returned from execution.
@@ -98,6 +138,19 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Executes the statement as a query of this group, if set
+  const std::shared_ptr<ResourceGroup> _resource_group;
+
+  // See SQLPipelineBuilder::with_cancellation_token() and with_statement_timeout()
+  const std::shared_ptr<const CancellationToken> _cancellation_token;
+  const std::chrono::milliseconds _statement_timeout;
+
+  // See SQLPipelineBuilder::with_task_profiler()
+  const std::shared_ptr<TaskProfiler> _task_profiler;
+
+  // Reset if the plans of the statement have its literals instead of parameters
+  std::optional<ParameterizedSQL> _parameterized_sql;
 };
 
 }  // namespace opossum
@@ -0,0 +1,187 @@
+#include "sql_plan_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/show_columns_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/update_node.hpp"
+#include "storage/lqp_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::unordered_set<std::string> referenced_table_names(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto table_names = std::unordered_set<std::string>{};
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::StoredTable:
+          table_names.emplace(static_cast<const StoredTableNode&>(*node).table_name);
+          break;
+        case LQPNodeType::Insert:
+          table_names.emplace(static_cast<const InsertNode&>(*node).table_name);
+          break;
+        case LQPNodeType::Update:
+          table_names.emplace(static_cast<const UpdateNode&>(*node).table_name);
+          break;
+        case LQPNodeType::ShowColumns:
+          table_names.emplace(static_cast<const ShowColumnsNode&>(*node).table_name);
+          break;
+        default:
+          break;
+      }
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  return table_names;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void SQLPlanCacheDependencies::set(const std::string& cache_key, const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto tables = std::vector<TableDependency>{};
+  for (const auto& table_name : referenced_table_names(lqp)) {
+    // A table that was dropped in the meantime makes evict_if_outdated() evict the plans
+    const auto row_count =
+        StorageManager::get().has_table(table_name) ? StorageManager::get().get_table(table_name)->row_count() : 0;
+    tables.emplace_back(TableDependency{table_name, row_count});
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _remove(cache_key);
+  for (const auto& table : tables) {
+    _cache_keys_by_table_name[table.table_name].emplace(cache_key);
+  }
+  _tables_by_cache_key.emplace(cache_key, std::move(tables));
+
+  // The caches evict plans without notice, so the dependencies of their evicted plans are removed every now and then
+  const auto capacity = SQLLogicalPlanCache::get().capacity() + SQLPhysicalPlanCache::get().capacity() +
+                        SQLPreparedPlanCache::get().capacity();
+  if (_tables_by_cache_key.size() > 2 * capacity) _forget_evicted_plans();
+}
+
+void SQLPlanCacheDependencies::invalidate_table(const std::string& table_name) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _invalidate_table(table_name);
+}
+
+void SQLPlanCacheDependencies::invalidate_view(const LQPView& view) {
+  const auto table_names = referenced_table_names(view.lqp);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (table_names.empty()) {
+    SQLLogicalPlanCache::get().clear();
+    SQLPhysicalPlanCache::get().clear();
+    SQLPreparedPlanCache::get().clear();
+    _tables_by_cache_key.clear();
+    _cache_keys_by_table_name.clear();
+    return;
+  }
+
+  for (const auto& table_name : table_names) {
+    _invalidate_table(table_name);
+  }
+}
+
+bool SQLPlanCacheDependencies::evict_if_outdated(const std::string& cache_key) {
+  auto tables = std::vector<TableDependency>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto tables_iter = _tables_by_cache_key.find(cache_key);
+    if (tables_iter == _tables_by_cache_key.end()) return false;
+    tables = tables_iter->second;
+  }
+
+  // Row counts are not computed under the _mutex, as every statement that might use a cached plan gets here
+  const auto is_outdated = std::any_of(tables.begin(), tables.end(), [](const auto& table) {
+    if (!StorageManager::get().has_table(table.table_name)) return true;
+
+    const auto row_count = std::max(StorageManager::get().get_table(table.table_name)->row_count(), uint64_t{1});
+    const auto cached_row_count = std::max(table.row_count, uint64_t{1});
+    const auto drift = static_cast<double>(std::max(row_count, cached_row_count)) /
+                       static_cast<double>(std::min(row_count, cached_row_count));
+    return drift > MAX_ROW_COUNT_DRIFT;
+  });
+
+  if (!is_outdated) return false;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _evict(cache_key);
+  return true;
+}
+
+void SQLPlanCacheDependencies::evict(const std::string& cache_key) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _evict(cache_key);
+}
+
+void SQLPlanCacheDependencies::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables_by_cache_key.clear();
+  _cache_keys_by_table_name.clear();
+}
+
+void SQLPlanCacheDependencies::_invalidate_table(const std::string& table_name) {
+  const auto cache_keys_iter = _cache_keys_by_table_name.find(table_name);
+  if (cache_keys_iter == _cache_keys_by_table_name.end()) return;
+
+  // _evict() modifies the set of the table
+  const auto cache_keys = std::vector<std::string>{cache_keys_iter->second.begin(), cache_keys_iter->second.end()};
+  for (const auto& cache_key : cache_keys) {
+    _evict(cache_key);
+  }
+}
+
+void SQLPlanCacheDependencies::_evict(const std::string& cache_key) {
+  SQLLogicalPlanCache::get().erase(cache_key);
+  SQLPhysicalPlanCache::get().erase(cache_key);
+  SQLPreparedPlanCache::get().erase(cache_key);
+  _remove(cache_key);
+}
+
+void SQLPlanCacheDependencies::_remove(const std::string& cache_key) {
+  const auto tables_iter = _tables_by_cache_key.find(cache_key);
+  if (tables_iter == _tables_by_cache_key.end()) return;
+
+  for (const auto& table : tables_iter->second) {
+    const auto cache_keys_iter = _cache_keys_by_table_name.find(table.table_name);
+    cache_keys_iter->second.erase(cache_key);
+    if (cache_keys_iter->second.empty()) _cache_keys_by_table_name.erase(cache_keys_iter);
+  }
+
+  _tables_by_cache_key.erase(tables_iter);
+}
+
+void SQLPlanCacheDependencies::_forget_evicted_plans() {
+  auto evicted_cache_keys = std::vector<std::string>{};
+  for (const auto& cache_key_and_tables : _tables_by_cache_key) {
+    const auto& cache_key = cache_key_and_tables.first;
+    if (!SQLLogicalPlanCache::get().has(cache_key) && !SQLPhysicalPlanCache::get().has(cache_key) &&
+        !SQLPreparedPlanCache::get().has(cache_key)) {
+      evicted_cache_keys.emplace_back(cache_key);
+    }
+  }
+
+  for (const auto& cache_key : evicted_cache_keys) {
+    _remove(cache_key);
+  }
+}
+
+}  // namespace opossum
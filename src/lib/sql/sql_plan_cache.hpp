@@ -1,16 +1,86 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "cache/cache.hpp"
+#include "utils/singleton.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class LQPView;
+class PreparedPlan;
 
+// Both caches are keyed by the SQL string, or by ParameterizedSQL::cache_key for statements whose literals are
+// parameterized. A nullptr in the SQLLogicalPlanCache marks a ParameterizedSQL::cache_key of a statement whose literals
+// cannot be parameterized.
 using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
 using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
 
+// Keyed by the SQL string of a prepared statement of the server. The PreparedPlans hold the unoptimized LQPs with their
+// placeholders, which are never modified, so that all sessions that prepare the same statement share its PreparedPlan.
+using SQLPreparedPlanCache = Cache<std::shared_ptr<PreparedPlan>, std::string>;
+
+/**
+ * Records the tables that the plans in the SQLLogicalPlanCache, the SQLPhysicalPlanCache, and the SQLPreparedPlanCache
+ * reference, so that a table that is dropped, replaced, or re-encoded only evicts its own plans from the caches. Views
+ * are inlined into the plans of the statements that use them, so the plans of a view are those of its tables.
+ *
+ * The optimizer chose the plans for the row counts that their tables had when they were cached. Once the row count of
+ * one of the tables has changed by more than MAX_ROW_COUNT_DRIFT, the plans are evicted when they are looked up.
+ */
+class SQLPlanCacheDependencies : public Singleton<SQLPlanCacheDependencies> {
+ public:
+  static constexpr auto MAX_ROW_COUNT_DRIFT = 2.0;
+
+  // Records the tables that the @param lqp cached under the @param cache_key references, including its subselects
+  void set(const std::string& cache_key, const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Evicts the plans that reference the table of the @param table_name
+  void invalidate_table(const std::string& table_name);
+
+  // Evicts the plans that reference the tables of the @param view. If the view references no tables, this evicts all
+  // plans, because they cannot be told apart from the plans that do not reference the view.
+  void invalidate_view(const LQPView& view);
+
+  // Evicts the plans cached under the @param cache_key if one of their tables was dropped or its row count has drifted
+  // @return Whether the plans were evicted
+  bool evict_if_outdated(const std::string& cache_key);
+
+  // Evicts the plans cached under the @param cache_key, e.g., because their cardinality estimates were far off
+  void evict(const std::string& cache_key);
+
+  void clear();
+
+ protected:
+  friend class Singleton;
+
+  struct TableDependency {
+    std::string table_name;
+    uint64_t row_count;
+  };
+
+  SQLPlanCacheDependencies() = default;
+
+  // All of these require the _mutex to be locked
+  void _invalidate_table(const std::string& table_name);
+  void _evict(const std::string& cache_key);
+
+  // Only removes the dependencies, not the plans
+  void _remove(const std::string& cache_key);
+  void _forget_evicted_plans();
+
+  std::unordered_map<std::string, std::vector<TableDependency>> _tables_by_cache_key;
+  std::unordered_map<std::string, std::unordered_set<std::string>> _cache_keys_by_table_name;
+
+  std::mutex _mutex;
+};
+
 }  // namespace opossum
@@ -0,0 +1,171 @@
+#include "sql_result_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+SQLResultCache::SQLResultCache() : _cache(0) {}
+
+std::optional<std::vector<SQLResultCache::TableVersion>> SQLResultCache::table_versions(
+    const std::shared_ptr<AbstractLQPNode>& lqp) {
+  const auto catalog = StorageManager::get().catalog();
+  const auto& tables = catalog->tables;
+
+  auto table_versions = std::vector<TableVersion>{};
+  auto is_cacheable = true;
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::Aggregate:
+        case LQPNodeType::Alias:
+        case LQPNodeType::DummyTable:
+        case LQPNodeType::Exchange:
+        case LQPNodeType::Join:
+        case LQPNodeType::Limit:
+        case LQPNodeType::Predicate:
+        case LQPNodeType::Projection:
+        case LQPNodeType::Sort:
+        case LQPNodeType::Union:
+        case LQPNodeType::Validate:
+          break;
+
+        case LQPNodeType::StoredTable: {
+          const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+          const auto table_iter = tables.find(table_name);
+          if (table_iter == tables.end()) {
+            is_cacheable = false;
+            break;
+          }
+          table_versions.emplace_back(TableVersion{table_name, table_iter->second, table_iter->second->row_count()});
+        } break;
+
+        default:
+          is_cacheable = false;
+      }
+
+      return is_cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+
+    if (!is_cacheable) return std::nullopt;
+  }
+
+  return table_versions;
+}
+
+void SQLResultCache::set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result_table,
+                         const CommitID snapshot_commit_id, const std::vector<TableVersion>& table_versions) {
+  if (_capacity == 0) return;
+
+  auto entry = Entry{lqp, result_table, snapshot_commit_id, table_versions};
+
+  // E.g., the result of an old snapshot would keep the result of a newer one out of the cache, but never be used
+  if (_is_outdated(entry)) return;
+
+  const auto hash = lqp->hash();
+  const auto size = static_cast<double>(std::max(result_table->estimate_memory_usage(), size_t{1}));
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_cache.capacity() == 0) return;
+
+  _cache.set(hash, std::move(entry), 1.0, size);
+}
+
+std::shared_ptr<const Table> SQLResultCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                     const CommitID snapshot_commit_id) {
+  if (_capacity == 0) return nullptr;
+
+  const auto hash = lqp->hash();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_cache.has(hash)) {
+    _miss_count.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  const auto& entry = _cache.get(hash);
+  if (*entry.lqp != *lqp) {
+    _miss_count.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  if (_is_outdated(entry)) {
+    _cache.erase(hash);
+    _miss_count.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  // The tables were not modified after the result was computed, but they might have been after the snapshot of the
+  // transaction, which then sees other rows
+  const auto& table_versions = entry.table_versions;
+  const auto is_visible = std::all_of(table_versions.begin(), table_versions.end(), [&](const auto& version) {
+    return version.table.lock()->last_commit_id() <= snapshot_commit_id;
+  });
+  if (!is_visible) {
+    _miss_count.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  _hit_count.fetch_add(1, std::memory_order_relaxed);
+  return entry.result_table;
+}
+
+void SQLResultCache::invalidate_table(const std::string& table_name) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto hashes = std::vector<size_t>{};
+  for (const auto& cache_entry : _cache.queue()) {
+    const auto& table_versions = cache_entry.value.table_versions;
+    if (std::any_of(table_versions.begin(), table_versions.end(),
+                    [&](const auto& version) { return version.table_name == table_name; })) {
+      hashes.emplace_back(cache_entry.key);
+    }
+  }
+
+  for (const auto hash : hashes) {
+    _cache.erase(hash);
+  }
+}
+
+size_t SQLResultCache::capacity() const { return _capacity; }
+
+void SQLResultCache::resize(const size_t capacity) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cache.resize(capacity);
+  _capacity = capacity;
+}
+
+size_t SQLResultCache::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cache.size();
+}
+
+void SQLResultCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cache.clear();
+}
+
+bool SQLResultCache::_is_outdated(const Entry& entry) {
+  const auto catalog = StorageManager::get().catalog();
+  const auto& tables = catalog->tables;
+
+  return std::any_of(entry.table_versions.begin(), entry.table_versions.end(), [&](const auto& version) {
+    const auto table_iter = tables.find(version.table_name);
+    if (table_iter == tables.end() || table_iter->second != version.table.lock()) return true;
+
+    const auto& table = *table_iter->second;
+    return table.row_count() != version.row_count || table.last_commit_id() > entry.snapshot_commit_id;
+  });
+}
+
+}  // namespace opossum
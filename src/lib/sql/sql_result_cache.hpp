@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cache/gdfs_cache.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the result tables of read-only statements, so that statements with the same optimized LQP share them
+ * instead of executing their plans again. The results are keyed by the hash of the LQP (see AbstractLQPNode::hash())
+ * and compared with the LQP on every lookup, so that two LQPs of the same hash only evict each other.
+ *
+ * A result is the result of the snapshot it was computed at. It is only returned to a transaction whose snapshot sees
+ * the same rows of its tables, i.e., if none of the tables were modified by a transaction that committed after the
+ * older of the two snapshots. For this, Insert and Delete record the commit id of the last transaction that modified
+ * a table (see Table::last_commit_id()), before the commit becomes visible to new snapshots. Rows that are appended
+ * to a table outside of transactions, and tables that were replaced in the StorageManager, are detected by the row
+ * count and the identity of the tables, which are taken before the statement is executed.
+ *
+ * The results are evicted by the GDFS policy weighted by their estimated memory usage, so that large results are
+ * evicted before small ones that are used as often. They are shared as they are, so that reference tables keep the
+ * tables they reference alive. The cache is disabled (i.e., has a capacity of 0) unless it is resized.
+ */
+class SQLResultCache : public Singleton<SQLResultCache> {
+ public:
+  // A table of a statement as it was before the statement was executed
+  struct TableVersion {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    uint64_t row_count;
+  };
+
+  /**
+   * @return The versions of the tables in the StorageManager that the @param lqp reads, including those of its
+   *         subselects, or std::nullopt if the result of the @param lqp cannot be cached, because it modifies tables
+   *         or reads tables that are not in the StorageManager (e.g., meta tables)
+   */
+  static std::optional<std::vector<TableVersion>> table_versions(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  /**
+   * Caches the @param result_table of the @param lqp, which a transaction of the @param snapshot_commit_id computed
+   * from the tables of the @param table_versions. The transaction must not have modified any tables itself.
+   */
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result_table,
+           const CommitID snapshot_commit_id, const std::vector<TableVersion>& table_versions);
+
+  /**
+   * @return The cached result of the @param lqp if the tables have not been modified since, see above, or nullptr.
+   *         The transaction of the @param snapshot_commit_id must not have modified any tables itself.
+   */
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<AbstractLQPNode>& lqp, const CommitID snapshot_commit_id);
+
+  // Evicts the results of the table of the @param table_name, e.g., because the RowIDs of its rows have changed
+  void invalidate_table(const std::string& table_name);
+
+  size_t capacity() const;
+
+  // Evicts the results that exceed the new @param capacity. A capacity of 0 disables the cache.
+  void resize(const size_t capacity);
+
+  size_t size() const;
+
+  void clear();
+
+  // How often try_get() found a result that could be used and how often it did not, since the cache was created
+  size_t hit_count() const { return _hit_count.load(std::memory_order_relaxed); }
+  size_t miss_count() const { return _miss_count.load(std::memory_order_relaxed); }
+
+ protected:
+  friend class Singleton;
+
+  struct Entry {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    std::shared_ptr<const Table> result_table;
+    CommitID snapshot_commit_id;
+    std::vector<TableVersion> table_versions;
+  };
+
+  SQLResultCache();
+
+  // Whether the tables of the @param entry have changed since its result was computed, so that it is never used again
+  static bool _is_outdated(const Entry& entry);
+
+  GDFSCache<size_t, Entry> _cache;
+
+  // Read without the _mutex, which guards the _cache, as the GDFS priorities change even on lookups
+  std::atomic_size_t _capacity{0};
+  mutable std::mutex _mutex;
+
+  std::atomic_size_t _hit_count{0};
+  std::atomic_size_t _miss_count{0};
+};
+
+}  // namespace opossum
@@ -538,11 +538,10 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_stored_table(
   const auto stored_table_node = StoredTableNode::make(name);
   const auto validated_stored_table_node = _validate_if_active(stored_table_node);
 
-  const auto table = StorageManager::get().get_table(name);
-
   // Publish the columns of the table in the SQLIdentifierResolver
-  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
-    const auto& column_definition = table->column_definitions()[column_id];
+  const auto& column_definitions = stored_table_node->column_definitions();
+  for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+    const auto& column_definition = column_definitions[column_id];
     const auto column_reference = LQPColumnReference{stored_table_node, column_id};
     const auto column_expression = std::make_shared<LQPColumnExpression>(column_reference);
     sql_identifier_resolver->set_column_name(column_expression, column_definition.name);
@@ -1067,7 +1066,9 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_execute(const hsql::E
   AssertInput(_use_mvcc == (lqp_is_validated(prepared_plan->lqp) ? UseMvcc::Yes : UseMvcc::No),
               "Mismatch between validation of Prepared statement and query it is used in");
 
-  return prepared_plan->instantiate(parameters);
+  // The optimizer modifies the LQP, which instantiate() does not copy for a plan without placeholders
+  const auto lqp = prepared_plan->instantiate(parameters);
+  return lqp == prepared_plan->lqp ? lqp->deep_copy() : lqp;
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_validate_if_active(
@@ -1241,6 +1242,12 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
               return std::make_shared<AggregateExpression>(
                   aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
             }
+
+          case AggregateFunction::ApproxCountDistinct:
+            AssertInput(expr.exprList->front()->type != hsql::kExprStar,
+                        "APPROX_COUNT_DISTINCT() requires a column as its argument");
+            return std::make_shared<AggregateExpression>(
+                aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
         }
       }
 
@@ -0,0 +1,220 @@
+#include "cardinality_feedback.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "constant_mappings.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The column name of the @param expression, followed by the tables of the columns that it references, so that equally
+// named columns of different tables are told apart
+std::optional<std::string> describe_expression(const std::shared_ptr<AbstractExpression>& expression) {
+  auto description = expression->as_column_name();
+  auto is_describable = true;
+
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::LQPSelect || sub_expression->type == ExpressionType::PQPSelect) {
+      is_describable = false;
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+
+    if (sub_expression->type != ExpressionType::LQPColumn) return ExpressionVisitation::VisitArguments;
+
+    const auto& column_expression = static_cast<const LQPColumnExpression&>(*sub_expression);
+    const auto original_node = column_expression.column_reference.original_node();
+    if (!original_node) {
+      is_describable = false;
+    } else if (original_node->type == LQPNodeType::StoredTable) {
+      description += " @" + static_cast<const StoredTableNode&>(*original_node).table_name;
+    } else if (original_node->type == LQPNodeType::Mock) {
+      description += " @" + static_cast<const MockNode&>(*original_node).name.value_or("");
+    }
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+
+  if (!is_describable) return std::nullopt;
+  return description;
+}
+
+// Describes `a = b` and `b = a` the same way, as the JoinOrderingRule might create an inner join with either one
+std::optional<std::string> describe_inner_join_predicate(const std::shared_ptr<AbstractExpression>& predicate) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+  if (!binary_predicate) return describe_expression(predicate);
+
+  auto predicate_condition = binary_predicate->predicate_condition;
+  if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+      predicate_condition != PredicateCondition::LessThan &&
+      predicate_condition != PredicateCondition::LessThanEquals &&
+      predicate_condition != PredicateCondition::GreaterThan &&
+      predicate_condition != PredicateCondition::GreaterThanEquals) {
+    return describe_expression(predicate);
+  }
+
+  auto left_description = describe_expression(binary_predicate->left_operand());
+  auto right_description = describe_expression(binary_predicate->right_operand());
+  if (!left_description || !right_description) return std::nullopt;
+
+  if (*left_description > *right_description) {
+    std::swap(left_description, right_description);
+    predicate_condition = flip_predicate_condition(predicate_condition);
+  }
+
+  return *left_description + " " + predicate_condition_to_string.left.at(predicate_condition) + " " +
+         *right_description;
+}
+
+// The operator that outputs the @param input_node of the LQP node of the @param op. If the LQPTranslator created more
+// than one operator for that node (e.g., an IndexScan and a TableScan whose results are combined), the operator is
+// found among the inputs of those.
+std::shared_ptr<const AbstractOperator> find_input_operator(const AbstractOperator& op,
+                                                            const AbstractLQPNode& input_node) {
+  for (const auto& input : {op.input_left(), op.input_right()}) {
+    if (!input) continue;
+    if (input->lqp_node.get() == &input_node) return input;
+
+    if (!input->lqp_node || input->lqp_node == op.lqp_node) {
+      if (const auto input_operator = find_input_operator(*input, input_node)) return input_operator;
+    }
+  }
+
+  return nullptr;
+}
+
+// Rows per row of the cross product of the inputs. Empty inputs and outputs count as a single row, so that estimates
+// of zero rows are as good as those of a single row.
+double selectivity(const double output_row_count, const double left_input_row_count,
+                   const double right_input_row_count) {
+  return std::max(output_row_count, 1.0) / (std::max(left_input_row_count, 1.0) * std::max(right_input_row_count, 1.0));
+}
+
+}  // namespace
+
+namespace opossum {
+
+CardinalityFeedback::CardinalityFeedback() : _corrections(DEFAULT_CAPACITY) {}
+
+std::optional<std::string> CardinalityFeedback::key(const AbstractLQPNode& node) {
+  if (node.type == LQPNodeType::Predicate) {
+    const auto predicate_description = describe_expression(static_cast<const PredicateNode&>(node).predicate());
+    if (!predicate_description) return std::nullopt;
+    return "Predicate " + *predicate_description;
+  }
+
+  if (node.type == LQPNodeType::Join) {
+    const auto& join_node = static_cast<const JoinNode&>(node);
+    if (!join_node.join_predicate()) return std::nullopt;
+
+    const auto predicate_description = join_node.join_mode == JoinMode::Inner
+                                           ? describe_inner_join_predicate(join_node.join_predicate())
+                                           : describe_expression(join_node.join_predicate());
+    if (!predicate_description) return std::nullopt;
+    return join_mode_to_string.at(join_node.join_mode) + " Join " + *predicate_description;
+  }
+
+  return std::nullopt;
+}
+
+double CardinalityFeedback::correction(const std::string& key) const {
+  if (!_has_corrections) return 1.0;
+  return _corrections.try_get(key).value_or(1.0);
+}
+
+std::shared_ptr<TableStatistics> CardinalityFeedback::correct(
+    const AbstractLQPNode& node, const std::shared_ptr<TableStatistics>& statistics) const {
+  if (!_has_corrections) return statistics;
+
+  const auto key = CardinalityFeedback::key(node);
+  if (!key) return statistics;
+
+  const auto correction = _corrections.try_get(*key);
+  if (!correction) return statistics;
+
+  // The column statistics are left as they are, so that only the row counts of the following nodes are corrected
+  return std::make_shared<TableStatistics>(statistics->table_type(),
+                                           statistics->row_count() * static_cast<float>(*correction),
+                                           statistics->column_statistics());
+}
+
+double CardinalityFeedback::record(const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto max_q_error = 1.0;
+  auto visited_operators = std::unordered_set<const AbstractOperator*>{};
+
+  // A Limit stops the pipeline it is part of once it has its rows (see OperatorTask), so the operators that were
+  // executed in the same pipeline might not have processed all of their input
+  const auto visit_operator = [&](const auto& visit, const std::shared_ptr<const AbstractOperator>& op,
+                                  const bool output_might_be_incomplete) -> void {
+    if (!visited_operators.emplace(op.get()).second) return;
+
+    const auto is_incomplete = output_might_be_incomplete && !op->is_pipeline_breaker();
+    const auto inputs_might_be_incomplete = is_incomplete || op->type() == OperatorType::Limit;
+    if (op->input_left()) visit(visit, op->input_left(), inputs_might_be_incomplete);
+    if (op->input_right()) visit(visit, op->input_right(), inputs_might_be_incomplete);
+
+    const auto& node = op->lqp_node;
+    if (is_incomplete || !node || !node->left_input() || !op->performance_data().output_row_count) return;
+
+    const auto key = CardinalityFeedback::key(*node);
+    if (!key) return;
+
+    const auto left_input_operator = find_input_operator(*op, *node->left_input());
+    const auto right_input_operator = node->right_input() ? find_input_operator(*op, *node->right_input()) : nullptr;
+    if (!left_input_operator || !left_input_operator->performance_data().output_row_count) return;
+    if (node->right_input() && (!right_input_operator || !right_input_operator->performance_data().output_row_count)) {
+      return;
+    }
+
+    const auto actual_selectivity = selectivity(
+        static_cast<double>(*op->performance_data().output_row_count),
+        static_cast<double>(*left_input_operator->performance_data().output_row_count),
+        right_input_operator ? static_cast<double>(*right_input_operator->performance_data().output_row_count) : 1.0);
+
+    const auto estimated_selectivity =
+        selectivity(node->derive_statistics_from(node->left_input(), node->right_input())->row_count(),
+                    node->left_input()->get_statistics()->row_count(),
+                    node->right_input() ? node->right_input()->get_statistics()->row_count() : 1.0f);
+
+    const auto q = actual_selectivity / estimated_selectivity;
+    observe(*key, q);
+    max_q_error = std::max(max_q_error, std::max(q, 1.0 / q));
+  };
+
+  visit_operator(visit_operator, pqp, false);
+
+  return max_q_error;
+}
+
+void CardinalityFeedback::observe(const std::string& key, const double q) {
+  // The feedback of concurrent statements on the same predicate might get lost, which only slows down the learning
+  const auto correction = _corrections.try_get(key);
+  if (!correction && std::max(q, 1.0 / q) < MIN_Q_ERROR) return;
+
+  const auto weight = correction ? OBSERVATION_WEIGHT : 1.0;
+  const auto updated_correction = std::clamp(correction.value_or(1.0) * std::pow(q, weight), 1.0 / MAX_CORRECTION,
+                                             MAX_CORRECTION);
+
+  _corrections.set(key, updated_correction);
+  _has_corrections = true;
+}
+
+void CardinalityFeedback::clear() {
+  _corrections.clear();
+  _has_corrections = false;
+}
+
+}  // namespace opossum
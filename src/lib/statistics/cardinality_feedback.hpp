@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "cache/cache.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class TableStatistics;
+
+/**
+ * Corrects the cardinality estimates of PredicateNodes and JoinNodes with the row counts that their operators actually
+ * produced, similar to the learning optimizer LEO (Stillger et al., "LEO - DB2's LEarning Optimizer", VLDB 2001).
+ *
+ * After a PQP was executed (the SQLPipelineStatement does so for every statement), record() compares the selectivity
+ * of each predicate, i.e., its output rows relative to the rows of its inputs, with the estimated one. The quotient is
+ * stored as a correction factor, keyed by the predicate and the tables of its columns. Later estimates of the same
+ * predicate are multiplied with it, so that the JoinOrderingRule and the cost estimators see the corrected row counts.
+ * Corrections of predicates that are estimated again and again are smoothed in log space, so that a single outlier
+ * (e.g., a parameter value that is far more selective than the others) does not undo what was learned before.
+ *
+ * Predicates whose operators do not correspond to a single LQP node, e.g., the chains of PredicateNodes that the
+ * LQPTranslator merges into one TableScan, are not recorded.
+ */
+class CardinalityFeedback : public Singleton<CardinalityFeedback> {
+ public:
+  static constexpr auto DEFAULT_CAPACITY = size_t{4'096};
+
+  // Estimates that are off by less than this factor are not worth a correction
+  static constexpr auto MIN_Q_ERROR = 1.1;
+
+  // Bounds the correction factors, so that a predicate without any output rows does not estimate zero rows forever
+  static constexpr auto MAX_CORRECTION = 1e6;
+
+  // Cached plans whose estimates are off by more than this factor are evicted, so that they are optimized again
+  static constexpr auto MAX_Q_ERROR = 10.0;
+
+  // Weight of a new observation when it is combined with the correction learned before
+  static constexpr auto OBSERVATION_WEIGHT = 0.5;
+
+  // The key of the predicate of a PredicateNode or a predicated JoinNode, or std::nullopt for all other nodes and for
+  // predicates with subselects
+  static std::optional<std::string> key(const AbstractLQPNode& node);
+
+  // The factor that the estimated selectivity of the predicate with the @param key is corrected with (1 if none)
+  double correction(const std::string& key) const;
+
+  // Applies the correction of the predicate of the @param node to the @param statistics estimated for the node
+  std::shared_ptr<TableStatistics> correct(const AbstractLQPNode& node,
+                                           const std::shared_ptr<TableStatistics>& statistics) const;
+
+  // Learns from the output row counts of the operators of the executed @param pqp
+  // @return The largest factor by which the (corrected) estimate of one of its predicates was off, i.e., its q-error
+  double record(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // Combines the correction of the predicate with the @param key with the @param q, i.e., the actual selectivity
+  // divided by its corrected estimate
+  void observe(const std::string& key, const double q);
+
+  void clear();
+
+ protected:
+  friend class Singleton;
+
+  CardinalityFeedback();
+
+  mutable Cache<double, std::string> _corrections;
+
+  // Spares the estimates from computing keys as long as nothing was learned
+  std::atomic_bool _has_corrections{false};
+};
+
+}  // namespace opossum
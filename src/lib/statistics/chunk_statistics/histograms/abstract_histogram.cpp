@@ -80,6 +80,16 @@ T AbstractHistogram<T>::maximum() const {
   return _bin_maximum(bin_count() - 1u);
 }
 
+template <typename T>
+const std::string& AbstractHistogram<T>::supported_characters() const {
+  return _supported_characters;
+}
+
+template <typename T>
+size_t AbstractHistogram<T>::string_prefix_length() const {
+  return _string_prefix_length;
+}
+
 template <>
 uint64_t AbstractHistogram<std::string>::_convert_string_to_number_representation(const std::string& value) const {
   return convert_string_to_number_representation(value, _supported_characters, _string_prefix_length);
@@ -129,6 +129,12 @@ class AbstractHistogram : public AbstractFilter {
    */
   virtual HistogramCountType total_distinct_count() const = 0;
 
+  /**
+   * Return the settings of string histograms, see above (meaningless for other histograms).
+   */
+  const std::string& supported_characters() const;
+  size_t string_prefix_length() const;
+
  protected:
   /**
    * Returns a list of pairs of distinct values and their respective number of occurrences in a given segment.
@@ -112,8 +112,14 @@ template <typename T>
 std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_segment(
     const std::shared_ptr<const BaseSegment>& segment, const BinID max_bin_count,
     const std::optional<std::string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
-  const auto value_counts = AbstractHistogram<T>::_gather_value_distribution(segment);
+  return from_value_counts(AbstractHistogram<T>::_gather_value_distribution(segment), max_bin_count,
+                           supported_characters, string_prefix_length);
+}
 
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_value_counts(
+    const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+    const std::optional<std::string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
   if (value_counts.empty()) {
     return nullptr;
   }
@@ -150,6 +156,11 @@ BinID EqualDistinctCountHistogram<T>::bin_count() const {
   return _bin_data.bin_heights.size();
 }
 
+template <typename T>
+const EqualDistinctCountBinData<T>& EqualDistinctCountHistogram<T>::bin_data() const {
+  return _bin_data;
+}
+
 template <typename T>
 BinID EqualDistinctCountHistogram<T>::_bin_for_value(const T& value) const {
   const auto it = std::lower_bound(_bin_data.bin_maxima.cbegin(), _bin_data.bin_maxima.cend(), value);
@@ -62,6 +62,17 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
       const std::optional<std::string>& supported_characters = std::nullopt,
       const std::optional<uint32_t>& string_prefix_length = std::nullopt);
 
+  /**
+   * Create a histogram based on the distribution of values that were gathered elsewhere, e.g., across all chunks of a
+   * table.
+   * @param value_counts The distinct values and their number of occurrences, sorted by value.
+   * The other parameters are the same as for from_segment().
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_value_counts(
+      const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+      const std::optional<std::string>& supported_characters = std::nullopt,
+      const std::optional<uint32_t>& string_prefix_length = std::nullopt);
+
   HistogramType histogram_type() const override;
   std::string histogram_name() const override;
   HistogramCountType total_distinct_count() const override;
@@ -75,6 +86,9 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
    */
   BinID bin_count() const override;
 
+  // The bins, e.g., to export the histogram
+  const EqualDistinctCountBinData<T>& bin_data() const;
+
  protected:
   /**
    * Creates bins and their statistics.
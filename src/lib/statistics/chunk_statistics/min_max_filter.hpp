@@ -1,7 +1,11 @@
 #pragma once
 
+#include <string>
+#include <type_traits>
+
 #include "abstract_filter.hpp"
 #include "all_type_variant.hpp"
+#include "expression/evaluation/like_matcher.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 
@@ -16,6 +20,9 @@ class MinMaxFilter : public AbstractFilter {
   explicit MinMaxFilter(T min, T max) : _min(min), _max(max) {}
   ~MinMaxFilter() override = default;
 
+  const T& min() const { return _min; }
+  const T& max() const { return _max; }
+
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
     // Early exit for NULL variants.
@@ -46,12 +53,33 @@ class MinMaxFilter : public AbstractFilter {
         const auto value2 = type_cast_variant<T>(*variant_value2);
         return value > _max || value2 < _min;
       }
+      case PredicateCondition::Like:
+        if constexpr (std::is_same_v<T, std::string>) {
+          return _can_prune_like(value);
+        }
+        return false;
       default:
         return false;
     }
   }
 
  protected:
+  // A pattern that starts with a prefix only matches the strings from the prefix up to (excluding) the prefix with its
+  // last character incremented, e.g., 'abc%' only matches the strings in ['abc', 'abd')
+  bool _can_prune_like(const std::string& pattern) const {
+    const auto prefix = pattern.substr(0, LikeMatcher::get_index_of_next_wildcard(pattern));
+    if (prefix.size() == pattern.size()) return prefix < _min || prefix > _max;
+    if (_max < prefix) return true;
+
+    auto upper_bound = prefix;
+    while (!upper_bound.empty() && static_cast<unsigned char>(upper_bound.back()) == 0xFF) {
+      upper_bound.pop_back();
+    }
+    if (upper_bound.empty()) return false;
+    upper_bound.back() = static_cast<char>(static_cast<unsigned char>(upper_bound.back()) + 1);
+    return _min >= upper_bound;
+  }
+
   const T _min;
   const T _max;
 };
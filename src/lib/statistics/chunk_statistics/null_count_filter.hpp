@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Filter that stores the number of NULLs in a segment. IS NULL can be pruned if there are none, and all other
+ * predicates (IS NOT NULL as well as comparisons, which never match NULLs) if all values of the segment are NULL.
+ */
+class NullCountFilter : public AbstractFilter {
+ public:
+  NullCountFilter(const size_t null_count, const size_t row_count) : _null_count(null_count), _row_count(row_count) {}
+  ~NullCountFilter() override = default;
+
+  size_t null_count() const { return _null_count; }
+  size_t row_count() const { return _row_count; }
+
+  bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+                 const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
+    if (predicate_type == PredicateCondition::IsNull) return _null_count == 0;
+    return _null_count == _row_count;
+  }
+
+ protected:
+  const size_t _null_count;
+  const size_t _row_count;
+};
+
+}  // namespace opossum
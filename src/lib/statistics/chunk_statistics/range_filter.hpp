@@ -26,6 +26,8 @@ class RangeFilter : public AbstractFilter {
   explicit RangeFilter(std::vector<std::pair<T, T>> ranges) : _ranges(std::move(ranges)) {}
   ~RangeFilter() override = default;
 
+  const std::vector<std::pair<T, T>>& ranges() const { return _ranges; }
+
   static std::unique_ptr<RangeFilter<T>> build_filter(const pmr_vector<T>& dictionary,
                                                       uint32_t max_ranges_count = MAX_RANGES_COUNT);
 
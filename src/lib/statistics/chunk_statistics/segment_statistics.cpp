@@ -9,6 +9,7 @@
 
 #include "abstract_filter.hpp"
 #include "min_max_filter.hpp"
+#include "null_count_filter.hpp"
 #include "range_filter.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/dictionary_segment.hpp"
@@ -16,6 +17,7 @@
 #include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -48,18 +50,28 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
     using SegmentType = std::decay_t<decltype(typed_segment)>;
     using DataTypeT = typename decltype(type)::type;
 
+    auto null_count = size_t{0};
+
     // clang-format off
     if constexpr(std::is_same_v<SegmentType, DictionarySegment<DataTypeT>>) {
         // we can use the fact that dictionary segments have an accessor for the dictionary
         const auto& dictionary = *typed_segment.dictionary();
         statistics = build_statistics_from_dictionary(dictionary);
+
+        const auto null_value_id = static_cast<uint32_t>(typed_segment.null_value_id());
+        resolve_compressed_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+          const auto nulls = std::count(attribute_vector.cbegin(), attribute_vector.cend(), null_value_id);
+          null_count = static_cast<size_t>(nulls);
+        });
     } else {
       // if we have a generic segment we create the dictionary ourselves
       auto iterable = create_iterable_from_segment<DataTypeT>(typed_segment);
       std::unordered_set<DataTypeT> values;
       iterable.for_each([&](const auto& position) {
         // we are only interested in non-null values
-        if (!position.is_null()) {
+        if (position.is_null()) {
+          ++null_count;
+        } else {
           values.insert(position.value());
         }
       });
@@ -68,6 +80,8 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
       statistics = build_statistics_from_dictionary(dictionary);
     }
     // clang-format on
+
+    statistics->add_filter(std::make_shared<NullCountFilter>(null_count, typed_segment.size()));
   });
   return statistics;
 }
@@ -23,6 +23,8 @@ class SegmentStatistics final {
 
   void add_filter(std::shared_ptr<AbstractFilter> filter);
 
+  const std::vector<std::shared_ptr<AbstractFilter>>& filters() const { return _filters; }
+
   /**
    * calls can_prune on each filter in this object
   */
@@ -2,6 +2,8 @@
 
 #include <sstream>
 
+#include "chunk_statistics/histograms/abstract_histogram.hpp"
+#include "chunk_statistics/histograms/histogram_utils.hpp"
 #include "resolve_type.hpp"
 #include "table_statistics.hpp"
 #include "type_cast.hpp"
@@ -18,9 +20,15 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max,
+                                                            _histogram);
 }
 
 template <typename ColumnDataType>
@@ -104,11 +112,12 @@ template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_value_placeholder(
     const PredicateCondition predicate_condition, const std::optional<AllTypeVariant>& value2) const {
   switch (predicate_condition) {
-    // Simply assume the value will be in (_min, _max) and pick _min as the representative
+    // Simply assume the value will be in (_min, _max) and pick _min as the representative. The histogram is not
+    // used, as the share of _min is no better a guess for the share of the value than the uniform one.
     case PredicateCondition::Equals:
-      return estimate_equals_with_value(_min);
+      return _estimate_equals_with_value(_min, false);
     case PredicateCondition::NotEquals:
-      return estimate_not_equals_with_value(_min);
+      return _estimate_not_equals_with_value(_min, false);
 
     case PredicateCondition::LessThan:
     case PredicateCondition::LessThanEquals:
@@ -402,43 +411,101 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_range(const Col
     return {non_null_value_ratio(), without_null_values()};
   }
   auto selectivity = 0.f;
+  auto distinct_value_ratio = 0.f;
   // estimate_selectivity_for_range function expects that the minimum must not be greater than the maximum
   if (common_min <= common_max) {
-    selectivity = estimate_range_selectivity(common_min, common_max);
+    distinct_value_ratio = estimate_range_selectivity(common_min, common_max);
+    selectivity =
+        _estimate_range_selectivity_with_histogram(common_min, common_max).value_or(distinct_value_ratio);
   }
-  auto column_statistics =
-      std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, selectivity * distinct_count(), common_min, common_max);
+  // The histogram covers the narrowed range as well, so that following predicates on the column can use it
+  auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(
+      0.0f, distinct_value_ratio * distinct_count(), common_min, common_max, _histogram);
   return {non_null_value_ratio() * selectivity, column_statistics};
 }
 
 template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_equals_with_value(const ColumnDataType value) const {
+  return _estimate_equals_with_value(value, true);
+}
+
+template <typename ColumnDataType>
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_not_equals_with_value(
+    const ColumnDataType value) const {
+  return _estimate_not_equals_with_value(value, true);
+}
+
+template <typename ColumnDataType>
+std::optional<float> ColumnStatistics<ColumnDataType>::_estimate_range_selectivity_with_histogram(
+    const ColumnDataType minimum, const ColumnDataType maximum) const {
+  // String ranges are not estimated yet (see estimate_range_selectivity())
+  if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+    return std::nullopt;
+  } else {
+    if (!_histogram) return std::nullopt;
+
+    // The statistics might cover only a part of the histogram, e.g., after a previous predicate on the column
+    const auto value_count = _histogram->estimate_cardinality(PredicateCondition::Between, _min, _max);
+    if (value_count <= 0.0f) return std::nullopt;
+
+    const auto range_count = _histogram->estimate_cardinality(PredicateCondition::Between, minimum, maximum);
+    return std::min(range_count / value_count, 1.0f);
+  }
+}
+
+template <typename ColumnDataType>
+std::optional<float> ColumnStatistics<ColumnDataType>::_estimate_equals_selectivity_with_histogram(
+    const ColumnDataType value) const {
+  if (!_histogram) return std::nullopt;
+
+  if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+    // String histograms cannot estimate values with characters that they do not support
+    const auto supported_characters = histogram::get_default_or_check_string_histogram_prefix_settings().first;
+    if (value.find_first_not_of(supported_characters) != std::string::npos ||
+        _min.find_first_not_of(supported_characters) != std::string::npos ||
+        _max.find_first_not_of(supported_characters) != std::string::npos) {
+      return std::nullopt;
+    }
+  }
+
+  const auto value_count = _histogram->estimate_cardinality(PredicateCondition::Between, _min, _max);
+  if (value_count <= 0.0f) return std::nullopt;
+
+  return std::min(_histogram->estimate_cardinality(PredicateCondition::Equals, value) / value_count, 1.0f);
+}
+
+template <typename ColumnDataType>
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::_estimate_equals_with_value(const ColumnDataType value,
+                                                                                    const bool use_histogram) const {
   DebugAssert(distinct_count() > 0, "Distinct count has to be greater zero");
   float new_distinct_count = 1.f;
   if (value < _min || value > _max) {
     new_distinct_count = 0.f;
   }
   auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, new_distinct_count, value, value);
-  if (distinct_count() == 0.0f) {
+  if (distinct_count() == 0.0f || new_distinct_count == 0.0f) {
     return {0.0f, column_statistics};
-  } else {
-    return {non_null_value_ratio() * new_distinct_count / distinct_count(), column_statistics};
   }
+
+  const auto selectivity = use_histogram ? _estimate_equals_selectivity_with_histogram(value) : std::nullopt;
+  return {non_null_value_ratio() * selectivity.value_or(new_distinct_count / distinct_count()), column_statistics};
 }
 
 template <typename ColumnDataType>
-FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_not_equals_with_value(
-    const ColumnDataType value) const {
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::_estimate_not_equals_with_value(
+    const ColumnDataType value, const bool use_histogram) const {
   DebugAssert(distinct_count() > 0, "Distinct count has to be greater zero");
   if (value < _min || value > _max) {
     return {non_null_value_ratio(), without_null_values()};
   }
-  auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, distinct_count() - 1, _min, _max);
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, distinct_count() - 1, _min, _max, _histogram);
   if (distinct_count() == 0.0f) {
     return {0.0f, column_statistics};
-  } else {
-    return {non_null_value_ratio() * (1 - 1.f / distinct_count()), column_statistics};
   }
+
+  const auto selectivity = use_histogram ? _estimate_equals_selectivity_with_histogram(value) : std::nullopt;
+  return {non_null_value_ratio() * (1 - selectivity.value_or(1.f / distinct_count())), column_statistics};
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
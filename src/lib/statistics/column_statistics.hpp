@@ -11,17 +11,27 @@
 
 namespace opossum {
 
+template <typename T>
+class AbstractHistogram;
+
 /**
  * @tparam ColumnDataType   the DataType of the values in the Column that these statistics represent
+ *
+ * If a histogram of the values of the Column is given (generate_table_statistics() builds one), the selectivities of
+ * predicates that compare the Column with a value are estimated with it, so that skewed value distributions are taken
+ * into account. Otherwise (and for placeholders), the values are assumed to be uniformly distributed between min and
+ * max.
  */
 template <typename ColumnDataType>
 class ColumnStatistics : public BaseColumnStatistics {
  public:
   ColumnStatistics(const float null_value_ratio, const float distinct_count, const ColumnDataType min,
-                   const ColumnDataType max)
+                   const ColumnDataType max,
+                   const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram = nullptr)
       : BaseColumnStatistics(data_type_from_type<ColumnDataType>(), null_value_ratio, distinct_count),
         _min(min),
-        _max(max) {
+        _max(max),
+        _histogram(histogram) {
     Assert(null_value_ratio >= 0.0f && null_value_ratio <= 1.0f, "NullValueRatio out of range");
   }
 
@@ -40,6 +50,7 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+  const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram() const;
   /** @} */
 
   /**
@@ -89,8 +100,18 @@ class ColumnStatistics : public BaseColumnStatistics {
   /** @} */
 
  private:
+  // The ratio of the non-null values in [minimum, maximum] and of those equal to the value according to the histogram,
+  // or std::nullopt if there is none or it cannot estimate the range/value
+  std::optional<float> _estimate_range_selectivity_with_histogram(const ColumnDataType minimum,
+                                                                  const ColumnDataType maximum) const;
+  std::optional<float> _estimate_equals_selectivity_with_histogram(const ColumnDataType value) const;
+
+  FilterByValueEstimate _estimate_equals_with_value(const ColumnDataType value, const bool use_histogram) const;
+  FilterByValueEstimate _estimate_not_equals_with_value(const ColumnDataType value, const bool use_histogram) const;
+
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const AbstractHistogram<ColumnDataType>> _histogram;
 };
 
 }  // namespace opossum
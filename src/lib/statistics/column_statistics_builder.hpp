@@ -0,0 +1,100 @@
+#pragma once
+
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "hyper_log_log.hpp"
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnStatistics;
+class BaseSegment;
+
+/**
+ * The blocks of a chunk that the ColumnStatisticsBuilders read. The blocks are numbered across the chunks of a table
+ * and every (1 / rate)-th block is read (systematic block sampling), so that the sample is spread evenly over the
+ * table. The values of every (1 / histogram_rate)-th block are counted for the histogram, too.
+ */
+struct StatisticsSample {
+  static constexpr auto BLOCK_SIZE = ChunkOffset{4'096};
+
+  static bool contains(const uint64_t block_id, const double rate);
+
+  // The ID of the first block of the chunk
+  uint64_t first_block_id{0};
+  double rate{1.0};
+  double histogram_rate{1.0};
+};
+
+/**
+ * Gathers the statistics of the segments of a column, so that the ColumnStatistics of a table can be generated in
+ * parallel (each builder reads some of the chunks, then they are merged), and the segments of chunks that are
+ * appended later can be added without reading the others again.
+ */
+class BaseColumnStatisticsBuilder {
+ public:
+  virtual ~BaseColumnStatisticsBuilder() = default;
+
+  // An empty builder for the same data type
+  virtual std::shared_ptr<BaseColumnStatisticsBuilder> new_builder() const = 0;
+
+  virtual void add_segment(const BaseSegment& segment, const StatisticsSample& sample) = 0;
+
+  // @param other must have the same data type
+  virtual void merge(const BaseColumnStatisticsBuilder& other) = 0;
+
+  // Builds the histogram from the values counted so far and frees them. The distinct count of a sample is
+  // extrapolated to the @param row_count of the table from how often the values occur in it.
+  virtual void build_histogram(const uint64_t row_count) = 0;
+
+  virtual std::shared_ptr<BaseColumnStatistics> column_statistics(const uint64_t row_count) const = 0;
+};
+
+template <typename T>
+class ColumnStatisticsBuilder : public BaseColumnStatisticsBuilder {
+ public:
+  ColumnStatisticsBuilder();
+
+  std::shared_ptr<BaseColumnStatisticsBuilder> new_builder() const override;
+  void add_segment(const BaseSegment& segment, const StatisticsSample& sample) override;
+  void merge(const BaseColumnStatisticsBuilder& other) override;
+  void build_histogram(const uint64_t row_count) override;
+  std::shared_ptr<BaseColumnStatistics> column_statistics(const uint64_t row_count) const override;
+
+ private:
+  void _add_min_max(const T& value);
+
+  uint64_t _read_row_count{0};
+  uint64_t _null_value_count{0};
+  std::optional<T> _min;
+  std::optional<T> _max;
+  HyperLogLog _distinct_values;
+
+  // Multiplied with the estimate of the HyperLogLog for the rows that were not read (see build_histogram())
+  double _distinct_count_scale{1.0};
+
+  // The values are only counted for the histogram and thrown away once it is built, so we don't want proper heap
+  // allocations for them
+  struct ValueCounts {
+    using ValueCount = std::pair<const T, HistogramCountType>;
+
+    boost::container::pmr::monotonic_buffer_resource buffer;
+    std::unordered_map<T, HistogramCountType, std::hash<T>, std::equal_to<>, PolymorphicAllocator<ValueCount>> counts{
+        PolymorphicAllocator<ValueCount>{&buffer}};
+  };
+  std::unique_ptr<ValueCounts> _value_counts;
+  uint64_t _counted_row_count{0};
+
+  // String histograms support only a range of characters, so columns with other characters do not get one
+  bool _has_unsupported_characters{false};
+
+  std::shared_ptr<const AbstractHistogram<T>> _histogram;
+};
+
+}  // namespace opossum
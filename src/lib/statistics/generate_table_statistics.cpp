@@ -1,30 +1,11 @@
 #include "generate_table_statistics.hpp"
 
-#include <unordered_set>
-
-#include "base_column_statistics.hpp"
-#include "column_statistics.hpp"
-#include "generate_column_statistics.hpp"
-#include "resolve_type.hpp"
-#include "storage/table.hpp"
-#include "table_statistics.hpp"
+#include "table_statistics_builder.hpp"
 
 namespace opossum {
 
-TableStatistics generate_table_statistics(const Table& table) {
-  std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
-  column_statistics.reserve(table.column_count());
-
-  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-    const auto column_data_type = table.column_data_types()[column_id];
-
-    resolve_data_type(column_data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-      column_statistics.emplace_back(generate_column_statistics<ColumnDataType>(table, column_id));
-    });
-  }
-
-  return {table.type(), static_cast<float>(table.row_count()), column_statistics};
+TableStatistics generate_table_statistics(const Table& table, const double sample_rate) {
+  return TableStatisticsBuilder{table, sample_rate}.table_statistics(table);
 }
 
 }  // namespace opossum
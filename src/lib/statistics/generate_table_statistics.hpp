@@ -1,8 +1,5 @@
 #pragma once
 
-#include <memory>
-#include <unordered_set>
-
 #include "table_statistics.hpp"
 
 namespace opossum {
@@ -10,8 +7,9 @@ namespace opossum {
 class Table;
 
 /**
- * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution.
+ * Generate statistics about a Table by analysing its data (see TableStatisticsBuilder). Unless a @param sample_rate
+ * below 1 is given, this reads the entire table and may be slow, use with caution.
  */
-TableStatistics generate_table_statistics(const Table& table);
+TableStatistics generate_table_statistics(const Table& table, const double sample_rate = 1.0);
 
 }  // namespace opossum
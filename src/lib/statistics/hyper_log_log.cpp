@@ -0,0 +1,105 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+
+// Finalizer of SplitMix64, which spreads the bits of the input over all bits of the output
+uint64_t mix(uint64_t hash) {
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void HyperLogLog::add(const uint64_t hash) {
+  const auto mixed_hash = mix(hash);
+
+  if (!_registers.empty()) {
+    _add_to_registers(mixed_hash);
+    return;
+  }
+
+  const auto iter = std::lower_bound(_sparse_hashes.begin(), _sparse_hashes.end(), mixed_hash);
+  if (iter != _sparse_hashes.end() && *iter == mixed_hash) return;
+
+  _sparse_hashes.insert(iter, mixed_hash);
+  if (_sparse_hashes.size() > SPARSE_LIMIT) _convert_to_registers();
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other._registers.empty()) {
+    if (_registers.empty()) {
+      auto merged_hashes = std::vector<uint64_t>{};
+      merged_hashes.reserve(_sparse_hashes.size() + other._sparse_hashes.size());
+      std::set_union(_sparse_hashes.begin(), _sparse_hashes.end(), other._sparse_hashes.begin(),
+                     other._sparse_hashes.end(), std::back_inserter(merged_hashes));
+      _sparse_hashes = std::move(merged_hashes);
+      if (_sparse_hashes.size() > SPARSE_LIMIT) _convert_to_registers();
+    } else {
+      for (const auto mixed_hash : other._sparse_hashes) {
+        _add_to_registers(mixed_hash);
+      }
+    }
+    return;
+  }
+
+  _convert_to_registers();
+  for (auto register_id = size_t{0}; register_id < REGISTER_COUNT; ++register_id) {
+    _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  if (_registers.empty()) return static_cast<double>(_sparse_hashes.size());
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(value));
+    if (value == 0) ++zero_register_count;
+  }
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // Small cardinalities are estimated better by counting the registers that no hash was assigned to
+  if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(zero_register_count));
+  }
+
+  return raw_estimate;
+}
+
+void HyperLogLog::_add_to_registers(const uint64_t mixed_hash) {
+  // The first PRECISION bits select the register, which keeps the longest run of leading zeros in the other bits
+  const auto register_id = mixed_hash >> (64 - PRECISION);
+  const auto remaining_bits = mixed_hash << PRECISION;
+  auto rank = uint8_t{1};
+  for (auto bit = uint64_t{1} << 63; rank <= 64 - PRECISION && !(remaining_bits & bit); bit >>= 1) {
+    ++rank;
+  }
+
+  _registers[register_id] = std::max(_registers[register_id], rank);
+}
+
+void HyperLogLog::_convert_to_registers() {
+  if (!_registers.empty()) return;
+
+  _registers.resize(REGISTER_COUNT);
+  for (const auto mixed_hash : _sparse_hashes) {
+    _add_to_registers(mixed_hash);
+  }
+  _sparse_hashes = {};
+}
+
+}  // namespace opossum
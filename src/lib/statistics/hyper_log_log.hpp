@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Estimates the number of distinct values that were added to it, using constant memory (Flajolet et al.,
+ * "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm", AofA 2007). Two HyperLogLogs can be
+ * merged, so that the distinct values of chunks that are read in parallel or appended later can be counted without
+ * keeping the values.
+ *
+ * As long as fewer than SPARSE_LIMIT distinct values were added, their hashes are kept instead of the registers
+ * (similar to the sparse representation of HyperLogLog++), so that small counts are exact.
+ */
+class HyperLogLog {
+ public:
+  // 2^14 registers estimate with a standard error of about 0.8%
+  static constexpr auto PRECISION = uint32_t{14};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+  static constexpr auto SPARSE_LIMIT = size_t{2'048};
+
+  // @param hash of the value, which the HyperLogLog mixes, so that hash functions like std::hash<int32_t> (i.e., the
+  // identity) can be used
+  void add(const uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  double estimate() const;
+
+ private:
+  void _add_to_registers(const uint64_t mixed_hash);
+  void _convert_to_registers();
+
+  // Sorted mixed hashes while the representation is sparse
+  std::vector<uint64_t> _sparse_hashes;
+
+  // Empty while the representation is sparse
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -56,6 +56,9 @@ class TableStatistics final {
   // Increases the (approximate) count of invalid rows in the table (caused by deletes).
   void increase_invalid_row_count(uint64_t count);
 
+  // Decreases it again for rows that were deleted only to be inserted elsewhere (see MvccGarbageCollector)
+  void decrease_invalid_row_count(uint64_t count);
+
   std::string description() const;
 
  private:
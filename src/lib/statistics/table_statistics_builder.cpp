@@ -0,0 +1,130 @@
+#include "table_statistics_builder.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_column_statistics.hpp"
+#include "column_statistics_builder.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableStatisticsBuilder::TableStatisticsBuilder(const Table& table, const double sample_rate, const bool read_chunks)
+    : _sample_rate(sample_rate) {
+  Assert(sample_rate > 0.0 && sample_rate <= 1.0, "Sample rate must be in (0, 1]");
+
+  _column_builders.reserve(table.column_count());
+  for (const auto data_type : table.column_data_types()) {
+    resolve_data_type(data_type, [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _column_builders.emplace_back(std::make_shared<ColumnStatisticsBuilder<ColumnDataType>>());
+    });
+  }
+
+  if (read_chunks) _add_all_chunks(table);
+}
+
+void TableStatisticsBuilder::add_chunks(const Table& table, const std::vector<ChunkID>& chunk_ids) {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (!_has_read_chunks) {
+    _add_all_chunks(table);
+    return;
+  }
+
+  _add_chunks(table, chunk_ids, 0.0);
+}
+
+TableStatistics TableStatisticsBuilder::table_statistics(const Table& table) const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  Assert(_has_read_chunks, "TableStatisticsBuilder has not read the chunks of the table yet");
+
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.reserve(_column_builders.size());
+  for (const auto& column_builder : _column_builders) {
+    column_statistics.emplace_back(column_builder->column_statistics(table.row_count()));
+  }
+
+  return {table.type(), static_cast<float>(table.row_count()), column_statistics};
+}
+
+void TableStatisticsBuilder::_add_all_chunks(const Table& table) {
+  _has_read_chunks = true;
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(table.chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    chunk_ids.emplace_back(chunk_id);
+  }
+
+  const auto row_count = static_cast<double>(table.row_count());
+  const auto histogram_rate =
+      row_count > 0.0 ? std::min(_sample_rate, static_cast<double>(MAX_HISTOGRAM_ROW_COUNT) / row_count) : _sample_rate;
+  _add_chunks(table, chunk_ids, histogram_rate);
+}
+
+void TableStatisticsBuilder::_add_chunks(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                                         const double histogram_rate) {
+  auto chunks = std::vector<std::shared_ptr<const Chunk>>{};
+  auto first_block_ids = std::vector<uint64_t>{};
+  for (const auto chunk_id : chunk_ids) {
+    if (static_cast<size_t>(chunk_id) >= _added_chunks.size()) _added_chunks.resize(chunk_id + 1);
+    const auto chunk = table.get_chunk(chunk_id);
+    // Empty chunks, e.g., a mutable chunk that was just appended, are added once they have rows
+    if (_added_chunks[chunk_id] || !chunk || chunk->size() == 0) continue;
+
+    _added_chunks[chunk_id] = true;
+    chunks.emplace_back(chunk);
+    first_block_ids.emplace_back(_next_block_id);
+    _next_block_id += (chunk->size() + StatisticsSample::BLOCK_SIZE - 1) / StatisticsSample::BLOCK_SIZE;
+  }
+
+  if (chunks.empty() || _column_builders.empty()) return;
+
+  // Each job reads every job_count_per_column-th chunk of one column
+  const auto thread_count = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  const auto job_count_per_column = std::clamp(thread_count / _column_builders.size(), size_t{1}, chunks.size());
+
+  auto partial_builders = std::vector<std::vector<std::shared_ptr<BaseColumnStatisticsBuilder>>>(
+      _column_builders.size(), std::vector<std::shared_ptr<BaseColumnStatisticsBuilder>>(job_count_per_column));
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(_column_builders.size() * job_count_per_column);
+
+  for (auto column_id = ColumnID{0}; column_id < _column_builders.size(); ++column_id) {
+    for (auto job_id = size_t{0}; job_id < job_count_per_column; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, column_id, job_id]() {
+        const auto partial_builder = _column_builders[column_id]->new_builder();
+        for (auto chunk_index = job_id; chunk_index < chunks.size(); chunk_index += job_count_per_column) {
+          const auto sample = StatisticsSample{first_block_ids[chunk_index], _sample_rate, histogram_rate};
+          partial_builder->add_segment(*chunks[chunk_index]->get_segment(column_id), sample);
+        }
+        partial_builders[column_id][job_id] = partial_builder;
+      }));
+      jobs.back()->schedule();
+    }
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  const auto row_count = table.row_count();
+  for (auto column_id = ColumnID{0}; column_id < _column_builders.size(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      for (const auto& partial_builder : partial_builders[column_id]) {
+        _column_builders[column_id]->merge(*partial_builder);
+      }
+      if (histogram_rate > 0.0) _column_builders[column_id]->build_histogram(row_count);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+}  // namespace opossum
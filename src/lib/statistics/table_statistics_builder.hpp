@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "table_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnStatisticsBuilder;
+class Table;
+
+/**
+ * Generates the TableStatistics of a Table. The chunks are read in parallel, a column by up to as many JobTasks as
+ * there are cores for all columns. Chunks that are added later (see StorageManager::add_chunks_to_table_statistics())
+ * are merged into the statistics of the others, so that only the new chunks are read.
+ *
+ * With a @param sample_rate below 1, only that share of the rows is read, in blocks of StatisticsSample::BLOCK_SIZE
+ * rows. The distinct counts are estimated with HyperLogLogs and extrapolated to the rows that were not read.
+ *
+ * The histograms are built from at most MAX_HISTOGRAM_ROW_COUNT of the rows of the chunks that the table has when the
+ * builder reads its chunks for the first time. Chunks that are added later do not change them.
+ *
+ * Without @param read_chunks (e.g., if the statistics of the table were restored from a binary file), the chunks are
+ * only read when chunks are added for the first time.
+ */
+class TableStatisticsBuilder {
+ public:
+  static constexpr auto MAX_HISTOGRAM_ROW_COUNT = uint64_t{1'000'000};
+
+  explicit TableStatisticsBuilder(const Table& table, const double sample_rate = 1.0, const bool read_chunks = true);
+
+  // Adds the chunks with the @param chunk_ids that were not added before
+  void add_chunks(const Table& table, const std::vector<ChunkID>& chunk_ids);
+
+  TableStatistics table_statistics(const Table& table) const;
+
+ private:
+  void _add_all_chunks(const Table& table);
+  void _add_chunks(const Table& table, const std::vector<ChunkID>& chunk_ids, const double histogram_rate);
+
+  const double _sample_rate;
+  std::vector<std::shared_ptr<BaseColumnStatisticsBuilder>> _column_builders;
+
+  bool _has_read_chunks{false};
+  std::vector<bool> _added_chunks;
+  uint64_t _next_block_id{0};
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
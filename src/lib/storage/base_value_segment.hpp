@@ -27,6 +27,9 @@ class BaseValueSegment : public BaseSegment {
   virtual const pmr_concurrent_vector<bool>& null_values() const = 0;
   virtual pmr_concurrent_vector<bool>& null_values() = 0;
 
+  // returns false if the segment is known not to contain null values, even though it might support them
+  virtual bool may_contain_nulls() const = 0;
+
   virtual void reserve(const size_t capacity) = 0;
 };
 }  // namespace opossum
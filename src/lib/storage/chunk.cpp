@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -21,8 +22,9 @@ Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_dat
              const std::optional<PolymorphicAllocator<Chunk>>& alloc,
              const std::shared_ptr<ChunkAccessCounter>& access_counter)
     : _segments(segments), _mvcc_data(mvcc_data), _access_counter(access_counter) {
+  const auto chunk_size = segments.empty() ? ChunkOffset{0} : static_cast<ChunkOffset>(segments[0]->size());
+
 #if HYRISE_DEBUG
-  const auto chunk_size = segments.empty() ? 0u : segments[0]->size();
   Assert(!_mvcc_data || _mvcc_data->size() == chunk_size, "Invalid MvccData size");
   for (const auto& segment : segments) {
     Assert(segment->size() == chunk_size, "Segments don't have the same length");
@@ -30,6 +32,10 @@ Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_dat
 #endif
 
   if (alloc) _alloc = *alloc;
+
+  _reserved_row_count = chunk_size;
+  _added_row_count = chunk_size;
+  _mvcc_data_pointer = _mvcc_data.get();
 }
 
 bool Chunk::is_mutable() const { return _is_mutable; }
@@ -54,10 +60,25 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   auto segment_it = _segments.cbegin();
   auto value_it = values.begin();
   for (; segment_it != _segments.end(); segment_it++, value_it++) {
-    const auto& base_value_segment = std::dynamic_pointer_cast<BaseValueSegment>(*segment_it);
-    DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
-    base_value_segment->append(*value_it);
+    // Checked only in debug builds, as the cast would otherwise be paid for every value
+    DebugAssert(std::dynamic_pointer_cast<BaseValueSegment>(*segment_it),
+                "Can't append to segment that is not a ValueSegment");
+    static_cast<BaseValueSegment&>(**segment_it).append(*value_it);
   }
+
+  ++_reserved_row_count;
+  ++_added_row_count;
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count, const ChunkOffset max_size) {
+  auto begin_offset = _reserved_row_count.load();
+  auto reserved_row_count = ChunkOffset{0};
+  do {
+    if (begin_offset >= max_size) return {begin_offset, 0};
+    reserved_row_count = std::min(row_count, static_cast<ChunkOffset>(max_size - begin_offset));
+  } while (!_reserved_row_count.compare_exchange_weak(begin_offset, begin_offset + reserved_row_count));
+
+  return {begin_offset, reserved_row_count};
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -74,22 +95,68 @@ uint32_t Chunk::size() const {
   return static_cast<uint32_t>(first_segment->size());
 }
 
-bool Chunk::has_mvcc_data() const { return _mvcc_data != nullptr; }
+bool Chunk::has_mvcc_data() const {
+  if (_replicated_chunk) return _replicated_chunk->has_mvcc_data();
+  return _mvcc_data_pointer.load() != nullptr;
+}
 bool Chunk::has_access_counter() const { return _access_counter != nullptr; }
 
-SharedScopedLockingPtr<MvccData> Chunk::get_scoped_mvcc_data_lock() const {
+EpochProtectedPtr<MvccData> Chunk::get_scoped_mvcc_data_lock() const {
   DebugAssert((has_mvcc_data()), "Chunk does not have mvcc data");
+  if (_replicated_chunk) return _replicated_chunk->get_scoped_mvcc_data_lock();
+
+  // Pin the epoch before loading the pointer, so that the MVCC data cannot be freed in between
+  auto epoch_guard = EpochManager::get().pin();
+  return {*_mvcc_data_pointer.load(), std::move(epoch_guard)};
+}
 
-  return {*_mvcc_data, _mvcc_data->_mutex};
+std::shared_ptr<MvccData> Chunk::mvcc_data() const {
+  if (_replicated_chunk) return _replicated_chunk->mvcc_data();
+  return std::atomic_load(&_mvcc_data);
 }
 
-std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
+void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) {
+  DebugAssert(!_replicated_chunk, "The MVCC data of a replica is the one of its replicated chunk");
+  const auto previous_mvcc_data = std::atomic_exchange(&_mvcc_data, mvcc_data);
+  _mvcc_data_pointer = mvcc_data.get();
+  if (previous_mvcc_data) EpochManager::get().retire(previous_mvcc_data);
+}
+
+bool Chunk::shrink_mvcc_data() {
+  DebugAssert(!is_mutable(), "Only the MVCC data of immutable chunks can be shrunk");
+
+  const auto mvcc_data = this->mvcc_data();
+  const auto row_count = mvcc_data->size();
+
+  // No transaction must modify the MVCC data while it is copied. Transactions that try to lock a row in the meantime
+  // retry on the new MVCC data (see Delete). Rows that a transaction has locked or not yet committed are not shrunk.
+  auto locked_row_count = size_t{0};
+  for (; locked_row_count < row_count; ++locked_row_count) {
+    auto expected = TransactionID{0};
+    if (!mvcc_data->tids[locked_row_count].compare_exchange_strong(expected, MvccData::SHRINK_TRANSACTION_ID)) break;
+  }
+
+  if (locked_row_count < row_count) {
+    for (auto chunk_offset = size_t{0}; chunk_offset < locked_row_count; ++chunk_offset) {
+      mvcc_data->tids[chunk_offset] = TransactionID{0};
+    }
+    return false;
+  }
+
+  const auto shrunk_mvcc_data = std::make_shared<MvccData>(row_count, _alloc);
+  std::copy(mvcc_data->begin_cids.cbegin(), mvcc_data->begin_cids.cend(), shrunk_mvcc_data->begin_cids.begin());
+  std::copy(mvcc_data->end_cids.cbegin(), mvcc_data->end_cids.cend(), shrunk_mvcc_data->end_cids.begin());
+  shrunk_mvcc_data->shrink();
 
-void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) { _mvcc_data = mvcc_data; }
+  // The rows of the old MVCC data stay locked for readers that still use it
+  set_mvcc_data(shrunk_mvcc_data);
+  return true;
+}
 
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
+  std::shared_lock<std::shared_mutex> lock{_indices_mutex};
   std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
@@ -102,6 +169,7 @@ std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<Col
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  std::shared_lock<std::shared_mutex> lock{_indices_mutex};
   auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
@@ -116,6 +184,7 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
 }
 
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  std::unique_lock<std::shared_mutex> lock{_indices_mutex};
   auto it = std::find(_indices.cbegin(), _indices.cend(), index);
   DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
   _indices.erase(it);
@@ -153,8 +222,33 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
     new_segments.push_back(segment->copy_using_allocator(_alloc));
   }
   _segments = std::move(new_segments);
+
+  // The MVCC data is moved by replacing it with a copy on the new allocator, which is only safe once no more rows are
+  // appended. If a transaction has locked a row, the MVCC data stays where it is.
+  if (has_mvcc_data() && !is_mutable()) shrink_mvcc_data();
 }
 
+std::shared_ptr<Chunk> Chunk::create_replica(const std::shared_ptr<const Chunk>& chunk,
+                                             const PolymorphicAllocator<Chunk>& alloc) {
+  Assert(!chunk->is_mutable(), "Only immutable chunks can be replicated");
+
+  Segments segments(alloc);
+  for (const auto& segment : chunk->segments()) {
+    segments.push_back(std::atomic_load(&segment)->copy_using_allocator(alloc));
+  }
+
+  auto replica = std::make_shared<Chunk>(segments, nullptr, alloc, chunk->access_counter());
+  replica->_replicated_chunk = chunk->_replicated_chunk ? chunk->_replicated_chunk : chunk;
+  replica->mark_immutable();
+  replica->set_statistics(chunk->statistics());
+  replica->set_partition_id(chunk->partition_id());
+  if (chunk->ordered_by()) replica->set_ordered_by(*chunk->ordered_by());
+  if (const auto cleanup_commit_id = chunk->cleanup_commit_id()) replica->set_cleanup_commit_id(*cleanup_commit_id);
+  return replica;
+}
+
+const std::shared_ptr<const Chunk>& Chunk::replicated_chunk() const { return _replicated_chunk; }
+
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
 size_t Chunk::estimate_memory_usage() const {
@@ -167,11 +261,11 @@ size_t Chunk::estimate_memory_usage() const {
   // TODO(anybody) Index memory usage missing
   // TODO(anybody) ChunkAccessCounter memory usage missing
 
-  if (_mvcc_data) {
-    bytes += sizeof(_mvcc_data->tids) + sizeof(_mvcc_data->begin_cids) + sizeof(_mvcc_data->end_cids);
-    bytes += _mvcc_data->tids.size() * sizeof(decltype(_mvcc_data->tids)::value_type);
-    bytes += _mvcc_data->begin_cids.size() * sizeof(decltype(_mvcc_data->begin_cids)::value_type);
-    bytes += _mvcc_data->end_cids.size() * sizeof(decltype(_mvcc_data->end_cids)::value_type);
+  if (const auto mvcc_data = this->mvcc_data()) {
+    bytes += sizeof(mvcc_data->tids) + sizeof(mvcc_data->begin_cids) + sizeof(mvcc_data->end_cids);
+    bytes += mvcc_data->tids.size() * sizeof(decltype(mvcc_data->tids)::value_type);
+    bytes += mvcc_data->begin_cids.size() * sizeof(decltype(mvcc_data->begin_cids)::value_type);
+    bytes += mvcc_data->end_cids.size() * sizeof(decltype(mvcc_data->end_cids)::value_type);
   }
 
   return bytes;
@@ -202,4 +296,23 @@ void Chunk::set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statist
   _statistics = chunk_statistics;
 }
 
+std::optional<CommitID> Chunk::cleanup_commit_id() const {
+  const auto cleanup_commit_id = _cleanup_commit_id.load();
+  if (cleanup_commit_id == MvccData::MAX_COMMIT_ID) return std::nullopt;
+  return cleanup_commit_id;
+}
+
+void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
+  DebugAssert(!this->cleanup_commit_id(), "Chunk has been cleaned up already");
+  _cleanup_commit_id = cleanup_commit_id;
+}
+
+PartitionID Chunk::partition_id() const { return _partition_id; }
+
+void Chunk::set_partition_id(const PartitionID partition_id) { _partition_id = partition_id; }
+
+const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const { return _ordered_by; }
+
+void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) { _ordered_by = ordered_by; }
+
 }  // namespace opossum
@@ -11,17 +11,19 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "index/segment_index_type.hpp"
 
 #include "all_type_variant.hpp"
 #include "chunk_access_counter.hpp"
+#include "concurrency/epoch_manager.hpp"
 #include "mvcc_data.hpp"
 #include "table_column_definition.hpp"
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
-#include "utils/scoped_locking_ptr.hpp"
 
 namespace opossum {
 
@@ -70,6 +72,26 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Used by Insert to reserve up to row_count rows at the end of the chunk without locking, so that concurrent inserts
+   * into the same table can fill their rows in parallel. Rows are not reserved beyond max_size.
+   * @return The offset of the first reserved row and the number of reserved rows, which is 0 if the chunk is full
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(const ChunkOffset row_count, const ChunkOffset max_size);
+
+  /**
+   * Calls add_rows_functor to add the reserved rows [begin_offset, end_offset) to the MVCC data and the segments. As
+   * the vectors of the segments cannot grow at different positions concurrently, the rows are added in the order in
+   * which they were reserved, which is cheap compared to filling them.
+   */
+  template <typename AddRowsFunctor>
+  void add_reserved_rows(const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                         const AddRowsFunctor& add_rows_functor) {
+    while (_added_row_count.load() != begin_offset) std::this_thread::yield();
+    add_rows_functor();
+    _added_row_count.store(end_offset);
+  }
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -88,19 +110,27 @@ class Chunk : private Noncopyable {
   bool has_access_counter() const;
 
   /**
-   * The locking pointer locks the MVCC data non-exclusively
-   * and unlocks them on destruction
+   * The returned pointer keeps the MVCC data from being freed while it exists, see shrink_mvcc_data(). Unlike a shared
+   * lock, it does not write to memory that other readers of the chunk use (see EpochManager).
    *
    * For improved performance, it is best to call this function
    * once and retain the reference as long as needed.
    *
-   * @return a locking ptr to the MVCC data
+   * @return a pointer to the MVCC data
    */
-  SharedScopedLockingPtr<MvccData> get_scoped_mvcc_data_lock() const;
+  EpochProtectedPtr<MvccData> get_scoped_mvcc_data_lock() const;
 
   std::shared_ptr<MvccData> mvcc_data() const;
   void set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data);
 
+  /**
+   * Replaces the MVCC data with a shrunk copy once the chunk is immutable. Meanwhile, its rows are locked against
+   * transactions. The copy is allocated using the allocator of the chunk. The old MVCC data is freed once all readers
+   * are done with it.
+   * @return false if a transaction has locked, or is still inserting, a row of the chunk
+   */
+  bool shrink_mvcc_data();
+
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID>& column_ids) const;
@@ -122,6 +152,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
+    std::unique_lock<std::shared_mutex> lock{_indices_mutex};
     _indices.emplace_back(index);
     return index;
   }
@@ -136,6 +167,18 @@ class Chunk : private Noncopyable {
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
+  /**
+   * Creates a replica of the immutable @param chunk, i.e., a copy of its segments using the @param alloc, e.g., in the
+   * memory of another NUMA node (see Table::set_numa_replicated()). The replica accesses the MVCC data of the chunk
+   * instead of a copy, so that transactions see and lock the same rows through both. Segments that are replaced in the
+   * chunk afterwards (e.g., by the ChunkEncoder) are not replaced in the replica. The replica has no indexes.
+   */
+  static std::shared_ptr<Chunk> create_replica(const std::shared_ptr<const Chunk>& chunk,
+                                               const PolymorphicAllocator<Chunk>& alloc);
+
+  // The chunk that this chunk is a replica of, or nullptr
+  const std::shared_ptr<const Chunk>& replicated_chunk() const;
+
   std::shared_ptr<ChunkAccessCounter> access_counter() const { return _access_counter; }
 
   bool references_exactly_one_table() const;
@@ -146,6 +189,30 @@ class Chunk : private Noncopyable {
 
   void set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics);
 
+  /**
+   * The commit id of the transaction that moved the visible rows of this chunk to the end of the table, see
+   * MvccGarbageCollector. Transactions whose snapshot is at or after it do not need to look at the chunk.
+   */
+  std::optional<CommitID> cleanup_commit_id() const;
+
+  void set_cleanup_commit_id(const CommitID cleanup_commit_id);
+
+  // The partition whose rows the chunk holds if its table is partitioned (see PartitionSchema), 0 otherwise
+  PartitionID partition_id() const;
+
+  void set_partition_id(const PartitionID partition_id);
+
+  /**
+   * The column by which the rows of the chunk are sorted, if known. The non-NULL values are ordered as by the Sort
+   * operator with the OrderByMode, NULLs come first for Ascending and Descending and last for the *NullsLast modes.
+   * It is set by the Sort operator for its output, by the ChunkSortTask, and passed on by operators that keep the order
+   * of the rows (e.g., TableScan, Validate). Scans use it to binary-search instead of comparing each value, Sort and
+   * JoinSortMerge to skip sorting, and Aggregate to group consecutive rows without hashing.
+   */
+  const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
+
+  void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -158,10 +225,20 @@ class Chunk : private Noncopyable {
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
+  // Read by get_scoped_mvcc_data_lock() without touching the reference count of _mvcc_data
+  std::atomic<MvccData*> _mvcc_data_pointer{nullptr};
+  std::shared_ptr<const Chunk> _replicated_chunk;
   std::shared_ptr<ChunkAccessCounter> _access_counter;
+  // Indexes are created and removed in the background (see IndexTuner) while queries look them up
+  mutable std::shared_mutex _indices_mutex;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
+  std::atomic<CommitID> _cleanup_commit_id{MvccData::MAX_COMMIT_ID};
+  PartitionID _partition_id{0};
+  std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
+  std::atomic<ChunkOffset> _reserved_row_count{0};
+  std::atomic<ChunkOffset> _added_row_count{0};
 };
 
 }  // namespace opossum
@@ -1,7 +1,30 @@
 #include "chunk_access_counter.hpp"
 
+#include <algorithm>
+#include <vector>
+
+#include "scheduler/topology.hpp"
+
 namespace opossum {
 
+ChunkAccessCounter::ChunkAccessCounter(const PolymorphicAllocator<uint64_t>& alloc)
+    : _history(_capacity, alloc),
+      _node_counters(Topology::get().nodes().size()),
+      _node_history(_capacity * _node_counters.size(), alloc) {}
+
+void ChunkAccessCounter::increment(uint64_t value, NodeID node_id) {
+  _counter.fetch_add(value);
+  // The Topology might have changed since the counter was created
+  if (node_id < _node_counters.size()) _node_counters[node_id].fetch_add(value);
+}
+
+void ChunkAccessCounter::process() {
+  _history.push_back(_counter);
+  for (const auto& node_counter : _node_counters) {
+    _node_history.push_back(node_counter);
+  }
+}
+
 uint64_t ChunkAccessCounter::history_sample(size_t lookback) const {
   if (_history.size() < 2 || lookback == 0) return 0;
   const auto last = _history.back();
@@ -11,4 +34,20 @@ uint64_t ChunkAccessCounter::history_sample(size_t lookback) const {
   return last - prelast;
 }
 
+std::vector<uint64_t> ChunkAccessCounter::node_history_sample(size_t lookback) const {
+  const auto node_count = _node_counters.size();
+  auto samples = std::vector<uint64_t>(node_count);
+
+  const auto snapshot_count = node_count == 0 ? size_t{0} : _node_history.size() / node_count;
+  if (snapshot_count < 2 || lookback == 0) return samples;
+
+  // Like in history_sample(), the snapshot at the index of the lookback is compared with the last one
+  const auto last_begin = (snapshot_count - 1) * node_count;
+  const auto prelast_begin = (snapshot_count - std::min(snapshot_count, lookback)) * node_count;
+  for (auto node_id = size_t{0}; node_id < node_count; ++node_id) {
+    samples[node_id] = _node_history.at(last_begin + node_id) - _node_history.at(prelast_begin + node_id);
+  }
+  return samples;
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <vector>
 
 #include "types.hpp"
 
@@ -16,29 +17,48 @@ namespace opossum {
  * of the current counter values and places them in a history. The history is
  * stored in a ring buffer, so that only a limited number of history items are
  * preserved.
+ *
+ * The access times are also counted per NUMA node of the worker that accessed the
+ * chunk, so that the MigrationPreparationTask can move chunks to the nodes whose
+ * workers scan them. Accesses from threads that are not workers of a scheduler are
+ * only part of the total.
  */
 struct ChunkAccessCounter {
   friend class Chunk;
 
  public:
-  explicit ChunkAccessCounter(const PolymorphicAllocator<uint64_t>& alloc) : _history(_capacity, alloc) {}
+  // Counts the nodes of the Topology
+  explicit ChunkAccessCounter(const PolymorphicAllocator<uint64_t>& alloc);
 
   void increment() { _counter++; }
   void increment(uint64_t value) { _counter.fetch_add(value); }
 
-  // Takes a snapshot of the current counter and adds it to the history
-  void process() { _history.push_back(_counter); }
+  // Attributes the access to the node with the @param node_id, unless it is INVALID_NODE_ID
+  void increment(uint64_t value, NodeID node_id);
+
+  // Takes a snapshot of the current counters and adds it to the history
+  void process();
 
   // Returns the access time of the chunk during the specified number of
   // recent history sample iterations.
   uint64_t history_sample(size_t lookback) const;
 
+  // Returns the access time of the chunk per node during the specified
+  // number of recent history sample iterations.
+  std::vector<uint64_t> node_history_sample(size_t lookback) const;
+
   uint64_t counter() const { return _counter; }
+  uint64_t node_counter(NodeID node_id) const { return _node_counters.at(node_id); }
 
  private:
   const size_t _capacity = 100;
   std::atomic<std::uint64_t> _counter{0};
   pmr_ring_buffer<uint64_t> _history;
+
+  // The snapshots of the node counters are appended to the _node_history one
+  // after another, so that it holds them for _capacity iterations, too
+  std::vector<std::atomic<std::uint64_t>> _node_counters;
+  pmr_ring_buffer<uint64_t> _node_history;
 };
 
 }  // namespace opossum
@@ -0,0 +1,191 @@
+#include "chunk_compression_manager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Segments whose runs of equal values are at least this long on average are run-length encoded
+constexpr auto MIN_AVERAGE_RUN_LENGTH = size_t{4};
+
+// Cold string segments whose strings are at least this long on average are compressed using LZ4
+constexpr auto MIN_LZ4_AVERAGE_STRING_LENGTH = size_t{32};
+
+}  // namespace
+
+namespace opossum {
+
+ChunkCompressionManager::ChunkCompressionManager() {
+  _compression_thread = std::make_unique<PausableLoopThread>(_options.compression_interval,
+                                                             [this](size_t) { compress_completed_chunks(); });
+}
+
+SegmentEncodingSpec ChunkCompressionManager::select_segment_encoding(const BaseSegment& segment,
+                                                                     const DataType data_type,
+                                                                     const ChunkTemperature temperature) {
+  const auto is_hot = temperature == ChunkTemperature::Hot;
+
+  auto segment_encoding_spec = SegmentEncodingSpec{EncodingType::Dictionary};
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment);
+    Assert(value_segment, "Can only select an encoding for ValueSegments");
+
+    const auto& values = value_segment->values();
+    const auto size = values.size();
+    if (size == 0) return;
+
+    // NULLs form runs of their own, and their values are not considered
+    auto run_count = size_t{1};
+    auto distinct_values = std::unordered_set<ColumnDataType>{};
+    auto is_sorted = true;
+    auto previous_value = std::optional<ColumnDataType>{};
+    auto non_null_count = size_t{0};
+    auto total_string_length = size_t{0};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      const auto is_null = value_segment->is_null(chunk_offset);
+      if (!is_null) {
+        ++non_null_count;
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) total_string_length += values[chunk_offset].size();
+        distinct_values.emplace(values[chunk_offset]);
+        if (previous_value && values[chunk_offset] < *previous_value) is_sorted = false;
+        previous_value = values[chunk_offset];
+      }
+
+      if (chunk_offset == 0) continue;
+      const auto previous_is_null = value_segment->is_null(chunk_offset - 1);
+      if (is_null != previous_is_null || (!is_null && values[chunk_offset] != values[chunk_offset - 1])) ++run_count;
+    }
+
+    if (run_count * MIN_AVERAGE_RUN_LENGTH <= size) {
+      segment_encoding_spec = SegmentEncodingSpec{EncodingType::RunLength};
+      return;
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      if (temperature == ChunkTemperature::Cold && non_null_count > 0 &&
+          total_string_length >= MIN_LZ4_AVERAGE_STRING_LENGTH * non_null_count) {
+        segment_encoding_spec = SegmentEncodingSpec{EncodingType::LZ4};
+        return;
+      }
+
+      // The FixedStringDictionary pads all strings to the longest one, which should at most double their size
+      auto max_length = size_t{0};
+      auto total_length = size_t{0};
+      for (const auto& value : distinct_values) {
+        max_length = std::max(max_length, value.size());
+        total_length += value.size();
+      }
+
+      if (total_length > 0 && max_length * distinct_values.size() <= 2 * total_length) {
+        segment_encoding_spec = SegmentEncodingSpec{EncodingType::FixedStringDictionary};
+      } else if (!is_hot) {
+        // Strings of varying length, e.g., URLs, are front-coded. Hot segments are decoded too often for that.
+        segment_encoding_spec = SegmentEncodingSpec{EncodingType::FrontCodedDictionary};
+      }
+    } else if constexpr (std::is_integral_v<ColumnDataType>) {
+      if (!is_hot && is_sorted) {
+        segment_encoding_spec = SegmentEncodingSpec{EncodingType::Delta};
+      } else if (!is_hot && distinct_values.size() * 2 > size) {
+        segment_encoding_spec = SegmentEncodingSpec{EncodingType::FrameOfReference};
+      }
+    }
+  });
+
+  return segment_encoding_spec;
+}
+
+ChunkEncodingSpec ChunkCompressionManager::select_chunk_encoding(const Chunk& chunk,
+                                                                 const std::vector<DataType>& column_data_types,
+                                                                 const Options& options) {
+  const auto temperature = chunk_temperature(chunk, options);
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(chunk.column_count());
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    chunk_encoding_spec.emplace_back(
+        select_segment_encoding(*chunk.get_segment(column_id), column_data_types[column_id], temperature));
+  }
+  return chunk_encoding_spec;
+}
+
+ChunkCompressionManager::ChunkTemperature ChunkCompressionManager::chunk_temperature(const Chunk& chunk,
+                                                                                     const Options& options) {
+  if (!chunk.has_access_counter()) return ChunkTemperature::Warm;
+
+  const auto access_count = chunk.access_counter()->counter();
+  if (access_count >= options.hot_chunk_access_count) return ChunkTemperature::Hot;
+  if (access_count <= options.cold_chunk_access_count) return ChunkTemperature::Cold;
+  return ChunkTemperature::Warm;
+}
+
+size_t ChunkCompressionManager::compress_completed_chunks() {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    if (jobs.size() == _options.max_chunks_per_iteration) break;
+    if (table->type() != TableType::Data) continue;
+
+    const auto column_data_types = table->column_data_types();
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (jobs.size() == _options.max_chunks_per_iteration) break;
+
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk->is_mutable() || !ChunkCompressionTask::chunk_is_completed(chunk, table->max_chunk_size())) continue;
+
+      // Chunks can also be created with encoded segments without being marked as immutable (e.g., by ImportBinary)
+      auto all_segments_are_value_segments = true;
+      for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+        if (!std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id))) {
+          all_segments_are_value_segments = false;
+          break;
+        }
+      }
+      if (!all_segments_are_value_segments) continue;
+
+      const auto chunk_encoding_specs =
+          std::map<ChunkID, ChunkEncodingSpec>{{chunk_id, select_chunk_encoding(*chunk, column_data_types, _options)}};
+      jobs.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, std::vector<ChunkID>{chunk_id},
+                                                               chunk_encoding_specs, SchedulePriority::Low));
+      jobs.back()->schedule();
+    }
+  }
+
+  // Waiting for the tasks keeps the next iteration from picking the same chunks again
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return jobs.size();
+}
+
+const ChunkCompressionManager::Options& ChunkCompressionManager::options() const { return _options; }
+
+void ChunkCompressionManager::set_options(const Options& options) {
+  _options = options;
+  _compression_thread->set_loop_sleep_time(_options.compression_interval);
+}
+
+void ChunkCompressionManager::resume() { _compression_thread->resume(); }
+
+void ChunkCompressionManager::pause() { _compression_thread->pause(); }
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+// The ChunkCompressionManager is a singleton that encodes the chunks of the tables in the StorageManager in the
+// background. Tables that are filled by inserts otherwise keep their chunks as ValueSegments forever.
+//
+// In a loop, it finds the chunks that are still mutable but completed (see ChunkCompressionTask), picks an encoding for
+// each of their segments, and encodes them in ChunkCompressionTasks with a low SchedulePriority, so that queries are
+// served first. Like the NUMAPlacementManager, it is initialized in a paused state and needs to be `resumed` to start
+// its operation.
+class ChunkCompressionManager : public Singleton<ChunkCompressionManager> {
+ public:
+  // How often a chunk is accessed, according to its ChunkAccessCounter. Without an access counter (i.e., without NUMA
+  // support), chunks are considered warm.
+  enum class ChunkTemperature { Hot, Warm, Cold };
+
+  struct Options {
+    // The time interval at which the completed chunks are looked for
+    std::chrono::milliseconds compression_interval = std::chrono::seconds(1);
+
+    // Maximum number of chunks that are encoded per loop iteration, so that a large backlog (e.g., after a bulk
+    // insert) does not occupy all workers at once
+    size_t max_chunks_per_iteration = 32;
+
+    // Chunks whose ChunkAccessCounter is at or above this value are considered hot
+    uint64_t hot_chunk_access_count = 1'000'000'000;
+
+    // Chunks whose ChunkAccessCounter is at or below this value are considered cold
+    uint64_t cold_chunk_access_count = 0;
+  };
+
+  /**
+   * Picks the encoding of a completed ValueSegment from the distribution of its values:
+   *
+   *  - RunLength if the average run of equal values is long, as the runs are both smaller and faster to scan
+   *  - Delta for sorted integer segments (e.g., keys or timestamps) that are not hot, whose deltas are small
+   *  - FrameOfReference for integer segments with mostly distinct values that are not hot, where a dictionary would
+   *    not save space
+   *  - LZ4 for cold segments of long strings (e.g., comments), which are rarely scanned
+   *  - FixedStringDictionary for strings of similar length, which makes the dictionary a single contiguous buffer
+   *  - FrontCodedDictionary for other strings that are not hot, which stores common prefixes of neighboring
+   *    dictionary entries once
+   *  - Dictionary otherwise, and for hot segments, whose scans compare the compressed value ids directly
+   */
+  static SegmentEncodingSpec select_segment_encoding(const BaseSegment& segment, DataType data_type,
+                                                     ChunkTemperature temperature);
+
+  static ChunkTemperature chunk_temperature(const Chunk& chunk, const Options& options);
+
+  // Calls select_segment_encoding for each segment of the chunk
+  static ChunkEncodingSpec select_chunk_encoding(const Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                                 const Options& options);
+
+  /**
+   * Encodes up to max_chunks_per_iteration completed, mutable chunks of the tables in the StorageManager and waits
+   * for them to be encoded. This is what the background thread does in each iteration.
+   * @return The number of chunks that have been encoded
+   */
+  size_t compress_completed_chunks();
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  ChunkCompressionManager(ChunkCompressionManager&&) = delete;
+
+ protected:
+  ChunkCompressionManager();
+
+  friend class Singleton;
+
+  Options _options;
+
+  std::unique_ptr<PausableLoopThread> _compression_thread;
+
+  ChunkCompressionManager& operator=(const ChunkCompressionManager&) = default;
+  ChunkCompressionManager& operator=(ChunkCompressionManager&&) = default;
+};
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
 #include "chunk_encoder.hpp"
 
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "base_value_segment.hpp"
@@ -8,22 +10,72 @@
 #include "table.hpp"
 #include "types.hpp"
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "storage/column_group_segment/column_group.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/encoding_advisor.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<ChunkID> all_chunk_ids(const Table& table) {
+  auto chunk_ids = std::vector<ChunkID>(table.chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+  return chunk_ids;
+}
+
+// Encodes the chunks in parallel, one JobTask each, which encode their segments in parallel, too
+void encode_chunks_in_parallel(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                               const std::function<ChunkEncodingSpec(ChunkID)>& get_chunk_encoding_spec) {
+  const auto column_data_types = table->column_data_types();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_encoding_spec = get_chunk_encoding_spec(chunk_id);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_encoding_spec]() {
+      ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec, table->column_groups());
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+}  // namespace
+
 namespace opossum {
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                                const ChunkEncodingSpec& chunk_encoding_spec) {
+                                const ChunkEncodingSpec& chunk_encoding_spec,
+                                const std::vector<std::vector<ColumnID>>& column_groups) {
   Assert((column_data_types.size() == chunk->column_count()),
          "Number of column types must match the chunk’s column count.");
   Assert((chunk_encoding_spec.size() == chunk->column_count()),
          "Number of column encoding specs must match the chunk’s column count.");
 
-  std::vector<std::shared_ptr<SegmentStatistics>> column_statistics;
+  // The columns of column groups stay ValueSegments until they are grouped below
+  auto is_grouped = std::vector<bool>(chunk->column_count());
+  for (const auto& column_group : column_groups) {
+    for (const auto column_id : column_group) {
+      is_grouped[column_id] = true;
+    }
+  }
+
+  // Each segment is encoded and gets its statistics in a JobTask of its own
+  auto column_statistics = std::vector<std::shared_ptr<SegmentStatistics>>(chunk->column_count());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk->column_count());
   for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
     const auto spec = chunk_encoding_spec[column_id];
 
@@ -33,91 +85,94 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 
     Assert(value_segment != nullptr, "All segments of the chunk need to be of type ValueSegment<T>");
 
-    if (spec.encoding_type == EncodingType::Unencoded) {
-      // No need to encode, but we still want to have statistics for the now immutable value segment
-      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, value_segment));
-    } else {
-      auto encoded_segment = encode_segment(spec.encoding_type, data_type, value_segment, spec.vector_compression_type);
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id, spec, data_type, value_segment]() {
+      if (spec.encoding_type == EncodingType::Unencoded || is_grouped[column_id]) {
+        // No need to encode, but we still want to have statistics for the now immutable value segment
+        column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, value_segment);
+        return;
+      }
+
+      const auto encoded_segment =
+          encode_segment(spec.encoding_type, data_type, value_segment, spec.vector_compression_type);
+
+      // The statistics of dictionary segments are taken from their dictionaries. All other statistics are built from
+      // the values of the ValueSegment, which are cheaper to iterate than those of most encoded segments (e.g., LZ4).
+      const auto statistics_segment = spec.encoding_type == EncodingType::Dictionary
+                                          ? std::shared_ptr<const BaseSegment>{encoded_segment}
+                                          : std::shared_ptr<const BaseSegment>{value_segment};
+      column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, statistics_segment);
       chunk->replace_segment(column_id, encoded_segment);
-      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, encoded_segment));
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& column_group : column_groups) {
+    auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+    segments.reserve(column_group.size());
+    for (const auto column_id : column_group) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+
+    const auto grouped_segments = ColumnGroup::group_segments(segments);
+    for (auto column_index = size_t{0}; column_index < column_group.size(); ++column_index) {
+      chunk->replace_segment(column_group[column_index], grouped_segments[column_index]);
     }
   }
 
   chunk->mark_immutable();
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
 
+  // If transactions still modify the chunk, it keeps its MVCC data as it is
   if (chunk->has_mvcc_data()) {
-    chunk->get_scoped_mvcc_data_lock()->shrink();
+    chunk->shrink_mvcc_data();
   }
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                                const SegmentEncodingSpec& segment_encoding_spec) {
+                                const SegmentEncodingSpec& segment_encoding_spec,
+                                const std::vector<std::vector<ColumnID>>& column_groups) {
   const auto chunk_encoding_spec = ChunkEncodingSpec{chunk->column_count(), segment_encoding_spec};
-  encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+  encode_chunk(chunk, column_data_types, chunk_encoding_spec, column_groups);
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                                  const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs) {
-  const auto column_data_types = table->column_data_types();
-
-  for (auto chunk_id : chunk_ids) {
-    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-
-    auto chunk = table->get_chunk(chunk_id);
-    const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
-
-    encode_chunk(chunk, column_data_types, chunk_encoding_spec);
-  }
+  encode_chunks_in_parallel(table, chunk_ids,
+                            [&](const ChunkID chunk_id) { return chunk_encoding_specs.at(chunk_id); });
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                                  const SegmentEncodingSpec& segment_encoding_spec) {
-  const auto column_data_types = table->column_data_types();
-
-  for (auto chunk_id : chunk_ids) {
-    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-    auto chunk = table->get_chunk(chunk_id);
-
-    encode_chunk(chunk, column_data_types, segment_encoding_spec);
-  }
+  const auto chunk_encoding_spec = ChunkEncodingSpec{table->column_count(), segment_encoding_spec};
+  encode_chunks_in_parallel(table, chunk_ids, [&](const ChunkID) { return chunk_encoding_spec; });
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const std::vector<ChunkEncodingSpec>& chunk_encoding_specs) {
-  const auto column_types = table->column_data_types();
   const auto chunk_count = static_cast<size_t>(table->chunk_count());
   Assert(chunk_encoding_specs.size() == chunk_count, "Number of encoding specs must match table’s chunk count.");
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
-
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
-  }
+  encode_chunks_in_parallel(table, all_chunk_ids(*table),
+                            [&](const ChunkID chunk_id) { return chunk_encoding_specs[chunk_id]; });
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const ChunkEncodingSpec& chunk_encoding_spec) {
   Assert(chunk_encoding_spec.size() == table->column_count(),
          "Number of encoding specs must match table’s column count.");
-  const auto column_types = table->column_data_types();
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
-  }
+  encode_chunks_in_parallel(table, all_chunk_ids(*table), [&](const ChunkID) { return chunk_encoding_spec; });
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const SegmentEncodingSpec& segment_encoding_spec) {
-  const auto column_types = table->column_data_types();
-
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
+  const auto chunk_encoding_spec = ChunkEncodingSpec{table->column_count(), segment_encoding_spec};
+  encode_chunks_in_parallel(table, all_chunk_ids(*table), [&](const ChunkID) { return chunk_encoding_spec; });
+}
 
-    encode_chunk(chunk, column_types, segment_encoding_spec);
-  }
+void ChunkEncoder::encode_all_chunks_automatically(const std::shared_ptr<Table>& table) {
+  encode_all_chunks(table, EncodingAdvisor::advise(*table));
 }
 
 }  // namespace opossum
@@ -34,6 +34,11 @@ using ChunkEncodingSpec = std::vector<SegmentEncodingSpec>;
  *
  * The methods provided are not thread-safe and might lead to race conditions
  * if there are other operations manipulating the chunks at the same time.
+ *
+ * The methods that encode the chunks of a table apply its column groups.
+ *
+ * The segments of a chunk are encoded in parallel, and so are the chunks of a table, each in a JobTask of their own.
+ * The statistics of a segment (see ChunkStatistics) are built by the same task that encodes it.
  */
 class ChunkEncoder {
  public:
@@ -48,15 +53,20 @@ class ChunkEncoder {
    * Note: In some cases, it might be beneficial to
    *       leave certain segments of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
+   *
+   * The columns of @param column_groups (see Table::column_groups()) are stored
+   * as a ColumnGroup each, regardless of their encoding specs.
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                           const ChunkEncodingSpec& chunk_encoding_spec);
+                           const ChunkEncodingSpec& chunk_encoding_spec,
+                           const std::vector<std::vector<ColumnID>>& column_groups = {});
 
   /**
    * @brief Encodes a chunk using the same segment-encoding spec
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
-                           const SegmentEncodingSpec& segment_encoding_spec = {});
+                           const SegmentEncodingSpec& segment_encoding_spec = {},
+                           const std::vector<std::vector<ColumnID>>& column_groups = {});
 
   /**
    * @brief Encodes the specified chunks of the passed table
@@ -92,6 +102,13 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Encodes an entire table using the encodings picked by the EncodingAdvisor
+   *
+   * The encoding is picked per segment and is the same for each chunk.
+   */
+  static void encode_all_chunks_automatically(const std::shared_ptr<Table>& table);
 };
 
 }  // namespace opossum
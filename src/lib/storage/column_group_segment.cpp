@@ -0,0 +1,87 @@
+#include "column_group_segment.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "column_group_segment/column_group.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+ColumnGroupSegment<T>::ColumnGroupSegment(const std::shared_ptr<const ColumnGroup>& column_group,
+                                          const size_t column_index)
+    : BaseEncodedSegment(data_type_from_type<T>()), _column_group{column_group}, _column_index{column_index} {
+  DebugAssert(column_index < column_group->columns().size(), "Column index out of range");
+  DebugAssert(column_group->columns()[column_index].data_type == data_type_from_type<T>(),
+              "Data type does not match the column of the ColumnGroup");
+}
+
+template <typename T>
+std::shared_ptr<const ColumnGroup> ColumnGroupSegment<T>::column_group() const {
+  return _column_group;
+}
+
+template <typename T>
+size_t ColumnGroupSegment<T>::column_index() const {
+  return _column_index;
+}
+
+template <typename T>
+const AllTypeVariant ColumnGroupSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+const std::optional<T> ColumnGroupSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  const auto& column = _column_group->columns()[_column_index];
+  const auto* const row = _column_group->row(chunk_offset);
+  if (ColumnGroup::is_null(row, column)) {
+    return std::nullopt;
+  }
+  return ColumnGroup::value<T>(row, column);
+}
+
+template <typename T>
+size_t ColumnGroupSegment<T>::size() const {
+  return _column_group->size();
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> ColumnGroupSegment<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  const auto segments = std::vector<const BaseSegment*>{this};
+  const auto new_column_group = std::allocate_shared<ColumnGroup>(alloc, segments, PolymorphicAllocator<char>{alloc});
+  return std::allocate_shared<ColumnGroupSegment<T>>(alloc, new_column_group, size_t{0});
+}
+
+template <typename T>
+size_t ColumnGroupSegment<T>::estimate_memory_usage() const {
+  const auto& column = _column_group->columns()[_column_index];
+  const auto value_width = sizeof(T) + (column.null_offset ? size_t{1} : size_t{0});
+  return sizeof(*this) + _column_group->size() * value_width;
+}
+
+template <typename T>
+EncodingType ColumnGroupSegment<T>::encoding_type() const {
+  return EncodingType::ColumnGroup;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> ColumnGroupSegment<T>::compressed_vector_type() const {
+  return std::nullopt;
+}
+
+template class ColumnGroupSegment<int32_t>;
+template class ColumnGroupSegment<int64_t>;
+template class ColumnGroupSegment<float>;
+template class ColumnGroupSegment<double>;
+
+}  // namespace opossum
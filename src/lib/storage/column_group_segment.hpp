@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+
+#include "base_encoded_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ColumnGroup;
+
+/**
+ * @brief Segment that exposes a single column of a ColumnGroup
+ *
+ * The ColumnGroup stores the values of several fixed-width columns of a chunk interleaved by row and is shared by the
+ * ColumnGroupSegments of all of these columns (see ColumnGroup::group_segments()). The ChunkEncoder creates them for
+ * the column groups that are declared for a table (see Table::set_column_groups()). A single segment that is encoded
+ * as a ColumnGroup becomes a group of one column.
+ */
+template <typename T>
+class ColumnGroupSegment : public BaseEncodedSegment {
+ public:
+  explicit ColumnGroupSegment(const std::shared_ptr<const ColumnGroup>& column_group, const size_t column_index);
+
+  std::shared_ptr<const ColumnGroup> column_group() const;
+
+  // The position of this segment's column in the ColumnGroup
+  size_t column_index() const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  // Copies only the column of this segment, as a ColumnGroup of its own
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  // Estimates the share of the ColumnGroup that is taken by this segment's column
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ protected:
+  const std::shared_ptr<const ColumnGroup> _column_group;
+  const size_t _column_index;
+};
+
+}  // namespace opossum
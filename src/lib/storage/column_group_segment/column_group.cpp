@@ -0,0 +1,113 @@
+#include "column_group.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/column_group_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename ColumnDataType>
+constexpr auto is_fixed_width(const hana::basic_type<ColumnDataType> type) {
+  return encoding_supports_data_type(enum_c<EncodingType, EncodingType::ColumnGroup>, type);
+}
+
+}  // namespace
+
+ColumnGroup::ColumnGroup(const std::vector<const BaseSegment*>& segments, const PolymorphicAllocator<char>& alloc)
+    : _row_width{0}, _size{segments.empty() ? size_t{0} : segments.front()->size()}, _data{alloc} {
+  Assert(!segments.empty(), "A column group needs at least one column");
+
+  // The values are followed by the bytes that mark NULLs, which only columns with NULLs get
+  auto column_has_nulls = std::vector<bool>(segments.size());
+  _columns.reserve(segments.size());
+  for (auto column_index = size_t{0}; column_index < segments.size(); ++column_index) {
+    const auto& segment = *segments[column_index];
+    Assert(segment.size() == _size, "All segments of a column group need to have the same size");
+
+    resolve_data_type(segment.data_type(), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (hana::value(is_fixed_width(type))) {
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          if (position.is_null()) column_has_nulls[column_index] = true;
+        });
+
+        _columns.emplace_back(Column{segment.data_type(), _row_width, std::nullopt});
+        _row_width += sizeof(ColumnDataType);
+      } else {
+        Fail("Column groups only support columns of fixed width");
+      }
+    });
+  }
+
+  for (auto column_index = size_t{0}; column_index < _columns.size(); ++column_index) {
+    if (!column_has_nulls[column_index]) continue;
+    _columns[column_index].null_offset = _row_width;
+    ++_row_width;
+  }
+
+  _data.resize(_size * _row_width);
+
+  for (auto column_index = size_t{0}; column_index < _columns.size(); ++column_index) {
+    const auto& column = _columns[column_index];
+
+    resolve_data_type(column.data_type, [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (hana::value(is_fixed_width(type))) {
+        segment_iterate<ColumnDataType>(*segments[column_index], [&](const auto& position) {
+          auto* const row = _data.data() + position.chunk_offset() * _row_width;
+          if (position.is_null()) {
+            row[*column.null_offset] = 1;
+          } else {
+            const ColumnDataType value = position.value();
+            std::memcpy(row + column.value_offset, &value, sizeof(ColumnDataType));
+          }
+        });
+      }
+    });
+  }
+}
+
+std::vector<std::shared_ptr<BaseEncodedSegment>> ColumnGroup::group_segments(
+    const std::vector<std::shared_ptr<const BaseSegment>>& segments) {
+  auto raw_segments = std::vector<const BaseSegment*>{};
+  raw_segments.reserve(segments.size());
+  for (const auto& segment : segments) {
+    raw_segments.emplace_back(segment.get());
+  }
+
+  const auto column_group = std::make_shared<const ColumnGroup>(raw_segments);
+
+  auto grouped_segments = std::vector<std::shared_ptr<BaseEncodedSegment>>{};
+  grouped_segments.reserve(segments.size());
+  for (auto column_index = size_t{0}; column_index < segments.size(); ++column_index) {
+    resolve_data_type(segments[column_index]->data_type(), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (hana::value(is_fixed_width(type))) {
+        grouped_segments.emplace_back(std::make_shared<ColumnGroupSegment<ColumnDataType>>(column_group, column_index));
+      }
+    });
+  }
+
+  return grouped_segments;
+}
+
+const std::vector<ColumnGroup::Column>& ColumnGroup::columns() const { return _columns; }
+
+size_t ColumnGroup::row_width() const { return _row_width; }
+
+size_t ColumnGroup::size() const { return _size; }
+
+size_t ColumnGroup::data_size() const { return _data.size(); }
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseEncodedSegment;
+class BaseSegment;
+
+/**
+ * ColumnGroup stores the values of several fixed-width columns of a chunk row by row (i.e., in a hybrid or PAX
+ * layout): Each row takes row_width() bytes, which hold the value of each column at a fixed offset, followed by one
+ * byte per column that contains NULLs. Accessing several columns of a row, as OLTP lookups do, thus touches a single
+ * cache line instead of one per column. Each column is exposed as a ColumnGroupSegment, so that operators, iterables,
+ * and segment accessors do not need to know about the layout.
+ *
+ * The values are packed without padding and are read with memcpy.
+ */
+class ColumnGroup {
+ public:
+  struct Column {
+    DataType data_type;
+    size_t value_offset;
+    // The offset of the byte that marks NULLs, or std::nullopt if the column does not contain NULLs
+    std::optional<size_t> null_offset;
+  };
+
+  // Interleaves the values of @param segments, which need to have the same size and data types of fixed width
+  explicit ColumnGroup(const std::vector<const BaseSegment*>& segments, const PolymorphicAllocator<char>& alloc = {});
+
+  // Creates a ColumnGroupSegment for each of @param segments, all of which share a single ColumnGroup
+  static std::vector<std::shared_ptr<BaseEncodedSegment>> group_segments(
+      const std::vector<std::shared_ptr<const BaseSegment>>& segments);
+
+  const std::vector<Column>& columns() const;
+
+  size_t row_width() const;
+
+  // The number of rows
+  size_t size() const;
+
+  // The number of bytes of the interleaved rows
+  size_t data_size() const;
+
+  const char* row(const ChunkOffset chunk_offset) const { return _data.data() + chunk_offset * _row_width; }
+
+  static bool is_null(const char* row, const Column& column) {
+    return column.null_offset && row[*column.null_offset] != 0;
+  }
+
+  template <typename T>
+  static T value(const char* row, const Column& column) {
+    auto value = T{};
+    std::memcpy(&value, row + column.value_offset, sizeof(T));
+    return value;
+  }
+
+ private:
+  std::vector<Column> _columns;
+  size_t _row_width;
+  size_t _size;
+  pmr_vector<char> _data;
+};
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/column_group_segment.hpp"
+#include "storage/column_group_segment/column_group.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes a single segment as a ColumnGroup of one column. The ChunkEncoder groups several columns of a chunk using
+ * ColumnGroup::group_segments() instead.
+ */
+class ColumnGroupEncoder : public SegmentEncoder<ColumnGroupEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::ColumnGroup>;
+  static constexpr auto _uses_vector_compression = false;
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+
+    const auto segments = std::vector<const BaseSegment*>{value_segment.get()};
+    const auto column_group = std::allocate_shared<ColumnGroup>(alloc, segments, PolymorphicAllocator<char>{alloc});
+    return std::allocate_shared<ColumnGroupSegment<T>>(alloc, column_group, size_t{0});
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/column_group_segment.hpp"
+#include "storage/column_group_segment/column_group.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ColumnGroupSegmentIterable : public PointAccessibleSegmentIterable<ColumnGroupSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit ColumnGroupSegmentIterable(const ColumnGroupSegment<T>& segment)
+      : _column_group{*segment.column_group()}, _column{_column_group.columns()[segment.column_index()]} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    auto begin = Iterator{_column_group.row(ChunkOffset{0}), _column_group.row_width(), &_column, ChunkOffset{0}};
+    auto end = Iterator{nullptr, 0u, &_column, static_cast<ChunkOffset>(_column_group.size())};
+
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    auto begin = PointAccessIterator{&_column_group, &_column, position_filter->cbegin(), position_filter->cbegin()};
+    auto end = PointAccessIterator{&_column_group, &_column, position_filter->cbegin(), position_filter->cend()};
+
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _column_group.size(); }
+
+ private:
+  const ColumnGroup& _column_group;
+  const ColumnGroup::Column& _column;
+
+ private:
+  // Steps from row to row of the ColumnGroup, reading the value of a single column each
+  class Iterator : public BaseSegmentIterator<Iterator, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ColumnGroupSegmentIterable<T>;
+
+   public:
+    explicit Iterator(const char* row, const size_t row_width, const ColumnGroup::Column* column,
+                      ChunkOffset chunk_offset)
+        : _row{row}, _row_width{row_width}, _column{column}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      _row += _row_width;
+      ++_chunk_offset;
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    SegmentPosition<T> dereference() const {
+      if (ColumnGroup::is_null(_row, *_column)) return SegmentPosition<T>{T{}, true, _chunk_offset};
+
+      return SegmentPosition<T>{ColumnGroup::value<T>(_row, *_column), false, _chunk_offset};
+    }
+
+   private:
+    const char* _row;
+    size_t _row_width;
+    const ColumnGroup::Column* _column;
+    ChunkOffset _chunk_offset;
+  };
+
+  class PointAccessIterator : public BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ColumnGroupSegmentIterable<T>;
+
+    PointAccessIterator(const ColumnGroup* column_group, const ColumnGroup::Column* column,
+                        const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>>{std::move(position_filter_begin),
+                                                                                  std::move(position_filter_it)},
+          _column_group{column_group},
+          _column{column} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto* const row = _column_group->row(chunk_offsets.offset_in_referenced_chunk);
+
+      if (ColumnGroup::is_null(row, *_column)) return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+
+      return SegmentPosition<T>{ColumnGroup::value<T>(row, *_column), false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const ColumnGroup* _column_group;
+    const ColumnGroup::Column* _column;
+  };
+};
+
+}  // namespace opossum
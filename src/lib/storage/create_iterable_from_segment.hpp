@@ -1,9 +1,13 @@
 #pragma once
 
+#include "storage/column_group_segment/column_group_segment_iterable.hpp"
+#include "storage/delta_segment/delta_iterable.hpp"
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference/frame_of_reference_iterable.hpp"
+#include "storage/lz4_segment/lz4_iterable.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/segment_iteration_specialization.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
 
 namespace opossum {
@@ -22,12 +26,14 @@ class ReferenceSegmentIterable;
  * (i.e. the CRTP pattern, see segment_iterables/.hpp).
  *
  * In debug mode, create_iterable_from_segment returns a type erased
- * iterable, i.e., all iterators have the same type
+ * iterable, i.e., all iterators have the same type. In release mode,
+ * it does so for the segment types that are not in the specialization
+ * table (see segment_iteration_specialization.hpp).
  *
  * @{
  */
 
-template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, ValueSegment<T>>>
 auto create_iterable_from_segment(const ValueSegment<T>& segment) {
   if constexpr (EraseSegmentType) {
     return create_any_segment_iterable<T>(segment);
@@ -36,7 +42,7 @@ auto create_iterable_from_segment(const ValueSegment<T>& segment) {
   }
 }
 
-template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, DictionarySegment<T>>>
 auto create_iterable_from_segment(const DictionarySegment<T>& segment) {
   if constexpr (EraseSegmentType) {
     return create_any_segment_iterable<T>(segment);
@@ -45,7 +51,7 @@ auto create_iterable_from_segment(const DictionarySegment<T>& segment) {
   }
 }
 
-template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, RunLengthSegment<T>>>
 auto create_iterable_from_segment(const RunLengthSegment<T>& segment) {
   if constexpr (EraseSegmentType) {
     return create_any_segment_iterable<T>(segment);
@@ -54,7 +60,7 @@ auto create_iterable_from_segment(const RunLengthSegment<T>& segment) {
   }
 }
 
-template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, FixedStringDictionarySegment<T>>>
 auto create_iterable_from_segment(const FixedStringDictionarySegment<T>& segment) {
   if constexpr (EraseSegmentType) {
     return create_any_segment_iterable<T>(segment);
@@ -63,7 +69,16 @@ auto create_iterable_from_segment(const FixedStringDictionarySegment<T>& segment
   }
 }
 
-template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, FrontCodedDictionarySegment<T>>>
+auto create_iterable_from_segment(const FrontCodedDictionarySegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return DictionarySegmentIterable<T, FrontCodedStringVector>{segment};
+  }
+}
+
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, FrameOfReferenceSegment<T>>>
 auto create_iterable_from_segment(const FrameOfReferenceSegment<T>& segment) {
   if constexpr (EraseSegmentType) {
     return create_any_segment_iterable<T>(segment);
@@ -72,6 +87,33 @@ auto create_iterable_from_segment(const FrameOfReferenceSegment<T>& segment) {
   }
 }
 
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, DeltaSegment<T>>>
+auto create_iterable_from_segment(const DeltaSegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return DeltaIterable<T>{segment};
+  }
+}
+
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, LZ4Segment<T>>>
+auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return LZ4Iterable<T>{segment};
+  }
+}
+
+template <typename T, bool EraseSegmentType = erase_segment_iteration_type_v<T, ColumnGroupSegment<T>>>
+auto create_iterable_from_segment(const ColumnGroupSegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return ColumnGroupSegmentIterable<T>{segment};
+  }
+}
+
 /**
  * This function must be forward-declared because ReferenceSegmentIterable
  * includes this file leading to a circular dependency
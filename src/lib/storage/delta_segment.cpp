@@ -0,0 +1,102 @@
+#include "delta_segment.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+DeltaSegment<T, U>::DeltaSegment(pmr_vector<T> block_first_values, pmr_vector<T> block_minimum_deltas,
+                                 pmr_vector<bool> null_values,
+                                 std::unique_ptr<const BaseCompressedVector> offset_values)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _block_first_values{std::move(block_first_values)},
+      _block_minimum_deltas{std::move(block_minimum_deltas)},
+      _null_values{std::move(null_values)},
+      _offset_values{std::move(offset_values)},
+      _decompressor{_offset_values->create_base_decompressor()} {}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaSegment<T, U>::block_first_values() const {
+  return _block_first_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaSegment<T, U>::block_minimum_deltas() const {
+  return _block_minimum_deltas;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& DeltaSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& DeltaSegment<T, U>::offset_values() const {
+  return *_offset_values;
+}
+
+template <typename T, typename U>
+const AllTypeVariant DeltaSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> DeltaSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  // Start decoding at the beginning of the block
+  const auto block_begin = static_cast<ChunkOffset>(chunk_offset / block_size * block_size);
+  return decode_value(*_decompressor, chunk_offset, block_begin, _block_first_values[chunk_offset / block_size]);
+}
+
+template <typename T, typename U>
+size_t DeltaSegment<T, U>::size() const {
+  return _offset_values->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> DeltaSegment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_first_values = pmr_vector<T>{_block_first_values, alloc};
+  auto new_block_minimum_deltas = pmr_vector<T>{_block_minimum_deltas, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+
+  return std::allocate_shared<DeltaSegment>(alloc, std::move(new_block_first_values),
+                                            std::move(new_block_minimum_deltas), std::move(new_null_values),
+                                            std::move(new_offset_values));
+}
+
+template <typename T, typename U>
+size_t DeltaSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(T) * (_block_first_values.size() + _block_minimum_deltas.size()) +
+         _offset_values->data_size() + _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType DeltaSegment<T, U>::encoding_type() const {
+  return EncodingType::Delta;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> DeltaSegment<T, U>::compressed_vector_type() const {
+  return _offset_values->type();
+}
+
+template class DeltaSegment<int32_t>;
+template class DeltaSegment<int64_t>;
+
+}  // namespace opossum
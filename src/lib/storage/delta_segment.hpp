@@ -0,0 +1,121 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <memory>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing delta encoding
+ *
+ * Delta encoding stores the difference of each value to its predecessor,
+ * which is small for sorted or clustered columns such as keys or
+ * timestamps, even if the values themselves are large. The segment is
+ * divided into fixed-size blocks. Each block stores its first value and
+ * the minimum of its deltas, and the deltas are encoded as an offset from
+ * this minimum. Thus, a sequence with a constant step results in offsets
+ * of zero. The offsets are then compressed using vector compression
+ * (null suppression).
+ *
+ * The first values of the blocks serve as an index for point access:
+ * a value is decoded from the first value of its block, so that at most
+ * block_size - 1 offsets have to be added up.
+ *
+ * Delta computations wrap around (i.e., are done on the unsigned type),
+ * so that they are well-defined for all values. NULLs repeat the value
+ * of their predecessor in order to keep the deltas small.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::Delta>,
+                                                                              hana::type_c<T>)>>
+class DeltaSegment : public BaseEncodedSegment {
+ public:
+  /**
+   * Smaller blocks speed up point access but need more space for the
+   * first values and minimum deltas. With 128 values per block, these
+   * add at most one bit per value for 64-bit integers. The size also
+   * matches the block size of SIMD-BP128.
+   */
+  static constexpr auto block_size = 128u;
+
+  explicit DeltaSegment(pmr_vector<T> block_first_values, pmr_vector<T> block_minimum_deltas,
+                        pmr_vector<bool> null_values, std::unique_ptr<const BaseCompressedVector> offset_values);
+
+  const pmr_vector<T>& block_first_values() const;
+  const pmr_vector<T>& block_minimum_deltas() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& offset_values() const;
+
+  // Returns the value that follows `previous_value` within a block
+  static T next_value(const T previous_value, const T minimum_delta, const uint32_t offset) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<UnsignedT>(previous_value) + static_cast<UnsignedT>(minimum_delta) +
+                          static_cast<UnsignedT>(offset));
+  }
+
+  /**
+   * Decodes the value at `chunk_offset`. If the value at `decoded_chunk_offset` in the same block is already known
+   * (e.g., because it was accessed before), decoding continues from there instead of from the start of the block.
+   */
+  template <typename OffsetValueDecompressorT>
+  T decode_value(OffsetValueDecompressorT& decompressor, const ChunkOffset chunk_offset,
+                 ChunkOffset decoded_chunk_offset, T decoded_value) const {
+    const auto block_index = chunk_offset / block_size;
+    if (decoded_chunk_offset > chunk_offset || decoded_chunk_offset / block_size != block_index) {
+      decoded_chunk_offset = block_index * block_size;
+      decoded_value = _block_first_values[block_index];
+    }
+
+    const auto minimum_delta = _block_minimum_deltas[block_index];
+    for (auto offset = decoded_chunk_offset + 1; offset <= chunk_offset; ++offset) {
+      decoded_value = next_value(decoded_value, minimum_delta, decompressor.get(offset));
+    }
+    return decoded_value;
+  }
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<T> _block_first_values;
+  const pmr_vector<T> _block_minimum_deltas;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DeltaEncoder : public SegmentEncoder<DeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Delta>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    const auto alloc = value_segment->values().get_allocator();
+
+    static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+    const auto size = value_segment->size();
+
+    // Ceiling of integer division
+    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+    const auto num_blocks = div_ceil(size, block_size);
+
+    // hold the first value and the minimum delta of each block
+    auto block_first_values = pmr_vector<T>{alloc};
+    block_first_values.reserve(num_blocks);
+    auto block_minimum_deltas = pmr_vector<T>{alloc};
+    block_minimum_deltas.reserve(num_blocks);
+
+    // holds the uncompressed offset values
+    auto offset_values = pmr_vector<uint32_t>{alloc};
+    offset_values.reserve(size);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0u};
+
+    // holds the values of all positions, where NULLs repeat their predecessor
+    auto values = pmr_vector<T>{alloc};
+    values.reserve(size);
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      // Leading NULLs take the first non-NULL value, so that the first delta is not unnecessarily large
+      auto previous_value = T{0};
+      for (auto it = segment_it; it != segment_end; ++it) {
+        const auto segment_value = *it;
+        if (!segment_value.is_null()) {
+          previous_value = segment_value.value();
+          break;
+        }
+      }
+
+      for (; segment_it != segment_end; ++segment_it) {
+        const auto segment_value = *segment_it;
+        if (!segment_value.is_null()) previous_value = segment_value.value();
+
+        values.push_back(previous_value);
+        null_values.push_back(segment_value.is_null());
+      }
+    });
+
+    const auto delta = [&](const size_t index) {
+      return static_cast<T>(static_cast<UnsignedT>(values[index]) - static_cast<UnsignedT>(values[index - 1]));
+    };
+
+    for (auto block_begin = size_t{0u}; block_begin < size; block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, size);
+
+      auto minimum_delta = std::numeric_limits<T>::max();
+      auto maximum_delta = std::numeric_limits<T>::min();
+      for (auto index = block_begin + 1; index < block_end; ++index) {
+        minimum_delta = std::min(minimum_delta, delta(index));
+        maximum_delta = std::max(maximum_delta, delta(index));
+      }
+
+      // A block of a single value has no deltas
+      if (block_end - block_begin == 1u) {
+        minimum_delta = T{0};
+        maximum_delta = T{0};
+      }
+
+      // Make sure that the largest offset fits into uint32_t (required for vector compression.) For 32-bit integers,
+      // this is always the case.
+      Assert(static_cast<UnsignedT>(static_cast<UnsignedT>(maximum_delta) - static_cast<UnsignedT>(minimum_delta)) <=
+                 std::numeric_limits<uint32_t>::max(),
+             "Range of deltas in block must fit into uint32_t.");
+
+      block_first_values.push_back(values[block_begin]);
+      block_minimum_deltas.push_back(minimum_delta);
+
+      // The first value of the block is not stored as an offset, but its position is kept for direct indexing
+      offset_values.push_back(0u);
+      for (auto index = block_begin + 1; index < block_end; ++index) {
+        const auto offset =
+            static_cast<uint32_t>(static_cast<UnsignedT>(delta(index)) - static_cast<UnsignedT>(minimum_delta));
+        offset_values.push_back(offset);
+        max_offset = std::max(max_offset, offset);
+      }
+    }
+
+    auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), alloc, {max_offset});
+
+    return std::allocate_shared<DeltaSegment<T>>(alloc, std::move(block_first_values), std::move(block_minimum_deltas),
+                                                 std::move(null_values), std::move(compressed_offset_values));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DeltaIterable : public PointAccessibleSegmentIterable<DeltaIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit DeltaIterable(const DeltaSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueIteratorT = decltype(offset_values.cbegin());
+
+      auto begin = Iterator<OffsetValueIteratorT>{_segment.block_first_values().cbegin(),
+                                                  _segment.block_minimum_deltas().cbegin(), offset_values.cbegin(),
+                                                  _segment.null_values().cbegin(), _segment.size()};
+
+      auto end = Iterator<OffsetValueIteratorT>{offset_values.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using OffsetValueDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto begin = PointAccessIterator<OffsetValueDecompressorT>{&_segment, decompressor.get(),
+                                                                 position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetValueDecompressorT>{position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const DeltaSegment<T>& _segment;
+
+ private:
+  template <typename OffsetValueIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<OffsetValueIteratorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaIterable<T>;
+    using BlockValueIterator = typename pmr_vector<T>::const_iterator;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(BlockValueIterator block_first_value_it, BlockValueIterator block_minimum_delta_it,
+                      OffsetValueIteratorT offset_value_it, NullValueIterator null_value_it, size_t size)
+        : _block_first_value_it{block_first_value_it},
+          _block_minimum_delta_it{block_minimum_delta_it},
+          _offset_value_it{offset_value_it},
+          _null_value_it{null_value_it},
+          _size{size},
+          _index_within_block{0u},
+          _chunk_offset{0u},
+          _value{size > 0u ? *block_first_value_it : T{}} {}
+
+    // End iterator
+    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, {}, offset_value_it, {}, 0u} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_offset_value_it;
+      ++_null_value_it;
+      ++_index_within_block;
+      ++_chunk_offset;
+
+      // The block iterators must not be dereferenced beyond the last block
+      if (_chunk_offset >= _size) return;
+
+      if (_index_within_block >= DeltaSegment<T>::block_size) {
+        _index_within_block = 0u;
+        ++_block_first_value_it;
+        ++_block_minimum_delta_it;
+        _value = *_block_first_value_it;
+      } else {
+        _value = DeltaSegment<T>::next_value(_value, *_block_minimum_delta_it, *_offset_value_it);
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _offset_value_it == other._offset_value_it; }
+
+    SegmentPosition<T> dereference() const { return SegmentPosition<T>{_value, *_null_value_it, _chunk_offset}; }
+
+   private:
+    BlockValueIterator _block_first_value_it;
+    BlockValueIterator _block_minimum_delta_it;
+    OffsetValueIteratorT _offset_value_it;
+    NullValueIterator _null_value_it;
+    size_t _size;
+    size_t _index_within_block;
+    ChunkOffset _chunk_offset;
+    T _value;
+  };
+
+  /**
+   * Position filters are often sorted, so the last decoded value is kept. If the next position lies behind it in the
+   * same block, decoding continues from there instead of from the first value of the block.
+   */
+  template <typename OffsetValueDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaIterable<T>;
+
+    // Begin Iterator
+    PointAccessIterator(const DeltaSegment<T>* segment, OffsetValueDecompressorT* offset_value_decompressor,
+                        const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT>,
+                                         SegmentPosition<T>>{std::move(position_filter_begin),
+                                                             std::move(position_filter_it)},
+          _segment{segment},
+          _offset_value_decompressor{offset_value_decompressor},
+          _decoded_chunk_offset{INVALID_CHUNK_OFFSET},
+          _decoded_value{} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, nullptr, std::move(position_filter_begin), std::move(position_filter_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      const auto is_null = _segment->null_values()[chunk_offsets.offset_in_referenced_chunk];
+      _decoded_value = _segment->decode_value(*_offset_value_decompressor, chunk_offsets.offset_in_referenced_chunk,
+                                              _decoded_chunk_offset, _decoded_value);
+      _decoded_chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      return SegmentPosition<T>{_decoded_value, is_null, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const DeltaSegment<T>* _segment;
+    OffsetValueDecompressorT* _offset_value_decompressor;
+    mutable ChunkOffset _decoded_chunk_offset;
+    mutable T _decoded_value;
+  };
+};
+
+}  // namespace opossum
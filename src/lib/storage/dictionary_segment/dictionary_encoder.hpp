@@ -8,6 +8,7 @@
 
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
@@ -41,7 +42,7 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
           FixedStringVector{values.cbegin(), values.cend(), _calculate_fixed_string_length(values), values.size()},
           value_segment);
     } else {
-      // Encode a segment with a pmr_vector<T> as dictionary
+      // Encode a segment with a pmr_vector<T> as dictionary, which a FrontCodedDictionary front-codes afterwards
       return _encode_dictionary_segment(pmr_vector<T>{values.cbegin(), values.cend(), values.get_allocator()},
                                         value_segment);
     }
@@ -117,13 +118,19 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
 
     auto encoded_attribute_vector = compress_vector(
         attribute_vector, SegmentEncoder<DictionaryEncoder<Encoding>>::vector_compression_type(), alloc, {max_value});
-    auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
     auto attribute_vector_sptr = std::shared_ptr<const BaseCompressedVector>(std::move(encoded_attribute_vector));
 
     if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<FixedStringDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                                    ValueID{null_value_id});
+    } else if constexpr (Encoding == EncodingType::FrontCodedDictionary) {
+      // The dictionary, now sorted and free of duplicates, is front-coded once all value ids are known
+      auto dictionary_sptr = std::allocate_shared<FrontCodedStringVector>(alloc, dictionary, alloc);
+      return std::allocate_shared<FrontCodedDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
+                                                                  ValueID{null_value_id});
     } else {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<DictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                         ValueID{null_value_id});
     }
@@ -0,0 +1,182 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of consecutive rows that are sampled at a time
+constexpr auto SAMPLE_RUN_LENGTH = size_t{64};
+
+// The scan duration of a candidate is the fastest of this many runs of the micro-benchmark
+constexpr auto SCAN_RUNS = size_t{3};
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> sample_column(const Table& table, const ColumnID column_id,
+                                               const size_t sample_size) {
+  const auto row_count = static_cast<size_t>(table.row_count());
+  const auto nullable = table.column_is_nullable(column_id);
+
+  // The first row of each chunk, to find the chunk of a sampled row
+  auto chunk_begins = std::vector<size_t>{};
+  auto accessors = std::vector<std::unique_ptr<BaseSegmentAccessor<T>>>{};
+  auto chunk_begin = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    chunk_begins.emplace_back(chunk_begin);
+    accessors.emplace_back(create_segment_accessor<T>(chunk->get_segment(column_id)));
+    chunk_begin += chunk->size();
+  }
+
+  auto values = std::vector<T>{};
+  auto null_values = std::vector<bool>{};
+  values.reserve(std::min(sample_size, row_count));
+  null_values.reserve(std::min(sample_size, row_count));
+
+  // Small columns are taken as a whole
+  const auto sample_all_rows = sample_size >= row_count;
+  const auto sample_runs = sample_all_rows ? size_t{1} : (sample_size + SAMPLE_RUN_LENGTH - 1) / SAMPLE_RUN_LENGTH;
+  const auto sample_run_length = sample_all_rows ? row_count : SAMPLE_RUN_LENGTH;
+
+  for (auto sample_run = size_t{0}; sample_run < sample_runs; ++sample_run) {
+    const auto run_begin = sample_run * row_count / sample_runs;
+    const auto run_end = std::min(run_begin + sample_run_length, row_count);
+
+    for (auto row = run_begin; row < run_end; ++row) {
+      const auto chunk_id = std::upper_bound(chunk_begins.begin(), chunk_begins.end(), row) - chunk_begins.begin() - 1;
+      const auto typed_value = accessors[chunk_id]->access(static_cast<ChunkOffset>(row - chunk_begins[chunk_id]));
+      values.emplace_back(typed_value ? *typed_value : T{});
+      null_values.emplace_back(!typed_value);
+    }
+  }
+
+  if (nullable) return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+// Compares all values of the segment to the search value, as a TableScan would
+template <typename T>
+size_t scan_segment(const BaseSegment& segment, const T& search_value) {
+  auto match_count = size_t{0};
+  segment_with_iterators<T>(segment, [&](auto iter, const auto end) {
+    for (; iter != end; ++iter) {
+      const auto& position = *iter;
+      match_count += !position.is_null() && position.value() == search_value;
+    }
+  });
+  return match_count;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ChunkEncodingSpec EncodingAdvisor::advise(const Table& table, const Options& options) {
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(table.column_count());
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    chunk_encoding_spec.emplace_back(advise_column(table, column_id, options));
+  }
+  return chunk_encoding_spec;
+}
+
+SegmentEncodingSpec EncodingAdvisor::advise_column(const Table& table, const ColumnID column_id,
+                                                   const Options& options) {
+  if (table.row_count() == 0) return SegmentEncodingSpec{};
+  return select_candidate(evaluate_candidates(table, column_id, options), options.max_scan_duration_factor);
+}
+
+std::vector<EncodingAdvisor::Candidate> EncodingAdvisor::evaluate_candidates(const Table& table,
+                                                                             const ColumnID column_id,
+                                                                             const Options& options) {
+  const auto data_type = table.column_data_type(column_id);
+  auto candidates = std::vector<Candidate>{};
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto sample = sample_column<ColumnDataType>(table, column_id, options.sample_size);
+    if (sample->size() == 0) return;
+
+    const auto search_value = sample->values()[sample->size() / 2];
+    [[maybe_unused]] const auto expected_match_count = scan_segment(*sample, search_value);
+
+    const auto evaluate_candidate = [&](const SegmentEncodingSpec& encoding_spec) {
+      auto segment = std::shared_ptr<const BaseSegment>{sample};
+      if (encoding_spec.encoding_type != EncodingType::Unencoded) {
+        segment = encode_segment(encoding_spec.encoding_type, data_type, sample, encoding_spec.vector_compression_type);
+      }
+
+      auto scan_duration = std::chrono::nanoseconds::max();
+      for (auto run = size_t{0}; run < SCAN_RUNS; ++run) {
+        auto timer = Timer{};
+        [[maybe_unused]] const auto match_count = scan_segment(*segment, search_value);
+        scan_duration = std::min(scan_duration, timer.lap());
+        DebugAssert(match_count == expected_match_count, "Encoded sample returned different scan results");
+      }
+
+      candidates.emplace_back(Candidate{encoding_spec, segment->estimate_memory_usage(), scan_duration});
+    };
+
+    for (const auto encoding_type : encoding_type_enum_values) {
+      if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+
+      // A column group of a single column does not compress it. Column groups are declared per table instead.
+      if (encoding_type == EncodingType::ColumnGroup) continue;
+
+      if (encoding_type == EncodingType::Unencoded || !create_encoder(encoding_type)->uses_vector_compression()) {
+        evaluate_candidate(SegmentEncodingSpec{encoding_type});
+        continue;
+      }
+
+      for (const auto vector_compression_type :
+           {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128}) {
+        evaluate_candidate(SegmentEncodingSpec{encoding_type, vector_compression_type});
+      }
+    }
+  });
+
+  return candidates;
+}
+
+SegmentEncodingSpec EncodingAdvisor::select_candidate(const std::vector<Candidate>& candidates,
+                                                      const double max_scan_duration_factor) {
+  Assert(!candidates.empty(), "Expected at least one candidate");
+  Assert(max_scan_duration_factor >= 1.0, "The scan duration factor has to be at least 1.0");
+
+  const auto fastest_scan_duration =
+      std::min_element(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.scan_duration < rhs.scan_duration;
+      })->scan_duration;
+  const auto max_scan_duration = fastest_scan_duration.count() * max_scan_duration_factor;
+
+  const Candidate* selected_candidate = nullptr;
+  for (const auto& candidate : candidates) {
+    if (static_cast<double>(candidate.scan_duration.count()) > max_scan_duration) continue;
+
+    if (!selected_candidate || candidate.memory_usage < selected_candidate->memory_usage ||
+        (candidate.memory_usage == selected_candidate->memory_usage &&
+         candidate.scan_duration < selected_candidate->scan_duration)) {
+      selected_candidate = &candidate;
+    }
+  }
+
+  return selected_candidate->encoding_spec;
+}
+
+}  // namespace opossum
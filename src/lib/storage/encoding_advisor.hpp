@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Picks the encoding of each column of a table
+ *
+ * Rows are sampled from all chunks of a column into a ValueSegment, which is then encoded with each combination of
+ * EncodingType and VectorCompressionType that supports the column's data type. For each of these candidates, the
+ * memory usage is taken from estimate_memory_usage() and the scan cost is measured by a micro-benchmark that compares
+ * all values of the encoded sample to a search value.
+ *
+ * Of the candidates whose scans are at most `max_scan_duration_factor` times slower than the fastest one, the smallest
+ * is chosen. The sample consists of short runs of consecutive rows, so that run-length encoding is not ruled out by
+ * sampling single rows.
+ */
+class EncodingAdvisor {
+ public:
+  struct Options {
+    Options() : sample_size(100'000), max_scan_duration_factor(2.0) {}
+
+    // Number of rows that are sampled from each column
+    size_t sample_size;
+
+    // Trades memory usage for scan cost. A factor of 1.0 always picks the fastest candidate.
+    double max_scan_duration_factor;
+  };
+
+  struct Candidate {
+    SegmentEncodingSpec encoding_spec;
+    size_t memory_usage;
+    std::chrono::nanoseconds scan_duration;
+  };
+
+  // Returns one SegmentEncodingSpec per column, to be used for all chunks of the table
+  static ChunkEncodingSpec advise(const Table& table, const Options& options = Options{});
+
+  static SegmentEncodingSpec advise_column(const Table& table, const ColumnID column_id,
+                                           const Options& options = Options{});
+
+  // Encodes a sample of the column with each supported encoding and measures its memory usage and scan duration
+  static std::vector<Candidate> evaluate_candidates(const Table& table, const ColumnID column_id,
+                                                    const Options& options = Options{});
+
+  static SegmentEncodingSpec select_candidate(const std::vector<Candidate>& candidates,
+                                              const double max_scan_duration_factor);
+};
+
+}  // namespace opossum
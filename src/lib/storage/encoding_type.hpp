@@ -17,11 +17,22 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference };
+enum class EncodingType : uint8_t {
+  Unencoded,
+  Dictionary,
+  RunLength,
+  FixedStringDictionary,
+  FrameOfReference,
+  Delta,
+  LZ4,
+  FrontCodedDictionary,
+  ColumnGroup
+};
 
 inline static std::vector<EncodingType> encoding_type_enum_values{
     EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FixedStringDictionary,
-    EncodingType::FrameOfReference};
+    EncodingType::FrameOfReference, EncodingType::Delta, EncodingType::LZ4, EncodingType::FrontCodedDictionary,
+    EncodingType::ColumnGroup};
 
 /**
  * @brief Maps each encoding type to its supported data types
@@ -36,7 +47,11 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::Dictionary>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<std::string>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Delta>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, hana::tuple_t<std::string>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrontCodedDictionary>, hana::tuple_t<std::string>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::ColumnGroup>, hana::tuple_t<int32_t, int64_t, float, double>));
 
 /**
  * @return an integral constant implicitly convertible to bool
@@ -0,0 +1,130 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+FrontCodedStringVector::FrontCodedStringVector(const pmr_vector<std::string>& strings,
+                                               const PolymorphicAllocator<char>& allocator)
+    : _size(strings.size()), _chars(allocator), _block_offsets(allocator) {
+  _block_offsets.reserve((_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+  for (auto pos = size_t{0}; pos < _size; ++pos) {
+    const auto& string = strings[pos];
+
+    if (pos % BLOCK_SIZE == 0) {
+      _block_offsets.emplace_back(_chars.size());
+      _write_length(_chars, string.size());
+      _chars.insert(_chars.end(), string.begin(), string.end());
+      continue;
+    }
+
+    const auto& previous_string = strings[pos - 1];
+    DebugAssert(previous_string < string, "Strings have to be sorted and free of duplicates");
+    const auto max_prefix_length = std::min(previous_string.size(), string.size());
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(string.begin(), string.begin() + max_prefix_length, previous_string.begin()).first -
+        string.begin());
+
+    _write_length(_chars, prefix_length);
+    _write_length(_chars, string.size() - prefix_length);
+    _chars.insert(_chars.end(), string.begin() + prefix_length, string.end());
+  }
+
+  _chars.shrink_to_fit();
+}
+
+FrontCodedStringVector::FrontCodedStringVector(const FrontCodedStringVector& other,
+                                               const PolymorphicAllocator<char>& allocator)
+    : _size(other._size),
+      _chars(other._chars, allocator),
+      _block_offsets(other._block_offsets, allocator) {}
+
+std::string FrontCodedStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < _size, "Position out of bounds");
+
+  auto string = std::string{};
+  auto remaining_strings = pos % BLOCK_SIZE;
+  _decode_block(pos / BLOCK_SIZE, string, [&](const std::string&) { return remaining_strings-- > 0; });
+  return string;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string_view& value) const {
+  return _partition_point([&](const std::string_view& string) { return string < value; });
+}
+
+size_t FrontCodedStringVector::upper_bound(const std::string_view& value) const {
+  return _partition_point([&](const std::string_view& string) { return string <= value; });
+}
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+size_t FrontCodedStringVector::data_size() const {
+  return sizeof(*this) + _chars.size() + _block_offsets.size() * sizeof(size_t);
+}
+
+std::shared_ptr<const pmr_vector<std::string>> FrontCodedStringVector::dictionary() const {
+  auto strings = pmr_vector<std::string>{};
+  strings.reserve(_size);
+  for_each([&](const std::string& string) { strings.emplace_back(string); });
+  return std::make_shared<pmr_vector<std::string>>(std::move(strings));
+}
+
+std::string_view FrontCodedStringVector::_first_string_of_block(const size_t block_idx) const {
+  const auto* position = _chars.data() + _block_offsets[block_idx];
+  const auto length = _read_length(position);
+  return {position, length};
+}
+
+template <typename IsBefore>
+size_t FrontCodedStringVector::_partition_point(const IsBefore& is_before) const {
+  // The number of blocks that begin with a string before the partition point. The point is thus either in the last of
+  // them (after its first string) or at the beginning of the next one.
+  auto low = size_t{0};
+  auto high = _block_offsets.size();
+  while (low < high) {
+    const auto block_idx = (low + high) / 2;
+    if (is_before(_first_string_of_block(block_idx))) {
+      low = block_idx + 1;
+    } else {
+      high = block_idx;
+    }
+  }
+  if (low == 0) return 0;
+
+  const auto block_idx = low - 1;
+  auto pos = block_idx * BLOCK_SIZE;
+  auto string = std::string{};
+  _decode_block(block_idx, string, [&](const std::string& decoded_string) {
+    if (!is_before(decoded_string)) return false;
+    ++pos;
+    return true;
+  });
+  return pos;
+}
+
+void FrontCodedStringVector::_write_length(pmr_vector<char>& chars, size_t length) {
+  while (length >= 0x80) {
+    chars.emplace_back(static_cast<char>(0x80 | (length & 0x7F)));
+    length >>= 7;
+  }
+  chars.emplace_back(static_cast<char>(length));
+}
+
+size_t FrontCodedStringVector::_read_length(const char*& position) {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return length;
+    shift += 7;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * FrontCodedStringVector stores a sorted set of distinct strings with front coding: The strings are grouped into
+ * blocks of BLOCK_SIZE. The first string of a block is stored as a whole, each of the following ones as the length of
+ * the prefix that it shares with its predecessor and the remaining suffix. All lengths are variable-length integers of
+ * seven bits per byte.
+ *
+ * The block directory holds the offset of each block. A string is thus decoded from the beginning of its block, and
+ * lower_bound() and upper_bound() binary search the first strings of the blocks, which need not be decoded, before
+ * they decode a single block. For strings with long common prefixes, e.g., URLs, this takes a fraction of the memory
+ * of a FixedStringVector, which pads all strings to the longest one.
+ */
+class FrontCodedStringVector {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  // @param strings has to be sorted and free of duplicates
+  FrontCodedStringVector(const pmr_vector<std::string>& strings, const PolymorphicAllocator<char>& allocator);
+
+  FrontCodedStringVector(const FrontCodedStringVector& other, const PolymorphicAllocator<char>& allocator);
+
+  std::string get_string_at(const size_t pos) const;
+
+  // Return the position of the first string that is not less than (lower_bound) or greater than (upper_bound)
+  // @param value, or size() if there is none
+  size_t lower_bound(const std::string_view& value) const;
+  size_t upper_bound(const std::string_view& value) const;
+
+  // Call @param functor with each string in order. Faster than get_string_at() for each position, as every string is
+  // decoded from its predecessor only once.
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    auto string = std::string{};
+    for (auto block_idx = size_t{0}; block_idx < _block_offsets.size(); ++block_idx) {
+      _decode_block(block_idx, string, [&](const std::string& decoded_string) {
+        functor(decoded_string);
+        return true;
+      });
+    }
+  }
+
+  // Return the number of strings
+  size_t size() const;
+
+  // Return the calculated size of FrontCodedStringVector in main memory
+  size_t data_size() const;
+
+  // Return the strings decoded into a vector
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+ protected:
+  // Decode the strings of the block @param block_idx one after the other into @param string, calling @param functor
+  // with each of them until it returns false
+  template <typename Functor>
+  void _decode_block(const size_t block_idx, std::string& string, const Functor& functor) const {
+    const auto* position = _chars.data() + _block_offsets[block_idx];
+    const auto block_end = std::min((block_idx + 1) * BLOCK_SIZE, _size);
+
+    for (auto pos = block_idx * BLOCK_SIZE; pos < block_end; ++pos) {
+      const auto prefix_length = pos % BLOCK_SIZE == 0 ? size_t{0} : _read_length(position);
+      const auto suffix_length = _read_length(position);
+      string.resize(prefix_length);
+      string.append(position, suffix_length);
+      position += suffix_length;
+
+      if (!functor(string)) return;
+    }
+  }
+
+  std::string_view _first_string_of_block(const size_t block_idx) const;
+
+  // Return the position of the first string for which @param is_before returns false. The strings have to be
+  // partitioned by it, i.e., it returns true for a prefix of them.
+  template <typename IsBefore>
+  size_t _partition_point(const IsBefore& is_before) const;
+
+  static void _write_length(pmr_vector<char>& chars, size_t length);
+  static size_t _read_length(const char*& position);
+
+  const size_t _size;
+  pmr_vector<char> _chars;
+  pmr_vector<size_t> _block_offsets;
+};
+
+}  // namespace opossum
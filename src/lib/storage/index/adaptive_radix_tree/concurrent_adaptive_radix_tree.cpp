@@ -0,0 +1,215 @@
+#include "concurrent_adaptive_radix_tree.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "concurrent_adaptive_radix_tree_nodes.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ConcurrentAdaptiveRadixTree::ConcurrentAdaptiveRadixTree() : _root(std::make_unique<ConcurrentARTNode256>()) {}
+
+ConcurrentAdaptiveRadixTree::~ConcurrentAdaptiveRadixTree() { _free_children(*_root); }
+
+void ConcurrentAdaptiveRadixTree::_free_children(const ConcurrentARTNode& node) {
+  // The replaced nodes share their children with the nodes that replaced them, so only the live ones free them
+  node.for_each_child([](const auto, const auto child) {
+    if (ConcurrentARTNode::is_leaf(child)) {
+      delete ConcurrentARTNode::as_leaf(child);
+    } else {
+      const auto* child_node = ConcurrentARTNode::as_node(child);
+      _free_children(*child_node);
+      delete child_node;
+    }
+  });
+}
+
+void ConcurrentAdaptiveRadixTree::insert(const Key& key, const RowID& row_id) {
+  DebugAssert(!key.empty(), "Keys must not be empty");
+  while (!_try_insert(key, row_id)) {
+  }
+}
+
+bool ConcurrentAdaptiveRadixTree::_try_insert(const Key& key, const RowID& row_id) {
+  auto* node = _root.get();
+  auto version = node->read_lock();
+  if (!version) return false;
+
+  auto* parent = static_cast<ConcurrentARTNode*>(nullptr);
+  auto parent_version = uint64_t{0};
+  auto parent_partial_key = uint8_t{0};
+
+  for (auto depth = size_t{0};; ++depth) {
+    DebugAssert(depth < key.size(), "No key may be a prefix of another one");
+    const auto partial_key = key[depth];
+    const auto child = node->find_child(partial_key);
+    if (!node->validate(*version)) return false;
+
+    if (!child) {
+      if (node->is_full()) {
+        // The node is replaced by a larger one, which the parent has to point to
+        DebugAssert(parent, "The root never grows");
+        if (!parent->upgrade_to_write_lock(parent_version)) return false;
+        if (!node->upgrade_to_write_lock(*version)) {
+          parent->write_unlock();
+          return false;
+        }
+
+        auto* leaf = new ConcurrentARTLeaf{key};
+        leaf->row_ids.emplace_back(row_id);
+        auto larger_node = node->grow();
+        larger_node->add_child(partial_key, ConcurrentARTNode::to_child(leaf));
+        parent->replace_child(parent_partial_key, ConcurrentARTNode::to_child(larger_node.release()));
+
+        node->write_unlock_obsolete();
+        parent->write_unlock();
+
+        std::lock_guard<std::mutex> lock{_replaced_nodes_mutex};
+        _replaced_nodes.emplace_back(node);
+        return true;
+      }
+
+      if (!node->upgrade_to_write_lock(*version)) return false;
+      auto* leaf = new ConcurrentARTLeaf{key};
+      leaf->row_ids.emplace_back(row_id);
+      node->add_child(partial_key, ConcurrentARTNode::to_child(leaf));
+      node->write_unlock();
+      return true;
+    }
+
+    if (ConcurrentARTNode::is_leaf(child)) {
+      auto* leaf = ConcurrentARTNode::as_leaf(child);
+
+      // Leaves are never moved or freed, so the row can be added even if the node changes meanwhile
+      if (leaf->key == key) {
+        std::lock_guard<std::mutex> lock{leaf->mutex};
+        leaf->row_ids.emplace_back(row_id);
+        return true;
+      }
+
+      if (!node->upgrade_to_write_lock(*version)) return false;
+      node->replace_child(partial_key, ConcurrentARTNode::to_child(_expand_leaf(leaf, key, row_id, depth + 1)));
+      node->write_unlock();
+      return true;
+    }
+
+    parent = node;
+    parent_version = *version;
+    parent_partial_key = partial_key;
+
+    node = ConcurrentARTNode::as_node(child);
+    version = node->read_lock();
+    if (!version || !parent->validate(parent_version)) return false;
+  }
+}
+
+ConcurrentARTNode* ConcurrentAdaptiveRadixTree::_expand_leaf(ConcurrentARTLeaf* leaf, const Key& key,
+                                                             const RowID& row_id, size_t depth) {
+  // The new nodes are not visible to other threads before the caller links them, so they need no locking
+  auto* first_node = new ConcurrentARTNode4{};
+  auto* node = first_node;
+  for (; leaf->key[depth] == key[depth]; ++depth) {
+    DebugAssert(depth + 1 < key.size() && depth + 1 < leaf->key.size(), "No key may be a prefix of another one");
+    auto* next_node = new ConcurrentARTNode4{};
+    node->add_child(key[depth], ConcurrentARTNode::to_child(next_node));
+    node = next_node;
+  }
+
+  auto* new_leaf = new ConcurrentARTLeaf{key};
+  new_leaf->row_ids.emplace_back(row_id);
+  node->add_child(leaf->key[depth], ConcurrentARTNode::to_child(leaf));
+  node->add_child(key[depth], ConcurrentARTNode::to_child(new_leaf));
+  return first_node;
+}
+
+PosList ConcurrentAdaptiveRadixTree::lookup(const std::optional<KeyBound>& lower_bound,
+                                            const std::optional<KeyBound>& upper_bound) const {
+  auto matches = PosList{};
+
+  const auto is_in_bounds = [&](const Key& key) {
+    if (lower_bound && (lower_bound->is_inclusive ? key < lower_bound->key : key <= lower_bound->key)) return false;
+    if (upper_bound && (upper_bound->is_inclusive ? key > upper_bound->key : key >= upper_bound->key)) return false;
+    return true;
+  };
+
+  const auto visit_leaf = [&](ConcurrentARTLeaf& leaf) {
+    if (!is_in_bounds(leaf.key)) return;
+    std::lock_guard<std::mutex> lock{leaf.mutex};
+    matches.insert(matches.end(), leaf.row_ids.begin(), leaf.row_ids.end());
+  };
+
+  while (!_try_visit_leaves(*_root, 0, lower_bound, upper_bound, lower_bound.has_value(), upper_bound.has_value(),
+                            visit_leaf)) {
+    matches.clear();
+  }
+
+  return matches;
+}
+
+size_t ConcurrentAdaptiveRadixTree::remove_chunk(const ChunkID chunk_id) {
+  auto removed_row_count = size_t{0};
+
+  // Removing the rows again after a restart does not change anything
+  const auto visit_leaf = [&](ConcurrentARTLeaf& leaf) {
+    std::lock_guard<std::mutex> lock{leaf.mutex};
+    const auto removed_begin = std::remove_if(leaf.row_ids.begin(), leaf.row_ids.end(),
+                                              [&](const auto& row_id) { return row_id.chunk_id == chunk_id; });
+    removed_row_count += std::distance(removed_begin, leaf.row_ids.end());
+    leaf.row_ids.erase(removed_begin, leaf.row_ids.end());
+  };
+
+  while (!_try_visit_leaves(*_root, 0, std::nullopt, std::nullopt, false, false, visit_leaf)) {
+  }
+
+  return removed_row_count;
+}
+
+bool ConcurrentAdaptiveRadixTree::_try_visit_leaves(const ConcurrentARTNode& node, const size_t depth,
+                                                    const std::optional<KeyBound>& lower_bound,
+                                                    const std::optional<KeyBound>& upper_bound,
+                                                    const bool is_on_lower_bound_path,
+                                                    const bool is_on_upper_bound_path,
+                                                    const std::function<void(ConcurrentARTLeaf&)>& visit_leaf) const {
+  const auto version = node.read_lock();
+  if (!version) return false;
+
+  auto children = std::vector<std::pair<uint8_t, ConcurrentARTChild>>{};
+  children.reserve(node.size());
+  node.for_each_child([&](const auto partial_key, const auto child) { children.emplace_back(partial_key, child); });
+  if (!node.validate(*version)) return false;
+
+  // The path to this node equals the prefix of a bound as long as is_on_*_bound_path is set. Keys below it are longer
+  // than the bound and thus greater.
+  if (is_on_upper_bound_path && depth >= upper_bound->key.size()) return true;
+
+  for (const auto& [partial_key, child] : children) {
+    auto is_child_on_lower_bound_path = false;
+    if (is_on_lower_bound_path && depth < lower_bound->key.size()) {
+      if (partial_key < lower_bound->key[depth]) continue;
+      is_child_on_lower_bound_path = partial_key == lower_bound->key[depth];
+    }
+
+    auto is_child_on_upper_bound_path = false;
+    if (is_on_upper_bound_path) {
+      if (partial_key > upper_bound->key[depth]) break;
+      is_child_on_upper_bound_path = partial_key == upper_bound->key[depth];
+    }
+
+    if (ConcurrentARTNode::is_leaf(child)) {
+      visit_leaf(*ConcurrentARTNode::as_leaf(child));
+    } else if (!_try_visit_leaves(*ConcurrentARTNode::as_node(child), depth + 1, lower_bound, upper_bound,
+                                  is_child_on_lower_bound_path, is_child_on_upper_bound_path, visit_leaf)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
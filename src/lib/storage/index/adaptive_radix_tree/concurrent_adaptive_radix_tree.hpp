@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ConcurrentARTNode;
+struct ConcurrentARTLeaf;
+
+/**
+ * An Adaptive Radix Tree that maps keys to RowIDs and, unlike the AdaptiveRadixTreeIndex, which is bulk-built from an
+ * immutable DictionarySegment, can be inserted into while it is read. This is what the TableIndex uses, so that the
+ * rows that are inserted into the mutable chunk of a table are indexed right away.
+ *
+ * The inner nodes are synchronized using optimistic lock coupling (see concurrent_adaptive_radix_tree_nodes.hpp):
+ * Lookups do not lock any node and never block inserts, and inserts only lock the node they change (and its parent if
+ * the node has to grow). The rows of a key are kept in a leaf, which is created once and only locked to add or copy
+ * its rows. Leaves are created lazily, i.e., an inner node is only added for a byte that distinguishes two keys.
+ *
+ * The keys are compared bytewise, so they have to be binary comparable (see binary_comparable_key()), and no key may
+ * be a prefix of another one. Nodes that have been replaced by larger ones are only freed together with the tree, as
+ * readers might still be looking at them. As nodes never shrink, this wastes less memory than the live nodes use.
+ */
+class ConcurrentAdaptiveRadixTree : private Noncopyable {
+ public:
+  using Key = std::vector<uint8_t>;
+
+  struct KeyBound {
+    Key key;
+    bool is_inclusive;
+  };
+
+  ConcurrentAdaptiveRadixTree();
+  ~ConcurrentAdaptiveRadixTree();
+
+  void insert(const Key& key, const RowID& row_id);
+
+  // @return The rows whose keys lie within the bounds, ordered by their keys. A missing bound is unbounded.
+  PosList lookup(const std::optional<KeyBound>& lower_bound, const std::optional<KeyBound>& upper_bound) const;
+
+  // Removes the rows of the chunk with the @param chunk_id and @return their number. Empty leaves stay in the tree.
+  size_t remove_chunk(const ChunkID chunk_id);
+
+ private:
+  // Both return false if a node was changed concurrently, in which case the operation is restarted
+  bool _try_insert(const Key& key, const RowID& row_id);
+  bool _try_visit_leaves(const ConcurrentARTNode& node, const size_t depth, const std::optional<KeyBound>& lower_bound,
+                         const std::optional<KeyBound>& upper_bound, const bool is_on_lower_bound_path,
+                         const bool is_on_upper_bound_path,
+                         const std::function<void(ConcurrentARTLeaf&)>& visit_leaf) const;
+
+  // Creates the Node4s for the bytes that the keys of the @param leaf and the new @param key have in common, starting
+  // at @param depth, and @return the first of them
+  ConcurrentARTNode* _expand_leaf(ConcurrentARTLeaf* leaf, const Key& key, const RowID& row_id, size_t depth);
+
+  static void _free_children(const ConcurrentARTNode& node);
+
+  // The root has room for all partial keys, so it never has to be replaced
+  std::unique_ptr<ConcurrentARTNode> _root;
+
+  std::mutex _replaced_nodes_mutex;
+  std::vector<std::unique_ptr<ConcurrentARTNode>> _replaced_nodes;
+};
+
+/**
+ * @return The bytes of the @param value, so that comparing them bytewise (i.e., as unsigned chars) orders them like
+ * the values: The sign bit of integers is flipped, that of positive floating point numbers, too, and all bits of
+ * negative ones invert. Strings are terminated by two zero bytes, and zero bytes within them are escaped as 0x00FF,
+ * so that no string is a prefix of another one.
+ */
+template <typename T>
+ConcurrentAdaptiveRadixTree::Key binary_comparable_key(const T& value) {
+  auto key = ConcurrentAdaptiveRadixTree::Key{};
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    key.reserve(value.size() + 2);
+    for (const auto character : value) {
+      key.emplace_back(static_cast<uint8_t>(character));
+      if (character == '\0') key.emplace_back(uint8_t{0xFF});
+    }
+    key.emplace_back(uint8_t{0});
+    key.emplace_back(uint8_t{0});
+  } else {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported data type");
+    using Bits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+    constexpr auto SIGN_BIT = Bits{1} << (sizeof(T) * 8 - 1);
+
+    auto bits = Bits{};
+    std::memcpy(&bits, &value, sizeof(T));
+    if constexpr (std::is_floating_point_v<T>) {
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    } else {
+      bits ^= SIGN_BIT;
+    }
+
+    // Most significant byte first
+    key.reserve(sizeof(T));
+    for (auto shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+      key.emplace_back(static_cast<uint8_t>(bits >> shift));
+    }
+  }
+
+  return key;
+}
+
+}  // namespace opossum
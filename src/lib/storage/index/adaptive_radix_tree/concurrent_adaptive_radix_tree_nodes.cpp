@@ -0,0 +1,211 @@
+#include "concurrent_adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+constexpr auto OBSOLETE_BIT = uint64_t{0b01};
+constexpr auto LOCKED_BIT = uint64_t{0b10};
+
+constexpr auto LEAF_TAG = opossum::ConcurrentARTChild{1};
+
+// The position in ConcurrentARTNode48::_child_positions of partial keys without a child
+constexpr auto NO_CHILD_POSITION = uint8_t{48};
+
+}  // namespace
+
+namespace opossum {
+
+ConcurrentARTNode::ConcurrentARTNode(const uint16_t capacity) : _capacity(capacity) {}
+
+std::optional<uint64_t> ConcurrentARTNode::read_lock() const {
+  const auto version = _version.load();
+  if (version & (OBSOLETE_BIT | LOCKED_BIT)) return std::nullopt;
+  return version;
+}
+
+bool ConcurrentARTNode::validate(const uint64_t version) const { return _version.load() == version; }
+
+bool ConcurrentARTNode::upgrade_to_write_lock(const uint64_t version) {
+  auto expected_version = version;
+  return _version.compare_exchange_strong(expected_version, version + LOCKED_BIT);
+}
+
+// Adding the locked bit again clears it and increments the counter in the higher bits
+void ConcurrentARTNode::write_unlock() { _version.fetch_add(LOCKED_BIT); }
+
+void ConcurrentARTNode::write_unlock_obsolete() { _version.fetch_add(LOCKED_BIT | OBSOLETE_BIT); }
+
+uint16_t ConcurrentARTNode::size() const { return _size.load(); }
+
+bool ConcurrentARTNode::is_full() const { return size() >= _capacity; }
+
+ConcurrentARTChild ConcurrentARTNode::to_child(const ConcurrentARTNode* node) {
+  return reinterpret_cast<ConcurrentARTChild>(node);
+}
+
+ConcurrentARTChild ConcurrentARTNode::to_child(const ConcurrentARTLeaf* leaf) {
+  return reinterpret_cast<ConcurrentARTChild>(leaf) | LEAF_TAG;
+}
+
+bool ConcurrentARTNode::is_leaf(const ConcurrentARTChild child) { return child & LEAF_TAG; }
+
+ConcurrentARTNode* ConcurrentARTNode::as_node(const ConcurrentARTChild child) {
+  DebugAssert(!is_leaf(child), "Child is a leaf");
+  return reinterpret_cast<ConcurrentARTNode*>(child);
+}
+
+ConcurrentARTLeaf* ConcurrentARTNode::as_leaf(const ConcurrentARTChild child) {
+  DebugAssert(is_leaf(child), "Child is not a leaf");
+  return reinterpret_cast<ConcurrentARTLeaf*>(child & ~LEAF_TAG);
+}
+
+template <uint16_t capacity>
+ConcurrentARTNodeSorted<capacity>::ConcurrentARTNodeSorted() : ConcurrentARTNode(capacity) {
+  for (auto position = size_t{0}; position < capacity; ++position) {
+    _partial_keys[position].store(0);
+    _children[position].store(0);
+  }
+}
+
+template <uint16_t capacity>
+ConcurrentARTChild ConcurrentARTNodeSorted<capacity>::find_child(const uint8_t partial_key) const {
+  // A concurrent writer may change the size, so it is limited to the capacity
+  const auto child_count = std::min(size(), capacity);
+  for (auto position = uint16_t{0}; position < child_count; ++position) {
+    if (_partial_keys[position].load() == partial_key) return _children[position].load();
+  }
+  return 0;
+}
+
+template <uint16_t capacity>
+void ConcurrentARTNodeSorted<capacity>::add_child(const uint8_t partial_key, const ConcurrentARTChild child) {
+  DebugAssert(!is_full(), "Node is full");
+
+  auto position = size();
+  while (position > 0 && _partial_keys[position - 1].load() > partial_key) {
+    _partial_keys[position].store(_partial_keys[position - 1].load());
+    _children[position].store(_children[position - 1].load());
+    --position;
+  }
+  _partial_keys[position].store(partial_key);
+  _children[position].store(child);
+  _size.fetch_add(1);
+}
+
+template <uint16_t capacity>
+void ConcurrentARTNodeSorted<capacity>::replace_child(const uint8_t partial_key, const ConcurrentARTChild child) {
+  for (auto position = uint16_t{0}; position < size(); ++position) {
+    if (_partial_keys[position].load() == partial_key) {
+      _children[position].store(child);
+      return;
+    }
+  }
+  Fail("Partial key not found");
+}
+
+template <uint16_t capacity>
+void ConcurrentARTNodeSorted<capacity>::for_each_child(
+    const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const {
+  const auto child_count = std::min(size(), capacity);
+  for (auto position = uint16_t{0}; position < child_count; ++position) {
+    functor(_partial_keys[position].load(), _children[position].load());
+  }
+}
+
+template <uint16_t capacity>
+std::unique_ptr<ConcurrentARTNode> ConcurrentARTNodeSorted<capacity>::grow() const {
+  auto larger_node = std::unique_ptr<ConcurrentARTNode>{};
+  if constexpr (capacity == 4) {
+    larger_node = std::make_unique<ConcurrentARTNode16>();
+  } else {
+    larger_node = std::make_unique<ConcurrentARTNode48>();
+  }
+  for_each_child([&](const auto partial_key, const auto child) { larger_node->add_child(partial_key, child); });
+  return larger_node;
+}
+
+template class ConcurrentARTNodeSorted<4>;
+template class ConcurrentARTNodeSorted<16>;
+
+ConcurrentARTNode48::ConcurrentARTNode48() : ConcurrentARTNode(48) {
+  for (auto& child_position : _child_positions) {
+    child_position.store(NO_CHILD_POSITION);
+  }
+  for (auto& child : _children) {
+    child.store(0);
+  }
+}
+
+ConcurrentARTChild ConcurrentARTNode48::find_child(const uint8_t partial_key) const {
+  const auto position = _child_positions[partial_key].load();
+  return position == NO_CHILD_POSITION ? 0 : _children[position].load();
+}
+
+void ConcurrentARTNode48::add_child(const uint8_t partial_key, const ConcurrentARTChild child) {
+  DebugAssert(!is_full(), "Node is full");
+
+  const auto position = size();
+  _children[position].store(child);
+  _child_positions[partial_key].store(static_cast<uint8_t>(position));
+  _size.fetch_add(1);
+}
+
+void ConcurrentARTNode48::replace_child(const uint8_t partial_key, const ConcurrentARTChild child) {
+  const auto position = _child_positions[partial_key].load();
+  Assert(position != NO_CHILD_POSITION, "Partial key not found");
+  _children[position].store(child);
+}
+
+void ConcurrentARTNode48::for_each_child(const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const {
+  for (auto partial_key = 0; partial_key < 256; ++partial_key) {
+    const auto position = _child_positions[partial_key].load();
+    if (position != NO_CHILD_POSITION) functor(static_cast<uint8_t>(partial_key), _children[position].load());
+  }
+}
+
+std::unique_ptr<ConcurrentARTNode> ConcurrentARTNode48::grow() const {
+  auto larger_node = std::make_unique<ConcurrentARTNode256>();
+  for_each_child([&](const auto partial_key, const auto child) { larger_node->add_child(partial_key, child); });
+  return larger_node;
+}
+
+ConcurrentARTNode256::ConcurrentARTNode256() : ConcurrentARTNode(256) {
+  for (auto& child : _children) {
+    child.store(0);
+  }
+}
+
+ConcurrentARTChild ConcurrentARTNode256::find_child(const uint8_t partial_key) const {
+  return _children[partial_key].load();
+}
+
+void ConcurrentARTNode256::add_child(const uint8_t partial_key, const ConcurrentARTChild child) {
+  DebugAssert(!_children[partial_key].load(), "Partial key already has a child");
+  _children[partial_key].store(child);
+  _size.fetch_add(1);
+}
+
+void ConcurrentARTNode256::replace_child(const uint8_t partial_key, const ConcurrentARTChild child) {
+  DebugAssert(_children[partial_key].load(), "Partial key not found");
+  _children[partial_key].store(child);
+}
+
+void ConcurrentARTNode256::for_each_child(const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const {
+  for (auto partial_key = 0; partial_key < 256; ++partial_key) {
+    const auto child = _children[partial_key].load();
+    if (child) functor(static_cast<uint8_t>(partial_key), child);
+  }
+}
+
+std::unique_ptr<ConcurrentARTNode> ConcurrentARTNode256::grow() const { Fail("A Node256 cannot grow"); }
+
+ConcurrentARTLeaf::ConcurrentARTLeaf(const std::vector<uint8_t>& init_key) : key(init_key) {}
+
+}  // namespace opossum
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This file declares the nodes of the ConcurrentAdaptiveRadixTree. Like those of the AdaptiveRadixTreeIndex, the inner
+ * nodes hold up to 4, 16, 48 or 256 children. Unlike them, they are filled one insert at a time and are synchronized
+ * using optimistic lock coupling (see "The ART of Practical Synchronization", Leis et al., DaMoN 2016):
+ *
+ * Each inner node has a version, whose lowest bit marks the node as obsolete and whose second bit as locked. Readers
+ * remember the version, read the node without locking it, and restart if the version has changed meanwhile. Writers
+ * lock a node by atomically upgrading the version they read. Hence, all fields that readers look at are atomic.
+ *
+ * A child is either an inner node or a leaf, tagged by the lowest bit of its address.
+ */
+
+struct ConcurrentARTLeaf;
+
+using ConcurrentARTChild = uintptr_t;
+
+class ConcurrentARTNode : private Noncopyable {
+ public:
+  explicit ConcurrentARTNode(const uint16_t capacity);
+  virtual ~ConcurrentARTNode() = default;
+
+  /**
+   * @defgroup Optimistic lock coupling
+   * @{
+   */
+
+  // @return The current version, or std::nullopt if the node is locked or obsolete, in which case the caller restarts
+  std::optional<uint64_t> read_lock() const;
+
+  // @return Whether the node has not been changed since the @param version was read
+  bool validate(const uint64_t version) const;
+
+  // @return Whether the node could be locked, i.e., has not been changed since the @param version was read
+  bool upgrade_to_write_lock(const uint64_t version);
+
+  void write_unlock();
+
+  // Unlocks a node that has been replaced by a larger one, so that the readers looking at it restart
+  void write_unlock_obsolete();
+
+  /** @} */
+
+  // The number of children, which is only reliable after validating the version
+  uint16_t size() const;
+
+  bool is_full() const;
+
+  // @return The child for the @param partial_key, or 0 if there is none
+  virtual ConcurrentARTChild find_child(const uint8_t partial_key) const = 0;
+
+  // Adds a child for a new @param partial_key to the node, which has to be write-locked and not full
+  virtual void add_child(const uint8_t partial_key, const ConcurrentARTChild child) = 0;
+
+  // Replaces the child of the existing @param partial_key, the node has to be write-locked
+  virtual void replace_child(const uint8_t partial_key, const ConcurrentARTChild child) = 0;
+
+  // Calls @param functor with the partial keys and children, ordered by the partial keys
+  virtual void for_each_child(const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const = 0;
+
+  // @return A copy of the node that holds more children, the node has to be write-locked
+  virtual std::unique_ptr<ConcurrentARTNode> grow() const = 0;
+
+  static ConcurrentARTChild to_child(const ConcurrentARTNode* node);
+  static ConcurrentARTChild to_child(const ConcurrentARTLeaf* leaf);
+
+  static bool is_leaf(const ConcurrentARTChild child);
+  static ConcurrentARTNode* as_node(const ConcurrentARTChild child);
+  static ConcurrentARTLeaf* as_leaf(const ConcurrentARTChild child);
+
+ protected:
+  std::atomic<uint64_t> _version{0};
+  std::atomic<uint16_t> _size{0};
+  const uint16_t _capacity;
+};
+
+// Node4 and Node16 keep their partial keys sorted and search them linearly
+template <uint16_t capacity>
+class ConcurrentARTNodeSorted final : public ConcurrentARTNode {
+ public:
+  ConcurrentARTNodeSorted();
+
+  ConcurrentARTChild find_child(const uint8_t partial_key) const override;
+  void add_child(const uint8_t partial_key, const ConcurrentARTChild child) override;
+  void replace_child(const uint8_t partial_key, const ConcurrentARTChild child) override;
+  void for_each_child(const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const override;
+  std::unique_ptr<ConcurrentARTNode> grow() const override;
+
+ private:
+  std::array<std::atomic<uint8_t>, capacity> _partial_keys;
+  std::array<std::atomic<ConcurrentARTChild>, capacity> _children;
+};
+
+using ConcurrentARTNode4 = ConcurrentARTNodeSorted<4>;
+using ConcurrentARTNode16 = ConcurrentARTNodeSorted<16>;
+
+// Node48 maps each partial key to the position of its child, 48 stands for none
+class ConcurrentARTNode48 final : public ConcurrentARTNode {
+ public:
+  ConcurrentARTNode48();
+
+  ConcurrentARTChild find_child(const uint8_t partial_key) const override;
+  void add_child(const uint8_t partial_key, const ConcurrentARTChild child) override;
+  void replace_child(const uint8_t partial_key, const ConcurrentARTChild child) override;
+  void for_each_child(const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const override;
+  std::unique_ptr<ConcurrentARTNode> grow() const override;
+
+ private:
+  std::array<std::atomic<uint8_t>, 256> _child_positions;
+  std::array<std::atomic<ConcurrentARTChild>, 48> _children;
+};
+
+// Node256 has a child slot for each partial key, so it never grows
+class ConcurrentARTNode256 final : public ConcurrentARTNode {
+ public:
+  ConcurrentARTNode256();
+
+  ConcurrentARTChild find_child(const uint8_t partial_key) const override;
+  void add_child(const uint8_t partial_key, const ConcurrentARTChild child) override;
+  void replace_child(const uint8_t partial_key, const ConcurrentARTChild child) override;
+  void for_each_child(const std::function<void(uint8_t, ConcurrentARTChild)>& functor) const override;
+  std::unique_ptr<ConcurrentARTNode> grow() const override;
+
+ private:
+  std::array<std::atomic<ConcurrentARTChild>, 256> _children;
+};
+
+/**
+ * A leaf holds the full key and the rows with this key. Its key never changes, and it is never moved or freed while
+ * the tree exists, so that the rows can be added under a mutex of the leaf without locking the nodes above it.
+ */
+struct ConcurrentARTLeaf : private Noncopyable {
+  explicit ConcurrentARTLeaf(const std::vector<uint8_t>& init_key);
+
+  const std::vector<uint8_t> key;
+
+  std::mutex mutex;
+  std::vector<RowID> row_ids;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "composite_group_key_index.hpp"
 
 #include <algorithm>
+#include <array>
 #include <climits>
 #include <cstdint>
 #include <iterator>
@@ -57,6 +58,94 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr
         return key_length + byte_width_for_fixed_size_byte_aligned_type(*segment->compressed_vector_type());
       });
 
+  if (bytes_per_key <= sizeof(uint64_t)) {
+    _create_from_packed_keys<1>(bytes_per_key);
+  } else if (bytes_per_key <= 2 * sizeof(uint64_t)) {
+    _create_from_packed_keys<2>(bytes_per_key);
+  } else {
+    _create_from_variable_length_keys(bytes_per_key);
+  }
+}
+
+template <size_t WordCount>
+void CompositeGroupKeyIndex::_create_from_packed_keys(const CompositeKeyLength bytes_per_key) {
+  const auto segment_size = _indexed_segments.front()->size();
+
+  // create concatenated keys, the least significant word first, by decoding the value ids of each attribute vector
+  // block by block and appending them to the keys
+  auto keys = std::vector<PackedKey<WordCount>>(segment_size);
+  auto value_ids = std::vector<uint32_t>(PACKED_KEY_BLOCK_SIZE);
+  for (const auto& segment : _indexed_segments) {
+    const auto& attribute_vector = *segment->attribute_vector();
+    const auto bits = static_cast<uint8_t>(
+        byte_width_for_fixed_size_byte_aligned_type(*segment->compressed_vector_type()) * CHAR_BIT);
+
+    for (auto block_begin = size_t{0}; block_begin < segment_size; block_begin += PACKED_KEY_BLOCK_SIZE) {
+      const auto block_size = std::min(PACKED_KEY_BLOCK_SIZE, segment_size - block_begin);
+      attribute_vector.decode_into(block_begin, block_size, value_ids.data());
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        auto& key = keys[block_begin + index];
+        for (auto word = WordCount - 1; word > 0; --word) {
+          key[word] = (key[word] << bits) | (key[word - 1] >> (sizeof(uint64_t) * CHAR_BIT - bits));
+        }
+        key[0] = (key[0] << bits) | value_ids[index];
+      }
+    }
+  }
+
+  _position_list.resize(segment_size);
+  std::iota(_position_list.begin(), _position_list.end(), ChunkOffset{0});
+
+  // sort keys and their positions with an LSD radix sort over the bytes of the keys. As it is stable, the positions of
+  // equal keys remain ordered.
+  auto keys_buffer = std::vector<PackedKey<WordCount>>(segment_size);
+  auto positions_buffer = std::vector<ChunkOffset>(segment_size);
+  for (auto byte = size_t{0}; byte < bytes_per_key; ++byte) {
+    const auto word = byte / sizeof(uint64_t);
+    const auto shift = (byte % sizeof(uint64_t)) * CHAR_BIT;
+    const auto digit = [&](const PackedKey<WordCount>& key) { return (key[word] >> shift) & 0xFFu; };
+
+    auto write_offsets = std::array<size_t, 256>{};
+    for (const auto& key : keys) {
+      ++write_offsets[digit(key)];
+    }
+
+    // skip the bytes that all keys share, e.g., the leading zeros of small value ids
+    if (std::find(write_offsets.cbegin(), write_offsets.cend(), segment_size) != write_offsets.cend()) continue;
+
+    std::exclusive_scan(write_offsets.begin(), write_offsets.end(), write_offsets.begin(), size_t{0});
+    for (auto index = size_t{0}; index < segment_size; ++index) {
+      const auto write_offset = write_offsets[digit(keys[index])]++;
+      keys_buffer[write_offset] = keys[index];
+      positions_buffer[write_offset] = _position_list[index];
+    }
+    std::swap(keys, keys_buffer);
+    std::swap(_position_list, positions_buffer);
+  }
+
+  // create offsets to unique keys and store these in the keystore
+  _key_offsets.reserve(segment_size);
+  for (auto chunk_offset = size_t{0}; chunk_offset < segment_size; ++chunk_offset) {
+    if (chunk_offset == 0 || keys[chunk_offset] != keys[chunk_offset - 1]) {
+      _key_offsets.emplace_back(static_cast<ChunkOffset>(chunk_offset));
+    }
+  }
+  _key_offsets.shrink_to_fit();
+
+  _keys = VariableLengthKeyStore(static_cast<ChunkOffset>(_key_offsets.size()), bytes_per_key);
+  const auto bits_of_most_significant_word =
+      static_cast<uint8_t>((bytes_per_key - (WordCount - 1) * sizeof(uint64_t)) * CHAR_BIT);
+  for (auto key_id = ChunkOffset{0}; key_id < _key_offsets.size(); ++key_id) {
+    const auto& key = keys[_key_offsets[key_id]];
+    auto stored_key = _keys[key_id];
+    stored_key.shift_and_set(key[WordCount - 1], bits_of_most_significant_word);
+    for (auto word = WordCount - 1; word > 0; --word) {
+      stored_key.shift_and_set(key[word - 1], static_cast<uint8_t>(sizeof(uint64_t) * CHAR_BIT));
+    }
+  }
+}
+
+void CompositeGroupKeyIndex::_create_from_variable_length_keys(const CompositeKeyLength bytes_per_key) {
   // create concatenated keys and save their positions
   // at this point duplicated keys may be created, they will be handled later
   auto segment_size = _indexed_segments.front()->size();
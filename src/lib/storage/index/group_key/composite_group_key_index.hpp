@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include <utility>
@@ -38,6 +39,10 @@ class BaseDictionarySegment;
  *    | 7 |  5  |  1  |     |            |         |     7     | ie key '51' can be found at i = 7 in the AV
  *    +---+-----------+     +------------+---------+-----------+
  *
+ * If the concatenated keys are at most 16 bytes wide, they are created as integers in one contiguous buffer and sorted
+ * with a radix sort, so that creating the index does not allocate memory per row. Only wider keys are created as
+ * VariableLengthKeys.
+ *
  * Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/Composite-GroupKey-Index
  */
 class CompositeGroupKeyIndex : public BaseIndex {
@@ -65,6 +70,18 @@ class CompositeGroupKeyIndex : public BaseIndex {
 
   size_t _memory_consumption() const final;
 
+  // A concatenated key of up to WordCount * 8 bytes as an integer, the least significant word first
+  template <size_t WordCount>
+  using PackedKey = std::array<uint64_t, WordCount>;
+
+  // The number of value ids per attribute vector that are decoded at once to create the PackedKeys
+  static constexpr auto PACKED_KEY_BLOCK_SIZE = size_t{2048};
+
+  // Create the keys, offsets and positions from PackedKeys or, for keys wider than 16 bytes, from VariableLengthKeys
+  template <size_t WordCount>
+  void _create_from_packed_keys(const CompositeKeyLength bytes_per_key);
+  void _create_from_variable_length_keys(const CompositeKeyLength bytes_per_key);
+
   /**
    * Creates a VariableLengthKey using the values given as parameters.
    *
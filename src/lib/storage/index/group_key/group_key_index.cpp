@@ -1,16 +1,29 @@
 #include "group_key_index.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/base_dictionary_segment.hpp"
-#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 
 namespace opossum {
 
 size_t GroupKeyIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
                                                   uint32_t value_bytes) {
-  return row_count * sizeof(ChunkOffset) + distinct_count * sizeof(std::size_t);
+  // The width of the compressed index offsets, see FixedSizeByteAlignedCompressor
+  auto offset_bytes = sizeof(uint32_t);
+  if (row_count <= std::numeric_limits<uint8_t>::max()) {
+    offset_bytes = sizeof(uint8_t);
+  } else if (row_count <= std::numeric_limits<uint16_t>::max()) {
+    offset_bytes = sizeof(uint16_t);
+  }
+  return row_count * sizeof(ChunkOffset) + (distinct_count + 1u) * offset_bytes;
 }
 
 GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
@@ -19,42 +32,77 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment
   Assert(static_cast<bool>(_indexed_segments), "GroupKeyIndex only works with dictionary segments_to_index.");
   Assert((segments_to_index.size() == 1), "GroupKeyIndex only works with a single segment.");
 
-  // 1) Initialize the index structures
-  // 1a) Set the index_offset to size of the dictionary + 1 (plus one to mark the ending position)
-  //     and set all offsets to 0
-  _index_offsets = std::vector<size_t>(_indexed_segments->unique_values_count() + 1u, 0u);
-  // 1b) Set the _index_postings to the size of the attribute vector
-  _index_postings = std::vector<ChunkOffset>(_indexed_segments->size());
-
-  // 2) Count the occurrences of value-ids: Iterate once over the attribute vector (i.e. value ids)
-  //    and count the occurrences of each value id at their respective position in the dictionary,
-  //    i.e. the position in the _index_offsets
-  resolve_compressed_vector_type(*_indexed_segments->attribute_vector(), [&](auto& attribute_vector) {
-    for (const auto value_id : attribute_vector) {
-      _index_offsets[value_id + 1u]++;
+  const auto& attribute_vector = *_indexed_segments->attribute_vector();
+  const auto unique_values_count = static_cast<size_t>(_indexed_segments->unique_values_count());
+  const auto null_value_id = _indexed_segments->null_value_id();
+  const auto size = attribute_vector.size();
+  const auto block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+  // Calls the functor with the ChunkOffset and the ValueID of every position of the block, decoding them at once
+  const auto for_each_value_id_in_block = [&](const size_t block_id, auto& value_ids, const auto& functor) {
+    const auto block_begin = block_id * BLOCK_SIZE;
+    const auto block_size = std::min(BLOCK_SIZE, size - block_begin);
+    attribute_vector.decode_into(block_begin, block_size, value_ids.data());
+    for (auto index = size_t{0}; index < block_size; ++index) {
+      functor(static_cast<ChunkOffset>(block_begin + index), static_cast<ValueID>(value_ids[index]));
     }
-  });
-
-  // 3) Create offsets for the postings in _index_offsets
-  std::partial_sum(_index_offsets.begin(), _index_offsets.end(), _index_offsets.begin());
+  };
 
-  // 4) Create the postings
-  // 4a) Copy _index_offsets to use it as a write counter
-  auto index_offset_copy = std::vector<size_t>(_index_offsets);
+  // Runs the functor for every block, in a JobTask each if there is more than one block
+  const auto for_each_block = [&](const auto& functor) {
+    if (block_count == 1) {
+      functor(size_t{0});
+      return;
+    }
 
-  // 4b) Iterate once again over the attribute vector to obtain the write-offsets
-  resolve_compressed_vector_type(*_indexed_segments->attribute_vector(), [&](auto& attribute_vector) {
-    auto value_id_it = attribute_vector.cbegin();
-    auto position = 0u;
-    for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++position) {
-      const auto& value_id = static_cast<ValueID>(*value_id_it);
-      _index_postings[index_offset_copy[value_id]] = position;
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(block_count);
+    for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, block_id]() { functor(block_id); }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  };
+
+  // 1) Count the occurrences of the value ids in each block. NULLs are not counted, as they are not indexed.
+  auto counts_by_block = std::vector<std::vector<ChunkOffset>>(block_count);
+  for_each_block([&](const size_t block_id) {
+    auto& counts = counts_by_block[block_id];
+    counts.resize(unique_values_count);
+
+    auto value_ids = std::vector<uint32_t>(BLOCK_SIZE);
+    for_each_value_id_in_block(block_id, value_ids, [&](const auto /* chunk_offset */, const auto value_id) {
+      if (value_id != null_value_id) ++counts[value_id];
+    });
+  });
 
-      // increase the write-offset in the copy by one to ensure that further writes
-      // are directed to the next position in _index_postings
-      index_offset_copy[value_id]++;
+  // 2) The postings of a value id begin at the sum of the counts of the smaller value ids (index offsets). Within them,
+  //    each block writes behind the preceding blocks, which is where the counts are turned into write offsets.
+  auto index_offsets = pmr_vector<uint32_t>(unique_values_count + 1u);
+  auto postings_count = ChunkOffset{0};
+  for (auto value_id = size_t{0}; value_id < unique_values_count; ++value_id) {
+    index_offsets[value_id] = postings_count;
+    for (auto& counts : counts_by_block) {
+      const auto count = counts[value_id];
+      counts[value_id] = postings_count;
+      postings_count += count;
     }
+  }
+  index_offsets[unique_values_count] = postings_count;
+
+  // 3) Scatter the positions to the postings of their value ids
+  _index_postings = std::vector<ChunkOffset>(postings_count);
+  for_each_block([&](const size_t block_id) {
+    auto& write_offsets = counts_by_block[block_id];
+
+    auto value_ids = std::vector<uint32_t>(BLOCK_SIZE);
+    for_each_value_id_in_block(block_id, value_ids, [&](const auto chunk_offset, const auto value_id) {
+      if (value_id != null_value_id) _index_postings[write_offsets[value_id]++] = chunk_offset;
+    });
   });
+
+  _index_offsets = compress_vector(index_offsets, VectorCompressionType::FixedSizeByteAligned, {},
+                                   UncompressedVectorInfo{postings_count});
 }
 
 GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -84,7 +132,8 @@ GroupKeyIndex::Iterator GroupKeyIndex::_get_postings_iterator_at(ValueID value_i
   if (value_id == INVALID_VALUE_ID) return _index_postings.cend();
 
   // get the start position in the position-vector, ie the offset, by looking up the index_offset at value_id
-  auto start_pos = _index_offsets[value_id];
+  auto start_pos = uint32_t{0};
+  _index_offsets->decode_into(value_id, 1u, &start_pos);
 
   // get an iterator pointing to start_pos
   auto iter = _index_postings.cbegin();
@@ -98,7 +147,7 @@ std::vector<std::shared_ptr<const BaseSegment>> GroupKeyIndex::_get_indexed_segm
 
 size_t GroupKeyIndex::_memory_consumption() const {
   size_t bytes = sizeof(_indexed_segments);
-  bytes += sizeof(std::size_t) * _index_offsets.size();
+  bytes += _index_offsets->data_size();
   bytes += sizeof(ChunkOffset) * _index_postings.size();
   return bytes;
 }
@@ -11,6 +11,7 @@
 
 namespace opossum {
 
+class BaseCompressedVector;
 class BaseSegment;
 class BaseDictionarySegment;
 class GroupKeyIndexTest;
@@ -37,6 +38,14 @@ class GroupKeyIndexTest;
  *    | 7 |         5 |            |         |  |-------->  7 |  ie "inbox" can be found at i = 7 in the AV
  *    +---+-----------+------------+---------+----------------+
  *
+ * NULLs are not part of the postings, so that the ranges towards cend() do not contain them.
+ *
+ * The index offsets are compressed with the FixedSizeByteAligned vector compression, i.e., their width depends on the
+ * number of postings instead of being that of a size_t. The postings remain ChunkOffsets, as the Iterators of all
+ * indexes point into a vector of ChunkOffsets (see BaseIndex::Iterator).
+ *
+ * The postings of large segments are created in parallel, see the constructor.
+ *
  * Find more information about this in our Wiki: https://github.com/hyrise/hyrise/wiki/GroupKey-Index
  */
 class GroupKeyIndex : public BaseIndex {
@@ -57,8 +66,17 @@ class GroupKeyIndex : public BaseIndex {
   GroupKeyIndex(GroupKeyIndex&&) = default;
   GroupKeyIndex& operator=(GroupKeyIndex&&) = default;
 
+  /**
+   * The postings are created like a counting sort of the positions by their value ids: The attribute vector is split
+   * into blocks of BLOCK_SIZE positions, whose value ids are counted and then scattered to the postings by one JobTask
+   * per block. Each block writes to the postings behind those of the preceding blocks, so that the postings of each
+   * value id remain ordered by position.
+   */
   explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
+  // The number of positions per JobTask that creates the postings, a multiple of the SIMD-BP128 meta block size
+  static constexpr auto BLOCK_SIZE = size_t{16'384};
+
  private:
   Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
 
@@ -81,7 +99,7 @@ class GroupKeyIndex : public BaseIndex {
 
  private:
   const std::shared_ptr<const BaseDictionarySegment> _indexed_segments;
-  std::vector<std::size_t> _index_offsets;   // maps value-ids to offsets in _index_postings
-  std::vector<ChunkOffset> _index_postings;  // records positions in the attribute vector
+  std::unique_ptr<const BaseCompressedVector> _index_offsets;  // maps value-ids to offsets in _index_postings
+  std::vector<ChunkOffset> _index_postings;                    // records positions in the attribute vector
 };
 }  // namespace opossum
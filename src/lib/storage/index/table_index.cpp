@@ -0,0 +1,99 @@
+#include "table_index.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseTableIndex::BaseTableIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BaseTableIndex::column_id() const { return _column_id; }
+
+template <typename T>
+TableIndex<T>::TableIndex(const ColumnID column_id) : BaseTableIndex(column_id) {}
+
+template <typename T>
+void TableIndex<T>::insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                           const ChunkOffset end_offset) {
+  const auto& segment = *chunk.get_segment(column_id());
+  DebugAssert(begin_offset <= end_offset && end_offset <= segment.size(), "Rows out of range of the chunk");
+
+  const auto add_row = [&](const T& value, const ChunkOffset chunk_offset) {
+    _tree.insert(binary_comparable_key(value), RowID{chunk_id, chunk_offset});
+    ++_row_count;
+  };
+
+  // Whole chunks are indexed when the index is created and are read with the iterators of their encoding. The few
+  // rows that are inserted at a time are accessed one by one instead.
+  if (begin_offset == 0 && end_offset == segment.size()) {
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (!position.is_null()) add_row(position.value(), position.chunk_offset());
+    });
+  } else {
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      const auto value = segment[chunk_offset];
+      if (!variant_is_null(value)) add_row(type_cast_variant<T>(value), chunk_offset);
+    }
+  }
+}
+
+template <typename T>
+void TableIndex<T>::remove_chunk(const ChunkID chunk_id) { _row_count -= _tree.remove_chunk(chunk_id); }
+
+template <typename T>
+PosList TableIndex<T>::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                              const std::optional<AllTypeVariant>& value2) const {
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return PosList{};
+
+  using KeyBound = ConcurrentAdaptiveRadixTree::KeyBound;
+  const auto typed_value = type_cast_variant<T>(value);
+  const auto key = binary_comparable_key(typed_value);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return _tree.lookup(KeyBound{key, true}, KeyBound{key, true});
+
+    case PredicateCondition::NotEquals: {
+      auto matches = _tree.lookup(std::nullopt, KeyBound{key, false});
+      const auto greater_matches = _tree.lookup(KeyBound{key, false}, std::nullopt);
+      matches.insert(matches.end(), greater_matches.begin(), greater_matches.end());
+      return matches;
+    }
+
+    case PredicateCondition::LessThan:
+      return _tree.lookup(std::nullopt, KeyBound{key, false});
+
+    case PredicateCondition::LessThanEquals:
+      return _tree.lookup(std::nullopt, KeyBound{key, true});
+
+    case PredicateCondition::GreaterThan:
+      return _tree.lookup(KeyBound{key, false}, std::nullopt);
+
+    case PredicateCondition::GreaterThanEquals:
+      return _tree.lookup(KeyBound{key, true}, std::nullopt);
+
+    case PredicateCondition::Between: {
+      Assert(value2, "BETWEEN needs two values");
+      const auto typed_value2 = type_cast_variant<T>(*value2);
+      if (typed_value2 < typed_value) return PosList{};
+      return _tree.lookup(KeyBound{key, true}, KeyBound{binary_comparable_key(typed_value2), true});
+    }
+
+    default:
+      Fail("Predicate condition not supported by TableIndex");
+  }
+}
+
+template <typename T>
+size_t TableIndex<T>::row_count() const { return _row_count; }
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndex);
+
+}  // namespace opossum
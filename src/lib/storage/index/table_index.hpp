@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include "adaptive_radix_tree/concurrent_adaptive_radix_tree.hpp"
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * A secondary index on a column that covers all chunks of a table, as opposed to the BaseIndexes, of which each chunk
+ * has its own. A lookup therefore probes a single ConcurrentAdaptiveRadixTree instead of one index per chunk.
+ *
+ * The index maps the values of the column to the RowIDs of the rows holding them. It is maintained incrementally: The
+ * Table adds the rows appended to it and the Insert operator those it inserts, so that uncommitted and rolled back
+ * rows are indexed, too, and have to be validated like all other rows. Encoding a chunk does not move its rows, so
+ * the RowIDs stay valid. NULLs are not indexed, as they do not match any predicate.
+ *
+ * Lookups and inserts can run concurrently, and lookups do not wait for inserts (see ConcurrentAdaptiveRadixTree).
+ * Unlike the BaseIndexes, which are built once from an encoded segment, the index thus also covers the mutable chunk.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  explicit BaseTableIndex(const ColumnID column_id);
+  virtual ~BaseTableIndex() = default;
+
+  ColumnID column_id() const;
+
+  // Indexes the rows [begin_offset, end_offset) of the @param chunk with the @param chunk_id
+  virtual void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+
+  // Removes the rows of the chunk with the @param chunk_id, e.g., when Table::remove_chunk() replaces it
+  virtual void remove_chunk(const ChunkID chunk_id) = 0;
+
+  // @return The rows for which `column <predicate_condition> value` (or `column BETWEEN value AND value2`) holds,
+  //         ordered by their values, not by their RowIDs
+  virtual PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+  // The number of rows that are indexed
+  virtual size_t row_count() const = 0;
+
+ private:
+  const ColumnID _column_id;
+};
+
+template <typename T>
+class TableIndex : public BaseTableIndex {
+ public:
+  explicit TableIndex(const ColumnID column_id);
+
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) override;
+  void remove_chunk(const ChunkID chunk_id) override;
+  PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                 const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+  size_t row_count() const override;
+
+ private:
+  ConcurrentAdaptiveRadixTree _tree;
+  std::atomic<size_t> _row_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include "unique_constraint_index.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Rows that are neither deleted by a committed transaction nor rolled back. Once a row is invalid, it stays invalid.
+bool row_is_valid(const MvccData& mvcc_data, const ChunkOffset chunk_offset) {
+  return mvcc_data.end_cids[chunk_offset] == MvccData::MAX_COMMIT_ID;
+}
+
+// Valid rows that the transaction with the @param transaction_id has not deleted itself. Rows that other transactions
+// are about to delete conflict, too, as the transactions might still be rolled back.
+bool row_conflicts(const MvccData& mvcc_data, const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  if (!row_is_valid(mvcc_data, chunk_offset)) return false;
+
+  const auto deleted_by_transaction = transaction_id != TransactionManager::INVALID_TRANSACTION_ID &&
+                                      mvcc_data.tids[chunk_offset] == transaction_id &&
+                                      mvcc_data.begin_cids[chunk_offset] != MvccData::MAX_COMMIT_ID;
+  return !deleted_by_transaction;
+}
+
+}  // namespace
+
+namespace opossum {
+
+UniqueConstraintIndex::UniqueConstraintIndex(const TableConstraintDefinition& definition) : _definition(definition) {
+  Assert(!_definition.column_ids.empty(), "A unique constraint needs at least one column");
+}
+
+const TableConstraintDefinition& UniqueConstraintIndex::definition() const { return _definition; }
+
+bool UniqueConstraintIndex::insert(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                   const ChunkOffset end_offset, const TransactionID transaction_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  DebugAssert(begin_offset <= end_offset && end_offset <= chunk->size(), "Rows out of range of the chunk");
+
+  auto key = Key(_definition.column_ids.size());
+
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    auto key_has_null = false;
+    for (auto key_column_idx = size_t{0}; key_column_idx < key.size(); ++key_column_idx) {
+      key[key_column_idx] = (*chunk->get_segment(_definition.column_ids[key_column_idx]))[chunk_offset];
+      key_has_null |= variant_is_null(key[key_column_idx]);
+    }
+    if (key_has_null) continue;
+
+    auto& partition = _partitions[KeyHash{}(key) % PARTITION_COUNT];
+    const auto lock = std::lock_guard<std::mutex>{partition.mutex};
+
+    auto& row_ids = partition.row_ids[key];
+
+    auto conflict = false;
+    auto row_ids_end = std::remove_if(row_ids.begin(), row_ids.end(), [&](const auto& row_id) {
+      const auto other_chunk = table.get_chunk(row_id.chunk_id);
+      if (!other_chunk->has_mvcc_data()) {
+        conflict = true;
+        return false;
+      }
+
+      // Invalid rows are removed while we are at it
+      const auto mvcc_data = other_chunk->get_scoped_mvcc_data_lock();
+      conflict |= row_conflicts(*mvcc_data, row_id.chunk_offset, transaction_id);
+      return !row_is_valid(*mvcc_data, row_id.chunk_offset);
+    });
+    row_ids.erase(row_ids_end, row_ids.end());
+
+    if (conflict) return false;
+
+    row_ids.emplace_back(chunk_id, chunk_offset);
+  }
+
+  return true;
+}
+
+void UniqueConstraintIndex::remove_chunk(const ChunkID chunk_id) {
+  for (auto& partition : _partitions) {
+    const auto lock = std::lock_guard<std::mutex>{partition.mutex};
+
+    for (auto iter = partition.row_ids.begin(); iter != partition.row_ids.end();) {
+      auto& row_ids = iter->second;
+      row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(),
+                                   [&](const auto& row_id) { return row_id.chunk_id == chunk_id; }),
+                    row_ids.end());
+
+      if (row_ids.empty()) {
+        iter = partition.row_ids.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+}
+
+size_t UniqueConstraintIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table_constraint_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Enforces a UNIQUE or PRIMARY KEY constraint of a Table. It is a hash index from the key of each row, i.e., its values
+ * in the columns of the constraint, to the rows holding that key. A row can only be added if no other row with the
+ * same key might be visible to any transaction. That is the case if the other row has been deleted by a committed
+ * transaction or if its insert has been rolled back. Rows that are still being inserted or deleted by other
+ * transactions conflict, so that of two transactions inserting the same key, the second one fails right away instead
+ * of at commit time.
+ *
+ * Keys with a NULL are not indexed, as a UNIQUE constraint allows any number of them (the columns of a primary key
+ * are not nullable).
+ *
+ * The index is partitioned by the hash of the keys. Each partition has its own mutex, so that concurrent Inserts only
+ * wait for each other if their keys fall into the same partition. Checking a key and adding it happen while the
+ * partition is locked.
+ */
+class UniqueConstraintIndex : private Noncopyable {
+ public:
+  explicit UniqueConstraintIndex(const TableConstraintDefinition& definition);
+
+  const TableConstraintDefinition& definition() const;
+
+  /**
+   * Adds the rows [begin_offset, end_offset) of the chunk with the @param chunk_id of the @param table, one by one,
+   * until one of them violates the constraint. The rows added before stay in the index, they are garbage once the
+   * caller has rolled them back.
+   *
+   * @param transaction_id  The transaction that inserts the rows. Rows it has deleted itself do not conflict
+   *                        (e.g., for an Update of the key). INVALID_TRANSACTION_ID for rows that are appended
+   *                        outside of a transaction.
+   * @return                Whether all rows were added
+   */
+  bool insert(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+              const TransactionID transaction_id);
+
+  // Removes the rows of the chunk with the @param chunk_id, e.g., when Table::remove_chunk() replaces it
+  void remove_chunk(const ChunkID chunk_id);
+
+ private:
+  using Key = std::vector<AllTypeVariant>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Partition {
+    std::mutex mutex;
+    std::unordered_map<Key, std::vector<RowID>, KeyHash> row_ids;
+  };
+
+  static constexpr auto PARTITION_COUNT = size_t{64};
+
+  const TableConstraintDefinition _definition;
+  std::array<Partition, PARTITION_COUNT> _partitions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,208 @@
+#include "index_tuner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cost_model/cost_model_physical.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Recorded scans whose weight has decayed below this value are forgotten
+constexpr auto MIN_SCAN_HISTORY_WEIGHT = 1.0 / 1024;
+
+}  // namespace
+
+namespace opossum {
+
+void IndexTuner::record_scan(const std::string& table_name, const ColumnID column_id, const size_t input_row_count,
+                             const size_t output_row_count) {
+  std::lock_guard<std::mutex> lock{_scan_history_mutex};
+  auto& scan_history = _scan_history[{table_name, column_id}];
+  scan_history.scan_count += 1.0;
+  scan_history.input_row_count += static_cast<double>(input_row_count);
+  scan_history.output_row_count += static_cast<double>(output_row_count);
+}
+
+size_t IndexTuner::tune_indexes() {
+  auto scan_histories = std::map<std::pair<std::string, ColumnID>, ScanHistory>{};
+  {
+    std::lock_guard<std::mutex> lock{_scan_history_mutex};
+    scan_histories = _scan_history;
+
+    for (auto iter = _scan_history.begin(); iter != _scan_history.end();) {
+      auto& scan_history = iter->second;
+      scan_history.scan_count *= _options.history_decay;
+      scan_history.input_row_count *= _options.history_decay;
+      scan_history.output_row_count *= _options.history_decay;
+
+      if (scan_history.scan_count < MIN_SCAN_HISTORY_WEIGHT) {
+        iter = _scan_history.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  // A column that has an index created by the tuner or is worth one
+  struct Candidate {
+    std::shared_ptr<Table> table;
+    ColumnID column_id;
+    bool is_indexed;
+    double benefit;
+    size_t memory_consumption;
+    std::vector<std::shared_ptr<Chunk>> chunks_to_index;
+  };
+
+  const auto cost_model = CostModelPhysical{};
+  auto candidates = std::vector<Candidate>{};
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    if (table->type() != TableType::Data) continue;
+
+    const auto index_infos = table->get_indexes();
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      const auto index_info_iter = std::find_if(index_infos.begin(), index_infos.end(), [&](const auto& index_info) {
+        return index_info.column_ids == std::vector<ColumnID>{column_id} &&
+               index_info.type == SegmentIndexType::GroupKey;
+      });
+      if (index_info_iter != index_infos.end() && index_info_iter->name != INDEX_NAME) continue;
+
+      auto candidate = Candidate{table, column_id, index_info_iter != index_infos.end(), 0.0, 0, {}};
+
+      auto indexable_row_count = size_t{0};
+      auto indexable_chunk_count = size_t{0};
+      for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (chunk->is_mutable()) continue;
+        if (chunk->has_access_counter() && chunk->access_counter()->counter() <= _options.cold_chunk_access_count) {
+          continue;
+        }
+
+        const auto segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_id));
+        if (!segment) continue;
+
+        indexable_row_count += chunk->size();
+        ++indexable_chunk_count;
+
+        if (const auto index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id})) {
+          candidate.memory_consumption += index->memory_consumption();
+        } else {
+          // The GroupKeyIndex stores offsets into the dictionary, not the values themselves
+          candidate.memory_consumption += BaseIndex::estimate_memory_consumption(
+              SegmentIndexType::GroupKey, chunk->size(), segment->unique_values_count(), 0);
+          candidate.chunks_to_index.emplace_back(chunk);
+        }
+      }
+
+      const auto scan_history_iter = scan_histories.find({table_name, column_id});
+      if (scan_history_iter != scan_histories.end() && indexable_row_count > 0) {
+        const auto& scan_history = scan_history_iter->second;
+        const auto input_row_count = scan_history.input_row_count / scan_history.scan_count;
+        const auto output_row_count = scan_history.output_row_count / scan_history.scan_count;
+
+        // The chunks without an index are still scanned by a TableScan
+        const auto table_scan_cost = cost_model.estimate_scan_cost(OperatorType::TableScan, input_row_count,
+                                                                   output_row_count);
+        const auto index_scan_cost = cost_model.estimate_scan_cost(OperatorType::IndexScan, input_row_count,
+                                                                   output_row_count, indexable_chunk_count);
+        const auto indexed_fraction = static_cast<double>(indexable_row_count) / table->row_count();
+        candidate.benefit = std::max(0.0, scan_history.scan_count * indexed_fraction *
+                                              static_cast<double>(table_scan_cost - index_scan_cost));
+      }
+
+      if (candidate.is_indexed || candidate.benefit > 0.0) candidates.emplace_back(std::move(candidate));
+    }
+  }
+
+  // Greedily pick the indexes with the best benefit per byte
+  std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.benefit / std::max(lhs.memory_consumption, size_t{1}) >
+           rhs.benefit / std::max(rhs.memory_consumption, size_t{1});
+  });
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto indexes_to_register = std::vector<const Candidate*>{};
+  auto used_memory = size_t{0};
+
+  for (const auto& candidate : candidates) {
+    const auto column_ids = std::vector<ColumnID>{candidate.column_id};
+
+    if (candidate.benefit > 0.0 && used_memory + candidate.memory_consumption <= _options.memory_budget) {
+      used_memory += candidate.memory_consumption;
+
+      for (const auto& chunk : candidate.chunks_to_index) {
+        if (jobs.size() == _options.max_indexes_per_iteration) break;
+
+        jobs.emplace_back(std::make_shared<JobTask>(
+            [chunk, column_ids]() {
+              if (!chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+                chunk->create_index<GroupKeyIndex>(column_ids);
+              }
+            },
+            SchedulePriority::Low));
+        jobs.back()->schedule();
+      }
+
+      if (!candidate.is_indexed) indexes_to_register.emplace_back(&candidate);
+    } else if (candidate.is_indexed) {
+      // Plans that still use the indexes scan the chunks with a TableScan instead (see IndexScan)
+      candidate.table->remove_index_info(column_ids, SegmentIndexType::GroupKey);
+      for (ChunkID chunk_id{0}; chunk_id < candidate.table->chunk_count(); ++chunk_id) {
+        const auto chunk = candidate.table->get_chunk(chunk_id);
+        if (const auto index = chunk->get_index(SegmentIndexType::GroupKey, column_ids)) chunk->remove_index(index);
+      }
+    }
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // The IndexScanRule only considers the indexes once the chunks have them
+  for (const auto* candidate : indexes_to_register) {
+    candidate->table->add_index_info(
+        IndexInfo{std::vector<ColumnID>{candidate->column_id}, INDEX_NAME, SegmentIndexType::GroupKey});
+  }
+
+  return jobs.size();
+}
+
+void IndexTuner::clear_scan_history() {
+  std::lock_guard<std::mutex> lock{_scan_history_mutex};
+  _scan_history.clear();
+}
+
+const IndexTuner::Options& IndexTuner::options() const { return _options; }
+
+void IndexTuner::set_options(const Options& options) {
+  _options = options;
+  if (_tuning_thread) _tuning_thread->set_loop_sleep_time(_options.tuning_interval);
+}
+
+void IndexTuner::resume() {
+  if (!_tuning_thread) {
+    _tuning_thread =
+        std::make_unique<PausableLoopThread>(_options.tuning_interval, [this](size_t) { tune_indexes(); });
+  }
+  _tuning_thread->resume();
+}
+
+void IndexTuner::pause() {
+  if (_tuning_thread) _tuning_thread->pause();
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+// The IndexTuner is a singleton that creates and drops the GroupKeyIndexes of the chunks of the tables in the
+// StorageManager in the background, so that the IndexScanRule finds indexes for the predicates that are executed
+// often, without anyone having to create them by hand.
+//
+// The TableScans on stored tables record the column and the selectivity of their predicate in the scan history. In a
+// loop, the tuner estimates the benefit of an index on each scanned column from the saved scan costs (according to the
+// CostModelPhysical) and its memory consumption, either the actual one (see BaseIndex::memory_consumption()) or the
+// estimated one. It picks the columns with the best benefit per byte until the memory budget is used up, indexes the
+// chunks of these columns in JobTasks with a low SchedulePriority, and drops the indexes it created on columns that
+// are no longer worth it. Only immutable, dictionary-encoded chunks that are not cold according to their
+// ChunkAccessCounter are indexed, as the GroupKeyIndex cannot follow inserts into the chunks. Indexes that were
+// created by hand are left alone.
+//
+// The scan history decays in each iteration, so that the indexes follow a changing workload. Like the
+// ChunkCompressionManager, the tuner is initialized in a paused state and needs to be `resumed` to start its operation.
+class IndexTuner : public Singleton<IndexTuner> {
+ public:
+  // The name of the IndexInfos of the indexes created by the tuner, which are the only ones that it drops
+  static constexpr auto INDEX_NAME = "IndexTuner";
+
+  struct Options {
+    // The time interval at which the indexes are tuned
+    std::chrono::milliseconds tuning_interval = std::chrono::seconds(10);
+
+    // Maximum number of bytes that the indexes created by the tuner may use
+    size_t memory_budget = 512 * 1024 * 1024;
+
+    // Maximum number of chunk indexes that are created per loop iteration
+    size_t max_indexes_per_iteration = 64;
+
+    // Chunks whose ChunkAccessCounter is at or below this value are considered cold and are not indexed
+    uint64_t cold_chunk_access_count = 0;
+
+    // Weight that the recorded scans keep per iteration
+    double history_decay = 0.5;
+  };
+
+  /**
+   * Records a TableScan with a single `<column> <condition> <value>` (or BETWEEN) predicate on the stored table with
+   * the @param table_name, which returned @param output_row_count of its @param input_row_count rows.
+   */
+  void record_scan(const std::string& table_name, const ColumnID column_id, const size_t input_row_count,
+                   const size_t output_row_count);
+
+  /**
+   * Creates and drops the indexes as described above and waits for them to be created. Afterwards, the scan history
+   * is decayed. This is what the background thread does in each iteration.
+   * @return The number of chunk indexes that have been created
+   */
+  size_t tune_indexes();
+
+  // Forgets the recorded scans
+  void clear_scan_history();
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  IndexTuner(IndexTuner&&) = delete;
+
+ protected:
+  IndexTuner() = default;
+
+  friend class Singleton;
+
+  // The scans on a column, weighted by their age
+  struct ScanHistory {
+    double scan_count{0.0};
+    double input_row_count{0.0};
+    double output_row_count{0.0};
+  };
+
+  Options _options;
+
+  std::mutex _scan_history_mutex;
+  std::map<std::pair<std::string, ColumnID>, ScanHistory> _scan_history;
+
+  // Only started when the tuner is resumed, as the TableScans use the singleton to record their predicates
+  std::unique_ptr<PausableLoopThread> _tuning_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "lazy_table_prefetcher.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+void LazyTablePrefetcher::prefetch(const std::string& usage_file_path) {
+  auto usage = read_usage(usage_file_path);
+
+  const auto table_names = prefetch_order(StorageManager::get().lazy_table_names(), usage);
+  auto used_table_count = size_t{0};
+  for (const auto& table_name : table_names) {
+    // Tables that were dropped in the meantime are skipped
+    if (!StorageManager::get().load_lazy_table(table_name) && StorageManager::get().has_table(table_name)) {
+      ++usage[table_name];
+      ++used_table_count;
+    }
+  }
+
+  if (used_table_count > 0) write_usage(usage, usage_file_path);
+}
+
+std::vector<std::string> LazyTablePrefetcher::prefetch_order(std::vector<std::string> table_names,
+                                                             const std::map<std::string, uint64_t>& usage) {
+  const auto count = [&](const std::string& table_name) {
+    const auto usage_iter = usage.find(table_name);
+    return usage_iter != usage.end() ? usage_iter->second : uint64_t{0};
+  };
+
+  std::sort(table_names.begin(), table_names.end(), [&](const auto& lhs, const auto& rhs) {
+    const auto lhs_count = count(lhs);
+    const auto rhs_count = count(rhs);
+    return lhs_count != rhs_count ? lhs_count > rhs_count : lhs < rhs;
+  });
+  return table_names;
+}
+
+std::map<std::string, uint64_t> LazyTablePrefetcher::read_usage(const std::string& usage_file_path) {
+  auto usage = std::map<std::string, uint64_t>{};
+  if (!filesystem::exists(usage_file_path)) return usage;
+
+  auto stream = std::ifstream{usage_file_path};
+  auto table_name = std::string{};
+  auto count = uint64_t{0};
+  while (stream >> table_name >> count) {
+    usage[table_name] = count;
+  }
+  Assert(stream.eof(), "Cannot read " + usage_file_path);
+  return usage;
+}
+
+void LazyTablePrefetcher::write_usage(const std::map<std::string, uint64_t>& usage,
+                                      const std::string& usage_file_path) {
+  // Replacing the file is atomic, so that a crash does not lose the counts of the previous runs
+  const auto temporary_file_path = usage_file_path + ".tmp";
+  {
+    auto stream = std::ofstream{};
+    stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    stream.open(temporary_file_path);
+    for (const auto& [table_name, count] : usage) {
+      stream << table_name << " " << count << "\n";
+    }
+  }
+  filesystem::rename(temporary_file_path, usage_file_path);
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Loads the tables that were added to the StorageManager lazily (see StorageManager::add_lazy_table()), e.g., from the
+ * server's data directory, so that queries find them loaded. The server starts answering queries right away, and the
+ * tables that queries wait for are loaded as they are looked up, while the prefetcher loads the others in the
+ * background.
+ *
+ * The tables that queries waited for most often in earlier runs are prefetched first: The usage file counts for each
+ * table the runs in which the table was loaded by a lookup before the prefetcher got to it. The tables are loaded one
+ * after the other, as ImportBinary loads the chunks of each of them in parallel.
+ */
+class LazyTablePrefetcher {
+ public:
+  /**
+   * Loads all lazy tables that are not loaded yet and adds the ones that were loaded by lookups in the meantime to the
+   * counts in the file at @param usage_file_path. Blocks until all of them are loaded.
+   */
+  static void prefetch(const std::string& usage_file_path);
+
+  /**
+   * The order in which prefetch() loads the @param table_names, by the counts of the @param usage: Most frequently
+   * used first, then by name
+   */
+  static std::vector<std::string> prefetch_order(std::vector<std::string> table_names,
+                                                 const std::map<std::string, uint64_t>& usage);
+
+  /**
+   * The counts of the usage file, one "<table name> <count>" per line. Empty if there is no such file.
+   */
+  static std::map<std::string, uint64_t> read_usage(const std::string& usage_file_path);
+  static void write_usage(const std::map<std::string, uint64_t>& usage, const std::string& usage_file_path);
+};
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#include "lz4_segment.hpp"
+
+#include <lz4.h>
+
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+LZ4Segment<T, U>::LZ4Segment(pmr_vector<char> compressed_data, pmr_vector<size_t> block_offsets,
+                             pmr_vector<bool> null_values,
+                             std::unique_ptr<const BaseCompressedVector> string_end_offsets)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _compressed_data{std::move(compressed_data)},
+      _block_offsets{std::move(block_offsets)},
+      _null_values{std::move(null_values)},
+      _string_end_offsets{std::move(string_end_offsets)},
+      _decompressor{_string_end_offsets->create_base_decompressor()} {
+  DebugAssert(_block_offsets.size() == block_count() + 1, "Expected one offset per block and the end offset");
+}
+
+template <typename T, typename U>
+const pmr_vector<char>& LZ4Segment<T, U>::compressed_data() const {
+  return _compressed_data;
+}
+
+template <typename T, typename U>
+const pmr_vector<size_t>& LZ4Segment<T, U>::block_offsets() const {
+  return _block_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& LZ4Segment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& LZ4Segment<T, U>::string_end_offsets() const {
+  return *_string_end_offsets;
+}
+
+template <typename T, typename U>
+size_t LZ4Segment<T, U>::block_count() const {
+  return (size() + block_size - 1u) / block_size;
+}
+
+template <typename T, typename U>
+const AllTypeVariant LZ4Segment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> LZ4Segment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  auto buffer = std::vector<char>{};
+  decompress_block(*_decompressor, chunk_offset / block_size, buffer);
+
+  const auto string_begin = chunk_offset % block_size == 0 ? size_t{0} : _decompressor->get(chunk_offset - 1);
+  const auto string_end = _decompressor->get(chunk_offset);
+  return T{buffer.data() + string_begin, string_end - string_begin};
+}
+
+template <typename T, typename U>
+size_t LZ4Segment<T, U>::size() const {
+  return _string_end_offsets->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> LZ4Segment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_compressed_data = pmr_vector<char>{_compressed_data, alloc};
+  auto new_block_offsets = pmr_vector<size_t>{_block_offsets, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_string_end_offsets = _string_end_offsets->copy_using_allocator(alloc);
+
+  return std::allocate_shared<LZ4Segment>(alloc, std::move(new_compressed_data), std::move(new_block_offsets),
+                                          std::move(new_null_values), std::move(new_string_end_offsets));
+}
+
+template <typename T, typename U>
+size_t LZ4Segment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + _compressed_data.size() + sizeof(size_t) * _block_offsets.size() +
+         _string_end_offsets->data_size() + _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType LZ4Segment<T, U>::encoding_type() const {
+  return EncodingType::LZ4;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> LZ4Segment<T, U>::compressed_vector_type() const {
+  return _string_end_offsets->type();
+}
+
+template <typename T, typename U>
+void LZ4Segment<T, U>::_decompress_block(const size_t block_index, const size_t uncompressed_size,
+                                         std::vector<char>& buffer) const {
+  buffer.resize(uncompressed_size);
+
+  // Blocks of empty strings are not compressed at all
+  if (uncompressed_size == 0) return;
+
+  const auto compressed_begin = _block_offsets[block_index];
+  const auto compressed_size = _block_offsets[block_index + 1] - compressed_begin;
+  const auto decompressed_size =
+      LZ4_decompress_safe(_compressed_data.data() + compressed_begin, buffer.data(), static_cast<int>(compressed_size),
+                          static_cast<int>(uncompressed_size));
+  Assert(decompressed_size == static_cast<int>(uncompressed_size), "LZ4 decompression failed");
+}
+
+template class LZ4Segment<std::string>;
+
+}  // namespace opossum
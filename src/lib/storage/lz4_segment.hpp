@@ -0,0 +1,109 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing LZ4 compression for strings
+ *
+ * Dictionary encodings keep every distinct string uncompressed, which does
+ * not save much for wide text columns with few repeated values (e.g., comments).
+ * Instead, this segment concatenates the strings of fixed-size blocks and
+ * compresses each block using LZ4. A block directory stores where each
+ * compressed block begins, so that accessing a value decompresses only its block.
+ * The end of each string within its uncompressed block is stored in a
+ * compressed vector.
+ *
+ * Scanning the segment is considerably slower than scanning dictionary
+ * segments, so it is meant for cold data.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::LZ4>,
+                                                                              hana::type_c<T>)>>
+class LZ4Segment : public BaseEncodedSegment {
+ public:
+  /**
+   * Larger blocks compress better but make point access more expensive,
+   * as each access decompresses the entire block.
+   */
+  static constexpr auto block_size = 256u;
+
+  explicit LZ4Segment(pmr_vector<char> compressed_data, pmr_vector<size_t> block_offsets,
+                      pmr_vector<bool> null_values, std::unique_ptr<const BaseCompressedVector> string_end_offsets);
+
+  const pmr_vector<char>& compressed_data() const;
+
+  // The offsets of all compressed blocks in compressed_data(), followed by the size of compressed_data()
+  const pmr_vector<size_t>& block_offsets() const;
+
+  const pmr_vector<bool>& null_values() const;
+
+  // The end of each string within its uncompressed block
+  const BaseCompressedVector& string_end_offsets() const;
+
+  size_t block_count() const;
+
+  /**
+   * Decompresses the block with the given index into `buffer`, whose size is set to the size of the uncompressed block
+   */
+  template <typename StringEndOffsetDecompressorT>
+  void decompress_block(StringEndOffsetDecompressorT& string_end_offset_decompressor, const size_t block_index,
+                        std::vector<char>& buffer) const {
+    const auto block_end = std::min(static_cast<size_t>((block_index + 1) * block_size), size());
+    const auto uncompressed_size = string_end_offset_decompressor.get(block_end - 1);
+    _decompress_block(block_index, uncompressed_size, buffer);
+  }
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  void _decompress_block(const size_t block_index, const size_t uncompressed_size, std::vector<char>& buffer) const;
+
+  const pmr_vector<char> _compressed_data;
+  const pmr_vector<size_t> _block_offsets;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _string_end_offsets;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
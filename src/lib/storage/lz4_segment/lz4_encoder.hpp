@@ -0,0 +1,107 @@
+#pragma once
+
+#include <lz4hc.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/lz4_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::LZ4>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+
+    static constexpr auto block_size = LZ4Segment<T>::block_size;
+
+    const auto size = value_segment->size();
+
+    // holds the compressed blocks, one after another
+    auto compressed_data = pmr_vector<char>{alloc};
+
+    // holds the offset of each block in compressed_data, followed by its size
+    auto block_offsets = pmr_vector<size_t>{alloc};
+    block_offsets.reserve((size + block_size - 1u) / block_size + 1u);
+
+    // holds the end of each string within its uncompressed block
+    auto string_end_offsets = pmr_vector<uint32_t>{alloc};
+    string_end_offsets.reserve(size);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // used as optional input for the compression of the string end offsets
+    auto max_string_end_offset = uint32_t{0u};
+
+    // a temporary storage to hold the concatenated strings of one block
+    auto uncompressed_block = std::string{};
+
+    const auto compress_block = [&]() {
+      block_offsets.push_back(compressed_data.size());
+      if (uncompressed_block.empty()) return;
+
+      Assert(uncompressed_block.size() <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE), "Block is too large for LZ4.");
+      const auto uncompressed_size = static_cast<int>(uncompressed_block.size());
+
+      // The data is cold, so a higher compression level is worth the slower encoding. Decompression is as fast.
+      const auto compressed_begin = compressed_data.size();
+      compressed_data.resize(compressed_begin + static_cast<size_t>(LZ4_compressBound(uncompressed_size)));
+      const auto compressed_size =
+          LZ4_compress_HC(uncompressed_block.data(), compressed_data.data() + compressed_begin, uncompressed_size,
+                          static_cast<int>(compressed_data.size() - compressed_begin), LZ4HC_CLEVEL_DEFAULT);
+      Assert(compressed_size > 0, "LZ4 compression failed.");
+      compressed_data.resize(compressed_begin + static_cast<size_t>(compressed_size));
+
+      uncompressed_block.clear();
+    };
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      for (auto index = size_t{0u}; segment_it != segment_end; ++segment_it, ++index) {
+        const auto segment_value = *segment_it;
+        if (!segment_value.is_null()) uncompressed_block += segment_value.value();
+
+        // Make sure that the offsets fit into uint32_t (required for vector compression.)
+        Assert(uncompressed_block.size() <= std::numeric_limits<uint32_t>::max(),
+               "Strings of a block must not exceed 4 GB.");
+
+        const auto string_end_offset = static_cast<uint32_t>(uncompressed_block.size());
+        string_end_offsets.push_back(string_end_offset);
+        max_string_end_offset = std::max(max_string_end_offset, string_end_offset);
+        null_values.push_back(segment_value.is_null());
+
+        if ((index + 1u) % block_size == 0u) compress_block();
+      }
+    });
+
+    // The last block might not be filled completely
+    if (size % block_size != 0u) compress_block();
+    block_offsets.push_back(compressed_data.size());
+    compressed_data.shrink_to_fit();
+
+    auto compressed_string_end_offsets =
+        compress_vector(string_end_offsets, vector_compression_type(), alloc, {max_string_end_offset});
+
+    return std::allocate_shared<LZ4Segment<T>>(alloc, std::move(compressed_data), std::move(block_offsets),
+                                               std::move(null_values), std::move(compressed_string_end_offsets));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/lz4_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit LZ4Iterable(const LZ4Segment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.string_end_offsets(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using StringEndOffsetDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto block_decompressor = BlockDecompressor<StringEndOffsetDecompressorT>{_segment, *decompressor};
+
+      auto begin = Iterator<StringEndOffsetDecompressorT>{&block_decompressor, _segment.null_values().cbegin(),
+                                                          ChunkOffset{0u}};
+      auto end = Iterator<StringEndOffsetDecompressorT>{nullptr, _segment.null_values().cend(),
+                                                        static_cast<ChunkOffset>(_segment.size())};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.string_end_offsets(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using StringEndOffsetDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto block_decompressor = BlockDecompressor<StringEndOffsetDecompressorT>{_segment, *decompressor};
+
+      auto begin = PointAccessIterator<StringEndOffsetDecompressorT>{&block_decompressor, &_segment.null_values(),
+                                                                     position_filter->cbegin(),
+                                                                     position_filter->cbegin()};
+      auto end = PointAccessIterator<StringEndOffsetDecompressorT>{nullptr, nullptr, position_filter->cbegin(),
+                                                                   position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const LZ4Segment<T>& _segment;
+
+ private:
+  /**
+   * Keeps the most recently decompressed block, so that iterating over the values of a block (or accessing them from
+   * a sorted position list) decompresses it only once. It is shared by all copies of an iterator.
+   */
+  template <typename StringEndOffsetDecompressorT>
+  class BlockDecompressor {
+   public:
+    BlockDecompressor(const LZ4Segment<T>& segment, StringEndOffsetDecompressorT& string_end_offset_decompressor)
+        : _segment{segment}, _string_end_offset_decompressor{string_end_offset_decompressor} {}
+
+    T value(const ChunkOffset chunk_offset) {
+      static constexpr auto block_size = LZ4Segment<T>::block_size;
+
+      const auto block_index = chunk_offset / block_size;
+      if (_block_index != block_index) {
+        _segment.decompress_block(_string_end_offset_decompressor, block_index, _block);
+        _block_index = block_index;
+      }
+
+      const auto string_begin =
+          chunk_offset % block_size == 0u ? size_t{0u} : _string_end_offset_decompressor.get(chunk_offset - 1u);
+      const auto string_end = _string_end_offset_decompressor.get(chunk_offset);
+      return T{_block.data() + string_begin, string_end - string_begin};
+    }
+
+   private:
+    const LZ4Segment<T>& _segment;
+    StringEndOffsetDecompressorT& _string_end_offset_decompressor;
+    std::vector<char> _block;
+    std::optional<size_t> _block_index;
+  };
+
+  template <typename StringEndOffsetDecompressorT>
+  class Iterator : public BaseSegmentIterator<Iterator<StringEndOffsetDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = LZ4Iterable<T>;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    explicit Iterator(BlockDecompressor<StringEndOffsetDecompressorT>* block_decompressor,
+                      NullValueIterator null_value_it, ChunkOffset chunk_offset)
+        : _block_decompressor{block_decompressor}, _null_value_it{null_value_it}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_null_value_it;
+      ++_chunk_offset;
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    SegmentPosition<T> dereference() const {
+      const auto is_null = *_null_value_it;
+      if (is_null) return SegmentPosition<T>{T{}, true, _chunk_offset};
+
+      return SegmentPosition<T>{_block_decompressor->value(_chunk_offset), false, _chunk_offset};
+    }
+
+   private:
+    BlockDecompressor<StringEndOffsetDecompressorT>* _block_decompressor;
+    NullValueIterator _null_value_it;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename StringEndOffsetDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<StringEndOffsetDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = LZ4Iterable<T>;
+
+    PointAccessIterator(BlockDecompressor<StringEndOffsetDecompressorT>* block_decompressor,
+                        const pmr_vector<bool>* null_values, const PosList::const_iterator position_filter_begin,
+                        PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<StringEndOffsetDecompressorT>,
+                                         SegmentPosition<T>>{std::move(position_filter_begin),
+                                                             std::move(position_filter_it)},
+          _block_decompressor{block_decompressor},
+          _null_values{null_values} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      const auto is_null = (*_null_values)[chunk_offsets.offset_in_referenced_chunk];
+      if (is_null) return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+
+      const auto value = _block_decompressor->value(chunk_offsets.offset_in_referenced_chunk);
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    BlockDecompressor<StringEndOffsetDecompressorT>* _block_decompressor;
+    const pmr_vector<bool>* _null_values;
+  };
+};
+
+}  // namespace opossum
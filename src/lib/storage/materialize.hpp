@@ -1,10 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <iterator>
 #include <optional>
+#include <type_traits>
 
 #include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -21,13 +31,48 @@ namespace opossum {
  * ```
  */
 
+/**
+ * Calls the @param functor with the ChunkOffset and the ValueID of every entry of the @param attribute_vector, in
+ * order. The ValueIDs are decoded in blocks (see BaseCompressedVector::decode_into()), so that SIMD-BP128 blocks are
+ * unpacked at once instead of being handed out value by value through the iterators.
+ */
+template <typename Functor>
+void for_each_value_id(const BaseCompressedVector& attribute_vector, const Functor& functor) {
+  // A multiple of the SIMD-BP128 meta block size, so that every call starts at the beginning of a meta block
+  constexpr auto BLOCK_SIZE = size_t{2048};
+  alignas(16) auto value_ids = std::array<uint32_t, BLOCK_SIZE>{};
+
+  const auto size = attribute_vector.size();
+  for (auto block_begin = size_t{0}; block_begin < size; block_begin += BLOCK_SIZE) {
+    const auto block_size = std::min(BLOCK_SIZE, size - block_begin);
+    attribute_vector.decode_into(block_begin, block_size, value_ids.data());
+
+    for (auto index = size_t{0}; index < block_size; ++index) {
+      functor(static_cast<ChunkOffset>(block_begin + index), static_cast<ValueID>(value_ids[index]));
+    }
+  }
+}
+
 // Materialize the values in the segment
 template <typename Container>
 void materialize_values(const BaseSegment& segment, Container& container) {
   using ContainerValueType = typename Container::value_type;
 
   resolve_segment_type<ContainerValueType>(segment, [&](const auto& typed_segment) {
-    create_iterable_from_segment<ContainerValueType>(typed_segment).materialize_values(container);
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, DictionarySegment<ContainerValueType>>) {
+      const auto& dictionary = *typed_segment.dictionary();
+      const auto null_value_id = typed_segment.null_value_id();
+
+      auto index = container.size();
+      container.resize(container.size() + typed_segment.size());
+      for_each_value_id(*typed_segment.attribute_vector(), [&](const auto /* chunk_offset */, const auto value_id) {
+        container[index++] = value_id == null_value_id ? ContainerValueType{} : dictionary[value_id];
+      });
+    } else {
+      create_iterable_from_segment<ContainerValueType>(typed_segment).materialize_values(container);
+    }
   });
 }
 
@@ -37,7 +82,21 @@ void materialize_values_and_nulls(const BaseSegment& segment, Container& contain
   using ContainerValueType = typename Container::value_type::second_type;
 
   resolve_segment_type<ContainerValueType>(segment, [&](const auto& typed_segment) {
-    create_iterable_from_segment<ContainerValueType>(typed_segment).materialize_values_and_nulls(container);
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, DictionarySegment<ContainerValueType>>) {
+      const auto& dictionary = *typed_segment.dictionary();
+      const auto null_value_id = typed_segment.null_value_id();
+
+      auto index = container.size();
+      container.resize(container.size() + typed_segment.size());
+      for_each_value_id(*typed_segment.attribute_vector(), [&](const auto /* chunk_offset */, const auto value_id) {
+        const auto is_null = value_id == null_value_id;
+        container[index++] = std::make_pair(is_null, is_null ? ContainerValueType{} : dictionary[value_id]);
+      });
+    } else {
+      create_iterable_from_segment<ContainerValueType>(typed_segment).materialize_values_and_nulls(container);
+    }
   });
 }
 
@@ -49,4 +108,45 @@ void materialize_nulls(const BaseSegment& segment, Container& container) {
   });
 }
 
+/**
+ * Copies the @param length values from the @param source_offset of the segment (of any type and encoding, including
+ * ReferenceSegments) to the @param target_offset of the @param target, which must already hold these positions. The
+ * type of the segment is resolved once for all values instead of going through an AllTypeVariant per value, values of
+ * another data type are converted with type_cast(). NULLs can only be copied to a nullable target.
+ */
+template <typename T>
+void materialize_into_value_segment(const BaseSegment& segment, const ChunkOffset source_offset,
+                                    const ChunkOffset length, ValueSegment<T>& target,
+                                    const ChunkOffset target_offset) {
+  DebugAssert(source_offset + length <= segment.size(), "Source range out of bounds");
+  DebugAssert(target_offset + length <= target.size(), "Target range out of bounds");
+
+  auto& values = target.values();
+  auto* const null_values = target.is_nullable() ? &target.null_values() : nullptr;
+
+  segment_with_iterators(segment, [&](auto iter, const auto& /* end */) {
+    using SegmentValueType = std::decay_t<decltype((*iter).value())>;
+
+    // The iterators only support forward traversal
+    std::advance(iter, source_offset);
+
+    for (auto index = target_offset; index < target_offset + length; ++index, ++iter) {
+      const auto& position = *iter;
+      if (position.is_null()) {
+        Assert(null_values, "Cannot insert NULL into NOT NULL target");
+        values[index] = T{};
+        (*null_values)[index] = true;
+        continue;
+      }
+
+      if constexpr (std::is_same_v<SegmentValueType, T>) {
+        values[index] = position.value();
+      } else {
+        values[index] = type_cast<T>(position.value());
+      }
+      if (null_values) (*null_values)[index] = false;
+    }
+  });
+}
+
 }  // namespace opossum
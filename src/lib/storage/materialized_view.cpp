@@ -0,0 +1,372 @@
+#include "materialized_view.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "operators/abstract_join_operator.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "optimizer/optimizer.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<Table> create_table(const AbstractLQPNode& lqp) {
+  const auto& column_expressions = lqp.column_expressions();
+
+  // The columns are nullable, as the aggregates of empty groups are NULL
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < column_expressions.size(); ++column_id) {
+    const auto& column_name = lqp.type == LQPNodeType::Alias ? static_cast<const AliasNode&>(lqp).aliases[column_id]
+                                                             : column_expressions[column_id]->as_column_name();
+    column_definitions.emplace_back(column_name, column_expressions[column_id]->data_type(), true);
+  }
+
+  return std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+}
+
+bool contain_subselects(const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto contain_subselects = false;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPSelect) contain_subselects = true;
+      return contain_subselects ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+    });
+  }
+  return contain_subselects;
+}
+
+/**
+ * Whether @param op computes its output row by row from the rows of validated tables, so that its output for the
+ * union of two sets of rows of a table is the union of its outputs for both sets. Collects the GetTables in
+ * @param get_tables.
+ */
+bool is_linear(const std::shared_ptr<AbstractOperator>& op, const bool is_validated,
+               std::vector<std::shared_ptr<AbstractOperator>>& get_tables) {
+  const auto inputs_are_linear = [&](const bool inputs_are_validated) {
+    return is_linear(op->mutable_input_left(), inputs_are_validated, get_tables) &&
+           (!op->input_right() || is_linear(op->mutable_input_right(), inputs_are_validated, get_tables));
+  };
+
+  switch (op->type()) {
+    case OperatorType::GetTable:
+      if (std::find(get_tables.cbegin(), get_tables.cend(), op) == get_tables.cend()) get_tables.emplace_back(op);
+      return is_validated;
+
+    case OperatorType::Validate:
+      return inputs_are_linear(true);
+
+    case OperatorType::Alias:
+    case OperatorType::UnionPositions:
+      return inputs_are_linear(is_validated);
+
+    case OperatorType::Projection:
+      return !contain_subselects(static_cast<const Projection&>(*op).expressions) && inputs_are_linear(is_validated);
+
+    case OperatorType::TableScan:
+      return !contain_subselects({static_cast<const TableScan&>(*op).predicate()}) && inputs_are_linear(is_validated);
+
+    case OperatorType::JoinAdaptive:
+    case OperatorType::JoinHash:
+    case OperatorType::JoinNestedLoop:
+    case OperatorType::JoinSortMerge:
+    case OperatorType::Product: {
+      if (op->type() != OperatorType::Product &&
+          static_cast<const AbstractJoinOperator&>(*op).mode() != JoinMode::Inner) {
+        return false;
+      }
+
+      // Both inputs must read different GetTables, which is not the case if the LQPTranslator shared an equal subplan
+      // between them (e.g., for a self-join), as the delta of the join is computed by replacing one GetTable at a time
+      auto left_get_tables = std::vector<std::shared_ptr<AbstractOperator>>{};
+      auto right_get_tables = std::vector<std::shared_ptr<AbstractOperator>>{};
+      if (!is_linear(op->mutable_input_left(), is_validated, left_get_tables) ||
+          !is_linear(op->mutable_input_right(), is_validated, right_get_tables)) {
+        return false;
+      }
+
+      for (const auto& get_table : right_get_tables) {
+        if (std::find(left_get_tables.cbegin(), left_get_tables.cend(), get_table) != left_get_tables.cend()) {
+          return false;
+        }
+        left_get_tables.emplace_back(get_table);
+      }
+      for (const auto& get_table : left_get_tables) {
+        if (std::find(get_tables.cbegin(), get_tables.cend(), get_table) == get_tables.cend()) {
+          get_tables.emplace_back(get_table);
+        }
+      }
+      return true;
+    }
+
+    default:
+      return false;
+  }
+}
+
+void execute_pqp(const std::shared_ptr<AbstractOperator>& pqp,
+                 const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+  if (transaction_context) pqp->set_transaction_context_recursively(transaction_context);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes));
+}
+
+// The rows that were inserted into a table between two snapshots, unless rows were deleted in the meantime
+struct TableChanges {
+  bool has_deletes{false};
+  std::shared_ptr<PosList> inserted_rows = std::make_shared<PosList>();
+};
+
+TableChanges find_changes(const Table& table, const CommitID from_commit_id, const CommitID to_commit_id) {
+  auto changes = TableChanges{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk->has_mvcc_data()) continue;
+
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+
+    // Chunks that Validate found to be unchanged since the first snapshot do not need to be looked at
+    const auto max_begin_cid = mvcc_data->max_begin_cid_of_visible_rows();
+    if (max_begin_cid && *max_begin_cid <= from_commit_id) continue;
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto begin_cid = mvcc_data->begin_cids[chunk_offset];
+      const auto end_cid = mvcc_data->end_cids[chunk_offset];
+
+      if (from_commit_id < end_cid && end_cid <= to_commit_id) {
+        changes.has_deletes = true;
+        return changes;
+      }
+
+      if (from_commit_id < begin_cid && begin_cid <= to_commit_id && to_commit_id < end_cid) {
+        changes.inserted_rows->emplace_back(chunk_id, chunk_offset);
+      }
+    }
+  }
+
+  return changes;
+}
+
+// The rows of a table that are visible to a snapshot
+std::shared_ptr<PosList> find_visible_rows(const Table& table, const CommitID snapshot_commit_id) {
+  auto visible_rows = std::make_shared<PosList>();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk->has_mvcc_data()) continue;
+
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->begin_cids[chunk_offset] <= snapshot_commit_id &&
+          snapshot_commit_id < mvcc_data->end_cids[chunk_offset]) {
+        visible_rows->emplace_back(chunk_id, chunk_offset);
+      }
+    }
+  }
+
+  return visible_rows;
+}
+
+// A TableWrapper in place of a GetTable, which outputs only the @param rows of the table
+std::shared_ptr<AbstractOperator> wrap_rows(const std::shared_ptr<const Table>& table,
+                                            const std::shared_ptr<const PosList>& rows) {
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, rows));
+  }
+  const auto referencing_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  referencing_table->append_chunk(segments);
+
+  return std::make_shared<TableWrapper>(referencing_table);
+}
+
+}  // namespace
+
+MaterializedView::MaterializedView(const std::string& table_name, const std::shared_ptr<AbstractLQPNode>& lqp)
+    : lqp(lqp->deep_copy()), _table_name(table_name), _table(create_table(*lqp)) {
+  _pqp = LQPTranslator{}.translate_node(Optimizer::create_default_optimizer()->optimize(lqp->deep_copy()));
+
+  // The Aggregate needs to be reached from the root through operators with a single input, which are applied to the
+  // merged aggregates
+  auto aggregate = _pqp;
+  while (aggregate->type() != OperatorType::Aggregate) {
+    if (!aggregate->input_left() || aggregate->input_right()) return;
+    aggregate = aggregate->mutable_input_left();
+  }
+
+  for (const auto& aggregate_column_definition : static_cast<const Aggregate&>(*aggregate).aggregates()) {
+    const auto function = aggregate_column_definition.function;
+    if (function != AggregateFunction::Min && function != AggregateFunction::Max &&
+        function != AggregateFunction::Sum && function != AggregateFunction::Count) {
+      return;
+    }
+  }
+
+  auto get_tables = std::vector<std::shared_ptr<AbstractOperator>>{};
+  if (!is_linear(aggregate->mutable_input_left(), false, get_tables)) return;
+
+  _aggregate = aggregate;
+  _get_tables = std::move(get_tables);
+}
+
+std::shared_ptr<Table> MaterializedView::table() const { return _table; }
+
+bool MaterializedView::is_incremental() const { return _aggregate != nullptr; }
+
+bool MaterializedView::refresh() {
+  const auto lock = std::lock_guard<std::mutex>{_refresh_mutex};
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  auto result = std::shared_ptr<AbstractOperator>{};
+  auto aggregates = std::shared_ptr<const Table>{};
+  auto is_incremental = false;
+  if (_aggregate) {
+    if (_snapshot_commit_id) aggregates = _compute_aggregates(transaction_context, *_snapshot_commit_id);
+    is_incremental = aggregates != nullptr;
+
+    if (!aggregates) {
+      const auto aggregate = _aggregate->deep_copy();
+      execute_pqp(aggregate, transaction_context);
+      aggregates = aggregate->get_output();
+    }
+
+    auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+    copied_ops.emplace(_aggregate.get(), std::make_shared<TableWrapper>(aggregates));
+    result = _pqp->deep_copy(copied_ops);
+  } else {
+    result = _pqp->deep_copy();
+  }
+  execute_pqp(result, transaction_context);
+
+  // Replace the rows of the table in a single transaction, so that readers see either the previous or the new result
+  const auto get_table = std::make_shared<GetTable>(_table_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto delete_operator = std::make_shared<Delete>(validate);
+  const auto insert = std::make_shared<Insert>(_table_name, result);
+  for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{get_table, validate, delete_operator, insert}) {
+    op->set_transaction_context(transaction_context);
+    op->execute();
+  }
+  Assert(!delete_operator->execute_failed() && !insert->execute_failed(),
+         "The table of a materialized view must only be modified by refresh()");
+  transaction_context->commit();
+
+  _aggregates = aggregates;
+  _snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  return is_incremental;
+}
+
+std::shared_ptr<const Table> MaterializedView::_compute_aggregates(
+    const std::shared_ptr<TransactionContext>& transaction_context, const CommitID previous_snapshot_commit_id) const {
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  // A table that the view reads several times (e.g., in a self-join) is only looked at once
+  auto changes_by_table_name = std::unordered_map<std::string, TableChanges>{};
+  for (const auto& get_table : _get_tables) {
+    const auto& table_name = static_cast<const GetTable&>(*get_table).table_name();
+    if (changes_by_table_name.count(table_name)) continue;
+
+    auto changes =
+        find_changes(*StorageManager::get().get_table(table_name), previous_snapshot_commit_id, snapshot_commit_id);
+    if (changes.has_deletes) return nullptr;
+    changes_by_table_name.emplace(table_name, std::move(changes));
+  }
+
+  // For the inserted rows of each GetTable, compute the aggregates of the view with the inserted rows only, with the
+  // current rows of the previous GetTables, and with the previous rows of the following ones
+  auto aggregates = std::vector<std::shared_ptr<const Table>>{_aggregates};
+  auto previous_rows_by_table_name = std::unordered_map<std::string, std::shared_ptr<const PosList>>{};
+  for (auto delta_index = size_t{0}; delta_index < _get_tables.size(); ++delta_index) {
+    const auto& table_name = static_cast<const GetTable&>(*_get_tables[delta_index]).table_name();
+    const auto& inserted_rows = changes_by_table_name[table_name].inserted_rows;
+    if (inserted_rows->empty()) continue;
+
+    auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+    copied_ops.emplace(_get_tables[delta_index].get(),
+                       wrap_rows(StorageManager::get().get_table(table_name), inserted_rows));
+
+    for (auto get_table_index = delta_index + 1; get_table_index < _get_tables.size(); ++get_table_index) {
+      const auto& previous_table_name = static_cast<const GetTable&>(*_get_tables[get_table_index]).table_name();
+      if (changes_by_table_name[previous_table_name].inserted_rows->empty()) continue;
+
+      const auto previous_table = StorageManager::get().get_table(previous_table_name);
+      auto& previous_rows = previous_rows_by_table_name[previous_table_name];
+      if (!previous_rows) previous_rows = find_visible_rows(*previous_table, previous_snapshot_commit_id);
+      copied_ops.emplace(_get_tables[get_table_index].get(), wrap_rows(previous_table, previous_rows));
+    }
+
+    const auto aggregate = _aggregate->deep_copy(copied_ops);
+    execute_pqp(aggregate, transaction_context);
+    aggregates.emplace_back(aggregate->get_output());
+  }
+
+  if (aggregates.size() == 1) return _aggregates;
+  return _merge_aggregates(aggregates);
+}
+
+std::shared_ptr<const Table> MaterializedView::_merge_aggregates(
+    const std::vector<std::shared_ptr<const Table>>& aggregates) const {
+  auto column_definitions = aggregates.front()->column_definitions();
+  for (auto& column_definition : column_definitions) column_definition.nullable = true;
+
+  const auto all_aggregates = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto& aggregates_table : aggregates) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < aggregates_table->chunk_count(); ++chunk_id) {
+      all_aggregates->append_chunk(aggregates_table->get_chunk(chunk_id)->segments());
+    }
+  }
+
+  // The counts are added up, the other aggregates are aggregated again with the same function
+  const auto& aggregate = static_cast<const Aggregate&>(*_aggregate);
+  const auto group_by_column_count = aggregate.groupby_column_ids().size();
+
+  auto group_by_column_ids = std::vector<ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < group_by_column_count; ++column_id) {
+    group_by_column_ids.emplace_back(column_id);
+  }
+
+  auto aggregate_column_definitions = std::vector<AggregateColumnDefinition>{};
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregate.aggregates().size(); ++aggregate_idx) {
+    const auto function = aggregate.aggregates()[aggregate_idx].function;
+    const auto column_id = ColumnID{static_cast<ColumnID::base_type>(group_by_column_count + aggregate_idx)};
+    aggregate_column_definitions.emplace_back(column_id,
+                                              function == AggregateFunction::Count ? AggregateFunction::Sum : function);
+  }
+
+  const auto merged_aggregates = std::make_shared<Aggregate>(std::make_shared<TableWrapper>(all_aggregates),
+                                                             aggregate_column_definitions, group_by_column_ids);
+  execute_pqp(merged_aggregates);
+
+  return merged_aggregates->get_output();
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class Table;
+class TransactionContext;
+
+/**
+ * A materialized view stores the result of its LQP as a regular table with MVCC in the StorageManager, under the name
+ * of the view (see StorageManager::add_materialized_view()). Queries can read it by its name, and the
+ * MaterializedViewRule rewrites the subplans of queries that equal the LQP of the view to read the table instead.
+ *
+ * The table holds the result as of the last refresh(), which replaces its rows in a transaction. If the LQP
+ * aggregates with SUM, COUNT, MIN, and MAX over inner joins, scans, and projections of validated tables, refresh()
+ * maintains the result incrementally: It finds the rows that were committed since the snapshot of the last refresh
+ * in the MVCC data of the tables, computes the aggregates for joining them with the other tables (following
+ * delta(A JOIN B) = delta(A) JOIN B_new + A_old JOIN delta(B)), and merges them into the previous aggregates, which it
+ * keeps. Once rows of one of the tables were deleted, the aggregates are recomputed, because MIN and MAX cannot take
+ * rows back. Operators above the aggregate (e.g., HAVING, ORDER BY, or projections) are applied to the merged
+ * aggregates. All other views are recomputed on every refresh().
+ */
+class MaterializedView {
+ public:
+  // The LQP is optimized and translated once, so that its PQP can be re-executed by every refresh()
+  MaterializedView(const std::string& table_name, const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // The table of the result, which is empty until the first refresh()
+  std::shared_ptr<Table> table() const;
+
+  // Whether refresh() can maintain the result incrementally, see above
+  bool is_incremental() const;
+
+  /**
+   * Brings the table up to date with the snapshot of a new transaction. Needs the table to be in the StorageManager.
+   * @return Whether the result was maintained incrementally
+   */
+  bool refresh();
+
+  // The unoptimized LQP of the view, which the MaterializedViewRule looks for
+  const std::shared_ptr<AbstractLQPNode> lqp;
+
+ protected:
+  std::shared_ptr<const Table> _compute_aggregates(const std::shared_ptr<TransactionContext>& transaction_context,
+                                                   const CommitID previous_snapshot_commit_id) const;
+  std::shared_ptr<const Table> _merge_aggregates(const std::vector<std::shared_ptr<const Table>>& aggregates) const;
+
+  const std::string _table_name;
+  const std::shared_ptr<Table> _table;
+
+  std::shared_ptr<AbstractOperator> _pqp;
+
+  // Only set if the view is maintained incrementally: The Aggregate of the _pqp, and the GetTables of its input
+  std::shared_ptr<AbstractOperator> _aggregate;
+  std::vector<std::shared_ptr<AbstractOperator>> _get_tables;
+
+  // The result of the _aggregate as of the last refresh, and the snapshot of that refresh
+  std::shared_ptr<const Table> _aggregates;
+  std::optional<CommitID> _snapshot_commit_id;
+
+  std::mutex _refresh_mutex;
+};
+
+}  // namespace opossum
@@ -1,12 +1,13 @@
 #include "mvcc_data.hpp"
 
-#include <shared_mutex>
-
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-MvccData::MvccData(const size_t size) { grow_by(size, 0); }
+MvccData::MvccData(const size_t size, const PolymorphicAllocator<size_t>& alloc)
+    : tids(alloc), begin_cids(alloc), end_cids(alloc) {
+  grow_by(size, 0);
+}
 
 size_t MvccData::size() const { return _size; }
 
@@ -17,12 +18,42 @@ void MvccData::shrink() {
 }
 
 void MvccData::grow_by(size_t delta, CommitID begin_cid) {
+  invalidate_visibility_summary();
   _size += delta;
   tids.grow_to_at_least(_size);
   begin_cids.grow_to_at_least(_size, begin_cid);
   end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
 }
 
+std::optional<CommitID> MvccData::max_begin_cid_of_visible_rows() const {
+  const auto max_begin_cid = static_cast<CommitID>(_visibility_summary.load() & 0xFFFFFFFFu);
+  if (max_begin_cid == MAX_COMMIT_ID) return std::nullopt;
+  return max_begin_cid;
+}
+
+uint32_t MvccData::visibility_summary_version() const { return static_cast<uint32_t>(_visibility_summary.load() >> 32); }
+
+void MvccData::set_max_begin_cid_of_visible_rows(const CommitID max_begin_cid,
+                                                 const uint32_t visibility_summary_version) {
+  DebugAssert(max_begin_cid != MAX_COMMIT_ID, "Rows with a begin_cid of MAX_COMMIT_ID are not visible");
+
+  const auto version_bits = static_cast<uint64_t>(visibility_summary_version) << 32;
+
+  // Only publish the summary if no invalidation happened since the version was retrieved. If it fails, we simply keep
+  // the invalidated state.
+  auto expected = version_bits | MAX_COMMIT_ID;
+  _visibility_summary.compare_exchange_strong(expected, version_bits | max_begin_cid);
+}
+
+void MvccData::invalidate_visibility_summary() {
+  auto expected = _visibility_summary.load();
+  while (true) {
+    const auto next_version = (expected >> 32) + 1;
+    const auto desired = ((next_version << 32) & 0xFFFFFFFF00000000u) | MAX_COMMIT_ID;
+    if (_visibility_summary.compare_exchange_weak(expected, desired)) break;
+  }
+}
+
 void MvccData::print(std::ostream& stream) const {
   stream << "TIDs: ";
   for (const auto& tid : tids) stream << tid << ", ";
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <atomic>
-#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <limits>
+#include <optional>
 
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -18,18 +19,22 @@ struct MvccData {
   // The last commit id is reserved for uncommitted changes
   static constexpr CommitID MAX_COMMIT_ID = std::numeric_limits<CommitID>::max() - 1;
 
-  pmr_concurrent_vector<copyable_atomic<TransactionID>> tids;  ///< 0 unless locked by a transaction
-  pmr_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
-  pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
+  // Locks the rows while the chunk replaces its MVCC data with a shrunk copy, see Chunk::shrink_mvcc_data()
+  static constexpr TransactionID SHRINK_TRANSACTION_ID = std::numeric_limits<TransactionID>::max();
 
-  explicit MvccData(const size_t size);
+  pmr_tbb_concurrent_vector<copyable_atomic<TransactionID>> tids;  ///< 0 unless locked by a transaction
+  pmr_tbb_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
+  pmr_tbb_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
+
+  // The vectors are allocated using @param alloc, usually that of the chunk, so that they live on its NUMA node
+  explicit MvccData(const size_t size, const PolymorphicAllocator<size_t>& alloc = {});
 
   size_t size() const;
 
   /**
    * Compacts the internal representation of
    * the mvcc data in order to reduce fragmentation
-   * Locks mvcc data exclusively in order to do so
+   * Not thread-safe, Chunk::shrink_mvcc_data() calls it on a copy before other threads can access it
    */
   void shrink();
 
@@ -40,19 +45,30 @@ struct MvccData {
    */
   void grow_by(size_t delta, CommitID begin_cid);
 
-  void print(std::ostream& stream = std::cout) const;
-
- private:
   /**
-   * @brief Mutex used to manage access to MVCC data
+   * Chunk-level visibility summary ("watermark") that allows Validate to skip the per-row visibility check.
+   *
+   * If set, all rows are unlocked (tid == 0), none of them has been deleted (end_cid == MAX_COMMIT_ID), and all
+   * begin_cids are smaller than or equal to the returned CommitID. In that case, every row is visible to every
+   * transaction whose snapshot_commit_id is at least the returned CommitID.
    *
-   * Exclusively locked in shrink()
-   * Locked for shared ownership when MVCC data of a Chunk are accessed
-   * via the get_scoped_mvcc_data_lock() getters
+   * The summary is computed by Validate when it checks all rows of a chunk anyway. Every operation that locks,
+   * inserts, or deletes rows invalidates it. To avoid publishing a summary that was computed from data that has been
+   * modified in the meantime, the summary is versioned: Get the version before checking the rows and pass it to
+   * set_max_begin_cid_of_visible_rows(), which only publishes the summary if there was no invalidation in between.
    */
-  std::shared_mutex _mutex;
+  std::optional<CommitID> max_begin_cid_of_visible_rows() const;
+  uint32_t visibility_summary_version() const;
+  void set_max_begin_cid_of_visible_rows(const CommitID max_begin_cid, const uint32_t visibility_summary_version);
+  void invalidate_visibility_summary();
 
+  void print(std::ostream& stream = std::cout) const;
+
+ private:
   size_t _size{0};
+
+  // The upper 32 bits hold the version, the lower 32 bits the max begin_cid (or MAX_COMMIT_ID if there is no summary)
+  std::atomic<uint64_t> _visibility_summary{MAX_COMMIT_ID};
 };
 
 }  // namespace opossum
@@ -0,0 +1,184 @@
+#include "mvcc_garbage_collector.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the fraction of rows that were deleted or whose insert was rolled back
+float invalid_row_fraction(const Chunk& chunk) {
+  const auto chunk_size = chunk.size();
+  if (chunk_size == 0) return 0.0f;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  auto invalid_row_count = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (mvcc_data->end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) ++invalid_row_count;
+  }
+
+  return static_cast<float>(invalid_row_count) / static_cast<float>(chunk_size);
+}
+
+}  // namespace
+
+namespace opossum {
+
+MvccGarbageCollector::MvccGarbageCollector() {
+  _collection_thread = std::make_unique<PausableLoopThread>(_options.collection_interval, [this](size_t) {
+    remove_compacted_chunks();
+    compact_chunks();
+  });
+}
+
+size_t MvccGarbageCollector::compact_chunks() {
+  auto compacted_chunk_count = size_t{0};
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    if (table->type() != TableType::Data || table->has_mvcc() != UseMvcc::Yes) continue;
+
+    // Inserts only go to the last chunk, or to the last chunk of each partition if the table is partitioned
+    const auto chunk_count = table->chunk_count();
+    for (ChunkID chunk_id{0}; chunk_id + 1 < chunk_count; ++chunk_id) {
+      if (compacted_chunk_count == _options.max_chunks_per_iteration) return compacted_chunk_count;
+
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->cleanup_commit_id() || invalid_row_fraction(*chunk) < _options.min_invalid_row_fraction) continue;
+      if (table->partition_schema() && table->last_chunk_id_of_partition(chunk->partition_id()) == chunk_id) continue;
+
+      if (compact_chunk(table_name, chunk_id)) ++compacted_chunk_count;
+    }
+  }
+
+  return compacted_chunk_count;
+}
+
+bool MvccGarbageCollector::compact_chunk(const std::string& table_name, const ChunkID chunk_id) {
+  const auto table = StorageManager::get().get_table(table_name);
+  const auto chunk = table->get_chunk(chunk_id);
+  Assert(!chunk->cleanup_commit_id(), "Chunk has been compacted already");
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  // Find the rows that are visible to the transaction. If the chunk holds rows that are still being inserted, or
+  // whose insert is not visible to the transaction yet, they would be lost.
+  const auto pos_list = std::make_shared<PosList>();
+  pos_list->guarantee_single_chunk();
+  {
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->begin_cids[chunk_offset] > snapshot_commit_id) {
+        transaction_context->rollback();
+        return false;
+      }
+
+      if (snapshot_commit_id < mvcc_data->end_cids[chunk_offset]) pos_list->emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  if (!pos_list->empty()) {
+    // What Validate would output for the chunk
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    const auto referencing_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+    referencing_table->append_chunk(segments);
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(referencing_table);
+    table_wrapper->execute();
+
+    // Other transactions might have locked the rows, we retry later then
+    const auto delete_operator = std::make_shared<Delete>(table_wrapper);
+    delete_operator->set_transaction_context(transaction_context);
+    delete_operator->execute();
+    if (delete_operator->execute_failed()) {
+      transaction_context->rollback();
+      return false;
+    }
+
+    const auto insert_operator = std::make_shared<Insert>(table_name, table_wrapper);
+    insert_operator->set_transaction_context(transaction_context);
+    insert_operator->execute();
+    if (insert_operator->execute_failed()) {
+      transaction_context->rollback();
+      return false;
+    }
+  }
+
+  transaction_context->commit();
+  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+
+  // The moved rows are still valid
+  const auto table_statistics = table->table_statistics();
+  if (table_statistics) table_statistics->decrease_invalid_row_count(pos_list->size());
+
+  // Transactions that start from now on see the mark and skip the chunk (see GetTable)
+  auto lock = std::lock_guard<std::mutex>{_compacted_chunks_mutex};
+  _compacted_chunks.emplace_back(
+      CompactedChunk{table, chunk_id, chunk, TransactionManager::get().next_transaction_id()});
+
+  return true;
+}
+
+size_t MvccGarbageCollector::remove_compacted_chunks() {
+  auto removed_chunk_count = size_t{0};
+  const auto lowest_active_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+  const auto lowest_active_transaction_id = TransactionManager::get().lowest_active_transaction_id();
+
+  auto lock = std::lock_guard<std::mutex>{_compacted_chunks_mutex};
+
+  const auto compacted_chunks_end = std::remove_if(
+      _compacted_chunks.begin(), _compacted_chunks.end(), [&](const CompactedChunk& compacted_chunk) {
+        const auto table = compacted_chunk.table.lock();
+        const auto chunk = compacted_chunk.chunk.lock();
+
+        // The table was dropped, or the chunk was replaced in the meantime
+        if (!table || !chunk || table->get_chunk(compacted_chunk.chunk_id) != chunk) return true;
+
+        // A transaction with an older snapshot might see rows of the chunk, and a transaction that started before the
+        // chunk was marked might look at it, even though it sees none of its rows.
+        if (*chunk->cleanup_commit_id() > lowest_active_snapshot_commit_id ||
+            compacted_chunk.first_informed_transaction_id > lowest_active_transaction_id) {
+          return false;
+        }
+
+        table->remove_chunk(compacted_chunk.chunk_id);
+        ++removed_chunk_count;
+        return true;
+      });
+  _compacted_chunks.erase(compacted_chunks_end, _compacted_chunks.end());
+
+  return removed_chunk_count;
+}
+
+const MvccGarbageCollector::Options& MvccGarbageCollector::options() const { return _options; }
+
+void MvccGarbageCollector::set_options(const Options& options) {
+  _options = options;
+  _collection_thread->set_loop_sleep_time(_options.collection_interval);
+}
+
+void MvccGarbageCollector::resume() { _collection_thread->resume(); }
+
+void MvccGarbageCollector::pause() { _collection_thread->pause(); }
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// The MvccGarbageCollector is a singleton that removes the rows that Deletes and Updates invalidated from the chunks
+// of the tables in the StorageManager in the background. Otherwise, scans, Validate and memory keep paying for them.
+//
+// Rows cannot be removed from a chunk in place, as RowIDs refer to them. Instead, the collector works in two steps:
+//
+//  1. Compaction: Chunks in which enough rows are invalid are compacted in a transaction that deletes their visible
+//     rows and inserts them again at the end of the table, where the ChunkCompressionManager encodes them once their
+//     chunks are complete. As this is a regular transaction, it conflicts with concurrent writes to the same rows (in
+//     which case the chunk is retried later) and it is written to the redo log. The compacted chunk is marked with the
+//     commit id of the transaction, so that GetTable skips it for all later snapshots.
+//  2. Removal: Once all transactions that started before the chunk was marked are done, no transaction looks at it
+//     anymore, and it is replaced by an empty chunk (see Table::remove_chunk()).
+//
+// Like the ChunkCompressionManager, it is initialized in a paused state and needs to be `resumed` to start its
+// operation.
+class MvccGarbageCollector : public Singleton<MvccGarbageCollector> {
+ public:
+  struct Options {
+    // The time interval at which the chunks are looked at
+    std::chrono::milliseconds collection_interval = std::chrono::seconds(1);
+
+    // Chunks in which at least this fraction of the rows is invalid are compacted
+    float min_invalid_row_fraction = 0.5f;
+
+    // Maximum number of chunks that are compacted per loop iteration, each in a transaction of its own
+    size_t max_chunks_per_iteration = 8;
+  };
+
+  /**
+   * Compacts up to max_chunks_per_iteration chunks of the tables in the StorageManager that are no longer filled by
+   * inserts and have at least min_invalid_row_fraction invalid rows.
+   * @return The number of chunks that have been compacted
+   */
+  size_t compact_chunks();
+
+  /**
+   * Compacts the chunk in a transaction, see above. Fails if the transaction conflicts with another one, or if the
+   * chunk holds rows of transactions that are not visible to it yet.
+   * @return Whether the chunk has been compacted
+   */
+  bool compact_chunk(const std::string& table_name, const ChunkID chunk_id);
+
+  /**
+   * Removes the compacted chunks that no transaction looks at anymore.
+   * @return The number of chunks that have been removed
+   */
+  size_t remove_compacted_chunks();
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  MvccGarbageCollector(MvccGarbageCollector&&) = delete;
+
+ protected:
+  MvccGarbageCollector();
+
+  friend class Singleton;
+
+  // A chunk that was compacted, but not removed yet
+  struct CompactedChunk {
+    std::weak_ptr<Table> table;
+    ChunkID chunk_id;
+    std::weak_ptr<Chunk> chunk;
+
+    // Transactions whose id is at least this one know that the chunk was compacted
+    TransactionID first_informed_transaction_id;
+  };
+
+  Options _options;
+
+  std::mutex _compacted_chunks_mutex;
+  std::vector<CompactedChunk> _compacted_chunks;
+
+  std::unique_ptr<PausableLoopThread> _collection_thread;
+};
+
+}  // namespace opossum
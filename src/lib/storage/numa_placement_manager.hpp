@@ -40,7 +40,9 @@ class NUMAPlacementManager : public Singleton<NUMAPlacementManager> {
           migration_interval(std::chrono::seconds(10)),
           counter_history_range(std::chrono::seconds(7)),
           migration_count(3),
-          imbalance_threshold(0.1) {}
+          imbalance_threshold(0.1),
+          affinity_threshold(0.6),
+          interleaved_table_max_chunk_count(16) {}
 
     // The time interval at which a snaphsot of the current access time counters
     // of all stored chunks are preserved. These access times are the basis to
@@ -64,6 +66,14 @@ class NUMAPlacementManager : public Singleton<NUMAPlacementManager> {
     // The threshold for the load imbalance metric between the NUMA nodes.
     // If the imbalance is less than this threshold, no chunks are migrated.
     double imbalance_threshold = 0.1;
+
+    // The share of the accesses to a chunk that the workers of a single node need
+    // to account for, so that the chunk is migrated to that node
+    double affinity_threshold = 0.6;
+
+    // Chunks of tables with at most this number of chunks that are accessed by the
+    // workers of all nodes (e.g., dimension tables) are interleaved across the nodes
+    size_t interleaved_table_max_chunk_count = 16;
   };
 
   // Returns the memory resource of the next node according to a round robin placement policy
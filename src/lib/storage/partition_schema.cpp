@@ -0,0 +1,156 @@
+#include "partition_schema.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Int and Long as well as Float and Double values are widened to the same type, so that they compare and hash alike
+DataType widened_data_type(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+    case DataType::Long:
+      return DataType::Long;
+    case DataType::Float:
+    case DataType::Double:
+      return DataType::Double;
+    default:
+      return data_type;
+  }
+}
+
+AllTypeVariant widen(const AllTypeVariant& value) {
+  switch (widened_data_type(data_type_from_all_type_variant(value))) {
+    case DataType::Long:
+      return type_cast_variant<int64_t>(value);
+    case DataType::Double:
+      return type_cast_variant<double>(value);
+    default:
+      return value;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<PartitionSchema> PartitionSchema::range_partitioning(const ColumnID column_id,
+                                                                     const DataType data_type,
+                                                                     const std::vector<AllTypeVariant>& bounds) {
+  Assert(!bounds.empty(), "Range partitioning needs at least one bound");
+
+  auto widened_bounds = std::vector<AllTypeVariant>{};
+  widened_bounds.reserve(bounds.size());
+  for (const auto& bound : bounds) {
+    Assert(!variant_is_null(bound), "Bounds must not be NULL");
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      widened_bounds.emplace_back(widen(type_cast_variant<ColumnDataType>(bound)));
+    });
+  }
+  for (auto bound_idx = size_t{1}; bound_idx < widened_bounds.size(); ++bound_idx) {
+    Assert(widened_bounds[bound_idx - 1] < widened_bounds[bound_idx], "Bounds must be strictly ascending");
+  }
+
+  return std::shared_ptr<PartitionSchema>(
+      new PartitionSchema(PartitioningType::Range, column_id, data_type, widened_bounds,
+                          PartitionID{static_cast<PartitionID::base_type>(widened_bounds.size() + 1)}));
+}
+
+std::shared_ptr<PartitionSchema> PartitionSchema::hash_partitioning(const ColumnID column_id,
+                                                                    const DataType data_type,
+                                                                    const PartitionID partition_count) {
+  Assert(partition_count > 0, "Hash partitioning needs at least one partition");
+  return std::shared_ptr<PartitionSchema>(
+      new PartitionSchema(PartitioningType::Hash, column_id, data_type, {}, partition_count));
+}
+
+PartitionSchema::PartitionSchema(const PartitioningType type, const ColumnID column_id, const DataType data_type,
+                                 const std::vector<AllTypeVariant>& bounds, const PartitionID partition_count)
+    : _type(type), _column_id(column_id), _data_type(data_type), _bounds(bounds), _partition_count(partition_count) {}
+
+PartitioningType PartitionSchema::type() const { return _type; }
+
+ColumnID PartitionSchema::column_id() const { return _column_id; }
+
+DataType PartitionSchema::data_type() const { return _data_type; }
+
+PartitionID PartitionSchema::partition_count() const { return _partition_count; }
+
+const std::vector<AllTypeVariant>& PartitionSchema::bounds() const { return _bounds; }
+
+PartitionID PartitionSchema::partition_of(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) return PartitionID{0};
+
+  // The value is cast like it is when it is stored in the column
+  auto widened_value = AllTypeVariant{};
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    widened_value = widen(type_cast_variant<ColumnDataType>(value));
+  });
+
+  if (_type == PartitioningType::Range) {
+    const auto bound_iter = std::upper_bound(_bounds.begin(), _bounds.end(), widened_value);
+    return PartitionID{static_cast<PartitionID::base_type>(std::distance(_bounds.begin(), bound_iter))};
+  }
+
+  return PartitionID{static_cast<PartitionID::base_type>(std::hash<AllTypeVariant>{}(widened_value) %
+                                                         _partition_count)};
+}
+
+bool PartitionSchema::can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                                const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) const {
+  DebugAssert(partition_id < _partition_count, "PartitionID out of range");
+
+  if (predicate_condition == PredicateCondition::IsNull) return partition_id != PartitionID{0};
+
+  // Values of another type (e.g., a float compared to an int column) are not cast, as that might change the result
+  const auto is_comparable = [&](const AllTypeVariant& predicate_value) {
+    return !variant_is_null(predicate_value) &&
+           widened_data_type(data_type_from_all_type_variant(predicate_value)) == widened_data_type(_data_type);
+  };
+  if (!is_comparable(value) || (value2 && !is_comparable(*value2))) return false;
+
+  if (_type == PartitioningType::Hash) {
+    return predicate_condition == PredicateCondition::Equals && partition_of(value) != partition_id;
+  }
+
+  // The rows of the partition lie within [lower_bound, upper_bound), where a missing bound is unbounded. The variants
+  // only provide operator<.
+  const auto* lower_bound = partition_id > 0 ? &_bounds[partition_id - 1] : nullptr;
+  const auto* upper_bound = partition_id < _bounds.size() ? &_bounds[partition_id] : nullptr;
+  const auto widened_value = widen(value);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return (lower_bound && widened_value < *lower_bound) || (upper_bound && !(widened_value < *upper_bound));
+    case PredicateCondition::LessThan:
+      return lower_bound && !(*lower_bound < widened_value);
+    case PredicateCondition::LessThanEquals:
+      return lower_bound && widened_value < *lower_bound;
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return upper_bound && !(widened_value < *upper_bound);
+    case PredicateCondition::Between:
+      DebugAssert(value2, "Between needs two values");
+      return (lower_bound && widen(*value2) < *lower_bound) || (upper_bound && !(widened_value < *upper_bound));
+    default:
+      return false;
+  }
+}
+
+bool PartitionSchema::is_compatible_with(const PartitionSchema& other) const {
+  return _type == other._type && widened_data_type(_data_type) == widened_data_type(other._data_type) &&
+         _partition_count == other._partition_count && _bounds == other._bounds;
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class PartitioningType { Range, Hash };
+
+/**
+ * Declares how the rows of a data table are distributed over partitions by the value of one column (see
+ * Table::set_partition_schema()). Each chunk of a partitioned table holds the rows of a single partition only, so that
+ * the ChunkPruningRule can skip all chunks of the partitions that a predicate on the column rules out, JoinHash can
+ * join two tables that are partitioned alike partition by partition, and Table::drop_partition() can remove old rows
+ * without scanning them.
+ *
+ * Range partitioning with the bounds b_0 < ... < b_n-1 creates n + 1 partitions: Partition 0 holds the values below
+ * b_0, partition i the values in [b_i-1, b_i), and partition n those from b_n-1 on. Hash partitioning distributes the
+ * values by their hash. In both cases, NULL values are assigned to partition 0.
+ *
+ * Integral values are compared and hashed as int64_t, and floating point values as double, so that a partitioning on
+ * an int column is compatible with the same partitioning on a long column.
+ */
+class PartitionSchema final {
+ public:
+  static std::shared_ptr<PartitionSchema> range_partitioning(const ColumnID column_id, const DataType data_type,
+                                                             const std::vector<AllTypeVariant>& bounds);
+  static std::shared_ptr<PartitionSchema> hash_partitioning(const ColumnID column_id, const DataType data_type,
+                                                            const PartitionID partition_count);
+
+  PartitioningType type() const;
+  ColumnID column_id() const;
+  DataType data_type() const;
+  PartitionID partition_count() const;
+
+  // The bounds of a range partitioning, cast to the data type of the column
+  const std::vector<AllTypeVariant>& bounds() const;
+
+  // @return The partition of a row with the @param value in the partitioning column
+  PartitionID partition_of(const AllTypeVariant& value) const;
+
+  // @return Whether no row of the partition with the @param partition_id can satisfy the predicate
+  // `column <predicate_condition> value [AND value2]`. This is conservative, i.e., false if it cannot be told.
+  bool can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                 const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  // @return Whether equal values are assigned to the same partition by both schemas, so that tables partitioned by them
+  // can be joined partition by partition on their partitioning columns
+  bool is_compatible_with(const PartitionSchema& other) const;
+
+ private:
+  PartitionSchema(const PartitioningType type, const ColumnID column_id, const DataType data_type,
+                  const std::vector<AllTypeVariant>& bounds, const PartitionID partition_count);
+
+  const PartitioningType _type;
+  const ColumnID _column_id;
+  const DataType _data_type;
+  const std::vector<AllTypeVariant> _bounds;
+  const PartitionID _partition_count;
+};
+
+}  // namespace opossum
@@ -52,12 +52,13 @@ void lqp_bind_placeholders_impl(const std::shared_ptr<AbstractLQPNode>& lqp,
 
 namespace opossum {
 
-PreparedPlan::PreparedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<ParameterID>& parameter_ids)
-    : lqp(lqp), parameter_ids(parameter_ids) {}
+PreparedPlan::PreparedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<ParameterID>& parameter_ids,
+                           const std::string& sql)
+    : lqp(lqp), parameter_ids(parameter_ids), sql(sql) {}
 
 std::shared_ptr<PreparedPlan> PreparedPlan::deep_copy() const {
   const auto lqp_copy = lqp->deep_copy();
-  return std::make_shared<PreparedPlan>(lqp_copy, parameter_ids);
+  return std::make_shared<PreparedPlan>(lqp_copy, parameter_ids, sql);
 }
 
 void PreparedPlan::print(std::ostream& stream) const {
@@ -76,6 +77,9 @@ std::shared_ptr<AbstractLQPNode> PreparedPlan::instantiate(
                                                         std::to_string(parameter_ids.size()) + " got " +
                                                         std::to_string(parameters.size()));
 
+  // Nothing to fill in, so the plan is shared rather than copied for every instantiation
+  if (parameter_ids.empty()) return lqp;
+
   auto parameters_by_id = std::unordered_map<ParameterID, std::shared_ptr<AbstractExpression>>{};
   for (auto parameter_idx = size_t{0}; parameter_idx < parameters.size(); ++parameter_idx) {
     const auto parameter_id = parameter_ids[parameter_idx];
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "types.hpp"
@@ -16,12 +17,14 @@ class AbstractExpression;
  */
 class PreparedPlan final {
  public:
-  PreparedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<ParameterID>& parameter_ids);
+  PreparedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<ParameterID>& parameter_ids,
+               const std::string& sql = "");
 
   std::shared_ptr<PreparedPlan> deep_copy() const;
 
   /**
-   * @return A copy of the prepared plan, with the specified @param parameters filled into the placeholders
+   * @return A copy of the prepared plan, with the specified @param parameters filled into the placeholders. A plan
+   *         without placeholders is not copied, so that the returned LQP must not be modified.
    */
   std::shared_ptr<AbstractLQPNode> instantiate(
       const std::vector<std::shared_ptr<AbstractExpression>>& parameters) const;
@@ -32,6 +35,10 @@ class PreparedPlan final {
 
   std::shared_ptr<AbstractLQPNode> lqp;
   std::vector<ParameterID> parameter_ids;
+
+  // The SQL string of the statement, if known. Prepared statements of the server with the same SQL string share their
+  // optimized LQPs, see BindServerPreparedStatementTask.
+  std::string sql;
 };
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #include "proxy_chunk.hpp"
 
 #include "chunk.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
 
 // Hyrise only supports x86-64 CPUs, therefore relying on RDTSC is fine.
 // Although RDTSCP would provide more accurate cycles counts, the precision
@@ -23,7 +25,9 @@ ProxyChunk::ProxyChunk(const std::shared_ptr<Chunk>& chunk) : _chunk(chunk), _be
 
 ProxyChunk::~ProxyChunk() {
   if (const auto& access_counter = _chunk->access_counter()) {
-    access_counter->increment(rdtsc() - _begin_rdtsc);
+    // The node of the worker, to which the chunk might be migrated (see MigrationPreparationTask)
+    const auto worker = Worker::get_this_thread_worker();
+    access_counter->increment(rdtsc() - _begin_rdtsc, worker ? worker->queue()->node_id() : INVALID_NODE_ID);
   }
 }
 
@@ -0,0 +1,115 @@
+#include "reference_segment_iterable.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/split_pos_list_by_chunk_id.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Sorts the positions of the @param sub_pos_list by their chunk offsets, together with their original positions
+void sort_by_chunk_offset(SubPosList& sub_pos_list) {
+  auto& row_ids = *sub_pos_list.row_ids;
+  const auto is_sorted = std::is_sorted(row_ids.begin(), row_ids.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.chunk_offset < rhs.chunk_offset;
+  });
+  if (is_sorted) return;
+
+  auto offsets = std::vector<std::pair<ChunkOffset, ChunkOffset>>(row_ids.size());
+  for (auto index = size_t{0}; index < row_ids.size(); ++index) {
+    offsets[index] = {row_ids[index].chunk_offset, sub_pos_list.original_positions[index]};
+  }
+  std::sort(offsets.begin(), offsets.end());
+
+  for (auto index = size_t{0}; index < row_ids.size(); ++index) {
+    row_ids[index].chunk_offset = offsets[index].first;
+    sub_pos_list.original_positions[index] = offsets[index].second;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+namespace detail {
+
+template <typename T>
+std::shared_ptr<const GatheredReferenceSegmentValues<T>> GatheredReferenceSegmentValues<T>::gather(
+    const ReferenceSegment& segment) {
+  const auto referenced_table = segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+  const auto& pos_list = segment.pos_list();
+  const auto chunk_count = referenced_table->chunk_count();
+
+  auto gathered_values = std::make_shared<GatheredReferenceSegmentValues<T>>();
+  gathered_values->values.resize(pos_list->size());
+  gathered_values->null_values.resize(pos_list->size(), true);
+
+  // Splitting the PosList creates a PosList for every chunk of the referenced table, which does not pay off for
+  // PosLists that are shorter than that. Their positions are looked up one by one.
+  if (pos_list->references_single_chunk() || pos_list->size() < static_cast<size_t>(chunk_count)) {
+    auto accessors = std::vector<std::shared_ptr<BaseSegmentAccessor<T>>>(chunk_count);
+    for (auto pos_list_offset = size_t{0}; pos_list_offset < pos_list->size(); ++pos_list_offset) {
+      const auto& row_id = (*pos_list)[pos_list_offset];
+      if (row_id.is_null()) continue;
+
+      auto& accessor = accessors[row_id.chunk_id];
+      if (!accessor) {
+        accessor =
+            create_segment_accessor<T>(referenced_table->get_chunk(row_id.chunk_id)->get_segment(referenced_column_id));
+      }
+
+      auto typed_value = accessor->access(row_id.chunk_offset);
+      if (!typed_value) continue;
+      gathered_values->values[pos_list_offset] = std::move(*typed_value);
+      gathered_values->null_values[pos_list_offset] = false;
+    }
+    return gathered_values;
+  }
+
+  auto pos_lists_by_chunk_id = split_pos_list_by_chunk_id(pos_list, chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto& sub_pos_list = pos_lists_by_chunk_id[chunk_id];
+    if (sub_pos_list.row_ids->empty()) continue;
+
+    // The point access iterators of, e.g., RunLengthSegments and LZ4Segments read the values of ascending offsets
+    // without searching or decompressing again
+    sort_by_chunk_offset(sub_pos_list);
+
+    const auto referenced_segment = referenced_table->get_chunk(chunk_id)->get_segment(referenced_column_id);
+    resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        Fail("Found ReferenceSegment pointing to ReferenceSegment");
+      } else {
+        const auto iterable = create_iterable_from_segment<T, false>(typed_segment);
+        iterable.with_iterators(sub_pos_list.row_ids, [&](auto it, const auto end) {
+          for (; it != end; ++it) {
+            const auto& position = *it;
+            if (position.is_null()) continue;
+
+            const auto pos_list_offset = sub_pos_list.original_positions[position.chunk_offset()];
+            gathered_values->values[pos_list_offset] = position.value();
+            gathered_values->null_values[pos_list_offset] = false;
+          }
+        });
+      }
+    });
+  }
+
+  return gathered_values;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(GatheredReferenceSegmentValues);
+
+}  // namespace detail
+
+}  // namespace opossum
@@ -8,9 +8,33 @@
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterables.hpp"
+#include "storage/segment_iteration_specialization.hpp"
 
 namespace opossum {
 
+namespace detail {
+
+// The values of the positions of the PosList of a ReferenceSegment, in its order, and whether they are NULL
+template <typename T>
+struct GatheredReferenceSegmentValues {
+  /**
+   * Dereferences the PosList of a @param segment that references multiple chunks (or a segment type that is not
+   * specialized, see segment_iteration_specialization.hpp). Looking up every position in the segment of its chunk
+   * through a virtual accessor jumps between the referenced segments and, for encoded segments, decodes their blocks
+   * over and over. Instead, the positions are grouped by chunk (see split_pos_list_by_chunk_id()), and each referenced
+   * segment is read once with its own point access iterators in the order of the chunk offsets. The values are
+   * scattered back to their positions.
+   *
+   * Defined in the translation unit, as it is not instantiated per functor of the iterable.
+   */
+  static std::shared_ptr<const GatheredReferenceSegmentValues<T>> gather(const ReferenceSegment& segment);
+
+  std::vector<T> values;
+  std::vector<bool> null_values;
+};
+
+}  // namespace detail
+
 template <typename T>
 class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable<T>> {
  public:
@@ -28,29 +52,39 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     const auto begin_it = pos_list.begin();
     const auto end_it = pos_list.end();
 
+    const auto with_gathered_iterators = [&]() {
+      const auto gathered_values = detail::GatheredReferenceSegmentValues<T>::gather(_segment);
+      auto begin = GatheredIterator{gathered_values, ChunkOffset{0}};
+      auto end = GatheredIterator{gathered_values, static_cast<ChunkOffset>(pos_list.size())};
+      functor(begin, end);
+    };
+
     // If we are guaranteed that the reference segment refers to a single non-NULL chunk, we can do some optimizations.
     // For example, we can use a single, non-virtual segment accessor instead of having to keep multiple and using
     // virtual method calls. If begin_it is NULL, chunk_id will be INVALID_CHUNK_ID. Therefore, we skip this case.
+    // Segment types that are not in the specialization table (see segment_iteration_specialization.hpp) are accessed
+    // like multiple chunks, so that the functor is not instantiated for their accessors. The values of multiple chunks
+    // are gathered chunk by chunk before they are iterated (see GatheredReferenceSegmentValues).
 
     if (pos_list.references_single_chunk() && pos_list.size() > 0 && !begin_it->is_null()) {
       auto referenced_segment = referenced_table->get_chunk(begin_it->chunk_id)->get_segment(referenced_column_id);
       resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_segment) {
         using SegmentType = std::decay_t<decltype(typed_segment)>;
 
-        if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+        if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+          Fail("Found ReferenceSegment pointing to ReferenceSegment");
+        } else if constexpr (is_segment_iteration_specialized<T, SegmentType>()) {
           auto accessor = SegmentAccessor<T, SegmentType>(typed_segment);
 
           auto begin = SingleChunkIterator<decltype(accessor)>{accessor, begin_it, begin_it};
           auto end = SingleChunkIterator<decltype(accessor)>{accessor, begin_it, end_it};
           functor(begin, end);
         } else {
-          Fail("Found ReferenceSegment pointing to ReferenceSegment");
+          with_gathered_iterators();
         }
       });
     } else {
-      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, begin_it, begin_it};
-      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, begin_it, end_it};
-      functor(begin, end);
+      with_gathered_iterators();
     }
   }
 
@@ -103,65 +137,32 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     const Accessor _accessor;
   };
 
-  // The iterator for cases where we potentially iterate over multiple referenced chunks
-  class MultipleChunkIterator : public BaseSegmentIterator<MultipleChunkIterator, SegmentPosition<T>> {
+  // The iterator over the gathered values of a segment that references multiple chunks
+  class GatheredIterator : public BaseSegmentIterator<GatheredIterator, SegmentPosition<T>> {
    public:
     using ValueType = T;
     using IterableType = ReferenceSegmentIterable<T>;
-    using PosListIterator = PosList::const_iterator;
 
    public:
-    explicit MultipleChunkIterator(const std::shared_ptr<const Table>& referenced_table,
-                                   const ColumnID referenced_column_id, const PosListIterator& begin_pos_list_it,
-                                   const PosListIterator& pos_list_it)
-        : _referenced_table{referenced_table},
-          _referenced_column_id{referenced_column_id},
-          _begin_pos_list_it{begin_pos_list_it},
-          _pos_list_it{pos_list_it},
-          _accessors{_referenced_table->chunk_count()} {}
+    explicit GatheredIterator(const std::shared_ptr<const detail::GatheredReferenceSegmentValues<T>>& gathered_values,
+                              const ChunkOffset pos_list_offset)
+        : _gathered_values{gathered_values}, _pos_list_offset{pos_list_offset} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
+    void increment() { ++_pos_list_offset; }
 
-    bool equal(const MultipleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
+    bool equal(const GatheredIterator& other) const { return _pos_list_offset == other._pos_list_offset; }
 
-    // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
     SegmentPosition<T> dereference() const {
-      const auto pos_list_offset = static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-
-      if (_pos_list_it->is_null()) return SegmentPosition<T>{T{}, true, pos_list_offset};
-
-      const auto chunk_id = _pos_list_it->chunk_id;
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
-
-      if (!_accessors[chunk_id]) {
-        _create_accessor(chunk_id);
-      }
-      const auto typed_value = _accessors[chunk_id]->access(chunk_offset);
-
-      if (typed_value) {
-        return SegmentPosition<T>{std::move(*typed_value), false, pos_list_offset};
-      } else {
-        return SegmentPosition<T>{T{}, true, pos_list_offset};
-      }
-    }
-
-    void _create_accessor(const ChunkID chunk_id) const {
-      auto segment = _referenced_table->get_chunk(chunk_id)->get_segment(_referenced_column_id);
-      auto accessor = std::move(create_segment_accessor<T>(segment));
-      _accessors[chunk_id] = std::move(accessor);
+      return SegmentPosition<T>{_gathered_values->values[_pos_list_offset],
+                                _gathered_values->null_values[_pos_list_offset], _pos_list_offset};
     }
 
    private:
-    const std::shared_ptr<const Table> _referenced_table;
-    const ColumnID _referenced_column_id;
-
-    const PosListIterator _begin_pos_list_it;
-    PosListIterator _pos_list_it;
-
-    mutable std::vector<std::shared_ptr<BaseSegmentAccessor<T>>> _accessors;
+    std::shared_ptr<const detail::GatheredReferenceSegmentValues<T>> _gathered_values;
+    ChunkOffset _pos_list_offset;
   };
 };
 
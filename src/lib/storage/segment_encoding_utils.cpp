@@ -3,8 +3,11 @@
 #include <map>
 #include <memory>
 
+#include "storage/column_group_segment/column_group_encoder.hpp"
+#include "storage/delta_segment/delta_encoder.hpp"
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
+#include "storage/lz4_segment/lz4_encoder.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
 
 #include "storage/base_value_segment.hpp"
@@ -24,7 +27,11 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::Dictionary, std::make_shared<DictionaryEncoder<EncodingType::Dictionary>>()},
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
-    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()}};
+    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
+    {EncodingType::Delta, std::make_shared<DeltaEncoder>()},
+    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()},
+    {EncodingType::FrontCodedDictionary, std::make_shared<DictionaryEncoder<EncodingType::FrontCodedDictionary>>()},
+    {EncodingType::ColumnGroup, std::make_shared<ColumnGroupEncoder>()}};
 
 }  // namespace
 
@@ -64,9 +64,10 @@ class AnySegmentIterableWrapper : public BaseAnySegmentIterableWrapper<ValueType
   explicit AnySegmentIterableWrapper(const IterableT& iterable) : iterable(iterable) {}
 
   void with_iterators(const AnySegmentIterableFunctorWrapper<ValueType>& functor_wrapper) const override {
-    iterable.with_iterators([&](auto begin, const auto end) {
-      const auto any_segment_iterator_begin = AnySegmentIterator<ValueType>(begin);
-      const auto any_segment_iterator_end = AnySegmentIterator<ValueType>(end);
+    const auto size = static_cast<size_t>(iterable._on_size());
+    iterable.with_iterators([&](auto begin, const auto /* end */) {
+      const auto any_segment_iterator_begin = AnySegmentIterator<ValueType>(begin, size);
+      const auto any_segment_iterator_end = AnySegmentIterator<ValueType>(size);
       functor_wrapper(any_segment_iterator_begin, any_segment_iterator_end);
     });
   }
@@ -75,9 +76,10 @@ class AnySegmentIterableWrapper : public BaseAnySegmentIterableWrapper<ValueType
                       const AnySegmentIterableFunctorWrapper<ValueType>& functor_wrapper) const override {
     if (position_filter) {
       if constexpr (is_point_accessible_segment_iterable_v<IterableT>) {
-        iterable.with_iterators(position_filter, [&](auto begin, const auto end) {
-          const auto any_segment_iterator_begin = AnySegmentIterator<ValueType>(begin);
-          const auto any_segment_iterator_end = AnySegmentIterator<ValueType>(end);
+        const auto size = position_filter->size();
+        iterable.with_iterators(position_filter, [&](auto begin, const auto /* end */) {
+          const auto any_segment_iterator_begin = AnySegmentIterator<ValueType>(begin, size);
+          const auto any_segment_iterator_end = AnySegmentIterator<ValueType>(size);
           functor_wrapper(any_segment_iterator_begin, any_segment_iterator_end);
         });
       } else {
@@ -102,8 +104,8 @@ class AnySegmentIterableWrapper : public BaseAnySegmentIterableWrapper<ValueType
  * called using many different iterators, which leads to a lot of code
  * being generated.
  *
- * The AnySegmentIterable erases the type of the Iterable and the Iterator, with each value retrieval incurring the cost
- * of two virtual function calls.
+ * The AnySegmentIterable erases the type of the Iterable and the Iterator. The iterators decode the values of the
+ * wrapped iterator in blocks, with one virtual function call per block (see AnySegmentIterator).
  */
 template <typename T>
 class AnySegmentIterable : public PointAccessibleSegmentIterable<AnySegmentIterable<T>> {
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <vector>
 
 #include "storage/segment_iterables/base_segment_iterators.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -10,17 +14,15 @@ namespace detail {
 
 /**
  * Emulates a base class for segment iterators with a virtual interface.
- * It duplicates all methods implemented by segment iterators as part of
- * a virtual interface.
+ * Instead of a virtual call per value, the values are decoded block by block.
  */
 template <typename T>
 class AnySegmentIteratorWrapperBase {
  public:
   virtual ~AnySegmentIteratorWrapperBase() = default;
 
-  virtual void increment() = 0;
-  virtual bool equal(const AnySegmentIteratorWrapperBase<T>* other) const = 0;
-  virtual SegmentPosition<T> dereference() const = 0;
+  // Writes the next @param count positions of the wrapped iterator into the arrays and advances it past them
+  virtual void decode_block(const size_t count, T* values, bool* nulls, ChunkOffset* chunk_offsets) = 0;
 
   /**
    * Segment iterators need to be copyable so we need a way
@@ -40,20 +42,14 @@ class AnySegmentIteratorWrapper : public AnySegmentIteratorWrapperBase<T> {
  public:
   explicit AnySegmentIteratorWrapper(const Iterator& iterator) : _iterator{iterator} {}
 
-  void increment() final { ++_iterator; }
-
-  /**
-   * Although `other` could have a different type, it is practically impossible,
-   * since AnySegmentIterator is only used within AnySegmentIterable.
-   */
-  bool equal(const AnySegmentIteratorWrapperBase<T>* other) const final {
-    const auto casted_other = static_cast<const AnySegmentIteratorWrapper<T, Iterator>*>(other);
-    return _iterator == casted_other->_iterator;
-  }
-
-  SegmentPosition<T> dereference() const final {
-    const auto value = *_iterator;
-    return {value.value(), value.is_null(), value.chunk_offset()};
+  // The loop is inlined for the Iterator, so that a value costs no more than with the templated iterators
+  void decode_block(const size_t count, T* values, bool* nulls, ChunkOffset* chunk_offsets) final {
+    for (auto index = size_t{0}; index < count; ++index, ++_iterator) {
+      const auto& position = *_iterator;
+      values[index] = position.value();
+      nulls[index] = position.is_null();
+      chunk_offsets[index] = position.chunk_offset();
+    }
   }
 
   std::unique_ptr<AnySegmentIteratorWrapperBase<T>> clone() const final {
@@ -83,6 +79,10 @@ class AnySegmentIterable;
  * AnySegmentIterator exists only to improve compile times and should
  * not be used outside of AnySegmentIterable.
  *
+ * The wrapped iterator decodes BLOCK_SIZE values at a time, so that there is one virtual call per block instead of
+ * several per value. The iterator knows its position in the iterated range (and the end iterator the size of the
+ * range), so that comparisons need no virtual calls either.
+ *
  * For another example for type erasure see: https://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/Type_Erasure
  */
 template <typename T>
@@ -100,23 +100,69 @@ class AnySegmentIterator : public BaseSegmentIterator<AnySegmentIterator<T>, Seg
   template <typename U>
   friend class AnySegmentIterable;
 
+  // The iterator at the beginning of a range of @param size values
   template <typename Iterator>
-  explicit AnySegmentIterator(const Iterator& iterator)
-      : _wrapper{std::make_unique<opossum::detail::AnySegmentIteratorWrapper<T, Iterator>>(iterator)} {}
+  AnySegmentIterator(const Iterator& iterator, const size_t size)
+      : _wrapper{std::make_unique<opossum::detail::AnySegmentIteratorWrapper<T, Iterator>>(iterator)}, _size{size} {}
+
+  // The end of a range of @param size values, which is never dereferenced
+  explicit AnySegmentIterator(const size_t size) : _position{size}, _size{size} {}
   /**@}*/
 
  public:
-  AnySegmentIterator(const AnySegmentIterator& other) : _wrapper{other._wrapper->clone()} {}
+  static constexpr auto BLOCK_SIZE = size_t{64};
+
+  AnySegmentIterator(const AnySegmentIterator& other)
+      : _wrapper{other._wrapper ? other._wrapper->clone() : nullptr},
+        _position{other._position},
+        _size{other._size},
+        _block_begin{other._block_begin},
+        _block_size{other._block_size},
+        _values{other._values},
+        _nulls{other._nulls},
+        _chunk_offsets{other._chunk_offsets} {}
 
  private:
   friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-  void increment() { _wrapper->increment(); }
-  bool equal(const AnySegmentIterator<T>& other) const { return _wrapper->equal(other._wrapper.get()); }
-  SegmentPosition<T> dereference() const { return _wrapper->dereference(); }
+  void increment() { ++_position; }
+  bool equal(const AnySegmentIterator<T>& other) const { return _position == other._position; }
+
+  SegmentPosition<T> dereference() const {
+    DebugAssert(_position < _size, "Dereferencing the end of the range");
+
+    // Blocks that were skipped by incrementing without dereferencing are decoded, too, to advance the wrapper
+    while (_position >= _block_begin + _block_size) {
+      _decode_next_block();
+    }
+
+    const auto index = _position - _block_begin;
+    return {_values[index], _nulls[index], _chunk_offsets[index]};
+  }
+
+  void _decode_next_block() const {
+    _block_begin += _block_size;
+    _block_size = std::min(BLOCK_SIZE, _size - _block_begin);
+
+    _values.resize(BLOCK_SIZE);
+    _wrapper->decode_block(_block_size, _values.data(), _nulls.data(), _chunk_offsets.data());
+  }
 
  private:
+  // Positioned after the decoded block
   std::unique_ptr<opossum::detail::AnySegmentIteratorWrapperBase<T>> _wrapper;
+
+  // Of the current value and of the end of the range, relative to the beginning of the range
+  size_t _position{0};
+  size_t _size;
+
+  // The decoded block. The values are only allocated once a block is decoded, so that copies of iterators that were
+  // not dereferenced yet (e.g., when they are passed to a functor) are cheap.
+  mutable size_t _block_begin{0};
+  mutable size_t _block_size{0};
+  mutable std::vector<T> _values;
+  mutable std::array<bool, BLOCK_SIZE> _nulls{};
+  mutable std::array<ChunkOffset, BLOCK_SIZE> _chunk_offsets{};
 };
 
 }  // namespace opossum
@@ -33,6 +33,10 @@
  *
  * Especially when nesting segment iteration, this will lead to a lot of instantiations of the functor, so try to keep
  * them small and use type erasure when performance is not crucial.
+ *
+ * Without type erasure, only the segment types in the specialization table (see segment_iteration_specialization.hpp)
+ * have their own IterableType and IteratorType combinations, all other segment types share those of the
+ * AnySegmentIterable.
  */
 
 namespace opossum {
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+template <typename T>
+class DictionarySegment;
+
+/**
+ * @brief The specialization table of segment iteration
+ *
+ * Operators that iterate over segments (see segment_iterate.hpp and create_iterable_from_segment()) are instantiated
+ * with the iterators of each combination of data type and segment type that they iterate over, as well as each vector
+ * compression type of the segment. The iterators of the combinations in the table below ("hot") are inlined into the
+ * operators, while the others ("cold") are iterated through the AnySegmentIterable, which decodes blocks of values with
+ * one virtual call per block. The operators are thus instantiated only once for all cold combinations, which keeps the
+ * compile time and the binary size of release builds down.
+ *
+ * ReferenceSegments are always iterated like their referenced segments, so the table decides for them as well.
+ *
+ * Builds with the CMake option SPECIALIZE_ALL_SEGMENT_ITERATION specialize all combinations. Add the segment types
+ * that a workload mostly reads, e.g., after changing the default encoding of the tables.
+ */
+template <template <typename> typename... SegmentTemplates>
+struct SegmentTemplateList {
+  template <typename T, typename SegmentType>
+  static constexpr bool contains = (std::is_same_v<SegmentTemplates<T>, SegmentType> || ...);
+};
+
+using SpecializedSegmentIterationTypes = SegmentTemplateList<ValueSegment, DictionarySegment>;
+
+constexpr auto specialized_segment_iteration_data_types = data_types;
+
+// @return Whether segments of the SegmentType with values of type T are iterated with their own iterators
+template <typename T, typename SegmentType>
+constexpr bool is_segment_iteration_specialized() {
+#if HYRISE_SPECIALIZE_ALL_SEGMENT_ITERATION
+  return true;
+#else
+  using DataTypeIsSpecialized = decltype(hana::contains(specialized_segment_iteration_data_types, hana::type_c<T>));
+  return DataTypeIsSpecialized::value && SpecializedSegmentIterationTypes::template contains<T, SegmentType>;
+#endif
+}
+
+// Whether create_iterable_from_segment() returns an AnySegmentIterable for segments of the SegmentType
+template <typename T, typename SegmentType>
+constexpr bool erase_segment_iteration_type_v = HYRISE_DEBUG || !is_segment_iteration_specialized<T, SegmentType>();
+
+}  // namespace opossum
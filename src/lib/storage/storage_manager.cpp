@@ -1,6 +1,8 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,124 +12,308 @@
 #include "operators/table_wrapper.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
-#include "statistics/generate_table_statistics.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_builder.hpp"
+#include "storage/materialized_view.hpp"
 #include "utils/assert.hpp"
+#include "utils/meta_table_manager.hpp"
 
 namespace opossum {
 
-void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
-  Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
+struct StorageManager::LazyTable {
+  std::function<std::shared_ptr<Table>()> loader;
+  std::once_flag load_flag;
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
-    Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
+  // Set by the load, once the table is part of the catalog
+  std::shared_ptr<Table> table;
+};
+
+std::shared_ptr<const StorageManager::Catalog> StorageManager::catalog() const { return std::atomic_load(&_catalog); }
+
+void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
+  {
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    _add_table(*new_catalog, name, std::move(table));
+    _publish_catalog(new_catalog);
   }
 
-  table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
-  _tables.emplace(name, std::move(table));
+  // The cached plans of a previous table of the same name must not be used for this one
+  SQLPlanCacheDependencies::get().invalidate_table(name);
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  const auto num_deleted = _tables.erase(name);
-  Assert(num_deleted == 1, "Error deleting table " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
+  {
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    Assert(!new_catalog->materialized_views.count(name),
+           "Cannot drop table " + name + " - it is the table of a materialized view, use drop_materialized_view()");
+    _drop_table(*new_catalog, name);
+    _publish_catalog(new_catalog);
+  }
+
+  SQLPlanCacheDependencies::get().invalidate_table(name);
+}
+
+void StorageManager::add_lazy_table(const std::string& name, std::function<std::shared_ptr<Table>()> loader) {
+  {
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    Assert(!new_catalog->tables.count(name) && !new_catalog->lazy_tables.count(name),
+           "A table with the name " + name + " already exists");
+    Assert(!MetaTableManager::is_meta_table_name(name),
+           "Cannot add table " + name + " - its prefix is reserved for meta tables");
+    Assert(!new_catalog->views.count(name), "Cannot add table " + name + " - a view with the same name already exists");
+
+    auto lazy_table = std::make_shared<LazyTable>();
+    lazy_table->loader = std::move(loader);
+    new_catalog->lazy_tables.emplace(name, std::move(lazy_table));
+    _publish_catalog(new_catalog);
+  }
+
+  SQLPlanCacheDependencies::get().invalidate_table(name);
+}
+
+bool StorageManager::load_lazy_table(const std::string& name) {
+  const auto current_catalog = catalog();
+  const auto lazy_table_iter = current_catalog->lazy_tables.find(name);
+  if (lazy_table_iter == current_catalog->lazy_tables.end()) return false;
+
+  return _load_lazy_table(name, lazy_table_iter->second).second;
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  const auto iter = _tables.find(name);
-  Assert(iter != _tables.end(), "No such table named '" + name + "'");
+  const auto current_catalog = catalog();
+  const auto iter = current_catalog->tables.find(name);
+  if (iter != current_catalog->tables.end()) return iter->second;
+
+  // Loading a lazy table does not change the tables that the catalog holds, it only makes one of them available
+  const auto lazy_table_iter = current_catalog->lazy_tables.find(name);
+  if (lazy_table_iter != current_catalog->lazy_tables.end()) {
+    const auto table = const_cast<StorageManager*>(this)->_load_lazy_table(name, lazy_table_iter->second).first;
+    Assert(table, "Table " + name + " was dropped while it was loaded");
+    return table;
+  }
 
-  return iter->second;
+  Assert(MetaTableManager::has_table(name), "No such table named '" + name + "'");
+  return MetaTableManager::generate_table(name);
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const {
+  const auto current_catalog = catalog();
+  return current_catalog->tables.count(name) || current_catalog->lazy_tables.count(name) ||
+         MetaTableManager::has_table(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  const auto current_catalog = catalog();
+
   std::vector<std::string> table_names;
-  table_names.reserve(_tables.size());
+  table_names.reserve(current_catalog->tables.size() + current_catalog->lazy_tables.size());
 
-  for (const auto& table_item : _tables) {
+  for (const auto& table_item : current_catalog->tables) {
     table_names.emplace_back(table_item.first);
   }
+  for (const auto& lazy_table_item : current_catalog->lazy_tables) {
+    table_names.emplace_back(lazy_table_item.first);
+  }
+  std::sort(table_names.begin(), table_names.end());
 
   return table_names;
 }
 
-const std::map<std::string, std::shared_ptr<Table>>& StorageManager::tables() const { return _tables; }
+std::map<std::string, std::shared_ptr<Table>> StorageManager::tables() const { return catalog()->tables; }
+
+std::vector<std::string> StorageManager::lazy_table_names() const {
+  const auto current_catalog = catalog();
+
+  auto lazy_table_names = std::vector<std::string>{};
+  lazy_table_names.reserve(current_catalog->lazy_tables.size());
+  for (const auto& lazy_table_item : current_catalog->lazy_tables) {
+    lazy_table_names.emplace_back(lazy_table_item.first);
+  }
+
+  return lazy_table_names;
+}
+
+void StorageManager::set_statistics_sample_rate(const double sample_rate) {
+  Assert(sample_rate > 0.0 && sample_rate <= 1.0, "Sample rate must be in (0, 1]");
+  std::lock_guard<std::mutex> lock(_catalog_mutex);
+  _statistics_sample_rate = sample_rate;
+}
+
+void StorageManager::add_chunks_to_table_statistics(const std::string& name, const std::vector<ChunkID>& chunk_ids) {
+  const auto table = get_table(name);
+
+  std::lock_guard<std::mutex> lock(_catalog_mutex);
+  const auto builder_iter = _table_statistics_builders.find(name);
+  Assert(builder_iter != _table_statistics_builders.end(), "No statistics were generated for table '" + name + "'");
+
+  builder_iter->second->add_chunks(*table, chunk_ids);
+  const auto table_statistics = std::make_shared<TableStatistics>(builder_iter->second->table_statistics(*table));
+
+  // The rows that were deleted in the meantime are still invalid
+  if (const auto previous_table_statistics = table->table_statistics()) {
+    table_statistics->increase_invalid_row_count(static_cast<uint64_t>(previous_table_statistics->row_count()) -
+                                                 previous_table_statistics->approx_valid_row_count());
+  }
+
+  table->set_table_statistics(table_statistics);
+}
 
 void StorageManager::add_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
-  Assert(_tables.find(name) == _tables.end(),
+  std::lock_guard<std::mutex> lock(_catalog_mutex);
+  const auto new_catalog = _copy_catalog();
+  Assert(new_catalog->tables.find(name) == new_catalog->tables.end() && !new_catalog->lazy_tables.count(name),
          "Cannot add view " + name + " - a table with the same name already exists");
-  Assert(_views.find(name) == _views.end(), "A view with the name " + name + " already exists");
+  Assert(new_catalog->views.find(name) == new_catalog->views.end(), "A view with the name " + name + " already exists");
 
-  _views.emplace(name, view);
+  new_catalog->views.emplace(name, view);
+  _publish_catalog(new_catalog);
 }
 
 void StorageManager::drop_view(const std::string& name) {
-  const auto num_deleted = _views.erase(name);
-  Assert(num_deleted == 1, "Error deleting view " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
+  auto view = std::shared_ptr<LQPView>{};
+  {
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    const auto view_iter = new_catalog->views.find(name);
+    Assert(view_iter != new_catalog->views.end(), "Error deleting view " + name + ": No such view.");
+
+    view = view_iter->second;
+    new_catalog->views.erase(view_iter);
+    _publish_catalog(new_catalog);
+  }
+
+  // The plans that used the view have inlined it, so they are found through the tables of the view
+  SQLPlanCacheDependencies::get().invalidate_view(*view);
 }
 
 std::shared_ptr<LQPView> StorageManager::get_view(const std::string& name) const {
-  const auto iter = _views.find(name);
-  Assert(iter != _views.end(), "No such view named '" + name + "'");
+  const auto current_catalog = catalog();
+  const auto iter = current_catalog->views.find(name);
+  Assert(iter != current_catalog->views.end(), "No such view named '" + name + "'");
 
   return iter->second->deep_copy();
 }
 
-bool StorageManager::has_view(const std::string& name) const { return _views.count(name); }
+bool StorageManager::has_view(const std::string& name) const { return catalog()->views.count(name); }
 
 std::vector<std::string> StorageManager::view_names() const {
+  const auto current_catalog = catalog();
+
   std::vector<std::string> view_names;
-  view_names.reserve(_views.size());
+  view_names.reserve(current_catalog->views.size());
 
-  for (const auto& view_item : _views) {
+  for (const auto& view_item : current_catalog->views) {
     view_names.emplace_back(view_item.first);
   }
 
   return view_names;
 }
 
+void StorageManager::add_materialized_view(const std::string& name, const std::shared_ptr<AbstractLQPNode>& lqp) {
+  // The view optimizes its LQP, which reads the catalog, so it is created before the catalog is changed
+  const auto materialized_view = std::make_shared<MaterializedView>(name, lqp);
+  {
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    Assert(new_catalog->materialized_views.find(name) == new_catalog->materialized_views.end(),
+           "A materialized view with the name " + name + " already exists");
+
+    _add_table(*new_catalog, name, materialized_view->table());
+    new_catalog->materialized_views.emplace(name, materialized_view);
+    _publish_catalog(new_catalog);
+  }
+
+  SQLPlanCacheDependencies::get().invalidate_table(name);
+  materialized_view->refresh();
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  {
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    const auto num_deleted = new_catalog->materialized_views.erase(name);
+    Assert(num_deleted == 1, "Error deleting materialized view " + name + ": No such materialized view.");
+
+    _drop_table(*new_catalog, name);
+    _publish_catalog(new_catalog);
+  }
+
+  SQLPlanCacheDependencies::get().invalidate_table(name);
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto current_catalog = catalog();
+  const auto iter = current_catalog->materialized_views.find(name);
+  Assert(iter != current_catalog->materialized_views.end(), "No such materialized view named '" + name + "'");
+
+  return iter->second;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const {
+  return catalog()->materialized_views.count(name);
+}
+
+std::map<std::string, std::shared_ptr<MaterializedView>> StorageManager::materialized_views() const {
+  return catalog()->materialized_views;
+}
+
 void StorageManager::add_prepared_plan(const std::string& name, const std::shared_ptr<PreparedPlan>& prepared_plan) {
-  Assert(_prepared_plans.find(name) == _prepared_plans.end(),
+  std::lock_guard<std::mutex> lock(_catalog_mutex);
+  const auto new_catalog = _copy_catalog();
+  Assert(new_catalog->prepared_plans.find(name) == new_catalog->prepared_plans.end(),
          "Cannot add prepared plan " + name + " - a prepared plan with the same name already exists");
 
-  _prepared_plans.emplace(name, prepared_plan);
+  new_catalog->prepared_plans.emplace(name, prepared_plan);
+  _publish_catalog(new_catalog);
 }
 
 std::shared_ptr<PreparedPlan> StorageManager::get_prepared_plan(const std::string& name) const {
-  const auto iter = _prepared_plans.find(name);
-  Assert(iter != _prepared_plans.end(), "No such prepared plan named '" + name + "'");
+  const auto current_catalog = catalog();
+  const auto iter = current_catalog->prepared_plans.find(name);
+  Assert(iter != current_catalog->prepared_plans.end(), "No such prepared plan named '" + name + "'");
 
   return iter->second;
 }
 
 bool StorageManager::has_prepared_plan(const std::string& name) const {
-  return _prepared_plans.find(name) != _prepared_plans.end();
+  return catalog()->prepared_plans.count(name);
 }
 
 void StorageManager::drop_prepared_plan(const std::string& name) {
-  const auto iter = _prepared_plans.find(name);
-  Assert(iter != _prepared_plans.end(), "No such prepared plan named '" + name + "'");
+  std::lock_guard<std::mutex> lock(_catalog_mutex);
+  const auto new_catalog = _copy_catalog();
+  const auto iter = new_catalog->prepared_plans.find(name);
+  Assert(iter != new_catalog->prepared_plans.end(), "No such prepared plan named '" + name + "'");
 
-  _prepared_plans.erase(iter);
+  new_catalog->prepared_plans.erase(iter);
+  _publish_catalog(new_catalog);
 }
 
 void StorageManager::print(std::ostream& out) const {
+  const auto current_catalog = catalog();
+
   out << "==================" << std::endl;
   out << "===== Tables =====" << std::endl << std::endl;
 
-  for (auto const& table : _tables) {
+  for (auto const& table : current_catalog->tables) {
     out << "==== table >> " << table.first << " <<";
     out << " (" << table.second->column_count() << " columns, " << table.second->row_count() << " rows in "
         << table.second->chunk_count() << " chunks)";
     out << std::endl;
   }
 
+  for (auto const& lazy_table : current_catalog->lazy_tables) {
+    out << "==== table >> " << lazy_table.first << " << (not loaded yet)" << std::endl;
+  }
+
   out << "==================" << std::endl;
   out << "===== Views ======" << std::endl << std::endl;
 
-  for (auto const& view : _views) {
+  for (auto const& view : current_catalog->views) {
     out << "==== view >> " << view.first << " <<";
     out << std::endl;
   }
@@ -135,7 +321,7 @@ void StorageManager::print(std::ostream& out) const {
   out << "==================" << std::endl;
   out << "= PreparedPlans ==" << std::endl << std::endl;
 
-  for (auto const& prepared_plan : _prepared_plans) {
+  for (auto const& prepared_plan : current_catalog->prepared_plans) {
     out << "==== prepared plan >> " << prepared_plan.first << " <<";
     out << std::endl;
   }
@@ -144,10 +330,12 @@ void StorageManager::print(std::ostream& out) const {
 void StorageManager::reset() { get() = StorageManager(); }
 
 void StorageManager::export_all_tables_as_csv(const std::string& path) {
+  const auto current_catalog = catalog();
+
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
-  tasks.reserve(_tables.size());
+  tasks.reserve(current_catalog->tables.size());
 
-  for (auto& pair : _tables) {
+  for (auto& pair : current_catalog->tables) {
     auto job_task = std::make_shared<JobTask>([pair, &path]() {
       const auto& name = pair.first;
       auto& table = pair.second;
@@ -165,4 +353,80 @@ void StorageManager::export_all_tables_as_csv(const std::string& path) {
   CurrentScheduler::wait_for_tasks(tasks);
 }
 
+StorageManager& StorageManager::operator=(StorageManager&& other) {
+  std::lock_guard<std::mutex> lock(_catalog_mutex);
+  std::atomic_store(&_catalog, std::atomic_load(&other._catalog));
+  _table_statistics_builders = std::move(other._table_statistics_builders);
+  _statistics_sample_rate = other._statistics_sample_rate;
+  return *this;
+}
+
+std::shared_ptr<StorageManager::Catalog> StorageManager::_copy_catalog() const {
+  return std::make_shared<Catalog>(*std::atomic_load(&_catalog));
+}
+
+void StorageManager::_publish_catalog(const std::shared_ptr<Catalog>& catalog) {
+  ++catalog->version;
+  std::atomic_store(&_catalog, std::shared_ptr<const Catalog>{catalog});
+}
+
+void StorageManager::_add_table(Catalog& catalog, const std::string& name, std::shared_ptr<Table> table) {
+  Assert(catalog.tables.find(name) == catalog.tables.end() && !catalog.lazy_tables.count(name),
+         "A table with the name " + name + " already exists");
+  Assert(!MetaTableManager::is_meta_table_name(name),
+         "Cannot add table " + name + " - its prefix is reserved for meta tables");
+  Assert(catalog.views.find(name) == catalog.views.end(),
+         "Cannot add table " + name + " - a view with the same name already exists");
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
+    Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
+  }
+
+  // Tables can bring their statistics along, e.g., from a binary file (see ImportBinary). They are only used if they
+  // were generated for the rows that the table still has.
+  const auto table_statistics = table->table_statistics();
+  const auto has_table_statistics =
+      table_statistics && table_statistics->row_count() == static_cast<float>(table->row_count());
+
+  auto table_statistics_builder =
+      std::make_shared<TableStatisticsBuilder>(*table, _statistics_sample_rate, !has_table_statistics);
+  if (!has_table_statistics) {
+    table->set_table_statistics(std::make_shared<TableStatistics>(table_statistics_builder->table_statistics(*table)));
+  }
+  _table_statistics_builders[name] = std::move(table_statistics_builder);
+  catalog.tables.emplace(name, std::move(table));
+}
+
+void StorageManager::_drop_table(Catalog& catalog, const std::string& name) {
+  if (catalog.lazy_tables.erase(name)) return;
+
+  const auto num_deleted = catalog.tables.erase(name);
+  Assert(num_deleted == 1, "Error deleting table " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
+  _table_statistics_builders.erase(name);
+}
+
+std::pair<std::shared_ptr<Table>, bool> StorageManager::_load_lazy_table(const std::string& name,
+                                                                         const std::shared_ptr<LazyTable>& lazy_table) {
+  auto loaded = false;
+  // The table is loaded without holding the _catalog_mutex, so that other tables can be looked up and changed meanwhile
+  std::call_once(lazy_table->load_flag, [&]() {
+    auto table = lazy_table->loader();
+    Assert(table, "Loader of table " + name + " returned no table");
+
+    std::lock_guard<std::mutex> lock(_catalog_mutex);
+    const auto new_catalog = _copy_catalog();
+    // The table was dropped while it was loaded
+    const auto lazy_table_iter = new_catalog->lazy_tables.find(name);
+    if (lazy_table_iter == new_catalog->lazy_tables.end() || lazy_table_iter->second != lazy_table) return;
+
+    new_catalog->lazy_tables.erase(lazy_table_iter);
+    _add_table(*new_catalog, name, table);
+    _publish_catalog(new_catalog);
+    lazy_table->table = std::move(table);
+    loaded = true;
+  });
+
+  return {lazy_table->table, loaded};
+}
+
 }  // namespace opossum
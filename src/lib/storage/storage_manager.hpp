@@ -1,9 +1,12 @@
 #pragma once
 
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "lqp_view.hpp"
@@ -14,22 +17,68 @@
 namespace opossum {
 
 class Table;
+class TableStatisticsBuilder;
 class AbstractLQPNode;
+class MaterializedView;
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// The tables, views, materialized views, and prepared plans form a catalog that is copied on write: Every change
+// publishes a new, immutable version of the catalog, which readers load atomically. Lookups therefore never lock or
+// wait for each other, and a version that a reader holds stays valid (including its tables) even if the tables are
+// dropped in the meantime. Changes are serialized by a mutex.
+//
+// Tables can be added lazily, e.g., from the binary files of the server's data directory: Only their names are known
+// until the first lookup loads them, so that the server answers queries right away instead of loading all of its
+// tables first (see LazyTablePrefetcher).
 class StorageManager : public Singleton<StorageManager> {
  public:
+  // A table that is loaded on its first lookup, see add_lazy_table()
+  struct LazyTable;
+
+  struct Catalog {
+    std::map<std::string, std::shared_ptr<Table>> tables;
+    std::map<std::string, std::shared_ptr<LazyTable>> lazy_tables;
+    std::map<std::string, std::shared_ptr<LQPView>> views;
+    std::map<std::string, std::shared_ptr<MaterializedView>> materialized_views;
+    std::map<std::string, std::shared_ptr<PreparedPlan>> prepared_plans;
+
+    // Incremented by every change of the catalog
+    uint64_t version{0};
+  };
+
+  // The current version of the catalog, which is not affected by later changes
+  std::shared_ptr<const Catalog> catalog() const;
+
   /**
    * @defgroup Manage Tables
    * @{
    */
   void add_table(const std::string& name, std::shared_ptr<Table> table);
   void drop_table(const std::string& name);
+
+  // Adds a table whose data the @param loader returns (e.g., by ImportBinary::read_binary()) once it is first looked up
+  // with get_table(). Until then, it is part of table_names() and has_table(), but not of tables(). Concurrent lookups
+  // wait for the same load. If the loader throws, the next lookup tries again.
+  void add_lazy_table(const std::string& name, std::function<std::shared_ptr<Table>()> loader);
+
+  // Loads a table that was added with add_lazy_table(), e.g., to prefetch it. Does nothing if it was loaded or dropped
+  // already, or if there is no such table.
+  // @returns whether this call loaded it
+  bool load_lazy_table(const std::string& name);
+
+  // The meta tables of the MetaTableManager, e.g., "meta_segments", are generated whenever they are asked for. They are
+  // not part of table_names() and tables().
   std::shared_ptr<Table> get_table(const std::string& name) const;
   bool has_table(const std::string& name) const;
+
+  // Copies of the current version, use catalog() to avoid the copy. tables() only holds the tables that are loaded.
   std::vector<std::string> table_names() const;
-  const std::map<std::string, std::shared_ptr<Table>>& tables() const;
+  std::map<std::string, std::shared_ptr<Table>> tables() const;
+
+  // The tables that were added with add_lazy_table() and are not loaded yet
+  std::vector<std::string> lazy_table_names() const;
   /** @} */
 
   /**
@@ -43,6 +92,18 @@ class StorageManager : public Singleton<StorageManager> {
   std::vector<std::string> view_names() const;
   /** @} */
 
+  /**
+   * @defgroup Manage materialized views, whose results are tables of the same name (see MaterializedView)
+   * @{
+   */
+  // Adds the table of the view and fills it with a first refresh()
+  void add_materialized_view(const std::string& name, const std::shared_ptr<AbstractLQPNode>& lqp);
+  void drop_materialized_view(const std::string& name);
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+  bool has_materialized_view(const std::string& name) const;
+  std::map<std::string, std::shared_ptr<MaterializedView>> materialized_views() const;
+  /** @} */
+
   /**
    * @defgroup Manage prepared plans - comparable to SQL PREPAREd statements
    * @{
@@ -53,6 +114,18 @@ class StorageManager : public Singleton<StorageManager> {
   void drop_prepared_plan(const std::string& name);
   /** @} */
 
+  /**
+   * @defgroup Manage the statistics of tables
+   * @{
+   */
+  // The share of the rows that the statistics of tables that are added from now on are generated from
+  void set_statistics_sample_rate(const double sample_rate);
+
+  // Adds the chunks with the @param chunk_ids, e.g., chunks that were completed after the table was added, to its
+  // statistics. Chunks that are part of them already are skipped.
+  void add_chunks_to_table_statistics(const std::string& name, const std::vector<ChunkID>& chunk_ids);
+  /** @} */
+
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
@@ -73,10 +146,28 @@ class StorageManager : public Singleton<StorageManager> {
   friend class Singleton;
 
   const StorageManager& operator=(const StorageManager&) = delete;
-  StorageManager& operator=(StorageManager&&) = default;
+  StorageManager& operator=(StorageManager&& other);
+
+  // Copy of the current version of the catalog for a change, must be called with the _catalog_mutex held
+  std::shared_ptr<Catalog> _copy_catalog() const;
+  void _publish_catalog(const std::shared_ptr<Catalog>& catalog);
+
+  // Add or drop the table in a @param catalog that is not published yet
+  void _add_table(Catalog& catalog, const std::string& name, std::shared_ptr<Table> table);
+  void _drop_table(Catalog& catalog, const std::string& name);
+
+  // Loads the @param lazy_table unless it is loaded already and returns it with whether this call loaded it. The table
+  // is nullptr if it was dropped while it was loaded.
+  std::pair<std::shared_ptr<Table>, bool> _load_lazy_table(const std::string& name,
+                                                           const std::shared_ptr<LazyTable>& lazy_table);
+
+  // Only accessed through std::atomic_load and std::atomic_store
+  std::shared_ptr<const Catalog> _catalog{std::make_shared<Catalog>()};
+
+  // Guards the changes of the _catalog and the statistics below
+  mutable std::mutex _catalog_mutex;
 
-  std::map<std::string, std::shared_ptr<Table>> _tables;
-  std::map<std::string, std::shared_ptr<LQPView>> _views;
-  std::map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans;
+  std::map<std::string, std::shared_ptr<TableStatisticsBuilder>> _table_statistics_builders;
+  double _statistics_sample_rate{1.0};
 };
 }  // namespace opossum
@@ -4,11 +4,20 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/index/unique_constraint_index.hpp"
+#include "storage/materialize.hpp"
+#include "storage/partition_schema.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -25,7 +34,8 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _max_chunk_size(type == TableType::Data ? max_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _append_mutex(std::make_unique<std::mutex>()),
+      _indexes_mutex(std::make_unique<std::shared_mutex>()) {
   // _max_chunk_size has no meaning if the table is a reference table.
   DebugAssert(type == TableType::Data || !max_chunk_size, "Must not set max_chunk_size for reference tables");
   DebugAssert(!max_chunk_size || *max_chunk_size > 0, "Table must have a chunk size greater than 0.");
@@ -88,14 +98,128 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
-    append_mutable_chunk();
+  const auto partition_id =
+      _partition_schema ? _partition_schema->partition_of(values[_partition_schema->column_id()]) : PartitionID{0};
+
+  auto chunk_id = last_chunk_id_of_partition(partition_id);
+  if (chunk_id == INVALID_CHUNK_ID || !_chunks[chunk_id]->is_mutable() ||
+      _chunks[chunk_id]->size() >= _max_chunk_size) {
+    append_mutable_chunk(partition_id);
+    chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
   }
 
-  _chunks.back()->append(values);
+  const auto& chunk = _chunks[chunk_id];
+  chunk->append(values);
+
+  const auto chunk_size = chunk->size();
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(*chunk, chunk_id, chunk_size - 1, chunk_size);
+  }
+  for (const auto& unique_constraint : _unique_constraints) {
+    Assert(unique_constraint->insert(*this, chunk_id, chunk_size - 1, chunk_size,
+                                     TransactionManager::INVALID_TRANSACTION_ID),
+           "Row violates a unique constraint");
+  }
+}
+
+void Table::append_rows(const Table& rows) {
+  Assert(rows.column_count() == column_count(), "Rows must have the columns of the table");
+
+  if (_partition_schema) {
+    // Consecutive rows may belong to different partitions, so that they are appended one by one
+    for (auto source_chunk_id = ChunkID{0}; source_chunk_id < rows.chunk_count(); ++source_chunk_id) {
+      const auto source_chunk = rows.get_chunk(source_chunk_id);
+      if (!source_chunk) continue;
+
+      auto values = std::vector<AllTypeVariant>(column_count());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < source_chunk->size(); ++chunk_offset) {
+        for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+          values[column_id] = (*source_chunk->get_segment(column_id))[chunk_offset];
+        }
+        append(values);
+      }
+    }
+    return;
+  }
+
+  for (auto source_chunk_id = ChunkID{0}; source_chunk_id < rows.chunk_count(); ++source_chunk_id) {
+    const auto source_chunk = rows.get_chunk(source_chunk_id);
+    if (!source_chunk) continue;
+
+    auto source_offset = ChunkOffset{0};
+    while (source_offset < source_chunk->size()) {
+      auto chunk_id = last_chunk_id_of_partition(PartitionID{0});
+      auto reservation = std::pair<ChunkOffset, ChunkOffset>{0, 0};
+      if (chunk_id != INVALID_CHUNK_ID && _chunks[chunk_id]->is_mutable()) {
+        reservation = _chunks[chunk_id]->reserve_rows(source_chunk->size() - source_offset, _max_chunk_size);
+      }
+      const auto [begin_offset, row_count] = reservation;
+      if (row_count == 0) {
+        append_mutable_chunk();
+        continue;
+      }
+
+      const auto& chunk = _chunks[chunk_id];
+      const auto end_offset = begin_offset + row_count;
+      chunk->add_reserved_rows(begin_offset, end_offset, [&]() {
+        if (chunk->has_mvcc_data()) chunk->get_scoped_mvcc_data_lock()->grow_by(row_count, MvccData::MAX_COMMIT_ID);
+
+        for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+          resolve_data_type(_column_definitions[column_id].data_type, [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            const auto value_segment =
+                std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+            DebugAssert(value_segment, "Can't append to segment that is not a ValueSegment");
+
+            value_segment->values().resize(end_offset);
+            if (value_segment->is_nullable()) value_segment->null_values().resize(end_offset);
+            materialize_into_value_segment(*source_chunk->get_segment(column_id), source_offset, row_count,
+                                           *value_segment, begin_offset);
+          });
+        }
+      });
+
+      for (const auto& table_index : _table_indexes) {
+        table_index->insert(*chunk, chunk_id, begin_offset, end_offset);
+      }
+      for (const auto& unique_constraint : _unique_constraints) {
+        Assert(unique_constraint->insert(*this, chunk_id, begin_offset, end_offset,
+                                         TransactionManager::INVALID_TRANSACTION_ID),
+               "Row violates a unique constraint");
+      }
+
+      source_offset += row_count;
+    }
+  }
+}
+
+void Table::append_mutable_chunk(const PartitionID partition_id) {
+  Segments segments;
+  for (const auto& column_definition : _column_definitions) {
+    resolve_data_type(column_definition.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
+    });
+  }
+
+  const auto chunk = _create_chunk(segments, std::nullopt, nullptr);
+  chunk->set_partition_id(partition_id);
+  _chunks.emplace_back(chunk);
+
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  if (_partition_schema) {
+    DebugAssert(partition_id < _last_chunk_ids_by_partition.size(), "PartitionID out of range");
+    _last_chunk_ids_by_partition[partition_id].store(chunk_id);
+  } else {
+    DebugAssert(partition_id == PartitionID{0}, "Table is not partitioned");
+  }
+  _index_chunk(chunk_id);
 }
 
-void Table::append_mutable_chunk() {
+void Table::remove_chunk(const ChunkID chunk_id) {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  const auto removed_chunk = get_chunk(chunk_id);
+
   Segments segments;
   for (const auto& column_definition : _column_definitions) {
     resolve_data_type(column_definition.data_type, [&](auto type) {
@@ -103,7 +227,22 @@ void Table::append_mutable_chunk() {
       segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
     });
   }
-  append_chunk(segments);
+
+  const auto empty_chunk = _create_chunk(segments, std::nullopt, nullptr);
+  empty_chunk->mark_immutable();
+  empty_chunk->set_partition_id(removed_chunk->partition_id());
+  if (const auto cleanup_commit_id = removed_chunk->cleanup_commit_id()) {
+    empty_chunk->set_cleanup_commit_id(*cleanup_commit_id);
+  }
+
+  std::atomic_store(&_chunks[chunk_id], empty_chunk);
+
+  for (const auto& table_index : _table_indexes) {
+    table_index->remove_chunk(chunk_id);
+  }
+  for (const auto& unique_constraint : _unique_constraints) {
+    unique_constraint->remove_chunk(chunk_id);
+  }
 }
 
 uint64_t Table::row_count() const {
@@ -122,57 +261,282 @@ const std::vector<std::shared_ptr<Chunk>>& Table::chunks() const { return _chunk
 
 uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
 
+void Table::set_max_chunk_size(const uint32_t max_chunk_size) {
+  Assert(_type == TableType::Data, "Only data tables have a max_chunk_size");
+  Assert(max_chunk_size > 0 && max_chunk_size <= Chunk::MAX_SIZE, "Invalid max_chunk_size");
+  _max_chunk_size = max_chunk_size;
+}
+
+uint32_t Table::choose_max_chunk_size(const size_t expected_row_count) {
+  const auto worker_count = std::max(Topology::get().num_cpus(), size_t{1});
+  const auto chunk_count = worker_count * CHOSEN_CHUNKS_PER_WORKER;
+  const auto chunk_size = (expected_row_count + chunk_count - 1) / chunk_count;
+  return static_cast<uint32_t>(
+      std::clamp(chunk_size, static_cast<size_t>(MIN_CHOSEN_CHUNK_SIZE), static_cast<size_t>(Chunk::DEFAULT_SIZE)));
+}
+
+// The chunks are loaded atomically, as remove_chunk() may replace them concurrently
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 void Table::append_chunk(const Segments& segments, const std::optional<PolymorphicAllocator<Chunk>>& alloc,
                          const std::shared_ptr<ChunkAccessCounter>& access_counter) {
+  _assert_not_partitioned();
+  _chunks.emplace_back(_create_chunk(segments, alloc, access_counter));
+  _index_chunk(static_cast<ChunkID>(_chunks.size() - 1));
+}
+
+void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  _assert_not_partitioned();
+  _assert_segment_types(chunk->segments());
+  DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+              "Chunk does not have the same MVCC setting as the table.");
+
+  _chunks.emplace_back(chunk);
+  _index_chunk(static_cast<ChunkID>(_chunks.size() - 1));
+}
+
+void Table::create_chunk_slots(const size_t slot_count) {
+  Assert(_chunk_slots.empty(), "Chunk slots have already been created");
+  _chunk_slots.resize(slot_count);
+}
+
+void Table::set_chunk_slot(const size_t slot_idx, const Segments& segments,
+                           const std::optional<PolymorphicAllocator<Chunk>>& alloc,
+                           const std::shared_ptr<ChunkAccessCounter>& access_counter) {
+  DebugAssert(slot_idx < _chunk_slots.size(), "Chunk slot out of range");
+  DebugAssert(!_chunk_slots[slot_idx], "Chunk slot has already been filled");
+  _chunk_slots[slot_idx] = _create_chunk(segments, alloc, access_counter);
+}
+
+void Table::set_chunk_slot(const size_t slot_idx, const std::shared_ptr<Chunk>& chunk) {
+  DebugAssert(slot_idx < _chunk_slots.size(), "Chunk slot out of range");
+  DebugAssert(!_chunk_slots[slot_idx], "Chunk slot has already been filled");
+  _assert_segment_types(chunk->segments());
+  DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+              "Chunk does not have the same MVCC setting as the table.");
+
+  _chunk_slots[slot_idx] = chunk;
+}
+
+void Table::append_chunk_slots() {
+  _assert_not_partitioned();
+  for (auto& chunk : _chunk_slots) {
+    if (!chunk) continue;
+    _chunks.emplace_back(std::move(chunk));
+    _index_chunk(static_cast<ChunkID>(_chunks.size() - 1));
+  }
+  _chunk_slots.clear();
+}
+
+void Table::create_pipelined_chunks(const ChunkID chunk_count) {
+  Assert(_chunks.empty(), "Pipelined chunks can only be created in an empty table");
+  _chunks.resize(chunk_count);
+}
+
+void Table::set_pipelined_chunk(const ChunkID chunk_id, const Segments& segments,
+                                const std::optional<PolymorphicAllocator<Chunk>>& alloc,
+                                const std::shared_ptr<ChunkAccessCounter>& access_counter) {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  DebugAssert(!_chunks[chunk_id], "Pipelined chunk has already been set");
+  _chunks[chunk_id] = _create_chunk(segments, alloc, access_counter);
+}
+
+void Table::set_pipelined_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk) {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  DebugAssert(!_chunks[chunk_id], "Pipelined chunk has already been set");
+  _assert_segment_types(chunk->segments());
+  DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+              "Chunk does not have the same MVCC setting as the table.");
+
+  _chunks[chunk_id] = chunk;
+}
+
+void Table::release_pipelined_chunk(const ChunkID chunk_id) {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  _chunks[chunk_id] = nullptr;
+}
+
+void Table::remove_missing_chunks() {
+  _chunks.erase(std::remove(_chunks.begin(), _chunks.end(), nullptr), _chunks.end());
+}
+
+std::shared_ptr<Chunk> Table::_create_chunk(const Segments& segments,
+                                            const std::optional<PolymorphicAllocator<Chunk>>& alloc,
+                                            const std::shared_ptr<ChunkAccessCounter>& access_counter) const {
   const auto chunk_size = segments.empty() ? 0u : segments[0]->size();
 
 #if HYRISE_DEBUG
   for (const auto& segment : segments) {
     DebugAssert(segment->size() == chunk_size, "Segments don't have the same length");
-    const auto is_reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment) != nullptr;
-    switch (_type) {
-      case TableType::References:
-        DebugAssert(is_reference_segment, "Invalid segment type");
-        break;
-      case TableType::Data:
-        DebugAssert(!is_reference_segment, "Invalid segment type");
-        break;
-    }
   }
 #endif
+  _assert_segment_types(segments);
 
   std::shared_ptr<MvccData> mvcc_data;
 
   if (_use_mvcc == UseMvcc::Yes) {
-    mvcc_data = std::make_shared<MvccData>(chunk_size);
+    mvcc_data = std::make_shared<MvccData>(chunk_size, alloc.value_or(PolymorphicAllocator<Chunk>{}));
   }
 
-  _chunks.emplace_back(std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter));
+  return std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter);
 }
 
-void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+void Table::set_partition_schema(const std::shared_ptr<const PartitionSchema>& partition_schema) {
+  Assert(_type == TableType::Data, "Only data tables can be partitioned");
+  Assert(_chunks.empty(), "Only empty tables can be partitioned");
+  Assert(!_partition_schema, "Table is partitioned already");
+  Assert(partition_schema->column_id() < column_count(), "ColumnID out of range");
+  Assert(partition_schema->data_type() == column_data_type(partition_schema->column_id()),
+         "PartitionSchema does not match the data type of the column");
+
+  _partition_schema = partition_schema;
+  _last_chunk_ids_by_partition = std::vector<std::atomic<ChunkID::base_type>>(partition_schema->partition_count());
+  for (auto& last_chunk_id : _last_chunk_ids_by_partition) {
+    last_chunk_id.store(INVALID_CHUNK_ID);
+  }
+}
+
+std::shared_ptr<const PartitionSchema> Table::partition_schema() const { return _partition_schema; }
+
+void Table::set_column_groups(const std::vector<std::vector<ColumnID>>& column_groups) {
+  auto is_grouped = std::vector<bool>(column_count());
+  for (const auto& column_group : column_groups) {
+    Assert(!column_group.empty(), "A column group needs at least one column");
+    for (const auto column_id : column_group) {
+      Assert(column_id < column_count(), "ColumnID out of range");
+      Assert(!is_grouped[column_id], "Column groups must not overlap");
+      Assert(encoding_supports_data_type(EncodingType::ColumnGroup, column_data_type(column_id)),
+             "Column groups may only contain columns of fixed width");
+      is_grouped[column_id] = true;
+    }
+  }
+
+  _column_groups = column_groups;
+}
+
+const std::vector<std::vector<ColumnID>>& Table::column_groups() const { return _column_groups; }
+
+void Table::set_numa_replicated(const bool numa_replicated) {
+  if (!numa_replicated) {
+    std::atomic_store(&_numa_replicas, {});
+    return;
+  }
+
+  Assert(_type == TableType::Data, "Only data tables can be replicated");
+  Assert(get_indexes().empty() && _table_indexes.empty(), "Tables with indexes cannot be replicated");
+
+  auto& topology = Topology::get();
+  const auto node_count = topology.nodes().size();
+  auto numa_replicas = std::vector<std::vector<std::shared_ptr<Chunk>>>(node_count);
+
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    const auto memory_resource = topology.get_memory_resource(static_cast<int>(node_id));
+    auto& node_replicas = numa_replicas[node_id];
+    node_replicas.resize(_chunks.size());
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
+      // Chunks that are already in the memory of the node are read from there
+      if (chunk->is_mutable() || chunk->get_allocator().resource() == memory_resource) continue;
+
+      node_replicas[chunk_id] = Chunk::create_replica(chunk, PolymorphicAllocator<Chunk>{memory_resource});
+    }
+  }
+
+  std::atomic_store(&_numa_replicas,
+                    std::make_shared<const std::vector<std::vector<std::shared_ptr<Chunk>>>>(std::move(numa_replicas)));
+}
+
+bool Table::is_numa_replicated() const { return std::atomic_load(&_numa_replicas) != nullptr; }
+
+std::shared_ptr<Chunk> Table::get_chunk_replica(const ChunkID chunk_id, const NodeID node_id) {
+  auto chunk = get_chunk(chunk_id);
+
+  const auto numa_replicas = std::atomic_load(&_numa_replicas);
+  if (!numa_replicas || static_cast<size_t>(node_id) >= numa_replicas->size()) return chunk;
+
+  const auto& node_replicas = (*numa_replicas)[node_id];
+  if (static_cast<size_t>(chunk_id) >= node_replicas.size()) return chunk;
+
+  // The chunk might have been replaced since it was replicated, e.g., by remove_chunk()
+  const auto& replica = node_replicas[chunk_id];
+  if (!replica || replica->replicated_chunk() != chunk) return chunk;
+
+  return replica;
+}
+
+ChunkID Table::last_chunk_id_of_partition(const PartitionID partition_id) const {
+  if (!_partition_schema) {
+    DebugAssert(partition_id == PartitionID{0}, "Table is not partitioned");
+    return _chunks.empty() ? INVALID_CHUNK_ID : static_cast<ChunkID>(_chunks.size() - 1);
+  }
+
+  DebugAssert(partition_id < _last_chunk_ids_by_partition.size(), "PartitionID out of range");
+  return ChunkID{_last_chunk_ids_by_partition[partition_id].load()};
+}
+
+void Table::drop_partition(const PartitionID partition_id) {
+  Assert(_partition_schema && partition_id < _partition_schema->partition_count(), "Partition does not exist");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (chunk->partition_id() == partition_id && chunk->size() > 0) remove_chunk(chunk_id);
+  }
+}
+
+void Table::append_partition_chunk(const std::shared_ptr<Chunk>& chunk) {
+  Assert(_partition_schema, "Table is not partitioned");
+  _assert_segment_types(chunk->segments());
+  DebugAssert(chunk->partition_id() < _partition_schema->partition_count(), "PartitionID out of range");
+  DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+              "Chunk does not have the same MVCC setting as the table.");
+
+  _chunks.emplace_back(chunk);
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  _last_chunk_ids_by_partition[chunk->partition_id()].store(chunk_id);
+  _index_chunk(chunk_id);
+}
+
+void Table::set_chunk_partition_id(const ChunkID chunk_id, const PartitionID partition_id) {
+  DebugAssert(_partition_schema && partition_id < _partition_schema->partition_count(), "Partition does not exist");
+  const auto chunk = get_chunk(chunk_id);
+  if (chunk->partition_id() == partition_id) return;
+  chunk->set_partition_id(partition_id);
+
+  // The chunk might have been the last one of its previous partition
+  for (auto& last_chunk_id : _last_chunk_ids_by_partition) {
+    last_chunk_id.store(INVALID_CHUNK_ID);
+  }
+  for (auto other_chunk_id = ChunkID{0}; other_chunk_id < chunk_count(); ++other_chunk_id) {
+    _last_chunk_ids_by_partition[get_chunk(other_chunk_id)->partition_id()].store(other_chunk_id);
+  }
+}
+
+void Table::_assert_not_partitioned() const {
+  Assert(!_partition_schema, "Rows can only be added to partitioned tables by append() or Insert");
+}
+
+void Table::_assert_segment_types(const Segments& segments) const {
 #if HYRISE_DEBUG
-  for (const auto& segment : chunk->segments()) {
+  for (const auto& segment : segments) {
     const auto is_reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment) != nullptr;
     switch (_type) {
       case TableType::References:
@@ -184,16 +548,109 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
     }
   }
 #endif
+}
 
-  DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
-              "Chunk does not have the same MVCC setting as the table.");
+std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-  _chunks.emplace_back(chunk);
+CommitID Table::last_commit_id() const { return _last_commit_id.load(); }
+
+void Table::raise_last_commit_id(const CommitID commit_id) const {
+  // Transactions commit their records in parallel, not in the order of their commit ids
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {
+  }
 }
 
-std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::shared_lock<std::shared_mutex> lock{*_indexes_mutex};
+  return _indexes;
+}
+
+void Table::add_index_info(const IndexInfo& index_info) {
+  std::unique_lock<std::shared_mutex> lock{*_indexes_mutex};
+  _indexes.emplace_back(index_info);
+}
+
+void Table::remove_index_info(const std::vector<ColumnID>& column_ids, const SegmentIndexType type) {
+  std::unique_lock<std::shared_mutex> lock{*_indexes_mutex};
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& index_info) {
+                                  return index_info.column_ids == column_ids && index_info.type == type;
+                                }),
+                 _indexes.end());
+}
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+std::shared_ptr<BaseTableIndex> Table::create_table_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "TableIndexes can only be created on data tables");
+  Assert(!get_table_index(column_id), "Column already has a TableIndex");
+
+  const auto table_index =
+      make_shared_by_data_type<BaseTableIndex, TableIndex>(column_data_type(column_id), column_id);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    table_index->insert(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
+
+  _table_indexes.emplace_back(table_index);
+  return table_index;
+}
+
+std::shared_ptr<BaseTableIndex> Table::get_table_index(const ColumnID column_id) const {
+  const auto table_index_iter =
+      std::find_if(_table_indexes.begin(), _table_indexes.end(),
+                   [&](const auto& table_index) { return table_index->column_id() == column_id; });
+  return table_index_iter != _table_indexes.end() ? *table_index_iter : nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseTableIndex>>& Table::table_indexes() const { return _table_indexes; }
+
+void Table::add_unique_constraint(const TableConstraintDefinition& definition) {
+  Assert(_type == TableType::Data, "Unique constraints can only be added to data tables");
+
+  for (const auto column_id : definition.column_ids) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+    Assert(definition.is_primary_key == IsPrimaryKey::No || !column_is_nullable(column_id),
+           "Columns of a primary key must not be nullable");
+  }
+  Assert(std::set<ColumnID>(definition.column_ids.begin(), definition.column_ids.end()).size() ==
+             definition.column_ids.size(),
+         "Column appears twice in the unique constraint");
+
+  for (const auto& unique_constraint : _unique_constraints) {
+    Assert(definition.is_primary_key == IsPrimaryKey::No ||
+               unique_constraint->definition().is_primary_key == IsPrimaryKey::No,
+           "A table can only have one primary key");
+    Assert(unique_constraint->definition().column_ids != definition.column_ids,
+           "Another unique constraint covers the same columns");
+  }
+
+  const auto unique_constraint = std::make_shared<UniqueConstraintIndex>(definition);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    Assert(unique_constraint->insert(*this, chunk_id, ChunkOffset{0}, get_chunk(chunk_id)->size(),
+                                     TransactionManager::INVALID_TRANSACTION_ID),
+           "Rows of the table violate the unique constraint");
+  }
+
+  _unique_constraints.emplace_back(unique_constraint);
+}
+
+const std::vector<std::shared_ptr<UniqueConstraintIndex>>& Table::unique_constraints() const {
+  return _unique_constraints;
+}
+
+void Table::_index_chunk(const ChunkID chunk_id) {
+  if (_table_indexes.empty() && _unique_constraints.empty()) return;
+
+  const auto chunk = get_chunk(chunk_id);
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
+  for (const auto& unique_constraint : _unique_constraints) {
+    Assert(unique_constraint->insert(*this, chunk_id, ChunkOffset{0}, chunk->size(),
+                                     TransactionManager::INVALID_TRANSACTION_ID),
+           "Rows of the chunk violate a unique constraint");
+  }
+}
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,13 +13,18 @@
 #include "proxy_chunk.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+class BaseTableIndex;
+class PartitionSchema;
+class UniqueConstraintIndex;
 class TableStatistics;
 
 /**
@@ -62,6 +69,26 @@ class Table : private Noncopyable {
   // return the maximum chunk size (cannot exceed ChunkOffset (uint32_t))
   uint32_t max_chunk_size() const;
 
+  /**
+   * Changes the size up to which chunks of a data table are filled from now on. Existing chunks keep their size, the
+   * ChunkMergeTask merges those that are small compared to it.
+   */
+  void set_max_chunk_size(const uint32_t max_chunk_size);
+
+  /**
+   * Chooses the max_chunk_size for a table of about @param expected_row_count rows. Chunks are the unit of parallelism
+   * (one job per chunk and operator) and of statistics, so there should be enough of them to keep all workers busy.
+   * However, small chunks make the per-chunk costs dominate, while chunks beyond Chunk::DEFAULT_SIZE make the
+   * chunk-local data structures (e.g., hash tables of the Aggregate) exceed the caches.
+   */
+  static uint32_t choose_max_chunk_size(const size_t expected_row_count);
+
+  // Chunks never get smaller than this when chosen by choose_max_chunk_size()
+  static constexpr auto MIN_CHOSEN_CHUNK_SIZE = ChunkOffset{10'000};
+
+  // The number of chunks per worker that choose_max_chunk_size() aims for, so that the workers can balance their load
+  static constexpr auto CHOSEN_CHUNKS_PER_WORKER = size_t{4};
+
   // Returns the number of rows.
   // This number includes invalidated (deleted) rows.
   // Use approx_valid_row_count() for an approximate count of valid rows instead.
@@ -104,8 +131,130 @@ class Table : private Noncopyable {
    */
   void append_chunk(const std::shared_ptr<Chunk>& chunk);
 
-  // Create and append a Chunk consisting of ValueSegments.
-  void append_mutable_chunk();
+  // Create and append a Chunk consisting of ValueSegments, for the rows of the partition with the @param partition_id
+  void append_mutable_chunk(const PartitionID partition_id = PartitionID{0});
+
+  /**
+   * Atomically replaces the chunk with an empty, immutable one, once the MvccGarbageCollector moved its rows. The ids
+   * of the other chunks stay the same, as RowIDs refer to them. Operators that still hold the chunk keep it alive.
+   */
+  void remove_chunk(const ChunkID chunk_id);
+
+  /** @} */
+
+  /**
+   * @defgroup Partitioning (see PartitionSchema)
+   *
+   * Each chunk of a partitioned table holds the rows of a single partition. append() and Insert add the rows to the
+   * last chunk of their partition, and chunks with rows of arbitrary partitions must not be appended.
+   * @{
+   */
+
+  // Partitions the table, which has to be an empty data table
+  void set_partition_schema(const std::shared_ptr<const PartitionSchema>& partition_schema);
+
+  // @return The PartitionSchema, or nullptr if the table is not partitioned
+  std::shared_ptr<const PartitionSchema> partition_schema() const;
+
+  // @return The chunk that was appended last for the partition, or INVALID_CHUNK_ID if there is none. The only
+  // partition of a table that is not partitioned is 0.
+  ChunkID last_chunk_id_of_partition(const PartitionID partition_id) const;
+
+  /**
+   * Removes all rows of the partition using remove_chunk(), e.g., to drop the oldest time range of a table that is
+   * range-partitioned by time. Like remove_chunk(), this does not respect transactions, so no transaction may insert
+   * into the partition concurrently. Rows that are inserted later are added to new chunks.
+   */
+  void drop_partition(const PartitionID partition_id);
+
+  // Appends a chunk of another table with the same PartitionSchema, which keeps its partition, e.g., to copy some of
+  // the chunks of a partitioned table
+  void append_partition_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  // Used by the recovery, which appends the chunks before it knows their partitions
+  void set_chunk_partition_id(const ChunkID chunk_id, const PartitionID partition_id);
+
+  /** @} */
+
+  /**
+   * @defgroup Column groups (see ColumnGroup)
+   *
+   * The ChunkEncoder stores the columns of each column group row-interleaved, so that accessing several of them per
+   * row, as OLTP lookups do, touches fewer cache lines. Chunks that are still mutable keep a ValueSegment per column.
+   * @{
+   */
+
+  // Declares the column groups, which must not overlap and may only contain columns of fixed width. Applies to the
+  // chunks that are encoded afterwards.
+  void set_column_groups(const std::vector<std::vector<ColumnID>>& column_groups);
+
+  const std::vector<std::vector<ColumnID>>& column_groups() const;
+
+  /** @} */
+
+  /**
+   * @defgroup NUMA replication of read-only tables
+   *
+   * Small tables that the workers of all NUMA nodes read, e.g., the dimension tables of joins, can keep a replica of
+   * each immutable chunk in the memory of each node (see Chunk::create_replica()). GetTable gives the operators of a
+   * worker the replicas of its node. Chunks that are appended or removed afterwards are read from the table itself
+   * until set_numa_replicated() is called again. Tables with indexes cannot be replicated.
+   * @{
+   */
+
+  // Replicates the immutable chunks to all nodes of the Topology, or drops the replicas
+  void set_numa_replicated(const bool numa_replicated);
+
+  bool is_numa_replicated() const;
+
+  // @return The replica of the chunk on the node with the @param node_id, or the chunk itself if there is none
+  std::shared_ptr<Chunk> get_chunk_replica(const ChunkID chunk_id, const NodeID node_id);
+
+  /** @} */
+
+  /**
+   * @defgroup Output slots for operators that create their output chunks in parallel, e.g., one per input chunk
+   *
+   * create_chunk_slots() prepares a number of empty slots. The jobs of the operator then fill them through
+   * set_chunk_slot() without any locking, as long as no two jobs fill the same slot. The chunk is created exactly as
+   * by append_chunk(). Finally, append_chunk_slots() appends the chunks of the filled slots in the order of the slots
+   * and removes the slots. Slots that were left empty (e.g., because a scan found no matches) are skipped. This way,
+   * the order of the output chunks does not depend on the order in which the jobs finish.
+   * @{
+   */
+
+  void create_chunk_slots(const size_t slot_count);
+
+  void set_chunk_slot(const size_t slot_idx, const Segments& segments,
+                      const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt,
+                      const std::shared_ptr<ChunkAccessCounter>& access_counter = nullptr);
+  void set_chunk_slot(const size_t slot_idx, const std::shared_ptr<Chunk>& chunk);
+
+  void append_chunk_slots();
+
+  /** @} */
+
+  /**
+   * @defgroup Output of operators that are executed in a pipeline (see OperatorTask)
+   *
+   * The output of a pipelined operator has one chunk per input chunk of the pipeline. create_pipelined_chunks() creates
+   * them as nullptrs. set_pipelined_chunk() works like set_chunk_slot(), but the chunk can be accessed through
+   * get_chunk() right away, so that the next operator of the pipeline can process it. Operators in the middle of a
+   * pipeline release their chunks as soon as they have been consumed. Finally, remove_missing_chunks() removes the
+   * chunks that were released or never set (e.g., because a scan found no matches).
+   * @{
+   */
+
+  void create_pipelined_chunks(const ChunkID chunk_count);
+
+  void set_pipelined_chunk(const ChunkID chunk_id, const Segments& segments,
+                           const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt,
+                           const std::shared_ptr<ChunkAccessCounter>& access_counter = nullptr);
+  void set_pipelined_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk);
+
+  void release_pipelined_chunk(const ChunkID chunk_id);
+
+  void remove_missing_chunks();
 
   /** @} */
 
@@ -118,6 +267,10 @@ class Table : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Appends all rows of a table with the same number of columns, and casts the values of other data types. Unless the
+  // table is partitioned, the rows are copied segment by segment and indexed per chunk instead of per row.
+  void append_rows(const Table& rows);
+
   // returns one materialized value
   // multiversion concurrency control values of chunks are ignored
   // - table needs to be validated before by Validate operator
@@ -144,9 +297,18 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
-  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
+  // The statistics are replaced while they are used, when chunks are added to them (see StorageManager)
+  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) {
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
+
+  std::shared_ptr<TableStatistics> table_statistics() const { return std::atomic_load(&_table_statistics); }
 
-  std::shared_ptr<TableStatistics> table_statistics() const { return _table_statistics; }
+  // The commit id of the last transaction that inserted or deleted rows of the table. Insert and Delete raise it when
+  // they commit, before the commit becomes visible to new snapshots (see SQLResultCache). Like the MVCC data of the
+  // chunks, it changes for const tables. Rows that are appended outside of transactions do not raise it.
+  CommitID last_commit_id() const;
+  void raise_last_commit_id(const CommitID commit_id) const;
 
   std::vector<IndexInfo> get_indexes() const;
 
@@ -158,22 +320,69 @@ class Table : private Noncopyable {
       chunk->create_index<Index>(column_ids);
     }
     IndexInfo i = {column_ids, name, index_type};
-    _indexes.emplace_back(i);
+    add_index_info(i);
   }
 
+  // Registers an index that exists on some of the chunks only, e.g., one created by the IndexTuner, so that the
+  // IndexScanRule considers it. The LQPTranslator scans the chunks without the index using a TableScan.
+  void add_index_info(const IndexInfo& index_info);
+
+  // Unregisters the index of the @param type on the columns with the @param column_ids. It is not removed from the
+  // chunks, as plans that were created before might still use it.
+  void remove_index_info(const std::vector<ColumnID>& column_ids, const SegmentIndexType type);
+
+  // Creates a TableIndex on the column with the @param column_id, which covers all chunks and is kept up to date as
+  // rows are added to the table (see BaseTableIndex)
+  std::shared_ptr<BaseTableIndex> create_table_index(const ColumnID column_id);
+
+  // @return The TableIndex on the column with the @param column_id, or nullptr if there is none
+  std::shared_ptr<BaseTableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseTableIndex>>& table_indexes() const;
+
+  // Adds a UNIQUE or PRIMARY KEY constraint, which Insert enforces (see UniqueConstraintIndex). Rows that are appended
+  // to the table directly (e.g., when loading it) are checked, too. Fail()s if the rows of the table violate it.
+  void add_unique_constraint(const TableConstraintDefinition& definition);
+
+  const std::vector<std::shared_ptr<UniqueConstraintIndex>>& unique_constraints() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
   size_t estimate_memory_usage() const;
 
  protected:
+  std::shared_ptr<Chunk> _create_chunk(const Segments& segments,
+                                       const std::optional<PolymorphicAllocator<Chunk>>& alloc,
+                                       const std::shared_ptr<ChunkAccessCounter>& access_counter) const;
+
+  // Adds all rows of the chunk with the @param chunk_id to the TableIndexes and UniqueConstraintIndexes
+  void _index_chunk(const ChunkID chunk_id);
+
+  // Chunks of arbitrary rows cannot be appended to partitioned tables
+  void _assert_not_partitioned() const;
+
+  // Makes sure the segments match with the TableType. Only checked in debug builds.
+  void _assert_segment_types(const Segments& segments) const;
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
-  const uint32_t _max_chunk_size;
+  copyable_atomic<uint32_t> _max_chunk_size;
+  mutable copyable_atomic<CommitID> _last_commit_id{0};
   std::vector<std::shared_ptr<Chunk>> _chunks;
+  std::vector<std::shared_ptr<Chunk>> _chunk_slots;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  std::unique_ptr<std::shared_mutex> _indexes_mutex;
   std::vector<IndexInfo> _indexes;
+  std::vector<std::shared_ptr<BaseTableIndex>> _table_indexes;
+  std::vector<std::shared_ptr<UniqueConstraintIndex>> _unique_constraints;
+  std::shared_ptr<const PartitionSchema> _partition_schema;
+  std::vector<std::vector<ColumnID>> _column_groups;
+  // The replicas by node and ChunkID. They are replaced as a whole while GetTable reads them.
+  std::shared_ptr<const std::vector<std::vector<std::shared_ptr<Chunk>>>> _numa_replicas;
+  // Read by Insert while other Inserts append chunks
+  std::vector<std::atomic<ChunkID::base_type>> _last_chunk_ids_by_partition;
 };
 }  // namespace opossum
@@ -0,0 +1,13 @@
+#include "table_constraint_definition.hpp"
+
+namespace opossum {
+
+TableConstraintDefinition::TableConstraintDefinition(const std::vector<ColumnID>& column_ids,
+                                                     const IsPrimaryKey is_primary_key)
+    : column_ids(column_ids), is_primary_key(is_primary_key) {}
+
+bool TableConstraintDefinition::operator==(const TableConstraintDefinition& rhs) const {
+  return column_ids == rhs.column_ids && is_primary_key == rhs.is_primary_key;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class IsPrimaryKey : bool { Yes = true, No = false };
+
+// A UNIQUE or PRIMARY KEY constraint on one or more columns of a table, see Table::add_unique_constraint()
+struct TableConstraintDefinition final {
+  TableConstraintDefinition() = default;
+  explicit TableConstraintDefinition(const std::vector<ColumnID>& column_ids,
+                                     const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+
+  bool operator==(const TableConstraintDefinition& rhs) const;
+
+  std::vector<ColumnID> column_ids;
+  IsPrimaryKey is_primary_key{IsPrimaryKey::No};
+};
+
+using TableConstraintDefinitions = std::vector<TableConstraintDefinition>;
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -35,7 +36,8 @@ ValueSegment<T>::ValueSegment(pmr_concurrent_vector<T>&& values, pmr_concurrent_
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values({std::move(null_values), alloc}) {
+      _null_values({std::move(null_values), alloc}),
+      _may_contain_nulls{std::find(_null_values->cbegin(), _null_values->cend(), true) != _null_values->cend()} {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
 }
 
@@ -52,7 +54,8 @@ ValueSegment<T>::ValueSegment(const std::vector<T>& values, std::vector<bool>& n
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(values, alloc),
-      _null_values(pmr_concurrent_vector<bool>(null_values, alloc)) {
+      _null_values(pmr_concurrent_vector<bool>(null_values, alloc)),
+      _may_contain_nulls{std::find(null_values.cbegin(), null_values.cend(), true) != null_values.cend()} {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
 }
 
@@ -61,7 +64,8 @@ ValueSegment<T>::ValueSegment(std::vector<T>&& values, std::vector<bool>&& null_
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values(pmr_concurrent_vector<bool>(std::move(null_values), alloc)) {
+      _null_values(pmr_concurrent_vector<bool>(std::move(null_values), alloc)),
+      _may_contain_nulls{std::find(_null_values->cbegin(), _null_values->cend(), true) != _null_values->cend()} {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
 }
 
@@ -105,6 +109,8 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   bool is_null = variant_is_null(val);
 
   if (is_nullable()) {
+    // Set before the NULL is added, so that iterators that are created from now on check for it
+    if (is_null) _may_contain_nulls = true;
     (*_null_values).push_back(is_null);
     _values.push_back(is_null ? T{} : type_cast_variant<T>(val));
     return;
@@ -147,9 +153,15 @@ template <typename T>
 pmr_concurrent_vector<bool>& ValueSegment<T>::null_values() {
   DebugAssert(is_nullable(), "This ValueSegment does not support null values.");
 
+  _may_contain_nulls = true;
   return *_null_values;
 }
 
+template <typename T>
+bool ValueSegment<T>::may_contain_nulls() const {
+  return _may_contain_nulls;
+}
+
 template <typename T>
 size_t ValueSegment<T>::size() const {
   return _values.size();
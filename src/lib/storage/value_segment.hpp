@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
@@ -61,9 +62,17 @@ class ValueSegment : public BaseValueSegment {
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
   // Usually you need to access more than a single value anyway.
+  // The non-const version assumes that NULLs are written into the vector, see may_contain_nulls().
   const pmr_concurrent_vector<bool>& null_values() const final;
   pmr_concurrent_vector<bool>& null_values() final;
 
+  /**
+   * Return whether the segment might contain NULLs. False for segments that are not nullable, and for nullable segments
+   * that no NULL has been added to, neither by the constructor, nor by append(), nor through the non-const
+   * null_values(). The iterables treat the others like segments that are not nullable and skip all NULL checks.
+   */
+  bool may_contain_nulls() const final;
+
   // Return the number of entries in the segment.
   size_t size() const final;
 
@@ -79,6 +88,9 @@ class ValueSegment : public BaseValueSegment {
   // (e.g. DictionarySegment) do not. For this reason, we need to store the nullable information separately
   // in the table's definition.
   std::optional<pmr_concurrent_vector<bool>> _null_values;
+
+  // Atomic, as Insert writes NULLs into segments that are being read
+  std::atomic_bool _may_contain_nulls{false};
 };
 
 }  // namespace opossum
@@ -15,9 +15,10 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
   explicit ValueSegmentIterable(const ValueSegment<T>& segment) : _segment{segment} {}
 
+  // Nullable segments without NULLs are iterated like segments that are not nullable, see may_contain_nulls()
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
-    if (_segment.is_nullable()) {
+    if (_segment.may_contain_nulls()) {
       auto begin = Iterator{_segment.values().cbegin(), _segment.values().cbegin(), _segment.null_values().cbegin()};
       auto end = Iterator{_segment.values().cbegin(), _segment.values().cend(), _segment.null_values().cend()};
       functor(begin, end);
@@ -30,7 +31,7 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
-    if (_segment.is_nullable()) {
+    if (_segment.may_contain_nulls()) {
       auto begin = PointAccessIterator{_segment.values(), _segment.null_values(), position_filter->cbegin(),
                                        position_filter->cbegin()};
       auto end = PointAccessIterator{_segment.values(), _segment.null_values(), position_filter->cbegin(),
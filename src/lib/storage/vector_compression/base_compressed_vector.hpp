@@ -42,6 +42,14 @@ class BaseCompressedVector : private Noncopyable {
 
   virtual CompressedVectorType type() const = 0;
 
+  /**
+   * @brief Decodes the @param count values starting at the index @param begin into @param values
+   *
+   * Unlike the iterators and decompressors, which hand out the values one at a time, this unpacks whole blocks at
+   * once, directly into the output where possible. @param values must hold at least @param count values.
+   */
+  virtual void decode_into(const size_t begin, const size_t count, uint32_t* values) const = 0;
+
   virtual std::unique_ptr<BaseVectorDecompressor> create_base_decompressor() const = 0;
 
   virtual std::unique_ptr<const BaseCompressedVector> copy_using_allocator(
@@ -100,6 +108,10 @@ class CompressedVector : public BaseCompressedVector {
 
   CompressedVectorType type() const final { return get_compressed_vector_type<Derived>(); }
 
+  void decode_into(const size_t begin, const size_t count, uint32_t* values) const final {
+    _self().on_decode_into(begin, count, values);
+  }
+
   std::unique_ptr<BaseVectorDecompressor> create_base_decompressor() const final {
     return _self().on_create_base_decompressor();
   }
@@ -3,6 +3,8 @@
 #include <boost/hana/contains.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
+
+#include <algorithm>
 #include <memory>
 
 #include "fixed_size_byte_aligned_decompressor.hpp"
@@ -39,6 +41,10 @@ class FixedSizeByteAlignedVector : public CompressedVector<FixedSizeByteAlignedV
     return std::make_unique<FixedSizeByteAlignedDecompressor<UnsignedIntType>>(_data);
   }
 
+  void on_decode_into(const size_t begin, const size_t count, uint32_t* values) const {
+    std::copy(_data.cbegin() + begin, _data.cbegin() + begin + count, values);
+  }
+
   auto on_begin() const { return _data.cbegin(); }
 
   auto on_end() const { return _data.cend(); }
@@ -1,5 +1,7 @@
 #include "simd_bp128_iterator.hpp"
 
+#include <numeric>
+
 namespace opossum {
 
 SimdBp128Iterator::SimdBp128Iterator(const pmr_vector<uint128_t>* data, size_t size, size_t absolute_index)
@@ -25,9 +27,9 @@ SimdBp128Iterator::SimdBp128Iterator(const SimdBp128Iterator& other)
 void SimdBp128Iterator::_unpack_next_meta_block() {
   _read_meta_info();
 
-  for (uint8_t meta_info_index = 0u; meta_info_index < Packing::blocks_in_meta_block; ++meta_info_index) {
-    _unpack_block(meta_info_index);
-  }
+  Packing::unpack_blocks(_data->data() + _data_index, _current_meta_block->data(), _current_meta_info.data(),
+                         Packing::blocks_in_meta_block);
+  _data_index += std::accumulate(_current_meta_info.begin(), _current_meta_info.end(), size_t{0u});
 
   _current_meta_block_index = 0u;
 }
@@ -36,14 +38,4 @@ void SimdBp128Iterator::_read_meta_info() {
   Packing::read_meta_info(_data->data() + _data_index++, _current_meta_info.data());
 }
 
-void SimdBp128Iterator::_unpack_block(uint8_t meta_info_index) {
-  const auto in = _data->data() + _data_index;
-  auto out = _current_meta_block->data() + (meta_info_index * Packing::block_size);
-  const auto bit_size = _current_meta_info[meta_info_index];
-
-  Packing::unpack_block(in, out, bit_size);
-
-  _data_index += bit_size;
-}
-
 }  // namespace opossum
@@ -43,7 +43,6 @@ class SimdBp128Iterator : public BaseCompressedVectorIterator<SimdBp128Iterator>
   void _unpack_next_meta_block();
 
   void _read_meta_info();
-  void _unpack_block(uint8_t meta_info_index);
 
  private:
   const pmr_vector<uint128_t>* _data;
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include "simd_bp128_wide_unpacking.hpp"
 #include "utils/assert.hpp"
 
 // When casting into this data type, make sure that the underlying data is properly aligned to 16 byte boundaries.
@@ -128,6 +129,14 @@ void unpack_128_zeros(uint32_t* out) {
   std::fill(out, out + NUM_ZEROES, 0u);
 }
 
+// The number of blocks that unpack_blocks() unpacks at once, depending on the widest registers supported by the CPU
+uint8_t wide_unpacking_block_count() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return 4u;
+  if (__builtin_cpu_supports("avx2")) return 2u;
+  return 1u;
+}
+
 }  // namespace
 
 void SimdBp128Packing::write_meta_info(const uint8_t* in, uint128_t* out) {
@@ -291,6 +300,38 @@ void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint
   }
 }
 
+void SimdBp128Packing::unpack_blocks(const uint128_t* in, uint32_t* out, const uint8_t* bit_sizes,
+                                     const uint8_t block_count) {
+  static const auto wide_block_count = wide_unpacking_block_count();
+
+  auto block_index = 0u;
+  while (block_index < block_count) {
+    // The blocks up to run_end have the same bit size
+    const auto bit_size = bit_sizes[block_index];
+    auto run_end = block_index + 1u;
+    while (run_end < block_count && bit_sizes[run_end] == bit_size) ++run_end;
+
+    while (block_index < run_end) {
+      const auto remaining_block_count = run_end - block_index;
+      auto unpacked_block_count = 1u;
+
+      if (wide_block_count >= 4u && remaining_block_count >= 4u) {
+        unpack_4_blocks_avx512(in, out, bit_size);
+        unpacked_block_count = 4u;
+      } else if (wide_block_count >= 2u && remaining_block_count >= 2u) {
+        unpack_2_blocks_avx2(in, out, bit_size);
+        unpacked_block_count = 2u;
+      } else {
+        unpack_block(in, out, bit_size);
+      }
+
+      block_index += unpacked_block_count;
+      in += unpacked_block_count * bit_size;
+      out += unpacked_block_count * block_size;
+    }
+  }
+}
+
 void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
   if (bit_size == 0u) {
     unpack_128_zeros(out);
@@ -26,6 +26,14 @@ class SimdBp128Packing {
 
   static void pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size);
   static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+
+  /**
+   * @brief Unpacks @param block_count consecutive blocks of a meta block with the given @param bit_sizes
+   *
+   * Runs of blocks with the same bit size are unpacked four or two at a time using 512-bit or 256-bit registers if the
+   * CPU supports AVX-512 or AVX2, which is detected at runtime (see simd_bp128_wide_unpacking.hpp).
+   */
+  static void unpack_blocks(const uint128_t* in, uint32_t* out, const uint8_t* bit_sizes, const uint8_t block_count);
 };
 
 }  // namespace opossum
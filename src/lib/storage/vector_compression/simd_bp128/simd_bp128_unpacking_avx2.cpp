@@ -0,0 +1,36 @@
+#include <immintrin.h>
+
+#include "simd_bp128_wide_unpacking.hpp"
+
+// Compiled with -mavx2, see src/lib/CMakeLists.txt
+
+namespace opossum {
+
+namespace {
+
+struct Avx2Blocks {
+  using Register = uint32_t __attribute__((vector_size(32)));
+  static constexpr auto block_count = 2u;
+
+  // Loads the 128-bit words of two blocks, which are bit_size words apart
+  static Register load(const uint128_t* in, const uint8_t bit_size) {
+    const auto first = _mm_load_si128(reinterpret_cast<const __m128i*>(in));
+    const auto second = _mm_load_si128(reinterpret_cast<const __m128i*>(in + bit_size));
+    return reinterpret_cast<Register>(_mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1));
+  }
+
+  // Stores the four integers of each block into the outputs of the blocks, which are 128 integers apart
+  static void store(uint32_t* out, const Register& reg) {
+    const auto value = reinterpret_cast<__m256i>(reg);
+    _mm_store_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(value));
+    _mm_store_si128(reinterpret_cast<__m128i*>(out + 128u), _mm256_extracti128_si256(value, 1));
+  }
+};
+
+}  // namespace
+
+void unpack_2_blocks_avx2(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  simd_bp128_wide_unpacking::unpack_blocks<Avx2Blocks>(in, out, bit_size, std::make_index_sequence<33u>{});
+}
+
+}  // namespace opossum
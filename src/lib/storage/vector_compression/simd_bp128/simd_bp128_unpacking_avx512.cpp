@@ -0,0 +1,50 @@
+#include <immintrin.h>
+
+#include "simd_bp128_wide_unpacking.hpp"
+
+// Compiled with -mavx512f, see src/lib/CMakeLists.txt
+
+namespace opossum {
+
+namespace {
+
+struct Avx512Blocks {
+  using Register = uint32_t __attribute__((vector_size(64)));
+  static constexpr auto block_count = 4u;
+
+  // Loads the 128-bit words of four blocks, which are bit_size words apart
+  static Register load(const uint128_t* in, const uint8_t bit_size) {
+    const auto first = _mm_load_si128(reinterpret_cast<const __m128i*>(in));
+    const auto second = _mm_load_si128(reinterpret_cast<const __m128i*>(in + bit_size));
+    const auto third = _mm_load_si128(reinterpret_cast<const __m128i*>(in + 2u * bit_size));
+    const auto fourth = _mm_load_si128(reinterpret_cast<const __m128i*>(in + 3u * bit_size));
+
+    auto value = _mm512_castsi128_si512(first);
+    value = _mm512_inserti32x4(value, second, 1);
+    value = _mm512_inserti32x4(value, third, 2);
+    value = _mm512_inserti32x4(value, fourth, 3);
+    return reinterpret_cast<Register>(value);
+  }
+
+  /**
+   * Stores the four integers of each block into the outputs of the blocks, which are 128 integers apart. The zero
+   * masking variants with a full mask are the same instructions as the unmasked ones, which GCC implements with an
+   * undefined value that it then warns about.
+   */
+  static void store(uint32_t* out, const Register& reg) {
+    constexpr auto FULL_MASK = __mmask8{0xFF};
+    const auto value = reinterpret_cast<__m512i>(reg);
+    _mm_store_si128(reinterpret_cast<__m128i*>(out), _mm512_maskz_extracti32x4_epi32(FULL_MASK, value, 0));
+    _mm_store_si128(reinterpret_cast<__m128i*>(out + 128u), _mm512_maskz_extracti32x4_epi32(FULL_MASK, value, 1));
+    _mm_store_si128(reinterpret_cast<__m128i*>(out + 256u), _mm512_maskz_extracti32x4_epi32(FULL_MASK, value, 2));
+    _mm_store_si128(reinterpret_cast<__m128i*>(out + 384u), _mm512_maskz_extracti32x4_epi32(FULL_MASK, value, 3));
+  }
+};
+
+}  // namespace
+
+void unpack_4_blocks_avx512(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  simd_bp128_wide_unpacking::unpack_blocks<Avx512Blocks>(in, out, bit_size, std::make_index_sequence<33u>{});
+}
+
+}  // namespace opossum
@@ -1,5 +1,12 @@
 #include "simd_bp128_vector.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 SimdBp128Vector::SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size) : _data{std::move(vector)}, _size{size} {}
@@ -17,6 +24,62 @@ std::unique_ptr<SimdBp128Decompressor> SimdBp128Vector::on_create_decompressor()
   return std::make_unique<SimdBp128Decompressor>(*this);
 }
 
+void SimdBp128Vector::on_decode_into(const size_t begin, const size_t count, uint32_t* values) const {
+  using Packing = SimdBp128Packing;
+  DebugAssert(begin + count <= _size, "Range out of bounds");
+
+  const auto end = begin + count;
+  // The blocks begin at multiples of the block size, so their outputs are aligned if the output of the index 0 would be
+  const auto is_output_aligned = (reinterpret_cast<std::uintptr_t>(values) - begin * sizeof(uint32_t)) % 16u == 0u;
+
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  alignas(16) auto block = std::array<uint32_t, Packing::block_size>{};
+
+  auto data_index = size_t{0u};
+  for (auto meta_block_begin = size_t{0u}; meta_block_begin < end; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(_data.data() + data_index++, meta_info.data());
+
+    const auto meta_block_end = meta_block_begin + Packing::meta_block_size;
+    const auto meta_block_data_size = std::accumulate(meta_info.begin(), meta_info.end(), size_t{0u});
+
+    // Meta blocks before the range are skipped using the bit sizes of their blocks
+    if (meta_block_end <= begin) {
+      data_index += meta_block_data_size;
+      continue;
+    }
+
+    if (is_output_aligned && begin <= meta_block_begin && meta_block_end <= end) {
+      Packing::unpack_blocks(_data.data() + data_index, values + (meta_block_begin - begin), meta_info.data(),
+                             Packing::blocks_in_meta_block);
+      data_index += meta_block_data_size;
+      continue;
+    }
+
+    for (auto block_index = 0u; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      const auto block_end = block_begin + Packing::block_size;
+      const auto bit_size = meta_info[block_index];
+
+      if (block_end > begin && block_begin < end) {
+        const auto in = _data.data() + data_index;
+
+        if (is_output_aligned && begin <= block_begin && block_end <= end) {
+          Packing::unpack_block(in, values + (block_begin - begin), bit_size);
+        } else {
+          Packing::unpack_block(in, block.data(), bit_size);
+
+          const auto copy_begin = std::max(begin, block_begin);
+          const auto copy_end = std::min(end, block_end);
+          std::copy(block.begin() + (copy_begin - block_begin), block.begin() + (copy_end - block_begin),
+                    values + (copy_begin - begin));
+        }
+      }
+
+      data_index += bit_size;
+    }
+  }
+}
+
 SimdBp128Iterator SimdBp128Vector::on_begin() const { return SimdBp128Iterator{&_data, _size, 0u}; }
 
 SimdBp128Iterator SimdBp128Vector::on_end() const { return SimdBp128Iterator{nullptr, _size, _size}; }
@@ -33,6 +33,9 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
   std::unique_ptr<BaseVectorDecompressor> on_create_base_decompressor() const;
   std::unique_ptr<SimdBp128Decompressor> on_create_decompressor() const;
 
+  // Unpacks the blocks of the range directly into the output if they are complete and it is 16 byte aligned
+  void on_decode_into(const size_t begin, const size_t count, uint32_t* values) const;
+
   SimdBp128Iterator on_begin() const;
   SimdBp128Iterator on_end() const;
 
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "oversized_types.hpp"
+
+namespace opossum {
+
+/**
+ * @defgroup Unpacking of multiple SIMD-BP128 blocks at once using AVX2 or AVX-512
+ *
+ * A block of 128 integers is packed into four interleaved 32-bit lanes (see simd_bp128_packing.cpp), so that a
+ * 128-bit register unpacks four integers per step. Consecutive blocks of the same bit size are unpacked together in
+ * a 256-bit or 512-bit register that holds the lanes of two or four blocks: The 128-bit words of the blocks are
+ * loaded into the parts of the register, and the parts are stored to the outputs of the blocks.
+ *
+ * The functions are defined in translation units that are compiled with -mavx2 and -mavx512f, respectively. They must
+ * only be called if the CPU supports these instructions (see SimdBp128Packing::unpack_blocks()).
+ *
+ * @param in the packed data of the blocks, which follow each other
+ * @param out the output for 128 integers per block, aligned to 16 bytes
+ * @param bit_size the bit size of all blocks
+ * @{
+ */
+void unpack_2_blocks_avx2(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+void unpack_4_blocks_avx512(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+/**@}*/
+
+namespace simd_bp128_wide_unpacking {
+
+/**
+ * Unpacks the blocks from the loads of the Blocks, which describe the width of the register: Blocks::Register holds
+ * Blocks::block_count 128-bit words, the i-th of which is the one of the i-th block. Works like Unpack128Bit in
+ * simd_bp128_packing.cpp.
+ */
+template <typename Blocks, uint8_t bit_size, uint8_t carry_over = 0u, uint8_t remaining_recursions = bit_size>
+struct UnpackBlocks {
+  using Register = typename Blocks::Register;
+
+  void operator()(const uint128_t* in, uint32_t* out, Register& in_reg, Register& out_reg,
+                  const Register& mask) const {
+    constexpr auto BITS_IN_WORD = 32u;
+    constexpr auto INTEGERS_IN_WORD = 4u;
+
+    // Number of integers that fit completely into the 32-bit sub-blocks
+    constexpr auto I_MAX = (BITS_IN_WORD - carry_over) / bit_size;
+
+    for (auto i = 0u; i < I_MAX; ++i) {
+      const auto offset = carry_over + i * bit_size;
+      out_reg = (in_reg >> offset) & mask;
+      Blocks::store(out, out_reg);
+      out += INTEGERS_IN_WORD;
+    }
+
+    constexpr auto NEXT_OFFSET = carry_over + I_MAX * bit_size;
+    constexpr auto NUM_FIRST_BITS = BITS_IN_WORD - NEXT_OFFSET;
+
+    // Check if integers have been split across the 128-bit block boundary
+    if (NEXT_OFFSET < BITS_IN_WORD) {
+      out_reg = in_reg >> NEXT_OFFSET;
+      in_reg = Blocks::load(++in, bit_size);
+
+      out_reg = out_reg | ((in_reg << NUM_FIRST_BITS) & mask);
+      Blocks::store(out, out_reg);
+      out += INTEGERS_IN_WORD;
+    } else {
+      constexpr auto LAST_RECURSION = 1u;
+
+      // Only load another 128-bit word if it's not the last recursion
+      if (remaining_recursions > LAST_RECURSION) {
+        in_reg = Blocks::load(++in, bit_size);
+      }
+    }
+
+    // Calculate the new carry over
+    constexpr auto NEW_CARRY_OVER = NEXT_OFFSET < BITS_IN_WORD ? bit_size - NUM_FIRST_BITS : 0u;
+    UnpackBlocks<Blocks, bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, out, in_reg, out_reg, mask);
+  }
+};
+
+template <typename Blocks, uint8_t bit_size, uint8_t carry_over>
+struct UnpackBlocks<Blocks, bit_size, carry_over, 0u> {
+  using Register = typename Blocks::Register;
+
+  void operator()(const uint128_t* in, uint32_t* out, Register& in_reg, Register& out_reg,
+                  const Register& mask) const {}
+};
+
+template <typename Blocks, size_t bit_size>
+void unpack_blocks_with_bit_size(const uint128_t* in, uint32_t* out) {
+  using Register = typename Blocks::Register;
+  constexpr auto BLOCK_SIZE = 128u;
+
+  if constexpr (bit_size == 0u) {
+    // Not std::fill(), which might be instantiated by other translation units that are not compiled for AVX
+    for (auto index = 0u; index < Blocks::block_count * BLOCK_SIZE; ++index) {
+      out[index] = 0u;
+    }
+  } else {
+    auto in_reg = Blocks::load(in, bit_size);
+    auto out_reg = Register{};
+    const auto mask = Register{} + static_cast<uint32_t>((1ul << bit_size) - 1);
+
+    UnpackBlocks<Blocks, static_cast<uint8_t>(bit_size)>{}(in, out, in_reg, out_reg, mask);
+  }
+}
+
+template <typename Blocks, size_t... bit_sizes>
+void unpack_blocks(const uint128_t* in, uint32_t* out, const uint8_t bit_size, std::index_sequence<bit_sizes...>) {
+  using Kernel = void (*)(const uint128_t*, uint32_t*);
+  static constexpr Kernel kernels[] = {&unpack_blocks_with_bit_size<Blocks, bit_sizes>...};
+
+  kernels[bit_size](in, out);
+}
+
+}  // namespace simd_bp128_wide_unpacking
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include "sql/sql_plan_cache.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
@@ -17,7 +18,15 @@ ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const
     : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
 
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+    : ChunkCompressionTask{table_name, chunk_ids, {}} {}
+
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs,
+                                           SchedulePriority priority)
+    : AbstractTask{priority},
+      _table_name{table_name},
+      _chunk_ids{chunk_ids},
+      _chunk_encoding_specs{chunk_encoding_specs} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
@@ -29,20 +38,36 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    const auto chunk_encoding_spec_iter = _chunk_encoding_specs.find(chunk_id);
+    if (chunk_encoding_spec_iter != _chunk_encoding_specs.end()) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec_iter->second,
+                                 table->column_groups());
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), SegmentEncodingSpec{}, table->column_groups());
+    }
   }
+
+  // The chunks are complete, so that their rows can be added to the statistics of the table
+  StorageManager::get().add_chunks_to_table_statistics(_table_name, _chunk_ids);
+
+  // Encoding a chunk creates its statistics, which the ChunkPruningRule takes into account for new plans
+  SQLPlanCacheDependencies::get().invalidate_table(_table_name);
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
-  if (chunk->size() != max_chunk_size) return false;
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<const Chunk>& chunk,
+                                              const uint32_t max_chunk_size) {
+  // Chunks that were filled before the max_chunk_size of the table was lowered may be larger
+  if (chunk->size() < max_chunk_size) return false;
 
-  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  if (chunk->has_mvcc_data()) {
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-  for (const auto begin_cid : mvcc_data->begin_cids) {
-    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+    for (const auto begin_cid : mvcc_data->begin_cids) {
+      if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+    }
   }
 
   return true;
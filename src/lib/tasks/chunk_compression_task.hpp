@@ -1,16 +1,18 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
 class Chunk;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the default encoding or the given encoding specs
  *
  * The task compresses a chunk by sequentially compressing segments.
  * From each value segment, a dictionary segment is created that replaces the
@@ -35,19 +37,24 @@ class ChunkCompressionTask : public AbstractTask {
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
 
- protected:
-  void _on_execute() override;
+  // Chunks without an entry in chunk_encoding_specs are encoded using the default encoding
+  ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                       const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs,
+                       SchedulePriority priority = SchedulePriority::Default);
 
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<const Chunk>& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::map<ChunkID, ChunkEncodingSpec> _chunk_encoding_specs;
 };
 }  // namespace opossum
@@ -0,0 +1,40 @@
+#include "chunk_merge_task.hpp"
+
+#include <string>
+
+#include "storage/chunk.hpp"
+#include "storage/mvcc_garbage_collector.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkMergeTask::ChunkMergeTask(const std::string& table_name, const float min_fill_fraction)
+    : _table_name{table_name}, _min_fill_fraction{min_fill_fraction} {}
+
+size_t ChunkMergeTask::merged_chunk_count() const { return _merged_chunk_count; }
+
+void ChunkMergeTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  Assert(table->type() == TableType::Data && table->has_mvcc() == UseMvcc::Yes,
+         "Only the chunks of data tables with MVCC can be merged");
+
+  const auto min_chunk_size =
+      static_cast<ChunkOffset>(_min_fill_fraction * static_cast<float>(table->max_chunk_size()));
+
+  // The chunks that are appended while the rows are moved are not looked at. Inserts only go to the last chunk, or to
+  // the last chunk of each partition if the table is partitioned.
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1 < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    // Empty chunks have been removed already (see Table::remove_chunk())
+    if (chunk->size() == 0 || chunk->size() >= min_chunk_size || chunk->cleanup_commit_id()) continue;
+    if (table->partition_schema() && table->last_chunk_id_of_partition(chunk->partition_id()) == chunk_id) continue;
+
+    if (MvccGarbageCollector::get().compact_chunk(_table_name, chunk_id)) ++_merged_chunk_count;
+  }
+}
+
+}  // namespace opossum
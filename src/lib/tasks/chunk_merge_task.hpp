@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Merges the small chunks of a table into full-sized ones
+ *
+ * Chunks that no longer receive inserts, but hold less than min_fill_fraction * max_chunk_size rows, cost a job per
+ * operator and statistics of their own for only few rows. They result, e.g., from trickle inserts before a restart or
+ * from lowering the max_chunk_size of the table.
+ *
+ * A chunk cannot be merged in place, as RowIDs refer to its rows. Instead, its visible rows are moved to the end of
+ * the table in a transaction, where they fill up the last chunk, exactly like the MvccGarbageCollector compacts a
+ * chunk (see MvccGarbageCollector::compact_chunk()). The merged chunks are removed by the MvccGarbageCollector once
+ * no transaction looks at them anymore, and the ChunkCompressionManager encodes the new chunks once they are full.
+ * Chunks whose transaction conflicts with others are left as they are and merged by a later run.
+ */
+class ChunkMergeTask : public AbstractTask {
+ public:
+  explicit ChunkMergeTask(const std::string& table_name, const float min_fill_fraction = 0.5f);
+
+  // The number of chunks that have been merged into others
+  size_t merged_chunk_count() const;
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const float _min_fill_fraction;
+  size_t _merged_chunk_count{0};
+};
+
+}  // namespace opossum
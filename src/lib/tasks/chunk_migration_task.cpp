@@ -42,7 +42,8 @@ void ChunkMigrationTask::_on_execute() {
 }
 
 bool ChunkMigrationTask::chunk_is_completed(const std::shared_ptr<const Chunk>& chunk, const uint32_t max_chunk_size) {
-  if (chunk->size() != max_chunk_size) return false;
+  // Chunks that were filled before the max_chunk_size of the table was lowered may be larger
+  if (chunk->size() < max_chunk_size) return false;
 
   if (chunk->has_mvcc_data()) {
     auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
@@ -0,0 +1,153 @@
+#include "chunk_sort_task.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the chunk offsets of the rows of the segment in their sorted order
+std::vector<ChunkOffset> sorted_chunk_offsets(const BaseSegment& segment, const OrderByMode order_by_mode) {
+  auto sorted_offsets = std::vector<ChunkOffset>{};
+  sorted_offsets.reserve(segment.size());
+
+  resolve_data_type(segment.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto null_offsets = std::vector<ChunkOffset>{};
+    auto offset_value_pairs = std::vector<std::pair<ChunkOffset, ColumnDataType>>{};
+    offset_value_pairs.reserve(segment.size());
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_offsets.emplace_back(position.chunk_offset());
+      } else {
+        offset_value_pairs.emplace_back(position.chunk_offset(), position.value());
+      }
+    });
+
+    if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast) {
+      std::stable_sort(offset_value_pairs.begin(), offset_value_pairs.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+    } else {
+      std::stable_sort(offset_value_pairs.begin(), offset_value_pairs.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+    }
+
+    const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+    if (nulls_first) sorted_offsets.insert(sorted_offsets.end(), null_offsets.begin(), null_offsets.end());
+    for (const auto& [chunk_offset, value] : offset_value_pairs) {
+      sorted_offsets.emplace_back(chunk_offset);
+    }
+    if (!nulls_first) sorted_offsets.insert(sorted_offsets.end(), null_offsets.begin(), null_offsets.end());
+  });
+
+  return sorted_offsets;
+}
+
+// Returns a copy of the segment with its rows in the order of the sorted_offsets, encoded like the segment
+std::shared_ptr<BaseSegment> reorder_segment(const std::shared_ptr<const BaseSegment>& segment, const bool nullable,
+                                             const std::vector<ChunkOffset>& sorted_offsets) {
+  auto reordered_segment = std::shared_ptr<BaseValueSegment>{};
+
+  resolve_data_type(segment->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+    auto values = pmr_concurrent_vector<ColumnDataType>(sorted_offsets.size());
+    auto null_values = pmr_concurrent_vector<bool>(nullable ? sorted_offsets.size() : 0);
+
+    for (auto row_idx = size_t{0}; row_idx < sorted_offsets.size(); ++row_idx) {
+      const auto value = accessor->access(sorted_offsets[row_idx]);
+      if (value) {
+        values[row_idx] = *value;
+      } else {
+        null_values[row_idx] = true;
+      }
+    }
+
+    if (nullable) {
+      reordered_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      reordered_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+
+  if (const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment)) {
+    return encode_segment(encoded_segment->encoding_type(), segment->data_type(), reordered_segment);
+  }
+  return reordered_segment;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ChunkSortTask::ChunkSortTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                             const ColumnID column_id, const OrderByMode order_by_mode)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _column_id{column_id}, _order_by_mode{order_by_mode} {}
+
+void ChunkSortTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  Assert(table->type() == TableType::Data, "Only the chunks of data tables can be sorted");
+  Assert(_column_id < table->column_count(), "ColumnID out of range");
+  Assert(table->table_indexes().empty(), "Sorting the chunks would invalidate the table indexes");
+
+  for (const auto chunk_id : _chunk_ids) {
+    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto sorted_offsets = sorted_chunk_offsets(*chunk->get_segment(_column_id), _order_by_mode);
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      Assert(chunk->get_indices(std::vector<ColumnID>{column_id}).empty(),
+             "Sorting the chunk would invalidate its indexes");
+      chunk->replace_segment(column_id, reorder_segment(chunk->get_segment(column_id),
+                                                        table->column_is_nullable(column_id), sorted_offsets));
+    }
+
+    // The MVCC data moves with the rows
+    if (chunk->has_mvcc_data()) {
+      auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      const auto begin_cids = mvcc_data->begin_cids;
+      const auto end_cids = mvcc_data->end_cids;
+
+      for (auto row_idx = size_t{0}; row_idx < sorted_offsets.size(); ++row_idx) {
+        const auto chunk_offset = sorted_offsets[row_idx];
+        Assert(mvcc_data->tids[chunk_offset].load() == 0u && begin_cids[chunk_offset] != MvccData::MAX_COMMIT_ID,
+               "Only chunks whose rows are committed and unlocked can be sorted");
+        mvcc_data->begin_cids[row_idx] = begin_cids[chunk_offset];
+        mvcc_data->end_cids[row_idx] = end_cids[chunk_offset];
+      }
+      mvcc_data->invalidate_visibility_summary();
+    }
+
+    // Rows appended later would not be in order
+    chunk->mark_immutable();
+    chunk->set_ordered_by({_column_id, _order_by_mode});
+  }
+
+  // Cached results might reference the rows by their RowIDs, which have changed
+  SQLResultCache::get().invalidate_table(_table_name);
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Physically sorts the rows of chunks of a table by a column and records the order (see Chunk::ordered_by())
+ *
+ * Scans on sorted chunks binary-search the column, Sort and JoinSortMerge do not sort them again, and Aggregate
+ * groups their rows without hashing. The non-NULL values are ordered like by the Sort operator, which is also stable.
+ *
+ * Other than compressing a chunk, sorting it moves its rows, which invalidates the RowIDs that point into it. Thus,
+ * the table must not be accessed while it is sorted, and its chunks must not have any indexes. The intended use is
+ * sorting a table right after it was loaded. All rows must be committed and none may be locked. Encoded segments are
+ * encoded again with the same encoding type, so sorting before the chunks are encoded saves that work. Sorted chunks
+ * are marked immutable, so that no rows are appended to them.
+ */
+class ChunkSortTask : public AbstractTask {
+ public:
+  ChunkSortTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids, const ColumnID column_id,
+                const OrderByMode order_by_mode = OrderByMode::Ascending);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const std::vector<ChunkID> _chunk_ids;
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+};
+
+}  // namespace opossum
@@ -8,7 +8,9 @@
 #include <ctime>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "chunk_migration_task.hpp"
@@ -38,8 +40,11 @@ struct NodeInfoSet {
 struct ChunkInfo {
   std::string table_name;
   ChunkID id;
+  size_t table_chunk_count;
   int node;
   double temperature;
+  // The access times by the workers of each node
+  std::vector<uint64_t> node_accesses;
   friend bool operator<(const ChunkInfo& l, const ChunkInfo& r) { return l.temperature < r.temperature; }
 };
 
@@ -147,10 +152,13 @@ std::vector<ChunkInfo> collect_chunk_infos(const StorageManager& storage_manager
       if (ChunkMigrationTask::chunk_is_completed(chunk, table->max_chunk_size()) && chunk->has_access_counter()) {
         const double temperature = static_cast<double>(chunk->access_counter()->history_sample(lookback_samples));
         sum_temperature += temperature;
-        chunk_infos.emplace_back(ChunkInfo{/* .table_name = */ table_name,
-                                           /* .id = */ i,
-                                           /* .node = */ MigrationPreparationTask::get_node_id(chunk->get_allocator()),
-                                           /* .temperature = */ temperature});
+        chunk_infos.emplace_back(
+            ChunkInfo{/* .table_name = */ table_name,
+                      /* .id = */ i,
+                      /* .table_chunk_count = */ chunk_count,
+                      /* .node = */ MigrationPreparationTask::get_node_id(chunk->get_allocator()),
+                      /* .temperature = */ temperature,
+                      /* .node_accesses = */ chunk->access_counter()->node_history_sample(lookback_samples)});
       }
     }
   }
@@ -158,6 +166,27 @@ std::vector<ChunkInfo> collect_chunk_infos(const StorageManager& storage_manager
   return chunk_infos;
 }
 
+// Returns the node that a chunk belongs to by the workers that accessed it: The node whose workers account for at least
+// the affinity_threshold of its accesses. The chunks of small tables that the workers of all nodes access (e.g.,
+// dimension tables) are interleaved across the nodes instead, so that the accesses are spread over their memory.
+std::optional<NodeID> get_affinity_node(const ChunkInfo& chunk_info, const NUMAPlacementManager::Options& options) {
+  const auto& node_accesses = chunk_info.node_accesses;
+  const auto access_sum = std::accumulate(node_accesses.cbegin(), node_accesses.cend(), uint64_t{0});
+  if (access_sum == 0) return std::nullopt;
+
+  const auto max_node_accesses = std::max_element(node_accesses.cbegin(), node_accesses.cend());
+  if (static_cast<double>(*max_node_accesses) >= options.affinity_threshold * static_cast<double>(access_sum)) {
+    return NodeID{static_cast<NodeID::base_type>(std::distance(node_accesses.cbegin(), max_node_accesses))};
+  }
+
+  if (chunk_info.table_chunk_count <= options.interleaved_table_max_chunk_count &&
+      std::all_of(node_accesses.cbegin(), node_accesses.cend(), [](const auto accesses) { return accesses > 0; })) {
+    return NodeID{static_cast<NodeID::base_type>(chunk_info.id % node_accesses.size())};
+  }
+
+  return std::nullopt;
+}
+
 MigrationPreparationTask::MigrationPreparationTask(const NUMAPlacementManager::Options& options) : _options(options) {}
 
 // This task first collects temperature metrics of chunks and NUMA nodes,
@@ -169,36 +198,57 @@ void MigrationPreparationTask::_on_execute() {
   size_t chunk_counter = 0;
   NodeInfoSet node_info = compute_node_info(get_node_temperatures(chunk_infos, Topology::get().nodes().size()));
 
-  // Migrations are only considered when the imbalance between the NUMA nodes is high enough.
+  // Identify migration candidates (chunks) and their target nodes, hottest chunks first
+  std::vector<std::pair<ChunkInfo, NodeID>> migration_candidates;
+
+  // Chunks are moved to the nodes whose workers access them first, see get_affinity_node()
+  std::vector<bool> is_placed_by_affinity(chunk_infos.size());
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_infos.size(); ++chunk_index) {
+    const auto& chunk_info = chunk_infos[chunk_index];
+    const auto affinity_node = get_affinity_node(chunk_info, _options);
+    if (!affinity_node) continue;
+
+    if (static_cast<int>(*affinity_node) == chunk_info.node) {
+      is_placed_by_affinity[chunk_index] = true;
+    } else if (migration_candidates.size() < _options.migration_count && node_has_capacity(*affinity_node)) {
+      migration_candidates.emplace_back(chunk_info, *affinity_node);
+      is_placed_by_affinity[chunk_index] = true;
+    }
+  }
+
+  // Migrations by temperature are only considered when the imbalance between the NUMA nodes is high enough. Chunks
+  // that are already placed by affinity stay where they are, so that the two do not move them back and forth.
   if (node_info.imbalance > _options.imbalance_threshold && !node_info.cold_nodes.empty()) {
-    // Identify migration candidates (chunks)
-    std::vector<ChunkInfo> migration_candidates;
-    for (const auto& chunk_info : chunk_infos) {
-      if (chunk_info.node < 0 || contains(node_info.hot_nodes, static_cast<NodeID>(chunk_info.node))) {
-        migration_candidates.push_back(chunk_info);
-      }
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_infos.size(); ++chunk_index) {
       if (migration_candidates.size() >= _options.migration_count) {
         break;
       }
-    }
-
-    // Schedule chunk migration tasks
-    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-    jobs.reserve(migration_candidates.size());
 
-    for (const auto& migration_chunk : migration_candidates) {
-      const auto target_node = node_info.cold_nodes.at(chunk_counter % node_info.cold_nodes.size());
-      const auto task =
-          std::make_shared<ChunkMigrationTask>(migration_chunk.table_name, std::vector<ChunkID>({migration_chunk.id}),
-                                               target_node, SchedulePriority::Default, false);
+      const auto& chunk_info = chunk_infos[chunk_index];
+      if (is_placed_by_affinity[chunk_index]) continue;
 
-      task->schedule(target_node);
-      jobs.push_back(task);
-      chunk_counter++;
+      if (chunk_info.node < 0 || contains(node_info.hot_nodes, static_cast<NodeID>(chunk_info.node))) {
+        const auto target_node = node_info.cold_nodes.at(chunk_counter % node_info.cold_nodes.size());
+        migration_candidates.emplace_back(chunk_info, target_node);
+        chunk_counter++;
+      }
     }
+  }
+
+  // Schedule chunk migration tasks
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(migration_candidates.size());
 
-    CurrentScheduler::wait_for_tasks(jobs);
+  for (const auto& [migration_chunk, target_node] : migration_candidates) {
+    const auto task =
+        std::make_shared<ChunkMigrationTask>(migration_chunk.table_name, std::vector<ChunkID>({migration_chunk.id}),
+                                             target_node, SchedulePriority::Default, false);
+
+    task->schedule(target_node);
+    jobs.push_back(task);
   }
+
+  CurrentScheduler::wait_for_tasks(jobs);
 }
 
 int MigrationPreparationTask::get_node_id(const PolymorphicAllocator<size_t>& alloc) {
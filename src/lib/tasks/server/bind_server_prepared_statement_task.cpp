@@ -5,8 +5,11 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/parameterized_sql.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "storage/prepared_plan.hpp"
 
 namespace opossum {
@@ -15,13 +18,8 @@ void BindServerPreparedStatementTask::_on_execute() {
   try {
     Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
 
-    auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
-    for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
-      parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
-    }
-
-    const auto lqp = _prepared_plan->instantiate(parameter_expressions);
-    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    const auto optimized_lqp = _optimized_lqp();
+    const auto pqp = LQPTranslator{}.translate_node(optimized_lqp);
 
     _promise.set_value(pqp);
   } catch (const std::exception&) {
@@ -29,4 +27,62 @@ void BindServerPreparedStatementTask::_on_execute() {
   }
 }
 
+std::shared_ptr<AbstractLQPNode> BindServerPreparedStatementTask::_optimized_lqp() const {
+  const auto& sql = _prepared_plan->sql;
+
+  // Prepared statements of the same SQL string share the optimized LQP with CorrelatedParameterExpressions for their
+  // placeholders, which is also the one of the statements whose literals are parameterized into that SQL string (see
+  // ParameterizedSQL). A statement without placeholders shares the LQP of its SQL string. A cached nullptr means that
+  // the placeholders cannot be turned into parameters.
+  if (!sql.empty()) {
+    const auto cache_key = _params.empty() ? sql : parameterized_sql_cache_key(sql, _params);
+
+    auto cached_lqp = std::optional<std::shared_ptr<AbstractLQPNode>>{};
+    if (!SQLPlanCacheDependencies::get().evict_if_outdated(cache_key)) {
+      cached_lqp = SQLLogicalPlanCache::get().try_get(cache_key);
+    }
+
+    // MVCC-enabled and MVCC-disabled LQPs evict each other, as in SQLPipelineStatement
+    auto parameterized_lqp = std::shared_ptr<AbstractLQPNode>{};
+    if (cached_lqp && (!*cached_lqp || lqp_is_validated(*cached_lqp))) {
+      parameterized_lqp = *cached_lqp;
+    } else {
+      parameterized_lqp = _optimize_parameterized_lqp();
+      SQLLogicalPlanCache::get().set(cache_key, parameterized_lqp);
+      if (parameterized_lqp) SQLPlanCacheDependencies::get().set(cache_key, parameterized_lqp);
+    }
+
+    if (parameterized_lqp) {
+      if (_params.empty()) return parameterized_lqp;
+
+      auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+      for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+        parameters.emplace(static_cast<ParameterID>(parameter_idx), _params[parameter_idx]);
+      }
+      return lqp_bind_parameters(parameterized_lqp, parameters);
+    }
+  }
+
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
+  for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+    parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
+  }
+
+  // instantiate() does not copy the LQP of a plan without placeholders, which the optimizer would modify
+  const auto lqp = _prepared_plan->instantiate(parameter_expressions);
+  return Optimizer::create_default_optimizer()->optimize(lqp == _prepared_plan->lqp ? lqp->deep_copy() : lqp);
+}
+
+std::shared_ptr<AbstractLQPNode> BindServerPreparedStatementTask::_optimize_parameterized_lqp() const {
+  const auto& lqp = _prepared_plan->lqp;
+  const auto parameterized_lqp =
+      _params.empty() ? lqp->deep_copy()
+                      : lqp_parameterize_placeholders(lqp, _prepared_plan->parameter_ids, _params);
+  if (!parameterized_lqp) return nullptr;
+
+  const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(parameterized_lqp);
+  if (!lqp_only_predicates_use_parameters(optimized_lqp, _params.size())) return nullptr;
+  return optimized_lqp;
+}
+
 }  // namespace opossum
@@ -6,10 +6,13 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
 class AbstractOperator;
 class PreparedPlan;
 
 // This task is used to bind the actual variables of a prepared statements and return the corresponding query plan.
+// The optimized LQP is shared by all bindings of the same SQL string and parameter types, only the values are filled in
+// for each of them.
 class BindServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<AbstractOperator>> {
  public:
   BindServerPreparedStatementTask(const std::shared_ptr<PreparedPlan>& prepared_plan,
@@ -19,6 +22,11 @@ class BindServerPreparedStatementTask : public AbstractServerTask<std::shared_pt
  protected:
   void _on_execute() override;
 
+  std::shared_ptr<AbstractLQPNode> _optimized_lqp() const;
+
+  // Returns nullptr if the placeholders cannot be turned into parameters
+  std::shared_ptr<AbstractLQPNode> _optimize_parameterized_lqp() const;
+
   std::shared_ptr<PreparedPlan> _prepared_plan;
   std::vector<AllTypeVariant> _params;
 };
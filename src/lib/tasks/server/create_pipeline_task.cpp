@@ -2,6 +2,9 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <regex>
+#include <string>
+
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -13,8 +16,15 @@ void CreatePipelineTask::_on_execute() {
     if (_allow_load_table && _is_load_table()) {
       // Try LOAD file_name table_name
       result->load_table = std::make_pair(_file_name, _table_name);
+    } else if (_allow_load_table && _is_copy_to_stdout()) {
+      result->sql_pipeline = std::make_shared<SQLPipeline>(
+          SQLPipelineBuilder{_copy_query}.with_cancellation_token(_query_cancellation_token).create_pipeline());
+      result->is_copy_to_stdout = true;
+    } else if (_allow_load_table && _is_copy_from_stdin()) {
+      result->copy_from_stdin = std::make_pair(_table_name, _copy_format);
     } else {
-      result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+      result->sql_pipeline = std::make_shared<SQLPipeline>(
+          SQLPipelineBuilder{_sql}.with_cancellation_token(_query_cancellation_token).create_pipeline());
     }
   } catch (...) {
     // Setting the exception this way ensures that the details are preserved in the futures
@@ -47,4 +57,36 @@ bool CreatePipelineTask::_is_load_table() {
   return true;
 }
 
+bool CreatePipelineTask::_is_copy_to_stdout() {
+  static const auto copy_regex =
+      std::regex{R"(\s*COPY\s+(\(([\s\S]*)\)|\w+)\s+TO\s+STDOUT\s*;?\s*)", std::regex::icase};
+
+  // Ignore the \0-byte at the end
+  const auto sql = std::string{_sql.c_str()};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(sql, match, copy_regex)) return false;
+
+  // Either the query in parentheses or the name of the table
+  _copy_query = match[2].matched ? match[2].str() : "SELECT * FROM " + match[1].str();
+  return true;
+}
+
+bool CreatePipelineTask::_is_copy_from_stdin() {
+  static const auto copy_regex = std::regex{
+      R"(\s*COPY\s+(\w+)\s+FROM\s+STDIN(\s+(WITH\s+)?(BINARY|\(\s*FORMAT\s+(TEXT|BINARY)\s*\)))?\s*;?\s*)",
+      std::regex::icase};
+
+  // Ignore the \0-byte at the end
+  const auto sql = std::string{_sql.c_str()};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(sql, match, copy_regex)) return false;
+
+  _table_name = match[1].str();
+  const auto is_binary = boost::iequals(match[4].str(), "BINARY") || boost::iequals(match[5].str(), "BINARY");
+  _copy_format = is_binary ? FormatCode::Binary : FormatCode::Text;
+  return true;
+}
+
 }  // namespace opossum
@@ -2,15 +2,27 @@
 
 #include <boost/thread/future.hpp>
 
+#include <optional>
+#include <string>
+#include <utility>
+
 #include "abstract_server_task.hpp"
+#include "server/types.hpp"
 
 namespace opossum {
 
+class CancellationToken;
 class SQLPipeline;
 
 struct CreatePipelineResult {
   std::shared_ptr<SQLPipeline> sql_pipeline;
   std::optional<std::pair<std::string, std::string>> load_table;
+
+  // The result of sql_pipeline is sent as COPY data, see _is_copy_to_stdout()
+  bool is_copy_to_stdout{false};
+
+  // The name of the table and the format of the data for COPY table FROM STDIN
+  std::optional<std::pair<std::string, FormatCode>> copy_from_stdin;
 };
 
 // This task is used to parse an SQL string from a client and wrap it in an SQLPipeline. It is a separate task and not
@@ -18,8 +30,11 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::shared_ptr<const CancellationToken> query_cancellation_token = nullptr)
+      : _sql(sql),
+        _allow_load_table(allow_load_table),
+        _query_cancellation_token(std::move(query_cancellation_token)) {}
 
  protected:
   void _on_execute() override;
@@ -29,11 +44,25 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   // interpret it as a LOAD <file-name> <table-name> command. If this doesn't work, we pass on the parse error.
   bool _is_load_table();
 
+  // The SQL parser does not know COPY either. COPY table_name TO STDOUT and COPY (query) TO STDOUT are executed as
+  // SELECT * FROM table_name and the query, respectively, and the session sends the result as COPY data. This is
+  // only allowed together with LOAD, i.e., in simple queries.
+  bool _is_copy_to_stdout();
+
+  // COPY table_name FROM STDIN, optionally followed by (FORMAT text), (FORMAT binary), or BINARY. The session
+  // receives the data in CopyData messages, there is no pipeline.
+  bool _is_copy_from_stdin();
+
   const std::string _sql;
   const bool _allow_load_table;
 
+  // The pipeline can be cancelled through this token, see SQLPipelineBuilder::with_cancellation_token()
+  const std::shared_ptr<const CancellationToken> _query_cancellation_token;
+
   std::string _file_name;
   std::string _table_name;
+  std::string _copy_query;
+  FormatCode _copy_format{FormatCode::Text};
 };
 
 }  // namespace opossum
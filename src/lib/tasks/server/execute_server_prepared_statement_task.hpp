@@ -5,19 +5,24 @@
 namespace opossum {
 
 class AbstractOperator;
+class CancellationToken;
 class TransactionContext;
 class Table;
 
-// This task takes a query plan of a prepared statement and executes it.
+// This task takes a query plan of a prepared statement and executes it. The query can be cancelled through the token,
+// which is not the token of this task, as the task has to fulfill its promise in any case.
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  explicit ExecuteServerPreparedStatementTask(
+      std::shared_ptr<AbstractOperator> prepared_plan,
+      std::shared_ptr<const CancellationToken> query_cancellation_token = nullptr)
+      : _prepared_plan(std::move(prepared_plan)), _query_cancellation_token(std::move(query_cancellation_token)) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<AbstractOperator> _prepared_plan;
+  std::shared_ptr<const CancellationToken> _query_cancellation_token;
 };
 
 }  // namespace opossum
@@ -0,0 +1,27 @@
+#include "insert_server_batch_task.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void InsertServerBatchTask::_on_execute() {
+  try {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>(_table_name, _batch);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+
+    // Inserts do not conflict with other transactions
+    Assert(!insert->execute_failed(), "Insert of COPY data failed");
+    transaction_context->commit();
+
+    _promise.set_value();
+  } catch (...) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
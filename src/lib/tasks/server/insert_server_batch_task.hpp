@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+class Table;
+
+// This task inserts a batch of rows that the client sent with COPY ... FROM STDIN (see CopyInParser) into a table.
+// Each batch is inserted and committed in a transaction of its own, so that batches that were inserted before an
+// error remain in the table, as with a series of INSERT statements.
+class InsertServerBatchTask : public AbstractServerTask<void> {
+ public:
+  InsertServerBatchTask(std::string table_name, std::shared_ptr<const Table> batch)
+      : _table_name(std::move(table_name)), _batch(std::move(batch)) {}
+
+ protected:
+  void _on_execute() override;
+
+  const std::string _table_name;
+  const std::shared_ptr<const Table> _batch;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "parse_server_prepared_statement_task.hpp"
 
 #include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/prepared_plan.hpp"
 
@@ -8,15 +9,25 @@ namespace opossum {
 
 void ParseServerPreparedStatementTask::_on_execute() {
   try {
+    // All sessions that prepare the statement share its PreparedPlan, unless one of its tables was dropped since
+    if (!SQLPlanCacheDependencies::get().evict_if_outdated(_query)) {
+      if (const auto cached_plan = SQLPreparedPlanCache::get().try_get(_query)) {
+        _promise.set_value(*cached_plan);
+        return;
+      }
+    }
+
     auto pipeline_statement = SQLPipelineBuilder{_query}.create_pipeline_statement();
     auto sql_translator = SQLTranslator{UseMvcc::Yes};
     const auto prepared_plans = sql_translator.translate_parser_result(*pipeline_statement.get_parsed_sql_statement());
     Assert(prepared_plans.size() == 1u, "Only a single statement allowed in prepared statement");
 
-    auto prepared_plan =
-        std::make_unique<PreparedPlan>(prepared_plans[0], sql_translator.parameter_ids_of_value_placeholders());
+    const auto prepared_plan = std::make_shared<PreparedPlan>(
+        prepared_plans[0], sql_translator.parameter_ids_of_value_placeholders(), _query);
+    SQLPreparedPlanCache::get().set(_query, prepared_plan);
+    SQLPlanCacheDependencies::get().set(_query, prepared_plan->lqp);
 
-    _promise.set_value(std::move(prepared_plan));
+    _promise.set_value(prepared_plan);
   } catch (const std::exception&) {
     _promise.set_exception(boost::current_exception());
   }
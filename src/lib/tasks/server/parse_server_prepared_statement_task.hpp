@@ -8,7 +8,9 @@ namespace opossum {
 
 class PreparedPlan;
 
-class ParseServerPreparedStatementTask : public AbstractServerTask<std::unique_ptr<PreparedPlan>> {
+// Translates the SQL string of a prepared statement into a PreparedPlan, which is shared through the
+// SQLPreparedPlanCache by all sessions that prepare the same statement
+class ParseServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<PreparedPlan>> {
  public:
   explicit ParseServerPreparedStatementTask(const std::string& query) : _query(query) {}
 
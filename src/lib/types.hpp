@@ -40,6 +40,7 @@ STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
 STRONG_TYPEDEF(uint32_t, NodeID);
 STRONG_TYPEDEF(uint32_t, CpuID);
+STRONG_TYPEDEF(uint32_t, PartitionID);
 
 // Used to identify a Parameter within a (Sub)Select. This can be either a parameter of a Prepared SELECT statement
 // `SELECT * FROM t WHERE a > ?` or a correlated parameter in a Subselect.
@@ -92,6 +93,33 @@ class pmr_concurrent_vector : public tbb::concurrent_vector<T> {
   PolymorphicAllocator<T> _alloc;
 };
 
+/**
+ * TBB needs its allocator to provide a nested rebind (see above), which the boost PolymorphicAllocator does not.
+ * PolymorphicTbbAllocator adds it, so that containers that are not converted from plain tbb::concurrent_vectors (such
+ * as the vectors of the MvccData) can be placed on a memory resource.
+ */
+template <typename T>
+class PolymorphicTbbAllocator : public PolymorphicAllocator<T> {
+ public:
+  template <typename U>
+  struct rebind {
+    using other = PolymorphicTbbAllocator<U>;
+  };
+
+  PolymorphicTbbAllocator() = default;
+  PolymorphicTbbAllocator(boost::container::pmr::memory_resource* resource)  // NOLINT
+      : PolymorphicAllocator<T>(resource) {}
+  template <typename U>
+  PolymorphicTbbAllocator(const PolymorphicAllocator<U>& other)  // NOLINT
+      : PolymorphicAllocator<T>(other.resource()) {}
+
+  // Copies of a container stay on its memory resource
+  PolymorphicTbbAllocator select_on_container_copy_construction() const { return *this; }
+};
+
+template <typename T>
+using pmr_tbb_concurrent_vector = tbb::concurrent_vector<T, PolymorphicTbbAllocator<T>>;
+
 template <typename T>
 using pmr_ring_buffer = boost::circular_buffer<T, PolymorphicAllocator<T>>;
 
@@ -133,12 +161,16 @@ struct RowID {
 
 using WorkerID = uint32_t;
 using TaskID = uint32_t;
+using ResourceGroupID = uint32_t;
 
 // When changing these to 64-bit types, reading and writing to them might not be atomic anymore.
 // Among others, the validate operator might break when another operator is simultaneously writing begin or end CIDs.
 using CommitID = uint32_t;
 using TransactionID = uint32_t;
 
+// Numbers the records of the redo log in the order in which they were appended, see Logger
+using LogSequenceNumber = uint64_t;
+
 using AttributeVectorWidth = uint8_t;
 
 using ColumnIDPair = std::pair<ColumnID, ColumnID>;
@@ -151,6 +183,8 @@ constexpr ColumnID INVALID_COLUMN_ID{std::numeric_limits<ColumnID::base_type>::m
 
 constexpr NodeID CURRENT_NODE_ID{std::numeric_limits<NodeID::base_type>::max() - 1};
 
+constexpr ResourceGroupID DEFAULT_RESOURCE_GROUP_ID{0};
+
 // Declaring one part of a RowID as invalid would suffice to represent NULL values. However, this way we add an extra
 // safety net which ensures that NULL values are handled correctly. E.g., getting a chunk with INVALID_CHUNK_ID
 // immediately crashes.
@@ -160,6 +194,7 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 // The Scheduler currently supports just these 3 priorities, subject to change.
 enum class SchedulePriority {
+  Low = 2,      // Schedule task after all tasks with a higher priority, e.g., for background maintenance
   Default = 1,  // Schedule task at the end of the queue
   High = 0      // Schedule task at the beginning of the queue
 };
@@ -196,6 +231,20 @@ enum class OrderByMode { Ascending, Descending, AscendingNullsLast, DescendingNu
 
 enum class TableType { References, Data };
 
+enum class TableSampleMethod { System, Bernoulli };
+
+// TABLESAMPLE of a stored table: SYSTEM keeps each chunk, BERNOULLI each row with a probability of percentage / 100.
+// With a seed (REPEATABLE), the same chunks or rows are sampled on every execution.
+struct TableSample {
+  TableSampleMethod method;
+  float percentage;
+  std::optional<uint32_t> seed;
+};
+
+inline bool operator==(const TableSample& lhs, const TableSample& rhs) {
+  return lhs.method == rhs.method && lhs.percentage == rhs.percentage && lhs.seed == rhs.seed;
+}
+
 enum class HistogramType { EqualWidth, EqualHeight, EqualDistinctCount };
 
 enum class DescriptionMode { SingleLine, MultiLine };
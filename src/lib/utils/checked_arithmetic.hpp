@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Integer arithmetic that fails on overflows instead of wrapping around, which is undefined for signed integers
+ * anyway. The operands may be of other types than the @tparam Result, an overflow is whatever does not fit into it.
+ * The checks compile to the arithmetic instruction followed by a branch on its overflow flag.
+ */
+template <typename Result, typename A, typename B>
+Result checked_add(const A a, const B b) {
+  static_assert(std::is_integral_v<Result> && std::is_integral_v<A> && std::is_integral_v<B>, "Expected integers");
+  auto result = Result{};
+  if (__builtin_add_overflow(a, b, &result)) {
+    Fail("Integer overflow in " + std::to_string(a) + " + " + std::to_string(b));
+  }
+  return result;
+}
+
+template <typename Result, typename A, typename B>
+Result checked_subtract(const A a, const B b) {
+  static_assert(std::is_integral_v<Result> && std::is_integral_v<A> && std::is_integral_v<B>, "Expected integers");
+  auto result = Result{};
+  if (__builtin_sub_overflow(a, b, &result)) {
+    Fail("Integer overflow in " + std::to_string(a) + " - " + std::to_string(b));
+  }
+  return result;
+}
+
+template <typename Result, typename A, typename B>
+Result checked_multiply(const A a, const B b) {
+  static_assert(std::is_integral_v<Result> && std::is_integral_v<A> && std::is_integral_v<B>, "Expected integers");
+  auto result = Result{};
+  if (__builtin_mul_overflow(a, b, &result)) {
+    Fail("Integer overflow in " + std::to_string(a) + " * " + std::to_string(b));
+  }
+  return result;
+}
+
+}  // namespace opossum
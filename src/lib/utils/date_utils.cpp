@@ -0,0 +1,96 @@
+#include "date_utils.hpp"
+
+#include <array>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace {
+
+// Parses the @param count digits at the @param offset of the @param string, std::nullopt if one of them is no digit
+std::optional<uint32_t> parse_digits(const std::string& string, const size_t offset, const size_t count) {
+  auto value = uint32_t{0};
+  for (auto index = offset; index < offset + count; ++index) {
+    const auto digit = static_cast<uint32_t>(string[index] - '0');
+    if (digit > 9) return std::nullopt;
+    value = value * 10 + digit;
+  }
+  return value;
+}
+
+bool is_leap_year(const int32_t year) { return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0; }
+
+uint32_t days_in_month(const int32_t year, const uint32_t month) {
+  static constexpr auto DAYS_IN_MONTH = std::array<uint32_t, 12>{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return month == 2 && is_leap_year(year) ? 29 : DAYS_IN_MONTH[month - 1];
+}
+
+}  // namespace
+
+namespace opossum {
+
+int32_t days_from_civil(const CivilDate& date) {
+  // Years start in March, so that the leap day is the last day of a year
+  const auto year = date.month <= 2 ? date.year - 1 : date.year;
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto year_of_era = static_cast<uint32_t>(year - era * 400);
+  const auto day_of_year = (153 * (date.month > 2 ? date.month - 3 : date.month + 9) + 2) / 5 + date.day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146'097 + static_cast<int32_t>(day_of_era) - 719'468;
+}
+
+CivilDate civil_from_days(const int32_t days) {
+  const auto shifted_days = days + 719'468;
+  const auto era = (shifted_days >= 0 ? shifted_days : shifted_days - 146'096) / 146'097;
+  const auto day_of_era = static_cast<uint32_t>(shifted_days - era * 146'097);
+  const auto year_of_era = (day_of_era - day_of_era / 1'460 + day_of_era / 36'524 - day_of_era / 146'096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  const auto year = static_cast<int32_t>(year_of_era) + era * 400 + (month <= 2 ? 1 : 0);
+  return {year, month, day};
+}
+
+std::optional<int32_t> parse_date(const std::string& date_string) {
+  if (date_string.size() != 10 || date_string[4] != '-' || date_string[7] != '-') return std::nullopt;
+
+  const auto year = parse_digits(date_string, 0, 4);
+  const auto month = parse_digits(date_string, 5, 2);
+  const auto day = parse_digits(date_string, 8, 2);
+  if (!year || !month || !day || *month < 1 || *month > 12) return std::nullopt;
+  if (*day < 1 || *day > days_in_month(static_cast<int32_t>(*year), *month)) return std::nullopt;
+
+  return days_from_civil({static_cast<int32_t>(*year), *month, *day});
+}
+
+std::optional<int64_t> parse_timestamp(const std::string& timestamp_string) {
+  if (timestamp_string.size() == 10) {
+    const auto days = parse_date(timestamp_string);
+    if (!days) return std::nullopt;
+    return *days * SECONDS_PER_DAY;
+  }
+
+  if (timestamp_string.size() != 19 || timestamp_string[10] != ' ' || timestamp_string[13] != ':' ||
+      timestamp_string[16] != ':') {
+    return std::nullopt;
+  }
+
+  const auto days = parse_date(timestamp_string.substr(0, 10));
+  const auto hour = parse_digits(timestamp_string, 11, 2);
+  const auto minute = parse_digits(timestamp_string, 14, 2);
+  const auto second = parse_digits(timestamp_string, 17, 2);
+  if (!days || !hour || !minute || !second || *hour > 23 || *minute > 59 || *second > 59) return std::nullopt;
+
+  return *days * SECONDS_PER_DAY + *hour * 3'600 + *minute * 60 + *second;
+}
+
+std::string date_to_string(const int32_t days) {
+  const auto date = civil_from_days(days);
+  std::stringstream stream;
+  stream << std::setfill('0') << std::setw(4) << date.year << '-' << std::setw(2) << date.month << '-' << std::setw(2)
+         << date.day;
+  return stream.str();
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace opossum {
+
+/**
+ * Dates and timestamps stored as integers: a date as the days since 1970-01-01 in an Int column, a timestamp as the
+ * seconds since 1970-01-01 00:00:00 in a Long column. They take a third of the memory of YYYY-MM-DD strings and their
+ * predicates compare integers. Dates before 1970 are negative.
+ */
+struct CivilDate {
+  int32_t year;
+  uint32_t month;
+  uint32_t day;
+};
+
+static constexpr auto SECONDS_PER_DAY = int64_t{24 * 60 * 60};
+
+// The days since 1970-01-01 of a proleptic Gregorian date (see http://howardhinnant.github.io/date_algorithms.html)
+int32_t days_from_civil(const CivilDate& date);
+CivilDate civil_from_days(const int32_t days);
+
+// Parses "YYYY-MM-DD", std::nullopt for anything else or an invalid date such as 1995-02-30
+std::optional<int32_t> parse_date(const std::string& date_string);
+
+// Parses "YYYY-MM-DD HH:MM:SS" or "YYYY-MM-DD", which is midnight of that day
+std::optional<int64_t> parse_timestamp(const std::string& timestamp_string);
+
+// "YYYY-MM-DD" for the days since 1970-01-01
+std::string date_to_string(const int32_t days);
+
+}  // namespace opossum
@@ -0,0 +1,189 @@
+#include "hardware_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::atomic_bool counters_enabled{false};
+
+// The innermost HardwareCounterScope that counts on the thread
+thread_local HardwareCounterScope* innermost_scope = nullptr;
+
+#if defined(__linux__)
+
+constexpr auto EVENT_COUNT = size_t{4};
+
+/**
+ * The events of a thread, opened as one group (with cycles as its leader) so that they are scheduled onto the PMU
+ * together and can be read with a single syscall
+ */
+class ThreadCounterGroup {
+ public:
+  ThreadCounterGroup() {
+    const auto events = std::array<uint64_t, EVENT_COUNT>{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                          PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (auto event_idx = size_t{0}; event_idx < EVENT_COUNT; ++event_idx) {
+      auto attributes = perf_event_attr{};
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.size = sizeof(perf_event_attr);
+      attributes.config = events[event_idx];
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP;
+
+      const auto group_file_descriptor = event_idx == 0 ? -1 : _file_descriptors[0];
+      _file_descriptors[event_idx] =
+          static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, group_file_descriptor, 0));
+      if (_file_descriptors[event_idx] < 0) return;
+    }
+    _is_open = true;
+  }
+
+  ~ThreadCounterGroup() {
+    for (const auto file_descriptor : _file_descriptors) {
+      if (file_descriptor >= 0) close(file_descriptor);
+    }
+  }
+
+  std::optional<HardwareCounters> read_counters() const {
+    if (!_is_open) return std::nullopt;
+
+    // PERF_FORMAT_GROUP reads the number of events, followed by their values
+    auto values = std::array<uint64_t, EVENT_COUNT + 1>{};
+    if (read(_file_descriptors[0], values.data(), sizeof(values)) != sizeof(values)) return std::nullopt;
+
+    return HardwareCounters{values[1], values[2], values[3], values[4]};
+  }
+
+ private:
+  std::array<int, EVENT_COUNT> _file_descriptors{-1, -1, -1, -1};
+  bool _is_open{false};
+};
+
+#endif
+
+std::string format_count(const uint64_t count) {
+  auto stream = std::stringstream{};
+  stream << std::fixed << std::setprecision(1);
+  if (count >= 1'000'000'000) {
+    stream << static_cast<double>(count) / 1e9 << "G";
+  } else if (count >= 1'000'000) {
+    stream << static_cast<double>(count) / 1e6 << "M";
+  } else if (count >= 1'000) {
+    stream << static_cast<double>(count) / 1e3 << "K";
+  } else {
+    stream << count;
+  }
+  return stream.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+HardwareCounters& HardwareCounters::operator+=(const HardwareCounters& rhs) {
+  cycles += rhs.cycles;
+  instructions += rhs.instructions;
+  llc_misses += rhs.llc_misses;
+  branch_misses += rhs.branch_misses;
+  return *this;
+}
+
+HardwareCounters HardwareCounters::operator-(const HardwareCounters& rhs) const {
+  return {cycles - rhs.cycles, instructions - rhs.instructions, llc_misses - rhs.llc_misses,
+          branch_misses - rhs.branch_misses};
+}
+
+bool HardwareCounters::operator==(const HardwareCounters& rhs) const {
+  return cycles == rhs.cycles && instructions == rhs.instructions && llc_misses == rhs.llc_misses &&
+         branch_misses == rhs.branch_misses;
+}
+
+double HardwareCounters::instructions_per_cycle() const {
+  return cycles > 0 ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0;
+}
+
+std::string HardwareCounters::to_string() const {
+  auto stream = std::stringstream{};
+  stream << format_count(cycles) << " cycles, " << format_count(instructions) << " instructions (" << std::fixed
+         << std::setprecision(2) << instructions_per_cycle() << " IPC), " << format_count(llc_misses)
+         << " LLC misses, " << format_count(branch_misses) << " branch misses";
+  return stream.str();
+}
+
+void HardwareCounters::set_enabled(const bool enabled) { counters_enabled = enabled; }
+
+bool HardwareCounters::enabled() { return counters_enabled.load(std::memory_order_relaxed); }
+
+bool HardwareCounters::available() { return read_this_thread().has_value(); }
+
+std::optional<HardwareCounters> HardwareCounters::read_this_thread() {
+#if defined(__linux__)
+  // Opened on first use, so that threads that never count do not hold the file descriptors
+  thread_local const auto counter_group = ThreadCounterGroup{};
+  return counter_group.read_counters();
+#else
+  return std::nullopt;
+#endif
+}
+
+void HardwareCounterCollector::add(const HardwareCounters& counters) {
+  _cycles += counters.cycles;
+  _instructions += counters.instructions;
+  _llc_misses += counters.llc_misses;
+  _branch_misses += counters.branch_misses;
+}
+
+HardwareCounters HardwareCounterCollector::counters() const {
+  return {_cycles.load(), _instructions.load(), _llc_misses.load(), _branch_misses.load()};
+}
+
+HardwareCounterScope::HardwareCounterScope(const std::shared_ptr<HardwareCounterCollector>& collector)
+    : _collector(collector) {
+  if (!HardwareCounters::enabled()) return;
+
+  const auto counters = HardwareCounters::read_this_thread();
+  if (!counters) return;
+
+  // The outer scope pauses until this one ends
+  _outer_scope = innermost_scope;
+  if (_outer_scope) _outer_scope->_count_until(*counters);
+
+  _begin = *counters;
+  _is_counting = true;
+  innermost_scope = this;
+}
+
+HardwareCounterScope::~HardwareCounterScope() {
+  if (!_is_counting) return;
+
+  const auto counters = HardwareCounters::read_this_thread();
+  if (counters) {
+    _count_until(*counters);
+    if (_outer_scope) _outer_scope->_begin = *counters;
+  }
+  innermost_scope = _outer_scope;
+}
+
+std::shared_ptr<HardwareCounterCollector> HardwareCounterScope::current_collector() {
+  return innermost_scope ? innermost_scope->_collector : nullptr;
+}
+
+void HardwareCounterScope::_count_until(const HardwareCounters& counters) {
+  if (_collector) _collector->add(counters - _begin);
+  _begin = counters;
+}
+
+}  // namespace opossum
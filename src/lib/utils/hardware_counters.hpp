@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Events counted by the performance monitoring unit of the CPU (through perf_event_open on Linux), e.g., to tell
+ * whether an operator is memory-bound (few instructions per cycle, many LLC misses) or compute-bound. Only events in
+ * user space are counted.
+ *
+ * Collecting them is off by default, as reading the counters costs a syscall whenever an operator or a task starts or
+ * ends. It is also unavailable where the OS does not grant access to the counters, e.g., in many virtual machines or
+ * if kernel.perf_event_paranoid is too restrictive.
+ */
+struct HardwareCounters {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  uint64_t llc_misses{0};
+  uint64_t branch_misses{0};
+
+  HardwareCounters& operator+=(const HardwareCounters& rhs);
+  HardwareCounters operator-(const HardwareCounters& rhs) const;
+  bool operator==(const HardwareCounters& rhs) const;
+
+  double instructions_per_cycle() const;
+
+  std::string to_string() const;
+
+  static void set_enabled(const bool enabled);
+  static bool enabled();
+
+  // Whether the counters can be read by the calling thread
+  static bool available();
+
+  // The counters of the calling thread since it first read them, nullopt if they are unavailable
+  static std::optional<HardwareCounters> read_this_thread();
+};
+
+// Sums up the counters of all HardwareCounterScopes that count into it, which may live on different threads
+class HardwareCounterCollector : public Noncopyable {
+ public:
+  void add(const HardwareCounters& counters);
+
+  HardwareCounters counters() const;
+
+ private:
+  std::atomic<uint64_t> _cycles{0};
+  std::atomic<uint64_t> _instructions{0};
+  std::atomic<uint64_t> _llc_misses{0};
+  std::atomic<uint64_t> _branch_misses{0};
+};
+
+/**
+ * Counts the events of the calling thread into a collector while it lives, if collecting is enabled. Scopes nest
+ * exclusively: While an inner scope lives, e.g., of a task that a worker executes while it waits for other tasks, the
+ * outer one does not count, so that each event is counted only once.
+ *
+ * The collector of the innermost scope is the current one of the thread. Tasks inherit it when they are scheduled (see
+ * AbstractTask::schedule()), so that, e.g., the events of the jobs of an operator are counted for the operator.
+ */
+class HardwareCounterScope : public Noncopyable {
+ public:
+  // @param collector  may be nullptr, in which case the events are not counted for anyone
+  explicit HardwareCounterScope(const std::shared_ptr<HardwareCounterCollector>& collector);
+  ~HardwareCounterScope();
+
+  static std::shared_ptr<HardwareCounterCollector> current_collector();
+
+ private:
+  void _count_until(const HardwareCounters& counters);
+
+  const std::shared_ptr<HardwareCounterCollector> _collector;
+  HardwareCounterScope* _outer_scope{nullptr};
+  HardwareCounters _begin;
+  bool _is_counting{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include "huge_page_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+size_t round_to_huge_pages(const size_t bytes) {
+  constexpr auto huge_page_size = opossum::HugePageMemoryResource::HUGE_PAGE_SIZE;
+  return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+}
+
+}  // namespace
+
+namespace opossum {
+
+HugePageMemoryResource::HugePageMemoryResource(const size_t threshold,
+                                               boost::container::pmr::memory_resource* upstream)
+    : _threshold(threshold), _upstream(upstream) {}
+
+size_t HugePageMemoryResource::threshold() const { return _threshold; }
+
+size_t HugePageMemoryResource::huge_page_allocations() const { return _huge_page_allocations.load(); }
+
+size_t HugePageMemoryResource::transparent_huge_page_allocations() const {
+  return _transparent_huge_page_allocations.load();
+}
+
+size_t HugePageMemoryResource::upstream_allocations() const { return _upstream_allocations.load(); }
+
+void* HugePageMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes < _threshold) {
+    ++_upstream_allocations;
+    return _upstream->allocate(bytes, alignment);
+  }
+
+  // Mappings are aligned to (at least) regular pages
+  DebugAssert(alignment <= HUGE_PAGE_SIZE, "Alignment exceeds the huge page size");
+  const auto mapped_bytes = round_to_huge_pages(bytes);
+
+#ifdef MAP_HUGETLB
+  auto* pointer = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (pointer != MAP_FAILED) {
+    ++_huge_page_allocations;
+    return pointer;
+  }
+#endif
+
+  auto* fallback_pointer = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (fallback_pointer == MAP_FAILED) throw std::bad_alloc{};
+
+#ifdef MADV_HUGEPAGE
+  madvise(fallback_pointer, mapped_bytes, MADV_HUGEPAGE);
+#endif
+  ++_transparent_huge_page_allocations;
+  return fallback_pointer;
+}
+
+void HugePageMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  if (bytes < _threshold) {
+    _upstream->deallocate(p, bytes, alignment);
+    return;
+  }
+
+  munmap(p, round_to_huge_pages(bytes));
+}
+
+bool HugePageMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+}  // namespace opossum
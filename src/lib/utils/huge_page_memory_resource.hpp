@@ -0,0 +1,55 @@
+#pragma once
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace opossum {
+
+/**
+ * Backs large allocations, e.g., of the values of a ValueSegment, an attribute vector, or a hash table of the JoinHash,
+ * with huge pages, so that random accesses into them cause fewer TLB misses. Allocations of at least the threshold are
+ * mapped with MAP_HUGETLB, which needs huge pages reserved by the OS (vm.nr_hugepages). If none are left, the mapping
+ * is advised to be backed by transparent huge pages (MADV_HUGEPAGE) instead, which the kernel may or may not do.
+ * Smaller allocations are forwarded to the upstream resource.
+ *
+ * Segments are placed here by migrating their chunks (see Chunk::migrate()), operator intermediates by setting the
+ * resource as the slab resource of the QueryMemoryResources (see QueryMemoryResource::set_slab_memory_resource()).
+ */
+class HugePageMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static constexpr auto HUGE_PAGE_SIZE = size_t{2} << 20;
+
+  explicit HugePageMemoryResource(
+      const size_t threshold = HUGE_PAGE_SIZE,
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+
+  size_t threshold() const;
+
+  // The number of large allocations that got reserved huge pages (hits) and of those that were left to transparent
+  // huge pages (misses)
+  size_t huge_page_allocations() const;
+  size_t transparent_huge_page_allocations() const;
+
+  // The number of allocations that were forwarded to the upstream resource
+  size_t upstream_allocations() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  const size_t _threshold;
+  boost::container::pmr::memory_resource* const _upstream;
+
+  std::atomic<size_t> _huge_page_allocations{0};
+  std::atomic<size_t> _transparent_huge_page_allocations{0};
+  std::atomic<size_t> _upstream_allocations{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+constexpr auto HALF_SUB_BUCKET_COUNT = uint64_t{1} << (opossum::LatencyHistogram::SUB_BUCKET_BITS - 1);
+
+}  // namespace
+
+namespace opossum {
+
+LatencyHistogram::LatencyHistogram() : _counts(_index_of(MAX_TRACKABLE_LATENCY.count()) + 1) {}
+
+LatencyHistogram::LatencyHistogram(LatencyHistogram&& other) noexcept : _counts(std::move(other._counts)) {
+  _total_count.store(other._total_count);
+  _sum.store(other._sum);
+  _min.store(other._min);
+  _max.store(other._max);
+}
+
+LatencyHistogram& LatencyHistogram::operator=(LatencyHistogram&& other) noexcept {
+  _counts = std::move(other._counts);
+  _total_count.store(other._total_count);
+  _sum.store(other._sum);
+  _min.store(other._min);
+  _max.store(other._max);
+  return *this;
+}
+
+void LatencyHistogram::record(const std::chrono::nanoseconds latency) {
+  DebugAssert(latency.count() >= 0, "Latencies cannot be negative");
+  const auto value =
+      std::min(static_cast<uint64_t>(latency.count()), static_cast<uint64_t>(MAX_TRACKABLE_LATENCY.count()));
+
+  _counts[_index_of(value)].fetch_add(1, std::memory_order_relaxed);
+  _total_count.fetch_add(1, std::memory_order_relaxed);
+  _sum.fetch_add(value, std::memory_order_relaxed);
+
+  auto min = _min.load(std::memory_order_relaxed);
+  while (value < min && !_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+  }
+  auto max = _max.load(std::memory_order_relaxed);
+  while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+  }
+}
+
+uint64_t LatencyHistogram::count() const { return _total_count.load(std::memory_order_relaxed); }
+
+std::chrono::nanoseconds LatencyHistogram::min() const {
+  if (count() == 0) return std::chrono::nanoseconds{0};
+  return std::chrono::nanoseconds{_min.load(std::memory_order_relaxed)};
+}
+
+std::chrono::nanoseconds LatencyHistogram::max() const {
+  return std::chrono::nanoseconds{_max.load(std::memory_order_relaxed)};
+}
+
+std::chrono::nanoseconds LatencyHistogram::mean() const {
+  const auto total_count = count();
+  if (total_count == 0) return std::chrono::nanoseconds{0};
+  return std::chrono::nanoseconds{_sum.load(std::memory_order_relaxed) / total_count};
+}
+
+std::chrono::nanoseconds LatencyHistogram::percentile(const double percentile) const {
+  Assert(percentile >= 0.0 && percentile <= 100.0, "Percentiles are in [0, 100]");
+  const auto total_count = count();
+  if (total_count == 0) return std::chrono::nanoseconds{0};
+
+  // The rank of the latency, starting at 1
+  const auto rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(percentile / 100.0 * total_count)));
+
+  auto seen_count = uint64_t{0};
+  for (auto index = size_t{0}; index < _counts.size(); ++index) {
+    seen_count += _counts[index].load(std::memory_order_relaxed);
+    if (seen_count >= rank) {
+      return std::chrono::nanoseconds{std::min(_highest_value_of(index), _max.load(std::memory_order_relaxed))};
+    }
+  }
+  return max();
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+  return {{"min", min().count()},
+          {"mean", mean().count()},
+          {"p50", percentile(50.0).count()},
+          {"p90", percentile(90.0).count()},
+          {"p99", percentile(99.0).count()},
+          {"p99.9", percentile(99.9).count()},
+          {"max", max().count()}};
+}
+
+size_t LatencyHistogram::_index_of(const uint64_t value) {
+  // Values below the sub-bucket count are their own index. For larger ones, the sub-bucket is given by the
+  // SUB_BUCKET_BITS highest bits of the value, and each further bit adds a bucket of HALF_SUB_BUCKET_COUNT sub-buckets.
+  if (value < 2 * HALF_SUB_BUCKET_COUNT) return value;
+
+  const auto highest_bit = 63 - static_cast<uint64_t>(__builtin_clzll(value));
+  const auto shift = highest_bit - (SUB_BUCKET_BITS - 1);
+  return (shift + 1) * HALF_SUB_BUCKET_COUNT + ((value >> shift) - HALF_SUB_BUCKET_COUNT);
+}
+
+uint64_t LatencyHistogram::_highest_value_of(const size_t index) {
+  if (index < 2 * HALF_SUB_BUCKET_COUNT) return index;
+
+  const auto shift = index / HALF_SUB_BUCKET_COUNT - 1;
+  const auto lowest_value = (index % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT) << shift;
+  return lowest_value + (uint64_t{1} << shift) - 1;
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "json.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A histogram of latencies in the layout of an HDR histogram (http://hdrhistogram.org): Latencies below 2048ns are
+ * counted exactly, larger ones in buckets whose width doubles with every power of two, each split into 1024 sub-buckets
+ * of equal width. The percentiles are thus accurate to three significant digits (a relative error below 0.1%) while
+ * the memory does not depend on how many latencies are recorded, e.g., by a benchmark that runs for hours.
+ *
+ * Latencies up to MAX_TRACKABLE_LATENCY (about 4.9 hours) are distinguished, larger ones count as that one.
+ * Recording is thread-safe and lock-free, so that concurrent clients can record into the same histogram.
+ */
+class LatencyHistogram : public Noncopyable {
+ public:
+  static constexpr auto SUB_BUCKET_BITS = size_t{11};
+  static constexpr auto MAX_TRACKABLE_LATENCY = std::chrono::nanoseconds{(int64_t{1} << 44) - 1};
+
+  LatencyHistogram();
+  LatencyHistogram(LatencyHistogram&& other) noexcept;
+  LatencyHistogram& operator=(LatencyHistogram&& other) noexcept;
+
+  void record(const std::chrono::nanoseconds latency);
+
+  uint64_t count() const;
+  std::chrono::nanoseconds min() const;
+  std::chrono::nanoseconds max() const;
+  std::chrono::nanoseconds mean() const;
+
+  // The latency that @param percentile percent (in [0, 100]) of the recorded latencies do not exceed, e.g., 99.9 for
+  // the p99.9. The highest latency of its sub-bucket, but at most the largest recorded one. Zero if nothing was
+  // recorded.
+  std::chrono::nanoseconds percentile(const double percentile) const;
+
+  // The min, mean, p50, p90, p99, p99.9, and max in nanoseconds, as written to the benchmark results
+  nlohmann::json to_json() const;
+
+ private:
+  static size_t _index_of(const uint64_t value);
+  static uint64_t _highest_value_of(const size_t index);
+
+  std::vector<std::atomic<uint64_t>> _counts;
+  std::atomic<uint64_t> _total_count{0};
+  std::atomic<uint64_t> _sum{0};
+  std::atomic<uint64_t> _min{UINT64_MAX};
+  std::atomic<uint64_t> _max{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) {
+  _file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(_file_descriptor >= 0, "Could not open file " + filename);
+
+  struct stat file_stat;
+  if (fstat(_file_descriptor, &file_stat) != 0) {
+    close(_file_descriptor);
+    Fail("Could not determine the size of file " + filename);
+  }
+
+  _size = static_cast<size_t>(file_stat.st_size);
+  if (_size == 0) return;
+
+  auto* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _file_descriptor, 0);
+  if (data == MAP_FAILED) {
+    close(_file_descriptor);
+    Fail("Could not map file " + filename);
+  }
+  _data = static_cast<const char*>(data);
+
+  madvise(data, _size, MADV_SEQUENTIAL);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+  close(_file_descriptor);
+}
+
+std::string_view MemoryMappedFile::content() const { return {_data, _size}; }
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace opossum {
+
+/**
+ * Read-only memory mapping of a file. Unlike reading the file into a buffer, the pages of the file are only loaded when
+ * they are accessed and, as they are backed by the file, can be evicted again by the OS. Thus, files larger than the
+ * main memory can be read. The file is expected to be read front to back, which lets the OS read ahead.
+ */
+class MemoryMappedFile {
+ public:
+  explicit MemoryMappedFile(const std::string& filename);
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  ~MemoryMappedFile();
+
+  std::string_view content() const;
+
+ private:
+  int _file_descriptor{-1};
+  const char* _data{nullptr};
+  size_t _size{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,256 @@
+#include "meta_table_manager.hpp"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::string segment_index_type_to_string(const SegmentIndexType type) {
+  switch (type) {
+    case SegmentIndexType::Invalid:
+      return "Invalid";
+    case SegmentIndexType::GroupKey:
+      return "GroupKey";
+    case SegmentIndexType::CompositeGroupKey:
+      return "CompositeGroupKey";
+    case SegmentIndexType::AdaptiveRadixTree:
+      return "AdaptiveRadixTree";
+    case SegmentIndexType::BTree:
+      return "BTree";
+  }
+  Fail("Unknown SegmentIndexType");
+}
+
+int64_t invalid_row_count(const Chunk& chunk) {
+  if (!chunk.has_mvcc_data()) return 0;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  auto invalid_row_count = int64_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+    if (mvcc_data->end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) ++invalid_row_count;
+  }
+  return invalid_row_count;
+}
+
+std::shared_ptr<Table> generate_tables_table() {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                                                    {"column_count", DataType::Int, false},
+                                                                    {"row_count", DataType::Long, false},
+                                                                    {"chunk_count", DataType::Int, false},
+                                                                    {"max_chunk_size", DataType::Long, false},
+                                                                    {"estimated_size_bytes", DataType::Long, false}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    table->append({table_name, static_cast<int32_t>(stored_table->column_count()),
+                   static_cast<int64_t>(stored_table->row_count()), static_cast<int32_t>(stored_table->chunk_count()),
+                   static_cast<int64_t>(stored_table->max_chunk_size()),
+                   static_cast<int64_t>(stored_table->estimate_memory_usage())});
+  }
+  return table;
+}
+
+std::shared_ptr<Table> generate_columns_table() {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                                                    {"column_id", DataType::Int, false},
+                                                                    {"column_name", DataType::String, false},
+                                                                    {"data_type", DataType::String, false},
+                                                                    {"nullable", DataType::Int, false}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto column_id = ColumnID{0}; column_id < stored_table->column_count(); ++column_id) {
+      table->append({table_name, static_cast<int32_t>(column_id), stored_table->column_name(column_id),
+                     data_type_to_string.left.at(stored_table->column_data_type(column_id)),
+                     static_cast<int32_t>(stored_table->column_is_nullable(column_id))});
+    }
+  }
+  return table;
+}
+
+std::shared_ptr<Table> generate_chunks_table() {
+  // The access count is NULL for chunks without a ChunkAccessCounter
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                                                    {"chunk_id", DataType::Int, false},
+                                                                    {"row_count", DataType::Long, false},
+                                                                    {"invalid_row_count", DataType::Long, false},
+                                                                    {"is_mutable", DataType::Int, false},
+                                                                    {"estimated_size_bytes", DataType::Long, false},
+                                                                    {"access_count", DataType::Long, true}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+      const auto access_count = chunk->has_access_counter()
+                                    ? AllTypeVariant{static_cast<int64_t>(chunk->access_counter()->counter())}
+                                    : NULL_VALUE;
+      table->append({table_name, static_cast<int32_t>(chunk_id), static_cast<int64_t>(chunk->size()),
+                     invalid_row_count(*chunk), static_cast<int32_t>(chunk->is_mutable()),
+                     static_cast<int64_t>(chunk->estimate_memory_usage()), access_count});
+    }
+  }
+  return table;
+}
+
+std::shared_ptr<Table> generate_segments_table() {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                                                    {"chunk_id", DataType::Int, false},
+                                                                    {"column_id", DataType::Int, false},
+                                                                    {"column_name", DataType::String, false},
+                                                                    {"encoding_type", DataType::String, false},
+                                                                    {"estimated_size_bytes", DataType::Long, false}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        const auto segment = chunk->get_segment(column_id);
+        const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment);
+        const auto encoding_type = encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+        table->append({table_name, static_cast<int32_t>(chunk_id), static_cast<int32_t>(column_id),
+                       stored_table->column_name(column_id), encoding_type_to_string.left.at(encoding_type),
+                       static_cast<int64_t>(segment->estimate_memory_usage())});
+      }
+    }
+  }
+  return table;
+}
+
+std::shared_ptr<Table> generate_indexes_table() {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                                                    {"index_name", DataType::String, false},
+                                                                    {"index_type", DataType::String, false},
+                                                                    {"column_names", DataType::String, false},
+                                                                    {"indexed_chunk_count", DataType::Int, false},
+                                                                    {"memory_bytes", DataType::Long, false}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (const auto& index_info : stored_table->get_indexes()) {
+      auto column_names = std::string{};
+      for (const auto column_id : index_info.column_ids) {
+        if (!column_names.empty()) column_names += ", ";
+        column_names += stored_table->column_name(column_id);
+      }
+
+      // Indexes may exist on some of the chunks only, see Table::add_index_info()
+      auto indexed_chunk_count = int32_t{0};
+      auto memory_bytes = int64_t{0};
+      for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+        const auto index = stored_table->get_chunk(chunk_id)->get_index(index_info.type, index_info.column_ids);
+        if (!index) continue;
+        ++indexed_chunk_count;
+        memory_bytes += static_cast<int64_t>(index->memory_consumption());
+      }
+
+      table->append({table_name, index_info.name, segment_index_type_to_string(index_info.type), column_names,
+                     indexed_chunk_count, memory_bytes});
+    }
+  }
+  return table;
+}
+
+std::shared_ptr<Table> generate_plan_cache_table() {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"cache_name", DataType::String, false},
+                                                                    {"entry_count", DataType::Long, false},
+                                                                    {"capacity", DataType::Long, false},
+                                                                    {"hit_count", DataType::Long, false},
+                                                                    {"miss_count", DataType::Long, false},
+                                                                    {"hit_rate", DataType::Double, false}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto append_cache = [&](const std::string& name, const auto& cache) {
+    const auto hit_count = cache.hit_count();
+    const auto miss_count = cache.miss_count();
+    const auto lookup_count = hit_count + miss_count;
+    table->append({name, static_cast<int64_t>(cache.size()), static_cast<int64_t>(cache.capacity()),
+                   static_cast<int64_t>(hit_count), static_cast<int64_t>(miss_count),
+                   lookup_count == 0 ? 0.0 : static_cast<double>(hit_count) / static_cast<double>(lookup_count)});
+  };
+  append_cache("logical", SQLLogicalPlanCache::get());
+  append_cache("physical", SQLPhysicalPlanCache::get());
+  return table;
+}
+
+std::shared_ptr<Table> generate_workers_table() {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"worker_id", DataType::Int, false},
+                                                                    {"node_id", DataType::Int, false},
+                                                                    {"tasks_executed", DataType::Long, false},
+                                                                    {"tasks_stolen", DataType::Long, false},
+                                                                    {"busy_time_ns", DataType::Long, false},
+                                                                    {"idle_time_ns", DataType::Long, false},
+                                                                    {"sleep_time_ns", DataType::Long, false},
+                                                                    {"queue_wait_time_ns", DataType::Long, false}},
+                                             TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  // Without the NodeQueueScheduler, the tasks are executed by the threads that schedule them
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(CurrentScheduler::get());
+  if (!scheduler) return table;
+
+  for (const auto& worker : scheduler->statistics().workers) {
+    table->append({static_cast<int32_t>(worker.worker_id), static_cast<int32_t>(worker.node_id),
+                   static_cast<int64_t>(worker.tasks_executed), static_cast<int64_t>(worker.tasks_stolen()),
+                   static_cast<int64_t>(worker.busy_time.count()), static_cast<int64_t>(worker.idle_time.count()),
+                   static_cast<int64_t>(worker.sleep_time.count()),
+                   static_cast<int64_t>(worker.queue_wait_time.count())});
+  }
+  return table;
+}
+
+const std::map<std::string, std::function<std::shared_ptr<Table>()>>& meta_table_generators() {
+  static const auto generators = std::map<std::string, std::function<std::shared_ptr<Table>()>>{
+      {"meta_tables", generate_tables_table},       {"meta_columns", generate_columns_table},
+      {"meta_chunks", generate_chunks_table},       {"meta_segments", generate_segments_table},
+      {"meta_indexes", generate_indexes_table},     {"meta_plan_cache", generate_plan_cache_table},
+      {"meta_workers", generate_workers_table}};
+  return generators;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool MetaTableManager::is_meta_table_name(const std::string& name) { return name.rfind(META_PREFIX, 0) == 0; }
+
+std::vector<std::string> MetaTableManager::table_names() {
+  auto table_names = std::vector<std::string>{};
+  for (const auto& [table_name, generator] : meta_table_generators()) {
+    table_names.emplace_back(table_name);
+  }
+  return table_names;
+}
+
+bool MetaTableManager::has_table(const std::string& name) { return meta_table_generators().count(name); }
+
+std::shared_ptr<Table> MetaTableManager::generate_table(const std::string& name) {
+  const auto generator_iter = meta_table_generators().find(name);
+  Assert(generator_iter != meta_table_generators().end(), "No such meta table named '" + name + "'");
+
+  // The optimizer estimates the cardinalities of the plans that read meta tables like those of the plans that read
+  // stored tables
+  const auto table = generator_iter->second();
+  table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+  return table;
+}
+
+}  // namespace opossum
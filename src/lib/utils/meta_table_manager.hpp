@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Virtual tables that expose the state of the system to SQL, e.g., for monitoring over the network:
+ *
+ *  meta_tables       one row per table: row, chunk and column counts and the estimated memory usage
+ *  meta_columns      one row per column of a table: name, data type and nullability
+ *  meta_chunks       one row per chunk of a table: row counts, estimated memory usage and ChunkAccessCounter value
+ *  meta_segments     one row per segment of a table: encoding and estimated memory usage
+ *  meta_indexes      one row per index registered at a table: type, columns, and the memory of its chunk indexes
+ *  meta_plan_cache   one row per SQL plan cache: entry count, capacity, hits and misses
+ *  meta_workers      one row per worker of the NodeQueueScheduler: the counters of its SchedulerStatistics
+ *
+ * The StorageManager does not store meta tables. Instead, StorageManager::get_table() generates them from the current
+ * state whenever it is asked for one, so that a GetTable that is executed again reads fresh values. Their names are
+ * reserved, i.e., no stored table may start with the prefix "meta_".
+ */
+class MetaTableManager {
+ public:
+  static constexpr auto META_PREFIX = "meta_";
+
+  // Whether the @param name has the META_PREFIX, whether or not there is a meta table of that name
+  static bool is_meta_table_name(const std::string& name);
+
+  // The names of all meta tables, including the prefix
+  static std::vector<std::string> table_names();
+  static bool has_table(const std::string& name);
+
+  // Fails if there is no meta table with the @param name
+  static std::shared_ptr<Table> generate_table(const std::string& name);
+};
+
+}  // namespace opossum
@@ -1,5 +1,15 @@
 #include <dlfcn.h>
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "storage/storage_manager.hpp"
 #include "utils/abstract_plugin.hpp"
 #include "utils/assert.hpp"
@@ -44,10 +54,75 @@ void PluginManager::load_plugin(const filesystem::path& path) {
 
   _plugins[name] = plugin_handle_wrapper;
 
+  _starting_plugin_name = name;
   plugin->start();
+  _starting_plugin_name.reset();
+}
+
+void PluginManager::add_optimizer_rule(const std::shared_ptr<AbstractRule>& rule,
+                                       const std::optional<std::string>& before_rule_name) {
+  const auto& plugin_name = _starting_plugin();
+  std::unique_lock<std::shared_mutex> lock(_extensions_mutex);
+  _optimizer_rules.emplace_back(PluginOptimizerRule{plugin_name, rule, before_rule_name});
+}
+
+void PluginManager::add_lqp_translator_override(const LQPNodeType node_type,
+                                                const LQPTranslatorOverride& lqp_translator_override) {
+  const auto& plugin_name = _starting_plugin();
+  std::unique_lock<std::shared_mutex> lock(_extensions_mutex);
+  _lqp_translator_overrides.emplace_back(PluginLQPTranslatorOverride{plugin_name, node_type, lqp_translator_override});
+}
+
+void PluginManager::add_maintenance_task(const std::string& name, const std::chrono::milliseconds interval,
+                                         const std::function<void(size_t)>& task) {
+  const auto& plugin_name = _starting_plugin();
+  auto loop_thread = std::make_unique<PausableLoopThread>(interval, task);
+  loop_thread->resume();
+
+  std::unique_lock<std::shared_mutex> lock(_extensions_mutex);
+  _maintenance_tasks.emplace_back(PluginMaintenanceTask{plugin_name, name, std::move(loop_thread)});
+}
+
+std::vector<PluginOptimizerRule> PluginManager::optimizer_rules() const {
+  std::shared_lock<std::shared_mutex> lock(_extensions_mutex);
+  return _optimizer_rules;
+}
+
+std::vector<LQPTranslatorOverride> PluginManager::lqp_translator_overrides(const LQPNodeType node_type) const {
+  // The overrides are copied, as they translate the inputs of their node, which looks up the overrides again
+  auto lqp_translator_overrides = std::vector<LQPTranslatorOverride>{};
+  std::shared_lock<std::shared_mutex> lock(_extensions_mutex);
+  for (const auto& plugin_lqp_translator_override : _lqp_translator_overrides) {
+    if (plugin_lqp_translator_override.node_type != node_type) continue;
+    lqp_translator_overrides.emplace_back(plugin_lqp_translator_override.lqp_translator_override);
+  }
+  return lqp_translator_overrides;
+}
+
+std::vector<std::string> PluginManager::maintenance_task_names() const {
+  auto names = std::vector<std::string>{};
+  std::shared_lock<std::shared_mutex> lock(_extensions_mutex);
+  for (const auto& maintenance_task : _maintenance_tasks) {
+    names.emplace_back(maintenance_task.name);
+  }
+  return names;
 }
 
-void PluginManager::reset() { get() = PluginManager(); }
+void PluginManager::reset() {
+  auto& plugin_manager = get();
+  plugin_manager._plugins.clear();
+  plugin_manager._starting_plugin_name.reset();
+
+  // The maintenance tasks are finished outside of the lock, as they may look up the extensions themselves
+  auto maintenance_tasks = std::vector<PluginMaintenanceTask>{};
+  {
+    std::unique_lock<std::shared_mutex> lock(plugin_manager._extensions_mutex);
+    plugin_manager._optimizer_rules.clear();
+    plugin_manager._lqp_translator_overrides.clear();
+    maintenance_tasks = std::move(plugin_manager._maintenance_tasks);
+    plugin_manager._maintenance_tasks.clear();
+  }
+}
 
 void PluginManager::unload_plugin(const PluginName& name) {
   auto plugin = _plugins.find(name);
@@ -61,6 +136,7 @@ const std::unordered_map<PluginName, PluginHandleWrapper>::iterator PluginManage
   const PluginName name = it->first;
   auto plugin_handle_wrapper = it->second;
 
+  _remove_extensions(name);
   plugin_handle_wrapper.plugin->stop();
   dlclose(plugin_handle_wrapper.handle);
 
@@ -69,6 +145,35 @@ const std::unordered_map<PluginName, PluginHandleWrapper>::iterator PluginManage
   return next;
 }
 
+const PluginName& PluginManager::_starting_plugin() const {
+  Assert(_starting_plugin_name, "Plugins can only add extensions in their start()");
+  return *_starting_plugin_name;
+}
+
+void PluginManager::_remove_extensions(const PluginName& name) {
+  const auto is_of_plugin = [&](const auto& extension) { return extension.plugin_name == name; };
+
+  auto maintenance_tasks = std::vector<PluginMaintenanceTask>{};
+  {
+    std::unique_lock<std::shared_mutex> lock(_extensions_mutex);
+    _optimizer_rules.erase(std::remove_if(_optimizer_rules.begin(), _optimizer_rules.end(), is_of_plugin),
+                           _optimizer_rules.end());
+    _lqp_translator_overrides.erase(
+        std::remove_if(_lqp_translator_overrides.begin(), _lqp_translator_overrides.end(), is_of_plugin),
+        _lqp_translator_overrides.end());
+
+    const auto first_task_of_plugin =
+        std::stable_partition(_maintenance_tasks.begin(), _maintenance_tasks.end(),
+                              [&](const auto& maintenance_task) { return !is_of_plugin(maintenance_task); });
+    std::move(first_task_of_plugin, _maintenance_tasks.end(), std::back_inserter(maintenance_tasks));
+    _maintenance_tasks.erase(first_task_of_plugin, _maintenance_tasks.end());
+  }
+
+  // Destroying the loop threads waits for the running iterations of the tasks, which may look up the extensions
+  // themselves, so it happens outside of the lock
+  maintenance_tasks.clear();
+}
+
 void PluginManager::_clean_up() {
   for (auto it = _plugins.begin(); it != _plugins.end();) {
     it = _unload_erase_plugin(it);
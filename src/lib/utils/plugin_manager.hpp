@@ -1,15 +1,28 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "types.hpp"
 #include "utils/abstract_plugin.hpp"
 #include "utils/filesystem.hpp"
+#include "utils/pausable_loop_thread.hpp"
 #include "utils/singleton.hpp"
 #include "utils/string_utils.hpp"
 
 namespace opossum {
 
+class AbstractOperator;
+class AbstractRule;
+class LQPTranslator;
+
 using PluginHandle = void*;
 using PluginName = std::string;
 
@@ -18,6 +31,28 @@ struct PluginHandleWrapper {
   AbstractPlugin* plugin;
 };
 
+// Translates an LQP node instead of the LQPTranslator, which it can use to translate the inputs of the node. Returns
+// nullptr to leave the node to the LQPTranslator (or to the overrides of other plugins).
+using LQPTranslatorOverride = std::function<std::shared_ptr<AbstractOperator>(
+    const std::shared_ptr<AbstractLQPNode>& node, const LQPTranslator& translator)>;
+
+// A rule that a plugin added to the default Optimizer, before the rule named before_rule_name or after all rules
+struct PluginOptimizerRule {
+  PluginName plugin_name;
+  std::shared_ptr<AbstractRule> rule;
+  std::optional<std::string> before_rule_name;
+};
+
+/**
+ * Loads plugins (see AbstractPlugin) and keeps the extensions that they register in their start():
+ *  - Optimizer rules, which Optimizer::create_default_optimizer() adds to the default rules
+ *  - LQPTranslator overrides, which the LQPTranslator tries for the nodes of their type before translating them itself
+ *  - Maintenance tasks, which run in a background loop
+ *
+ * When a plugin is unloaded, its maintenance tasks are finished and its extensions are removed before its stop() is
+ * called. Optimizers and translations that have taken a plugin's extensions must have finished before it is unloaded,
+ * as its library is closed afterwards.
+ */
 class PluginManager : public Singleton<PluginManager> {
   friend class PluginManagerTest;
   friend class SingletonTest;
@@ -26,9 +61,23 @@ class PluginManager : public Singleton<PluginManager> {
   void load_plugin(const filesystem::path& path);
   void unload_plugin(const PluginName& name);
 
+  // The extensions of a plugin, which may only be added by the start() of the plugin that is being loaded.
+  // @param before_rule_name is the name() of a default rule of the Optimizer
+  void add_optimizer_rule(const std::shared_ptr<AbstractRule>& rule,
+                          const std::optional<std::string>& before_rule_name = std::nullopt);
+  void add_lqp_translator_override(const LQPNodeType node_type, const LQPTranslatorOverride& lqp_translator_override);
+  // Calls @param task with the number of the iteration every @param interval, starting after the first interval
+  void add_maintenance_task(const std::string& name, const std::chrono::milliseconds interval,
+                            const std::function<void(size_t)>& task);
+
+  // The extensions of all loaded plugins, in the order in which they were added
+  std::vector<PluginOptimizerRule> optimizer_rules() const;
+  std::vector<LQPTranslatorOverride> lqp_translator_overrides(const LQPNodeType node_type) const;
+  std::vector<std::string> maintenance_task_names() const;
+
   ~PluginManager();
 
-  // Deletes the entire PluginManager and creates a new one, used especially in tests.
+  // Forgets all plugins and their extensions without stopping the plugins, used especially in tests.
   // This can lead to a lot of issues if there are still running tasks / threads that
   // want to access a resource. You should be very sure that this is what you want.
   // Have a look at base_test.hpp to see the correct order of resetting things.
@@ -37,15 +86,37 @@ class PluginManager : public Singleton<PluginManager> {
  protected:
   friend class Singleton;
 
+  struct PluginLQPTranslatorOverride {
+    PluginName plugin_name;
+    LQPNodeType node_type;
+    LQPTranslatorOverride lqp_translator_override;
+  };
+
+  struct PluginMaintenanceTask {
+    PluginName plugin_name;
+    std::string name;
+    std::unique_ptr<PausableLoopThread> loop_thread;
+  };
+
   PluginManager() {}
   const PluginManager& operator=(const PluginManager&) = delete;
-  PluginManager& operator=(PluginManager&&) = default;
 
   std::unordered_map<PluginName, PluginHandleWrapper> _plugins;
 
+  // The plugin whose start() is being called, to which the extensions that are added belong
+  std::optional<PluginName> _starting_plugin_name;
+
+  // Guards the extensions, which are read by concurrent queries
+  mutable std::shared_mutex _extensions_mutex;
+  std::vector<PluginOptimizerRule> _optimizer_rules;
+  std::vector<PluginLQPTranslatorOverride> _lqp_translator_overrides;
+  std::vector<PluginMaintenanceTask> _maintenance_tasks;
+
   // This method is called during destruction and stops and unloads all currently loaded plugions.
   void _clean_up();
   bool _is_duplicate(AbstractPlugin* plugin) const;
+  const PluginName& _starting_plugin() const;
+  void _remove_extensions(const PluginName& name);
   const std::unordered_map<PluginName, PluginHandleWrapper>::iterator _unload_erase_plugin(
       const std::unordered_map<PluginName, PluginHandleWrapper>::iterator it);
 };
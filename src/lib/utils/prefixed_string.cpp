@@ -0,0 +1,26 @@
+#include "prefixed_string.hpp"
+
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrefixedString::PrefixedString(const std::string_view& string, boost::container::pmr::memory_resource& arena)
+    : _size(static_cast<uint32_t>(string.size())) {
+  Assert(string.size() <= std::numeric_limits<uint32_t>::max(), "String is too long for a PrefixedString");
+
+  if (string.size() <= INLINE_SIZE) {
+    std::memcpy(_chars, string.data(), string.size());
+    return;
+  }
+
+  auto* const data = static_cast<char*>(arena.allocate(string.size(), 1));
+  std::memcpy(data, string.data(), string.size());
+
+  std::memcpy(_chars, string.data(), PREFIX_SIZE);
+  const auto* const const_data = static_cast<const char*>(data);
+  std::memcpy(_chars + PREFIX_SIZE, &const_data, sizeof(const_data));
+}
+
+}  // namespace opossum
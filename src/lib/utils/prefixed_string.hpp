@@ -0,0 +1,64 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace opossum {
+
+/**
+ * A string of 16 bytes in the layout of Umbra (Neumann and Freitag, "Umbra: A Disk-Based System with In-Memory
+ * Performance", CIDR 2020): The size and the first four characters are stored inline, followed by either the
+ * remaining characters of a string of up to INLINE_SIZE characters or a pointer to all characters of a longer one.
+ * The characters of long strings are allocated from an arena, which has to outlive the PrefixedString.
+ *
+ * Most comparisons are decided by the prefix and thus do not dereference the pointer. Used for materialized sort keys,
+ * which are compared O(n log n) times but copied rarely.
+ */
+class PrefixedString {
+ public:
+  static constexpr auto PREFIX_SIZE = size_t{4};
+  static constexpr auto INLINE_SIZE = size_t{12};
+
+  PrefixedString() = default;
+  PrefixedString(const std::string_view& string, boost::container::pmr::memory_resource& arena);
+
+  size_t size() const { return _size; }
+
+  const char* data() const {
+    if (_size <= INLINE_SIZE) return _chars;
+
+    const char* data;
+    std::memcpy(&data, _chars + PREFIX_SIZE, sizeof(data));
+    return data;
+  }
+
+  explicit operator std::string_view() const { return {data(), _size}; }
+
+  // Compares like std::string_view::compare(), i.e., character by character as unsigned chars
+  static int compare(const PrefixedString& lhs, const PrefixedString& rhs) {
+    // Prefixes of short strings are padded with '\0', which only compares equal if the strings do so up to the end of
+    // the shorter one. In that case, the comparison of the whole strings decides.
+    const auto prefix_comparison = std::memcmp(lhs._chars, rhs._chars, PREFIX_SIZE);
+    if (prefix_comparison != 0) return prefix_comparison;
+    return std::string_view{lhs}.compare(std::string_view{rhs});
+  }
+
+  friend bool operator==(const PrefixedString& lhs, const PrefixedString& rhs) {
+    return lhs._size == rhs._size && compare(lhs, rhs) == 0;
+  }
+  friend bool operator!=(const PrefixedString& lhs, const PrefixedString& rhs) { return !(lhs == rhs); }
+  friend bool operator<(const PrefixedString& lhs, const PrefixedString& rhs) { return compare(lhs, rhs) < 0; }
+  friend bool operator>(const PrefixedString& lhs, const PrefixedString& rhs) { return compare(lhs, rhs) > 0; }
+
+ private:
+  uint32_t _size{0};
+  // The prefix, followed by either the remaining characters or the pointer to all of them
+  char _chars[INLINE_SIZE]{};
+};
+
+static_assert(sizeof(PrefixedString) == 16, "PrefixedString is expected to take 16 bytes");
+
+}  // namespace opossum
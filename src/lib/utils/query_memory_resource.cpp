@@ -0,0 +1,181 @@
+#include "query_memory_resource.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+
+#include "boost/container/pmr/global_resource.hpp"
+
+#include "utils/format_bytes.hpp"
+
+namespace {
+
+// The part of a slab that a thread has not allocated yet
+struct SlabCursor {
+  uint64_t resource_id{0};
+  std::byte* begin{nullptr};
+  std::byte* end{nullptr};
+};
+
+// A worker thread of the scheduler may execute tasks of several queries in turns. Keeping a cursor for a few resources
+// avoids starting a new slab (and wasting the rest of the previous one) whenever the thread switches between them.
+constexpr auto CURSORS_PER_THREAD = size_t{4};
+
+struct ThreadSlabCursors {
+  std::array<SlabCursor, CURSORS_PER_THREAD> cursors;
+  size_t next_replaced_cursor{0};
+};
+
+thread_local auto thread_slab_cursors = ThreadSlabCursors{};
+
+std::atomic<uint64_t> next_resource_id{1};
+
+// Of all QueryMemoryResources
+std::atomic<size_t> total_allocated_bytes{0};
+std::atomic<size_t> total_budget{0};
+
+std::atomic<boost::container::pmr::memory_resource*> default_slab_memory_resource{nullptr};
+
+void* align_in_cursor(SlabCursor& cursor, const size_t bytes, const size_t alignment) {
+  void* pointer = cursor.begin;
+  auto space = static_cast<size_t>(cursor.end - cursor.begin);
+  if (!std::align(alignment, bytes, pointer, space)) return nullptr;
+
+  cursor.begin = static_cast<std::byte*>(pointer) + bytes;
+  return pointer;
+}
+
+}  // namespace
+
+namespace opossum {
+
+QueryMemoryResource::QueryMemoryResource(const size_t budget)
+    : _id(next_resource_id++), _slab_memory_resource(slab_memory_resource()), _budget(budget) {}
+
+QueryMemoryResource::~QueryMemoryResource() {
+  for (const auto& [slab, bytes] : _slabs) {
+    _slab_memory_resource->deallocate(slab, bytes, alignof(std::max_align_t));
+  }
+  total_allocated_bytes -= _allocated_bytes;
+}
+
+size_t QueryMemoryResource::allocated_bytes() const {
+  std::lock_guard<std::mutex> lock(_slabs_mutex);
+  return _allocated_bytes;
+}
+
+size_t QueryMemoryResource::budget() const { return _budget; }
+
+void QueryMemoryResource::set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token) {
+  std::lock_guard<std::mutex> lock(_slabs_mutex);
+  _cancellation_token = cancellation_token;
+}
+
+std::optional<std::string> QueryMemoryResource::budget_exceeded_message() const {
+  std::lock_guard<std::mutex> lock(_slabs_mutex);
+  return _budget_exceeded_message;
+}
+
+size_t QueryMemoryResource::global_allocated_bytes() { return total_allocated_bytes.load(); }
+
+void QueryMemoryResource::set_global_budget(const size_t budget) { total_budget = budget; }
+
+size_t QueryMemoryResource::global_budget() { return total_budget.load(); }
+
+void QueryMemoryResource::set_slab_memory_resource(boost::container::pmr::memory_resource* slab_memory_resource) {
+  default_slab_memory_resource = slab_memory_resource;
+}
+
+boost::container::pmr::memory_resource* QueryMemoryResource::slab_memory_resource() {
+  auto* slab_memory_resource = default_slab_memory_resource.load();
+  return slab_memory_resource ? slab_memory_resource : boost::container::pmr::new_delete_resource();
+}
+
+void* QueryMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // Large allocations get a slab of their own, so that they do not waste the rest of the thread's slab
+  if (bytes + alignment > SLAB_SIZE / 4) {
+    auto cursor = SlabCursor{_id, _allocate_slab(bytes + alignment), nullptr};
+    cursor.end = cursor.begin + bytes + alignment;
+    return align_in_cursor(cursor, bytes, alignment);
+  }
+
+  auto& thread_cursors = thread_slab_cursors;
+  auto* cursor = static_cast<SlabCursor*>(nullptr);
+  for (auto& thread_cursor : thread_cursors.cursors) {
+    if (thread_cursor.resource_id == _id) cursor = &thread_cursor;
+  }
+
+  if (cursor) {
+    if (auto* pointer = align_in_cursor(*cursor, bytes, alignment)) return pointer;
+  } else {
+    cursor = &thread_cursors.cursors[thread_cursors.next_replaced_cursor];
+    thread_cursors.next_replaced_cursor = (thread_cursors.next_replaced_cursor + 1) % CURSORS_PER_THREAD;
+  }
+
+  // The rest of the thread's previous slab, if any, is not used anymore
+  const auto slab = _allocate_slab(SLAB_SIZE);
+  *cursor = SlabCursor{_id, slab, slab + SLAB_SIZE};
+  return align_in_cursor(*cursor, bytes, alignment);
+}
+
+void QueryMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {}
+
+bool QueryMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+std::byte* QueryMemoryResource::_allocate_slab(const size_t bytes) {
+  // The bytes are added to the totals before they are allocated, so that concurrent threads cannot exceed a budget
+  // together
+  const auto global_bytes = total_allocated_bytes.fetch_add(bytes) + bytes;
+  const auto global_budget_bytes = total_budget.load();
+  if (global_budget_bytes > 0 && global_bytes > global_budget_bytes) {
+    total_allocated_bytes -= bytes;
+    _fail_on_exceeded_budget("out of memory: the statements exceed the global memory budget of " +
+                             format_bytes(global_budget_bytes));
+  }
+
+  auto exceeds_budget = false;
+  {
+    std::lock_guard<std::mutex> lock(_slabs_mutex);
+    exceeds_budget = _budget > 0 && _allocated_bytes + bytes > _budget;
+    if (!exceeds_budget) _allocated_bytes += bytes;
+  }
+
+  if (exceeds_budget) {
+    total_allocated_bytes -= bytes;
+    _fail_on_exceeded_budget("out of memory: the statement exceeds its memory budget of " + format_bytes(_budget));
+  }
+
+  auto* slab = static_cast<std::byte*>(nullptr);
+  try {
+    slab = static_cast<std::byte*>(_slab_memory_resource->allocate(bytes, alignof(std::max_align_t)));
+  } catch (const std::bad_alloc&) {
+    {
+      std::lock_guard<std::mutex> lock(_slabs_mutex);
+      _allocated_bytes -= bytes;
+    }
+    total_allocated_bytes -= bytes;
+    throw;
+  }
+
+  std::lock_guard<std::mutex> lock(_slabs_mutex);
+  _slabs.emplace_back(slab, bytes);
+  return slab;
+}
+
+void QueryMemoryResource::_fail_on_exceeded_budget(const std::string& message) {
+  auto cancellation_token = std::shared_ptr<CancellationToken>{};
+  {
+    std::lock_guard<std::mutex> lock(_slabs_mutex);
+    if (!_budget_exceeded_message) _budget_exceeded_message = message;
+    cancellation_token = _cancellation_token;
+  }
+
+  // The other jobs of the query stop at their next check of the token
+  if (cancellation_token) cancellation_token->cancel();
+  throw MemoryBudgetExceededException{message};
+}
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "scheduler/cancellation_token.hpp"
+
+namespace opossum {
+
+/**
+ * Thrown by a QueryMemoryResource when the query exceeds its budget, or all queries together exceed the global one.
+ * As a QueryCancelledException, it unwinds the operators of the cancelled query (see CancellationToken).
+ */
+class MemoryBudgetExceededException : public QueryCancelledException {
+ public:
+  explicit MemoryBudgetExceededException(const std::string& what_arg) : QueryCancelledException(what_arg) {}
+};
+
+/**
+ * A monotonic memory resource for the intermediate data structures of the operators of a single query, e.g., the
+ * position lists in the hash tables of the JoinHash. Each thread allocates from a slab of its own by bumping a pointer,
+ * so that the threads of a query do not contend for a lock and small allocations have almost no overhead.
+ * Deallocations are no-ops. All slabs are freed at once when the resource is destroyed, which the
+ * SQLPipelineStatement that owns it does once its query has been executed.
+ *
+ * Thus, only memory that is not used after the execution may be allocated here. Operator outputs (e.g., the PosLists
+ * of ReferenceSegments) must not be, as they may outlive the statement.
+ *
+ * A new slab is only allocated if it fits into the budget of the query and into the global budget of all queries. If
+ * it does not, the resource cancels the query through its CancellationToken and throws a
+ * MemoryBudgetExceededException, so that a single query cannot take the memory of all others even if it, e.g., joins
+ * two large tables without a predicate.
+ */
+class QueryMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static constexpr auto SLAB_SIZE = size_t{1} << 20;
+
+  // @param budget  the maximum total size of the slabs, zero for no limit
+  explicit QueryMemoryResource(const size_t budget = 0);
+  ~QueryMemoryResource() override;
+
+  // The total size of all slabs. As deallocations are no-ops, this is the peak memory usage of the query.
+  size_t allocated_bytes() const;
+
+  size_t budget() const;
+
+  // The token of the query, cancelled once a budget is exceeded. Must be set before the query allocates memory.
+  void set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  // The message of the MemoryBudgetExceededException, if a budget was exceeded
+  std::optional<std::string> budget_exceeded_message() const;
+
+  // The total size of the slabs of all QueryMemoryResources
+  static size_t global_allocated_bytes();
+
+  // Limits global_allocated_bytes(), zero (the default) for no limit
+  static void set_global_budget(const size_t budget);
+  static size_t global_budget();
+
+  // The resource that the slabs of QueryMemoryResources created from now on are allocated from, e.g., a
+  // HugePageMemoryResource. It has to outlive them. Defaults to new_delete_resource().
+  static void set_slab_memory_resource(boost::container::pmr::memory_resource* slab_memory_resource);
+  static boost::container::pmr::memory_resource* slab_memory_resource();
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  // Returns a new slab of @param bytes, which is owned by the resource
+  std::byte* _allocate_slab(const size_t bytes);
+
+  [[noreturn]] void _fail_on_exceeded_budget(const std::string& message);
+
+  // Identifies the resource in the threads' slab cursors. Ids are not reused, so that a cursor never refers to a slab
+  // of a resource that has been destroyed.
+  const uint64_t _id;
+
+  boost::container::pmr::memory_resource* const _slab_memory_resource;
+
+  mutable std::mutex _slabs_mutex;
+  std::vector<std::pair<std::byte*, size_t>> _slabs;
+  size_t _allocated_bytes{0};
+
+  const size_t _budget;
+  std::shared_ptr<CancellationToken> _cancellation_token;
+  std::optional<std::string> _budget_exceeded_message;
+};
+
+}  // namespace opossum
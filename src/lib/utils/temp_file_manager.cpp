@@ -0,0 +1,111 @@
+#include "temp_file_manager.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TempFile::TempFile(const filesystem::path& path) {
+  _file_descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  Assert(_file_descriptor >= 0, "Could not create temporary file " + path.string());
+  unlink(path.c_str());
+}
+
+TempFile::~TempFile() { close(_file_descriptor); }
+
+void TempFile::write(const void* data, const size_t bytes) {
+  auto written_bytes = size_t{0};
+  while (written_bytes < bytes) {
+    const auto result = pwrite(_file_descriptor, static_cast<const char*>(data) + written_bytes,
+                               bytes - written_bytes, static_cast<off_t>(_size + written_bytes));
+    Assert(result > 0, "Could not write to temporary file, is the disk full?");
+    written_bytes += static_cast<size_t>(result);
+  }
+
+  _size += bytes;
+  TempFileManager::get()._written_bytes += bytes;
+}
+
+void TempFile::read(const size_t offset, void* data, const size_t bytes) const {
+  DebugAssert(offset + bytes <= _size, "Cannot read beyond the end of the temporary file");
+
+  auto read_bytes = size_t{0};
+  while (read_bytes < bytes) {
+    const auto result = pread(_file_descriptor, static_cast<char*>(data) + read_bytes, bytes - read_bytes,
+                              static_cast<off_t>(offset + read_bytes));
+    Assert(result > 0, "Could not read from temporary file");
+    read_bytes += static_cast<size_t>(result);
+  }
+}
+
+size_t TempFile::size() const { return _size; }
+
+TempFileWriter::TempFileWriter(TempFile& file, const size_t buffer_size) : _file(file), _buffer_size(buffer_size) {
+  _buffer.reserve(buffer_size);
+}
+
+void TempFileWriter::flush() {
+  _file.write(_buffer.data(), _buffer.size());
+  _buffer.clear();
+}
+
+void TempFileWriter::_append(const void* data, const size_t bytes) {
+  const auto* begin = static_cast<const char*>(data);
+  _buffer.insert(_buffer.end(), begin, begin + bytes);
+  if (_buffer.size() >= _buffer_size) flush();
+}
+
+TempFileReader::TempFileReader(const TempFile& file, const size_t begin, const size_t end, const size_t buffer_size)
+    : _file(file), _file_offset(begin), _end(end), _buffer_size(buffer_size) {
+  DebugAssert(begin <= end && end <= file.size(), "Invalid range of the temporary file");
+}
+
+bool TempFileReader::at_end() const { return _buffer_offset == _buffer.size() && _file_offset == _end; }
+
+void TempFileReader::_consume(void* data, const size_t bytes) {
+  auto* output = static_cast<char*>(data);
+  auto consumed_bytes = size_t{0};
+  while (consumed_bytes < bytes) {
+    if (_buffer_offset == _buffer.size()) {
+      Assert(_file_offset < _end, "Cannot read beyond the end of the range");
+      _buffer.resize(std::min(_buffer_size, _end - _file_offset));
+      _file.read(_file_offset, _buffer.data(), _buffer.size());
+      _file_offset += _buffer.size();
+      _buffer_offset = 0;
+    }
+
+    const auto copied_bytes = std::min(bytes - consumed_bytes, _buffer.size() - _buffer_offset);
+    std::copy_n(_buffer.data() + _buffer_offset, copied_bytes, output + consumed_bytes);
+    _buffer_offset += copied_bytes;
+    consumed_bytes += copied_bytes;
+  }
+}
+
+TempFileManager::TempFileManager() : _directory(filesystem::temp_directory_path()) {}
+
+void TempFileManager::set_directory(const filesystem::path& directory) {
+  Assert(filesystem::is_directory(directory), "Directory for temporary files does not exist: " + directory.string());
+  std::lock_guard<std::mutex> lock(_directory_mutex);
+  _directory = directory;
+}
+
+filesystem::path TempFileManager::directory() const {
+  std::lock_guard<std::mutex> lock(_directory_mutex);
+  return _directory;
+}
+
+std::unique_ptr<TempFile> TempFileManager::create_file() {
+  // The process id keeps concurrent processes (e.g., test runs) that share the directory apart
+  const auto file_name = "hyrise_" + std::to_string(getpid()) + "_" + std::to_string(_next_file_id++) + ".tmp";
+  return std::make_unique<TempFile>(directory() / file_name);
+}
+
+size_t TempFileManager::written_bytes() const { return _written_bytes.load(); }
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "utils/filesystem.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * A file for intermediate data that does not fit into memory, e.g., the spilled partitions of the JoinHash. The file
+ * is unlinked as soon as it is created, so that the OS removes it once the TempFile is destroyed, even if the process
+ * crashes. Writes append to the file, reads may access any range that has been written.
+ */
+class TempFile {
+ public:
+  explicit TempFile(const filesystem::path& path);
+
+  TempFile(const TempFile&) = delete;
+  TempFile& operator=(const TempFile&) = delete;
+
+  ~TempFile();
+
+  void write(const void* data, const size_t bytes);
+
+  void read(const size_t offset, void* data, const size_t bytes) const;
+
+  // The number of bytes written so far
+  size_t size() const;
+
+ private:
+  int _file_descriptor{-1};
+  size_t _size{0};
+};
+
+/**
+ * Appends values to a TempFile through a buffer, so that small values do not need a write of their own. Values of
+ * trivially copyable types are written as their bytes, strings as their length followed by their characters. The
+ * buffer has to be flushed before the values are read.
+ */
+class TempFileWriter {
+ public:
+  static constexpr auto DEFAULT_BUFFER_SIZE = size_t{1} << 20;
+
+  explicit TempFileWriter(TempFile& file, const size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+  template <typename T>
+  void write(const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      write(value.size());
+      _append(value.data(), value.size());
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Value cannot be written as its bytes");
+      _append(&value, sizeof(T));
+    }
+  }
+
+  void flush();
+
+ private:
+  void _append(const void* data, const size_t bytes);
+
+  TempFile& _file;
+  const size_t _buffer_size;
+  std::vector<char> _buffer;
+};
+
+/**
+ * Reads the values written by a TempFileWriter from the range [begin, end) of a TempFile, front to back. Only the
+ * buffer is kept in memory, so that, e.g., many sorted runs can be merged at once.
+ */
+class TempFileReader {
+ public:
+  static constexpr auto DEFAULT_BUFFER_SIZE = size_t{1} << 20;
+
+  TempFileReader(const TempFile& file, const size_t begin, const size_t end,
+                 const size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+  template <typename T>
+  void read(T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto length = size_t{0};
+      read(length);
+      value.resize(length);
+      _consume(value.data(), length);
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Value cannot be read as its bytes");
+      _consume(&value, sizeof(T));
+    }
+  }
+
+  bool at_end() const;
+
+ private:
+  void _consume(void* data, const size_t bytes);
+
+  const TempFile& _file;
+  size_t _file_offset;
+  const size_t _end;
+  const size_t _buffer_size;
+  std::vector<char> _buffer;
+  size_t _buffer_offset{0};
+};
+
+/**
+ * Creates the TempFiles of all operators. They are placed in a directory that should be on a fast local disk (e.g., an
+ * NVMe SSD), which is the system's temporary directory unless set otherwise.
+ */
+class TempFileManager : public Singleton<TempFileManager> {
+ public:
+  void set_directory(const filesystem::path& directory);
+  filesystem::path directory() const;
+
+  std::unique_ptr<TempFile> create_file();
+
+  // The number of bytes written to all TempFiles so far
+  size_t written_bytes() const;
+
+ protected:
+  friend class Singleton;
+  friend class TempFile;
+
+  TempFileManager();
+
+  mutable std::mutex _directory_mutex;
+  filesystem::path _directory;
+
+  std::atomic<size_t> _next_file_id{0};
+  std::atomic<size_t> _written_bytes{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#include "tracking_memory_resource.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TrackingMemoryResource::TrackingMemoryResource(boost::container::pmr::memory_resource* upstream)
+    : _upstream(upstream) {}
+
+void TrackingMemoryResource::set_upstream(boost::container::pmr::memory_resource* upstream) {
+  DebugAssert(_allocated_bytes == 0, "Cannot change the upstream resource while memory is allocated from it");
+  _upstream = upstream;
+}
+
+boost::container::pmr::memory_resource* TrackingMemoryResource::upstream() const { return _upstream; }
+
+size_t TrackingMemoryResource::allocated_bytes() const { return _allocated_bytes.load(); }
+
+size_t TrackingMemoryResource::peak_allocated_bytes() const { return _peak_allocated_bytes.load(); }
+
+size_t TrackingMemoryResource::total_allocated_bytes() const { return _total_allocated_bytes.load(); }
+
+void* TrackingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // If the upstream resource throws (e.g., because a budget was exceeded), the bytes are not counted
+  auto* pointer = _upstream->allocate(bytes, alignment);
+
+  _total_allocated_bytes += bytes;
+  const auto allocated_bytes = _allocated_bytes.fetch_add(bytes) + bytes;
+  auto peak_allocated_bytes = _peak_allocated_bytes.load();
+  while (allocated_bytes > peak_allocated_bytes &&
+         !_peak_allocated_bytes.compare_exchange_weak(peak_allocated_bytes, allocated_bytes)) {
+  }
+
+  return pointer;
+}
+
+void TrackingMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  _allocated_bytes -= bytes;
+  _upstream->deallocate(p, bytes, alignment);
+}
+
+bool TrackingMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+}  // namespace opossum
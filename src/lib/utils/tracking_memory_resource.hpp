@@ -0,0 +1,46 @@
+#pragma once
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace opossum {
+
+/**
+ * Forwards all allocations to an upstream resource and keeps track of the bytes that are currently allocated through
+ * it, e.g., for attributing the intermediate data of a query to its operators (see
+ * AbstractOperator::query_memory_resource()). It is thread-safe, as long as the upstream resource is.
+ */
+class TrackingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit TrackingMemoryResource(
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+
+  // Not thread-safe, must only be called while nothing is allocated through the resource
+  void set_upstream(boost::container::pmr::memory_resource* upstream);
+  boost::container::pmr::memory_resource* upstream() const;
+
+  size_t allocated_bytes() const;
+  size_t peak_allocated_bytes() const;
+
+  // The bytes of all allocations so far, including those that were deallocated again
+  size_t total_allocated_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  boost::container::pmr::memory_resource* _upstream;
+
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic<size_t> _peak_allocated_bytes{0};
+  std::atomic<size_t> _total_allocated_bytes{0};
+};
+
+}  // namespace opossum
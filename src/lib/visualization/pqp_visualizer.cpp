@@ -1,13 +1,20 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_select_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "operators/limit.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
-#include "utils/format_duration.hpp"
+#include "operators/top_k.hpp"
+#include "statistics/table_statistics.hpp"
 #include "visualization/abstract_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
@@ -20,12 +27,45 @@ PQPVisualizer::PQPVisualizer(GraphvizConfig graphviz_config, VizGraphInfo graph_
     : AbstractVisualizer(std::move(graphviz_config), std::move(graph_info), std::move(vertex_info),
                          std::move(edge_info)) {}
 
+float PQPVisualizer::q_error(const float estimated_row_count, const float actual_row_count) {
+  const auto estimated = std::max(estimated_row_count, 1.0f);
+  const auto actual = std::max(actual_row_count, 1.0f);
+  return std::max(estimated / actual, actual / estimated);
+}
+
 void PQPVisualizer::_build_graph(const std::vector<std::shared_ptr<AbstractOperator>>& plans) {
   std::unordered_set<std::shared_ptr<const AbstractOperator>> visualized_ops;
 
   for (const auto& plan : plans) {
     _build_subtree(plan, visualized_ops);
   }
+
+  // The share of each operator of the walltime of all operators, including those of subselects, is only known once all
+  // operators are visualized
+  auto total_walltime = std::chrono::nanoseconds{0};
+  for (const auto& op : visualized_ops) {
+    if (op->get_output()) total_walltime += op->performance_data().walltime;
+  }
+  if (total_walltime.count() == 0) return;
+
+  for (const auto& op : visualized_ops) {
+    if (!op->get_output()) continue;
+
+    auto& info = _graph[_id_to_position.at(_get_id(op))];
+    const auto walltime_share = static_cast<double>(op->performance_data().walltime.count()) /
+                                static_cast<double>(total_walltime.count());
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(1) << walltime_share * 100 << "% of the walltime";
+    info.label += "\n" + stream.str();
+
+    if (walltime_share >= HOT_WALLTIME_SHARE) {
+      info.color = "#FF4040";
+      info.font_color = "#FF4040";
+    } else if (walltime_share >= WARM_WALLTIME_SHARE) {
+      info.color = "#FFA040";
+      info.font_color = "#FFA040";
+    }
+  }
 }
 
 void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>& op,
@@ -66,6 +106,11 @@ void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>
       _visualize_subselects(op, limit->row_count_expression(), visualized_ops);
     } break;
 
+    case OperatorType::TopK: {
+      const auto top_k = std::dynamic_pointer_cast<const TopK>(op);
+      _visualize_subselects(op, top_k->row_count_expression(), visualized_ops);
+    } break;
+
     default: {}  // OperatorType has no expressions
   }
 }
@@ -92,19 +137,33 @@ void PQPVisualizer::_visualize_subselects(const std::shared_ptr<const AbstractOp
 void PQPVisualizer::_build_dataflow(const std::shared_ptr<const AbstractOperator>& from,
                                     const std::shared_ptr<const AbstractOperator>& to) {
   VizEdgeInfo info = _default_edge;
+  std::stringstream stream;
 
-  if (const auto& output = from->get_output()) {
-    std::stringstream stream;
+  const auto estimated_row_count = _estimated_row_count(*from);
+  if (estimated_row_count) {
+    stream << std::fixed << std::setprecision(1) << *estimated_row_count << " row(s) estd.\n";
+  } else {
+    stream << "no est.\n";
+  }
 
+  if (const auto& output = from->get_output()) {
     stream << std::to_string(output->row_count()) + " row(s)/";
     stream << std::to_string(output->chunk_count()) + " chunk(s)/";
     stream << format_bytes(output->estimate_memory_usage());
 
-    info.label = stream.str();
-
     info.pen_width = std::fmax(1, std::ceil(std::log10(output->row_count()) / 2));
+
+    if (estimated_row_count) {
+      const auto estimation_q_error = q_error(*estimated_row_count, static_cast<float>(output->row_count()));
+      if (estimation_q_error > Q_ERROR_THRESHOLD) {
+        stream << "\nq-error " << std::fixed << std::setprecision(1) << estimation_q_error;
+        info.color = "#FF4040";
+        info.font_color = "#FF4040";
+      }
+    }
   }
 
+  info.label = stream.str();
   _add_edge(from, to, info);
 }
 
@@ -113,8 +172,9 @@ void PQPVisualizer::_add_operator(const std::shared_ptr<const AbstractOperator>&
   auto label = op->description(DescriptionMode::MultiLine);
 
   if (op->get_output()) {
-    auto total = op->performance_data().walltime;
-    label += "\n\n" + format_duration(total);
+    const auto& performance_data = op->performance_data();
+    auto total = performance_data.walltime;
+    label += "\n\n" + performance_data.to_string(DescriptionMode::MultiLine);
     info.pen_width = std::fmax(1, std::ceil(std::log10(total.count()) / 2));
   }
 
@@ -122,4 +182,16 @@ void PQPVisualizer::_add_operator(const std::shared_ptr<const AbstractOperator>&
   _add_vertex(op, info);
 }
 
+std::optional<float> PQPVisualizer::_estimated_row_count(const AbstractOperator& op) {
+  if (!op.lqp_node) return std::nullopt;
+
+  try {
+    const auto& lqp_node = *op.lqp_node;
+    return lqp_node.derive_statistics_from(lqp_node.left_input(), lqp_node.right_input())->row_count();
+  } catch (...) {
+    // Statistics don't exist for this node (e.g., for maintenance nodes)
+    return std::nullopt;
+  }
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -10,8 +11,25 @@
 
 namespace opossum {
 
+/**
+ * Visualizes executed PQPs for diagnosing slow plans:
+ *  - Each dataflow is labelled with the row count that the statistics of the operator's LQP node estimated and the
+ *    actual row count. If either is more than Q_ERROR_THRESHOLD times the other, the dataflow is highlighted.
+ *  - Each operator shows its share of the walltime of all operators, and the operators that take the largest shares
+ *    are highlighted as hot spots.
+ */
 class PQPVisualizer : public AbstractVisualizer<std::vector<std::shared_ptr<AbstractOperator>>> {
  public:
+  // Dataflows whose q-error, i.e., max(estimated / actual, actual / estimated), exceeds this are highlighted
+  static constexpr auto Q_ERROR_THRESHOLD = 10.0f;
+
+  // Operators that take at least these shares of the total walltime are highlighted as hot or warm spots
+  static constexpr auto HOT_WALLTIME_SHARE = 0.5;
+  static constexpr auto WARM_WALLTIME_SHARE = 0.2;
+
+  // The q-error of an estimation, where row counts below one are counted as one
+  static float q_error(const float estimated_row_count, const float actual_row_count);
+
   PQPVisualizer();
 
   PQPVisualizer(GraphvizConfig graphviz_config, VizGraphInfo graph_info = {}, VizVertexInfo vertex_info = {},
@@ -31,6 +49,9 @@ class PQPVisualizer : public AbstractVisualizer<std::vector<std::shared_ptr<Abst
                        const std::shared_ptr<const AbstractOperator>& to);
 
   void _add_operator(const std::shared_ptr<const AbstractOperator>& op);
+
+  // The row count that the statistics of the LQP node of @param op estimated, if it has one with statistics
+  static std::optional<float> _estimated_row_count(const AbstractOperator& op);
 };
 
 }  // namespace opossum
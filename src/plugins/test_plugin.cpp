@@ -1,6 +1,23 @@
 #include "test_plugin.hpp"
 
+#include "operators/table_wrapper.hpp"
+#include "optimizer/strategy/abstract_rule.hpp"
 #include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Leaves the LQP as it is, so that tests can check that the rules of plugins are applied
+class TestPluginRule : public AbstractRule {
+ public:
+  std::string name() const override { return "TestPluginRule"; }
+
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {}
+};
+
+}  // namespace
 
 namespace opossum {
 
@@ -12,9 +29,31 @@ void TestPlugin::start() {
   auto table = std::make_shared<Table>(column_definitions, TableType::Data);
 
   sm.add_table("DummyTable", table);
+
+  auto& plugin_manager = PluginManager::get();
+  plugin_manager.add_optimizer_rule(std::make_shared<TestPluginRule>(), "ColumnPruningRule");
+
+  // DummyTableNodes are translated to the DummyTable instead of the dummy table of the Projection
+  plugin_manager.add_lqp_translator_override(
+      LQPNodeType::DummyTable, [](const std::shared_ptr<AbstractLQPNode>& node, const LQPTranslator& translator) {
+        return std::make_shared<TableWrapper>(StorageManager::get().get_table("DummyTable"));
+      });
+
+  // Adds the DummyMaintenanceTable once the task ran
+  plugin_manager.add_maintenance_task("TestPluginMaintenance", std::chrono::milliseconds{10}, [](const size_t) {
+    auto& storage_manager = StorageManager::get();
+    if (storage_manager.has_table("DummyMaintenanceTable")) return;
+
+    const auto maintenance_column_definitions = TableColumnDefinitions{{"col_1", DataType::Int}};
+    storage_manager.add_table("DummyMaintenanceTable",
+                              std::make_shared<Table>(maintenance_column_definitions, TableType::Data));
+  });
 }
 
-void TestPlugin::stop() { StorageManager::get().drop_table("DummyTable"); }
+void TestPlugin::stop() {
+  StorageManager::get().drop_table("DummyTable");
+  if (sm.has_table("DummyMaintenanceTable")) sm.drop_table("DummyMaintenanceTable");
+}
 
 EXPORT_PLUGIN(TestPlugin)
 
@@ -10,9 +10,14 @@
 #include "expression/expression_functional.hpp"
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
+#if HYRISE_JIT_SUPPORT
+#include "operators/jit_operator/jit_module_cache.hpp"
+#endif
 #include "operators/table_scan.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/numa_placement_manager.hpp"
@@ -89,6 +94,13 @@ class BaseTestWithParam
 
     SQLPhysicalPlanCache::get().clear();
     SQLLogicalPlanCache::get().clear();
+    SQLPreparedPlanCache::get().clear();
+    SQLPlanCacheDependencies::get().clear();
+    SQLResultCache::get().resize(0);
+    CardinalityFeedback::get().clear();
+#if HYRISE_JIT_SUPPORT
+    JitModuleCache::get().clear();
+#endif
   }
 
   static std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
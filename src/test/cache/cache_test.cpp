@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -253,6 +256,59 @@ TEST(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+TEST(CachePolicyTest, Shards) {
+  // Too small for more than one shard
+  EXPECT_EQ((Cache<int, int>{2}.shard_count()), 1u);
+  EXPECT_EQ((Cache<int, int>{MinCacheShardCapacity * 4}.shard_count()), 4u);
+
+  Cache<int, int> cache(1000, 8);
+  ASSERT_EQ(cache.shard_count(), 8u);
+  EXPECT_EQ(cache.capacity(), 1000u);
+
+  for (auto key = 0; key < 2000; ++key) {
+    cache.set(key, 2 * key);
+  }
+
+  // Each shard evicts its own entries
+  EXPECT_LE(cache.size(), 1000u);
+
+  auto element_count = size_t{0};
+  for (const auto& [key, value] : cache) {
+    ++element_count;
+    EXPECT_EQ(value, 2 * key);
+    EXPECT_EQ(cache.try_get(key), value);
+  }
+  EXPECT_EQ(element_count, cache.size());
+
+  cache.resize(500);
+  EXPECT_EQ(cache.capacity(), 500u);
+  EXPECT_LE(cache.size(), 500u);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_TRUE(cache.begin() == cache.end());
+}
+
+TEST(CachePolicyTest, ConcurrentAccess) {
+  Cache<int, int> cache(1024);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0; thread_idx < 8; ++thread_idx) {
+    threads.emplace_back([&, thread_idx]() {
+      for (auto key = thread_idx * 100; key < (thread_idx + 1) * 100; ++key) {
+        cache.set(key, key + 1);
+        EXPECT_EQ(cache.try_get(key), key + 1);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(cache.size(), 800u);
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
@@ -287,6 +343,29 @@ TYPED_TEST(CacheTest, Clear) {
   ASSERT_FALSE(cache.has(2));
 }
 
+TYPED_TEST(CacheTest, Erase) {
+  TypeParam cache(3);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+  cache.set(3, 6);
+
+  cache.erase(1);
+  cache.erase(4);
+
+  ASSERT_EQ(cache.size(), 2u);
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_EQ(cache.get(2), 4);
+  ASSERT_EQ(cache.get(3), 6);
+
+  // The erased entry does not count towards the capacity anymore
+  cache.set(5, 10);
+  ASSERT_EQ(cache.size(), 3u);
+  ASSERT_EQ(cache.get(2), 4);
+  ASSERT_EQ(cache.get(3), 6);
+  ASSERT_EQ(cache.get(5), 10);
+}
+
 TYPED_TEST(CacheTest, ResizeGrow) {
   TypeParam cache(3);
 
@@ -368,4 +447,16 @@ TYPED_TEST(CacheTest, CacheIteratorsBeginEndLoop) {
   ASSERT_EQ(value_sum, 200);
 }
 
+TEST(CachePolicyTest, HitAndMissCounts) {
+  Cache<int, int> cache(2);
+  cache.set(0, 100);
+
+  EXPECT_TRUE(cache.try_get(0));
+  EXPECT_TRUE(cache.try_get(0));
+  EXPECT_FALSE(cache.try_get(1));
+
+  EXPECT_EQ(cache.hit_count(), 2u);
+  EXPECT_EQ(cache.miss_count(), 1u);
+}
+
 }  // namespace opossum
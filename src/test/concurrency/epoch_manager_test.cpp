@@ -0,0 +1,80 @@
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/epoch_manager.hpp"
+
+namespace opossum {
+
+class EpochManagerTest : public BaseTest {};
+
+TEST_F(EpochManagerTest, FreesRetiredObjectsOnceReadersAreDone) {
+  auto object = std::make_shared<int>(42);
+  const auto weak_object = std::weak_ptr<int>{object};
+
+  {
+    const auto epoch_guard = EpochManager::get().pin();
+    EpochManager::get().retire(std::move(object));
+
+    // The reader might still access the object
+    EpochManager::get().reclaim();
+    EXPECT_FALSE(weak_object.expired());
+  }
+
+  EpochManager::get().reclaim();
+  EXPECT_TRUE(weak_object.expired());
+
+  // Without readers, the object is freed right away
+  object = std::make_shared<int>(43);
+  const auto other_weak_object = std::weak_ptr<int>{object};
+  EpochManager::get().retire(std::move(object));
+  EXPECT_TRUE(other_weak_object.expired());
+}
+
+TEST_F(EpochManagerTest, NestedAndMovedGuards) {
+  auto object = std::make_shared<int>(42);
+  const auto weak_object = std::weak_ptr<int>{object};
+
+  auto outer_epoch_guard = std::make_unique<EpochGuard>(EpochManager::get().pin());
+  EpochManager::get().retire(std::move(object));
+
+  {
+    auto inner_epoch_guard = EpochManager::get().pin();
+    const auto moved_epoch_guard = std::move(inner_epoch_guard);
+  }
+
+  // The outer guard still pins the epoch
+  EpochManager::get().reclaim();
+  EXPECT_FALSE(weak_object.expired());
+
+  outer_epoch_guard.reset();
+  EpochManager::get().reclaim();
+  EXPECT_TRUE(weak_object.expired());
+}
+
+TEST_F(EpochManagerTest, ReadersOfOtherThreads) {
+  auto object = std::make_shared<int>(42);
+  const auto weak_object = std::weak_ptr<int>{object};
+
+  auto is_pinned = std::atomic_bool{false};
+  auto may_unpin = std::atomic_bool{false};
+  auto reader = std::thread([&]() {
+    const auto epoch_guard = EpochManager::get().pin();
+    is_pinned = true;
+    while (!may_unpin) std::this_thread::yield();
+  });
+
+  while (!is_pinned) std::this_thread::yield();
+  EpochManager::get().retire(std::move(object));
+  EXPECT_FALSE(weak_object.expired());
+
+  may_unpin = true;
+  reader.join();
+
+  EpochManager::get().reclaim();
+  EXPECT_TRUE(weak_object.expired());
+}
+
+}  // namespace opossum
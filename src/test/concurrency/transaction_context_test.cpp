@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -56,11 +58,19 @@ class CommitFuncOp : public AbstractReadWriteOperator {
   std::function<void()> _func;
 };
 
+// Read-only transactions get no commit ids, so the transactions of the tests below register an operator that writes
+void register_write(const std::shared_ptr<TransactionContext>& context) {
+  const auto write_op = std::make_shared<CommitFuncOp>([]() {});
+  write_op->set_transaction_context(context);
+  write_op->execute();
+}
+
 TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions) {
   const auto empty_callback = [](TransactionID) {};
 
   auto context_1 = manager().new_transaction_context();
   auto context_2 = manager().new_transaction_context();
+  register_write(context_2);
 
   const auto prev_last_commit_id = manager().last_commit_id();
 
@@ -91,6 +101,8 @@ TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions
 TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   auto context_1 = manager().new_transaction_context();
   auto context_2 = manager().new_transaction_context();
+  register_write(context_1);
+  register_write(context_2);
 
   auto context_1_committed = false;
   auto callback_1 = [&context_1_committed](TransactionID) { context_1_committed = true; };
@@ -108,4 +120,86 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, CommitsPendingTransactionsAsOneBatch) {
+  auto context_1 = manager().new_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+  auto context_3 = manager().new_transaction_context();
+  register_write(context_2);
+  register_write(context_3);
+
+  // The last commit id that is visible when the callbacks of the transactions fire
+  auto visible_commit_ids = std::vector<CommitID>{};
+  const auto callback = [&](TransactionID) { visible_commit_ids.emplace_back(manager().last_commit_id()); };
+
+  auto commit_op = std::make_shared<CommitFuncOp>([&]() {
+    context_2->commit_async(callback);
+    context_3->commit_async(callback);
+  });
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  context_1->commit_async(callback);
+
+  // The commit ids of all three transactions were published at once
+  EXPECT_EQ(visible_commit_ids, std::vector<CommitID>(3, context_3->commit_id()));
+  EXPECT_EQ(context_1->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+}
+
+TEST_F(TransactionContextTest, ConcurrentCommitsGetConsecutiveCommitIDs) {
+  constexpr auto THREAD_COUNT = size_t{8};
+  constexpr auto COMMITS_PER_THREAD = size_t{200};
+
+  const auto first_commit_id = manager().last_commit_id() + 1;
+
+  auto commit_ids = std::vector<std::vector<CommitID>>(THREAD_COUNT);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = size_t{0}; thread_index < THREAD_COUNT; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto commit_index = size_t{0}; commit_index < COMMITS_PER_THREAD; ++commit_index) {
+        auto context = manager().new_transaction_context();
+        register_write(context);
+        context->commit();
+        commit_ids[thread_index].emplace_back(context->commit_id());
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  auto all_commit_ids = std::vector<CommitID>{};
+  for (const auto& thread_commit_ids : commit_ids) {
+    all_commit_ids.insert(all_commit_ids.end(), thread_commit_ids.begin(), thread_commit_ids.end());
+  }
+  std::sort(all_commit_ids.begin(), all_commit_ids.end());
+
+  for (auto commit_index = size_t{0}; commit_index < all_commit_ids.size(); ++commit_index) {
+    EXPECT_EQ(all_commit_ids[commit_index], first_commit_id + commit_index);
+  }
+  EXPECT_EQ(manager().last_commit_id(), all_commit_ids.back());
+}
+
+TEST_F(TransactionContextTest, ReadOnlyTransactionsCommitWithoutCommitID) {
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto writing_context = manager().new_transaction_context();
+  auto read_only_context = manager().new_transaction_context();
+
+  // The read-only transaction does not wait for the pending commit of the earlier transaction
+  auto read_only_context_committed = false;
+  auto commit_op = std::make_shared<CommitFuncOp>([&]() {
+    read_only_context->commit_async([&](TransactionID) { read_only_context_committed = true; });
+    EXPECT_TRUE(read_only_context_committed);
+    EXPECT_EQ(read_only_context->phase(), TransactionPhase::Committed);
+  });
+  commit_op->set_transaction_context(writing_context);
+  commit_op->execute();
+  writing_context->commit();
+
+  EXPECT_TRUE(read_only_context->is_read_only());
+  EXPECT_THROW(read_only_context->commit_id(), std::logic_error);
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 1);
+  EXPECT_EQ(writing_context->commit_id(), prev_last_commit_id + 1);
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), manager().last_commit_id());
+}
+
 }  // namespace opossum
@@ -0,0 +1,120 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_physical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CostModelPhysicalTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    node_a = create_mock_node(1'000.0f, "a");
+    node_b = create_mock_node(1'000'000.0f, "b");
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+  }
+
+  static std::shared_ptr<MockNode> create_mock_node(const float row_count, const std::string& name) {
+    const auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+        std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 1, static_cast<int32_t>(row_count))};
+    const auto node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, name);
+    node->set_statistics(std::make_shared<TableStatistics>(TableType::Data, row_count, column_statistics));
+    return node;
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b;
+  LQPColumnReference a_a, b_a;
+};
+
+TEST_F(CostModelPhysicalTest, LinearCostFunction) {
+  const auto cost_function = LinearCostFunction{10.0f, {2.0f, 0.5f}};
+  EXPECT_FLOAT_EQ(cost_function({3.0f, 4.0f}), 18.0f);
+  EXPECT_FLOAT_EQ(cost_function({0.0f, 0.0f}), 10.0f);
+}
+
+TEST_F(CostModelPhysicalTest, Features) {
+  const auto hash_features = CostModelPhysical::features(OperatorType::JoinHash, 100.0f, 10.0f, 50.0f);
+  EXPECT_EQ(hash_features, std::vector<float>({10.0f, 100.0f, 50.0f}));
+
+  const auto sort_merge_features = CostModelPhysical::features(OperatorType::JoinSortMerge, 4.0f, 8.0f, 2.0f);
+  EXPECT_EQ(sort_merge_features, std::vector<float>({32.0f, 12.0f, 2.0f}));
+
+  const auto index_features = CostModelPhysical::features(OperatorType::JoinIndex, 100.0f, 1'000.0f, 100.0f, 5);
+  EXPECT_EQ(index_features, std::vector<float>({500.0f, 100.0f}));
+
+  const auto index_scan_features = CostModelPhysical::features(OperatorType::IndexScan, 1'000.0f, 0.0f, 8.0f, 2);
+  EXPECT_EQ(index_scan_features, std::vector<float>({2.0f, 8.0f, 24.0f}));
+
+  // Every cost function has one weight per feature
+  const auto cost_model = CostModelPhysical{};
+  for (const auto operator_type : {OperatorType::JoinHash, OperatorType::JoinSortMerge, OperatorType::JoinIndex,
+                                   OperatorType::JoinNestedLoop, OperatorType::TableScan, OperatorType::IndexScan}) {
+    EXPECT_EQ(cost_model.cost_function(operator_type).weights.size(),
+              CostModelPhysical::features(operator_type, 1.0f, 1.0f, 1.0f).size());
+  }
+}
+
+TEST_F(CostModelPhysicalTest, DefaultCoefficients) {
+  const auto cost_model = CostModelPhysical{};
+
+  // Hashing is cheaper than sorting large inputs
+  EXPECT_LT(cost_model.estimate_join_cost(OperatorType::JoinHash, 1e6f, 1e6f, 1e6f),
+            cost_model.estimate_join_cost(OperatorType::JoinSortMerge, 1e6f, 1e6f, 1e6f));
+
+  // Looking up a few rows in an index is cheaper than hashing the indexed input
+  EXPECT_LT(cost_model.estimate_join_cost(OperatorType::JoinIndex, 10.0f, 1e6f, 10.0f, 10),
+            cost_model.estimate_join_cost(OperatorType::JoinHash, 10.0f, 1e6f, 10.0f));
+
+  // Probing pays off for selective predicates only
+  EXPECT_LT(cost_model.estimate_scan_cost(OperatorType::IndexScan, 1e6f, 100.0f),
+            cost_model.estimate_scan_cost(OperatorType::TableScan, 1e6f, 100.0f));
+  EXPECT_GT(cost_model.estimate_scan_cost(OperatorType::IndexScan, 1e6f, 5e5f),
+            cost_model.estimate_scan_cost(OperatorType::TableScan, 1e6f, 5e5f));
+}
+
+TEST_F(CostModelPhysicalTest, EstimatePlanCost) {
+  auto coefficients = PhysicalCostCoefficients{};
+  coefficients.table_scan = LinearCostFunction{0.0f, {1.0f, 0.0f}};
+  coefficients.join_hash = LinearCostFunction{5.0f, {0.0f, 0.0f, 0.0f}};
+  const auto cost_model = CostModelPhysical{coefficients};
+
+  const auto predicate_node = PredicateNode::make(equals_(a_a, 5), node_a);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node), 1'000.0f);
+
+  // The MockNodes are costed like TableScans without input
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a_a, b_a), node_a, node_b);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(join_node), 5.0f);
+}
+
+TEST_F(CostModelPhysicalTest, Json) {
+  auto coefficients = PhysicalCostCoefficients{};
+  coefficients.join_index = LinearCostFunction{1.5f, {2.5f, 3.5f}};
+
+  const auto json = nlohmann::json(coefficients);
+  const auto parsed_coefficients = json.get<PhysicalCostCoefficients>();
+  EXPECT_EQ(parsed_coefficients.join_index.setup, 1.5f);
+  EXPECT_EQ(parsed_coefficients.join_index.weights, std::vector<Cost>({2.5f, 3.5f}));
+  EXPECT_EQ(parsed_coefficients.join_hash.weights, PhysicalCostCoefficients{}.join_hash.weights);
+
+  // Cost functions that are not given keep their defaults
+  const auto partial_coefficients = nlohmann::json::parse(R"({"table_scan": {"setup": 1, "weights": [2, 3]}})")
+                                        .get<PhysicalCostCoefficients>();
+  EXPECT_EQ(partial_coefficients.table_scan.weights, std::vector<Cost>({2.0f, 3.0f}));
+  EXPECT_EQ(partial_coefficients.index_scan.weights, PhysicalCostCoefficients{}.index_scan.weights);
+
+  EXPECT_THROW(nlohmann::json::parse(R"({"table_scan": {"setup": 1, "weights": [2]}})").get<PhysicalCostCoefficients>(),
+               std::logic_error);
+}
+
+}  // namespace opossum
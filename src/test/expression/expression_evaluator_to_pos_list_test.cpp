@@ -164,4 +164,38 @@ TEST_F(ExpressionEvaluatorToPosListTest, ExistsUncorrelated) {
   EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *not_exists_(select_none), {0, 1, 2, 3}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, MultipleBatches) {
+  // A chunk of more than two batches, with the last one being incomplete
+  const auto row_count = ExpressionEvaluator::BATCH_SIZE * 2 + 100;
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             row_count);
+  for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+    table->append({row_idx % 11 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<int32_t>(row_idx % 7)}});
+  }
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+
+  const auto expected_chunk_offsets = [&](const auto& predicate) {
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+      if (predicate(row_idx % 11 == 0, row_idx % 7)) chunk_offsets.emplace_back(row_idx);
+    }
+    return chunk_offsets;
+  };
+
+  // The right operands are only evaluated for the rows still in the selections
+  EXPECT_TRUE(test_expression(table, ChunkID{0}, *and_(less_than_(a, 3), greater_than_(add_(a, 1), 1)),
+                              expected_chunk_offsets([](const auto is_null, const auto value) {
+                                return !is_null && value < 3 && value + 1 > 1;
+                              })));
+  EXPECT_TRUE(test_expression(table, ChunkID{0}, *or_(and_(less_than_(a, 3), not_equals_(a, 1)), equals_(a, 6)),
+                              expected_chunk_offsets([](const auto is_null, const auto value) {
+                                return !is_null && ((value < 3 && value != 1) || value == 6);
+                              })));
+  EXPECT_TRUE(test_expression(table, ChunkID{0}, *or_(is_null_(a), equals_(a, 2)),
+                              expected_chunk_offsets([](const auto is_null, const auto value) {
+                                return is_null || value == 2;
+                              })));
+  EXPECT_TRUE(test_expression(table, ChunkID{0}, *and_(equals_(a, 7), is_null_(a)), {}));
+}
+
 }  // namespace opossum
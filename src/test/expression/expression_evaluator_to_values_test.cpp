@@ -1,3 +1,4 @@
+#include <limits>
 #include <optional>
 
 #include "gtest/gtest.h"
@@ -223,6 +224,15 @@ TEST_F(ExpressionEvaluatorToValuesTest, ArithmeticsLiterals) {
   EXPECT_TRUE(test_expression<float>(*mod_(23.25, 3), {2.25}));
   EXPECT_TRUE(test_expression<float>(*mod_(23.25, 0), {std::nullopt}));
   EXPECT_TRUE(test_expression<float>(*mod_(5, 0), {std::nullopt}));
+
+  // Integer arithmetic fails on overflows
+  const auto int_max = std::numeric_limits<int32_t>::max();
+  const auto long_min = std::numeric_limits<int64_t>::min();
+  EXPECT_TRUE(test_expression<int32_t>(*add_(int_max - 1, 1), {int_max}));
+  EXPECT_THROW(test_expression<int32_t>(*add_(int_max, 1), {std::nullopt}), std::logic_error);
+  EXPECT_THROW(test_expression<int32_t>(*mul_(int_max, 2), {std::nullopt}), std::logic_error);
+  EXPECT_THROW(test_expression<int64_t>(*sub_(long_min, 1), {std::nullopt}), std::logic_error);
+  EXPECT_TRUE(test_expression<int64_t>(*mul_(int64_t{int_max}, 2), {int64_t{int_max} * 2}));
 }
 
 TEST_F(ExpressionEvaluatorToValuesTest, ArithmeticsSeries) {
@@ -314,6 +324,21 @@ TEST_F(ExpressionEvaluatorToValuesTest, CaseSeries) {
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CaseSeriesEvaluatesBranchesOnTheirRows) {
+  // Nested CASEs, as the SQLTranslator creates them for multiple WHENs
+  EXPECT_TRUE(test_expression<int32_t>(
+      table_a, *case_(less_than_(a, 2), 10, case_(less_than_(a, 4), add_(b, 100), mul_(c, 2))),
+      {10, 103, 104, std::nullopt}));
+  EXPECT_TRUE(test_expression<std::string>(table_a, *case_(equals_(a, 2), s1, s2), {"b", "Hello", "up", "Same"}));
+
+  // The multiplication would overflow for the rows that do not take its branch
+  const auto int_max = std::numeric_limits<int32_t>::max();
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(a, 1), 0, mul_(a, int_max)), {int_max, 0, 0, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(a, 0), b, mul_(a, int_max)), {2, 3, 4, 5}));
+  EXPECT_THROW(test_expression<int32_t>(table_a, *case_(greater_than_(a, 3), 0, mul_(a, int_max)), {}),
+               std::logic_error);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, IsNullLiteral) {
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(0), {0}));
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(1), {0}));
@@ -539,6 +564,28 @@ TEST_F(ExpressionEvaluatorToValuesTest, InSelectUncorrelatedWithPrecalculated) {
                                        uncorrelated_select_results));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, PopulateUncorrelatedSelectResultsCache) {
+  // PQP that returns the column "a", used by two selects
+  const auto table_wrapper_a = std::make_shared<TableWrapper>(table_a);
+  const auto pqp_a =
+      std::make_shared<Projection>(table_wrapper_a, expression_vector(PQPColumnExpression::from_table(*table_a, "a")));
+  const auto select_a = pqp_select_(pqp_a, DataType::Int, false);
+  const auto other_select_a = pqp_select_(pqp_a, DataType::Int, false);
+
+  // Correlated selects are not cached
+  const auto table_wrapper_b = std::make_shared<TableWrapper>(table_a);
+  const auto mul_b = mul_(correlated_parameter_(ParameterID{0}, a), PQPColumnExpression::from_table(*table_a, "b"));
+  const auto pqp_b = std::make_shared<Projection>(table_wrapper_b, expression_vector(mul_b));
+  const auto select_b = pqp_select_(pqp_b, DataType::Int, false, std::make_pair(ParameterID{0}, ColumnID{0}));
+
+  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(
+      {in_(a, select_a), and_(in_(b, other_select_a), in_(b, select_b))});
+  ASSERT_EQ(uncorrelated_select_results->size(), 1u);
+  EXPECT_EQ(uncorrelated_select_results->count(pqp_a), 1u);
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(b, other_select_a), {1, 1, 1, 0}, uncorrelated_select_results));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, InSelectUncorrelatedWithBrokenPrecalculated) {
   // Make sure the expression evaluator complains if it has been given a list of preevaluated selects but one is missing
   if (!HYRISE_DEBUG) GTEST_SKIP();
@@ -633,6 +680,25 @@ TEST_F(ExpressionEvaluatorToValuesTest, InSelectCorrelated) {
                                        {std::nullopt, std::nullopt, std::nullopt, std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, InSelectCorrelatedWithRepeatedParameters) {
+  // PQP that returns the column "a" added to the current value in "c", which is NULL for rows 1 and 3. The sub-PQP is
+  // executed once for both of them.
+  //
+  // row   list returned from select
+  //  0      (34, 35, 36, 37)
+  //  1      (NULL, NULL, NULL, NULL)
+  //  2      (35, 36, 37, 38)
+  //  3      (NULL, NULL, NULL, NULL)
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
+  const auto add_c = add_(correlated_parameter_(ParameterID{0}, c), PQPColumnExpression::from_table(*table_a, "a"));
+  const auto pqp = std::make_shared<Projection>(table_wrapper, expression_vector(add_c));
+  const auto select = pqp_select_(pqp, DataType::Int, true, std::make_pair(ParameterID{0}, ColumnID{2}));
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(34, select), {1, std::nullopt, 0, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(35, select), {1, std::nullopt, 1, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(38, select), {0, std::nullopt, 1, std::nullopt}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, NotInListLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_())), {std::nullopt}));
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_(), 3)), {std::nullopt}));
@@ -731,6 +797,29 @@ TEST_F(ExpressionEvaluatorToValuesTest, ExtractSeries) {
   EXPECT_TRUE(test_expression<std::string>(table_empty, *extract_(DatetimeComponent::Day, empty_s), {}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, ExtractIntegerDatesAndTimestamps) {
+  // 1992-09-30 as the days since 1970-01-01 and 1998-12-01 13:45:07 as the seconds since 1970-01-01 00:00:00
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Year, 8'308), {1992}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Month, 8'308), {9}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Day, 8'308), {30}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Year, int64_t{912'519'907}), {1998}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Month, int64_t{912'519'907}), {12}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Day, int64_t{912'519'907}), {1}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Hour, int64_t{912'519'907}), {13}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Minute, int64_t{912'519'907}), {45}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Second, int64_t{912'519'907}), {7}));
+
+  // Before 1970: 1969-12-31 23:59:58
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Day, int64_t{-2}), {31}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Second, int64_t{-2}), {58}));
+
+  EXPECT_EQ(extract_(DatetimeComponent::Year, 8'308)->data_type(), DataType::Int);
+  EXPECT_THROW(test_expression<int32_t>(*extract_(DatetimeComponent::Hour, 8'308), {0}), std::logic_error);
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *extract_(DatetimeComponent::Year, a), {1970, 1970, 1970, 1970}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *extract_(DatetimeComponent::Day, a), {2, 3, 4, 5}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, CastLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*cast_(5.5, DataType::Int), {5}));
   EXPECT_TRUE(test_expression<float>(*cast_(5.5, DataType::Float), {5.5f}));
@@ -752,4 +841,38 @@ TEST_F(ExpressionEvaluatorToValuesTest, CastSeries) {
       test_expression<std::string>(table_a, *cast_(c, DataType::String), {"33", std::nullopt, "34", std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, FindCommonSubexpressions) {
+  const auto a_times_b_plus_a = add_(mul_(a, b), a);
+  const auto a_times_b_minus_a = sub_(mul_(a, b), a);
+
+  // Columns are not worth caching
+  const auto common_subexpressions =
+      ExpressionEvaluator::find_common_subexpressions(expression_vector(a_times_b_plus_a, a_times_b_minus_a, a));
+  EXPECT_EQ(*common_subexpressions, ExpressionUnorderedSet({mul_(a, b)}));
+
+  // The arguments of repeated expressions are only evaluated once anyway
+  const auto repeated_subexpressions =
+      ExpressionEvaluator::find_common_subexpressions(expression_vector(a_times_b_plus_a, add_(mul_(a, b), a)));
+  EXPECT_EQ(*repeated_subexpressions, ExpressionUnorderedSet({a_times_b_plus_a}));
+}
+
+TEST_F(ExpressionEvaluatorToValuesTest, CommonSubexpressionsAreEvaluatedOnce) {
+  const auto a_times_b_plus_a = add_(mul_(a, b), a);
+  const auto a_times_b_minus_a = sub_(mul_(a, b), a);
+  const auto common_subexpressions =
+      ExpressionEvaluator::find_common_subexpressions(expression_vector(a_times_b_plus_a, a_times_b_minus_a));
+
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}, nullptr, common_subexpressions};
+  EXPECT_EQ(normalize_expression_result(*evaluator.evaluate_expression_to_result<int32_t>(*a_times_b_plus_a)),
+            std::vector<std::optional<int32_t>>({3, 8, 15, 24}));
+  EXPECT_EQ(normalize_expression_result(*evaluator.evaluate_expression_to_result<int32_t>(*a_times_b_minus_a)),
+            std::vector<std::optional<int32_t>>({1, 4, 9, 16}));
+
+  // Equal expressions share the result computed before
+  const auto first_result = evaluator.evaluate_expression_to_result<int32_t>(*mul_(a, b));
+  EXPECT_EQ(first_result, evaluator.evaluate_expression_to_result<int32_t>(*mul_(a, b)));
+  EXPECT_NE(evaluator.evaluate_expression_to_result<int32_t>(*a_times_b_plus_a),
+            evaluator.evaluate_expression_to_result<int32_t>(*a_times_b_plus_a));
+}
+
 }  // namespace opossum
@@ -54,4 +54,44 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GeneralPattern) {
+  EXPECT_TRUE(match("Hello World", "H_llo%W%_d"));
+  EXPECT_TRUE(match("Hello World", "Hello World"));
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("ab", "_%_"));
+  EXPECT_TRUE(match("abxcabzd!", "%ab_d%"));
+  EXPECT_TRUE(match("abxcabzd", "a%ab_d"));
+  EXPECT_TRUE(match("a\\b.c", "a%\\_.%"));
+
+  EXPECT_FALSE(match("Hello World", "H_llo"));
+  EXPECT_FALSE(match("a", "a%a"));
+  EXPECT_FALSE(match("a", "_%_"));
+  EXPECT_FALSE(match("abxcabzd!", "%ab_e%"));
+  EXPECT_FALSE(match("abzdab", "a%ab_d"));
+  EXPECT_FALSE(match("Hello World", "%World_"));
+}
+
+TEST_F(LikeMatcherTest, Find) {
+  EXPECT_EQ(LikeMatcher::find("Hello", ""), 0u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "", 5), 5u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "", 6), std::string::npos);
+  EXPECT_EQ(LikeMatcher::find("Hello", "o"), 4u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "lo"), 3u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "Hello"), 0u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "Hello!"), std::string::npos);
+  EXPECT_EQ(LikeMatcher::find("Hello", "l", 3), 3u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "l", 4), std::string::npos);
+
+  // Longer strings are searched in blocks of 32 characters. Candidates with matching first and last characters, e.g.,
+  // "needle" and "nee_le", must not end the search.
+  const auto string = std::string(40, 'x') + "neeXle" + std::string(30, 'x') + "needle" + std::string(50, 'x');
+  EXPECT_EQ(LikeMatcher::find(string, "needle"), 76u);
+  EXPECT_EQ(LikeMatcher::find(string, "needle", 76), 76u);
+  EXPECT_EQ(LikeMatcher::find(string, "needle", 77), std::string::npos);
+  EXPECT_EQ(LikeMatcher::find(string, "xn"), 39u);
+  EXPECT_EQ(LikeMatcher::find(string, string), 0u);
+  EXPECT_EQ(LikeMatcher::find(string, "xy"), std::string::npos);
+  EXPECT_EQ(LikeMatcher::find(string + "needle", "needle", 77), string.size());
+}
+
 }  // namespace opossum
@@ -1,3 +1,7 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
@@ -6,7 +10,19 @@
 
 namespace opossum {
 
-class CsvParserTest : public BaseTest {};
+class CsvParserTest : public BaseTest {
+ protected:
+  std::vector<size_t> find_chunk_begins(const std::string_view csv_content, const ChunkOffset chunk_size,
+                                        const size_t block_size) const {
+    return CsvParser{}._find_chunk_begins(csv_content, chunk_size, block_size);
+  }
+
+  std::vector<size_t> find_fields_in_chunk(const std::string_view csv_content, const Table& table) const {
+    auto field_ends = std::vector<size_t>{};
+    CsvParser{}._find_fields_in_chunk(csv_content, table, field_ends);
+    return field_ends;
+  }
+};
 
 TEST_F(CsvParserTest, EmptyTableFromMetaFile) {
   CsvParser parser;
@@ -18,4 +34,50 @@ TEST_F(CsvParserTest, EmptyTableFromMetaFile) {
   EXPECT_TABLE_EQ_UNORDERED(csv_meta_table, expected_table);
 }
 
+TEST_F(CsvParserTest, FindChunkBegins) {
+  // Quoted values may contain delimiters and (escaped) quotes, the last row is not terminated by a delimiter
+  const auto rows = std::vector<std::string>{"1,\"a\nb\"\n", "2,\"c\"\"d\"\n", "3,e\n", "4,\"\n\n\"\n", "5,f"};
+
+  auto csv_content = std::string{};
+  auto row_begins = std::vector<size_t>{};
+  for (const auto& row : rows) {
+    row_begins.emplace_back(csv_content.size());
+    csv_content += row;
+  }
+
+  // The blocks that are searched in parallel begin and end within quoted values, in escaped quotes, and at row ends
+  for (auto block_size = size_t{1}; block_size <= csv_content.size() + 1; ++block_size) {
+    EXPECT_EQ(find_chunk_begins(csv_content, 1, block_size),
+              std::vector<size_t>({0, row_begins[1], row_begins[2], row_begins[3], row_begins[4], csv_content.size()}));
+    EXPECT_EQ(find_chunk_begins(csv_content, 2, block_size),
+              std::vector<size_t>({0, row_begins[2], row_begins[4], csv_content.size()}));
+    EXPECT_EQ(find_chunk_begins(csv_content, 5, block_size), std::vector<size_t>({0, csv_content.size()}));
+    EXPECT_EQ(find_chunk_begins(csv_content, 10, block_size), std::vector<size_t>({0, csv_content.size()}));
+
+    // A delimiter at the end of the file does not begin another chunk
+    EXPECT_EQ(find_chunk_begins(csv_content + "\n", 5, block_size), std::vector<size_t>({0, csv_content.size() + 1}));
+  }
+}
+
+TEST_F(CsvParserTest, FindFieldsWithoutTrailingDelimiter) {
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String}}, TableType::Data);
+
+  EXPECT_EQ(find_fields_in_chunk("1,a\n22,\"b,c\"\n", *table), std::vector<size_t>({1, 3, 6, 12}));
+  EXPECT_EQ(find_fields_in_chunk("1,a\n22,\"b,c\"", *table), std::vector<size_t>({1, 3, 6, 12}));
+}
+
+TEST_F(CsvParserTest, DatesAndTimestamps) {
+  // Dates are stored as the days since 1970-01-01 and timestamps as the seconds since 1970-01-01 00:00:00
+  const auto table = CsvParser{}.parse("resources/test_data/csv/dates.csv");
+
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"d", DataType::Int, false}, {"t", DataType::Long, true}}, TableType::Data);
+  expected_table->append({8'308, int64_t{912'519'907}});
+  expected_table->append({-1, NULL_VALUE});
+  expected_table->append({0, int64_t{0}});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
 }  // namespace opossum
@@ -0,0 +1,117 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/checkpoint.hpp"
+#include "logging/logger.hpp"
+#include "logging/recovery.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    filesystem::create_directories(data_directory);
+  }
+
+  void TearDown() override {
+    if (Logger::get().is_enabled()) Logger::get().disable();
+    filesystem::remove_all(data_directory);
+  }
+
+  std::shared_ptr<const Table> _execute_sql(const std::string& sql,
+                                            const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    return builder.create_pipeline().get_result_table();
+  }
+
+  void _restart() {
+    StorageManager::reset();
+    TransactionManager::reset();
+  }
+
+  const std::string data_directory = test_data_path + "checkpoint_test";
+  const std::string log_file_path = data_directory + "/redo.log";
+};
+
+TEST_F(CheckpointTest, WritesRowsVisibleAtSnapshot) {
+  _execute_sql("DELETE FROM table_a WHERE a = 12345");
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  const auto expected_table = _execute_sql("SELECT * FROM table_a");
+
+  // Neither uncommitted rows nor rows that are deleted later are part of the checkpoint
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  _execute_sql("INSERT INTO table_a VALUES (2, 2.5)", transaction_context);
+
+  const auto checkpoint_commit_id = Checkpoint::write(data_directory);
+  EXPECT_EQ(checkpoint_commit_id, TransactionManager::get().last_commit_id());
+
+  _execute_sql("DELETE FROM table_a WHERE a = 123");
+  transaction_context->rollback();
+
+  _restart();
+  EXPECT_EQ(Checkpoint::load(data_directory), checkpoint_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+
+  // The rows keep their positions, the deleted one is still there, but invisible. The chunk of the uncommitted row
+  // is empty.
+  const auto table = StorageManager::get().get_table("table_a");
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 0u);
+}
+
+TEST_F(CheckpointTest, RecoveryReplaysLogAfterCheckpoint) {
+  Logger::get().enable(log_file_path, Durability::Sync);
+
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  const auto checkpoint_commit_id = Checkpoint::write(data_directory);
+  _execute_sql("DELETE FROM table_a WHERE a = 123");
+  _execute_sql("UPDATE table_a SET b = 2.5 WHERE a = 1");
+  _execute_sql("INSERT INTO table_a VALUES (2, 3.5)");
+
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+  const auto expected_table = _execute_sql("SELECT * FROM table_a");
+  Logger::get().disable();
+
+  _restart();
+  EXPECT_EQ(Checkpoint::load(data_directory), checkpoint_commit_id);
+  EXPECT_EQ(Recovery::recover(log_file_path, checkpoint_commit_id), 3u);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(CheckpointTest, ReplacesPreviousCheckpoint) {
+  const auto first_commit_id = Checkpoint::write(data_directory);
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  const auto second_commit_id = Checkpoint::write(data_directory);
+  EXPECT_GT(second_commit_id, first_commit_id);
+  EXPECT_FALSE(filesystem::exists(data_directory + "/" + std::to_string(first_commit_id)));
+
+  // Nothing was committed in between, so the checkpoint is kept
+  EXPECT_EQ(Checkpoint::write(data_directory), second_commit_id);
+
+  _restart();
+  EXPECT_EQ(Checkpoint::load(data_directory), second_commit_id);
+  EXPECT_EQ(Recovery::recover(log_file_path, second_commit_id), 0u);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), second_commit_id);
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a")->row_count(), 4u);
+}
+
+TEST_F(CheckpointTest, LoadWithoutCheckpoint) {
+  _restart();
+  EXPECT_FALSE(Checkpoint::load(data_directory));
+}
+
+}  // namespace opossum
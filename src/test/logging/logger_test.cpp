@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "logging/log_record.hpp"
+#include "logging/logger.hpp"
+#include "logging/recovery.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class LoggerTest : public BaseTest {
+ protected:
+  void SetUp() override { _load_snapshot(); }
+
+  void TearDown() override {
+    if (Logger::get().is_enabled()) Logger::get().disable();
+    std::remove(log_file_path.c_str());
+  }
+
+  // Stands in for the binary snapshot that the database is started from
+  void _load_snapshot() {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  std::shared_ptr<const Table> _execute_sql(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  const std::string log_file_path = test_data_path + "logger_test.log";
+};
+
+TEST_F(LoggerTest, LogRecordRoundTrip) {
+  auto log_record = LogRecord{};
+  log_record.transaction_id = TransactionID{7};
+  log_record.commit_id = CommitID{42};
+  auto& changes = log_record.table_changes["table_a"];
+  changes.inserted_row_ids = {RowID{ChunkID{1}, ChunkOffset{2}}};
+  changes.inserted_rows = {{AllTypeVariant{int32_t{5}}, NULL_VALUE, AllTypeVariant{std::string{"five"}}}};
+  changes.deleted_row_ids = {RowID{ChunkID{0}, ChunkOffset{3}}};
+
+  auto buffer = std::vector<char>{};
+  log_record.serialize(buffer);
+
+  auto stream = std::stringstream{std::string{buffer.begin(), buffer.end()}};
+  const auto deserialized_log_record = LogRecord::deserialize(stream);
+  ASSERT_TRUE(deserialized_log_record);
+  EXPECT_EQ(deserialized_log_record->transaction_id, TransactionID{7});
+  EXPECT_EQ(deserialized_log_record->commit_id, CommitID{42});
+
+  const auto& deserialized_changes = deserialized_log_record->table_changes.at("table_a");
+  EXPECT_EQ(deserialized_changes.inserted_row_ids, changes.inserted_row_ids);
+  ASSERT_EQ(deserialized_changes.inserted_rows.size(), 1u);
+  EXPECT_EQ(deserialized_changes.inserted_rows[0][0], AllTypeVariant{int32_t{5}});
+  EXPECT_TRUE(variant_is_null(deserialized_changes.inserted_rows[0][1]));
+  EXPECT_EQ(deserialized_changes.inserted_rows[0][2], AllTypeVariant{std::string{"five"}});
+  EXPECT_EQ(deserialized_changes.deleted_row_ids, changes.deleted_row_ids);
+
+  EXPECT_FALSE(LogRecord::deserialize(stream));
+
+  // A record that was only partially written is not read
+  auto torn_stream = std::stringstream{std::string{buffer.begin(), buffer.end() - 1}};
+  EXPECT_FALSE(LogRecord::deserialize(torn_stream));
+}
+
+TEST_F(LoggerTest, RecoversCommittedWrites) {
+  Logger::get().enable(log_file_path, Durability::Sync);
+
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  _execute_sql("DELETE FROM table_a WHERE a = 123");
+  _execute_sql("UPDATE table_a SET b = 2.5 WHERE a = 1234");
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  // Read-only transactions do not write to the log
+  const auto expected_table = _execute_sql("SELECT * FROM table_a");
+
+  Logger::get().disable();
+
+  // Restart
+  StorageManager::reset();
+  TransactionManager::reset();
+  _load_snapshot();
+
+  EXPECT_EQ(Recovery::recover(log_file_path), 3u);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(LoggerTest, RecoveryDropsTornRecord) {
+  Logger::get().enable(log_file_path, Durability::Async);
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  Logger::get().disable();
+
+  const auto log_file_size = filesystem::file_size(log_file_path);
+  {
+    auto log_file = std::ofstream{log_file_path, std::ios::binary | std::ios::app};
+    log_file << "torn";
+  }
+
+  StorageManager::reset();
+  TransactionManager::reset();
+  _load_snapshot();
+
+  EXPECT_EQ(Recovery::recover(log_file_path), 1u);
+  EXPECT_EQ(filesystem::file_size(log_file_path), log_file_size);
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a WHERE a = 1")->row_count(), 1u);
+}
+
+TEST_F(LoggerTest, RecoveryWithoutLogFile) { EXPECT_EQ(Recovery::recover(log_file_path), 0u); }
+
+}  // namespace opossum
@@ -0,0 +1,147 @@
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "logging/log_record.hpp"
+#include "logging/log_shipper.hpp"
+#include "logging/logger.hpp"
+#include "logging/replica.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ReplicationTest : public BaseTest {
+ protected:
+  void SetUp() override { _load_snapshot(); }
+
+  void TearDown() override {
+    if (Replica::get().is_running()) Replica::get().stop();
+    if (LogShipper::get().is_running()) LogShipper::get().stop();
+    if (Logger::get().is_enabled()) Logger::get().disable();
+    std::remove(log_file_path.c_str());
+  }
+
+  void _load_snapshot() {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  std::shared_ptr<const Table> _execute_sql(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  // Reads the next message of a LogShipper and returns its shipped commit id, with the records that it holds
+  static CommitID _receive_message(boost::asio::ip::tcp::socket& socket, std::vector<LogRecord>& records) {
+    auto header = LogShippingHeader{};
+    boost::asio::read(socket, boost::asio::buffer(&header, sizeof(LogShippingHeader)));
+    auto serialized_records = std::string(header.records_size, '\0');
+    boost::asio::read(socket, boost::asio::buffer(&serialized_records[0], serialized_records.size()));
+
+    auto stream = std::stringstream{serialized_records};
+    while (auto record = LogRecord::deserialize(stream)) {
+      records.emplace_back(std::move(*record));
+    }
+    return static_cast<CommitID>(header.shipped_commit_id);
+  }
+
+  const std::string log_file_path = test_data_path + "replication_test.log";
+};
+
+TEST_F(ReplicationTest, ShipsLogToReplicas) {
+  Logger::get().enable(log_file_path, Durability::Sync);
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  const auto first_commit_id = TransactionManager::get().last_commit_id();
+
+  LogShipper::get().start();
+
+  auto io_service = boost::asio::io_service{};
+  auto socket = boost::asio::ip::tcp::socket{io_service};
+  socket.connect({boost::asio::ip::address_v4::loopback(), LogShipper::get().port()});
+
+  // A new replica receives what was flushed before it connected
+  auto records = std::vector<LogRecord>{};
+  EXPECT_EQ(_receive_message(socket, records), first_commit_id);
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0].commit_id, first_commit_id);
+  EXPECT_EQ(records[0].table_changes.at("table_a").inserted_rows.size(), 1u);
+
+  // And then the records that are flushed afterwards
+  _execute_sql("DELETE FROM table_a WHERE a = 123");
+  const auto second_commit_id = TransactionManager::get().last_commit_id();
+  records.clear();
+  while (_receive_message(socket, records) < second_commit_id) {
+  }
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0].commit_id, second_commit_id);
+  EXPECT_EQ(records[0].table_changes.at("table_a").deleted_row_ids.size(), 1u);
+  EXPECT_EQ(LogShipper::get().replica_count(), 1u);
+}
+
+TEST_F(ReplicationTest, ReplicaAppliesLogOfPrimary) {
+  // The primary writes a log, which a stand-in for its LogShipper sends to the replica
+  Logger::get().enable(log_file_path, Durability::Sync);
+  _execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  _execute_sql("DELETE FROM table_a WHERE a = 123");
+  _execute_sql("UPDATE table_a SET b = 2.5 WHERE a = 1234");
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+  const auto expected_table = _execute_sql("SELECT * FROM table_a");
+  Logger::get().disable();
+
+  auto log_file = std::ifstream{log_file_path, std::ios::binary};
+  const auto log = std::vector<char>{std::istreambuf_iterator<char>{log_file}, std::istreambuf_iterator<char>{}};
+
+  // The replica starts from the snapshot of the primary
+  StorageManager::reset();
+  TransactionManager::reset();
+  _load_snapshot();
+
+  auto io_service = boost::asio::io_service{};
+  auto acceptor = boost::asio::ip::tcp::acceptor{io_service, {boost::asio::ip::address_v4::loopback(), 0}};
+  Replica::get().start("127.0.0.1", acceptor.local_endpoint().port());
+  auto socket = boost::asio::ip::tcp::socket{io_service};
+  acceptor.accept(socket);
+
+  // Without the shipped commit id, the records are not applied
+  const auto header = LogShippingHeader{last_commit_id - 1, log.size()};
+  boost::asio::write(socket, boost::asio::buffer(&header, sizeof(LogShippingHeader)));
+  boost::asio::write(socket, boost::asio::buffer(log));
+  EXPECT_TRUE(Replica::get().wait_for_commit_id(last_commit_id - 1));
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id - 1);
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a WHERE a = 1")->row_count(), 1u);
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a WHERE a = 123")->row_count(), 0u);
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a WHERE b = 2.5")->row_count(), 0u);
+
+  // The records are sent again while the replica connects, it skips those that it applied already
+  const auto last_header = LogShippingHeader{last_commit_id, log.size()};
+  boost::asio::write(socket, boost::asio::buffer(&last_header, sizeof(LogShippingHeader)));
+  boost::asio::write(socket, boost::asio::buffer(log));
+  EXPECT_TRUE(Replica::get().wait_for_commit_id(last_commit_id));
+  EXPECT_EQ(Replica::get().applied_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+
+  // Replicas are read-only
+  EXPECT_THROW(_execute_sql("INSERT INTO table_a VALUES (2, 2.5)"), std::logic_error);
+
+  // The replica keeps its snapshot if the primary goes away
+  socket.close();
+  EXPECT_FALSE(Replica::get().wait_for_commit_id(last_commit_id + 1));
+  EXPECT_FALSE(Replica::get().is_connected());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+}
+
+}  // namespace opossum
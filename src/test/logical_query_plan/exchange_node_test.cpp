@@ -0,0 +1,57 @@
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/exchange_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ExchangeNodeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    _mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}}, "t");
+    _a = _mock_node->get_column("a");
+    _b = _mock_node->get_column("b");
+
+    _exchange_node = ExchangeNode::make(lqp_column_(_a), PartitionID{4});
+    _exchange_node->set_left_input(_mock_node);
+  }
+
+  std::shared_ptr<MockNode> _mock_node;
+  LQPColumnReference _a, _b;
+  std::shared_ptr<ExchangeNode> _exchange_node;
+};
+
+TEST_F(ExchangeNodeTest, Description) { EXPECT_EQ(_exchange_node->description(), "[Exchange] Hash(a) 4 partitions"); }
+
+TEST_F(ExchangeNodeTest, Equals) {
+  EXPECT_EQ(*_exchange_node, *_exchange_node);
+
+  const auto other_column_exchange_node = ExchangeNode::make(lqp_column_(_b), PartitionID{4});
+  other_column_exchange_node->set_left_input(_mock_node);
+  EXPECT_NE(*other_column_exchange_node, *_exchange_node);
+
+  const auto other_count_exchange_node = ExchangeNode::make(lqp_column_(_a), PartitionID{8});
+  other_count_exchange_node->set_left_input(_mock_node);
+  EXPECT_NE(*other_count_exchange_node, *_exchange_node);
+}
+
+TEST_F(ExchangeNodeTest, Copy) { EXPECT_EQ(*_exchange_node->deep_copy(), *_exchange_node); }
+
+TEST_F(ExchangeNodeTest, NodeExpressions) {
+  ASSERT_EQ(_exchange_node->node_expressions.size(), 1u);
+  EXPECT_EQ(*_exchange_node->node_expressions.at(0u), *lqp_column_(_a));
+}
+
+TEST_F(ExchangeNodeTest, ForwardsColumns) {
+  EXPECT_EQ(_exchange_node->column_expressions().size(), 2u);
+  EXPECT_EQ(_exchange_node->get_column_id(*lqp_column_(_b)), ColumnID{1});
+}
+
+}  // namespace opossum
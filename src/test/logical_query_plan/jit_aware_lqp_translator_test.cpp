@@ -2,6 +2,7 @@
 
 #include "base_test.hpp"
 #include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/jit_aware_lqp_translator.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
@@ -12,6 +13,7 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
@@ -156,8 +158,9 @@ TEST_F(JitAwareLQPTranslatorTest, InputColumnsAreAddedToJitReadTupleAdapter) {
 
 TEST_F(JitAwareLQPTranslatorTest, LiteralValuesAreAddedToJitReadTupleAdapter) {
   // The query contains two literals. Literals are treated like values read from a column inside the operator pipeline.
-  // The JitReadTuples adapter is responsible for making these literals available from within the pipeline.
-  const auto jit_operator_wrapper = translate_query("SELECT a, b FROM table_b WHERE a > 1 AND b > 1.2");
+  // The JitReadTuples adapter is responsible for making these literals available from within the pipeline. Both
+  // literals are compared with columns of another data type, so the comparisons are not evaluated as input predicates.
+  const auto jit_operator_wrapper = translate_query("SELECT a, b FROM table_b WHERE b > 1 AND a > 1.2");
   ASSERT_TRUE(jit_operator_wrapper);
   const auto jit_operators = jit_operator_wrapper->jit_operators();
   ASSERT_EQ(jit_operators.size(), 5u);
@@ -179,6 +182,44 @@ TEST_F(JitAwareLQPTranslatorTest, LiteralValuesAreAddedToJitReadTupleAdapter) {
   ASSERT_EQ(input_literals[1].tuple_value.is_nullable(), false);
 }
 
+TEST_F(JitAwareLQPTranslatorTest, ColumnVsLiteralComparisonsAreAddedAsInputPredicates) {
+  // Comparisons of a column with a literal of the same data type are evaluated by the JitReadTuples adapter, so that
+  // predicates on dictionary segments are evaluated on the ValueIDs
+  const auto jit_operator_wrapper = translate_query("SELECT b FROM table_a WHERE a > 1 AND 2 <= c");
+  ASSERT_TRUE(jit_operator_wrapper);
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 5u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_compute = std::dynamic_pointer_cast<JitCompute>(jit_operators[2]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_compute, nullptr);
+
+  // Neither the compared columns nor the literals are read
+  const auto input_columns = jit_read_tuples->input_columns();
+  ASSERT_EQ(input_columns.size(), 1u);
+  ASSERT_EQ(input_columns[0].column_id, ColumnID{1});
+  ASSERT_TRUE(jit_read_tuples->input_literals().empty());
+
+  const auto input_predicates = jit_read_tuples->input_predicates();
+  ASSERT_EQ(input_predicates.size(), 2u);
+
+  ASSERT_EQ(input_predicates[0].column_id, ColumnID{0});
+  ASSERT_EQ(input_predicates[0].predicate_condition, PredicateCondition::GreaterThan);
+  ASSERT_EQ(input_predicates[0].value, AllTypeVariant(1));
+
+  // The comparison is flipped, so that the column is on the left side
+  ASSERT_EQ(input_predicates[1].column_id, ColumnID{2});
+  ASSERT_EQ(input_predicates[1].predicate_condition, PredicateCondition::GreaterThanEquals);
+  ASSERT_EQ(input_predicates[1].value, AllTypeVariant(2));
+
+  // The filter condition combines the results of both predicates
+  const auto expression = jit_compute->expression();
+  ASSERT_EQ(expression->expression_type(), JitExpressionType::And);
+  ASSERT_EQ(expression->left_child()->result(), input_predicates[0].tuple_value);
+  ASSERT_EQ(expression->right_child()->result(), input_predicates[1].tuple_value);
+}
+
 TEST_F(JitAwareLQPTranslatorTest, ColumnSubsetIsOutputCorrectly) {
   // Select a subset of columns
   const auto jit_operator_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1");
@@ -524,4 +565,67 @@ TEST_F(JitAwareLQPTranslatorTest, AggregateOperator) {
   ASSERT_EQ(jit_read_tuples->find_input_column(aggregate_columns[4].tuple_value), ColumnID{1});
 }
 
+TEST_F(JitAwareLQPTranslatorTest, InnerEquiJoinIsProbedWithinTheOperatorChain) {
+  const auto b_a = stored_table_node_b->get_column("a");
+  const auto b_b = stored_table_node_b->get_column("b");
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a_b, b_b),
+    PredicateNode::make(greater_than_(a_c, 1),
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        stored_table_node_a,
+        stored_table_node_b)));
+  // clang-format on
+
+  const auto jit_operator_wrapper = translate_lqp(lqp);
+  ASSERT_NE(jit_operator_wrapper, nullptr);
+
+  // The probe side is the input of the operator chain, while the build side is hashed by the JitHashJoinProbe
+  ASSERT_NE(jit_operator_wrapper->input_right(), nullptr);
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 5u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_hash_join_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operators[1]);
+  const auto jit_filter = std::dynamic_pointer_cast<JitFilter>(jit_operators[3]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[4]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_hash_join_probe, nullptr);
+  ASSERT_NE(jit_filter, nullptr);
+  ASSERT_NE(jit_write_tuples, nullptr);
+
+  ASSERT_EQ(jit_read_tuples->find_input_column(jit_hash_join_probe->probe_value()), ColumnID{0});
+  ASSERT_EQ(jit_hash_join_probe->build_column_id(), ColumnID{0});
+
+  // The build columns used by the filter and the output are copied once each
+  const auto build_columns = jit_hash_join_probe->build_columns();
+  ASSERT_EQ(build_columns.size(), 2u);
+  ASSERT_EQ(build_columns[0].column_id, ColumnID{2});
+  ASSERT_EQ(build_columns[1].column_id, ColumnID{1});
+
+  const auto output_columns = jit_write_tuples->output_columns();
+  ASSERT_EQ(output_columns.size(), 2u);
+  ASSERT_EQ(output_columns[0].tuple_value, build_columns[1].tuple_value);
+  ASSERT_EQ(jit_read_tuples->find_input_column(output_columns[1].tuple_value), ColumnID{1});
+}
+
+TEST_F(JitAwareLQPTranslatorTest, OuterJoinsAreNotJitted) {
+  const auto b_a = stored_table_node_b->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a_b),
+    PredicateNode::make(greater_than_(a_c, 1),
+      JoinNode::make(JoinMode::Left, equals_(a_a, b_a),
+        stored_table_node_a,
+        stored_table_node_b)));
+  // clang-format on
+
+  const auto jit_operator_wrapper = translate_lqp(lqp);
+  ASSERT_NE(jit_operator_wrapper, nullptr);
+  ASSERT_EQ(jit_operator_wrapper->input_right(), nullptr);
+  ASSERT_EQ(std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operator_wrapper->jit_operators()[1]), nullptr);
+}
+
 }  // namespace opossum
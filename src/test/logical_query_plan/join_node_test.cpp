@@ -10,7 +10,11 @@
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -112,4 +116,45 @@ TEST_F(JoinNodeTest, NodeExpressions) {
   ASSERT_EQ(_join_node->node_expressions.size(), 0u);
 }
 
+class JoinNodeStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The statistics claim that all values are the same, so that the estimation of the joins is far off
+    const auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+        std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1.0f, 1, 1)};
+
+    const auto table_a = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data,
+                                                 std::nullopt, UseMvcc::Yes);
+    for (auto value = 1; value <= 4; ++value) table_a->append({value});
+    StorageManager::get().add_table("table_a", table_a);
+    table_a->set_table_statistics(std::make_shared<TableStatistics>(TableType::Data, 4.0f, column_statistics));
+
+    const auto table_b = std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int}}, TableType::Data,
+                                                 std::nullopt, UseMvcc::Yes);
+    for (auto value = 1; value <= 4; ++value) table_b->append({value});
+    table_b->add_unique_constraint(TableConstraintDefinition{{ColumnID{0}}, IsPrimaryKey::Yes});
+    StorageManager::get().add_table("table_b", table_b);
+    table_b->set_table_statistics(std::make_shared<TableStatistics>(TableType::Data, 4.0f, column_statistics));
+
+    _node_a = StoredTableNode::make("table_a");
+    _node_b = StoredTableNode::make("table_b");
+  }
+
+  std::shared_ptr<StoredTableNode> _node_a, _node_b;
+};
+
+TEST_F(JoinNodeStatisticsTest, UniqueColumnCapsEstimation) {
+  const auto a = _node_a->get_column("a");
+  const auto b = _node_b->get_column("b");
+
+  // Each row of table_a has at most one join partner in table_b
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(a, b), ValidateNode::make(_node_a), ValidateNode::make(_node_b));
+  EXPECT_FLOAT_EQ(join_node->get_statistics()->row_count(), 4.0f);
+
+  // Without the Validate, b is not known to be unique
+  const auto unvalidated_join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), _node_a, _node_b);
+  EXPECT_GT(unvalidated_join_node->get_statistics()->row_count(), 4.0f);
+}
+
 }  // namespace opossum
@@ -323,6 +323,25 @@ TEST_F(LogicalQueryPlanTest, DeepCopyBasics) {
   EXPECT_EQ(copied_expression_b->column_reference.original_node(), copied_node_int_int);
 }
 
+TEST_F(LogicalQueryPlanTest, Hash) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a1, 5),
+    JoinNode::make(JoinMode::Inner, equals_(a1, a2),
+      node_int_int,
+      node_int_int_int));
+  // clang-format on
+
+  // Equal LQPs have equal hashes, even though their columns stem from different nodes
+  const auto copied_lqp = lqp->deep_copy();
+  EXPECT_NE(copied_lqp->left_input()->left_input(), node_int_int);
+  EXPECT_EQ(copied_lqp->hash(), lqp->hash());
+
+  EXPECT_NE(PredicateNode::make(greater_than_(a1, 6), lqp->left_input())->hash(), lqp->hash());
+  EXPECT_NE(PredicateNode::make(less_than_(a1, 5), lqp->left_input())->hash(), lqp->hash());
+  EXPECT_NE(lqp->left_input()->hash(), lqp->hash());
+}
+
 TEST_F(LogicalQueryPlanTest, PrintWithoutSubselects) {
   // clang-format off
   const auto lqp =
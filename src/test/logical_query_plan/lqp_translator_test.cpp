@@ -5,10 +5,12 @@
 #include <vector>
 
 #include "base_test.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
@@ -27,10 +29,16 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/update_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_ie.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -38,11 +46,18 @@
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
+#include "operators/multi_column_sort.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/update.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -180,6 +195,57 @@ TEST_F(LQPTranslatorTest, PredicateNodeSimpleBinary) {
   EXPECT_EQ(get_table_op->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeChain) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float WHERE a > 5 AND b < 3.0 AND a <> 7;
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(not_equals_(int_float_a, 7),
+    PredicateNode::make(less_than_(int_float_b, 3.0),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP: A single TableScan, the predicate at the bottom of the chain comes first
+   */
+  const auto table_scan_op = std::dynamic_pointer_cast<TableScan>(pqp);
+  const auto a = PQPColumnExpression::from_table(*table_int_float, ColumnID{0});
+  const auto b = PQPColumnExpression::from_table(*table_int_float, ColumnID{1});
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(*table_scan_op->predicate(), *and_(and_(greater_than_(a, 5), less_than_(b, 3.0)), not_equals_(a, 7)));
+
+  const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(pqp->input_left());
+  ASSERT_TRUE(get_table_op);
+  EXPECT_EQ(get_table_op->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeChainWithSharedPredicateNode) {
+  // The result of predicate_node_b is used by the UnionNode as well, so it has to be scanned on its own
+  const auto predicate_node_b = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+  const auto predicate_node_a = PredicateNode::make(less_than_(int_float_b, 3.0), predicate_node_b);
+  const auto lqp = UnionNode::make(UnionMode::Positions, predicate_node_a, predicate_node_b);
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto a = PQPColumnExpression::from_table(*table_int_float, ColumnID{0});
+  const auto b = PQPColumnExpression::from_table(*table_int_float, ColumnID{1});
+
+  const auto table_scan_a = std::dynamic_pointer_cast<const TableScan>(pqp->input_left());
+  ASSERT_TRUE(table_scan_a);
+  EXPECT_EQ(*table_scan_a->predicate(), *less_than_(b, 3.0));
+
+  const auto table_scan_b = std::dynamic_pointer_cast<const TableScan>(pqp->input_right());
+  ASSERT_TRUE(table_scan_b);
+  EXPECT_EQ(*table_scan_b->predicate(), *greater_than_(a, 5));
+  EXPECT_EQ(table_scan_a->input_left(), table_scan_b);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeLike) {
   /**
    * Build LQP and translate to PQP
@@ -326,22 +392,12 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
+  const auto sort = std::dynamic_pointer_cast<const MultiColumnSort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  EXPECT_EQ(sort->column_ids(), std::vector<ColumnID>({ColumnID{1}, ColumnID{0}, ColumnID{2}}));
+  EXPECT_EQ(sort->order_by_modes(), order_by_modes);
 
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
-
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
@@ -380,6 +436,99 @@ TEST_F(LQPTranslatorTest, JoinNonEqui) {
   EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, JoinTwoInequalities) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float2, int_float WHERE int_float.a < int_float2.a AND int_float2.b <= int_float.b
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(less_than_equals_(int_float2_b, int_float_b),
+    JoinNode::make(JoinMode::Inner, less_than_(int_float_a, int_float2_a),
+      int_float2_node, int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto join_ie = std::dynamic_pointer_cast<JoinIE>(pqp);
+  ASSERT_TRUE(join_ie);
+  EXPECT_EQ(join_ie->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_ie->predicate_condition(), PredicateCondition::GreaterThan);
+  EXPECT_EQ(join_ie->secondary_column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_ie->secondary_predicate_condition(), PredicateCondition::LessThanEquals);
+
+  const auto get_table_int_float2 = std::dynamic_pointer_cast<const GetTable>(join_ie->input_left());
+  ASSERT_TRUE(get_table_int_float2);
+  EXPECT_EQ(get_table_int_float2->table_name(), "table_int_float2");
+
+  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_ie->input_right());
+  ASSERT_TRUE(get_table_int_float);
+  EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, JoinInequalityAndEquality) {
+  // A JoinIE is only used for two inequalities
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(int_float2_b, int_float_b),
+    JoinNode::make(JoinMode::Inner, less_than_(int_float_a, int_float2_a),
+      int_float2_node, int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto table_scan = std::dynamic_pointer_cast<TableScan>(pqp);
+  ASSERT_TRUE(table_scan);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinSortMerge>(table_scan->input_left()));
+}
+
+TEST_F(LQPTranslatorTest, JoinTwoEqualities) {
+  /**
+   * LQP resembles:
+   *   SELECT * FROM int_float, int_float2 WHERE int_float.a = int_float2.a AND int_float2.b = int_float.b
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(int_float2_b, int_float_b),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      int_float_node, int_float2_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto join_hash = std::dynamic_pointer_cast<JoinHash>(pqp);
+  ASSERT_TRUE(join_hash);
+  EXPECT_EQ(join_hash->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_hash->secondary_column_ids(), std::vector<ColumnIDPair>{ColumnIDPair(ColumnID{1}, ColumnID{1})});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_hash->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_hash->input_right()));
+
+  // Other predicates above the join are still scanned
+  // clang-format off
+  const auto lqp_with_scan =
+  PredicateNode::make(greater_than_(int_float_a, 5),
+    PredicateNode::make(equals_(int_float2_b, int_float_b),
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+        int_float_node, int_float2_node)));
+  // clang-format on
+  const auto table_scan = std::dynamic_pointer_cast<TableScan>(LQPTranslator{}.translate_node(lqp_with_scan));
+  ASSERT_TRUE(table_scan);
+  const auto scanned_join_hash = std::dynamic_pointer_cast<const JoinHash>(table_scan->input_left());
+  ASSERT_TRUE(scanned_join_hash);
+  EXPECT_EQ(scanned_join_hash->secondary_column_ids().size(), 1u);
+
+  // Columns of different types are not combined into one key
+  // clang-format off
+  const auto mixed_type_lqp =
+  PredicateNode::make(equals_(int_float2_b, int_float_a),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_b, int_float2_a),
+      int_float_node, int_float2_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<TableScan>(LQPTranslator{}.translate_node(mixed_type_lqp)));
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -563,6 +712,154 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeAdaptive) {
+  const auto translator = LQPTranslator{std::make_shared<CostModelPhysical>(), true};
+
+  // The sizes of stored tables are known, so that the join is chosen by the LQPTranslator
+  const auto stored_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(translator.translate_node(stored_join_node)));
+
+  // clang-format off
+  const auto join_node =
+  JoinNode::make(JoinMode::Left, equals_(int_float_a, int_float2_a),
+    PredicateNode::make(greater_than_(int_float_a, 5),
+      int_float_node),
+    int_float2_node);
+  // clang-format on
+  const auto join_op = std::dynamic_pointer_cast<JoinAdaptive>(translator.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->mode(), JoinMode::Left);
+
+  // Without the option, the adaptive join is not used
+  EXPECT_FALSE(std::dynamic_pointer_cast<JoinAdaptive>(LQPTranslator{}.translate_node(join_node)));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeNUMAAware) {
+  Topology::use_fake_numa_topology(8, 4);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node,
+                                        int_float2_node);
+
+  // The inputs are too small to benefit from the NUMA-aware join
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  const auto large_row_count = LQPTranslator::NUMA_AWARE_JOIN_MIN_ROW_COUNT * 2;
+  for (const auto& table : {table_int_float, table_int_float2}) {
+    table->set_table_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, large_row_count, table->table_statistics()->column_statistics()));
+  }
+
+  const auto join_op = std::dynamic_pointer_cast<JoinMPSM>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+
+  // JoinMPSM requires both join columns to have the same type
+  const auto mixed_type_join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_b, int_float2_a),
+                                                   int_float_node, int_float2_node);
+  EXPECT_FALSE(std::dynamic_pointer_cast<JoinMPSM>(LQPTranslator{}.translate_node(mixed_type_join_node)));
+
+  // Without multiple NUMA nodes, there is nothing to gain
+  Topology::use_non_numa_topology();
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+
+  Topology::use_default_topology();
+}
+
+TEST_F(LQPTranslatorTest, SemiAntiJoinWithSmallRightInputIsTableScan) {
+  for (const auto join_mode : {JoinMode::Semi, JoinMode::Anti}) {
+    const auto join_node =
+        JoinNode::make(join_mode, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node);
+    const auto op = LQPTranslator{}.translate_node(join_node);
+
+    const auto table_scan = std::dynamic_pointer_cast<TableScan>(op);
+    ASSERT_TRUE(table_scan);
+    const auto in_expression = std::dynamic_pointer_cast<InExpression>(table_scan->predicate());
+    ASSERT_TRUE(in_expression);
+    EXPECT_EQ(in_expression->is_negated(), join_mode == JoinMode::Anti);
+
+    const auto tasks = OperatorTask::make_tasks_from_operator(op, CleanupTemporaries::No);
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+    const auto left_table = std::make_shared<GetTable>("table_int_float");
+    const auto right_table = std::make_shared<GetTable>("table_int_float2");
+    left_table->execute();
+    right_table->execute();
+    const auto join_hash = std::make_shared<JoinHash>(
+        left_table, right_table, join_mode, ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    join_hash->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(op->get_output(), join_hash->get_output());
+  }
+}
+
+TEST_F(LQPTranslatorTest, SemiAntiJoinNotTranslatableToTableScan) {
+  StorageManager::get().add_table("table_int_float_with_null",
+                                  load_table("resources/test_data/tbl/int_float_with_null.tbl"));
+  const auto int_float_with_null_node = StoredTableNode::make("table_int_float_with_null");
+  const auto int_float_with_null_a = int_float_with_null_node->get_column("a");
+
+  // The data types of the join columns differ
+  const auto mixed_type_join_node =
+      JoinNode::make(JoinMode::Semi, equals_(int_float_b, int_float2_a), int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(mixed_type_join_node)));
+
+  // NOT IN and anti joins treat NULLs in the right input differently
+  const auto nullable_anti_join_node = JoinNode::make(JoinMode::Anti, equals_(int_float_a, int_float_with_null_a),
+                                                      int_float_node, int_float_with_null_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(nullable_anti_join_node)));
+  const auto nullable_semi_join_node = JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float_with_null_a),
+                                                      int_float_node, int_float_with_null_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<TableScan>(LQPTranslator{}.translate_node(nullable_semi_join_node)));
+
+  // The right input is too large
+  table_int_float2->set_table_statistics(
+      std::make_shared<TableStatistics>(TableType::Data, LQPTranslator::SEMI_JOIN_SCAN_MAX_ROW_COUNT * 2,
+                                        table_int_float2->table_statistics()->column_statistics()));
+  const auto large_join_node =
+      JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(large_join_node)));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeCostBased) {
+  ChunkEncoder::encode_all_chunks(table_int_float2);
+  table_int_float2->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  table_int_float2->set_table_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 1'000'000.0f, table_int_float2->table_statistics()->column_statistics()));
+
+  // Looking up the few rows of the left input in the index is cheaper than hashing the large right input
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node,
+                                        int_float2_node);
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+
+  // The translator follows the coefficients of its cost model
+  auto coefficients = PhysicalCostCoefficients{};
+  coefficients.join_index.setup = 1'000'000'000.0f;
+  const auto cost_model = std::make_shared<CostModelPhysical>(coefficients);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{cost_model}.translate_node(join_node)));
+
+  // There is no index on the right column b
+  const auto unindexed_join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_b, int_float2_b),
+                                                  int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(unindexed_join_node)));
+
+  // Only stored tables are indexed
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float2_b, 0), int_float2_node);
+  const auto intermediate_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node, predicate_node);
+  EXPECT_FALSE(std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(intermediate_join_node)));
+
+  // Neither JoinHash nor JoinSortMerge support outer not-equals joins
+  const auto not_equals_join_node = JoinNode::make(JoinMode::Outer, not_equals_(int_float_b, int_float2_b),
+                                                   int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinNestedLoop>(LQPTranslator{}.translate_node(not_equals_join_node)));
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
@@ -676,6 +973,50 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, SortUnderLimitIsTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC LIMIT 3
+   */
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(static_cast<int64_t>(3)),
+    SortNode::make(expression_vector(int_float_b), std::vector<OrderByMode>{OrderByMode::Descending},
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(top_k->column_id(), ColumnID{1});
+  EXPECT_EQ(top_k->order_by_mode(), OrderByMode::Descending);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(static_cast<int64_t>(3)));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->input_left());
+  ASSERT_TRUE(get_table);
+  EXPECT_EQ(get_table->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, SortByMultipleColumnsUnderLimitIsNotTopK) {
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(static_cast<int64_t>(3)),
+    SortNode::make(expression_vector(int_float_a, int_float_b),
+                   std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Descending},
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto limit = std::dynamic_pointer_cast<Limit>(pqp);
+  ASSERT_TRUE(limit);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const MultiColumnSort>(limit->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
@@ -724,6 +1065,35 @@ TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   EXPECT_EQ(pqp->input_left()->input_left()->input_left(), pqp->input_right()->input_left()->input_left());
 }
 
+TEST_F(LQPTranslatorTest, ShareEqualSubplans) {
+  // The two inputs of the join are different nodes, but equal subplans, so that they are executed once
+  const auto int_float_node_b = StoredTableNode::make("table_int_float");
+  const auto int_float_b_a = int_float_node_b->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float_b_a),
+    PredicateNode::make(greater_than_(int_float_a, 5), int_float_node),
+    PredicateNode::make(greater_than_(int_float_b_a, 5), int_float_node_b));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  ASSERT_NE(pqp->input_left(), nullptr);
+  EXPECT_EQ(pqp->input_left(), pqp->input_right());
+
+  // Subplans that differ are not shared, but their equal inputs are
+  // clang-format off
+  const auto other_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float_b_a),
+    PredicateNode::make(greater_than_(int_float_a, 5), int_float_node),
+    PredicateNode::make(greater_than_(int_float_b_a, 6), int_float_node_b));
+  // clang-format on
+
+  const auto other_pqp = LQPTranslator{}.translate_node(other_lqp);
+  EXPECT_NE(other_pqp->input_left(), other_pqp->input_right());
+  EXPECT_EQ(other_pqp->input_left()->input_left(), other_pqp->input_right()->input_left());
+}
+
 TEST_F(LQPTranslatorTest, ReuseInputExpressions) {
   // If the result of a (sub)expression is available in an input column, the expression should not be redundantly
   // evaluated
@@ -822,6 +1192,25 @@ TEST_F(LQPTranslatorTest, DropTable) {
   EXPECT_EQ(drop_table->table_name, "t");
 }
 
+TEST_F(LQPTranslatorTest, UpdateProjectsOnlyChangedColumns) {
+  // clang-format off
+  const auto selection_node = PredicateNode::make(greater_than_(int_float_a, 1), int_float_node);
+  const auto lqp =
+  UpdateNode::make("table_int_float",
+    selection_node,
+    ProjectionNode::make(expression_vector(int_float_a, add_(int_float_b, 1.0f)),
+      selection_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  EXPECT_EQ(pqp->type(), OperatorType::Update);
+  const auto projection = std::dynamic_pointer_cast<const Projection>(pqp->input_right());
+  ASSERT_NE(projection, nullptr);
+  ASSERT_EQ(projection->expressions.size(), 1u);
+  EXPECT_EQ(projection->input_left(), pqp->input_left());
+}
+
 TEST_F(LQPTranslatorTest, CreatePreparedPlan) {
   const auto prepared_plan = std::make_shared<PreparedPlan>(DummyTableNode::make(), std::vector<ParameterID>{});
   const auto lqp = CreatePreparedPlanNode::make("p", prepared_plan);
@@ -7,6 +7,7 @@
 
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -49,6 +50,22 @@ TEST_F(StoredTableNodeTest, Equals) {
 
 TEST_F(StoredTableNodeTest, Copy) { EXPECT_EQ(*_stored_table_node->deep_copy(), *_stored_table_node); }
 
+TEST_F(StoredTableNodeTest, TableSample) {
+  const auto sampled_node = StoredTableNode::make("t_a");
+  sampled_node->set_excluded_chunk_ids({ChunkID{2}});
+  sampled_node->set_table_sample(TableSample{TableSampleMethod::Bernoulli, 50.0f, 3u});
+
+  EXPECT_EQ(sampled_node->description(), "[StoredTable] Name: 't_a' TABLESAMPLE BERNOULLI (50)");
+  EXPECT_NE(*sampled_node, *_stored_table_node);
+  EXPECT_EQ(*sampled_node->deep_copy(), *sampled_node);
+
+  // The estimated row count scales with the sampling percentage
+  const auto table_statistics = _stored_table_node->get_statistics();
+  const auto sampled_statistics = sampled_node->get_statistics();
+  EXPECT_FLOAT_EQ(sampled_statistics->row_count(), table_statistics->row_count() / 2.0f);
+  EXPECT_EQ(sampled_statistics->table_type(), TableType::References);
+}
+
 TEST_F(StoredTableNodeTest, NodeExpressions) { ASSERT_EQ(_stored_table_node->node_expressions.size(), 0u); }
 
 }  // namespace opossum
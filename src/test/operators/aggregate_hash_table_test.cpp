@@ -0,0 +1,68 @@
+#include <array>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/aggregate/aggregate_hash_table.hpp"
+
+namespace opossum {
+
+class AggregateHashTableTest : public BaseTest {};
+
+TEST_F(AggregateHashTableTest, AssignsDenseIdsInInsertionOrder) {
+  auto hash_table = AggregateHashTable<std::string>{};
+
+  EXPECT_EQ(hash_table.find_or_insert("b", std::hash<std::string>{}("b")), std::make_pair(size_t{0}, true));
+  EXPECT_EQ(hash_table.find_or_insert("a", std::hash<std::string>{}("a")), std::make_pair(size_t{1}, true));
+  EXPECT_EQ(hash_table.find_or_insert("b", std::hash<std::string>{}("b")), std::make_pair(size_t{0}, false));
+  EXPECT_EQ(hash_table.find_or_insert("c", std::hash<std::string>{}("c")), std::make_pair(size_t{2}, true));
+
+  EXPECT_EQ(hash_table.size(), 3u);
+  EXPECT_EQ(hash_table.keys(), std::vector<std::string>({"b", "a", "c"}));
+}
+
+TEST_F(AggregateHashTableTest, EqualHashesOfDifferentKeys) {
+  auto hash_table = AggregateHashTable<AggregateKeyEntry>{};
+
+  // All keys share one hash, so they have to be told apart by comparing the keys
+  for (auto key = AggregateKeyEntry{0}; key < 100; ++key) {
+    EXPECT_EQ(hash_table.find_or_insert(key, 42), std::make_pair(size_t{key}, true));
+  }
+  for (auto key = AggregateKeyEntry{0}; key < 100; ++key) {
+    EXPECT_EQ(hash_table.find_or_insert(key, 42), std::make_pair(size_t{key}, false));
+  }
+}
+
+TEST_F(AggregateHashTableTest, Growing) {
+  // Starts small and has to grow multiple times. Keys of the same partition (i.e., with the same lower bits of the
+  // hash) must not collide in the table.
+  auto hash_table = AggregateHashTable<std::array<AggregateKeyEntry, 2>>{};
+
+  for (auto key = AggregateKeyEntry{0}; key < 10'000; ++key) {
+    const auto hash = static_cast<size_t>(key * 64);
+    EXPECT_EQ(hash_table.find_or_insert({key, key + 1}, hash), std::make_pair(size_t{key}, true));
+  }
+  EXPECT_EQ(hash_table.size(), 10'000u);
+
+  for (auto key = AggregateKeyEntry{0}; key < 10'000; ++key) {
+    const auto hash = static_cast<size_t>(key * 64);
+    EXPECT_EQ(hash_table.find_or_insert({key, key + 1}, hash), std::make_pair(size_t{key}, false));
+  }
+  EXPECT_EQ(hash_table.size(), 10'000u);
+}
+
+TEST_F(AggregateHashTableTest, ExpectedSize) {
+  auto hash_table = AggregateHashTable<AggregateKeyEntry>{1'000};
+
+  for (auto key = AggregateKeyEntry{0}; key < 1'000; ++key) {
+    hash_table.find_or_insert(key, std::hash<AggregateKeyEntry>{}(key));
+  }
+  EXPECT_EQ(hash_table.size(), 1'000u);
+  EXPECT_EQ(hash_table.keys().front(), AggregateKeyEntry{0});
+  EXPECT_EQ(hash_table.keys().back(), AggregateKeyEntry{999});
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -10,6 +11,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "constant_mappings.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/join_hash.hpp"
@@ -17,7 +19,11 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -189,6 +195,74 @@ TEST_F(OperatorsAggregateTest, SingleAggregateCountDistinct) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl", 1);
 }
 
+TEST_F(OperatorsAggregateTest, DictionarySingleAggregateCountDistinct) {
+  this->test_output(_table_wrapper_1_1_dict, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}},
+                    "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl", 1);
+}
+
+TEST_F(OperatorsAggregateTest, SumOverflow) {
+  const auto large_value = std::numeric_limits<int64_t>::max() / 2 + 1;
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Long, false}}, TableType::Data, 2);
+  table->append({1, large_value});
+  table->append({1, large_value});
+  table->append({2, int64_t{1}});
+
+  for (const auto encode : {false, true}) {
+    if (encode) ChunkEncoder::encode_all_chunks(table);
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}};
+    for (const auto& groupby_column_ids : {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}}}) {
+      const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+      EXPECT_THROW(aggregate->execute(), std::logic_error);
+    }
+
+    // AVG sums as double and does not overflow
+    const auto avg = std::make_shared<Aggregate>(
+        table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Avg}},
+        std::vector<ColumnID>{});
+    avg->execute();
+    EXPECT_DOUBLE_EQ(avg->get_output()->get_value<double>(ColumnID{0}, 0), (2.0 * large_value + 1.0) / 3.0);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, ApproxCountDistinct) {
+  // 5'000 distinct values in each of the groups 0 and 1 (the even and the odd ones), and 10'000 in total, with NULLs in
+  // between
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}}, TableType::Data, 1'000);
+  for (auto row = 0; row < 30'000; ++row) {
+    table->append({row % 2, row % 3 == 0 ? NULL_VALUE : AllTypeVariant{row % 10'000}});
+  }
+
+  for (const auto encode : {false, true}) {
+    if (encode) ChunkEncoder::encode_all_chunks(table);
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto aggregates = std::vector<AggregateColumnDefinition>{
+        {ColumnID{1}, AggregateFunction::CountDistinct}, {ColumnID{1}, AggregateFunction::ApproxCountDistinct}};
+    for (const auto& groupby_column_ids : {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}}}) {
+      const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+      aggregate->execute();
+      const auto& output = aggregate->get_output();
+      const auto exact_column_id = ColumnID{static_cast<ColumnID::base_type>(groupby_column_ids.size())};
+      const auto approx_column_id = ColumnID{static_cast<ColumnID::base_type>(groupby_column_ids.size() + 1)};
+
+      EXPECT_EQ(output->column_name(approx_column_id), "APPROX_COUNT_DISTINCT(b)");
+      EXPECT_EQ(output->column_data_type(approx_column_id), DataType::Long);
+      EXPECT_EQ(output->row_count(), groupby_column_ids.size() + 1);
+      for (auto row = size_t{0}; row < output->row_count(); ++row) {
+        const auto exact = output->get_value<int64_t>(exact_column_id, row);
+        EXPECT_EQ(exact, groupby_column_ids.empty() ? 10'000 : 5'000);
+        EXPECT_NEAR(output->get_value<int64_t>(approx_column_id, row), exact, exact * 0.05);
+      }
+    }
+  }
+}
+
 TEST_F(OperatorsAggregateTest, StringSingleAggregateMax) {
   this->test_output(_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl", 1);
@@ -401,6 +475,85 @@ TEST_F(OperatorsAggregateTest, NoGroupbySingleAggregateCount) {
                     "resources/test_data/tbl/aggregateoperator/0gb_1agg/count.tbl", 1);
 }
 
+TEST_F(OperatorsAggregateTest, NoGroupbyAggregatesOfEncodedSegments) {
+  // More rows than the ungrouped aggregation gathers into one block, with NULLs in both columns
+  const auto row_count = 3'000;
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Float, true}}, TableType::Data, 1'000);
+  auto sum_a = int64_t{0}, count_a = int64_t{0}, count_b = int64_t{0};
+  auto sum_b = 0.0;
+  for (auto row = 0; row < row_count; ++row) {
+    const auto a = row % 7 == 0 ? NULL_VALUE : AllTypeVariant{row % 100 - 50};
+    const auto b = row % 5 == 0 ? NULL_VALUE : AllTypeVariant{static_cast<float>(row) / 4};
+    table->append({a, b});
+
+    if (row % 7 != 0) {
+      sum_a += row % 100 - 50;
+      ++count_a;
+    }
+    if (row % 5 != 0) {
+      sum_b += static_cast<double>(row) / 4;
+      ++count_b;
+    }
+  }
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{
+      {ColumnID{0}, AggregateFunction::Sum},           {ColumnID{0}, AggregateFunction::Min},
+      {ColumnID{0}, AggregateFunction::Max},           {ColumnID{0}, AggregateFunction::Count},
+      {ColumnID{0}, AggregateFunction::CountDistinct}, {ColumnID{1}, AggregateFunction::Avg},
+      {ColumnID{1}, AggregateFunction::Min},           {ColumnID{1}, AggregateFunction::Max},
+      {std::nullopt, AggregateFunction::Count}};
+
+  auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"SUM(a)", DataType::Long, true},
+                             {"MIN(a)", DataType::Int, true},
+                             {"MAX(a)", DataType::Int, true},
+                             {"COUNT(a)", DataType::Long, false},
+                             {"COUNT(DISTINCT a)", DataType::Long, false},
+                             {"AVG(b)", DataType::Double, true},
+                             {"MIN(b)", DataType::Float, true},
+                             {"MAX(b)", DataType::Float, true},
+                             {"COUNT(*)", DataType::Long, false}},
+      TableType::Data);
+  expected_result->append({sum_a, -50, 49, count_a, int64_t{100}, sum_b / static_cast<double>(count_b), 0.25f,
+                           static_cast<float>(row_count - 1) / 4, int64_t{row_count}});
+
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                   EncodingType::LZ4}) {
+    SCOPED_TRACE(encoding_type_to_string.left.at(encoding_type));
+    auto table_copy = std::make_shared<Table>(table->column_definitions(), TableType::Data, 1'000);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table_copy->append_chunk(table->get_chunk(chunk_id)->segments());
+    }
+    if (encoding_type != EncodingType::Unencoded) {
+      ChunkEncoder::encode_all_chunks(table_copy, SegmentEncodingSpec{encoding_type});
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table_copy);
+    table_wrapper->execute();
+    const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, std::vector<ColumnID>{});
+    aggregate->execute();
+    EXPECT_TABLE_EQ_ORDERED(aggregate->get_output(), expected_result);
+
+    // Reference segments are aggregated without the statistics and dictionaries of the referenced chunks
+    auto reference_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table_copy->chunk_count(); ++chunk_id) {
+      auto pos_list = std::make_shared<PosList>();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < table_copy->get_chunk(chunk_id)->size(); ++chunk_offset) {
+        pos_list->emplace_back(chunk_id, chunk_offset);
+      }
+      reference_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(table_copy, ColumnID{0}, pos_list),
+                                             std::make_shared<ReferenceSegment>(table_copy, ColumnID{1}, pos_list)});
+    }
+    const auto reference_table_wrapper = std::make_shared<TableWrapper>(reference_table);
+    reference_table_wrapper->execute();
+    const auto aggregate_on_references =
+        std::make_shared<Aggregate>(reference_table_wrapper, aggregates, std::vector<ColumnID>{});
+    aggregate_on_references->execute();
+    EXPECT_TABLE_EQ_ORDERED(aggregate_on_references->get_output(), expected_result);
+  }
+}
+
 TEST_F(OperatorsAggregateTest, OneGroupbyAndNoAggregate) {
   this->test_output(_table_wrapper_1_1, {}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_0agg/result.tbl", 1);
@@ -471,6 +624,21 @@ TEST_F(OperatorsAggregateTest, ThreeGroupbyCountStar) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_3gb_0agg/count_star.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, DictionaryStringGroupByWithNull) {
+  // Every chunk has its own dictionary, so equal values have different ValueIDs in different chunks
+  for (const auto encoding_type :
+       {EncodingType::Dictionary, EncodingType::FixedStringDictionary, EncodingType::FrontCodedDictionary}) {
+    auto table = load_table("resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/input_null.tbl", 2);
+    ChunkEncoder::encode_all_chunks(table, create_compatible_chunk_encoding_spec(*table, {encoding_type}));
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    this->test_output(table_wrapper, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                      "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", 1, false);
+  }
+}
+
 TEST_F(OperatorsAggregateTest, DictionarySingleAggregateMaxWithNull) {
   this->test_output(_table_wrapper_1_1_null_dict, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/max_null.tbl", 1, false);
@@ -592,4 +760,65 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, RecordsStepWalltimes) {
+  const auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper_1_1, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto& performance_data = static_cast<const Aggregate::PerformanceData&>(aggregate->performance_data());
+  EXPECT_GT(performance_data.key_extraction.count(), 0);
+  EXPECT_GT(performance_data.grouping.count(), 0);
+  EXPECT_GT(performance_data.aggregation.count(), 0);
+  EXPECT_GT(performance_data.output_writing.count(), 0);
+  EXPECT_EQ(performance_data.step_walltimes().size(), 4u);
+  EXPECT_NE(performance_data.to_string().find("key_extraction: "), std::string::npos);
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroupsWithScheduler) {
+  // With a scheduler, the groups are built per chunk and merged in hash partitions. Many groups span several chunks.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+  column_definitions.emplace_back("c", DataType::Long);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  auto expected_sums = std::map<std::pair<std::optional<int32_t>, std::string>, int64_t>{};
+  auto expected_counts = std::map<std::pair<std::optional<int32_t>, std::string>, int64_t>{};
+  for (auto row = int64_t{0}; row < 20'000; ++row) {
+    const auto a = row % 101 == 0 ? std::nullopt : std::optional<int32_t>{static_cast<int32_t>(row % 2'503)};
+    const auto b = std::string{"b"} + std::to_string(row % 3);
+    table->append({a ? AllTypeVariant{*a} : AllTypeVariant{NullValue{}}, b, row});
+
+    expected_sums[{a, b}] += row;
+    ++expected_counts[{a, b}];
+  }
+
+  TableColumnDefinitions expected_column_definitions;
+  expected_column_definitions.emplace_back("a", DataType::Int, true);
+  expected_column_definitions.emplace_back("b", DataType::String);
+  expected_column_definitions.emplace_back("SUM(c)", DataType::Long, true);
+  expected_column_definitions.emplace_back("COUNT(*)", DataType::Long);
+
+  auto expected_result = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  for (const auto& [group, sum] : expected_sums) {
+    const auto& [a, b] = group;
+    expected_result->append({a ? AllTypeVariant{*a} : AllTypeVariant{NullValue{}}, b, sum, expected_counts.at(group)});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                                                  {std::nullopt, AggregateFunction::Count}};
+  auto aggregate =
+      std::make_shared<Aggregate>(table_wrapper, aggregates, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+}
+
 }  // namespace opossum
@@ -60,6 +60,38 @@ TEST_F(OperatorsDifferenceTest, DifferneceOnReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
 }
 
+TEST_F(OperatorsDifferenceTest, NullsAndDuplicates) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  auto left = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  left->append({NullValue{}, "x"});
+  left->append({1, NullValue{}});
+  left->append({2, "y"});
+  left->append({2, "y"});
+  left->append({3, "z"});
+  auto right = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  right->append({NullValue{}, "x"});
+  right->append({2, "y"});
+  right->append({1, "x"});
+
+  // NULLs are equal to NULLs, and all rows of the left input with the same values are removed
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({1, NullValue{}});
+  expected_result->append({3, "z"});
+
+  auto table_wrapper_left = std::make_shared<TableWrapper>(left);
+  auto table_wrapper_right = std::make_shared<TableWrapper>(right);
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  auto difference = std::make_shared<Difference>(table_wrapper_left, table_wrapper_right);
+  difference->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
+}
+
 TEST_F(OperatorsDifferenceTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
@@ -0,0 +1,97 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/exchange.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsExchangeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float2.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsExchangeTest, ShufflesRowsIntoPartitions) {
+  const auto exchange = std::make_shared<Exchange>(_table_wrapper, ColumnID{0}, PartitionID{3});
+  exchange->execute();
+  const auto output = exchange->get_output();
+
+  EXPECT_TABLE_EQ_UNORDERED(output, _table_wrapper->get_output());
+
+  const auto partition_schema = output->partition_schema();
+  ASSERT_TRUE(partition_schema);
+  EXPECT_EQ(partition_schema->type(), PartitioningType::Hash);
+  EXPECT_EQ(partition_schema->column_id(), ColumnID{0});
+  EXPECT_EQ(partition_schema->partition_count(), PartitionID{3});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    const auto& segment = *chunk->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(partition_schema->partition_of(segment[chunk_offset]), chunk->partition_id());
+    }
+  }
+}
+
+TEST_F(OperatorsExchangeTest, ShufflesReferencedRows) {
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 100);
+  table_scan->execute();
+
+  const auto exchange = std::make_shared<Exchange>(table_scan, ColumnID{1}, PartitionID{2});
+  exchange->execute();
+
+  EXPECT_EQ(exchange->get_output()->type(), TableType::Data);
+  EXPECT_TABLE_EQ_UNORDERED(exchange->get_output(), table_scan->get_output());
+}
+
+TEST_F(OperatorsExchangeTest, EnablesPartitionWiseJoin) {
+  // A table that is hash-partitioned like the output of the Exchange
+  const auto partitioned_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Long}, {"b", DataType::Int}}, TableType::Data, 2);
+  partitioned_table->set_partition_schema(
+      PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Long, PartitionID{3}));
+  auto row_idx = int32_t{0};
+  for (const auto value : {int64_t{12}, int64_t{123}, int64_t{12345}, int64_t{1}, int64_t{12345}, int64_t{2}}) {
+    partitioned_table->append({value, row_idx++});
+  }
+  const auto partitioned_table_wrapper = std::make_shared<TableWrapper>(partitioned_table);
+  partitioned_table_wrapper->execute();
+
+  const auto exchange = std::make_shared<Exchange>(_table_wrapper, ColumnID{0}, PartitionID{3});
+  exchange->execute();
+
+  const auto partition_wise_join =
+      std::make_shared<JoinHash>(partitioned_table_wrapper, exchange, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  partition_wise_join->execute();
+  EXPECT_NE(partition_wise_join->description(DescriptionMode::SingleLine).find("Partition-wise (3 partitions)"),
+            std::string::npos);
+
+  const auto join = std::make_shared<JoinHash>(partitioned_table_wrapper, _table_wrapper, JoinMode::Inner,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine).find("Partition-wise"), std::string::npos);
+
+  EXPECT_TABLE_EQ_UNORDERED(partition_wise_join->get_output(), join->get_output());
+}
+
+TEST_F(OperatorsExchangeTest, Description) {
+  const auto exchange = std::make_shared<Exchange>(_table_wrapper, ColumnID{0}, PartitionID{3});
+  EXPECT_EQ(exchange->description(DescriptionMode::SingleLine), "Exchange Hash(a) 3 partitions");
+  EXPECT_EQ(exchange->column_id(), ColumnID{0});
+  EXPECT_EQ(exchange->partition_count(), PartitionID{3});
+}
+
+}  // namespace opossum
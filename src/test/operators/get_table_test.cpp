@@ -1,9 +1,17 @@
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "operators/get_table.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -52,4 +60,122 @@ TEST_F(OperatorsGetTableTest, ExcludedChunks) {
   EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 3u));
 }
 
+TEST_F(OperatorsGetTableTest, ExcludedChunksOfPartitionedTable) {
+  const auto partitioned_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 2, UseMvcc::Yes);
+  partitioned_table->set_partition_schema(
+      PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{2}));
+  for (auto value = 0; value < 10; ++value) {
+    partitioned_table->append({value});
+  }
+  StorageManager::get().add_table("partitioned", partitioned_table);
+
+  auto gt = std::make_shared<GetTable>("partitioned");
+  gt->set_excluded_chunk_ids({ChunkID{0}});
+  gt->execute();
+
+  // The chunks keep their partitions
+  const auto table = gt->get_output();
+  EXPECT_EQ(table->partition_schema(), partitioned_table->partition_schema());
+  ASSERT_EQ(table->chunk_count(), partitioned_table->chunk_count() - 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id)->partition_id(),
+              partitioned_table->get_chunk(ChunkID{chunk_id + 1})->partition_id());
+  }
+}
+
+TEST_F(OperatorsGetTableTest, ReplicasOfTheWorkersNode) {
+  // Two nodes with four workers each
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto original_table = StorageManager::get().get_table("tableWithValues");
+  ChunkEncoder::encode_all_chunks(original_table);
+  original_table->set_numa_replicated(true);
+
+  for (auto node_id = NodeID{0}; node_id < 2; ++node_id) {
+    auto gt = std::make_shared<GetTable>("tableWithValues");
+    const auto task = std::make_shared<JobTask>([&]() { gt->execute(); });
+    task->schedule(node_id);
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+    const auto table = gt->get_output();
+    EXPECT_TABLE_EQ_ORDERED(table, load_table("resources/test_data/tbl/int_float2.tbl", 1u));
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      EXPECT_EQ(chunk, original_table->get_chunk_replica(chunk_id, node_id));
+      EXPECT_EQ(chunk->replicated_chunk(), original_table->get_chunk(chunk_id));
+      EXPECT_EQ(Topology::get().get_node_id(chunk->get_allocator().resource()), node_id);
+      // Transactions see the same rows in the replicas
+      EXPECT_EQ(chunk->mvcc_data(), original_table->get_chunk(chunk_id)->mvcc_data());
+    }
+  }
+
+  // Without a worker, the chunks are read from the table itself
+  auto gt = std::make_shared<GetTable>("tableWithValues");
+  CurrentScheduler::set(nullptr);
+  gt->execute();
+  EXPECT_EQ(gt->get_output(), original_table);
+}
+
+TEST_F(OperatorsGetTableTest, SystemSample) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 10);
+  for (auto value = 0; value < 1'000; ++value) table->append({value});
+  StorageManager::get().add_table("sampledTable", table);
+
+  const auto sample = [](const float percentage, const std::optional<uint32_t> seed) {
+    auto gt = std::make_shared<GetTable>("sampledTable");
+    gt->set_table_sample(TableSample{TableSampleMethod::System, percentage, seed});
+    gt->execute();
+    return gt->get_output();
+  };
+
+  EXPECT_EQ(sample(0.0f, std::nullopt)->row_count(), 0u);
+  EXPECT_EQ(sample(100.0f, std::nullopt)->row_count(), 1'000u);
+
+  // SYSTEM sampling keeps whole chunks of the table
+  const auto sampled_table = sample(30.0f, 42u);
+  EXPECT_EQ(sampled_table->type(), TableType::Data);
+  EXPECT_GT(sampled_table->chunk_count(), 10u);
+  EXPECT_LT(sampled_table->chunk_count(), 50u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < sampled_table->chunk_count(); ++chunk_id) {
+    const auto chunk = sampled_table->get_chunk(chunk_id);
+    const auto first_value = type_cast_variant<int32_t>((*chunk->get_segment(ColumnID{0}))[0]);
+    EXPECT_EQ(chunk, table->get_chunk(static_cast<ChunkID>(first_value / 10)));
+  }
+
+  // The same seed samples the same chunks
+  EXPECT_TABLE_EQ_ORDERED(sample(30.0f, 42u), sampled_table);
+}
+
+TEST_F(OperatorsGetTableTest, BernoulliSample) {
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 1'000);
+  for (auto value = 0; value < 10'000; ++value) table->append({value});
+  StorageManager::get().add_table("sampledTable", table);
+
+  const auto sample = [](const float percentage, const std::optional<uint32_t> seed) {
+    auto gt = std::make_shared<GetTable>("sampledTable");
+    gt->set_table_sample(TableSample{TableSampleMethod::Bernoulli, percentage, seed});
+    gt->execute();
+    return gt->get_output();
+  };
+
+  EXPECT_EQ(sample(0.0f, std::nullopt)->row_count(), 0u);
+  EXPECT_EQ(sample(100.0f, std::nullopt)->row_count(), 10'000u);
+
+  const auto sampled_table = sample(20.0f, 7u);
+  EXPECT_EQ(sampled_table->type(), TableType::References);
+  EXPECT_GT(sampled_table->row_count(), 1'700u);
+  EXPECT_LT(sampled_table->row_count(), 2'300u);
+
+  // The same seed samples the same rows, another one (almost certainly) other rows
+  EXPECT_TABLE_EQ_ORDERED(sample(20.0f, 7u), sampled_table);
+  EXPECT_NE(sample(20.0f, 8u)->get_value<int32_t>(ColumnID{0}, 0), sampled_table->get_value<int32_t>(ColumnID{0}, 0));
+
+  EXPECT_THROW(std::make_shared<GetTable>("sampledTable")->set_table_sample(
+                   TableSample{TableSampleMethod::Bernoulli, 101.0f, std::nullopt}),
+               std::exception);
+}
+
 }  // namespace opossum
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,13 +8,34 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "operators/export_binary.hpp"
 #include "operators/import_binary.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
 
-class OperatorsImportBinaryTest : public BaseTest {};
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  // Writes the given file to `filename`, with the last `truncated_bytes` bytes replaced by `suffix`
+  void write_modified_copy(const std::string& source, const size_t truncated_bytes, const std::string& suffix) {
+    std::ifstream input{source, std::ios::binary};
+    auto content = std::string{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+    content.resize(content.size() - truncated_bytes);
+    content += suffix;
+
+    std::ofstream output{filename, std::ios::binary};
+    output.write(content.data(), content.size());
+  }
+
+  const std::string filename = test_data_path + "import_test.bin";
+};
 
 TEST_F(OperatorsImportBinaryTest, SingleChunkSingleFloatColumn) {
   auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float}}, TableType::Data, 5);
@@ -40,6 +64,37 @@ TEST_F(OperatorsImportBinaryTest, MultipleChunkSingleFloatColumn) {
   EXPECT_EQ(importer->get_output()->chunk_count(), 2u);
 }
 
+TEST_F(OperatorsImportBinaryTest, WithoutChunkDirectory) {
+  auto expected_importer =
+      std::make_shared<opossum::ImportBinary>("resources/test_data/bin/MultipleChunkSingleFloatColumn.bin");
+  expected_importer->execute();
+
+  // Files written before the chunk directory was introduced end after the last chunk
+  write_modified_copy("resources/test_data/bin/MultipleChunkSingleFloatColumn.bin", 2 * 8 + 8, "");
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_importer->get_output());
+  EXPECT_EQ(importer->get_output()->chunk_count(), 2u);
+}
+
+TEST_F(OperatorsImportBinaryTest, InvalidChunkDirectory) {
+  auto expected_importer =
+      std::make_shared<opossum::ImportBinary>("resources/test_data/bin/MultipleChunkSingleFloatColumn.bin");
+  expected_importer->execute();
+
+  // The offsets of the chunks are not ascending, so the chunks have to be found by skipping over them
+  const auto chunk_offsets = std::vector<uint64_t>{46, 33};
+  auto directory = std::string(reinterpret_cast<const char*>(chunk_offsets.data()), 2 * sizeof(uint64_t));
+  directory.append(CHUNK_DIRECTORY_MARKER.data(), CHUNK_DIRECTORY_MARKER.size());
+  write_modified_copy("resources/test_data/bin/MultipleChunkSingleFloatColumn.bin", 2 * 8 + 8, directory);
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_importer->get_output());
+}
+
 TEST_F(OperatorsImportBinaryTest, StringValueSegment) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("a", DataType::String);
@@ -273,4 +328,65 @@ TEST_F(OperatorsImportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
 }
 
+TEST_F(OperatorsImportBinaryTest, Statistics) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String, true}}, TableType::Data, 3, UseMvcc::Yes);
+  table->append({1, "one"});
+  table->append({2, opossum::NULL_VALUE});
+  table->append({7, "seven"});
+  table->append({10, "ten"});
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {EncodingType::Dictionary});
+  StorageManager::get().add_table("table_a", table);
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  // The statistics of the table are restored, including the histograms
+  const auto table_statistics = imported_table->table_statistics();
+  ASSERT_TRUE(table_statistics);
+  EXPECT_FLOAT_EQ(table_statistics->row_count(), 4.0f);
+
+  const auto a_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics->column_statistics().at(0));
+  ASSERT_TRUE(a_statistics);
+  EXPECT_FLOAT_EQ(a_statistics->distinct_count(), 4.0f);
+  EXPECT_EQ(a_statistics->min(), 1);
+  EXPECT_EQ(a_statistics->max(), 10);
+  ASSERT_TRUE(a_statistics->histogram());
+  EXPECT_EQ(a_statistics->histogram()->total_count(), 4u);
+
+  const auto b_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<std::string>>(table_statistics->column_statistics().at(1));
+  ASSERT_TRUE(b_statistics);
+  EXPECT_FLOAT_EQ(b_statistics->null_value_ratio(), 0.25f);
+  EXPECT_EQ(b_statistics->min(), "one");
+  EXPECT_EQ(b_statistics->max(), "ten");
+  ASSERT_TRUE(b_statistics->histogram());
+  EXPECT_EQ(b_statistics->histogram()->total_count(), 3u);
+
+  for (const auto value : {1, 5, 7}) {
+    EXPECT_FLOAT_EQ(table_statistics->estimate_predicate(ColumnID{0}, PredicateCondition::Equals, value).row_count(),
+                    table->table_statistics()->estimate_predicate(ColumnID{0}, PredicateCondition::Equals, value)
+                        .row_count());
+  }
+
+  // The statistics of the encoded chunk are restored, the other chunk has none
+  const auto chunk_statistics = imported_table->get_chunk(ChunkID{0})->statistics();
+  ASSERT_TRUE(chunk_statistics);
+  EXPECT_FALSE(imported_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(chunk_statistics->can_prune(ColumnID{0}, PredicateCondition::Equals, 5));
+  EXPECT_FALSE(chunk_statistics->can_prune(ColumnID{0}, PredicateCondition::Equals, 7));
+  EXPECT_TRUE(chunk_statistics->can_prune(ColumnID{1}, PredicateCondition::Equals, std::string{"zero"}));
+  EXPECT_FALSE(imported_table->get_chunk(ChunkID{1})->statistics());
+
+  // The StorageManager does not generate them again
+  StorageManager::get().add_table("table_b", imported_table);
+  EXPECT_EQ(imported_table->table_statistics(), table_statistics);
+
+  // Snapshots do not have statistics, as they might not contain all rows
+  ExportBinary::write_binary(*table, filename, CommitID{0});
+  EXPECT_FALSE(ImportBinary::read_binary(filename)->table_statistics());
+}
+
 }  // namespace opossum
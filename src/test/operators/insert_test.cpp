@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -16,6 +17,8 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -283,4 +286,70 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float)
 }
 
+TEST_F(OperatorsInsertTest, InsertTable) {
+  const auto target_table = load_table("resources/test_data/tbl/int_float.tbl");
+  StorageManager::get().add_table("target_table", target_table);
+
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Float, false);
+  const auto batch = std::make_shared<Table>(column_definitions, TableType::Data);
+  batch->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{7, 8}),
+                       std::make_shared<ValueSegment<float>>(std::vector<float>{7.5f, 8.5f})});
+
+  const auto insert = std::make_shared<Insert>("target_table", batch);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(target_table->row_count(), 5u);
+  EXPECT_EQ(target_table->get_value<int32_t>(ColumnID{0}, 3), 7);
+  EXPECT_EQ(target_table->get_value<float>(ColumnID{1}, 4), 8.5f);
+}
+
+TEST_F(OperatorsInsertTest, ConcurrentInserts) {
+  // 3 Rows, chunk_size = 1000
+  const auto target_table = load_table("resources/test_data/tbl/int.tbl", 1000u);
+  StorageManager::get().add_table("target_table", target_table);
+
+  constexpr auto thread_count = 4;
+  constexpr auto inserts_per_thread = 100;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto insert_id = 0; insert_id < inserts_per_thread; ++insert_id) {
+        auto values_to_insert = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+        values_to_insert->append({thread_id * inserts_per_thread + insert_id});
+
+        const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+        table_wrapper->execute();
+
+        const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+        const auto context = TransactionManager::get().new_transaction_context();
+        insert->set_transaction_context(context);
+        insert->execute();
+        context->commit();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Every row was inserted exactly once, into a row of its own
+  ASSERT_EQ(target_table->chunk_count(), 1u);
+  const auto chunk = target_table->get_chunk(ChunkID{0});
+  ASSERT_EQ(chunk->size(), 3u + thread_count * inserts_per_thread);
+
+  auto inserted = std::vector<bool>(thread_count * inserts_per_thread);
+  const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  for (auto chunk_offset = ChunkOffset{3}; chunk_offset < chunk->size(); ++chunk_offset) {
+    EXPECT_NE(mvcc_data->begin_cids[chunk_offset], MvccData::MAX_COMMIT_ID);
+    const auto value = type_cast_variant<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]);
+    ASSERT_LT(value, thread_count * inserts_per_thread);
+    EXPECT_FALSE(inserted[value]);
+    inserted[value] = true;
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/intersect.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+class OperatorsIntersectTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_a = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+    _table_wrapper_b = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float3.tbl", 2));
+
+    _table_wrapper_a->execute();
+    _table_wrapper_b->execute();
+
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Float, false);
+    _expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+    _expected_result->append({123, 456.7f});
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_a;
+  std::shared_ptr<TableWrapper> _table_wrapper_b;
+  std::shared_ptr<Table> _expected_result;
+};
+
+TEST_F(OperatorsIntersectTest, OperatorName) {
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_a, _table_wrapper_b);
+  EXPECT_EQ(intersect->name(), "Intersect");
+}
+
+TEST_F(OperatorsIntersectTest, IntersectOnValueTables) {
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_a, _table_wrapper_b);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), _expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, IntersectOnReferenceTables) {
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "a");
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "b");
+
+  auto projection1 = std::make_shared<Projection>(_table_wrapper_a, expression_vector(a, b));
+  projection1->execute();
+
+  auto projection2 = std::make_shared<Projection>(_table_wrapper_b, expression_vector(a, b));
+  projection2->execute();
+
+  auto intersect = std::make_shared<Intersect>(projection1, projection2);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), _expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, NullsAndDuplicates) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  auto left = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  left->append({NullValue{}, "x"});
+  left->append({1, NullValue{}});
+  left->append({2, "y"});
+  left->append({2, "y"});
+  left->append({3, "z"});
+  auto right = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  right->append({NullValue{}, "x"});
+  right->append({2, "y"});
+  right->append({1, "x"});
+
+  // NULLs are equal to NULLs, and all rows of the left input with the same values are kept
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({NullValue{}, "x"});
+  expected_result->append({2, "y"});
+  expected_result->append({2, "y"});
+
+  auto table_wrapper_left = std::make_shared<TableWrapper>(left);
+  auto table_wrapper_right = std::make_shared<TableWrapper>(right);
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  auto intersect = std::make_shared<Intersect>(table_wrapper_left, table_wrapper_right);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, ThrowWrongColumnNumberException) {
+  if (!HYRISE_DEBUG) GTEST_SKIP();
+  auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
+  table_wrapper_c->execute();
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_a, table_wrapper_c);
+
+  EXPECT_THROW(intersect->execute(), std::exception);
+}
+
+}  // namespace opossum
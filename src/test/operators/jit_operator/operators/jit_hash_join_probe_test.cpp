@@ -0,0 +1,93 @@
+#include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+
+namespace opossum {
+
+// Mock JitOperator that passes on individual tuples
+class MockJoinSource : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockJoinSource"; }
+
+  void emit(JitRuntimeContext& context) { _emit(context); }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {}
+};
+
+// Mock JitOperator that records the values of a tuple value for each tuple passed to it
+class MockJoinSink : public AbstractJittable {
+ public:
+  explicit MockJoinSink(const JitTupleValue& tuple_value) : _tuple_value{tuple_value} {}
+
+  std::string description() const final { return "MockJoinSink"; }
+
+  std::vector<std::optional<std::string>> consumed_values() const { return _consumed_values; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {
+    if (_tuple_value.is_null(context)) {
+      _consumed_values.emplace_back(std::nullopt);
+    } else {
+      _consumed_values.emplace_back(_tuple_value.get<std::string>(context));
+    }
+  }
+
+  const JitTupleValue _tuple_value;
+  mutable std::vector<std::optional<std::string>> _consumed_values;
+};
+
+class JitHashJoinProbeTest : public BaseTest {};
+
+TEST_F(JitHashJoinProbeTest, EmitsATupleForEachMatch) {
+  const auto build_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}}, TableType::Data, 2);
+  build_table->append({1, "x"});
+  build_table->append({2, "y"});
+  build_table->append({1, "z"});
+  build_table->append({NULL_VALUE, "n"});
+  build_table->append({3, NULL_VALUE});
+
+  JitRuntimeContext context;
+  context.tuple.resize(2);
+
+  const auto probe_value = JitTupleValue{DataType::Int, true, 0};
+  auto source = std::make_shared<MockJoinSource>();
+  auto probe = std::make_shared<JitHashJoinProbe>(probe_value, ColumnID{0});
+  const auto build_value = probe->add_build_column(ColumnID{1}, DataType::String, true, 1);
+  auto sink = std::make_shared<MockJoinSink>(build_value);
+
+  // The same column is only copied once
+  EXPECT_EQ(probe->add_build_column(ColumnID{1}, DataType::String, true, 1), build_value);
+  EXPECT_EQ(probe->build_columns().size(), 1u);
+
+  source->set_next_operator(probe);
+  probe->set_next_operator(sink);
+  probe->before_query(build_table, context);
+
+  // The matches of a value are emitted in the order of the build table
+  probe_value.set_is_null(false, context);
+  probe_value.set<int32_t>(1, context);
+  source->emit(context);
+  EXPECT_EQ(sink->consumed_values(), (std::vector<std::optional<std::string>>{"x", "z"}));
+
+  // Values without a match and NULL values are not emitted
+  probe_value.set<int32_t>(4, context);
+  source->emit(context);
+  probe_value.set_is_null(true, context);
+  source->emit(context);
+  EXPECT_EQ(sink->consumed_values().size(), 2u);
+
+  // NULL values of the build columns are copied, too
+  probe_value.set_is_null(false, context);
+  probe_value.set<int32_t>(3, context);
+  source->emit(context);
+  EXPECT_EQ(sink->consumed_values(), (std::vector<std::optional<std::string>>{"x", "z", std::nullopt}));
+}
+
+TEST_F(JitHashJoinProbeTest, DescriptionContainsBuildColumns) {
+  auto probe = std::make_shared<JitHashJoinProbe>(JitTupleValue{DataType::Int, false, 0}, ColumnID{2});
+  probe->add_build_column(ColumnID{1}, DataType::Float, false, 3);
+  EXPECT_EQ(probe->description(), "[HashJoinProbe] x0 = Column#2, Build: x3 = Column#1 (float), ");
+}
+
+}  // namespace opossum
@@ -1,10 +1,33 @@
 #include "base_test.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
+// Mock JitOperator that records the (nullable) boolean value of a tuple value for each tuple passed to it
+class MockPredicateResultSink : public AbstractJittable {
+ public:
+  explicit MockPredicateResultSink(const JitTupleValue& tuple_value) : _tuple_value{tuple_value} {}
+
+  std::string description() const final { return "MockPredicateResultSink"; }
+
+  std::vector<std::optional<bool>> consumed_values() const { return _consumed_values; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {
+    if (_tuple_value.is_null(context)) {
+      _consumed_values.emplace_back(std::nullopt);
+    } else {
+      _consumed_values.emplace_back(_tuple_value.get<bool>(context));
+    }
+  }
+
+  const JitTupleValue _tuple_value;
+  mutable std::vector<std::optional<bool>> _consumed_values;
+};
+
 class JitReadWriteTupleTest : public BaseTest {};
 
 TEST_F(JitReadWriteTupleTest, CreateOutputTable) {
@@ -100,4 +123,51 @@ TEST_F(JitReadWriteTupleTest, CopyTable) {
                                 FloatComparisonMode::AbsoluteDifference));
 }
 
+TEST_F(JitReadWriteTupleTest, InputPredicatesAreEvaluated) {
+  auto input_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 3);
+  for (const auto& value : std::vector<AllTypeVariant>{1, NULL_VALUE, 3, 2, 5, 3, 4, 1, NULL_VALUE}) {
+    input_table->append({value});
+  }
+
+  // The predicates are evaluated on the ValueIDs of both kinds of compressed attribute vectors, and on the values of
+  // the unencoded chunk
+  ChunkEncoder::encode_chunks(input_table, {ChunkID{0}}, {EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+  ChunkEncoder::encode_chunks(input_table, {ChunkID{1}},
+                              {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned});
+
+  const auto test_predicate = [&](const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                  const std::vector<std::optional<bool>>& expected_values) {
+    JitRuntimeContext context;
+    auto read_tuples = std::make_shared<JitReadTuples>();
+    const auto tuple_value = read_tuples->add_input_predicate(ColumnID{0}, true, predicate_condition, value);
+    auto sink = std::make_shared<MockPredicateResultSink>(tuple_value);
+    read_tuples->set_next_operator(sink);
+
+    // The column itself is not read
+    EXPECT_TRUE(read_tuples->input_columns().empty());
+    EXPECT_EQ(tuple_value.data_type(), DataType::Bool);
+
+    read_tuples->before_query(*input_table, context);
+    for (const auto& chunk : input_table->chunks()) {
+      read_tuples->before_chunk(*input_table, *chunk, context);
+      read_tuples->execute(context);
+    }
+    EXPECT_EQ(sink->consumed_values(), expected_values);
+  };
+
+  const auto n = std::nullopt;
+  test_predicate(PredicateCondition::Equals, 3, {0, n, 1, 0, 0, 1, 0, 0, n});
+  test_predicate(PredicateCondition::NotEquals, 3, {1, n, 0, 1, 1, 0, 1, 1, n});
+  test_predicate(PredicateCondition::LessThan, 3, {1, n, 0, 1, 0, 0, 0, 1, n});
+  test_predicate(PredicateCondition::LessThanEquals, 3, {1, n, 1, 1, 0, 1, 0, 1, n});
+  test_predicate(PredicateCondition::GreaterThan, 3, {0, n, 0, 0, 1, 0, 1, 0, n});
+  test_predicate(PredicateCondition::GreaterThanEquals, 3, {0, n, 1, 0, 1, 1, 1, 0, n});
+
+  // Values that are not part of the dictionaries
+  test_predicate(PredicateCondition::Equals, 0, {0, n, 0, 0, 0, 0, 0, 0, n});
+  test_predicate(PredicateCondition::NotEquals, 6, {1, n, 1, 1, 1, 1, 1, 1, n});
+  test_predicate(PredicateCondition::GreaterThanEquals, 6, {0, n, 0, 0, 0, 0, 0, 0, n});
+  test_predicate(PredicateCondition::LessThan, 6, {1, n, 1, 1, 1, 1, 1, 1, n});
+}
+
 }  // namespace opossum
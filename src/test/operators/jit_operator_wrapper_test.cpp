@@ -1,6 +1,7 @@
 #include <gmock/gmock.h>
 
 #include "base_test.hpp"
+#include "operators/jit_operator/jit_module_cache.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_expression.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
@@ -22,6 +23,27 @@ class JitOperatorWrapperTest : public BaseTest {
     _int_table_wrapper->execute();
   }
 
+  // Creates a wrapper for the query SELECT a + <value> FROM resources/test_data/tbl/10_ints.tbl;
+  std::shared_ptr<JitOperatorWrapper> _create_add_literal_wrapper(const AllTypeVariant& value,
+                                                                  const JitExecutionMode execution_mode) const {
+    auto read_operator = std::make_shared<JitReadTuples>();
+    const auto column_tuple_value = read_operator->add_input_column(DataType::Int, false, ColumnID{0});
+    const auto literal_tuple_value = read_operator->add_literal_value(value);
+
+    const auto expression = std::make_shared<JitExpression>(std::make_shared<JitExpression>(column_tuple_value),
+                                                            JitExpressionType::Addition,
+                                                            std::make_shared<JitExpression>(literal_tuple_value),
+                                                            read_operator->add_temporary_value());
+    auto write_operator = std::make_shared<JitWriteTuples>();
+    write_operator->add_output_column("a+value", expression->result());
+
+    auto jit_operator_wrapper = std::make_shared<JitOperatorWrapper>(_int_table_wrapper, execution_mode);
+    jit_operator_wrapper->add_jit_operator(read_operator);
+    jit_operator_wrapper->add_jit_operator(std::make_shared<JitCompute>(expression));
+    jit_operator_wrapper->add_jit_operator(write_operator);
+    return jit_operator_wrapper;
+  }
+
   std::shared_ptr<Table> _empty_table;
   std::shared_ptr<Table> _int_table;
   std::shared_ptr<TableWrapper> _empty_table_wrapper;
@@ -155,4 +177,42 @@ TEST_F(JitOperatorWrapperTest, JitOperatorsSpecializedWithMultipleInliningOfSame
   ASSERT_EQ(result->get_value<int>(ColumnID(0), 1), 48);
 }
 
+TEST_F(JitOperatorWrapperTest, CompiledPipelinesAreCached) {
+  const auto first_wrapper = _create_add_literal_wrapper(1, JitExecutionMode::Compile);
+  first_wrapper->execute();
+  EXPECT_EQ(first_wrapper->get_output()->get_value<int>(ColumnID{0}, 1), 25);
+  EXPECT_EQ(JitModuleCache::get().size(), 1u);
+
+  // The literal value is not part of the specialized code, so the compiled pipeline is reused
+  const auto second_wrapper = _create_add_literal_wrapper(2, JitExecutionMode::Compile);
+  second_wrapper->execute();
+  EXPECT_EQ(second_wrapper->get_output()->get_value<int>(ColumnID{0}, 1), 26);
+  EXPECT_EQ(JitModuleCache::get().size(), 1u);
+
+  // Other data types need other code
+  const auto third_wrapper = _create_add_literal_wrapper(int64_t{3}, JitExecutionMode::Compile);
+  third_wrapper->execute();
+  EXPECT_EQ(third_wrapper->get_output()->get_value<int64_t>(ColumnID{0}, 1), 27);
+  EXPECT_EQ(JitModuleCache::get().size(), 2u);
+
+  // Interpreted pipelines are not compiled
+  _create_add_literal_wrapper(1.5f, JitExecutionMode::Interpret)->execute();
+  EXPECT_EQ(JitModuleCache::get().size(), 2u);
+}
+
+TEST_F(JitOperatorWrapperTest, CompileAsynchronously) {
+  // Whether a chunk is interpreted or processed by the compiled pipeline, the result is the same
+  for (auto run = 0; run < 2; ++run) {
+    const auto jit_operator_wrapper = _create_add_literal_wrapper(run, JitExecutionMode::CompileAsync);
+    jit_operator_wrapper->execute();
+
+    const auto result = jit_operator_wrapper->get_output();
+    ASSERT_EQ(result->row_count(), _int_table->row_count());
+    for (auto row = size_t{0}; row < result->row_count(); ++row) {
+      EXPECT_EQ(result->get_value<int>(ColumnID{0}, row), _int_table->get_value<int>(ColumnID{0}, row) + run);
+    }
+  }
+  EXPECT_EQ(JitModuleCache::get().size(), 1u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,117 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_adaptive.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinAdaptiveTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _small_table = _create_table(10, 10);
+    _large_table = _create_table(1'000, 100);
+
+    _large_indexed_table = _create_table(1'000, 100);
+    ChunkEncoder::encode_all_chunks(_large_indexed_table);
+    for (auto chunk_id = ChunkID{0}; chunk_id < _large_indexed_table->chunk_count(); ++chunk_id) {
+      _large_indexed_table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    }
+  }
+
+  // A table with the columns a (0, 1, ..., row_count - 1) and b (a * 2), with the rows in descending order of a
+  static std::shared_ptr<Table> _create_table(const int row_count, const ChunkOffset chunk_size) {
+    auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data, chunk_size);
+    for (auto value = row_count - 1; value >= 0; --value) {
+      table->append({value, value * 2});
+    }
+    return table;
+  }
+
+  static std::shared_ptr<AbstractOperator> _wrap(const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _small_table, _large_table, _large_indexed_table;
+};
+
+TEST_F(JoinAdaptiveTest, HashJoinForUnsortedInputs) {
+  const auto join = std::make_shared<JoinAdaptive>(_wrap(_small_table), _wrap(_large_table), JoinMode::Inner,
+                                                   ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  EXPECT_FALSE(join->executed_join());
+  join->execute();
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(join->executed_join()));
+  EXPECT_FALSE(join->inputs_swapped());
+  EXPECT_EQ(join->get_output()->row_count(), 10u);
+  EXPECT_NE(join->description(DescriptionMode::SingleLine).find("executed as JoinHash"), std::string::npos);
+}
+
+TEST_F(JoinAdaptiveTest, SortMergeJoinForSortedInputs) {
+  const auto sort_left = std::make_shared<Sort>(_wrap(_large_table), ColumnID{0});
+  sort_left->execute();
+  const auto sort_right = std::make_shared<Sort>(_wrap(_create_table(1'000, 100)), ColumnID{0});
+  sort_right->execute();
+
+  const auto join = std::make_shared<JoinAdaptive>(sort_left, sort_right, JoinMode::Inner,
+                                                   ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinSortMerge>(join->executed_join()));
+  EXPECT_EQ(join->get_output()->row_count(), 1'000u);
+}
+
+TEST_F(JoinAdaptiveTest, IndexJoinForIndexedRightInput) {
+  const auto join =
+      std::make_shared<JoinAdaptive>(_wrap(_small_table), _wrap(_large_indexed_table), JoinMode::Inner,
+                                     ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinIndex>(join->executed_join()));
+  EXPECT_FALSE(join->inputs_swapped());
+  EXPECT_EQ(join->get_output()->row_count(), 10u);
+}
+
+TEST_F(JoinAdaptiveTest, IndexJoinForIndexedLeftInput) {
+  const auto join =
+      std::make_shared<JoinAdaptive>(_wrap(_large_indexed_table), _wrap(_small_table), JoinMode::Inner,
+                                     ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThanEquals);
+  join->execute();
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinIndex>(join->executed_join()));
+  EXPECT_TRUE(join->inputs_swapped());
+  EXPECT_NE(join->description(DescriptionMode::SingleLine).find("with swapped inputs"), std::string::npos);
+
+  // The columns are those of the left input followed by those of the right one, as for the other joins
+  const auto join_sort_merge =
+      std::make_shared<JoinSortMerge>(_wrap(_large_indexed_table), _wrap(_small_table), JoinMode::Inner,
+                                      ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThanEquals);
+  join_sort_merge->execute();
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_sort_merge->get_output());
+}
+
+TEST_F(JoinAdaptiveTest, IndexesOfOuterJoinsAreNotSwapped) {
+  const auto join = std::make_shared<JoinAdaptive>(_wrap(_large_indexed_table), _wrap(_small_table), JoinMode::Left,
+                                                   ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  EXPECT_FALSE(join->inputs_swapped());
+  EXPECT_EQ(join->get_output()->row_count(), 1'000u);
+}
+
+}  // namespace opossum
@@ -11,6 +11,7 @@
 #include "join_test.hpp"
 
 #include "operators/get_table.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_mpsm.hpp"
@@ -32,7 +33,7 @@ template <typename T>
 class JoinEquiTest : public JoinTest {};
 
 // here we define all Join types
-using JoinEquiTypes = ::testing::Types<JoinNestedLoop, JoinHash, JoinSortMerge, JoinIndex, JoinMPSM>;
+using JoinEquiTypes = ::testing::Types<JoinNestedLoop, JoinHash, JoinSortMerge, JoinIndex, JoinMPSM, JoinAdaptive>;
 TYPED_TEST_CASE(JoinEquiTest, JoinEquiTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(JoinEquiTest, LeftJoin) {
@@ -399,6 +400,31 @@ TYPED_TEST(JoinEquiTest, LeftJoinEmptyRefSegment) {
                                              "resources/test_data/tbl/joinoperators/int_join_empty_left.tbl", 1);
 }
 
+TYPED_TEST(JoinEquiTest, JoinOnSkewedKeys) {
+  // A third of the left and half of the right values are 7, in enough chunks for several clusters of JoinSortMerge
+  const auto create_table = [](const int row_count, const ChunkOffset chunk_size, const int heavy_hitter_period) {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                         chunk_size);
+    for (auto row = 0; row < row_count; ++row) table->append({row % heavy_hitter_period == 0 ? 7 : row});
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto left = create_table(2'000, 100, 3);
+  const auto right = create_table(500, 50, 2);
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left}) {
+    const auto join = std::make_shared<TypeParam>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                  PredicateCondition::Equals);
+    join->execute();
+    const auto expected_join = std::make_shared<JoinNestedLoop>(
+        left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    expected_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+  }
+}
+
 // Does not work yet due to problems with RowID implementation (RowIDs need to reference a table)
 TYPED_TEST(JoinEquiTest, DISABLED_JoinOnUnion /* #160 */) {
   //  Filtering to generate RefSegments
@@ -10,6 +10,7 @@
 #include "join_test.hpp"
 
 #include "operators/get_table.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
@@ -29,7 +30,7 @@ template <typename T>
 class JoinFullTest : public JoinTest {};
 
 // here we define all Join types
-typedef ::testing::Types<JoinNestedLoop, JoinSortMerge, JoinIndex> JoinFullTypes;
+typedef ::testing::Types<JoinNestedLoop, JoinSortMerge, JoinIndex, JoinAdaptive> JoinFullTypes;
 TYPED_TEST_CASE(JoinFullTest, JoinFullTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(JoinFullTest, CrossJoin) {
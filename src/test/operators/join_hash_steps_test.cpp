@@ -3,6 +3,7 @@
 #include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -38,16 +39,6 @@ class JoinHashStepsTest : public BaseTest {
 
   void SetUp() override {}
 
-  // Accumulates the RowIDs hidden behind the iterator element (hash map stores PosLists, not RowIDs)
-  template <typename Iter>
-  size_t get_row_count(Iter begin, Iter end) {
-    size_t row_count = 0;
-    for (Iter it = begin; it != end; ++it) {
-      row_count += it->second.size();
-    }
-    return row_count;
-  }
-
   inline static size_t _table_size_zero_one = 0;
   inline static std::shared_ptr<Table> _table_zero_one;
   inline static std::shared_ptr<TableWrapper> _table_int_with_nulls, _table_with_nulls_and_zeros;
@@ -118,9 +109,7 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   table_without_nulls_scanned->execute();
 
   // now that build removed the unneeded init values, map sizes should differ
-  EXPECT_EQ(
-      this->get_row_count(hash_map_without_nulls.at(0).value().begin(), hash_map_without_nulls.at(0).value().end()),
-      table_without_nulls_scanned->get_output()->row_count());
+  EXPECT_EQ(hash_map_without_nulls.at(0)->row_count(), table_without_nulls_scanned->get_output()->row_count());
 }
 
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
@@ -183,6 +172,208 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, MultiPassRadixClustering) {
+  // Partitioning by 1 + 2 bits in two passes yields the same partitions as a single pass with 3 bits, except for their
+  // order: Partition p of the first pass is refined into the partitions p * 4 to p * 4 + 3.
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized =
+      materialize_input<int, int, true>(_table_int_with_nulls->get_output(), ColumnID{0}, histograms, 1);
+  const auto chunk_offsets = determine_chunk_offsets(_table_int_with_nulls->get_output());
+  const auto first_pass = partition_radix_parallel<int, int, true>(materialized, chunk_offsets, histograms, 1);
+  const auto second_pass = partition_radix_refine<int, int, true>(first_pass, 1, 2);
+
+  ASSERT_EQ(second_pass.partition_offsets.size(), 8u);
+  EXPECT_EQ(second_pass.partition_offsets.back(), materialized.elements->size());
+  ASSERT_EQ(second_pass.null_value_bitvector->size(), materialized.elements->size());
+
+  const std::hash<int> hash_function;
+  auto partition_begin = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < 8; ++partition_id) {
+    const auto partition_end = second_pass.partition_offsets[partition_id];
+    for (auto offset = partition_begin; offset < partition_end; ++offset) {
+      const auto& element = second_pass.elements->at(offset);
+      const auto hash = hash_function(element.value);
+      EXPECT_EQ((hash & 1) * 4 + ((hash >> 1) & 3), partition_id);
+
+      // Loaded table does not include int=0 values, so all int=0 values are NULLs
+      EXPECT_EQ((*second_pass.null_value_bitvector)[offset], element.value == 0);
+    }
+    partition_begin = partition_end;
+  }
+}
+
+TEST_F(JoinHashStepsTest, BloomFilter) {
+  auto bloom_filter = BloomFilter{1'000};
+  const std::hash<int> hash_function;
+  for (auto value = 0; value < 1'000; ++value) {
+    bloom_filter.insert(hash_function(value * 2));
+  }
+
+  auto false_positive_count = 0;
+  for (auto value = 0; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter.contains(hash_function(value * 2)));
+    if (bloom_filter.contains(hash_function(value * 2 + 1))) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 50);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputWithBloomFilter) {
+  // Only the zeros can find a match
+  auto bloom_filter = std::make_shared<BloomFilter>(1);
+  bloom_filter->insert(std::hash<int>{}(0));
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto radix_container =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 0, bloom_filter);
+
+  auto materialized_count = size_t{0};
+  for (const auto& element : *radix_container.elements) {
+    if (element.row_id == NULL_ROW_ID) continue;
+    EXPECT_EQ(element.value, 0);
+    ++materialized_count;
+  }
+  EXPECT_EQ(materialized_count, _table_size_zero_one / 2);
+  EXPECT_EQ(histograms[0][0], _table_size_zero_one / 2);
+}
+
+TEST_F(JoinHashStepsTest, ProbeStreamingMatchesProbe) {
+  std::vector<std::vector<size_t>> histograms;
+  const auto build_input = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
+                                                              histograms, 0);
+  const auto hashtables = build<int, int>(build_input);
+  ASSERT_EQ(hashtables.size(), 1u);
+
+  for (const auto& probe_table :
+       {_table_with_nulls_and_zeros->get_output(), _table_with_nulls_and_zeros_scanned->get_output()}) {
+    const auto probe_input = materialize_input<int, int, true>(probe_table, ColumnID{0}, histograms, 0);
+    auto pos_lists_left = std::vector<PosList>(1);
+    auto pos_lists_right = std::vector<PosList>(1);
+    probe<int, int, true>(probe_input, hashtables, pos_lists_left, pos_lists_right, JoinMode::Left);
+
+    auto streamed_pos_lists_left = std::vector<PosList>(probe_table->chunk_count());
+    auto streamed_pos_lists_right = std::vector<PosList>(probe_table->chunk_count());
+    probe_streaming<int, int, true>(probe_table, ColumnID{0}, hashtables.front(), streamed_pos_lists_left,
+                                    streamed_pos_lists_right, JoinMode::Left);
+
+    // Both write the matches in the order of the probe input
+    auto streamed_left = PosList{};
+    auto streamed_right = PosList{};
+    for (ChunkID chunk_id{0}; chunk_id < probe_table->chunk_count(); ++chunk_id) {
+      streamed_left.insert(streamed_left.end(), streamed_pos_lists_left[chunk_id].begin(),
+                           streamed_pos_lists_left[chunk_id].end());
+      streamed_right.insert(streamed_right.end(), streamed_pos_lists_right[chunk_id].begin(),
+                            streamed_pos_lists_right[chunk_id].end());
+    }
+    EXPECT_EQ(streamed_left, pos_lists_left.front());
+    EXPECT_EQ(streamed_right, pos_lists_right.front());
+
+    const auto non_null_probe_input = materialize_input<int, int, false>(probe_table, ColumnID{0}, histograms, 0);
+    for (const auto mode : {JoinMode::Semi, JoinMode::Anti}) {
+      auto pos_lists = std::vector<PosList>(1);
+      probe_semi_anti<int, int>(non_null_probe_input, hashtables, pos_lists, mode);
+
+      auto streamed_pos_lists = std::vector<PosList>(probe_table->chunk_count());
+      probe_streaming_semi_anti<int, int>(probe_table, ColumnID{0}, hashtables.front(), streamed_pos_lists, mode);
+
+      auto streamed = PosList{};
+      for (const auto& streamed_pos_list : streamed_pos_lists) {
+        streamed.insert(streamed.end(), streamed_pos_list.begin(), streamed_pos_list.end());
+      }
+      EXPECT_EQ(streamed, pos_lists.front());
+    }
+  }
+}
+
+TEST_F(JoinHashStepsTest, PruneProbeChunks) {
+  // Four chunks holding the values 0 to 9, 10 to 19, and so on. Their statistics are created by the ChunkEncoder.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto value = 0; value < 40; ++value) {
+    probe_table->append({value});
+  }
+
+  const auto build_input = [&](const std::vector<int>& values) {
+    const auto build_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto value : values) {
+      build_table->append({value});
+    }
+    std::vector<std::vector<size_t>> histograms;
+    return materialize_input<int, int, false>(build_table, ColumnID{0}, histograms, 0);
+  };
+
+  // Without statistics, no chunk can be pruned
+  EXPECT_TRUE(prune_probe_chunks(build_input({15}), *probe_table, ColumnID{0}).empty());
+
+  ChunkEncoder::encode_all_chunks(probe_table);
+  const auto probe_table_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_table_wrapper->execute();
+  const auto probe_table_scanned =
+      create_table_scan(probe_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, -1);
+  probe_table_scanned->execute();
+
+  for (const auto& table : {std::shared_ptr<const Table>{probe_table}, probe_table_scanned->get_output()}) {
+    // The range of the build values rules out all but the second chunk
+    EXPECT_EQ(prune_probe_chunks(build_input({15, 17}), *table, ColumnID{0}),
+              std::vector<bool>({true, false, true, true}));
+
+    // The range of the build values overlaps all chunks, but the first and the last chunk hold one of them
+    EXPECT_EQ(prune_probe_chunks(build_input({5, 35}), *table, ColumnID{0}),
+              std::vector<bool>({false, true, true, false}));
+
+    // Without build values, nothing matches
+    EXPECT_EQ(prune_probe_chunks(build_input({}), *table, ColumnID{0}), std::vector<bool>(4, true));
+  }
+
+  // The values of pruned chunks are neither materialized nor probed
+  const auto pruned_chunks = std::vector<bool>({true, false, true, true});
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized =
+      materialize_input<int, int, false>(probe_table, ColumnID{0}, histograms, 0, nullptr, pruned_chunks);
+  auto materialized_count = size_t{0};
+  for (const auto& element : *materialized.elements) {
+    if (element.row_id == NULL_ROW_ID) continue;
+    EXPECT_EQ(element.row_id.chunk_id, ChunkID{1});
+    ++materialized_count;
+  }
+  EXPECT_EQ(materialized_count, 10u);
+
+  const auto hashtables = build<int, int>(build_input({5, 15}));
+  auto pos_lists_left = std::vector<PosList>(4);
+  auto pos_lists_right = std::vector<PosList>(4);
+  probe_streaming<int, int, false>(probe_table, ColumnID{0}, hashtables.front(), pos_lists_left, pos_lists_right,
+                                   JoinMode::Inner, pruned_chunks);
+  EXPECT_TRUE(pos_lists_right[0].empty());
+  EXPECT_EQ(pos_lists_right[1], PosList({RowID{ChunkID{1}, ChunkOffset{5}}}));
+}
+
+TEST_F(JoinHashStepsTest, AlignPosListsToChunks) {
+  const auto row_id = [](const uint32_t chunk_id, const uint32_t chunk_offset) {
+    return RowID{ChunkID{chunk_id}, ChunkOffset{chunk_offset}};
+  };
+
+  // Two partitions of the probe phase
+  auto pos_lists_left = std::vector<PosList>(2);
+  auto pos_lists_right = std::vector<PosList>(2);
+  pos_lists_left[0] = PosList{row_id(0, 0), NULL_ROW_ID};
+  pos_lists_right[0] = PosList{row_id(2, 0), row_id(0, 1)};
+  pos_lists_left[1] = PosList{row_id(1, 1), row_id(0, 2)};
+  pos_lists_right[1] = PosList{row_id(2, 3), row_id(2, 1)};
+
+  align_pos_lists_to_chunks(pos_lists_left, pos_lists_right, true, 3);
+
+  ASSERT_EQ(pos_lists_right.size(), 3u);
+  EXPECT_EQ(pos_lists_right[0], PosList({row_id(0, 1)}));
+  EXPECT_TRUE(pos_lists_right[1].empty());
+  EXPECT_EQ(pos_lists_right[2], PosList({row_id(2, 0), row_id(2, 3), row_id(2, 1)}));
+
+  // The left matches are moved along with their right counterparts
+  ASSERT_EQ(pos_lists_left.size(), 3u);
+  EXPECT_EQ(pos_lists_left[0], PosList({NULL_ROW_ID}));
+  EXPECT_TRUE(pos_lists_left[1].empty());
+  EXPECT_EQ(pos_lists_left[2], PosList({row_id(0, 0), row_id(1, 1), row_id(0, 2)}));
+}
+
 TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   // offset store the start offset for each chunk
   const auto chunk_offsets_nulls = determine_chunk_offsets(_table_with_nulls_and_zeros->get_output());
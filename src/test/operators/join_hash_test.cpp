@@ -1,8 +1,17 @@
 #include "../base_test.hpp"
 
+#include "constant_mappings.hpp"
+#include "expression/expression_functional.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/partition_schema.hpp"
 #include "types.hpp"
+#include "utils/query_memory_resource.hpp"
+#include "utils/temp_file_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
 
 namespace opossum {
 
@@ -51,9 +60,9 @@ TEST_F(JoinHashTest, OperatorName) {
   EXPECT_EQ(join->name(), "JoinHash");
 }
 
-// Once we bring in the PosList optimization flag REFERS_TO_SINGLE_CHUNK_ONLY, this test will ensure
-// that the join does not unnecessarily add chunks (e.g., discussed in #698).
-TEST_F(JoinHashTest, DISABLED_ChunkCount /* #698 */) {
+// The output chunks are aligned to the chunks of the probe input, so that the join does not unnecessarily add chunks
+// (e.g., discussed in #698).
+TEST_F(JoinHashTest, ChunkCount) {
   auto join = std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
                                          ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 10);
   join->execute();
@@ -65,6 +74,35 @@ TEST_F(JoinHashTest, DISABLED_ChunkCount /* #698 */) {
                        _table_tpch_lineitems_scanned->get_output()->chunk_count()));
 }
 
+TEST_F(JoinHashTest, OutputAlignedToProbeChunks) {
+  for (const auto radix_bits : {size_t{0}, size_t{3}}) {
+    auto join = std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
+                                           ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                           radix_bits);
+    join->execute();
+    const auto output = join->get_output();
+    EXPECT_EQ(output->row_count(), _table_tpch_lineitems_scanned->get_output()->row_count());
+
+    // lineitem is the larger input and thus the probe side. Its columns (the ones after those of orders) only
+    // reference a single chunk per output chunk.
+    const auto first_lineitem_column_id = static_cast<ColumnID>(_table_tpch_orders->get_output()->column_count());
+    for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto chunk = output->get_chunk(chunk_id);
+      for (auto column_id = first_lineitem_column_id; column_id < output->column_count(); ++column_id) {
+        const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+        EXPECT_TRUE(reference_segment->pos_list()->references_single_chunk());
+      }
+
+      // All columns of lineitem share their pos list, as they did in the input
+      const auto first_segment =
+          std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(first_lineitem_column_id));
+      const auto second_segment = std::static_pointer_cast<const ReferenceSegment>(
+          chunk->get_segment(static_cast<ColumnID>(first_lineitem_column_id + 1)));
+      EXPECT_EQ(first_segment->pos_list(), second_segment->pos_list());
+    }
+  }
+}
+
 TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   // This test mirrors the test "LeftJoinWithNullAndZeros" executed in join_null_test, but for such input
   // sizes no radix clustering is executed. Consequently, we manually create a radix clustered hash join.
@@ -77,6 +115,113 @@ TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
 }
 
+TEST_F(JoinHashTest, MultiPassRadixClustering) {
+  // With this many radix bits, the fan-out exceeds what a single pass handles for common L1 cache sizes
+  auto single_pass_join =
+      std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 2);
+  single_pass_join->execute();
+
+  auto multi_pass_join =
+      std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 16);
+  multi_pass_join->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(multi_pass_join->get_output(), single_pass_join->get_output());
+}
+
+TEST_F(JoinHashTest, DescriptionShowsRadixPartitioning) {
+  auto join = std::make_shared<JoinHash>(_table_wrapper_small, _table_wrapper_small, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 3);
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine).find("Radix bits"), std::string::npos);
+
+  join->execute();
+  EXPECT_NE(join->description(DescriptionMode::SingleLine).find("Radix bits: 3 (passes: 3)"), std::string::npos);
+
+  // Small inputs are not partitioned
+  auto small_join = std::make_shared<JoinHash>(_table_wrapper_small, _table_wrapper_small, JoinMode::Inner,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  small_join->execute();
+  EXPECT_NE(small_join->description(DescriptionMode::SingleLine).find("Radix bits: 0 (passes: none)"),
+            std::string::npos);
+}
+
+TEST_F(JoinHashTest, SelectiveJoinWithBloomFilter) {
+  // The probe relation is much larger than the build relation. When it is partitioned, its values are filtered by a
+  // Bloom filter first. Without radix bits, it is probed chunk by chunk instead. The result must not change.
+  const auto orders = create_table_scan(_table_tpch_orders, ColumnID{0}, PredicateCondition::LessThan, 100);
+  orders->execute();
+  const auto lineitems = create_table_scan(_table_tpch_lineitems, ColumnID{0}, PredicateCondition::LessThan, 100);
+  lineitems->execute();
+  ASSERT_GT(lineitems->get_output()->row_count(), 0u);
+
+  for (const auto radix_bits : {std::optional<size_t>{}, std::optional<size_t>{2}}) {
+    auto inner_join = std::make_shared<JoinHash>(_table_tpch_lineitems, orders, JoinMode::Inner,
+                                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                                 radix_bits);
+    inner_join->execute();
+    EXPECT_EQ(inner_join->get_output()->row_count(), lineitems->get_output()->row_count());
+
+    auto semi_join = std::make_shared<JoinHash>(_table_tpch_lineitems, orders, JoinMode::Semi,
+                                                ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                                radix_bits);
+    semi_join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(semi_join->get_output(), lineitems->get_output());
+  }
+}
+
+TEST_F(JoinHashTest, PruneProbeChunksByStatistics) {
+  // The lineitems are ordered by their orders, so most chunks hold none of the selected orders
+  const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", 10);
+  ChunkEncoder::encode_all_chunks(lineitem_table);
+  const auto lineitems = std::make_shared<TableWrapper>(lineitem_table);
+  lineitems->execute();
+
+  const auto orders = create_table_scan(_table_tpch_orders, ColumnID{0}, PredicateCondition::LessThan, 100);
+  orders->execute();
+  const auto selected_lineitems = create_table_scan(lineitems, ColumnID{0}, PredicateCondition::LessThan, 100);
+  selected_lineitems->execute();
+
+  for (const auto radix_bits : {std::optional<size_t>{0}, std::optional<size_t>{2}}) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Semi}) {
+      auto join = std::make_shared<JoinHash>(lineitems, orders, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                             PredicateCondition::Equals, radix_bits);
+      join->execute();
+      EXPECT_EQ(join->get_output()->row_count(), selected_lineitems->get_output()->row_count());
+
+      const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+      EXPECT_GT(performance_data.probe_chunks_pruned, lineitem_table->chunk_count() / 2);
+    }
+  }
+
+  // The unmatched rows of outer and anti joins are part of their result
+  auto left_join = std::make_shared<JoinHash>(lineitems, orders, JoinMode::Left, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                              PredicateCondition::Equals);
+  left_join->execute();
+  EXPECT_EQ(left_join->get_output()->row_count(), lineitem_table->row_count());
+  EXPECT_EQ(static_cast<const JoinHash::PerformanceData&>(left_join->performance_data()).probe_chunks_pruned, 0u);
+}
+
+TEST_F(JoinHashTest, StreamingProbeMatchesPartitionedProbe) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti}) {
+    for (const auto& probe_input : std::vector<std::shared_ptr<AbstractOperator>>{_table_with_nulls,
+                                                                                   _table_tpch_orders_scanned}) {
+      // Without radix bits, the right input is not materialized but probed chunk by chunk
+      auto streaming_join = std::make_shared<JoinHash>(_table_wrapper_small, probe_input, mode,
+                                                       ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                       PredicateCondition::Equals, 0);
+      streaming_join->execute();
+
+      auto partitioned_join = std::make_shared<JoinHash>(_table_wrapper_small, probe_input, mode,
+                                                         ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                         PredicateCondition::Equals, 2);
+      partitioned_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(streaming_join->get_output(), partitioned_join->get_output());
+    }
+  }
+}
+
 TEST_F(JoinHashTest, HashJoinNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -98,4 +243,187 @@ TEST_F(JoinHashTest, HashJoinNotApplicable) {
   EXPECT_THROW(execute_hash_join(JoinMode::Left, PredicateCondition::GreaterThan), std::logic_error);
 }
 
+TEST_F(JoinHashTest, PartitionWiseJoin) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}};
+  const auto create_table = [&](const bool is_partitioned, const int32_t row_count, const int32_t factor) {
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+    if (is_partitioned) {
+      table->set_partition_schema(PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{4}));
+    }
+    for (auto value = 0; value < row_count; ++value) {
+      table->append({(value * factor) % 120, value});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto partitioned_left = create_table(true, 100, 1);
+  const auto partitioned_right = create_table(true, 80, 3);
+  const auto left = create_table(false, 100, 1);
+  const auto right = create_table(false, 80, 3);
+
+  // Scans of the partitioned tables keep their partitions
+  const auto partitioned_right_scanned =
+      create_table_scan(partitioned_right, ColumnID{1}, PredicateCondition::GreaterThan, 10);
+  partitioned_right_scanned->execute();
+  const auto right_scanned = create_table_scan(right, ColumnID{1}, PredicateCondition::GreaterThan, 10);
+  right_scanned->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::Anti}) {
+    const auto partitioned_join =
+        std::make_shared<JoinHash>(partitioned_left, partitioned_right_scanned, mode,
+                                   ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    partitioned_join->execute();
+    EXPECT_NE(partitioned_join->description(DescriptionMode::SingleLine).find("Partition-wise (4 partitions)"),
+              std::string::npos);
+
+    const auto join = std::make_shared<JoinHash>(left, right_scanned, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                 PredicateCondition::Equals);
+    join->execute();
+    EXPECT_EQ(join->description(DescriptionMode::SingleLine).find("Partition-wise"), std::string::npos);
+
+    EXPECT_TABLE_EQ_UNORDERED(partitioned_join->get_output(), join->get_output());
+  }
+
+  // Inputs that are partitioned by other columns are joined as a whole
+  const auto join_on_other_column =
+      std::make_shared<JoinHash>(partitioned_left, partitioned_right, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{1}), PredicateCondition::Equals);
+  join_on_other_column->execute();
+  EXPECT_EQ(join_on_other_column->description(DescriptionMode::SingleLine).find("Partition-wise"), std::string::npos);
+}
+
+TEST_F(JoinHashTest, RecordsStepWalltimes) {
+  auto join = std::make_shared<JoinHash>(_table_tpch_lineitems_scanned, _table_tpch_orders_scanned, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 2);
+  join->execute();
+
+  const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+  EXPECT_GT(performance_data.materialization.count(), 0);
+  EXPECT_GT(performance_data.radix_partitioning.count(), 0);
+  EXPECT_GT(performance_data.build.count(), 0);
+  EXPECT_GT(performance_data.probe.count(), 0);
+  EXPECT_GT(performance_data.output_writing.count(), 0);
+
+  const auto step_walltimes = performance_data.step_walltimes();
+  ASSERT_EQ(step_walltimes.size(), 5u);
+  EXPECT_EQ(step_walltimes.front().first, "materialization");
+  EXPECT_EQ(step_walltimes.back().first, "output_writing");
+  EXPECT_NE(performance_data.to_string(DescriptionMode::MultiLine).find("\nmaterialization: "), std::string::npos);
+}
+
+TEST_F(JoinHashTest, TracksAndLimitsIntermediateMemory) {
+  // The orderkeys of the lineitems are not unique, so that the hash table allocates position lists from the resource
+  const auto query_memory_resource = std::make_shared<QueryMemoryResource>();
+  auto join = std::make_shared<JoinHash>(_table_tpch_lineitems_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->set_query_memory_resource_recursively(query_memory_resource);
+  join->execute();
+
+  EXPECT_GT(join->performance_data().peak_memory_bytes, 0u);
+  EXPECT_GE(query_memory_resource->allocated_bytes(), join->performance_data().peak_memory_bytes);
+  EXPECT_NE(join->performance_data().to_string().find("peak memory"), std::string::npos);
+
+  // Without a CancellationToken, e.g., outside of an SQLPipeline, the exception reaches whoever executes the operator.
+  // Without radix bits, the join cannot spill partitions (see SpillsPartitionsExceedingTheMemoryBudget).
+  const auto limited_memory_resource = std::make_shared<QueryMemoryResource>(1);
+  auto limited_join =
+      std::make_shared<JoinHash>(_table_tpch_lineitems_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 0);
+  limited_join->set_query_memory_resource_recursively(limited_memory_resource);
+  EXPECT_THROW(limited_join->execute(), MemoryBudgetExceededException);
+  EXPECT_TRUE(limited_memory_resource->budget_exceeded_message());
+}
+
+TEST_F(JoinHashTest, SpillsPartitionsExceedingTheMemoryBudget) {
+  const auto join_modes = {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti};
+  for (const auto join_mode : join_modes) {
+    SCOPED_TRACE(join_mode_to_string.at(join_mode));
+
+    auto join = std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, join_mode,
+                                           ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    join->execute();
+
+    const auto written_bytes = TempFileManager::get().written_bytes();
+    auto spilling_join = std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned,
+                                                    join_mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                    PredicateCondition::Equals);
+    spilling_join->set_query_memory_resource_recursively(std::make_shared<QueryMemoryResource>(64'000));
+    spilling_join->execute();
+
+    EXPECT_GT(TempFileManager::get().written_bytes(), written_bytes);
+    EXPECT_NE(spilling_join->description(DescriptionMode::SingleLine).find("Spilled"), std::string::npos);
+    EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), join->get_output());
+  }
+}
+
+TEST_F(JoinHashTest, SpillsStringPartitions) {
+  // The comments of the orders are joined with themselves
+  auto join = std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_orders_scanned, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{8}, ColumnID{8}), PredicateCondition::Equals);
+  join->execute();
+
+  auto spilling_join =
+      std::make_shared<JoinHash>(_table_tpch_orders_scanned, _table_tpch_orders_scanned, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{8}, ColumnID{8}), PredicateCondition::Equals);
+  spilling_join->set_query_memory_resource_recursively(std::make_shared<QueryMemoryResource>(32'000));
+  spilling_join->execute();
+
+  EXPECT_NE(spilling_join->description(DescriptionMode::SingleLine).find("Spilled"), std::string::npos);
+  EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), join->get_output());
+}
+
+TEST_F(JoinHashTest, MultipleColumnPairs) {
+  // The join on multiple column pairs has the same result as a join on the first pair followed by a scan on the other
+  const auto test_join = [&](const std::shared_ptr<const AbstractOperator>& left,
+                             const std::shared_ptr<const AbstractOperator>& right, const ColumnIDPair& column_ids,
+                             const ColumnIDPair& secondary_column_ids) {
+    const auto left_table = left->get_output();
+    const auto right_table = right->get_output();
+
+    const auto join = std::make_shared<JoinHash>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    join->execute();
+    const auto secondary_column_id_right =
+        ColumnID{static_cast<ColumnID::base_type>(left_table->column_count() + secondary_column_ids.second)};
+    const auto table_scan = std::make_shared<TableScan>(
+        join, equals_(pqp_column_(secondary_column_ids.first,
+                                  left_table->column_data_type(secondary_column_ids.first), true, ""),
+                      pqp_column_(secondary_column_id_right,
+                                  right_table->column_data_type(secondary_column_ids.second), true, "")));
+    table_scan->execute();
+
+    // Without radix bits, the right input is probed chunk by chunk
+    for (const auto radix_bits : {size_t{0}, size_t{2}}) {
+      const auto composite_join =
+          std::make_shared<JoinHash>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals, radix_bits,
+                                     std::vector<ColumnIDPair>{secondary_column_ids});
+      composite_join->execute();
+      EXPECT_TABLE_EQ_UNORDERED(composite_join->get_output(), table_scan->get_output());
+    }
+  };
+
+  // The orders are joined with the other orders of the same customer and priority
+  test_join(_table_tpch_orders, _table_tpch_orders, ColumnIDPair(ColumnID{1}, ColumnID{1}),
+            ColumnIDPair(ColumnID{5}, ColumnID{5}));
+  test_join(_table_tpch_orders_scanned, _table_tpch_orders, ColumnIDPair(ColumnID{5}, ColumnID{5}),
+            ColumnIDPair(ColumnID{1}, ColumnID{1}));
+
+  // Rows with a NULL in any of the columns do not match
+  test_join(_table_with_nulls, _table_with_nulls, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+            ColumnIDPair(ColumnID{1}, ColumnID{1}));
+
+  auto join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_orders, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{1}, ColumnID{1}), PredicateCondition::Equals,
+                                         std::nullopt, std::vector<ColumnIDPair>{{ColumnID{5}, ColumnID{5}}});
+  EXPECT_NE(join->description(DescriptionMode::SingleLine).find("AND o_orderpriority = o_orderpriority"),
+            std::string::npos);
+
+  // Only inner joins are supported
+  EXPECT_THROW(std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_orders, JoinMode::Left,
+                                          ColumnIDPair(ColumnID{1}, ColumnID{1}), PredicateCondition::Equals,
+                                          std::nullopt, std::vector<ColumnIDPair>{{ColumnID{5}, ColumnID{5}}}),
+               std::logic_error);
+}
+
 }  // namespace opossum
@@ -1,3 +1,6 @@
+#include <set>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "operators/join_hash/join_hash_steps.hpp"
@@ -28,19 +31,15 @@ void test_hash_map(const std::vector<T>& values) {
   // With only one offset value passed, one hash map will be created
   EXPECT_EQ(hash_map.size(), 1);
 
-  size_t row_count = 0;
-  for (const auto& pos_list_pair : hash_map.at(0).value()) {
-    row_count += pos_list_pair.second.size();
-  }
-  EXPECT_EQ(row_count, elements.size());
-
-  ASSERT_FALSE(hash_map.at(0).value().empty());  // hash map for first (and only) chunk exists
+  ASSERT_TRUE(hash_map.at(0));  // hash map for first (and only) chunk exists
+  EXPECT_EQ(hash_map.at(0)->row_count(), elements.size());
+  EXPECT_EQ(hash_map.at(0)->distinct_count(), std::set<T>(values.begin(), values.end()).size());
 
   ChunkOffset offset = ChunkOffset{0};
   for (const auto& element : elements) {
     const auto probe_value = element.value;
 
-    const auto result_list = hash_map.at(0).value().at(probe_value);
+    const auto result_list = hash_map.at(0)->find(probe_value);
     const RowID probe_row_id{ChunkID{17}, offset};
     EXPECT_TRUE(std::find(result_list.begin(), result_list.end(), probe_row_id) != result_list.end());
     ++offset;
@@ -70,4 +69,14 @@ TYPED_TEST(JoinHashTypesTest, BuildSingleRowIds) {
   test_hash_map<TypeParam, TypeParam>(values);
 }
 
+TYPED_TEST(JoinHashTypesTest, BuildUniqueAndDuplicateValues) {
+  // Only the values with more than one row get an overflow list
+  std::vector<TypeParam> values;
+  for (int i = 0; i < 500; ++i) {
+    values.push_back(static_cast<TypeParam>(i % 3 == 0 ? i : 1));
+  }
+
+  test_hash_map<TypeParam, TypeParam>(values);
+}
+
 }  // namespace opossum
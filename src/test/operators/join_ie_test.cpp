@@ -0,0 +1,126 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/join_ie.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsJoinIETest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left = _create_table(60, 7, 7);
+    _table_wrapper_right = _create_table(50, 5, 3);
+  }
+
+  // Many duplicate values and some NULLs in both columns
+  static std::shared_ptr<TableWrapper> _create_table(const int row_count, const ChunkOffset chunk_size,
+                                                     const int factor) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("x", DataType::Int, true);
+    column_definitions.emplace_back("y", DataType::Float, true);
+
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+    for (auto row = 0; row < row_count; ++row) {
+      const auto x = row % 13 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(row * factor) % 20};
+      const auto y = row % 11 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<float>(row % 15) / 2.0f};
+      table->append({x, y});
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Compares the JoinIE with a JoinNestedLoop on the first predicate and a TableScan on the second one
+  static void _test_all_predicate_conditions(const std::shared_ptr<const AbstractOperator>& left,
+                                             const std::shared_ptr<const AbstractOperator>& right) {
+    const auto inequalities =
+        std::vector<PredicateCondition>{PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                                        PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+    const auto left_column_count = static_cast<ColumnID::base_type>(left->get_output()->column_count());
+
+    for (const auto predicate_condition : inequalities) {
+      for (const auto secondary_predicate_condition : inequalities) {
+        const auto join_ie =
+            std::make_shared<JoinIE>(left, right, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                     predicate_condition, ColumnIDPair{ColumnID{1}, ColumnID{1}},
+                                     secondary_predicate_condition);
+        join_ie->execute();
+
+        const auto join_nested_loop = std::make_shared<JoinNestedLoop>(
+            left, right, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}}, predicate_condition);
+        join_nested_loop->execute();
+        const auto secondary_predicate = std::make_shared<BinaryPredicateExpression>(
+            secondary_predicate_condition, pqp_column_(ColumnID{1}, DataType::Float, true, "y"),
+            pqp_column_(ColumnID{static_cast<ColumnID::base_type>(left_column_count + 1)}, DataType::Float, true,
+                        "y"));
+        const auto table_scan = std::make_shared<TableScan>(join_nested_loop, secondary_predicate);
+        table_scan->execute();
+
+        EXPECT_TABLE_EQ_UNORDERED(join_ie->get_output(), table_scan->get_output());
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left;
+  std::shared_ptr<TableWrapper> _table_wrapper_right;
+};
+
+TEST_F(OperatorsJoinIETest, AllPredicateConditions) {
+  _test_all_predicate_conditions(_table_wrapper_left, _table_wrapper_right);
+}
+
+TEST_F(OperatorsJoinIETest, ReferenceInputs) {
+  const auto scan_left = std::make_shared<TableScan>(
+      _table_wrapper_left, greater_than_equals_(pqp_column_(ColumnID{0}, DataType::Int, true, "x"), 3));
+  scan_left->execute();
+  const auto scan_right = std::make_shared<TableScan>(
+      _table_wrapper_right, less_than_(pqp_column_(ColumnID{1}, DataType::Float, true, "y"), 6.0f));
+  scan_right->execute();
+
+  _test_all_predicate_conditions(scan_left, scan_right);
+}
+
+TEST_F(OperatorsJoinIETest, ManyMarkedRows) {
+  // More than 4096 right rows, so that the second level of the bit array has more than one word
+  const auto table_wrapper_right = _create_table(5'000, 1'000, 11);
+  _test_all_predicate_conditions(_table_wrapper_left, table_wrapper_right);
+}
+
+TEST_F(OperatorsJoinIETest, EmptyInput) {
+  const auto scan_right = std::make_shared<TableScan>(
+      _table_wrapper_right, less_than_(pqp_column_(ColumnID{0}, DataType::Int, true, "x"), -1));
+  scan_right->execute();
+
+  const auto join_ie = std::make_shared<JoinIE>(
+      _table_wrapper_left, scan_right, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::LessThan, ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan);
+  join_ie->execute();
+  EXPECT_EQ(join_ie->get_output()->row_count(), 0u);
+  EXPECT_EQ(join_ie->get_output()->column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinIETest, UnsupportedPredicates) {
+  EXPECT_THROW(std::make_shared<JoinIE>(_table_wrapper_left, _table_wrapper_right, JoinMode::Inner,
+                                        ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                        ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan),
+               std::logic_error);
+  EXPECT_THROW(std::make_shared<JoinIE>(_table_wrapper_left, _table_wrapper_right, JoinMode::Left,
+                                        ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan,
+                                        ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan),
+               std::logic_error);
+}
+
+}  // namespace opossum
@@ -551,4 +551,25 @@ TYPED_TEST(JoinIndexTest, LeftJoinEmptyRefSegment) {
                          "resources/test_data/tbl/joinoperators/int_join_empty_left.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, LeftJoinDuplicateProbeKeys) {
+  // The first chunk of the left input holds 12345 twice, for which the index is looked up only once
+  auto join = std::make_shared<JoinIndex>(this->_table_wrapper_b, this->_table_wrapper_a, JoinMode::Left,
+                                          std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                                          PredicateCondition::Equals);
+  join->execute();
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Float, false);
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Float, true);
+  const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({12345, 456.7f, 12345, 458.7f});
+  expected_result->append({12345, 457.7f, 12345, 458.7f});
+  expected_result->append({123, 458.7f, 123, 456.7f});
+  expected_result->append({12, 350.7f, NullValue{}, NullValue{}});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
 }  // namespace opossum
@@ -0,0 +1,73 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinNestedLoopTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The right chunks are larger than a block of the JoinNestedLoop (2048 values), the left ones are small, so that
+    // there are many pairs of chunks
+    _table_wrapper_left = _create_table(100, 30, 7);
+    _table_wrapper_right = _create_table(3'000, 2'500, 13);
+  }
+
+  static std::shared_ptr<TableWrapper> _create_table(const int row_count, const ChunkOffset chunk_size,
+                                                     const int factor) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+    for (auto row = 0; row < row_count; ++row) {
+      table->append({(row * factor) % 100, row});
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  void _test_against_join_sort_merge() {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Outer}) {
+      for (const auto predicate_condition :
+           {PredicateCondition::Equals, PredicateCondition::LessThan, PredicateCondition::GreaterThanEquals}) {
+        const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+        auto join_nested_loop = std::make_shared<JoinNestedLoop>(_table_wrapper_left, _table_wrapper_right, mode,
+                                                                 column_ids, predicate_condition);
+        join_nested_loop->execute();
+        auto join_sort_merge = std::make_shared<JoinSortMerge>(_table_wrapper_left, _table_wrapper_right, mode,
+                                                               column_ids, predicate_condition);
+        join_sort_merge->execute();
+
+        EXPECT_TABLE_EQ_UNORDERED(join_nested_loop->get_output(), join_sort_merge->get_output());
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left;
+  std::shared_ptr<TableWrapper> _table_wrapper_right;
+};
+
+TEST_F(OperatorsJoinNestedLoopTest, ManyChunksAndBlocks) { _test_against_join_sort_merge(); }
+
+TEST_F(OperatorsJoinNestedLoopTest, ManyChunksAndBlocksWithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  _test_against_join_sort_merge();
+}
+
+}  // namespace opossum
@@ -10,6 +10,7 @@
 #include "join_test.hpp"
 
 #include "operators/get_table.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_mpsm.hpp"
 #include "operators/join_nested_loop.hpp"
@@ -57,7 +58,7 @@ class JoinNullTest : public JoinTest {
   inline static std::shared_ptr<TableWrapper> _table_wrapper_null_and_zero;
 };
 
-using JoinNullTypes = ::testing::Types<JoinHash, JoinSortMerge, JoinNestedLoop, JoinMPSM>;
+using JoinNullTypes = ::testing::Types<JoinHash, JoinSortMerge, JoinNestedLoop, JoinMPSM, JoinAdaptive>;
 TYPED_TEST_CASE(JoinNullTest, JoinNullTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(JoinNullTest, InnerJoinWithNull) {
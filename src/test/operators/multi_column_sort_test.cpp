@@ -0,0 +1,118 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/multi_column_sort.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsMultiColumnSortTest : public BaseTestWithParam<EncodingType> {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("int", DataType::Int, true);
+    column_definitions.emplace_back("long", DataType::Long);
+    column_definitions.emplace_back("float", DataType::Float, true);
+    column_definitions.emplace_back("double", DataType::Double);
+    column_definitions.emplace_back("string", DataType::String, true);
+    column_definitions.emplace_back("row", DataType::Int);
+
+    // Few distinct values per column, negative numbers, NULLs and strings that are prefixes of each other
+    const auto strings = std::vector<std::string>{"", "a", "ab", "abc", "b", "ba", "Z"};
+
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+    for (auto row = 0; row < 1'000; ++row) {
+      const auto int_value = row % 11 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(row * 7) % 5 - 2};
+      const auto float_value =
+          row % 17 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<float>((row * 3) % 7) - 3.5f};
+      const auto string_value =
+          row % 23 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{strings[(row * 5) % strings.size()]};
+      table->append({int_value, int64_t{(row % 3) - 1} * int64_t{10'000'000'000}, float_value,
+                     static_cast<double>(row % 4) * -0.25, string_value, row});
+    }
+    ChunkEncoder::encode_all_chunks(table, GetParam());
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // MultiColumnSort has to match a chain of stable single-column Sorts, starting with the least significant column
+  void test_sort(const std::vector<ColumnID>& column_ids, const std::vector<OrderByMode>& order_by_modes) {
+    std::shared_ptr<AbstractOperator> sort = _table_wrapper;
+    for (auto sort_column_idx = column_ids.size(); sort_column_idx > 0; --sort_column_idx) {
+      sort = std::make_shared<Sort>(sort, column_ids[sort_column_idx - 1], order_by_modes[sort_column_idx - 1]);
+      sort->execute();
+    }
+
+    auto multi_column_sort = std::make_shared<MultiColumnSort>(_table_wrapper, column_ids, order_by_modes, 300);
+    multi_column_sort->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(multi_column_sort->get_output(), sort->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsMultiColumnSortTest,
+                        ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength),
+                        formatter);
+
+TEST_P(OperatorsMultiColumnSortTest, AllOrderByModes) {
+  for (const auto first_order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending,
+                                         OrderByMode::AscendingNullsLast, OrderByMode::DescendingNullsLast}) {
+    for (const auto second_order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending,
+                                            OrderByMode::AscendingNullsLast, OrderByMode::DescendingNullsLast}) {
+      test_sort({ColumnID{0}, ColumnID{2}}, {first_order_by_mode, second_order_by_mode});
+    }
+  }
+}
+
+TEST_P(OperatorsMultiColumnSortTest, AllDataTypes) {
+  test_sort({ColumnID{4}, ColumnID{1}, ColumnID{3}}, {OrderByMode::Ascending, OrderByMode::Descending,
+                                                      OrderByMode::Ascending});
+  test_sort({ColumnID{3}, ColumnID{4}, ColumnID{0}, ColumnID{2}},
+            {OrderByMode::Descending, OrderByMode::DescendingNullsLast, OrderByMode::AscendingNullsLast,
+             OrderByMode::Ascending});
+}
+
+TEST_P(OperatorsMultiColumnSortTest, SingleColumn) { test_sort({ColumnID{4}}, {OrderByMode::Descending}); }
+
+TEST_P(OperatorsMultiColumnSortTest, WithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  test_sort({ColumnID{1}, ColumnID{4}, ColumnID{0}},
+            {OrderByMode::Descending, OrderByMode::AscendingNullsLast, OrderByMode::Ascending});
+}
+
+TEST_P(OperatorsMultiColumnSortTest, EmptyInput) {
+  auto empty_table = std::make_shared<Table>(_table_wrapper->get_output()->column_definitions(), TableType::Data);
+  auto table_wrapper = std::make_shared<TableWrapper>(empty_table);
+  table_wrapper->execute();
+
+  auto multi_column_sort = std::make_shared<MultiColumnSort>(
+      table_wrapper, std::vector<ColumnID>{ColumnID{0}, ColumnID{4}},
+      std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Descending});
+  multi_column_sort->execute();
+
+  EXPECT_EQ(multi_column_sort->get_output()->row_count(), 0u);
+  EXPECT_EQ(multi_column_sort->get_output()->column_count(), 6u);
+}
+
+}  // namespace opossum
@@ -167,6 +167,26 @@ TEST_F(OperatorDeepCopyTest, DeepCopyTableScan) {
   EXPECT_TABLE_EQ_UNORDERED(copied_scan->get_output(), expected_result);
 }
 
+TEST_F(OperatorDeepCopyTest, DeepCopyWithParameters) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto parameter = correlated_parameter_(ParameterID{0}, column_a);
+  const auto predicate = greater_than_equals_(column_a, parameter);
+  const auto scan_a = std::make_shared<TableScan>(_table_wrapper_a, predicate);
+  const auto scan_b = create_table_scan(scan_a, ColumnID{1}, PredicateCondition::LessThan, 458.0f);
+
+  const auto copied_scan = scan_b->deep_copy({{ParameterID{0}, 1234}});
+  copied_scan->mutable_input_left()->mutable_input_left()->execute();
+  copied_scan->mutable_input_left()->execute();
+  copied_scan->execute();
+  EXPECT_EQ(copied_scan->get_output()->row_count(), 1u);
+
+  // Only the copied predicate with the parameter has its value
+  const auto copied_predicate = std::static_pointer_cast<const TableScan>(copied_scan->input_left())->predicate();
+  EXPECT_NE(copied_predicate, predicate);
+  EXPECT_FALSE(parameter->value());
+  EXPECT_EQ(std::static_pointer_cast<const TableScan>(copied_scan)->predicate(), scan_b->predicate());
+}
+
 TEST_F(OperatorDeepCopyTest, DiamondShape) {
   auto scan_a = create_table_scan(_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
   scan_a->execute();
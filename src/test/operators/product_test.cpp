@@ -10,6 +10,10 @@
 #include "operators/product.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -57,4 +61,27 @@ TEST_F(OperatorsProductTest, SelfProduct) {
   EXPECT_TABLE_EQ_UNORDERED(product->get_output(), expected_result);
 }
 
+TEST_F(OperatorsProductTest, ParallelChunkPairsKeepTheirOrder) {
+  auto product = std::make_shared<Product>(_table_wrapper_a, _table_wrapper_c);
+  product->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  auto parallel_product = std::make_shared<Product>(_table_wrapper_a, _table_wrapper_c);
+  parallel_product->execute();
+
+  const auto output = parallel_product->get_output();
+  EXPECT_EQ(output->chunk_count(), _table_wrapper_a->get_output()->chunk_count() *
+                                       _table_wrapper_c->get_output()->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(output, product->get_output());
+
+  // The positions of the left chunk are repeated for each row of the right chunk
+  const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(
+                              output->get_chunk(ChunkID{1})->get_segment(ColumnID{0}))->pos_list();
+  const auto right_chunk_size = _table_wrapper_c->get_output()->get_chunk(ChunkID{1})->size();
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.front(), RowID(ChunkID{0}, ChunkOffset{0}));
+  EXPECT_EQ(pos_list[right_chunk_size], RowID(ChunkID{0}, ChunkOffset{1}));
+}
+
 }  // namespace opossum
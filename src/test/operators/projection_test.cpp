@@ -13,7 +13,11 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -54,6 +58,40 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, ParallelWithCommonSubexpressions) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto a_times_b_plus_a = add_(mul_(a_a, a_b), a_a);
+  const auto a_times_b_minus_a = sub_(mul_(a_a, a_b), a_a);
+
+  const auto projection =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(a_times_b_plus_a, a_times_b_minus_a));
+  projection->execute();
+
+  // Projections of the single expressions do not share any subexpressions
+  const auto projection_plus =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(a_times_b_plus_a));
+  projection_plus->execute();
+  const auto projection_minus =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(a_times_b_minus_a));
+  projection_minus->execute();
+
+  const auto& output = projection->get_output();
+  const auto& input = table_wrapper_a->get_output();
+  ASSERT_EQ(output->chunk_count(), input->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < input->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->size(), input->get_chunk(chunk_id)->size());
+  }
+
+  for (auto row_idx = size_t{0}; row_idx < input->row_count(); ++row_idx) {
+    EXPECT_EQ(output->get_value<float>(ColumnID{0}, row_idx),
+              projection_plus->get_output()->get_value<float>(ColumnID{0}, row_idx));
+    EXPECT_EQ(output->get_value<float>(ColumnID{1}, row_idx),
+              projection_minus->get_output()->get_value<float>(ColumnID{0}, row_idx));
+  }
+}
+
 TEST_F(OperatorsProjectionTest, ForwardsIfPossibleDataTable) {
   // The Projection will forward segments from its input if all expressions are segment references.
   // Why would you enforce something like this? E.g., Update relies on it.
@@ -110,6 +148,47 @@ TEST_F(OperatorsProjectionTest, ForwardsIfPossibleReferenceTable) {
             projection->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
 }
 
+TEST_F(OperatorsProjectionTest, StringFunctionsOnDictionarySegments) {
+  const auto values = std::vector<std::optional<std::string>>{"0301", "0302", "0401", std::nullopt, "0501", "0302"};
+  const auto make_table = [&]() {
+    const auto table =
+        std::make_shared<Table>(TableColumnDefinitions{{"s", DataType::String, true}}, TableType::Data, 3);
+    for (const auto& value : values) {
+      table->append({value ? AllTypeVariant{*value} : AllTypeVariant{NULL_VALUE}});
+    }
+    return table;
+  };
+
+  const auto encoded_table = make_table();
+  ChunkEncoder::encode_all_chunks(encoded_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+  const auto table_wrapper = std::make_shared<TableWrapper>(make_table());
+  table_wrapper->execute();
+
+  const auto s = PQPColumnExpression::from_table(*encoded_table, "s");
+  const auto expressions = expression_vector(substr_(s, 1, 2), concat_("x", s), concat_(s, s, substr_(s, 3, 2)));
+
+  const auto projection = std::make_shared<Projection>(encoded_table_wrapper, expressions);
+  projection->execute();
+  const auto expected_projection = std::make_shared<Projection>(table_wrapper, expressions);
+  expected_projection->execute();
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), expected_projection->get_output());
+
+  // The functions are evaluated on the dictionaries, and the attribute vector is reused if the order is preserved
+  const auto input_segment = std::dynamic_pointer_cast<const DictionarySegment<std::string>>(
+      encoded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  const auto output_chunk = projection->get_output()->get_chunk(ChunkID{0});
+  const auto prefix_segment =
+      std::dynamic_pointer_cast<const DictionarySegment<std::string>>(output_chunk->get_segment(ColumnID{0}));
+  const auto concat_segment =
+      std::dynamic_pointer_cast<const DictionarySegment<std::string>>(output_chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(input_segment && prefix_segment && concat_segment);
+  EXPECT_EQ(*prefix_segment->dictionary(), (pmr_vector<std::string>{"03", "04"}));
+  EXPECT_NE(prefix_segment->attribute_vector(), input_segment->attribute_vector());
+  EXPECT_EQ(concat_segment->attribute_vector(), input_segment->attribute_vector());
+}
+
 TEST_F(OperatorsProjectionTest, SetParameters) {
   const auto table_scan_a = create_table_scan(table_wrapper_b, ColumnID{1}, PredicateCondition::GreaterThan, 5);
   const auto projection_a = std::make_shared<Projection>(table_scan_a, expression_vector(b_a));
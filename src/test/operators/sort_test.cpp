@@ -12,10 +12,15 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/query_memory_resource.hpp"
+#include "utils/temp_file_manager.hpp"
 
 namespace opossum {
 
@@ -236,4 +241,88 @@ TEST_P(OperatorsSortTest, SortAfterOuterJoin) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, ParallelSortIsStable) {
+  // With a scheduler, the chunks are sorted in parallel and merged afterwards. This has to produce the same (stable)
+  // result as the single-threaded sort. The table is large enough for the merges to be split into multiple jobs.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("key", DataType::Int, true);
+  column_definitions.emplace_back("row", DataType::Int);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+  for (auto row = 0; row < 150'000; ++row) {
+    const auto key = row % 97 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(row * 7919) % 1'000};
+    table->append({key, row});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    auto single_threaded_sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, order_by_mode);
+    single_threaded_sort->execute();
+
+    Topology::use_fake_numa_topology(8, 4);
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+    auto parallel_sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, order_by_mode);
+    parallel_sort->execute();
+
+    CurrentScheduler::set(nullptr);
+
+    EXPECT_TABLE_EQ_ORDERED(parallel_sort->get_output(), single_threaded_sort->get_output());
+  }
+}
+
+TEST_P(OperatorsSortTest, RecordsStepWalltimes) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sort->execute();
+
+  const auto step_walltimes = sort->performance_data().step_walltimes();
+  ASSERT_EQ(step_walltimes.size(), 3u);
+  EXPECT_EQ(step_walltimes[0].first, "materialization");
+  EXPECT_EQ(step_walltimes[1].first, "sort");
+  EXPECT_EQ(step_walltimes[2].first, "output_writing");
+  EXPECT_GT(step_walltimes[2].second.count(), 0);
+  EXPECT_NE(sort->performance_data().to_string().find("output_writing: "), std::string::npos);
+}
+
+TEST_P(OperatorsSortTest, ExternalSortIsStable) {
+  // If the sort column exceeds the memory budget, sorted runs are spilled and merged. This has to produce the same
+  // (stable) result as the in-memory sort.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("key", DataType::Int, true);
+  column_definitions.emplace_back("name", DataType::String, true);
+  column_definitions.emplace_back("row", DataType::Int);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row = 0; row < 20'000; ++row) {
+    const auto key = row % 97 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(row * 7919) % 1'000};
+    const auto name = row % 89 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{"name" + std::to_string(row % 311)};
+    table->append({key, name, row});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+    for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                     OrderByMode::DescendingNullsLast}) {
+      auto sort = std::make_shared<Sort>(table_wrapper, column_id, order_by_mode, 700);
+      sort->execute();
+
+      const auto written_bytes = TempFileManager::get().written_bytes();
+      auto external_sort = std::make_shared<Sort>(table_wrapper, column_id, order_by_mode, 700);
+      external_sort->set_query_memory_resource_recursively(std::make_shared<QueryMemoryResource>(50'000));
+      external_sort->execute();
+
+      EXPECT_GT(TempFileManager::get().written_bytes(), written_bytes);
+      EXPECT_EQ(external_sort->get_output()->chunk_count(), sort->get_output()->chunk_count());
+      EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), sort->get_output());
+    }
+  }
+}
+
 }  // namespace opossum
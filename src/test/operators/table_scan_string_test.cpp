@@ -68,7 +68,8 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanStringTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                          EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                          EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                          EncodingType::FrontCodedDictionary),
                         formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
@@ -315,4 +316,30 @@ TEST_P(OperatorsTableScanStringTest, ScanNotLikeUnderscoreWildcardOnDict) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanLikeReusesCachedDictionaryMatches) {
+  auto& cache = LikeDictionaryMatchesCache::get();
+  cache.clear();
+
+  const auto is_dictionary_encoded = GetParam() == EncodingType::Dictionary ||
+                                     GetParam() == EncodingType::FixedStringDictionary ||
+                                     GetParam() == EncodingType::FrontCodedDictionary;
+  const auto expected_cache_size = is_dictionary_encoded ? _gt_string_compressed->get_output()->chunk_count() : 0u;
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_starting.tbl", 1);
+  for (auto run = 0; run < 2; ++run) {
+    auto scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::Like, "Dampf%");
+    scan->execute();
+    EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+    EXPECT_EQ(cache.size(), expected_cache_size);
+  }
+
+  // NOT LIKE shares the cached matches of LIKE
+  std::shared_ptr<Table> expected_inverted_result =
+      load_table("resources/test_data/tbl/int_string_like_not_starting.tbl", 1);
+  auto scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_inverted_result);
+  EXPECT_EQ(cache.size(), expected_cache_size);
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -11,16 +12,20 @@
 #include "gtest/gtest.h"
 
 #include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/limit.hpp"
 #include "operators/print.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_in_hash_set_table_scan_impl.hpp"
 #include "operators/table_scan/column_is_null_table_scan_impl.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/conjunction_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -241,7 +246,7 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
-                                          EncodingType::FrameOfReference),
+                                          EncodingType::FrameOfReference, EncodingType::Delta),
                         formatter);
 
 TEST_P(OperatorsTableScanTest, DoubleScan) {
@@ -778,6 +783,204 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksAtRuntime) {
+  // The chunks hold the values [0, 10), [10, 20), and [20, 30)
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int);
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto value = 0; value < 30; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table, GetParam());
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto parameter = correlated_parameter_(ParameterID{2}, column);
+
+  const auto test_pruning = [&](const std::shared_ptr<AbstractExpression>& predicate, const AllTypeVariant& value,
+                                const std::vector<ChunkID>& expected_pruned_chunk_ids,
+                                const size_t expected_row_count) {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    scan->set_parameters({{ParameterID{2}, value}});
+    scan->execute();
+
+    EXPECT_EQ(scan->pruned_chunk_ids(), expected_pruned_chunk_ids);
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count);
+
+    const auto& performance_data = static_cast<const TableScan::PerformanceData&>(scan->performance_data());
+    EXPECT_EQ(performance_data.chunks_pruned, expected_pruned_chunk_ids.size());
+    EXPECT_EQ(performance_data.chunks_scanned, 3 - expected_pruned_chunk_ids.size());
+    EXPECT_EQ(performance_data.chunks_excluded, 0u);
+  };
+
+  test_pruning(greater_than_equals_(column, parameter), 20, {ChunkID{0}, ChunkID{1}}, 10);
+  test_pruning(less_than_(parameter, column), 14, {ChunkID{0}}, 15);
+  test_pruning(equals_(column, parameter), 12, {ChunkID{0}, ChunkID{2}}, 1);
+  test_pruning(between_(column, parameter, 25), 8, {}, 18);
+  test_pruning(and_(less_than_equals_(column, 12), greater_than_(column, parameter)), 9, {ChunkID{0}, ChunkID{2}}, 3);
+
+  // The dictionaries and statistics say nothing about values of other types, e.g., whether `a < 9.5` matches 9
+  test_pruning(less_than_(column, parameter), 9.5, {}, 10);
+
+  // The chunks of reference tables are not pruned
+  const auto reference_scan = std::make_shared<TableScan>(table_wrapper, less_than_(column, 30));
+  reference_scan->execute();
+  const auto scan = std::make_shared<TableScan>(reference_scan, greater_than_equals_(column, parameter));
+  scan->set_parameters({{ParameterID{2}, 20}});
+  scan->execute();
+  EXPECT_TRUE(scan->pruned_chunk_ids().empty());
+  EXPECT_EQ(scan->get_output()->row_count(), 10u);
+}
+
+TEST_P(OperatorsTableScanTest, InScan) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  auto tests = std::vector<std::pair<std::shared_ptr<AbstractExpression>, std::vector<AllTypeVariant>>>{};
+  tests.emplace_back(in_(column_a, list_(0, 6, 7, 12)), std::vector<AllTypeVariant>{100, 106, 112, 100, 106, 112});
+  tests.emplace_back(not_in_(column_a, list_(0, 6, 7, 12)),
+                     std::vector<AllTypeVariant>{102, 104, 108, 110, 102, 104, 108, 110});
+  tests.emplace_back(not_in_(column_a, list_(1, 3)), std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 100,
+                                                                               102, 104, 106, 108, 110, 112});
+  // More values than a dictionary has entries
+  tests.emplace_back(in_(column_a, list_(0, 1, 2, 3, 4, 5, 6, 7, 8)),
+                     std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 100, 102, 104, 106, 108});
+  tests.emplace_back(in_(column_a, list_(6, null_())), std::vector<AllTypeVariant>{106, 106});
+  tests.emplace_back(not_in_(column_a, list_(6, null_())), std::vector<AllTypeVariant>{});
+
+  const auto referencing_table_wrapper =
+      std::make_shared<TableWrapper>(to_referencing_table(_int_int_partly_compressed->get_output()));
+  referencing_table_wrapper->execute();
+
+  for (const auto& [predicate, expected] : tests) {
+    for (const auto& table_wrapper : {_int_int_compressed, _int_int_partly_compressed, referencing_table_wrapper}) {
+      auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+      scan->execute();
+
+      EXPECT_TRUE(dynamic_cast<ColumnInHashSetTableScanImpl*>(scan->create_impl().get()));
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, InScanWithLongListAndParameters) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  // Multiples of three, plus a parameter that is set before the execution
+  auto elements = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto value = 0; value < 3'000; value += 3) {
+    elements.emplace_back(value_(value));
+  }
+  elements.emplace_back(correlated_parameter_(ParameterID{0}, column_a));
+  const auto predicate = in_(column_a, std::make_shared<ListExpression>(elements));
+
+  for (const auto& table_wrapper : {_int_int_compressed, _int_int_partly_compressed}) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, predicate->deep_copy());
+    scan->set_parameters({{ParameterID{0}, AllTypeVariant{4}}});
+    scan->execute();
+
+    EXPECT_TRUE(dynamic_cast<ColumnInHashSetTableScanImpl*>(scan->create_impl().get()));
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {100, 104, 106, 112, 100, 104, 106, 112});
+  }
+}
+
+TEST_P(OperatorsTableScanTest, InScanOnNullable) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  auto scan_in = std::make_shared<TableScan>(get_int_float_with_null_op(), in_(column_a, list_(123, 1234, 5)));
+  scan_in->execute();
+  ASSERT_COLUMN_EQ(scan_in->get_output(), ColumnID{0}, {123, 1234});
+
+  auto scan_not_in = std::make_shared<TableScan>(get_int_float_with_null_op(), not_in_(column_a, list_(123)));
+  scan_not_in->execute();
+  ASSERT_COLUMN_EQ(scan_not_in->get_output(), ColumnID{0}, {12345, 1234});
+}
+
+TEST_P(OperatorsTableScanTest, InScanWithSubselect) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  const auto subselect_scan = std::make_shared<TableScan>(_int_int_compressed, less_than_(column_a, 5));
+  const auto subselect_pqp = std::make_shared<Projection>(subselect_scan, expression_vector(column_a));
+
+  auto scan = std::make_shared<TableScan>(_int_int_partly_compressed,
+                                          in_(column_a, pqp_select_(subselect_pqp, DataType::Int, false)));
+  scan->execute();
+
+  EXPECT_TRUE(dynamic_cast<ColumnInHashSetTableScanImpl*>(scan->create_impl().get()));
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {100, 102, 104, 100, 102, 104});
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScan) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Int);
+  column_definitions.emplace_back("c", DataType::String);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row = 0; row < 2'500; ++row) {
+    const auto value_a = row % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row % 100};
+    table->append({value_a, (row * 3) % 1'000, std::string(1, static_cast<char>('a' + row % 26))});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::String, false, "c");
+
+  // References single chunks of the data table
+  const auto scan_all = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(b, 0));
+  scan_all->execute();
+  // References multiple chunks in a single chunk
+  const auto referencing_table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(table));
+  referencing_table_wrapper->execute();
+
+  // The conjunctions mix selective and unselective predicates, so that the later predicates are applied both to the
+  // bitmap and through a position filter
+  auto conjunctions = std::vector<std::vector<std::shared_ptr<AbstractExpression>>>{};
+  conjunctions.push_back({greater_than_(b, 10), less_than_(a, 90)});
+  conjunctions.push_back({equals_(a, 42), greater_than_(b, 500), not_equals_(c, "q")});
+  conjunctions.push_back({less_than_(a, 50), equals_(b, 501), like_(c, "%d%")});
+  conjunctions.push_back({is_not_null_(a), between_(b, 100, 200), in_(a, list_(1, 2, 3, 50))});
+  conjunctions.push_back({less_than_(a, b), greater_than_(add_(a, 1), 50)});
+  conjunctions.push_back({equals_(a, 1000), greater_than_(b, 10)});
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, scan_all,
+                                                                          referencing_table_wrapper}) {
+    for (const auto& conjunction : conjunctions) {
+      auto expected_scan = input;
+      for (const auto& predicate : conjunction) {
+        expected_scan = std::make_shared<TableScan>(expected_scan, predicate);
+        expected_scan->execute();
+      }
+
+      const auto scan =
+          std::make_shared<TableScan>(input, inflate_logical_expressions(conjunction, LogicalOperator::And));
+      scan->execute();
+
+      EXPECT_TRUE(dynamic_cast<ConjunctionTableScanImpl*>(scan->create_impl().get()));
+      EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScanEvaluatesExpressionEvaluatorLast) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Float, false, "b");
+
+  const auto predicate =
+      and_(and_(greater_than_(add_(column_a, 1), 5), less_than_(column_b, 6)), like_("hello", "%s%"));
+  const auto scan = TableScan{get_int_float_op(), predicate};
+  const auto impl = scan.create_impl();
+  const auto conjunction_impl = dynamic_cast<ConjunctionTableScanImpl*>(impl.get());
+  ASSERT_TRUE(conjunction_impl);
+  EXPECT_EQ(conjunction_impl->description(), "Conjunction(ColumnVsValue, ExpressionEvaluator, ExpressionEvaluator)");
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -800,11 +1003,15 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
       TableScan{get_int_string_op(), like_(column_s, "%s%")}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
       TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+  EXPECT_TRUE(dynamic_cast<ColumnInHashSetTableScanImpl*>(
       TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ColumnInHashSetTableScanImpl*>(
+      TableScan{get_int_float_op(), not_in_(column_a, list_(1, 2, 3))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
-      TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+      TableScan{get_int_float_op(), in_(column_a, list_(1, 2.5, 3))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), in_(column_a, list_(1, add_(column_a, 1)))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ConjunctionTableScanImpl*>(
       TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
       TableScan{get_int_float_with_null_op(), is_null_(column_an)}.create_impl().get()));
@@ -812,4 +1019,176 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
       TableScan{get_int_float_with_null_op(), is_not_null_(column_an)}.create_impl().get()));
 }
 
+class OperatorsTableScanVectorCompressionTest : public BaseTestWithParam<VectorCompressionType> {};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, OperatorsTableScanVectorCompressionTest,
+                        ::testing::Values(VectorCompressionType::FixedSizeByteAligned,
+                                          VectorCompressionType::SimdBp128));
+
+TEST_P(OperatorsTableScanVectorCompressionTest, ScanOnDictionarySegments) {
+  // The attribute vectors are scanned in blocks. The chunk sizes are no multiples of the block sizes, the second chunk
+  // spans multiple SIMD-BP128 meta blocks, and the columns need 8 and 16 bit value ids.
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Int);
+
+  const auto create_table = [&]() {
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3'000);
+    for (auto row = 0; row < 5'000; ++row) {
+      const auto value_a = row % 13 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(row * 7) % 250};
+      table->append({value_a, (row * 13) % 1'000});
+    }
+    return table;
+  };
+
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(create_table());
+  unencoded_table_wrapper->execute();
+
+  const auto encoded_table = create_table();
+  ChunkEncoder::encode_all_chunks(encoded_table, SegmentEncodingSpec{EncodingType::Dictionary, GetParam()});
+
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto& [column_id, value] : std::vector<std::pair<ColumnID, int32_t>>{
+             {ColumnID{0}, 0}, {ColumnID{0}, 101}, {ColumnID{0}, 249}, {ColumnID{1}, 1}, {ColumnID{1}, 500}}) {
+      const auto expected_scan = create_table_scan(unencoded_table_wrapper, column_id, predicate_condition, value);
+      expected_scan->execute();
+      const auto scan = create_table_scan(encoded_table_wrapper, column_id, predicate_condition, value);
+      scan->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+    }
+  }
+}
+
+class OperatorsTableScanRunLengthTest : public BaseTest {};
+
+TEST_F(OperatorsTableScanRunLengthTest, ScanOnRunLengthSegments) {
+  // Run-length segments are scanned run by run. The runs have varying lengths, include runs of NULLs, and span the
+  // chunk boundaries.
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+
+  const auto create_table = [&]() {
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+    for (auto row = 0; row < 2'500; ++row) {
+      const auto run = row / 37 + row / 101;
+      const auto value_a = run % 7 == 3 ? AllTypeVariant{NullValue{}} : AllTypeVariant{run % 20};
+      table->append({value_a, std::string(1, static_cast<char>('a' + run % 5))});
+    }
+    return table;
+  };
+
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(create_table());
+  unencoded_table_wrapper->execute();
+
+  const auto encoded_table = create_table();
+  ChunkEncoder::encode_all_chunks(encoded_table, SegmentEncodingSpec{EncodingType::RunLength});
+
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto& [column_id, value] : std::vector<std::pair<ColumnID, AllTypeVariant>>{
+             {ColumnID{0}, 0},
+             {ColumnID{0}, 10},
+             {ColumnID{0}, 19},
+             {ColumnID{1}, std::string{"a"}},
+             {ColumnID{1}, std::string{"c"}}}) {
+      const auto expected_scan = create_table_scan(unencoded_table_wrapper, column_id, predicate_condition, value);
+      expected_scan->execute();
+      const auto scan = create_table_scan(encoded_table_wrapper, column_id, predicate_condition, value);
+      scan->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+    }
+  }
+
+  for (const auto& [left_value, right_value] : std::vector<std::pair<int32_t, int32_t>>{{0, 0}, {4, 12}, {15, 30}}) {
+    const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+    const auto expected_scan =
+        std::make_shared<TableScan>(unencoded_table_wrapper, between_(column_a, left_value, right_value));
+    expected_scan->execute();
+    const auto scan = std::make_shared<TableScan>(encoded_table_wrapper, between_(column_a, left_value, right_value));
+    scan->execute();
+
+    EXPECT_TRUE(dynamic_cast<ColumnBetweenTableScanImpl*>(scan->create_impl().get()));
+    EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+  }
+}
+
+class OperatorsTableScanFrameOfReferenceTest : public BaseTestWithParam<VectorCompressionType> {};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, OperatorsTableScanFrameOfReferenceTest,
+                        ::testing::Values(VectorCompressionType::FixedSizeByteAligned,
+                                          VectorCompressionType::SimdBp128));
+
+TEST_P(OperatorsTableScanFrameOfReferenceTest, ScanOnFrameOfReferenceSegments) {
+  // The offsets are compared per block of the segment. The block minima increase, so that the predicates match all,
+  // some, or none of the values of a block, and the values close to the limits of the data types test the offset
+  // range calculation. Each chunk of column b stays within the value range that the offsets can represent.
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Long);
+
+  const auto create_table = [&]() {
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 5'000);
+    for (auto row = 0; row < 10'000; ++row) {
+      const auto value_a = row % 11 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row / 3 + (row * 7) % 100};
+      const auto value_b = row < 5'000 ? std::numeric_limits<int64_t>::min() + row : int64_t{row} * row;
+      table->append({value_a, value_b});
+    }
+    return table;
+  };
+
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(create_table());
+  unencoded_table_wrapper->execute();
+
+  const auto encoded_table = create_table();
+  ChunkEncoder::encode_all_chunks(encoded_table, SegmentEncodingSpec{EncodingType::FrameOfReference, GetParam()});
+
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto& [column_id, value] : std::vector<std::pair<ColumnID, AllTypeVariant>>{
+             {ColumnID{0}, -1},
+             {ColumnID{0}, 0},
+             {ColumnID{0}, 700},
+             {ColumnID{0}, 3'400},
+             {ColumnID{1}, std::numeric_limits<int64_t>::min()},
+             {ColumnID{1}, std::numeric_limits<int64_t>::min() + 2'500},
+             {ColumnID{1}, int64_t{8'000} * 8'000},
+             {ColumnID{1}, std::numeric_limits<int64_t>::max()}}) {
+      const auto expected_scan = create_table_scan(unencoded_table_wrapper, column_id, predicate_condition, value);
+      expected_scan->execute();
+      const auto scan = create_table_scan(encoded_table_wrapper, column_id, predicate_condition, value);
+      scan->execute();
+
+      EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+    }
+  }
+
+  for (const auto& [left_value, right_value] :
+       std::vector<std::pair<int32_t, int32_t>>{{0, 0}, {650, 1'200}, {3'000, 5'000}, {20, 10}}) {
+    const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+    const auto expected_scan =
+        std::make_shared<TableScan>(unencoded_table_wrapper, between_(column_a, left_value, right_value));
+    expected_scan->execute();
+    const auto scan = std::make_shared<TableScan>(encoded_table_wrapper, between_(column_a, left_value, right_value));
+    scan->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,96 @@
+#include <memory>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTestWithParam<EncodingType> {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("key", DataType::Int, true);
+    column_definitions.emplace_back("row", DataType::Int);
+
+    // Many duplicate keys and some NULLs, so that the stability of TopK is tested as well
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+    for (auto row = 0; row < 1'000; ++row) {
+      const auto key = row % 13 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(row * 31) % 50};
+      table->append({key, row});
+    }
+    ChunkEncoder::encode_all_chunks(table, GetParam());
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // TopK has to return the same rows in the same order as a Sort followed by a Limit
+  void test_top_k(const OrderByMode order_by_mode, const int64_t row_count) {
+    auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, order_by_mode);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, to_expression(row_count));
+    limit->execute();
+
+    auto top_k = std::make_shared<TopK>(_table_wrapper, ColumnID{0}, order_by_mode, to_expression(row_count));
+    top_k->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTopKTest,
+                        ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength),
+                        formatter);
+
+TEST_P(OperatorsTopKTest, MatchesSortAndLimit) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    for (const auto row_count : {int64_t{1}, int64_t{10}, int64_t{150}, int64_t{999}}) {
+      test_top_k(order_by_mode, row_count);
+    }
+  }
+}
+
+TEST_P(OperatorsTopKTest, RowCountLargerThanInput) {
+  test_top_k(OrderByMode::Ascending, 5'000);
+  test_top_k(OrderByMode::DescendingNullsLast, 5'000);
+}
+
+TEST_P(OperatorsTopKTest, RowCountZero) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, value_(int64_t{0}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_count(), 2u);
+}
+
+TEST_P(OperatorsTopKTest, WithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  test_top_k(OrderByMode::Ascending, 42);
+  test_top_k(OrderByMode::Descending, 42);
+}
+
+}  // namespace opossum
@@ -54,6 +54,38 @@ TEST_F(OperatorsUnionAllTest, UnionOfValueReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
 }
 
+TEST_F(OperatorsUnionAllTest, ForwardsChunksOfInputs) {
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all->execute();
+
+  const auto& left = _table_wrapper_a->get_output();
+  const auto& right = _table_wrapper_b->get_output();
+  const auto& output = union_all->get_output();
+  ASSERT_EQ(output->chunk_count(), left->chunk_count() + right->chunk_count());
+  EXPECT_EQ(output->get_chunk(ChunkID{0}), left->get_chunk(ChunkID{0}));
+  EXPECT_EQ(output->get_chunk(left->chunk_count()), right->get_chunk(ChunkID{0}));
+}
+
+TEST_F(OperatorsUnionAllTest, UnionOfTablesWithAndWithoutMvcc) {
+  // Same rows as int_float2.tbl, but without MVCC data
+  const auto table_without_mvcc =
+      std::make_shared<Table>(_table_wrapper_b->get_output()->column_definitions(), TableType::Data, 2);
+  table_without_mvcc->append({12345, 456.7f});
+  table_without_mvcc->append({12345, 457.7f});
+  table_without_mvcc->append({123, 458.7f});
+  table_without_mvcc->append({12, 350.7f});
+  const auto table_wrapper_without_mvcc = std::make_shared<TableWrapper>(table_without_mvcc);
+  table_wrapper_without_mvcc->execute();
+
+  // The output has no MVCC data, as the right input has none, so the chunks of the left input cannot be forwarded
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper_a, table_wrapper_without_mvcc);
+  union_all->execute();
+
+  EXPECT_EQ(union_all->get_output()->has_mvcc(), UseMvcc::No);
+  EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(),
+                            load_table("resources/test_data/tbl/int_float_union.tbl", 2));
+}
+
 TEST_F(OperatorsUnionAllTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   std::shared_ptr<Table> test_table_c = load_table("resources/test_data/tbl/int.tbl", 2);
@@ -9,6 +9,9 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -304,4 +307,33 @@ TEST_F(UnionPositionsTest, MultipleShuffledPosList) {
                             load_table("resources/test_data/tbl/union_positions_multiple_shuffled_pos_list.tbl"));
 }
 
+TEST_F(UnionPositionsTest, HashLargeInputs) {
+  /**
+   * Inputs with at least HASH_MIN_ROW_COUNT rows are deduplicated by hashing instead of sorting. Scan a table of
+   * 2 * HASH_MIN_ROW_COUNT rows for two overlapping ranges, so that their union is the entire table again.
+   */
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto row_count = static_cast<int>(2 * UnionPositions::HASH_MIN_ROW_COUNT);
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto value = 0; value < row_count; ++value) table->append({value});
+  StorageManager::get().add_table("large_ints", table);
+
+  auto get_table_a_op = std::make_shared<GetTable>("large_ints");
+  auto get_table_b_op = std::make_shared<GetTable>("large_ints");
+  auto table_scan_a_op =
+      std::make_shared<TableScan>(get_table_a_op, less_than_(_int_column_0_non_nullable, row_count * 3 / 4));
+  auto table_scan_b_op =
+      std::make_shared<TableScan>(get_table_b_op, greater_than_equals_(_int_column_0_non_nullable, row_count / 4));
+  auto union_unique_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+
+  _execute_all({get_table_a_op, get_table_b_op, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  EXPECT_TABLE_EQ_UNORDERED(union_unique_op->get_output(), table);
+}
+
 }  // namespace opossum
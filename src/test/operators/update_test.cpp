@@ -36,7 +36,8 @@ class OperatorsUpdateTest : public BaseTest {
 
   void helper(const std::shared_ptr<AbstractExpression>& where_predicate,
               const std::vector<std::shared_ptr<AbstractExpression>>& update_expressions,
-              const std::string& expected_result_path) {
+              const std::string& expected_result_path,
+              const std::optional<std::vector<ColumnID>>& updated_column_ids = std::nullopt) {
     const auto get_table = std::make_shared<GetTable>(table_to_update_name);
     const auto where_scan = std::make_shared<TableScan>(get_table, where_predicate);
     const auto updated_values_projection = std::make_shared<Projection>(where_scan, update_expressions);
@@ -46,7 +47,8 @@ class OperatorsUpdateTest : public BaseTest {
     updated_values_projection->execute();
 
     const auto transaction_context = TransactionManager::get().new_transaction_context();
-    const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+    const auto update =
+        std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection, updated_column_ids);
     update->set_transaction_context(transaction_context);
     update->execute();
     transaction_context->commit();
@@ -78,6 +80,13 @@ TEST_F(OperatorsUpdateTest, UpdateWithExpression) {
          "resources/test_data/tbl/int_float2_updated_1.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, UpdateSomeColumns) {
+  helper(greater_than_(column_a, 100), expression_vector(7.5f), "resources/test_data/tbl/int_float2_updated_0.tbl",
+         std::vector<ColumnID>{ColumnID{1}});
+  helper(greater_than_(column_a, 1000), expression_vector(cast_(add_(column_a, 100), DataType::Float)),
+         "resources/test_data/tbl/int_float2_updated_1.tbl", std::vector<ColumnID>{ColumnID{1}});
+}
+
 TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
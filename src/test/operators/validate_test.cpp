@@ -13,6 +13,9 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -122,4 +125,64 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateWithScheduler) {
+  // Validate spawns one job per chunk. The output chunks have to keep the order of the input chunks.
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(validate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsValidateTest, ChunkVisibilitySummary) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  const auto mvcc_data_0 = _test_table->get_chunk(ChunkID{0})->mvcc_data();
+  const auto mvcc_data_1 = _test_table->get_chunk(ChunkID{1})->mvcc_data();
+  EXPECT_FALSE(mvcc_data_0->max_begin_cid_of_visible_rows());
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+
+  // All rows of the first chunk are visible, the second chunk contains a deleted row
+  EXPECT_EQ(mvcc_data_0->max_begin_cid_of_visible_rows(), CommitID{0});
+  EXPECT_FALSE(mvcc_data_1->max_begin_cid_of_visible_rows());
+
+  // The second execution uses the fast path for the first chunk
+  auto validate_fast_path = std::make_shared<Validate>(_table_wrapper);
+  validate_fast_path->set_transaction_context(context);
+  validate_fast_path->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate_fast_path->get_output(), expected_result);
+
+  mvcc_data_0->invalidate_visibility_summary();
+  EXPECT_FALSE(mvcc_data_0->max_begin_cid_of_visible_rows());
+
+  // A summary computed before an invalidation must not be published
+  const auto version = mvcc_data_0->visibility_summary_version();
+  mvcc_data_0->invalidate_visibility_summary();
+  mvcc_data_0->set_max_begin_cid_of_visible_rows(CommitID{0}, version);
+  EXPECT_FALSE(mvcc_data_0->max_begin_cid_of_visible_rows());
+
+  mvcc_data_0->set_max_begin_cid_of_visible_rows(CommitID{0}, mvcc_data_0->visibility_summary_version());
+  EXPECT_EQ(mvcc_data_0->max_begin_cid_of_visible_rows(), CommitID{0});
+
+  // A snapshot older than the max begin_cid cannot use the summary
+  mvcc_data_0->invalidate_visibility_summary();
+  mvcc_data_0->set_max_begin_cid_of_visible_rows(CommitID{5}, mvcc_data_0->visibility_summary_version());
+  auto validate_old_snapshot = std::make_shared<Validate>(_table_wrapper);
+  validate_old_snapshot->set_transaction_context(context);
+  validate_old_snapshot->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate_old_snapshot->get_output(), expected_result);
+}
+
 }  // namespace opossum
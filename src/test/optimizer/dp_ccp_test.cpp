@@ -259,4 +259,23 @@ TEST_F(DpCcpTest, UncorrelatedPredicates) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(DpCcpTest, MaxCsgCmpPairCount) {
+  // The triangle of vertices has six CsgCmpPairs. If DpCcp may not cost that many, it gives up before building any
+  // plan.
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+  const auto join_edge_a = JoinGraphEdge{JoinGraphVertexSet{3, 0b001}, expression_vector(greater_than_(a_a, 5))};
+
+  const auto join_graph =
+      JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c, join_edge_a}));
+
+  EXPECT_EQ(DpCcp(cost_estimator, 5)(join_graph), nullptr);
+  EXPECT_TRUE(node_a->outputs().empty());
+
+  EXPECT_NE(DpCcp(cost_estimator, 6)(join_graph), nullptr);
+}
+
 }  // namespace opossum
@@ -120,6 +120,18 @@ TEST(EnumerateCcpTest, Clique) {
   EXPECT_TRUE(equals(pairs[24], std::make_pair(0b1101ul, 0b0010ul)));
 }
 
+TEST(EnumerateCcpTest, MaxCsgCmpPairCount) {
+  std::vector<std::pair<size_t, size_t>> edges{{0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 3}, {1, 3}};
+
+  // The clique has 25 CsgCmpPairs
+  EXPECT_EQ(EnumerateCcp(4, edges, 25)().size(), 25u);
+
+  // The enumeration stops once there are more CsgCmpPairs than allowed
+  const auto pairs = EnumerateCcp(4, edges, 10)();
+  EXPECT_GT(pairs.size(), 10u);
+  EXPECT_LT(pairs.size(), 25u);
+}
+
 TEST(EnumerateCcpTest, RandomJoinGraphShape) {
   /**
    *    0
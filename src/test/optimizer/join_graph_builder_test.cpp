@@ -182,6 +182,49 @@ TEST_F(JoinGraphBuilderTest, ComputedExpression) {
   EXPECT_EQ(*join_graph->edges.at(1).predicates.at(0), *equals_(c_a, a_a));
 }
 
+TEST_F(JoinGraphBuilderTest, TransitivePredicates) {
+  // The predicates on a_a and c_a hold for all columns that are equal to them
+
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(less_than_(a_a, 10),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      node_a,
+      JoinNode::make(JoinMode::Inner, equals_(c_a, b_a),
+        PredicateNode::make(greater_than_(b_b, 5),
+          node_b),
+        PredicateNode::make(between_(c_a, 3, 7),
+          node_c))));
+  // clang-format on
+
+  const auto join_graph = JoinGraphBuilder()(lqp);
+  ASSERT_TRUE(join_graph);
+
+  ASSERT_EQ(join_graph->vertices.size(), 3u);
+  EXPECT_EQ(join_graph->vertices.at(0), node_a);
+  EXPECT_EQ(join_graph->vertices.at(1), node_b);
+  EXPECT_EQ(join_graph->vertices.at(2), node_c);
+
+  const auto local_predicates_a = join_graph->find_local_predicates(0);
+  ASSERT_EQ(local_predicates_a.size(), 2u);
+  EXPECT_EQ(*local_predicates_a.at(0), *less_than_(a_a, 10));
+  EXPECT_EQ(*local_predicates_a.at(1), *between_(a_a, 3, 7));
+
+  const auto local_predicates_b = join_graph->find_local_predicates(1);
+  ASSERT_EQ(local_predicates_b.size(), 3u);
+  EXPECT_EQ(*local_predicates_b.at(0), *greater_than_(b_b, 5));
+  EXPECT_EQ(*local_predicates_b.at(1), *less_than_(b_a, 10));
+  EXPECT_EQ(*local_predicates_b.at(2), *between_(b_a, 3, 7));
+
+  const auto local_predicates_c = join_graph->find_local_predicates(2);
+  ASSERT_EQ(local_predicates_c.size(), 2u);
+  EXPECT_EQ(*local_predicates_c.at(0), *between_(c_a, 3, 7));
+  EXPECT_EQ(*local_predicates_c.at(1), *less_than_(c_a, 10));
+
+  // No equi-join predicate is derived, they would only be redundant
+  EXPECT_EQ(join_graph->find_join_predicates(JoinGraphVertexSet(3, 0b001), JoinGraphVertexSet(3, 0b100)).size(), 0u);
+}
+
 TEST_F(JoinGraphBuilderTest, OuterJoin) {
   // Test that outer joins are treated as vertices
 
@@ -286,6 +329,32 @@ TEST_F(JoinGraphBuilderTest, NonJoinGraphJoin) {
   ASSERT_FALSE(join_graph);
 }
 
+TEST_F(JoinGraphBuilderTest, BetweenWithColumnBoundsIsSplit) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(between_(a_a, b_a, b_b),
+    PredicateNode::make(between_(a_b, 3, 7),
+      JoinNode::make(JoinMode::Cross,
+        node_a,
+        node_b)));
+  // clang-format on
+
+  const auto join_graph = JoinGraphBuilder()(lqp);
+  ASSERT_TRUE(join_graph);
+
+  ASSERT_EQ(join_graph->edges.size(), 2u);
+
+  EXPECT_EQ(join_graph->edges.at(0).vertex_set, JoinGraphVertexSet(2, 0b11));
+  ASSERT_EQ(join_graph->edges.at(0).predicates.size(), 2u);
+  EXPECT_EQ(*join_graph->edges.at(0).predicates.at(0), *greater_than_equals_(a_a, b_a));
+  EXPECT_EQ(*join_graph->edges.at(0).predicates.at(1), *less_than_equals_(a_a, b_b));
+
+  // BETWEEN with literal bounds stays a single predicate
+  EXPECT_EQ(join_graph->edges.at(1).vertex_set, JoinGraphVertexSet(2, 0b01));
+  ASSERT_EQ(join_graph->edges.at(1).predicates.size(), 1u);
+  EXPECT_EQ(*join_graph->edges.at(1).predicates.at(0), *between_(a_b, 3, 7));
+}
+
 TEST_F(JoinGraphBuilderTest, BuildAllInLQP) {
   // clang-format off
   const auto sub_lqp =
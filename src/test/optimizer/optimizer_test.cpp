@@ -1,3 +1,5 @@
+#include <mutex>
+
 #include "gtest/gtest.h"
 
 #include "expression/expression_functional.hpp"
@@ -9,6 +11,8 @@
 #include "logical_query_plan/projection_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "testing_assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -162,4 +166,52 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   EXPECT_LQP_EQ(select_b_a->lqp, select_lqp_b);
 }
 
+TEST_F(OptimizerTest, OptimizesIndependentSubqueriesInParallel) {
+  /**
+   * Subselects that do not share any nodes are optimized in parallel. The rule has to reach all of them nonetheless.
+   */
+
+  // A "rule" that collects the nodes it was applied to
+  class MockRule : public AbstractRule {
+   public:
+    std::string name() const override { return "Mock"; }
+
+    void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {
+      {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        nodes.emplace(root);
+      }
+      _apply_to_inputs(root);
+    }
+
+    mutable std::mutex mutex;
+    mutable std::unordered_set<std::shared_ptr<AbstractLQPNode>> nodes;
+  };
+
+  const auto node_c = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "z"}});
+  const auto select_lqp_c = LimitNode::make(to_expression(1), node_c);
+  const auto select_c = lqp_select_(select_lqp_c);
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(b, select_a)),
+    PredicateNode::make(greater_than_(a, select_c),
+      node_a));
+  // clang-format on
+
+  const auto rule = std::make_shared<MockRule>();
+
+  Optimizer optimizer{};
+  optimizer.add_rule(rule);
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  optimizer.optimize(lqp);
+  CurrentScheduler::set(nullptr);
+
+  // The nodes created above and the root nodes created by the optimizer for the lqp and each select
+  EXPECT_EQ(rule->nodes.size(), 10u);
+  EXPECT_TRUE(rule->nodes.count(node_b));
+  EXPECT_TRUE(rule->nodes.count(node_c));
+}
+
 }  // namespace opossum
@@ -20,6 +20,7 @@
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/partition_schema.hpp"
 #include "storage/storage_manager.hpp"
 
 #include "utils/assert.hpp"
@@ -274,4 +275,89 @@ TEST_F(ChunkPruningTest, FixedStringPruningTest) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, LikePrefixPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("string_compressed");
+
+  // Only the second chunk (from "ttt" to "zzz") may hold strings starting with "u"
+  auto predicate_node =
+      std::make_shared<PredicateNode>(like_(LQPColumnReference(stored_table_node, ColumnID{0}), "u%"));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected = {ChunkID{0}};
+  std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+  EXPECT_EQ(excluded, expected);
+}
+
+TEST_F(ChunkPruningTest, InListPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+  const auto column = LQPColumnReference(stored_table_node, ColumnID{0});
+
+  // The first chunk holds neither 12 nor 200
+  auto predicate_node = std::make_shared<PredicateNode>(in_(column, list_(12, 200)));
+  predicate_node->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->excluded_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+
+  // Each chunk may hold one of the values
+  auto other_stored_table_node = std::make_shared<StoredTableNode>("compressed");
+  const auto other_column = LQPColumnReference(other_stored_table_node, ColumnID{0});
+  auto other_predicate_node = std::make_shared<PredicateNode>(in_(other_column, list_(12, 12345)));
+  other_predicate_node->set_left_input(other_stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, other_predicate_node);
+  EXPECT_TRUE(other_stored_table_node->excluded_chunk_ids().empty());
+
+  // NOT IN is not pruned
+  auto negated_stored_table_node = std::make_shared<StoredTableNode>("compressed");
+  const auto negated_column = LQPColumnReference(negated_stored_table_node, ColumnID{0});
+  auto negated_predicate_node = std::make_shared<PredicateNode>(not_in_(negated_column, list_(12, 200)));
+  negated_predicate_node->set_left_input(negated_stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, negated_predicate_node);
+  EXPECT_TRUE(negated_stored_table_node->excluded_chunk_ids().empty());
+}
+
+TEST_F(ChunkPruningTest, IsNullPruningTest) {
+  auto& storage_manager = StorageManager::get();
+  storage_manager.add_table("compressed_with_null", load_table("resources/test_data/tbl/int_float_with_null.tbl", 2u));
+  ChunkEncoder::encode_all_chunks(storage_manager.get_table("compressed_with_null"), EncodingType::Dictionary);
+
+  // Only the second chunk holds NULLs in the first column, and only the first chunk in the second one
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed_with_null");
+  auto predicate_node = std::make_shared<PredicateNode>(is_null_(LQPColumnReference(stored_table_node, ColumnID{0})));
+  predicate_node->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->excluded_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+
+  auto other_stored_table_node = std::make_shared<StoredTableNode>("compressed_with_null");
+  auto other_predicate_node =
+      std::make_shared<PredicateNode>(is_null_(LQPColumnReference(other_stored_table_node, ColumnID{1})));
+  other_predicate_node->set_left_input(other_stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, other_predicate_node);
+  EXPECT_EQ(other_stored_table_node->excluded_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+}
+
+TEST_F(ChunkPruningTest, PartitionPruningTest) {
+  // The chunks are neither encoded nor have statistics, so only their partitions are pruned
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 2);
+  table->set_partition_schema(
+      PartitionSchema::range_partitioning(ColumnID{0}, DataType::Int, {AllTypeVariant{10}, AllTypeVariant{20}}));
+  for (const auto value : {1, 12, 25, 3, 5, 27}) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("partitioned", table);
+
+  auto stored_table_node = std::make_shared<StoredTableNode>("partitioned");
+  auto predicate_node =
+      std::make_shared<PredicateNode>(greater_than_equals_(LQPColumnReference(stored_table_node, ColumnID{0}), 20));
+  predicate_node->set_left_input(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  // Chunks 0 and 3 hold the rows of partition 0, chunk 1 those of partition 1
+  std::vector<ChunkID> expected = {ChunkID{0}, ChunkID{1}, ChunkID{3}};
+  EXPECT_EQ(stored_table_node->excluded_chunk_ids(), expected);
+}
+
 }  // namespace opossum
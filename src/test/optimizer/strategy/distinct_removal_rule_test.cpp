@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/distinct_removal_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class DistinctRemovalRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    column_definitions.emplace_back("c", DataType::Int, true);
+
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table->append({1, 1, 1});
+    table->append({2, 1, 2});
+    table->append({3, 2, NULL_VALUE});
+    table->add_unique_constraint(TableConstraintDefinition{{ColumnID{0}}, IsPrimaryKey::Yes});
+    table->add_unique_constraint(TableConstraintDefinition{{ColumnID{2}}});
+    StorageManager::get().add_table("table", table);
+
+    node = StoredTableNode::make("table");
+    a = node->get_column("a");
+    b = node->get_column("b");
+    c = node->get_column("c");
+
+    _rule = std::make_shared<DistinctRemovalRule>();
+  }
+
+  std::shared_ptr<DistinctRemovalRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node;
+  LQPColumnReference a, b, c;
+};
+
+TEST_F(DistinctRemovalRuleTest, DistinctOnPrimaryKey) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(b, a), expression_vector(),
+    PredicateNode::make(greater_than_(b, 1),
+      ValidateNode::make(
+        node)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(b, a),
+    PredicateNode::make(greater_than_(b, 1),
+      ValidateNode::make(
+        node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DistinctRemovalRuleTest, DistinctOnGroupBy) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(b, sum_(a)), expression_vector(),
+    AggregateNode::make(expression_vector(b), expression_vector(sum_(a)),
+      node));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(b, sum_(a)),
+    AggregateNode::make(expression_vector(b), expression_vector(sum_(a)),
+      node));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DistinctRemovalRuleTest, NoRemoval) {
+  // clang-format off
+  // Without a ValidateNode, the table might hold several versions of a row
+  const auto lqp_without_validate =
+  AggregateNode::make(expression_vector(a), expression_vector(),
+    node);
+
+  // b is not unique
+  const auto lqp_not_unique =
+  AggregateNode::make(expression_vector(b), expression_vector(),
+    ValidateNode::make(
+      node));
+
+  // c is unique, but nullable
+  const auto lqp_nullable =
+  AggregateNode::make(expression_vector(c), expression_vector(),
+    ValidateNode::make(
+      node));
+
+  // Not a DISTINCT
+  const auto lqp_with_aggregate =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    ValidateNode::make(
+      node));
+
+  // The join might duplicate the rows
+  const auto lqp_with_join =
+  AggregateNode::make(expression_vector(a), expression_vector(),
+    JoinNode::make(JoinMode::Cross,
+      ValidateNode::make(
+        node),
+      ValidateNode::make(
+        StoredTableNode::make("table"))));
+  // clang-format on
+
+  for (const auto& input_lqp :
+       {lqp_without_validate, lqp_not_unique, lqp_nullable, lqp_with_aggregate, lqp_with_join}) {
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+}  // namespace opossum
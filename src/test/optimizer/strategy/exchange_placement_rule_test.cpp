@@ -0,0 +1,193 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/delete_node.hpp"
+#include "logical_query_plan/exchange_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/exchange_placement_rule.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ExchangePlacementRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // The fact table is hash-partitioned by a, and larger than the dimension tables
+    const auto fact_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}}, TableType::Data, 10, UseMvcc::Yes);
+    fact_table->set_partition_schema(PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{4}));
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      fact_table->append({value % 20, value});
+    }
+    StorageManager::get().add_table("fact", fact_table);
+
+    const auto dimension_column_definitions = TableColumnDefinitions{{"x", DataType::Long}, {"y", DataType::Float}};
+    const auto dimension_table =
+        std::make_shared<Table>(dimension_column_definitions, TableType::Data, 10, UseMvcc::Yes);
+    const auto partitioned_dimension_table =
+        std::make_shared<Table>(dimension_column_definitions, TableType::Data, 10, UseMvcc::Yes);
+    partitioned_dimension_table->set_partition_schema(
+        PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Long, PartitionID{4}));
+    for (auto value = int64_t{0}; value < 20; ++value) {
+      dimension_table->append({value, static_cast<float>(value)});
+      partitioned_dimension_table->append({value, static_cast<float>(value)});
+    }
+    StorageManager::get().add_table("dimension", dimension_table);
+    StorageManager::get().add_table("partitioned_dimension", partitioned_dimension_table);
+
+    fact = StoredTableNode::make("fact");
+    a = fact->get_column("a");
+    b = fact->get_column("b");
+    dimension = StoredTableNode::make("dimension");
+    x = dimension->get_column("x");
+    y = dimension->get_column("y");
+    partitioned_dimension = StoredTableNode::make("partitioned_dimension");
+    partitioned_x = partitioned_dimension->get_column("x");
+
+    _rule = std::make_shared<ExchangePlacementRule>();
+  }
+
+  std::shared_ptr<ExchangePlacementRule> _rule;
+
+  std::shared_ptr<StoredTableNode> fact, dimension, partitioned_dimension;
+  LQPColumnReference a, b, x, y, partitioned_x;
+};
+
+TEST_F(ExchangePlacementRuleTest, ShufflesSmallerInput) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, x),
+    PredicateNode::make(greater_than_(b, 10),
+      ValidateNode::make(
+        fact)),
+    dimension);
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, x),
+    PredicateNode::make(greater_than_(b, 10),
+      ValidateNode::make(
+        fact)),
+    ExchangeNode::make(lqp_column_(x), PartitionID{4},
+      dimension));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ExchangePlacementRuleTest, ShufflesLeftInput) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Right, equals_(x, a),
+    dimension,
+    fact);
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Right, equals_(x, a),
+    ExchangeNode::make(lqp_column_(x), PartitionID{4},
+      dimension),
+    fact);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ExchangePlacementRuleTest, KeepsInputsThatArePartitionedAlike) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, partitioned_x),
+    fact,
+    partitioned_dimension);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ExchangePlacementRuleTest, DoesNotShuffleLargerInput) {
+  // The fact table is not partitioned by b, and it is larger than the partitioned dimension table
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(b, partitioned_x),
+    fact,
+    partitioned_dimension);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ExchangePlacementRuleTest, RequiresPartitionsThatJoinHashFinds) {
+  // Projections of stored tables forward their data segments, which lose the partitions
+  // clang-format off
+  const auto projected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, x),
+    ProjectionNode::make(expression_vector(a),
+      fact),
+    dimension);
+  // clang-format on
+
+  const auto expected_projected_lqp = projected_lqp->deep_copy();
+  EXPECT_LQP_EQ(StrategyBaseTest::apply_rule(_rule, projected_lqp), expected_projected_lqp);
+
+  // Floating point values are hashed differently than integral ones
+  // clang-format off
+  const auto float_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a, y),
+    fact,
+    dimension);
+  // clang-format on
+
+  const auto expected_float_lqp = float_lqp->deep_copy();
+  EXPECT_LQP_EQ(StrategyBaseTest::apply_rule(_rule, float_lqp), expected_float_lqp);
+}
+
+TEST_F(ExchangePlacementRuleTest, KeepsSemiJoinsThatAreExecutedAsScans) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(a, x),
+    fact,
+    dimension);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ExchangePlacementRuleTest, KeepsInputsOfDeletes) {
+  // The Delete needs the rows of the dimension table to reference it
+  // clang-format off
+  const auto input_lqp =
+  DeleteNode::make(
+    JoinNode::make(JoinMode::Inner, equals_(x, a),
+      dimension,
+      fact));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -7,6 +7,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/mock_node.hpp"
@@ -35,7 +36,7 @@ class IndexScanRuleTest : public StrategyBaseTest {
     StorageManager::get().add_table("a", table);
     ChunkEncoder::encode_all_chunks(StorageManager::get().get_table("a"));
 
-    rule = std::make_shared<IndexScanRule>();
+    rule = std::make_shared<IndexScanRule>(std::make_shared<CostModelPhysical>());
 
     stored_table_node = StoredTableNode::make("a");
     a = stored_table_node->get_column("a");
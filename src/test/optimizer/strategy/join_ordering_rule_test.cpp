@@ -6,6 +6,8 @@
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
 #include "optimizer/strategy/join_ordering_rule.hpp"
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
@@ -87,4 +89,38 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, GreedyOperatorOrderingFallback) {
+  // JoinGraphs that exceed the budget of DpCcp, in vertices or in CsgCmpPairs, are ordered by GreedyOperatorOrdering
+
+  // clang-format off
+  const auto make_join_lqp = [&]() -> std::shared_ptr<AbstractLQPNode> {
+    return
+    PredicateNode::make(equals_(a_a, d_a),
+      PredicateNode::make(equals_(c_a, d_a),
+        PredicateNode::make(equals_(a_a, c_a),
+          PredicateNode::make(equals_(a_a, b_a),
+            JoinNode::make(JoinMode::Cross,
+              JoinNode::make(JoinMode::Cross,
+                node_a,
+                node_b),
+              JoinNode::make(JoinMode::Cross,
+                node_c,
+                node_d))))));
+  };
+  // clang-format on
+
+  const auto expected_join_lqp = GreedyOperatorOrdering{cost_estimator}(*JoinGraph::build_from_lqp(make_join_lqp()));
+  const auto expected_lqp = AggregateNode::make(expression_vector(a_a), expression_vector(), expected_join_lqp);
+
+  const auto vertex_count_rule = std::make_shared<JoinOrderingRule>(cost_estimator, 3);
+  const auto vertex_count_input_lqp = AggregateNode::make(expression_vector(a_a), expression_vector(), make_join_lqp());
+  EXPECT_LQP_EQ(apply_rule(vertex_count_rule, vertex_count_input_lqp), expected_lqp);
+
+  const auto csg_cmp_pair_count_rule =
+      std::make_shared<JoinOrderingRule>(cost_estimator, JoinOrderingRule::DEFAULT_MAX_DP_CCP_VERTEX_COUNT, 3);
+  const auto csg_cmp_pair_count_input_lqp =
+      AggregateNode::make(expression_vector(a_a), expression_vector(), make_join_lqp());
+  EXPECT_LQP_EQ(apply_rule(csg_cmp_pair_count_rule, csg_cmp_pair_count_input_lqp), expected_lqp);
+}
+
 }  // namespace opossum
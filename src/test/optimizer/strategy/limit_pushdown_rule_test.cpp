@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "optimizer/strategy/limit_pushdown_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LimitPushdownRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}}, "t");
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    _rule = std::make_shared<LimitPushdownRule>();
+  }
+
+  std::shared_ptr<LimitPushdownRule> _rule;
+
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference a, b;
+};
+
+TEST_F(LimitPushdownRuleTest, PushBelowProjectionsAndAliases) {
+  // clang-format off
+  const auto input_lqp =
+  AliasNode::make(expression_vector(add_(a, 1)), std::vector<std::string>{"x"},
+    LimitNode::make(value_(int64_t{10}),
+      ProjectionNode::make(expression_vector(add_(a, 1)),
+        AliasNode::make(expression_vector(a, b), std::vector<std::string>{"a", "b"},
+          PredicateNode::make(greater_than_(a, 5),
+            node)))));
+
+  const auto expected_lqp =
+  AliasNode::make(expression_vector(add_(a, 1)), std::vector<std::string>{"x"},
+    ProjectionNode::make(expression_vector(add_(a, 1)),
+      AliasNode::make(expression_vector(a, b), std::vector<std::string>{"a", "b"},
+        LimitNode::make(value_(int64_t{10}),
+          PredicateNode::make(greater_than_(a, 5),
+            node)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, PushOntoSort) {
+  // The Limit ends up directly on top of the Sort, so that both are executed as a single Sort
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(int64_t{10}),
+    ProjectionNode::make(expression_vector(add_(a, 1)),
+      SortNode::make(expression_vector(b), std::vector<OrderByMode>{OrderByMode::Ascending},
+        node)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(add_(a, 1)),
+    LimitNode::make(value_(int64_t{10}),
+      SortNode::make(expression_vector(b), std::vector<OrderByMode>{OrderByMode::Ascending},
+        node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, KeepAbovePredicatesAndSorts) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(int64_t{10}),
+    PredicateNode::make(greater_than_(a, 5),
+      ProjectionNode::make(expression_vector(a, b),
+        node)));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LimitPushdownRuleTest, KeepAboveProjectionsWithMultipleOutputs) {
+  // The Projection is also used by the join, which needs all of its rows
+  const auto projection_node = ProjectionNode::make(expression_vector(a, b), node);
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Cross,
+    LimitNode::make(value_(int64_t{10}),
+      projection_node),
+    projection_node);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
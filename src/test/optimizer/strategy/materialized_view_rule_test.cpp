@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+    const auto view_node = StoredTableNode::make("table_a");
+    const auto view_a = view_node->get_column("a");
+    const auto view_b = view_node->get_column("b");
+
+    // clang-format off
+    const auto view_lqp =
+    AggregateNode::make(expression_vector(view_a), expression_vector(sum_(view_b)),
+      PredicateNode::make(greater_than_(view_a, 200),
+        ValidateNode::make(
+          view_node)));
+    // clang-format on
+    StorageManager::get().add_materialized_view("view", view_lqp);
+
+    node = StoredTableNode::make("table_a");
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    _rule = std::make_shared<MaterializedViewRule>();
+  }
+
+  std::shared_ptr<MaterializedViewRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node;
+  LQPColumnReference a, b;
+};
+
+TEST_F(MaterializedViewRuleTest, ReplaceSubplanWithView) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(add_(sum_(b), 1), a),
+    AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+      PredicateNode::make(greater_than_(a, 200),
+        ValidateNode::make(
+          node))));
+
+  const auto view_node = StoredTableNode::make("view");
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(add_(view_node->get_column("SUM(b)"), 1), view_node->get_column("a")),
+    ValidateNode::make(
+      view_node));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(MaterializedViewRuleTest, KeepOtherSubplans) {
+  // clang-format off
+  const auto different_predicate_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    PredicateNode::make(greater_than_(a, 300),
+      ValidateNode::make(
+        node)));
+
+  const auto not_validated_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    PredicateNode::make(greater_than_(a, 200),
+      node));
+  // clang-format on
+
+  for (const auto& lqp : {different_predicate_lqp, not_validated_lqp}) {
+    const auto expected_lqp = lqp->deep_copy();
+    EXPECT_LQP_EQ(apply_rule(_rule, lqp), expected_lqp);
+  }
+}
+
+}  // namespace opossum
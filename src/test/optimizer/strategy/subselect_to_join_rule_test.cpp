@@ -0,0 +1,191 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/subselect_to_join_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SubselectToJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl"));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_int3.tbl"));
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    node_table_b = StoredTableNode::make("table_b");
+    node_table_b_col_a = node_table_b->get_column("a");
+    node_table_b_col_b = node_table_b->get_column("b");
+
+    _rule = std::make_shared<SubselectToJoinRule>();
+  }
+
+  std::shared_ptr<SubselectToJoinRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a, node_table_b;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b, node_table_b_col_a, node_table_b_col_b;
+};
+
+TEST_F(SubselectToJoinRuleTest, UncorrelatedInToSemiJoin) {
+  // clang-format off
+  const auto subselect_lqp =
+  ProjectionNode::make(expression_vector(node_table_b_col_a),
+    node_table_b);
+
+  const auto input_lqp =
+  PredicateNode::make(in_(node_table_a_col_a, lqp_select_(subselect_lqp)),
+    node_table_a);
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(node_table_a_col_a, node_table_b_col_a),
+    node_table_a,
+    ProjectionNode::make(expression_vector(node_table_b_col_a),
+      node_table_b));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectToJoinRuleTest, CorrelatedInToJoin) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subselect_lqp =
+  ProjectionNode::make(expression_vector(node_table_b_col_b),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(in_(node_table_a_col_b, subselect),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(equals_(node_table_a_col_b, node_table_b_col_b),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        AggregateNode::make(expression_vector(node_table_b_col_a, node_table_b_col_b), expression_vector(),
+          ProjectionNode::make(expression_vector(node_table_b_col_a, node_table_b_col_b),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectToJoinRuleTest, CorrelatedScalarToJoin) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subselect_lqp =
+  ProjectionNode::make(expression_vector(mul_(2, sum_(node_table_b_col_b))),
+    AggregateNode::make(expression_vector(), expression_vector(sum_(node_table_b_col_b)),
+      PredicateNode::make(equals_(parameter, node_table_b_col_a),
+        node_table_b)));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  // The subselect is on the left, so the comparison is flipped
+  const auto input_lqp =
+  PredicateNode::make(less_than_(subselect, node_table_a_col_b),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(greater_than_(node_table_a_col_b, mul_(2, sum_(node_table_b_col_b))),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        ProjectionNode::make(expression_vector(node_table_b_col_a, mul_(2, sum_(node_table_b_col_b))),
+          AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(sum_(node_table_b_col_b)),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectToJoinRuleTest, NoRewriteOfNotIn) {
+  // clang-format off
+  const auto subselect_lqp =
+  ProjectionNode::make(expression_vector(node_table_b_col_a),
+    node_table_b);
+
+  const auto input_lqp =
+  PredicateNode::make(not_in_(node_table_a_col_a, lqp_select_(subselect_lqp)),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectToJoinRuleTest, NoRewriteOfCount) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // COUNT returns 0 for the outer rows without a matching group, which the join would drop
+  // clang-format off
+  const auto subselect_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subselect),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectToJoinRuleTest, NoRewriteOfOtherParameterUses) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subselect_lqp =
+  ProjectionNode::make(expression_vector(node_table_b_col_b),
+    PredicateNode::make(greater_than_(node_table_b_col_b, parameter),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(in_(node_table_a_col_b, subselect),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
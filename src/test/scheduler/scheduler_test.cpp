@@ -1,4 +1,9 @@
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <numeric>
+#include <sstream>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,11 +13,16 @@
 #include "expression/expression_functional.hpp"
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_dispatcher.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "storage/storage_manager.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -239,6 +249,18 @@ TEST_F(SchedulerTest, VerifyTaskQueueSetup) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, TopologyCacheSizes) {
+  const auto l1_data_cache_size = Topology::get().l1_data_cache_size();
+  const auto l2_cache_size = Topology::get().l2_cache_size();
+  EXPECT_GT(l1_data_cache_size, 0u);
+  EXPECT_GE(l2_cache_size, l1_data_cache_size);
+
+  // Replacing the topology does not forget the detected cache hierarchy
+  Topology::use_fake_numa_topology(4, 2);
+  EXPECT_EQ(Topology::get().l1_data_cache_size(), l1_data_cache_size);
+  EXPECT_EQ(Topology::get().l2_cache_size(), l2_cache_size);
+}
+
 TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Topology::use_default_topology(1);
   CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
@@ -258,4 +280,411 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, TaskQueueWakesWaitingWorkers) {
+  // The timeouts are far longer than the test should take, so that returning early means the worker was woken
+  constexpr auto timeout = std::chrono::seconds{60};
+
+  auto queue = std::make_shared<TaskQueue>(NodeID{0});
+
+  auto waiting_worker = std::thread{[&]() { queue->wait_for_task(timeout, []() { return false; }); }};
+  // Give the thread some time to start waiting. The test also passes if it only waits after the push.
+  std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  queue->push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Default));
+  waiting_worker.join();
+
+  // A queue that is not empty does not block
+  queue->wait_for_task(timeout, []() { return false; });
+
+  EXPECT_NE(queue->pull(), nullptr);
+  EXPECT_TRUE(queue->empty());
+
+  waiting_worker = std::thread{[&]() { queue->wait_for_task(timeout, []() { return false; }); }};
+  // notify_all() only wakes workers that are already waiting, so keep notifying until the thread returned
+  auto woken = std::atomic_bool{false};
+  auto notifier = std::thread{[&]() {
+    while (!woken) {
+      queue->notify_all();
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  }};
+  waiting_worker.join();
+  woken = true;
+  notifier.join();
+}
+
+TEST_F(SchedulerTest, WorkStealingDeque) {
+  auto deque = WorkStealingDeque{2};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  // More tasks than the initial capacity make the deque grow
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 5; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+  EXPECT_FALSE(deque.empty());
+
+  // The owner pops the most recent task, thieves steal the oldest ones
+  EXPECT_EQ(deque.pop(), tasks[4]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(SchedulerTest, NestedJobsOnWorkerDeques) {
+  // Jobs spawned by jobs go to the deques of the workers, from where idle workers steal them
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto counter = std::atomic_uint{0};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_index = 0; job_index < 20; ++job_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto subjobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto subjob_index = 0; subjob_index < 50; ++subjob_index) {
+        subjobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+        subjobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(subjobs);
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+  EXPECT_EQ(counter, 1'000u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, WaitingWorkersExecuteTheirJobs) {
+  // A worker that waits for its jobs executes those that no idle worker stole yet, each of them exactly once
+  Topology::use_fake_numa_topology(4, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto job_count = size_t{50};
+  auto job_executions = std::vector<std::atomic_uint>(job_count);
+  auto job_thread_ids = std::vector<std::thread::id>(job_count);
+  auto task_thread_id = std::thread::id{};
+
+  const auto task = std::make_shared<JobTask>([&]() {
+    task_thread_id = std::this_thread::get_id();
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_index]() {
+        ++job_executions[job_index];
+        job_thread_ids[job_index] = std::this_thread::get_id();
+        std::this_thread::sleep_for(std::chrono::microseconds{100});
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  for (const auto& executions : job_executions) {
+    EXPECT_EQ(executions, 1u);
+  }
+  // The waiting worker starts with the last job, which idle workers steal last
+  EXPECT_EQ(job_thread_ids.back(), task_thread_id);
+
+  // The skipped jobs still count as finished, otherwise the scheduler would not shut down
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, StatisticsCountTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+
+  auto dump = std::stringstream{};
+  scheduler->dump_statistics_periodically(std::chrono::milliseconds{1}, dump);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_index = 0; job_index < 20; ++job_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto subjobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto subjob_index = 0; subjob_index < 50; ++subjob_index) {
+        subjobs.emplace_back(std::make_shared<JobTask>([]() {}));
+        subjobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(subjobs);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Workers count a task once it returned, which may be after wait_for_tasks() returned
+  const auto tasks_executed = [&]() {
+    const auto statistics = scheduler->statistics();
+    return std::accumulate(statistics.workers.cbegin(), statistics.workers.cend(), uint64_t{0},
+                           [](const auto sum, const auto& worker) { return sum + worker.tasks_executed; });
+  };
+  while (tasks_executed() < 1'020u) std::this_thread::yield();
+
+  const auto statistics = scheduler->statistics();
+  // The fake topology has fewer workers on machines with fewer cores
+  ASSERT_EQ(statistics.workers.size(), Topology::get().num_cpus());
+  ASSERT_EQ(statistics.queues.size(), Topology::get().nodes().size());
+
+  // Tasks scheduled from outside of the workers go to the queues, the jobs of tasks to the deques of the workers
+  auto tasks_taken = uint64_t{0};
+  for (const auto& worker : statistics.workers) {
+    tasks_taken += worker.tasks_from_deque + worker.tasks_pulled + worker.tasks_stolen();
+    EXPECT_EQ(worker.tasks_stolen_from_nodes.size(), statistics.queues.size());
+    EXPECT_LE(worker.sleep_time, worker.idle_time);
+  }
+  EXPECT_EQ(tasks_taken, 1'020u);
+
+  auto tasks_pushed = uint64_t{0};
+  for (const auto& queue : statistics.queues) {
+    tasks_pushed += queue.tasks_pushed;
+    EXPECT_EQ(queue.queue_depth, 0u);
+    EXPECT_EQ(queue.tasks_pulled + queue.tasks_stolen, queue.tasks_pushed);
+  }
+  EXPECT_EQ(tasks_pushed, 20u);
+
+  // Differences of snapshots describe the time between them
+  const auto difference = scheduler->statistics() - statistics;
+  for (const auto& queue : difference.queues) {
+    EXPECT_EQ(queue.tasks_pushed, 0u);
+  }
+
+  auto printed_statistics = std::stringstream{};
+  statistics.print(printed_statistics);
+  EXPECT_NE(printed_statistics.str().find("TaskQueue 0: "), std::string::npos);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  CurrentScheduler::get()->finish();
+  EXPECT_NE(dump.str().find("Scheduler statistics of the last 1 ms"), std::string::npos);
+  EXPECT_NE(dump.str().find(" (node 0): "), std::string::npos);
+}
+
+TEST_F(SchedulerTest, MorselDispatcherFormsMorsels) {
+  // Items are combined until a morsel holds at least ten rows, large items form a morsel of their own
+  const auto dispatcher = MorselDispatcher{std::vector<size_t>{5, 5, 20, 1, 1, 1, 30, 0, 3}, 10};
+  ASSERT_EQ(dispatcher.morsel_count(), 4u);
+  EXPECT_EQ(dispatcher.morsel(0), std::make_pair(size_t{0}, size_t{2}));
+  EXPECT_EQ(dispatcher.morsel(1), std::make_pair(size_t{2}, size_t{3}));
+  EXPECT_EQ(dispatcher.morsel(2), std::make_pair(size_t{3}, size_t{7}));
+  EXPECT_EQ(dispatcher.morsel(3), std::make_pair(size_t{7}, size_t{9}));
+
+  EXPECT_EQ(MorselDispatcher{std::vector<size_t>{}}.morsel_count(), 0u);
+}
+
+TEST_F(SchedulerTest, MorselDispatcherProcessesEachItemOnce) {
+  const auto item_sizes = std::vector<size_t>(1'000, 7);
+
+  const auto test_dispatcher = [&]() {
+    auto processed_counts = std::vector<std::atomic_uint>(item_sizes.size());
+    MorselDispatcher{item_sizes, 100}.run([&](const size_t item_index) { ++processed_counts[item_index]; });
+
+    for (const auto& processed_count : processed_counts) {
+      EXPECT_EQ(processed_count, 1u);
+    }
+  };
+
+  test_dispatcher();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  test_dispatcher();
+
+  // The dispatcher is also used from within tasks, e.g., by operators
+  auto job = std::make_shared<JobTask>(test_dispatcher);
+  job->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{job});
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, MorselDispatcherKeepsMorselsOnTheirNode) {
+  // Morsels never span nodes, even if they hold fewer rows than the morsel size then
+  const auto item_node_ids = std::vector<NodeID>{NodeID{0}, NodeID{0}, NodeID{1}, NodeID{1}, INVALID_NODE_ID};
+  const auto dispatcher = MorselDispatcher{std::vector<size_t>{5, 5, 5, 5, 5}, item_node_ids, 10};
+  ASSERT_EQ(dispatcher.morsel_count(), 3u);
+  EXPECT_EQ(dispatcher.morsel(1), std::make_pair(size_t{2}, size_t{4}));
+  EXPECT_EQ(dispatcher.morsel_node_id(0), NodeID{0});
+  EXPECT_EQ(dispatcher.morsel_node_id(1), NodeID{1});
+  EXPECT_EQ(dispatcher.morsel_node_id(2), INVALID_NODE_ID);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Chunks migrated to a node belong to it, the others have no node. The fake topology has fewer nodes on machines
+  // with fewer cores, so the last node is used.
+  const auto node_id = static_cast<NodeID>(Topology::get().nodes().size() - 1);
+  auto table = load_table("resources/test_data/tbl/int_float.tbl", 1);
+  table->get_chunk(ChunkID{1})->migrate(Topology::get().get_memory_resource(node_id));
+  table->get_chunk(ChunkID{2})->migrate(Topology::get().get_memory_resource(node_id));
+
+  const auto table_dispatcher = MorselDispatcher{*table, 1};
+  ASSERT_EQ(table_dispatcher.morsel_count(), 3u);
+  EXPECT_EQ(table_dispatcher.morsel_node_id(0), INVALID_NODE_ID);
+  EXPECT_EQ(table_dispatcher.morsel_node_id(1), node_id);
+  EXPECT_EQ(table_dispatcher.morsel_node_id(2), node_id);
+
+  auto processed_counts = std::vector<std::atomic_uint>(table->chunk_count());
+  table_dispatcher.run([&](const size_t chunk_index) { ++processed_counts[chunk_index]; });
+  for (const auto& processed_count : processed_counts) {
+    EXPECT_EQ(processed_count, 1u);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+// Resource groups live as long as the program, so the tests create each of their groups once
+
+TEST_F(SchedulerTest, ResourceGroupAdmitsQueriesInOrder) {
+  static const auto resource_group = ResourceGroup::create("admission_test", 1, 1);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto first_query_ticket = resource_group->queue_query();
+  auto second_query_ticket = resource_group->queue_query();
+  EXPECT_TRUE(first_query_ticket->is_admitted());
+  EXPECT_FALSE(second_query_ticket->is_admitted());
+
+  auto executed = std::atomic_bool{false};
+  auto task = std::make_shared<JobTask>([&]() { executed = true; });
+  task->set_query_ticket(second_query_ticket);
+  task->schedule();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(executed);
+
+  // The task is handed to the scheduler once the first query finishes
+  first_query_ticket = nullptr;
+  EXPECT_TRUE(second_query_ticket->is_admitted());
+  second_query_ticket = nullptr;
+
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(executed);
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ResourceGroupLimitsInFlightJobs) {
+  static const auto resource_group = ResourceGroup::create("in_flight_jobs_test", 1, 0, 2);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto running_job_count = std::atomic_uint{0};
+  auto max_running_job_count = std::atomic_uint{0};
+  auto executed_job_count = std::atomic_uint{0};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_index = 0; job_index < 20; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        const auto job_count = ++running_job_count;
+        auto previous_max_job_count = max_running_job_count.load();
+        while (previous_max_job_count < job_count &&
+               !max_running_job_count.compare_exchange_weak(previous_max_job_count, job_count)) {
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --running_job_count;
+        ++executed_job_count;
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->set_query_ticket(resource_group->queue_query());
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(executed_job_count, 20u);
+
+  // Besides the two jobs in flight, the spawning task executes one itself
+  EXPECT_LE(max_running_job_count, 3u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, TaskQueueServesResourceGroupsByVirtualTime) {
+  static const auto busy_resource_group = ResourceGroup::create("busy", 1);
+  static const auto idle_resource_group = ResourceGroup::create("idle", 1);
+
+  busy_resource_group->charge(std::chrono::milliseconds{1});
+  EXPECT_LT(idle_resource_group->virtual_time(), busy_resource_group->virtual_time());
+
+  auto queue = TaskQueue{NodeID{0}};
+
+  auto busy_task = std::make_shared<JobTask>([]() {});
+  busy_task->set_query_ticket(busy_resource_group->queue_query());
+  auto idle_task = std::make_shared<JobTask>([]() {});
+  idle_task->set_query_ticket(idle_resource_group->queue_query());
+
+  queue.push(busy_task, static_cast<uint32_t>(SchedulePriority::Default));
+  queue.push(idle_task, static_cast<uint32_t>(SchedulePriority::Default));
+
+  EXPECT_EQ(queue.pull(), idle_task);
+  EXPECT_EQ(queue.pull(), busy_task);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulerTest, CancellationTokenDeadlineAndParent) {
+  const auto parent_cancellation_token = std::make_shared<CancellationToken>();
+  const auto cancellation_token = std::make_shared<CancellationToken>(parent_cancellation_token);
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+
+  parent_cancellation_token->cancel();
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  EXPECT_THROW(cancellation_token->throw_if_cancelled(), QueryCancelledException);
+
+  const auto expired_cancellation_token = std::make_shared<CancellationToken>();
+  expired_cancellation_token->set_deadline(std::chrono::steady_clock::now() + std::chrono::hours{1});
+  EXPECT_FALSE(expired_cancellation_token->is_cancelled());
+  expired_cancellation_token->set_deadline(std::chrono::steady_clock::now() - std::chrono::milliseconds{1});
+  EXPECT_TRUE(expired_cancellation_token->is_cancelled());
+}
+
+TEST_F(SchedulerTest, CancelledTasksAreSkipped) {
+  const auto run_query = [&]() {
+    const auto cancellation_token = std::make_shared<CancellationToken>();
+    auto processed_item_count = std::atomic_uint{0};
+    auto finished = false;
+
+    // The jobs of the MorselDispatcher inherit the token of the task and stop once it is cancelled
+    auto task = std::make_shared<JobTask>([&]() {
+      MorselDispatcher{std::vector<size_t>(100, 1), 1}.run([&](const size_t /*item_index*/) {
+        if (++processed_item_count == 10) cancellation_token->cancel();
+      });
+      finished = true;
+    });
+    auto successor = std::make_shared<JobTask>([&]() { ADD_FAILURE() << "Cancelled task was executed"; });
+    task->set_as_predecessor_of(successor);
+
+    for (const auto& query_task : {task, successor}) {
+      query_task->set_cancellation_token(cancellation_token);
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task, successor});
+
+    EXPECT_TRUE(task->is_done());
+    EXPECT_TRUE(successor->is_done());
+    EXPECT_FALSE(finished);
+    EXPECT_LT(processed_item_count, 100u);
+  };
+
+  run_query();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  run_query();
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_profiler.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class TaskProfilerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  void profile_projection() {
+    const auto profiler = std::make_shared<TaskProfiler>();
+    SQLPipelineBuilder{"SELECT a + 1 FROM table_a"}.with_task_profiler(profiler).create_pipeline().get_result_table();
+
+    // The Projection executes one job per chunk
+    auto projection_count = size_t{0};
+    auto job_count = size_t{0};
+    for (const auto& event : profiler->events()) {
+      EXPECT_LE(event.begin, event.end);
+      if (event.name == "Projection") {
+        EXPECT_EQ(event.category, "OperatorTask");
+        EXPECT_EQ(event.parent_operator, "Projection");
+        ++projection_count;
+      } else if (event.category == "JobTask") {
+        EXPECT_EQ(event.name, "JobTask");
+        EXPECT_EQ(event.parent_operator, "Projection");
+        ++job_count;
+      }
+    }
+    EXPECT_EQ(projection_count, 1u);
+    EXPECT_EQ(job_count, 2u);
+
+    const auto chrome_trace = profiler->to_chrome_trace();
+    ASSERT_TRUE(chrome_trace.count("traceEvents"));
+    auto complete_event_count = size_t{0};
+    auto thread_name_count = size_t{0};
+    for (const auto& trace_event : chrome_trace["traceEvents"]) {
+      if (trace_event["ph"] == "X") {
+        EXPECT_TRUE(trace_event.count("ts"));
+        EXPECT_TRUE(trace_event.count("dur"));
+        EXPECT_TRUE(trace_event.count("tid"));
+        ++complete_event_count;
+      } else {
+        EXPECT_EQ(trace_event["ph"], "M");
+        ++thread_name_count;
+      }
+    }
+    EXPECT_EQ(complete_event_count, profiler->events().size());
+    EXPECT_GE(thread_name_count, 1u);
+  }
+};
+
+TEST_F(TaskProfilerTest, ProfilesPipelineWithoutScheduler) {
+  profile_projection();
+}
+
+TEST_F(TaskProfilerTest, ProfilesPipelineWithScheduler) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  profile_projection();
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(TaskProfilerTest, JobsInheritProfiler) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto profiler = std::make_shared<TaskProfiler>();
+  const auto outer_job = std::make_shared<JobTask>([&]() {
+    EXPECT_EQ(TaskProfiler::current(), profiler);
+    const auto inner_job = std::make_shared<JobTask>([]() {});
+    inner_job->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{inner_job});
+  });
+  outer_job->set_task_profiler(profiler);
+  outer_job->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{outer_job});
+  CurrentScheduler::get()->finish();
+
+  const auto events = profiler->events();
+  ASSERT_EQ(events.size(), 2u);
+  for (const auto& event : events) {
+    EXPECT_EQ(event.category, "JobTask");
+    EXPECT_TRUE(event.parent_operator.empty());
+    EXPECT_TRUE(event.worker_id.has_value());
+  }
+  EXPECT_EQ(TaskProfiler::current(), nullptr);
+}
+
+}  // namespace opossum
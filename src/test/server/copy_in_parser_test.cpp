@@ -0,0 +1,116 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/copy_in_parser.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CopyInParserTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+
+    _expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    _expected_table->append({1, "x\ty"});
+    _expected_table->append({2, NULL_VALUE});
+    _expected_table->append({3, "z"});
+  }
+
+  // Appends the single chunk of each batch to one table
+  std::shared_ptr<Table> _concatenate(const std::vector<std::shared_ptr<Table>>& batches) {
+    const auto table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (const auto& batch : batches) {
+      EXPECT_EQ(batch->chunk_count(), 1u);
+      table->append_chunk(batch->get_chunk(ChunkID{0})->segments());
+    }
+    return table;
+  }
+
+  static std::string _binary_int16(const int16_t value) {
+    return {static_cast<char>(value >> 8), static_cast<char>(value & 0xFF)};
+  }
+
+  static std::string _binary_int32(const int32_t value) {
+    return _binary_int16(static_cast<int16_t>(value >> 16)) + _binary_int16(static_cast<int16_t>(value & 0xFFFF));
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(CopyInParserTest, TextFormat) {
+  auto parser = CopyInParser{*_table, FormatCode::Text};
+  EXPECT_EQ(parser.batch_row_count(), 2u);
+
+  // Rows and values are split across messages
+  parser.parse("1\tx\\ty\r\n2\t");
+  parser.parse("\\N\n3\tz");
+  EXPECT_EQ(parser.row_count(), 2u);
+
+  auto batches = parser.take_full_batches();
+  ASSERT_EQ(batches.size(), 1u);
+  EXPECT_EQ(batches[0]->row_count(), 2u);
+  EXPECT_TRUE(parser.take_full_batches().empty());
+
+  // The last line does not need to end with a line break
+  const auto remaining_batches = parser.finish();
+  EXPECT_EQ(parser.row_count(), 3u);
+  batches.insert(batches.end(), remaining_batches.begin(), remaining_batches.end());
+  ASSERT_EQ(batches.size(), 2u);
+
+  EXPECT_TABLE_EQ_ORDERED(_concatenate(batches), _expected_table);
+}
+
+TEST_F(CopyInParserTest, TextFormatEndOfDataMarker) {
+  auto parser = CopyInParser{*_table, FormatCode::Text};
+  parser.parse("1\tx\\ty\n2\t\\N\n3\tz\n\\.\n4\tignored\n");
+  EXPECT_TABLE_EQ_ORDERED(_concatenate(parser.finish()), _expected_table);
+}
+
+TEST_F(CopyInParserTest, TextFormatInvalidData) {
+  EXPECT_THROW(CopyInParser(*_table, FormatCode::Text).parse("1\n"), std::logic_error);
+  EXPECT_THROW(CopyInParser(*_table, FormatCode::Text).parse("1\tx\ty\n"), std::logic_error);
+  EXPECT_THROW(CopyInParser(*_table, FormatCode::Text).parse("\\N\tx\n"), std::logic_error);
+  EXPECT_THROW(CopyInParser(*_table, FormatCode::Text).parse("1a\tx\n"), std::logic_error);
+}
+
+TEST_F(CopyInParserTest, BinaryFormat) {
+  const auto header = std::string{"PGCOPY\n\377\r\n\0", 11} + _binary_int32(0) + _binary_int32(0);
+  const auto data = header + _binary_int16(2) + _binary_int32(4) + _binary_int32(1) + _binary_int32(3) + "x\ty" +
+                    _binary_int16(2) + _binary_int32(4) + _binary_int32(2) + _binary_int32(-1) + _binary_int16(2) +
+                    _binary_int32(4) + _binary_int32(3) + _binary_int32(1) + "z" + _binary_int16(-1);
+
+  // Feed the data byte by byte, so that every part of it is incomplete at some point
+  auto parser = CopyInParser{*_table, FormatCode::Binary};
+  auto batches = std::vector<std::shared_ptr<Table>>{};
+  for (const auto byte : data) {
+    parser.parse(std::string(1, byte));
+    const auto full_batches = parser.take_full_batches();
+    batches.insert(batches.end(), full_batches.begin(), full_batches.end());
+  }
+  EXPECT_EQ(batches.size(), 1u);
+
+  const auto remaining_batches = parser.finish();
+  batches.insert(batches.end(), remaining_batches.begin(), remaining_batches.end());
+  EXPECT_EQ(parser.row_count(), 3u);
+  EXPECT_TABLE_EQ_ORDERED(_concatenate(batches), _expected_table);
+}
+
+TEST_F(CopyInParserTest, BinaryFormatInvalidData) {
+  EXPECT_THROW(CopyInParser(*_table, FormatCode::Binary).parse(std::string(19, 'x')), std::logic_error);
+
+  // The trailer is missing
+  auto parser = CopyInParser{*_table, FormatCode::Binary};
+  parser.parse(std::string{"PGCOPY\n\377\r\n\0", 11} + _binary_int32(0) + _binary_int32(0));
+  EXPECT_THROW(parser.finish(), std::logic_error);
+}
+
+}  // namespace opossum
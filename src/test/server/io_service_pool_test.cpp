@@ -0,0 +1,43 @@
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/io_service_pool.hpp"
+
+namespace opossum {
+
+class IoServicePoolTest : public BaseTest {};
+
+TEST_F(IoServicePoolTest, HandsOutIoServicesRoundRobin) {
+  auto io_service_pool = IoServicePool{3};
+  EXPECT_EQ(io_service_pool.size(), 3u);
+
+  auto& first_io_service = io_service_pool.next_io_service();
+  EXPECT_EQ(&first_io_service, &io_service_pool.acceptor_io_service());
+  EXPECT_NE(&io_service_pool.next_io_service(), &first_io_service);
+  EXPECT_NE(&io_service_pool.next_io_service(), &first_io_service);
+  EXPECT_EQ(&io_service_pool.next_io_service(), &first_io_service);
+}
+
+TEST_F(IoServicePoolTest, RunsIoServicesOnThreadsOfTheirOwn) {
+  auto io_service_pool = IoServicePool{3};
+
+  auto thread_ids_mutex = std::mutex{};
+  auto thread_ids = std::set<std::thread::id>{};
+  for (auto io_service_idx = size_t{0}; io_service_idx < io_service_pool.size(); ++io_service_idx) {
+    io_service_pool.next_io_service().post([&]() {
+      auto lock = std::lock_guard<std::mutex>{thread_ids_mutex};
+      thread_ids.emplace(std::this_thread::get_id());
+      if (thread_ids.size() == io_service_pool.size()) io_service_pool.stop();
+    });
+  }
+
+  // Returns once the last handler has stopped the pool
+  io_service_pool.run();
+  EXPECT_EQ(thread_ids.size(), 3u);
+}
+
+}  // namespace opossum
@@ -11,6 +11,7 @@
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/insert_server_batch_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
 
@@ -19,7 +20,7 @@ namespace opossum {
 class MockTaskRunner {
  public:
   MOCK_METHOD1(dispatch_server_task,
-               boost::future<std::unique_ptr<PreparedPlan>>(std::shared_ptr<ParseServerPreparedStatementTask>));
+               boost::future<std::shared_ptr<PreparedPlan>>(std::shared_ptr<ParseServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task,
                boost::future<std::shared_ptr<AbstractOperator>>(std::shared_ptr<BindServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task,
@@ -27,6 +28,7 @@ class MockTaskRunner {
   MOCK_METHOD1(dispatch_server_task,
                boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<ExecuteServerQueryTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<InsertServerBatchTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<LoadServerFileTask>));
 };
 
@@ -58,6 +58,45 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
 }
 
+TEST_F(PostgresWireHandlerTest, HandleCancelRequestPackage) {
+  ByteBuffer buffer = {};
+  for (const auto value : {16u, 80877102u, 42u, 1234567u}) {
+    const auto network_value = htonl(value);
+    const auto* chars = reinterpret_cast<const char*>(&network_value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));  // length, version, process id, secret key
+  }
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  ASSERT_EQ(postgres_wire_handler.handle_startup_package(_input_packet), PostgresWireHandler::CANCEL_REQUEST);
+
+  // The connection reads the body of the CancelRequest separately
+  _input_packet.offset = _input_packet.data.cbegin() + 2 * sizeof(uint32_t);
+  const auto cancel_request = postgres_wire_handler.handle_cancel_request_packet(_input_packet);
+  EXPECT_EQ(cancel_request.process_id, 42u);
+  EXPECT_EQ(cancel_request.secret_key, 1234567u);
+}
+
+TEST_F(PostgresWireHandlerTest, HandleExecutePacket) {
+  const auto execute_packet_with_max_rows = [&](const int32_t max_rows) {
+    ByteBuffer buffer = {'p', '\0'};
+    const auto network_max_rows = htonl(static_cast<uint32_t>(max_rows));
+    const auto* chars = reinterpret_cast<const char*>(&network_max_rows);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+    _input_packet.data = buffer;
+    _input_packet.offset = _input_packet.data.cbegin();
+
+    return postgres_wire_handler.handle_execute_packet(_input_packet);
+  };
+
+  const auto execute_packet = execute_packet_with_max_rows(100);
+  EXPECT_EQ(execute_packet.portal, "p");
+  EXPECT_EQ(execute_packet.max_rows, 100u);
+
+  // A negative row limit means no limit
+  EXPECT_EQ(execute_packet_with_max_rows(-1).max_rows, 0u);
+}
+
 TEST_F(PostgresWireHandlerTest, WriteString) {
   std::string value("Response");
 
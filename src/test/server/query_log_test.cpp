@@ -0,0 +1,88 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/query_log.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class QueryLogTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    QueryLog::get().close();
+    filesystem::remove(query_log_path);
+  }
+
+  const std::string query_log_path = test_data_path + "query_log_test.log";
+};
+
+TEST_F(QueryLogTest, RecordAndRead) {
+  auto& query_log = QueryLog::get();
+  const auto session_a = query_log.new_session_id();
+  const auto session_b = query_log.new_session_id();
+  EXPECT_NE(session_a, session_b);
+
+  // Nothing is recorded before the log is opened
+  query_log.record_simple_query(session_a, "SELECT 0");
+
+  query_log.open(query_log_path);
+  EXPECT_TRUE(query_log.is_open());
+  query_log.record_simple_query(session_a, "SELECT\n\t\"a\" FROM t");
+  query_log.record_prepared_statement(session_b, "SELECT * FROM t WHERE a = ? AND b = ? AND c = ? AND d = ? AND e = ?",
+                                      {AllTypeVariant{std::string{"x'y"}}, AllTypeVariant{int32_t{3}},
+                                       AllTypeVariant{int64_t{5'000'000'000}}, AllTypeVariant{2.5}, NULL_VALUE});
+  query_log.record_prepared_statement(session_a, "SELECT 1", {});
+  query_log.close();
+  EXPECT_FALSE(query_log.is_open());
+
+  query_log.record_simple_query(session_a, "SELECT 2");
+
+  const auto entries = QueryLog::read(query_log_path);
+  ASSERT_EQ(entries.size(), 3u);
+
+  EXPECT_EQ(entries[0].session_id, session_a);
+  EXPECT_EQ(entries[0].sql, "SELECT\n\t\"a\" FROM t");
+  EXPECT_FALSE(entries[0].is_prepared_statement);
+  EXPECT_TRUE(entries[0].parameters.empty());
+
+  EXPECT_EQ(entries[1].session_id, session_b);
+  EXPECT_TRUE(entries[1].is_prepared_statement);
+  ASSERT_EQ(entries[1].parameters.size(), 5u);
+  EXPECT_EQ(entries[1].parameters[0], AllTypeVariant{std::string{"x'y"}});
+  EXPECT_EQ(entries[1].parameters[1], AllTypeVariant{int32_t{3}});
+  EXPECT_EQ(entries[1].parameters[2], AllTypeVariant{int64_t{5'000'000'000}});
+  EXPECT_EQ(entries[1].parameters[3], AllTypeVariant{2.5});
+  EXPECT_TRUE(variant_is_null(entries[1].parameters[4]));
+
+  EXPECT_TRUE(entries[2].is_prepared_statement);
+  EXPECT_TRUE(entries[2].parameters.empty());
+
+  EXPECT_LE(entries[0].timestamp, entries[1].timestamp);
+  EXPECT_LE(entries[1].timestamp, entries[2].timestamp);
+}
+
+TEST_F(QueryLogTest, AppendsToExistingLog) {
+  auto& query_log = QueryLog::get();
+  query_log.open(query_log_path);
+  query_log.record_simple_query(1, "SELECT 1");
+  query_log.close();
+
+  query_log.open(query_log_path);
+  EXPECT_THROW(query_log.open(query_log_path), std::exception);
+  query_log.record_simple_query(1, "SELECT 2");
+  query_log.close();
+
+  const auto entries = QueryLog::read(query_log_path);
+  ASSERT_EQ(entries.size(), 2u);
+  EXPECT_EQ(entries[0].sql, "SELECT 1");
+  EXPECT_EQ(entries[1].sql, "SELECT 2");
+}
+
+TEST_F(QueryLogTest, ReadingMissingLogFails) {
+  EXPECT_THROW(QueryLog::read(query_log_path), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/query_response_builder.hpp"
+
+namespace opossum {
+
+class QueryResponseBuilderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 holds (NULL, 456.7) and (123, NULL), chunk 1 holds (1234, 457.7)
+    _table = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
+  }
+
+  // Collects the rows that send_query_response() sends
+  std::vector<std::vector<std::optional<std::string>>> _send_rows(const uint64_t row_offset,
+                                                                  const uint64_t max_row_count,
+                                                                  const std::vector<FormatCode>& column_formats) {
+    auto rows = std::vector<std::vector<std::optional<std::string>>>{};
+    const auto send_row = [&](const std::vector<std::optional<std::string>>& row) {
+      rows.emplace_back(row);
+      return boost::make_ready_future();
+    };
+
+    const auto row_count =
+        QueryResponseBuilder::send_query_response(send_row, *_table, row_offset, max_row_count, column_formats).get();
+    EXPECT_EQ(row_count, rows.size());
+    return rows;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(QueryResponseBuilderTest, BuildColumnFormats) {
+  const auto text = FormatCode::Text;
+  const auto binary = FormatCode::Binary;
+
+  EXPECT_EQ(QueryResponseBuilder::build_column_formats({}, 2), std::vector<FormatCode>({text, text}));
+  EXPECT_EQ(QueryResponseBuilder::build_column_formats({binary}, 2), std::vector<FormatCode>({binary, binary}));
+  EXPECT_EQ(QueryResponseBuilder::build_column_formats({binary, text}, 2), std::vector<FormatCode>({binary, text}));
+  EXPECT_THROW(QueryResponseBuilder::build_column_formats({binary, text}, 3), std::logic_error);
+}
+
+TEST_F(QueryResponseBuilderTest, SendsRowsAsText) {
+  const auto rows = _send_rows(0, 0, {});
+  ASSERT_EQ(rows.size(), 3u);
+  EXPECT_EQ(rows[0][0], std::nullopt);
+  EXPECT_EQ(rows[1][0], std::optional<std::string>{"123"});
+  EXPECT_EQ(rows[1][1], std::nullopt);
+  EXPECT_EQ(rows[2][0], std::optional<std::string>{"1234"});
+}
+
+TEST_F(QueryResponseBuilderTest, SendsRowsInBinaryFormat) {
+  // Skip the first row and stop after the second one
+  const auto rows = _send_rows(1, 1, {FormatCode::Binary, FormatCode::Text});
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows[0][0], std::optional<std::string>(std::string{'\0', '\0', '\0', '\x7b'}));
+  EXPECT_EQ(rows[0][1], std::nullopt);
+
+  // 457.7 as single precision IEEE 754 number
+  const auto last_rows = _send_rows(2, 0, {FormatCode::Binary, FormatCode::Binary});
+  ASSERT_EQ(last_rows.size(), 1u);
+  EXPECT_EQ(last_rows[0][0], std::optional<std::string>(std::string{'\0', '\0', '\x04', '\xd2'}));
+  EXPECT_EQ(last_rows[0][1], std::optional<std::string>(std::string{'\x43', '\xe4', '\xd9', '\x9a'}));
+}
+
+TEST_F(QueryResponseBuilderTest, BuildCopyData) {
+  EXPECT_EQ(QueryResponseBuilder::build_copy_data({std::string{"123"}, std::nullopt}), "123\t\\N\n");
+  EXPECT_EQ(QueryResponseBuilder::build_copy_data({std::string{"a\tb\\c\nd"}}), "a\\tb\\\\c\\nd\n");
+}
+
+}  // namespace opossum
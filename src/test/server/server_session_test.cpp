@@ -6,6 +6,8 @@
 #include "base_test.hpp"
 #include "mock_connection.hpp"
 #include "mock_task_runner.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "server/query_cancellation_registry.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -63,6 +65,9 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_parameter_status(_, _)).WillByDefault(Invoke([](const std::string&, const std::string&) {
       return boost::make_ready_future();
     }));
+    ON_CALL(*_connection, send_backend_key_data(_, _)).WillByDefault(Invoke([](uint32_t, uint32_t) {
+      return boost::make_ready_future();
+    }));
     ON_CALL(*_connection, send_ready_for_query()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
     ON_CALL(*_connection, send_error(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
@@ -76,12 +81,22 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::optional<std::string>>&) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_in_response(_, _)).WillByDefault(Invoke([](uint16_t, FormatCode) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_out_response(_)).WillByDefault(Invoke([](uint16_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_data(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
+    ON_CALL(*_connection, flush()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
   }
 
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
@@ -112,9 +127,10 @@ TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Make sure receive_startup_packet_body is called with the magic value defined above
   EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header_length));
 
-  // Expect that the session sends out an authentication response and an initial ReadyForQuery
+  // Expect that the session sends out an authentication response, its backend key, and an initial ReadyForQuery
   EXPECT_CALL(*_connection, send_auth());
   EXPECT_CALL(*_connection, send_parameter_status(_, _)).Times(2);
+  EXPECT_CALL(*_connection, send_backend_key_data(_, _));
   EXPECT_CALL(*_connection, send_ready_for_query());
 
   // Actually run the session: googlemock will record which Connection methods are called in which order
@@ -155,6 +171,38 @@ TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionCancelsQueryOfOtherSessionOnCancelRequest) {
+  // The other session, which runs a query
+  const auto backend_key = QueryCancellationRegistry::get().register_session();
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  QueryCancellationRegistry::get().set_running_query(backend_key, cancellation_token);
+
+  // Without the secret key, the query cannot be cancelled
+  const auto wrong_secret_key = backend_key.secret_key + 1;
+  EXPECT_FALSE(QueryCancellationRegistry::get().cancel_running_query({backend_key.process_id, wrong_secret_key}));
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+
+  {
+    InSequence s;
+
+    EXPECT_CALL(*_connection, receive_startup_packet_header())
+        .WillOnce(Return(ByMove(boost::make_ready_future(PostgresWireHandler::CANCEL_REQUEST))));
+    EXPECT_CALL(*_connection, receive_cancel_request_packet_body())
+        .WillOnce(Return(ByMove(
+            boost::make_ready_future(CancelRequestPacket{backend_key.process_id, backend_key.secret_key}))));
+  }
+
+  // The connection is closed without any response
+  EXPECT_CALL(*_connection, send_auth()).Times(0);
+  EXPECT_CALL(*_connection, send_ready_for_query()).Times(0);
+  EXPECT_CALL(*_connection, receive_packet_header()).Times(0);
+
+  _session->start().wait();
+
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  QueryCancellationRegistry::get().unregister_session(backend_key);
+}
+
 TEST_F(ServerSessionTest, SessionShutsDownOnTerminationPacket) {
   InSequence s;
 
@@ -245,6 +293,86 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionSendsCopyResponse) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY foo TO STDOUT;")))));
+
+  // The CreatePipelineTask detects the COPY command and creates the pipeline for its query
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline = _create_working_sql_pipeline();
+  create_pipeline_result->is_copy_to_stdout = true;
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // The rows are sent as COPY data instead of DataRow messages
+  EXPECT_CALL(*_connection, send_copy_out_response(1));
+  EXPECT_CALL(*_connection, send_copy_data("123\n"));
+  EXPECT_CALL(*_connection, send_copy_data("1234\n"));
+  EXPECT_CALL(*_connection, send_copy_data("12345\n"));
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::CopyDone));
+  EXPECT_CALL(*_connection, send_command_complete("COPY 3"));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionReceivesCopyData) {
+  InSequence s;
+
+  StorageManager::get().add_table("foo", load_table("resources/test_data/tbl/int.tbl", 10));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY foo FROM STDIN;")))));
+
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy_from_stdin = std::make_pair("foo", FormatCode::Text);
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_copy_in_response(1, FormatCode::Text));
+
+  // The client splits the rows across messages as it likes
+  RequestHeader copy_data_request{NetworkMessageType::CopyData, 4};
+  for (const auto& data : {"12\n3", "4\n"}) {
+    EXPECT_CALL(*_connection, receive_packet_header())
+        .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+    EXPECT_CALL(*_connection, receive_copy_data_packet_body(4))
+        .WillOnce(Return(ByMove(boost::make_ready_future(std::string(data)))));
+  }
+
+  RequestHeader copy_done_request{NetworkMessageType::CopyDone, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_done_request))));
+  EXPECT_CALL(*_connection, receive_copy_done_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // Both rows fit into a single batch
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<InsertServerBatchTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, send_command_complete("COPY 2"));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   InSequence s;
 
@@ -262,7 +390,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   // The session creates a SQLPipeline using a scheduled task (we're providing a 'real' SQLPipeline in the result)
   auto sql_pipeline = _create_working_sql_pipeline();
   auto parse_server_prepared_plan_result =
-      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+      std::make_shared<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
 
@@ -272,7 +400,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"", "", {}};
+  BindPacket bind_packet = {"", "", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -290,7 +418,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
       .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
 
   EXPECT_CALL(*_connection, receive_execute_packet_body(42))
-      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("")))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 0}))));
 
   // The session executes the SQLPipeline using another scheduled task
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
@@ -316,6 +444,60 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionSuspendsPortalAtRowLimit) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  // Bind the unnamed statement to the unnamed portal
+  const auto sql_pipeline = _create_working_sql_pipeline();
+  StorageManager::get().add_prepared_plan(
+      "", std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(),
+                                         std::vector<ParameterID>{}));
+
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"", "", {}, {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  const auto placeholder_plan = sql_pipeline->get_physical_plans().front();
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(placeholder_plan->deep_copy()))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+
+  // The first Execute message asks for two of the three rows, ...
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 2}))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
+
+  EXPECT_CALL(*_connection, send_row_description(_));
+  EXPECT_CALL(*_connection, send_data_row(_)).Times(2);
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::PortalSuspended));
+
+  // ... the second one gets the remaining row without executing the plan again
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 2}))));
+
+  EXPECT_CALL(*_connection, send_data_row(_)).Times(1);
+  EXPECT_CALL(*_connection, send_command_complete("SELECT 3"));
+
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   InSequence s;
 
@@ -358,7 +540,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   // For this test, we don't actually have to set the SQL Pipeline in the result
   auto sql_pipeline = _create_working_sql_pipeline();
   auto parse_server_prepared_plan_result =
-      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+      std::make_shared<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
 
@@ -372,6 +554,11 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   EXPECT_CALL(*_connection,
               send_error("Named prepared statements must be explicitly closed before they can be redefined."));
 
+  // The session discards the rest of the pipeline and sends ReadyForQuery in response to the Sync
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
   EXPECT_CALL(*_connection, send_ready_for_query());
   EXPECT_CALL(*_connection, receive_packet_header());
 
@@ -386,13 +573,64 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingUnknownNamedStatement) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"my_named_statement", "", {}};
+  BindPacket bind_packet = {"my_named_statement", "", {}, {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  EXPECT_CALL(*_connection, send_error("The specified statement does not exist."));
+
+  // The session discards the rest of the pipeline and sends ReadyForQuery in response to the Sync
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionSkipsPipelineUntilSyncAfterError) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"my_named_statement", "", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
   EXPECT_CALL(*_connection, send_error("The specified statement does not exist."));
 
+  // The pipelined Execute message is received, but not executed
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 13};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(13)).WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, receive_execute_packet_body(_)).Times(0);
+
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionFlushesResponsesOnFlushCommand) {
+  InSequence s;
+
   EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader flush_request{NetworkMessageType::FlushCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(flush_request))));
+  EXPECT_CALL(*_connection, receive_flush_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, flush());
+
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -414,7 +652,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
 
   auto sql_pipeline = _create_working_sql_pipeline();
   auto parse_server_prepared_plan_result =
-      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+      std::make_shared<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
 
@@ -424,7 +662,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
   RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
   EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
 
-  BindPacket bind_packet = {"my_named_statement", "my_named_portal", {}};
+  BindPacket bind_packet = {"my_named_statement", "my_named_portal", {}, {}};
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
@@ -442,6 +680,11 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
 
   EXPECT_CALL(*_connection, send_error("Named portals must be explicitly closed before they can be redefined."));
 
+  // The session discards the rest of the pipeline and sends ReadyForQuery in response to the Sync
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
   EXPECT_CALL(*_connection, send_ready_for_query());
   EXPECT_CALL(*_connection, receive_packet_header());
 
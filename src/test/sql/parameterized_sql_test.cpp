@@ -0,0 +1,113 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "sql/parameterized_sql.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ParameterizedSQLTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    SQLPhysicalPlanCache::get().clear();
+  }
+
+  std::shared_ptr<const Table> execute_query(const std::string& query, bool& query_plan_cache_hit) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    const auto table = pipeline_statement.get_result_table();
+    query_plan_cache_hit = pipeline_statement.metrics()->query_plan_cache_hit;
+    return table;
+  }
+};
+
+TEST_F(ParameterizedSQLTest, ParameterizeLiterals) {
+  const auto parameterized_sql =
+      parameterize_sql_literals("SELECT a FROM t1 WHERE b > -5 AND c - 3 < 2.5 AND d = 'it''s' AND e = 12345678901");
+  ASSERT_TRUE(parameterized_sql);
+
+  EXPECT_EQ(parameterized_sql->sql, "SELECT a FROM t1 WHERE b > ? AND c - ? < ? AND d = ? AND e = ?");
+  ASSERT_EQ(parameterized_sql->values.size(), 5u);
+  EXPECT_EQ(parameterized_sql->values[0], AllTypeVariant{int32_t{-5}});
+  EXPECT_EQ(parameterized_sql->values[1], AllTypeVariant{int32_t{3}});
+  EXPECT_EQ(parameterized_sql->values[2], AllTypeVariant{2.5});
+  EXPECT_EQ(parameterized_sql->values[3], AllTypeVariant{std::string{"it's"}});
+  EXPECT_EQ(parameterized_sql->values[4], AllTypeVariant{int64_t{12345678901}});
+
+  const auto parameters = parameterized_sql->parameters();
+  ASSERT_EQ(parameters.size(), 5u);
+  EXPECT_EQ(parameters.at(ParameterID{3}), AllTypeVariant{std::string{"it's"}});
+}
+
+TEST_F(ParameterizedSQLTest, KeepLiteralsThatAreNotValues) {
+  const auto parameterized_sql = parameterize_sql_literals(
+      "SELECT \"a1\", 1e5, t2.c FROM t2 WHERE b = 7 -- 42\n AND c = E'x' /* 'y' */ LIMIT 10 OFFSET 4");
+  ASSERT_TRUE(parameterized_sql);
+
+  EXPECT_EQ(parameterized_sql->sql,
+            "SELECT \"a1\", 1e5, t2.c FROM t2 WHERE b = ? -- 42\n AND c = E'x' /* 'y' */ LIMIT 10 OFFSET 4");
+  ASSERT_EQ(parameterized_sql->values.size(), 1u);
+  EXPECT_EQ(parameterized_sql->values[0], AllTypeVariant{int32_t{7}});
+}
+
+TEST_F(ParameterizedSQLTest, NoParameterizableLiterals) {
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t"));
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t WHERE a = ? AND b = 3"));
+  EXPECT_FALSE(parameterize_sql_literals("SELECT * FROM t WHERE a = 'unterminated"));
+  EXPECT_FALSE(parameterize_sql_literals("INSERT INTO t VALUES (1, 'a')"));
+  EXPECT_FALSE(parameterize_sql_literals("DELETE FROM t WHERE a = 1"));
+}
+
+TEST_F(ParameterizedSQLTest, CacheKeyContainsDataTypes) {
+  const auto int_key = parameterize_sql_literals("SELECT * FROM t WHERE a > 1")->cache_key;
+  EXPECT_EQ(int_key, parameterize_sql_literals("SELECT * FROM t WHERE a > 2")->cache_key);
+  EXPECT_NE(int_key, parameterize_sql_literals("SELECT * FROM t WHERE a > 1.5")->cache_key);
+  EXPECT_NE(int_key, parameterize_sql_literals("SELECT * FROM t WHERE a > 12345678901")->cache_key);
+}
+
+TEST_F(ParameterizedSQLTest, ShareCachedPlan) {
+  auto query_plan_cache_hit = false;
+
+  const auto table_1000 = execute_query("SELECT * FROM table_a WHERE a > 1000", query_plan_cache_hit);
+  EXPECT_FALSE(query_plan_cache_hit);
+  EXPECT_EQ(table_1000->row_count(), 2u);
+
+  const auto table_10000 = execute_query("SELECT * FROM table_a WHERE a > 10000", query_plan_cache_hit);
+  EXPECT_TRUE(query_plan_cache_hit);
+  EXPECT_EQ(table_10000->row_count(), 1u);
+
+  const auto table_100 = execute_query("SELECT * FROM table_a WHERE a > 100 AND b < 457.0", query_plan_cache_hit);
+  EXPECT_FALSE(query_plan_cache_hit);
+  EXPECT_EQ(table_100->row_count(), 1u);
+
+  // The cached plan does not keep the values of the previous statement
+  const auto table_1000_again = execute_query("SELECT * FROM table_a WHERE a > 1000", query_plan_cache_hit);
+  EXPECT_TRUE(query_plan_cache_hit);
+  EXPECT_EQ(table_1000_again->row_count(), 2u);
+
+  const auto& cache = SQLPhysicalPlanCache::get();
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.has(parameterize_sql_literals("SELECT * FROM table_a WHERE a > 1")->cache_key));
+}
+
+TEST_F(ParameterizedSQLTest, LiteralsOutsideOfPredicates) {
+  // The literal is part of the column name, so the statement is cached under its SQL string
+  const auto query = std::string{"SELECT a + 1 FROM table_a WHERE a > 1000"};
+  auto query_plan_cache_hit = false;
+
+  const auto table = execute_query(query, query_plan_cache_hit);
+  EXPECT_EQ(table->row_count(), 2u);
+  EXPECT_EQ(table->column_name(ColumnID{0}), "a + 1");
+
+  execute_query(query, query_plan_cache_hit);
+  EXPECT_TRUE(query_plan_cache_hit);
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(query));
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has(parameterize_sql_literals(query)->cache_key));
+}
+
+}  // namespace opossum
@@ -8,10 +8,13 @@
 #include "cache/gdfs_cache.hpp"
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
+#include "sql/parameterized_sql.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "storage/lqp_view.hpp"
 #include "storage/storage_manager.hpp"
+#include "tasks/chunk_compression_task.hpp"
 
 namespace opossum {
 
@@ -40,6 +43,7 @@ class QueryPlanCacheTest : public BaseTest {
 
   const std::string Q1 = "SELECT * FROM table_a;";
   const std::string Q2 = "SELECT * FROM table_b;";
+  // Cached under its parameterized SQL string, see ParameterizedSQL
   const std::string Q3 = "SELECT * FROM table_a WHERE a > 1;";
 
   size_t _query_plan_cache_hits;
@@ -83,7 +87,7 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRU) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(parameterize_sql_literals(Q3)->cache_key));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
@@ -113,7 +117,7 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheGDFS) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(parameterize_sql_literals(Q3)->cache_key));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
@@ -140,11 +144,76 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(parameterize_sql_literals(Q3)->cache_key));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
   EXPECT_EQ(5u, _query_plan_cache_hits);
 }
 
+TEST_F(QueryPlanCacheTest, DropTableEvictsItsPlans) {
+  execute_query(Q1);
+  execute_query(Q2);
+
+  StorageManager::get().drop_table("table_a");
+
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has(Q1));
+  EXPECT_FALSE(SQLLogicalPlanCache::get().has(Q1));
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(Q2));
+  EXPECT_TRUE(SQLLogicalPlanCache::get().has(Q2));
+}
+
+TEST_F(QueryPlanCacheTest, ReplacedTableGetsNewPlans) {
+  execute_query(Q1);
+
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+  auto pipeline_statement = SQLPipelineBuilder{Q1}.create_pipeline_statement();
+  const auto table = pipeline_statement.get_result_table();
+  EXPECT_FALSE(pipeline_statement.metrics()->query_plan_cache_hit);
+  EXPECT_TABLE_EQ_UNORDERED(table, StorageManager::get().get_table("table_a"));
+}
+
+TEST_F(QueryPlanCacheTest, DropViewEvictsPlansOfItsTables) {
+  execute_query("CREATE VIEW view_a AS SELECT a FROM table_a;");
+  const auto view_query = std::string{"SELECT * FROM view_a;"};
+  execute_query(view_query);
+  execute_query(Q2);
+
+  StorageManager::get().drop_view("view_a");
+
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has(view_query));
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(Q2));
+}
+
+TEST_F(QueryPlanCacheTest, EncodingEvictsPlans) {
+  execute_query(Q1);
+  execute_query(Q2);
+
+  ChunkCompressionTask{"table_a", ChunkID{0}}.execute();
+
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has(Q1));
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(Q2));
+}
+
+TEST_F(QueryPlanCacheTest, RowCountDriftEvictsPlans) {
+  execute_query(Q1);
+
+  // table_a has three rows, one more is no significant drift
+  execute_query("INSERT INTO table_a VALUES (1, 1.0);");
+  execute_query(Q1);
+  EXPECT_EQ(_query_plan_cache_hits, 1u);
+
+  execute_query("INSERT INTO table_a VALUES (2, 2.0);");
+  execute_query("INSERT INTO table_a VALUES (3, 3.0);");
+  execute_query("INSERT INTO table_a VALUES (4, 4.0);");
+  _query_plan_cache_hits = 0;
+
+  execute_query(Q1);
+  EXPECT_EQ(_query_plan_cache_hits, 0u);
+  execute_query(Q1);
+  EXPECT_EQ(_query_plan_cache_hits, 1u);
+}
+
 }  // namespace opossum
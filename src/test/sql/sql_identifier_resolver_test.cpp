@@ -1,4 +1,5 @@
 #include <memory>
+#include <utility>
 
 #include "base_test.hpp"
 #include "expression/abstract_expression.hpp"
@@ -176,6 +177,23 @@ TEST_F(SQLIdentifierResolverTest, DeepEqualsIsUsed) {
   EXPECT_EQ(context.get_expression_identifier(expression_a2), SQLIdentifier("a2"s, "T2"));
 }
 
+TEST_F(SQLIdentifierResolverTest, Append) {
+  const auto expression_a2 = std::make_shared<LQPColumnExpression>(LQPColumnReference(node_b, ColumnID{0}));
+  auto other_context = SQLIdentifierResolver{};
+  other_context.set_column_name(expression_a2, "a");
+  other_context.set_table_name(expression_a2, "T3");
+
+  context.append(std::move(other_context));
+  EXPECT_EQ(context.resolve_identifier_relaxed({"a"s}), nullptr);
+  EXPECT_EQ(context.resolve_identifier_relaxed({"a"s, "T3"}), expression_a2);
+  EXPECT_EQ(context.get_expression_identifier(expression_a2), SQLIdentifier("a"s, "T3"));
+
+  // The appended entries can be renamed like the others
+  context.set_column_name(expression_a2, "y");
+  EXPECT_EQ(context.resolve_identifier_relaxed({"a"s}), expression_a);
+  EXPECT_EQ(context.resolve_identifier_relaxed({"y"s}), expression_a2);
+}
+
 TEST_F(SQLIdentifierResolverTest, ResolveTableName) {
   /**
    * Test that all Expressions of a table name can be found
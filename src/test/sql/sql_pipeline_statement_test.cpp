@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -521,6 +522,7 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_EQ(metrics->optimize_time_nanos, zero_duration);
   EXPECT_EQ(metrics->lqp_translate_time_nanos, zero_duration);
   EXPECT_EQ(metrics->execution_time_nanos, zero_duration);
+  EXPECT_TRUE(metrics->optimizer_rule_durations.empty());
 
   // Run to get times
   sql_pipeline.get_result_table();
@@ -529,6 +531,22 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_GT(metrics->optimize_time_nanos, zero_duration);
   EXPECT_GT(metrics->lqp_translate_time_nanos, zero_duration);
   EXPECT_GT(metrics->execution_time_nanos, zero_duration);
+
+  // The rules take part of the time of the optimizer
+  auto rule_time_nanos = zero_duration;
+  for (const auto& [rule_name, rule_duration] : metrics->optimizer_rule_durations) {
+    rule_time_nanos += rule_duration;
+  }
+  EXPECT_LE(rule_time_nanos, metrics->optimize_time_nanos);
+  EXPECT_TRUE(std::any_of(metrics->optimizer_rule_durations.begin(), metrics->optimizer_rule_durations.end(),
+                          [](const auto& rule_duration) { return rule_duration.first == "JoinOrderingRule"; }));
+}
+
+TEST_F(SQLPipelineStatementTest, MemoryBudgetOnlyLimitsIntermediateData) {
+  // The scan does not allocate intermediate data from the QueryMemoryResource, so even a budget of one byte is enough
+  auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.with_memory_budget(1).create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _table_a);
+  EXPECT_EQ(sql_pipeline.metrics()->peak_memory_bytes, 0u);
 }
 
 TEST_F(SQLPipelineStatementTest, ParseErrorDebugMessage) {
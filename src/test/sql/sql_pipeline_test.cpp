@@ -6,14 +6,17 @@
 #include "SQLParser.h"
 #include "SQLParserResult.h"
 #include "gtest/gtest.h"
+#include "concurrency/transaction_manager.hpp"
 #include "logical_query_plan/join_node.hpp"
 
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -376,6 +379,87 @@ TEST_F(SQLPipelineTest, GetResultTableExecutionRequired) {
   EXPECT_TABLE_EQ_UNORDERED(table, _table_a)
 }
 
+TEST_F(SQLPipelineTest, GetResultTableBatchedInserts) {
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  auto sql_pipeline = SQLPipelineBuilder{
+      "INSERT INTO table_a VALUES (11, 11.11); INSERT INTO table_a VALUES (-12, 12.5); "
+      "INSERT INTO table_a (b, a) VALUES (13.5, 13);"}
+                          .create_pipeline();
+  const auto& tables = sql_pipeline.get_result_tables();
+  ASSERT_EQ(tables.size(), 3u);
+  EXPECT_EQ(tables[0], nullptr);
+
+  // The rows were inserted by a single transaction
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id + 1);
+
+  auto expected_table = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data);
+  expected_table->append({11, 11.11f});
+  expected_table->append({-12, 12.5f});
+  expected_table->append({13, 13.5f});
+  EXPECT_TABLE_EQ_UNORDERED(
+      SQLPipelineBuilder{"SELECT * FROM table_a WHERE a < 100"}.create_pipeline().get_result_table(), expected_table);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableBatchedInsertsInTransaction) {
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto sql_pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (11, 11.11); INSERT INTO table_a VALUES (12, 1.5)"}
+                          .with_transaction_context(transaction_context)
+                          .create_pipeline();
+  sql_pipeline.get_result_tables();
+  EXPECT_EQ(sql_pipeline.failed_pipeline_statement(), nullptr);
+
+  EXPECT_EQ(SQLPipelineBuilder{"SELECT * FROM table_a"}
+                .with_transaction_context(transaction_context)
+                .create_pipeline()
+                .get_result_table()
+                ->row_count(),
+            5u);
+
+  transaction_context->rollback();
+  EXPECT_EQ(SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline().get_result_table()->row_count(), 3u);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableBatchedInsertsWithCasts) {
+  // A string has to be cast into the Int column by the ExpressionEvaluator, so that it ends the first batch
+  auto sql_pipeline = SQLPipelineBuilder{
+      "INSERT INTO table_a VALUES (11, 11); INSERT INTO table_a VALUES (12, 12.5); "
+      "INSERT INTO table_a VALUES ('13', 13.5); INSERT INTO table_a VALUES (14, 14.5); "
+      "INSERT INTO table_a VALUES (15, -15.5)"}
+                          .create_pipeline();
+  sql_pipeline.get_result_tables();
+
+  const auto table =
+      SQLPipelineBuilder{"SELECT a, b FROM table_a WHERE a < 100 ORDER BY a"}.create_pipeline().get_result_table();
+  ASSERT_EQ(table->row_count(), 5u);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 2), 13);
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 0), 11.0f);
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 4), -15.5f);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableNotBatchedInserts) {
+  // The value of the second INSERT depends on the first one
+  auto sql_pipeline = SQLPipelineBuilder{
+      "INSERT INTO table_a VALUES (11, 11.11); "
+      "INSERT INTO table_a VALUES ((SELECT MAX(a) FROM table_a WHERE a < 100) + 1, 1.5); "
+      "SELECT a FROM table_a WHERE a < 100"}
+                          .create_pipeline();
+  const auto table = sql_pipeline.get_result_table();
+  ASSERT_EQ(table->row_count(), 2u);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 0) + table->get_value<int32_t>(ColumnID{0}, 1), 23);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableMultipleWithScheduler) {
+  // The SELECT is optimized while the INSERT is executed
+  auto sql_pipeline = SQLPipelineBuilder{_multi_statement_query}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& table = sql_pipeline.get_result_table();
+
+  EXPECT_TABLE_EQ_UNORDERED(table, _table_a_multi);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableWithScheduler) {
   auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
 
@@ -412,6 +496,45 @@ TEST_F(SQLPipelineTest, DisabledCleanupWithScheduler) {
   }
 }
 
+TEST_F(SQLPipelineTest, GetResultTableInResourceGroup) {
+  // Resource groups live as long as the program, so the group is shared by repeated runs of this test
+  static const auto resource_group = ResourceGroup::create("sql_pipeline_test", 1, 1, 2);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The second statement is only admitted once the first one is done
+  auto sql_pipeline = SQLPipelineBuilder{_join_query + "; " + _select_query_a}
+                          .with_resource_group(resource_group)
+                          .create_pipeline();
+  const auto& tables = sql_pipeline.get_result_tables();
+
+  ASSERT_EQ(tables.size(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(tables[0], _join_result);
+  EXPECT_TABLE_EQ_UNORDERED(tables[1], _table_a);
+  EXPECT_EQ(resource_group->running_query_count(), 0u);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableCancelled) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  cancellation_token->cancel();
+
+  auto sql_pipeline_statement = SQLPipelineBuilder{"INSERT INTO table_a SELECT * FROM table_a"}
+                                    .with_cancellation_token(cancellation_token)
+                                    .create_pipeline_statement();
+
+  EXPECT_THROW(sql_pipeline_statement.get_result_table(), QueryCancelledException);
+  EXPECT_EQ(sql_pipeline_statement.transaction_context()->phase(), TransactionPhase::RolledBack);
+  EXPECT_EQ(_table_a->row_count(), 3u);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableWithStatementTimeout) {
+  auto sql_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_statement_timeout(std::chrono::hours{1}).create_pipeline();
+
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _table_a);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableBadQuery) {
   auto sql = "SELECT a + not_a_column FROM table_a";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class SQLResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    SQLResultCache::get().resize(16);
+  }
+
+  std::shared_ptr<const Table> execute(const std::string& sql,
+                                       const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    auto statement = builder.create_pipeline_statement();
+    const auto result_table = statement.get_result_table();
+    _result_cache_hit = statement.metrics()->result_cache_hit;
+    return result_table;
+  }
+
+  bool _result_cache_hit = false;
+};
+
+TEST_F(SQLResultCacheTest, ShareResultsOfEqualPlans) {
+  const auto result_table = execute("SELECT a FROM table_a WHERE a > 200");
+  EXPECT_FALSE(_result_cache_hit);
+  EXPECT_EQ(SQLResultCache::get().size(), 1u);
+
+  // The spelling of the statement does not matter, only its optimized LQP
+  EXPECT_EQ(execute("SELECT a FROM table_a WHERE a>200"), result_table);
+  EXPECT_TRUE(_result_cache_hit);
+
+  execute("SELECT a FROM table_a WHERE a > 300");
+  EXPECT_FALSE(_result_cache_hit);
+  EXPECT_EQ(SQLResultCache::get().hit_count(), 1u);
+}
+
+TEST_F(SQLResultCacheTest, EvictResultsOfModifiedTables) {
+  execute("SELECT * FROM table_a");
+
+  execute("INSERT INTO table_a VALUES (1, 1.0)");
+  EXPECT_EQ(execute("SELECT * FROM table_a")->row_count(), 4u);
+  EXPECT_FALSE(_result_cache_hit);
+
+  execute("DELETE FROM table_a WHERE a = 1");
+  EXPECT_EQ(execute("SELECT * FROM table_a")->row_count(), 3u);
+  EXPECT_FALSE(_result_cache_hit);
+
+  // Rows appended outside of transactions
+  StorageManager::get().get_table("table_a")->append({7, 7.0f});
+  EXPECT_EQ(execute("SELECT * FROM table_a")->row_count(), 4u);
+  EXPECT_FALSE(_result_cache_hit);
+
+  // A new table of the same name
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  EXPECT_EQ(execute("SELECT * FROM table_a")->row_count(), 3u);
+  EXPECT_FALSE(_result_cache_hit);
+
+  execute("SELECT * FROM table_a");
+  EXPECT_TRUE(_result_cache_hit);
+}
+
+TEST_F(SQLResultCacheTest, OnlyResultsOfTheSameRows) {
+  const auto old_transaction_context = TransactionManager::get().new_transaction_context();
+  execute("INSERT INTO table_a VALUES (1, 1.0)");
+
+  // The result of a newer snapshot contains rows that the older snapshot cannot see
+  EXPECT_EQ(execute("SELECT * FROM table_a")->row_count(), 4u);
+  EXPECT_EQ(execute("SELECT * FROM table_a", old_transaction_context)->row_count(), 3u);
+  EXPECT_FALSE(_result_cache_hit);
+
+  // Newer snapshots see the same rows as long as the table is not modified
+  const auto new_transaction_context = TransactionManager::get().new_transaction_context();
+  execute("SELECT * FROM table_a", new_transaction_context);
+  EXPECT_TRUE(_result_cache_hit);
+  execute("SELECT * FROM table_a");
+  EXPECT_TRUE(_result_cache_hit);
+}
+
+TEST_F(SQLResultCacheTest, NotForTransactionsWithModifications) {
+  execute("SELECT * FROM table_a WHERE a < 200");
+
+  // The transaction sees the rows that it deleted or inserted itself
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  execute("DELETE FROM table_a WHERE a = 123", transaction_context);
+  EXPECT_EQ(execute("SELECT * FROM table_a WHERE a < 200", transaction_context)->row_count(), 0u);
+  EXPECT_FALSE(_result_cache_hit);
+  transaction_context->rollback();
+
+  execute("SELECT * FROM table_a WHERE a < 200");
+  EXPECT_TRUE(_result_cache_hit);
+}
+
+TEST_F(SQLResultCacheTest, NotForOtherStatements) {
+  execute("INSERT INTO table_a VALUES (1, 1.0)");
+  execute("SELECT * FROM meta_tables");
+  EXPECT_EQ(SQLResultCache::get().size(), 0u);
+
+  auto statement = SQLPipelineBuilder{"SELECT * FROM table_a"}.disable_mvcc().create_pipeline_statement();
+  statement.get_result_table();
+  EXPECT_EQ(SQLResultCache::get().size(), 0u);
+}
+
+TEST_F(SQLResultCacheTest, Resize) {
+  execute("SELECT * FROM table_a WHERE a > 200");
+  execute("SELECT * FROM table_a WHERE a > 300");
+  EXPECT_EQ(SQLResultCache::get().size(), 2u);
+
+  SQLResultCache::get().resize(1);
+  EXPECT_EQ(SQLResultCache::get().size(), 1u);
+
+  // A capacity of 0 disables the cache
+  SQLResultCache::get().resize(0);
+  execute("SELECT * FROM table_a WHERE a > 200");
+  EXPECT_EQ(SQLResultCache::get().size(), 0u);
+  EXPECT_FALSE(_result_cache_hit);
+}
+
+TEST_F(SQLResultCacheTest, InvalidateTable) {
+  execute("SELECT * FROM table_a");
+  EXPECT_EQ(SQLResultCache::get().size(), 1u);
+
+  SQLResultCache::get().invalidate_table("table_b");
+  EXPECT_EQ(SQLResultCache::get().size(), 1u);
+  SQLResultCache::get().invalidate_table("table_a");
+  EXPECT_EQ(SQLResultCache::get().size(), 0u);
+}
+
+}  // namespace opossum
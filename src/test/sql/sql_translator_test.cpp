@@ -618,6 +618,15 @@ TEST_F(SQLTranslatorTest, AggregateCount) {
   // clang-format on
   EXPECT_LQP_EQ(actual_lqp_count_distinct_a_plus_b, expected_lqp_count_distinct_a_plus_b);
 
+  const auto actual_lqp_approx_count_distinct_a =
+      compile_query("SELECT b, APPROX_COUNT_DISTINCT(a) FROM int_float GROUP BY b");
+  // clang-format off
+  const auto expected_lqp_approx_count_distinct_a =
+  AggregateNode::make(expression_vector(int_float_b), expression_vector(approx_count_distinct_(int_float_a)),
+    stored_table_node_int_float);
+  // clang-format on
+  EXPECT_LQP_EQ(actual_lqp_approx_count_distinct_a, expected_lqp_approx_count_distinct_a);
+
   const auto actual_lqp_count_1 = compile_query("SELECT a, COUNT(1) FROM int_float GROUP BY a");
   // clang-format off
   const auto expected_lqp_count_1 =
@@ -9,6 +9,9 @@ INSTANTIATE_TEST_CASE_P(SQLiteTestRunnerEncodings, SQLiteTestRunner,
                         testing::Combine(testing::ValuesIn(SQLiteTestRunner::queries()), testing::ValuesIn({false}),
                                          testing::ValuesIn({EncodingType::Dictionary, EncodingType::RunLength,
                                                             EncodingType::FixedStringDictionary,
-                                                            EncodingType::FrameOfReference})), );  // NOLINT
+                                                            EncodingType::FrameOfReference,
+                                                            EncodingType::Delta, EncodingType::LZ4,
+                                                            EncodingType::FrontCodedDictionary,
+                                                            EncodingType::ColumnGroup})), );  // NOLINT
 
 }  // namespace opossum
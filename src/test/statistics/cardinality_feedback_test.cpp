@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CardinalityFeedbackTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 100 rows with the values 0 to 99 in chunks of 10 rows
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10,
+                                               UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      table->append({value});
+    }
+    StorageManager::get().add_table("t", table);
+
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "a");
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "b");
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+  }
+
+  // Executes the @param lqp with pipelined operators and records the output row counts of its operators
+  static double execute_and_record(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes));
+    return CardinalityFeedback::get().record(pqp);
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b;
+  LQPColumnReference a_a, b_a;
+};
+
+TEST_F(CardinalityFeedbackTest, Key) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 5), node_a);
+  const auto key = CardinalityFeedback::key(*predicate_node);
+  ASSERT_TRUE(key);
+  EXPECT_EQ(key, CardinalityFeedback::key(*PredicateNode::make(greater_than_(a_a, 5), node_a)));
+
+  // Equally named columns of other tables and other values are different predicates
+  EXPECT_NE(key, CardinalityFeedback::key(*PredicateNode::make(greater_than_(b_a, 5), node_b)));
+  EXPECT_NE(key, CardinalityFeedback::key(*PredicateNode::make(greater_than_(a_a, 6), node_a)));
+
+  // The inputs of inner joins can be swapped
+  const auto join_node = JoinNode::make(JoinMode::Inner, less_than_(a_a, b_a), node_a, node_b);
+  const auto join_key = CardinalityFeedback::key(*join_node);
+  ASSERT_TRUE(join_key);
+  EXPECT_EQ(join_key,
+            CardinalityFeedback::key(*JoinNode::make(JoinMode::Inner, greater_than_(b_a, a_a), node_b, node_a)));
+  EXPECT_NE(join_key, CardinalityFeedback::key(*JoinNode::make(JoinMode::Left, less_than_(a_a, b_a), node_a, node_b)));
+
+  EXPECT_FALSE(CardinalityFeedback::key(*node_a));
+  EXPECT_FALSE(CardinalityFeedback::key(*JoinNode::make(JoinMode::Cross, node_a, node_b)));
+}
+
+TEST_F(CardinalityFeedbackTest, Correct) {
+  const auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+      std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000.0f, 0, 999)};
+  node_a->set_statistics(std::make_shared<TableStatistics>(TableType::Data, 1'000.0f, column_statistics));
+
+  const auto predicate_node = PredicateNode::make(greater_than_(add_(a_a, 1), 5), node_a);
+  const auto key = *CardinalityFeedback::key(*predicate_node);
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), 1'000.0f);
+
+  // Estimates that are almost right are not corrected
+  CardinalityFeedback::get().observe(key, 1.05);
+  EXPECT_DOUBLE_EQ(CardinalityFeedback::get().correction(key), 1.0);
+
+  CardinalityFeedback::get().observe(key, 0.1);
+  EXPECT_DOUBLE_EQ(CardinalityFeedback::get().correction(key), 0.1);
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), 100.0f);
+
+  // Later observations are combined with the correction learned before
+  CardinalityFeedback::get().observe(key, 4.0);
+  EXPECT_DOUBLE_EQ(CardinalityFeedback::get().correction(key), 0.2);
+
+  CardinalityFeedback::get().observe(key, 0.0);
+  EXPECT_DOUBLE_EQ(CardinalityFeedback::get().correction(key), 1.0 / CardinalityFeedback::MAX_CORRECTION);
+}
+
+TEST_F(CardinalityFeedbackTest, Record) {
+  // The estimate assumes that all rows qualify for a predicate that is not a simple column comparison
+  const auto stored_table_node = StoredTableNode::make("t");
+  const auto a = stored_table_node->get_column("a");
+  const auto predicate_node = PredicateNode::make(greater_than_(add_(a, 1), 1'000), stored_table_node);
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), 100.0f);
+
+  EXPECT_DOUBLE_EQ(execute_and_record(predicate_node), 100.0);
+  EXPECT_DOUBLE_EQ(CardinalityFeedback::get().correction(*CardinalityFeedback::key(*predicate_node)), 0.01);
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), 1.0f);
+
+  // The corrected estimate is right
+  EXPECT_NEAR(execute_and_record(predicate_node), 1.0, 1e-6);
+  EXPECT_NEAR(CardinalityFeedback::get().correction(*CardinalityFeedback::key(*predicate_node)), 0.01, 1e-6);
+}
+
+TEST_F(CardinalityFeedbackTest, RecordSkipsIncompleteOperators) {
+  // The Limit stops the pipeline of the TableScan before it has processed all chunks
+  const auto stored_table_node = StoredTableNode::make("t");
+  const auto a = stored_table_node->get_column("a");
+  const auto predicate_node = PredicateNode::make(greater_than_(add_(a, 1), 50), stored_table_node);
+  const auto lqp = LimitNode::make(value_(int64_t{5}), predicate_node);
+
+  execute_and_record(lqp);
+  EXPECT_DOUBLE_EQ(CardinalityFeedback::get().correction(*CardinalityFeedback::key(*predicate_node)), 1.0);
+}
+
+TEST_F(CardinalityFeedbackTest, ReoptimizeCachedPlan) {
+  const auto execute = [](const std::string& sql) {
+    auto pipeline_statement = SQLPipelineBuilder{sql}.disable_mvcc().create_pipeline_statement();
+    pipeline_statement.get_result_table();
+    return pipeline_statement.metrics()->query_plan_cache_hit;
+  };
+
+  // The first execution evicts its plan, as it estimated 100 times the actual rows
+  EXPECT_FALSE(execute("SELECT * FROM t WHERE a + 1 > 1000"));
+  EXPECT_FALSE(execute("SELECT * FROM t WHERE a + 1 > 1000"));
+  EXPECT_TRUE(execute("SELECT * FROM t WHERE a + 1 > 1000"));
+}
+
+}  // namespace opossum
@@ -98,4 +98,26 @@ TYPED_TEST(MinMaxFilterTest, CanPruneOnBounds) {
   EXPECT_FALSE(filter->can_prune(PredicateCondition::IsNotNull, {this->_min_value}, {this->_in_between}));
 }
 
+TEST(MinMaxFilterStringTest, CanPruneOnLikePrefix) {
+  const auto filter = std::make_unique<MinMaxFilter<std::string>>("aa", "c");
+
+  // The strings that start with the prefix of the pattern are not between the minimum and the maximum
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Like, {"d%"}));
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Like, {"ca%"}));
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Like, {"0_"}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Like, {"a%"}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Like, {"b%c"}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Like, {"c%"}));
+
+  // Without a prefix, any string may match
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Like, {"%z"}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Like, {"_"}));
+
+  // Without wildcards, the pattern is compared like a value
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Like, {"d"}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Like, {"b"}));
+
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::NotLike, {"d%"}));
+}
+
 }  // namespace opossum
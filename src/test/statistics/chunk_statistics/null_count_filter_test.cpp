@@ -0,0 +1,40 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/null_count_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class NullCountFilterTest : public BaseTest {};
+
+TEST_F(NullCountFilterTest, CanPruneWithoutNulls) {
+  const auto filter = std::make_unique<NullCountFilter>(0, 10);
+
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::IsNull, NULL_VALUE));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::IsNotNull, NULL_VALUE));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Equals, {5}));
+}
+
+TEST_F(NullCountFilterTest, CanPruneWithSomeNulls) {
+  const auto filter = std::make_unique<NullCountFilter>(3, 10);
+
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::IsNull, NULL_VALUE));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::IsNotNull, NULL_VALUE));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Equals, {5}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Between, {5}, {7}));
+}
+
+TEST_F(NullCountFilterTest, CanPruneWithOnlyNulls) {
+  const auto filter = std::make_unique<NullCountFilter>(10, 10);
+
+  // NULLs only match IS NULL
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::IsNull, NULL_VALUE));
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::IsNotNull, NULL_VALUE));
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Equals, {5}));
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Between, {5}, {7}));
+}
+
+}  // namespace opossum
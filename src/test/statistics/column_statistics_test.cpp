@@ -20,20 +20,27 @@ class ColumnStatisticsTest : public BaseTest {
   void SetUp() override {
     _table_with_different_column_types = load_table("resources/test_data/tbl/int_float_double_string.tbl");
     auto table_statistics1 = generate_table_statistics(*_table_with_different_column_types);
-    _column_statistics_int = std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(
-        std::const_pointer_cast<BaseColumnStatistics>(table_statistics1.column_statistics()[0]));
-    _column_statistics_float = std::dynamic_pointer_cast<ColumnStatistics<float>>(
-        std::const_pointer_cast<BaseColumnStatistics>(table_statistics1.column_statistics()[1]));
-    _column_statistics_double = std::dynamic_pointer_cast<ColumnStatistics<double>>(
-        std::const_pointer_cast<BaseColumnStatistics>(table_statistics1.column_statistics()[2]));
-    _column_statistics_string = std::dynamic_pointer_cast<ColumnStatistics<std::string>>(
-        std::const_pointer_cast<BaseColumnStatistics>(table_statistics1.column_statistics()[3]));
+    _column_statistics_int = without_histogram<int32_t>(table_statistics1.column_statistics()[0]);
+    _column_statistics_float = without_histogram<float>(table_statistics1.column_statistics()[1]);
+    _column_statistics_double = without_histogram<double>(table_statistics1.column_statistics()[2]);
+    _column_statistics_string = without_histogram<std::string>(table_statistics1.column_statistics()[3]);
 
     _table_uniform_distribution = load_table("resources/test_data/tbl/int_equal_distribution.tbl");
     auto table_statistics2 = generate_table_statistics(*_table_uniform_distribution);
     _column_statistics_uniform_columns = table_statistics2.column_statistics();
   }
 
+  // The expected selectivities assume uniformly distributed values, i.e., the estimation without histograms. Those
+  // with histograms are tested in GenerateTableStatisticsTest.
+  template <typename T>
+  static std::shared_ptr<ColumnStatistics<T>> without_histogram(
+      const std::shared_ptr<const BaseColumnStatistics>& base_column_statistics) {
+    const auto& column_statistics = static_cast<const ColumnStatistics<T>&>(*base_column_statistics);
+    return std::make_shared<ColumnStatistics<T>>(column_statistics.null_value_ratio(),
+                                                 column_statistics.distinct_count(), column_statistics.min(),
+                                                 column_statistics.max());
+  }
+
   // For single value scans (i.e. all but BETWEEN)
   template <typename T>
   void predict_selectivities_and_compare(const std::shared_ptr<ColumnStatistics<T>>& column_statistic,
@@ -1,9 +1,16 @@
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
 #include "statistics/column_statistics.hpp"
+#include "statistics/column_statistics_builder.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "statistics_test_utils.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -24,4 +31,74 @@ TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsUnsampled) {
   EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
 }
 
+TEST_F(GenerateTableStatisticsTest, SkewedColumnHistogram) {
+  // 90 rows with the value 1, one row each for the values 2 to 11, and 10 NULLs, in chunks of 16 rows
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String}}, TableType::Data, 16);
+  for (auto row_id = 0; row_id < 110; ++row_id) {
+    const auto a = row_id < 90 ? AllTypeVariant{1} : row_id < 100 ? AllTypeVariant{row_id - 88} : NULL_VALUE;
+    table->append({a, row_id < 90 ? std::string{"x"} : std::string{"\t"} + std::to_string(row_id)});
+  }
+  const auto table_statistics = generate_table_statistics(*table);
+
+  const auto& a_statistics =
+      static_cast<const ColumnStatistics<int32_t>&>(*table_statistics.column_statistics().at(0));
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(0), 10.0f / 110.0f, 11, 1, 11);
+  ASSERT_TRUE(a_statistics.histogram());
+  EXPECT_EQ(a_statistics.histogram()->total_count(), 100u);
+
+  const auto estimate_a = [](const TableStatistics& statistics, const PredicateCondition predicate_condition,
+                             const int32_t value) {
+    return statistics.estimate_predicate(ColumnID{0}, predicate_condition, value).row_count();
+  };
+
+  // With uniformly distributed values, every value would be estimated to make up 1/11 of the non-null rows
+  EXPECT_NEAR(estimate_a(table_statistics, PredicateCondition::Equals, 1), 90.0f, 0.001f);
+  EXPECT_NEAR(estimate_a(table_statistics, PredicateCondition::Equals, 5), 1.0f, 0.001f);
+  EXPECT_NEAR(estimate_a(table_statistics, PredicateCondition::NotEquals, 1), 10.0f, 0.001f);
+  EXPECT_NEAR(estimate_a(table_statistics, PredicateCondition::GreaterThan, 1), 10.0f, 0.001f);
+  EXPECT_NEAR(estimate_a(table_statistics, PredicateCondition::LessThanEquals, 4), 93.0f, 0.001f);
+
+  // The narrowed statistics keep the histogram
+  const auto narrowed_statistics = table_statistics.estimate_predicate(ColumnID{0}, PredicateCondition::LessThan, 6);
+  EXPECT_NEAR(estimate_a(narrowed_statistics, PredicateCondition::Equals, 1), 90.0f, 0.001f);
+
+  // Strings with characters that string histograms do not support are estimated without one
+  const auto& b_statistics =
+      static_cast<const ColumnStatistics<std::string>&>(*table_statistics.column_statistics().at(1));
+  EXPECT_FALSE(b_statistics.histogram());
+  EXPECT_FLOAT_EQ(
+      table_statistics.estimate_predicate(ColumnID{1}, PredicateCondition::Equals, std::string{"x"}).row_count(),
+      110.0f / 21.0f);
+}
+
+TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsSampled) {
+  // 20 chunks of four blocks each. Column a has 1'000 distinct values that occur in every block, column b is unique.
+  const auto chunk_size = ChunkOffset{4 * StatisticsSample::BLOCK_SIZE};
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}}, TableType::Data, chunk_size);
+  for (auto chunk_id = int32_t{0}; chunk_id < 20; ++chunk_id) {
+    auto a_values = std::vector<int32_t>(chunk_size);
+    auto b_values = std::vector<int32_t>(chunk_size);
+    for (auto chunk_offset = int32_t{0}; chunk_offset < static_cast<int32_t>(chunk_size); ++chunk_offset) {
+      a_values[chunk_offset] = chunk_offset % 1'000;
+      b_values[chunk_offset] = chunk_id * static_cast<int32_t>(chunk_size) + chunk_offset;
+    }
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(a_values)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(b_values))});
+  }
+
+  // Every fourth block is read
+  const auto table_statistics = generate_table_statistics(*table, 0.25);
+  EXPECT_EQ(table_statistics.row_count(), 20u * chunk_size);
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(0), 0.0f, 1'000, 0, 999);
+
+  // The distinct count of b is extrapolated from the rows that were read
+  const auto b_distinct_count = table_statistics.column_statistics().at(1)->distinct_count();
+  EXPECT_GT(b_distinct_count, 5.0f * chunk_size);
+  EXPECT_LE(b_distinct_count, 20.0f * chunk_size);
+
+  EXPECT_THROW(generate_table_statistics(*table, 0.0), std::logic_error);
+}
+
 }  // namespace opossum
@@ -0,0 +1,55 @@
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+#include "statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public ::testing::Test {};
+
+TEST_F(HyperLogLogTest, SmallCountsAreExact) {
+  auto hyper_log_log = HyperLogLog{};
+  EXPECT_DOUBLE_EQ(hyper_log_log.estimate(), 0.0);
+
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = uint64_t{0}; value < 1'000; ++value) {
+      hyper_log_log.add(value);
+    }
+  }
+  EXPECT_DOUBLE_EQ(hyper_log_log.estimate(), 1'000.0);
+}
+
+TEST_F(HyperLogLogTest, LargeCounts) {
+  auto hyper_log_log = HyperLogLog{};
+  for (auto value = uint64_t{0}; value < 1'000'000; ++value) {
+    hyper_log_log.add(value);
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 1'000'000.0, 30'000.0);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  // The values 0 to 1'499 and 1'000 to 2'999, so that the merged HyperLogLog is no longer sparse
+  auto hyper_log_log_a = HyperLogLog{};
+  auto hyper_log_log_b = HyperLogLog{};
+  for (auto value = uint64_t{0}; value < 1'500; ++value) {
+    hyper_log_log_a.add(value);
+  }
+  for (auto value = uint64_t{1'000}; value < 3'000; ++value) {
+    hyper_log_log_b.add(value);
+  }
+
+  hyper_log_log_a.merge(hyper_log_log_b);
+  EXPECT_NEAR(hyper_log_log_a.estimate(), 3'000.0, 90.0);
+
+  // Merging again does not add values
+  hyper_log_log_a.merge(hyper_log_log_b);
+  EXPECT_NEAR(hyper_log_log_a.estimate(), 3'000.0, 90.0);
+
+  auto hyper_log_log_c = HyperLogLog{};
+  hyper_log_log_c.add(5'000);
+  hyper_log_log_c.merge(HyperLogLog{});
+  EXPECT_DOUBLE_EQ(hyper_log_log_c.estimate(), 1.0);
+}
+
+}  // namespace opossum
@@ -79,6 +79,37 @@ TEST_P(AnySegmentIterableTest, IntWithPositionFilter) {
   EXPECT_EQ(index, position_filter->size());
 }
 
+TEST_P(AnySegmentIterableTest, MultipleBlocks) {
+  // Values and NULLs of more than two blocks, see AnySegmentIterator::BLOCK_SIZE
+  const auto size = AnySegmentIterator<int32_t>::BLOCK_SIZE * 2 + 10;
+  auto values = pmr_concurrent_vector<int32_t>{};
+  auto nulls = pmr_concurrent_vector<bool>{};
+  for (auto index = size_t{0}; index < size; ++index) {
+    values.push_back(static_cast<int32_t>(index));
+    nulls.push_back(index % 3 == 0);
+  }
+  const auto segment = ValueSegment<int32_t>{std::move(values), std::move(nulls)};
+
+  create_any_segment_iterable<int32_t>(segment).with_iterators([&](auto it, const auto end) {
+    EXPECT_EQ(std::distance(it, end), static_cast<std::ptrdiff_t>(size));
+
+    // A copy continues independently of the original
+    auto skipped_it = it;
+    std::advance(skipped_it, AnySegmentIterator<int32_t>::BLOCK_SIZE + 3);
+    EXPECT_EQ(skipped_it->chunk_offset(), AnySegmentIterator<int32_t>::BLOCK_SIZE + 3);
+
+    for (auto index = size_t{0}; index < size; ++index, ++it) {
+      ASSERT_NE(it, end);
+      EXPECT_EQ(it->is_null(), index % 3 == 0);
+      if (!it->is_null()) {
+        EXPECT_EQ(it->value(), static_cast<int32_t>(index));
+      }
+      EXPECT_EQ(it->chunk_offset(), index);
+    }
+    EXPECT_EQ(it, end);
+  });
+}
+
 INSTANTIATE_TEST_CASE_P(
     AnySegmentIterableTestInstances, AnySegmentIterableTest,
     ::testing::Values(SegmentEncodingSpec{EncodingType::Unencoded}, SegmentEncodingSpec{EncodingType::Dictionary},
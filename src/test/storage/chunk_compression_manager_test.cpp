@@ -0,0 +1,178 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_access_counter.hpp"
+#include "storage/chunk_compression_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class ChunkCompressionManagerTest : public BaseTest {
+ protected:
+  template <typename T>
+  static EncodingType select_encoding(
+      const std::vector<T>& values,
+      const ChunkCompressionManager::ChunkTemperature temperature = ChunkCompressionManager::ChunkTemperature::Warm) {
+    const auto segment = ValueSegment<T>{values};
+    return ChunkCompressionManager::select_segment_encoding(segment, data_type_from_type<T>(), temperature)
+        .encoding_type;
+  }
+};
+
+TEST_F(ChunkCompressionManagerTest, SelectSegmentEncoding) {
+  using ChunkTemperature = ChunkCompressionManager::ChunkTemperature;
+
+  auto long_runs = std::vector<int32_t>{};
+  auto unique_values = std::vector<int32_t>{};
+  auto few_distinct_values = std::vector<int32_t>{};
+  auto sorted_values = std::vector<int64_t>{};
+  for (auto value = 0; value < 100; ++value) {
+    long_runs.emplace_back(value / 10);
+    unique_values.emplace_back((value * 37) % 100);
+    few_distinct_values.emplace_back(value % 3);
+    sorted_values.emplace_back(1'500'000'000'000 + value * 7 + value % 2);
+  }
+
+  EXPECT_EQ(select_encoding(long_runs), EncodingType::RunLength);
+  EXPECT_EQ(select_encoding(unique_values), EncodingType::FrameOfReference);
+  EXPECT_EQ(select_encoding(unique_values, ChunkTemperature::Hot), EncodingType::Dictionary);
+  EXPECT_EQ(select_encoding(few_distinct_values), EncodingType::Dictionary);
+  EXPECT_EQ(select_encoding(sorted_values), EncodingType::Delta);
+  EXPECT_EQ(select_encoding(sorted_values, ChunkTemperature::Hot), EncodingType::Dictionary);
+  EXPECT_EQ(select_encoding(std::vector<float>{1.5f, 2.5f, 1.5f, 3.5f}), EncodingType::Dictionary);
+
+  EXPECT_EQ(select_encoding(std::vector<std::string>{"foo", "bar", "baz", "foo"}),
+            EncodingType::FixedStringDictionary);
+  EXPECT_EQ(select_encoding(std::vector<std::string>{"a", "b", std::string(100, 'c'), "d"}),
+            EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(select_encoding(std::vector<std::string>{"a", "b", std::string(100, 'c'), "d"}, ChunkTemperature::Hot),
+            EncodingType::Dictionary);
+  EXPECT_EQ(select_encoding(std::vector<std::string>{"", "", "", "", "", "", "", "a"}), EncodingType::RunLength);
+
+  // Only cold segments of long strings are compressed using LZ4
+  const auto comments = std::vector<std::string>{"carefully final deposits detect slyly agai",
+                                                 "furiously regular pinto beans cajole quickly",
+                                                 "blithely ironic requests sleep furiously even"};
+  EXPECT_EQ(select_encoding(comments, ChunkTemperature::Cold), EncodingType::LZ4);
+  EXPECT_EQ(select_encoding(comments), EncodingType::FixedStringDictionary);
+  EXPECT_EQ(select_encoding(std::vector<std::string>{"foo", "bar", "baz", "qux"}, ChunkTemperature::Cold),
+            EncodingType::FixedStringDictionary);
+}
+
+TEST_F(ChunkCompressionManagerTest, ChunkTemperature) {
+  using ChunkTemperature = ChunkCompressionManager::ChunkTemperature;
+
+  auto options = ChunkCompressionManager::Options{};
+  options.hot_chunk_access_count = 100;
+  options.cold_chunk_access_count = 10;
+
+  const auto segments = Segments{std::make_shared<ValueSegment<int32_t>>()};
+  EXPECT_EQ(ChunkCompressionManager::chunk_temperature(Chunk{segments}, options), ChunkTemperature::Warm);
+
+  const auto access_counter = std::make_shared<ChunkAccessCounter>(PolymorphicAllocator<uint64_t>{});
+  const auto chunk = Chunk{segments, nullptr, std::nullopt, access_counter};
+  EXPECT_EQ(ChunkCompressionManager::chunk_temperature(chunk, options), ChunkTemperature::Cold);
+
+  access_counter->increment(50);
+  EXPECT_EQ(ChunkCompressionManager::chunk_temperature(chunk, options), ChunkTemperature::Warm);
+
+  access_counter->increment(50);
+  EXPECT_EQ(ChunkCompressionManager::chunk_temperature(chunk, options), ChunkTemperature::Hot);
+}
+
+TEST_F(ChunkCompressionManagerTest, ChunkAccessesPerNode) {
+  // Two nodes with four workers each
+  Topology::use_fake_numa_topology(8, 4);
+
+  auto access_counter = ChunkAccessCounter{PolymorphicAllocator<uint64_t>{}};
+  access_counter.process();
+
+  access_counter.increment(30, NodeID{0});
+  access_counter.increment(20, NodeID{1});
+  access_counter.increment(10, NodeID{1});
+  // Not accessed by a worker
+  access_counter.increment(5, INVALID_NODE_ID);
+  access_counter.process();
+
+  EXPECT_EQ(access_counter.counter(), 65u);
+  EXPECT_EQ(access_counter.node_counter(NodeID{0}), 30u);
+  EXPECT_EQ(access_counter.node_counter(NodeID{1}), 30u);
+  EXPECT_EQ(access_counter.history_sample(2), 65u);
+  EXPECT_EQ(access_counter.node_history_sample(2), std::vector<uint64_t>({30, 30}));
+
+  // Only the accesses since the earlier snapshot of the lookback count
+  access_counter.increment(40, NodeID{0});
+  access_counter.process();
+  EXPECT_EQ(access_counter.node_history_sample(2), std::vector<uint64_t>({40, 0}));
+  EXPECT_EQ(access_counter.node_history_sample(3), std::vector<uint64_t>({70, 30}));
+}
+
+TEST_F(ChunkCompressionManagerTest, CompressCompletedChunks) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table", table);
+
+  auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+
+  // The inserted rows fill two more chunks, which are not completed before the insert is committed
+  auto insert = std::make_shared<Insert>("table", get_table);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  ASSERT_EQ(table->chunk_count(), 4u);
+
+  auto& compression_manager = ChunkCompressionManager::get();
+  EXPECT_EQ(compression_manager.compress_completed_chunks(), 2u);
+  EXPECT_EQ(compression_manager.compress_completed_chunks(), 0u);
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto is_encoded = chunk_id < ChunkID{2};
+    const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(ColumnID{0}));
+    EXPECT_EQ(chunk->is_mutable(), !is_encoded);
+    EXPECT_EQ(value_segment == nullptr, is_encoded);
+  }
+
+  context->commit();
+  EXPECT_EQ(compression_manager.compress_completed_chunks(), 2u);
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->is_mutable());
+
+  // Every row of the input has been inserted once more
+  auto input_table = load_table("resources/test_data/tbl/compression_input.tbl");
+  auto expected_table = load_table("resources/test_data/tbl/compression_input.tbl");
+  for (auto row_idx = size_t{0}; row_idx < input_table->row_count(); ++row_idx) {
+    expected_table->append({input_table->get_value<std::string>(ColumnID{0}, row_idx),
+                            input_table->get_value<int32_t>(ColumnID{1}, row_idx)});
+  }
+  EXPECT_TABLE_EQ_UNORDERED(table, expected_table);
+}
+
+TEST_F(ChunkCompressionManagerTest, MaxChunksPerIteration) {
+  StorageManager::get().add_table("table", load_table("resources/test_data/tbl/compression_input.tbl", 2u));
+
+  auto& compression_manager = ChunkCompressionManager::get();
+  const auto default_options = compression_manager.options();
+
+  auto options = default_options;
+  options.max_chunks_per_iteration = 4;
+  compression_manager.set_options(options);
+
+  EXPECT_EQ(compression_manager.compress_completed_chunks(), 4u);
+  EXPECT_EQ(compression_manager.compress_completed_chunks(), 2u);
+  EXPECT_EQ(compression_manager.compress_completed_chunks(), 0u);
+
+  compression_manager.set_options(default_options);
+}
+
+}  // namespace opossum
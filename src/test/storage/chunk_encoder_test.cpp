@@ -1,12 +1,17 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <typeinfo>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "all_type_variant.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
@@ -146,4 +151,50 @@ TEST_F(ChunkEncoderTest, EncodeMultipleChunksUsingSameEncoding) {
   verify_encoding(_table->get_chunk(ChunkID{1u}), unencoded_chunk_spec);
 }
 
+TEST_F(ChunkEncoderTest, EncodeInParallelWithStatistics) {
+  // The chunks and their segments are encoded by concurrent jobs
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{{EncodingType::Unencoded}, {EncodingType::RunLength}, {EncodingType::Dictionary}};
+  ChunkEncoder::encode_all_chunks(_table, chunk_encoding_spec);
+
+  for (auto chunk_id = ChunkID{0u}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    verify_encoding(chunk, chunk_encoding_spec);
+    EXPECT_FALSE(chunk->is_mutable());
+
+    // Chunk i holds the values 5 * i to 5 * i + 4 in each column
+    const auto statistics = chunk->statistics();
+    ASSERT_TRUE(statistics);
+    const auto first_value = static_cast<int32_t>(chunk_id * 5);
+    for (auto column_id = ColumnID{0u}; column_id < chunk->column_count(); ++column_id) {
+      EXPECT_TRUE(statistics->can_prune(column_id, PredicateCondition::LessThan, first_value));
+      EXPECT_FALSE(statistics->can_prune(column_id, PredicateCondition::Equals, first_value + 4));
+      EXPECT_TRUE(statistics->can_prune(column_id, PredicateCondition::GreaterThan, first_value + 4));
+    }
+  }
+}
+
+TEST_F(ChunkEncoderTest, EncodeAllChunksAutomatically) {
+  ChunkEncoder::encode_all_chunks_automatically(_table);
+
+  for (auto chunk_id = ChunkID{0u}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+
+    // All segments of a column get the same encoding
+    for (auto column_id = ColumnID{0u}; column_id < chunk->column_count(); ++column_id) {
+      const auto& segment = *chunk->get_segment(column_id);
+      const auto& first_segment = *_table->get_chunk(ChunkID{0})->get_segment(column_id);
+      EXPECT_EQ(typeid(segment), typeid(first_segment));
+    }
+  }
+
+  for (auto row_id = size_t{0u}; row_id < _table->row_count(); ++row_id) {
+    EXPECT_EQ(_table->get_value<int32_t>(ColumnID{2}, row_id), static_cast<int32_t>(row_id));
+  }
+}
+
 }  // namespace opossum
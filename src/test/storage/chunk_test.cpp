@@ -1,4 +1,7 @@
 #include <memory>
+#include <utility>
+
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -8,6 +11,7 @@
 #include "storage/chunk.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "types.hpp"
 
@@ -61,6 +65,22 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, ReserveRows) {
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
+  EXPECT_EQ(chunk->reserve_rows(2, 10), std::make_pair(ChunkOffset{3}, ChunkOffset{2}));
+  EXPECT_EQ(chunk->reserve_rows(10, 10), std::make_pair(ChunkOffset{5}, ChunkOffset{5}));
+  EXPECT_EQ(chunk->reserve_rows(1, 10).second, 0u);
+
+  // The rows are added in the order of their reservation
+  chunk->add_reserved_rows(3, 5, [&]() {
+    vs_int->append(1);
+    vs_int->append(2);
+    vs_str->append("one");
+    vs_str->append("two");
+  });
+  EXPECT_EQ(chunk->size(), 5u);
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
   chunk->append({2, "two"});
@@ -203,4 +223,34 @@ TEST_F(StorageChunkTest, RemoveIndex) {
             indices_for_segment_0.cend());
 }
 
+TEST_F(StorageChunkTest, MigrateMvccData) {
+  // The resources outlive the chunk that is migrated to them
+  auto first_resource = boost::container::pmr::monotonic_buffer_resource{};
+  auto second_resource = boost::container::pmr::monotonic_buffer_resource{};
+
+  auto mvcc_data = std::make_shared<MvccData>(3);
+  mvcc_data->begin_cids[1] = CommitID{4};
+  mvcc_data->end_cids[2] = CommitID{5};
+  const auto mvcc_chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}), mvcc_data);
+
+  // The MVCC data of mutable chunks is not moved, as rows might still be appended to it
+  mvcc_chunk->migrate(&first_resource);
+  EXPECT_EQ(mvcc_chunk->mvcc_data(), mvcc_data);
+
+  mvcc_chunk->mark_immutable();
+  mvcc_chunk->migrate(&second_resource);
+
+  const auto migrated_mvcc_data = mvcc_chunk->mvcc_data();
+  EXPECT_NE(migrated_mvcc_data, mvcc_data);
+  EXPECT_EQ(migrated_mvcc_data->tids.get_allocator().resource(), &second_resource);
+  EXPECT_EQ(migrated_mvcc_data->begin_cids.get_allocator().resource(), &second_resource);
+  EXPECT_EQ(migrated_mvcc_data->end_cids.get_allocator().resource(), &second_resource);
+
+  ASSERT_EQ(migrated_mvcc_data->size(), 3u);
+  EXPECT_EQ(migrated_mvcc_data->begin_cids[1], CommitID{4});
+  EXPECT_EQ(migrated_mvcc_data->end_cids[2], CommitID{5});
+  EXPECT_EQ(migrated_mvcc_data->end_cids[0], MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(migrated_mvcc_data->tids[0], TransactionID{0});
+}
+
 }  // namespace opossum
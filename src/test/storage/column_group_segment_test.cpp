@@ -0,0 +1,162 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/column_group_segment.hpp"
+#include "storage/column_group_segment/column_group.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageColumnGroupSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vs_int->append(4);
+    vs_int->append(NULL_VALUE);
+    vs_int->append(6);
+
+    vs_long->append(int64_t{1} << 40);
+    vs_long->append(int64_t{2});
+    vs_long->append(int64_t{-3});
+
+    vs_double->append(1.5);
+    vs_double->append(2.5);
+    vs_double->append(NULL_VALUE);
+  }
+
+  std::vector<std::shared_ptr<BaseEncodedSegment>> group_segments() {
+    return ColumnGroup::group_segments({vs_int, vs_long, vs_double});
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> vs_int = std::make_shared<ValueSegment<int32_t>>(true);
+  std::shared_ptr<ValueSegment<int64_t>> vs_long = std::make_shared<ValueSegment<int64_t>>(false);
+  std::shared_ptr<ValueSegment<double>> vs_double = std::make_shared<ValueSegment<double>>(true);
+};
+
+TEST_F(StorageColumnGroupSegmentTest, GroupSegments) {
+  const auto segments = group_segments();
+  ASSERT_EQ(segments.size(), 3u);
+
+  const auto int_segment = std::dynamic_pointer_cast<ColumnGroupSegment<int32_t>>(segments[0]);
+  const auto long_segment = std::dynamic_pointer_cast<ColumnGroupSegment<int64_t>>(segments[1]);
+  const auto double_segment = std::dynamic_pointer_cast<ColumnGroupSegment<double>>(segments[2]);
+  ASSERT_NE(int_segment, nullptr);
+  ASSERT_NE(long_segment, nullptr);
+  ASSERT_NE(double_segment, nullptr);
+
+  // All columns share one ColumnGroup, in which only the columns with NULLs get a byte to mark them
+  EXPECT_EQ(int_segment->column_group(), double_segment->column_group());
+  EXPECT_EQ(long_segment->column_index(), 1u);
+  const auto& column_group = *int_segment->column_group();
+  EXPECT_EQ(column_group.size(), 3u);
+  EXPECT_EQ(column_group.row_width(), sizeof(int32_t) + sizeof(int64_t) + sizeof(double) + 2u);
+  EXPECT_EQ(column_group.data_size(), 3u * column_group.row_width());
+  EXPECT_FALSE(column_group.columns()[1].null_offset);
+
+  EXPECT_EQ(int_segment->encoding_type(), EncodingType::ColumnGroup);
+  EXPECT_EQ(int_segment->compressed_vector_type(), std::nullopt);
+  EXPECT_EQ(int_segment->size(), 3u);
+
+  EXPECT_EQ(int_segment->get_typed_value(ChunkOffset{0}), 4);
+  EXPECT_EQ(int_segment->get_typed_value(ChunkOffset{1}), std::nullopt);
+  EXPECT_EQ(int_segment->get_typed_value(ChunkOffset{2}), 6);
+  EXPECT_EQ((*long_segment)[ChunkOffset{0}], AllTypeVariant{int64_t{1} << 40});
+  EXPECT_EQ((*long_segment)[ChunkOffset{2}], AllTypeVariant{int64_t{-3}});
+  EXPECT_EQ((*double_segment)[ChunkOffset{1}], AllTypeVariant{2.5});
+  EXPECT_TRUE(variant_is_null((*double_segment)[ChunkOffset{2}]));
+}
+
+TEST_F(StorageColumnGroupSegmentTest, OnlyFixedWidthColumns) {
+  const auto vs_str = std::make_shared<ValueSegment<std::string>>();
+  vs_str->append("a");
+
+  EXPECT_THROW(ColumnGroup::group_segments({vs_str}), std::exception);
+}
+
+TEST_F(StorageColumnGroupSegmentTest, Iterable) {
+  const auto segment = std::static_pointer_cast<ColumnGroupSegment<double>>(group_segments()[2]);
+
+  auto values = std::vector<std::optional<double>>{};
+  create_iterable_from_segment<double, false>(*segment).for_each([&](const auto& position) {
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<double>{position.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<double>>{1.5, 2.5, std::nullopt}));
+
+  const auto position_filter = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, ChunkOffset{2}},
+                                                                 RowID{ChunkID{0}, ChunkOffset{0}}});
+  position_filter->guarantee_single_chunk();
+
+  values.clear();
+  create_iterable_from_segment<double, false>(*segment).for_each(position_filter, [&](const auto& position) {
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<double>{position.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<double>>{std::nullopt, 1.5}));
+}
+
+TEST_F(StorageColumnGroupSegmentTest, SegmentAccessor) {
+  const auto segment = group_segments()[0];
+
+  const auto accessor = create_segment_accessor<int32_t>(segment);
+  EXPECT_EQ(accessor->access(ChunkOffset{0}), 4);
+  EXPECT_EQ(accessor->access(ChunkOffset{1}), std::nullopt);
+  EXPECT_EQ(accessor->access(ChunkOffset{2}), 6);
+}
+
+TEST_F(StorageColumnGroupSegmentTest, EncodeSingleSegment) {
+  const auto segment = encode_segment(EncodingType::ColumnGroup, DataType::Long, vs_long);
+  const auto long_segment = std::dynamic_pointer_cast<ColumnGroupSegment<int64_t>>(segment);
+  ASSERT_NE(long_segment, nullptr);
+
+  EXPECT_EQ(long_segment->column_group()->row_width(), sizeof(int64_t));
+  EXPECT_EQ(long_segment->get_typed_value(ChunkOffset{1}), int64_t{2});
+}
+
+TEST_F(StorageColumnGroupSegmentTest, CopyUsingAllocator) {
+  const auto segment = group_segments()[2];
+
+  // The copy is a ColumnGroup of its own column only
+  const auto copy = std::dynamic_pointer_cast<ColumnGroupSegment<double>>(segment->copy_using_allocator({}));
+  ASSERT_NE(copy, nullptr);
+  EXPECT_EQ(copy->column_group()->row_width(), sizeof(double) + 1u);
+  EXPECT_EQ(copy->get_typed_value(ChunkOffset{0}), 1.5);
+  EXPECT_EQ(copy->get_typed_value(ChunkOffset{2}), std::nullopt);
+  EXPECT_EQ(copy->estimate_memory_usage(), segment->estimate_memory_usage());
+}
+
+TEST_F(StorageColumnGroupSegmentTest, EncodeTableWithColumnGroups) {
+  const auto table = load_table("resources/test_data/tbl/int_float_double_string.tbl", 2);
+  const auto expected_table = load_table("resources/test_data/tbl/int_float_double_string.tbl", 2);
+
+  EXPECT_THROW(table->set_column_groups({{ColumnID{0}, ColumnID{3}}}), std::exception);
+  EXPECT_THROW(table->set_column_groups({{ColumnID{0}, ColumnID{1}}, {ColumnID{1}}}), std::exception);
+
+  table->set_column_groups({{ColumnID{2}, ColumnID{0}}});
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto int_segment =
+        std::dynamic_pointer_cast<const ColumnGroupSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+    const auto double_segment =
+        std::dynamic_pointer_cast<const ColumnGroupSegment<double>>(chunk->get_segment(ColumnID{2}));
+    ASSERT_NE(int_segment, nullptr);
+    ASSERT_NE(double_segment, nullptr);
+    EXPECT_EQ(int_segment->column_group(), double_segment->column_group());
+    EXPECT_EQ(int_segment->column_index(), 1u);
+
+    const auto float_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(ColumnID{1}));
+    ASSERT_NE(float_segment, nullptr);
+    EXPECT_EQ(float_segment->encoding_type(), EncodingType::Dictionary);
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+}  // namespace opossum
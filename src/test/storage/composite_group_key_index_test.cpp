@@ -124,4 +124,18 @@ TEST_F(CompositeGroupKeyIndexTest, PositionList) {
   EXPECT_POSITION_LIST_EQ(expected_str_int, *_position_list_str_int);
 }
 
+TEST_F(CompositeGroupKeyIndexTest, WideKeys) {
+  // Keys of 9 bytes are created as two words, keys of 17 bytes as VariableLengthKeys
+  for (const auto segment_count : {size_t{9}, size_t{17}}) {
+    const auto index = CompositeGroupKeyIndex{std::vector<std::shared_ptr<const BaseSegment>>(segment_count,
+                                                                                             _segment_int)};
+    EXPECT_POSITION_LIST_EQ({{2, 4}, {2, 4}, {1, 3}, {1, 3}, {0, 6}, {0, 6}, {5, 7}, {5, 7}},
+                            std::vector<ChunkOffset>(index.cbegin(), index.cend()));
+
+    const auto values = std::vector<AllTypeVariant>(segment_count, 1);
+    EXPECT_EQ(std::distance(index.cbegin(), index.lower_bound(values)), 2);
+    EXPECT_EQ(std::distance(index.cbegin(), index.upper_bound(values)), 4);
+  }
+}
+
 }  // namespace opossum
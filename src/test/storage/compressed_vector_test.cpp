@@ -1,11 +1,15 @@
+#include <array>
 #include <bitset>
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
 #include "constant_mappings.hpp"
@@ -103,6 +107,24 @@ TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingDecompressor) {
   }
 }
 
+TEST_P(CompressedVectorTest, DecodeRangesUsingDecodeInto) {
+  const auto sequence = this->generate_sequence(4'200, 8u);
+  const auto encoded_sequence = this->encode(sequence);
+
+  // Whole vector, within a block, across meta blocks, and the incomplete last block. The output at offset 1 is not 16
+  // byte aligned, so that complete blocks cannot be unpacked into it directly.
+  for (const auto& [begin, count] : std::vector<std::pair<size_t, size_t>>{
+           {0u, 4'200u}, {5u, 50u}, {2'000u, 300u}, {4'100u, 100u}, {128u, 2'048u}, {4'199u, 1u}}) {
+    for (const auto output_offset : {size_t{0u}, size_t{1u}}) {
+      auto values = std::vector<uint32_t>(output_offset + count);
+      encoded_sequence->decode_into(begin, count, values.data() + output_offset);
+
+      const auto expected_values = std::vector<uint32_t>(sequence.cbegin() + begin, sequence.cbegin() + begin + count);
+      EXPECT_EQ(std::vector<uint32_t>(values.cbegin() + output_offset, values.cend()), expected_values);
+    }
+  }
+}
+
 TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingIterators) {
   const auto sequence = pmr_vector<uint32_t>(2'200, 0u);
   const auto encoded_sequence_base = this->encode(sequence);
@@ -125,4 +147,33 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+TEST(SimdBp128PackingTest, UnpackBlocks) {
+  using Packing = SimdBp128Packing;
+
+  // Runs of one to eight blocks of the same bit size, which are unpacked a single, two, or four blocks at a time
+  const auto bit_sizes = std::array<uint8_t, Packing::blocks_in_meta_block>{3, 17, 17, 0, 0, 0, 32, 32,
+                                                                            32, 32, 32, 9, 9, 9, 9, 9};
+
+  alignas(16) auto values = std::array<uint32_t, Packing::meta_block_size>{};
+  auto packed = std::vector<uint128_t>(Packing::blocks_in_meta_block * 32u);
+
+  auto packed_size = size_t{0u};
+  for (auto block_index = 0u; block_index < Packing::blocks_in_meta_block; ++block_index) {
+    const auto bit_size = bit_sizes[block_index];
+    const auto max_value = static_cast<uint32_t>((uint64_t{1u} << bit_size) - 1u);
+
+    const auto block_values = values.data() + block_index * Packing::block_size;
+    for (auto index = 0u; index < Packing::block_size; ++index) {
+      block_values[index] = static_cast<uint32_t>(index * 2'654'435'761u) & max_value;
+    }
+
+    Packing::pack_block(block_values, packed.data() + packed_size, bit_size);
+    packed_size += bit_size;
+  }
+
+  alignas(16) auto unpacked_values = std::array<uint32_t, Packing::meta_block_size>{};
+  Packing::unpack_blocks(packed.data(), unpacked_values.data(), bit_sizes.data(), Packing::blocks_in_meta_block);
+  EXPECT_EQ(unpacked_values, values);
+}
+
 }  // namespace opossum
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/adaptive_radix_tree/concurrent_adaptive_radix_tree.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ConcurrentAdaptiveRadixTreeTest : public BaseTest {
+ protected:
+  using KeyBound = ConcurrentAdaptiveRadixTree::KeyBound;
+
+  template <typename T>
+  static void expect_ordered(const std::vector<T>& values) {
+    for (auto index = size_t{1}; index < values.size(); ++index) {
+      EXPECT_LT(binary_comparable_key(values[index - 1]), binary_comparable_key(values[index])) << index;
+    }
+  }
+
+  static KeyBound inclusive(const int32_t value) { return KeyBound{binary_comparable_key(value), true}; }
+  static KeyBound exclusive(const int32_t value) { return KeyBound{binary_comparable_key(value), false}; }
+
+  ConcurrentAdaptiveRadixTree tree;
+};
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, BinaryComparableKeys) {
+  expect_ordered(std::vector<int32_t>{std::numeric_limits<int32_t>::min(), -256, -5, -1, 0, 3, 255, 256,
+                                      std::numeric_limits<int32_t>::max()});
+  expect_ordered(std::vector<int64_t>{-5'000'000'000, -1, 0, 1, 5'000'000'000});
+  expect_ordered(std::vector<float>{-std::numeric_limits<float>::infinity(), -2.5f, -0.5f, 0.0f, 0.25f, 1.5f, 1e30f});
+  expect_ordered(std::vector<double>{-1e300, -2.5, -0.5, 0.0, 0.25, 1.5, 1e300});
+  expect_ordered(std::vector<std::string>{"", std::string(1, '\0'), "a", std::string("a\0", 2),
+                                          std::string("a\0b", 3), "ab", "abc", "b", "\xFF"});
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, InsertAndLookup) {
+  // The keys of 0 to 255 only differ in their last byte, so their node grows up to a Node256
+  for (auto value = 999; value >= 0; --value) {
+    tree.insert(binary_comparable_key(value), RowID{ChunkID{0}, static_cast<ChunkOffset>(value)});
+  }
+  tree.insert(binary_comparable_key(500), RowID{ChunkID{1}, 0});
+
+  EXPECT_EQ(tree.lookup(inclusive(500), inclusive(500)), (PosList{RowID{ChunkID{0}, 500}, RowID{ChunkID{1}, 0}}));
+  EXPECT_TRUE(tree.lookup(inclusive(1000), inclusive(1000)).empty());
+  EXPECT_TRUE(tree.lookup(inclusive(-1), inclusive(-1)).empty());
+
+  // Ranges are returned ordered by their keys
+  EXPECT_EQ(tree.lookup(exclusive(254), exclusive(258)),
+            (PosList{RowID{ChunkID{0}, 255}, RowID{ChunkID{0}, 256}, RowID{ChunkID{0}, 257}}));
+  EXPECT_EQ(tree.lookup(std::nullopt, exclusive(2)), (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(tree.lookup(inclusive(998), std::nullopt), (PosList{RowID{ChunkID{0}, 998}, RowID{ChunkID{0}, 999}}));
+  EXPECT_EQ(tree.lookup(std::nullopt, std::nullopt).size(), 1001u);
+  EXPECT_TRUE(tree.lookup(inclusive(600), inclusive(400)).empty());
+
+  const auto all_rows = tree.lookup(exclusive(-1), inclusive(999));
+  ASSERT_EQ(all_rows.size(), 1001u);
+  EXPECT_TRUE(std::is_sorted(all_rows.begin(), all_rows.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.chunk_offset < rhs.chunk_offset;
+  }));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, StringsWithCommonPrefixes) {
+  const auto values = std::vector<std::string>{"Customer#000000010", "Customer#000000001", "Customer#00000001",
+                                               "Customer#000000011", "", "C"};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    tree.insert(binary_comparable_key(values[index]), RowID{ChunkID{0}, static_cast<ChunkOffset>(index)});
+  }
+
+  const auto lookup = [&](const std::string& value) {
+    const auto key = binary_comparable_key(value);
+    return tree.lookup(KeyBound{key, true}, KeyBound{key, true});
+  };
+
+  EXPECT_EQ(lookup("Customer#00000001"), (PosList{RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(lookup(""), (PosList{RowID{ChunkID{0}, 4}}));
+  EXPECT_TRUE(lookup("Customer#0000000").empty());
+
+  EXPECT_EQ(tree.lookup(KeyBound{binary_comparable_key(std::string{"Customer#000000001"}), true},
+                        KeyBound{binary_comparable_key(std::string{"Customer#000000011"}), false}),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(tree.lookup(std::nullopt, std::nullopt),
+            (PosList{RowID{ChunkID{0}, 4}, RowID{ChunkID{0}, 5}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0},
+                     RowID{ChunkID{0}, 3}, RowID{ChunkID{0}, 2}}));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, RemoveChunk) {
+  for (auto value = 0; value < 10; ++value) {
+    tree.insert(binary_comparable_key(value), RowID{ChunkID{static_cast<uint32_t>(value % 2)}, ChunkOffset{0}});
+  }
+
+  EXPECT_EQ(tree.remove_chunk(ChunkID{1}), 5u);
+  EXPECT_EQ(tree.remove_chunk(ChunkID{1}), 0u);
+  EXPECT_EQ(tree.lookup(std::nullopt, std::nullopt).size(), 5u);
+  EXPECT_TRUE(tree.lookup(inclusive(3), inclusive(3)).empty());
+
+  tree.insert(binary_comparable_key(3), RowID{ChunkID{2}, ChunkOffset{0}});
+  EXPECT_EQ(tree.lookup(inclusive(3), inclusive(3)), (PosList{RowID{ChunkID{2}, ChunkOffset{0}}}));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, ConcurrentInsertsAndLookups) {
+  constexpr auto THREAD_COUNT = 4;
+  constexpr auto ROWS_PER_THREAD = 20'000;
+
+  auto inserts_are_done = std::atomic_bool{false};
+
+  // Each insert is either visible completely or not at all, and the rows stay ordered by their keys
+  auto reader = std::thread([&]() {
+    while (!inserts_are_done) {
+      const auto rows = tree.lookup(inclusive(0), exclusive(THREAD_COUNT * ROWS_PER_THREAD));
+      const auto is_ordered = std::is_sorted(rows.begin(), rows.end(), [&](const auto& lhs, const auto& rhs) {
+        return lhs.chunk_offset * THREAD_COUNT + lhs.chunk_id < rhs.chunk_offset * THREAD_COUNT + rhs.chunk_id;
+      });
+      EXPECT_TRUE(is_ordered);
+    }
+  });
+
+  // The threads insert interleaved keys, so that they often change the same nodes
+  auto writers = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    writers.emplace_back([&, thread_id]() {
+      for (auto row = 0; row < ROWS_PER_THREAD; ++row) {
+        const auto value = row * THREAD_COUNT + thread_id;
+        tree.insert(binary_comparable_key(value),
+                    RowID{ChunkID{static_cast<uint32_t>(thread_id)}, static_cast<ChunkOffset>(row)});
+      }
+    });
+  }
+
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  inserts_are_done = true;
+  reader.join();
+
+  const auto rows = tree.lookup(std::nullopt, std::nullopt);
+  ASSERT_EQ(rows.size(), static_cast<size_t>(THREAD_COUNT * ROWS_PER_THREAD));
+  for (auto value = 0; value < THREAD_COUNT * ROWS_PER_THREAD; ++value) {
+    EXPECT_EQ(rows[value], (RowID{ChunkID{static_cast<uint32_t>(value % THREAD_COUNT)},
+                                  static_cast<ChunkOffset>(value / THREAD_COUNT)}));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<DeltaSegment<T>> encode(const std::shared_ptr<ValueSegment<T>>& value_segment) {
+    return std::dynamic_pointer_cast<DeltaSegment<T>>(encode_segment(EncodingType::Delta, data_type_from_type<T>(),
+                                                                     value_segment, VectorCompressionType::SimdBp128));
+  }
+};
+
+TEST_F(StorageDeltaSegmentTest, CompressSortedSegment) {
+  // Timestamps in milliseconds, with a step of either one or two seconds
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>(true);
+  auto value = int64_t{1'500'000'000'000};
+  for (auto index = 0u; index < 1'000u; ++index) {
+    value += index % 3 == 0 ? 2'000 : 1'000;
+    if (index % 50 == 10) {
+      value_segment->append(NULL_VALUE);
+    } else {
+      value_segment->append(value);
+    }
+  }
+
+  const auto delta_segment = encode(value_segment);
+  ASSERT_NE(delta_segment, nullptr);
+  ASSERT_EQ(delta_segment->size(), value_segment->size());
+  EXPECT_EQ(delta_segment->block_first_values().size(), 8u);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment->size(); ++chunk_offset) {
+    EXPECT_EQ(delta_segment->get_typed_value(chunk_offset), value_segment->get_typed_value(chunk_offset));
+  }
+
+  // The deltas need far fewer bits than the offsets from the block minima
+  const auto frame_of_reference_segment = encode_segment(EncodingType::FrameOfReference, DataType::Long, value_segment,
+                                                         VectorCompressionType::SimdBp128);
+  EXPECT_LT(delta_segment->estimate_memory_usage(), frame_of_reference_segment->estimate_memory_usage());
+}
+
+TEST_F(StorageDeltaSegmentTest, WrappingDeltas) {
+  const auto min = std::numeric_limits<int32_t>::min();
+  const auto max = std::numeric_limits<int32_t>::max();
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{min, max, 0, max, min});
+
+  const auto delta_segment = encode(value_segment);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment->size(); ++chunk_offset) {
+    EXPECT_EQ(delta_segment->get_typed_value(chunk_offset), value_segment->get_typed_value(chunk_offset));
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, PointAccessAcrossBlocks) {
+  auto values = pmr_concurrent_vector<int32_t>{};
+  for (auto index = 0; index < 1'000; ++index) {
+    values.push_back(index * index);
+  }
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  const auto delta_segment = encode(value_segment);
+
+  // Positions jump between blocks and backwards within a block
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->guarantee_single_chunk();
+  for (const auto chunk_offset : {5u, 3u, 130u, 131u, 999u, 0u, 128u, 127u}) {
+    position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+
+  auto iterable = create_iterable_from_segment(*delta_segment);
+  auto values_read = std::vector<int32_t>{};
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    for (; it != end; ++it) {
+      values_read.push_back(it->value());
+    }
+  });
+
+  const auto expected_values = std::vector<int32_t>{25, 9, 16'900, 17'161, 998'001, 0, 16'384, 16'129};
+  EXPECT_EQ(values_read, expected_values);
+}
+
+}  // namespace opossum
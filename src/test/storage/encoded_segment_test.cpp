@@ -35,6 +35,9 @@ class EncodedSegmentTest : public BaseTestWithParam<SegmentEncodingSpec> {
       case EncodingType::FrameOfReference:
         // fill three blocks and a bit more
         return static_cast<size_t>(FrameOfReferenceSegment<int32_t>::block_size * (3.3));
+      case EncodingType::Delta:
+        // fill many blocks and a bit more
+        return static_cast<size_t>(DeltaSegment<int32_t>::block_size * (30.3));
       default:
         return default_row_count;
     }
@@ -125,7 +128,10 @@ INSTANTIATE_TEST_CASE_P(
                       SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned},
-                      SegmentEncodingSpec{EncodingType::RunLength}),
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::SimdBp128},
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::FixedSizeByteAligned},
+                      SegmentEncodingSpec{EncodingType::RunLength},
+                      SegmentEncodingSpec{EncodingType::ColumnGroup}),
     formatter);
 
 TEST_P(EncodedSegmentTest, SequentiallyReadNotNullableIntSegment) {
@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/encoding_advisor.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("long_runs", DataType::Int);
+    column_definitions.emplace_back("sequence", DataType::Int, true);
+    column_definitions.emplace_back("fixed_length_strings", DataType::String);
+    column_definitions.emplace_back("floats", DataType::Float);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2'000);
+
+    for (auto row = 0; row < 10'000; ++row) {
+      auto sequence_value = row % 100 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row};
+      auto string_value = std::to_string(100'000'000 + row);
+      _table->append({row / 1'000, sequence_value, string_value, static_cast<float>(row % 7) * 0.5f});
+    }
+
+    // Only the memory usage should matter for the tests, the micro-benchmarks are too noisy
+    _options.max_scan_duration_factor = 1'000'000.0;
+  }
+
+  std::shared_ptr<Table> _table;
+  EncodingAdvisor::Options _options;
+};
+
+TEST_F(EncodingAdvisorTest, EvaluateCandidates) {
+  const auto int_candidates = EncodingAdvisor::evaluate_candidates(*_table, ColumnID{0}, _options);
+  ASSERT_EQ(int_candidates.size(), 8u);
+  EXPECT_EQ(int_candidates[0].encoding_spec.encoding_type, EncodingType::Unencoded);
+  EXPECT_EQ(int_candidates[1].encoding_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(int_candidates[1].encoding_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+  EXPECT_EQ(int_candidates[2].encoding_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(int_candidates[2].encoding_spec.vector_compression_type, VectorCompressionType::SimdBp128);
+  EXPECT_EQ(int_candidates[3].encoding_spec.encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(int_candidates[4].encoding_spec.encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(int_candidates[5].encoding_spec.encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(int_candidates[6].encoding_spec.encoding_type, EncodingType::Delta);
+  EXPECT_EQ(int_candidates[7].encoding_spec.encoding_type, EncodingType::Delta);
+
+  for (const auto& candidate : int_candidates) {
+    EXPECT_GT(candidate.memory_usage, 0u);
+  }
+
+  const auto string_candidates = EncodingAdvisor::evaluate_candidates(*_table, ColumnID{2}, _options);
+  ASSERT_EQ(string_candidates.size(), 10u);
+  EXPECT_EQ(string_candidates[4].encoding_spec.encoding_type, EncodingType::FixedStringDictionary);
+  EXPECT_EQ(string_candidates[6].encoding_spec.encoding_type, EncodingType::LZ4);
+  EXPECT_EQ(string_candidates[8].encoding_spec.encoding_type, EncodingType::FrontCodedDictionary);
+
+  EXPECT_EQ(EncodingAdvisor::evaluate_candidates(*_table, ColumnID{3}, _options).size(), 4u);
+}
+
+TEST_F(EncodingAdvisorTest, AdviseSmallestEncoding) {
+  const auto chunk_encoding_spec = EncodingAdvisor::advise(*_table, _options);
+  ASSERT_EQ(chunk_encoding_spec.size(), 4u);
+  EXPECT_EQ(chunk_encoding_spec[0].encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(chunk_encoding_spec[1].encoding_type, EncodingType::Delta);
+  // The sequential numbers compress well
+  EXPECT_EQ(chunk_encoding_spec[2].encoding_type, EncodingType::LZ4);
+  EXPECT_EQ(chunk_encoding_spec[3].encoding_type, EncodingType::Dictionary);
+}
+
+TEST_F(EncodingAdvisorTest, SampleSize) {
+  const auto all_rows_candidates = EncodingAdvisor::evaluate_candidates(*_table, ColumnID{0}, _options);
+
+  // Two runs of 64 rows are sampled
+  _options.sample_size = 100;
+  const auto sampled_candidates = EncodingAdvisor::evaluate_candidates(*_table, ColumnID{0}, _options);
+  ASSERT_EQ(sampled_candidates.size(), all_rows_candidates.size());
+  EXPECT_EQ(sampled_candidates[0].encoding_spec.encoding_type, EncodingType::Unencoded);
+  EXPECT_LT(sampled_candidates[0].memory_usage, all_rows_candidates[0].memory_usage);
+}
+
+TEST_F(EncodingAdvisorTest, SelectCandidate) {
+  using namespace std::chrono_literals;  // NOLINT
+
+  const auto candidates = std::vector<EncodingAdvisor::Candidate>{
+      {SegmentEncodingSpec{EncodingType::Unencoded}, 4'000, 100ns},
+      {SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned}, 1'000, 150ns},
+      {SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128}, 500, 300ns},
+      {SegmentEncodingSpec{EncodingType::RunLength}, 500, 220ns}};
+
+  EXPECT_EQ(EncodingAdvisor::select_candidate(candidates, 1.0).encoding_type, EncodingType::Unencoded);
+  EXPECT_EQ(EncodingAdvisor::select_candidate(candidates, 2.0).encoding_type, EncodingType::Dictionary);
+  // Both remaining candidates are equally small, the faster one wins
+  EXPECT_EQ(EncodingAdvisor::select_candidate(candidates, 2.5).encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(EncodingAdvisor::select_candidate(candidates, 3.0).encoding_type, EncodingType::RunLength);
+}
+
+}  // namespace opossum
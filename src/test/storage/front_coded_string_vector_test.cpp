@@ -0,0 +1,82 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/front_coded_dictionary_segment/front_coded_string_vector.hpp"
+
+namespace opossum {
+
+class FrontCodedStringVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // More than two blocks of URLs that share long prefixes, and a string longer than 127 characters
+    for (auto index = 0; index < 40; ++index) {
+      strings.emplace_back("https://www.example.com/products/" + std::to_string(1'000 + index * 2));
+    }
+    strings.emplace_back("https://www.example.com/products/a" + std::string(200, 'x'));
+    strings.emplace_back("https://www.example.org/");
+
+    front_coded_string_vector = std::make_shared<FrontCodedStringVector>(strings, PolymorphicAllocator<char>{});
+  }
+
+  pmr_vector<std::string> strings;
+  std::shared_ptr<FrontCodedStringVector> front_coded_string_vector;
+};
+
+TEST_F(FrontCodedStringVectorTest, GetStringAt) {
+  ASSERT_EQ(front_coded_string_vector->size(), strings.size());
+  for (auto pos = size_t{0}; pos < strings.size(); ++pos) {
+    EXPECT_EQ(front_coded_string_vector->get_string_at(pos), strings[pos]);
+  }
+}
+
+TEST_F(FrontCodedStringVectorTest, ForEachAndDictionary) {
+  auto decoded_strings = std::vector<std::string>{};
+  front_coded_string_vector->for_each([&](const std::string& string) { decoded_strings.emplace_back(string); });
+  EXPECT_EQ(decoded_strings, std::vector<std::string>(strings.begin(), strings.end()));
+
+  EXPECT_EQ(*front_coded_string_vector->dictionary(), strings);
+}
+
+TEST_F(FrontCodedStringVectorTest, LowerUpperBound) {
+  for (auto pos = size_t{0}; pos < strings.size(); ++pos) {
+    EXPECT_EQ(front_coded_string_vector->lower_bound(strings[pos]), pos);
+    EXPECT_EQ(front_coded_string_vector->upper_bound(strings[pos]), pos + 1);
+  }
+
+  // Values between the strings, e.g., "https://www.example.com/products/1001" between 1000 and 1002
+  for (auto index = 0; index < 40; ++index) {
+    const auto value = "https://www.example.com/products/" + std::to_string(1'001 + index * 2);
+    EXPECT_EQ(front_coded_string_vector->lower_bound(value), static_cast<size_t>(index + 1));
+    EXPECT_EQ(front_coded_string_vector->upper_bound(value), static_cast<size_t>(index + 1));
+  }
+
+  EXPECT_EQ(front_coded_string_vector->lower_bound(""), 0u);
+  EXPECT_EQ(front_coded_string_vector->upper_bound("a"), 0u);
+  EXPECT_EQ(front_coded_string_vector->lower_bound("https://www.example.com/products/"), 0u);
+  EXPECT_EQ(front_coded_string_vector->lower_bound("z"), strings.size());
+  EXPECT_EQ(front_coded_string_vector->upper_bound("z"), strings.size());
+}
+
+TEST_F(FrontCodedStringVectorTest, EmptyAndCopy) {
+  const auto empty_vector = FrontCodedStringVector{pmr_vector<std::string>{}, PolymorphicAllocator<char>{}};
+  EXPECT_EQ(empty_vector.size(), 0u);
+  EXPECT_EQ(empty_vector.lower_bound("a"), 0u);
+  EXPECT_EQ(empty_vector.upper_bound("a"), 0u);
+  EXPECT_TRUE(empty_vector.dictionary()->empty());
+
+  const auto copy = FrontCodedStringVector{*front_coded_string_vector, PolymorphicAllocator<char>{}};
+  EXPECT_EQ(*copy.dictionary(), strings);
+}
+
+TEST_F(FrontCodedStringVectorTest, DataSize) {
+  // The common prefixes are stored once per block
+  auto total_length = size_t{0};
+  for (const auto& string : strings) total_length += string.size();
+  EXPECT_LT(front_coded_string_vector->data_size(), total_length / 2);
+}
+
+}  // namespace opossum
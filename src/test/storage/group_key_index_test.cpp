@@ -11,6 +11,9 @@
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -22,7 +25,7 @@ class GroupKeyIndexTest : public BaseTest {
         DataType::String, {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"});
     index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseSegment>>({dict_segment}));
 
-    index_offsets = &(index->_index_offsets);
+    index_offsets = index->_index_offsets.get();
     index_postings = &(index->_index_postings);
   }
 
@@ -34,16 +37,21 @@ class GroupKeyIndexTest : public BaseTest {
    * private scope. In order to minimize the friend classes of CompositeGroupKeyIndex the fixture
    * is used as proxy. Since the variables are set in setup() references are not possible.
    */
-  std::vector<std::size_t>* index_offsets;
+  const BaseCompressedVector* index_offsets;
   std::vector<ChunkOffset>* index_postings;
 };
 
 TEST_F(GroupKeyIndexTest, IndexOffsets) {
-  auto expected_offsets = std::vector<size_t>{0, 1, 3, 5, 6, 7, 8};
-  EXPECT_EQ(expected_offsets, *index_offsets);
+  auto expected_offsets = std::vector<uint32_t>{0, 1, 3, 5, 6, 7, 8};
+  auto offsets = std::vector<uint32_t>(index_offsets->size());
+  index_offsets->decode_into(0u, offsets.size(), offsets.data());
+  EXPECT_EQ(expected_offsets, offsets);
+
+  // The offsets are compressed to the width that the number of postings needs
+  EXPECT_EQ(index_offsets->type(), CompressedVectorType::FixedSize1ByteAligned);
 }
 
-TEST_F(GroupKeyIndexTest, IndexMemoryConsumption) { EXPECT_EQ(index->memory_consumption(), 104u); }
+TEST_F(GroupKeyIndexTest, IndexMemoryConsumption) { EXPECT_EQ(index->memory_consumption(), 55u); }
 
 TEST_F(GroupKeyIndexTest, IndexPostings) {
   // check if there are no duplicates in postings
@@ -59,4 +67,40 @@ TEST_F(GroupKeyIndexTest, IndexPostings) {
   }
 }
 
+TEST_F(GroupKeyIndexTest, NullsAreNotIndexed) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (const auto& value : {AllTypeVariant{4}, NULL_VALUE, AllTypeVariant{2}, NULL_VALUE, AllTypeVariant{4},
+                            AllTypeVariant{3}}) {
+    value_segment->append(value);
+  }
+  const auto segment = encode_segment(EncodingType::Dictionary, DataType::Int, value_segment);
+  const auto nullable_index = GroupKeyIndex{std::vector<std::shared_ptr<const BaseSegment>>{segment}};
+
+  EXPECT_EQ(std::vector<ChunkOffset>(nullable_index.cbegin(), nullable_index.cend()),
+            (std::vector<ChunkOffset>{2, 5, 0, 4}));
+  EXPECT_EQ(std::vector<ChunkOffset>(nullable_index.upper_bound({3}), nullable_index.cend()),
+            (std::vector<ChunkOffset>{0, 4}));
+}
+
+TEST_F(GroupKeyIndexTest, PostingsOfMultipleBlocks) {
+  // The postings of segments with more than one block are created in parallel, but ordered as well
+  auto values = std::vector<int32_t>{};
+  const auto row_count = GroupKeyIndex::BLOCK_SIZE * 2 + 10;
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    values.emplace_back(static_cast<int32_t>(row % 3));
+  }
+  const auto segment = BaseTest::create_dict_segment_by_type<int32_t>(DataType::Int, values);
+  const auto large_index = GroupKeyIndex{std::vector<std::shared_ptr<const BaseSegment>>{segment}};
+
+  auto expected_postings = std::vector<ChunkOffset>{};
+  for (auto value = size_t{0}; value < 3; ++value) {
+    for (auto row = value; row < row_count; row += 3) {
+      expected_postings.emplace_back(static_cast<ChunkOffset>(row));
+    }
+  }
+  EXPECT_EQ(std::vector<ChunkOffset>(large_index.cbegin(), large_index.cend()), expected_postings);
+  EXPECT_EQ(std::distance(large_index.lower_bound({1}), large_index.upper_bound({1})),
+            static_cast<std::ptrdiff_t>((row_count + 1) / 3));
+}
+
 }  // namespace opossum
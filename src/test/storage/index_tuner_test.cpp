@@ -0,0 +1,147 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index_tuner.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class IndexTunerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+
+    for (auto value = 0; value < 10'000; ++value) {
+      table->append({value, value % 2});
+    }
+    ChunkEncoder::encode_all_chunks(table);
+
+    // The last chunk is still filled by inserts and cannot be indexed
+    table->append({10'000, 0});
+    StorageManager::get().add_table("t", table);
+
+    IndexTuner::get().clear_scan_history();
+  }
+
+  void TearDown() override {
+    IndexTuner::get().clear_scan_history();
+    IndexTuner::get().set_options(IndexTuner::Options{});
+  }
+
+  static void scan(const ColumnID column_id, const int32_t value) {
+    const auto get_table = std::make_shared<GetTable>("t");
+    get_table->execute();
+    create_table_scan(get_table, column_id, PredicateCondition::Equals, value)->execute();
+  }
+
+  size_t index_count(const ColumnID column_id) const {
+    auto count = size_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (table->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id})) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  bool has_index_info(const ColumnID column_id) const {
+    for (const auto& index_info : table->get_indexes()) {
+      if (index_info.column_ids == std::vector<ColumnID>{column_id}) return true;
+    }
+    return false;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(IndexTunerTest, IndexesSelectiveScans) {
+  scan(ColumnID{0}, 5);
+  scan(ColumnID{1}, 0);
+
+  EXPECT_EQ(IndexTuner::get().tune_indexes(), 10u);
+  EXPECT_EQ(index_count(ColumnID{0}), 10u);
+  ASSERT_TRUE(has_index_info(ColumnID{0}));
+  EXPECT_EQ(table->get_indexes().front().name, IndexTuner::INDEX_NAME);
+
+  // Half of the rows match b = 0, for which a TableScan is cheaper
+  EXPECT_EQ(index_count(ColumnID{1}), 0u);
+  EXPECT_FALSE(has_index_info(ColumnID{1}));
+
+  // The indexed chunks are not indexed again
+  EXPECT_EQ(IndexTuner::get().tune_indexes(), 0u);
+  EXPECT_EQ(table->get_indexes().size(), 1u);
+}
+
+TEST_F(IndexTunerTest, MemoryBudget) {
+  auto options = IndexTuner::Options{};
+  options.memory_budget = 0;
+  IndexTuner::get().set_options(options);
+
+  scan(ColumnID{0}, 5);
+  EXPECT_EQ(IndexTuner::get().tune_indexes(), 0u);
+  EXPECT_EQ(index_count(ColumnID{0}), 0u);
+  EXPECT_FALSE(has_index_info(ColumnID{0}));
+}
+
+TEST_F(IndexTunerTest, DropsUnusedIndexes) {
+  scan(ColumnID{0}, 5);
+  IndexTuner::get().tune_indexes();
+  ASSERT_EQ(index_count(ColumnID{0}), 10u);
+
+  // Without further scans, the history decays until the index is not worth it anymore
+  for (auto iteration = 0; iteration < 20; ++iteration) {
+    IndexTuner::get().tune_indexes();
+  }
+  EXPECT_EQ(index_count(ColumnID{0}), 0u);
+  EXPECT_FALSE(has_index_info(ColumnID{0}));
+}
+
+TEST_F(IndexTunerTest, KeepsIndexesCreatedByHand) {
+  for (ChunkID chunk_id{0}; chunk_id < ChunkID{10}; ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+  }
+  table->add_index_info(IndexInfo{{ColumnID{1}}, "by_hand", SegmentIndexType::GroupKey});
+
+  auto options = IndexTuner::Options{};
+  options.memory_budget = 0;
+  IndexTuner::get().set_options(options);
+
+  scan(ColumnID{1}, 0);
+  IndexTuner::get().tune_indexes();
+  EXPECT_EQ(index_count(ColumnID{1}), 10u);
+  EXPECT_TRUE(has_index_info(ColumnID{1}));
+}
+
+TEST_F(IndexTunerTest, IndexScanOnDroppedIndex) {
+  scan(ColumnID{0}, 5);
+  IndexTuner::get().tune_indexes();
+
+  const auto get_table = std::make_shared<GetTable>("t");
+  get_table->execute();
+
+  const auto index_scan = std::make_shared<IndexScan>(
+      get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Between,
+      std::vector<AllTypeVariant>{1'500}, std::vector<AllTypeVariant>{2'499});
+  index_scan->set_included_chunk_ids({ChunkID{1}, ChunkID{2}});
+
+  // The index of the first chunk is dropped after the plan was created, so the IndexScan scans it without one
+  const auto chunk = table->get_chunk(ChunkID{1});
+  chunk->remove_index(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 1'000u);
+}
+
+}  // namespace opossum
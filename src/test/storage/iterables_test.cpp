@@ -1,6 +1,8 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,6 +15,8 @@
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/reference_segment/reference_segment_iterable.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iteration_specialization.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
@@ -164,6 +168,22 @@ TEST_F(IterablesTest, ValueSegmentNullableReferencedIteratorWithIterators) {
   EXPECT_EQ(accessed_offsets, (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}}));
 }
 
+TEST_F(IterablesTest, ValueSegmentNullableWithoutNullsIteratorWithIterators) {
+  const auto int_segment = ValueSegment<int>{std::vector<int>{1, 2, 3}, std::vector<bool>{false, false, false}};
+  const auto iterable = ValueSegmentIterable<int>{int_segment};
+
+  // The segment is iterated like one that is not nullable, i.e., without checking for NULLs
+  iterable.with_iterators([&](auto it, auto end) {
+    using PositionType = std::decay_t<decltype(*it)>;
+    EXPECT_FALSE(PositionType::Nullable);
+  });
+
+  auto sum = uint32_t{0};
+  auto accessed_offsets = std::vector<ChunkOffset>{};
+  iterable.with_iterators(SumUpWithIterator{sum, accessed_offsets});
+  EXPECT_EQ(sum, 6u);
+}
+
 TEST_F(IterablesTest, DictionarySegmentIteratorWithIterators) {
   ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
 
@@ -294,6 +314,80 @@ TEST_F(IterablesTest, ReferenceSegmentIteratorWithIteratorsReadingParallel) {
   EXPECT_EQ(dereference_iterator_b(), 1);
 }
 
+TEST_F(IterablesTest, SegmentIterationSpecialization) {
+  EXPECT_TRUE((is_segment_iteration_specialized<int32_t, ValueSegment<int32_t>>()));
+  EXPECT_TRUE((is_segment_iteration_specialized<std::string, DictionarySegment<std::string>>()));
+  EXPECT_EQ((is_segment_iteration_specialized<int32_t, RunLengthSegment<int32_t>>()),
+            static_cast<bool>(HYRISE_SPECIALIZE_ALL_SEGMENT_ITERATION));
+}
+
+TEST_F(IterablesTest, ReferenceSegmentIteratorWithIteratorsSingleChunkOfUnspecializedSegment) {
+  // The segments that are not specialized are iterated via the type-erased iterators, also through a ReferenceSegment
+  ChunkEncoder::encode_all_chunks(table, EncodingType::RunLength);
+
+  auto pos_list = PosList{RowID{ChunkID{0u}, 0u}, RowID{ChunkID{0u}, 3u}, RowID{ChunkID{0u}, 1u},
+                          RowID{ChunkID{0u}, 2u}, NULL_ROW_ID};
+  pos_list.guarantee_single_chunk();
+
+  auto reference_segment =
+      std::make_unique<ReferenceSegment>(table, ColumnID{0u}, std::make_shared<PosList>(std::move(pos_list)));
+
+  auto iterable = ReferenceSegmentIterable<int>{*reference_segment};
+
+  auto sum = uint32_t{0};
+  auto accessed_offsets = std::vector<ChunkOffset>{};
+  iterable.with_iterators(SumUpWithIterator{sum, accessed_offsets});
+
+  EXPECT_EQ(sum, 24'825u);
+  EXPECT_EQ(accessed_offsets,
+            (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}, ChunkOffset{3}, ChunkOffset{4}}));
+}
+
+TEST_F(IterablesTest, ReferenceSegmentIteratorWithIteratorsMultipleChunks) {
+  // The positions of multiple chunks are gathered chunk by chunk from segments of different encodings
+  const auto referenced_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 3);
+  for (const auto& value : std::vector<AllTypeVariant>{0, 1, NULL_VALUE, 3, 4, 5, 6, NULL_VALUE, 8, 9, 10, 11}) {
+    referenced_table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(referenced_table, std::vector<ChunkEncodingSpec>{
+                                                        {SegmentEncodingSpec{EncodingType::Dictionary}},
+                                                        {SegmentEncodingSpec{EncodingType::RunLength}},
+                                                        {SegmentEncodingSpec{EncodingType::LZ4}},
+                                                        {SegmentEncodingSpec{EncodingType::Unencoded}}});
+
+  const auto iterate = [&](const std::shared_ptr<PosList>& pos_list) {
+    auto reference_segment = ReferenceSegment{referenced_table, ColumnID{0}, pos_list};
+
+    auto values = std::vector<std::optional<int>>{};
+    auto accessed_offsets = std::vector<ChunkOffset>{};
+    ReferenceSegmentIterable<int>{reference_segment}.with_iterators([&](auto it, const auto end) {
+      for (; it != end; ++it) {
+        values.emplace_back(it->is_null() ? std::nullopt : std::optional<int>{it->value()});
+        accessed_offsets.emplace_back(it->chunk_offset());
+      }
+    });
+
+    auto expected_offsets = std::vector<ChunkOffset>(pos_list->size());
+    std::iota(expected_offsets.begin(), expected_offsets.end(), ChunkOffset{0});
+    EXPECT_EQ(accessed_offsets, expected_offsets);
+    return values;
+  };
+
+  // At least as many positions as chunks, the PosList is split by chunk
+  const auto long_pos_list = std::make_shared<PosList>(
+      PosList{RowID{ChunkID{2}, 2}, RowID{ChunkID{0}, 1}, NULL_ROW_ID,          RowID{ChunkID{1}, 2},
+              RowID{ChunkID{3}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 0}, RowID{ChunkID{0}, 2},
+              RowID{ChunkID{3}, 2}, RowID{ChunkID{2}, 1}});
+  EXPECT_EQ(iterate(long_pos_list), (std::vector<std::optional<int>>{8, 1, std::nullopt, 5, 9, 3, 6, std::nullopt, 11,
+                                                                     std::nullopt}));
+
+  // Fewer positions than chunks are looked up one by one
+  const auto short_pos_list =
+      std::make_shared<PosList>(PosList{RowID{ChunkID{3}, 1}, RowID{ChunkID{1}, 1}, NULL_ROW_ID});
+  EXPECT_EQ(iterate(short_pos_list), (std::vector<std::optional<int>>{10, 4, std::nullopt}));
+}
+
 TEST_F(IterablesTest, ValueSegmentIteratorForEach) {
   auto chunk = table->get_chunk(ChunkID{0u});
 
@@ -0,0 +1,66 @@
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/lazy_table_prefetcher.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class LazyTablePrefetcherTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& table_name : {"table_a", "table_b", "table_c"}) {
+      StorageManager::get().add_lazy_table(table_name, [&, table_name = std::string{table_name}]() {
+        loaded_table_names.emplace_back(table_name);
+        return load_table("resources/test_data/tbl/int_float.tbl", 2);
+      });
+    }
+  }
+
+  void TearDown() override { filesystem::remove(usage_file_path); }
+
+  const std::string usage_file_path = test_data_path + "lazy_table_prefetcher_test_usage";
+  std::vector<std::string> loaded_table_names;
+};
+
+TEST_F(LazyTablePrefetcherTest, PrefetchOrder) {
+  const auto usage = std::map<std::string, uint64_t>{{"table_b", 1}, {"table_c", 3}, {"table_d", 5}};
+  EXPECT_EQ(LazyTablePrefetcher::prefetch_order({"table_a", "table_b", "table_c"}, usage),
+            (std::vector<std::string>{"table_c", "table_b", "table_a"}));
+  EXPECT_EQ(LazyTablePrefetcher::prefetch_order({"table_b", "table_a"}, {}),
+            (std::vector<std::string>{"table_a", "table_b"}));
+}
+
+TEST_F(LazyTablePrefetcherTest, PrefetchesMostFrequentlyUsedTablesFirst) {
+  LazyTablePrefetcher::write_usage({{"table_b", 2}, {"table_c", 1}}, usage_file_path);
+
+  // A query looked up table_c before it was prefetched
+  StorageManager::get().get_table("table_c");
+  LazyTablePrefetcher::prefetch(usage_file_path);
+
+  EXPECT_EQ(loaded_table_names, (std::vector<std::string>{"table_c", "table_b", "table_a"}));
+  EXPECT_TRUE(StorageManager::get().lazy_table_names().empty());
+  EXPECT_EQ(StorageManager::get().tables().size(), 3u);
+
+  const auto expected_usage = std::map<std::string, uint64_t>{{"table_b", 2}, {"table_c", 2}};
+  EXPECT_EQ(LazyTablePrefetcher::read_usage(usage_file_path), expected_usage);
+}
+
+TEST_F(LazyTablePrefetcherTest, NoUsageFile) {
+  EXPECT_TRUE(LazyTablePrefetcher::read_usage(usage_file_path).empty());
+
+  LazyTablePrefetcher::prefetch(usage_file_path);
+  EXPECT_EQ(loaded_table_names, (std::vector<std::string>{"table_a", "table_b", "table_c"}));
+
+  // No query waited for a table, so there is nothing to count
+  EXPECT_FALSE(filesystem::exists(usage_file_path));
+}
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageLZ4SegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Fills three blocks and a bit more, with some NULLs and empty strings
+    value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (auto index = 0u; index < LZ4Segment<std::string>::block_size * 3 + 10; ++index) {
+      if (index % 17 == 0) {
+        value_segment->append(NULL_VALUE);
+      } else if (index % 13 == 0) {
+        value_segment->append(std::string{});
+      } else {
+        value_segment->append("slyly final deposits " + std::to_string(index) + " sleep quickly");
+      }
+    }
+  }
+
+  std::shared_ptr<LZ4Segment<std::string>> encode(const std::shared_ptr<ValueSegment<std::string>>& segment) {
+    const auto encoded_segment =
+        encode_segment(EncodingType::LZ4, DataType::String, segment, VectorCompressionType::SimdBp128);
+    return std::dynamic_pointer_cast<LZ4Segment<std::string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> value_segment;
+};
+
+TEST_F(StorageLZ4SegmentTest, CompressSegment) {
+  const auto lz4_segment = encode(value_segment);
+  ASSERT_NE(lz4_segment, nullptr);
+  ASSERT_EQ(lz4_segment->size(), value_segment->size());
+  EXPECT_EQ(lz4_segment->block_count(), 4u);
+  EXPECT_EQ(lz4_segment->block_offsets().size(), 5u);
+  EXPECT_EQ(lz4_segment->block_offsets().back(), lz4_segment->compressed_data().size());
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment->size(); ++chunk_offset) {
+    EXPECT_EQ(lz4_segment->get_typed_value(chunk_offset), value_segment->get_typed_value(chunk_offset));
+  }
+
+  // The repetitive strings compress well, while a dictionary would store each of them
+  const auto dictionary_segment = encode_segment(EncodingType::Dictionary, DataType::String, value_segment);
+  EXPECT_LT(lz4_segment->estimate_memory_usage(), dictionary_segment->estimate_memory_usage());
+}
+
+TEST_F(StorageLZ4SegmentTest, EmptyBlocks) {
+  auto empty_strings = std::make_shared<ValueSegment<std::string>>(true);
+  for (auto index = 0u; index < LZ4Segment<std::string>::block_size + 1; ++index) {
+    empty_strings->append(index % 2 ? AllTypeVariant{std::string{}} : AllTypeVariant{NULL_VALUE});
+  }
+
+  const auto lz4_segment = encode(empty_strings);
+  EXPECT_TRUE(lz4_segment->compressed_data().empty());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < empty_strings->size(); ++chunk_offset) {
+    EXPECT_EQ(lz4_segment->get_typed_value(chunk_offset), empty_strings->get_typed_value(chunk_offset));
+  }
+}
+
+TEST_F(StorageLZ4SegmentTest, SequentialIteration) {
+  const auto lz4_segment = encode(value_segment);
+
+  auto chunk_offset = ChunkOffset{0};
+  create_iterable_from_segment(*lz4_segment).with_iterators([&](auto it, auto end) {
+    for (; it != end; ++it, ++chunk_offset) {
+      ASSERT_EQ(it->is_null(), value_segment->is_null(chunk_offset));
+      if (!it->is_null()) {
+        EXPECT_EQ(it->value(), value_segment->values()[chunk_offset]);
+      }
+    }
+  });
+  EXPECT_EQ(chunk_offset, value_segment->size());
+}
+
+TEST_F(StorageLZ4SegmentTest, PointAccess) {
+  const auto lz4_segment = encode(value_segment);
+
+  // Positions jump between blocks and back
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->guarantee_single_chunk();
+  for (const auto chunk_offset : {5u, 3u, 300u, 17u, 777u, 256u, 255u}) {
+    position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+
+  create_iterable_from_segment(*lz4_segment).with_iterators(position_filter, [&](auto it, auto end) {
+    for (; it != end; ++it) {
+      const auto referenced_chunk_offset = (*position_filter)[it->chunk_offset()].chunk_offset;
+      ASSERT_EQ(it->is_null(), value_segment->is_null(referenced_chunk_offset));
+      if (!it->is_null()) {
+        EXPECT_EQ(it->value(), value_segment->values()[referenced_chunk_offset]);
+      }
+    }
+  });
+}
+
+}  // namespace opossum
@@ -151,6 +151,38 @@ TEST_P(MaterializeTest, MaterializeNullsTwoSegments) {
   EXPECT_EQ(expected, nulls);
 }
 
+TEST_P(MaterializeTest, MaterializeIntoValueSegment) {
+  auto target = ValueSegment<int64_t>(true);
+  target.values().resize(3);
+  target.null_values().resize(3);
+
+  materialize_into_value_segment(*_data_table_with_nulls->get_chunk(ChunkID(0))->get_segment(ColumnID(0)), 1u, 1u,
+                                 target, 0u);
+  materialize_into_value_segment(*_data_table_with_nulls->get_chunk(ChunkID(1))->get_segment(ColumnID(0)), 0u, 2u,
+                                 target, 1u);
+  EXPECT_EQ(target.values()[0], 123);
+  EXPECT_TRUE(target.is_null(1));
+  EXPECT_EQ(target.values()[2], 1234);
+  EXPECT_EQ(target.null_values()[2], false);
+}
+
+TEST_P(MaterializeTest, MaterializeReferencesIntoValueSegment) {
+  auto target = ValueSegment<float>{};
+  target.values().resize(2);
+
+  materialize_into_value_segment(*_references_table->get_chunk(ChunkID(0))->get_segment(ColumnID(1)), 0u, 2u, target,
+                                 0u);
+  EXPECT_FLOAT_EQ(target.values()[0], 458.7f);
+  EXPECT_FLOAT_EQ(target.values()[1], 456.7f);
+
+  // NULLs cannot be copied to a non-nullable target
+  auto non_nullable_target = ValueSegment<int32_t>{};
+  non_nullable_target.values().resize(1);
+  EXPECT_THROW(materialize_into_value_segment(*_data_table_with_nulls->get_chunk(ChunkID(1))->get_segment(ColumnID(0)),
+                                              0u, 1u, non_nullable_target, 0u),
+               std::logic_error);
+}
+
 INSTANTIATE_TEST_CASE_P(
     MaterializeTestInstances, MaterializeTest,
     ::testing::ValuesIn(std::begin(all_segment_encoding_specs),
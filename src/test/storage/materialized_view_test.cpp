@@ -0,0 +1,177 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "optimizer/optimizer.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MaterializedViewTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto sales_column_definitions = TableColumnDefinitions{};
+    sales_column_definitions.emplace_back("sale_store_id", DataType::Int);
+    sales_column_definitions.emplace_back("amount", DataType::Int);
+    const auto sales = std::make_shared<Table>(sales_column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    sales->append({1, 10});
+    sales->append({1, 20});
+    sales->append({2, 30});
+    StorageManager::get().add_table("sales", sales);
+
+    auto stores_column_definitions = TableColumnDefinitions{};
+    stores_column_definitions.emplace_back("store_id", DataType::Int);
+    stores_column_definitions.emplace_back("region", DataType::Int);
+    const auto stores = std::make_shared<Table>(stores_column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    stores->append({1, 100});
+    stores->append({2, 200});
+    StorageManager::get().add_table("stores", stores);
+  }
+
+  std::shared_ptr<MaterializedView> _add_materialized_view(const std::string& name, const std::string& sql) {
+    const auto lqp = SQLPipelineBuilder{sql}.create_pipeline_statement().get_unoptimized_logical_plan();
+    StorageManager::get().add_materialized_view(name, lqp);
+    return StorageManager::get().get_materialized_view(name);
+  }
+
+  std::shared_ptr<const Table> _execute_sql(const std::string& sql,
+                                            const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    return builder.create_pipeline().get_result_table();
+  }
+
+  // Without the MaterializedViewRule, so that the query is not rewritten to read the view
+  std::shared_ptr<const Table> _execute_unoptimized_sql(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.with_optimizer(std::make_shared<Optimizer>()).create_pipeline().get_result_table();
+  }
+
+  const std::string _sales_by_region_sql =
+      "SELECT region, SUM(amount) AS revenue, COUNT(*) AS sale_count, MIN(amount) AS low, MAX(amount) AS high "
+      "FROM sales, stores WHERE sale_store_id = store_id GROUP BY region";
+};
+
+TEST_F(MaterializedViewTest, AddAndDrop) {
+  _add_materialized_view("sales_by_region", _sales_by_region_sql);
+
+  EXPECT_TRUE(StorageManager::get().has_materialized_view("sales_by_region"));
+  EXPECT_TRUE(StorageManager::get().has_table("sales_by_region"));
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"),
+                            _execute_unoptimized_sql(_sales_by_region_sql));
+
+  EXPECT_THROW(_add_materialized_view("sales_by_region", _sales_by_region_sql), std::exception);
+  EXPECT_THROW(StorageManager::get().drop_table("sales_by_region"), std::exception);
+
+  StorageManager::get().drop_materialized_view("sales_by_region");
+  EXPECT_FALSE(StorageManager::get().has_materialized_view("sales_by_region"));
+  EXPECT_FALSE(StorageManager::get().has_table("sales_by_region"));
+}
+
+TEST_F(MaterializedViewTest, RefreshIncrementallyAfterInserts) {
+  const auto view = _add_materialized_view("sales_by_region", _sales_by_region_sql);
+  ASSERT_TRUE(view->is_incremental());
+
+  // Unchanged tables
+  EXPECT_TRUE(view->refresh());
+
+  // Rows inserted into one of the tables, including a new group
+  _execute_sql("INSERT INTO sales VALUES (2, 5)");
+  _execute_sql("INSERT INTO stores VALUES (3, 300)");
+  _execute_sql("INSERT INTO sales VALUES (3, 40)");
+  EXPECT_TRUE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"),
+                            _execute_unoptimized_sql(_sales_by_region_sql));
+
+  // Rows inserted into both tables that only join with each other
+  _execute_sql("INSERT INTO stores VALUES (4, 100)");
+  _execute_sql("INSERT INTO sales VALUES (4, 1)");
+  _execute_sql("INSERT INTO sales VALUES (1, 50)");
+  EXPECT_TRUE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"),
+                            _execute_unoptimized_sql(_sales_by_region_sql));
+}
+
+TEST_F(MaterializedViewTest, RecomputeAfterDeletes) {
+  const auto view = _add_materialized_view("sales_by_region", _sales_by_region_sql);
+
+  _execute_sql("DELETE FROM sales WHERE amount = 10");
+  _execute_sql("INSERT INTO sales VALUES (2, 5)");
+  EXPECT_FALSE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"),
+                            _execute_unoptimized_sql(_sales_by_region_sql));
+
+  // Incremental again from the snapshot of the recomputation on
+  _execute_sql("INSERT INTO sales VALUES (1, 1)");
+  EXPECT_TRUE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"),
+                            _execute_unoptimized_sql(_sales_by_region_sql));
+}
+
+TEST_F(MaterializedViewTest, RefreshOnlyWithCommittedRows) {
+  const auto view = _add_materialized_view("sales_by_region", _sales_by_region_sql);
+  const auto expected_table = _execute_unoptimized_sql(_sales_by_region_sql);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  _execute_sql("INSERT INTO sales VALUES (2, 5)", transaction_context);
+  EXPECT_TRUE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"), expected_table);
+
+  transaction_context->commit();
+  EXPECT_TRUE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sales_by_region"),
+                            _execute_unoptimized_sql(_sales_by_region_sql));
+}
+
+TEST_F(MaterializedViewTest, OperatorsAboveTheAggregate) {
+  const auto sql =
+      "SELECT sale_store_id, SUM(amount) * 2 AS doubled FROM sales GROUP BY sale_store_id HAVING COUNT(*) > 1 "
+      "ORDER BY sale_store_id";
+  const auto view = _add_materialized_view("doubled_sales", sql);
+  ASSERT_TRUE(view->is_incremental());
+
+  _execute_sql("INSERT INTO sales VALUES (2, 5)");
+  EXPECT_TRUE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM doubled_sales"), _execute_unoptimized_sql(sql));
+}
+
+TEST_F(MaterializedViewTest, RecomputeViewsThatAreNotIncremental) {
+  const auto sql = "SELECT sale_store_id, AVG(amount) AS average FROM sales GROUP BY sale_store_id";
+  const auto view = _add_materialized_view("average_sales", sql);
+  EXPECT_FALSE(view->is_incremental());
+
+  _execute_sql("INSERT INTO sales VALUES (2, 5)");
+  EXPECT_FALSE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM average_sales"), _execute_unoptimized_sql(sql));
+}
+
+TEST_F(MaterializedViewTest, RecomputeSelfJoins) {
+  // Both sides of the join read the same operators, so that the delta of one of them cannot be joined with the other
+  const auto sql =
+      "SELECT s1.sale_store_id, COUNT(*) AS pair_count FROM sales AS s1, sales AS s2 "
+      "WHERE s1.sale_store_id = s2.sale_store_id GROUP BY s1.sale_store_id";
+  const auto view = _add_materialized_view("sale_pairs", sql);
+  EXPECT_FALSE(view->is_incremental());
+
+  _execute_sql("INSERT INTO sales VALUES (2, 5)");
+  EXPECT_FALSE(view->refresh());
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM sale_pairs"), _execute_unoptimized_sql(sql));
+}
+
+TEST_F(MaterializedViewTest, QueriesReadTheView) {
+  _add_materialized_view("sales_by_region", _sales_by_region_sql);
+
+  // The query reads the result of the last refresh
+  _execute_sql("INSERT INTO sales VALUES (2, 5)");
+  const auto expected_table = _execute_sql("SELECT * FROM sales_by_region");
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql(_sales_by_region_sql), expected_table);
+}
+
+}  // namespace opossum
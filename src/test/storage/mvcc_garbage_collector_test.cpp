@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_garbage_collector.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class MvccGarbageCollectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 holds 12345 and 123, chunk 1 holds 1234
+    _table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  std::shared_ptr<const Table> _execute_sql(const std::string& sql,
+                                            const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    return builder.create_pipeline().get_result_table();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MvccGarbageCollectorTest, CompactsChunksWithInvalidRows) {
+  // Below min_invalid_row_fraction, and the last chunk is never compacted
+  EXPECT_EQ(MvccGarbageCollector::get().compact_chunks(), 0u);
+  _execute_sql("DELETE FROM table_a WHERE a = 1234");
+  EXPECT_EQ(MvccGarbageCollector::get().compact_chunks(), 0u);
+
+  _execute_sql("DELETE FROM table_a WHERE a = 12345");
+  const auto expected_table = _execute_sql("SELECT * FROM table_a");
+  EXPECT_EQ(MvccGarbageCollector::get().compact_chunks(), 1u);
+
+  // The visible row was moved to the end of the table
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  ASSERT_TRUE(chunk->cleanup_commit_id());
+  EXPECT_EQ(*chunk->cleanup_commit_id(), TransactionManager::get().last_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+
+  // Nobody looks at the chunk anymore
+  EXPECT_EQ(MvccGarbageCollector::get().remove_compacted_chunks(), 1u);
+  EXPECT_NE(_table->get_chunk(ChunkID{0}), chunk);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(_table->chunk_count(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a"), expected_table);
+
+  // Removed chunks are not compacted again
+  EXPECT_EQ(MvccGarbageCollector::get().compact_chunks(), 0u);
+  EXPECT_EQ(MvccGarbageCollector::get().remove_compacted_chunks(), 0u);
+}
+
+TEST_F(MvccGarbageCollectorTest, RemovalWaitsForOlderTransactions) {
+  const auto expected_table = _execute_sql("SELECT * FROM table_a");
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(TransactionManager::get().lowest_active_snapshot_commit_id(), transaction_context->snapshot_commit_id());
+  EXPECT_EQ(TransactionManager::get().lowest_active_transaction_id(), transaction_context->transaction_id());
+
+  _execute_sql("DELETE FROM table_a WHERE a = 12345");
+  EXPECT_TRUE(MvccGarbageCollector::get().compact_chunk("table_a", ChunkID{0}));
+
+  // The older transaction still sees the deleted row in the compacted chunk
+  EXPECT_EQ(MvccGarbageCollector::get().remove_compacted_chunks(), 0u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute_sql("SELECT * FROM table_a", transaction_context), expected_table);
+
+  transaction_context->commit();
+  EXPECT_EQ(TransactionManager::get().lowest_active_snapshot_commit_id(), TransactionManager::get().last_commit_id());
+  EXPECT_EQ(MvccGarbageCollector::get().remove_compacted_chunks(), 1u);
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a")->row_count(), 2u);
+}
+
+TEST_F(MvccGarbageCollectorTest, CompactionConflictsWithConcurrentWrites) {
+  _execute_sql("DELETE FROM table_a WHERE a = 12345");
+
+  // The remaining row of the chunk is locked by another transaction
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  _execute_sql("DELETE FROM table_a WHERE a = 123", transaction_context);
+  EXPECT_FALSE(MvccGarbageCollector::get().compact_chunk("table_a", ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+
+  transaction_context->rollback();
+  EXPECT_TRUE(MvccGarbageCollector::get().compact_chunk("table_a", ChunkID{0}));
+  EXPECT_EQ(_execute_sql("SELECT * FROM table_a")->row_count(), 2u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PartitionSchemaTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    column_definitions = {{"a", DataType::Int, true}, {"b", DataType::String}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table->set_partition_schema(
+        PartitionSchema::range_partitioning(ColumnID{0}, DataType::Int, {AllTypeVariant{10}, AllTypeVariant{20}}));
+  }
+
+  std::vector<PartitionID> chunk_partition_ids() const {
+    auto partition_ids = std::vector<PartitionID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      partition_ids.emplace_back(table->get_chunk(chunk_id)->partition_id());
+    }
+    return partition_ids;
+  }
+
+  TableColumnDefinitions column_definitions;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(PartitionSchemaTest, RangePartitioning) {
+  const auto schema = PartitionSchema::range_partitioning(ColumnID{0}, DataType::Long,
+                                                          {AllTypeVariant{10}, AllTypeVariant{int64_t{20}}});
+  EXPECT_EQ(schema->partition_count(), PartitionID{3});
+
+  EXPECT_EQ(schema->partition_of(-5), PartitionID{0});
+  EXPECT_EQ(schema->partition_of(9), PartitionID{0});
+  EXPECT_EQ(schema->partition_of(10), PartitionID{1});
+  EXPECT_EQ(schema->partition_of(int64_t{19}), PartitionID{1});
+  EXPECT_EQ(schema->partition_of(20), PartitionID{2});
+  EXPECT_EQ(schema->partition_of(NULL_VALUE), PartitionID{0});
+
+  EXPECT_TRUE(schema->can_prune(PartitionID{0}, PredicateCondition::Equals, 10));
+  EXPECT_FALSE(schema->can_prune(PartitionID{1}, PredicateCondition::Equals, 10));
+  EXPECT_TRUE(schema->can_prune(PartitionID{2}, PredicateCondition::Equals, 10));
+  EXPECT_TRUE(schema->can_prune(PartitionID{1}, PredicateCondition::LessThan, 10));
+  EXPECT_FALSE(schema->can_prune(PartitionID{1}, PredicateCondition::LessThanEquals, 10));
+  EXPECT_TRUE(schema->can_prune(PartitionID{1}, PredicateCondition::GreaterThanEquals, 20));
+  EXPECT_FALSE(schema->can_prune(PartitionID{2}, PredicateCondition::GreaterThan, 20));
+  EXPECT_TRUE(schema->can_prune(PartitionID{0}, PredicateCondition::Between, 12, 25));
+  EXPECT_FALSE(schema->can_prune(PartitionID{2}, PredicateCondition::Between, 12, 25));
+  EXPECT_TRUE(schema->can_prune(PartitionID{2}, PredicateCondition::IsNull, NULL_VALUE));
+  EXPECT_FALSE(schema->can_prune(PartitionID{0}, PredicateCondition::IsNull, NULL_VALUE));
+
+  // Values of other types are not cast, so they never prune
+  EXPECT_FALSE(schema->can_prune(PartitionID{0}, PredicateCondition::Equals, 10.5));
+  EXPECT_FALSE(schema->can_prune(PartitionID{0}, PredicateCondition::NotEquals, 10));
+}
+
+TEST_F(PartitionSchemaTest, HashPartitioning) {
+  const auto schema = PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{4});
+  EXPECT_EQ(schema->partition_count(), PartitionID{4});
+
+  const auto partition_id = schema->partition_of(42);
+  EXPECT_LT(partition_id, PartitionID{4});
+  EXPECT_EQ(schema->partition_of(int64_t{42}), partition_id);
+
+  for (auto other_partition_id = PartitionID{0}; other_partition_id < PartitionID{4}; ++other_partition_id) {
+    EXPECT_EQ(schema->can_prune(other_partition_id, PredicateCondition::Equals, 42),
+              other_partition_id != partition_id);
+    EXPECT_FALSE(schema->can_prune(other_partition_id, PredicateCondition::LessThan, 42));
+  }
+}
+
+TEST_F(PartitionSchemaTest, Compatibility) {
+  const auto hash_schema = PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{4});
+  EXPECT_TRUE(hash_schema->is_compatible_with(
+      *PartitionSchema::hash_partitioning(ColumnID{2}, DataType::Long, PartitionID{4})));
+  EXPECT_FALSE(hash_schema->is_compatible_with(
+      *PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{8})));
+  EXPECT_FALSE(hash_schema->is_compatible_with(
+      *PartitionSchema::hash_partitioning(ColumnID{0}, DataType::String, PartitionID{4})));
+  EXPECT_FALSE(hash_schema->is_compatible_with(*table->partition_schema()));
+}
+
+TEST_F(PartitionSchemaTest, AppendRoutesRows) {
+  table->append({5, "a"});
+  table->append({15, "b"});
+  table->append({6, "c"});
+  table->append({NULL_VALUE, "d"});
+  table->append({25, "e"});
+
+  // The maximum chunk size is 2, so the NULL value starts a new chunk of partition 0
+  EXPECT_EQ(chunk_partition_ids(), (std::vector<PartitionID>{PartitionID{0}, PartitionID{1}, PartitionID{0},
+                                                              PartitionID{2}}));
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2u);
+  EXPECT_EQ(table->last_chunk_id_of_partition(PartitionID{0}), ChunkID{2});
+  EXPECT_EQ(table->last_chunk_id_of_partition(PartitionID{2}), ChunkID{3});
+}
+
+TEST_F(PartitionSchemaTest, InsertRoutesRows) {
+  StorageManager::get().add_table("partitioned", table);
+  table->append({5, "a"});
+
+  const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+  values->append({25, "b"});
+  values->append({7, "c"});
+  values->append({12, "d"});
+  values->append({26, "e"});
+  values->append({27, "f"});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("partitioned", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(chunk_partition_ids(),
+            (std::vector<PartitionID>{PartitionID{0}, PartitionID{1}, PartitionID{2}, PartitionID{2}}));
+  EXPECT_EQ((*table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[1], AllTypeVariant{"c"});
+  EXPECT_EQ((*table->get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[0], AllTypeVariant{"b"});
+  EXPECT_EQ((*table->get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[1], AllTypeVariant{"e"});
+  EXPECT_EQ((*table->get_chunk(ChunkID{3})->get_segment(ColumnID{1}))[0], AllTypeVariant{"f"});
+
+  const auto get_table = std::make_shared<GetTable>("partitioned");
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->row_count(), 6u);
+}
+
+TEST_F(PartitionSchemaTest, DropPartition) {
+  table->append({5, "a"});
+  table->append({15, "b"});
+  table->append({6, "c"});
+  table->append({7, "d"});
+
+  table->drop_partition(PartitionID{0});
+  EXPECT_EQ(table->row_count(), 1u);
+  EXPECT_EQ(chunk_partition_ids(), (std::vector<PartitionID>{PartitionID{0}, PartitionID{1}, PartitionID{0}}));
+
+  // The partition is filled again by later rows
+  table->append({8, "e"});
+  EXPECT_EQ(table->row_count(), 2u);
+  EXPECT_EQ(table->last_chunk_id_of_partition(PartitionID{0}), ChunkID{3});
+}
+
+TEST_F(PartitionSchemaTest, OnlyEmptyTablesCanBePartitioned) {
+  auto other_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  other_table->append({1, "a"});
+  EXPECT_THROW(other_table->set_partition_schema(
+                   PartitionSchema::hash_partitioning(ColumnID{0}, DataType::Int, PartitionID{2})),
+               std::exception);
+
+  // Chunks might hold rows of any partition
+  EXPECT_THROW(table->append_chunk(Segments{}), std::exception);
+}
+
+}  // namespace opossum
@@ -29,6 +29,14 @@ class PreparedPlanTest : public ::testing::Test {
   LQPColumnReference a_a, b_x;
 };
 
+TEST_F(PreparedPlanTest, InstantiateWithoutPlaceholders) {
+  const auto lqp = PredicateNode::make(greater_than_(a_a, 5), node_a);
+  const auto prepared_plan = PreparedPlan{lqp, {}};
+
+  // There is nothing to fill in, so that the LQP is not copied
+  EXPECT_EQ(prepared_plan.instantiate({}), lqp);
+}
+
 TEST_F(PreparedPlanTest, Instantiate) {
   // clang-format off
   const auto placeholder_parameter_a = placeholder_(ParameterID{0});
@@ -1,11 +1,15 @@
 #include <memory>
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/base_column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/filesystem.hpp"
@@ -67,6 +71,82 @@ TEST_F(StorageManagerTest, HasTable) {
   EXPECT_EQ(sm.has_table("first_table"), true);
 }
 
+TEST_F(StorageManagerTest, CatalogVersions) {
+  auto& sm = StorageManager::get();
+  const auto catalog = sm.catalog();
+  const auto table = sm.get_table("first_table");
+
+  sm.drop_table("first_table");
+  EXPECT_GT(sm.catalog()->version, catalog->version);
+  EXPECT_FALSE(sm.has_table("first_table"));
+
+  // Versions that were loaded before are not changed and keep their tables alive
+  ASSERT_EQ(catalog->tables.count("first_table"), 1u);
+  EXPECT_EQ(catalog->tables.at("first_table"), table);
+}
+
+TEST_F(StorageManagerTest, ConcurrentLookupsAndDrops) {
+  auto& sm = StorageManager::get();
+  auto done = std::atomic_bool{false};
+  auto lookup_count = std::atomic_size_t{0};
+
+  auto readers = std::vector<std::thread>{};
+  for (auto reader_id = 0; reader_id < 4; ++reader_id) {
+    readers.emplace_back([&]() {
+      while (!done) {
+        const auto catalog = sm.catalog();
+        const auto table_iter = catalog->tables.find("third_table");
+        if (table_iter != catalog->tables.end()) {
+          EXPECT_EQ(table_iter->second->column_count(), 1u);
+        }
+        EXPECT_TRUE(sm.has_table("second_table"));
+        EXPECT_TRUE(sm.get_table("second_table"));
+        ++lookup_count;
+      }
+    });
+  }
+
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    sm.add_table("third_table", std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data));
+    sm.drop_table("third_table");
+  }
+
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_FALSE(sm.has_table("third_table"));
+  EXPECT_GT(lookup_count.load(), 0u);
+}
+
+TEST_F(StorageManagerTest, AddChunksToTableStatistics) {
+  auto& sm = StorageManager::get();
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10,
+                                             UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 10; ++value) {
+    table->append({value});
+  }
+  sm.add_table("third_table", table);
+  table->table_statistics()->increase_invalid_row_count(2);
+
+  for (auto value = int32_t{10}; value < 20; ++value) {
+    table->append({value});
+  }
+  EXPECT_FLOAT_EQ(table->table_statistics()->column_statistics().at(0)->distinct_count(), 10.0f);
+
+  sm.add_chunks_to_table_statistics("third_table", {ChunkID{1}});
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count(), 20.0f);
+  EXPECT_FLOAT_EQ(table->table_statistics()->column_statistics().at(0)->distinct_count(), 20.0f);
+  EXPECT_EQ(table->table_statistics()->approx_valid_row_count(), 18u);
+
+  // Chunks that were added before are skipped
+  sm.add_chunks_to_table_statistics("third_table", {ChunkID{0}, ChunkID{1}});
+  EXPECT_FLOAT_EQ(table->table_statistics()->column_statistics().at(0)->distinct_count(), 20.0f);
+
+  EXPECT_THROW(sm.add_chunks_to_table_statistics("unknown_table", {ChunkID{0}}), std::exception);
+}
+
 TEST_F(StorageManagerTest, AddViewTwice) {
   const auto v1_lqp = StoredTableNode::make("first_table");
   const auto v1 = std::make_shared<LQPView>(v1_lqp, std::unordered_map<ColumnID, std::string>{});
@@ -116,6 +196,65 @@ TEST_F(StorageManagerTest, ListViewNames) {
   EXPECT_EQ(view_names[1], "second_view");
 }
 
+TEST_F(StorageManagerTest, LazyTables) {
+  auto& sm = StorageManager::get();
+  auto load_count = std::atomic_uint{0};
+  const auto loader = [&]() {
+    ++load_count;
+    return load_table("resources/test_data/tbl/int_int2.tbl", 2);
+  };
+  sm.add_lazy_table("lazy_table", loader);
+  sm.add_lazy_table("dropped_lazy_table", loader);
+  EXPECT_THROW(sm.add_lazy_table("first_table", loader), std::exception);
+  EXPECT_THROW(sm.add_table("lazy_table", std::make_shared<Table>(TableColumnDefinitions{}, TableType::Data)),
+               std::exception);
+
+  // Lazy tables are known by their names, but not loaded
+  EXPECT_TRUE(sm.has_table("lazy_table"));
+  const auto table_names =
+      std::vector<std::string>{"dropped_lazy_table", "first_table", "lazy_table", "second_table"};
+  EXPECT_EQ(sm.table_names(), table_names);
+  EXPECT_EQ(sm.lazy_table_names(), (std::vector<std::string>{"dropped_lazy_table", "lazy_table"}));
+  EXPECT_EQ(sm.tables().size(), 2u);
+
+  sm.drop_table("dropped_lazy_table");
+  EXPECT_FALSE(sm.has_table("dropped_lazy_table"));
+  EXPECT_FALSE(sm.load_lazy_table("dropped_lazy_table"));
+
+  // Concurrent lookups load the table once
+  auto threads = std::vector<std::thread>{};
+  auto tables = std::vector<std::shared_ptr<Table>>(8);
+  for (auto& table : tables) {
+    threads.emplace_back([&]() { table = sm.get_table("lazy_table"); });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(load_count, 1u);
+  for (const auto& table : tables) {
+    EXPECT_EQ(table, tables.front());
+  }
+  EXPECT_EQ(tables.front()->row_count(), 4u);
+  EXPECT_TRUE(tables.front()->table_statistics());
+  EXPECT_TRUE(sm.lazy_table_names().empty());
+  EXPECT_EQ(sm.tables().size(), 3u);
+  EXPECT_FALSE(sm.load_lazy_table("lazy_table"));
+  EXPECT_EQ(load_count, 1u);
+}
+
+TEST_F(StorageManagerTest, LazyTableLoaderThrows) {
+  auto& sm = StorageManager::get();
+  auto attempt_count = 0;
+  sm.add_lazy_table("lazy_table", [&]() {
+    Assert(++attempt_count > 1, "First attempt fails");
+    return load_table("resources/test_data/tbl/int_int2.tbl", 2);
+  });
+
+  EXPECT_THROW(sm.get_table("lazy_table"), std::exception);
+  EXPECT_TRUE(sm.has_table("lazy_table"));
+  EXPECT_EQ(sm.get_table("lazy_table")->row_count(), 4u);
+  EXPECT_EQ(attempt_count, 2);
+}
+
 TEST_F(StorageManagerTest, Print) {
   auto& sm = StorageManager::get();
   sm.add_table("third_table", load_table("resources/test_data/tbl/int_int2.tbl", 2));
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/index_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String);
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+
+    table->append({5, "five"});
+    table->append({3, "three"});
+    table->append({NULL_VALUE, "null"});
+    table->append({1, "one"});
+    table->append({3, "three again"});
+    table->append({7, "seven"});
+    table->append({4, "four"});
+  }
+
+  static PosList sorted(PosList pos_list) {
+    std::sort(pos_list.begin(), pos_list.end());
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(TableIndexTest, CreateAndLookup) {
+  const auto index = table->create_table_index(ColumnID{0});
+
+  EXPECT_EQ(table->get_table_index(ColumnID{0}), index);
+  EXPECT_EQ(table->get_table_index(ColumnID{1}), nullptr);
+  EXPECT_EQ(index->column_id(), ColumnID{0});
+  EXPECT_EQ(index->row_count(), 6u);
+
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::Equals, 3)),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, 2).empty());
+  EXPECT_EQ(index->lookup(PredicateCondition::LessThan, 4),
+            (PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::GreaterThanEquals, 5),
+            (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(index->lookup(PredicateCondition::NotEquals, 3).size(), 4u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Between, 4, AllTypeVariant{5}),
+            (PosList{RowID{ChunkID{2}, 0}, RowID{ChunkID{0}, 0}}));
+  EXPECT_TRUE(index->lookup(PredicateCondition::Between, 5, AllTypeVariant{4}).empty());
+  EXPECT_TRUE(index->lookup(PredicateCondition::Equals, NULL_VALUE).empty());
+}
+
+TEST_F(TableIndexTest, CreateTwice) {
+  table->create_table_index(ColumnID{0});
+  EXPECT_THROW(table->create_table_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableIndexTest, CoversEncodedChunks) {
+  ChunkEncoder::encode_all_chunks(table);
+  const auto index = table->create_table_index(ColumnID{1});
+
+  EXPECT_EQ(index->row_count(), 7u);
+  EXPECT_EQ(index->lookup(PredicateCondition::Equals, "seven"), (PosList{RowID{ChunkID{1}, 2}}));
+}
+
+TEST_F(TableIndexTest, MaintainedOnAppendAndRemoveChunk) {
+  const auto index = table->create_table_index(ColumnID{0});
+
+  table->append({3, "three once more"});
+  EXPECT_EQ(index->row_count(), 7u);
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::Equals, 3)),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 1}}));
+
+  table->remove_chunk(ChunkID{1});
+  EXPECT_EQ(index->row_count(), 4u);
+  EXPECT_EQ(sorted(index->lookup(PredicateCondition::Equals, 3)),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{2}, 1}}));
+}
+
+TEST_F(TableIndexTest, IndexScan) {
+  table->create_table_index(ColumnID{0});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto index_scan = std::make_shared<IndexScan>(
+      table_wrapper, SegmentIndexType::Invalid, std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::LessThanEquals,
+      std::vector<AllTypeVariant>{4});
+  index_scan->execute();
+
+  const auto expected_result = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_result->append({3, "three"});
+  expected_result->append({1, "one"});
+  expected_result->append({3, "three again"});
+  expected_result->append({4, "four"});
+
+  // One output chunk per input chunk with matches
+  EXPECT_EQ(index_scan->get_output()->chunk_count(), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_result);
+
+  // Only the included chunks are scanned
+  const auto partial_index_scan = std::make_shared<IndexScan>(
+      table_wrapper, SegmentIndexType::Invalid, std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::LessThanEquals,
+      std::vector<AllTypeVariant>{4});
+  partial_index_scan->set_included_chunk_ids({ChunkID{2}});
+  partial_index_scan->execute();
+
+  EXPECT_EQ(partial_index_scan->get_output()->row_count(), 1u);
+}
+
+}  // namespace opossum
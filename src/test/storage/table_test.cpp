@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -90,34 +91,46 @@ TEST_F(StorageTableTest, ShrinkingMvccDataHasNoSideEffects) {
   t->append({6, "world"});
 
   auto chunk = t->get_chunk(ChunkID{0});
+  chunk->mark_immutable();
 
   const auto values = std::vector<CommitID>{1u, 2u};
 
   {
-    // acquiring mvcc_data locks them
     auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
     mvcc_data->tids[0u] = values[0u];
-    mvcc_data->tids[1u] = values[1u];
     mvcc_data->begin_cids[0u] = values[0u];
     mvcc_data->begin_cids[1u] = values[1u];
     mvcc_data->end_cids[0u] = values[0u];
     mvcc_data->end_cids[1u] = values[1u];
   }
 
+  // A row is locked by a transaction
+  const auto previous_mvcc_data = chunk->mvcc_data();
+  EXPECT_FALSE(chunk->shrink_mvcc_data());
+  EXPECT_EQ(chunk->mvcc_data(), previous_mvcc_data);
+  EXPECT_EQ(previous_mvcc_data->tids[0u], values[0u]);
+  EXPECT_EQ(previous_mvcc_data->tids[1u], 0u);
+
+  previous_mvcc_data->tids[0u] = 0u;
+
   const auto previous_size = chunk->size();
 
-  chunk->get_scoped_mvcc_data_lock()->shrink();
+  EXPECT_TRUE(chunk->shrink_mvcc_data());
 
   ASSERT_EQ(previous_size, chunk->size());
   ASSERT_TRUE(chunk->has_mvcc_data());
+  EXPECT_NE(chunk->mvcc_data(), previous_mvcc_data);
 
   auto new_mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
   for (auto i = 0u; i < chunk->size(); ++i) {
-    EXPECT_EQ(new_mvcc_data->tids[i], values[i]);
+    EXPECT_EQ(new_mvcc_data->tids[i], 0u);
     EXPECT_EQ(new_mvcc_data->begin_cids[i], values[i]);
     EXPECT_EQ(new_mvcc_data->end_cids[i], values[i]);
+
+    // Readers of the old MVCC data see the rows locked
+    EXPECT_EQ(previous_mvcc_data->tids[i], MvccData::SHRINK_TRANSACTION_ID);
   }
 }
 
@@ -142,6 +155,27 @@ TEST_F(StorageTableTest, EmplaceChunkAndAppend) {
   EXPECT_EQ(t->chunk_count(), 2u);
 }
 
+TEST_F(StorageTableTest, AppendRows) {
+  t->append({4, "Hello,"});
+
+  auto rows = Table{TableColumnDefinitions{{"a", DataType::Long}, {"b", DataType::String}}, TableType::Data, 3};
+  rows.append({int64_t{6}, "world"});
+  rows.append({int64_t{3}, "!"});
+  rows.append({int64_t{5}, "?"});
+  rows.append({int64_t{7}, "."});
+
+  // The rows fill up the last chunk first, the values of the long column are cast to int
+  t->append_rows(rows);
+  EXPECT_EQ(t->row_count(), 5u);
+  EXPECT_EQ(t->chunk_count(), 3u);
+  EXPECT_EQ(t->get_chunk(ChunkID{0})->size(), 2u);
+  EXPECT_EQ(t->get_value<int32_t>(ColumnID{0}, 1u), 6);
+  EXPECT_EQ(t->get_value<std::string>(ColumnID{1}, 1u), "world");
+  EXPECT_EQ(t->get_value<int32_t>(ColumnID{0}, 3u), 5);
+  EXPECT_EQ(t->get_value<int32_t>(ColumnID{0}, 4u), 7);
+  EXPECT_EQ(t->get_value<std::string>(ColumnID{1}, 4u), ".");
+}
+
 TEST_F(StorageTableTest, EmplaceChunkDoesNotReplaceIfNumberOfChunksGreaterOne) {
   EXPECT_EQ(t->chunk_count(), 0u);
 
@@ -157,12 +191,62 @@ TEST_F(StorageTableTest, EmplaceChunkDoesNotReplaceIfNumberOfChunksGreaterOne) {
   EXPECT_EQ(t->chunk_count(), 3u);
 }
 
+TEST_F(StorageTableTest, ChunkSlots) {
+  t->append({4, "Hello,"});
+  t->create_chunk_slots(3);
+
+  const auto make_segments = [](const int32_t value) {
+    auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+    int_segment->append(value);
+    auto string_segment = std::make_shared<ValueSegment<std::string>>();
+    string_segment->append(std::to_string(value));
+    return Segments{int_segment, string_segment};
+  };
+
+  // Slots are filled in any order and can be left empty. Until they are appended, the chunks are not part of the table.
+  t->set_chunk_slot(2, make_segments(2));
+  t->set_chunk_slot(0, std::make_shared<Chunk>(make_segments(0)));
+  EXPECT_EQ(t->chunk_count(), 1u);
+
+  t->append_chunk_slots();
+  ASSERT_EQ(t->chunk_count(), 3u);
+  EXPECT_EQ(t->get_value<int32_t>(ColumnID{0}, 1u), 0);
+  EXPECT_EQ(t->get_value<int32_t>(ColumnID{0}, 2u), 2);
+
+  // The slots are gone, new ones can be created
+  t->create_chunk_slots(1);
+  t->append_chunk_slots();
+  EXPECT_EQ(t->chunk_count(), 3u);
+}
+
 TEST_F(StorageTableTest, ChunkSizeZeroThrows) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   TableColumnDefinitions column_definitions{};
   EXPECT_THROW(Table(column_definitions, TableType::Data, 0), std::logic_error);
 }
 
+TEST_F(StorageTableTest, ChangeMaxChunkSize) {
+  t->append({4, "Hello,"});
+  t->set_max_chunk_size(3);
+  t->append({6, "world"});
+  t->append({3, "!"});
+  t->append({5, "?"});
+  EXPECT_EQ(t->max_chunk_size(), 3u);
+  EXPECT_EQ(t->chunk_count(), 2u);
+  EXPECT_EQ(t->get_chunk(ChunkID{0})->size(), 3u);
+
+  EXPECT_THROW(t->set_max_chunk_size(0), std::logic_error);
+}
+
+TEST_F(StorageTableTest, ChooseMaxChunkSize) {
+  EXPECT_EQ(Table::choose_max_chunk_size(0), Table::MIN_CHOSEN_CHUNK_SIZE);
+  EXPECT_EQ(Table::choose_max_chunk_size(1'000'000'000'000), Chunk::DEFAULT_SIZE);
+
+  const auto chunk_size = Table::choose_max_chunk_size(10'000'000);
+  EXPECT_GE(chunk_size, Table::MIN_CHOSEN_CHUNK_SIZE);
+  EXPECT_LE(chunk_size, Chunk::DEFAULT_SIZE);
+}
+
 TEST_F(StorageTableTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
@@ -180,4 +264,38 @@ TEST_F(StorageTableTest, MemoryUsageEstimation) {
                                                      sizeof(TransactionID) + 2 * sizeof(CommitID));
 }
 
+TEST_F(StorageTableTest, NumaReplicas) {
+  Topology::use_fake_numa_topology(8, 4);
+
+  t->append({4, "Hello,"});
+  t->append({6, "world"});
+  t->append({3, "!"});
+  t->get_chunk(ChunkID{0})->mark_immutable();
+
+  EXPECT_FALSE(t->is_numa_replicated());
+  EXPECT_EQ(t->get_chunk_replica(ChunkID{0}, NodeID{1}), t->get_chunk(ChunkID{0}));
+
+  t->set_numa_replicated(true);
+  EXPECT_TRUE(t->is_numa_replicated());
+
+  for (auto node_id = NodeID{0}; node_id < 2; ++node_id) {
+    const auto replica = t->get_chunk_replica(ChunkID{0}, node_id);
+    EXPECT_NE(replica, t->get_chunk(ChunkID{0}));
+    EXPECT_EQ(replica->replicated_chunk(), t->get_chunk(ChunkID{0}));
+    EXPECT_EQ(Topology::get().get_node_id(replica->get_allocator().resource()), node_id);
+    EXPECT_EQ(replica->size(), 2u);
+    EXPECT_EQ((*replica->get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+    // The mutable chunk is not replicated
+    EXPECT_EQ(t->get_chunk_replica(ChunkID{1}, node_id), t->get_chunk(ChunkID{1}));
+  }
+
+  // Chunks that were replaced after the replication are not read from their replicas
+  t->remove_chunk(ChunkID{0});
+  EXPECT_EQ(t->get_chunk_replica(ChunkID{0}, NodeID{1}), t->get_chunk(ChunkID{0}));
+
+  t->set_numa_replicated(false);
+  EXPECT_FALSE(t->is_numa_replicated());
+}
+
 }  // namespace opossum
@@ -0,0 +1,156 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/maintenance/create_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/unique_constraint_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class UniqueConstraintIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int, true);
+
+    const auto create_table = std::make_shared<CreateTable>(
+        "t", column_definitions,
+        TableConstraintDefinitions{TableConstraintDefinition{{ColumnID{0}}, IsPrimaryKey::Yes},
+                                   TableConstraintDefinition{{ColumnID{1}}}});
+    create_table->execute();
+    table = StorageManager::get().get_table("t");
+
+    EXPECT_TRUE(insert({{1, 10}, {2, NULL_VALUE}, {3, NULL_VALUE}}));
+  }
+
+  // Inserts the @param rows in a transaction of their own and @return whether it was committed
+  bool insert(const std::vector<std::vector<AllTypeVariant>>& rows,
+              const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto& row : rows) {
+      values->append(row);
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto context =
+        transaction_context ? transaction_context : TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>("t", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+
+    if (insert->execute_failed()) {
+      context->rollback();
+      return false;
+    }
+
+    if (!transaction_context) context->commit();
+    return true;
+  }
+
+  // Deletes the rows with a = @param a
+  void delete_where_a_equals(const int32_t a, const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>("t");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, a);
+    table_scan->execute();
+
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(transaction_context);
+    delete_operator->execute();
+    ASSERT_FALSE(delete_operator->execute_failed());
+  }
+
+  TableColumnDefinitions column_definitions;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(UniqueConstraintIndexTest, CreatedByCreateTable) {
+  ASSERT_EQ(table->unique_constraints().size(), 2u);
+  EXPECT_EQ(table->unique_constraints()[0]->definition(),
+            TableConstraintDefinition({ColumnID{0}}, IsPrimaryKey::Yes));
+  EXPECT_EQ(table->unique_constraints()[1]->definition(), TableConstraintDefinition({ColumnID{1}}));
+}
+
+TEST_F(UniqueConstraintIndexTest, InvalidConstraints) {
+  // The table already has a primary key
+  EXPECT_THROW(table->add_unique_constraint(TableConstraintDefinition{{ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes}),
+               std::logic_error);
+  EXPECT_THROW(table->add_unique_constraint(TableConstraintDefinition{{ColumnID{1}}}), std::logic_error);
+  EXPECT_THROW(table->add_unique_constraint(TableConstraintDefinition{{ColumnID{2}}}), std::logic_error);
+
+  const auto other_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  other_table->append({1, 1});
+  other_table->append({1, 2});
+  EXPECT_THROW(other_table->add_unique_constraint(TableConstraintDefinition{{ColumnID{1}}, IsPrimaryKey::Yes}),
+               std::logic_error);
+  EXPECT_THROW(other_table->add_unique_constraint(TableConstraintDefinition{{ColumnID{0}}}), std::logic_error);
+
+  other_table->add_unique_constraint(TableConstraintDefinition{{ColumnID{0}, ColumnID{1}}});
+  EXPECT_THROW(other_table->append({1, 2}), std::logic_error);
+  other_table->append({2, 2});
+}
+
+TEST_F(UniqueConstraintIndexTest, InsertDuplicates) {
+  EXPECT_FALSE(insert({{1, 20}}));
+  EXPECT_FALSE(insert({{4, 10}}));
+  EXPECT_FALSE(insert({{4, 40}, {5, 50}, {4, 60}}));
+
+  // Any number of NULLs are allowed in a UNIQUE column
+  EXPECT_TRUE(insert({{4, NULL_VALUE}, {5, 50}}));
+  EXPECT_FALSE(insert({{6, 50}}));
+
+  EXPECT_EQ(table->row_count(), 11u);
+}
+
+TEST_F(UniqueConstraintIndexTest, ConcurrentInserts) {
+  const auto transaction_context_a = TransactionManager::get().new_transaction_context();
+  const auto transaction_context_b = TransactionManager::get().new_transaction_context();
+
+  // The uncommitted row of a conflicts with b
+  EXPECT_TRUE(insert({{4, 40}}, transaction_context_a));
+  EXPECT_FALSE(insert({{4, 41}}, transaction_context_b));
+
+  // Once a has been rolled back, the key is available again
+  transaction_context_a->rollback();
+  EXPECT_TRUE(insert({{4, 41}}));
+}
+
+TEST_F(UniqueConstraintIndexTest, ReinsertDeletedKeys) {
+  // A row that is being deleted by another transaction still conflicts
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  delete_where_a_equals(1, delete_context);
+  EXPECT_FALSE(insert({{1, 11}}));
+
+  delete_context->commit();
+  EXPECT_TRUE(insert({{1, 11}}));
+
+  // The transaction that deletes a row can insert its key again, as an Update does
+  const auto update_context = TransactionManager::get().new_transaction_context();
+  delete_where_a_equals(2, update_context);
+  EXPECT_TRUE(insert({{2, 22}}, update_context));
+  EXPECT_TRUE(update_context->commit());
+
+  EXPECT_FALSE(insert({{2, 23}}));
+}
+
+}  // namespace opossum
@@ -82,6 +82,24 @@ TEST_F(StorageValueSegmentTest, AppendNullValueWhenNullable) {
   EXPECT_NO_THROW(vs_double.append(NULL_VALUE));
 }
 
+TEST_F(StorageValueSegmentTest, MayContainNulls) {
+  EXPECT_FALSE(vs_int.may_contain_nulls());
+
+  auto nullable_segment = ValueSegment<int>{true};
+  nullable_segment.append(1);
+  EXPECT_FALSE(nullable_segment.may_contain_nulls());
+  nullable_segment.append(NULL_VALUE);
+  EXPECT_TRUE(nullable_segment.may_contain_nulls());
+
+  EXPECT_FALSE((ValueSegment<int>{std::vector<int>{1, 2}, std::vector<bool>{false, false}}.may_contain_nulls()));
+  EXPECT_TRUE((ValueSegment<int>{std::vector<int>{1, 0}, std::vector<bool>{false, true}}.may_contain_nulls()));
+
+  // NULLs might be written through the non-const null_values()
+  auto written_segment = ValueSegment<int>{std::vector<int>{1, 2}, std::vector<bool>{false, false}};
+  written_segment.null_values()[1] = true;
+  EXPECT_TRUE(written_segment.may_contain_nulls());
+}
+
 TEST_F(StorageValueSegmentTest, ArraySubscriptOperatorReturnsNullValue) {
   auto vs_int = ValueSegment<int>{true};
   auto vs_str = ValueSegment<std::string>{true};
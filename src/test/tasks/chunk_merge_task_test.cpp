@@ -0,0 +1,46 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_garbage_collector.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_merge_task.hpp"
+
+namespace opossum {
+
+class ChunkMergeTaskTest : public BaseTest {};
+
+TEST_F(ChunkMergeTaskTest, MergesSmallChunks) {
+  // Each of the three rows has a chunk of its own
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 1);
+  StorageManager::get().add_table("table_a", table);
+  const auto expected_table = load_table("resources/test_data/tbl/int_float.tbl", 4);
+
+  // The chunks are full, so they are not merged
+  auto merge_task = std::make_shared<ChunkMergeTask>("table_a");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->merged_chunk_count(), 0u);
+
+  // Compared to the new max_chunk_size, the first two chunks are small. Their rows are moved to the last chunk, which
+  // is filled by inserts.
+  table->set_max_chunk_size(4);
+  merge_task = std::make_shared<ChunkMergeTask>("table_a");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->merged_chunk_count(), 2u);
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 3u);
+
+  EXPECT_EQ(MvccGarbageCollector::get().remove_compacted_chunks(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 0u);
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  EXPECT_TABLE_EQ_UNORDERED(get_table->get_output(), expected_table);
+}
+
+}  // namespace opossum
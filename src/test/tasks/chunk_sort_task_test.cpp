@@ -0,0 +1,136 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/aggregate_expression.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_sort_task.hpp"
+
+namespace opossum {
+
+class ChunkSortTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 4, UseMvcc::Yes);
+    table->append({3, "c"});
+    table->append({NULL_VALUE, "n"});
+    table->append({1, "a"});
+    table->append({2, "b"});
+    table->append({5, "e"});
+    table->append({4, "d"});
+    table->append({4, "d2"});
+    table->append({NULL_VALUE, "m"});
+
+    // The rows are committed, the row "e" has been deleted
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      auto mvcc_data = table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+      for (auto& begin_cid : mvcc_data->begin_cids) {
+        begin_cid = 0;
+      }
+    }
+    table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->end_cids[0] = 5;
+
+    StorageManager::get().add_table("table", table);
+  }
+
+  static std::vector<AllTypeVariant> column_values(const std::shared_ptr<const Table>& table,
+                                                   const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto segment = table->get_chunk(chunk_id)->get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+        values.emplace_back((*segment)[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  void sort_chunks(const OrderByMode order_by_mode = OrderByMode::Ascending) {
+    ChunkSortTask{"table", {ChunkID{0}, ChunkID{1}}, ColumnID{0}, order_by_mode}.execute();
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(ChunkSortTaskTest, SortsRowsAndMvccData) {
+  sort_chunks();
+
+  EXPECT_EQ(column_values(table, ColumnID{0}), (std::vector<AllTypeVariant>{NULL_VALUE, 1, 2, 3, NULL_VALUE, 4, 4, 5}));
+  EXPECT_EQ(column_values(table, ColumnID{1}),
+            (std::vector<AllTypeVariant>{"n", "a", "b", "c", "m", "d", "d2", "e"}));
+
+  const auto expected_ordered_by = std::make_pair(ColumnID{0}, OrderByMode::Ascending);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->ordered_by(), expected_ordered_by);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->ordered_by(), expected_ordered_by);
+
+  // The deleted row "e" moved to the end of the chunk
+  const auto mvcc_data = table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+  EXPECT_EQ(mvcc_data->end_cids[0], MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data->end_cids[3], CommitID{5});
+}
+
+TEST_F(ChunkSortTaskTest, KeepsEncoding) {
+  ChunkEncoder::encode_chunk(table->get_chunk(ChunkID{0}), table->column_data_types(),
+                             {EncodingType::Dictionary, EncodingType::Dictionary});
+  sort_chunks(OrderByMode::DescendingNullsLast);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_EQ(column_values(table, ColumnID{0}), (std::vector<AllTypeVariant>{3, 2, 1, NULL_VALUE, 5, 4, 4, NULL_VALUE}));
+}
+
+TEST_F(ChunkSortTaskTest, OperatorsUseSortOrder) {
+  sort_chunks();
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The scan binary-searches the sorted chunks, its output is still sorted
+  const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::Between, 2, 4);
+  scan->execute();
+  EXPECT_EQ(column_values(scan->get_output(), ColumnID{1}), (std::vector<AllTypeVariant>{"b", "c", "d", "d2"}));
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{0})->ordered_by(),
+            std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+
+  // The sorted chunks are merged only, which keeps the sort stable
+  const auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, 3);
+  sort->execute();
+  EXPECT_EQ(column_values(sort->get_output(), ColumnID{1}),
+            (std::vector<AllTypeVariant>{"n", "m", "a", "b", "c", "d", "d2", "e"}));
+  for (const auto& chunk : sort->get_output()->chunks()) {
+    EXPECT_EQ(chunk->ordered_by(), std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+  }
+
+  // The groups of the sorted chunks are found without hashing
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  const auto groups = column_values(aggregate->get_output(), ColumnID{0});
+  const auto counts = column_values(aggregate->get_output(), ColumnID{1});
+  ASSERT_EQ(groups.size(), 6u);
+  for (auto group_idx = size_t{0}; group_idx < groups.size(); ++group_idx) {
+    const auto expected_count = variant_is_null(groups[group_idx]) || groups[group_idx] == AllTypeVariant{4} ? 2 : 1;
+    EXPECT_EQ(counts[group_idx], AllTypeVariant{int64_t{expected_count}});
+  }
+
+  // The sorted chunks are not sorted again by the sort-merge join
+  const auto join = std::make_shared<JoinSortMerge>(table_wrapper, table_wrapper, JoinMode::Inner,
+                                                    ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 8u);
+}
+
+}  // namespace opossum
@@ -9,7 +9,10 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/storage_manager.hpp"
@@ -26,9 +29,12 @@ class OperatorTaskTest : public BaseTest {
 
     _test_table_b = load_table("resources/test_data/tbl/int_float2.tbl", 2);
     StorageManager::get().add_table("table_b", _test_table_b);
+
+    _test_table_c = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+    StorageManager::get().add_table("table_c", _test_table_c);
   }
 
-  std::shared_ptr<Table> _test_table_a, _test_table_b;
+  std::shared_ptr<Table> _test_table_a, _test_table_b, _test_table_c;
 };
 
 TEST_F(OperatorTaskTest, BasicTasksFromOperatorTest) {
@@ -123,4 +129,140 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, PrioritizeCriticalPath) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto gt_b = std::make_shared<GetTable>("table_b");
+  auto gt_c = std::make_shared<GetTable>("table_c");
+  auto join_a_b = std::make_shared<JoinHash>(gt_a, gt_b, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                             PredicateCondition::Equals);
+  auto join_c = std::make_shared<JoinHash>(join_a_b, gt_c, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                           PredicateCondition::Equals);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(join_c, CleanupTemporaries::Yes);
+  ASSERT_EQ(tasks.size(), 5u);
+  EXPECT_EQ(tasks[3]->get_operator(), gt_c);
+
+  // The input of the second join that is a join itself is on the critical path, the other one can wait
+  for (const auto& task : tasks) {
+    const auto expected_priority = task == tasks[3] ? SchedulePriority::Default : SchedulePriority::High;
+    EXPECT_EQ(task->priority(), expected_priority);
+  }
+
+  // There is nothing to prioritize for a chain of tasks
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto chain = std::make_shared<Projection>(std::make_shared<GetTable>("table_a"), expression_vector(a));
+  for (const auto& task : OperatorTask::make_tasks_from_operator(chain, CleanupTemporaries::No)) {
+    EXPECT_EQ(task->priority(), SchedulePriority::Default);
+  }
+}
+
+TEST_F(OperatorTaskTest, PipelineOfNonBreakingOperators) {
+  auto gt = std::make_shared<GetTable>("table_c");
+  auto a = PQPColumnExpression::from_table(*_test_table_c, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_c, "b");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_(a, 123));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 850.0f));
+  auto projection = std::make_shared<Projection>(scan_b, expression_vector(b, a));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::Yes);
+
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_TRUE(tasks[0]->pipelined_operators().empty());
+  EXPECT_EQ(tasks[1]->get_operator(), projection);
+  const auto expected_pipeline = std::vector<std::shared_ptr<AbstractOperator>>{scan_a, scan_b, projection};
+  EXPECT_EQ(tasks[1]->pipelined_operators(), expected_pipeline);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  // The output chunks are in the order of the input chunks
+  auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Float}, {"a", DataType::Int}}, TableType::Data);
+  expected_result->append({457.7f, 12345});
+  expected_result->append({700.0f, 123456});
+  expected_result->append({456.7f, 12345});
+  expected_result->append({800.0f, 123456});
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), expected_result);
+
+  // The intermediate results are gone
+  EXPECT_EQ(gt->get_output(), nullptr);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+  EXPECT_EQ(scan_b->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, NoPipelinesWithoutCleanup) {
+  auto gt = std::make_shared<GetTable>("table_c");
+  auto a = PQPColumnExpression::from_table(*_test_table_c, "a");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_(a, 123));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(a, 100'000));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_b, CleanupTemporaries::No);
+
+  ASSERT_EQ(tasks.size(), 3u);
+  for (const auto& task : tasks) {
+    EXPECT_TRUE(task->pipelined_operators().empty());
+  }
+}
+
+TEST_F(OperatorTaskTest, PipelineEndsWithLimit) {
+  auto gt = std::make_shared<GetTable>("table_c");
+  auto a = PQPColumnExpression::from_table(*_test_table_c, "a");
+  auto scan = std::make_shared<TableScan>(gt, greater_than_(a, 123));
+  auto limit = std::make_shared<Limit>(scan, to_expression(int64_t{3}));
+  auto projection = std::make_shared<Projection>(limit, expression_vector(a));
+
+  // The Limit needs its input chunks in order, so it cannot be part of the pipeline of the Projection
+  auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::Yes);
+
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(tasks[1]->get_operator(), limit);
+  const auto expected_pipeline = std::vector<std::shared_ptr<AbstractOperator>>{scan, limit};
+  EXPECT_EQ(tasks[1]->pipelined_operators(), expected_pipeline);
+  EXPECT_TRUE(tasks[2]->pipelined_operators().empty());
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data);
+  expected_result->append({12345});
+  expected_result->append({123456});
+  expected_result->append({12345});
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), expected_result);
+}
+
+TEST_F(OperatorTaskTest, PipelineWithDataTableInBetween) {
+  // The UnionAll and the Projection output data tables, which the following operators might reference. Thus, the
+  // pipeline is executed in three stages.
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto gt_b = std::make_shared<GetTable>("table_b");
+  auto union_all = std::make_shared<UnionAll>(gt_a, gt_b);
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto projection = std::make_shared<Projection>(union_all, expression_vector(add_(a, 1)));
+  auto a_plus_one = pqp_column_(ColumnID{0}, DataType::Int, false, "a + 1");
+  auto scan = std::make_shared<TableScan>(projection, less_than_(a_plus_one, 1000));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan, CleanupTemporaries::Yes);
+
+  ASSERT_EQ(tasks.size(), 3u);
+  const auto expected_pipeline = std::vector<std::shared_ptr<AbstractOperator>>{union_all, projection, scan};
+  EXPECT_EQ(tasks[2]->pipelined_operators(), expected_pipeline);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a + 1", DataType::Int}}, TableType::Data);
+  expected_result->append({124});
+  expected_result->append({124});
+  expected_result->append({13});
+  EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_result);
+
+  EXPECT_EQ(union_all->get_output(), nullptr);
+  EXPECT_EQ(projection->get_output(), nullptr);
+}
+
 }  // namespace opossum
@@ -0,0 +1,92 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/parameterized_sql.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/prepared_plan.hpp"
+#include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/parse_server_prepared_statement_task.hpp"
+
+namespace opossum {
+
+class ServerPreparedStatementTaskTest : public BaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  std::shared_ptr<PreparedPlan> parse(const std::string& sql) {
+    const auto task = std::make_shared<ParseServerPreparedStatementTask>(sql);
+    auto future = task->get_future();
+    task->execute();
+    return future.get();
+  }
+
+  std::shared_ptr<const Table> bind_and_execute(const std::shared_ptr<PreparedPlan>& prepared_plan,
+                                                const std::vector<AllTypeVariant>& params) {
+    const auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, params);
+    auto future = task->get_future();
+    task->execute();
+    const auto pqp = future.get();
+
+    pqp->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes));
+    return pqp->get_output();
+  }
+};
+
+TEST_F(ServerPreparedStatementTaskTest, SharePreparedPlans) {
+  const auto prepared_plan = parse("SELECT * FROM table_a WHERE a > ?");
+  EXPECT_EQ(prepared_plan->sql, "SELECT * FROM table_a WHERE a > ?");
+  EXPECT_EQ(parse("SELECT * FROM table_a WHERE a > ?"), prepared_plan);
+  EXPECT_NE(parse("SELECT * FROM table_a WHERE a < ?"), prepared_plan);
+
+  // A new table of the same name evicts the prepared plan
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  EXPECT_NE(parse("SELECT * FROM table_a WHERE a > ?"), prepared_plan);
+}
+
+TEST_F(ServerPreparedStatementTaskTest, ShareOptimizedPlans) {
+  const auto sql = std::string{"SELECT * FROM table_a WHERE a > ?"};
+  const auto prepared_plan = parse(sql);
+
+  EXPECT_EQ(bind_and_execute(prepared_plan, {200})->row_count(), 2u);
+  const auto cache_key = parameterized_sql_cache_key(sql, {200});
+  const auto optimized_lqp = SQLLogicalPlanCache::get().try_get(cache_key);
+  ASSERT_TRUE(optimized_lqp);
+  ASSERT_NE(*optimized_lqp, nullptr);
+
+  // Only the values are filled into the shared LQP
+  EXPECT_EQ(bind_and_execute(prepared_plan, {2000})->row_count(), 1u);
+  EXPECT_EQ(SQLLogicalPlanCache::get().try_get(cache_key), optimized_lqp);
+
+  // A value of another type needs a plan of its own
+  EXPECT_EQ(bind_and_execute(prepared_plan, {int64_t{100}})->row_count(), 3u);
+  EXPECT_TRUE(SQLLogicalPlanCache::get().has(parameterized_sql_cache_key(sql, {int64_t{100}})));
+}
+
+TEST_F(ServerPreparedStatementTaskTest, PlansWithoutPlaceholders) {
+  const auto prepared_plan = parse("SELECT * FROM table_a");
+  EXPECT_EQ(bind_and_execute(prepared_plan, {})->row_count(), 3u);
+  EXPECT_TRUE(SQLLogicalPlanCache::get().has("SELECT * FROM table_a"));
+
+  // The prepared plan itself is not optimized
+  EXPECT_EQ(prepared_plan->instantiate({}), prepared_plan->lqp);
+  EXPECT_EQ(bind_and_execute(prepared_plan, {})->row_count(), 3u);
+}
+
+TEST_F(ServerPreparedStatementTaskTest, PlansWithoutSQL) {
+  const auto prepared_plan = std::make_shared<PreparedPlan>(parse("SELECT * FROM table_a WHERE a > ?")->lqp,
+                                                            std::vector<ParameterID>{ParameterID{0}});
+  EXPECT_EQ(bind_and_execute(prepared_plan, {200})->row_count(), 2u);
+  EXPECT_FALSE(SQLLogicalPlanCache::get().has(parameterized_sql_cache_key("SELECT * FROM table_a WHERE a > ?", {200})));
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+
+#include "utils/date_utils.hpp"
+
+namespace opossum {
+
+TEST(DateUtilsTest, ParseDate) {
+  EXPECT_EQ(parse_date("1970-01-01"), 0);
+  EXPECT_EQ(parse_date("1970-01-02"), 1);
+  EXPECT_EQ(parse_date("1969-12-31"), -1);
+  EXPECT_EQ(parse_date("1992-09-30"), 8'308);
+  EXPECT_EQ(parse_date("1960-02-29"), -3'594);
+
+  EXPECT_EQ(parse_date("1999-02-29"), std::nullopt);
+  EXPECT_EQ(parse_date("1999-04-31"), std::nullopt);
+  EXPECT_EQ(parse_date("1999-13-01"), std::nullopt);
+  EXPECT_EQ(parse_date("1999-00-01"), std::nullopt);
+  EXPECT_EQ(parse_date("1999-1-01"), std::nullopt);
+  EXPECT_EQ(parse_date("1999/01/01"), std::nullopt);
+  EXPECT_EQ(parse_date("1999-01-01 00:00:00"), std::nullopt);
+}
+
+TEST(DateUtilsTest, ParseTimestamp) {
+  EXPECT_EQ(parse_timestamp("1970-01-01 00:01:05"), 65);
+  EXPECT_EQ(parse_timestamp("1969-12-31 23:59:58"), -2);
+  EXPECT_EQ(parse_timestamp("1998-12-01 13:45:07"), 912'519'907);
+  EXPECT_EQ(parse_timestamp("1998-12-01"), int64_t{10'561} * SECONDS_PER_DAY);
+
+  EXPECT_EQ(parse_timestamp("1998-12-01 24:00:00"), std::nullopt);
+  EXPECT_EQ(parse_timestamp("1998-12-01T13:45:07"), std::nullopt);
+  EXPECT_EQ(parse_timestamp("1998-12-32 13:45:07"), std::nullopt);
+}
+
+TEST(DateUtilsTest, RoundTrip) {
+  EXPECT_EQ(date_to_string(0), "1970-01-01");
+  EXPECT_EQ(date_to_string(-3'594), "1960-02-29");
+
+  for (auto days = -200'000; days < 200'000; days += 7) {
+    const auto date = civil_from_days(days);
+    ASSERT_EQ(days_from_civil(date), days);
+    ASSERT_EQ(parse_date(date_to_string(days)), days);
+  }
+}
+
+}  // namespace opossum
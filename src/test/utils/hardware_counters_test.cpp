@@ -0,0 +1,90 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class HardwareCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { HardwareCounters::set_enabled(false); }
+};
+
+TEST_F(HardwareCountersTest, Arithmetic) {
+  auto counters = HardwareCounters{100, 250, 3, 4};
+  counters += HardwareCounters{100, 150, 1, 1};
+  EXPECT_EQ(counters, (HardwareCounters{200, 400, 4, 5}));
+  EXPECT_EQ((counters - HardwareCounters{50, 100, 1, 2}), (HardwareCounters{150, 300, 3, 3}));
+  EXPECT_DOUBLE_EQ(counters.instructions_per_cycle(), 2.0);
+  EXPECT_DOUBLE_EQ(HardwareCounters{}.instructions_per_cycle(), 0.0);
+
+  EXPECT_EQ(counters.to_string(), "200 cycles, 400 instructions (2.00 IPC), 4 LLC misses, 5 branch misses");
+}
+
+TEST_F(HardwareCountersTest, CollectorSumsUpCounters) {
+  auto collector = HardwareCounterCollector{};
+  collector.add(HardwareCounters{1, 2, 3, 4});
+  collector.add(HardwareCounters{10, 20, 30, 40});
+  EXPECT_EQ(collector.counters(), (HardwareCounters{11, 22, 33, 44}));
+}
+
+TEST_F(HardwareCountersTest, ScopesDoNothingWhenDisabled) {
+  const auto collector = std::make_shared<HardwareCounterCollector>();
+  {
+    const auto scope = HardwareCounterScope{collector};
+    EXPECT_EQ(HardwareCounterScope::current_collector(), collector);
+  }
+  EXPECT_EQ(HardwareCounterScope::current_collector(), nullptr);
+  EXPECT_EQ(collector->counters(), HardwareCounters{});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl"));
+  table_wrapper->execute();
+  EXPECT_FALSE(table_wrapper->performance_data().hardware_counters);
+}
+
+TEST_F(HardwareCountersTest, NestedScopesCountExclusively) {
+  HardwareCounters::set_enabled(true);
+  if (!HardwareCounters::available()) GTEST_SKIP();
+
+  const auto outer_collector = std::make_shared<HardwareCounterCollector>();
+  const auto inner_collector = std::make_shared<HardwareCounterCollector>();
+  auto sum = uint64_t{0};
+  {
+    const auto outer_scope = HardwareCounterScope{outer_collector};
+    {
+      const auto inner_scope = HardwareCounterScope{inner_collector};
+      EXPECT_EQ(HardwareCounterScope::current_collector(), inner_collector);
+      for (auto i = uint64_t{0}; i < 100'000; ++i) sum += i * i;
+    }
+    EXPECT_EQ(HardwareCounterScope::current_collector(), outer_collector);
+  }
+  EXPECT_GT(sum, 0u);
+
+  const auto inner_counters = inner_collector->counters();
+  EXPECT_GT(inner_counters.instructions, 100'000u);
+  EXPECT_GT(inner_counters.cycles, 0u);
+
+  // The loop was counted only for the inner scope
+  EXPECT_LT(outer_collector->counters().instructions, inner_counters.instructions);
+}
+
+TEST_F(HardwareCountersTest, OperatorPerformanceData) {
+  HardwareCounters::set_enabled(true);
+  if (!HardwareCounters::available()) GTEST_SKIP();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl"));
+  table_wrapper->execute();
+  const auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+  sort->execute();
+
+  const auto& performance_data = sort->performance_data();
+  ASSERT_TRUE(performance_data.hardware_counters);
+  EXPECT_GT(performance_data.hardware_counters->instructions, 0u);
+  EXPECT_NE(performance_data.to_string().find("instructions"), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#include <memory>
+#include <numeric>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/huge_page_memory_resource.hpp"
+#include "utils/query_memory_resource.hpp"
+#include "utils/tracking_memory_resource.hpp"
+
+namespace opossum {
+
+class HugePageMemoryResourceTest : public BaseTest {};
+
+TEST_F(HugePageMemoryResourceTest, ForwardsSmallAllocations) {
+  auto upstream = TrackingMemoryResource{};
+  auto memory_resource = HugePageMemoryResource{1'024, &upstream};
+  EXPECT_EQ(memory_resource.threshold(), 1'024u);
+
+  auto* pointer = memory_resource.allocate(1'023, 8);
+  EXPECT_EQ(upstream.allocated_bytes(), 1'023u);
+  EXPECT_EQ(memory_resource.upstream_allocations(), 1u);
+  EXPECT_EQ(memory_resource.huge_page_allocations() + memory_resource.transparent_huge_page_allocations(), 0u);
+
+  memory_resource.deallocate(pointer, 1'023, 8);
+  EXPECT_EQ(upstream.allocated_bytes(), 0u);
+}
+
+TEST_F(HugePageMemoryResourceTest, MapsLargeAllocations) {
+  auto upstream = TrackingMemoryResource{};
+  auto memory_resource = HugePageMemoryResource{HugePageMemoryResource::HUGE_PAGE_SIZE, &upstream};
+
+  {
+    // Whether the OS has reserved huge pages differs between machines, either way the memory has to be usable
+    auto values = pmr_vector<int64_t>(1'000'000, PolymorphicAllocator<int64_t>{&memory_resource});
+    std::iota(values.begin(), values.end(), 0);
+    EXPECT_EQ(values[999'999], 999'999);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % alignof(int64_t), 0u);
+  }
+
+  EXPECT_EQ(memory_resource.huge_page_allocations() + memory_resource.transparent_huge_page_allocations(), 1u);
+  EXPECT_EQ(memory_resource.upstream_allocations(), 0u);
+  EXPECT_EQ(upstream.peak_allocated_bytes(), 0u);
+}
+
+TEST_F(HugePageMemoryResourceTest, BacksSegments) {
+  auto memory_resource = HugePageMemoryResource{1'024};
+
+  auto values = pmr_concurrent_vector<int32_t>(10'000);
+  std::iota(values.begin(), values.end(), 0);
+  const auto chunk = std::make_shared<Chunk>(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+  chunk->migrate(&memory_resource);
+
+  EXPECT_GE(memory_resource.huge_page_allocations() + memory_resource.transparent_huge_page_allocations(), 1u);
+  EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[9'999], AllTypeVariant{9'999});
+}
+
+TEST_F(HugePageMemoryResourceTest, BacksQueryMemorySlabs) {
+  auto memory_resource = HugePageMemoryResource{};
+  QueryMemoryResource::set_slab_memory_resource(&memory_resource);
+
+  {
+    auto query_memory_resource = QueryMemoryResource{};
+    EXPECT_EQ(QueryMemoryResource::slab_memory_resource(), &memory_resource);
+
+    // Large allocations get a slab of their own, which is backed by huge pages
+    query_memory_resource.allocate(HugePageMemoryResource::HUGE_PAGE_SIZE, 8);
+    query_memory_resource.allocate(16, 8);
+    EXPECT_EQ(memory_resource.huge_page_allocations() + memory_resource.transparent_huge_page_allocations(), 1u);
+    EXPECT_EQ(memory_resource.upstream_allocations(), 1u);
+  }
+
+  QueryMemoryResource::set_slab_memory_resource(nullptr);
+  EXPECT_NE(QueryMemoryResource::slab_memory_resource(), &memory_resource);
+}
+
+}  // namespace opossum
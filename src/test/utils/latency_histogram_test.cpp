@@ -0,0 +1,79 @@
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/latency_histogram.hpp"
+
+namespace opossum {
+
+class LatencyHistogramTest : public BaseTest {};
+
+TEST_F(LatencyHistogramTest, Empty) {
+  const auto histogram = LatencyHistogram{};
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.min().count(), 0);
+  EXPECT_EQ(histogram.max().count(), 0);
+  EXPECT_EQ(histogram.mean().count(), 0);
+  EXPECT_EQ(histogram.percentile(99.0).count(), 0);
+}
+
+TEST_F(LatencyHistogramTest, SmallLatenciesAreExact) {
+  auto histogram = LatencyHistogram{};
+  for (auto latency = 1; latency <= 1000; ++latency) {
+    histogram.record(std::chrono::nanoseconds{latency});
+  }
+
+  EXPECT_EQ(histogram.count(), 1000u);
+  EXPECT_EQ(histogram.min().count(), 1);
+  EXPECT_EQ(histogram.max().count(), 1000);
+  EXPECT_EQ(histogram.mean().count(), 500);
+  EXPECT_EQ(histogram.percentile(0.0).count(), 1);
+  EXPECT_EQ(histogram.percentile(50.0).count(), 500);
+  EXPECT_EQ(histogram.percentile(99.0).count(), 990);
+  EXPECT_EQ(histogram.percentile(100.0).count(), 1000);
+  EXPECT_THROW(histogram.percentile(100.1), std::exception);
+}
+
+TEST_F(LatencyHistogramTest, LargeLatenciesAreAccurateToThreeDigits) {
+  auto histogram = LatencyHistogram{};
+  for (auto latency = 1; latency <= 10'000; ++latency) {
+    histogram.record(std::chrono::microseconds{latency});
+  }
+
+  for (const auto percentile : {50.0, 90.0, 99.0, 99.9}) {
+    const auto expected = percentile * 100.0 * 1000.0;
+    const auto actual = static_cast<double>(histogram.percentile(percentile).count());
+    EXPECT_GE(actual, expected);
+    EXPECT_LE(actual, expected * 1.001);
+  }
+  EXPECT_EQ(histogram.percentile(100.0), std::chrono::milliseconds{10});
+
+  // Latencies beyond the trackable range count as the largest one
+  histogram.record(LatencyHistogram::MAX_TRACKABLE_LATENCY * 2);
+  EXPECT_EQ(histogram.max(), LatencyHistogram::MAX_TRACKABLE_LATENCY);
+}
+
+TEST_F(LatencyHistogramTest, ConcurrentRecordingAndMove) {
+  auto histogram = LatencyHistogram{};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 4; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto latency = 1; latency <= 1000; ++latency) {
+        histogram.record(std::chrono::milliseconds{latency});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  const auto moved_histogram = LatencyHistogram{std::move(histogram)};
+  EXPECT_EQ(moved_histogram.count(), 4000u);
+  EXPECT_EQ(moved_histogram.min(), std::chrono::milliseconds{1});
+  EXPECT_EQ(moved_histogram.max(), std::chrono::milliseconds{1000});
+}
+
+}  // namespace opossum
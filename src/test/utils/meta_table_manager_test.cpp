@@ -0,0 +1,98 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/meta_table_manager.hpp"
+
+namespace opossum {
+
+class MetaTableManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // int_float has three rows, i.e., two chunks of up to two rows, the first one of which is encoded
+    const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {EncodingType::Dictionary});
+    StorageManager::get().add_table("int_float", table);
+  }
+
+  std::shared_ptr<const Table> execute(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+};
+
+TEST_F(MetaTableManagerTest, TableNames) {
+  EXPECT_TRUE(MetaTableManager::is_meta_table_name("meta_tables"));
+  EXPECT_TRUE(MetaTableManager::is_meta_table_name("meta_unknown"));
+  EXPECT_FALSE(MetaTableManager::is_meta_table_name("int_float"));
+
+  for (const auto& table_name : MetaTableManager::table_names()) {
+    EXPECT_TRUE(MetaTableManager::has_table(table_name));
+    EXPECT_TRUE(StorageManager::get().has_table(table_name));
+  }
+  EXPECT_FALSE(MetaTableManager::has_table("meta_unknown"));
+  EXPECT_THROW(MetaTableManager::generate_table("meta_unknown"), std::exception);
+
+  // Meta tables are not stored, and their names are reserved
+  EXPECT_EQ(StorageManager::get().table_names(), std::vector<std::string>{"int_float"});
+  EXPECT_THROW(StorageManager::get().add_table("meta_tables", load_table("resources/test_data/tbl/int_float.tbl")),
+               std::exception);
+}
+
+TEST_F(MetaTableManagerTest, Tables) {
+  const auto table = execute("SELECT table_name, column_count, row_count, chunk_count FROM meta_tables");
+  ASSERT_EQ(table->row_count(), 1u);
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{0}, 0), "int_float");
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{2}, 0), 3);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{3}, 0), 2);
+
+  const auto columns = execute("SELECT column_name, data_type FROM meta_columns WHERE table_name = 'int_float'");
+  ASSERT_EQ(columns->row_count(), 2u);
+  EXPECT_EQ(columns->get_value<std::string>(ColumnID{0}, 1), "b");
+  EXPECT_EQ(columns->get_value<std::string>(ColumnID{1}, 1), "float");
+}
+
+TEST_F(MetaTableManagerTest, ChunksAndSegments) {
+  const auto chunks = execute("SELECT chunk_id, row_count, estimated_size_bytes FROM meta_chunks ORDER BY chunk_id");
+  ASSERT_EQ(chunks->row_count(), 2u);
+  EXPECT_EQ(chunks->get_value<int64_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(chunks->get_value<int64_t>(ColumnID{1}, 1), 1);
+  EXPECT_GT(chunks->get_value<int64_t>(ColumnID{2}, 0), 0);
+
+  const auto segments = execute(
+      "SELECT encoding_type, COUNT(*) FROM meta_segments WHERE table_name = 'int_float' GROUP BY encoding_type "
+      "ORDER BY encoding_type");
+  ASSERT_EQ(segments->row_count(), 2u);
+  EXPECT_EQ(segments->get_value<std::string>(ColumnID{0}, 0), "Dictionary");
+  EXPECT_EQ(segments->get_value<int64_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(segments->get_value<std::string>(ColumnID{0}, 1), "Unencoded");
+  EXPECT_EQ(segments->get_value<int64_t>(ColumnID{1}, 1), 2);
+}
+
+TEST_F(MetaTableManagerTest, ReadsCurrentState) {
+  const auto sql = std::string{"SELECT row_count FROM meta_tables WHERE table_name = 'int_float'"};
+  EXPECT_EQ(execute(sql)->get_value<int64_t>(ColumnID{0}, 0), 3);
+
+  // The cached plan reads the meta table again
+  execute("INSERT INTO int_float VALUES (1, 2.0)");
+  EXPECT_EQ(execute(sql)->get_value<int64_t>(ColumnID{0}, 0), 4);
+}
+
+TEST_F(MetaTableManagerTest, PlanCache) {
+  const auto hit_count = [&]() {
+    const auto table = execute("SELECT hit_count FROM meta_plan_cache WHERE cache_name = 'physical'");
+    return table->get_value<int64_t>(ColumnID{0}, 0);
+  };
+
+  const auto hit_count_before = hit_count();
+  execute("SELECT * FROM int_float");
+  execute("SELECT * FROM int_float");
+  EXPECT_GT(hit_count(), hit_count_before);
+}
+
+}  // namespace opossum
@@ -1,6 +1,15 @@
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "logical_query_plan/dummy_table_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "optimizer/optimizer.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/plugin_manager.hpp"
 
@@ -71,6 +80,70 @@ TEST_F(PluginManagerTest, LoadPluginAutomaticUnload) {
   EXPECT_FALSE(sm.has_table("DummyTable"));
 }
 
+TEST_F(PluginManagerTest, PluginExtensions) {
+  auto& sm = StorageManager::get();
+  auto& pm = PluginManager::get();
+
+  const auto rule_names = [&]() {
+    auto durations = OptimizerRuleDurations{};
+    Optimizer::create_default_optimizer()->optimize(DummyTableNode::make(), &durations);
+
+    auto names = std::vector<std::string>{};
+    for (const auto& [name, duration] : durations) {
+      names.emplace_back(name);
+    }
+    return names;
+  };
+  const auto translate_dummy_table_node = [&]() {
+    const auto pqp = LQPTranslator{}.translate_node(DummyTableNode::make());
+    pqp->execute();
+    return pqp->get_output();
+  };
+
+  const auto default_rule_names = rule_names();
+  pm.load_plugin(build_dylib_path("libTestPlugin"));
+
+  // The test plugin adds a rule before the ColumnPruningRule
+  EXPECT_EQ(pm.optimizer_rules().size(), 1u);
+  const auto plugin_rule_names = rule_names();
+  ASSERT_EQ(plugin_rule_names.size(), default_rule_names.size() + 1);
+  const auto plugin_rule_iter = std::find(plugin_rule_names.begin(), plugin_rule_names.end(), "TestPluginRule");
+  ASSERT_NE(plugin_rule_iter, plugin_rule_names.end());
+  EXPECT_EQ(*(plugin_rule_iter + 1), "ColumnPruningRule");
+
+  // The test plugin translates DummyTableNodes to its DummyTable
+  EXPECT_EQ(pm.lqp_translator_overrides(LQPNodeType::DummyTable).size(), 1u);
+  EXPECT_TRUE(pm.lqp_translator_overrides(LQPNodeType::Predicate).empty());
+  EXPECT_EQ(translate_dummy_table_node(), sm.get_table("DummyTable"));
+
+  // The maintenance task of the test plugin adds the DummyMaintenanceTable
+  EXPECT_EQ(pm.maintenance_task_names(), std::vector<std::string>{"TestPluginMaintenance"});
+  for (auto wait_count = 0; wait_count < 1'000 && !sm.has_table("DummyMaintenanceTable"); ++wait_count) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_TRUE(sm.has_table("DummyMaintenanceTable"));
+
+  pm.unload_plugin("TestPlugin");
+
+  EXPECT_TRUE(pm.optimizer_rules().empty());
+  EXPECT_EQ(rule_names(), default_rule_names);
+  EXPECT_TRUE(pm.lqp_translator_overrides(LQPNodeType::DummyTable).empty());
+  EXPECT_EQ(translate_dummy_table_node()->row_count(), 1u);
+  EXPECT_TRUE(pm.maintenance_task_names().empty());
+  EXPECT_FALSE(sm.has_table("DummyMaintenanceTable"));
+}
+
+TEST_F(PluginManagerTest, ExtensionsCanOnlyBeAddedByStartingPlugins) {
+  auto& pm = PluginManager::get();
+
+  const auto lqp_translator_override = [](const std::shared_ptr<AbstractLQPNode>& node,
+                                          const LQPTranslator& translator) { return nullptr; };
+  EXPECT_THROW(pm.add_lqp_translator_override(LQPNodeType::DummyTable, lqp_translator_override), std::exception);
+  EXPECT_THROW(pm.add_maintenance_task("Maintenance", std::chrono::milliseconds{10}, [](const size_t) {}),
+               std::exception);
+  EXPECT_TRUE(pm.maintenance_task_names().empty());
+}
+
 TEST_F(PluginManagerTest, LoadingSameName) {
   auto& pm = PluginManager::get();
   auto& plugins = get_plugins();
@@ -0,0 +1,57 @@
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
+#include "utils/prefixed_string.hpp"
+
+namespace opossum {
+
+class PrefixedStringTest : public BaseTest {
+ protected:
+  PrefixedString make(const std::string& string) { return PrefixedString{string, _arena}; }
+
+  boost::container::pmr::monotonic_buffer_resource _arena;
+};
+
+TEST_F(PrefixedStringTest, StoresShortAndLongStrings) {
+  EXPECT_EQ(std::string_view{PrefixedString{}}, "");
+  EXPECT_EQ(std::string_view{make("")}, "");
+  EXPECT_EQ(std::string_view{make("abc")}, "abc");
+  EXPECT_EQ(std::string_view{make("Hello World!")}, "Hello World!");
+  EXPECT_EQ(std::string_view{make("Hello World, how are you?")}, "Hello World, how are you?");
+  EXPECT_EQ(make("Hello World, how are you?").size(), 25u);
+
+  const auto with_null = std::string{"a\0b", 3};
+  EXPECT_EQ(std::string_view{make(with_null)}, with_null);
+}
+
+TEST_F(PrefixedStringTest, ComparesLikeStrings) {
+  const auto strings = std::vector<std::string>{"",
+                                                "a",
+                                                std::string{"a\0", 2},
+                                                "ab",
+                                                "abc",
+                                                "abcd",
+                                                "abcde",
+                                                "abcdefghijkl",
+                                                "abcdefghijklm",
+                                                "abcdefghijklmn",
+                                                "abcdefghijklmo",
+                                                "abcz",
+                                                "b",
+                                                "\xff",
+                                                "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff"};
+
+  for (const auto& lhs : strings) {
+    for (const auto& rhs : strings) {
+      const auto prefixed_lhs = make(lhs);
+      const auto prefixed_rhs = make(rhs);
+      EXPECT_EQ(prefixed_lhs == prefixed_rhs, lhs == rhs) << lhs << " == " << rhs;
+      EXPECT_EQ(prefixed_lhs < prefixed_rhs, lhs < rhs) << lhs << " < " << rhs;
+      EXPECT_EQ(prefixed_lhs > prefixed_rhs, lhs > rhs) << lhs << " > " << rhs;
+    }
+  }
+}
+
+}  // namespace opossum
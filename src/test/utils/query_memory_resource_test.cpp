@@ -0,0 +1,111 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/query_memory_resource.hpp"
+
+namespace opossum {
+
+class QueryMemoryResourceTest : public BaseTest {};
+
+TEST_F(QueryMemoryResourceTest, SmallAllocationsShareASlab) {
+  auto memory_resource = QueryMemoryResource{};
+
+  auto* first = memory_resource.allocate(sizeof(int32_t), alignof(int32_t));
+  auto* second = memory_resource.allocate(sizeof(double), alignof(double));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(double), 0u);
+  EXPECT_LT(reinterpret_cast<std::byte*>(first), reinterpret_cast<std::byte*>(second));
+  EXPECT_EQ(memory_resource.allocated_bytes(), QueryMemoryResource::SLAB_SIZE);
+
+  // Large allocations get slabs of their own
+  memory_resource.allocate(QueryMemoryResource::SLAB_SIZE, alignof(double));
+  EXPECT_GT(memory_resource.allocated_bytes(), 2 * QueryMemoryResource::SLAB_SIZE);
+
+  // A full slab is replaced by a new one
+  for (auto allocation_idx = size_t{0}; allocation_idx < 8; ++allocation_idx) {
+    memory_resource.allocate(QueryMemoryResource::SLAB_SIZE / 8, alignof(double));
+  }
+  EXPECT_GT(memory_resource.allocated_bytes(), 3 * QueryMemoryResource::SLAB_SIZE);
+}
+
+TEST_F(QueryMemoryResourceTest, ThreadsUseTheirOwnSlabs) {
+  auto memory_resource = QueryMemoryResource{};
+  const auto allocator = PolymorphicAllocator<size_t>{&memory_resource};
+
+  // Copies of a pmr_vector use the default resource, so the vectors are constructed with the allocator in place
+  auto vectors = std::vector<pmr_vector<size_t>>{};
+  vectors.reserve(4);
+  for (auto thread_idx = size_t{0}; thread_idx < 4; ++thread_idx) {
+    vectors.emplace_back(allocator);
+  }
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = size_t{0}; thread_idx < vectors.size(); ++thread_idx) {
+    threads.emplace_back([&, thread_idx]() {
+      auto& vector = vectors[thread_idx];
+      for (auto value = size_t{0}; value < 1'000; ++value) {
+        vector.emplace_back(thread_idx * value);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto thread_idx = size_t{0}; thread_idx < vectors.size(); ++thread_idx) {
+    ASSERT_EQ(vectors[thread_idx].size(), 1'000u);
+    EXPECT_EQ(vectors[thread_idx][999], thread_idx * 999);
+  }
+  EXPECT_EQ(memory_resource.allocated_bytes(), vectors.size() * QueryMemoryResource::SLAB_SIZE);
+}
+
+TEST_F(QueryMemoryResourceTest, ResourcesDoNotShareSlabs) {
+  auto first_memory_resource = std::make_unique<QueryMemoryResource>();
+  first_memory_resource->allocate(16, 8);
+  first_memory_resource.reset();
+
+  // The thread's cursor of the destroyed resource is not used
+  auto second_memory_resource = QueryMemoryResource{};
+  second_memory_resource.allocate(16, 8);
+  EXPECT_EQ(second_memory_resource.allocated_bytes(), QueryMemoryResource::SLAB_SIZE);
+}
+
+TEST_F(QueryMemoryResourceTest, BudgetIsEnforced) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto memory_resource = QueryMemoryResource{2 * QueryMemoryResource::SLAB_SIZE};
+  memory_resource.set_cancellation_token(cancellation_token);
+
+  memory_resource.allocate(16, 8);
+  EXPECT_FALSE(memory_resource.budget_exceeded_message());
+
+  EXPECT_THROW(memory_resource.allocate(2 * QueryMemoryResource::SLAB_SIZE, 8), MemoryBudgetExceededException);
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  EXPECT_EQ(memory_resource.budget_exceeded_message(),
+            "out of memory: the statement exceeds its memory budget of 2.097MB");
+  EXPECT_EQ(memory_resource.allocated_bytes(), QueryMemoryResource::SLAB_SIZE);
+}
+
+TEST_F(QueryMemoryResourceTest, GlobalBudgetIsEnforced) {
+  auto first_memory_resource = QueryMemoryResource{};
+  first_memory_resource.allocate(16, 8);
+
+  const auto global_allocated_bytes = QueryMemoryResource::global_allocated_bytes();
+  EXPECT_GE(global_allocated_bytes, QueryMemoryResource::SLAB_SIZE);
+  QueryMemoryResource::set_global_budget(global_allocated_bytes + QueryMemoryResource::SLAB_SIZE);
+
+  // The budget of all resources together is exceeded, even though neither of them has a budget of its own
+  auto second_memory_resource = QueryMemoryResource{};
+  second_memory_resource.allocate(16, 8);
+  EXPECT_THROW(second_memory_resource.allocate(QueryMemoryResource::SLAB_SIZE, 8), MemoryBudgetExceededException);
+  EXPECT_THROW(first_memory_resource.allocate(QueryMemoryResource::SLAB_SIZE, 8), MemoryBudgetExceededException);
+  EXPECT_EQ(QueryMemoryResource::global_allocated_bytes(), global_allocated_bytes + QueryMemoryResource::SLAB_SIZE);
+
+  QueryMemoryResource::set_global_budget(0);
+  second_memory_resource.allocate(QueryMemoryResource::SLAB_SIZE, 8);
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include <array>
+#include <numeric>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/temp_file_manager.hpp"
+
+namespace opossum {
+
+class TempFileManagerTest : public BaseTest {};
+
+TEST_F(TempFileManagerTest, WritesAndReadsFiles) {
+  auto& temp_file_manager = TempFileManager::get();
+  const auto written_bytes = temp_file_manager.written_bytes();
+
+  auto file = temp_file_manager.create_file();
+  auto values = std::array<int32_t, 100>{};
+  std::iota(values.begin(), values.end(), 0);
+  file->write(values.data(), sizeof(values));
+  file->write("spill", 5);
+
+  EXPECT_EQ(file->size(), sizeof(values) + 5);
+  EXPECT_EQ(temp_file_manager.written_bytes(), written_bytes + sizeof(values) + 5);
+
+  auto read_values = std::array<int32_t, 10>{};
+  file->read(20 * sizeof(int32_t), read_values.data(), sizeof(read_values));
+  EXPECT_EQ(read_values.front(), 20);
+  EXPECT_EQ(read_values.back(), 29);
+
+  auto read_string = std::string(5, '\0');
+  file->read(sizeof(values), read_string.data(), 5);
+  EXPECT_EQ(read_string, "spill");
+
+  // Reading beyond the written bytes fails
+  if (!HYRISE_DEBUG) return;
+  EXPECT_THROW(file->read(sizeof(values), read_string.data(), 6), std::logic_error);
+}
+
+TEST_F(TempFileManagerTest, WritesAndReadsValuesThroughBuffers) {
+  auto file = TempFileManager::get().create_file();
+
+  // The buffers are smaller than some of the values
+  auto writer = TempFileWriter{*file, 4};
+  writer.write(RowID{ChunkID{1}, ChunkOffset{2}});
+  writer.write(std::string{"a longer string"});
+  writer.write(std::string{});
+  writer.write(3.5);
+  writer.flush();
+
+  auto reader = TempFileReader{*file, 0, file->size(), 3};
+  auto row_id = RowID{};
+  auto long_string = std::string{};
+  auto empty_string = std::string{"overwritten"};
+  auto value = 0.0;
+  reader.read(row_id);
+  reader.read(long_string);
+  reader.read(empty_string);
+  EXPECT_FALSE(reader.at_end());
+  reader.read(value);
+  EXPECT_TRUE(reader.at_end());
+
+  EXPECT_EQ(row_id, (RowID{ChunkID{1}, ChunkOffset{2}}));
+  EXPECT_EQ(long_string, "a longer string");
+  EXPECT_EQ(empty_string, "");
+  EXPECT_EQ(value, 3.5);
+}
+
+TEST_F(TempFileManagerTest, FilesAreUnlinked) {
+  auto& temp_file_manager = TempFileManager::get();
+  const auto directory = temp_file_manager.directory();
+  const auto count_files = [&]() {
+    return std::distance(filesystem::directory_iterator(directory), filesystem::directory_iterator{});
+  };
+
+  const auto file_count = count_files();
+  const auto file = temp_file_manager.create_file();
+  EXPECT_EQ(count_files(), file_count);
+}
+
+TEST_F(TempFileManagerTest, SetDirectory) {
+  auto& temp_file_manager = TempFileManager::get();
+  const auto directory = temp_file_manager.directory();
+
+  EXPECT_THROW(temp_file_manager.set_directory("/this/directory/does/not/exist"), std::logic_error);
+  EXPECT_EQ(temp_file_manager.directory(), directory);
+
+  temp_file_manager.set_directory(".");
+  EXPECT_EQ(temp_file_manager.directory(), filesystem::path{"."});
+  temp_file_manager.create_file()->write("x", 1);
+
+  temp_file_manager.set_directory(directory);
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/query_memory_resource.hpp"
+#include "utils/tracking_memory_resource.hpp"
+
+namespace opossum {
+
+class TrackingMemoryResourceTest : public BaseTest {};
+
+TEST_F(TrackingMemoryResourceTest, TracksAllocatedAndPeakBytes) {
+  auto memory_resource = TrackingMemoryResource{};
+
+  auto* first = memory_resource.allocate(100, 8);
+  auto* second = memory_resource.allocate(50, 8);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 150u);
+
+  memory_resource.deallocate(first, 100, 8);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 50u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 150u);
+
+  {
+    auto vector = pmr_vector<int32_t>(10, PolymorphicAllocator<int32_t>{&memory_resource});
+    EXPECT_EQ(memory_resource.allocated_bytes(), 50u + 10 * sizeof(int32_t));
+  }
+
+  memory_resource.deallocate(second, 50, 8);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 150u);
+}
+
+TEST_F(TrackingMemoryResourceTest, FailedAllocationsAreNotTracked) {
+  auto query_memory_resource = QueryMemoryResource{1};
+  auto memory_resource = TrackingMemoryResource{&query_memory_resource};
+  EXPECT_EQ(memory_resource.upstream(), &query_memory_resource);
+
+  EXPECT_THROW(memory_resource.allocate(16, 8), MemoryBudgetExceededException);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 0u);
+}
+
+}  // namespace opossum
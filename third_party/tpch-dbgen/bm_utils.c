@@ -119,7 +119,8 @@ char     *getenv PROTO((const char *name));
 #endif
 void usage();
 long *permute_dist(distribution *d, long stream);
-extern seed_t Seed[];
+void permute(long *set, int cnt, long stream);
+extern __thread seed_t Seed[];
 
 /*
  * env_config: look for a environmental variable setting and return its
@@ -447,14 +448,20 @@ agg_str(distribution *set, long count, long col, char *dest)
 {
 	distribution *d;
 	int i;
+	/**
+	 * HYRISE: The permutation is not kept in the distribution, as several threads permute it at once.
+	 */
+	long permutation[DIST_SIZE(set)];
 
 	d = set;
 	*dest = '\0';
 
-	permute_dist(d, col);
+	for (i=0; i < DIST_SIZE(d); i++)
+		permutation[i] = i;
+	permute(permutation, DIST_SIZE(d), col);
 	for (i=0; i < count; i++)
 		{
-		strcat(dest, DIST_MEMBER(set,DIST_PERMUTE(d, i)));
+		strcat(dest, DIST_MEMBER(set,permutation[i]));
 		strcat(dest, " ");
 		}
 	*(dest + (int)strlen(dest) - 1) = '\0';
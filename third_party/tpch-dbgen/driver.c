@@ -114,7 +114,7 @@ double flt_scale;
 char *spawn_args[25];
 #endif
 #ifdef RNG_TEST
-extern seed_t Seed[];
+extern __thread seed_t Seed[];
 #endif
 static int bTableSet = 0;
 
@@ -82,7 +82,7 @@ void	permute(long *set, int cnt, long stream);
 void	permute_dist(distribution *d, long stream);
 long seed;
 char *eol[2] = {" ", "},"};
-extern seed_t Seed[];
+extern __thread seed_t Seed[];
 #ifdef TEST
 tdef tdefs = { NULL };
 #endif
@@ -95,8 +95,11 @@ tdef tdefs = { NULL };
 void	permute(long *a, int c, long s)
 {
     int i;
-    static DSS_HUGE source;
-    static long *set, temp;
+    /**
+     * HYRISE: not static, as several threads permute at once
+     */
+    DSS_HUGE source;
+    long temp;
     
 	if (a != (long *)NULL)
 	{
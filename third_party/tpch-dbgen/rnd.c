@@ -236,7 +236,11 @@ UnifInt(DSS_HUGE nLow, DSS_HUGE nHigh, long nStream)
     return (nLow + nTemp);
 }
 
-seed_t Seed[MAX_STREAM + 1] =
+/**
+ * HYRISE: The seeds are thread-local, so that several threads can generate the rows of the tables at once, each
+ * starting at its first row by dbgen_skip_rows().
+ */
+__thread seed_t Seed[MAX_STREAM + 1] =
 {
 {PART,   1,          0,	1},					/* P_MFG_SD     0 */
 {PART,   46831694,   0, 1},					/* P_BRND_SD    1 */
@@ -62,7 +62,7 @@
 	advanceStream(stream_id, num_calls, 1)
 #define MAX_COLOR 92
 long name_bits[MAX_COLOR / BITS_PER_LONG];
-extern seed_t Seed[];
+extern __thread seed_t Seed[];
 void fakeVStr(int nAvg, long nSeed, DSS_HUGE nCount);
 void NthElement (DSS_HUGE N, DSS_HUGE *StartSeed);
 
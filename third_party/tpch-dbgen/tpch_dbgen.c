@@ -809,4 +809,15 @@ void dbgen_reset_seeds() {
   Seed[45] = mk_seed(SUPP,   753643799,  0, 1);      /* BBB type     45 */
   Seed[46] = mk_seed(SUPP,   202794285,  0, 1);      /* BBB comment  46 */
   Seed[47] = mk_seed(SUPP,   715851524,  0, 1);       /* BBB junk     47 */
-}
\ No newline at end of file
+}
+void NthElement(DSS_HUGE, DSS_HUGE *);
+
+void dbgen_skip_rows(int table, long long row_count) {
+  /* As row_stop(), which advances the seeds of the table and of its child table to their boundary after each row */
+  int i;
+  for (i = 0; i <= MAX_STREAM; i++) {
+    if (Seed[i].table == table || Seed[i].table == tdefs[table].child) {
+      NthElement(row_count * Seed[i].boundary, &Seed[i].value);
+    }
+  }
+}
@@ -51,3 +51,9 @@ extern distribution grammar;
 
 void dbgen_reset_seeds();
 
+/**
+ * Advances the seeds of the table with the dbgen id @param table (and of its child table, e.g., LINE for ORDER) of the
+ * current thread as if @param row_count rows had been generated, so that several threads can generate one table.
+ */
+void dbgen_skip_rows(int table, long long row_count);
+